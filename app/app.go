@@ -19,11 +19,11 @@ import (
 	"strings"
 	"sync"
 	"sync/atomic"
+	"syscall"
 	"text/template"
 	"time"
 
 	"github.com/braintree/manners"
-	"github.com/elazarl/go-bindata-assetfs"
 	"github.com/gorilla/websocket"
 	"github.com/kr/pty"
 	"github.com/yudai/hcl"
@@ -33,6 +33,12 @@ import (
 type InitMessage struct {
 	Arguments string `json:"Arguments,omitempty"`
 	AuthToken string `json:"AuthToken,omitempty"`
+	Binary    bool   `json:"Binary,omitempty"`
+	SessionID string `json:"SessionID,omitempty"`
+	Offset    int64  `json:"Offset,omitempty"`
+
+	// FlowControl is set by clients that acknowledge consumed output
+	FlowControl bool `json:"FlowControl,omitempty"`
 }
 
 type App struct {
@@ -50,6 +56,16 @@ type App struct {
 	// clientContext writes concurrently
 	// Use atomic operations.
 	connections *int64
+
+	// Commands outliving their connections
+	sessionsMutex *sync.Mutex
+	broadcast     *ptySession
+	sessions      map[string]*ptySession
+
+	// Processes started ahead of time
+	pool *processPool
+
+	metrics *metrics
 }
 
 type Options struct {
@@ -69,6 +85,7 @@ type Options struct {
 	TitleFormat         string                 `hcl:"title_format"`
 	EnableReconnect     bool                   `hcl:"enable_reconnect"`
 	ReconnectTime       int                    `hcl:"reconnect_time"`
+	ReconnectGrace      int                    `hcl:"reconnect_grace"`
 	MaxConnection       int                    `hcl:"max_connection"`
 	Once                bool                   `hcl:"once"`
 	Timeout             int                    `hcl:"timeout"`
@@ -78,6 +95,17 @@ type Options struct {
 	RawPreferences      map[string]interface{} `hcl:"preferences"`
 	Width               int                    `hcl:"width"`
 	Height              int                    `hcl:"height"`
+	FlushSize           int                    `hcl:"flush_size"`
+	FlushDelay          int                    `hcl:"flush_delay"`
+	Broadcast           bool                   `hcl:"broadcast"`
+	FlowWindow          int                    `hcl:"flow_window"`
+	WriteTimeout        int                    `hcl:"write_timeout"`
+	PoolSize            int                    `hcl:"pool_size"`
+	EnableMetrics       bool                   `hcl:"enable_metrics"`
+
+	CompressionLevel           int  `hcl:"compression_level"`
+	CompressionThreshold       int  `hcl:"compression_threshold"`
+	CompressionContextTakeover bool `hcl:"compression_context_takeover"`
 }
 
 var Version = "1.0.0"
@@ -99,12 +127,24 @@ var DefaultOptions = Options{
 	TitleFormat:         "GoTTY - {{ .Command }} ({{ .Hostname }})",
 	EnableReconnect:     false,
 	ReconnectTime:       10,
+	ReconnectGrace:      60,
 	MaxConnection:       0,
 	Once:                false,
 	CloseSignal:         1, // syscall.SIGHUP
 	Preferences:         HtermPrefernces{},
 	Width:               0,
 	Height:              0,
+	FlushSize:           64 * 1024,
+	FlushDelay:          5,
+	Broadcast:           false,
+	FlowWindow:          256 * 1024,
+	WriteTimeout:        30,
+	PoolSize:            0,
+	EnableMetrics:       false,
+
+	CompressionLevel:           1,
+	CompressionThreshold:       256,
+	CompressionContextTakeover: false,
 }
 
 func New(command []string, options *Options) (*App, error) {
@@ -123,12 +163,20 @@ func New(command []string, options *Options) (*App, error) {
 			ReadBufferSize:  1024,
 			WriteBufferSize: 1024,
 			Subprotocols:    []string{"gotty"},
+
+			EnableCompression:          options.CompressionLevel > 0,
+			CompressionContextTakeover: options.CompressionContextTakeover,
 		},
 
 		titleTemplate: titleTemplate,
 
 		onceMutex:   umutex.New(),
 		connections: &connections,
+
+		sessionsMutex: &sync.Mutex{},
+		sessions:      make(map[string]*ptySession),
+
+		metrics: newMetrics(),
 	}, nil
 }
 
@@ -156,6 +204,12 @@ func CheckConfig(options *Options) error {
 	if options.EnableTLSClientAuth && !options.EnableTLS {
 		return errors.New("TLS client authentication is enabled, but TLS is not enabled")
 	}
+	if options.FlushSize <= 0 {
+		return errors.New("Flush size must be a positive number of bytes")
+	}
+	if options.CompressionLevel < 0 || options.CompressionLevel > 9 {
+		return errors.New("Compression level must be between 0 and 9")
+	}
 	return nil
 }
 
@@ -168,6 +222,16 @@ func (app *App) Run() error {
 		log.Printf("Once option is provided, accepting only one client")
 	}
 
+	if app.options.Broadcast {
+		log.Printf("Broadcast option is provided, all clients share one command")
+	}
+
+	if app.options.PoolSize > 0 {
+		log.Printf("Keeping %d processes of the command started ahead of time", app.options.PoolSize)
+		app.pool = newProcessPool(app.command, app.options.PoolSize)
+		defer app.pool.close(syscall.Signal(app.options.CloseSignal))
+	}
+
 	path := ""
 	if app.options.EnableRandomUrl {
 		path += "/" + generateRandomString(app.options.RandomUrlLength)
@@ -178,9 +242,10 @@ func (app *App) Run() error {
 	wsHandler := http.HandlerFunc(app.handleWS)
 	customIndexHandler := http.HandlerFunc(app.handleCustomIndex)
 	authTokenHandler := http.HandlerFunc(app.handleAuthToken)
-	staticHandler := http.FileServer(
-		&assetfs.AssetFS{Asset: Asset, AssetDir: AssetDir, Prefix: "static"},
-	)
+	staticHandler, err := newAssetServer("static")
+	if err != nil {
+		return errors.New("Failed to load static files: " + err.Error())
+	}
 
 	var siteMux = http.NewServeMux()
 
@@ -193,6 +258,10 @@ func (app *App) Run() error {
 	siteMux.Handle(path+"/auth_token.js", authTokenHandler)
 	siteMux.Handle(path+"/js/", http.StripPrefix(path+"/", staticHandler))
 	siteMux.Handle(path+"/favicon.png", http.StripPrefix(path+"/", staticHandler))
+	if app.options.EnableMetrics {
+		log.Printf("Exposing metrics at %s/metrics", path)
+		siteMux.Handle(path+"/metrics", http.HandlerFunc(app.handleMetrics))
+	}
 
 	siteHandler := http.Handler(siteMux)
 
@@ -332,6 +401,9 @@ func (app *App) handleWS(w http.ResponseWriter, r *http.Request) {
 		log.Print("Failed to upgrade connection: " + err.Error())
 		return
 	}
+	if app.options.CompressionLevel > 0 {
+		conn.SetCompressionLevel(app.options.CompressionLevel)
+	}
 
 	_, stream, err := conn.ReadMessage()
 	if err != nil {
@@ -382,8 +454,46 @@ func (app *App) handleWS(w http.ResponseWriter, r *http.Request) {
 		}
 	}
 
-	cmd := exec.Command(app.command[0], argv...)
-	ptyIo, err := pty.Start(cmd)
+	context := &clientContext{
+		app:        app,
+		request:    r,
+		connection: conn,
+		writeMutex: &sync.Mutex{},
+		binary:     init.Binary,
+	}
+	if init.FlowControl && app.options.FlowWindow > 0 {
+		context.flow = newFlowControl(app.options.FlowWindow)
+	}
+
+	if app.options.Broadcast || app.resumable() {
+		var session *ptySession
+		var client *sessionClient
+		if app.options.Broadcast {
+			session, err = app.broadcastSession()
+			if err == nil {
+				client, _ = session.join(-1)
+			}
+		} else {
+			session, client, err = app.resumableSession(init.SessionID, init.Offset, argv)
+		}
+		if err != nil {
+			log.Print("Failed to execute command")
+			return
+		}
+
+		log.Printf("Client %s attached to PID %d, connections: %d",
+			r.RemoteAddr, session.command.Process.Pid, connections)
+
+		context.command = session.command
+		context.pty = session.pty
+		context.session = session
+		context.client = client
+		context.output = client
+		context.goHandleClient()
+		return
+	}
+
+	cmd, ptyIo, exited, err := app.startCommand(argv)
 	if err != nil {
 		log.Print("Failed to execute command")
 		return
@@ -397,18 +507,139 @@ func (app *App) handleWS(w http.ResponseWriter, r *http.Request) {
 			r.RemoteAddr, cmd.Process.Pid, strings.Join(argv, " "), connections)
 	}
 
-	context := &clientContext{
-		app:        app,
-		request:    r,
-		connection: conn,
-		command:    cmd,
-		pty:        ptyIo,
-		writeMutex: &sync.Mutex{},
-	}
+	context.command = cmd
+	context.pty = ptyIo
+	context.exited = exited
+	context.output = newOutputBuffer(
+		app.options.FlushSize,
+		time.Duration(app.options.FlushDelay)*time.Millisecond,
+	)
 
 	context.goHandleClient()
 }
 
+// startCommand starts the command with argv as its arguments, or claims a
+// pre-started process when the client didn't add any. The returned channel
+// is closed when the command exits; nobody else may Wait for it.
+func (app *App) startCommand(argv []string) (*exec.Cmd, *os.File, chan bool, error) {
+	defer app.metrics.spawnLatency.observeDuration(time.Now())
+
+	if app.pool != nil && len(argv) == len(app.command)-1 {
+		if cmd, ptyIo, exited, ok := app.pool.get(); ok {
+			return cmd, ptyIo, exited, nil
+		}
+		log.Printf("No pre-started process is available")
+	}
+
+	cmd := exec.Command(app.command[0], argv...)
+	ptyIo, err := pty.Start(cmd)
+	if err != nil {
+		return nil, nil, nil, err
+	}
+	return cmd, ptyIo, waitExit(cmd), nil
+}
+
+// broadcastSession returns the shared command, starting it if it is not
+// running.
+func (app *App) broadcastSession() (*ptySession, error) {
+	app.sessionsMutex.Lock()
+	defer app.sessionsMutex.Unlock()
+
+	if app.broadcast == nil || app.broadcast.isClosed() {
+		cmd, ptyIo, exited, err := app.startCommand(app.command[1:])
+		if err != nil {
+			return nil, err
+		}
+		session := newSession(cmd, ptyIo, exited, broadcastBufferSize, app.metrics)
+		log.Printf("Shared command is running with PID %d", session.command.Process.Pid)
+
+		go session.run()
+		app.broadcast = session
+	}
+	return app.broadcast, nil
+}
+
+// resumable reports whether commands are kept alive for reconnecting clients.
+func (app *App) resumable() bool {
+	return app.options.EnableReconnect && app.options.ReconnectGrace > 0
+}
+
+// resumableSession attaches to the session with the given ID at offset, or
+// starts a new session running argv if that is not possible.
+func (app *App) resumableSession(id string, offset int64, argv []string) (*ptySession, *sessionClient, error) {
+	app.sessionsMutex.Lock()
+	defer app.sessionsMutex.Unlock()
+
+	if session, ok := app.sessions[id]; ok && !session.isClosed() {
+		session.detachClients()
+		if client, ok := session.join(offset); ok {
+			session.expiry.Stop()
+			log.Printf("Resuming session with PID %d at offset %d", session.command.Process.Pid, offset)
+			return session, client, nil
+		}
+
+		log.Printf("Output of session with PID %d is no longer available", session.command.Process.Pid)
+		session.stop(syscall.Signal(app.options.CloseSignal))
+		delete(app.sessions, id)
+	}
+
+	cmd, ptyIo, exited, err := app.startCommand(argv)
+	if err != nil {
+		return nil, nil, err
+	}
+	session := newSession(cmd, ptyIo, exited, replayBufferSize, app.metrics)
+	session.id = generateRandomString(32)
+	session.expiry = time.AfterFunc(
+		time.Duration(app.options.ReconnectGrace)*time.Second,
+		func() { app.expireSession(session) },
+	)
+	session.expiry.Stop()
+	log.Printf("Command is running with PID %d (args=%q)",
+		session.command.Process.Pid, strings.Join(argv, " "))
+
+	go func() {
+		session.run()
+
+		app.sessionsMutex.Lock()
+		defer app.sessionsMutex.Unlock()
+		if app.sessions[session.id] == session {
+			delete(app.sessions, session.id)
+		}
+	}()
+	app.sessions[session.id] = session
+
+	client, _ := session.join(0)
+	return session, client, nil
+}
+
+// leaveSession detaches a client. A resumable session left without clients
+// is stopped unless a client resumes it within the grace period.
+func (app *App) leaveSession(session *ptySession, client *sessionClient) {
+	app.sessionsMutex.Lock()
+	defer app.sessionsMutex.Unlock()
+
+	if session.leave(client) > 0 || session.id == "" || session.isClosed() {
+		return
+	}
+
+	log.Printf("Keeping session with PID %d for %d seconds",
+		session.command.Process.Pid, app.options.ReconnectGrace)
+	session.expiry.Reset(time.Duration(app.options.ReconnectGrace) * time.Second)
+}
+
+func (app *App) expireSession(session *ptySession) {
+	app.sessionsMutex.Lock()
+	defer app.sessionsMutex.Unlock()
+
+	if session.clientCount() > 0 || app.sessions[session.id] != session {
+		return
+	}
+
+	log.Printf("Session with PID %d expired", session.command.Process.Pid)
+	session.stop(syscall.Signal(app.options.CloseSignal))
+	delete(app.sessions, session.id)
+}
+
 func (app *App) handleCustomIndex(w http.ResponseWriter, r *http.Request) {
 	http.ServeFile(w, r, ExpandHomeDir(app.options.IndexFile))
 }
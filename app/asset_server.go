@@ -0,0 +1,274 @@
+package app
+
+import (
+	"bytes"
+	"compress/gzip"
+	"crypto/sha1"
+	"encoding/hex"
+	"io/ioutil"
+	"log"
+	"mime"
+	"net/http"
+	"path"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+)
+
+// assetServer serves the embedded static files. Each file is kept gzip
+// compressed and sent as is to clients accepting gzip, or as the brotli
+// variant built by the Makefile when there is one. The plain content is
+// inflated once, only when a client that doesn't accept gzip asks for it.
+type assetServer struct {
+	assets map[string]*staticAsset
+}
+
+type staticAsset struct {
+	contentType string
+	modTime     time.Time
+	hash        string
+
+	gzip   []byte
+	brotli []byte
+
+	inflateOnce *sync.Once
+	inflateErr  error
+	content     []byte
+}
+
+// Caching for responses requested with the current version of the asset
+// in the "v" query parameter, and for all the others
+const (
+	versionedCacheControl   = "public, max-age=31536000, immutable"
+	unversionedCacheControl = "no-cache"
+)
+
+// newAssetServer loads the assets under prefix. Compressed variants are
+// looked up as "<name>.gz" and "<name>.br"; plain files without a gzip
+// variant are compressed here once.
+func newAssetServer(prefix string) (*assetServer, error) {
+	server := &assetServer{assets: make(map[string]*staticAsset)}
+
+	for _, name := range AssetNames() {
+		if !strings.HasPrefix(name, prefix+"/") {
+			continue
+		}
+		data, err := Asset(name)
+		if err != nil {
+			return nil, err
+		}
+		info, err := AssetInfo(name)
+		if err != nil {
+			return nil, err
+		}
+
+		extension := path.Ext(name)
+		base := strings.TrimPrefix(name, prefix+"/")
+		if extension == ".gz" || extension == ".br" {
+			base = strings.TrimSuffix(base, extension)
+		}
+
+		asset := server.asset(base)
+		switch extension {
+		case ".gz":
+			asset.gzip = data
+		case ".br":
+			asset.brotli = data
+		default:
+			asset.content = data
+		}
+		if info.ModTime().After(asset.modTime) {
+			asset.modTime = info.ModTime()
+		}
+	}
+
+	for name, asset := range server.assets {
+		if asset.gzip == nil {
+			if asset.content == nil {
+				log.Printf("Ignoring static file without plain or gzip content: %s", name)
+				delete(server.assets, name)
+				continue
+			}
+			compressed, err := compressAsset(asset.content)
+			if err != nil {
+				return nil, err
+			}
+			asset.gzip = compressed
+		}
+		asset.hash = hashAsset(asset.gzip)
+	}
+
+	if index, ok := server.assets["index.html"]; ok {
+		if err := server.versionReferences(index); err != nil {
+			return nil, err
+		}
+	}
+
+	return server, nil
+}
+
+func (server *assetServer) asset(name string) *staticAsset {
+	asset, ok := server.assets[name]
+	if !ok {
+		contentType := mime.TypeByExtension(path.Ext(name))
+		if contentType == "" {
+			contentType = "application/octet-stream"
+		}
+		asset = &staticAsset{
+			contentType: contentType,
+			inflateOnce: &sync.Once{},
+		}
+		server.assets[name] = asset
+	}
+	return asset
+}
+
+// versionReferences makes the page refer to the other assets with their
+// current version, so that browsers can cache them for good.
+func (server *assetServer) versionReferences(index *staticAsset) error {
+	content, err := index.plain()
+	if err != nil {
+		return err
+	}
+
+	for name, asset := range server.assets {
+		if asset == index {
+			continue
+		}
+		versioned := []byte(`"./` + name + `?v=` + asset.hash + `"`)
+		content = bytes.Replace(content, []byte(`"./`+name+`"`), versioned, -1)
+		content = bytes.Replace(content, []byte(`"`+name+`"`), versioned, -1)
+	}
+
+	compressed, err := compressAsset(content)
+	if err != nil {
+		return err
+	}
+	index.content = content
+	index.gzip = compressed
+	index.brotli = nil
+	index.hash = hashAsset(compressed)
+	return nil
+}
+
+func (server *assetServer) ServeHTTP(w http.ResponseWriter, r *http.Request) {
+	name := strings.TrimPrefix(r.URL.Path, "/")
+	if name == "" || strings.HasSuffix(name, "/") {
+		name += "index.html"
+	}
+
+	asset, ok := server.assets[name]
+	if !ok {
+		http.NotFound(w, r)
+		return
+	}
+
+	header := w.Header()
+	header.Set("Content-Type", asset.contentType)
+	header.Set("Last-Modified", asset.modTime.UTC().Format(http.TimeFormat))
+	header.Add("Vary", "Accept-Encoding")
+	if r.URL.Query().Get("v") == asset.hash {
+		header.Set("Cache-Control", versionedCacheControl)
+	} else {
+		header.Set("Cache-Control", unversionedCacheControl)
+	}
+
+	var body []byte
+	var etag string
+	switch {
+	case asset.brotli != nil && acceptsEncoding(r, "br"):
+		header.Set("Content-Encoding", "br")
+		body, etag = asset.brotli, `"`+asset.hash+`-br"`
+	case acceptsEncoding(r, "gzip"):
+		header.Set("Content-Encoding", "gzip")
+		body, etag = asset.gzip, `"`+asset.hash+`-gzip"`
+	default:
+		content, err := asset.plain()
+		if err != nil {
+			http.Error(w, "Internal Server Error", http.StatusInternalServerError)
+			return
+		}
+		body, etag = content, `"`+asset.hash+`"`
+	}
+	header.Set("ETag", etag)
+
+	if matchesETag(r.Header.Get("If-None-Match"), etag) {
+		w.WriteHeader(http.StatusNotModified)
+		return
+	}
+
+	header.Set("Content-Length", strconv.Itoa(len(body)))
+	if r.Method == "HEAD" {
+		return
+	}
+	w.Write(body)
+}
+
+// plain returns the uncompressed content, inflating it on first use.
+func (asset *staticAsset) plain() ([]byte, error) {
+	asset.inflateOnce.Do(func() {
+		if asset.content != nil {
+			return
+		}
+		reader, err := gzip.NewReader(bytes.NewReader(asset.gzip))
+		if err == nil {
+			asset.content, err = ioutil.ReadAll(reader)
+		}
+		asset.inflateErr = err
+	})
+	return asset.content, asset.inflateErr
+}
+
+// matchesETag reports whether an If-None-Match header value names etag.
+// The comparison is weak, as required for If-None-Match.
+func matchesETag(header string, etag string) bool {
+	if header == "" {
+		return false
+	}
+	for _, tag := range strings.Split(header, ",") {
+		tag = strings.TrimSpace(tag)
+		if tag == "*" || strings.TrimPrefix(tag, "W/") == etag {
+			return true
+		}
+	}
+	return false
+}
+
+func acceptsEncoding(r *http.Request, encoding string) bool {
+	for _, accepted := range strings.Split(r.Header.Get("Accept-Encoding"), ",") {
+		parts := strings.Split(accepted, ";")
+		if strings.TrimSpace(parts[0]) != encoding {
+			continue
+		}
+		for _, parameter := range parts[1:] {
+			parameter = strings.TrimSpace(parameter)
+			if strings.HasPrefix(parameter, "q=") {
+				q, err := strconv.ParseFloat(parameter[2:], 64)
+				return err == nil && q > 0
+			}
+		}
+		return true
+	}
+	return false
+}
+
+func compressAsset(content []byte) ([]byte, error) {
+	var compressed bytes.Buffer
+	writer, err := gzip.NewWriterLevel(&compressed, gzip.BestCompression)
+	if err != nil {
+		return nil, err
+	}
+	if _, err := writer.Write(content); err != nil {
+		return nil, err
+	}
+	if err := writer.Close(); err != nil {
+		return nil, err
+	}
+	return compressed.Bytes(), nil
+}
+
+func hashAsset(data []byte) string {
+	sum := sha1.Sum(data)
+	return hex.EncodeToString(sum[:8])
+}
@@ -8,10 +8,12 @@ import (
 	"net/http"
 	"os"
 	"os/exec"
+	"strconv"
 	"strings"
 	"sync"
 	"sync/atomic"
 	"syscall"
+	"time"
 	"unsafe"
 
 	"github.com/fatih/structs"
@@ -24,13 +26,36 @@ type clientContext struct {
 	connection *websocket.Conn
 	command    *exec.Cmd
 	pty        *os.File
+	exited     chan bool
 	writeMutex *sync.Mutex
+	output     outputSource
+
+	// session is set when the command outlives the connection or is
+	// shared with other clients.
+	session *ptySession
+	client  *sessionClient
+
+	// binary is negotiated in the init message and makes Output
+	// messages carry raw PTY bytes in binary frames instead of base64 text.
+	binary bool
+
+	// flow is set when the client acknowledges consumed output.
+	flow *flowControl
+
+	// Nanoseconds spent writing to the websocket and waiting for
+	// acknowledgements, accessed atomically
+	writeBlocked int64
+	flowBlocked  int64
+
+	// Bytes of messages written, accessed atomically
+	bytesSent int64
 }
 
 const (
 	Input          = '0'
 	Ping           = '1'
 	ResizeTerminal = '2'
+	Acknowledge    = '3'
 )
 
 const (
@@ -39,13 +64,23 @@ const (
 	SetWindowTitle = '2'
 	SetPreferences = '3'
 	SetReconnect   = '4'
+	SetSession     = '5'
+	SetFlowControl = '6'
 )
 
+// readBufferSize is large enough to drain bursts of output with one read.
+const readBufferSize = 64 * 1024
+
 type argResizeTerminal struct {
 	Columns float64
 	Rows    float64
 }
 
+type argSetSession struct {
+	ID     string
+	Offset int64
+}
+
 type ContextVars struct {
 	Command    string
 	Pid        int
@@ -56,6 +91,10 @@ type ContextVars struct {
 func (context *clientContext) goHandleClient() {
 	exit := make(chan bool, 2)
 
+	if context.session == nil {
+		go context.processOutput(context.output.(*outputBuffer))
+	}
+
 	go func() {
 		defer func() { exit <- true }()
 
@@ -80,6 +119,14 @@ func (context *clientContext) goHandleClient() {
 				log.Printf("Connection closed: %s, connections: %d",
 					context.request.RemoteAddr, connections)
 			}
+			log.Printf("Client %s was blocked for %s on writes and %s on acknowledgements",
+				context.request.RemoteAddr,
+				time.Duration(atomic.LoadInt64(&context.writeBlocked)),
+				time.Duration(atomic.LoadInt64(&context.flowBlocked)))
+			log.Printf("Client %s was sent %d bytes of messages in %d bytes",
+				context.request.RemoteAddr,
+				atomic.LoadInt64(&context.bytesSent),
+				context.connection.BytesWritten())
 
 			if connections == 0 {
 				context.app.restartTimer()
@@ -87,33 +134,96 @@ func (context *clientContext) goHandleClient() {
 		}()
 
 		<-exit
+		if context.flow != nil {
+			context.flow.close()
+		}
+		if context.session != nil {
+			context.app.leaveSession(context.session, context.client)
+			context.connection.Close()
+			return
+		}
+
 		context.pty.Close()
 
 		// Even if the PTY has been closed,
 		// Read(0 in processSend() keeps blocking and the process doen't exit
 		context.command.Process.Signal(syscall.Signal(context.app.options.CloseSignal))
 
-		context.command.Wait()
+		<-context.exited
 		context.connection.Close()
 	}()
 }
 
+// processOutput moves PTY output into the output buffer until the command
+// exits or the writer stops.
+func (context *clientContext) processOutput(output *outputBuffer) {
+	defer output.Close()
+
+	buf := frameBufferPool.Get().([]byte)
+	defer frameBufferPool.Put(buf)
+	buf = buf[:readBufferSize]
+
+	for {
+		size, err := context.pty.Read(buf)
+		if err != nil {
+			log.Printf("Command exited for: %s", context.request.RemoteAddr)
+			return
+		}
+		context.app.metrics.ptyReadSize.observe(float64(size))
+		if _, err := output.Write(buf[:size]); err != nil {
+			return
+		}
+	}
+}
+
+// processSend writes buffered output to the websocket, so that a slow
+// connection does not block the PTY reader for every chunk.
 func (context *clientContext) processSend() {
+	defer context.output.Close()
+
 	if err := context.sendInitialize(); err != nil {
 		log.Printf(err.Error())
 		return
 	}
 
-	buf := make([]byte, 1024)
+	frame := frameBufferPool.Get().([]byte)
+	defer func() { frameBufferPool.Put(frame) }()
+
+	var encoded []byte
 
 	for {
-		size, err := context.pty.Read(buf)
-		if err != nil {
-			log.Printf("Command exited for: %s", context.request.RemoteAddr)
+		var ok bool
+		frame, ok = context.output.Next(frame)
+		if !ok {
 			return
 		}
-		safeMessage := base64.StdEncoding.EncodeToString([]byte(buf[:size]))
-		if err = context.write(append([]byte{Output}, []byte(safeMessage)...)); err != nil {
+		frame[0] = Output
+
+		if context.flow != nil {
+			start := time.Now()
+			ok := context.flow.wait(len(frame) - 1)
+			blocked := int64(time.Since(start))
+			atomic.AddInt64(&context.flowBlocked, blocked)
+			context.app.metrics.flowControlWait.add(blocked)
+			if !ok {
+				return
+			}
+		}
+
+		var err error
+		if context.binary {
+			err = context.writeMessage(websocket.BinaryMessage, frame)
+		} else {
+			size := 1 + base64.StdEncoding.EncodedLen(len(frame)-1)
+			if cap(encoded) < size {
+				encoded = make([]byte, size, 1+base64.StdEncoding.EncodedLen(cap(frame)-1))
+			}
+			encoded = encoded[:size]
+			encoded[0] = Output
+			base64.StdEncoding.Encode(encoded[1:], frame[1:])
+			err = context.write(encoded)
+		}
+		if err != nil {
 			log.Printf(err.Error())
 			return
 		}
@@ -121,9 +231,36 @@ func (context *clientContext) processSend() {
 }
 
 func (context *clientContext) write(data []byte) error {
+	return context.writeMessage(websocket.TextMessage, data)
+}
+
+func (context *clientContext) writeMessage(messageType int, data []byte) error {
+	metrics := context.app.metrics
+	start := time.Now()
+	defer func() {
+		atomic.AddInt64(&context.writeBlocked, int64(time.Since(start)))
+		metrics.writeLatency.observeDuration(start)
+	}()
+
 	context.writeMutex.Lock()
 	defer context.writeMutex.Unlock()
-	return context.connection.WriteMessage(websocket.TextMessage, data)
+	metrics.writeMutexWait.add(int64(time.Since(start)))
+	metrics.framesSent.add(1)
+	metrics.bytesSent.add(int64(len(data)))
+	atomic.AddInt64(&context.bytesSent, int64(len(data)))
+
+	if timeout := context.app.options.WriteTimeout; timeout > 0 {
+		context.connection.SetWriteDeadline(start.Add(time.Duration(timeout) * time.Second))
+	}
+
+	// Small frames are mostly keystroke echoes, where compression only
+	// adds latency.
+	context.connection.EnableWriteCompression(len(data) >= context.app.options.CompressionThreshold)
+
+	written := context.connection.BytesWritten()
+	err := context.connection.WriteMessage(messageType, data)
+	metrics.wireBytesSent.add(context.connection.BytesWritten() - written)
+	return err
 }
 
 func (context *clientContext) sendInitialize() error {
@@ -166,10 +303,32 @@ func (context *clientContext) sendInitialize() error {
 			return err
 		}
 	}
+	if context.flow != nil {
+		window, _ := json.Marshal(context.flow.window)
+		if err := context.write(append([]byte{SetFlowControl}, window...)); err != nil {
+			return err
+		}
+	}
+	if context.session != nil && context.session.id != "" {
+		session, _ := json.Marshal(argSetSession{
+			ID:     context.session.id,
+			Offset: context.client.cursor,
+		})
+		if err := context.write(append([]byte{SetSession}, session...)); err != nil {
+			return err
+		}
+	}
 	return nil
 }
 
 func (context *clientContext) processReceive() {
+	input := newInputQueue()
+	defer input.close()
+	go context.processInput(input)
+
+	resizer := newWindowResizer(context.pty)
+	defer resizer.stop()
+
 	for {
 		_, data, err := context.connection.ReadMessage()
 		if err != nil {
@@ -180,24 +339,46 @@ func (context *clientContext) processReceive() {
 			log.Print("An error has occured")
 			return
 		}
+		context.app.metrics.framesReceived.add(1)
+		context.app.metrics.bytesReceived.add(int64(len(data)))
 
 		switch data[0] {
 		case Input:
-			if !context.app.options.PermitWrite {
+			if !context.app.options.PermitWrite || !context.ownsInput() {
+				break
+			}
+
+			if len(data) > 1 && !input.push(data[1:]) {
+				return
+			}
+
+		case Acknowledge:
+			if context.flow == nil {
 				break
 			}
 
-			_, err := context.pty.Write(data[1:])
+			total, err := strconv.ParseInt(string(data[1:]), 10, 64)
 			if err != nil {
+				log.Print("Malformed remote command")
 				return
 			}
+			context.flow.acknowledge(total)
 
 		case Ping:
+			// Clients report the round trip time of the previous ping
+			// in milliseconds
+			if rtt, err := strconv.ParseFloat(string(data[1:]), 64); err == nil && rtt >= 0 {
+				context.app.metrics.pingRTT.observe(rtt / 1000)
+			}
 			if err := context.write([]byte{Pong}); err != nil {
 				log.Print(err.Error())
 				return
 			}
 		case ResizeTerminal:
+			if !context.ownsInput() {
+				break
+			}
+
 			var args argResizeTerminal
 			err = json.Unmarshal(data[1:], &args)
 			if err != nil {
@@ -215,23 +396,7 @@ func (context *clientContext) processReceive() {
 				columns = uint16(args.Columns)
 			}
 
-			window := struct {
-				row uint16
-				col uint16
-				x   uint16
-				y   uint16
-			}{
-				rows,
-				columns,
-				0,
-				0,
-			}
-			syscall.Syscall(
-				syscall.SYS_IOCTL,
-				context.pty.Fd(),
-				syscall.TIOCSWINSZ,
-				uintptr(unsafe.Pointer(&window)),
-			)
+			resizer.resize(rows, columns)
 
 		default:
 			log.Print("Unknown message type")
@@ -239,3 +404,44 @@ func (context *clientContext) processReceive() {
 		}
 	}
 }
+
+// processInput writes queued input to the PTY.
+func (context *clientContext) processInput(input *inputQueue) {
+	defer input.close()
+
+	for {
+		data, ok := input.next()
+		if !ok {
+			return
+		}
+		if _, err := context.pty.Write(data); err != nil {
+			return
+		}
+	}
+}
+
+// ownsInput reports whether the client may write to and resize the PTY.
+// In broadcast mode only the earliest connected client does.
+func (context *clientContext) ownsInput() bool {
+	return context.session == nil || context.session.isOwner(context.client)
+}
+
+func setWindowSize(pty *os.File, rows uint16, columns uint16) {
+	window := struct {
+		row uint16
+		col uint16
+		x   uint16
+		y   uint16
+	}{
+		rows,
+		columns,
+		0,
+		0,
+	}
+	syscall.Syscall(
+		syscall.SYS_IOCTL,
+		pty.Fd(),
+		syscall.TIOCSWINSZ,
+		uintptr(unsafe.Pointer(&window)),
+	)
+}
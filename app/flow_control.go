@@ -0,0 +1,64 @@
+package app
+
+import (
+	"sync"
+)
+
+// flowControl limits the output sent to a client but not yet acknowledged
+// as consumed, so that a client which cannot keep up holds back the writer
+// instead of buffering without bounds in the browser.
+type flowControl struct {
+	window int64
+
+	mutex  *sync.Mutex
+	cond   *sync.Cond
+	sent   int64
+	acked  int64
+	closed bool
+}
+
+func newFlowControl(window int) *flowControl {
+	mutex := &sync.Mutex{}
+	return &flowControl{
+		window: int64(window),
+		mutex:  mutex,
+		cond:   sync.NewCond(mutex),
+	}
+}
+
+// wait blocks until size more bytes fit in the window, then counts them as
+// sent. A frame larger than the window is let through once everything
+// before it has been acknowledged. It returns false if closed.
+func (flow *flowControl) wait(size int) bool {
+	flow.mutex.Lock()
+	defer flow.mutex.Unlock()
+
+	for !flow.closed {
+		inFlight := flow.sent - flow.acked
+		if inFlight == 0 || inFlight+int64(size) <= flow.window {
+			flow.sent += int64(size)
+			return true
+		}
+		flow.cond.Wait()
+	}
+	return false
+}
+
+// acknowledge records the total number of bytes consumed by the client.
+func (flow *flowControl) acknowledge(total int64) {
+	flow.mutex.Lock()
+	defer flow.mutex.Unlock()
+
+	if total > flow.acked && total <= flow.sent {
+		flow.acked = total
+		flow.cond.Broadcast()
+	}
+}
+
+func (flow *flowControl) close() {
+	flow.mutex.Lock()
+	defer flow.mutex.Unlock()
+
+	flow.closed = true
+	flow.cond.Broadcast()
+}
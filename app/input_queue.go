@@ -0,0 +1,80 @@
+package app
+
+import (
+	"sync"
+)
+
+// maxPendingInput is how much input may wait for the PTY before the
+// websocket reader is held back.
+const maxPendingInput = 1024 * 1024
+
+// inputQueue passes input from the websocket reader to the goroutine
+// writing it to the PTY. Input frames arriving while the PTY is busy are
+// appended to each other and written with a single write, and control
+// messages such as acknowledgements keep being read during a large paste.
+type inputQueue struct {
+	mutex   *sync.Mutex
+	cond    *sync.Cond
+	pending []byte
+	closed  bool
+}
+
+func newInputQueue() *inputQueue {
+	mutex := &sync.Mutex{}
+	return &inputQueue{
+		mutex: mutex,
+		cond:  sync.NewCond(mutex),
+	}
+}
+
+// push queues data, taking ownership of it. It blocks while too much input
+// is pending, and returns false if the queue is closed.
+func (queue *inputQueue) push(data []byte) bool {
+	queue.mutex.Lock()
+	defer queue.mutex.Unlock()
+
+	for !queue.closed && len(queue.pending) >= maxPendingInput {
+		queue.cond.Wait()
+	}
+	if queue.closed {
+		return false
+	}
+
+	if len(queue.pending) == 0 {
+		// Nothing to append to, typically a keystroke or a whole paste:
+		// hand over the frame itself.
+		queue.pending = data
+	} else {
+		queue.pending = append(queue.pending, data...)
+	}
+	queue.cond.Broadcast()
+	return true
+}
+
+// next waits for input and returns all of it. It returns false once the
+// queue is closed.
+func (queue *inputQueue) next() ([]byte, bool) {
+	queue.mutex.Lock()
+	defer queue.mutex.Unlock()
+
+	for !queue.closed && len(queue.pending) == 0 {
+		queue.cond.Wait()
+	}
+	if queue.closed {
+		return nil, false
+	}
+
+	data := queue.pending
+	queue.pending = nil
+	queue.cond.Broadcast()
+	return data, true
+}
+
+func (queue *inputQueue) close() {
+	queue.mutex.Lock()
+	defer queue.mutex.Unlock()
+
+	queue.closed = true
+	queue.pending = nil
+	queue.cond.Broadcast()
+}
@@ -0,0 +1,151 @@
+package app
+
+import (
+	"bytes"
+	"fmt"
+	"math"
+	"net/http"
+	"strconv"
+	"sync/atomic"
+	"time"
+)
+
+// metrics are updated with atomic operations only, so that they can be
+// collected all the time without slowing down the connections.
+type metrics struct {
+	bytesSent        counter
+	wireBytesSent    counter
+	framesSent       counter
+	bytesReceived    counter
+	framesReceived   counter
+	writeMutexWait   counter // nanoseconds
+	flowControlWait  counter // nanoseconds
+	slowClientsDrops counter
+
+	ptyReadSize  *histogram
+	writeLatency *histogram
+	pingRTT      *histogram
+	spawnLatency *histogram
+}
+
+func newMetrics() *metrics {
+	return &metrics{
+		ptyReadSize:  newHistogram(64, 256, 1024, 4096, 16384, 65536),
+		writeLatency: newHistogram(.0001, .0005, .001, .005, .01, .05, .1, .5, 1, 5),
+		pingRTT:      newHistogram(.001, .005, .01, .025, .05, .1, .25, .5, 1, 2.5),
+		spawnLatency: newHistogram(.001, .005, .01, .05, .1, .25, .5, 1, 2.5, 5),
+	}
+}
+
+type counter struct {
+	value int64
+}
+
+func (c *counter) add(delta int64) {
+	atomic.AddInt64(&c.value, delta)
+}
+
+func (c *counter) get() int64 {
+	return atomic.LoadInt64(&c.value)
+}
+
+// histogram counts observations in buckets with the given upper bounds.
+type histogram struct {
+	bounds  []float64
+	buckets []uint64 // the last one counts values above all bounds
+	sum     uint64   // float64 bits
+}
+
+func newHistogram(bounds ...float64) *histogram {
+	return &histogram{
+		bounds:  bounds,
+		buckets: make([]uint64, len(bounds)+1),
+	}
+}
+
+func (h *histogram) observe(value float64) {
+	i := 0
+	for i < len(h.bounds) && value > h.bounds[i] {
+		i++
+	}
+	atomic.AddUint64(&h.buckets[i], 1)
+
+	for {
+		old := atomic.LoadUint64(&h.sum)
+		sum := math.Float64bits(math.Float64frombits(old) + value)
+		if atomic.CompareAndSwapUint64(&h.sum, old, sum) {
+			return
+		}
+	}
+}
+
+func (h *histogram) observeDuration(start time.Time) {
+	h.observe(time.Since(start).Seconds())
+}
+
+func (h *histogram) write(buffer *bytes.Buffer, name string, help string) {
+	fmt.Fprintf(buffer, "# HELP %s %s\n# TYPE %s histogram\n", name, help, name)
+	cumulative := uint64(0)
+	for i, bound := range h.bounds {
+		cumulative += atomic.LoadUint64(&h.buckets[i])
+		fmt.Fprintf(buffer, "%s_bucket{le=\"%s\"} %d\n",
+			name, strconv.FormatFloat(bound, 'g', -1, 64), cumulative)
+	}
+	cumulative += atomic.LoadUint64(&h.buckets[len(h.bounds)])
+	fmt.Fprintf(buffer, "%s_bucket{le=\"+Inf\"} %d\n", name, cumulative)
+	fmt.Fprintf(buffer, "%s_sum %s\n", name,
+		strconv.FormatFloat(math.Float64frombits(atomic.LoadUint64(&h.sum)), 'g', -1, 64))
+	fmt.Fprintf(buffer, "%s_count %d\n", name, cumulative)
+}
+
+func writeMetric(buffer *bytes.Buffer, name string, kind string, help string, value string) {
+	fmt.Fprintf(buffer, "# HELP %s %s\n# TYPE %s %s\n%s %s\n", name, help, name, kind, name, value)
+}
+
+func seconds(nanoseconds int64) string {
+	return strconv.FormatFloat(time.Duration(nanoseconds).Seconds(), 'g', -1, 64)
+}
+
+// handleMetrics exposes the metrics in the Prometheus text format.
+func (app *App) handleMetrics(w http.ResponseWriter, r *http.Request) {
+	m := app.metrics
+	buffer := new(bytes.Buffer)
+
+	writeMetric(buffer, "gotty_sessions_active", "gauge",
+		"Number of connected clients.",
+		strconv.FormatInt(atomic.LoadInt64(app.connections), 10))
+	fmt.Fprintf(buffer, "# HELP gotty_websocket_bytes_total Bytes of websocket messages.\n"+
+		"# TYPE gotty_websocket_bytes_total counter\n"+
+		"gotty_websocket_bytes_total{direction=\"sent\"} %d\n"+
+		"gotty_websocket_bytes_total{direction=\"received\"} %d\n",
+		m.bytesSent.get(), m.bytesReceived.get())
+	fmt.Fprintf(buffer, "# HELP gotty_websocket_frames_total Number of websocket messages.\n"+
+		"# TYPE gotty_websocket_frames_total counter\n"+
+		"gotty_websocket_frames_total{direction=\"sent\"} %d\n"+
+		"gotty_websocket_frames_total{direction=\"received\"} %d\n",
+		m.framesSent.get(), m.framesReceived.get())
+	writeMetric(buffer, "gotty_websocket_wire_bytes_sent_total", "counter",
+		"Bytes written to the network for sent messages, after compression.",
+		strconv.FormatInt(m.wireBytesSent.get(), 10))
+	writeMetric(buffer, "gotty_write_mutex_wait_seconds_total", "counter",
+		"Time spent waiting for the websocket write lock.",
+		seconds(m.writeMutexWait.get()))
+	writeMetric(buffer, "gotty_flow_control_wait_seconds_total", "counter",
+		"Time spent waiting for clients to acknowledge output.",
+		seconds(m.flowControlWait.get()))
+	writeMetric(buffer, "gotty_slow_clients_dropped_total", "counter",
+		"Number of clients dropped for falling behind a shared session.",
+		strconv.FormatInt(m.slowClientsDrops.get(), 10))
+
+	m.ptyReadSize.write(buffer, "gotty_pty_read_bytes",
+		"Size of reads from the PTY.")
+	m.writeLatency.write(buffer, "gotty_websocket_write_seconds",
+		"Latency of websocket writes, including waiting for the write lock.")
+	m.pingRTT.write(buffer, "gotty_ping_rtt_seconds",
+		"Round trip time of ping messages reported by clients.")
+	m.spawnLatency.write(buffer, "gotty_process_spawn_seconds",
+		"Time to start or claim the process for a client.")
+
+	w.Header().Set("Content-Type", "text/plain; version=0.0.4")
+	w.Write(buffer.Bytes())
+}
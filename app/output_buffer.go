@@ -0,0 +1,161 @@
+package app
+
+import (
+	"errors"
+	"sync"
+	"time"
+)
+
+// outputSource provides the frames written by processSend.
+type outputSource interface {
+	// Next returns the next frame, reusing the buffer of the given one.
+	Next(frame []byte) ([]byte, bool)
+	Close()
+}
+
+// outputBuffer sits between the PTY reader and the websocket writer.
+// Output is accumulated until flushSize bytes are pending or flushDelay has
+// passed since the previous frame, so programs writing many small chunks
+// produce few frames. Output arriving after an idle period is flushed at
+// once to keep keystroke echo responsive.
+type outputBuffer struct {
+	flushSize  int
+	flushDelay time.Duration
+
+	mutex   *sync.Mutex
+	drained *sync.Cond
+	pending []byte
+	closed  bool
+
+	ready chan bool // notified on new output, closed by Close()
+	full  chan bool // notified when flushSize is reached
+
+	// Used only by the writer
+	timer     *time.Timer
+	lastFlush time.Time
+}
+
+var errOutputClosed = errors.New("Output buffer closed")
+
+// frameBufferPool recycles buffers for PTY reads and websocket frames.
+// Frames start with one byte reserved for the message opcode.
+var frameBufferPool = sync.Pool{
+	New: func() interface{} {
+		return make([]byte, 1, 1+2*readBufferSize)
+	},
+}
+
+func newOutputBuffer(flushSize int, flushDelay time.Duration) *outputBuffer {
+	mutex := &sync.Mutex{}
+	timer := time.NewTimer(flushDelay)
+	timer.Stop()
+
+	return &outputBuffer{
+		flushSize:  flushSize,
+		flushDelay: flushDelay,
+
+		mutex:   mutex,
+		drained: sync.NewCond(mutex),
+		pending: frameBufferPool.Get().([]byte)[:1],
+
+		ready: make(chan bool, 1),
+		full:  make(chan bool, 1),
+
+		timer: timer,
+	}
+}
+
+// Write appends output for the next frames. Frames hold at most flushSize
+// bytes, so it blocks while a full frame is waiting for the writer and the
+// rest of p doesn't fit.
+func (buffer *outputBuffer) Write(p []byte) (int, error) {
+	buffer.mutex.Lock()
+	defer buffer.mutex.Unlock()
+
+	written := 0
+	for written < len(p) {
+		for !buffer.closed && len(buffer.pending)-1 >= buffer.flushSize {
+			buffer.drained.Wait()
+		}
+		if buffer.closed {
+			return written, errOutputClosed
+		}
+
+		size := buffer.flushSize - (len(buffer.pending) - 1)
+		if size > len(p)-written {
+			size = len(p) - written
+		}
+		buffer.pending = append(buffer.pending, p[written:written+size]...)
+		written += size
+
+		notify(buffer.ready)
+		if len(buffer.pending)-1 >= buffer.flushSize {
+			notify(buffer.full)
+		}
+	}
+	return written, nil
+}
+
+// Close makes the writer return the remaining output and stop.
+func (buffer *outputBuffer) Close() {
+	buffer.mutex.Lock()
+	defer buffer.mutex.Unlock()
+
+	if buffer.closed {
+		return
+	}
+	buffer.closed = true
+	close(buffer.ready)
+	buffer.drained.Broadcast()
+}
+
+// Next waits for the next frame and swaps it with frame, a buffer obtained
+// from frameBufferPool or a previous call. It returns false once the buffer
+// has been closed and drained.
+func (buffer *outputBuffer) Next(frame []byte) ([]byte, bool) {
+	for {
+		<-buffer.ready
+
+		if wait := buffer.flushDelay - time.Since(buffer.lastFlush); wait > 0 {
+			buffer.timer.Reset(wait)
+			select {
+			case <-buffer.timer.C:
+			case <-buffer.full:
+				if !buffer.timer.Stop() {
+					<-buffer.timer.C
+				}
+			}
+		}
+
+		buffer.mutex.Lock()
+		if len(buffer.pending) <= 1 {
+			closed := buffer.closed
+			if closed {
+				frameBufferPool.Put(buffer.pending)
+				buffer.pending = nil
+			}
+			buffer.mutex.Unlock()
+			if closed {
+				return frame, false
+			}
+			continue
+		}
+		frame, buffer.pending = buffer.pending, frame[:1]
+		select {
+		case <-buffer.full:
+		default:
+		}
+		buffer.drained.Broadcast()
+		buffer.mutex.Unlock()
+
+		buffer.lastFlush = time.Now()
+		return frame, true
+	}
+}
+
+func notify(c chan bool) {
+	select {
+	case c <- true:
+	default:
+	}
+}
@@ -0,0 +1,130 @@
+package app
+
+import (
+	"log"
+	"os"
+	"os/exec"
+	"syscall"
+	"time"
+
+	"github.com/kr/pty"
+)
+
+// Terminal size of pre-started processes until a client resizes them
+const (
+	poolRows    = 24
+	poolColumns = 80
+)
+
+// processPool keeps processes of the command started ahead of time, so that
+// a new client doesn't wait for the command to start up. It is refilled in
+// the background as clients claim processes.
+type processPool struct {
+	argv      []string
+	processes chan *pooledProcess
+	// slots holds a token for each process that may be started, so that
+	// no more than the pool size are ever running unclaimed
+	slots   chan bool
+	done    chan bool
+	stopped chan bool
+}
+
+type pooledProcess struct {
+	command *exec.Cmd
+	pty     *os.File
+	exited  chan bool
+}
+
+// waitExit reaps cmd in the background and returns a channel that is closed
+// once it has exited. Wait can only be called once, so everyone else waits
+// on the channel instead.
+func waitExit(cmd *exec.Cmd) chan bool {
+	exited := make(chan bool)
+	go func() {
+		cmd.Wait()
+		close(exited)
+	}()
+	return exited
+}
+
+func newProcessPool(argv []string, size int) *processPool {
+	pool := &processPool{
+		argv:      argv,
+		processes: make(chan *pooledProcess, size),
+		slots:     make(chan bool, size),
+		done:      make(chan bool),
+		stopped:   make(chan bool),
+	}
+	for i := 0; i < size; i++ {
+		pool.slots <- true
+	}
+	go pool.fill()
+	return pool
+}
+
+// fill starts a process whenever there is room in the pool.
+func (pool *processPool) fill() {
+	defer close(pool.stopped)
+
+	for {
+		select {
+		case <-pool.slots:
+		case <-pool.done:
+			return
+		}
+
+		cmd := exec.Command(pool.argv[0], pool.argv[1:]...)
+		ptyIo, err := pty.Start(cmd)
+		if err != nil {
+			log.Printf("Failed to pre-start command: %s", err.Error())
+			pool.slots <- true
+			select {
+			case <-time.After(time.Second):
+				continue
+			case <-pool.done:
+				return
+			}
+		}
+		setWindowSize(ptyIo, poolRows, poolColumns)
+
+		// There is a slot, so this never blocks
+		pool.processes <- &pooledProcess{command: cmd, pty: ptyIo, exited: waitExit(cmd)}
+	}
+}
+
+// get claims a pre-started process, or returns false if none is ready.
+// The returned channel is closed when the process exits.
+func (pool *processPool) get() (*exec.Cmd, *os.File, chan bool, bool) {
+	for {
+		select {
+		case process := <-pool.processes:
+			pool.slots <- true
+			// Skip processes that died while waiting
+			select {
+			case <-process.exited:
+				process.pty.Close()
+				continue
+			default:
+			}
+			return process.command, process.pty, process.exited, true
+		default:
+			return nil, nil, nil, false
+		}
+	}
+}
+
+// close stops refilling and terminates the processes left in the pool.
+func (pool *processPool) close(signal syscall.Signal) {
+	close(pool.done)
+	<-pool.stopped
+	for {
+		select {
+		case process := <-pool.processes:
+			process.pty.Close()
+			process.command.Process.Signal(signal)
+			<-process.exited
+		default:
+			return
+		}
+	}
+}
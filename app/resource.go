@@ -1,18 +1,15 @@
 // Code generated by go-bindata.
 // sources:
 // bindata/static/favicon.png
-// bindata/static/index.html
-// bindata/static/js/gotty.js
-// bindata/static/js/hterm.js
+// bindata/static/index.html.gz
+// bindata/static/js/gotty.js.gz
+// bindata/static/js/hterm.js.gz
 // DO NOT EDIT!
 
 package app
 
 import (
-	"bytes"
-	"compress/gzip"
 	"fmt"
-	"io"
 	"io/ioutil"
 	"os"
 	"path/filepath"
@@ -20,26 +17,6 @@ import (
 	"time"
 )
 
-func bindataRead(data []byte, name string) ([]byte, error) {
-	gz, err := gzip.NewReader(bytes.NewBuffer(data))
-	if err != nil {
-		return nil, fmt.Errorf("Read %q: %v", name, err)
-	}
-
-	var buf bytes.Buffer
-	_, err = io.Copy(&buf, gz)
-	clErr := gz.Close()
-
-	if err != nil {
-		return nil, fmt.Errorf("Read %q: %v", name, err)
-	}
-	if clErr != nil {
-		return nil, err
-	}
-
-	return buf.Bytes(), nil
-}
-
 type asset struct {
 	bytes []byte
 	info  os.FileInfo
@@ -71,13 +48,10 @@ func (fi bindataFileInfo) Sys() interface{} {
 	return nil
 }
 
-var _staticFaviconPng = []byte("\x1f\x8b\x08\x00\x00\x09\x6e\x88\x00\xff\x00\x5f\x03\xa0\xfc\x89\x50\x4e\x47\x0d\x0a\x1a\x0a\x00\x00\x00\x0d\x49\x48\x44\x52\x00\x00\x00\x20\x00\x00\x00\x20\x08\x03\x00\x00\x00\x44\xa4\x8a\xc6\x00\x00\x00\x19\x74\x45\x58\x74\x53\x6f\x66\x74\x77\x61\x72\x65\x00\x41\x64\x6f\x62\x65\x20\x49\x6d\x61\x67\x65\x52\x65\x61\x64\x79\x71\xc9\x65\x3c\x00\x00\x01\xa4\x50\x4c\x54\x45\x1c\x1c\x1c\x2e\x2e\x2e\x1a\x1a\x1a\x25\x25\x25\x26\x26\x26\x24\x24\x24\x4e\x4e\x4e\x5f\x5f\x5f\x20\x20\x20\x1e\x1e\x1e\x1f\x1f\x1f\x22\x22\x22\x1d\x1d\x1d\x21\x21\x21\x3b\x3b\x3b\x19\x19\x19\x16\x16\x16\x2c\x2c\x2c\x29\x29\x29\x28\x28\x28\x27\x27\x27\x2b\x2b\x2b\x2a\x2a\x2a\x2d\x2d\x2d\x2f\x2f\x2f\x00\xac\x3a\x00\xa9\x3a\x60\x60\x60\x3a\x3a\x3a\x00\xae\x3b\x05\x9a\x38\x5e\x5e\x5e\x25\x24\x24\x52\x52\x52\x18\x18\x18\x39\x39\x39\x55\x55\x55\x5c\x5c\x5c\x5d\x5d\x5d\x37\x37\x37\x32\x32\x32\x50\x50\x50\x61\x61\x61\x5b\x5b\x5b\x4f\x4f\x4f\x58\x58\x58\x53\x53\x53\x59\x59\x59\x30\x27\x2d\x28\x1e\x24\x56\x56\x56\x54\x54\x54\x14\x14\x14\x2f\x2c\x2e\x17\x17\x17\x1b\x1b\x1b\x44\x44\x44\x35\x35\x35\x33\x33\x33\x4a\x4a\x4a\x36\x36\x36\x38\x38\x38\x20\x62\x36\x34\x34\x34\x30\x30\x30\x31\x31\x31\x23\x24\x24\x75\x75\x75\x2a\x22\x27\x20\x55\x32\x2e\x2b\x2d\x27\x1f\x24\x2e\x2a\x2d\x29\x26\x28\x62\x62\x62\x25\x21\x24\x26\x25\x25\x26\x2e\x29\x2b\x28\x2a\x20\x60\x36\x1f\x3b\x29\x2d\x25\x2b\x1f\x53\x32\x11\x70\x32\x25\x24\x25\x1d\x4f\x2e\x25\x29\x27\x1f\x52\x31\x00\xb1\x3b\x27\x2e\x2a\x77\x77\x77\x28\x2f\x2b\x2a\x31\x2d\x00\xb6\x3c\x23\x23\x23\x28\x25\x27\x2f\x2e\x2f\x11\x71\x32\x5a\x5a\x5a\x14\x66\x30\x30\x28\x2d\x2e\x25\x2c\x22\x5a\x35\x1e\x51\x2f\x2e\x31\x2f\x29\x21\x26\x2a\x3e\x31\x25\x26\x26\x2b\x32\x2d\x1c\x4f\x2d\x2c\x24\x2a\x30\x26\x2c\x28\x20\x25\x57\x57\x57\x00\xae\x3a\x27\x25\x26\x2a\x27\x29\x2c\x29\x2b\x25\x2d\x28\x00\xaf\x3b\x2c\x34\x2f\x22\x23\x23\x27\x1e\x24\x29\x30\x2c\x2b\x33\x2e\x04\xa0\x3a\x26\x23\x25\x1a\x50\x2d\x1f\x51\x30\x00\xb5\x3b\x00\xb3\x3b\x2b\x23\x28\x03\xa0\x39\x11\x6e\x31\x05\x99\x38\x1d\x50\x2f\x00\xb4\x3c\x2d\x2a\x2c\x63\x63\x63\x2f\x2b\x2e\x63\xda\xc5\x2e\x00\x00\x01\x51\x49\x44\x41\x54\x38\xcb\x85\xcc\xd5\x76\xc2\x40\x14\x40\xd1\x0b\x24\x78\x25\x81\x00\x2d\x69\x53\xdc\xdd\x1d\xea\xee\xee\xee\xee\xee\xde\x9f\x6e\xf2\x3c\x0c\xec\xe7\xb3\x0e\xcc\x72\x46\x19\x96\x91\x6b\x03\x2e\xc9\xd6\x62\xb1\x49\x1b\xfc\xb2\x54\x2c\x18\x0c\xae\x8b\xca\xa1\x58\x37\xf4\xb2\xdd\xbb\xf9\xa1\xfc\xe6\xf6\xb2\x01\xa5\x67\x8d\xe0\xb6\x1c\x75\xbc\x5c\xbd\x3e\x5c\xc7\xca\x1d\x2c\x42\xb0\x31\x7a\xda\xd8\xd0\x7c\xff\x87\x09\x8c\xb9\x91\xa9\x26\x3e\xd8\xef\xd4\xa3\x98\x9c\x0c\x64\x8e\xc3\x67\x21\x98\xff\xa1\x50\x3a\x07\xc7\x07\x6f\x5b\x42\x70\x77\xc1\xa0\x68\x3e\xe0\xb2\xed\x5f\x42\x30\x37\xa8\x43\x69\xb2\x76\xb0\xa7\x76\x26\x84\x60\xe6\x9c\x46\x69\x53\x36\xb0\x15\x8e\x0f\xf8\xe0\x73\xa0\x47\x83\x22\x0a\x1e\xb0\xa5\x6f\x9f\x16\xa6\xbf\xdf\x2f\x97\xb4\x28\x49\xda\x03\x1e\x67\xdf\xf0\xca\xc7\xd8\xda\xe4\x19\x81\x22\x9d\xab\x10\x70\xb6\x3e\x86\x42\xa1\xae\xfe\xbd\xb2\x81\x0f\x02\xa5\x9b\x16\xc1\xb8\xa4\x8c\xc5\x12\x1f\x14\x55\x24\x96\xaa\xe8\x83\x13\x91\x5c\x85\x25\x17\x85\x21\xac\x57\xd6\x60\x29\xf5\x56\x08\x53\x0a\x39\x96\x82\xb2\x82\x95\x51\x2b\xb1\xd4\x8c\x15\x22\x3a\x50\x60\x81\x2e\x02\x7e\x3a\xa1\xc6\x4a\xd0\x7e\x30\xd1\x62\xc0\x12\x0b\x81\xa6\x52\xa0\x31\x55\x09\xb4\x26\x70\x11\x66\x31\x96\x59\xeb\xaa\x16\x78\xf9\x20\x5e\x87\x15\x27\xbc\xe0\x25\xa3\xf5\x58\x51\x52\x0a\x19\x03\x29\xc1\x22\x0d\x19\xb0\x4b\x2b\xb2\xff\x03\x80\x64\x51\xf1\x29\x1a\xc2\x9c\x00\x00\x00\x00\x49\x45\x4e\x44\xae\x42\x60\x82\x01\x00\x00\xff\xff\xb0\xaa\xd3\x73\x5f\x03\x00\x00")
+var _staticFaviconPng = []byte("\x89PNG\r\n\x1a\n\x00\x00\x00\rIHDR\x00\x00\x00 \x00\x00\x00 \b\x03\x00\x00\x00D\xa4\x8a\xc6\x00\x00\x00\x19tEXtSoftware\x00Adobe ImageReadyq\xc9e<\x00\x00\x01\xa4PLTE\x1c\x1c\x1c...\x1a\x1a\x1a%%%&&&$$$NNN___   \x1e\x1e\x1e\x1f\x1f\x1f\"\"\"\x1d\x1d\x1d!!!;;;\x19\x19\x19\x16\x16\x16,,,)))((('''+++***---///\x00\xac:\x00\xa9:```:::\x00\xae;\x05\x9a8^^^%$$RRR\x18\x18\x18999UUU\\\\\\]]]777222PPPaaa[[[OOOXXXSSSYYY0'-(\x1e$VVVTTT\x14\x14\x14/,.\x17\x17\x17\x1b\x1b\x1bDDD555333JJJ666888 b6444000111#$$uuu*\"' U2.+-'\x1f$.*-)&(bbb%!$&%%&.)+(* `6\x1f;)-%+\x1fS2\x11p2%$%\x1dO.%)'\x1fR1\x00\xb1;'.*www(/+*1-\x00\xb6<###(%'/./\x11q2ZZZ\x14f00(-.%,\"Z5\x1eQ/.1/)!&*>1%&&+2-\x1cO-,$*0&,( %WWW\x00\xae:'%&*'),)+%-(\x00\xaf;,4/\"##'\x1e$)0,+3.\x04\xa0:&#%\x1aP-\x1fQ0\x00\xb5;\x00\xb3;+#(\x03\xa09\x11n1\x05\x998\x1dP/\x00\xb4<-*,ccc/+.c\xda\xc5.\x00\x00\x01QIDAT8\u02c5\xcc\xd5v\xc2@\x14@\xd1\v$x%\x81\x00-iS\xdc\xdd\x1d\xea\xee\xee\xee\xee\xee\u079fn\xf2<\f\xec\xe7\xb3\x0e\xccrF\x19\x96\x91k\x03.\xc9\xd6b\xb1I\x1b\xfc\xb2T,\x18\f\xae\x8b\u02a1X7\xf4\xb2\u077b\xf9\xa1\xfc\xe6\xf6\xb2\x01\xa5g\x8d\xe0\xb6\x1cu\xbc\\\xbd>\\\xc7\xca\x1d,B\xb01z\xda\xd8\xd0|\xff\x87\t\x8c\xb9\x91\xa9&>\xd8\xef\u0523\x98\x9c\fd\x8e\xc3g!\x98\xff\xa1P:\a\xc7\ao[Bpw\xc1\xa0h>\xe0\xb2\xed_B07\xa8Ci\xb2v\xb0\xa7v&\x84`\xe6\x9cFiS6\xb0\x15\x8e\x0f\xf8\xe0s\xa0G\x83\"\n\x1e\xb0\xa5o\x9f\x16\xa6\xbf\xdf/\x97\xb4(I\xda\x03\x1eg\xdf\xf0\xca\xc7\xd8\xda\xe4\x19\x81\"\x9d\xab\x10p\xb6>\x86B\xa1\xae\xfe\xbd\xb2\x81\x0f\x02\xa5\x9b\x16\xc1\xb8\xa4\x8c\xc5\x12\x1f\x14U$\x96\xaa\xe8\x83\x13\x91\\\x85%\x17\x85!\xacW\xd6`)\xf5V\bS\n9\x96\x82\xb2\x82\x95Q+\xb1\u050c\x15\":P`\x81.\x02~:\xa1\xc6J\xd0~0\xd1b\xc0\x12\v\x81\xa6R\xa01U\t\xb4&p\x11f1\x96Y\xeb\xaa\x16x\xf9 ^\x87\x15'\xbc\xe0%\xa3\xf5XQR\n\x19\x03)\xc1\"\r\x19\xb0K+\xb2\xff\x03\x80dQ\xf1)\x1a\u009c\x00\x00\x00\x00IEND\xaeB`\x82")
 
 func staticFaviconPngBytes() ([]byte, error) {
-	return bindataRead(
-		_staticFaviconPng,
-		"static/favicon.png",
-	)
+	return _staticFaviconPng, nil
 }
 
 func staticFaviconPng() (*asset, error) {
@@ -86,67 +60,58 @@ func staticFaviconPng() (*asset, error) {
 		return nil, err
 	}
 
-	info := bindataFileInfo{name: "static/favicon.png", size: 863, mode: os.FileMode(436), modTime: time.Unix(1440919501, 0)}
+	info := bindataFileInfo{name: "static/favicon.png", size: 863, mode: os.FileMode(420), modTime: time.Unix(1792223985, 0)}
 	a := &asset{bytes: bytes, info: info}
 	return a, nil
 }
 
-var _staticIndexHtml = []byte("\x1f\x8b\x08\x00\x00\x09\x6e\x88\x00\xff\x84\x90\xc1\x52\xc3\x20\x10\x86\xef\x3e\xc5\x8a\xe3\xcd\x09\xf1\xda\x90\x5c\x7d\x81\x5e\x3c\x39\x34\x6c\xc3\xb6\x04\x32\xb0\xad\x66\x1c\xdf\x5d\x28\xe6\xa4\x33\x9e\xf8\x77\xf7\x9b\xe5\x03\x75\x6f\xc2\xc8\xeb\x82\x60\x79\x76\xc3\x9d\xaa\x07\x80\xb2\xa8\x4d\x09\x39\x32\xb1\xc3\xe1\x25\xec\xf7\xaf\x4a\xd6\xa2\x0e\x12\xaf\x39\x1f\x82\x59\x9f\xe0\x81\x31\xce\xe4\xb5\x83\xcf\x25\x24\x62\x0a\x7e\x07\xfa\x90\x82\xbb\x30\x76\x60\x91\x26\xcb\x3b\x78\x6e\xdb\xc7\x0e\xde\xc9\xb0\xdd\x8a\x59\xc7\x89\x32\xdc\x2e\x1f\xdd\x97\x92\x75\x69\xbd\xc0\x91\x3f\x43\x44\xd7\x0b\x1a\x83\x17\x50\x4c\x73\x9e\xf5\x84\x72\xf1\x93\x00\x1b\xf1\xd8\x8b\xa3\xbe\x96\x79\x53\x5a\x37\x79\xb9\xd9\xab\x22\xf7\xb3\xcc\xd0\x15\xc8\xf4\x62\x13\x15\x83\x92\xb9\xb7\xbd\x65\x8c\xb4\x30\xa4\x38\xf6\xa2\x91\xa7\x24\x6d\xe1\x9a\x53\x2a\x58\x1d\xfe\x49\xea\x0b\xdb\x37\x0e\x67\xf4\xff\xb3\x79\xeb\x14\x98\xd7\x5f\xa4\x92\xd5\x33\x8b\xdf\xfe\xff\x3b\x00\x00\xff\xff\x35\xaf\x3e\x6a\x97\x01\x00\x00")
+var _staticIndexHtmlGz = []byte("\x1f\x8b\b\x00\x00\x00\x00\x00\x02\x03\x85\x90AO\xc4 \x10\x85\xef\xfe\x8a\x11\xe3\u0354z\xdd\xd2^\xfd\x03{\xf1d\xd8\xc2\xc2\xecR 0\xbb\xda\x18\xff\xbb\xb0\u0613&\x9ex3\xef\xe5\xf1\x81\xb8Wa\xa65j\xb0\xb4\xb8\xe9N\xb4\x03@X-U\x15E\x12\x92\xd3\xd3K\xd8\xef_\x05oC32\xadE\x1f\x82Z\x9f\xe0\x81tZ\xd0K\a\x9f1d$\f~\a\U000900fb\x90\x1e\xc0j4\x96v\xf0\xdc\xf7\x8f\x03\xbc\xa3\"\xbb\r\x8bL\x06K\xb8\x8f\x1f\u00d7\u0b74]\xe0\u041f!i72\x9c\x83gPI\x8b^\xa4\xd1<z\xc3\xc0&}\x1c\xd9Q^\xab\xdf\xd5\xd5\r\x9eo\xf4\xa2\xc2\xfd\x94)\xbc\x02\xaa\x91m\xa0l\x12\xbc\ucdb7\xcc\t#AN\xf3\xc8:~\xca\xdc\xd6\\w\xca5\xd6\xcc?\x93\xf2B\xf6\x8d\xc2Y\xfb\xff\xb3\xa5\xd5\x04\xa2\xf5WR\xf0\xc6Y\xc0o\xff\xff\r5\xaf>j\x97\x01\x00\x00")
 
-func staticIndexHtmlBytes() ([]byte, error) {
-	return bindataRead(
-		_staticIndexHtml,
-		"static/index.html",
-	)
+func staticIndexHtmlGzBytes() ([]byte, error) {
+	return _staticIndexHtmlGz, nil
 }
 
-func staticIndexHtml() (*asset, error) {
-	bytes, err := staticIndexHtmlBytes()
+func staticIndexHtmlGz() (*asset, error) {
+	bytes, err := staticIndexHtmlGzBytes()
 	if err != nil {
 		return nil, err
 	}
 
-	info := bindataFileInfo{name: "static/index.html", size: 407, mode: os.FileMode(436), modTime: time.Unix(1444190539, 0)}
+	info := bindataFileInfo{name: "static/index.html.gz", size: 246, mode: os.FileMode(420), modTime: time.Unix(1792223985, 0)}
 	a := &asset{bytes: bytes, info: info}
 	return a, nil
 }
 
-var _staticJsGottyJs = []byte("\x1f\x8b\x08\x00\x00\x09\x6e\x88\x00\xff\x94\x56\x4f\x6f\xdb\x36\x14\xbf\xe7\x53\x10\xba\x84\xda\x5c\xc5\x6e\x77\x18\x6c\x64\x43\x57\x64\x40\xb7\x61\x29\x6a\x6f\x39\x04\x41\x41\x4b\xcf\x96\x16\x9a\x14\x48\x2a\x82\x57\xe8\xbb\xf7\x3d\x49\x96\x65\x99\xaa\x5b\x1e\x12\x99\xef\xdf\xef\xfd\x27\xdf\x14\x2a\x76\x99\x56\x3c\x64\x9f\xaf\x18\x9e\x17\x61\x58\xea\x5c\x6e\xef\x94\x58\x4b\x48\xd8\x2d\x2b\x33\x95\xe8\x32\x92\x3a\x16\xc4\x1a\xe5\x46\x3b\x1d\x6b\xc9\x6e\x6f\x59\x50\xf3\xce\x83\x45\x27\x2c\xcc\xd6\x7a\x84\x2c\x08\x13\xa7\x47\xb6\xc2\xa0\x3c\xe3\x27\xa6\x7e\x65\xd7\xa5\xb5\xf3\x9b\x9b\x6b\x36\xa7\x4f\xfa\x0a\xd9\x8f\x67\xba\x52\x6d\x9d\xe7\x3a\x17\x2e\x55\x62\x07\x48\x42\xe1\xeb\xa3\xad\x03\x60\xc2\xf5\x18\x6c\xb5\x73\xfb\xe0\xa9\x87\xb8\x70\xfa\x23\xc4\x5a\x29\x88\x1d\xb2\xbc\x9a\x2d\xae\x3a\xa2\xce\x41\x3d\x90\xe0\x59\xa4\x0e\x1c\x25\x51\x15\x94\xec\x01\xd6\x4b\x1d\x3f\x83\xe3\xe8\xdc\xe4\x68\x35\x6c\xd5\x1d\x04\x1c\x98\xdd\xe0\x2a\xcf\xd4\x76\x95\xed\xc0\xf4\xee\x4b\x1b\x69\x45\xe6\xfb\xc6\xe1\x05\x94\xeb\x23\x68\x39\x2d\xa8\x84\xff\xb1\xbc\xff\x3b\xb2\xce\xa0\xb2\x6c\xb3\xe7\x9f\xd9\x5b\xb3\x2d\x76\x28\x60\xe7\x75\x5a\x26\xec\x6d\xe1\xd2\x95\x7e\x06\x35\x67\x75\x18\x3e\xa1\xef\xe9\x27\x47\x37\x93\x2a\x0c\x17\x27\x6a\x3b\x50\x08\xc0\x82\x7b\xaf\x10\xf8\x8b\x90\x9c\x6c\x7d\x40\xda\x84\xbd\x99\xb2\x1f\xd8\x6c\x3a\x9d\x4e\x10\x43\xdf\x4d\x3a\x29\xf9\x19\x25\xb0\x11\x85\x74\x4b\xa7\x8d\xd8\x42\x1b\x29\x99\xad\xa3\xf6\x26\xfa\x0b\xd3\x27\xf9\xc0\xb4\x4f\x36\x8a\x25\xd6\x10\x1f\x9a\x21\xce\x56\x6d\x23\xb5\xc2\x3f\x99\x6a\x74\x9e\x71\x46\x5b\x70\x1f\x0c\x6c\x2c\x0f\x31\x66\x8e\x07\xe4\xcc\x2b\x50\xb1\x4e\xd0\xa3\x60\xc2\x02\x23\xca\xc0\x2b\xa9\xd5\x41\xf3\x47\x10\xc9\x7e\xac\x24\xfa\x69\xcd\x34\x72\xd5\xc2\x99\x8e\xf2\xc2\xa6\x67\x98\xe8\x20\x4d\xab\x7f\x57\x7f\xc2\x1e\x73\x87\xa9\xe8\x6b\xc6\x1b\x9f\xf2\x7e\xd6\x83\x69\x80\x15\x4f\x8c\x8b\x33\xbe\xca\x6f\x8e\xe4\x96\x75\x9d\xa0\xad\xa1\xf9\x31\x84\x47\xef\x6d\xf6\xff\x09\x48\x2c\xf2\x62\xa7\xb0\xbc\x8c\xc6\x32\xb8\x00\xd7\x4b\xa4\x13\xbc\x26\x3f\x06\x35\x3c\xca\x4d\xc7\x6f\xa8\x7f\x5a\x64\xf3\xc3\xc7\xe4\xa2\x04\xb9\x30\xaf\xff\x7e\x9d\xb7\x1a\xa5\x86\x5e\xca\xf9\xad\x2f\x37\x4d\xad\x28\xeb\x84\x94\x98\x90\xb5\x16\x26\x19\xf6\xc6\x50\xae\x6d\x95\x18\x9b\xc4\x01\x4f\x74\x5c\xb7\x3c\x15\xfa\x9d\x04\xfa\xfc\x6d\xff\x1e\xab\xc4\xb5\xe9\x0b\xfa\x6d\x5e\x0d\xe7\xcd\x0e\xac\x6d\xfa\xf4\xeb\x23\x27\x11\x4e\x20\x53\x4d\x8b\xe8\x47\x64\x65\x16\x03\x9f\x0d\xc0\xda\x32\x73\x71\xca\x8f\x7c\x8f\xd3\xa7\xa1\xae\x58\x58\x60\xd7\xd3\xeb\xf9\x48\x38\x74\x54\x9a\xcc\xc1\x3f\xab\xdf\x7f\xe6\xed\xcc\x17\x4e\xaf\x39\xa9\x1b\xce\x2c\x3a\x6b\x03\xe2\x79\xe1\x31\x31\xf3\x98\xb8\xb9\x61\xb9\x56\xdb\x6f\x57\xf2\x7a\x0c\x27\x8e\x93\x87\x1a\xdd\x2a\x73\x12\x1a\x74\xdf\x01\xee\x8d\x47\x6f\x8e\x93\x0a\x0c\x4e\x27\xa0\x1d\x53\xb7\x46\x2e\x8c\x1d\x55\x7e\xbf\xfe\x0f\x57\x58\xf4\x8c\xad\xcc\x7b\xb2\x61\xb4\xd1\xe6\x4e\x60\x1e\xba\xa4\x22\xcb\x58\xa3\xe2\x22\xb4\x5a\x02\xee\xd5\x2d\x0f\x96\xe0\x1c\x8d\x09\x6a\x4d\x94\xc1\xbf\xc1\xbc\xfe\xd1\xc7\xf6\x88\x94\x27\x0f\x9c\x2e\x34\x83\xa1\x8b\xec\x93\x6f\x91\xaf\xbe\x27\x7e\x3f\x79\xe2\x37\xdc\xec\x97\x23\x78\xe2\x7c\xfd\x2e\x21\xef\xcd\x41\x47\xe3\xfb\xa9\x5a\x0c\x09\xae\x47\xfc\x95\xd8\xe0\xbc\xcb\x3d\x78\xab\xf1\xf6\x8b\xa5\xb6\x97\x9b\x2f\xdb\x30\x4e\x71\xf5\x65\xb0\x8e\x77\xa1\x2e\xcc\x90\x8e\x93\x96\x41\xaa\xcb\xfb\x17\x30\x52\xec\x79\xf0\xae\x71\x0a\x4d\xb3\x77\x84\x25\xc1\x95\xa8\x0a\x29\x87\x33\xe8\x34\x01\xb4\x98\xbb\xe7\x41\xf7\x6c\x18\xc8\x10\xea\xd3\xc8\xfd\xc2\xa6\x3e\x17\xb0\x44\x48\x5e\x17\x8e\x37\xaf\xaf\xc9\x20\xe2\xcd\x9b\x63\x14\x52\xd5\x10\xaa\xab\xe3\x2b\xee\xf0\x64\xe9\x87\xf6\x74\x55\x75\xdb\x74\x16\x84\x9d\x3c\xfd\x6b\x20\x50\x00\xab\x90\x87\x57\x5f\x02\x00\x00\xff\xff\x9e\x90\xaa\xec\x32\x0b\x00\x00")
+var _staticJsGottyJsGz = []byte("\x1f\x8b\b\x00\x00\x00\x00\x00\x02\x03\xbdX\xddo\xdb6\x10\x7f\xcf_\xc1\ua851VEq\xdam(\x1cdC\u06a6@\xb6\xa1)bw}(\x8a\x82\x92(K\x8bL\x1a$\x15\xcdk\xfd\xbf\xef\x8e\xfa\xa2d)q\xf70=\x04\x0e\xc9;\xfe\xee\xfb\x8enR\xf0Hg\x82\xbb\x1e\xf9zD\u0ee7\x92\xa4Zo\xd4\x15\xa7a\xcebrA\u028c\u01e2\fr\x11Q<\x1al\xa4\xd0\"\x129\xb9\xb8 \x8e9;w\xce[b*Wj\x84H1*\xa3\xb4;VH\xa0'n\xef\xaa_\xc9q\xa9\xd4\xfc\xf4\xf4\x98\xcc\xf1'\xfe\xf2\u0233=^\xa9PzdyCu\xca\xe9\x9a\xc1\x16\x10\x1fww5\x80\x11\xd7'g%\xb4\xde:\x9f-\u0105\x16\xb7,\x12\x9c\xb3H\u00d1\x93\xb3\xf3\xa3v\xb3T\xddA\xcd\xe4\xba\xde:=%\v\xa6\x14\\K\xb4 \x92\xa9\x02\xee\xa5<&:e\x84\x17\xeb\x90I\"\x12\"\n\xbd)4\t\xb7\x9a)8\x15\xb1\xec\x1e\xe4L\xa4X\x93L\xb7|U\xcd\xe9\x02(\xf3\xbc\xbbO$\x89b\x88h\xd6\xddzcs\x8c3\xb5\xc9\xe9\x16X\"\x8e4S\xa4\x96\x02\xb8\xf9\x84Fw\\\x94\xa0\xd8\x15\x1c\x00\x94\bM1y\xcfd\u00ecL\x19\a \x84\x19\x03(\x92\xe4\xa2D\x16Z\x8a\xbcE\x81\x8b\xaf\xab5\x80\x92\xd0\\\xb1\x0e\"\x1cF\xd1\xe3\nd\xab\xd1\xe8n\x99\xadA\x05\x8dD\u0345\xb8jp\xe4\x14L\xb8\xc9\xf8\x8a\x94T\x01*\xae[\xedIQ\xe0/\x99m\x88\xc6\xe3\xa0F\\\xdeHv\x9f\x89B5\xac\x04g$\xe3d\x9d\xe5y\xa6\xd0z\xb1\xf2A\xc5\x1b!\xf5P\\\xf0\x14\x9dV\x96a\x7fW\xd7v\xbe\x01\xff,\xf0\xfa\xa1\xf2q\xe3v\xb9\x84u\u01f1\xfcAl\x18\xff\x88\x8e\xb4\x179\xf8\x95\xb8\xc3YI>\xb2p!\xa2;\xa6]pt\xbf\xf3@\xef\xdc:\x1b\x84\x19\xa7r\xbb\xdcn\x18^C\xa5\xa4\u06f0H\x12&\x9b\x1bm0F\xa3\xd6:\xd0\v\x8epl0\xec\x1ed\xb1\x11\xe17i\xc1\xe6\u06f7b\xbb\x93C\xdc\xe2\xcd\xe0\xc9ncV\xaf\x7ff\xcf\xda\xf6\xe6\xa8~\xed\xcdN\xc7\xf6\x0e\b\aN\x11\xbb\xbf-n\xde\x05\n\x9c\x81\xaf\xb2d\xeb~%\x97r\x05H\xb9Vs\x93i|rY\xe8t)\xee\x18\x9f\x13\x13\xd9_ \x9c\xd3/\x1aW|\xf2\xca(x\x0e\xdeT0\xbf\x89\xd8\xeb7\xf3&\xe4|rcbl^\u01daO\xdev\xba\xaa\xc9v\x9e\xb7\x8f\xba\x11\x18h\xae9\xe4\x85{\x9a\xbb\b\xf8=\xec\xf9\xe4\u014c\xfc@\xcef\xb3\x99\x0f\x82x\x96\xcd\xf0\xcb\x12\xe2b&\x19Z\t?\\\x0f2\x11\xa8T\x947\xe0\xb9\x10\u072e\xd3\xe6&\x16;\x03(\x1d\rW\x9a\xe6\xf9\xefl\x1b\n*cw\xf2\x9c\x00\xa7Y\xc2/PL~\xcbT\xf6\x0f3`\x02\x15I\xc6\xf8\x02\xfe\x0f\xca,\u05a9O\x86\xcb)\xcbV\xa9\x1ea,\x99.$\xef\xaf\xef\xfa2\xa7\x86Y\xcc\x12Z\xe4z\xa1\x85\xa4+VGJ\x9e\x85A\xbd\x12\xfc\x01\xa9<\x1fb\x1f\xa3\r\x8c_\xbaC\xd5\xe2\u025amE\xd5H:z2X1\xfd^\xb2D\xb9\x1e8\x9bv\x1d4\xe0\t\u3448\xc1\x8a\x8eO\x1cI\u02e1\xc6G\tC\xaa\xa3\xf4D\x029\x93\x15)z\xce!\x94\xa5\x90wL\x9el\xa8T=\xc2\x1ee\x97\xf6!\xc3\xc7\x00\x8aC\xf6\x8b %\x82\vR\x9e\xadM\xf9\x83\xaa\x02\xb5\xcf7iT\xf0|[\x1d\x1c\xf2\x11-\x1f\xbb:\xec\xe3\x14\xbc\xba\xf1\xd6\xc8d2\x83E0\xa6L\u06edh\xbc\x9d\u0290vV\xcb\x04\x9cj\xdcrS\xa8t\xcfL&^\xd0e\xff\\\x82kC\x1e\x80\xb0\xb69\xc3\xca\x18s;\x8383\a\x1a\x02<\xb8\ufe7b\xf1\xeb\x90nar\x0e\xdc5\xbc~\na?\xa8l\x90\x90\xf7\x8b5\xc7\xea$ \x1b<\x02wt\x13?\xe79\xca1\u0207\x93\xa7\xf1\xfb\xfa\xe0n\x95\xf7\r\xb2y\xf3\xc3\x7f\x94\x02E\x98\x9b\xbf\x0f\x9f\xddM\xeezG\x87\xad\x8e\xd9\xe6\x90T\xb7\x1bs\xce\x18R\xa8\xa4\x9a\xb9\xb1\x88L\xf9\xc0@\xbc\xca\x19\xfe|\xb5\xbd\x06/\u0475\xf9\x1c;\xdb\xef\x86\xe5v\re\xa3J]\x0fW\\\xcc\xf1f#\x88\xa9\xa6\xc4@\x86\x88\x85V\xe6\x12\x8b\xfc+S\xe4\xc7\\\x01B\xb4\xaaYU8CC\a]\xc1\x96@(7\xa1K\x13\x80j\x9a\x19\xb1\x81L\x05\x11\x8f\xc2\u0143 \xaey\x85\xdb*\x11\x9a\x0eH \xb5\xe9\x1cI\xe5A\xd8?\x85L\x97\x90\xe1G\u3cfe\xb1J\xa8\x1f2\xae_\x1a\xf4\x96d>9\x1b\t\xab\xbao}vQs\br\xc6W:\x9d.I\xa5\xcc4\xfb\xb0|\xfb\u04ad\b\xfe[\x911\xaa\xbe \x1d\xba@\xe5Y\xc4\xdc!D\x05\u0288RK\x8aO\xb3\xcfC[DT1r<;\x9e?\xac\x98z\x04\xa1Z\x84.r\xfa\x9f\x94\x11JF\xef\xceG\x00\x9f\x8d\x00F_l\xbb\xb0'U\x1b6\x95\x85\xba\x86\xac\xca\x7f\xee\x1b\b\x9a\x00\xd2>\xe4\U00013d97\x1bA\xf4h\xab7\x9e\x14&\x05y>\"H\u05500\xfd\xd1(}\x99\xe9\x9cM)}\x92\xef\x8b\x11\xbe0Y@4B\xddg\u063d\x9b\f\x8b\xf5x\x92\xf9M\xf8\x174c\xc1\x1dT\x04\u05e2\xf5\x82D\xc8+\n\x9e\xd5\xe6\x0682\xa5il\xb9E\xce`z]\xb9\u0382i\x8d\xf1\x88\x19\x1eh\xe0\xaf37\xff\xd8\xd8>\xc1\xce\xe7\t\u054f\xf5\x16p\xdc?\x84~\xf7=\xfa\xfbqD\x7f\xc3\xf9\xf9q\r\xf6\x847\xd3?J/\x1b\x1e\x95\xec}\xb6\xa0\x12R\x8fy\x8ew8\u079f&\"8\xe3\x898\b*FO3\x9f\xd7\xc1C\x9e>5\xf4\xc1\xf5\x1b\\\xaaw\xa7\f\x8dS\xaf5\xbe\xb6\xc3>\xb4`+\x98a}\xc8\xc5Tj\"\x9a\xb1|\u0534\x92\xa1E\xbdCB\xaa{L\xa81N\xa6\xa4\xfaD5\x01}\x87\x0f\xfc<\xa2\xd3\xfe\x88\x89M\xec\xa1V\xb7\xdf\x1c*\xc3\x0f\x8dblo\x1e<\x0e\xb3\xfcn\xba~G\xb9P\x87U\xef\a'\xb4\x82\x7f\u01fc\u055b\xe5^\xb7\xef3\xe45b\x89\xa1\xe57\tyJ\x84v\bo\xc7\xccv\xfc\x1c\xd0 \xea~\xcc\xfcBfc\"\x80\xb5\x9b\x89\xbez\xcd\xf0\a\xb1V\u036e\xde\x03Z\xad\xab\xaf\xf5\x82U\x8d\xbe\xb6j\xfb\xbdn\u06ce\x9f\xa1\x89\xeb:c]a\x15\x8f\xae\xe6\xb4\x17\u0541t\u064d \xbd\u01ef\xaa\x1c\x9b\x99\b\x1b\xa3\xa8\x90\x12Y\x85\x85T\x1a\u07cf\xea\xb6M\x91\x94\xb6\xefG!t=\xf0?\x8f\xf3\xbau\xaa\x1f\xae\x9a\vzc\x06t\xf4\xb60\xed{\tTu\xdc\xeb\xc4@#<\xb1\x83\xe1\u06f7\xee}d\xa2\xf8\x0e[\x9bN\xd3\xd6\u02cae\xb4\u0279\xea\xc1\x87\x18D\x06F\x908\x9c-4\xa8\x18\x9fo\xdbg\xaa\xe0\xe6\xfd\u057b1gi\xed\xf6\x02\xed\xd6\b>\xed\x1b>\x99\xf5\xcdV\xb9\x18\xdar\xe7\xb9\xde\u047f\xbc\xf5aBr\x16\x00\x00")
 
-func staticJsGottyJsBytes() ([]byte, error) {
-	return bindataRead(
-		_staticJsGottyJs,
-		"static/js/gotty.js",
-	)
+func staticJsGottyJsGzBytes() ([]byte, error) {
+	return _staticJsGottyJsGz, nil
 }
 
-func staticJsGottyJs() (*asset, error) {
-	bytes, err := staticJsGottyJsBytes()
+func staticJsGottyJsGz() (*asset, error) {
+	bytes, err := staticJsGottyJsGzBytes()
 	if err != nil {
 		return nil, err
 	}
 
-	info := bindataFileInfo{name: "static/js/gotty.js", size: 2866, mode: os.FileMode(436), modTime: time.Unix(1444190539, 0)}
+	info := bindataFileInfo{name: "static/js/gotty.js.gz", size: 1762, mode: os.FileMode(420), modTime: time.Unix(1792223996, 0)}
 	a := &asset{bytes: bytes, info: info}
 	return a, nil
 }
 
-var _staticJsHtermJs = []byte("\x1f\x8b\x08\x00\x00\x09\x6e\x88\x00\xff\xec\x7d\xfb\x7f\xdb\xc6\x91\xf8\xef\xfe\x2b\x10\x35\x57\x92\x36\x45\x91\x7a\xcb\x8e\x92\x63\x2c\x2b\xe7\xfb\x38\x4e\xbe\xb6\x73\xbd\xfb\xd8\xae\x0f\x24\x97\x12\x62\x12\x60\x01\x50\x12\x9b\xe8\xfe\xf6\xef\x3c\xf6\x31\xbb\x00\x48\x3a\x69\x7b\x6d\x2f\x4e\x4c\x93\xc0\x60\x31\x3b\x3b\xef\x9d\xdd\xdd\xdb\x8b\xde\x5c\x27\x45\x34\x4d\x66\x2a\xba\x8d\x8b\xe8\x4a\xa5\x2a\x8f\x4b\x35\x89\x46\xab\x68\x96\x8c\x26\x59\xb9\x37\x4a\xd2\xbd\x71\x96\x8e\xe3\xb2\x57\x5c\xf7\x1e\xc0\x33\xcf\xcb\xe8\x1a\x80\x47\x4a\xa5\xd1\x3c\xce\x3f\x02\x78\xae\xe2\xc9\x6e\x96\xce\x56\xd1\x34\xcb\xa3\x55\xb6\xcc\xa3\x22\x9e\xaa\x72\xd5\x8b\xa2\x57\x71\x79\xad\x72\x7c\xb0\xbc\x8e\xd3\x48\x4d\x92\x32\x82\xff\x27\x49\xae\xc6\xe5\x6c\xd5\x8d\x16\x33\x15\x17\x2a\x9a\x67\x93\x64\xba\x8a\xb2\x54\x45\xd9\x14\x60\x15\x5c\x2b\xa0\xa5\xb1\xc2\x67\x11\xc7\xa2\xd7\x43\x04\xf0\xa7\x46\xee\xc7\x62\x0f\xbe\xf5\x7e\x2c\x2a\xd7\x3e\x8c\xb3\x59\x96\x17\xb5\xb7\xa6\xb5\x57\xe7\xaa\x28\xe2\x2b\xf5\x61\x1e\xa7\xf0\x4f\x5e\x0b\xb3\xc8\xd5\x54\xe5\x2a\x1d\xaf\x07\xcb\x15\x23\x5e\x7b\xb3\x28\xb3\x1c\x9e\x5c\x77\xef\xc3\xf8\x3a\xcf\xe6\xeb\x41\x66\xd9\x38\x9e\xad\x85\x98\xab\x79\x96\xaf\x6a\x41\x4a\x55\x94\x6b\x7b\xb0\x2c\xa7\xa7\xb5\x37\x6e\xc7\xfa\xf2\x75\xa9\xf2\x39\x5e\xa5\x2f\xb5\x17\x3f\x4c\xf3\xd8\xf6\x22\xb8\xf5\x51\xad\x46\x59\x9c\x4f\xd6\xdf\xfd\x00\xdc\x37\x49\xd2\xab\x62\x03\x18\x7c\x99\xc7\x8b\xcd\x40\x8b\xb8\x84\x6b\x69\x3d\x60\xb6\x28\x93\x2c\x6d\x78\xd5\x22\xce\x0b\x4b\xab\xda\x7b\x1f\x92\x89\x4a\xcb\x64\x9a\xa8\xbc\xa9\x8d\x26\xee\x09\xe1\x96\xa3\x62\x39\xaa\xbf\x57\x8c\x73\x90\xbb\xc6\x7b\xd9\x6c\xb6\xc8\xf2\xb2\xfe\x3e\x7e\x24\xa9\xe5\x9a\x86\xbb\x1f\x92\xac\x09\xe0\xae\xfc\x00\x04\xcc\x93\xd1\x12\x18\xa8\x1e\xe8\xa6\xe1\xdd\x37\x25\x30\x75\x9c\xc7\x63\xf8\xf5\xc1\x8e\xd5\x03\x84\x7c\xfd\xdd\x0f\xaf\x9e\x3e\x8b\x2e\x9f\xbf\x78\xf6\xb8\x56\xb0\x9f\x66\x8b\x55\x9e\x5c\x5d\x97\x51\x7b\xdc\x89\xf6\xfb\x83\x7d\xd0\x5b\x2a\x7a\x8a\x42\x92\x2c\xe7\xd1\x77\xaf\xa3\xe1\xb2\xbc\x46\x71\x8f\x86\xb3\x59\x44\xb0\x05\x28\x25\x18\x95\x1b\x35\x21\xa5\xf5\x43\xa1\xd5\x0a\xe8\x3b\x16\xce\x68\x9c\x4d\x54\x04\x3f\xaf\xb2\x1b\xe0\x09\x56\x7a\x71\xf4\xf5\xeb\x8b\xdd\xa2\x5c\x81\x46\x9c\x25\x63\x95\xc2\x63\xa0\xb6\xca\x68\x0c\xaa\x6b\xc4\x9a\x28\x5b\xa6\x93\x28\x49\x51\x45\x45\x2f\x9e\x3f\x7d\xf6\xf2\xf5\x33\x52\x4f\xbd\x07\x0f\x5a\x4b\x54\x5a\x40\xa1\x71\xd9\x7a\xf2\xe0\x41\x32\x8d\xda\xe5\x6a\xa1\xe0\xc5\xd0\x9b\xe8\xb3\xf3\xa8\x05\xcf\xaa\x69\x02\x6f\x6b\x75\x1e\x44\xd0\x44\x9e\xdd\x46\xa9\xba\x8d\x9e\xe5\x79\x96\xb7\x5b\xdf\xcc\xb2\x51\x3c\x8b\x76\x00\x7c\x27\xca\x46\x3f\x82\x8a\x8c\xe2\x19\xaa\xd7\x55\xa4\xee\x92\xa2\x2c\x7a\xad\x0e\xb4\x7c\x13\xe7\xd4\xe4\x79\xf4\xd3\x3d\xfc\xdc\x7b\xf8\xf0\x41\xf4\x30\xfa\x36\x5e\x60\x27\x77\x26\x6a\xa1\xe0\x3d\xe9\x78\xb5\x13\x95\x59\xf4\x76\x87\x7b\xbc\xd3\x8d\x40\x83\xbe\xef\x01\x28\x42\x3f\x8b\xc7\xd7\x91\x03\x45\x52\xc4\xe6\x9d\x29\x08\x6e\x17\xde\xf0\x51\x11\x2e\xbd\x69\x01\x0f\x9b\x66\x10\x12\x3b\xbf\xcc\x67\x44\x1c\x6c\x0c\xda\x81\x56\x26\x05\xe8\x6f\xba\xc7\xed\xe0\xab\xf6\x1e\x60\x03\xf9\x12\x64\x63\xae\x2e\xcc\xeb\x12\x55\x7c\x08\xb0\x7f\x01\xdd\x43\xf4\xa7\xcb\x74\x4c\x92\xc8\x94\x4f\x15\x0c\x0d\xf4\x62\x04\x83\x95\xde\x64\x68\x6e\x26\xcb\x1c\x94\x02\x12\x20\x8f\x73\x40\x3c\x4d\xca\x24\x9e\x25\x7f\x8e\xf1\x31\xaf\x7b\x6a\xa6\xe6\x20\x95\x66\xb8\x10\xf2\x69\x3c\x9b\x8d\xe2\xf1\x47\x78\x7f\x9c\xe7\x31\xf5\x3b\x29\x0b\x35\x9b\x42\xf7\xcb\xdb\x6c\xd7\x3c\x43\x77\x7b\xd4\x94\xbe\xd2\x67\x1a\x15\xc0\x6a\x25\x0d\x33\x20\x31\x51\x20\x76\xc9\x08\xbf\x52\xbf\x6f\xc1\x84\x6a\x03\x46\xaf\x8b\xf2\x6c\x59\xc2\x80\x77\x23\xe0\x8d\xe9\x72\x86\xed\xa1\x91\x9c\xa8\xd1\xf2\xea\x0a\x1e\x03\x13\x69\xda\x1f\x18\xca\x8e\x35\x8e\x96\x16\x8e\x90\x41\x17\xce\xa3\xb7\xef\x1d\x09\x5f\xa9\x71\x96\x4f\x10\x47\x4d\x6f\x31\xbe\x86\x2e\x64\xf2\x99\x9d\x35\x4a\xd1\xed\x35\x98\x72\xb0\xda\xe0\x04\x00\x16\x40\x6b\x75\x07\xba\xaa\xd0\xed\xec\x06\x0d\x45\x3c\xe2\xe3\x6c\xbe\x40\xc7\x01\xef\x42\x1f\xc0\x2b\x80\x76\xd3\x0c\x69\x5d\x22\xa4\x19\xb4\x18\x3a\x31\x9b\xed\x4e\x67\x6a\x72\x05\x17\xcd\xa0\x15\xab\xa2\x54\xf3\x28\xcb\x35\xf7\x98\xc6\x4b\xd0\x11\x1f\x41\x33\x62\x8b\xad\x22\xfa\x71\x09\x4c\x81\x0e\x84\xc2\xe6\xe6\x31\x30\x24\xd0\x74\x91\x15\x45\x32\x9a\xd1\x35\x22\x24\x82\xe8\x86\x8a\xe8\x36\x01\x65\xb0\x2c\x11\xf7\x14\xc7\x05\xa8\xc5\x54\x05\x81\x37\x54\xf8\xce\xf1\x39\x74\x13\x5a\x2f\x16\x6a\x8c\xca\x7b\x12\x81\x6f\xc3\x63\x0b\xea\x24\xba\x84\xa1\x52\x77\xf1\x1c\x9c\x14\xf4\x3e\xf8\x61\xfc\x43\x4c\x5d\xc2\xfb\xda\x2d\xfc\xca\xee\x46\xab\x1b\xd1\xaf\xef\xad\xa6\xff\x96\x15\x3d\x0a\x6d\xcd\x8b\x89\xb7\x91\x66\x40\xa7\x3c\xcb\xb4\xe7\x85\x4d\xb4\xe0\xdd\xff\x05\x23\x32\x07\x06\x5d\x92\x12\x42\xd6\xc0\xde\x8e\x67\x88\x6e\x1c\x90\x0d\xc4\x2e\x4e\x57\x42\xec\x78\xa8\xa1\xd3\xb3\x04\x59\x6b\x91\x67\x57\x60\x8d\xa9\x3d\xe4\x2e\xc2\x1f\xd4\xdb\x32\x57\xaf\xaa\xa2\xd9\xee\xc0\x20\x03\x15\xe2\xbc\x5c\x2e\x60\x40\xb1\x31\x60\x2c\xe0\x6c\x64\x0e\x7a\x8a\x85\x13\x5b\xaa\xb0\x1a\x34\x00\x1e\xe2\x8d\xd2\x2e\xa2\xb2\xf8\xfc\x2b\x58\x4a\xc0\xe1\x27\x26\xef\x7d\x04\x5a\xec\x43\x9c\x5f\x15\xd1\x77\xe8\xf4\xe5\xe0\x02\xe6\x46\x73\x14\xf5\x03\xe2\xf4\x09\x92\x1e\xb8\xdf\x08\x48\xdb\xb4\xd5\x89\x7e\x02\xc5\x8a\xfa\x91\xb5\x15\x08\x07\xe8\x59\x60\x38\xbc\x5c\xd5\xb8\x38\x2e\xd1\x3d\x90\xa4\x04\x6d\xd1\x56\x77\x1d\x0d\x47\x0d\x94\xc0\x8a\x43\xd2\x11\xe7\xc0\x04\x3d\xfa\xdd\x2b\x16\xb3\xa4\x6c\xb7\xde\xa5\x34\xa6\xf0\x07\x5d\xe2\x34\x7a\x1d\x4f\xe3\x3c\xe9\x12\xa3\x81\xec\x2c\x67\x25\xb2\x9e\x68\xe2\x36\x01\x5a\x91\x8f\x4c\xb4\xd9\x37\xba\x09\xd8\x0f\xec\x09\xf1\x2f\x37\x86\x2e\xcf\x4d\x32\x59\x82\x1d\xd0\xdd\x26\x06\x05\xa5\x31\x47\xf7\x05\xd4\x5f\x32\x25\xee\x02\xef\xb9\x47\x0f\xa1\x9d\x71\x6f\xea\xcd\x54\x7a\x55\x5e\x47\x5f\x9e\x47\x07\xa6\x3b\x91\x31\x7a\xe7\x02\xa5\xb7\xfb\xef\x7b\xb9\x5a\xcc\xe2\xb1\x6a\xef\xfd\xf1\x5d\xf1\x30\x2e\xdf\x15\x8f\xf6\x80\x87\x4d\xd7\xee\x01\x49\x60\xbe\x75\x6d\x0c\x82\x36\xae\xd8\x82\xa1\xac\xfd\xab\xd7\x14\xd2\x19\xc7\x02\x95\x1f\x8e\x56\x94\x40\x43\xfd\x27\xf0\xcf\x17\xd0\xbf\xab\x25\xd1\x42\xe3\x0e\x57\x1f\x3d\x92\x43\x01\x8e\xdb\x35\x80\x5b\xb8\xb7\xc9\xfb\x27\xb6\xeb\x74\x33\x49\x01\x29\x10\x38\x50\xbd\x84\x98\xeb\xb9\x65\x97\x5e\xbc\x58\xcc\x56\x6d\xf8\xdd\xa5\x06\xeb\x3b\x89\xaf\x43\x05\x75\x4e\x32\x57\x6b\xb8\xde\xe2\xd3\x1a\x01\x46\xe1\x33\x78\xa2\xa3\x7f\x47\xdb\x3d\xae\x55\xb7\x7d\xa2\xb7\x58\x16\xd7\x6d\x26\xb1\x47\x33\x61\x22\x9f\x91\xe8\x15\x1b\x64\x0f\xb9\x05\xa4\xae\x8b\x22\x85\x11\xd7\xdd\x58\x91\x6b\xcb\xd6\x05\xf8\xdf\xd9\x48\xf0\x7c\x40\xbf\xa4\x00\x5d\x63\x31\x98\x65\x41\x35\xcd\xb2\xab\x2b\xd6\xe7\xc8\xdd\xff\xfe\x1a\x46\x37\x2d\xb2\x19\xa9\xfd\xa9\x36\x07\x18\xc4\x95\x14\xbd\xf9\x2e\x05\x37\x4e\xea\x8b\x9a\xcb\xe3\x04\x88\x2d\xd1\x72\x42\xdd\xa8\x8f\x3e\x48\x49\x77\x12\xbe\x88\x8b\x02\xf0\x02\x52\xe7\x4b\x16\x74\xcb\x5c\x9a\x27\xa2\x26\xdf\xc3\x93\x73\xa2\x39\xb9\x1f\xe7\x8d\x0f\xc8\x31\xc7\x87\x58\x81\x9f\xd3\x8b\x8c\x4e\x60\xdf\xcc\xe9\x84\x38\x9a\x64\x63\x62\x58\xa4\x18\xfa\xcf\x51\xeb\x16\xc4\x3b\xbb\x6d\x19\x4b\xaf\xc5\x45\xeb\xed\x88\x9f\xba\xcd\x20\xaa\x06\x01\x01\x03\x68\x5a\x43\x9d\x0d\x5d\x6d\xa1\x9f\xd2\xea\x59\x2c\xe0\x39\xc0\xa1\xcd\x8d\x46\x3f\xff\x1c\xe1\x7d\xcd\x3d\x75\x82\x46\x58\xd7\x09\x99\x66\xe3\x36\x01\x80\x74\x21\xed\xa0\xf1\x8e\xbb\x1f\xd9\x51\xbf\x8d\xf3\xb4\xdd\xfa\x36\x01\x1b\x0c\x2a\x6e\xa7\x15\x3d\x62\x72\x3f\x8a\x5a\xe4\x1b\xa2\x55\x23\x4b\x06\xe6\xd0\xd1\xb6\xf3\xc4\x36\x64\xc7\x6d\x1a\x83\xe4\xb9\xeb\x23\x70\x74\x3f\x9a\x9f\xf7\x0f\xf4\x17\xee\x23\x7c\xbe\x35\xc8\xbd\x0f\x54\x0a\xa1\xce\x8d\x76\x6a\xb5\x7c\xeb\x32\x4e\x90\x7c\x35\x3c\x3e\xbe\x56\xe3\x8f\x38\x6e\xf7\xd2\x8d\xba\x02\x84\x15\x49\x8f\xef\x5c\x7a\x0e\x99\x31\xb1\x0d\x20\x2c\x88\xc6\x67\x05\x7a\xe6\xd4\x6c\xce\x50\x6c\x4e\xd1\xf3\x22\xe9\xd1\x9e\x1d\x30\x37\xba\xa3\xfc\x0c\x7a\x86\xe8\xc4\x9a\x06\xb5\x00\xa9\xb1\x4a\x6e\xd0\xaf\x42\xf2\x83\x0f\x44\x46\x55\x01\xba\x5d\x68\x2e\x19\x5f\x63\x7b\xe4\xa7\xda\xe7\x7c\xef\x99\xbc\xbd\xa4\x24\x07\x6e\x06\xcf\x91\xfb\x8b\xad\x94\xd2\x6f\xad\x3a\xd4\xa1\xf5\xc6\xd1\x88\x86\xda\x1b\x66\x37\x18\xe4\x19\x30\xa3\x1b\x35\x2e\xb0\x71\x37\xa7\xec\xf4\xe1\x1f\xe7\x05\xcb\x37\x58\x51\x37\x5f\x3a\xf7\xce\x25\x5e\x43\x71\xec\x68\xae\xc7\x8e\x1b\xcc\x55\xb9\xcc\x53\xd7\xe2\x3d\xfb\x44\xa6\x2d\x4b\x3a\xe1\x58\xe8\xe7\x9f\x23\xe2\x42\xeb\x70\x44\x64\x9e\x64\xb1\xa8\xfa\xe3\xac\xc4\xdf\xfa\xc0\xef\x89\xf5\x35\x2a\xe6\xa2\xc7\x70\xcf\x4d\x7f\x14\x11\x4d\xfb\xc8\x9e\xc7\x4e\x63\x5f\x71\xbd\x34\xb2\x75\xac\xed\x59\x02\x70\x31\x88\x2d\x88\x05\xc8\x53\x14\x8f\x36\xf1\xaf\x79\xff\x73\xff\x3e\xf2\x56\xb1\x4a\x31\x47\x95\x66\x4b\x74\x92\xdf\x38\x9c\x4d\x10\xc0\x21\x2b\xaa\x20\xf4\x5e\x11\x37\x8a\x7c\x28\x44\x4a\x89\xb6\x76\xd0\x04\xc3\x07\x9c\xe6\x54\xfe\xbd\x79\x0a\x5f\x25\x87\x5b\xf7\x88\x79\x3a\xc4\xd3\x70\x99\xe1\xf4\x7a\x26\x7b\x88\xad\x2f\xca\x0f\x60\xe5\x2e\x4d\xcb\xc3\x34\xe2\x74\x10\xe8\x66\xf9\xba\x42\x31\x21\x49\x61\xfa\xaf\xcb\xd5\x8c\x52\xa7\xd0\x4c\xa4\x73\x89\xe8\xb1\xfb\x91\x9b\xe4\x28\xee\x51\x37\x7c\xb7\x33\x6f\xec\x46\x54\x99\x8c\x6c\x0c\x29\x76\xb8\xfc\x12\xad\x4a\xc5\x3a\xb2\x4e\x44\x1e\x62\x5d\xdf\xf1\xdc\x1b\x50\x21\xe4\x4c\xad\x7a\xc5\x75\x32\x2d\xdb\x1d\xe9\xca\x84\xe8\x58\xed\x1c\xdc\x68\xb7\xf0\xf5\x8f\x23\x54\xff\xd0\xe0\xdb\xfe\x7b\xdb\x0c\xfe\x1c\xbc\x6f\x53\xe2\xa0\x17\x43\xbc\x32\x6f\x1b\x54\x3b\xf5\x4e\x17\xd3\xa2\x2d\xfd\x9e\x27\x46\xb3\xeb\x0c\x8a\x66\x00\x4c\xa2\x98\xce\xb6\x1a\xb4\xbd\x31\x4d\x19\x92\xe8\x06\x86\x68\x62\x3d\xc7\xc7\xba\x1d\x6d\xa9\xd7\x7b\x1d\x6d\x06\x2a\x54\xf9\x06\x6e\x81\x12\xb3\xdd\xe8\x46\x7d\x36\x19\x6b\xf3\x57\x7e\x12\xfa\x1f\x36\x8d\xa5\x95\xd4\x4b\xb4\xbe\x0b\x70\xf4\x49\xac\xa9\x6b\x11\xe8\x75\xf0\x7c\x80\x56\x8e\xcd\xb9\xcf\x41\x6e\xe7\x32\xc9\x8b\x12\xbd\x81\x39\x6a\xdf\x34\xa5\x39\x83\xab\x25\xb0\x86\xc9\x35\x90\xc1\xbc\x55\x2d\xd0\x58\x57\x19\x65\x53\x32\x52\x1d\x84\xa1\x9e\xa4\xd0\xfa\xc1\x08\x60\xe3\x9f\xaf\x5f\x0d\x61\x40\xfe\x0b\xc6\xe5\xf5\xb3\x17\x97\xdb\x3c\x01\x7f\xba\xff\x03\x7f\x7a\xdb\x40\xfe\xfc\xe5\x87\x2f\xa2\xff\xf9\x9f\x2d\x40\x0f\xfe\x7b\x77\x77\xb7\xb5\xbb\xb7\x4d\xb3\x07\x8f\xf1\xcf\xbb\x9b\x77\x9b\x61\xcf\xb3\x73\x06\xee\x6e\x01\x1c\xfd\x1c\x69\x60\x82\x5e\xf3\xc0\x9b\x7f\x7b\x16\xbd\x7a\xf6\xcd\x0f\x2f\x86\xaf\xa2\x67\xff\xf9\xfd\xab\x67\xaf\x5f\x3f\xff\xee\xe5\xeb\xcd\xaf\x18\xbe\x7a\x16\x3d\xfd\xee\xdb\xe7\x2f\xbf\x11\x6e\x51\xae\x5a\x68\x0a\xa2\x5b\x88\x7d\xd1\x01\x41\xdf\x0e\x94\x23\x8c\x2c\x40\x03\xd3\xa8\x1c\x9c\x3f\x1c\xde\x7f\x8f\x6f\xe2\xd7\xe4\x3c\x60\xbe\x25\xb9\x63\x4e\xbd\xbd\x5e\x81\xf7\x9c\xb6\x28\xb8\x58\x65\xcb\xaf\xa2\xe8\xbb\x6b\x32\x64\x60\xf9\x8a\x8c\x73\x42\xde\x1b\x6e\x73\x68\x14\xdd\x22\x4e\xcc\x51\x2b\x93\x4c\x15\xd0\x06\xe5\xa4\x72\xe0\x33\x6a\x0d\x5c\x95\x78\xa1\x84\x79\x03\x3b\x18\x4f\xc0\x7b\x42\xa6\xcf\xb2\x05\x07\x3a\xc0\x73\x36\xb2\xed\x44\x28\x0c\x1f\x43\x26\x87\xfb\x94\xc4\x7c\x40\x2e\xfa\xd3\xd7\xaf\xa3\x6b\x75\xc7\x92\xd1\x8d\x7e\xf7\xea\x9b\xaf\xd1\x51\x87\x4b\x83\xe3\xc7\xd1\xde\xef\xda\x6f\xe3\xdd\x69\x7f\xf7\xec\x7d\xa7\xee\xdb\x5e\xd2\x7d\xd0\xd0\xce\xab\x6f\xbe\xf9\xda\x34\xb5\x7f\xe8\x35\xf5\xd3\xfe\x7d\xa7\xf9\x87\xdf\x66\x7e\x35\x32\x6d\xc2\xd7\x76\x9e\xe7\xdd\xab\xab\xab\xee\x68\x34\xea\x60\xe3\x70\xed\x31\x29\x51\xf0\x7e\x9f\xdd\x2d\xda\x5a\x33\xb7\x5b\x7f\xdc\x2b\x1e\xc2\x4d\xf8\xdc\x6b\xc3\x47\x7b\x6f\xf2\xd3\xa0\x7b\x00\xad\x17\x0f\xbb\xe1\x6f\x30\x06\xc6\x5e\xb4\x82\x7b\x7b\xf8\xf1\x79\xcb\xdc\xee\xb8\xb4\xc1\xbb\xbd\xbd\xab\x6e\xd4\x7a\xf7\xae\xd5\x81\x7f\x12\xf8\xdc\x0a\xeb\x6e\x1c\xc7\x06\xf3\x78\x2d\xea\x31\xfc\xe3\x61\xb6\xb1\x1f\xc1\x6f\xf9\x70\xfb\xab\xc7\xfa\xf6\x23\xf8\xba\xd7\x83\x7f\x3b\x5f\x21\x50\xe7\x17\xf4\xf0\x59\x82\x7c\x1c\x01\xab\xa0\xb1\x82\x7f\x86\xba\x43\x77\xeb\x3b\xf4\xd5\xdf\xa6\x47\x5f\xfd\x82\x2e\x81\xeb\xf4\x9f\x83\x41\xb4\x83\xfc\x34\x99\x4c\xf6\xf4\xdf\x1d\xf0\x3c\x66\x4b\x54\xe1\xd1\xdd\x60\x40\xcc\x46\xf9\x22\xfc\xe6\x98\x76\xd0\x3d\xbc\xef\xbc\xdb\xdb\x78\x01\x90\x72\xcc\xfd\x0c\xc2\xa0\xa4\xb8\xd6\x26\x09\x7d\x6f\x7c\x0b\xfe\x0b\xef\x80\x07\xff\xfc\x1e\x3f\xe0\xe9\x77\xc5\xfb\x47\x7b\x5d\xe9\x78\x3f\xcd\x52\xb0\x9a\xe0\x4c\x1b\x5e\x6b\x03\xaa\x5d\xfd\xb7\xa3\x5b\x24\xc4\x51\x85\x64\x18\x10\x62\xe7\xc4\x75\x9b\x50\xa6\x81\xc4\x56\xc4\x4d\x1d\x02\x5e\xa5\x59\xce\xf9\x13\xed\xc0\x17\x31\xf8\x11\xe8\xde\x4d\xe2\x32\x8e\xae\x41\xa9\xcd\x74\x0c\x64\x67\x2e\x5a\x80\x40\x8b\x3c\xd7\x2c\xa5\x19\x0c\x9a\x9d\x81\x20\x6a\xb4\x02\x2d\xc7\x28\xb9\x14\x29\xa8\xd1\x09\x7c\x9f\xc7\xb3\xe6\x5c\x2b\x3e\x41\x0e\x87\x8f\x23\xa2\x35\x66\x32\xf8\x31\x93\x79\x12\x9f\x09\x3a\x8d\xcc\x9a\x2e\xc1\x47\x49\x38\xca\xe3\x8b\xe3\x6c\x39\x33\xe9\x6c\xe7\x7a\x53\xcb\xec\xdb\xfb\xba\xf3\x6a\xf4\x26\xc3\x76\xbd\x24\x2e\xb4\xc3\xbe\xaa\xf5\xba\x41\x59\xcf\x54\xfb\xc6\x26\x6c\x30\xdf\xf1\x2d\x26\x5d\xe6\x09\x3c\xd0\x8d\xf6\x8f\x8e\x3a\xf0\xb2\xfd\xa3\x93\x4e\xaf\xcc\x5e\x13\xd2\xed\xc1\xb1\x76\x25\x21\x22\x06\x1f\xa8\x7d\x63\x92\xa2\x5f\x44\x87\xc6\xa3\xc5\x96\x5a\x7d\x74\x5f\x6f\x74\xd6\x46\xf7\xfc\xe6\x89\x49\x2c\x38\x2f\x9c\xc7\x7a\x8e\x69\xe2\xb6\x6f\x00\xb0\x23\x77\xf4\x36\x3f\x11\xa8\x1b\x43\x32\x51\xf3\xfa\x77\x0b\x19\x1e\x5f\xca\xfd\x02\x70\x70\x95\x3b\x98\x3b\xd9\xf3\xaf\xee\xd7\x5e\x3d\x78\xef\xa7\x2a\x2c\x03\x57\x18\xd3\x32\xac\xe1\xec\x5e\xaf\xd7\xa9\xe3\x5c\x33\xbe\xfc\x14\x4e\x10\x8c\x94\xdf\x1e\x87\xb3\x9c\x4d\x44\x55\xa5\x79\x80\xc7\x1e\xf3\xd2\xd8\x0c\xf6\xeb\x1a\xfe\xec\xd9\x0f\x9d\x1e\x14\x4c\xac\x11\x2b\xa2\x19\xce\x2e\x51\x3d\xc8\x61\x34\x49\xae\x30\x01\x81\x65\x21\x14\xb1\x2d\xe2\x09\xa6\x8f\x70\x06\x07\x3a\x70\x48\x29\x75\xcd\x06\x13\x30\xe8\xb7\x14\x88\x4d\x13\x9a\xd4\xb3\x49\x10\x94\x8a\xcd\xac\x1f\x92\x68\x1b\xd6\x0f\xc5\xe5\x2f\xc0\xfa\xa0\x00\xdf\x64\xd8\xae\x64\xfd\xf5\x6c\x0f\x6a\xee\xfb\x98\x89\xa2\x35\x0b\xce\x72\x09\x3a\x4e\xb1\xe8\x86\x49\x49\x11\x79\x52\x10\x21\xd1\x13\x6a\x2f\xf2\x6c\x14\x8f\x66\x9a\x31\xa1\x29\xe2\x63\x68\xe3\x8e\x6a\x37\xf4\x54\x1b\x4e\x2b\x24\xe3\xe5\x8c\xc8\x5e\xc4\x1c\xbd\xb3\xba\x4a\x52\xf0\xfa\x09\x18\x82\x21\x35\xc7\xb8\xd6\x34\x15\xe7\x39\x65\xa3\x50\x87\xea\x91\x63\x92\xe8\x59\x8d\x34\x5a\xa8\x1c\x79\x44\x3b\xff\xd9\x7c\x94\xa4\x3a\x05\x36\x35\x8d\x5c\xc5\xf3\x39\xf2\x49\x8e\x35\x41\x70\xab\xab\x29\xce\xe1\x46\x99\xc7\x29\xcf\x7e\xd0\x2d\x6c\xf8\x4f\xcb\x18\xc2\x35\x93\x9f\xb2\x01\xaf\x15\xf3\xf3\xf3\x68\xe0\x62\x5e\x0c\xd2\x98\x4d\x34\xaf\x2d\x62\xcb\x5f\x44\xb7\x11\xe6\x43\x16\x2a\x2e\xcd\x34\xae\xad\x55\x00\xe2\xec\x4c\x77\x60\x54\x01\x71\x55\xb8\xf6\x76\xa6\xf0\x67\x07\xee\xbe\x86\x71\xa2\x79\x60\x64\xcc\x98\x1c\x37\x21\x1e\x34\x0a\x54\x73\x82\xef\x00\x1d\x65\xf2\xbe\x05\x88\x94\x6b\x2d\x2e\xa2\xf1\xb2\xa4\xb7\x67\xd3\xa9\x55\xf3\xd0\xfc\x1f\x00\xf4\x63\xb2\xa0\x67\xe6\xc9\x64\x32\x43\x1f\x55\x2d\x88\x08\x34\x37\x3a\xc9\x96\xa3\x99\x68\xca\xc7\xde\x06\xe4\xc4\xd7\x54\xa8\xf2\x3c\x2d\xdb\x37\xa8\xf4\xba\x91\xd5\x92\xf7\xf5\x24\xdc\x0f\x48\x38\x4f\x30\x60\x9b\xa8\x78\x16\xa1\xf7\x0d\xe8\xa1\x40\x01\x31\x0b\x9c\x38\x67\xe2\x1a\xf6\x0c\x49\xea\xda\x21\x03\xd6\xc6\xd1\x45\x16\x8f\x96\x0b\x4d\x9a\x0e\x52\x93\x38\x2d\x08\x03\x19\x0e\x9a\xc6\xf4\x87\x6b\x87\x29\x9e\xae\xc0\xfd\x27\xdf\x1d\x63\x5b\x22\x89\xee\x2d\xe5\x9a\x20\x88\xc6\xa2\x16\xe7\x7c\xd4\x92\x63\x33\x29\x0e\x3c\x52\xbc\xb9\xce\x95\xf2\xfb\x8b\x72\xa1\x13\xad\x5a\x0c\x2a\x4c\x35\x25\x4c\xe8\xa9\x9e\x6b\x4b\xf5\xae\x7a\xd1\xa0\x3f\x35\x3c\x86\xdf\xa7\x3d\x61\xa3\x68\xb0\x7a\xc5\x72\x04\x5a\xa9\xbd\xef\xa3\x89\xc3\x42\xd4\x61\xbd\x78\x8d\xf3\x8a\xce\x41\xe8\x49\x43\x44\x36\x33\xc7\xa8\xbf\x1d\x74\x3c\xda\x23\xf2\xd7\x59\xbd\x7a\x8b\xc7\x0e\x5c\xb3\xcd\x13\xe0\x68\x3a\xde\x64\x60\x34\x40\x95\x91\x19\xa4\xac\xd3\x02\x93\x12\xed\x3e\xbc\x5d\xa6\x46\xc5\x63\x54\x7b\x41\xcf\x0d\x29\x8b\x35\x8f\x17\x6d\x62\x83\x4e\xad\xf9\x2b\xb8\x6c\x50\xcf\x20\xa3\x66\x6d\xe9\xb0\xa9\xe5\xbb\x63\x64\x13\x81\x4c\x49\x6e\x4d\xa2\x2e\xc8\x98\x1b\xeb\x41\xb3\x87\xec\xb8\x59\x0d\x8e\xa6\x86\xfc\xde\x1e\x5b\x34\xad\xf4\xe3\x54\xcf\xdd\x5b\xc0\xae\x33\x63\xda\x53\x9e\xb0\xa2\x46\x93\x51\x6f\x9f\x7e\xe6\x49\xdb\x2f\xf8\xd7\x97\xf7\x98\x52\x67\x65\x25\x4c\x6d\xae\x6b\x55\x40\xa9\xd8\xab\xac\x85\x3d\x5b\x53\x67\xc5\x2a\xed\x53\x06\xdc\xf6\xcc\xbe\x80\xdb\xac\xd8\x2a\x50\x68\x34\x0e\xd2\x56\xc5\xf9\x55\x60\xad\x74\x7b\xed\x6b\x7f\x06\x3d\xc7\xc9\x62\xbc\x28\x24\xe9\xb0\x13\x7d\x65\x73\x8a\x01\x63\x51\xac\x1c\x3d\xae\xb9\xbc\x7f\xe8\xa6\xde\x98\x37\xb1\x55\xe6\xce\x5c\x75\xac\xcc\xca\x89\xd8\xd0\x03\xf3\x7c\xb0\x36\x4f\x5b\x69\x41\x60\x37\x8c\xa5\x01\x9c\xae\x6e\x24\xe2\x23\x1f\x6a\x7f\x2b\xa8\x03\x07\xd5\x69\x3d\x91\xf3\x54\x40\xbb\xc6\xb9\xea\x86\xa9\xf1\xfa\xf9\x3a\xb8\x81\xf3\x74\xe7\x96\xf6\x7c\x41\xa6\x50\x65\x8e\x15\xdf\xeb\xc1\x3a\x79\xd7\x54\x81\x6b\xdb\xc9\x96\x75\x26\x51\x6c\x3c\x99\xaa\x97\x3a\x9b\x68\x99\x46\x57\xe0\x2b\xa0\xd2\xa6\x98\xdd\x35\xc2\x65\x13\xf1\x6c\x71\x1d\x83\x96\x54\xe0\x4a\xd9\xa9\xea\x28\xbe\x8d\x57\x7f\x7f\xb2\x69\x69\x50\x15\x50\xa9\x58\x98\x65\xb5\xb0\xfe\x15\xa5\x94\x82\xa9\x7f\x03\xdf\x63\x2b\x29\x45\xe5\x2d\xa4\xd4\xcd\x33\xe8\xd6\xc6\x58\x83\x85\x3a\xdb\x68\x79\x27\x39\xbf\x43\xb1\xe1\xc4\xfe\x9f\xc1\xce\xb5\xdb\x6d\x8f\xef\xfb\x10\xb4\x7c\xf1\x05\xb1\xfe\xcf\x56\x32\x6a\xff\xb4\x03\xd9\xa3\xe7\xa2\xd3\x4f\x7c\x6e\x5f\x3f\xd7\xef\xf8\xc1\x5f\x37\x3a\xee\xfc\x83\x8a\xdd\x9b\x58\xcf\xd0\xf1\xc4\xc5\x18\x1c\x7c\x16\x26\x2a\x1c\x4d\x68\x20\xc9\xb7\xc6\x87\x29\x0a\xe2\x30\x0f\x13\x65\x19\x99\xb5\xd8\x8f\xef\x5e\xd1\x7b\x8a\x0d\x51\x0b\xfc\x03\x1e\x36\x4e\x41\x56\xe3\x15\x7b\x2b\x88\x59\x00\x23\x26\x0c\x52\x18\x7e\x18\x27\x85\x0c\x3b\xea\x7a\x60\x97\x26\xc7\xc0\xd8\x15\x6a\xc4\xce\xf5\xd4\x84\xd6\x3d\x2c\x56\x27\x28\xaf\x29\xb8\x20\xc3\xea\x5a\x97\x83\x9b\xae\x4d\xf7\x1c\x20\xad\x0e\x23\xaf\xd6\x53\x92\x52\x2b\x27\x16\xc7\x0a\x41\x84\x7b\xe2\x4b\xdc\x4a\xcc\xde\x91\x36\x3b\x97\xb3\x70\xd1\x97\xe8\x47\x7e\x15\xb1\x85\x00\x3b\x37\x78\xe2\x27\x06\x62\xb2\x4a\x2c\x48\xd6\xc2\x44\x2c\x20\xfe\xef\x7d\xf9\x9b\xde\xa4\x4d\x8d\xe8\xed\x77\xd0\x57\x4e\x8a\x3b\xed\x0a\xa1\x41\x9a\xaa\x19\xea\x29\xee\xe8\x1e\x31\x0c\xf5\xab\xd2\xcd\x42\x95\x43\xdd\x0b\xdb\x47\x00\xef\x72\x5b\x75\x13\x95\x4d\x0a\x44\xf7\xf8\x9c\x9f\xdc\xca\xe7\xf3\x47\xee\xdb\xe4\x0e\x03\x4c\x95\x8f\x61\xb8\xe2\x2b\x0a\xaf\xe2\x08\x5c\xeb\x52\x4b\x07\x8f\x1d\x84\x08\x85\x6a\xe8\xcd\x3c\xf1\xd4\x23\x42\x76\xa9\x85\xae\x69\xd7\xeb\xd1\xa0\xa1\x4b\xf8\x1c\xf5\x49\xc3\xed\x37\xc0\x61\xcb\x9d\x27\x4d\x15\x6f\x87\x4f\xa2\x47\x8f\x12\xa9\x85\x31\xfc\xe6\x59\xd9\x7d\x54\x30\xbb\x84\x83\xad\x73\xd3\x3f\x00\xa0\xce\x8f\xd7\x77\xd1\xdf\xa0\x66\x1e\xda\x1e\x85\xda\xa6\x99\xde\x03\x9f\xe0\xaf\xb1\xa4\xa9\xca\x23\x56\x46\xac\xb9\xc3\x78\xda\x66\x78\xac\xad\xff\x2e\x8d\x8a\xe5\x78\xac\x8a\x02\xb8\xa5\x22\x68\xa6\xb0\x8c\x91\xa2\x4a\x97\x4b\xd6\x5d\xda\xc0\x09\x87\x00\x5b\x33\xf0\x85\xa2\x98\x7d\x50\x19\x5b\x43\x75\x39\xc0\x74\xcb\xe9\x27\x66\x0a\xa7\xa1\x0e\x59\x43\x61\xd7\x5a\x55\x6b\xc8\xd0\x4d\xf9\xbe\xb8\xe3\xaa\x0f\xad\xd0\xeb\x61\x0a\xe7\xd4\xad\x9a\x5f\x35\x98\x88\x6d\x5f\xfa\x09\xef\xb4\xe5\x84\x83\xf5\x68\x20\x63\x98\xaa\x2e\xc5\x73\xe7\x4f\xd1\x26\xa4\xef\x5a\x20\x57\x48\x53\x9e\xdf\x67\x52\x0a\xb1\x65\x9f\x7a\x53\x1e\x92\x0a\x81\xb4\x60\x7a\x8e\xa3\x67\x9f\x5e\xba\x1a\x6c\xd0\xb6\x8b\x05\xe6\xfe\xa6\x9c\xfa\xe1\xda\x58\xe7\x06\x41\x4b\xb3\xec\x16\x58\x1b\x64\x90\xb3\x8b\xc8\x26\xfc\x1a\x72\xec\x96\xe9\xc7\x14\x9c\xc6\xae\x36\x76\x85\xe3\x30\x59\x4b\x33\xd3\x2b\x0d\x04\x96\xd0\x32\xb2\x0f\xc4\x99\x0b\x0c\xd7\x01\x68\xa2\x30\xb1\x35\x89\xa6\x79\x36\xe7\x94\x4d\x99\x8d\x3f\x62\xef\x74\xb6\xb3\x57\xde\x95\x72\x5a\xba\xbe\x40\x8a\xfd\x38\xf9\x9e\x8d\x19\x47\xca\x83\x15\x20\x50\x94\xbd\xab\x27\x9c\x6f\x9f\x8d\xc5\x0b\x0b\x96\x1c\xf7\xeb\xa1\xf0\x34\x15\xfe\x43\xc4\x6f\xb2\xd1\x0e\x82\x2a\x9a\xde\x93\x36\xa3\x96\xce\x79\x9a\xa5\xcc\x5e\xe0\x70\x3c\x85\xe1\x68\xdb\x74\xc0\x5f\xe7\x55\x6e\xe2\xa9\x78\x44\x33\x4f\xad\xbf\xc2\x0b\x9b\xb8\xfb\x8d\x1d\x7e\x1e\xca\x45\x3c\x53\x65\x59\x1d\x08\x82\x79\x8a\xdf\xbf\x67\x08\xdf\x36\x18\x9f\x07\xde\xd4\x7e\x4b\x69\x24\x15\xed\x0c\x5f\xbe\x7e\x0e\x0e\xf3\x0e\x2d\x2f\x80\x3f\xad\xdf\xf5\xe9\x0f\x1a\xf7\xdf\x3d\x7d\x6a\xbf\x1e\x3e\x3b\x1b\xf6\x8f\xf9\xea\xe1\x90\xae\x6a\xf8\x83\xc3\xe3\xa3\xe1\x21\xdd\x39\x39\x3a\xea\x9f\x7c\x4d\x5f\xfb\xc7\x67\xa7\x67\x43\xfa\x7a\x71\x70\x71\xf2\xf4\xd2\xc2\x1f\x1d\x1d\x9d\x1c\x1d\xd0\x9d\x67\x97\xfb\x67\xfb\x67\x0c\xdf\xff\x7a\x38\xe0\xab\x97\x4f\x9f\x9d\x1d\x3a\xf8\x93\xfd\xb3\x4b\x7c\x1c\xef\xec\xf7\xfb\x4f\xbf\x36\xf0\x47\x5f\x5f\x70\x2b\xf8\xe7\x69\xab\x6b\x73\x52\xd8\xb1\xe3\xbb\x63\x4d\xad\xf1\x72\xc4\x6b\x37\x2b\xdd\xc3\x2f\x47\x97\xf6\xeb\xe9\x89\xfd\x3a\x74\x57\x2f\xdc\xd5\x4b\x87\x14\x3e\x68\x5b\x39\xba\xb4\xad\x1c\x5d\xda\x56\x8e\x2e\x87\xee\xea\x85\xbb\xea\xb5\x72\x7a\x62\x5b\x39\x3d\xb1\xad\x9c\x9e\xd8\x56\x4e\x4f\x86\xee\xea\x85\xbb\xea\xb5\x32\x74\xb8\x0c\x1d\x2e\x43\x87\xcb\xd0\xe1\x32\x74\xb8\x0c\x7d\x5c\x2e\x1c\x2e\x17\x0e\x97\x0b\x87\xcb\x85\xc3\xe5\xc2\xe1\x72\xe1\xe3\x72\xe9\x70\xb9\x74\xb8\x5c\x3a\x5c\x2e\x1d\x2e\x97\x0e\x97\x4b\xc6\xc5\xf0\xc8\xa5\x1d\x24\xfc\xaa\x9b\xc1\xaf\xba\x19\xfc\x3a\x74\x57\x2f\xdc\x55\x81\x0c\x8e\x8b\x6d\xc5\x0e\x12\x7e\xb1\xad\xd8\x41\xc2\xaf\x17\xee\xaa\xd7\x8a\x1d\x24\xfc\x6a\x5b\xb1\x83\x84\x5f\x87\xee\xea\x85\xbb\xea\xb5\x32\x74\xb8\x0c\x1d\x2e\x43\x87\xcb\xd0\xe1\x32\x74\xb8\x0c\x7d\x5c\x2e\x1c\x2e\x17\x0e\x97\x0b\x87\xcb\x85\xc3\xe5\xc2\xe1\x72\xe1\xe3\x72\xe9\x70\xb9\x74\xb8\x5c\x3a\x5c\x2e\x1d\x2e\x97\x0e\x17\x7f\x90\x90\x2c\xba\x19\xfc\xaa\x9b\xc1\xaf\xba\x19\xfc\x3a\x74\x57\x2f\xdc\x55\x81\x0c\x52\xd4\xb6\x62\x07\x09\xbf\xda\x56\xec\x20\xe1\xd7\x0b\x77\xd5\x6b\xc5\x0e\x12\x7e\xb5\xad\xd8\x41\xc2\x2f\x43\x77\xf5\xc2\x5d\xf5\x5a\x19\x3a\x5c\x86\x0e\x97\xa1\xc3\x65\xe8\x70\x19\x3a\x5c\x86\x3e\x2e\x17\x0e\x97\x0b\x87\xcb\x85\xc3\xe5\xc2\xe1\x72\xe1\x70\xb9\xf0\x71\xb9\x74\xb8\x5c\x3a\x5c\x2e\x1d\x2e\x97\x0e\x97\x4b\x87\x8b\x3f\x48\x43\x27\x49\x43\x27\x49\x43\x27\x49\x43\x27\x49\x43\x27\x49\x43\x5f\x92\x86\x4e\x92\x86\x4e\x92\x86\x4e\x92\x86\x4e\x92\x86\x4e\x92\x86\xbe\x24\x0d\x9d\x24\x0d\x9d\x24\x0d\x9d\x24\x0d\x9d\x24\x0d\x9d\x24\x0d\x7d\x49\x1a\x3a\x49\x1a\x3a\x49\x1a\x3a\x49\x1a\x3a\x49\x1a\x3a\x49\x1a\xfa\x92\x34\x74\x92\x34\x74\x92\x34\x74\x92\x34\x74\x92\x34\x74\x92\x34\xf4\x25\x69\xe8\x24\x69\xe8\x24\x69\xe8\x24\x69\xe8\x24\x69\xe8\x24\x69\x18\x48\xd2\x85\x93\xa4\x0b\x27\x49\x17\x4e\x92\x2e\x9c\x24\x5d\x38\x49\xba\xf0\x25\xe9\xc2\x49\xd2\x85\x93\xa4\x0b\x27\x49\x17\x4e\x92\x2e\x9c\x24\x5d\xf8\x92\x74\xe1\x24\xe9\xc2\x49\xd2\x85\x93\xa4\x0b\x27\x49\x17\x4e\x92\x2e\x7c\x49\xba\x70\x92\x74\xe1\x24\xe9\xc2\x49\xd2\x85\x93\xa4\x0b\x27\x49\x17\xbe\x24\x5d\x38\x49\xba\x70\x92\x74\xe1\x24\xe9\xc2\x49\xd2\x85\x93\xa4\x0b\x5f\x92\x2e\x9c\x24\x5d\x38\x49\xba\x70\x92\x74\xe1\x24\xe9\xc2\x49\xd2\x45\x20\x49\x97\x4e\x92\x2e\x9d\x24\x5d\x3a\x49\xba\x74\x92\x74\xe9\x24\xe9\xd2\x97\xa4\x4b\x27\x49\x97\x4e\x92\x2e\x9d\x24\x5d\x3a\x49\xba\x74\x92\x74\xe9\x4b\xd2\xa5\x93\xa4\x4b\x27\x49\x97\x4e\x92\x2e\x9d\x24\x5d\x3a\x49\xba\xf4\x25\xe9\xd2\x49\xd2\xa5\x93\xa4\x4b\x27\x49\x97\x4e\x92\x2e\x9d\x24\x5d\xfa\x92\x74\xe9\x24\xe9\xd2\x49\xd2\xa5\x93\xa4\x4b\x27\x49\x97\x4e\x92\x2e\x7d\x49\xba\x74\x92\x74\xe9\x24\xe9\xd2\x49\xd2\xa5\x93\xa4\x4b\x27\x49\x97\x9e\x24\x69\xdf\xef\x2a\x57\x2b\x9e\xb5\x85\x80\x68\x21\x5c\xbf\x53\xfc\x8f\x9e\x1b\xec\xe3\x7f\xfc\xf5\x29\xfe\x47\x5f\xf7\x8f\xf1\x3f\xfa\x7a\xd0\xc7\xff\xf8\xeb\x10\xff\xb3\x98\x1e\xd2\x1f\xba\x73\xf8\x0c\xff\x63\xe3\x78\x8a\xff\xd1\x57\x6a\x84\xdb\x3e\x7e\x8a\xff\xd1\xd7\x93\x63\xfc\xcf\xa9\x77\x42\x86\x55\xf6\x10\xff\xa3\xaf\x67\x87\xf8\x1f\x7f\x7d\x86\xff\xb1\xba\x20\x08\xfa\xfa\xf5\x3e\xfe\x67\x5b\xf9\xfa\x29\xfe\x47\x77\xe8\x4d\x8c\xfb\x45\x1f\xff\xe3\xaf\x43\xfc\x8f\xbe\x12\xae\xdc\x36\x79\xcc\xcf\xa8\xae\x0e\x53\xc7\x32\xce\x18\x2f\xf3\x5c\xd9\xb4\x96\x8e\x34\xba\x66\xc9\xf3\x8a\xa7\x2c\x96\x85\xca\x29\x97\x77\x55\x33\x19\x30\x6e\x0c\x40\x2a\xf1\x89\x5f\xdd\x3d\x89\x74\xf1\x76\x3c\xc6\x75\xe4\x7a\xfa\xdd\x8b\x7d\x2b\x81\x6f\xf5\xcd\x2f\xf5\xca\x38\x0c\x3d\x77\x62\x9c\xe9\x1d\x41\xd0\xba\xf3\x98\x4a\x02\xdb\xfb\x87\xfd\x6e\xb4\x7f\x78\xca\x85\x5b\x3b\x5d\x02\x4a\xcb\xe4\x4f\x4b\x75\x7b\x9d\x94\x0e\xee\x08\xe1\x0e\x8e\xe0\x63\x50\x07\x37\x70\x80\x08\x73\x70\x86\x80\x67\x35\x80\xfb\x16\xf0\x00\x5f\xba\x7f\x00\x1f\xfd\xc3\x1a\xc0\x03\x0b\xd8\x87\x16\x07\x67\xfb\xf0\x71\x72\x5c\x03\x78\x68\x00\x07\xf8\xd6\xc1\xc1\x00\x3e\xf6\xfb\x06\xf0\x4f\xcb\x78\x1e\x43\x30\x6f\x7b\x32\xd8\x3f\xa1\xce\x22\x82\xfb\x15\xa8\xc1\x76\x60\xb6\x17\x83\x01\xf6\x02\xbb\x32\x38\x3b\xad\x80\xd9\x3e\x0c\xfa\xfb\xd8\x4f\xec\xc8\x49\x15\x35\xdb\x83\x63\xea\x00\x7e\x0c\x6c\x4f\xff\xbc\xcc\x83\xd1\x22\xa4\xdc\x68\x21\xc0\x60\x23\x84\xa3\xfb\xfe\xa1\xc6\x18\x3e\x24\x84\x43\xf6\xec\x40\x23\x0b\x1f\x12\x42\x50\x7a\x60\x10\x3d\x30\x83\x3c\x52\xc9\x95\x40\x14\x9f\xa6\x0f\x3b\x14\xa3\xa4\xf8\x93\x60\x3c\xc2\x71\x9f\x08\x77\xec\x41\x0c\x36\x83\x04\x4c\x34\x00\x7c\x07\xa7\x07\x1e\x48\xc0\x3e\xa7\x08\x72\x74\xea\x81\x04\x8c\xb3\x8f\x70\xfd\x13\x03\x32\x8b\xc7\x1f\x0d\x00\xd0\x14\xff\x77\xb7\xd2\xf1\xb5\x9a\xc4\xb3\x79\x96\x4e\x02\xc6\xf7\xa8\x26\x25\x8d\xdb\x70\xa3\x82\xf7\x06\xeb\x6e\xee\x07\x37\xed\x68\xe1\xcd\x83\xe0\xa6\xf7\xca\x43\xff\xa6\x18\x23\xb8\x79\x93\x64\xa0\x6b\x5c\xd7\x81\x80\x87\x38\xde\xfb\x96\xc4\x38\xcf\x6b\xef\x1f\x43\x87\x0e\xf7\xf1\xaf\xbc\xed\x8f\xd1\xf1\x21\xfe\x95\xf7\xfd\x01\x3a\x3a\xc3\xbf\xf2\xbe\x3f\x3a\x47\x03\xfc\x2b\xef\xfb\x43\x83\x44\x3d\xb0\x1d\x5c\xe6\xb3\xd5\x6d\x96\x39\xc2\xef\xa3\x6a\x38\x3d\xc4\x8e\x56\x80\x02\x66\x1a\x20\xdf\x1e\x55\xa0\x7c\x74\x07\x67\x20\xfa\x83\xc3\x0a\x54\xc0\x52\x27\x7d\x62\x9a\x10\x2a\xe0\xaa\x01\x80\x9e\x1a\xa0\x71\x3c\x51\xa5\x64\x8a\xb3\x23\x62\x4b\xac\x4e\xe8\x87\x30\x4e\x15\x1d\xed\x1b\x61\x3a\xaa\xb4\xe4\x34\x11\x8e\xd2\xfe\xfe\x99\xe4\x14\x0b\xe5\x64\x9b\x88\x85\x1d\x74\x2c\x63\xa1\x2c\xea\x24\x2d\x07\x87\x92\x75\xb0\x88\xad\xcc\x15\x58\xba\xaa\x86\xec\x57\x60\x6a\xd4\x68\x15\xa8\x46\x89\x56\x81\x6a\x54\x68\x15\xa8\xaa\x40\x1d\x4c\x06\x56\x30\x16\x86\x6c\x80\xc3\x86\xcd\x1c\x54\x60\x7c\x66\x21\xd4\x0f\x8e\x43\xa0\x80\x57\x10\xf5\x83\x83\x10\x28\x60\x15\x42\xfd\x2c\x04\xf2\x39\x85\x50\xb7\x30\x59\x1e\xcf\xaa\xd8\x9c\xf6\xe5\xfd\x00\xdd\x01\x8c\xd7\xe9\xb1\x04\x08\x50\xed\x1f\x87\x2d\xf8\x68\x9e\x0d\x10\x0b\x79\x3f\xc0\x10\xd5\xc0\x89\xbb\x9f\x4e\x29\xfb\x2f\xf9\x79\xd0\x47\xea\x1e\x12\x13\x4a\xc8\x22\x99\x7d\xf4\x25\x91\x5c\x8e\xfd\x7e\x00\x33\xd8\x06\x28\xd0\xfe\x07\xfb\x1e\x33\x6b\x20\xbf\x6b\xfb\x84\xd7\x49\x88\x52\xe8\x3a\x1c\x4b\xd7\x61\xbc\x8a\x53\xa1\x48\x03\xa3\x8a\x77\x07\xeb\x6f\x4b\x05\x1e\x18\x5c\xbc\x2d\x55\x78\x60\x6d\xf1\xb6\x54\xe2\x81\xa9\x9d\xc4\xf9\xc7\xaa\x69\xf1\xef\x07\xd8\xd7\xb4\x70\x95\xcd\x26\x2a\xcd\x9d\x22\xd5\x3a\x14\x3f\x06\x75\x70\x01\xbf\x9d\x92\xee\xaa\x03\x0c\xf8\xee\x04\xb5\xc9\x61\x1d\x60\x20\x26\x87\x64\x86\xeb\x00\x83\x81\xea\x03\xa7\x9e\x4a\xb8\x3c\x5e\x39\x8b\x85\x10\xfa\xc3\x83\x51\xca\xa3\x48\x5f\x98\x74\x0d\xb0\xb1\x91\x8f\xd7\xf1\xc7\xc4\xd1\xeb\xcc\x78\x16\xd6\x6d\x40\xa0\x79\x7c\x85\xb3\xe2\x1e\xca\x95\xf1\xc9\x66\xc9\x8d\xf2\x70\x3a\x65\xff\x43\xc8\x98\x0f\xe7\xc8\x4f\xea\x84\x65\x7e\xbf\x16\xd4\x69\xd6\x53\xeb\x9e\xf6\x0f\x6b\x41\x9d\x7e\x3d\x36\xfa\xf5\xac\x5f\x0b\xe9\xc6\x60\x60\x18\xea\x58\xf2\x09\x28\x8c\xf4\xca\xf7\xef\x06\x87\x01\x8d\x19\xa6\x46\xcf\x56\x81\x6a\xf4\x6c\x15\xa8\x46\xcf\x56\x81\xaa\x7a\xd6\x87\x19\x5f\x27\x4e\x06\x8e\x60\x38\x29\xd6\xf1\xe9\x45\x40\xce\xaa\x91\xaa\xdc\x97\x02\xef\xa0\x1c\xf1\x4f\xd0\xf7\xf1\xe4\xde\x41\x39\xba\x1f\x1d\x9a\x37\x56\xdb\x72\xa8\xf7\x01\xca\xb7\xc8\x08\x95\xab\x49\xc8\x66\xb2\x6f\x05\xb9\xa8\x8e\x90\xe4\x04\x93\xdb\x22\xf9\xa6\x50\xb1\xc7\x88\x83\x43\xf2\xa7\x91\xea\x87\x07\x35\x70\x03\x3f\x50\xa0\x31\x3c\xab\x03\x14\x6c\x68\x54\xe0\xe0\xb4\x5f\x03\x28\x88\x71\x64\xe2\x24\x8f\xb2\x06\x50\xd0\xe3\xc8\x28\x35\x8f\x6c\x05\x1a\x56\xa9\x1b\x4f\xf6\x91\x4d\x43\xba\x11\x98\xd4\x1a\x87\xc0\x83\x27\x67\xf8\xb7\x0e\x4a\xb8\x62\x83\x8a\xaa\xf7\x20\x85\x3b\x36\xa8\x68\x7d\x0f\x52\xb8\x64\x83\x8a\x01\xf0\x20\x9d\x5b\xb6\x5f\xab\xc8\x35\xa0\x5a\xdf\x99\x72\x99\xff\x69\x99\x25\x85\xf2\xcc\xce\x31\x7e\x48\xb0\x20\x3c\x40\x0b\xdc\x27\xc7\xd9\xc0\xa8\x51\x12\xa7\x82\xef\xf6\xd1\xc3\x45\xdf\xc4\x41\x28\x9c\xb5\x0f\xec\x3d\xf9\x05\x27\x01\xc8\x60\x0b\x98\x40\x0f\xe0\xdf\x83\x10\x26\x50\x03\xc7\xa4\x2f\x02\x98\xd0\x84\x08\x5f\x08\x41\x8a\x8f\xab\xc0\xa4\x92\x90\x8b\x61\x76\x40\x83\xad\xa0\xa4\xf9\x27\x55\x20\x18\xc1\x41\x49\x2f\x80\x54\x81\x60\x02\x07\xe5\x39\x03\x7d\x5f\x0d\x24\x73\xcf\xfc\xb1\x22\x3c\xf2\x04\x03\x41\xd4\x7a\x90\x6c\x72\xe5\xbb\x72\x07\x34\x1a\x87\x5e\xe7\x2c\xd0\x60\x2b\x28\x37\x74\xa7\xda\xb1\x10\x24\xb0\x50\x6e\xf0\xc8\xf3\x38\xf6\x48\x60\xa1\xdc\xf0\x01\xc0\xc9\xa9\xa4\xc0\x34\xc9\xd5\x08\x17\x84\x7b\x8a\xf7\x80\x14\x66\x08\xe2\x73\x1c\x72\xf7\xe1\x69\x08\xe3\x73\x1c\x76\xee\xb0\xd2\x8e\xcf\x71\x08\x77\x50\x69\xc7\xe7\xb8\x7d\xec\x98\x71\xcf\xc1\x73\x06\xf7\x3a\xc8\xb0\x91\x56\xa1\x74\x9c\x61\xcc\x69\x96\xab\xa2\xf4\x94\xb3\xb6\x01\xa2\x6f\x57\x71\x92\x16\xa3\x2c\xcf\x5c\x40\xdc\x27\xb7\x59\xfa\xce\x57\xd7\x59\x51\xfa\xef\x23\xe7\xda\xcf\xfc\xa1\xbf\x15\x04\xcc\x22\xde\xc2\xbb\x61\x3c\x1d\xdc\x0e\x5c\x73\xf4\xd3\xe4\xed\x30\x82\x3e\xf0\x6f\x87\xa1\xf3\x89\x7f\xdb\x73\x56\xf7\x49\x13\x60\x76\xe2\x60\x3f\x84\x09\xfc\x0b\xb4\x52\x56\x65\x34\x39\xa9\x68\xa1\x1c\x49\x1b\x1c\x54\xea\xf3\x59\x08\x14\x6a\x16\x52\x65\x06\x48\x8a\xe6\x19\xe9\x0b\xfe\x10\xf7\xfb\xbe\x1f\x2f\x6f\x39\x39\x03\xec\xe0\x7f\x79\xcb\x3e\xc6\x9c\x25\xb8\x8b\x6f\xf7\x03\xce\xf2\x8c\x16\x81\x0c\xa4\x7c\xf2\x5f\x79\xdb\x52\x08\xb3\x7d\xfc\x57\xde\xb6\xb4\x41\xb7\x82\xff\xca\xdb\x96\x2a\x18\x55\xf1\x5f\x79\xfb\xc8\xde\x3e\x0d\xe4\x87\x6e\x1f\x5b\x5b\x06\xef\xe5\xbf\xf2\xf6\x89\xbd\x7d\xc0\xe9\xab\x43\xef\xdd\xa7\xf6\x36\xbc\x97\xff\xca\xdb\x67\xf6\xf6\x69\xa0\x03\x3c\x13\x8e\x99\x29\xf8\x5f\xde\xb2\x34\xe5\x94\x95\x48\x5b\xd1\x6d\x4b\x50\xf2\xe9\xe8\xaf\xbc\xed\x5a\x06\x94\xf8\xaf\xbc\x6d\x09\xca\xf9\x32\x91\x33\xa3\xdb\x2e\xc9\x31\x60\x97\xe6\xd8\x7b\xb7\x25\x28\x67\xe3\x44\x46\x8e\x6e\x5b\x82\x1e\xc3\x7b\xf9\xaf\xbc\x7d\x22\x33\x28\xfc\x57\xde\xb6\x04\x3d\x81\xf7\xf2\x5f\x79\xdb\x12\xf4\x04\xde\xcb\x7f\xc5\x6d\xdb\x2f\xa0\xf4\xa9\x0b\xdc\xe8\x96\x25\xe8\x09\xfa\x2c\xf4\x57\xde\xb6\x04\x65\x77\x46\xb8\x34\x74\x7b\x5f\x7a\x46\xfc\x57\xde\x76\x2f\xc6\xd4\x08\xfd\x95\xb7\x9d\x5f\x85\xee\x0b\xfd\x95\xb7\x2d\x41\x31\xcc\xe3\xbf\xf2\xb6\x25\x28\xce\x4c\xf0\x5f\x79\xdb\x12\xf4\x0c\xde\xcb\x7f\xe5\x6d\x4b\x50\x4c\xc5\xf1\x5f\x79\xdb\x12\xf4\x0c\xde\xcb\x7f\xc5\x6d\xe1\x05\xb3\x27\x33\x90\x3a\xe3\xb0\xef\x6e\xef\xeb\xa0\x08\x3e\x24\xc4\x60\x9d\x2b\x40\x10\xce\x8f\xc5\x88\xd4\x7c\x48\x88\x03\x3f\x1c\xd4\x1f\x12\x42\x04\x8c\xfb\x14\xab\xca\x80\x95\x20\x8e\x1c\xc4\x91\xce\x95\x0e\x06\x1e\x1e\xc7\x0e\xe2\x44\x9b\x04\xf8\x90\x10\x27\xce\x8f\xa6\xc8\xa6\x2f\x73\x38\x04\x71\xea\x20\xf6\x29\xf6\x91\x01\x10\x41\x9c\x39\x88\x23\x33\x13\xb0\x2f\xf1\x70\x88\x52\x66\x14\xff\xca\xbb\x8e\xe2\x18\xcb\x9a\x0f\x09\xe1\x28\x4e\x1e\x93\xfe\x90\x10\x8e\xe2\x14\xa6\xe9\x0f\x09\xe1\x28\x7e\x40\xc1\x0f\x7f\x48\x08\x61\x89\xc8\x43\xe2\x0f\x09\xe1\x3a\x72\xd8\xd7\xf1\xf9\xe0\xd0\xc3\xe3\xd8\x0f\x03\xf5\x87\x84\x70\x14\x3f\xa4\x18\x9f\x3f\x24\xc4\xa9\x17\x3f\x98\x0f\x09\xe1\x28\x4e\xf1\xa8\xfe\x10\x10\x0e\x0d\x32\xbc\x22\xd5\x44\x77\xfb\x5e\xc0\x6e\x3e\x24\x84\x88\xd9\x30\x1e\xd0\x1f\x12\xc2\x51\x9c\x32\xf0\xfa\x43\x42\x88\xe4\x08\x86\x90\xfa\x43\x42\x08\xb7\x14\x51\xd0\x1f\x12\xc2\x51\x1c\xb5\xae\xf9\x90\x10\xae\xab\xc7\xe4\xd3\xf0\x87\x84\x70\x14\x47\xdd\x6b\x3e\x24\x84\xa3\x38\x65\xdb\xf4\x87\x84\x70\x14\x3f\x41\x14\xf4\x87\x80\x70\x2f\x31\x71\x96\xc4\xe1\xc4\x51\x1c\xf5\xb0\xf9\x90\x10\x8e\xe2\xa7\x88\xa0\xfe\x90\x10\x22\x21\x80\x6e\xac\xfe\x90\x10\x8e\xe2\xa7\x88\xa0\xfe\x90\x10\x8e\xe2\x9c\x7e\xe3\x0f\x09\xe1\x28\x8e\xb1\x99\xf9\x90\x10\x8e\xe2\xa8\x99\xcd\x87\x84\x70\xc4\x38\x43\x14\xf4\x87\x84\x70\x14\x3f\xa3\xcc\x3d\x7f\x48\x88\x33\xe7\x3c\x0e\xb4\x33\x0c\x1f\x02\xe2\xd4\x01\x70\xf4\xeb\xe9\xad\x53\xe7\xc0\xf5\x29\x2e\x3c\x94\x59\x29\x82\x10\x29\x41\x9a\xd1\xe1\x0f\x09\xe1\xbc\xdc\xfe\x19\x85\xfa\x32\xde\x27\x08\xe7\xe2\xa2\x82\x36\x1f\x12\xe2\xd0\x41\x20\x0a\xfa\x43\x42\x1c\x39\x08\x44\x41\x7f\x48\x88\x63\x07\xc1\xa5\x01\xb2\x3e\x80\x20\x4e\x5c\xf8\x42\x13\x59\xfc\x21\x21\x1c\xb9\x68\x0a\x5b\x7f\x48\x08\x47\x71\x9a\x76\xd2\x1f\x02\xc2\x01\x60\xe6\x8a\xfe\xca\xbb\x8e\xe2\x34\x8f\xa6\x3f\x24\x84\xa3\x38\x4d\x3b\xe8\x0f\x09\x21\xe2\x0a\x3b\x21\xec\x69\xe9\x33\x47\xf1\x83\x13\x9a\x28\x91\xb3\x25\x04\xe1\x28\xce\xe5\x19\x5e\x50\x48\x10\x8e\xe2\x34\xed\xa7\x3f\x24\x84\xa3\xb8\x9b\x8b\xf7\xb4\xf4\x99\xa3\x38\x26\x8c\xcc\x87\x84\x70\x14\xa7\xb8\x54\x7f\x48\x08\x47\x50\x9a\xa4\xd4\x1f\x16\xc2\x4f\xb9\x7b\xf3\x80\x7e\x2a\xb1\xf6\x6e\x65\x02\xc5\xbb\x5b\x99\x3f\xf1\xee\x56\xa6\x4f\xbc\xbb\x2b\x35\x9b\x65\xb7\x9e\xce\xe4\x84\x80\xeb\xbe\xda\x10\xb7\xa9\xe6\xb8\x4d\x35\xc7\x6d\x6a\x7d\xdc\xa6\x36\xc7\x6d\x6a\x7d\xdc\xa6\xd6\xc7\x6d\x6a\x7d\xdc\xa6\xd6\xc7\x6d\x6a\x7d\xdc\xa6\xd6\xc7\x6d\x6a\x7d\xdc\xa6\xd6\xc7\x6d\x6a\x7d\xdc\xa6\x9a\xe3\x36\xb5\x3e\x6e\x53\xeb\xe3\x36\xb5\x3e\x6e\x53\xeb\xe3\x36\xb5\x3e\x6e\x53\xeb\xe3\x36\xb5\x3e\x6e\x53\xeb\xe3\x36\xb5\x3e\x6e\x53\xeb\xe3\x36\xd5\x1c\xb7\xa9\xf5\x71\x9b\x5a\x1f\xb7\xa9\xf5\x71\x9b\x5a\x1f\xb7\xa9\xf5\x71\x9b\x5a\x1f\xb7\xa9\xf5\x71\x9b\x5a\x1f\xb7\xa9\xf5\x71\x9b\x5a\x1f\xb7\xa9\xb5\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\x5a\x1b\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\xb5\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\x5a\x1b\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\xb5\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\x5a\x1b\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x18\xb7\xa9\x8d\x71\x9b\xda\x10\xb7\x5d\x67\xa9\x5a\x4d\xd4\xad\xdf\x1b\xae\xc8\xeb\x07\x30\x75\x95\xe7\x15\xa0\xba\xe2\x73\xcb\x01\x06\xa8\xa6\xfe\xdc\x95\x95\x18\xa0\xda\x12\xf4\x81\x05\x2a\x2b\x85\x07\xec\x24\x9d\xf6\x7d\x90\xb0\x74\xb2\x5f\x03\x53\x53\x3d\x39\x38\x3e\xf1\x61\x82\x02\x4a\x04\x39\x3c\xf4\x41\xfc\xd9\x41\x34\x56\x76\xa1\x00\x1e\x2d\xe6\xd7\x52\x50\x2b\xd2\x27\xb5\x20\x01\xc6\x84\x4d\xff\x38\x84\xf2\x71\xf6\x1c\x50\x0b\xe3\xe3\x7c\x2a\xeb\x93\x2d\x4c\x15\x69\x6b\x60\x93\x9b\x2c\x5f\xd5\x84\xa8\x76\xd0\x09\x60\xb0\x11\x22\xac\xe2\xf4\x78\x82\x20\xc2\x12\x4e\x8f\x21\x08\x22\xac\xdf\xf4\xb8\xc1\xab\xd5\x63\xee\x3c\xf0\xdc\x26\x02\x08\x2b\x4e\x8f\xa5\xdb\x44\x10\x21\xa2\x7d\xe9\xe0\x11\x44\xb8\x54\xe5\x54\xba\xc3\x04\x11\x22\x8a\xa1\x96\x21\xe8\x2c\xbe\xc1\x33\x2e\x72\xf7\x1a\x83\xaa\x93\x59\x03\x33\x9a\x2d\x8b\xeb\x00\xe3\xbe\x54\x10\x1e\x60\xd8\xb7\x66\xc8\x70\x55\xce\xa1\x54\xa0\x1e\x64\xd8\x57\x74\x58\x6c\x0c\xe4\x41\xd6\xad\xcb\xb1\x33\xec\xb3\xf8\x36\xf5\x8b\xce\xe8\x9d\x47\xa2\x80\x6f\xa6\xe6\x59\x3a\xbe\x4e\xa6\x53\x51\xc2\xe6\x8a\x24\x6c\xdc\x23\xe1\x42\xb6\x6b\x04\x0c\x07\xf5\x40\xfa\x1a\x12\x30\x64\x42\x72\x25\xeb\x5a\x0c\xbb\x7b\x22\xa3\xa6\x19\x1e\x1e\xe2\x15\x4a\x53\xca\x89\x8a\x5d\x6c\x38\x61\x81\xfc\x3a\x43\x5e\x4c\x65\x33\x40\x16\xca\xaf\x33\xe4\x95\x54\x36\x68\xb0\x50\x7e\x9d\x21\x2d\xa3\x12\x14\x31\x50\x7e\x9d\xa1\xd1\xad\x12\xca\xaf\x48\xa7\xf8\x83\xaa\x7a\xf6\xbd\x37\xca\xaa\x63\xe6\x22\x3f\x7d\x65\x81\x06\x5b\x41\x05\x5e\x90\x5f\x4d\x67\xa1\x84\xef\x59\x2d\xa5\xb6\x50\x87\x7e\x34\xe9\x97\xd1\x11\x54\xb5\xc6\x84\x85\x61\x20\x63\x3e\x1f\x32\x5c\xf6\x76\xdc\xdc\x68\x28\x62\xfd\xe6\x56\x43\x19\xeb\x57\x58\xa9\xa9\xf6\x04\x3d\x1f\x1b\x1c\xf8\x90\x7e\xca\x53\x38\x06\x03\x1f\x09\x51\xb0\x42\xcb\x65\xcc\x87\x0f\xe4\x95\x8b\x1a\x9b\xee\x6c\x9f\x81\xda\xdc\x54\xd5\x60\x53\x95\xa3\xd5\xf3\x16\x28\x30\x80\x27\x14\x83\x1c\x85\x50\x81\xd1\x3e\xde\x97\xf1\x94\x85\x0a\xeb\xce\x79\xd1\x42\x08\xe5\xd3\x96\x96\xea\xf4\x3d\xdc\x83\xf2\x5a\xc2\xeb\xd8\x2b\xaf\x15\x60\x83\x2d\xe1\x82\x1e\x50\x4d\xfc\xe0\xb0\x0a\x17\xf4\x01\x47\xfe\xec\xb4\x0a\xe6\x77\x02\xb3\x65\xc7\x1e\x7f\x84\xc5\xbf\x07\x44\x31\x2a\xdb\xf7\xf8\x22\xa8\x8f\x1c\xf0\x42\xb7\x63\xcf\x48\x09\xb8\x81\x17\xb5\xee\x53\x9a\xdb\x97\xef\xb0\x4a\x72\x70\x7c\x68\x38\xc4\x17\xf1\xb0\x50\x92\x2a\x6b\x89\x4b\x02\x29\x0f\x6b\x25\xc9\x1d\xdb\x3f\xa8\x88\x64\xa5\x46\x78\x70\x60\xf2\x5c\x21\x8e\x61\x99\xf0\x60\x60\xd7\x89\x1c\x1d\xd4\x40\xaa\x2d\x20\x4b\xa5\x66\xbe\x29\x30\x91\xea\x7e\xc0\x0f\x06\x32\xa8\xfc\xdf\xaf\x2a\x4b\x0b\x1a\x54\xfe\x0f\xfa\x55\x72\x1a\x50\xbf\xf2\x9f\xc2\xfe\x90\xa0\x06\x34\x28\xfd\xaf\xa1\x69\xa8\x5d\xac\xd3\xb7\x7f\x58\x05\xab\x73\x0e\xeb\xe0\xea\x5c\xc4\x7e\xcd\x6b\xeb\x1c\xc5\xd3\x7e\x15\xae\xce\x5d\x14\x24\x9f\xfb\xeb\x31\x8e\x8c\x31\x11\x0c\x9e\xaa\xd4\xd7\xa0\xda\xad\xd4\x00\xc1\xca\x0f\x9e\xd1\x92\x83\xa5\x01\x06\x1b\x21\xfc\xae\x7b\xa3\xa8\x21\xfc\x4e\x7b\x8e\x8e\x86\xf0\xbb\xeb\xad\x40\x99\xc7\x79\xe6\x34\x17\x71\x20\x26\xfb\x6c\xa6\x84\xef\xfb\x68\x1e\xed\xcb\xcc\x11\x43\x04\xa5\xb2\xa7\x32\x44\x62\x08\x1f\x4d\x12\x5d\x6b\x25\x18\x22\x28\x93\x95\x01\xd2\x5c\x4d\x92\xe5\xbc\x66\x0d\x77\xcd\x72\x6a\x86\xad\x59\x71\xeb\xc8\x42\x10\xc1\x7a\x0f\xcc\x54\x9d\x1e\x49\xb3\x24\xc1\x7c\x37\x65\xd0\xf7\x54\x84\x04\xf4\x3d\x95\xb3\x23\x6f\xc0\x04\x9c\xef\xab\xf8\x4a\x4c\xc2\xf9\xde\xca\xd1\x91\x37\x78\x04\xb7\x58\xe6\x8b\x99\xa3\xc8\xe1\x89\x51\x61\x83\x3a\x38\xa1\x8f\xd9\x9d\xa9\x76\x84\x01\x45\x72\x95\xc4\x63\x50\xed\x09\x03\x8a\xac\x36\x4d\x32\x1c\x56\xbb\xc2\x80\x4e\x1f\x1f\xf0\x1c\x54\xd8\x93\xd0\x04\x91\x69\xa4\x3c\xa5\xcd\xd6\x6b\xc0\x8a\xe2\x26\x4d\xd4\x3f\xac\xe2\x58\x2c\x70\x03\xbf\xea\x04\x34\x57\xd9\x7b\xa0\x95\x85\x11\x27\x34\x2a\x94\x71\xf3\x21\x79\x6d\x84\x5c\x73\x73\x46\xf9\x30\x19\x10\xce\x93\x49\x1a\x3a\xfb\xac\xb0\xa5\x13\x37\x4f\xd2\x72\x9c\xab\x78\xee\x27\x7b\x74\xd0\x62\x81\x8a\x72\x95\x67\x45\xcd\x9a\xf9\x7d\x3b\xcb\x61\x81\x6a\x96\xcd\xd7\x40\xd5\xac\x9c\x77\x0e\xa0\x85\xaa\x5b\x3c\x6f\x33\xc2\x16\xaa\x6e\xfd\xbc\xcd\xcb\xcd\xb3\xf1\x38\x2e\x92\xb4\x8a\x95\x6b\x29\x8d\x6f\xe2\x1f\xb3\x9a\x2a\xf8\x7d\xcf\x6d\x13\x60\x61\x27\x9b\xe0\xc2\x3a\x74\xe4\xd0\xe3\x9a\xd7\x86\x05\xe9\x5e\x50\x20\xe0\xc2\xae\x0e\xc4\xbc\x20\x80\xad\x7c\x95\xe3\x82\x22\xbc\x57\xb3\x52\xd3\xde\x07\xe7\x1c\xb7\x51\x74\xbd\x3a\x30\x29\x3f\x6b\x53\x68\x01\xde\x24\x8f\x47\x4e\xf9\xd1\xf2\xf4\x7d\xb1\x26\xde\xc2\x88\xc8\xd1\xac\x11\x3c\xde\x0f\x81\x44\xe0\x68\xa2\xaa\xa3\xd3\x10\xc8\x8f\x1b\x7d\x3b\x68\x81\x6a\x96\x63\xd9\x08\xbf\x6e\x39\xe0\xb1\xa8\xd2\xa8\x5d\x0a\x58\x05\x08\xdc\x61\x44\xc6\x07\x08\x86\xf0\xe0\x20\x04\x08\xdc\xf8\x7e\x78\x5f\xe6\xdf\x88\x60\x67\x35\x10\x83\xcd\x20\x3e\xa6\xc7\x15\x44\x2b\xa9\xb7\xa3\x4a\x67\x2b\x99\xb7\x83\x13\x09\x22\x0d\x17\xaf\x7f\x60\x85\x7f\xe8\x41\x04\x24\x3d\x18\x48\x9d\x12\x5a\x2b\x22\x2a\xe5\xec\xad\x06\x0b\x0c\xd5\xbe\x9d\x6a\x76\x93\x20\xa1\x8d\x42\x54\x59\xb3\x1b\xe3\x8f\x1b\xe5\x34\xc4\xd3\x1c\x61\xf4\x25\xa0\x17\x4e\x72\x2e\x9a\x36\x6a\xd8\x0f\x81\x06\x3e\x57\x52\x07\xad\x3a\xb7\x50\xfb\xeb\x42\x53\x0b\x75\xe0\xa7\x9e\x38\x8a\xaa\x40\xb9\x62\x03\xb3\xf0\xe6\x54\xc2\x54\x8c\xc7\xe0\xe4\xa8\x92\xa9\xf0\x00\xc5\x6c\xdb\x49\x25\xf3\xe1\x41\x0a\x39\xad\x6e\xd9\xe2\x41\x0a\x61\xad\x66\x40\x3c\xc8\x43\xcf\x85\x0a\xb2\x20\x08\x59\xb1\x71\x34\xe7\xc3\x45\x00\x87\x27\x75\x80\x21\xbf\x91\xf5\x1e\xd4\x41\x86\x6c\x47\x63\x5c\xfb\xf2\x90\xfb\x0e\x43\xde\xb2\x90\x55\x26\xb4\xa9\x83\x45\xbc\x88\x57\x31\xe8\xef\x45\x90\xa5\x21\xa3\x6d\xa1\x54\x3c\xbe\x5e\x2c\xa7\x53\x1f\x88\x27\x52\x8f\x42\xa0\x70\xfd\x53\x3d\x54\x68\x7e\xbc\x59\x5d\x0b\x15\x1a\x9f\x23\x99\x85\xb0\x50\xe1\xa2\xa8\x33\x99\x86\x58\xa8\x7c\x59\xd5\x7f\x76\x22\xbb\x9a\x5c\xe1\xfc\x9f\xbc\x1f\xae\xea\x1f\xc8\x84\x6e\x5d\x4a\x85\x26\x6e\x0f\x05\x40\x98\x4d\x21\xa1\x3c\x15\x00\x81\x06\xa6\x1e\xd8\xfb\xb3\xa5\x73\x82\x88\x23\x8e\x69\xe1\xda\x40\xdc\x0f\x51\x3c\xf1\x44\x06\x00\xc2\x0d\x07\x3c\x87\x10\x01\xc2\x75\x5c\x5e\x5c\x80\x00\xe1\x1a\xae\x7d\x4f\x2e\xb2\xdb\x49\xb0\xcf\x05\x67\x35\x0e\xa5\xa1\x0e\x1c\x72\xec\x06\x4d\x33\x1e\xfa\x00\x42\x85\x1d\x71\xc8\x24\xfa\x12\xb8\xe0\x48\xca\x43\xbf\x33\x81\xef\x8d\x4e\x17\xf3\x98\xdf\x86\x53\x5b\xc8\xa6\x5e\x5a\x32\xb4\x77\xc2\x20\x56\xa4\xd9\xbf\x57\x09\x4a\xc5\xbd\x4a\x38\x2a\xee\x55\x02\x51\x7b\x2f\x2b\x56\xfe\x76\x43\x7a\xd5\x79\x57\x4c\xc2\x58\xa0\x9a\x65\x7d\x2e\x4f\x68\xa1\x6a\xd6\xf5\xb9\x64\x80\x85\xaa\x59\xd8\xe7\x56\x9c\x5b\xa8\x9a\x95\x7d\xae\xde\x2a\xcf\x56\xb1\x97\xc8\x39\xb6\x86\x72\xbf\x02\x33\x90\xc1\x05\xef\x77\x73\x54\x01\xb2\xa8\x1f\x53\x30\xe7\x45\xfd\x16\xc8\x55\x1b\x9e\xea\x40\xb3\x8a\x91\xab\xe1\x3c\x63\x4f\xc4\x8d\x7e\x11\xe3\xa9\x75\x3e\xd1\x2b\xdb\xcf\x84\x89\x4d\x9b\xed\xb7\xae\x46\x6d\x4e\x93\xf2\xa8\x16\x9b\xda\x74\x26\x5a\x07\x1b\xde\xd7\x26\x32\xd1\xd2\x9c\xfa\xaf\x09\x74\x3c\x16\x60\x9e\x58\x80\x74\xe2\xb3\xd0\x3e\x0a\x0c\x25\x13\x6d\x36\x23\x0c\x30\x0f\x8f\x8d\x29\x3f\x09\x20\x06\xd2\xda\x6b\xf7\xe2\x2c\x80\xb1\x3d\x3a\xb1\x7b\x6b\xd8\x1a\xa9\xca\x86\x06\xc7\x27\xd6\xb5\x08\x61\x0e\xd7\xa2\x53\x5c\xab\x99\xbf\x03\x90\x8e\x0b\x4e\x03\x98\x70\x92\xaf\x16\x28\x9c\x7c\x38\x93\xc9\x46\x03\x14\x4e\x3b\x20\x13\xda\x39\x31\x03\x54\x33\x93\xe9\xa6\x31\x8a\x44\xa5\x69\xec\xa9\x40\x4c\x71\xd8\x39\x47\xbe\x5f\xe3\x30\x58\x7f\x81\x21\x6a\x1c\x05\x9b\xb5\x66\x88\x1a\x07\xc1\xf1\x04\x41\x54\x1d\x03\x47\x95\xc6\x5c\xb6\x8d\xa8\x2a\x69\x6c\x91\xef\x0e\x60\x9c\xba\x26\x3d\x4b\x16\x36\x7c\x95\xd8\xc5\x8a\x6c\xa8\xb7\xc8\x3d\xcc\x5b\xd3\xd4\xc6\xc0\xb3\x40\xd5\xcc\x07\xa2\x72\xe6\x99\x31\x0b\x23\x90\x46\x7b\x3a\xf0\x36\x28\xb0\x50\x02\x6d\x2a\x34\xf5\xa6\x0f\x2d\xd4\x81\x17\xe1\x9d\x9e\xd5\xbe\xd0\x61\x8e\x03\xd5\xaf\x20\xee\x67\xd0\xf7\x8d\x32\xb1\x2e\x79\xcd\x3e\x1b\x67\xa7\x95\x59\x83\x9a\x3d\x36\x74\xe2\xae\x82\xb9\xbf\xbf\x06\x25\xb2\xfc\x54\x5b\x75\x6f\x0d\x1e\x18\x3f\xb3\x5d\x93\xd4\xaf\x41\x3e\xad\xe4\xbd\xbd\xa9\x7b\xbc\x5f\x37\x2d\xed\x01\xd4\x4c\x47\xbb\x80\x0c\x01\x6a\xa6\xa1\x5d\x38\x86\x00\x75\xd3\xcf\xd6\x63\x6e\xca\x86\x91\x5e\xaa\x01\xaa\x2c\xcb\xa8\x85\xaa\x2c\xcf\x70\x9b\x6e\x08\xa8\xca\x32\x0d\x57\xd3\x2c\xa0\x2a\xcb\x35\x6c\x1d\x7b\x65\xbe\xe4\xc4\x16\xe2\x5a\xb3\x5e\x9d\x29\x39\x63\x2f\xd5\xe3\x9f\xca\x1c\x09\xef\x29\xea\xcb\x6b\x65\x76\x84\x72\x42\x87\x9e\x8b\x55\x9d\x17\xa1\xb9\xf5\xbe\xc7\xf9\xa5\x98\x09\xd7\xf5\x45\x5d\x51\x7c\x52\xc6\x95\x19\xc1\x23\x51\x26\x5f\xc6\xa1\xe5\xc4\x57\xd8\x18\xa2\x8c\x43\xb3\xe9\xf9\xfd\x65\x9c\x56\xb3\x1e\xd6\xa1\xc2\x73\x70\xcb\x99\xd8\x11\x8f\xd4\x16\x4d\xcd\x1e\xfb\x20\x61\xba\xcd\x8b\x55\x35\x4c\x98\x51\xf4\xbc\x16\x0d\x13\xe6\x13\xbd\xa9\x26\x0d\x13\xa6\xd8\x3c\x49\x2c\xb3\x79\x5c\x66\x1e\x36\x67\x67\xc2\x6c\xf0\xfd\xc1\x26\x80\xa0\x3c\x6a\x5f\x98\x15\x06\xf0\x11\xc5\xa1\xb7\x56\x85\x01\x82\xc2\xa8\x43\x61\x55\x2a\xa9\x80\x63\x5b\xed\xd8\xaf\xc0\x78\x12\xe6\x6f\xed\x58\x8d\xff\xfb\xdd\x70\x63\xc7\x6a\xe4\xdf\xef\x86\xdb\x3a\x56\x63\xfe\x7e\x37\xdc\xd5\xd1\xdf\xed\xc7\xb9\x68\xee\x4d\xd5\x7c\x00\x2a\x4a\xca\xe1\x58\x15\xd8\x90\x0a\xa0\x69\x45\xab\xe6\x1a\xb2\x00\x54\xbd\x7d\x58\x01\x0a\x32\x65\xde\xe2\x80\x86\xd8\x1f\x7b\x66\xd7\x91\xdc\x5e\xab\xd8\xf5\xeb\xd0\x25\x8b\xcf\x24\x40\x58\xbe\x41\x13\xcb\xc7\x12\x22\xe4\x6e\xaa\xbe\x3e\x94\x10\x21\x6f\x1f\xcb\x4e\x13\x44\xc8\xd9\xc7\x52\x07\xd6\xed\x01\xe3\xb1\x03\x01\x14\xf3\xec\x63\xdd\xe6\xba\xd6\xb3\x6a\x9a\x7f\xed\x7b\xf7\x6b\x26\x5e\x7d\x80\x9a\x19\x57\x1f\xa0\x66\xaa\xd5\x07\xa8\x99\x63\xf5\x01\x82\x64\x9f\x4c\x2e\xe3\x19\x3f\x78\x84\xf2\x77\x3f\xbc\x7a\xfa\x2c\xba\x7c\xfe\xe2\x19\x9d\x3d\x3b\xc9\xca\xbd\x1f\x8b\x3d\xf8\xf6\x61\xda\xfb\xb1\x40\x90\xa7\xd9\x62\x95\xe3\x34\x4b\xd4\x1e\x77\xd0\x12\xee\xf3\xe1\xf0\xd7\x79\x36\x4f\x96\xf3\xe8\xbb\xd7\xd1\x70\x59\x5e\xe3\x26\xd8\xd1\x70\x36\x8b\x08\x16\x8f\x9f\x2a\x54\x7e\x83\xc7\x4f\x41\x1b\x3f\x14\xee\x54\xf0\x22\x5b\xe6\x63\x3c\xea\x69\x42\xe7\xe1\x5f\x65\x37\x0a\x8f\xa9\xc2\x43\xa3\xe3\xe8\xeb\xd7\x17\xbb\x45\xb9\x9a\xa9\x08\x77\xcf\x4e\x0b\x3c\xc0\x2f\x2e\xe9\x80\xeb\x91\xc2\x96\xa6\x78\xfc\x1b\x1e\x79\x84\x7b\x73\xbf\x78\xfe\xf4\xd9\xcb\xd7\xcf\xf4\x8e\xdc\x0f\x5a\xcb\x82\x4f\xd2\x1a\x97\x2d\xb7\xbd\xf7\x37\x79\x3c\x8a\x46\x31\x9e\x2f\x1e\x2d\xcb\x64\x96\x94\x2b\x7b\x54\x94\xd8\x41\x1c\x4f\xa0\xfb\x49\x1c\x7c\xf4\x8a\x4f\x5d\xc2\x33\xca\x92\x78\x84\xfb\xb9\xab\xa9\xca\x55\x3a\xa6\xb3\x94\xf1\xf8\x7d\x7b\x40\x22\x82\xff\x87\x06\xe3\xe3\xbc\x32\x3e\x9e\x8b\x0e\x7f\xff\x97\xcb\x1f\x5e\x3e\x7d\xf3\xfc\xbb\x97\xed\xff\x18\xbe\x7a\x39\xfc\xf6\x19\x9e\xf6\x6d\xae\x21\x05\xa0\x6f\xd9\x02\xb1\x89\x67\xd8\x92\x2a\xc6\xf1\x42\xb9\xa3\x4b\xf1\x0c\xb1\xc5\x62\xb6\x32\x1b\x92\x7b\x27\x88\xe1\xd9\x71\xea\x2e\x9e\x2f\x66\xfa\xf0\x7d\x3e\xa0\x54\x1f\x19\x05\x48\x15\xed\x9d\x7f\x69\x23\x1f\xe0\x59\xdc\x9d\x6e\xf4\x2f\xd0\x03\xa0\xfc\x0f\xaf\x9e\x3f\x35\x27\xd7\xf1\x79\x59\xc8\x37\x0f\xa3\xba\x3f\x3f\x45\xe6\x79\xe0\xa4\x7f\x43\xc6\x6a\x86\xe5\x93\xab\x00\xee\x9b\x2c\xbb\x9a\xa9\x47\x3b\xd1\x3d\x1e\x56\x45\xb8\xfe\x01\x8f\xb2\x03\xb6\xc0\x73\xf6\x81\x82\xdc\x54\x37\x62\xc8\x7f\xd9\xff\x7a\x47\x0c\x86\xec\x81\x3c\xda\x0b\x88\xde\xc5\x21\x29\xf8\x7c\x2f\x7d\x6a\x15\x5c\x75\xa7\x64\xfd\x4b\xfb\x6d\xbc\xfb\xe7\xf7\x0f\x3b\xef\xda\xed\xb7\x7f\x7c\xd7\x79\xff\xa8\xf3\xae\xb3\x77\x95\x74\x5d\x2b\x74\xce\x1c\xfc\x4e\xa9\x2d\x77\x5c\x18\xfe\xc1\x63\xb5\xca\xd5\x02\x8f\x4a\xc5\xf7\xbc\xd5\x00\xef\xe9\xc8\x3c\xe0\x3d\x3c\x8a\x54\x4d\x5a\xe6\xa4\xe5\x88\x0f\xeb\x8d\x5a\x3f\xf0\xf9\x6b\x96\x5f\xf8\xf8\x38\xfd\xb4\x3e\x84\x59\x1f\x0d\x4d\x47\x9b\xcb\xb6\xed\x6d\x7c\xf9\x34\x35\x27\x7a\x79\x54\xe8\x59\x9e\x75\xb8\x46\xdc\xd6\x1a\xd8\xb7\xd3\xf4\x7d\x3b\xbf\xb1\x67\xe1\xe9\xe3\xf7\xf8\x3d\xb2\xa1\xa0\x17\x01\x13\x72\x67\xa6\xa9\x6d\xc6\x20\xac\x07\x20\xbf\xd1\x47\xeb\xf9\x27\x29\x5e\x1a\x34\xa4\x14\xe3\x0e\xfe\xfa\xf8\x61\x89\xb2\x66\x92\xa7\xb3\x04\x0f\x53\x24\xd8\x78\x32\x61\xa6\x37\x07\xd7\xc1\x0f\x75\x57\x2a\x50\x00\x55\x36\xef\x34\x70\x8f\xa3\x85\xde\x98\xdf\x0a\xc0\x63\xf7\xb5\x2b\xaf\x5b\xc1\x78\x5c\x73\x8d\x20\x89\x38\xff\xf6\xe6\xdb\x17\x8f\x3d\xce\x94\x67\x29\xce\xe3\x85\x7e\x1f\x9d\x96\xf0\x45\x0b\x48\xf8\xfb\x59\xf9\x44\x1f\x9f\x00\x97\xbe\xa4\x4b\x57\xf2\xd2\xef\xe9\x12\x48\xb3\xb8\xb6\x43\xd7\xc0\xbb\x10\x80\x3b\xad\x1d\xbc\xf8\xbb\x83\xb3\x27\x2d\xa6\xbb\x7f\xca\xb7\x27\x0f\x6f\xbf\xf8\xf2\xf7\xef\x76\xde\xb5\xde\xe3\xd9\x71\x4e\x04\x00\x59\x03\x0e\xb8\xbe\x9d\xbf\x67\x49\x85\xa1\x15\x03\xf8\x0d\x9e\x3a\x79\xad\xec\xb1\x81\xf1\x78\xac\x16\x78\x1c\xe1\x0f\xcf\xa3\x59\x9c\x5e\x2d\xe3\x2b\x77\xc8\xb5\x39\x04\xd0\xbe\x83\x8f\x1a\xbe\x87\xb1\x9c\xcd\x46\xf1\xf8\xa3\xe5\x07\x1c\xc8\x24\xbd\x01\x3b\xcb\x7c\x80\xaf\x60\xc5\x00\x36\x04\xad\x8b\x51\x2f\xd4\xa2\x2a\x55\x4e\x7a\xd2\xa2\x31\xcb\xe8\x84\x0d\x94\x1d\xa9\xc1\x7b\x57\xaa\x1c\x12\x86\x2f\x0c\x6e\xde\xa9\x98\x1a\x0d\x77\x34\xe0\x6d\x92\x4e\xb2\xdb\xde\x18\x4d\x99\x8a\x7e\xff\xfb\x88\xbf\xf5\x92\xc1\xa9\x15\x0e\x71\xa9\xa6\x7d\xd7\x28\xd1\x4e\x1e\x6e\x59\xa8\xf2\x4d\x32\x57\xd9\xb2\x6c\x5b\x14\xa4\xc4\x99\x27\xdb\x6f\xd3\xf8\x26\xb9\x02\x87\x37\xef\x19\x9a\xba\xd1\xdb\xa5\x13\xff\x3e\xb4\x3a\xef\x9d\x0c\xa3\x99\xaf\x0c\xd5\xf7\x78\x22\x2a\xd0\xe8\x4f\x4b\x95\xaf\xb4\x71\x32\x27\x50\x5e\xc7\xc5\xb5\x77\x0c\x64\x19\x7f\x44\x4b\x15\x2d\xf3\x59\xf8\x80\x33\x5c\x2d\xa4\xef\xe0\x9c\xec\xcd\xef\xf1\xfb\x3e\x7f\x6f\xe1\xd1\x94\xd8\xd4\xd8\x1c\x93\x2e\xce\x62\xce\x46\x3f\xaa\x71\xe9\x19\xc0\x9f\x68\xa0\x06\xc0\xb1\xfc\x78\x97\x7e\xef\xdb\xdf\xd1\x7d\x4f\x9f\x91\x1e\xeb\x53\xd2\xe9\x58\x43\x30\x7a\x0a\xb5\xff\x1c\xd8\x22\x01\xfb\x16\x95\xc9\x9c\x6d\x2f\xb6\x2c\xb1\xee\x46\x59\x8a\xf6\x91\xf9\x66\x16\x03\x93\xf0\x29\xcf\x74\x78\x2a\xb7\x63\x9e\x63\x36\x0b\x0e\xe0\x4c\x27\xe6\xa8\x72\x34\xde\x8b\xb8\x40\x0d\x85\x1a\x71\x79\x75\x1d\x4d\x54\xa8\x03\x40\x89\xe1\x6e\x81\xf0\x0f\x92\x0c\xb4\x94\x22\x72\x68\xfb\xac\x2d\x1c\x13\xa2\xe9\x80\x4c\x42\x9f\x0f\xed\xd6\x47\x2c\xe6\xfa\xcc\x11\x3a\xd9\x96\x4f\xf8\x04\xb2\x16\x65\x8c\x04\x26\x29\x89\x8d\x54\xcc\x54\x4c\x27\x94\xb4\xbe\x6a\xf1\x69\xb1\xf0\xc5\x1e\x14\x9b\x5c\xa5\x80\xdb\x44\x8a\x05\x35\xf9\xff\x88\x60\x42\x1c\x04\x0a\x4e\x22\xc4\xc5\xea\x91\xd6\x5f\x69\xab\x27\x91\x3f\x8f\x6a\x1e\x19\xf0\xe9\xbf\xd6\xd8\xfd\x74\x6f\x7f\x2f\xe2\x84\x2c\xba\xf7\x14\x1e\xb8\xdb\x06\xed\x47\x5c\x5d\x77\x66\x30\x3d\x55\x77\x2a\xb9\x69\x12\x40\x09\xe6\x6d\xf2\xde\x34\x77\xde\x32\x07\xb8\xdf\xbc\xad\x8e\x61\x1b\xc1\xf1\xd0\x76\x3c\x58\xb8\xe9\xf6\xe0\x7d\xe5\x14\x61\xb4\x74\xd8\x1b\xab\x70\x7e\x78\xf5\x42\x52\x75\x11\x97\xd7\x9b\x15\x4c\xbe\x4c\x91\x9b\xab\x57\x74\x8b\xde\xd1\x9d\xb5\x10\xfc\x22\x79\x74\x27\x5e\xf0\x0f\xa6\x9d\x81\x25\xb1\x32\x05\x02\xaa\xae\x40\x91\x92\x42\x28\x16\x6a\x9c\x4c\x13\xe0\x72\xaa\x85\x08\xb9\x54\xc3\xde\x47\x37\xc4\x9c\x2c\x4c\xf0\x20\xb0\xd7\x18\x1b\x65\xf6\xaa\x82\xcf\x41\xc8\xf0\x01\xf8\x37\x99\x43\x68\xc0\xe6\x82\xbc\x67\xeb\xb5\xd6\x3c\x15\xdf\xf1\x53\xf1\x5d\xe3\x53\x86\x95\xe9\xf5\x92\xde\x37\x5d\x7c\x5b\x17\x1f\x76\x64\xbf\x01\x96\x81\xab\x1e\x15\xe1\xf7\x13\x7b\xfb\x4b\x82\xf7\x6e\xc7\x77\xe2\x90\xdf\x1b\x8f\x90\x2f\xd4\xb4\x04\xf2\x4e\xac\xd3\xcf\x44\x64\xba\xea\xf3\xcd\x97\x05\xe9\x02\x7d\x11\x8f\x4b\x88\xc7\x60\xb7\x9a\xe4\x1f\xfe\xad\xc8\x7d\x03\x51\xf5\x0b\x10\x7a\xa2\x8a\x04\x64\x5b\x5f\xea\xd5\x35\x0c\x91\xc4\x87\x31\x43\x9b\xa0\x02\x9b\x26\x7d\x61\xb1\xea\xe2\x19\xf2\x31\x9a\x5b\x7c\x73\x2b\x6a\x35\x9f\xc8\xbb\x20\xf5\x56\x39\x0d\x7e\xda\x9b\x21\x41\x42\xcf\x9c\x11\xeb\x6a\x2c\x78\x40\xb0\xab\xe7\x11\x8b\x3a\x79\x49\x48\x67\x8d\xe6\xb9\xf9\xf2\xf3\xcf\x88\x06\xb1\x33\x04\xe1\x30\xf2\x08\x69\xce\x8e\xff\x42\xb7\xcb\x03\xc6\xed\xe9\xe7\x1e\xe1\x4f\x29\x05\xf4\xb3\x7e\xec\xd2\xe5\x7c\x64\x04\xc0\x1b\x3b\xd2\xae\x46\xa9\xfe\x59\xe5\x59\xc5\xa5\xe1\xee\xff\x6c\xc7\x44\x37\x85\x04\x72\xad\xfe\xd2\x11\x5c\x43\x76\xdd\x78\x5c\x78\xf1\xa6\x19\x82\x3f\x07\x43\xc0\xd0\x66\x14\xbc\x08\xc9\x8d\x59\x00\x05\xce\x45\xbf\xe5\x7b\xed\xaf\xf4\x79\xd9\x86\x39\xc1\xcc\x97\x31\x48\xb4\xe0\x6f\x8d\x97\x39\xac\xda\x71\x56\xe1\xb9\x19\xe0\xba\x5d\x67\x13\x90\xad\x84\x5a\xe0\x5e\xc4\x65\x32\x06\xe7\x67\x7c\x6d\xc3\xe4\x59\x9c\x83\x2b\x55\x46\xf1\x1c\x82\x7b\xf2\x1d\x38\x11\x83\x4d\x53\x44\x0c\x5e\x06\x74\x04\x4c\x46\x51\xd2\x89\xe9\xcf\xc1\x30\x5e\xd3\x69\xdd\xad\xd2\x46\x14\x30\x02\x57\x2a\x55\x79\x5c\x2a\x74\x44\xe0\x75\x71\xaa\xc0\x2d\xb8\x5e\x5e\x29\xd7\x34\x9d\xa9\x6e\x5b\x6f\x54\x7c\x35\x43\x56\x87\x5d\xad\x08\x0e\x0d\xe1\xdc\x59\xde\xba\xa3\xb6\x0f\x62\xfc\x85\xef\xfa\x07\xdb\xae\x1c\x55\x39\x9a\xa8\xbd\x34\x6a\x60\x90\xfb\x9e\x06\x6b\xb5\xac\x91\xc5\x5c\x06\x46\x4d\x7e\xa3\x46\xfd\x7d\x36\xed\xb9\x1e\x70\x13\xf2\x0a\x3c\xdb\x72\xe1\xbc\x27\x93\xfa\xd5\x5f\x7a\xf0\x3d\x89\x60\xd0\xd4\xa3\x73\xef\x77\x68\x4c\xbd\x66\x9c\xbb\xa1\x1b\x64\xa6\x8c\x34\x57\x3e\x4b\x8b\x65\xae\xd3\x41\xb1\xcb\x8e\x24\x05\x39\xd2\x3a\xa2\xa4\xc4\xcc\x18\x7c\xd2\x18\xdd\x3d\xb4\xb0\xb3\x64\x9e\x58\x2f\xec\x75\x82\x89\x12\x60\x17\x70\xb1\x21\x88\xc8\x3e\x62\x5c\xf9\x51\x31\xad\x7a\x06\x8a\x84\x25\x57\x57\x10\x6c\xa8\xfc\x79\x0a\xbe\x04\x8f\x50\x0c\x7c\x3a\x6f\x67\x29\x5e\xea\xd8\xac\x06\x31\x3a\x39\x5f\xb3\x0c\x05\xe4\x16\x62\x7a\x71\x7c\x9c\x3e\x63\x1e\x09\xcf\x4f\x42\x0c\x00\x0f\xa4\x59\xa9\x23\x20\x83\x38\xb6\x75\x04\x41\x03\x3c\x30\xb1\x52\x04\x4e\xe0\x2a\x5b\xb6\xd0\x29\x55\x39\x3a\xd3\xd8\x72\x81\xbe\x44\xb6\x40\x4e\xa7\x58\x0a\x29\x32\x8f\x57\xe4\xd4\x03\x12\x29\x59\xf9\x6b\x10\x01\xdb\x1c\x36\x42\x0e\x7b\x9c\x92\x77\x0b\x68\x4e\x96\xfa\xf1\x04\x4d\xe3\x0c\x22\x2b\x0d\x1a\x17\x84\xb7\x35\x1e\x7c\xdd\x45\x62\x3e\x6a\xa6\x39\x13\x3e\x4c\xc0\x77\x42\xc7\x02\xfd\x6d\x20\x5f\x4c\x07\xda\xc7\x2e\x02\x34\xe3\xd6\xa5\x7e\x01\xd1\x80\x43\xd9\xb1\xbd\xcd\xd1\x51\xcf\x8d\x0c\x83\x13\x08\x9f\xd7\xa6\x2b\xf0\x06\x68\x1f\xe8\xa8\xc1\x40\x09\x3c\x03\x15\x42\x0d\x6b\x52\x63\x23\xee\xe1\x5b\x4e\x36\x69\x4d\xc6\x4f\x81\x97\x0f\x1a\x0a\x3b\xad\xe5\xd1\xa2\x75\x4b\x12\x5e\x66\xd8\x06\xbc\x0a\xb4\x19\xfe\xe4\xe8\x8d\x22\x52\x18\x32\xf8\x1f\x5d\x53\x3c\x80\x1f\x06\x1c\x30\x53\x44\x80\xdb\x38\xe5\xc4\x84\xe4\xcf\x12\xcd\x49\x51\x62\x73\xe0\x4e\x32\x0d\x20\x1e\xa4\x93\xf7\xf5\x3b\xa9\x41\xc3\x02\x3a\xa0\x88\xcd\x3b\x23\x75\xb7\x00\x94\x2c\x1f\xb0\x58\x13\x03\xda\x7c\x0f\xb3\x63\x6b\xaa\x4a\xa0\x03\x47\x1b\xe4\xf1\xda\x2c\x60\x96\xf5\xe8\xe6\x77\x74\xaf\x6d\xd8\xf7\xf5\x12\xfc\xab\xa2\xe8\x74\x23\x73\xe5\x32\x4e\x66\x80\xbb\xe3\xe9\x4a\x24\xff\x50\x46\xf1\xa8\x14\x65\x76\x12\x89\x4b\x29\xd1\x94\x5b\x0c\x8d\x20\x3b\x25\xf3\x22\xfa\xce\xf0\x94\x33\x1f\x1e\xeb\x61\x5b\x71\x62\xc3\xab\x3c\x4e\x70\xd0\x4d\xd4\x63\x9b\x8f\xa2\x0b\xf6\x5e\x90\x82\x47\xfd\x7e\x3f\x6a\x5b\x4e\xef\xf8\x26\xd5\xa0\x79\x8f\xec\x6a\x3b\x40\xb9\x04\xd7\x83\x6b\x65\x42\x43\xf6\xfd\x5c\xe8\x38\xb2\x89\x08\xbc\x6f\x98\xc8\xb4\xc3\x41\x9a\xdf\xaa\xf1\xe7\x1a\xdb\x34\x0d\x8e\x94\x8f\x03\xb0\x8c\xb1\x5e\xa0\x1d\xd4\x6d\xe5\x6d\x5e\xa2\xc3\x70\x42\x25\xb7\xd1\xd5\xb4\x66\x6d\x4c\x89\xa8\x42\x7b\x4b\xf0\x05\xbc\xac\x23\x78\xff\x00\x68\xf6\x44\xdf\x06\x7b\x0c\xb8\x1b\x9e\x02\x69\x7c\x8d\x17\x4c\x04\xa7\xd1\xaf\x26\x30\xe8\xb4\x53\xe8\x31\xf0\x2a\x0c\x64\x8d\x36\x4e\xe6\xb8\x8e\x03\x7a\x33\x5b\x91\xc1\x6e\x15\x11\x89\x0c\x8c\xf1\x38\x5e\x94\x4b\xe2\x76\xe8\xa7\x69\xad\x18\x67\x0b\xca\x17\x10\xd9\x8c\x18\x98\x64\x6a\xcf\x3b\x63\xb5\xa5\x6f\xb7\x5c\x72\x1e\xe7\x15\x58\x6a\x47\x2b\x4e\x18\x9a\x26\x9c\xc6\xc1\x30\x9f\xf4\x04\xb7\xe4\x84\x5f\xab\x14\x1b\x50\x9a\x47\xcf\x37\xe4\x70\x10\x96\x52\x15\xe7\x36\x65\x6c\x1b\xc5\x78\x99\x99\xa1\xd5\x89\xbe\x62\xb0\xc7\x8e\x75\x38\x29\xcc\xcd\xe8\x26\xe8\x9f\xaf\xa2\x76\x8b\x93\xad\x9c\x95\x7e\x4c\x66\x5d\x27\x8c\xd8\x94\xf4\xd0\xc2\xb4\x5b\x82\x11\x1e\x07\x6a\x63\xc2\x2d\xb4\x61\xc4\xf7\x68\xb0\x3b\xf0\xab\x55\xd8\x56\xc3\x06\xc1\x70\xb5\x89\x0f\xec\x1d\x47\x81\x74\x39\x9b\xe9\xdc\x2e\x04\x59\x45\x47\x27\x1a\xb1\xeb\x9a\x6e\xdf\x58\x9d\xdb\x98\x6b\x13\x5e\x4a\x6d\x2a\x8c\x72\xee\xfc\x4a\x79\x19\x30\x04\x35\x9a\x9b\x11\x30\x10\x4f\x04\x40\x1d\xa2\x84\xec\x03\x97\x22\xd7\x51\xb4\x21\x3d\x4d\xa6\xb4\x11\x1c\x58\x22\xbf\x5a\xce\x31\xdf\xec\x92\x6b\x5e\x3e\x55\x4c\x06\xd4\x8e\xac\xdf\xb7\x90\x20\x7e\x52\x36\xbc\x1b\xa4\x0e\x3b\xed\x5a\x2f\xbc\x94\xe7\xe2\xa2\xb1\x63\x81\x8d\xa7\x28\x77\xc5\xc7\x04\xcf\x5b\xa9\xf3\xcb\xa7\xb9\x49\x8e\x86\xde\x38\x99\x1d\x4c\xa2\xb3\xcf\x6c\xdc\x67\x14\xbd\x89\x1a\x2d\xaf\xae\xc8\x75\x4d\xb5\xdc\x6a\xec\x31\x49\x86\x0d\xb1\x2d\xf1\x8c\x7b\x1a\x51\x9e\xb7\x0b\x2d\x8d\xe3\x25\xcd\xd8\x39\xb7\x87\x09\x85\x1e\x01\xe6\xd6\x00\xac\x00\x01\xc5\x86\x74\x00\xaa\x85\x32\x46\xfd\x80\x3e\xd1\x2d\x2a\xc2\x5b\x45\x56\xd5\x20\x3f\x8c\x60\x08\x12\xe8\x3c\x13\x60\x4e\x73\x91\xe8\xbd\x91\xf3\x26\xfc\x36\x9f\xa3\x5b\xaf\x33\xec\x31\xf6\xe6\x36\x19\x7f\xa4\x8c\x1e\xba\x6a\xe0\x29\x8d\x81\x36\xad\x6e\xa8\xf3\x3a\xc6\x7a\xa2\x76\x68\xfa\xf3\x32\x83\xf0\xc5\xf4\x71\x3e\x8f\xa3\x3f\x7a\x7e\x20\x06\x25\x11\x96\xda\x70\xde\x1c\x86\x80\x7c\x4d\xed\x0c\xfe\x58\x18\x0c\xbb\x40\x6f\x9c\xa1\xd5\xf3\x9e\x26\x6f\xaa\xa3\x13\x72\x6c\x52\x4e\xb7\x68\xd4\x33\x18\x88\x1b\x05\x34\xe0\x33\x89\x91\x91\x03\x63\xcd\x63\xcf\xc6\x96\x93\x80\x97\xc4\x03\x7e\x2e\x40\x44\x6e\xc4\x48\xcc\x27\xda\xf5\x21\x96\xa7\x47\x39\x0d\x1f\x41\x4c\xb7\x84\x87\x5a\x86\x46\x2d\x1e\x02\x34\x75\xb3\x5b\x1c\xcc\x9a\x6c\xa3\x81\x95\xea\x20\xc4\xc9\x99\x27\x0f\xd3\xf3\x2a\xf2\x5f\x55\x2f\x3d\x8a\xf6\x41\x2f\xee\xdb\x68\x87\x3a\x42\x3c\x48\x97\xca\x7c\xa5\x75\x08\xcf\x69\xa1\x31\x7d\x96\xe7\x20\x70\x3a\x47\x3f\xc6\xd9\xbf\xa8\xad\xee\x8c\xae\x71\x0d\x00\x06\xea\xae\xc7\xe4\xd5\x69\xc4\x77\x69\xcb\x25\x01\xed\xeb\xb4\x1c\x70\x6a\x33\xc8\x59\x4a\x64\x39\x7d\xe9\x5e\x50\x97\xc3\x14\x0d\xbe\x4d\xa2\x5d\xef\x79\xcc\x4e\xba\xa7\x31\xbb\x69\x67\x06\xfe\xf8\xae\x78\x18\x97\xef\x8a\x47\x7b\x10\xc3\xb7\x2a\x89\x4a\xd1\xaa\xa7\x57\x2e\x92\x1b\xf0\xd2\xd9\xc9\x2f\x6f\x33\xcd\x10\x9c\x04\x9f\x82\x54\xe5\x85\x9c\x8e\xe9\x46\xcb\x74\x06\x4c\xac\xaf\x61\x24\x3f\xe1\xd9\x18\xbc\x4a\x59\x6f\x72\xcf\x31\x8e\x18\x03\x23\xd0\x39\xdd\xc5\x1c\x99\x84\x7c\x9e\x2e\x3a\x86\x86\xa3\x71\xe2\xd1\x29\x14\x12\x21\x95\xcc\x74\x52\xc3\x3a\xd9\xa0\x42\xa6\xcb\x19\x7a\xd8\xac\xfd\x4c\x0e\x04\x9d\x87\x1c\x18\x2a\xc6\xf8\x19\x54\x69\x9e\xdd\x25\xf3\x98\x67\xf6\x68\x4e\x08\x03\x1f\x6c\x88\x53\xf9\x6c\xef\x8b\x2c\x9a\x64\xa8\x02\x26\xd0\x6d\x72\xfd\xcd\x84\x53\xa1\x6c\xd7\x57\x89\x9a\x61\xe4\xe3\x26\xa7\x4d\x57\x28\x68\x9a\x65\x85\xe2\xac\xd1\xed\x35\xea\x34\x7e\xac\x49\xfc\xe0\x5f\xd6\xef\x75\x37\x21\x3c\xca\x20\x86\xb3\xb7\x8d\x9f\xaa\xef\x0b\x29\x02\x1a\xe6\xe5\x25\x8e\x07\x0f\x58\x90\xe7\xe1\x57\x74\x23\xd9\xa2\x13\x2a\xa0\x00\x59\x44\x0d\x06\x5e\x80\x00\x33\x9e\x9f\xa6\x3d\x00\x7e\x0b\x81\x56\x0f\x7f\x02\x0b\xcf\x3a\x26\x4d\x60\xee\xef\x52\x73\x5f\x44\x3d\x70\x24\x06\x86\x67\x8d\x51\x65\x98\xca\xdc\x97\xbe\x4d\x0d\x13\x53\xd9\x96\xef\x37\x17\x9e\x68\xa5\xf9\x61\x1e\xa7\xf0\x4f\xfe\x4f\x52\x86\xf2\x2d\xf7\xea\x5b\xee\x14\xe6\xd1\x41\xaa\x40\x76\x26\x33\xc5\x06\x39\x4f\x63\xd6\xd1\xc9\x9f\x6d\xc2\xd5\x1a\x70\x30\x3b\xea\xb1\x9c\x8b\x04\x9c\x31\xf9\x55\x2c\xa7\xd3\x64\x9c\xf0\xa4\x14\x99\x5f\xb6\x87\xa4\xca\x07\x3d\x24\x51\xae\x5a\xc8\xdb\x60\xd9\x11\x5f\x3d\x15\xa1\x93\x06\x38\x0b\x08\x22\xb9\xc4\xe5\xb7\xc9\x8c\x3d\x69\x68\x9a\x8d\xc2\x63\x51\xe4\x71\x5d\x96\x8b\xc7\x7b\x7b\xe3\x1c\x9a\xe9\x81\xe1\xdb\x1b\x1c\xf4\xf7\xfb\x7d\x03\xb1\xdf\xe3\x03\xfc\x69\xf2\x9e\x69\x8a\x19\x09\xb4\xe8\x23\x4c\x66\x8e\x3f\x42\xa7\x27\x5c\x37\xf3\x94\x31\xa0\x89\x7c\x94\x48\x8b\xee\x41\x7d\x23\xd4\x40\xce\xd3\xcf\xc8\x29\x79\x0c\x0a\xde\x6f\x12\x06\x34\x9f\xec\x22\xd4\x4a\xe0\x5c\xf7\x22\x29\x94\xa4\x52\xef\xdd\x3c\x76\xf4\xc2\x4c\x2f\xdb\x2b\x20\xf5\xb3\x2c\x9e\x74\xcd\x48\x67\xf9\x84\x32\x12\xca\xbe\x87\xf3\x90\x88\x24\x02\x52\x76\xf2\xa5\xba\x05\x20\xcd\xc5\x85\x29\x72\x88\x70\x85\x66\x8e\xe9\x00\x9c\xe3\x6e\xa9\xb4\x05\x43\x68\x63\xdb\x25\x95\x3c\xa2\x93\x03\xfa\x93\x73\xbf\x3a\x11\x33\x4d\x72\xc0\xca\xa0\x84\x92\x99\x94\x26\x83\x14\xcf\x72\xf0\xc2\x80\x1a\xc8\xe5\xec\x30\xb1\xfe\x08\x98\x4d\x66\x13\x4d\xdf\x58\x92\x29\xf3\x65\xaf\x7d\xc0\x40\xd0\x4e\xeb\xcf\xe3\x45\x5b\x3b\xb8\xf6\x71\x35\x13\x75\x03\x6a\x56\x33\x4f\x4d\x65\x04\x5a\x85\x04\xad\xf7\xd0\x78\xdc\x7d\x37\x6d\x63\xef\x69\x4a\x71\x77\xd0\xd1\x96\xda\x07\x5c\xa6\xc5\x75\x32\x2d\x19\x90\xad\x3a\x42\x58\x9a\xb2\xdd\x15\x56\x6d\x38\x99\x58\x67\x8b\x4a\x74\x12\x5d\x77\x92\x79\x7e\x98\x51\x29\x35\x73\xe1\xe1\xd4\x75\x81\xe1\x18\xa6\xdc\x62\xcd\x7a\x9a\x9d\x0c\x0e\xa0\x96\xc0\x9a\x90\xc8\x47\xd1\x6b\x45\x99\x82\x2f\x8c\x98\x00\xef\xf6\xae\xa8\xae\x89\x84\x85\x85\x6e\xcf\x72\x62\xb1\x87\x22\xbc\x6b\x9b\xba\x2e\xe7\xb3\x2f\x9b\x46\xaf\x07\x96\xae\xcc\x30\x0a\xe9\x01\x63\x7c\xeb\x48\x60\x07\x05\x3a\xac\x87\xd3\xfa\x21\x1f\xd5\x0a\x79\xd6\xdd\x61\x9d\x0f\xbf\x69\xba\x73\x5a\xbc\x05\x88\xf7\x22\xca\xf9\x0c\x2e\xf6\x68\x2c\xaf\x89\x51\x45\x95\x91\x47\x7a\x7a\x8e\xdb\x30\xd7\x74\x78\x28\xf5\x3f\xb9\xd0\xa6\x82\x6e\xe7\x73\xac\x7a\xfb\x7c\x27\x92\xcd\xb3\x1d\xde\xf9\x7c\xb0\xd3\x8d\x54\x39\xee\x6d\xf9\x2e\xcb\x70\x22\x06\xdc\x7b\xf7\x39\x97\x7c\xbd\x05\x97\xe8\xdd\xe7\x58\xef\xf5\xf9\x5e\x72\xd5\x15\x20\xae\xec\xa5\x1b\xf9\xe5\x5e\x5e\x00\x67\x09\xe3\x51\xe2\x2d\x3e\xd1\x2b\xb3\x17\x78\x02\xf7\x53\xf0\x62\xda\x9d\xf7\x3d\x9c\x14\x01\x91\x93\xb1\xe8\xbd\x0e\x22\xef\xc3\xd2\x8c\x17\xa0\x19\x84\x2c\x3b\x5d\x6b\xa5\xda\xf0\xe7\x68\x89\xf6\xa0\x69\xd2\x70\x11\x97\x68\x26\x20\x20\xc2\xba\x0d\xf3\xcb\x9b\x9e\x41\x82\xea\xe4\x24\xcd\xac\x50\xa1\x8c\xd1\x32\x94\x61\xd0\x0a\xeb\x2a\xeb\x35\xd7\xec\x74\x4d\xe5\x4e\x96\xe2\x8c\xf8\x4c\x95\xca\xab\xdd\x19\x29\x9b\x74\x47\x2f\x0d\x35\x9f\x48\xd4\x61\x12\x48\x3f\xa5\xc3\x08\xf4\x33\x75\xf4\x17\x1b\xcc\xb4\xae\x2d\x38\x1b\x89\x1e\x1f\x79\xa0\x40\x1a\xae\xa6\xc0\x3f\x5e\x9d\x0f\x65\xdb\x1c\x15\xbd\xd2\x20\x3d\x31\xd1\x87\xd1\xcd\xf4\x53\xc0\x61\x40\x05\xd7\x12\x29\xe7\xcd\x22\x06\xaa\x63\x32\x4c\x27\x38\x64\x75\xa2\x46\x03\xac\x29\xdf\x15\xe4\x71\xbe\xd7\x4c\x94\x1e\x85\x6a\x0d\x86\x0a\xdc\x57\x8e\x43\x08\x96\xb0\x02\xc0\xb7\xef\xcd\x25\x26\x80\xbe\xf4\xc0\x71\x2e\xbc\xcb\x14\x1d\x99\x77\x62\xce\xa6\xb4\xac\x8c\x42\xec\x5d\x88\x5c\xf3\x4e\xa7\xb3\x5a\xed\xd4\x8a\xac\x7d\x75\x13\xb8\xd3\x16\x0e\xc2\x9f\xfc\xa1\xe8\xeb\x25\xe8\x39\x83\x6b\xc3\xab\x1c\xe1\xda\x8c\x64\x57\xbf\xdd\x13\x21\x4d\x92\xa0\x49\x39\x1c\x1d\x1b\xe9\x21\xa1\xc5\x98\xb1\xe9\xd1\xca\xe2\x95\xad\xdc\x6d\xdb\xa1\x73\x76\xb0\xeb\x69\x02\xf7\xa7\x4a\xf0\xde\x08\x98\x83\x5a\xee\x62\x28\xa2\x7e\xe1\xa3\xd3\x18\x48\xd1\x61\x6f\xd8\x5d\xef\x98\xe0\x35\x24\x5f\xa8\x48\xac\x11\x9c\x82\x51\x01\x91\xaf\x31\x48\x9b\xd9\x7c\xb6\x8e\xbf\x41\xbb\x20\x6f\xeb\x89\x02\x4e\x29\x67\x29\xc5\xd0\x8e\xcf\xef\xae\xd1\xaf\xc0\xe0\xfa\x3f\xbf\x7d\xf1\x6f\x60\xf7\x5e\xf1\xe4\x66\x9b\x3b\x02\xb7\x7b\x59\x4a\x83\x9b\x4e\xea\x86\x0c\xd9\x08\x81\x90\x67\x97\x45\xf4\xd9\x39\xf8\xf4\x7d\xbf\x0c\x57\xbe\xd7\x52\x5a\x5c\x14\xcf\x77\x9e\xf8\x15\xa9\x1e\xc7\x12\x2f\x08\xdb\xd9\xfe\xf7\xd7\xdf\xbd\xe4\xaa\x28\x6a\x02\xbc\xa7\x05\x18\x65\xf5\x06\x28\xdf\xd1\x1c\x68\xbb\xdf\xae\x1f\x28\xea\xdf\x42\xa5\xed\xd6\x37\xcf\xde\xb4\xba\x48\x33\x02\x24\x94\xa0\xcb\x95\x6c\x1e\xdb\xc2\xcf\x07\xe0\x9f\x7f\x9e\xca\x62\x72\x5b\x01\xa9\x66\x8a\x72\x91\xc6\x03\x89\xf3\x2b\x9d\x34\x6b\x32\x08\xf3\xe2\x4a\x17\x56\x48\x2b\x20\x1d\x1e\xd4\xa9\x26\xc9\x29\x5e\xda\xab\xf1\x83\xe9\x75\x9c\x05\x09\x1a\xb3\x0d\x70\x64\xdd\xc8\x5e\x15\x71\x93\xe3\x0e\xb8\x52\xbe\xd5\xaf\xdc\x86\xab\xce\x87\x04\x3b\xfe\x6e\xf2\xa8\x23\xeb\x54\x23\xb4\xd8\xe4\x36\x56\x32\xc9\xd8\xd6\x5b\xba\x05\x21\xea\xe0\x7d\x6d\x01\xf2\xf7\x2a\xdf\xc5\x5c\x65\x9c\x52\xa8\xb7\x58\x21\x6d\x2b\x68\x6e\x21\x2f\x35\x5d\xa3\xf7\x6d\x43\x05\xbf\x9c\x36\x76\xc6\x7e\x45\x96\xad\x6b\x93\x73\xe0\xfa\xf3\xc3\x64\xcb\x4d\x6a\x1a\x0c\x6e\xb6\x86\x01\xc8\xa8\xd7\x33\x01\xdd\xd2\xcc\x24\x32\x91\x57\xaa\xac\x1b\x7f\x14\x2c\xe2\x01\x3b\x4d\x17\x6f\xc9\x0c\xb5\x45\x48\x26\xc1\x6b\x5b\xb3\x55\x64\x7a\xfc\x12\x8d\x98\xee\x02\x87\x34\xc6\x5e\x53\x7c\x0d\x26\xff\x95\x48\x16\x99\x2e\x10\x38\x10\x4f\xbf\x61\x8b\xd1\xc3\x49\x66\x9f\x15\x2d\xe1\xa9\xcb\x5d\x89\xb1\x98\x3a\x33\xfe\xad\x0e\x67\x2c\xaa\xa9\xef\xa7\x1a\xd6\x34\x08\x9e\x07\x6e\xac\x7e\x8e\x0d\xba\x67\x09\x2b\x35\x82\x5c\x7a\xac\x19\xdd\xb5\x17\x14\x21\xeb\x8e\x1a\x84\x3a\xd2\x8f\xd7\x0f\x39\x71\xf1\xa7\x8d\x4c\x81\xbf\x06\xe3\x99\x22\xd7\x8e\x27\x61\x66\xea\x43\x0e\x67\xb0\x0a\x22\xfa\xca\x0e\xe0\x63\x09\x17\x98\x71\xc2\xcc\x50\xdb\xaf\xbb\x0b\x68\xfc\x59\xdb\xf2\xa1\x11\x5c\xc0\x80\xfd\x51\x7e\xd0\xde\x07\x1f\xc9\x7c\x7f\x2f\x67\x2b\x1b\x4c\xbf\x7e\x93\x1b\xf5\x40\x55\xe4\x19\xaa\xfb\x08\x53\x97\x5a\x66\x76\x90\xde\x3b\x11\x46\x67\x11\xf8\x0d\x79\x32\x5a\xe2\xec\xac\xcd\xfd\x98\x59\x97\x09\xd8\xe1\x69\x1e\x5f\xcd\x95\x9b\xb4\xa0\xea\x04\x4a\xd4\xd8\x27\x8d\xeb\xad\x05\x0a\x1e\x47\x3b\x64\x0a\x85\xd9\x53\x86\xe0\x43\xfb\xc8\x10\x95\xa6\x3a\x2d\x8f\x73\xc5\xb6\x11\x72\x86\xed\x64\xa6\xac\x5b\x96\xf2\x21\x2b\x48\x10\x4c\xbc\x09\xab\xc1\x31\x52\xf8\xb0\x13\xb5\x71\x24\xf3\x62\x9c\xe5\xc0\x2f\xf0\x6a\x50\xb5\x38\x11\xc3\x92\xca\xa9\x58\x93\x87\xa0\x54\x2f\xd8\xc7\xa7\x1c\xf7\x18\x12\x69\x9b\x65\xde\xf6\xad\x44\x81\xd2\x65\x64\x73\x50\xea\x33\x2a\xe6\x10\x64\xe4\xa9\x77\x8e\xb3\x75\x33\x6c\x0b\x79\x82\x68\x01\x4f\x26\x77\x3c\x7b\x83\xc5\xcf\x40\xe5\xd9\x0c\xd3\xef\xc9\x55\x8a\x0b\xa8\xdc\xc2\x27\x39\x03\xf4\x05\xb4\x5d\xe2\x44\xf4\xe4\xbc\x85\x66\x78\x97\x7f\xb7\x1e\x78\xeb\x95\x70\x5c\xce\x5b\x3f\xed\xe0\xec\xf1\x2e\x84\x62\x8a\x76\x7f\xf8\x3c\x99\x40\x30\x0a\x74\x81\xef\xaf\x9f\xbd\xbc\xf8\xf0\xf5\x0f\x6f\xde\x7c\xf7\xf2\xc3\x8b\xe1\xd7\xcf\x5e\xec\xdc\x07\x6d\x7c\xf9\xc5\x1e\xb7\xfd\xa5\x4d\x26\xa0\x72\x34\x0d\xfa\xda\xca\x14\x67\x63\x5c\xb4\x2c\x99\xa8\xde\x3b\x86\xaf\x9e\x0f\xf5\x8b\x7a\x3a\xdf\xc7\xd3\x4c\x71\xa9\x59\x71\xb2\x23\x98\xe0\x16\x87\x70\xb1\xb0\x93\x78\x94\xcc\xc7\x2a\xba\xd2\x01\x75\x4d\x99\xbe\x28\x4a\xd7\x15\xfb\xfc\xd0\x0f\xdf\x7f\xff\xec\xd5\x87\x21\x20\xf1\xc3\xcb\x8b\x67\xaf\x22\x4a\x78\x6e\xa1\x4d\x17\x2c\x29\xcf\x81\x88\x43\x37\x9c\x32\x1f\x91\xcd\x59\xfd\x50\xda\x96\xde\xc8\x9d\xc0\x09\xaf\x7c\x17\xd0\xda\x9d\xe0\x0e\x17\xc5\x4e\xc8\xd7\xb4\x8c\x80\x1f\xdc\x09\xd0\xdb\xb1\xf8\xc9\xb2\x89\x65\xfa\x51\xaf\xbc\xa9\x5d\xfb\x62\xb3\x52\x10\xbe\xff\x80\xb3\xaf\x1c\xbe\xbb\xd8\x22\xcd\x26\x84\x3b\xa0\xdc\xe3\x92\x74\x60\xc5\x71\x99\xe5\xc3\xd9\xac\xdd\x7a\x8b\x8c\xf2\x5e\x67\xa0\xea\xea\xd2\xe9\xf1\xa6\xba\x74\xbc\x89\x2e\x32\xc2\xbc\x4d\xb4\x83\x42\x0d\xa0\x5a\xe0\x1b\xb4\xa4\xc4\xd0\xa0\xdd\xc2\x3b\x2d\x4f\x9d\x4b\x7b\x80\x8a\x23\x49\x97\x66\x35\x99\x9b\xe8\x8a\x4c\x93\xc2\xb1\xa5\x07\x4d\xf0\x55\x99\xf2\x72\x66\x41\x91\x27\xdd\x7a\x1a\xa7\xef\x5a\x25\xaf\x3e\xe0\xfa\x03\xc4\xae\x8c\xaf\x70\x89\x04\x96\x0f\xfc\xce\x5e\x4c\x26\xf8\x9b\x2c\x47\x6d\xfc\x23\xde\x6c\xe6\xe0\xd4\x9d\xe7\x90\x87\x69\x2a\xb9\xde\xc6\x54\xad\x5c\xe9\xb2\x08\xbc\xa7\x93\x55\x2e\x32\xd0\xb7\xab\x4b\x14\x3e\x17\x0b\xf3\x5c\x1b\xcc\x27\x55\x7a\x07\xcd\x0c\x3a\x54\x28\xf1\x01\x7b\x0a\x6f\xec\x78\xab\xf6\xd0\xd7\x76\x55\x95\xed\xd0\x64\x22\x56\xd8\x1b\x44\x02\xb3\xa0\x2e\xbf\xc4\x84\x14\xaa\xf3\x1c\xdb\x0a\x16\xe4\x05\xe0\x85\xc4\x92\x14\x33\x3c\x12\xd6\x28\x6c\x37\x9b\xb2\xb0\x5e\xff\x3f\xd9\x84\x0a\x90\x13\xae\x2d\x51\x58\x89\xa1\x50\x67\x7d\x6f\x3b\x6b\x52\xdf\x6c\xf3\x44\x21\x04\x4e\xfc\xe9\x8b\xe0\x41\x82\x5f\x4a\xe6\x65\x81\x85\x81\x45\xa9\xab\xe4\x53\x9d\xfb\x2f\x78\x15\x42\x01\xaf\x30\xc1\x14\xf8\xa8\xc9\x74\xa5\xb3\x5d\x28\x43\x38\xc9\x56\x70\x1e\x6c\x21\xa2\x3a\x6e\xc5\x5a\xe1\xd2\x2f\xbb\x30\x6a\x1d\xcb\x3f\xa8\xa4\xb3\xc4\x82\xb7\xb1\x99\x4a\x28\x6c\xe5\x42\xe6\x4a\x20\x71\xbd\xe1\x11\x36\xa6\xd1\xe9\x46\xc0\x1d\xd8\x0a\x96\x52\xc1\x5b\x5b\x58\x4c\xb1\x42\x9b\xad\x6b\x14\xf5\x3b\xe6\x19\x59\xe8\x28\x7a\xae\xd7\x76\x2d\x4b\x2e\x54\xd4\xe9\x31\x3d\xc7\x12\x9b\xa9\xa1\x78\x91\x70\xdf\x11\xa5\x62\x95\x8e\x77\x89\x08\xc8\xed\x7b\xec\x19\xd0\x4a\x1b\x76\x41\x6e\x55\x6b\x42\xc5\x1a\x7a\x2a\xb8\xb2\xe0\x09\x47\xe5\x35\x23\xdc\x7b\x78\x6f\x49\xc9\x6b\x1f\xf8\xbb\x76\x4b\xe0\x9d\x88\x3b\x39\x27\x9a\x2e\x76\x92\x05\x71\x69\x8c\x34\xd8\x53\x08\x96\x3c\xf0\xb5\xa0\xbe\x05\x7d\x3b\x37\x48\x32\x2d\xaa\xd7\x1d\x46\xad\xbd\x96\x2b\x66\x17\x93\x3b\xa6\xc2\xbc\x50\x88\x00\x98\xab\x99\xba\x01\xc1\x45\xe6\xbf\x56\x49\x1e\xe7\xe3\xeb\x95\x5d\x14\x9d\xd8\xaa\xdd\xab\x4c\x97\x02\x5f\xc7\x37\x9a\xe5\xa1\x5f\x13\x2d\x33\xe9\x15\x27\x35\xc1\xa0\xe2\x14\xef\x84\x17\x73\x31\xea\xc1\xfc\x12\xad\x03\x33\x9e\x10\x20\xc9\x0f\xe2\x1c\x90\x7b\x38\x29\xfd\x65\x1d\x7b\x2d\x67\xcc\xab\x82\xe1\x2d\xdd\xd0\x0c\xe5\xa8\x29\x66\x87\xcc\x30\x9d\x9b\x01\x7b\x12\xdc\xf9\x6e\x44\x1a\x21\xff\x60\xf4\x63\x96\xea\x11\x7f\x4a\x42\xf0\xa1\x92\xe4\x42\xa0\xa4\x18\xc2\xdb\x6f\x14\x3e\x45\x19\x31\xdb\x6c\x8c\xd7\x81\xc6\x6d\x01\x5d\xe6\xba\x2a\x9e\x21\xb5\xf5\xd6\xa3\x7c\x2e\xd9\x00\x57\x92\xec\xb5\xcc\x24\x36\x5f\x34\x0a\x5e\xff\xd2\xd9\xe2\x5d\x34\x1a\x9f\x9d\x23\x38\x1b\x0d\xdd\xc2\xa3\x73\x6e\xc1\xbc\xdb\xbe\x85\xbf\xf8\x37\x5e\x29\xf0\x9e\x27\x34\x73\xc6\xa5\x20\x6c\x21\x66\xd9\x28\x9e\x19\xc2\xd0\x5d\x9d\xcf\xa5\xdb\xe3\xeb\x64\x36\xb9\x8c\x51\x75\x25\xca\x3e\xcb\x7e\xcf\xb7\xf1\x82\xe6\x20\x41\x1b\xed\x92\xf9\x82\xa1\xfc\x69\xce\x17\xe9\x39\x42\xc3\xcc\x64\x15\xf7\xfc\xd4\x10\xb5\x0b\x39\xc2\xf0\x8b\x2f\x89\x57\xe1\xc4\x26\xbf\xe6\x81\x29\x6e\x6a\x01\xdf\xa0\x7a\xdd\x4d\x26\x05\xd8\x72\x77\x03\x6e\x65\xa9\x82\x4b\x15\x96\xe9\x4a\x98\xf2\x36\xdb\x04\x63\xd0\x21\x63\xd5\x95\x98\xc1\xf3\xd3\x3c\x1b\xd5\xbc\xdb\x7b\x46\x7f\xbb\x7f\x50\xdf\x17\x7f\x06\xf0\x87\x82\x66\x83\x69\x1e\x7d\xc6\xbb\x25\xe0\x11\x5b\x58\x2e\xe2\xf4\xad\xa9\xa4\x63\x3d\xa6\x63\x18\xa7\x11\xb4\xb4\xe9\x98\x8b\x43\x30\xca\xb2\x96\xb4\x0e\x84\x23\x60\x7e\x56\x47\xc0\x2e\x7b\xe7\x5a\xb1\x21\xe0\x9f\x96\x31\xed\x36\x01\xee\x31\x88\x64\x7c\x85\x4b\x60\x4a\x36\x96\xdc\xc8\xb7\x3f\xbc\x7e\x43\x4a\xaf\x75\x7e\x7e\xde\x8a\x40\x43\xb5\x3e\xc3\x2f\xac\xb6\xe2\xf1\x18\x8b\xf4\xd5\x1a\x29\x16\x5e\xf9\xc5\xb3\xcb\xe1\x0f\x2f\xde\x7c\xf8\x8f\xe1\x8b\x1f\x9e\xe9\xcc\xac\x5e\x74\xd5\xd2\xf7\xc8\xb3\x34\x13\xa6\x29\x91\x07\x54\xc7\x32\x9e\xd5\x20\xef\x1b\x4a\x0a\x2f\xe9\x95\xba\xc0\x56\xd5\x0c\x3d\x95\xc3\x23\x05\x69\x59\x4e\xaa\x6c\x45\x3d\x57\x39\xe0\x53\xf3\x68\x92\xe4\xd0\xe2\x6c\xb5\xae\x53\x2c\x53\x5e\xc5\x0b\xa5\x6b\xf4\x08\xfc\x07\xd2\x4e\x28\x28\x51\x3f\x6b\x05\x50\x82\xf2\x0c\xa2\xfd\x69\x61\x34\x33\x18\x18\xba\xe6\x51\xd1\x42\x66\x46\x90\xb5\x1c\xcb\x89\x67\x9e\x6e\xb2\xc9\x45\x24\x8d\x3f\x14\xe8\x24\x94\x7a\x91\x00\x56\x5c\xa0\x9e\xa6\x92\x2a\x68\x70\x94\x15\x6b\x87\x97\x29\xd1\x3c\xca\x36\x07\xb9\x35\x67\xc8\x94\x34\xaf\x70\x91\xcb\x33\x98\xf1\xec\xc2\x14\x2e\xc1\x02\x76\x15\x22\xa2\xdd\xa3\xc6\x45\xff\xba\xec\xcb\xac\xcc\xae\x45\x0e\xec\xb6\xa6\xa8\xb7\x98\xc0\x16\xdb\x9b\xdd\x01\xb8\x02\x55\x2f\xe5\x18\xab\xe4\x86\xe7\x0e\x91\xb5\xf5\x6b\xc2\x34\xa7\x43\xb4\xeb\xd6\x0d\x4c\xa8\xb4\xcb\x74\x40\x87\xcb\x55\x8b\x08\x9e\x87\x9d\x54\x2c\x3e\x69\x54\xe2\xc9\xc4\xe8\x7a\xaf\xea\x51\x5f\x13\xbc\x6a\x39\xa9\xb7\x58\x16\xd7\x0e\xc2\x57\x65\x69\x6e\xc7\x26\x75\xa4\xb2\x15\xcc\x0d\xa4\x17\x54\x1d\x22\x21\x6e\x92\x6c\x59\x50\x4e\x99\x1b\x93\x4b\x17\x3e\xa5\x77\xb9\x9a\x83\x2f\xbf\xb9\x83\x26\x36\x0e\x3a\x6a\x8a\x3e\x44\x5f\xd9\x36\x27\xd1\x97\x76\x0d\x5b\xf0\x0c\xd6\x5e\x42\xfc\x9e\x60\x5c\xe7\xef\x28\x42\xab\x5d\x6c\xe2\xcb\x06\x1f\xbe\x02\xdb\xba\x6b\x41\x62\xd8\x2d\xb2\xab\x51\x10\xe7\x75\x2a\x42\xce\x66\xed\xfd\xb1\xad\xd7\x89\x72\x39\x5f\xe7\xf3\xbd\x1e\xaa\x7e\x93\x46\xad\x28\xa6\x4e\x50\x3f\x5e\x01\xa8\x56\xa1\xd7\x28\x37\xf0\x56\xcc\xea\x1f\x59\x7d\xf1\x07\x65\x97\x26\xd9\x65\x50\x4f\xbf\xfb\xfe\xbf\x8c\xa4\xf8\xe6\xac\xc8\xd8\x48\x82\x31\xca\x29\x71\xe7\x1a\x9a\x67\x13\x88\x78\x74\xee\x1f\x27\x04\x32\x13\x55\x91\xf1\xc3\xea\x7b\xd2\x09\x66\x82\xc0\x6b\xb8\xe7\xf7\x50\xe4\x27\xe8\xab\x29\x0f\x5f\xb5\x6b\x88\xe3\xa5\x0c\x9a\x49\xe4\x97\xbd\x56\x06\xce\x63\x1f\xf0\x4b\x17\x15\x8d\xa6\x5d\x29\x6d\xe9\x73\x11\x92\xa1\xdb\x1b\xe8\xbb\xa7\xb4\xe0\x8c\x4a\x55\xab\x5e\x7e\x71\x8b\x7e\x1a\x10\x04\x17\x7d\xd5\xbd\x01\x63\x90\x94\x63\xba\x22\x33\x21\x13\xd9\xcd\x49\x86\x46\x13\xf9\x91\x22\x4c\x5c\x9a\x1f\x8f\xb0\xa9\x04\xba\x02\xc1\x06\x0e\xa5\x40\x65\xb3\x3f\x00\xb1\xad\xf6\xa3\xeb\x39\xfc\x33\xdf\x0b\x37\x62\xe8\x57\x4c\xb7\x5e\x62\x95\x99\x6e\x67\xd2\xda\xca\x7d\xd7\x84\x0b\xd4\x46\xbb\x36\x62\xe8\x04\xa3\x83\x41\xce\xa6\x11\x30\x0b\x0f\x9d\x82\x73\x5d\x9d\x34\x0d\x2e\x3b\x27\x9c\x90\xb6\x74\x49\xb8\xde\x9e\x3d\x38\xbb\x40\x02\x8c\xce\x7f\xd9\x01\xd1\x5e\x8c\x5e\x67\x88\x40\x31\xd6\x07\x27\x65\x82\x75\x9a\x7a\x01\x66\x82\xce\x49\x4c\xc5\x7c\x94\x3f\xf7\xab\xf9\x74\xa5\x0c\x5b\x17\x9b\x38\x1f\xbb\xec\xc5\x76\xe3\xb9\x7e\x34\xb7\x1a\xcc\xa1\x2e\x17\xdc\x38\xa0\x58\xdc\x50\x19\x4f\x61\xe4\xb6\x19\xcc\x57\x4a\x17\x3d\x8d\x82\xe1\xd4\x6b\xbc\x0a\x29\x21\x76\x70\xff\x4b\xbb\x90\x10\xe6\x4c\xf4\xce\x4f\x19\x0e\x63\x3d\xd5\x69\xd5\x7d\x4e\x5f\x4c\xb1\x13\xaf\x2c\xc7\xa6\xb2\xa9\xe4\x03\x3d\x5b\xc9\x51\x7e\x8d\x68\x92\x93\x31\xcf\xe0\x1d\x7a\x09\x9a\x48\x41\x48\xcc\x35\x33\x76\x51\x63\xae\x1c\xb2\x18\x89\x57\x79\x65\x9e\xf1\x8a\xd0\x94\x3a\xe1\x55\x1d\xda\x1c\x36\x38\x36\xcb\xbc\x00\xc2\x93\xa5\x8e\x27\x85\xf7\x3a\x6c\xca\x45\x7d\x3e\xce\x85\xe6\xb9\x5b\x35\x9b\xd5\xb7\x8d\xec\x8a\x19\x1c\x60\x84\x14\x44\xa5\xab\x75\x96\xc5\x14\xdf\x57\x25\x52\xd7\x2c\x17\x7e\x38\x5f\x16\xe5\x43\x5e\x93\x69\x56\xe6\x6d\x72\x42\xda\x1d\xbd\x07\x85\x71\x29\xed\xfc\xef\xb4\x66\xf3\x27\xb7\x4c\x32\xb6\x45\x5f\x38\x3d\x65\xea\xc7\x26\xdb\xc9\x06\x3e\xfe\xda\xa6\x29\xbc\x55\x27\xfe\x42\x34\x4a\x1a\xa8\x14\xab\xd5\x9e\x22\x55\xa1\x3d\x4a\xe6\x07\x95\x56\x74\xcf\x56\x28\x49\x1b\xbf\xbb\x5b\x79\x1c\x9e\xc7\x7d\x5c\xbc\x97\x69\xab\x27\xaf\xb5\xfd\x55\x24\x34\xd1\x77\xae\xd7\x53\xf5\xf0\x57\xbb\x92\x53\xe8\x6c\x2e\xc1\x95\x09\x8a\x47\x91\x9a\x79\x85\x2a\x41\x21\x2e\xe5\x50\x18\x35\x6f\x9d\xd4\xf7\x22\x6d\x89\x94\xe4\x39\x61\xd1\xb2\xd0\x12\x46\x19\x80\xa1\x7a\x5e\xaa\x79\x81\xc9\xe9\x42\x6c\x2b\x96\xe0\x45\x3f\x95\xcf\x6d\xbc\xd0\xbb\x16\xc8\x76\xcd\xc4\x89\x49\xb3\x57\xa6\x05\xfc\xc6\xec\xda\x06\x0a\xd7\xe8\xa6\x37\x31\xe0\x2d\xc8\x84\x1b\x7e\xd6\xe7\x85\xd9\x54\xc0\x03\x06\x41\x78\x0d\x02\x82\x2b\x38\xbd\xa9\x7d\x99\x6a\xf8\xfd\xef\x6b\xa7\x39\xf0\x4f\xe8\xc5\xdc\x70\x68\xfa\xd9\x79\xe3\x13\x51\x9d\xdf\x23\x07\x9d\xaa\x4d\xdf\x7b\x2e\x4c\xa7\xe3\xa6\x22\x6a\x52\x4f\x35\x4f\xd0\x06\x83\xce\x81\x34\xdc\x6b\xba\xeb\x97\xbf\x06\x1c\xfd\xe8\x91\xb7\xc0\x92\x46\x1d\x9e\x79\x6a\x28\xa2\x83\xf1\x40\x4a\x3a\x72\xed\xa5\xf9\x57\xcc\x8d\x7c\x8a\xd8\x78\x7b\xa7\x79\x00\xda\x25\xf4\x79\x5c\x2e\x6e\xa2\xac\x0c\x78\xba\x75\x09\x8d\xa4\xb0\xa1\x10\xe6\x98\xbd\x9c\x82\x89\x27\x31\x58\xc4\x9e\xa1\x92\xd7\x79\x0b\xed\xb6\xd5\x34\x19\x26\xa3\x89\x83\xde\x34\x46\xa4\x66\x23\x01\x33\x19\xcc\x7c\x49\x19\x95\x07\x62\x99\xb9\x96\x66\x13\xd9\x54\xe3\x54\xbd\x3c\xfe\x36\x4f\xca\x92\x6a\x04\xb4\xe5\x33\xb2\x59\x45\x4d\x07\x24\x3f\x8f\x32\x10\xfa\x38\xfd\x99\xb5\xce\xcf\x54\x55\xf1\x33\xae\x84\xbd\xd7\x62\xf5\xa6\x12\x18\xf0\x8e\x29\x86\x13\xfc\xde\x0c\xd3\x15\xcf\x52\xc8\xdd\x1d\x73\xa5\x57\x23\xf0\xe2\x0c\x2a\x3c\xa0\xa5\xf1\xd0\x5e\x62\x95\x7c\x18\x24\xfc\xf2\x44\x02\x96\x03\xda\xb0\xd7\x96\x0f\xad\xb1\x35\x35\xb9\x8c\xc6\x34\x83\x69\x6f\x73\xb6\xa1\x21\xcd\x60\x1a\xf8\x15\xd9\x06\xe9\xd2\x23\x77\x3b\x88\x4a\xe1\x26\xb3\xb4\x46\x96\x0b\x25\x99\x95\x51\xe0\xb5\xe1\xc9\x4d\x72\xad\x41\x8f\x98\xe8\x9c\xe1\xbc\x02\x5b\x26\x97\xde\x7c\xa1\x2d\x5e\x56\xdd\xfc\x70\xd3\x5b\x22\xa7\x21\xd1\x41\x5d\x17\xae\x57\x5f\x64\xac\x9a\xd7\x43\xf1\x5a\xcf\x55\xf5\x80\xea\x94\x85\xdd\x5f\x70\x11\x16\x65\xda\x4d\x47\x2c\x3b\xa1\x22\x6a\x58\x46\x64\xa7\x5e\x86\xa9\x89\x93\xa7\xd1\xc1\xae\xa9\x6c\xe1\xf2\x77\xb3\x6d\x09\xb8\xe6\xca\x56\xbd\xd8\x44\x15\x3d\x15\x14\x09\x21\x9b\xbd\xa5\x19\x60\x33\xac\xba\x2f\xef\x05\xfb\xb0\x86\x32\xed\x6c\x97\x0b\x69\x66\xab\x70\x6d\x09\x75\x2b\x58\x5f\x22\x6a\x20\x0c\x44\x5d\x19\x84\x09\xd7\xbd\xf6\x6d\x9b\x6f\x93\xf7\x6f\xfb\xef\xdd\x66\x64\xf8\x7b\x10\xfc\xde\x7f\x5f\xdd\xea\xd2\x68\xf9\x94\xd7\x63\xe1\x76\x4a\x7a\x35\x41\xe8\x2a\xbb\xb0\x3d\xbc\x41\x29\xed\x49\x32\xa5\xdf\x25\xc7\xfe\x3f\x82\xbb\x4b\x5a\x94\xea\x2f\xc5\x30\x8a\xea\x29\x8e\xf2\xf4\x8e\x1d\x8a\xb6\xa0\xa1\xa6\x79\x1f\x67\x5b\x6b\x4a\x2b\x86\xaa\x2e\xbb\x31\x01\x73\xd0\xc2\xde\xae\x3c\x5a\x85\xc9\xc9\x67\x91\x9e\xaf\x74\x8b\xd5\x0d\x66\x0b\x68\x33\x20\x52\xad\xb1\x49\xa1\x9a\x9c\x02\xa6\x26\x30\x2e\xc9\xf5\xce\x66\xb8\x2b\x0e\xd8\x0c\xb3\x7f\x5d\x1a\xd9\x3a\xbe\x6a\x88\xe1\x6d\x32\x1d\xda\x39\xa4\x36\x95\x85\x0c\x59\x1b\x9a\xd8\xc0\x1b\x05\x68\xc7\xf6\x16\xe9\xea\xf6\x52\x59\xa6\xc9\x9f\x96\xd6\xd5\x6a\xa2\x92\x72\xaf\xd1\x06\x73\x4c\xb3\xd3\x55\x2e\xe7\x4a\xb2\x5a\x53\x69\xa7\x6d\xcb\x4c\xaf\x3b\x09\x38\xc6\xb4\xa6\x07\x71\xa2\x6d\x01\x2d\x70\x2f\x32\x7e\x1e\x10\x05\x4a\xef\x81\x52\xd9\xe3\x9c\x86\xdb\x7c\x89\x07\x8a\x37\x3d\x5a\x49\x7d\x1f\x92\x82\x2a\xe0\x16\xbc\x39\x99\x5e\xf2\x58\x4d\xdf\x8a\x69\xc1\x15\xd0\xd6\xdf\x1d\xc6\x78\x0d\xe1\x5e\x67\x76\xd2\x59\xb3\x9e\x29\x1f\xc7\x32\x00\x7e\xf9\x44\xd3\x73\xaa\x5b\xb6\xed\x86\x16\xcf\x92\x36\x26\x99\x58\x57\x50\xa1\xcd\x9d\x19\xca\x89\xe5\x01\xd4\xe6\xf4\xde\xea\x38\x7d\x92\x95\x13\xe1\x99\x6f\xe3\x0c\x57\x74\x3d\x72\x69\x03\xb7\xb7\x57\xe7\x02\xd2\x04\x7c\x36\x9b\xd4\x31\x80\x18\xf9\x07\x4d\xfa\xca\xbd\xf2\xed\xfb\xa6\x25\x1f\x26\x85\x9d\x5a\x3f\xb9\x32\xf9\xdd\xb5\xb8\x73\x6e\xb3\x6e\x2a\xf8\xad\x01\x79\x4f\x55\xbf\xae\x83\x4f\x6a\x26\x41\x3d\xe0\x60\x3a\xd4\xce\xee\x20\xe3\x69\xe5\xb2\x79\x16\xe7\xd2\xf2\x22\xcf\x60\x03\x17\xba\xb9\x21\xcb\x85\xd7\x54\x7a\x48\x43\x8e\x5b\xf3\xad\x02\x8b\xc3\x0e\x0f\x2e\x6f\x46\xd7\xd2\xe4\x1c\x44\x3e\x2d\x4b\x7d\x97\x8f\xdd\xd1\x7b\xda\x33\x7b\x18\xe9\xb9\x6e\x39\x2b\xcb\xbb\x95\x8e\xc5\x5e\x48\xfe\x0b\xcc\x4b\x83\xf7\xc4\xe9\xda\x69\xc6\xda\xf9\x1b\xcf\xf8\x31\x11\x70\x73\xd1\x85\x4b\xb5\x69\xca\x40\xec\xa2\x73\xf2\xfa\x02\x56\x12\x98\x27\x5b\x0d\x19\xb8\xe7\x29\xa9\x6a\x36\xdd\x8f\xf5\x93\x45\xcb\x05\xea\x7c\x45\xcc\x89\x84\x95\x04\x3c\x6f\xa4\xc1\x5c\xd5\x34\x62\x28\xf2\xe4\x7e\xc1\xa2\x89\x6c\x6d\x37\x4c\xa9\xb5\x17\xf2\x7a\x99\x07\x13\x8a\x55\x7a\x60\xea\xc7\xdd\xf0\x88\xed\x8a\x9e\x88\xf5\x36\x35\x11\xaa\x74\xcb\x70\xcf\x71\xba\x5a\x63\xde\x93\x62\x11\x9b\x69\x1e\x66\xd4\xc8\xcd\xc0\x9a\xac\x58\x88\x46\x21\x6a\xad\x74\x49\x93\xde\x49\xc2\x4f\xdf\xd2\xc6\x39\x32\x61\x64\x72\x4d\x05\xad\xf2\xd6\x2b\xbc\x29\x39\x4f\xe5\xb4\x0b\x9c\x8a\xe2\x94\x23\x2d\xaf\x43\x20\x8c\x87\xd9\x45\xc4\xf9\x92\x3a\x24\xc8\xee\xc9\xfd\xee\xf5\x6c\x81\x35\xf1\x93\x5a\xff\x80\x26\x0f\xc8\x17\xa1\xca\x6c\x6c\x09\xd7\xbc\xdf\x98\x99\xf8\x2e\x0b\x1d\xd7\x3d\x73\x48\x53\x00\x1e\xe3\x6b\xbb\x29\xad\x73\x69\x74\x8e\x65\x2b\x01\xe0\xaa\x36\xac\xf2\xab\x64\x97\x2b\x5c\x54\x65\x16\xe9\xec\x71\x4b\x5a\xf7\xb5\x6d\x89\xa4\x37\xc0\x2f\x33\x63\x2e\x1b\x86\x57\xd7\xd5\xff\xea\x88\x5b\x07\xa6\x4c\xf0\x4f\xa1\x84\xc6\x3f\x2c\x41\x70\x49\xc4\x6d\xa3\xa8\xcf\x74\x18\x55\xaf\x0e\x36\x0b\x13\x6d\xd4\xe1\x27\x76\x74\x8c\x83\x45\xa8\xcd\x85\xc9\xf5\xba\x43\x7a\xe8\xcd\x2a\x06\xdc\x6e\x1d\x73\x79\x49\xa8\xc6\x77\x69\x84\xdc\xec\x6d\x4d\x20\x10\xc2\xe0\x3b\x64\xeb\x5d\x1d\xbb\xea\x22\xb1\x80\x61\x9e\x82\xbc\x96\x7a\xc3\x38\x6d\xb0\xab\x8e\x89\xf1\x40\xcc\x0e\xcc\x08\x85\x06\x52\x54\xb4\xb8\xfa\xc0\x6b\xdc\xa1\xc9\x3f\x5d\x00\x4f\x61\x89\xd1\x9b\xd1\x09\x18\xde\x85\x41\x57\x0b\xe0\x94\xce\xae\x71\xb9\xc8\xb7\x09\x5d\x1f\x94\x77\x7c\x27\x4f\x1f\xe5\x1a\x01\xe3\x73\xf1\xce\x9b\x58\x5b\x9d\x71\xd1\xa6\x28\xf3\x43\x57\x6a\x49\x7b\xe3\x6c\x74\xb8\x69\x7f\x0c\xdb\x33\xd2\x6c\x4c\x1a\xe3\x7a\xd9\x00\x04\x95\x48\x63\xc5\x24\xf5\xfe\x3b\x8f\x16\x14\x70\x8c\x67\xcb\x89\x32\x45\xb8\xc6\x31\x6a\x6c\x05\xba\x6e\xdb\x48\x88\x52\x58\xf2\x9b\xe3\x66\x35\x34\x0e\x86\x5a\xba\x8d\xcd\xb2\xc7\x7d\xe1\x50\x4d\x6e\x59\x61\xdd\x2f\x83\x7b\xb3\x13\xb6\xe1\x0f\xa3\x2d\xca\x15\x26\x85\x2c\xea\xb6\xfe\xd9\x13\x7b\xff\x89\x4c\x36\x24\x36\x1f\x92\x4c\xcc\x66\x55\x93\x27\xd6\xa0\xa2\x13\x69\xaa\x1d\x10\xf4\x33\xb7\xc1\x45\x8d\xf0\x5f\x2c\xd9\xb2\x68\x4a\xb3\xe4\xdb\x91\x36\x15\xf6\xf0\xa6\x4e\x75\xdd\x18\xf8\xb9\xdf\x27\xb8\x0d\x1c\xee\xdf\x3e\xc9\xe6\x5d\xc3\x8e\x87\xbb\x93\xe4\x2a\x29\xa3\x6b\x75\x27\x37\x63\x95\xde\xb9\x2e\xfc\xe3\x99\x79\xbd\xb1\xef\x67\xd0\x9f\x9f\x7f\x8e\xea\x3b\xe0\x16\x19\x4c\xcc\x66\x41\xbc\xa7\x0f\x7d\x65\x04\xc0\x58\x3c\x8c\xfa\x77\x53\xf8\x03\x38\x0f\x70\xbd\x85\x2e\x3e\x1b\x1c\xbb\x1a\xf9\x89\xdd\x68\x12\xb7\xae\x86\x57\x74\xa3\x43\xaf\x82\xde\x0c\xb0\xcb\x04\x5b\x42\x13\x97\x22\x55\x98\x28\x35\xeb\xc4\x89\x8c\xae\xbc\x75\xbd\x7b\xad\x3d\xf2\x84\x57\x9c\xcb\x47\x6d\xad\xa9\x9b\x34\xa9\x80\x60\x86\xb3\xc4\x25\x22\x9d\xa0\xa8\x33\x74\xcc\xdf\x26\x13\xeb\xc9\xeb\x87\x99\xa3\x26\xba\x02\x48\x23\xc0\x69\x76\xc1\x82\x88\x5a\xe1\x6d\xc2\xe9\xb7\xe1\xb9\xfa\x14\x94\xc6\xd5\x34\x81\x55\x07\x46\xb1\x30\x68\x51\x03\x6b\x3d\x10\xd4\x46\xb4\xed\x62\x41\xe5\xe4\xb2\x35\x8a\xa2\x27\x3c\x33\xb3\x95\xaa\x92\x56\x59\xa8\xad\x60\x45\x29\xdf\x71\x3b\xd0\x71\x90\x5d\xab\x76\x80\x1b\x9c\x0a\x7c\x7e\xb1\xed\xec\x20\xb6\xb7\x46\xad\x48\x8d\x80\xfd\x95\x3a\x81\x1e\xf3\x61\x71\xbc\x08\x2c\x64\x83\xad\x34\x0a\x4e\x5d\xf9\x62\xe6\xea\xa1\x3c\x79\x43\x28\xbf\x0e\xca\x5a\xec\x3a\x46\xd1\x82\x30\x51\xb4\x5b\xc7\x7a\x8e\xac\xdf\xee\xbd\xc9\xb0\x3a\x9b\x22\x7c\x33\xd6\xe9\x0f\xdc\x0a\x43\x31\xbe\x59\x6e\x8d\x87\xd9\xa9\x88\xfd\x9c\xd2\x4e\x7f\xe4\x6e\x77\x4b\x7b\x16\x05\x36\x16\x4c\x3e\xe4\x5a\x6d\x82\xf5\x54\x77\x78\x2a\x04\xcd\x6a\x63\xe1\x7b\x00\x49\x79\x24\x2e\x84\xff\x05\x46\x94\x36\x93\x4c\xd2\x6d\x59\xce\xc2\x3c\xf4\x97\x3a\x7b\x1e\x86\x8f\x5f\x65\xd9\xb3\x97\x23\xd1\x44\xe2\x45\xcf\x5b\xf1\xb4\xe1\xcc\x26\x86\xae\x59\xd1\xcc\x21\x9f\xa5\x42\xcd\x4c\x67\x67\x83\x9b\xea\x88\xe6\x1b\x2b\xe1\xaa\x9a\xc6\x3c\xfd\x1b\xb2\xa0\x75\x8e\xdb\xc9\x84\xf7\x24\xd3\x40\x1d\x19\x9e\x6e\x5e\x7c\xbc\x29\x46\xdd\x09\x2d\xea\x8e\x34\xb5\xc6\xb0\x5a\x05\x1b\x2c\x5f\xbe\x0f\x75\x2f\x62\x58\x91\x9e\xa7\xf1\x6c\xbc\x9c\x19\x17\xcc\x44\x5f\x63\x3c\x1c\xa8\xbc\x55\x98\xf8\xbb\xcd\x08\x87\x22\x4c\x36\xf1\x8e\x00\x24\x4c\x62\x7f\x1c\x09\xc4\xee\x70\x25\x5f\xc7\xe2\xea\x6d\x19\x4a\x7b\x29\x91\xc3\x8a\x2b\x58\x59\xe1\xe1\x57\x54\xe6\x3b\xb8\x4f\x69\x96\xee\xa0\x80\x2c\x54\x5e\x26\xca\x4e\x43\xe8\x2b\x2b\xbd\x13\x59\x1c\xc9\x75\x06\xbb\xec\xd3\xfd\x37\x16\x03\xfd\xb7\xbf\xe2\xb6\xcb\x4a\xc0\xdb\x7a\x35\xc6\xda\xe8\x16\x3f\x79\xd7\xea\x46\xfa\xeb\xaa\xf5\x5e\x03\x8c\x04\x00\x5f\xd5\x37\x90\x68\x36\x6b\x56\xb4\xe3\x6e\x34\xea\x44\xe7\x5f\x1a\xe1\x88\x7e\x62\x57\xfc\x31\x7c\xb1\xed\x3f\xa6\x1a\x25\xdc\x93\x58\x77\x16\xee\xc2\x0f\xee\xaa\x80\x5c\x59\x48\xf4\x15\xdc\x3a\x5d\x6c\x50\x67\x73\x27\x82\x30\x51\x5c\xe0\x82\x2e\x8e\x1b\xff\x3b\xfe\x6f\x94\x4c\xb9\x6e\x40\xc6\x13\xde\xfc\xcf\x5b\x56\x17\xef\xef\x81\x0e\x6f\x68\xd1\x55\x51\x52\x6a\x55\x3f\x54\x19\xfc\xa6\xc7\x47\x38\x7f\xc4\x5b\xc5\x35\x3c\x67\xf6\x8c\x34\x59\xb3\x61\x2a\xcb\x31\xfd\xae\xed\x31\x41\xe4\xd0\xaf\x51\x2f\xfe\x40\x48\xd5\xc2\x63\x62\x83\xdf\x9b\xc8\x1c\x6d\x67\x46\xe6\xbe\xfb\xc0\x99\x6e\x71\xc1\x0e\x08\xfd\xbe\x6f\x8c\x21\xe3\xba\xa0\x11\xb5\xc0\xc8\x5a\xca\x18\x62\xc6\x8a\x4b\x9a\xdf\xf4\xf8\x15\x6f\xf1\xf6\x7b\x51\xbb\x56\x59\x5a\x09\xa0\x84\x6d\x1d\xa4\x11\xf7\x3a\xd4\x46\x4d\xa8\xb5\x47\xd0\x10\xea\x2f\xd3\x72\x07\x7d\x68\x79\x95\x51\xeb\x34\xac\xdf\x05\x00\x4d\xaf\xb7\xa3\x00\xa5\xba\x13\xa7\x4c\x91\xa4\xae\xe7\x4a\xfe\xac\xc4\x89\x78\x0d\xb6\xbb\x10\xd3\x02\x76\xa5\x8a\x66\x66\x6c\x8c\x1e\x77\x6e\x1d\x7b\x35\x0f\xc2\x83\x2d\xb8\x8d\x32\xe1\x93\x55\x56\xd1\x3c\x29\xe8\xb4\x23\x57\x87\x06\x6a\x86\x6a\xc9\x8c\x9c\x54\x6a\xca\xb0\x41\xca\x6b\x99\x22\x05\xaa\x1e\xe0\x4a\x44\x51\xd0\x46\x72\x47\x5b\x78\xd1\x29\x16\xee\xe8\x36\x7f\x6e\x96\xb7\xd1\x1f\x29\xed\xed\xfc\x12\x93\x5f\x38\x32\xd6\x97\x1f\xfc\xa2\x3a\x36\x6c\x55\x18\x75\xbb\x0d\xda\x56\x36\xdd\xab\xb2\x59\x33\xef\x11\x96\xb5\x3d\x58\x53\xd7\x56\x2d\x6b\xd3\x69\xcf\xbf\x7c\x55\x9b\xde\x9c\xbf\xa2\xb5\xf4\xc4\x81\x8a\x1e\xf2\xd4\xf6\x43\x5e\x0c\x19\xcb\xaa\xe8\x9e\x9f\xea\x7a\xde\xe8\x44\xbb\xf7\xe8\x6d\x4c\x2c\x0b\x72\x56\x85\xd7\x49\x9a\x2d\x1c\x81\xa0\x9a\xd1\xcc\xbb\x8a\x92\x19\x9a\x1a\xe7\xc6\x08\x61\xfd\x38\xee\x55\xe5\x16\x7d\x4e\x92\x62\x1c\xe7\xec\x52\x12\x7a\xa0\x97\x19\xb5\x4a\xd9\x5e\xad\x9f\x13\x9c\x82\xb7\x8d\xd2\x6d\x3b\x0a\x74\xf5\xeb\x9a\x13\x6f\x0e\xb6\x69\x0b\x02\x8a\x9e\x1d\x18\xed\x42\x60\x6f\x6a\x9a\x3c\xa7\x2d\x94\xce\xf5\xdb\xc2\xc0\x44\xaf\xb7\x97\xa0\x6e\xd5\x46\x64\x1e\xd2\x71\x8a\x04\xe3\x90\xc5\x4d\x36\xac\x8f\x48\xfc\x92\xc1\x5f\x11\xc9\xdb\xf7\xc9\x36\xbc\x63\x37\x83\xed\x70\x68\x71\x33\xb9\xe7\x7a\x11\xf6\xc6\x64\x8c\x68\x49\xab\x73\xfe\x6d\xeb\xdd\xb6\xc8\x26\xd8\x50\x6e\xfb\xac\x01\x3f\xd4\x58\xac\x17\xe4\x27\xec\xfc\x46\xdb\x97\xfb\x70\x83\xbd\x3a\xbe\xd2\x83\x5a\xc3\x53\x9b\xa3\x4b\x7e\x16\xcd\x99\x57\xaa\xf3\x59\xa8\x60\x6a\x75\x4b\x73\xd9\x9f\x17\xaf\x16\xb4\x8d\x96\x3f\xbf\x9b\xd0\x72\x7e\x0e\x13\x68\x9e\xa6\x6a\xc6\x26\x72\x5e\xa9\x52\xe4\x97\x54\x26\x0f\x38\x72\xe3\x2d\xf0\xf5\x56\xe0\xf5\xb3\xa6\x95\xd9\x08\x1f\x35\xca\x12\x6c\x9b\xaa\x28\xfc\x15\x49\xff\x3b\xb3\x0e\x35\xeb\x38\xb0\xda\xb7\xed\x57\x1b\x3b\x78\x57\x2f\xe6\x57\xa1\x7e\xb6\x76\xcd\x54\xdd\x13\x4d\xcb\x30\x3f\x61\x76\x49\xf3\x87\xb7\xd4\xbf\x88\xcc\xf2\xc6\x12\x97\xeb\x57\x39\x65\xcb\xa1\xa9\x9d\x21\x63\x8d\xc5\x93\x7a\x6e\xdf\x4e\x23\x57\x6b\x03\x6e\xa1\xaa\xb7\x0f\x9d\xa5\xd0\x06\xf1\xb3\xdb\xdd\x45\x06\xac\x5e\x9e\xaa\x5e\xfa\x37\x4e\xee\xd9\x2a\xf2\x4d\x95\xc7\xeb\xc7\x7c\xeb\xf2\xe5\x26\x36\x88\xec\x74\x1e\xa5\x4f\xc5\x1e\x2c\x5e\x2e\x78\xfb\xf2\x7a\xbf\xae\xde\xc4\x0a\xf5\xd5\xf5\xc4\x6b\x95\x02\xfb\x06\x69\xe1\xda\x78\x06\x31\x38\x03\xbd\x31\xf0\x6e\x57\x99\xb9\xb1\xa4\xd9\x9c\x03\x83\x41\x2c\xea\xa8\xdb\xcc\xec\xf9\xe5\x1c\x15\xb4\x69\x09\x97\xb5\x40\xa3\xbb\x0a\x17\x9e\x8b\xf4\xdc\x28\x03\xcf\x5f\x6c\x14\x66\xb7\xdd\x02\xf7\x06\xb7\xd4\x42\xfe\xe6\xbc\x2f\xf8\xab\x08\x40\x0d\xf8\xc9\x07\x6c\xca\x9c\xdc\x40\xeb\xbd\xa2\x36\x26\xe1\x6c\xbe\xa3\xd3\xe5\xbd\x4a\x6e\x93\xc2\x9e\x7a\x85\x38\x7b\x6a\xd8\x6c\x29\x86\x0e\xfd\x8c\x0e\x46\xe4\xad\x8a\x6f\xdd\x5a\xc5\xf1\xb5\xc2\xb3\xb4\x82\xf2\x39\x5a\x13\xe2\xa6\x71\xa3\x57\xe2\x68\x38\x3a\xf6\x8e\x36\xc0\xd2\x2b\x82\x4c\x2f\xd8\xfb\xbe\x33\x3d\x87\x97\x50\x81\x9f\x21\x16\x3e\x33\xa7\x7a\xb9\xcc\x9c\x66\x32\x12\x25\x81\xa1\x92\x7f\x88\xa1\xfd\xd0\xa5\xf3\xf4\x5b\xc2\x7c\xe0\xa8\x01\x66\x8b\xba\x27\x78\x73\x7d\xcc\x0d\x4e\xaa\x4e\xb2\x22\x60\x50\xba\xd8\x8d\xcc\x99\x59\x38\x8a\x66\x63\xf8\xa8\xe0\xa3\x0e\x71\x75\x54\x42\x31\x16\x17\xdd\x70\xe0\xaa\x53\x6b\x71\x87\xa4\xd5\xfc\x1c\x61\xfc\xaa\x05\xe0\x33\x5c\xcd\x6a\x53\x6d\xb6\x70\x5c\xd7\x91\xb3\xc1\x0b\xd7\xb7\xc6\x9d\x4e\x70\x3c\x44\x5d\x38\x1b\xd3\x3b\x47\x7e\x12\x8d\x4d\x71\x75\x59\x6a\x50\x46\x59\xc3\x4c\xf6\xa8\x90\x62\x39\xa2\x33\x15\x30\x30\xad\x59\x2b\x25\x67\x81\x6d\x48\x34\xc9\x94\xd9\x48\xbf\x54\x79\xb4\xc5\x0e\x11\xe6\x3c\x14\xaa\x02\xe5\xad\xf4\xc8\x9b\xc0\xf5\x6a\x5e\x49\x7b\x14\xfd\x81\x83\xc2\xb8\xd4\xf5\x52\x45\xb7\xb6\xe2\x81\xf3\x77\x5c\xdb\x67\x96\x7e\x7e\x5a\xb9\x83\x9d\xc5\x26\xf1\x31\xdb\x0e\x49\xa6\x04\xe3\xff\x1f\xb6\xbe\x1f\x3d\x01\x9f\xca\x66\x76\xf0\x53\x0b\x87\xbd\x7a\xf0\xea\x76\x0d\xe6\xad\x7f\x7b\xff\xc5\x05\x1c\x28\x26\xc6\x35\x91\xcb\x86\x05\x76\xe2\x48\xbb\x0b\x8f\x2c\x30\xb8\x58\x4a\xe6\xf4\x4e\x24\x77\x17\xbe\xff\xe5\x8e\x8f\x39\x3c\x0f\x3b\xa0\x77\x63\xb4\x25\x6e\xba\xca\x9b\x35\x55\x55\x2c\xf4\x9e\x4b\xa8\x00\xb4\x40\x5b\x3f\x2a\xd8\xf2\xc2\xf4\xef\x49\x1d\xde\x9b\x1e\x79\xb0\xce\xdf\xda\x52\x70\xeb\xea\xea\x43\xc6\xae\xad\xfc\x23\xe6\xde\xfd\x32\x12\x9b\x4d\x69\xfa\xac\xec\xce\xb6\x8e\x87\x1f\xc8\x25\x1a\x5b\x96\x98\x7a\x8c\xeb\xef\x52\x6c\x4a\xe4\xc2\xb5\x68\xa2\x76\xae\x66\x2d\x04\x6f\xd1\x16\x2f\x68\x3d\x5a\xd5\x25\x7d\x5d\x13\xb0\x84\x63\xfe\xbf\x10\xaf\x60\xd7\xaa\xe1\x4a\x11\x6c\x0f\xfc\x50\x2e\x0e\xb2\xa6\x0d\xa1\xb6\x5a\x01\x64\xc6\x27\x58\x08\x14\x1e\xed\xbe\x36\x31\x56\x8d\x89\xfe\x37\xb5\x8b\xce\x04\x35\xd6\x63\x05\xda\xc7\x80\x4a\x95\xe3\xc9\xe4\x03\xe1\x5d\x7f\x82\xbe\xaa\x0f\x9f\x7c\xb1\xf7\x5c\xd3\x82\xd7\x6c\xd6\x44\x71\xa2\xf5\x86\x95\x3c\x9f\x14\xa5\x6d\x1b\x39\xba\xc4\xe1\x1f\x94\x5d\x93\x0c\x06\x9b\xf8\x37\xc2\xed\x5b\x6d\xb5\x14\x5b\x46\x5d\x87\x69\xea\xfd\x6d\x75\x03\x6d\x86\x76\xab\x5c\x72\xd0\x2c\xa1\x56\x37\xb4\xab\x2c\x95\x04\x4f\x13\x3e\x73\x54\xb6\x64\x8e\x2c\x04\x95\x8a\x29\x49\xbd\x3e\x5e\x6b\x7c\x6e\x4e\x38\x05\x7a\x24\x0a\xcc\x36\xe8\x46\x0b\xa5\x44\xd1\xa5\x43\x05\x33\x25\xf1\x8a\x56\x56\xf0\xd6\x18\xdc\x98\x47\xc5\x65\x5a\x26\xe6\x3c\x3f\x81\x6e\x57\xab\x0a\xce\xa8\x8b\x73\x54\x75\xed\x6a\x4c\xab\x38\x74\x67\xf9\xc0\x41\x31\x9b\x6e\xb6\x45\x70\xdb\x6f\x98\x5d\xb7\xde\x84\x64\x24\x0a\x8a\x33\x87\xa1\x5f\x7c\xf6\x52\xa1\x8b\xa8\xe3\xf1\x98\x6a\x88\x68\x38\x26\x6a\x41\x03\x92\x72\x6b\x71\x24\x16\x96\x7b\xed\xe2\x3b\x45\x22\x67\x5d\xa8\xa3\x0f\x63\xe9\x46\x7d\xdf\xac\xe0\x3e\xe9\xde\x1e\x2f\xdb\xac\xbe\xac\xd7\x66\x57\xdb\xa6\x5e\xae\xfe\x1e\x12\x2f\x66\xca\xc7\x53\x29\x35\xb5\x1a\x60\x1d\xd2\x2c\xdd\x35\x36\xd7\x5b\xd7\x54\xd8\x8d\xa5\x53\x0a\x7e\x3d\x9f\x99\x4b\xfc\xb8\xb4\x27\xe5\xa3\xe8\xeb\x37\x16\xb0\xbb\x0a\x6c\xa6\x9c\xba\x5b\x64\x79\x39\x2c\xfe\x1d\xcf\x9f\xa8\xcd\x8e\xf0\x84\xe1\x7d\x7d\x55\xfa\xda\x94\x43\xd3\xa2\x6c\x39\x03\x68\x56\x14\xea\x53\x54\xbc\x84\x4a\x30\x93\xe0\x6d\xd9\x5a\x9b\x52\xd7\x0f\xd5\x25\x3f\x4d\xc3\x9c\x54\xd7\x80\x76\x63\x5f\x89\x0b\xe7\x26\x7e\x4a\x26\x8f\xa9\x14\x03\x0f\xe6\x78\x1c\x54\x14\xa5\xa6\x9a\xc8\x23\x5f\xbb\x73\xdf\x09\xd2\xc9\xc1\x2c\xe6\xb6\xdc\x68\x08\x58\xef\x9d\xd6\x39\xa7\x95\x5e\x38\xdb\xe6\xef\xa7\xe3\x25\x5b\xea\x27\x29\x9f\xcf\xb1\x4f\x86\x11\x47\xb3\x6c\xe4\x2f\xe9\x28\xe4\xf6\x2d\xae\x50\x94\xa6\x28\x25\x3d\xaa\x4e\x91\xae\x77\xfd\x4b\xf1\x6e\x42\x88\x5e\xe6\xd9\x3c\xe4\x5e\x1c\xb4\x86\x0a\x78\x77\x6b\x5b\x26\x0d\x13\x7c\xd8\x82\x3f\x56\x8d\xcc\x88\x4f\x6c\xc7\x8d\x9c\xee\x7b\xdf\xd3\x45\xab\xc1\x9b\x91\x0a\x75\x53\x2a\x3a\xc3\x98\xba\xda\x30\xf3\xa8\x9b\x46\x11\xcf\x3a\x36\x89\x9a\xdb\x75\x75\xbc\xc6\x59\xa3\xd3\x96\x5d\xc5\x4d\xdd\xd3\xc1\x58\xb4\xbd\x3e\x11\xc9\xd7\x4b\x86\xad\x8c\xe3\x57\x3a\x12\x37\x1d\xcb\xf5\x54\x1c\x61\xa5\x4f\xe9\x0f\x0a\xd9\x24\xc3\x7e\xd2\xe6\x4b\xd5\x65\x60\x75\x85\x5a\x72\x93\x55\x6f\x87\x05\x31\xe1\xd9\x80\x6f\x6c\xe2\x12\xe9\x3e\x7c\x22\x8a\xfe\x26\xad\x9f\x1a\x05\x79\x09\xe1\xe4\xce\x3f\xb9\x07\x77\xdf\x98\xc5\x45\xf9\x5c\x4f\x26\x0a\x40\x34\xf6\xa8\x81\xfa\x9d\x86\x89\xb4\x7b\x37\x43\x59\xdd\xcb\xa3\xba\x7b\x88\x37\xc9\xb8\x6e\x45\x93\xdc\x1c\x8d\x8e\x86\x4e\xe6\x94\x15\x6c\x81\x56\xa9\xd9\x77\x8b\x0b\x41\x29\xae\x89\x69\x21\xad\x29\x4a\xd0\x39\x31\xb3\xb3\x59\x23\xf2\x9b\xb5\xb4\xeb\xa7\xc9\xcf\x9c\xdb\x20\xb2\xe7\x3b\xf2\xcd\xeb\x40\xaa\xba\x99\x0e\x6f\x0d\xb7\xae\xd3\xd0\xb5\x2a\x3f\x68\xb8\x7d\x93\x81\x52\xe9\x4b\xc2\xba\xd8\x24\x58\xb4\x11\x06\x25\x5e\xe9\x9e\xeb\x56\x70\x68\x88\xd3\x60\xf5\xd1\x45\x1d\xb2\x56\xf8\xc3\x0d\xd3\xb7\x89\x83\xc4\xe4\xec\xba\x79\xa4\xad\x37\x55\x87\xf8\x96\x76\x3b\xff\x27\xd9\x4a\xfd\xb5\xdc\xe0\x2a\x4e\xf1\x55\xa6\x87\xc1\xce\xe9\x28\x0a\xcb\x82\x03\x34\xf4\x40\xff\x3d\xbe\x89\x5f\x8f\xf3\x64\x41\xfb\xda\xa6\x57\x42\x62\xc6\xd9\x0c\x8f\x52\x80\xb6\x26\x4b\x5e\x51\x1f\x8d\x96\xba\xe8\x15\x8c\xf7\x42\xcf\x38\x98\x03\x29\xf0\xe4\x07\x8c\x2a\x14\x4e\xef\x23\x25\x5a\xa8\xc1\x2c\xa1\xe3\xc9\xa4\xdd\xeb\xf5\x3a\x7c\x02\x79\xe1\xce\xdc\xc4\x4e\xee\xfc\xab\x81\xdb\xd1\x1b\xcc\x62\xc6\x9b\xea\x8d\xf4\xb8\x41\xc8\xb1\xc7\xa7\xef\xf5\x8a\x6b\xb1\x99\x15\xf4\x81\x4e\x96\x07\xb2\x50\xc2\x24\x2e\x2a\x49\x66\xbd\xbc\xd3\x6e\x92\xed\x6f\xfc\xa5\x63\xda\x15\x2e\xf9\x31\x48\xe8\xb3\x2c\xb0\x3f\x28\x4a\xd4\x30\x10\x83\xce\x9f\x16\xda\xd9\x82\x9f\xeb\x13\xb1\x34\xc5\x3f\x60\xb9\x5c\x78\xb8\x69\x6c\xef\xaf\x4d\x0e\x07\x2b\xf2\xed\x33\x91\xdc\x59\x4d\xe3\x4c\xac\x66\xca\xee\x09\x53\x81\x26\xfb\x62\x16\x27\x73\xd8\x5c\x71\x1d\xf3\xe2\x69\x3a\x86\xb7\xb6\x60\x9a\xe6\x21\x86\xd1\x9c\x66\x63\xf0\x7b\x88\x0c\xcd\x58\xec\xe4\xf1\xed\x0e\x97\x72\xeb\x14\x9e\x5e\x69\x39\x9a\x55\xd2\xd7\x93\xb8\x8c\x45\xf6\x49\xdb\x69\x49\x0f\x9f\xa0\xc8\x2c\xd5\x84\x11\xe2\xd2\xa5\xb6\x58\x01\x79\x4f\x38\xe2\x5b\xdf\x57\x27\xfb\xe0\xa9\xc7\xfc\x2c\xfd\xc6\xbb\x8f\x39\x69\x42\xbf\xb1\xbd\xc7\xf4\xf9\x80\xea\x1b\xfd\x60\x0d\x78\x99\x4a\x9d\xec\x50\x6b\x65\x25\x26\x23\xec\x2d\xea\x65\x62\x57\x59\xe8\xe3\x71\x76\xf0\xf2\x8e\xab\xd4\xb5\x9d\x47\xb7\x1b\xc1\x46\x32\xc8\xdb\x6a\xc2\xc0\xbe\xb1\xe6\x2c\x30\xbf\xa2\xdd\x4d\x1a\x64\x1b\x4e\xf1\xb2\x6d\x9a\x33\x8d\x71\x56\xc5\x59\x4a\x51\xb6\x9a\xd5\x97\xad\xee\x20\x89\xb1\x78\x19\x31\x35\x95\xcb\x5e\xdf\xbd\xe2\x55\x3b\x70\x35\x61\x7b\xb7\xd2\x05\x59\x00\x6f\x3c\x84\x86\xe1\xdf\x50\x82\x5e\x6b\xcf\xac\x65\xc1\x78\xdf\x46\xf9\xa6\x4d\x17\xe3\x37\x96\x9b\xd7\xee\x64\xba\x96\x3f\xeb\x19\xcd\xe3\xa5\x7f\x20\x9e\x80\x37\x54\x44\xa1\x7e\xac\x2f\x50\x48\xfe\x0f\x8e\x77\x0f\x49\xb2\x61\xd0\x29\xf3\xc3\xfa\x68\x99\x57\xb6\x29\xfa\xfb\x1e\xfe\xa1\x43\x3c\x82\x78\x25\xc3\xa5\xb7\x38\x3b\x4a\xe9\xde\x8d\xfa\x5e\x33\xc6\x0f\xf9\x6c\x5b\xde\x60\x07\xdd\xda\xdf\xb0\xb5\xa6\x67\x9f\xb8\xe1\x6a\x11\xc2\x38\xd4\xf6\x41\xb2\x76\x8f\xa2\x56\xd7\xbb\x6a\x47\x6e\xbd\x4b\x69\x92\xe6\xff\x1c\x1e\x25\x46\xaf\xc5\x22\xd6\x8b\xc6\xa8\x16\x01\xb7\xba\xd2\x9b\xe6\x60\x2e\x88\x0f\xdc\xa1\x7c\xf7\x22\x2b\x8a\x64\x84\x5b\xe5\xce\xb2\xe5\x64\x17\x4b\xb5\x94\x76\x13\xed\x8e\x76\x3c\xe2\x6e\x93\x4f\x4c\xab\xf2\xec\x21\xa6\x48\xb7\x22\xed\x07\x7d\x8a\xe2\x3f\x07\x85\x75\x67\x4c\xec\x3f\x8a\xb1\xb0\x86\x2a\x20\xf4\x3a\x90\x94\xf7\x7e\xe5\x33\x31\xa6\xb1\xd9\x0d\x41\x9f\x43\x94\x73\xb2\x00\xdd\xad\x07\x66\x05\x11\x6f\x4c\xed\x9d\xd8\x13\x0e\x5d\x65\x28\x7a\xfa\x58\xfc\xea\x71\x32\xd5\x23\x64\x30\xc7\x10\x9e\x21\x93\xd5\x9c\x91\xe2\x77\xad\x67\xa6\x3e\x69\x5f\xb7\x17\xc4\x34\x66\x0b\x62\x7b\xab\xb9\x7e\x4a\x67\x4d\xf4\xa9\x15\x86\x5c\x7e\xb7\x44\x01\xbf\xb9\x5f\xf0\xbe\xe7\x89\xdc\x37\xc2\xef\x72\x90\xee\x61\x34\x24\x1d\xec\x56\xc1\xe0\x32\xc7\x6e\x3e\x81\xc2\x73\xaf\x87\x6f\x0d\xc0\x7b\x9b\x9a\x35\x14\x6b\xde\xd4\x25\xdc\xec\x21\xab\xdf\xe6\x41\xce\x59\x67\xde\x16\x0f\x1a\xbd\xba\x02\x4a\x7b\x30\x84\x5c\xeb\x60\x76\x11\x6a\xd8\x96\xbb\xb2\x80\x02\x73\x45\xf7\x6e\xfb\x20\xaf\xf0\xa6\x6e\xe9\x04\x37\x6b\xa6\x8b\x2b\xb9\xac\x46\xe2\x37\x1c\xbe\xe0\x6f\xfc\x1b\x92\x88\x12\xf4\xf5\xf5\xc5\xf2\xf4\x85\xb0\x5a\xe7\x2f\x7a\xf4\x42\x63\x8f\x9a\x0f\x5c\xa8\xee\x66\x5c\x3d\x70\xe1\x83\x2d\xe1\xf7\xb6\x4d\x95\x2b\x8c\xeb\x58\xa2\xf9\xcc\x85\x0b\x2e\xfa\xa6\xad\x9e\x78\xb6\xdf\x6c\xdd\x26\xf4\xf3\x5f\x82\x05\xb8\xba\xdc\x70\x40\xc3\x3e\xd0\x8d\x54\xa3\x45\xeb\xeb\xb7\x7f\xf6\x44\x8b\x1f\x10\x73\xf6\x5b\xd7\xa3\x57\xe6\x2b\x5f\xb9\xf9\xd7\x4a\xfd\x58\xec\x74\x4a\xa9\xe6\x9b\x26\x2f\xf1\x5f\xb3\x20\x79\xb9\x58\xb3\x31\x6a\x67\x7b\xb2\xda\x6a\x26\x43\xd9\x11\xae\x4b\xcd\xb5\xff\xb8\x0d\x69\xf5\x6e\xcf\x92\xb8\x54\xf1\xb2\x8e\xba\xe8\x45\xf9\x40\xec\x04\xd5\x9e\xe3\x51\x78\x05\x43\x92\x60\x15\xfd\xa2\xb7\xdb\xa4\x02\x5f\x4d\xb1\x62\x23\xc9\x28\x6f\xfd\x69\x04\x2b\x68\x99\xd2\x3a\x92\x6d\x45\xb3\x22\x20\x5a\xb1\x15\xd5\x8a\x90\x6c\x7e\x25\x91\x5e\xf3\x9e\x36\x09\x60\x1d\x57\x99\x2c\x8c\xf5\xd6\x47\x4a\xa7\x1a\xb6\xa8\xf6\x71\xb0\x0d\x35\x3f\x98\xb6\xc3\xbd\xf9\x95\x5d\xd3\x4e\x1e\x85\x2d\xfa\x19\xe3\xe2\xfd\x4a\x6e\xe7\x57\x2d\xb6\x33\x2f\xc2\xea\x20\xb9\xd6\x4e\x1e\xdf\xc0\xc7\xee\x65\xfe\x16\xf6\xf8\x80\x2e\xce\x25\xc5\x66\x76\xfd\x32\x0d\x9a\x8d\xf1\x2d\xb5\xba\xb8\x0f\xec\xb8\x72\xc8\x00\x55\xa0\x2e\x26\x34\x73\x29\x8a\x21\xe4\xd9\x56\x8d\xdc\x51\x34\x48\x94\xd8\xbb\xb7\xaa\xeb\xb3\xd1\x8f\x91\x39\x66\x0e\xbe\xd3\x3c\x81\xdb\xe9\x3b\x64\x25\x9c\x0a\x03\xa8\xa0\xb1\x0a\x37\x59\xa9\xd3\x5c\xdf\xcc\x55\xb5\xc5\x7a\x80\xc3\x9e\x7e\x92\xab\xc2\x82\x06\x7e\x1b\x6b\x33\xd6\x9e\x26\xa8\x0e\x4c\x8d\x32\xd8\x62\x04\xcd\xde\x2f\xbc\x59\xbe\xbf\xc4\x76\x3b\x53\x43\x05\x7b\xb4\x0a\xf9\x2f\x3f\x5c\x7a\xbb\xd4\x5f\x39\x62\xa6\x35\xb3\x35\xdf\x5f\x7f\xc4\x5c\xe1\x5a\x45\x40\x37\x8d\x19\x3f\x5a\x03\x5b\x37\x6c\x56\xf6\xc8\xd2\xad\x1d\xbd\x26\xb3\xf7\xdb\xf0\xad\x1b\xbe\x1a\xeb\xbb\xfd\x00\x86\xc0\xdb\x27\x71\x3e\x50\x47\xfe\x49\x12\x0d\xb7\x10\x4e\x64\xb7\x3d\xea\xd2\xeb\x4f\xcf\x36\x60\x13\x41\xc2\xe1\x57\x64\x1b\x5e\x10\x87\x54\x8a\xcc\xea\x53\x09\xd5\xec\x43\x4d\x5f\x10\x4c\x5f\x86\x48\xf2\x19\x56\x60\xda\x1c\x43\x4b\x3f\xda\xea\xea\x37\x98\x9a\x89\xbf\x69\xba\x81\xfa\x5c\x57\xb9\xe1\x65\x1b\x44\x76\xc1\x26\x16\x86\x20\x6a\x9b\x53\x0a\xb8\xbc\xe8\x19\x67\xb3\x8b\xca\x4e\x4b\xee\xc4\x36\x62\x36\xda\xae\x06\x61\xe6\x8b\x72\xa5\xcf\x66\x30\xab\xe3\x31\xee\x35\xd3\xef\x80\xa5\xa9\x90\xfe\x4a\x9e\xfa\xe6\xae\x77\xa2\xc7\xd1\xce\xce\x93\x07\xb6\xb6\xc1\x3d\x6a\xeb\x06\x82\x47\x5d\xc9\xb7\x7c\x34\x73\x3e\xd1\x5b\xd5\xd3\x3e\x11\x67\x3d\xcc\xbb\x1e\x3b\xdc\xf4\x2c\x9e\x6e\xe9\xb1\x7d\xf1\x83\x75\xbb\x93\xfc\xb2\x04\x4b\xf6\x8f\x96\x5a\x09\x19\xed\x1f\x3e\xb3\x12\x76\xe8\xb7\xc4\xca\x16\x89\x95\x90\x68\xbf\xe5\x55\xfe\x52\x79\x95\x90\xb2\xdb\xa5\x55\xe4\xa1\x57\x95\x64\x01\x2d\xae\x80\x87\xc4\x51\x5f\x3c\x87\x79\x63\x27\x2e\x99\x14\xb6\xea\xaa\xcc\x57\xa2\x2c\x95\x9b\x15\x5a\xd6\x1d\xb3\x82\xa5\x56\x63\x5a\x7f\x64\x6c\x0b\xfe\xe1\xb5\xa8\xb7\x54\x3b\xd3\x2a\xf5\x9e\xb6\xc2\x99\xa3\x85\x6b\x66\x22\xb0\x8c\x96\x29\x41\xe8\x6a\x39\x5b\x35\x2c\x18\xc0\x4a\x2f\x59\x54\x2e\x14\x65\x24\x2a\xec\xf0\xcf\x90\x34\xda\x82\x1f\x36\xa6\x8c\x1a\x4b\xea\x13\x2e\x96\x2c\xc4\x09\xf7\x68\xc0\xbe\x64\x43\xb6\xbb\x2b\xf7\x1b\x40\x89\x60\x68\x5b\xc2\xbe\x2d\xa7\x05\xd3\xe5\x8d\xac\xe6\x33\x1b\x15\x96\x6b\xf3\xdc\xc0\x70\xf5\x2c\xf7\x2b\x99\xce\x7f\xf3\x8d\x5f\x14\xc8\xef\xf4\x2a\x0a\x89\x80\xd5\x8d\x37\xb7\xe5\xdd\xfc\xa6\xca\xb8\xbf\x65\xed\xfe\x21\x33\x39\xa1\x7c\x7e\x72\xd2\xae\x92\xce\x31\x42\xd4\x0d\x8f\x01\x64\x29\x68\xb6\x99\xdb\x5a\xcc\xdf\x32\x7a\x7f\x3b\x3e\xd8\x26\xa1\x17\x16\xd0\x03\x98\x17\x31\x6c\xc5\x1c\x26\xd7\xdb\xa9\x1e\x7f\xf6\x4b\x78\xe4\xb7\x9c\xe1\x5f\x81\x27\x7e\x75\xca\xb0\xea\xc9\xfd\xca\xf1\xfd\x2d\xb9\xf8\xd7\x1d\x67\x7f\x83\xd4\xbc\x76\xa0\x6b\xb7\x3a\xcd\x57\x8d\x09\x84\x3a\x9e\x00\x78\xdc\xf9\xf4\x57\x89\xfe\x76\x59\xcb\x39\xbc\x14\x90\xfb\xe7\x48\x5b\x3e\x4f\x77\xb9\x3f\x2e\xab\xf2\x4b\x8a\xa3\x08\x1e\xdb\xfb\x45\xe9\xca\x6f\x19\x83\x5f\x9c\xaf\x6c\x3a\xd4\xeb\xef\x32\x7d\xc4\x9d\xfd\x67\xca\x1f\x55\x7a\xf4\x5b\x02\x69\x8b\x04\x52\x85\x6a\x5b\x64\x90\x90\x60\xca\x26\x72\x43\xaf\xc9\xcf\x5f\x6b\x85\xa9\x4c\x48\xf7\x93\x4b\xf3\x7a\x80\x74\xbf\x2b\x72\xbd\x66\x61\xdb\xbd\xd5\xa5\x75\xf2\xe6\xab\xd3\x40\x70\x7f\x71\x7e\xb8\x36\x43\xec\xad\x3a\x13\x53\x0a\x5d\xb3\xfa\xee\xb7\xf4\xd9\x3a\xbe\xfa\x95\xf9\x33\x7d\x78\xfc\x6f\x79\xb3\x7f\xb4\xbc\x59\x13\x23\xfc\xfd\x25\xce\x34\x8b\xfd\x96\x30\xfb\x2d\x61\xf6\x7f\x21\x51\x52\x11\xcc\x5f\x56\xe6\xe6\xf6\xd6\xaa\x17\xa6\xea\x55\x23\x21\x61\x42\xcd\xee\xd7\xe5\x7c\x8b\x3a\xb7\xa1\xba\x45\xd7\x63\x46\xf1\x1f\xc0\x1d\xf8\x2d\x33\xf8\x77\xc8\xf0\xdb\xa4\x06\x25\x5b\xae\xcf\x14\x7e\xba\xa7\x6b\x32\x86\xf7\x4f\xaa\xb9\x85\x06\x81\xb1\x49\xc6\x27\x35\x7a\xfb\x7f\x85\xed\xff\x62\x99\xb0\xdf\x32\x9d\x7f\x51\x1e\xff\xa4\x54\xa7\x3c\x31\xa0\xde\xf1\xfe\x2d\xcd\xf9\xf7\x3d\xc8\x7f\xe1\x3c\x67\x2d\x43\x70\x8e\xf3\xfd\x5f\x31\xc7\x89\x1b\x55\x7f\xd0\x7b\x84\xfd\x93\x64\x38\xff\x15\xef\xe2\x4b\x6e\x12\x75\x1b\x89\x9d\x58\x96\x29\x30\x13\x76\x18\xdd\xd7\x29\xee\x0e\x7d\x9b\xe5\x1f\x69\x90\xe4\xa6\x8d\x71\x6a\xbd\xd8\x58\x5e\xc7\x27\xfd\x53\xa0\xf0\x45\xe6\xd4\x4e\xde\xf0\x1a\x79\xe7\x0d\xc0\x7d\x2b\x4e\x0d\xcd\xd5\x8c\x58\x8d\xf2\xac\x74\xc8\xdc\x90\xb7\x71\x9c\x67\x73\x7d\xde\x54\x52\xb6\x0a\xda\xbd\xd0\x6d\x0e\x43\x5b\x50\xe2\xae\xdd\xf0\x0a\x7a\x0f\xb3\x32\x41\x02\x97\x17\x19\x9e\xd0\xb2\x8a\x8a\x79\xcc\xa7\x3e\xb5\xcf\xff\x67\xf0\x11\xde\x9f\x2a\x74\x8c\xf0\xbd\xdc\x28\x30\x7e\x19\x01\x7c\xc2\x02\x62\x0e\x33\xc6\x8d\xbd\xa8\x59\xda\x5f\x86\xb6\x69\xc1\xfe\x61\x4b\xd7\x31\x0c\x4f\x41\x3b\xd6\x50\x14\x44\xbb\xa1\xd8\x07\x0b\xdc\x8c\x53\x6e\xd4\x31\x05\x94\xb3\x5b\x24\xa9\xee\x20\xef\xc3\xae\x17\xb4\x8b\xa3\xf0\x42\xda\xec\xf2\xe6\x06\x19\xe0\xc7\x29\x68\x44\x1a\x08\x92\xaf\x16\x19\x1e\x6a\x4b\xbb\xee\xe0\x96\x69\x14\x6d\x28\x8c\xcc\x96\x9c\x4c\xae\x36\xd6\x7b\x91\x5d\x41\x83\xf0\x89\x9b\x8a\x62\x3c\x72\x93\xf0\x92\xf8\x1a\xd8\xd7\x4b\xd0\x89\x00\x3d\x34\xe4\x36\xab\xe9\xcd\x00\xd7\x3c\x83\xdf\xe9\x11\x3d\x24\x08\xbb\x06\xf4\xd5\x32\x05\x68\xbe\xc2\x9c\xa1\xee\xd4\x78\x69\xde\x14\x93\x2e\xdb\xf0\xca\x57\xaa\xc0\x4d\x2c\x83\x97\xa2\x9c\xc1\x65\xbd\xd4\xca\xe8\x7c\x24\xa2\xde\x36\x44\x8b\x8a\x65\xf6\x08\x4f\xf6\x88\xf3\xf1\xf5\x8a\xd9\xe2\xa3\x52\x0b\x3c\x51\x7f\xaa\xd5\xe2\x55\xc3\x5e\x29\x35\x14\x66\x7d\x8f\x8f\x58\x55\x5f\x37\x0e\xae\x3d\x12\x22\xb8\x54\x98\xf3\xc2\x85\x34\xea\x03\x87\x50\xa7\x65\xf3\x79\x52\x7a\x39\x53\xc9\x27\x41\x82\x14\x5e\x2f\x32\xe4\x88\xcc\xb9\x45\xeb\xe7\x9f\x69\x01\x7c\x0d\x52\xb4\x61\x68\xfd\xc1\xe9\x86\xb5\x0c\x01\xed\xb9\xe5\x74\xc3\xe8\xc6\x86\x40\x80\x54\xee\x9d\xd8\xb5\x85\xed\xe6\x02\x25\x81\x4f\x49\xc7\x46\x0a\xe2\x38\x18\xf3\xe5\xa2\xdd\xe9\x1a\xc2\x2c\x00\x8b\x39\x04\xc5\x6d\x2d\xb0\x04\x8a\x5b\x2d\x15\x66\x6b\x28\x87\x06\xe0\x07\x8a\x83\xb4\x8e\x19\xe7\x42\x1f\xcc\x2e\xfc\xf8\xb0\xe3\x0f\x49\xeb\xe2\xe6\xbb\xa8\x0b\xf0\xd8\xeb\x1c\x37\xcc\x5d\x2e\xcc\x78\x08\xec\x6e\x69\xa2\x07\xe0\x4c\x7b\x74\x24\x05\x1f\x42\x56\x1d\x95\xca\xf1\xe4\x86\xeb\xc3\x74\xb6\xde\x01\x4f\x27\x55\xea\x46\x47\x3f\xa9\x77\xbe\xd5\x0f\xad\xd9\xe1\xcf\x8e\x17\xd0\x38\x1b\x27\x6e\x87\xcc\xca\xa0\x59\x57\xc1\xaa\xed\xa7\x7a\x23\xdf\x79\xbc\x92\xa7\xb2\xb3\x8a\x43\xd3\x49\x53\x60\x0b\xdc\x5a\x27\xa7\x73\xfd\x4c\x67\x36\x11\x21\x4b\x75\x37\x9e\x1a\xef\x44\x10\xa2\xe4\x5b\x1d\x8e\x69\xec\x24\x05\x1a\x22\x2e\x7c\x27\x96\x33\xa3\x8f\x9b\x3b\x2f\x96\x15\x79\x14\xfb\x08\xd0\x29\x13\x56\x18\x2f\x8d\xb7\x55\xeb\x7f\x51\xa7\xdc\x21\xd2\xb4\x47\x32\x65\xb9\x99\xc1\x32\xa3\x05\x78\x87\x66\x23\x89\x5d\x7b\x1e\x18\x8a\x95\x3e\x9f\xa4\x9e\x06\x2f\x48\x02\x43\x11\x35\x48\xf9\xa2\x6a\xae\x7e\x70\x32\x6b\xb1\x07\xd9\x75\x5d\x84\xc7\x24\x06\x78\xe1\xde\xa6\x38\xf4\x99\x59\xd8\x48\xab\xe5\xae\xd2\xee\x5d\xb5\x17\x5f\x97\xe0\x10\x99\xd9\xc4\xca\x06\x62\x66\xdb\xaf\x8c\x94\xe1\x1c\x4c\x5f\x7c\xa5\x7c\x43\x9f\xa5\xb4\xcd\xf4\x14\xe4\xae\xf0\xa0\x22\xbb\xad\x1b\x9d\x74\xa9\xb7\xa2\x46\x92\xea\x56\xf1\x38\x83\x65\x71\xdd\x7c\x76\x05\xfc\x6b\xb7\x67\x66\x2c\xe0\x1b\x6d\x29\x0d\x5f\xa7\x4b\x90\x1a\x55\xc1\xab\x76\x10\x04\x33\xe2\x1b\xbf\xe7\xf6\xbc\xfd\x27\x72\x31\x1a\x92\x32\x3c\xb9\x88\xf7\x6b\xa8\x59\x85\xfe\x11\xcc\x73\xbb\xd5\xaa\x0d\x3b\xd8\xaf\xb1\x87\xbc\x22\xd9\x88\x30\x1a\x7d\xdd\xcd\xad\x3a\x91\x2d\xaa\x7d\x68\xec\x40\xb6\x68\xff\x0a\xe4\xff\xdf\x52\xe1\xc6\xe3\x0b\x4f\x30\x40\x03\xf0\xd9\x3b\x46\x42\x1e\xd8\x93\x83\x62\x72\xb4\x28\xb5\xa9\xf7\x46\xd7\x3c\xd9\x35\xd3\x8c\xd4\x08\xde\xa7\xde\xd3\x41\x6c\xd2\x69\x72\x00\x74\xcc\x8a\x3e\x9b\x80\x5f\xa9\xed\x86\x36\xce\xbc\x1b\xfa\x74\x86\x23\xd4\xc1\x1d\xe2\x08\x66\x06\xa4\x20\xc7\xb1\x20\x01\xa7\xcc\x6c\xe0\x8c\xa1\xdc\x17\x0a\xec\x03\xba\x8d\xfa\x88\x64\x72\x28\xc0\x41\x78\xf3\x87\xef\xd8\x55\xd4\xde\x02\x36\x85\x3d\x94\xde\x1a\x0d\x06\xbc\xaa\xdd\xba\x56\xd0\x28\x52\x2c\xbc\x11\x55\x2f\x02\x62\x2d\xf0\xaa\x67\x13\xbe\x85\x77\xff\x70\x8d\x7e\x66\x8c\x9b\xc5\xd1\x9e\x82\xd0\x77\xb0\x7b\xbb\xb3\x84\xce\x27\x42\x5c\xcd\x6e\xed\x06\x3d\x7e\x63\x44\xed\xbc\x4b\xf5\x2a\x23\x74\x59\xb1\x39\x06\x2b\x04\xdc\xbb\xd4\x40\x6e\x12\x32\x37\xb8\xb8\x15\x9e\x3f\xb4\x1b\xf9\x91\xd8\xa1\x4e\x9e\xdc\x96\xaf\x5a\x31\x79\xb5\x2b\x56\x5b\x3d\xc2\x5d\x5e\xe8\xc0\x42\x6f\xa2\x20\x54\x69\x1e\x07\x3f\xb2\x8f\x48\x76\xfd\x9e\x50\xd1\x4c\x28\x78\x05\x9d\x08\xe2\x14\x72\xdb\xdd\x0e\xf9\x7f\x75\xb2\xcc\xd2\x2d\x09\xe3\x7a\xac\x39\xda\x9d\xa9\x22\xcd\x43\xbb\x4a\x84\x60\xea\x8e\x7a\x89\xbb\xb5\xeb\xa6\xa5\x8e\xdc\x06\x6d\x26\x53\x45\xb3\xb8\x33\x2a\x7c\x94\xc5\xb2\xb0\x26\x64\x0d\x7c\x93\x99\xaa\x4c\x40\x17\xda\xff\x44\x3b\x57\xe6\x4b\x3c\xc1\x53\x58\x6e\x3a\x1c\x96\x0f\x65\xbd\x56\x39\x66\x41\x20\xfc\x26\x39\xad\x8b\x66\xcc\x08\xff\x50\x68\x77\xc6\x73\x01\x2a\xde\xae\xf6\x47\xf5\xd1\x50\xe4\x1f\xfa\xa7\xa8\x63\x5b\xbc\xbf\xe0\x0c\xb3\xae\x49\xa9\xa7\x77\xea\x91\xb5\x09\x1a\xd7\x20\xa6\x72\x30\x88\x87\xcb\x94\xa5\x11\xce\x96\x75\x84\x89\x5f\x9d\x13\x0c\xc3\x57\x5e\x67\x93\x82\x76\xbf\x04\xeb\x01\x63\x99\xaf\x08\x86\xb8\xd2\x3a\xc7\xd8\x9c\xe6\x51\xfb\x42\xab\xb6\x30\xd9\xf2\xed\x0a\xe9\x53\xe8\xdd\xb0\x6a\xe9\xd5\x6e\x69\x20\xa7\xa6\x22\xf3\x9c\x9f\xb6\x06\xa3\x20\xcb\x59\xd8\x9d\x7d\x68\x66\x13\x5f\xab\xb2\xd0\x39\x1b\x3c\x78\x1a\x89\x7d\xc7\x5f\xa1\x13\x30\x68\xea\x0e\xb7\x11\xb7\x67\x91\x55\x0e\x03\x1a\xf4\x45\x63\xbc\xeb\xa7\x8d\x9b\xcc\xc6\xdd\xe6\x30\x9d\xf1\x5d\x17\x44\x17\xda\x7e\x0c\x8f\xdd\x1b\xcd\x7b\xbf\x0e\x7f\x43\x5c\xd9\x05\xd6\x9f\xe0\xe0\x85\x5d\xc1\xed\xaa\x28\x1e\x8d\xda\x18\xe3\x03\x71\xc7\x38\x08\x78\x92\x58\x86\x59\x05\x72\x9a\xf1\x88\xb8\x5d\x45\x9e\x10\x33\x1a\xee\xc9\x8d\x9b\xbf\x8a\x96\xc0\xf4\x33\xc7\x01\x01\x46\x6a\x8a\xa7\xc7\x52\x29\x8e\x0c\x9a\x8d\x1c\xf1\xbe\xef\x54\xe5\xc5\x97\x1b\x33\xe8\xd8\x73\x97\x31\x7b\x18\x45\x7e\x2b\x78\xba\xf8\x79\x94\xd8\x76\xee\x2b\xe4\x01\xcc\xbe\x8e\x8b\x64\x1c\x85\x49\x1d\xbb\xbd\xad\xa0\x21\xb0\x1c\x7e\x69\xb7\xc0\xb3\xd8\xe5\x74\x1d\xd8\xa1\xf5\x44\x14\xd8\x58\x87\xe4\xa1\xbb\x69\x8e\xab\x4b\xe8\x38\x7d\xdc\xb9\x13\x45\x27\x4e\x66\xfa\x04\x34\x44\x85\xfc\x7f\x92\xc4\xa2\xcc\x16\x11\x9e\x02\xd8\x73\x2d\xe8\xd0\x9f\x9f\x7e\xf6\xff\xda\xee\x75\x8c\x61\x57\xb0\xe2\x2e\x4f\x38\xfb\xef\x1f\xea\xf0\x08\xa7\xb9\x13\xd0\x4e\x63\x3d\x4a\x58\xb9\xa4\x43\xd6\xd1\x8a\x5c\x07\x1b\x7d\xb2\x50\x56\x91\x40\xf0\x76\xc7\x91\xbb\xe3\x11\xfa\x75\x4c\xc7\xec\x55\xf2\x67\x6b\x49\x4d\xd0\xbb\x9f\x44\x70\x64\x94\x42\xcd\xa6\xda\x6e\xfa\x1d\xa6\x05\xb4\x26\x39\x1d\xaa\x7a\x03\x54\x47\x57\x6c\xd1\xa7\x2b\x5d\xf1\xe8\x5a\x7d\x3c\xa0\x88\xc7\x7b\x9a\xfe\x7f\xc0\x74\xf6\xa0\xdf\x9f\x73\xbc\x49\x67\x3a\xe2\xd0\xc7\x98\x81\x8f\x74\x91\x85\xd5\xa6\x78\x80\xa3\x49\xa2\xaa\x3b\xa2\xa8\x18\x87\x9a\xf2\x81\x2e\xb6\x1d\x8c\xfa\x46\x96\x34\x6c\x40\x16\xc7\x85\xd0\x78\xee\x10\xa6\xe4\xb8\xbe\x73\xdf\xe2\x2c\x8e\x6e\x0f\xf8\x5a\x67\x13\xec\xe1\x81\x10\xc6\xe0\x61\x17\x48\x96\x3d\x64\x73\xbd\xf8\x3b\xed\xea\xa4\xa2\x38\x9d\xd3\xc5\xa7\xd4\x1c\x67\xff\xa1\x73\x74\xd0\x51\x95\xf7\x72\x74\x6b\x0b\xea\x7e\x7b\x5f\xf7\xb8\xc2\x85\xce\x99\xad\xb8\x3d\x68\x01\x5e\xd6\xed\xf7\xe9\x8c\x63\xbd\x0f\xc1\x99\x43\xe9\xea\x98\xa6\x74\xbe\xdf\x58\x44\xb4\x8f\x14\xf6\xeb\x27\x2d\xe3\x9a\x11\x11\xf7\xc8\xe9\x73\x3f\xe5\xd4\xa4\x45\xf4\xdc\x21\xad\x77\x4f\x35\xd6\x01\x0c\x29\xa5\x4b\xf4\x0c\x01\xbe\xb8\xe9\x39\x7d\x57\xcb\x9b\xde\xde\xb3\xea\x4a\xe8\xfb\x16\x7e\x92\x14\x58\xba\xb1\xf6\x19\x01\x63\x9f\xbb\x02\x06\x5d\xf7\x8c\xbe\x1f\xc2\xeb\xa3\x40\xd6\x3e\x83\x30\xf6\xb9\x52\x5f\x70\xe5\xc2\xf6\xf2\xb7\xf1\xe2\x83\xad\x70\xa0\xab\xd6\x36\xe2\xe5\xe8\xc3\x07\xfa\xfd\xe1\xc3\xe3\x86\xf7\x39\x70\x9e\x8d\xae\x87\x32\x6e\x08\x44\xe7\x5c\xa6\x0b\x6f\xf2\x0e\x2e\xc2\x0b\x9e\x07\x48\x9d\x04\xa6\xab\x67\x30\xd7\x5e\xd7\xa4\x73\xf5\x0c\xd7\xb5\x5a\x45\xb7\x4a\xe4\xd7\x9b\xd9\x54\x60\x65\xb6\x90\xf4\xd2\x1e\xc4\xeb\xb4\xb7\xfc\x5a\x8f\xf2\x8d\x33\x02\x2c\xb4\x8b\x84\x03\x54\xf4\xad\xc4\x2b\xcc\x04\xdf\x8a\x37\xb9\x27\x07\x60\x2d\x7a\x8e\x0d\xbd\x3c\xd9\x4b\xde\x94\x1c\xbe\xf9\x29\x24\x8a\x25\x54\x70\x66\xb4\x19\x63\x79\xb0\x54\xeb\x62\x49\x1b\xa6\x97\x5a\x9c\x79\x67\x72\xdc\x7a\xd6\x3c\x6e\xab\x5f\x4a\x7e\x7f\x53\x52\x52\x67\x24\x1b\xb0\xb2\x7e\xbe\x41\xe2\xad\x01\x7c\xaf\x05\xda\x83\x20\x0e\x65\xf6\xc0\x9f\x61\xc1\xf2\x94\xa2\x71\x3c\x32\x8d\x04\x69\x62\x7d\xa5\x26\xf2\xf9\x52\xf9\x8f\x4b\x42\x99\xe5\x6b\x5d\xc8\xde\xbb\x37\xf6\xc0\x07\x9d\x55\x0f\x7e\xf9\x46\x95\x35\xdc\x4b\x14\x31\x47\xe0\xa1\xcd\x41\xec\xff\x62\xdc\x5c\x67\x4f\x2c\x4d\x43\x73\x32\x51\x45\x92\x8b\xb1\x74\x5b\x3b\xd7\x21\x6d\x36\xfb\x26\xdb\xa6\x9f\xa2\xc8\xc1\x6e\xb1\xad\x83\x8a\xdb\xb8\x70\xc7\x03\x44\x3c\x43\xba\x8e\x55\x9c\x22\xae\xb0\x89\x97\x9c\x6f\xe0\xe6\x2a\xcd\x53\xed\xb0\xd4\x28\x30\x8e\xbc\x6a\x33\xf3\x7f\x1b\xb5\xe2\x5b\x91\x20\xbc\x0f\x3b\x4a\x42\x59\x29\x07\x73\x1b\xeb\xe3\x69\x03\xb1\x0c\x99\x0d\x5f\x75\xa3\xc5\xd2\x38\xc9\xca\x9d\x42\xc0\x71\x9d\x89\xd4\xa9\xc0\x3c\x4b\x4b\x75\x57\x7a\xe1\x20\xe7\x69\xb0\x20\x43\xc4\x84\x05\x88\x3e\xa1\x8a\x41\xaf\x8b\x04\x2d\xad\xf4\x12\x9c\x54\xa7\x13\x47\xca\x1e\x19\x6e\x27\x6f\x19\xc7\x56\x61\xe3\x6b\x4d\x5f\xf6\xae\x98\x87\xdc\xb1\xc8\x85\x75\x34\xbd\x49\xa0\x64\x7c\x4d\x81\x1e\xbc\x40\xc7\xec\x13\x1a\x81\x3c\x5b\x5e\x5d\x9b\x5c\xa1\xe9\x95\x9e\xe9\x8b\xa2\x4b\x68\xca\xb8\xa8\x22\x89\xf8\xed\x2a\x30\xa3\x1b\x22\xea\x20\xe4\x2d\x36\xc5\xbc\xda\xef\xf4\xd1\xd1\x47\x07\xb7\xf0\xb1\x96\x1b\x9b\x92\x39\xc9\xc4\x47\xe6\x6c\x69\x2e\x2a\x31\xc3\x65\x03\x73\x1d\xc6\xcb\xd3\xdb\x83\x67\xaf\x48\xfb\xd4\x44\xf4\x4d\x53\x85\xe3\x3b\x12\xf0\x00\x59\x1c\x04\x37\xa7\xd5\xab\x7b\xd0\x72\x88\x9b\x65\xd4\x45\x07\xc8\x80\xa8\x70\xb8\xfc\x50\x9f\x09\xac\x6b\x10\xb3\x54\x52\xb5\x8e\x89\x75\xce\x98\x9f\xc5\x10\x01\xf8\x89\xcf\x9d\xd7\xb4\x61\x0e\x9b\xca\xba\x1d\x3e\x36\xa0\x90\x9b\xd6\x9b\x23\x39\x02\xa6\x58\x23\xa3\x1e\x3b\xd4\x1d\x37\x8c\xc3\x6e\x7a\x1d\x2e\x18\x46\x96\xf7\xef\x71\x0f\xdf\x7e\x44\xbb\xdb\xa6\xfb\xc8\x54\x5f\xc1\x27\x5e\x7b\x6c\xa1\xe1\x57\x25\x95\xfa\x5a\xab\x1a\x5a\xd3\xa6\xe5\x85\x33\xea\x86\x8e\x38\x59\x5a\x09\x0d\x4c\x1e\xdf\x0c\x7f\xb0\x91\x95\x89\xda\x9c\x82\xc3\x03\x56\x77\xb3\x05\xcf\xb2\x05\x12\xcb\x59\xed\x3f\x2d\xc1\x56\x60\xb5\x0c\x10\xf8\x63\x82\x47\x8a\x4e\xf9\xf6\xee\x6d\x32\xd1\x39\x33\x9d\x09\x4f\xb8\xa4\x60\x31\x8b\xf9\x68\x82\x89\x9c\x5e\xa0\xa9\xde\xa9\xce\x0c\x53\xd9\x36\x7c\xa2\x29\xd7\xc3\x54\xab\xcd\x28\xf8\x63\x30\x3d\xf8\xd8\x54\x4c\x09\xa0\x04\x49\x83\x8e\x22\x4e\x24\x92\x7a\x37\xe7\xab\x11\x35\xa8\x47\x98\x89\x75\x13\x98\x22\xa9\xc1\x73\xce\x24\x5e\xee\xbd\xf6\x80\x13\x66\x33\x70\x65\xc6\x71\x4e\xd3\x67\x98\xec\x23\x13\x80\xf5\x29\xe6\xbe\xd6\xfa\xc8\x03\x46\x4e\x73\x35\xd7\xec\x4f\x18\x99\xbe\x0f\x53\xce\x50\x45\x4a\xcf\xd5\x41\xf8\x48\xbf\xcd\x80\xd4\x74\x9e\xb3\x21\xf0\x1a\x80\x9b\x2f\x32\xdc\x7a\x9f\xa4\x50\xa8\xb4\x2e\x0a\x01\x0c\x5a\x8b\xe7\xf9\xf0\xb5\x17\xdf\x7d\x0b\x23\x3a\xd1\xc7\x19\xc1\x08\x8c\x97\x73\xda\xb4\x7f\x8e\x51\x7b\x81\xb3\x76\x38\x7f\x07\xf2\x58\xda\xce\xeb\x08\x5b\xad\x5a\x74\x70\x5a\x69\x27\x8f\x4a\xca\xf3\x44\x5a\x9d\x91\xa9\xeb\x9a\x0a\x39\xb8\x30\x8f\xf2\x98\xa2\x70\xac\xc8\x61\x66\x59\xf2\xba\x85\xb9\x7f\x80\x11\xb6\x39\x06\x6f\xa0\xd4\x63\x9d\xe4\x3c\xa6\xa2\x0e\x4e\x87\x0f\x20\x81\x23\xac\x1f\xa2\x84\xb2\x9a\x62\xff\xaf\x91\xe7\xa8\x26\x0b\x87\x4f\xfb\x1f\xf2\xe0\x27\x24\xae\xdb\x03\xcd\x29\x8a\x78\x84\x61\xbe\x1b\x95\x89\xab\x2e\x91\x6a\xed\xd7\xa8\xc4\xad\x14\x49\x8d\x5d\xd9\x5a\xd0\x27\x34\xed\xba\xcb\xec\x41\x42\xff\x37\x94\x72\xf9\xe6\xed\x64\x9c\x3c\x02\xbd\xf6\x62\xa9\x0b\x4d\xf8\xa4\x2a\x3c\x4c\x2c\x05\x13\x0e\xcd\x8e\x32\x18\xc6\x7c\x81\xc5\x67\xdc\xf2\x5e\xa9\x40\xcc\xf0\x4c\x16\xae\xc5\x4b\x59\x9a\x70\xbe\x52\x3b\x0e\x66\xc8\x8b\xbf\xc2\x98\xd7\x97\x37\xdd\x9b\x69\x3f\xf6\x7d\xe9\xab\x57\x87\x83\xd3\xb2\xe3\x6c\x4e\x47\x45\x6b\x73\x66\xbd\xe9\xbf\x1a\x37\x6d\xcc\x9b\x7f\x12\x63\x65\x45\xc9\xe3\x8b\xf4\xdf\xc5\x01\xf8\x8d\xb9\xfe\x2f\x33\x17\xf0\xc3\xd6\xdc\xc5\xaf\xc7\x5c\x2a\xd6\xd7\xa6\x25\x1f\x18\x28\xeb\x01\x13\x3f\x44\x11\xac\xa5\xcf\x25\x34\xe6\x93\x72\xfc\x79\x69\x2b\xff\xd6\x65\x65\x6c\xf0\x40\xb4\x90\x26\x06\x67\x72\x6c\x79\xb6\x9d\x0d\x24\x7b\x0d\xc6\x03\x0c\x54\x25\x4c\xae\x7d\x91\xce\xc2\x3e\xa5\xc2\xcf\x37\xbe\x5b\xc2\xd5\xa0\xce\xc5\xad\xf8\xb1\xbd\x8d\x51\x38\x57\x7b\xbb\x58\x3c\x11\xd3\x0f\x5d\xb2\x93\x5c\xcf\xaa\x23\x38\x39\xfa\x1a\x09\x93\x35\xa8\xd6\x5f\xd5\xf3\x5a\x57\x0f\x55\xe7\xde\xcb\x71\x78\xeb\x3c\xed\x6b\x6c\x59\xbc\x5f\x6b\x48\xd6\x36\xb2\xf1\x9e\x9e\x91\x89\xa3\x57\xa6\x32\x42\x7b\x2c\x54\x2c\xe8\xb0\x0e\x78\xb2\x1a\x7c\x57\xe4\xa6\xca\xa4\x61\x82\xc0\x8d\x4e\x63\xf6\x86\x7c\x6f\x62\xd3\x48\xab\xb2\x35\x63\xe8\xcf\x4a\xd3\x82\xca\x87\x7b\x0f\x64\x9e\x9b\x59\xe1\x5c\xf0\x05\xef\xc2\x2a\x5f\xd0\x30\xac\x35\x23\x5a\x33\x94\xf2\x8d\x96\x59\xce\xfd\x94\x96\xf7\x36\x7d\xc2\x65\xcd\xeb\x3e\xe5\x55\x26\x77\xe5\x75\x4d\xa4\xe8\x1f\x45\xad\xb7\x32\xb5\x86\x17\xde\xb7\xcc\x0e\xb4\xe1\x32\x61\x2a\xeb\xf1\xb8\xa6\x27\xfb\x24\x0b\xec\xe4\x6f\x2f\xc7\xf1\x8c\x4a\x91\x95\x2f\x4f\x32\xd1\x30\xb6\x9b\xf5\x56\xd3\x6b\x01\x2f\x76\xa5\x5a\xa1\xb2\x81\x86\xf2\xce\x1a\x4f\x15\xbb\x82\x53\xc4\xdb\xa9\x8d\xad\x55\x7a\x73\xe6\x14\xbf\xcb\xb5\x1c\x7e\xb9\x2a\xb7\xa6\x2b\xcc\xec\x7a\x63\x1c\x03\xce\x69\xa1\xf3\x8f\x67\x71\xba\xfa\x2c\xc0\x14\x37\x0f\x58\x9f\xc4\xef\xf9\x93\x3e\x76\x84\x7a\xd8\xd8\x4a\xbf\x95\xf9\x81\x37\xe1\x6d\xfc\xf3\xd6\x18\x09\xfd\x4c\xa9\x29\x3b\xbe\xd3\xab\xd3\xec\x9a\xe7\x3b\x79\x7a\x9f\xba\xb3\xa3\x55\x93\xb0\x63\xb2\xd2\x25\x53\xba\x6a\x0e\xf2\x13\x45\x2f\x6e\x92\xd3\x14\x79\x91\xc2\xc8\xe3\x84\x34\x94\xd8\x1c\x99\xb3\xb6\xea\x4e\x1e\x93\xac\xee\x7a\x45\x69\x17\xc5\x84\x57\x25\x76\xb4\x14\xc9\x3f\x08\xd9\x7b\xad\x79\x46\x97\xf1\xbd\x4b\x5b\x1d\xb1\xe4\xbb\x72\x02\x72\xed\xb3\x9d\x60\xd5\xb6\xd7\x3f\x33\xbf\x89\xdd\xfb\x60\x06\xe7\x72\xf8\xfc\xc5\xb3\x8b\x2e\x04\x46\xf0\x82\xea\xee\xc5\x3f\x68\x27\x69\x7c\x9d\x65\x85\x0a\x8a\xfb\x79\x09\xc8\x32\xe5\x70\x4d\xc6\xe8\xc5\x0c\x17\xce\xcc\x56\xd1\x3c\xa3\x63\x81\xd3\x1b\x95\x62\x75\x72\xd5\xb0\xb2\xc5\x2e\x54\x63\x0d\x50\x43\x31\x76\xbb\xb3\x41\xa8\xee\xe5\xc4\xa3\x55\xe1\x76\xf1\x4a\x4d\x16\xd7\xd8\x1c\x23\xd5\x0d\xae\xd2\xd0\x1a\x25\xaf\x1e\x9e\x16\x9b\x18\x19\x2d\x8c\xa9\x13\xbe\xa6\xb0\x90\x48\xc4\xf5\xc9\x4a\x3c\x41\x2f\x9d\x24\x37\xc9\x64\x19\xcf\x44\x81\x50\xb3\xf0\x07\x05\xea\xa2\xb3\x6e\x82\xd6\x33\x01\x82\x04\xe1\xb2\x04\x9b\x45\xab\x5a\x16\x71\xee\xbf\x12\xf3\xba\xb2\xf1\xd7\xd7\xe0\xe3\x82\x16\xb6\xd5\x76\x7e\xeb\xad\x42\xd7\xdf\xc9\xa6\x79\xad\x83\x68\x12\xaf\x54\xcd\x96\xb1\xf5\x66\x08\xb6\x2b\xff\xf7\x17\x20\x70\x6b\xd7\xd9\xad\x8d\x17\xa8\x00\x9c\x0a\xc5\xec\xc2\x83\x86\x15\x07\x7a\x26\xd4\xc7\x7d\x8c\x65\xbc\xf0\xf1\xf3\xcf\x66\x61\xaf\x6f\xd8\xf5\x7c\xa8\xc3\x80\xb3\x25\x78\xe6\xe5\x32\xe5\xfd\x88\x30\x2d\xb1\xcc\x2b\x2d\x9b\xcb\x91\x3d\x27\x6f\xab\x96\x99\x23\x83\xb6\x16\xde\x74\x69\x48\x57\x3a\xb9\x59\x12\x18\x18\x20\xa7\x62\x79\xe0\x44\xdc\xb4\x41\x67\xf9\xaf\xe3\x02\xd7\x30\xd2\x76\x1d\x1a\x24\x5a\xd1\xe9\xa1\x9e\xd3\x83\x77\x2e\x62\xaa\x27\xc0\x87\x1b\x5e\x08\xee\xfd\x3c\xc1\xd3\xa7\x15\x0c\xe7\xa4\xb0\x49\x24\x87\x45\x89\x9b\x8e\x88\xd2\x0c\x89\x0e\x37\xe6\x70\xb2\xdb\x13\xd5\x20\x34\x59\xe6\x1c\x7a\x36\xe1\x23\xea\xba\x7d\xd3\xeb\x11\xc0\xc3\x4d\xbf\x56\x53\x81\x9b\xc2\x37\x03\x23\xa5\x6e\xd5\xe6\x04\x30\x02\x55\x47\xc1\xa4\x19\x4e\x17\xa9\x92\xaf\x80\x5b\x25\x99\x25\x20\xe6\x0d\xdc\x9c\x5c\xe3\xe1\x71\x1c\x6f\xed\xa3\xfd\x95\xba\x3e\xbd\x5c\xce\x47\x1c\x5a\xce\xe3\xbb\x64\xbe\x9c\x3b\x16\x8b\x7c\x49\x72\x15\x59\xb7\x66\x16\x01\xda\xa3\xa7\x13\x2d\x2b\xa0\x77\xc7\xd7\x2c\x22\xd3\xa8\x8f\x04\x71\x6b\x29\x5c\x22\xd4\x98\x86\x42\xe9\x65\x7e\x3a\xa1\x5a\xe0\x6b\xba\x58\x26\x97\xea\x21\x9b\x72\x18\x8f\x18\x05\x1d\x03\x64\x2f\x1d\xcf\xf7\x83\x71\xca\x97\x8a\x47\x41\xac\x1c\x8a\x78\xda\x08\x48\x38\xc3\x89\x9d\x71\xbc\xe4\xe5\x99\xa0\x77\x97\xa9\xba\x5b\x30\x2a\xc8\x5f\x49\x8d\x77\xbe\x88\xd3\x64\x8c\x6a\x13\xad\x9f\xf1\x4b\x4d\x01\x83\x29\xbf\xf5\xb4\xaf\xd3\x84\x54\x58\x6f\x8f\xb0\x14\x36\x93\x14\x3f\xcf\x3c\x68\xf5\xef\x96\x4c\x31\x71\x20\x04\xa5\x38\x49\x96\x27\xb9\x14\x34\xfb\x91\xd8\x12\xcd\xe1\x30\x35\xd7\x2a\x7e\x61\x24\x87\x2f\x5e\x7c\x78\xf3\xec\xf5\x9b\xd7\x7a\xe6\xfa\x35\x85\x90\xed\xd6\x17\xd0\x3e\x25\x4b\x8a\x2f\xb1\x2e\xd4\xaf\x97\x90\x31\xb7\x54\x9f\x8d\x71\x7f\xf5\xbd\x8c\x67\x18\x6a\x61\x2b\x62\x5d\x83\x23\x5b\xa5\x5a\x60\xdb\x37\x54\xca\x94\xc8\xc3\x91\x21\x1d\x2e\xbe\x59\xc4\xc0\x9d\x79\xea\x76\x5d\xd0\x17\xf4\xda\x1c\xf3\x0b\x34\x36\xe1\x65\x89\xf6\xe4\x81\xad\xbb\x83\x77\x3d\xa5\x7c\x33\xf1\xa1\xab\x08\xd0\xb3\xaf\x22\xde\x11\xd3\xb2\xba\xe8\xdb\xce\xe8\xfc\xc8\x85\x9e\x3f\x62\xa1\xa7\x06\xb1\x0b\xa4\x7f\x74\x0b\xa4\x45\xb5\x81\x01\x7b\xfb\xa3\xde\x44\x08\x18\xf2\x65\x66\x98\xe4\x56\x61\x7e\x7d\x89\xe3\x15\xed\x7c\x76\x7e\xbe\x23\xd3\xe7\x78\x65\x07\x44\x4b\x82\xce\xd1\x6b\xa6\x3c\x03\x37\x85\x43\xeb\x58\x84\x99\xc3\x6a\x3a\xd9\x96\x9d\xf5\xc2\x25\x65\x3a\xad\xe2\xce\xfe\x60\x2f\xd7\x90\x11\x10\x09\xe8\xe8\x7b\xc3\x06\x4e\x38\xc3\xaf\xd4\xff\x27\xef\xdd\xf7\xdb\xb8\x91\x84\xd1\xff\xfd\x14\x6d\xef\xb7\x43\xd2\x26\x29\x92\xba\xcb\x51\xb2\x14\x45\xc5\x9e\xf8\xa2\xb5\x64\x7b\x77\x14\xc7\x69\x91\x2d\xa9\xd7\x24\x9b\xcb\x26\x2d\x6b\x12\xef\xef\xbc\xc6\x79\xbd\xf3\x24\x07\x75\x03\x0a\x7d\xa1\x28\xdb\x99\xd9\x99\xcf\x33\xbf\x48\x42\x03\x05\xa0\x00\x14\x0a\x75\xbd\xec\x7f\x9a\x6a\x6e\x18\xcd\xd3\xb9\x26\x6e\x14\xdc\x1d\xf6\x35\x5b\xab\xa9\x07\x04\x0c\x2c\x9e\xa8\x18\x45\xc4\x1e\x8b\x11\x88\x7b\x02\xdf\xdf\x0f\xbc\xad\x50\xd2\x5c\x33\xcb\xac\xa7\x95\xdd\x2c\x7b\x14\x77\x99\xdb\x15\x8f\x1e\x59\xb3\x34\x56\xbc\xab\x8f\x19\xad\xfb\x88\xd4\x35\x13\xe4\xea\x90\x21\xa6\x73\x6e\x4e\xda\x25\x61\x5c\xfc\x3e\xd8\x23\xd1\x35\x93\x67\x78\x1a\xb2\x01\x33\xb7\x87\x15\x4a\xd0\x67\x1a\x7d\xab\x93\xeb\x32\x0b\x8e\xdf\x09\xd1\x9f\xed\x01\x38\xe6\x9f\x0b\x8f\x20\x79\xce\xba\x48\xe6\x97\x50\x96\xba\xa2\x55\xe1\xcc\x27\x51\xd2\x5c\x9c\x8d\xea\xe4\x5f\x66\x29\x0a\x71\x3e\x9f\xc2\x01\x3e\x0e\x60\x73\x46\x78\x45\x14\xc3\xa0\xc1\x0b\x0c\xec\x50\x36\x34\x82\xa4\xef\xce\x47\xcd\xe2\x40\x6c\x51\x0c\x53\x4e\xa6\x27\x13\x7b\x1f\x82\x92\x8b\x7d\x09\x79\x19\x60\x48\x28\xf5\x23\xae\x26\xb2\x5e\xea\xce\x74\x13\xaf\x1c\xf5\x2e\x58\x9d\x22\x1e\x5b\xc2\x63\x29\x56\x8e\x38\xe5\xa8\xcd\xbd\x62\x5b\xf1\x5b\x2d\xf4\x0a\x62\x2f\x68\xd8\x8f\xf6\xf5\xee\x26\x67\x81\xdb\x60\x9e\xc5\xef\x6e\x79\xba\xf3\x3f\x99\x95\x17\xd0\xe1\xbe\xea\xde\xb3\x11\xf5\x9c\xaa\x5e\x24\x7a\x71\x21\x72\x45\x24\xae\xeb\x03\xf0\xe9\x9c\xc5\x21\x3d\xbd\x73\x7d\xdc\x72\xf6\x9e\x18\xf6\xd1\x80\xa3\x47\x01\x67\x7c\x32\xe7\x70\x36\x33\xc8\x65\x37\x64\xe5\x73\x1b\x2b\xb6\x8d\xa4\x0d\xf6\xe5\x4f\x8e\x19\x48\x56\x51\xc6\xe3\x2c\x27\x2e\x13\xc3\x67\x18\xae\xc3\x3c\x77\x57\xdd\x18\xc9\xe4\x35\xb7\xe8\x0b\xfc\xf7\xb9\x1b\x8d\xfd\x7d\xea\x18\xc9\xa0\x8e\xee\x50\x80\x40\xc6\xab\x78\x03\x49\x70\xd1\x8a\x40\x5c\x45\x06\x52\xa9\x41\x20\xba\x96\xb9\xfd\x78\x61\x73\xd0\x40\xb3\xba\x48\xf7\x98\x6f\x31\xf5\x29\x52\xa9\x12\x1b\x31\xff\x1a\xfa\x06\xe2\x40\xe0\xb8\x00\x98\xbb\x6a\x8d\x65\x7a\x60\x0f\x14\xba\xa0\xab\x41\xf0\x16\x2e\x27\x01\x26\xaa\xe2\xcb\x84\x3d\xb5\x86\x91\x39\x9c\xf8\x2c\x8f\xe7\x59\xd1\xbe\x2f\xc4\xa0\x0e\xdc\xe5\x16\x5a\xb9\x4d\x3c\xc7\x6e\x90\x03\x4b\xc3\x0b\x78\x1b\xa6\xe6\x5d\x37\x1a\xb0\xc5\x16\x6d\x02\xe7\x55\x15\x38\x0b\xaa\x19\xdd\x0c\x6e\x13\xe7\x79\xee\x9c\xe7\x94\x5a\x14\x8c\xf2\x67\xd7\x03\xc5\x9f\xb9\xf6\x4d\xe1\x4c\xfb\x30\x8c\xe7\xd4\xf0\x7d\xcd\x97\xcb\xf1\x93\x0e\x2c\x96\xc0\x62\x1d\x63\xc0\xc0\xe4\x88\xb7\x05\xb9\x22\x48\x32\x9d\x96\x29\x83\x29\x11\xa0\xba\x71\xf2\x9c\x80\xaa\x20\xaf\x6f\xc6\x49\xa7\xa0\xe2\x42\x62\xe6\x87\x4a\x9b\xc1\xe6\x14\xf3\x3f\x1e\xf7\x5f\x1c\x3e\x7d\xf1\x23\xe1\x43\x80\xa2\xa7\x70\xc5\xf3\x28\x73\x87\xdd\x62\xc6\x0d\x1c\x70\x84\x6d\x1f\x99\x5f\x2d\xb7\x8d\x47\xbe\x88\xf4\x14\x0c\x03\xe7\xaa\x2c\x29\x0b\x3a\x96\xd5\x31\x7d\xd4\xb1\x47\x0c\x11\x62\xfe\xda\x83\x3f\xf0\x7c\xb9\x11\xfb\xd0\xfd\x3d\x57\x50\x21\x2b\x44\x73\x94\x89\x1f\x16\x79\x87\x7f\x20\x48\xf6\xbd\xa5\xdf\x94\x7e\x98\xdd\xac\x3d\x21\x3b\x9a\x62\x34\xe3\x06\xc4\x0c\x31\x1b\x1d\x9d\x44\x42\x2f\xda\x4f\xdd\x23\x66\xa3\x68\x2e\x3a\x15\xb0\xed\x30\x0b\x7a\x1e\x83\xcb\x1b\x0a\x46\x52\x90\xd6\x98\x97\xc1\x6c\x8c\x8f\x72\xb0\x2a\xf1\x22\x11\xb1\x97\xd3\x30\x32\x17\xc2\x4c\xe9\x94\x94\x28\xc6\xb9\x4d\x68\x06\xe4\x3c\x49\xcc\xcb\x76\x42\xbe\xfc\xe9\x87\x78\xca\x2e\x1d\x68\x0a\x32\x5b\x44\xec\x19\xc4\x85\xc0\x03\x98\x3a\x53\xb6\x94\xc9\x2a\xae\x90\x3e\x2b\xdc\x78\x2e\xa0\x2c\x6b\x63\xf9\x3b\x32\x0b\xa2\xdf\x45\xd2\x03\xa4\x24\xf6\x4d\xc6\x96\xc7\x3e\x28\xa2\xd9\x5c\x26\x44\x34\x4f\xb1\x33\xd3\x54\x4e\x97\x85\x5f\x9c\x0a\x24\x16\x5e\x04\x8f\x3a\x72\x22\x68\xb7\x82\x4e\xb0\x66\x38\x14\xf5\xc5\x7a\xc4\x34\x9b\x4d\x08\x80\x84\x82\x09\xd3\xe0\xdc\xd2\xd1\x29\x5e\x76\x2c\x42\x81\x85\x46\xf5\xe9\x75\x78\x13\x38\x8f\x4b\xc3\x94\x5d\xa2\xfc\x13\xdf\xe3\x73\x36\xe4\x89\xa4\x55\x34\x19\x0a\x34\x1b\xe2\x68\x8e\xde\x37\xe6\x59\x71\x1d\x61\x32\xc0\x00\x1d\x9b\x53\x8e\xc7\x4d\x4a\x76\x33\xbc\xb9\x39\x4d\xa8\x23\xe7\x0d\x93\x2c\x66\x02\x8a\x66\x08\x72\x8e\xc9\x62\x8a\x36\x94\x81\xe7\xe3\x83\x27\x2a\x8f\x61\x3f\x1c\x62\x1d\x37\x0d\x73\xe2\x19\x8a\x96\x95\xf1\x54\xe1\xe5\x0b\xf2\xa7\x6a\xad\x16\x34\x32\x32\xa9\x0c\x5d\x12\x57\xfc\x6a\x31\xd9\xa8\x7c\x76\x24\x7c\xaa\xb9\x2c\x24\x56\x74\x41\xd6\x97\x52\x2a\x2b\x78\x51\xed\xc8\x0c\x09\xda\x2d\x69\x38\x4e\x4f\x93\x13\x12\x8d\x31\xd5\x91\x29\xd6\x4a\xc6\x5a\x51\x24\x2c\x5d\x8c\xc7\xe6\xc0\xfe\x35\xe2\x37\x69\x86\xfd\x51\x42\xa3\xac\x6c\x37\xbf\x14\xb4\x08\x4b\x92\x5e\x96\x68\xd2\xc4\x18\x4e\x05\x37\xc9\x85\x2d\xf9\x62\x9d\x18\xd9\xf3\x02\xc5\x84\xd0\xb6\x4e\x61\x9c\x0b\x52\x7e\xdb\xc9\xa6\x9e\x8a\x82\x9b\x14\xab\xcd\xb4\x5a\xcb\x59\x3c\x54\xcb\xf4\x54\x45\x57\xa0\x15\x4c\xa9\xc4\x9b\x93\xc0\xc2\x2a\xbd\xfa\x02\xa5\x5a\xfa\x21\xb0\xbf\xee\x81\x52\xaa\xa6\xbc\xab\x44\xae\xe5\xf1\x32\xab\xed\x79\xd9\xf1\x33\xef\xf6\x97\x5b\x33\x3f\xa8\xfc\x56\xe5\x96\x25\x9b\x55\x3b\xc7\x03\x75\xf4\xfb\x31\xbc\x93\xa7\x98\xf2\x90\x68\x4f\x12\x0a\x8f\x78\x71\xd4\xac\xf9\x52\x16\x11\x11\x6d\x70\x4f\x3a\x50\xd6\xd9\x71\xf7\xe4\x24\xd3\xd9\x54\x39\x3d\xa9\xae\xf2\xf1\x0d\x32\x4b\xfb\x61\x02\x44\x90\xb7\xaa\x30\xd2\x0a\xa1\x1e\xab\x82\xfc\x47\xf9\x62\x7b\xc3\xf5\x48\xdf\x6d\xcb\x6c\xee\xcb\x17\xd1\xa7\x39\x73\xc9\xdf\xe4\xe4\xba\xf3\xc6\x0c\xfb\x3d\x25\xa1\x1e\xb2\x4b\xa4\x73\xab\xe4\x2f\x7c\xc7\x6a\x15\xfc\x22\xa5\x88\x20\x2c\xff\x84\x2b\x05\xe3\x86\x9d\x2f\x2e\x2f\x6f\x9c\x69\xa6\x28\x64\xc4\x9e\x93\x7b\xc0\x47\x1b\xd9\x84\xd1\x48\x41\x41\x0b\xef\x04\xe2\x1a\xcc\x70\x2f\x43\x73\x96\xe8\xcd\x31\xf1\xdd\x74\x75\xda\x07\xd2\x55\xe2\x95\x6b\x78\x34\xd4\xe4\xe1\xfb\x22\x4c\x23\xa7\x88\x30\x6f\x60\x0c\x61\xa2\x79\x6a\xac\x81\x72\x66\xb8\x03\xe1\x9e\xa5\xbc\x14\x00\x90\x70\xc4\x97\x2c\x5b\xab\xd9\x8b\x16\xe3\x3a\xd9\x20\x3a\xc4\xd6\x50\xb4\x04\x6b\x1f\x4b\x95\x01\x12\xb1\xf7\x33\x87\x56\x11\xe0\xe3\x1b\x0b\x9e\x01\x29\xbd\x03\xb2\xdc\xb4\x73\xb8\xc6\x1b\x1f\x60\xa1\x87\x2a\xfa\xbd\x1b\x1e\x12\x5c\x1d\xd8\x2d\x5a\x1e\x5e\x39\x8e\xf3\xe9\x04\xad\x9e\xc9\xa2\xc8\x30\x9a\xb2\x96\xee\xbd\xdc\x7d\xf6\xb6\xfb\x9f\x27\x01\x98\xf1\xa6\xe8\xf3\x2a\xda\x4f\x19\xe5\x34\x1e\xe5\x38\xc2\x3f\x82\xc4\xe7\x6c\xa5\x40\xd3\x72\x42\xe7\xfb\xf4\x2a\xe2\x13\x98\x51\x2d\x81\x18\x61\x3c\xe5\x68\x34\x33\x43\xb7\x66\x43\x4f\x03\x8c\xda\xa9\x70\x56\xee\x7c\x54\x7e\x8d\xbc\x8a\x8a\x2e\x12\x75\x6f\xd4\xd5\x08\xfd\x08\x52\x8e\x8a\x3c\x03\xad\x80\xe5\xc0\x25\x82\xd6\x17\x92\x11\xd5\x9d\x68\x38\x7a\xec\x9e\x8c\xab\x3c\x52\x9d\xe1\x33\x52\xd6\x90\x74\x36\xa4\xf8\xc3\x70\x8b\xc3\x64\x61\x2e\xa7\xc6\x14\xc5\xec\x68\x76\x4d\xe0\xf8\xf3\x38\x4e\x17\xa9\xe7\x6f\x0c\x1b\xa6\x7b\xfc\xb4\xc9\x8f\x4e\x94\x2f\xd8\x30\x30\x44\x5f\x45\xe6\xa0\x48\x2c\x26\x47\xc1\xaa\x10\x8c\xbf\x88\x28\x4b\xe4\x79\xa8\xe4\xa2\xcf\x2f\xbf\x23\xfc\xa4\xcc\x64\xb4\x60\xde\xd5\x9f\xe6\xd6\xd4\x10\x0a\xfe\x1b\xb4\x13\xab\xae\xb9\x26\xb2\xc5\xf1\x56\x14\x95\xfe\xfd\xf7\xe0\x7e\x56\x09\x42\x1c\x61\x2d\x47\xd7\xf3\xbc\xb0\xba\x30\x73\x8a\xb2\x3f\xfd\xa9\x98\xd1\xfc\x7e\x3f\xa7\x54\x2b\xe7\x49\x9e\xfb\x6a\x42\xb6\xb5\x67\xcd\x5f\x9d\xec\x56\x75\xb0\xca\x66\xa5\xe0\x3e\x2a\x1e\x37\xdf\x4b\x66\xa3\x1c\x47\xd1\x07\x79\x6a\x80\xc6\x11\x81\xa1\x23\x01\x09\x6b\x24\x72\x2e\xe9\x4b\x67\x94\xb3\x80\xdf\x13\xb4\xc9\xce\xcd\x7b\x81\x60\x11\x41\xad\x2b\x7d\x07\xc7\xd7\x1d\xc6\xa9\x19\xd1\x39\x76\x62\xf6\xa8\x9c\x22\xe6\x3e\x61\x56\x12\x18\x0a\xc0\x30\x75\x66\x08\xe4\xcb\x4f\x1d\x1a\xe8\x68\xdd\x87\xd6\xc3\x9e\x8a\xc6\x5f\xc5\xb3\xd6\x3b\xab\x36\x62\xce\xa3\x40\x49\xfb\x43\x91\x60\x81\xea\xef\x29\x56\xdc\x32\x99\x24\x3d\xc5\xef\xb0\x73\xaa\xbe\x63\x07\x2b\xfd\x95\x75\x61\x2d\x13\x6f\xdb\x5b\xdc\xa7\x12\xe5\x06\x9f\x92\xd0\x46\x39\xa0\x16\x59\xee\x59\x3b\x22\x99\x91\x84\xd7\x51\xb5\xab\xd9\x77\x43\x5d\xcc\x21\x74\x70\xef\x3c\x3f\xcc\x31\x15\x22\x3f\x76\x24\x39\xd6\xb0\xd6\x0a\xd4\xe2\x48\x7b\xac\x48\x10\x10\xc3\x57\xa8\xb3\xb1\x29\xd9\xca\x56\xaa\x2a\x32\x5e\xec\x80\x66\xfc\x65\xec\x73\xb0\x7c\x7b\xe7\xdf\xa3\x76\x19\xb3\xbc\xf5\x69\x54\xe8\xfc\x8b\x8f\xc2\xdf\x2a\x7a\x0c\xd8\xc8\x06\xbb\xab\x9a\x97\x62\xa5\xa6\xe3\x23\xe4\x6c\x00\x0a\xdc\x94\xe9\x23\x3b\x2a\x93\x19\x5e\xa0\xf5\x59\x6c\xbd\xcd\x51\x8a\xf2\x60\xf5\x8a\xba\x9e\x15\x01\x4b\xaf\xe2\x8b\xf9\xd7\xbe\x7c\x24\x20\x28\xec\x08\x19\xcc\x57\xbf\x80\x0a\xde\x39\x85\xaf\x7b\x1f\xa9\xdf\x78\xe1\xfd\xd3\x3e\x03\xab\xb5\x12\x54\x99\x43\xa1\x6b\x89\x2c\x8b\xea\x21\x66\x9c\x2e\x82\x58\x5d\x4e\xf3\x34\x26\xd6\xcb\x33\x20\x72\xb9\x60\x2e\x93\x39\x3a\x1f\x60\x5c\x92\x71\x14\x52\x28\xe7\x19\xea\x0d\xe7\x33\xbc\xce\xe5\xe6\x93\xfb\xda\x06\x8f\x2e\x3b\x5e\xb7\xae\xa1\x99\xc1\x1f\xf0\x80\x2d\xb8\xbd\xad\xaa\x4e\x1b\x42\x59\xc1\x82\x0a\xfa\xe4\x89\xd0\x17\x93\x9c\xb0\x34\xc5\x30\xd1\xa0\x2b\x40\xd7\xb5\x34\x5d\xb0\x39\x14\x89\x1d\xf5\x43\x47\x49\x6d\xad\xed\xb2\xe2\xe2\x0d\x7d\x36\x2c\x75\x1d\x05\x43\x24\x7f\xd3\x16\xce\xe4\x7a\x28\x26\xc8\x30\x71\x6b\xf4\xb3\x5c\xfa\x6b\x81\xa0\x10\x0f\x8c\xe5\xe6\x96\x59\x4e\xb3\x0e\x24\xa0\x08\x40\x77\xb8\xab\x70\x3a\x05\x06\x8e\x79\x73\xb4\xae\x34\x4d\xc5\xb7\x95\x5f\x80\xe5\x76\x80\x66\x42\x07\x37\xd6\x89\x87\x6d\x96\x08\x19\x36\xb0\x41\x9d\x99\x74\xb6\x74\x81\xb8\xe4\x91\x8d\x69\x5e\x10\x12\x19\x2c\x92\xc0\xd6\xea\x7c\x96\x5c\xa7\xe6\x8d\xa4\xdd\x85\xb8\x8c\x9d\x35\x4d\x6f\x60\x3c\x35\x1b\xeb\xc1\xe2\x83\x4c\xec\x54\x28\x70\xf0\xdb\x88\xbc\xc7\x49\xa9\x4b\x7e\x7f\xcc\x09\x24\xf4\x8c\x21\xc1\xa3\xe5\x14\x78\xa9\xe1\x32\x9d\x52\xac\x2f\xeb\x46\x7a\xe1\xbb\x08\x82\x8c\x15\xb1\x16\x85\x1c\xff\x53\x86\x48\x0f\xa7\x0b\x14\xc1\x4e\xc4\x44\x93\x8c\x23\xac\xff\x8f\xb5\xde\x33\xd8\x28\x8e\x5e\x1c\x24\xb3\xfc\x45\xa8\xe3\xe5\x02\x28\xeb\xb0\x85\x6b\x4f\x06\x4e\x19\x23\x39\x62\xcf\xee\xc0\xb6\x96\xc4\x1d\xf5\xce\xf9\x2b\xe6\x7f\xac\xf8\x33\xc7\xb8\x5a\x7d\x0d\x06\xb5\xad\x64\x84\x49\x45\x77\x57\x4e\x08\xc9\xe4\x35\xaf\x10\x55\xc2\x5f\x0b\xd6\x33\x2b\xb4\x12\xde\xc7\x2b\xc8\x3c\x8e\x92\xd9\xd8\xac\xbc\x67\x6d\x18\x42\xe6\x88\x70\xc0\xb6\x00\x5c\xba\x2a\x0e\xb5\xc0\x4b\x23\x73\x9c\x6a\xb5\xfe\x00\xac\xd8\x4c\x59\xb0\x06\xd1\xab\x5a\xb5\xe6\x3c\x39\x8a\x3f\x45\xc3\x6a\x07\x47\x6d\xb5\xd7\x03\x14\xb0\xa5\x7e\x24\xc5\x67\x7c\xca\x25\x8f\x9f\x88\x94\x50\xae\x7b\xb3\xb2\x15\x82\x88\x81\x97\x3c\x50\x32\x0f\x87\x5b\x13\xbe\x64\xea\x17\xa5\x7b\xf1\x76\x12\x89\xf2\xf6\xdc\x4e\x12\x00\x67\xf1\xbb\x02\xd5\x9d\xca\x23\x66\x87\x98\x7f\x34\x95\xf2\x18\xa7\x4e\x9f\x2f\xc4\x74\x6f\xe9\x26\x2e\xbe\xa7\xdc\xce\x46\xaf\x62\x8c\xfa\x65\x9f\x3d\xfe\x75\x44\x02\x04\xa6\xc2\x22\xc1\xb8\xf0\xed\xea\x0a\x7c\xd7\xc4\x0e\xde\x10\x9b\x9c\x31\x42\x1d\xa9\x14\x71\x01\x3a\x69\x08\xba\x60\x73\xb4\xd8\x84\xe3\x63\x28\xa7\xcb\xae\x33\xb2\xb2\x0a\x1c\x72\x57\x72\x3e\x57\x31\x52\x0c\x78\xd8\xf1\xfb\x4b\x54\x61\x28\x70\xe3\xec\x14\x06\x96\xf5\x8f\x1c\x0e\x55\x4c\x68\x65\x1d\x88\xd4\xdf\x09\x50\x78\xf0\x2e\x26\x1a\xfb\x67\x73\x04\x0a\x94\xbb\x48\x6c\x40\x0e\x1b\x69\xe3\x77\x5a\x46\xa2\x61\x76\xae\x19\xf8\xf5\x0c\xae\x2e\x36\x8d\x17\xa9\x1d\x8a\xb2\x78\xb0\xb7\xaa\x0f\xf8\x24\x90\x17\x00\x30\x0c\x70\xc1\x70\xa1\xf2\x36\xf3\xdd\x00\x3c\x15\xa1\x4b\x46\xb0\xd4\xdd\x8f\xbd\xfd\x10\x3e\x49\x9e\x3d\xcf\x30\x11\xc5\x91\xc1\x83\x08\xb0\x46\xce\xb8\xcb\xf6\x24\xd6\x5f\x4b\xa7\x44\xf3\x71\x16\xbc\xf4\x5e\x5a\x0e\x30\x4f\x26\xec\xa3\x21\x1b\xc6\xdd\x7f\x25\xe4\x7d\x06\x6e\x43\x60\x06\x73\x59\xe7\x01\xf2\x51\xe0\xdf\xf2\x46\xd8\xb7\xa0\x6f\xf9\x34\x73\x4e\x77\x62\xa4\x59\xe2\x45\x70\x47\x90\xf2\xf6\x8f\x20\xf6\x55\x0e\x20\xc8\x0b\xaf\x23\x6b\x11\x8f\xfa\xf3\xd1\xc8\x06\x12\x15\xc9\x9f\x32\x25\xbf\x8e\xf0\x4c\x2b\x0b\xf2\x3f\xc2\x86\xfe\x6f\x66\x3f\x2f\x97\x14\x8b\x5b\x3d\xc7\xd4\xc2\xed\x20\x2a\x18\xfa\x8b\xcd\x48\x44\x3e\x69\xc8\x98\x67\x9f\x93\x99\x15\x4a\xe0\x31\x70\x24\xbf\x43\xc0\x92\x32\x32\x3c\x45\x88\x56\x08\x04\xb2\xd0\xc2\xc6\x8e\x5f\x47\x9c\x4e\x38\x0e\x08\xe7\xb9\x13\x0f\x44\x1e\xe2\xb2\x13\xa4\xee\x59\x9e\x01\x98\xbf\xb0\xdd\xb8\xb9\xcd\x6f\x6d\x45\x37\x63\x00\xad\xe8\xd7\x55\x1a\x91\xb2\x0a\x1b\xb1\x81\x96\xf6\x7f\x94\x17\x19\x86\x3b\x9b\x14\xeb\x5e\xc1\x24\xd7\xdc\x09\x10\xe7\xd8\x10\xea\x1a\x52\xf1\x68\x82\x91\x3d\x26\x09\x99\x98\x26\x17\x64\xf2\x26\x9e\xd8\x69\xb9\x31\x78\x81\x89\x59\xa9\x12\x15\xf9\x34\xa1\x3e\xf4\x4b\xb1\xfd\x77\x01\x50\x85\x82\x79\xc2\xa6\xcb\x65\x61\xb0\x2a\x2b\xc0\x53\x5c\x41\xb1\x50\x9d\x19\x83\x4a\xdd\xd3\xe3\xe9\x06\x54\xae\xd3\xaf\x9c\xc0\xb1\x55\x9a\x86\xa5\xf4\x71\x95\x8d\x55\xc8\xad\xe7\x62\xc3\xae\xc8\x22\xe3\x04\x67\x9c\x90\x24\x23\x52\x76\x4a\x51\x7d\x24\x41\xba\xcc\x72\x6b\xb2\xd6\xc8\x44\x80\xf7\xb8\xae\x61\x3c\xe4\xf0\xa8\x14\x6a\x9b\xbd\x20\x40\x5e\xe1\x3e\x61\x0c\x38\xb6\x63\x36\x20\x9b\x9e\xd4\xab\xc0\xd4\xea\x36\x0f\x45\x67\x09\x97\x21\x19\x42\x7f\x88\x12\xa4\x19\x2a\xa1\x4c\xab\x38\x48\x0e\xea\xdf\xc0\x34\xd9\x06\x8d\x77\x06\x9f\xc0\x8e\xa0\x06\xa3\xe4\x5d\x8b\x89\x6f\xcc\x4b\x75\x41\xd1\x27\xb4\xfd\x9f\x4b\x0b\x71\x4f\xdf\x3f\x48\xc4\x30\xa0\xec\x43\x83\x97\x87\x41\xb8\x98\x27\xe6\x8d\xc2\xd6\x5d\xc8\x40\xb1\xc7\x91\x3f\xaf\xd8\x06\xc8\x53\x0e\x64\x2b\xee\x25\xc2\x84\xa6\x88\xe5\x49\x34\xca\xe8\x27\x06\xed\xd7\x4f\x2b\x1b\x17\x36\x9f\xc9\x06\xd6\x37\x95\x38\xb7\x2b\x8c\x2f\x99\xb0\x49\x50\x81\x3a\xc5\xdb\x83\xfa\x1e\xca\x6e\xe0\xfb\xfe\x06\x2e\x0e\x72\xef\xef\x5b\x17\x8f\x57\x3d\x62\x57\xd8\x8a\x0a\x0d\x7e\xac\xe1\x50\xad\x31\x45\x1b\xb6\xfb\x3d\x1b\x69\x18\x1a\x1f\x90\xc6\x41\xb7\x62\x99\x12\xca\xed\x28\x73\x33\x46\x1c\x0e\x15\x7f\xad\xb8\x0a\x7d\xaa\x90\x6e\x73\x47\xc3\x24\x48\x13\xab\xd5\xbd\x90\x1e\x96\xc4\x31\xa6\x91\x88\x65\x1e\x9c\x1d\x8c\xbb\x12\x3b\x6d\x32\xa6\x4e\x84\x66\x14\x77\x23\xb4\x26\x7c\xfc\xaa\xa3\x44\xca\xa4\x56\xb4\x80\x53\x1b\xf1\xca\x74\x6b\x05\x44\xf6\x61\x80\x4f\x89\xf3\x05\x1b\xa9\xa1\x10\x4e\xe2\xb0\x8b\x81\x9c\x7b\x57\x69\x47\x78\x3c\x52\x91\x67\x2b\x8b\x26\xc7\x2a\x8c\x72\xc6\x65\xc2\xc6\x98\xa1\x37\x55\x18\x5c\x80\xe0\x3c\xbc\x31\xaf\x0d\x7c\x54\xf9\xa6\x94\xa0\xbe\x44\xc2\x91\x04\x1c\x27\x50\xbf\xcc\x38\x03\xd1\x15\x66\xf0\x30\xdc\x30\x24\x1f\x43\x50\xf6\x35\x01\xee\xe3\xa9\x41\x10\x4b\x97\xc0\xeb\x74\x94\x18\xd2\x82\xcf\x2f\x1b\xc0\x9b\x4c\xf3\xe0\x69\x57\xb0\x39\xe4\x39\x80\xbe\x0c\xe3\x54\xbb\xf6\x69\xc6\xcf\x06\xd7\x5c\xf5\x5e\x51\x18\x2a\x10\x60\xb8\x97\xb7\x90\x7d\x3c\x47\xe8\xac\xe8\xd9\xed\xd9\xef\xca\x96\xcc\x9d\xd2\x02\x2b\x3f\xfe\xe8\x59\xf7\x8d\xd3\x6c\xc6\x9d\xa9\xc4\xc9\x51\x9a\xe9\x44\x36\x70\x59\xb4\xd2\x34\xa7\xf7\xd7\xa2\x51\x1b\x9f\xbd\xd0\x42\x95\xc2\xc3\xda\x3c\x53\xfc\xcd\x1a\xa9\x40\x2a\x97\xab\x08\x2d\x5b\x80\x85\x76\x21\x4a\xe7\xb4\x33\xae\xb1\x1f\x8f\x07\xb2\x8f\xda\x15\x57\xc4\x23\x38\x3e\x61\x86\xb9\xd4\xdd\x30\x33\x4b\x54\x7c\x73\x7b\xf7\xf4\xea\xc6\x91\xb6\x89\xe5\xd0\x85\xc9\xf1\x35\x40\x20\x66\xca\xda\xce\x39\x79\x5d\xde\x4c\x2a\xdb\xc6\x19\x4a\x88\x7e\xca\x59\x39\x59\xd9\x4f\x38\xbb\xc4\xd8\x73\x56\xa7\xfd\x5d\xd0\x01\x7d\xa8\xc3\x04\x77\x00\x0b\x50\xae\x01\xf3\xd8\xbe\x02\x63\xc6\x2e\xca\x25\x98\x74\x4f\x38\x67\x91\xe4\xa2\x4f\xad\xbf\x92\x39\x31\x20\xe9\x4d\x98\x53\xe0\xc7\x07\x56\xf3\x18\x8a\x45\xca\x89\x11\x15\x9f\x50\xd9\xdf\xdf\xaf\x04\x10\xaf\x33\x9c\xa3\x73\xbf\x33\xcf\xa6\x00\x54\x18\x89\x7b\x90\x44\xb3\x81\x32\x99\x62\xab\xa0\xd2\x9c\x0a\x30\xba\x71\x38\xfb\x20\xa4\x58\xb4\xf7\x14\x6c\x50\xcf\x1a\xfd\x49\x95\xb5\x61\xca\x0f\x84\xec\x51\x7a\xf8\x59\xa6\x8f\x31\x02\xe8\xd7\x71\x14\xc2\xe3\x40\xcd\x55\xd7\xb7\x98\x80\x16\x84\x34\x29\x2a\xb4\xd0\x81\xc5\xc3\xc0\x33\x10\xf3\x53\xce\x1b\x16\x88\xc8\x29\x1e\x82\x38\xff\xe2\x26\xd0\x46\x39\x0e\x09\x4a\x63\x95\x4f\xef\x26\x57\x95\x70\x74\x60\xe6\xbf\x07\xe6\xfd\x02\x47\x1c\x49\x80\x5d\x59\x2a\x1f\x51\x47\x53\xd2\x27\xe4\x6c\x7a\x08\x41\x75\x3b\xe1\xba\x9d\x1d\x4b\x4f\xd6\x82\xd7\xf3\x78\x14\xcf\x6f\x3c\x45\x90\xe1\x09\xe7\xf3\x1b\x89\xbf\xc9\xe1\x10\x74\xce\x19\x73\x61\x70\x3e\x7b\x65\x0f\x00\x43\x31\xa3\x27\x14\x83\x97\x09\x79\xb5\x55\xfc\xa0\x26\xf4\x9d\x8f\x2b\x3e\x14\xe6\x20\x69\x67\x47\x60\x49\x92\x2f\x1f\x21\x24\x2f\x32\x75\x68\x54\x33\xa7\xb8\x23\xcd\x71\x38\xb5\x09\xc0\x83\x2a\x0c\x42\x80\x67\x52\x88\x9b\x4f\x9f\x19\x1a\x9d\xd7\x1b\x6b\x7d\x12\xb4\x9d\x4c\xd8\xe5\x51\x60\xd6\x1a\x54\x5d\xe6\xbc\x62\xa2\xae\x3a\x49\x40\x60\xe1\x92\x8b\x0b\x10\x6b\xc6\xa0\xd4\xba\x9e\x50\x12\x28\x56\xdb\x38\x48\x68\x09\xe2\xd2\xbe\x02\xd9\x44\x0f\x40\xb0\xfb\x83\x27\x17\x1b\x20\x72\x4f\xf8\xec\x92\xae\x9a\x3e\xa6\x60\xb2\xe6\x45\x07\xa3\x76\x41\x57\x58\x04\xed\x47\x5c\x91\x17\x4d\x51\x4d\x8f\x60\xd1\x81\x31\x87\xdd\x6e\x89\x1c\x03\x0a\x68\x9f\x50\xd4\x24\x7b\x14\x7e\xe0\x48\x49\xb6\x00\x23\x25\x05\x7b\x98\x5e\xe9\x9e\xb2\x6d\x82\x54\x22\xb4\x17\xa1\xfa\x44\x1b\x7f\x51\xa5\xcb\x68\x8e\x16\x9e\xb3\x67\xc9\x20\xa4\x24\x4e\x66\x21\x0a\x0d\xc4\x78\x9f\xd1\x98\xb1\x0e\xba\xf2\xa2\x73\x0c\x7d\xb2\x73\x58\x42\x2f\x1d\x9d\x04\x65\xed\x1f\x40\x08\x29\x40\x83\x7a\xa4\xc9\xdd\x4c\x1d\xff\x0a\xdd\xfe\x4a\x71\xb2\xd0\x60\x08\xad\x2e\x1f\x98\xd2\x38\xbd\x7a\xe0\x93\xe7\xbf\x3d\x3d\xb5\x3c\xc6\x9d\xa8\xea\x3f\x3c\xa9\xd4\x84\x52\x68\xa4\x4f\x19\x33\xa7\x05\x9d\x3b\xfe\x90\x93\xf2\xf5\xe7\x84\x49\x27\x9f\x93\x2c\xa7\x2a\x96\x18\x88\x3e\x4c\x27\x80\x64\x0b\x99\x55\x49\x37\x44\x56\x0e\x68\x5a\x91\x3f\x20\x90\x19\x01\xa2\x78\x5f\x91\x6f\xe4\xd3\x39\x6d\xa5\xd4\x8b\x3d\x55\x27\x5b\x10\x7c\x8a\x51\x4a\x5d\x08\xe0\x0b\x34\x4d\xe4\x74\xd4\x87\x8d\x09\x6e\xd7\xce\x37\x0f\x2e\x7c\x55\xe0\xc0\x9e\xa2\xc9\xe5\xa9\x85\x84\x85\xa4\xdf\x81\x29\x9a\x91\xb5\x24\xb8\x26\x7f\x42\xaa\xcc\x2a\x0d\xf6\x6a\xbb\xb2\xae\x6a\xf5\xa0\x8d\x81\xdd\xe7\x1c\x73\x6d\x46\xa3\x36\xd4\x9c\x4f\xb5\x75\xd2\x96\xcd\xde\x15\x92\xcd\x43\x27\x1a\x14\x3c\xf0\xf0\x4a\x57\xde\x83\x15\x37\x63\x7e\x91\xf5\xc6\x74\xd3\xce\xba\x78\x38\x86\x12\xc5\x1f\xa5\x66\x3b\xb0\x41\x09\x19\xfb\xd6\x98\x45\x5f\xa4\x67\x0a\xb3\x8f\x82\xce\xbb\xec\xbd\x4b\x3b\x02\xdd\x9e\xab\x6b\xd5\xb3\x5f\xd6\xde\x3d\xda\xfb\x79\xf8\xa8\x06\xff\xf9\xb9\xf6\xc3\xff\x59\xf3\x8d\x2c\xa1\xd1\x0f\xf0\xdf\xb3\x36\x04\xff\xae\xfc\xf0\xc3\x0f\x95\x9c\x40\xec\x2d\xa7\xc1\xb5\x82\xb0\x44\xeb\x25\x4b\x53\x1f\xe6\x70\x57\x90\xfd\x90\x41\x66\x22\x7a\x00\x57\x5f\xe0\x69\xe9\x9f\x93\xe7\x86\xaa\xfa\xc6\x15\xbc\x89\xe1\xd6\x5f\xcc\x95\xf6\xb4\xf8\x8d\x0f\x1b\x8b\x9e\xc9\xb8\x34\x19\x62\xec\x9f\x13\x8a\x8f\xa1\x75\xe7\x62\x31\x02\x71\x6e\xca\x1e\x8f\x40\x50\x04\x67\xf6\x19\xa8\x90\xb8\x4a\xfe\xc8\x1c\x12\x51\xa8\x92\x49\x21\xec\x61\xb1\xe8\x95\x53\xcb\xcb\x57\x75\x3b\xe5\xa6\x5a\x2e\xa2\x62\x67\xb9\xfc\x0a\x48\x2c\x9a\xbf\xf3\x0a\xac\xb2\x01\x29\x68\x66\x91\x1c\xb0\x60\xe2\xa4\x15\xd1\x13\x87\x5c\x6d\x2f\x5f\xbf\xea\xf5\x83\x23\x83\x13\x4c\x83\x34\x4c\xe6\x6b\xff\x95\xae\x99\xdf\xde\x2f\xe6\x17\x3b\xcd\xff\x4a\xef\xa1\x39\xfc\xf4\x66\x06\x01\xeb\x82\xea\xa0\x16\x74\x5a\xed\x0e\x92\xc1\x9e\x99\xe7\x38\x5e\x8c\x83\x97\x27\x41\x77\x61\x68\xda\x2c\x6d\x06\x5d\x10\x2e\x41\x5d\x14\xe3\x47\xb3\x8f\xf0\xc8\x01\x2e\x3f\x75\x1a\xf7\x34\x59\xcc\x06\x11\x07\x0b\x4e\x83\x4b\x48\x36\x31\x91\xa0\x93\x07\x27\x87\x8d\x74\x7e\x33\x02\xd7\x9b\x41\x34\x11\x6f\x13\xd6\xbb\x83\xb7\x24\xb8\x1d\xc8\xc5\xfd\xec\x69\xaf\xff\xe2\xa4\x8f\x77\x4b\xf3\xde\xbd\x0a\x18\xff\xc0\x86\x1d\xcc\x51\xe9\xb3\x16\x9c\xbe\x3c\x7c\x59\x1d\x86\x1f\xe3\xe1\x79\x34\xa9\xed\x05\x6f\xc5\xa0\x8c\x69\x29\x08\x89\x87\x6c\x87\x8f\xf4\x58\x42\x31\x9b\xb7\xca\x3d\x4c\x68\xc8\x91\x92\x69\x79\x39\xa6\xea\x84\xdc\x72\xe2\x49\x43\x0c\x9e\xfc\x10\xce\x30\x65\x68\x7d\x35\x9f\x4f\xf7\xd6\xd6\xae\xe3\x0f\x71\x13\x92\xac\x5f\x5f\x36\x93\xd9\x25\xfe\xbd\x46\xb7\x66\x9f\xfb\x57\xb5\x87\x1f\x07\x69\xf3\x7a\x1d\x6b\x5e\x5d\xae\xc9\x08\xd7\x66\xe1\x75\x03\xe6\xb9\x36\x8f\xa7\x6b\x2f\x0d\xce\xc0\x98\xac\x79\x35\x1f\x8f\x1c\xe3\x49\x46\x05\x90\xb7\xf1\xf5\xe9\x51\x63\x07\xdc\x92\x0d\x96\x15\x6f\x62\x8a\x77\x0e\xa9\x30\xbf\x77\xd8\xe3\xd6\x05\x03\x39\xbf\x01\x6d\x18\x7a\xdb\x32\xc2\xad\x22\x93\xd3\x0b\x5b\x7d\x22\x56\x7d\x06\x35\x39\x20\x10\x03\x8b\xd1\x66\xe1\xd2\x6c\x86\x94\x56\x7c\x9a\x40\x06\xdb\xf3\x08\x90\x4e\xc3\x1b\x62\x90\x7d\x07\xe0\xfb\xa0\xd5\x74\x3b\x79\x18\x1d\x27\xf1\x24\x0b\x16\x62\xba\xcc\x0c\xa7\x0b\x7b\x21\x99\x28\x39\xa8\xeb\x63\x09\x54\x6c\x7d\x80\x8d\x11\xac\x97\x8f\x69\x80\xb1\xfd\x43\xe2\x93\x19\x8d\xe1\x3c\xac\x83\x04\x12\x0d\xde\xc1\x5e\x30\x1c\x90\xad\x3c\x19\xc6\xa1\x37\x95\x79\xb4\x7e\x8c\x93\x05\x32\x1c\xd0\x80\xb3\x1d\xe3\xb5\x6f\x53\xa8\xd0\x86\x8b\x66\x59\x2a\x7b\xa2\xf2\xf2\x62\x63\x8c\xf3\x00\x55\xeb\x2e\x02\xb4\xb0\xdd\xee\xb9\x20\xfc\xc5\x89\x7a\xcc\x91\xec\x14\xd0\xb0\x98\xc4\xb9\xf8\xd1\x80\x10\x83\xfd\xf9\x35\x04\x73\x69\x7d\x6a\xb5\x54\x06\xbe\xd6\xa7\xa3\x23\x9f\xf7\x90\x61\x01\xca\x71\x58\xbc\x62\x8c\x04\xfd\x70\x01\x4c\xb5\xb7\x5c\x10\xa4\xfc\x86\x53\xb4\x8b\xc0\x14\x6a\x57\xe0\xf6\x37\xdd\x07\x92\xcc\xbd\xc8\xcc\x0a\xde\xe3\x05\xc6\x55\x98\xf5\x91\x9f\xeb\x83\xab\x70\xd6\x33\x7d\x74\xe7\xd5\x58\xbd\xc0\xb3\x7b\x55\x79\xd0\x50\x85\x41\xf0\x9d\x29\xfb\xb4\x7d\xe4\x87\x22\x9d\x73\x0e\x67\x84\xab\x60\x7a\xee\x93\xad\x4f\xbd\x16\x34\x1f\x80\x56\x90\x01\x1d\x7a\x80\x72\x7b\x7a\x10\x34\x02\x68\xf6\xd8\xaf\xa2\x4f\x53\x3b\xf3\xcd\xdf\xbc\x9f\x76\x5a\x85\x23\xe9\xe7\x46\xd2\x5f\x65\x24\xfd\x65\x23\xe9\xdc\x36\x92\xe2\xa1\x1c\xe5\x86\x72\xb4\xbd\xc2\x50\x8e\x96\x0d\x65\x7d\xf9\x50\xc0\x9c\xb0\x64\x30\x3b\xb9\xc1\x1c\xac\x32\x98\x9d\x25\x83\xd9\x58\x3e\x98\x4e\xab\x7c\x34\xbd\xdc\x68\x0e\x57\x19\x4d\x6f\xc9\x68\x36\x97\x8f\x66\xa3\x55\x34\x9c\xdc\x5e\xaf\xfc\xbc\xb8\xb8\xb8\x18\x56\x6c\xbd\x22\xb1\x0f\x4d\x62\x27\xb7\xbe\x07\xf9\xad\x66\x47\xd8\x68\x3c\x2e\x9f\x5e\x35\x53\xf2\xdd\x77\xc1\x16\xbc\x3a\xab\x34\xef\x9d\x56\xcd\x35\xbe\xf5\x38\xc3\x3f\x73\x5d\xfc\x08\xea\xb2\x00\xcc\x16\xdc\xad\x65\x98\x17\x48\xc0\x2a\xbe\x7b\x14\x01\x83\xae\x13\xf4\x1f\xf0\x21\x98\x5b\x17\xdc\xad\x80\x0b\x4c\xcd\xfd\x97\x5c\x92\xee\x2e\x9e\x59\x81\x19\xfc\x43\xea\xa3\xe6\xe2\x4f\xe5\xb1\xaa\x89\x74\xc6\xcd\x31\xbb\x4c\xde\xe3\x3a\x00\x79\xbe\x41\xf2\xa1\x39\x5d\x88\x66\xdb\x0e\xd0\xed\x80\x10\xad\x39\x3a\xaa\xe5\x5b\xbb\x5a\xdf\xe3\xd1\x38\x82\x6a\x1e\x96\x4a\x57\xbd\x70\x87\x30\x56\x90\x75\x01\x61\x91\x90\x7e\xc9\x57\xb9\x98\x4f\x17\xf3\xa6\x57\x3d\x3b\x63\x3e\xa1\xd9\x51\xd8\x71\xd0\xbd\xd3\x84\x7b\xb5\xc7\x84\xdc\xb5\xaf\x3d\xf6\x1a\x15\x8e\x8f\x52\x11\x7b\x8b\xd5\xcc\x54\x70\xe3\x69\xe4\x48\xc6\x0a\xc3\xc9\xd4\x84\xdb\x13\xd7\xc8\x6c\x56\x35\xd5\xef\xbf\xff\x3e\x68\x9b\x79\xfe\xc9\x7c\x5e\x37\x68\xcf\x07\x0b\x33\xcd\x7a\xd4\x4c\x2d\x2d\xd7\xce\xce\xf4\x5e\xd1\xef\x9f\xcb\x4e\x32\xb0\x4a\x49\x82\x0a\x5c\x62\xe4\xc0\x18\xce\xbc\x21\xe2\x06\x32\x01\xee\x30\xbc\x8a\xc0\xf0\x9c\xf9\x15\x0a\x65\xa2\x81\x90\xb7\xc0\x28\x61\xc3\x7a\x74\x0a\x05\x08\xcd\xdb\x68\x46\x19\x6b\x48\xff\x62\x47\x09\x3e\x2b\x49\xb1\x7d\xcd\x9b\x1f\x85\x9c\x99\x63\xc9\x9a\x2a\xd0\x96\x0d\xa2\x3d\x88\xfc\xec\xf4\x64\x70\x81\xef\xb2\xc8\xb2\x66\xb1\xf3\xee\xc6\x80\x04\xff\xd7\xb0\x63\xd4\x00\x98\x32\xcd\x7c\xc1\x63\xcf\xb3\x0f\xab\x8a\xb2\x50\xb1\x6f\xd5\x5a\x8d\x9b\x53\x7d\x3f\xb1\xc0\x44\xd8\x66\xaf\x63\x1a\x18\xae\x98\x7d\x28\x67\x5e\x64\x87\x18\x39\x07\xdd\x8f\x42\xf7\x7c\x31\xcf\x9b\x54\xe7\xc2\x91\x47\xe0\x3d\xeb\xfb\x0f\xb5\xbd\xf3\x1d\xa0\x60\x09\xa9\xd0\x35\x65\x4b\x48\x7f\x30\xef\x3d\x8c\x5e\x08\x8e\x3e\x29\x50\x21\x0c\x8d\xf0\x21\xba\x99\xe2\x83\x84\xbc\x5b\xc9\x84\x09\xcd\x1d\xd8\xb8\x16\xc7\x02\x9c\x5e\x38\x60\xc2\x8f\xa9\xc4\x60\xf7\x1f\x3c\x3f\xfe\x61\xc9\x66\x39\x75\x4f\x4b\x34\x1a\x04\xac\x94\xaf\xa1\x7e\x84\xd2\x6e\x42\x54\xd5\xcb\xf6\x95\xd6\xd9\xd0\x91\xce\x6c\x46\xbb\xcf\x52\x7a\x93\xf0\x8e\xb2\x5b\x89\x36\x01\xf5\x97\xdd\x04\xdf\x82\x03\x87\xeb\x16\x93\x23\x9a\x31\xe0\x58\xd4\x93\x8f\x85\x28\xd0\x72\x55\x6e\x9d\x69\x63\x8e\xa5\xd6\xf7\xd7\x00\xb9\x1a\x53\x74\xe8\x69\xa6\xb8\xf9\x4e\x41\xf3\x03\xdd\x1c\xbd\xe9\x1f\xb5\xbd\x29\xe9\x6b\x09\x46\x39\x2c\x18\xe5\xa3\x76\x86\x15\x71\x63\x1d\x42\x67\xc3\xa2\xb1\x32\x8a\x4e\xae\x31\x28\x69\x6e\x07\xeb\x1b\x6a\xe0\xf8\x58\xba\x52\xec\xa5\x00\x4c\x11\x5c\x29\xa6\x74\x68\x0b\x3d\xf6\x82\xa2\xaf\x96\xdc\x0a\x79\x8c\x2d\xbd\x44\xf2\x95\xbd\x70\xb0\x8e\x0f\x18\xc0\xc9\x93\x93\xce\x88\xb3\x94\xdf\x2d\x69\xc1\xfb\x6a\xd9\xeb\xca\x8f\x45\xab\xd6\xd6\xc2\xc9\x03\x2a\xba\xad\xf1\x69\xf6\x3b\x34\x83\x1b\x79\xcb\xdd\xac\x05\x2f\xad\x7c\x2f\x3e\xc7\xb4\xb4\x9b\xbe\xea\xa6\xdd\x29\xee\xa7\xe3\xf5\xb3\xf6\x50\x77\x25\xec\xd9\xc3\xb5\xd5\xfa\x3b\xd2\xfd\xed\x14\xf7\xb7\xfe\x58\x2f\xd9\xf5\x15\x44\xf6\xab\x7a\x92\x11\x37\xb9\x02\x3e\x7d\x69\xff\x3b\xd8\x3f\x0f\xa0\xba\x05\x06\x70\x02\xa1\x26\x6c\x4f\xcd\x53\x05\xe7\x2e\xf8\xe5\x82\xc8\xeb\x41\x99\x18\x72\xe3\x8b\xc5\x90\x40\x04\xaf\x07\x7f\x43\x41\xa4\x8a\x7c\xae\xee\x68\x33\x8c\x19\xe6\xfc\x4d\x03\x36\x18\xb4\xa9\x81\xaf\x07\xd7\xf1\x70\x7e\x65\xa6\x1e\x8c\x93\xe1\x82\x3c\x43\x21\xeb\xa4\x29\xb1\x4a\xdf\xc4\x4c\x11\x85\x5e\x99\x04\x72\xec\x6c\x4a\x03\x0c\xe7\x7b\x78\x69\xce\xe7\xd3\x74\x6f\x6d\x6d\x32\x1d\x1b\x08\x20\x5b\x9c\x86\x83\x0f\xe1\x65\xb4\xe6\xba\xc2\x0b\x42\x06\xab\xc6\x29\x71\x85\xcc\x10\x40\x4a\xbe\x48\x83\x9f\x16\x57\x13\x78\x37\x51\xd3\x6a\x2d\x33\x02\x65\xcc\x7b\x91\x00\xa9\xc3\x5b\xee\xd3\x74\x14\x4e\x78\x84\x09\x58\xbe\xda\xd9\xda\x89\xf4\x32\x80\xf6\xee\xf9\xb1\x91\xc0\xe2\x2c\x97\x2c\xcf\x8d\x02\x04\xf6\xd7\x83\x54\xfe\xac\xda\xe4\xd9\xc8\x37\x3c\xed\xf7\xfb\x66\x17\x0f\xc1\xd9\xb0\xd3\x6c\x37\xcc\xbb\xbc\x5d\xc3\xdb\xed\x35\xdd\x56\xc2\xa2\x88\xd8\xf6\xfa\xba\x99\x18\xc6\xe1\x72\x96\x2c\xa6\x88\xb2\x64\x02\x3a\xb6\xe9\xe2\x3c\x5d\x6b\xb5\xb6\x77\x5b\x1b\xbb\xdb\x9b\x6b\xd6\xe7\xca\x62\x12\x65\xb2\x5f\x05\x27\xf5\x00\x91\x01\xad\xd9\x5b\x9f\xa2\x61\x03\xbf\xf0\x23\xcb\xf0\x7f\x1f\xcd\xe6\x4c\xeb\xc1\x33\xb0\xc1\x73\x2c\x0b\x86\xbd\x0e\x92\xc1\x60\x31\xbd\xb1\x8e\x76\x00\xe6\xc1\x20\x1a\x8d\x1e\x40\x28\xb5\x58\xd0\x47\x66\x5b\x08\x16\xbc\x95\x23\xc3\x16\xa7\xa0\x37\x4f\x2e\x67\xe1\xf4\x2a\x1e\x04\xbd\x3f\xff\xa4\x20\xa3\x15\x28\x01\x06\x3e\x2b\x5d\x00\x7b\x6b\x80\x9a\x53\xf7\x14\xac\xad\xd1\x74\xe1\x9c\x6c\x7a\x84\xb1\x25\x37\xe5\x70\xd4\x10\xed\x39\x66\x53\x22\x95\x23\xf9\xeb\x57\xe7\xd1\x28\x02\xd1\x20\x9d\xb9\x9a\xe2\xbe\xa4\x71\x1a\x58\xb5\x09\x1a\xb6\xe3\x33\xc0\xca\xef\x6d\x0a\xc4\xf0\x72\x16\xe1\xfe\x00\xb9\x30\x3b\x5f\x5b\x58\x6c\x97\x1a\x0e\x3f\x86\x18\x9e\xe7\xa1\x08\xb5\xd3\x64\x86\xd9\xa8\xcc\xad\x3c\x46\xa7\x68\x33\x23\x8b\x25\x33\xb5\x17\x09\x18\xaa\x86\xe7\xa3\x38\xbd\xa2\x7c\xb4\xe3\x10\xd7\x18\x1c\xbd\x86\xe1\x6c\x98\x52\x86\x6f\x08\xdf\xc2\x1c\x99\xeb\xff\xb5\x30\x43\x6a\x1c\x6e\x7d\x70\xa7\x14\xf7\x0b\x20\x0a\x10\xd1\x64\x37\x49\xb3\x9f\xe6\xa0\xe2\x06\x7f\x49\xc4\x2a\x05\x8b\x91\xf8\x4d\xb0\xb8\x78\x02\x28\xac\x89\x19\xc8\x79\x64\xb8\xdc\x18\xa6\x1a\xa6\x94\xbd\x39\xc5\xe3\x14\xcc\x0c\x85\x49\xed\xc2\x70\xfe\x4a\x78\x60\x4c\x67\x89\xe1\xd4\x9d\x83\xb9\x4c\x05\x42\x24\x01\x55\x58\xd8\xc4\x46\x90\x34\x17\x45\xe6\xbc\x6d\x40\x16\x6f\x37\x4d\xdd\x6b\x2c\x38\x43\x92\x10\x0f\xe2\x39\x7b\xa5\xe3\x69\x4d\x35\xeb\xdd\x40\x7c\xd0\x96\xff\x18\x87\x08\x85\xa6\xe4\x32\x65\x46\x41\x1f\xbc\xde\xbb\x69\x4c\xcf\x83\xa3\xc5\x68\xf4\x16\x5b\x54\xcd\x7b\x3b\x78\x0b\x9c\x7b\xf5\xad\xf9\xed\x49\x38\xba\xe0\xe3\x53\x7d\x52\x23\x7d\xfb\x8b\x70\x06\xda\xba\xea\x8b\xb0\xa6\xd2\xd7\x50\x88\x2f\x7a\x33\xa6\x14\xf4\x8c\xa6\x30\x63\x07\x83\x20\x1c\x9f\xc7\x97\x0b\xd8\xe3\x18\x73\x87\x17\x9a\x80\x87\x64\xb7\x4d\x8b\xc5\x4b\xbd\x80\x88\x6d\x80\x22\x75\x44\xf9\xea\x70\xa3\x0f\xba\x08\x15\xec\xaa\xab\xdd\x1a\x40\x19\x70\x1a\x3e\xb8\x11\x10\xf6\xe0\x2a\x31\x07\xde\xe0\x00\xbc\xa8\xcc\xb5\xb1\xc0\xb4\x3e\x18\x96\x0a\x1c\x29\xcc\x00\xd9\xb7\x15\x0c\xa7\xaf\x0d\x8e\x11\x0a\x98\x80\xcd\x63\x3e\x94\xf4\x2a\x8d\xd1\x08\xcc\x90\xd5\xb9\x21\xbe\x74\xc6\xcd\xe8\xde\x82\x89\xb4\xb9\x9a\xa7\xe8\xf9\x3d\xa0\xa7\x4b\x0f\x92\x5b\xe1\x1e\x42\x32\xc2\x28\xe4\xac\x4c\x69\xe4\x4d\x09\x2d\xcf\x30\x16\x0d\xd8\x1a\x81\xe1\x4d\x68\x2d\x30\xcc\xde\x32\xd4\x61\x06\xee\x3e\x68\xe5\x4d\x51\x75\xd3\x64\xb4\x20\xbd\x28\xc5\x65\xc0\xa1\x48\xff\xec\x67\x35\x8c\xcd\xdb\x2e\xbc\xe1\xd3\xef\x77\x69\x5a\x71\xe0\x2d\xc6\x90\xbb\x5a\x64\x76\x00\x22\x73\x6d\xe0\xbe\x87\xad\x77\x13\x54\x77\x1a\xe7\xf1\xdc\x3e\xc2\x14\x68\xf4\x6c\xe6\xbe\xc9\xa2\xc9\xc3\x00\xec\x9f\xf6\x16\x36\x4e\x60\xdf\xea\x61\x70\x70\x30\x40\xd2\x8f\x86\x1e\x7d\x40\x07\x98\x9e\xe1\x5f\x46\xa6\x57\xf3\x71\x3e\x68\xd2\x75\x85\xc6\xfc\x90\x42\xfb\x66\x6a\x09\xee\x80\xe3\x8f\x85\x9e\x2b\xef\x73\x38\xc1\x23\xd4\xa3\x8d\xd0\xd9\x86\xd0\xc5\x3b\x02\xee\x41\xbd\x2e\x90\x15\x23\x73\x30\xaa\x2f\xa2\xc5\x7c\x06\xa6\x6c\x94\x9d\x2e\xe8\x03\xc5\x02\xa4\x5a\x74\x5b\xcf\x87\xa1\xe1\x5c\x42\xb4\x93\x70\x50\xcd\x30\xd9\x05\x20\xbb\x08\x4d\xb0\xca\xb9\x76\x59\x42\xcd\x77\x1c\x28\x65\xc4\x06\xe6\x09\xf7\x80\x9b\x22\x3a\xf1\x50\x62\xf1\x84\xdc\x42\xe0\xc9\x6e\x29\x1d\xde\x27\x94\x57\xcd\x2e\x06\x10\x30\xa4\x50\xe4\x82\x68\x5d\x6c\xfb\xcf\x83\x93\xe3\xae\x61\x1e\x4d\xe1\x9b\x97\xcf\x5e\x3f\xef\x07\x4f\x5f\x9c\xf6\x7f\x7c\xd5\x7d\xa6\x82\x6f\xc0\x9c\xce\x39\x57\xae\x7a\x31\x0f\xe1\xf2\x83\x20\xc9\x74\x2a\x42\x7f\x81\x2f\x47\x37\xd3\xab\xa6\xcf\xc6\x20\x08\x4b\x77\x1d\xb1\x1f\x47\x78\x12\x0d\x5e\xe3\xcb\x89\x03\xa4\xe8\x17\x4d\x17\xda\x4f\x68\x1d\x3c\xfa\xc8\xc4\x20\x46\x87\x25\x32\x31\x70\x7b\xd4\x09\xba\xac\x6f\x13\x27\xf4\x4a\xcd\x1e\x49\x2f\x0c\x90\xc4\xf0\x91\x1c\xaf\x1a\x96\x01\xbd\x50\x64\x1f\x01\xf9\x46\xc7\x15\x6c\x2a\xd7\x18\x09\xa0\xe8\x26\x73\x24\x99\x83\x71\x18\xee\xd8\x5c\x2a\xa1\xe1\xa4\xc9\xcd\x60\x9c\x50\x8e\x73\x11\xa2\x45\x83\x18\xe5\x33\x84\x60\x7f\xaf\xe9\x8d\xa6\xd6\x4f\x06\x96\x5d\x04\x73\xb3\x78\x07\x18\xb1\x9e\xca\xa2\xdd\x44\x68\xd7\x18\x4e\xd2\x6b\x9a\xc8\x8d\x5c\x53\x37\x92\x10\xd7\xde\x60\x8e\xa1\x94\x9b\x06\xee\xb0\x73\x0c\x48\x49\xb9\x5a\x9a\xc1\x49\x34\x9f\xf3\x32\x2e\xa6\x48\x35\x81\x61\x71\xf3\x97\xe3\x63\xaf\x4a\xb3\x10\xc4\x6a\x14\x5c\xc4\x00\x05\x6d\x3e\x98\xfb\x40\x93\xb6\x19\x0a\xb0\x0c\xa7\x3b\xba\x49\x39\x87\x15\xc6\xdc\x06\x56\x2b\x2c\xe2\x06\x90\x36\x80\x77\x0f\x06\xda\x94\x6a\x8c\xa0\xd0\x9a\x3c\xd7\xf1\x7a\x9d\xdb\xec\x1e\x21\x3e\x76\xec\x71\xf4\x36\x26\x86\xaf\x04\x73\x51\x9b\x8a\x3a\x85\x20\x48\xb3\x02\x0e\x97\x25\x35\xc8\x97\xf2\xef\x6b\x1c\x55\x73\x6d\x3e\x6b\xb7\xd7\x84\xfc\x38\xce\x3f\x68\x34\xcc\xfb\xab\xb5\xdd\x68\x6d\x36\x3a\x5b\x41\x55\x66\xb4\xd9\x6c\xd5\xb8\xf6\x31\xa0\x28\x4d\xd9\x9e\x7b\x01\x81\x32\x07\xe6\xfd\x56\x87\xd7\x8c\xb9\x15\xea\xec\xf4\x08\x4f\xa4\x73\x48\x48\x6a\x5f\x64\x17\xf3\x6b\xe6\x66\x98\xe4\xc0\x1d\x37\xc5\xe4\x8a\x13\x72\x12\x45\x5f\xaa\x08\x2f\x62\xb8\x90\xcd\xf6\x31\x44\x05\x76\x12\x9d\x54\x42\x0b\xdf\x1a\x86\xd0\xc5\x63\x62\x86\x0d\x58\xa8\x16\x47\x6c\xc7\x31\x8b\x2e\x61\xbd\x39\x91\x9d\xea\x5b\x70\x04\x51\x26\xcd\x96\x66\x49\xe4\x9e\xc6\xd9\x60\xd4\x1c\x84\xe3\x66\x38\x68\x2e\x3e\xac\xfd\xcf\xf8\xf2\x43\x67\x73\x6d\x31\x70\x0f\x80\x81\xf7\x92\xf2\x9f\x41\x56\x38\x2d\xec\x0e\x79\xf1\x8c\x16\xe3\x09\x13\x0a\x4a\xcf\xf5\xf4\xe4\xa5\x79\xa8\x6c\x6d\x6c\xb9\x8d\x62\xc9\x1f\xc0\x4a\xe5\x6d\x14\x34\xd8\x6a\x63\xa4\x28\x8a\x59\x94\x47\xa4\x61\xc1\xad\x90\xeb\xa0\xd5\xe4\xa6\x2f\x91\x0f\xe8\xb5\xd6\x7a\x6d\x3c\x24\xb3\x64\xe4\xdd\xae\x06\xe9\x87\xfd\x67\x1c\x58\x29\x0a\x29\xe4\x85\x67\x4a\x0f\xe0\x1a\x6d\x81\xf7\x22\x99\x34\x52\xf3\xb4\xc4\xc3\x09\xf6\x53\x93\xc1\x88\xb8\x07\x73\x31\x9f\x13\x2f\xaa\xe0\x57\xc9\xe5\x14\x02\xf7\xcc\xa3\x4b\x20\x62\xb8\x93\x9e\x4b\x38\x7a\xb3\x07\x9e\xdb\x18\x5c\xd9\x53\x5d\x13\x1f\xb5\xd2\xd9\x9d\xbc\x3c\x3a\x0d\x9e\xfc\xe7\xf1\x93\xfe\x0b\xc2\x48\xf7\xb0\x0c\x23\x6d\x1f\x23\x6c\x5d\x79\xfb\x50\x7b\x17\xa5\xc3\xe3\x39\x00\x1a\xfe\xd2\x7f\xf5\x32\x78\xfb\xf4\xf0\xf4\x09\xdf\x56\x66\x34\xe6\x08\x1d\xdc\x3e\x85\x27\xe1\xe4\xd2\xd0\x93\x3f\x87\xe3\x24\xc0\x98\xfe\xa3\xe0\x63\x72\x1d\x8d\x68\x6d\xc4\xe8\xc5\x70\xe3\x93\x10\x72\x51\x19\xb8\xed\xf6\x56\xab\x01\x3f\x40\x8e\x44\xe0\x79\x24\xe5\x78\xe2\x15\x5b\xca\x9d\x0a\x27\x0d\x8b\xa2\x8a\x81\xdf\x16\xb6\xfa\x48\xe6\x6c\x71\x04\xec\x99\x7d\x85\x5b\x14\x9d\x46\x83\xab\x09\xbe\x11\xd8\x95\xed\x5f\xda\xed\x12\x4c\x30\xc0\x8e\x0c\x35\xcb\x2e\x63\xe0\x62\xb5\x61\xc1\x99\xd1\xb0\x1d\x13\xdf\x4e\x27\x16\x38\x74\xec\x7b\xff\xf5\xc1\xf1\xda\x17\xa3\xf0\x12\x39\xd7\x09\x24\xf2\x27\x32\x72\x53\xb6\x2e\x76\x1c\x28\x62\xc2\x24\xf5\xd9\x2d\xed\x52\x44\x03\xdd\x41\x13\x45\x00\x8c\x27\x7a\x67\x67\x73\xb7\xd1\xc6\xa5\x7b\xfb\xe3\xb3\x0d\xc1\x96\x62\x04\xec\xf5\x90\x3b\x8c\xc2\x36\x96\x8c\xac\xed\x07\x92\xf6\xf9\x5d\x0a\xda\x26\x7a\x14\x1f\x5d\xc2\xf9\xc6\x8a\xe8\x34\x33\x14\xcc\x40\x14\x69\x95\xe1\x3b\x80\x88\xb2\xd5\x15\x87\xb4\xb5\xba\xcb\xee\x5c\xb8\x2e\xbe\xfb\xd2\xc5\x94\x85\x5b\x24\x85\x01\x9c\xd8\xe8\x66\xc1\x71\x32\xba\xb9\x20\x5f\x6e\x53\xb9\x19\x98\xfb\x39\xd2\xe2\xaa\xa1\x61\x27\x47\x70\x43\x37\xc7\xc9\x5f\x0d\x0d\x0a\xf1\x9e\x8a\x26\x8d\xd7\x27\x6b\xc3\xc4\x90\xdc\xb7\xd1\xf9\x9a\x13\x55\xad\xbd\x92\x37\xd0\xda\x8f\x98\xc2\xfb\x3d\x65\xa6\x4d\xd9\xdc\x6e\x4d\x8d\xf3\x5f\xb8\xef\x11\x4e\x15\x03\x8a\xb2\x88\x53\xfb\x1c\xda\xea\x24\x22\xad\x66\x4c\xe6\x82\xc0\x13\xf5\x81\x3c\x1c\x54\x59\x9c\x3c\x8c\xa6\x1e\xfc\x8a\xec\xca\xaf\x6b\xbf\x02\xdf\xfb\x2b\x5d\x3f\xbf\x2e\x26\x7c\x2e\x4c\x39\xd0\xee\x5f\x9d\x52\xc4\x75\xea\xe5\xc5\x62\xa9\x80\xaf\xbb\x40\xed\xd8\x3e\xf9\x7b\xfb\x46\x17\xf0\xae\x3d\x35\x93\x50\x26\xda\x5a\xd2\xcf\xae\x4f\x14\x25\x82\x4d\xf8\xad\x7f\xa2\xad\x40\x91\xb1\x58\x8b\xc8\x0a\x1f\xfe\x6e\xa6\xfa\xeb\x69\x02\x32\x9f\xcb\x68\xf6\xab\x6a\x24\x71\x8c\xad\x90\xe9\x07\x76\xca\x55\x53\xd8\x73\x9a\x60\x17\xcf\xf8\xfe\x3e\xb5\x05\x7f\x2a\x03\xfd\x3c\x82\x74\x56\xc1\xaf\x71\xfa\x22\x7c\xf1\xab\x53\xb6\x30\xf8\x56\x76\x46\x10\x19\x85\x8f\x3b\xf0\x0e\x86\x4f\x68\x24\x17\x0d\x36\xea\x40\x47\xd5\x08\x2e\xcd\x4c\xa7\xdf\x61\xaa\xa7\xc0\x46\x54\x86\x29\x67\x6c\xbf\xe0\xaa\xb3\xcb\x55\xd0\xeb\x8f\x91\x78\x62\xcf\x30\x8c\x08\xeb\xe0\x14\x4a\xe8\x8b\x45\xa4\x56\x24\xe1\x84\x3d\x9c\xa3\xc7\xb2\xc6\x0e\xf4\x31\x70\x06\x2b\xff\xdf\xff\xf3\xff\xa6\xe2\xd2\x30\x93\x50\x5a\x9e\x22\xc9\x0e\x9e\xfa\xfd\x7e\x5f\x8c\x13\xfe\xf4\x27\x2e\xb2\x9a\x30\x28\x02\xdb\xd3\xf8\xf2\xca\x01\xb1\xed\x71\xfd\xbf\x67\xe4\x3c\x0a\xda\x9c\x23\x91\xc4\x20\x21\x99\x02\x64\xe7\xab\x91\x47\x73\x29\x9f\x38\xc0\xcc\xe8\xd1\xb8\x09\x8d\xb9\x47\x63\xe6\x32\xad\x51\x83\x91\x80\x0e\x2d\x3f\x66\x5c\x12\x66\xd6\xcc\x15\x7e\x15\x87\xe9\xf9\xcd\xc4\x3c\x42\x9b\xe7\xd1\x1a\xb8\xd7\xa7\x6b\xff\x65\x08\x46\x8a\x04\xa3\x21\x02\xc4\x7f\xb1\x80\x1a\x70\xf5\x2f\x46\xa1\x86\x28\x6a\x71\x42\x5e\x83\xd1\x59\x33\x84\x0a\x0d\xaa\xcc\x34\x78\x88\x0d\x67\xcf\x91\x33\x29\xf9\x9c\xd9\x39\x92\x03\x09\x60\xb2\x82\xc4\xe9\xc9\x88\x6e\x35\x69\xd3\x1d\xb3\xd7\x8a\x43\x6d\xe1\xe7\x6a\x96\x7e\xd5\x83\x8a\x22\x26\x95\xba\x5a\x99\x0a\xf2\x6e\x95\x3d\x8f\x72\xbb\xaf\x66\x32\x17\xe6\x7a\x9c\xc1\xc5\x65\x2a\x61\x42\x22\xf7\xf5\x7a\x16\xcf\xd5\x17\x99\x57\xb1\x6f\xe0\x32\xa2\x1a\xec\xeb\xfe\x95\x96\xa8\x8a\x7e\x44\x14\xf7\xe6\x1a\x74\x90\x98\x3a\xda\x2c\xec\x5b\xcb\x22\x03\xc9\x73\x57\x59\x93\xab\x36\x4d\x29\xd5\xa1\x54\x81\x7e\x13\xef\x52\xd5\xad\xf8\x43\xa6\xe5\x11\x70\x06\xe2\xd7\xce\xb9\xd9\x31\x30\x7c\xa1\xcc\x4e\xc9\x43\x04\x6c\x01\xb7\xe1\xb2\xe9\x7a\x43\x9b\xdc\x02\xd3\x8d\x54\x01\x93\xe1\x76\x08\xda\x09\xdd\xb3\x12\xee\x75\x62\x58\x71\x50\x69\x8d\xcc\xf5\xc3\xb6\x18\xd1\xec\x23\x08\xd2\xf9\x63\x9a\xe3\xfa\x00\x8a\x04\x81\xc1\x97\xf9\x03\x73\xb0\x21\x71\xf1\x23\xc3\xd0\xed\x1b\x4e\x9c\x7e\x4e\xe8\xa7\x61\x7d\x1b\xc0\x52\x07\xc4\x72\x02\xc3\x19\x20\x57\x1b\x0c\x1e\x38\xc4\x0a\xd7\xbf\x1f\x9c\xe1\xfa\x9e\x81\x55\xc2\x7a\xab\x55\xc7\x9f\x5b\x47\xc1\xbb\x3a\x95\x6d\xec\xac\xd7\xe9\xe7\x96\x2a\xdb\xe1\xb2\xdd\x80\x33\x2d\x62\xf9\xe6\x6e\x1b\xcb\x37\x0f\x0e\x6d\xdd\xcd\x83\x23\x2e\x73\x30\x37\x7b\x5c\xaf\xd7\xf1\xdb\xf7\x36\xb8\x7c\x53\xd5\xdd\xe6\xb2\x6d\x5b\xb6\xc5\xe3\xdc\x6a\xad\x7b\xed\xb7\xda\x5c\xde\x76\xed\xb7\x36\x0e\xa8\x6c\xb3\xef\xca\xb6\xb9\xde\x76\xcb\x6f\x7f\xb8\x45\xe5\xfd\x0d\x57\xb7\xbf\xcd\x65\x3b\xaa\xac\xcb\x65\x87\x5e\xfb\xed\x16\xcd\xd5\xfc\xb4\x75\xb7\xdb\x34\x57\xf3\xd3\x95\xad\x53\xff\xdb\x1b\x5d\xbf\x7d\x97\xfa\xdf\x3e\x68\xb9\xba\x7d\x1a\xff\xf6\xd1\xba\x2d\xdb\x6d\x11\xcc\xdd\x96\x8f\xbf\xdd\xf5\x5e\x9d\x7f\xba\xba\x1b\x5c\x77\x63\x47\x95\x1d\x72\x99\x3f\xfe\xdd\x4d\xae\xbb\xe9\xe6\xbf\xbb\xd5\xa1\xb2\x2d\xd5\xff\x0e\xd7\xdb\x69\xfb\xed\x0f\xb8\xff\x03\xd5\x3f\xaf\xf5\x6e\x4f\xc1\xec\x71\xff\xbd\x4c\xff\x7d\xee\xab\xef\xfa\xea\xf2\x5c\xbb\x38\x57\x2e\xe3\x79\x76\x71\x9e\xae\x7d\x97\xe7\xda\xdd\x50\x75\x37\xb6\xb9\x6c\x47\x95\x1d\x70\x99\xdf\x7f\x97\xf7\x45\x77\xdb\xad\x55\x97\xe7\xda\xdd\x51\x30\x79\x9e\xdd\x83\x4c\xff\x3c\xd7\xae\xda\xbf\x5d\xde\xbf\xdd\x9e\xea\x9f\xe7\xdf\xcd\xcc\xbf\xcb\xf3\xef\xaa\xf9\x1f\xf0\xfc\xcd\x4f\x57\xc6\xf3\x3f\xc8\xcc\xff\x60\xfd\x88\xcb\xdd\xfe\x3b\x60\x9c\x1c\x6c\x28\x98\xbc\xfe\x07\x99\xf9\x1f\x6c\xd2\xfe\x33\x3f\x5d\xdd\x1d\x1a\xd3\x81\x9a\xff\x41\x8f\xf0\x64\x7e\xfa\xed\x79\x5e\x07\x3d\x77\xfe\x7b\xeb\x7d\x2c\xeb\x6d\xb8\x3d\xdd\xdb\xd8\xe2\xb2\x1d\xaf\x7d\x6f\xa3\xcb\xe5\xaa\xfd\xe6\x26\x95\xa9\x31\xf5\x18\xff\xbd\x0c\xfe\x7b\x4c\x6b\x7a\x8a\xd6\xf4\x7a\xdc\x57\x4f\xb5\xef\x71\xfb\x0c\xfe\x7b\x8c\xff\x9e\xc2\xff\x21\xe3\xef\x70\x43\x97\x1d\x72\x99\xdf\xfe\xb0\x47\xe3\x37\x3f\x5d\xdd\x43\x82\x79\x78\xb8\xa1\xca\xb6\xb8\x6c\xcb\x6b\xdf\x5f\xa7\xbe\xcc\x4f\x5b\xb7\xbf\xbe\xc1\x65\x0e\x66\x9f\xf7\x74\x7f\xa3\xef\xb7\x3f\xe0\xf6\x07\xaa\xfd\x01\xb7\x3f\xd8\x55\x65\x07\x5c\xe6\xe3\xaf\xdf\x23\xba\xde\x57\xeb\x77\xd4\xa6\xb2\xa3\xb6\x6b\x7f\xb4\x4e\x6b\x62\x7e\x7a\xed\x8f\xd6\xb7\xb9\x7c\x5b\xd5\xdd\xe5\x32\xd5\x7e\x9b\xc6\x79\xb4\xed\x8f\xff\x68\x87\xf6\xd5\xd1\x8e\xc3\xd5\xd1\xce\x16\x97\x29\x98\xbb\x5c\x6f\x77\xdb\x6f\xbf\xcb\x7d\x29\xfa\x73\xc4\xeb\x7f\xe4\xd6\xbf\xdd\xea\xe0\xfa\xb5\xcd\x85\xa7\xdb\x9b\xbf\x3b\x5c\xde\x71\x75\xd7\xb7\xb8\x6c\x5b\x95\xed\x72\xd9\xae\xdf\x7e\x73\x87\xca\x37\xed\x5c\xe1\x0e\xc6\x32\xb8\x86\xa5\x6c\x7d\x13\xf7\x29\xfc\xf4\xda\x6f\xb7\xa9\xff\xed\xb6\x9d\x7f\x7b\x9b\xc7\xb4\xbd\xae\xca\x36\xb9\x6c\x73\xdd\x6f\xbf\xcd\xe5\xdb\xeb\xae\x2e\xad\xbf\xf9\xb9\xa9\xca\xb6\xb9\xec\xd0\x6f\x4f\xb8\x82\x9f\xae\x6e\x8f\xe6\xba\x7d\xa8\x60\x1e\x1e\x72\x99\xdf\x7e\xa7\x85\xfb\xca\xfc\xb4\xfb\xa7\xbd\xd3\xa5\xf6\xe6\xa7\x2d\xdb\xed\x10\x4e\x76\x3b\xde\xfd\x65\xfe\xde\xe6\xf2\x1d\x57\x97\xe7\xbf\xab\xd6\x64\x97\xf1\xbf\xbb\x7e\xe0\xb5\xef\xb6\xa9\x7d\xb7\xed\xda\x1f\x10\xaf\x60\x7e\xba\xf1\x1f\xd0\x99\x82\x9f\x5e\xfb\x03\x5e\xeb\x03\x77\xd6\xda\x4c\x6b\xdb\x07\xee\x4e\x6d\x1f\x6c\xd0\x98\x0e\x36\xfc\xf1\x1f\x6c\xd1\xfc\x0f\x14\xfe\x0f\x89\x56\xb6\x15\x4d\x68\x1f\x1e\xf5\xa9\xec\xc8\x5b\x7f\x60\xd2\xea\xf4\xd3\xee\x95\x4e\xab\xd3\xa5\xb2\x4e\xdf\x95\xd1\x9e\x32\x3f\xd7\xfd\xf6\x5b\x5c\x77\x4b\xb5\x3f\xe4\xba\x7d\x5b\xb6\xce\x30\xcd\x4f\xaf\xff\xf5\x16\x9d\x1f\xf3\xd3\x8e\xb5\xbb\xd3\x42\x9c\xc0\x4f\x55\x76\xc0\x65\x1e\xfe\xcd\x15\xb9\x49\xe5\x1d\x5b\xf7\xe8\xa0\x8d\x73\x85\x9f\xb6\xac\x4f\x6b\x62\x7e\x7a\xfd\x1f\xf5\x3b\x5c\xde\x59\x77\x75\x8f\x8e\xea\xfc\xd3\x96\x1d\x1d\xe1\x38\xcd\x4f\x7f\xfd\x85\x59\x80\x5f\xdc\x0a\x98\x3f\x36\xa5\x74\x4b\x97\xf6\xa4\xf4\x28\x03\x65\x9d\x8f\x71\x57\xed\x03\xf3\xc7\x91\x94\xba\x93\x7c\xd8\xde\xa2\x2d\x67\x7e\xf1\x69\xc1\xa1\x39\xb1\xfc\xc5\xdd\x9c\xf0\xc7\xa6\x94\x1e\xa8\xd2\x6e\x97\x4b\xbb\xfe\x89\x3a\xec\xf0\x56\x33\xbf\xd8\xf3\x6f\xd0\x47\xf3\xc4\x5f\x54\x29\xa1\xcf\xfc\xb2\xed\xcd\xa8\xdf\x6a\xb7\xf8\x4b\x1b\x76\xc1\xbd\x77\x77\x7f\x99\xdc\xf2\xb6\x2a\x7f\xa2\xa0\x78\xbd\xd1\x0d\x1a\xfc\x56\x69\xf0\x5b\xa5\xc1\x6f\x15\xf7\x28\x09\xd5\x6b\x4c\x3d\x4a\x5a\x5d\xba\x2c\xcc\x4f\x4b\xd4\x0d\xe7\xc6\x65\x1b\xaa\x6c\x9b\xcb\x7c\xa6\xa2\x45\xb8\x85\x9f\xaa\x6e\x9f\xcb\xdc\xa3\xc0\x70\x58\x54\x76\xb0\xe1\xb7\x3f\xd8\xe2\x72\xd5\x9e\x19\x90\x96\x62\x34\x5a\x7c\xd1\xb4\x7a\xfe\xa5\xce\x07\x10\x7e\xba\xba\x87\x3c\xd6\xc3\x1d\x55\xc6\x63\xea\xfb\x4c\x75\xab\xcf\x70\xfb\x8e\x81\x69\xf5\x77\xb8\x4c\x8d\xa9\xcf\x63\xca\x3c\x4a\x5a\x47\xdc\xff\x91\xea\xff\xa8\xc3\x65\xeb\xaa\x8c\xc7\x74\xd4\xcd\xb4\x67\xb8\x47\x3d\x55\x97\xc7\x7a\xe4\xf0\xd7\x66\x46\xb5\xdd\xf2\xc7\xdf\xe6\x07\x50\x5b\x3d\x80\xda\xed\x75\x2e\x5b\x57\x65\x07\x5c\x76\xe0\xb7\xef\xd0\xfc\xdb\x1d\xc7\x00\xb4\x3b\x5c\xb7\x73\xe0\xca\x98\x79\x6a\xaf\xfb\x8f\xc2\x36\x9d\x66\xf8\xa9\xea\x12\xa3\xd8\x56\x0f\x85\xf6\xc6\x06\x97\xf9\xeb\xdf\xde\xe0\xf6\x1b\xaa\x2f\x66\x00\xdb\x8a\x51\x6d\xd3\xa5\x6c\x7e\x66\xfa\xdf\xe2\xf1\x6f\xa9\xf1\x6f\xf1\xf8\xb7\x14\xcc\x1e\xe1\xd4\xfc\xf4\xdb\xf3\xfe\x69\xab\xfd\xd3\x66\xa6\xd2\xfc\x54\x65\x3c\xfe\xc3\xcc\xf8\x99\xd9\x6c\x1f\x6e\xa9\xba\x3c\x27\xb5\xff\xda\x87\x5d\x2e\xeb\x66\xda\xf7\xb8\xdc\xad\x7f\x87\x1f\x8a\xe6\xa7\x2b\xdb\xe2\xb2\x2d\x7f\xfd\x3b\xfc\xa8\xef\xa8\x07\x60\x87\x1f\x45\x1d\xf5\xa8\xef\x10\xa3\x61\x7e\x1e\x64\xda\x1f\x72\xb9\xc3\x75\x87\x71\xd2\x51\x38\xe9\xf0\x9c\x3a\x87\x99\xf6\x87\xdc\xfe\x50\xb7\x3f\xe2\x32\x77\x7e\xd7\x59\x78\xb1\xde\xf5\xc7\xbf\xde\x5d\xe7\x72\xc7\xc0\xae\x33\xa3\xbd\xde\x73\xf3\x5f\xef\x71\xbd\x9e\x2f\x14\xd9\xe0\x73\xb1\xa1\x1e\x70\x1b\x2c\xa8\xd8\xd8\x50\x82\x16\xc6\xe9\xc6\x66\xdb\xbf\xd4\xdb\x7c\x81\xb7\x5b\xee\x52\xa7\xf3\x63\x7e\x6e\xa9\xb2\x1d\x2e\xdb\xcd\xb4\xef\x71\xf9\xa1\x62\x2a\x18\x66\xa7\xa3\xca\x36\xb8\x6c\xdb\x6f\xbf\xce\x75\xd7\x55\xff\xc4\x94\x99\x9f\xeb\xaa\x6c\x93\xcb\x36\x33\xed\x99\xa9\x59\x3f\x50\x75\xfb\x5c\xa6\x98\x9a\x6d\xee\x7f\x7b\xc3\x6f\xbf\x7d\xc4\xe5\x8a\xa9\xa1\x47\xb9\xf9\xb9\xe1\xca\xba\x3c\xcf\xae\xf7\xa8\xe9\x18\x2e\xbd\xce\x3f\x6d\xdd\x36\x71\x04\xf0\x53\x95\xed\x72\x99\x8f\x3f\xa6\x55\x1d\x45\xab\xcc\xef\x5b\x5c\xe6\xf0\xdf\xee\xd0\x98\xda\x3e\x53\xdb\x61\xfa\x05\x3f\x55\xdd\x03\x2e\x73\x38\x31\x74\x83\xca\x36\xfd\xf9\xb7\x37\xb9\xae\x13\x60\x75\xf8\x51\xd1\x51\xf4\xa3\xd3\xde\xe6\xb2\xed\xcc\xf8\x77\xb9\x7c\x77\xd7\xd5\x3d\xa0\xbd\xd2\x3e\x50\x65\x44\x53\x3a\x44\x53\x54\x7b\xa2\x2b\x9d\xb6\x7b\xc0\x76\xda\x24\x14\x83\x9f\xb6\xac\x43\x3c\x06\xfc\xf4\xda\x9b\x0d\xc5\xe5\xeb\xaa\xee\x36\x97\xed\xa8\xb2\x03\x2e\x3b\xc8\xb4\x3f\xe2\x72\xb7\xfe\x1d\xba\x53\xe0\xa7\x2a\xdb\xe4\x32\x7f\xff\x75\xda\x5d\x2e\xef\xaa\xba\x87\x54\xd6\x71\x7b\xba\xd3\x59\xe7\x32\x9f\xa9\xee\x74\x18\x6e\x67\x53\xd5\xe5\xf1\x77\x7a\xaa\xac\xcf\x65\x7d\xbf\x3d\x3d\x36\xcc\x4f\x85\x2b\x7a\x54\x98\x9f\xee\x4c\x76\xe8\x9e\x81\x9f\x7e\xfb\x0d\xae\xbb\xa1\xfa\xda\x64\x9c\x6e\xba\xf3\xdb\xe1\x3d\x91\xa1\xbf\xe6\x6f\xee\x7f\x4b\xf5\xcf\x0f\x85\x8e\xda\x3f\x9d\x2d\x1e\xff\x96\xff\x28\xe9\xec\x70\x5f\x3b\x6a\xfd\xe8\x51\x6e\x7e\x2a\x98\xbb\x8c\xa7\xdd\x0c\xfe\xe9\x51\x01\x3f\x5d\xdd\x2e\xd7\xed\x2a\x9c\x1e\xf0\x3a\x1f\xf8\xfd\xaf\xd3\xa3\x18\x7e\xda\xba\x1b\x3c\xd7\x8d\xbe\x83\xb9\x41\x82\xd2\xce\xe6\x86\xbf\x7f\x36\x37\xa9\xee\xa6\x7b\x94\x75\x36\x77\xb8\x6c\xc7\xed\xa9\xcd\x5d\xea\x67\x33\x33\xfe\xcd\x2e\xd7\x75\xfc\xa7\xf9\x7d\x9d\xcb\x5c\xff\x9b\x07\xdc\xfe\xc0\xdf\x3f\x9b\xc4\x3f\x9a\x9f\xdb\xaa\x6e\x8f\xcb\xdc\xfa\x6f\xf6\xb8\x9f\x9e\xbf\x7e\x9b\x3d\x6e\xef\x04\x88\xe6\x77\x9e\x6b\xef\x40\x95\xd1\xfa\x6d\x1e\x66\xda\xf7\x79\x5c\x7d\x87\xeb\xcd\xfe\x11\x97\xb9\xf9\x6f\x31\x4d\xdc\x6a\x79\xfc\xab\xf9\x7b\x97\xcb\x77\x55\xdd\x3e\x97\xa9\xf6\x6d\xda\x67\x5b\x99\xf3\xb7\xc5\xf7\x8f\xf9\xa9\xea\x72\x7b\xf7\x28\x34\xdb\x94\xe6\xbf\xb5\xe1\xd3\x8f\x2d\x7a\x01\xc1\x4f\x57\x97\xd7\x7f\x6b\xab\xad\xca\xd6\xb9\x2c\xd3\x3f\xbd\xd0\xcc\xcf\xae\xaa\xcb\x63\xda\x3a\x54\x65\x47\x5c\xe6\xef\xbf\xed\x75\xa2\x15\xdb\xea\xac\x6e\x6f\xd3\x9a\x6c\xbb\x3b\x09\xde\x62\x50\x76\xb4\xe3\x3f\xea\xc1\x49\xaf\xce\x3f\xa5\xee\x51\x4b\x2a\xeb\x52\x54\x4c\x92\xb0\xa0\x45\xe5\xf4\x50\x23\x6b\x8f\x83\x78\x02\x76\x1e\x69\x14\xce\x06\x57\x64\x85\xcb\xba\x67\x50\x3a\x5f\xc6\x60\xd8\xbc\xc8\xb9\x34\xa0\x42\x18\x34\x4a\x91\x56\x5a\xe5\xa2\xe9\x45\xb3\xcb\x68\xf6\x39\x58\x0c\xd2\xa0\x5b\x00\x45\xbb\xe1\x58\x97\x59\x1b\x24\xf2\x74\xb6\x88\xfc\x71\x2c\xef\xff\x31\xe9\xda\xc4\x7d\x16\x03\x9f\x5e\xc7\xa9\xca\x60\x6c\x1e\x83\x71\x7a\x82\xad\xb4\x3f\xf4\x20\xb5\x11\x91\xba\x8b\x4f\xf1\x28\x06\x84\x78\x6e\xe5\xe7\x1e\x92\xe2\x89\x7d\xc3\x06\xa8\x19\x95\x9c\xb8\xe3\x18\x22\xc4\x19\x54\x8f\x43\xb0\x59\xc8\x2a\xc5\x24\x1a\x6c\x83\x7c\x0f\xa9\xc5\xd0\xc6\xed\x07\x2c\x7d\x97\x6b\x74\xd6\x7a\x67\xfe\x0f\x46\x0b\xf0\xfd\xfb\xfc\x77\xd3\xd7\xbb\xb3\xf6\x3b\x2f\x71\x32\x2b\x1d\xad\xfb\x1f\x8c\xe7\xfb\x7d\x18\x9f\x28\x95\x4d\xc7\x66\x84\xcf\xc3\xf9\x55\xf3\x62\x94\x24\xb3\x6a\x15\x06\xff\x08\x46\x5e\x0b\xd6\x82\x8e\xf2\xcb\x2d\xeb\x37\x1e\x62\xbf\x56\xf5\x4b\xb3\x07\xc0\x8f\x0a\x9c\x2b\x4b\x66\x87\x50\x5a\x1a\x0a\xa2\x0e\xa0\x34\x32\x50\x7e\xf3\x35\xe9\x2e\x2d\xa9\x0d\x3a\xeb\xcf\x5e\xc7\x68\x2d\x5e\x56\xdc\xea\x28\x92\x58\x61\xb7\x83\xa4\x02\x61\x95\x2b\x6d\xff\xc6\xfb\xbf\x48\x76\x82\x1e\x20\x7a\x44\x6a\xe7\x67\x35\xd3\xb9\x03\x50\xbe\x87\xad\x0c\xe5\x2e\x7b\xd8\x36\x2a\xd9\xc3\xee\xfb\xdf\x76\x0f\xab\x7e\xbf\x62\x0f\x67\xa0\xfc\xe1\x7b\xf8\x50\xf2\x7f\x16\xda\x10\x17\x6c\x92\xa2\xfd\x78\xf7\xed\x68\x5b\x9d\xae\xde\xab\xdd\x73\x50\x2a\x66\x0b\xf9\xed\x06\x28\x2d\x35\x9d\x10\x6c\xf2\x38\xb2\x00\x5f\x61\x03\x5b\x1b\x81\x02\x26\x3d\x3c\x97\xb4\x3d\x8c\xd3\x59\x59\xf3\xaf\xc2\xb8\xb5\x58\x17\xd3\x11\xa0\x2d\xb7\xd2\x8d\x5c\xfa\xbe\xbf\xe7\x42\xe5\x71\x53\x76\x55\x62\xa6\x11\xa0\xa2\xe4\x51\x95\xb7\x60\x6d\x2a\x9a\xb0\x8f\xc1\x9a\x0a\x16\x45\x0c\x78\x1e\x7b\x04\x64\x1d\x13\x1b\xd0\xa9\x45\xc7\xff\x0b\x30\x0c\xa3\x6f\xad\x4f\x61\xab\x56\x04\x4a\x5b\xf5\x48\xf2\x34\x88\x5d\x3a\x06\xb3\x36\x18\x68\xf7\xa4\xf7\xf4\x69\xc9\x00\xbf\xc3\x5e\x3c\xb0\x6d\x01\x72\x90\xbd\xfd\xc9\xc2\xb7\xd4\xae\xa6\xe9\xef\x6d\x66\x39\x10\x79\x5e\x07\x2d\xe9\x80\xf2\x53\x87\xb3\x19\xc4\x99\xa4\x14\xd5\x30\x26\xb6\xa9\x0d\x95\x31\x7d\x52\x6a\xbd\xdf\x74\xb4\xa3\xcd\x21\x9b\x1d\xfe\xda\x6d\x34\xad\x23\xe2\x43\xf3\xa5\xe2\xcd\x0b\x40\xb4\xfe\x67\x86\xa3\x8d\xd0\xc1\xf9\xb2\xa9\x4c\xce\x99\x7e\xd1\x9a\xe2\xf3\xa9\xb3\x2b\x84\x5d\x0a\x42\x53\xc0\xf5\xdc\x10\x3a\xd1\x4e\xcb\x2e\x22\x14\x84\x1b\x83\x0b\x3b\x26\x82\x78\x1f\xca\xd7\x5b\xeb\x17\x35\x7f\x54\x10\x0f\xe0\xcf\x3f\x05\xcd\x66\x33\xf8\xcf\x38\x07\x39\x1c\xb4\x7c\xc8\xc3\xed\x70\x9d\x20\xb8\xc9\x9c\xdc\x8c\x46\xb0\x6a\x69\xae\xf9\xc5\x6e\xa6\xf9\x45\x78\x71\x61\x9b\x43\xbf\x3d\xcf\xa3\xf2\xa9\x38\x4b\x17\x80\x8a\xda\x19\x50\x51\x7b\xd7\x82\x7a\x03\x61\xc8\xc1\x0a\x1e\x4c\x0e\x8b\x1a\xaf\x67\x1b\x6f\x2d\x1b\xc7\x51\x31\x94\x8b\xec\x6c\x2e\xb6\x5a\x16\x0a\x58\xef\x13\x4d\x28\x6b\x1d\x65\x5b\x47\x5b\xb5\xc2\xe5\xc4\x58\x25\xba\x6a\x07\xa2\x41\x15\xd6\x5d\xcf\xd5\x5d\xc7\xba\x14\x29\x82\xe3\xb6\xee\x05\xd1\x38\xf9\xaf\x58\x9b\xab\x2f\xd2\x05\xba\x0e\x8a\xbf\x15\xf1\xfb\x18\xe6\x29\x1e\xfa\x6e\xa1\x23\xa0\xbb\x97\x57\x04\x4e\xf1\x45\x34\x59\x48\x6d\x1d\xa4\xe1\x0d\x9e\x27\x70\xa9\x6a\x06\x27\xe4\xa0\x06\xc7\x6e\x38\xc4\x0a\x31\x3a\x7b\xa4\x36\xe9\x61\x34\xfe\xe1\xeb\x2e\x83\xec\x25\xe0\x7c\x33\xff\xb7\x5f\x02\xaf\x56\xb8\x01\x3c\x02\xa7\x2f\xee\x3c\x9d\x2b\xb3\x65\x7c\xac\xf8\x9d\x95\xef\xe8\x2f\x58\x12\x17\x16\xeb\x5e\x41\xa8\x6b\x08\xe4\xd4\xcd\xd6\xb9\x23\x3e\xb3\x81\xb7\xcc\x4c\x4c\x51\x8e\xf3\xf1\x82\x2e\xb1\xe7\xf0\xec\x23\x5b\xa0\xde\x1a\x7a\xc9\x0b\x7c\xaa\x42\x0f\x62\x28\x1d\x67\x57\x6b\xe3\xe9\x5c\x73\xf7\x59\xd4\xe6\x62\xeb\xc1\x52\x52\xe5\xef\xe4\x92\xb6\xeb\xd2\x60\xfe\xd5\x0c\xf3\xd1\x3e\x81\xe4\x46\xf0\x77\x35\x13\x93\xd0\x1c\x6b\x43\xb2\x7e\x30\x37\xd0\x1e\xc5\xbd\xd1\x2c\xed\xec\xa3\xb7\x7a\x62\x47\x9f\x2e\xce\xd9\x33\x81\xd3\x9a\xf2\x16\x25\x64\x27\x17\x17\xa0\xee\xf5\x77\xaf\x5a\x87\x65\xab\xea\x87\xe7\xba\x8c\xe6\xaa\x2f\x70\x1e\x6d\x16\x9e\x37\xb2\xb3\x3f\x15\x8b\x7b\x72\x66\xd3\x63\xc9\xc2\x2a\x06\x03\x41\xca\x09\xa9\x65\x5b\xc7\x03\xe0\xed\xba\x54\x47\x0d\xd3\xb5\xdc\xee\xc2\xd2\xcc\xde\xe2\xdc\x31\x75\xd7\xb7\x4a\x90\x09\x5f\x30\xf6\x7e\x3d\x88\x26\x43\xfe\xed\xda\x1e\x43\xdc\x7b\xae\x12\x3d\x01\xaf\xad\x81\xb4\x6a\x9f\x89\x07\xe6\x3e\xb8\xc0\x60\xd4\xee\x51\xc1\xd6\xcb\x04\xd6\x72\x8d\x6b\xb9\xbd\xf8\x3d\x81\x96\xfd\x78\x3e\x8b\xc2\x0f\x76\x4b\x41\x35\x87\x61\xc3\x37\x58\x8f\x0d\x2f\x61\xbb\xcc\x94\x12\x77\x59\x04\xb8\x79\xdd\xb3\x3c\x86\xad\xaa\xa7\x07\x97\x96\x9c\x0c\xdb\x9d\x6a\xb4\xf2\x44\x05\x7a\xad\xe6\xd0\x6f\xf0\x95\x9f\xb3\x5b\xba\x7b\xfe\xb8\x24\x42\x93\xe4\xc9\x87\x24\x45\xb2\x35\xaa\x45\xab\x5b\xcb\x9e\x3f\xd7\x44\xe3\x3d\x77\x26\x4b\xce\x23\x1d\x0b\x72\xf2\x1c\xfa\x27\xe2\x6f\x7f\x06\x8b\x5b\xc1\xc0\x4e\x31\xea\xf6\xb0\xb0\xc5\x17\x9d\xb1\x4c\x62\x5d\x7d\xcc\x4c\x3f\x5e\x1c\x45\xaf\x5d\xb6\x66\xd0\xe0\xfd\x8c\x08\x87\xaa\xb3\x88\x42\x52\x35\x0d\x07\x52\xad\x70\x1c\x2c\xb3\x67\x26\x97\xd1\x28\xb9\x5c\x63\x57\xe4\x4a\x3d\xa8\xcc\xa3\x4f\xf3\xb5\xe9\x28\x8c\xcd\x5f\xf7\x2a\xed\xe6\x2e\x24\x65\xa9\x54\xee\xd5\x38\x57\xf0\x2d\x90\x86\xe1\x3c\xca\x83\x81\x98\x5a\xe8\xd3\xbd\xad\xa0\x65\xa3\x73\x5d\xc1\x0d\x0b\xc1\xb9\xf0\x97\x7f\xf4\x14\x01\x88\xab\xf9\x30\x9a\x22\x92\x9a\x27\xf3\x64\x16\x5e\x46\x95\x9a\x3b\x00\xff\x06\x0d\x13\x0e\xb7\x0f\x41\x48\x47\xe1\x8c\xbd\xb6\x09\x03\x0f\x31\x7d\x0e\x71\xa2\x94\xc2\x65\x1c\x41\x80\x9d\x78\x00\xb1\x5f\x20\x66\xc1\x02\x53\x9c\xc5\x92\x8b\x06\xb2\x42\x81\x97\x6a\x92\x04\xe9\x18\xa3\xcc\x40\x70\x51\xc4\x84\xf9\x49\x79\x52\x87\x38\x5e\xce\xae\x0d\xd4\x1a\xfb\xb2\x7e\x30\xce\xb1\x1c\xd3\x41\x61\xf0\x8f\xc9\x30\xb9\x0e\xae\x12\x8a\xe8\x41\x43\xbb\xe7\x47\xcf\x82\xab\x2a\x4c\x83\x29\x7b\x8d\x51\x1d\x78\xce\x55\x6b\xcd\x40\xa5\xa7\x83\xda\x13\xf3\x6b\x6c\x86\x3e\x31\x63\xc7\xf8\x29\x10\x72\xc7\x14\xfd\xd5\x06\xf0\xa2\x5c\xd9\x34\x42\x02\x45\x63\x00\x9f\x43\x97\x80\x56\xb2\xae\x84\x33\x7c\xad\xaa\x84\x21\x1c\x58\xc5\xe5\x60\xe2\x80\x39\x18\xb0\x55\xf2\x2a\xfc\x35\x49\xc6\xda\x37\x97\x67\xf4\x9f\xc9\x02\xd7\x5b\xd2\x33\x60\xa6\x26\x43\x2d\x6f\xcc\xbe\xa1\xd4\x68\xc9\x00\x06\x6b\xf0\xc8\x3d\xea\x71\x02\x50\x1e\x90\xcb\xf3\x5b\xf9\xcb\xcb\x97\xcf\xe1\xde\x30\x0f\xe3\x7f\x55\x41\xdb\x0e\x66\x71\x74\x11\x90\xb5\xda\x8d\x1d\xbf\x8d\x0a\x43\xc3\x85\x73\x04\xc3\x1c\x24\x53\x8e\x9e\x84\xfc\xe7\x28\x9e\x9e\x27\x86\x63\xb5\x89\x6c\x6f\xc0\x19\x3a\x84\x44\x33\xf1\x5c\x02\xb8\x08\x1f\x7f\xf0\xac\xdb\xfb\x29\x38\xe9\x3d\x3d\x39\x79\xf9\xea\x44\x85\x87\xc0\xd8\x10\x37\x34\x63\x0e\x9e\x71\x87\x49\xeb\x0d\x80\x71\x28\xb2\x43\x37\x43\xa8\x10\x7a\x1b\x76\xc0\x0d\xf3\x2a\x32\x67\xab\xa2\x82\x0a\xe1\x26\xf0\x16\x42\xd0\x09\x75\x2f\x6e\x80\x04\x28\x6c\xfe\xbc\xe8\x6c\xb7\x3a\x80\x47\xbb\x5b\x01\x47\xe9\x15\x0c\x34\x86\x08\x29\x66\xcb\x7f\x98\x27\xd3\x00\x9b\x73\x30\x30\x1b\x7e\x43\x76\x03\x86\xc6\x88\x46\x23\xb3\x3f\x0d\xc4\xce\x16\x85\xee\xb5\x38\xeb\x3f\xfd\xf1\xc9\xe9\x93\xe0\xc5\xcb\xd3\x7e\x3d\xf8\xd7\xea\x3c\x9e\x43\xec\x30\x3f\x15\x2f\xe0\xca\xc6\xaf\xb2\xbb\x0c\xab\xea\x59\xf0\x70\x5e\xa8\xd1\x9c\x42\x1d\x9e\x0c\xe8\xf4\x6c\x07\xf4\xb7\xda\x24\xcf\xd8\xb0\x11\x83\x09\xf3\x59\xc5\xe8\x11\xe9\x22\xe6\x43\x82\xaf\x3c\x2a\x34\x2b\x3b\x81\xf0\x38\x1c\x12\x85\x53\xcb\x4b\x12\xff\x1b\x74\x91\xa6\x68\x62\x9c\x6f\x78\xb6\x98\x4c\xec\x5d\x44\xc3\x05\x40\x87\xd1\x14\x2d\x18\x2b\x54\x74\x32\x98\x25\xa3\xd1\x71\x32\xa3\x84\x9e\x29\x10\x78\xfb\x25\x8a\x26\x52\x7a\x2f\xc8\xfd\xe3\x7a\xa7\x8c\x9d\x6c\xfb\x37\xa7\xb7\xb7\x35\x75\x7a\xe1\xc4\x10\x69\xaa\xf9\xce\x27\x53\x84\x12\x20\x22\xf6\xe2\x84\x48\xca\x97\x71\x8a\x09\xba\x69\x23\xd3\xc5\x45\x65\x4f\x89\x2c\x65\x36\x30\xe7\xd1\x1a\x2e\xf0\x12\x86\xfa\xb1\x57\x4f\x18\x00\xe9\xc3\x30\xdd\x13\x80\x44\x31\x38\x44\xd1\xe3\xda\x05\xd7\x18\x34\x61\x81\xc1\x86\x0c\xcd\x4b\x3e\x44\x78\x2a\x44\x63\x98\xa1\x7a\x78\xc2\x5d\xfa\xe1\xb5\x7b\xb9\x11\x13\x32\x0c\xe6\x5c\x4a\x23\x1c\x00\x71\x05\x76\x04\xc9\xe4\x2d\xd2\xca\x2a\x91\x4c\xe1\x50\x0b\xc8\x28\xfd\xd1\x04\x32\x4f\xdc\x9e\x4a\x19\x4c\xa0\xeb\x41\xcb\x31\x76\xaa\x87\xd3\xf0\xbc\x3a\x0f\xcf\xbd\x0c\x99\xe1\x39\xf1\xaf\x08\x13\x92\x38\x8f\x95\xaf\x33\xfd\xcd\xdd\x63\x06\x38\x68\xc0\x7f\x3f\x1d\xd6\x91\xa4\xd7\xed\xd8\x8b\xbd\x3d\x25\xe7\xce\xec\xd2\x54\x0a\x6b\x7b\x76\xe9\x30\xb2\x20\x48\x57\x80\xf3\x59\x4c\x29\xbc\x4b\xf0\xb1\x0d\xb1\x7c\x2a\x29\xc6\x2b\x83\x00\x89\xe6\xe3\x94\x28\x97\x80\x7b\x1e\xde\x9c\x47\x81\x87\x94\xca\x24\x99\x18\xe2\x74\x2d\xa1\x8e\x30\x85\xb5\x0a\x2f\x86\x49\xbf\x6d\xb4\x1c\x81\x55\x80\x5d\x03\x08\xc2\x1f\xd9\x88\xe5\xa5\xc8\xcd\xe4\xb1\xbc\x2f\x34\x03\x89\x39\x73\x0d\xfa\x35\x4e\xf9\xcb\x26\xe1\xc7\xf8\x12\xf2\x38\x36\x0d\xd7\x31\xeb\x5e\x42\x04\x22\xce\x66\xf6\x73\x8a\xcc\x51\xf4\xf3\x5a\xf5\xe7\xe1\xcf\xc3\xda\x9a\x4a\x3a\x2a\xc1\xaf\xf7\x39\xa3\x99\xd9\xd4\x69\xf4\x74\x32\xaf\x52\x6a\x33\xf0\x9e\x97\x47\x38\x3d\x14\xd4\x72\x62\xa0\x63\x5a\xc8\x94\x86\x95\x2f\x69\x42\x06\x6f\x25\x68\xb5\x1d\x7e\x1f\x74\x54\x56\xd2\xa2\x39\xc2\xa4\x38\x34\x38\x97\x34\x69\x1e\xd5\x82\x2e\x8a\x77\xc8\x8a\x60\x21\x25\xdd\xa8\x9a\x45\x3e\xa7\xff\xe1\xce\xcc\xf6\x4c\x25\x73\x53\x36\xd6\x44\xc0\xf1\x4d\x87\xb0\x31\x52\x0e\x38\x64\x0e\xee\x60\x4e\xea\x5d\x02\x66\xee\xce\x0a\xc6\x6d\xd2\xb5\xe9\x8e\x31\x2c\x1b\x90\xff\xf0\x1a\xe3\xe8\x89\x42\x3f\x4e\x8f\xb9\x66\xd7\x54\xdc\x77\x3a\xc9\x65\x2b\x31\x03\x36\xaa\xa8\x04\x0e\xd9\xf3\x70\x12\x5f\x18\x9a\xa9\xb7\xcf\x98\xcb\xc0\x3f\xba\xb4\x41\x55\x6d\x99\xec\xb0\x04\x40\x13\xa6\x63\xba\xd5\x7f\x37\xdd\x59\xf3\x5e\xcf\x1e\x0c\x15\xd1\xfb\x58\x23\x12\x59\x57\x0c\xf2\xa6\x18\x89\xd8\x31\x6c\xb0\x24\xcd\x3c\xa1\x22\x92\x41\x49\xcd\x89\x8c\xfc\x06\x24\x6d\x2f\xa8\x4c\x93\xe9\x62\x5a\xf9\x5c\xb3\x64\x4c\xef\x96\x65\x48\x85\x9e\xbc\x14\xba\xb0\x31\x20\xa3\x21\xa7\xa8\xa2\x3c\x8b\x50\x42\x7c\x16\x10\x3f\xbc\x63\xcd\xea\x3e\xe0\x3c\x56\x20\x4a\xa6\xbb\xf5\x01\x65\x48\xc5\xf8\x66\x02\xd0\xb0\x03\xe3\x04\x2e\x76\x08\x07\x34\xa0\x94\xa2\x86\x20\xfa\xe4\x12\x27\xec\xba\xad\x22\xe1\x2d\xde\xf9\x2b\x62\x84\x69\x92\x43\x89\xec\xff\xcf\xb5\x5c\x62\x4d\x08\xc4\x06\xf1\xdb\x7e\x13\xe1\xe1\x55\x84\xcf\xb0\xcf\x4c\x5f\xe9\xa5\x3e\x34\x4c\xf4\x84\x85\xc3\xc2\x40\xc0\x90\x47\xb1\x19\xf1\x09\xc5\xf8\xb0\x17\x96\xa9\xec\xbd\x61\xcd\xdf\x50\x19\x53\x93\x18\x44\x51\xa3\x57\xe6\x1c\x55\x0b\x53\x7d\xca\x88\x54\xdc\xc0\x55\x46\x91\x93\x8c\xde\x61\x18\x4d\x16\xc2\x94\x0f\x86\xb1\xb2\xf2\x68\x9e\x50\xfd\x2f\x1c\x0e\xf5\xe6\x8d\x07\xb8\xe3\x4c\x02\xb5\x51\x64\xf3\x5d\xa3\xec\xef\xc6\x30\x11\xe3\xfc\x9b\x41\x58\x9a\x27\xa7\xcf\x9f\x1d\x9a\x5d\x08\x31\x7d\x38\x03\x04\xff\xe5\xf2\xd2\x79\x40\x21\xde\x9a\x9e\x1c\xfc\x7d\x22\x15\x4e\x93\x9e\x74\xe4\xcf\x92\x40\x66\x13\x7e\x4a\x79\x33\xfa\x14\x0d\x7a\xc9\xd8\x90\x93\x61\xb5\x02\x10\x2b\x7e\xee\xcf\x8b\xd8\x3c\x18\x92\x4f\x7d\xc9\x76\xa8\xc8\xc8\xd3\xcb\x49\x32\xa3\x4c\x7a\xcd\xe0\xe8\x28\x28\xc8\xe2\xca\xb6\x2d\xc0\x27\x84\xf4\x05\x62\xd7\x70\x2c\x4d\xab\xcf\x09\x38\x0a\x89\x52\xe2\x60\x62\x63\x6d\x27\xd1\xcc\x6a\xee\x8f\xc3\x74\x1e\x15\x22\x9a\x02\x45\x61\x6e\x36\x8a\x98\x44\xf8\xc4\x13\x7f\x87\x45\x80\xb4\xe5\xd8\x07\x80\xd3\x78\xc7\xd2\x23\x88\x9a\xfe\xf5\x18\x47\x58\xff\x28\x28\x87\x18\xc1\xf3\xd9\x02\x62\x53\xf2\xc9\xe3\xd7\x08\x10\x1c\x88\x4e\xe9\x36\xf9\x53\x8e\xe6\x99\x5a\x09\x10\x86\x28\xa5\x50\x57\xd3\xc5\xf9\x28\x1e\x04\x90\xae\x65\xed\x1a\xb3\xb7\x8e\x23\x08\x27\x94\x8a\xe2\x8f\x63\xb1\xd2\xb1\x2b\xd5\x9a\x39\xd1\xbb\x92\xb9\xc7\xa9\x1a\x49\xbe\x0d\xd3\x0d\x7c\xc1\xd0\xaf\xf9\x56\xb2\xce\x59\x3a\xea\x11\x64\x95\x9c\x53\x44\xcd\x56\x72\x8c\xa5\x57\x42\x71\x0a\x88\x47\x77\x88\xc8\x76\x51\x80\xdd\x6c\x0b\xc6\x73\xcb\xe4\x81\xcf\xfa\x22\x04\x40\xc3\x95\x90\xa0\x42\xbd\xcc\xa2\xf4\x0f\xc3\x0a\x93\xf8\x10\x09\x5d\x19\x1e\x44\xb6\xeb\x46\x07\x89\x94\x71\x2a\x6e\xd1\x6c\x2c\x59\x47\x48\x21\x67\xb1\xc5\x35\x06\x24\xb3\x9b\xab\x64\xaa\x83\x91\x79\x93\xe4\x73\x6a\xf2\x00\xfc\x1e\xab\x6e\xca\x75\x3d\x51\xff\x42\x3d\x61\x75\x18\x23\x81\xe2\x5f\xea\x85\xb3\xe3\xb6\xe1\xbc\x25\xb9\xbf\x1a\x61\x66\x47\x68\x44\x20\x37\x84\x89\x04\x30\x9a\x90\x5c\x1a\x56\x0a\x5f\x32\x53\x60\x63\x12\x3d\x53\x80\x53\xb0\x94\x50\xdc\x2c\x59\x4f\xfc\x56\xb0\xa8\x68\x42\x04\x79\x7a\x72\x13\x71\xb3\x05\x29\x14\xc6\xac\x47\xb2\x8d\x62\xad\x15\xa7\x59\x06\xb2\x99\x37\xb7\x54\xd6\x96\xe7\xa6\x9d\xad\xca\x34\xc9\xdf\x24\x6b\x34\x93\xfa\x52\x73\xe3\x42\x5c\xe2\x44\xd2\x62\x64\x8a\x45\xa0\xc2\xa9\x46\x2a\xb0\xc2\x1e\x52\xcb\xb1\x6a\x8f\x0a\x6b\x2f\x6c\xf8\xdd\x70\xae\x93\x2c\x69\x74\x14\x6a\x46\x6c\x0a\x72\xe2\xa3\x29\xb7\x7e\xcc\xd2\xf0\x32\xd2\xe4\x64\x29\x0e\x7a\x09\x36\xe6\xc9\x49\x4e\xbd\xe2\xe1\xa2\x72\xe6\xda\xa9\x64\xf5\xac\x74\x0b\x40\x62\x25\x65\x3c\x08\x4c\x7f\xff\x78\x95\x6b\xe9\x55\x72\xdd\x4b\x46\xdf\xee\x62\xc2\x2c\xd0\x56\x31\xe6\x49\xb2\x08\x06\xc5\x89\x8c\xf0\xd6\xad\x80\x80\xf9\x62\x94\x5c\x57\x02\x30\x9d\xb3\x11\x14\x41\x5b\x81\xa2\x29\x52\x0b\x58\x21\x61\x40\xa2\x60\x89\xf4\x0f\x21\x4d\xcf\x21\xd3\xc2\x38\x1c\x62\x83\x71\xc2\x9b\x94\x73\x1b\xb0\xe6\x4b\xb2\x5b\x93\x4a\x8c\xd5\xce\x00\x28\x25\x09\x61\x20\x09\x92\x21\xb8\x2e\x67\xcd\xba\x8e\x20\xf0\x6b\x21\x38\xd6\x7d\xc3\x87\x51\x88\xa1\xef\xa0\x18\xe0\x89\x42\x1b\xc1\xa2\x00\x3b\x65\x6a\x26\x13\x85\x79\x42\x3a\x7f\xee\x8d\x12\xe9\x32\x78\x18\x3d\x30\x3f\x48\x78\x79\x18\xf4\x2a\x1a\xdd\x90\x38\x1c\x02\x03\xcb\xe4\x81\xf3\x82\x20\x9b\x48\x64\x95\x09\x10\xe4\xd9\xa6\x74\x02\xb3\xb5\x11\xc6\xff\xc4\x50\x6b\xa5\x77\x24\x06\x4c\xbc\x8a\xf0\xe7\x2a\x77\x23\x23\x41\x29\xf3\x97\xb4\xb2\x36\xdc\xa0\xce\xb5\x38\xb0\x89\xd4\xf9\xb3\x2c\xb4\x3d\x63\x80\x31\xda\x98\x72\x8c\x60\xa9\xa5\xbd\x2f\x87\xe7\x0d\xac\xce\x8e\x99\x49\x9d\xc7\x56\xf7\x3a\x56\xd4\x1a\x66\xbb\x0f\x73\xb6\x44\x9a\x27\xb3\xcf\x2d\x6d\xb9\x1d\xf5\x7e\x70\xff\xbe\x86\x56\xc6\xac\xf8\x27\x60\x55\x56\x45\x96\x01\x56\xf3\x0b\x96\x02\x37\xc1\xff\x9e\xe5\x50\xd4\x0d\xcf\xe4\xdf\x79\x75\xbe\x80\x69\xa2\x79\xf8\x6c\x13\x6f\xb5\x12\xc6\x89\xd7\x1d\x60\x39\xe2\x57\x8a\x96\x55\x19\x27\x6a\x58\x15\xb4\xd4\x35\x3a\xea\x3e\x0e\x8a\xf9\xa8\x92\xed\x78\x1b\x17\xc5\x03\x2e\x64\x30\x04\x37\xab\x72\x52\xb9\xc9\xdf\xc6\x4b\xd1\xfa\xe3\xbd\x5e\xb8\x09\xf0\x4b\xf9\x4e\xc0\xcf\x85\x1b\xa1\x98\xd1\xca\xae\xeb\xea\xac\x56\x1e\x13\xe5\x60\xbf\x82\xdd\x32\x48\x58\x93\x25\xbf\x9d\xd9\xca\xa1\x7b\x05\x76\xab\xea\xf0\xee\x10\x6f\x79\x2d\x41\xbc\x87\x79\x2d\x4a\xcf\xad\x41\x66\x11\x0a\x65\x66\x7f\x2c\x63\x56\xbc\xef\x97\xb1\x65\x39\xbc\xdd\xca\x98\x55\x85\x33\xa3\xa6\x8a\x37\x83\xde\x7d\xce\x8c\xc7\x21\x85\xa5\xa8\x43\xd6\xad\x56\x98\x22\xce\x37\x42\x79\x7f\x61\x36\x62\xf4\x4f\x66\x8a\x72\xa1\x8d\x50\x8e\x30\xee\xec\x70\x16\x5e\x58\xc3\x47\xf4\x25\xbb\x00\x3b\x00\x9b\x65\x4b\xeb\xb7\x61\xc1\x21\x5f\x52\x3c\x1b\xa2\xc1\x07\xe8\xfd\xc3\x51\x72\x99\xd5\xa8\xce\x40\xc2\x03\x7c\x18\xe4\xc1\xb6\x37\xb7\x80\x69\x7c\x4f\xad\x02\x90\xf3\xcf\xc0\x48\x24\xb1\x1a\xd0\x00\x95\x6b\x94\x03\x23\xaa\x18\x4c\x62\xfa\x0a\x4e\xe4\x3a\x20\x89\x55\xe3\x7b\x3b\x20\x0b\x01\x10\x84\xe9\x04\xe8\x64\x43\x5e\x8a\x01\xd8\xc7\x60\x0c\xdf\x87\xf9\x96\x76\x0c\x09\xa8\x1c\x66\x40\x5e\x6d\x1d\xfe\x02\x7f\x83\x49\x00\x9e\x1a\xcb\xba\x07\xf1\x38\xbc\x24\x5b\x60\xcb\x73\x63\xc7\x64\x07\x15\x40\xa6\x16\xd4\xf5\xa3\x1e\x80\x8d\x21\x5c\xba\x58\x3f\x04\xba\x7d\x35\x60\xd8\xe3\xeb\x00\xb7\x9c\x35\x57\x20\x91\xb2\x8c\x38\x43\x21\x2d\x0a\x7e\xf3\xb5\xec\x24\x40\x34\x75\x50\x7c\x28\x95\xe8\x06\xd1\xcc\xca\x62\x36\xf2\xd3\xc6\x42\x01\xe4\xad\x48\x42\xbb\xb5\xe8\x04\xa8\x46\xc8\x01\x4c\x29\x8b\xd8\x6f\x14\x2d\xf8\xb3\xe3\x6f\xe4\x8b\x8c\x9f\x9a\x07\x98\xc8\xc5\x46\x8e\xf7\xd9\x99\x23\x9c\xb0\xa6\x9c\x3c\xe2\x3a\x8c\xa7\xae\x3b\x54\xf7\x97\x54\x7a\x0f\x97\x11\xff\x6e\x2f\xaa\x61\xfc\x51\x97\xe3\xdf\xf6\x23\x4c\x72\x1f\x40\xbb\x7b\x8d\x07\xbd\xef\x4d\xee\xf7\xdf\xd1\x26\x8a\xeb\xc4\x38\x93\xf7\xd6\xfe\xc8\xde\x97\x94\xd7\x77\x96\xfb\xc2\x96\x32\xbd\x2b\xb0\x5d\x18\xb9\xcf\x8a\x48\x3f\xa1\x7c\xc3\x5c\x53\xa5\x2d\x8c\x2d\xd6\x3d\x24\x29\xba\x99\x4c\xd8\x24\xe6\xbd\xc6\x5c\xe4\xec\xe5\xa3\x26\x26\xb2\x06\x0b\x32\xb0\x3d\xaa\xc4\xd3\x41\x03\x8c\x0e\x1a\xc9\x87\x8a\x08\x72\xd1\xd5\xc6\x50\x0c\xb3\xd3\xab\x95\xd7\x13\xb2\x31\x11\x43\x24\x1c\x0c\x8e\x63\xcf\x90\x53\x02\x57\xd3\x76\xa1\x56\xc5\x87\xd3\x35\x77\xcb\x50\xf6\xdf\xd3\xc9\x45\xf2\x9e\x94\x88\x45\xa8\x68\x82\x2a\xb5\x6d\xa6\x30\xb6\x56\x3d\xb4\x0c\x32\x27\xd2\x5d\xd9\x98\xf1\xfc\xf1\x99\xd9\x95\x19\xcd\x10\x29\x47\xc0\x76\x02\xf4\xf5\x40\x40\x67\x94\x4e\x39\x4e\xeb\xe6\x98\x5e\x2e\x0c\x3c\x7b\x6a\xe7\x98\x84\x0a\x32\x8e\x4b\xf8\x7c\xcc\x59\x3e\x45\x1a\x9b\xce\x21\xf2\x57\x4a\x6f\xc0\xa7\x95\x31\x6b\x7d\xc5\x7a\x86\x0c\x02\xfc\xac\x53\x20\xdb\x16\xfa\x66\x16\xe6\x3c\x3c\x1f\xdd\x48\x68\x79\x88\xd1\x3f\x8d\xc2\x0f\x4c\x57\x28\x27\x15\x58\x53\xd1\xa1\x4c\x57\x5a\xda\xcc\x9d\x98\xdf\x38\xb4\x4d\x02\x42\x0d\xe5\x9c\x5e\x0e\x18\xea\xbd\xcf\x5f\xb5\x65\xfb\xd5\x50\xa3\xe7\x5e\xe9\x57\xac\xe9\xfb\xa2\x45\x2d\x06\x82\xb6\xab\xaa\x2b\x3e\x7a\x4d\x4e\xb5\xc4\xfa\xcd\x69\x92\xce\x19\xb6\xa4\xcc\xff\x0d\x76\xfb\x9e\xdb\xeb\x66\xdf\x86\xb3\xcb\x8f\x7b\xc1\xd9\x6f\xdc\x13\xd8\x30\xed\x95\xf7\xdd\xf9\xfc\xee\xb3\x58\x22\x9d\x95\xd7\x7a\x57\xb7\x94\xa4\x78\x3f\x8e\xc3\x1b\x7f\x37\xde\xbe\x2c\xe5\x8b\x7d\x82\x09\xf9\xbc\xcb\x33\x36\x07\x4c\x5b\x3c\xae\x46\x33\x72\x47\x34\xbf\x13\x90\x3f\x00\xf5\x63\x77\x00\x6a\x9c\x67\xe0\xd0\x06\xa4\xc9\x65\xa7\x18\x49\x91\xd3\x90\xe3\x04\xf5\x72\x54\xbc\x81\x9a\x55\x38\xfb\xcd\xf1\x62\xa1\x0f\x79\x2f\xb0\x10\x95\x0d\x18\x18\xa7\x91\x21\x81\xe1\xf9\x92\xd9\x5e\x86\xe6\xc3\x08\x8f\xfc\x2a\xd5\x9a\x6a\xee\xec\x10\x4a\x9b\x1f\xf8\x55\xbc\xe6\x24\x2c\x2a\x6d\xda\x73\x9f\xbd\x66\x17\x09\xe9\xbc\x8b\x47\x4b\xdf\x72\x0d\x8e\xc2\x71\x3c\xba\x29\x6b\x42\x5f\x33\x73\x4b\xa3\xd7\xaf\x9e\xed\xb9\xb5\x32\x7f\x55\x2b\x6b\x95\x9a\xe2\x77\x3f\xbf\xb3\x7f\x88\xa2\x5f\x9d\x3f\x7f\xd3\xbe\x06\xeb\x8a\x81\x61\x33\x3f\xb0\x00\x0f\xf2\x2a\x45\x40\x08\xe7\x68\xee\xe5\xee\x71\xd0\x7a\x27\x33\xcb\x0b\x95\x6f\xe8\x1e\x40\xe8\x11\xc8\x32\x7a\x83\xbd\xe4\xe8\x79\x92\x32\x57\x75\xeb\x6e\xa6\x51\xe6\x60\xa3\x11\x55\xf6\x6a\x36\x57\x79\xb6\xac\x49\x94\xf8\x85\xe1\xbe\x7d\x37\xa4\xc7\xf7\xf2\x77\xbb\xaa\xdc\x9c\x45\x20\x6e\xe9\x5d\xc5\x23\xc2\xa6\xaa\xa6\x6f\xab\x9e\x9e\xde\x57\xd2\x87\x5e\xc1\x54\x33\x04\xc2\x30\x8f\x77\xa6\x07\xea\xc8\x6a\xe0\x40\x44\x89\x70\x66\x31\x9a\x21\x86\x84\x37\xca\x07\x03\x77\x05\xe5\x83\xa9\x08\xc8\x01\x55\xb3\x26\x54\xd1\x3c\x58\x4c\x9b\xf8\xf8\x58\x4a\xfe\x35\x25\x61\x8a\xee\x86\xb4\x87\xff\xfd\x9c\x91\xc3\x40\x96\x5b\x4c\x94\xf5\x94\x19\x4f\xbd\x81\xee\xb1\xa5\x28\xdf\x96\xe9\x6c\x20\x43\x02\x3e\x37\x62\x53\x74\x6a\xc4\xa6\x3d\xd6\x20\x74\x29\x39\xbd\x42\x49\x48\x66\xff\x51\xa2\x95\xd1\x05\x5f\x80\x8f\x7d\xdb\xc9\xe9\x9c\xd1\xcb\x56\x6a\x6f\xc0\x2c\x5e\x1b\x52\x22\xbf\x16\x4f\x10\x84\xf0\xa5\x19\x37\x39\xfd\xe9\x0c\xea\xbf\x7b\x7c\x4f\xb1\x65\x1e\x68\xcb\xa3\x15\x0d\x4b\xb2\xfc\xe8\x93\xe2\xc4\x11\x45\x07\x25\xc3\x37\x46\xb4\xe0\xc4\xc0\x87\x23\x50\x57\xdc\x04\x1f\xe3\x34\x86\x0c\x1e\xc5\xbc\x22\x7a\x1c\x98\x7a\xd1\xcc\x5a\xc2\x54\xda\x5b\xd3\x4f\x95\xc7\xf2\xd5\xf0\xea\xac\xf0\x2e\x30\x27\xaa\x5a\xf6\xbe\x66\x1b\x88\x56\x10\x90\x5b\xc1\x3f\xcc\x8d\xb3\xb5\x41\x16\x4e\xd4\x1f\xf7\x84\x35\xe8\x2f\x53\x65\x63\xc7\x55\x19\x51\x3e\xfb\x2a\x77\xce\x7a\x9f\x46\xc0\x9e\x6d\x6b\xe4\x61\x08\x35\xc1\xb0\x5c\x55\x64\xd8\x0d\xab\x77\xc6\xaa\x32\x15\x31\xe1\xd8\xcf\x92\x77\xf9\xf2\xde\xd6\xb5\x08\x97\xca\xde\xcb\xc2\x1a\x6d\x0c\x0c\x92\xe7\x51\x9f\xde\x51\xd5\x8a\x19\x06\x21\xda\xd6\x6e\xa2\xd4\xa0\x39\x48\x53\x34\x8b\x37\x43\xe5\xdd\x53\x91\x1c\x49\xe6\x08\x9d\x63\x6e\xdc\xe8\xb1\x13\x92\x54\xd8\xe6\x6e\x2f\x68\x5c\x47\xe7\x1f\xcc\x3b\xe1\x62\x14\x7d\xd2\x15\x74\x79\x83\xd8\x5a\x04\xc6\x32\x42\x55\xd3\xa0\x68\x2f\x68\xb7\xfe\x55\x97\x01\x82\xf7\x82\x0d\xaf\x0c\x91\xbb\x17\xec\xfa\x35\x09\x91\x7b\xc1\x8e\x5f\x7c\x9e\x7c\x6a\xa4\x57\xa1\xe1\xfc\xf6\x82\x96\xf9\x5f\x67\xfa\xc9\x09\x7e\x96\x33\x06\x20\xef\xf1\x41\xcd\xcc\xfe\xdb\xbb\x2b\x08\x48\x28\x1c\x0f\x1f\x57\xdc\xce\xa3\x8d\xbc\xca\xf2\x50\xcd\xf2\xb5\x59\x19\xfb\x9c\xfc\xb8\xc1\xbc\xf0\x5e\x80\xcb\x61\x2e\x80\x22\x14\xc2\xe4\xbc\xc3\x96\x45\x84\xe5\x81\x0c\x3c\x64\x76\xbe\x10\xa3\x4b\x5b\xe7\x38\xad\x6c\x6b\x60\x83\x1a\x29\x32\x4e\x40\x0a\x72\x9f\x2e\x98\x45\x2a\x1b\x9c\x63\x93\x32\x47\x01\xc5\x2d\x43\xba\xaa\x09\x0f\x35\x4b\xf8\x50\xc6\xab\x2c\x9a\x5e\x60\x32\x51\x2b\xb7\xd0\x3c\x10\xd9\x65\xc2\x82\x33\x4f\xb4\xc2\x82\x07\xd2\xd6\x5c\x7b\xdd\x39\x27\x23\xad\x56\x66\x86\x6c\x82\x70\x92\x3e\x66\xab\x96\xec\x0e\x83\x87\x71\x08\x66\xef\x0d\x3c\x59\x8d\x75\x0f\x47\xee\xeb\x8c\x56\x3d\xf7\x99\xd8\xd9\xbd\x60\x9a\xa0\x68\xef\x71\xa6\x5b\x70\x31\xea\xd1\x76\x62\x97\x94\xb0\x73\x51\xf1\xaa\x84\xc3\x61\x1f\x5e\x97\xcf\xf8\x9d\x5c\xad\x20\xbf\x58\xa9\x7b\xdc\x8e\x30\x7c\x3e\xa7\x09\x60\x78\xfb\xeb\xf5\x20\xc8\x35\xef\x62\xe0\x1b\x7a\x3f\x2b\x71\x29\xc3\x36\xd5\xa0\xe9\x30\xbb\x93\x4c\x46\xf4\x98\x52\x42\x83\xec\xd3\x93\xab\x7e\xfd\x61\x84\x72\xb3\x67\x0b\x68\x1a\xba\x7a\x79\x9d\x79\xdb\xc0\xf0\x20\x15\xef\x0d\x59\x56\x2f\x0a\xc7\x90\xef\x1a\x2a\xcf\x0c\xa3\x50\xbe\xbd\xa9\xb9\xe2\xad\xe0\x8e\xf4\x6a\xd8\x76\x2b\x09\xbe\x3f\x44\x37\x64\x2c\xfa\xcf\x23\xfb\x26\x76\xe2\x27\x99\x98\xf9\xe5\x79\x38\xd5\xb2\x70\xf9\x14\x5c\xa1\x78\xc5\x06\xb5\x02\x09\x2d\xe6\xb8\x4c\x26\xa6\xca\x43\x12\xb4\x50\x96\x54\xf2\xec\x81\x2f\x6f\x4e\xcd\x37\xd3\x2f\x38\xfa\xf0\x9b\x29\x4c\xd3\x64\x00\x5e\x23\x64\xe7\xe5\x89\x68\x95\x34\x96\x58\xf8\x08\xa5\xdc\x7b\xc1\xd9\x7f\x9c\xf6\x5f\x3d\x7f\x07\xee\x94\xd6\x43\x0e\xe7\xfa\x71\x6e\xd6\xa2\x58\x45\xe6\xcb\x7d\x33\x5d\xa8\x61\x88\x36\xd5\x60\xdc\xae\xaf\x62\x70\xed\xfc\x0b\x64\xb1\x2e\x14\x93\x93\x2c\x7f\x9c\x93\xae\x60\x3a\x8b\x28\xbc\x87\x4f\x9d\x3d\xc1\xac\x6b\x6c\x6d\x61\x23\xf0\x8f\x70\xe6\xf2\x83\x70\x3a\x27\xef\x2b\x19\x9b\x20\xda\xd0\x64\x0b\x5c\xbe\x31\x0d\x70\x62\x55\xd5\x01\xb4\x92\x35\x4c\x29\xda\x91\xcb\x7f\x8e\xc8\x24\xa7\x0d\xb3\x46\xb1\xa1\xe9\xb8\x99\x80\xdd\x87\xeb\x30\xad\x07\x69\xf8\x11\x56\x0c\xc0\xa5\xf8\x94\xba\xe1\xad\x07\xce\x81\xa0\xd3\x42\x4f\x31\x4e\xf5\x0c\x6f\x41\x8f\x34\xd6\x49\xde\xcf\x71\x64\x86\x76\xe0\x32\x9e\xf7\x36\x33\x40\x10\x9c\x55\xce\x47\x8b\x99\xa3\xa2\x07\xe6\x2f\x4d\xac\xde\x59\x59\x54\xc5\xcc\xdb\xb0\x3e\x13\x57\xd7\x2c\xd6\xa1\x29\x28\xaf\x0e\xfa\xbe\xd4\xab\x7f\x0c\x25\xe5\x0d\x16\x53\xaf\xf6\xeb\x69\x49\x55\xb8\x2f\x9e\x4e\xa6\x8b\xb9\xab\x7e\x2a\x45\x5e\x13\xd3\x82\x9e\x26\x78\xbe\x02\x7e\x86\x89\x9d\xba\xe9\xd1\xbc\x83\xa7\x78\xb9\x9a\x2d\xe8\xd6\xd7\x9c\x4a\x16\x3e\x16\x9e\x58\xa1\xe3\xd2\x02\x3a\x04\x75\x51\x71\x9b\x03\xfe\xaa\x5a\xd9\xd1\x80\xaf\xd7\x5e\x70\x18\xa7\x18\x62\x0b\x0c\x7f\xba\xa3\xf9\x8f\x33\xc8\x43\x8b\xa7\x65\xbc\x98\x5c\x8a\x97\xd7\xc3\x60\x30\x9f\x8d\x1a\xe1\xc8\x5c\xb0\x5d\x4c\x79\x1b\xf4\x4c\xc1\x23\xd3\xc2\x3c\x1a\xc3\x49\x4a\x6d\xb9\x2e\x70\xbb\x5e\x5d\x7c\x5f\x14\xd7\x45\x52\xe9\x55\x26\x42\x5b\x58\xdb\xe2\x29\x84\xb2\xe7\x40\x3e\xc5\x69\xcd\x9f\xdb\xd3\x0b\x4a\xad\x68\xde\xc6\xb1\x19\xcb\x53\x43\x45\x67\xac\x1d\xbb\x40\xcf\xf0\x2b\xd4\xcf\x89\xb0\x40\x9c\x6c\x30\x81\x35\xda\x82\x37\x2d\x1c\xe4\x94\x30\x41\x3f\xac\x19\x93\x38\x84\x74\x8e\xd2\x70\x6b\xa9\x05\x2e\xe2\x99\x61\xa6\xd0\x3b\x75\x4e\x76\xf2\xfb\x1c\x87\xb0\x70\xac\x57\xc9\x38\x5a\x8b\xd0\x1a\x75\x34\xb2\x61\xc7\x3c\xed\x63\x8a\xae\xa8\xe7\xe0\x08\x07\x1e\xf1\x00\xde\x36\x23\x68\xd8\x16\x44\x9d\xd8\xf0\xcd\x29\x0c\x1a\xee\x99\x14\x64\xf5\x3c\x1b\xf8\x34\x71\xdd\xa5\x28\x61\x35\x55\xb1\x1e\x59\x98\x00\x28\x1f\x3c\xf7\x9d\x66\xa6\x08\x9f\x81\xf4\x93\x93\xac\xca\xc2\xa8\x66\x78\x82\x0f\x64\x03\xf9\xdc\x90\x8b\x3a\xdb\xc8\x23\xaf\x09\x2e\x89\xc1\x62\xba\x86\x3f\xe1\x84\x67\xa0\x43\xf9\x6d\xd0\x2d\xfe\x60\x47\x36\x8e\x47\x8b\x74\xed\x79\x3c\x31\xff\xfd\x4b\x34\x4b\x04\x8d\x29\x7a\xbc\xe7\x56\x15\x9b\xd0\x1e\x59\xda\x90\x6b\xe2\x67\xc6\xd7\x2f\xef\xeb\x04\xcd\x75\x8b\xed\x86\x89\x0d\x7d\xe5\xcf\x05\x4e\x10\x54\x43\x20\x50\xf5\x2f\xe0\x83\x5f\xb4\x23\xf0\x68\xf5\xc8\xe9\x3d\x45\x47\x02\x9c\x1f\xf7\xdb\x83\x0d\x07\x9b\x0d\xbe\x58\x0f\x01\x69\x86\x93\x31\x8d\x8b\x2a\x13\x18\x07\x56\x35\xf6\x46\xd9\x43\xaf\x9a\x42\x64\x63\x1f\x6f\xe8\x8c\xe4\x87\xf6\x66\x85\xa1\xbd\x29\xac\x4c\x60\x1c\xd8\xb2\xa1\xbd\x91\x73\x54\x30\xb6\x3e\xba\xd0\xaf\x0d\x85\xa2\x4d\xa7\x23\x71\x7f\x87\x0b\x21\x1c\x12\x3c\xa1\xc5\x71\xca\x0a\x6b\x36\xb3\x0d\x6f\xcc\x5d\x3a\x8e\x0c\xeb\x84\x07\x1d\xaf\x4d\x3c\xdf\x56\x2f\xa9\xb8\x06\x8f\x18\xb9\x8e\x7e\xc2\x7e\x56\x1a\x1e\xb2\x48\x6a\x88\xd6\x44\x73\x18\xdd\x3a\x4e\xae\xfb\xc5\xc3\x24\x11\xfe\x2d\xc7\x09\x09\x23\xf0\x04\x18\x81\x83\x7d\xea\x91\xb2\x1c\x9c\x04\xd5\xca\xcf\x9f\x5a\x3b\xa0\x61\xfa\x10\x06\xbf\x3c\x81\x38\x17\x2f\xc5\x52\x88\xe0\xf8\xcd\xe1\xba\xd3\x20\x4c\xf3\xed\x8b\x4a\x66\x84\xb6\x3a\xea\x7c\x0e\x6c\xe3\xc2\x71\x52\xf8\x19\x4a\x32\x2c\x82\x4b\x20\x29\xa0\xa8\xbd\x8d\x2e\x5b\x63\xd6\xbe\x00\x30\xd7\xc8\x62\x7e\xd1\xd8\xc9\xdc\x23\x60\xe2\x66\xf3\xd4\x5e\x81\xae\xda\x00\xc7\xb9\xe0\x1e\x0e\xc1\x82\x17\xdb\x47\xa9\x61\xe0\x22\x30\xa5\x80\x74\xeb\x7e\x6f\xd0\x08\x67\xd4\xa7\x4a\x45\x47\x5e\x77\x04\xf5\x1b\x6f\xc8\xc1\x52\x0c\x8b\x93\xa2\x69\xc0\xc7\xe7\xa6\xf2\x9b\x62\x2a\x22\x04\x4c\xc4\xc3\xe6\xd2\xc4\xb1\xa3\x0d\x32\xb0\x63\xde\x81\xe0\x29\x34\xe9\x1f\x4b\xd5\x27\x41\xff\xa4\x87\xc1\x2a\xe2\x4f\x7c\x94\x29\x08\x69\x53\xea\x75\x87\xc3\xa0\xdd\xd9\x11\x64\x2f\x26\x78\x6b\x98\x21\xbb\xf0\x79\x21\x18\x5a\x05\x9f\xe6\x14\x39\x05\x61\xf0\x85\xdb\x30\xc3\x31\x30\xde\x86\xf1\xdc\x8a\x1e\x84\x77\x63\x46\x16\xef\xb9\x08\xa2\x07\xb0\x99\xa8\xdc\xd5\xe0\x2c\x25\xe0\xfc\x7f\x55\x3c\x33\xd7\x09\xe8\xba\xaf\x93\xd9\x07\xc3\x03\x9b\xbb\xc3\x1c\x31\xf3\xac\x9d\x63\x44\x48\x76\x9a\x57\xe0\x0a\x01\x05\xd3\x68\x46\xf5\x43\x1b\x5f\x24\x74\x31\xad\x31\x20\x0d\x20\x35\x35\xdc\x2e\x3c\x54\xd2\x66\x2d\x7b\x72\xcd\x83\x16\xad\x5c\x31\x42\xc8\x18\x2c\xab\x67\x29\xb1\xc8\xd0\xd0\x54\x30\xe4\xc0\x54\x18\xf0\xf1\xc5\xfd\x55\x35\x9f\x9e\xe2\xc2\x06\x71\x4a\xb0\x88\x1c\xd6\x72\x4c\x10\x6e\xab\xb7\x80\x1a\xb3\x81\x69\x01\x6f\xd9\xc1\xb2\x09\xcc\x3c\x52\xe2\x77\x64\x4f\xd7\xd1\x64\xcd\xec\x67\x78\xa6\x4e\x67\xc9\x70\x81\xc1\x56\x71\xb9\x99\x07\xf4\xe2\xae\xda\x79\x82\x7d\xa1\x59\x7e\x8a\x60\x52\x17\x16\x03\x03\xd1\x50\x09\x3c\x51\xa0\x20\x5c\xcc\x13\x72\x15\x77\x36\xa1\xb2\x26\x79\x06\x8f\x51\x70\x0b\x91\x9a\xa1\x35\x5e\xc2\x2e\xe8\xc1\x61\xff\x19\x4e\x8f\xdf\x4e\x36\x28\x10\x62\xd7\x00\x6d\x38\x92\x94\x4c\xf8\x9c\x90\x03\xb4\x79\xc3\x7f\x64\x1b\x94\x10\x81\x5b\x58\xb8\x1d\xf5\x8c\x9d\x48\xcf\x30\xad\x6c\xd8\x05\x6e\xe8\x10\x2e\x68\x16\xc3\x7a\x43\x34\x07\x07\xb8\x9e\xe9\x19\x34\x2d\x20\x9b\x60\x3e\xcb\x8c\xde\x74\x65\x8e\x1c\xd4\x86\x80\x06\xa4\x21\x33\xec\x25\x58\x4c\xdd\xb8\x67\x2b\x99\x67\xa0\x45\xa6\xad\x72\x31\x5b\x18\x9e\x94\x5e\xd9\x44\x76\xc1\x50\x11\x8c\x32\xe2\xf1\x34\x49\x51\x19\x81\xf8\x49\x88\xae\xd8\x51\x34\x11\x89\x57\xd4\x23\x2f\x5e\x4a\xaf\x63\x38\xef\xcc\xdc\x5c\xe3\x77\xc4\x48\x3c\xf8\x80\xa7\x1c\x0e\x93\x8f\x21\x3a\xaf\x79\x14\xef\x59\x1c\x7b\xc5\x75\x80\xca\x7c\x6a\xe4\x6d\xca\xcb\x04\x99\xc0\x3a\x31\xa8\x10\xc2\x2c\x94\x3e\x88\xf1\xd6\x73\x64\xd7\x0d\x59\x64\x3a\x4e\xa0\xd7\xc2\xe1\x18\xe2\x86\x62\x05\x4e\x58\x3f\x98\x9d\x2f\x2e\x21\x18\xfe\x5a\x7b\x7b\x63\xa3\xdd\x0a\xf2\xfb\xcd\xde\x37\xb4\xf1\x6e\xb9\x7e\x5e\x33\x59\xfe\x10\x45\x53\x83\x0c\x53\x59\x0c\x08\xe5\x85\x07\x73\xc6\xab\x62\x8e\x91\x33\xac\xeb\xc9\x24\x1a\x80\x7a\x0f\x22\xe4\x27\x33\x77\x57\x2e\x1b\x81\x8b\x16\x44\x3c\x34\x52\x45\x21\x98\xf6\x2d\x44\xb0\x5c\x5d\x34\x0a\x24\x6b\xc4\x10\xbc\x42\xcc\x9e\xa3\xbd\x44\xd4\x0f\xfc\x61\x44\x29\x02\x36\x44\x66\xd4\xe9\x14\x72\xed\x13\x29\x27\x68\x0f\x20\xf6\x11\xd4\x78\x00\x24\x01\xb3\xe1\xcb\x3c\xed\x31\xcb\xa3\x52\x5e\xdb\xd1\xd0\x46\xdc\x2c\x60\xd7\xed\xb9\x1b\x47\xc3\x38\x24\x6e\x46\x1e\x56\x74\x3e\x78\x28\xf1\x2c\x38\x42\x54\x82\x54\xe1\x63\x38\xb2\x7d\x06\xfd\xe6\x65\x33\x78\x00\x88\x7a\x50\xd0\xf4\xa8\xdd\xd4\xbc\x3e\xf5\xc7\x26\x92\x68\x41\x24\x8f\xba\xdc\x85\x6d\xc6\x03\xcf\x8e\xee\x2c\x3a\x82\x9f\xc5\x5b\xe0\x49\x32\x62\xcb\x14\x83\xf3\x8f\x71\xb2\x50\xe4\xfe\x22\xf0\xa8\x33\x52\xfc\xc3\x7e\xef\xa4\x7f\x1a\x60\xce\x59\x72\x41\x32\x7b\xf4\x2d\x46\xc5\x01\x70\xe6\xf3\xab\x13\xff\x73\xdd\x87\x62\x39\xc1\x21\x72\x56\xd6\x78\x9c\xa4\x39\xb8\xd2\xfc\xb4\x5f\xa0\x90\x26\x59\xe4\x38\x06\x1e\x68\x57\x81\x2d\xb4\xcd\x3b\xe1\x30\xbd\x88\x28\x8c\x20\x48\xfc\x66\x0f\x9f\x88\x18\x67\xca\xca\xa9\x46\xe1\x0d\xf5\x94\x13\xa5\xc1\x2f\xdd\x81\x58\x17\xfe\xe6\x71\x27\xf0\x0c\x87\xe1\x98\xc5\x3c\x94\xbb\x15\xee\xfa\x79\x32\x3d\x36\x3b\x2d\xbc\xd4\x81\xab\x48\x64\xa7\x58\x02\x7e\x62\x11\xac\xc8\x7b\x2b\xf4\xba\x2f\x7a\xfd\x67\x7b\x28\x0e\x21\xeb\xce\x6a\x85\xca\x2a\xb5\x7a\x86\x85\x04\x62\x27\x77\x3c\x2c\xa4\xdc\xf2\xce\xdc\x77\xe0\x85\xcf\x02\x7e\x05\xdf\xd1\x18\xb4\x82\x44\xb0\x04\x4b\xa2\x4b\x48\x0b\x96\xb0\x65\xe4\x06\xd6\x0e\x1d\x05\x0d\xe0\x5c\x85\x6f\x01\xbc\x7d\x2d\x28\x1d\xe4\xbe\x44\xcc\xe0\x8d\x01\xdc\x3c\xf8\x4c\x9a\xd7\x03\xd8\xa7\x33\x59\xa1\xa1\xa4\x75\x5f\x86\x80\x40\x79\xd6\xf8\x85\x46\x6e\x07\x7e\x01\x3d\x57\xf9\xee\xb8\xa9\x59\x02\x4e\xe1\x95\xe3\xb9\xc7\x34\x36\xe4\x16\x61\x20\xc2\x0a\x51\x04\xc6\x94\xe8\x4d\xef\xe4\x29\x8d\xc1\x7e\x95\x89\x85\xe8\xd4\x24\x77\x97\xf9\x87\x3e\x79\xe8\xbe\xe7\xcd\x27\x40\x81\x6f\xc4\xdc\xa4\xd9\x82\x83\x59\x7c\x4e\xb3\x17\x89\xb1\x18\xec\x52\x74\x33\x01\x27\xe1\xe3\xe1\xd3\x83\xe3\x5e\xe3\x04\x05\xeb\x47\x62\x91\x00\x87\xfb\x81\x19\xd6\x80\x8d\x7a\x0a\x26\x26\x72\x18\xe6\x9c\xe1\x7e\xb2\x8b\x0b\x65\x25\x4b\xea\xc2\xcc\xd9\xc1\x48\xab\x85\xa1\x4f\x33\x88\x7f\x6d\xe3\x03\xf1\x00\x1d\xf3\x0c\x42\x9b\x10\xe3\xe5\xb0\x11\xba\x05\xb2\xb5\x11\x54\x29\xba\x7e\xe5\xdf\x2a\x35\x84\xb9\xbb\x69\x8b\xde\x9b\x2d\x4e\x97\xe7\xb2\x8e\x2c\xb0\x5c\x87\x63\x14\x70\x98\x3e\x90\x75\x9d\xcc\xe5\x0a\x01\xd3\xcf\x34\xa8\xfc\xf2\x6f\x15\xfb\x7c\x6b\xb5\x2a\x4e\x54\x64\xfe\x55\x7e\x79\xef\x3e\xb6\xcd\xdb\xce\x30\xe2\x2f\x12\x71\xad\x84\x3d\x7a\x15\x5f\x12\x17\x6a\xfe\x6e\x99\x2a\xd0\x09\x84\x37\x77\x77\xa3\x5b\x37\x5c\x49\xb0\xcd\x77\x18\xa5\x29\x62\x24\x45\x8f\xcf\x76\x4b\xa5\x1e\x38\x77\x5e\x26\xc4\x9a\xd7\x3f\xc5\x6c\x94\x4b\x5d\xe7\x83\x11\xa4\x2d\xa6\xa0\xb1\x31\xaf\x9f\xfc\xce\x19\x13\xf7\xee\xc6\x61\xb6\xd1\x45\x7c\xb9\x98\xd1\xcd\x94\xf2\xeb\x8a\x58\xf6\x3a\xa2\xec\xbc\xe2\x9d\x77\x3b\x16\x8e\x55\x97\x3f\xa9\x8e\x78\x45\xea\xad\x7f\xd8\x3f\xea\xbe\x7e\x76\xea\xd3\x3f\x2e\xcc\x12\xc0\x1e\x79\x72\x7a\xe4\x01\x2c\x75\xa7\x73\xb8\x3b\x30\x96\xa5\xd0\x7f\xef\xc6\x77\x4f\x85\x11\x5d\x78\xea\xc9\xcf\xcf\xb3\x61\x84\xa4\x06\x5c\x8e\xd4\x25\x74\xdc\x3d\x39\xf1\x47\x06\x25\xd9\x61\xb1\xb8\xd6\x6d\x02\x78\x6c\x45\x03\xe0\x4d\xdc\x3a\x38\x2e\xa4\x17\x4e\xeb\xee\x41\x11\x91\xd4\xd5\x9c\xec\xa6\x13\x14\xc0\xc8\x05\xb9\xfc\xf6\x25\xca\xc9\x7a\x04\xd2\x88\x44\x4d\xff\x42\xaa\xd6\xa4\x11\x13\x66\x31\x8a\xb2\x8b\xfd\x74\xce\x57\xf5\xc5\x62\xc4\x4e\xcf\x4c\xb2\x86\xf2\xca\xc2\x88\x7c\xc4\x71\x19\x86\x0b\x98\xa2\x09\x84\xbe\x1b\xdd\xa0\x9a\x6e\x9a\xba\x03\x69\x89\x1d\xa5\xe1\xe1\xb1\x08\xf2\x05\xb1\xc8\x66\xcf\xa2\x90\xe2\x6d\xf1\xa5\xf0\x41\x66\x0b\x48\x3e\x39\x7d\xf5\xf4\xd8\xc7\x32\x16\x55\x6a\xfa\x86\x47\xd1\x47\xe4\x5c\xa4\xc2\x01\xf8\x2a\x2a\x98\x15\xd8\xa4\x0d\x11\xb1\xe8\x90\x95\x85\x57\xbd\x72\x06\x23\xc8\x45\xd1\xd8\x9d\xcd\x55\x5e\x02\x63\x45\x30\x5e\x44\x7b\x4f\xa7\xd6\xfc\x38\x67\xe8\xaf\x4f\x8f\x76\x10\xac\x8e\x6c\x6f\xfe\xf6\xed\x29\x51\xa7\x16\xe5\x34\x6a\xfa\x3a\x55\xea\x41\x56\xcd\x79\x9e\x3c\xee\x5d\xa4\xe4\x6a\x81\x40\xb6\x10\xe1\x89\x39\x20\x3d\x29\x87\xc4\x14\xcf\x18\xf4\x26\x17\x99\x3e\xbe\x4e\xdc\xcd\x1b\xcf\xb2\x62\x05\x48\x80\xb6\x38\xe7\x27\x1b\x79\xfa\xf1\xa8\xac\xee\xf3\xd8\x00\xc5\xf5\xa2\x67\xb5\x8b\xad\x63\xfe\xb0\x1a\x3a\x6f\xbc\x56\x19\x58\x14\x75\x87\x35\x89\x9f\x2d\x20\x4f\x49\x79\x05\x66\x20\x82\xb5\x2b\x09\x0b\x38\xe0\xd9\x43\x38\x40\x71\x77\x93\x37\xbe\x16\x6f\x2e\xd3\xb2\xaa\xfd\xc2\x63\x2e\xd2\xbf\xf2\x40\x94\x5f\x07\x8f\x6c\x7f\xbf\x58\x21\xaa\xf7\x8e\x35\x76\x91\x46\x62\xdd\x57\xdc\x88\xac\x2e\xfc\xb1\x60\x04\xb1\x5a\x69\xca\x00\x5f\xb5\x69\x03\xb5\xc7\x2e\x3e\x3b\xda\x49\x51\x05\xb1\xca\xb0\xf5\xcf\xe2\x77\x2e\xd8\xa0\x37\x53\xf8\x27\xbb\x31\x67\x7c\xc2\xed\xcf\x5a\xef\xea\x02\x1a\x82\x17\x16\x46\x46\x2b\x9c\x6e\xb3\x40\x6f\x7b\x0b\xd4\x7b\xda\xd7\xa5\x40\x09\xcd\x83\xf5\x73\x46\xf0\x4e\xf0\x4f\x9f\x6c\x1e\xef\x94\xe1\xe6\x35\x68\x67\x41\xa5\x8d\x79\x07\x01\x08\x12\x78\x2d\x6b\x99\x8e\x04\x2c\xb8\x65\x57\xd9\xb3\x50\xb4\xaf\x94\x21\x76\xc9\x8a\xe7\xdd\x4d\x94\x9e\x97\x87\x22\x73\x78\x8b\xba\x7c\x4c\x20\x34\x98\x53\x22\x15\xf4\xb1\x61\x11\xc1\x25\xf9\x49\xc3\x1b\x14\xe4\x37\xd7\xa0\xe9\x12\x23\x89\xe7\xe1\x40\x38\x57\x60\xd4\xd0\xe9\x0f\xef\x0a\xdf\xc7\x10\xa2\x0d\x92\xc8\x39\xbd\x99\x98\xca\x73\x56\x52\xe0\xab\x02\xe5\x5f\xf4\xba\xbd\x05\x27\x5a\x55\x5d\xe2\x38\x75\x9f\x5d\x9d\xb2\xe7\x88\x1d\xaa\xd2\xe9\x08\xa2\xb1\x56\x6a\x4d\x73\x1e\xfa\xe1\xe0\xaa\xea\x13\x68\xcf\x12\xc4\x69\xc3\x6d\x85\x5a\x09\x6a\x45\x62\xa0\x30\xbb\x74\x1e\x56\x9f\x5f\x30\x0d\xc9\xda\x61\x0d\x15\x61\xf3\xec\xf3\x5d\xd8\x84\xfb\xb3\xc7\xe9\x02\xaa\x51\x13\x59\x4f\x67\x08\x9b\x5c\x47\xb3\x9f\xb0\x3a\x5c\xa9\xf3\xe4\x19\x14\xf4\x42\xb2\x65\x27\x0c\x99\x46\xa0\x89\x82\x5a\xbf\xff\x6e\xf0\x02\xac\x9e\xf9\xa3\x06\xe4\xa5\xea\x00\x98\xeb\x6c\x50\x81\x1a\x5e\xd1\xc7\x4a\x4d\x59\xdd\xbd\x9c\x50\xf4\xb0\xc8\xc9\x19\x83\x2a\xec\x23\xf8\x13\x58\xc7\x1a\x1f\x1a\xd4\x05\x40\x40\x32\x12\xfb\x80\x0f\xfc\x9a\xd3\x53\x03\xa8\x67\x11\xc6\xbe\xf6\xb4\xdb\xf2\x6a\x95\x4b\x46\xce\xd5\x79\x74\x15\x82\x18\x80\xb4\xea\x59\x1b\x65\x72\x9f\x23\x29\x8e\x25\x99\xbe\xac\xd9\x4c\x44\x49\xf0\x2b\x50\x2b\xb2\x39\x18\x30\x39\x95\x0e\x96\x86\x29\xb7\x2e\xcd\xac\x48\xec\x14\x61\xfc\x10\x94\x01\xc2\xdf\xd1\xa7\x29\xc7\x0e\xcd\x1c\x7d\x96\xd1\x84\x13\x01\xa4\x45\xed\x78\x92\xcc\x7c\x87\xf1\x10\xc4\xfc\xe6\x40\x41\x4c\x59\x7c\xf9\x18\xc0\x63\x34\x21\x38\x8f\x28\xe8\x00\x88\x98\x38\x5d\x9c\x05\x35\x91\x80\xdb\xc1\xd3\xe7\x7d\x0e\x5d\x27\x51\x53\xd0\xd8\x8a\x46\x88\xe8\x14\x59\x0b\x6a\x30\x1a\xa3\x98\xc4\x90\x00\x86\x11\x39\x93\x55\x90\x72\x24\x6a\x12\x60\x05\x67\x8d\xf2\x7f\x14\xb7\x5f\xb0\xa9\x0d\x3c\xad\x6e\xa6\x90\xa5\x6a\x74\x43\xe4\x41\xe9\x27\xe8\xae\x15\x70\x18\x5f\x5e\x2f\x00\x48\xdb\x63\xe4\x0e\x44\xe8\x0f\x9c\x43\x05\x45\xf5\x15\x67\xaf\x39\xb8\x2a\xdd\xf6\x2c\xca\x51\x69\x31\xee\x3b\xc6\x59\x2c\xee\xb1\xfd\xe0\x2a\x7f\x0c\x82\x80\x39\x3c\xf3\x51\xa5\xde\x68\x81\x6d\xab\x79\x0e\xe1\xc1\x53\xc9\x1c\xd5\xde\xf8\x7e\x3f\x58\xef\x58\x43\x7a\x80\xef\x3e\x7a\x3b\x70\x70\xa5\x6e\xe5\x62\xf2\x52\x2d\x9a\x9a\x69\x57\x63\x82\x95\x65\xe6\x1f\x63\x69\x46\xc0\x94\x71\xc1\x39\xa6\x36\xf6\xc8\x78\xf2\x2f\xc8\x41\x87\x76\x30\xf2\x00\xb4\x3e\x87\x78\x0b\x5c\x61\xc2\x1c\xc8\x1f\x27\x06\x52\x2c\x72\x9c\xc2\xf0\x53\x7c\x80\x57\x20\x4e\x2c\x47\x5e\x35\x6f\x86\x11\xc7\x07\x12\x6f\x98\x7e\x3a\x80\x58\xe0\xc4\x32\x72\x50\x6e\xcc\x8a\x0b\xb1\x1b\x84\x28\xe0\x47\xf8\xc3\xbc\x3f\x89\x5c\x62\x13\x38\x3e\xa0\xad\xa3\xd7\xee\x38\x34\x17\x9b\x79\x99\xe0\x15\x0c\x83\x31\xb7\x8c\xeb\x50\x46\x06\xf7\x8a\xc4\xa5\x5e\x4e\x72\x19\x99\xd4\xae\x3b\x9d\xbe\x48\x26\xa0\xd4\x47\x9d\x3e\x63\xb8\xf4\x4a\xf1\x23\xcd\x82\x37\x92\x57\x82\xb1\x74\x0b\x4b\x19\x53\xb5\x0c\x99\xe2\xed\xaa\xa8\x70\x6e\xf3\x16\xad\x3e\x2c\xf3\x92\x2b\x05\xcd\xcf\x0a\xa6\x50\x26\xd4\xbe\x05\x1c\xd9\x90\x95\xba\x27\xf3\x01\x04\x62\xd9\xde\x51\x5b\x3d\xdb\x51\x41\xe1\x9f\x82\xff\xa9\xb6\x83\xef\xbe\x03\x30\x22\x9e\x87\xf4\xa7\x35\x67\xde\xed\xc1\xef\x6c\x2b\xf8\xab\xac\x63\x35\x2a\xbf\xa5\xe1\xb5\x7c\x87\x4b\x1a\x8d\xf4\xfe\x08\x24\xfc\x1e\xfc\x0d\x70\xe0\xf8\x07\x53\x1c\xb8\x27\xc7\xf3\x70\xda\xa4\xc2\xf4\xcc\x76\xf3\xce\x6e\x4d\xfa\x94\x75\x17\xba\x0e\x67\x93\x6a\xe5\x05\xa8\x2a\x2f\x30\xfe\x3d\xcb\x95\xb9\x39\x19\xf8\x67\x29\x73\xe6\x6e\x66\x1b\x4f\x49\x4e\xc2\xaf\x46\xb2\x25\xbd\x4c\xf8\xf1\xbe\x48\x6d\x9a\x6c\x48\x57\x33\xfa\x18\x0d\x49\x08\xef\x67\x10\x29\xf0\x8a\x52\xbe\x5a\xe8\x04\x6b\x1d\xe2\xd4\x75\x2e\xc9\xc4\x9c\x78\x23\x13\xad\x81\x0b\x27\x14\xf9\x40\x44\x73\x56\x64\x15\x0a\x20\x97\xaf\x00\x2c\xce\x31\xe6\x6a\x3c\xcf\xb5\x18\x82\xd0\x21\x95\xd7\xba\x27\x00\xab\x0b\x24\x9e\xa5\xe8\x05\x51\x32\xd5\x14\xa7\xb0\x22\x04\x98\xa1\xb1\xd3\x18\xc6\x94\xa7\x9e\xf6\x79\x9d\xc5\xa9\x4c\x2e\x46\x40\xb6\xc3\x35\xf0\x3e\x32\x72\xeb\x73\x6a\x21\xd0\x2f\x68\x6a\x73\x53\x45\x4f\x35\xda\x2d\xf5\xe0\xcc\x70\xff\x04\xff\x5d\x8d\xfb\x06\xe0\x16\xea\xbe\x08\xee\x80\x99\xb2\x61\x0b\x58\xa9\x90\xeb\xc7\xad\x8e\xad\xe2\x7b\xc1\x51\x4d\xbd\x6f\x9c\x2c\x96\x75\xba\x28\xf5\x9b\x41\x00\x80\x06\x87\xef\xa9\x56\xcc\x38\x2a\xb5\x00\xf4\x7c\x10\x5d\x9f\xd4\xbd\xe9\x9c\x62\x15\x41\x26\x4c\xd2\x58\x52\xcc\xda\x94\x44\x1e\x73\xc8\xf4\x50\x47\x69\x1a\xf8\x15\xb1\x0c\x00\x18\xba\x45\x7a\x05\x17\xd0\xa5\x13\xa2\x72\x75\x92\x61\xe1\x27\x82\x06\xe8\x85\xb8\xf0\xa6\xdb\x91\x17\x71\x47\x78\xa8\x79\x22\x86\xff\xa4\x47\x00\xfc\x9c\xdf\x50\x06\x10\x5c\x43\x52\xf0\x58\xaf\xb9\x02\x05\x54\x93\xaa\x08\xa7\x2f\xd8\x5e\xd6\x82\xeb\x48\x13\x10\x55\x2e\xad\x0f\x15\xa4\x32\x4a\xdc\x96\xd6\xc6\x1a\x9e\x03\xdc\x0c\xa3\xcc\xd9\x8b\x4d\x40\x01\xdf\xbb\x9f\x35\x8b\xf8\x81\xed\x2c\xf6\x02\xe1\xd5\xa5\xfa\x98\xac\x26\x72\xf5\x1d\x53\xef\x3f\x5b\xf6\xdc\x1f\x36\x4b\xee\x44\x8e\x78\x63\x0c\x9b\xf7\x1a\x12\x77\xcd\x28\x8b\x84\x13\xba\x5a\x9e\xc8\x8a\xd3\x51\x33\xf8\xe0\xac\xd9\x6c\xbe\x7b\x70\xcf\x06\xd0\xb7\xc2\xf6\xfd\xe0\x7e\x75\xed\x97\x9f\xcf\x7e\xbe\x7e\xf4\xf3\xbb\xff\xb3\x86\xb9\x56\xaa\x74\x28\x9a\x04\x92\xc9\x77\x6a\x18\x16\x08\xc1\xec\xdb\xfa\x5a\x82\x0a\xcc\x79\x45\x0c\x92\x2b\x7b\xf6\x30\xe9\xbe\x20\x9e\x3d\xa3\xd4\xfc\x6a\xea\x79\x21\xed\xa5\xb1\x1b\x3a\x1b\x1b\x63\x67\x10\xae\x11\x7c\xa0\x22\x33\x7e\x90\x83\x6b\x35\x10\xab\x3c\xdc\x8b\x44\xa4\xb6\xa4\x86\xbd\x06\x53\x26\x14\xf0\x47\x56\x6f\x80\x77\x50\x6c\x51\x3a\xb4\x37\x68\x53\xf8\x6c\xbb\xf6\x36\xeb\x01\x9e\x76\x5c\x77\x55\xf4\x19\xff\xcb\xe9\xf9\x14\x2a\xac\x0d\x75\x39\x2e\x32\xcf\x74\x2b\x99\xcb\x72\x16\x9d\x9a\xca\x5b\xf2\x95\xc3\x12\x33\xf0\xaf\x1f\x55\xfb\x6b\x47\xa5\xbc\xac\x84\x32\xca\x3b\x83\xc0\x09\xfc\x22\x0a\xcb\x55\x2a\x3a\x8d\x02\xd2\x6e\xb7\xa9\x8a\x9a\xc1\xcc\xb3\x4d\xe0\x9c\x2d\x6b\x03\xdf\x2b\xf9\x74\x0d\xcb\xe9\xbe\xa3\xf1\xe6\xea\x34\x67\x39\x4c\x3f\x9c\x30\x33\x8c\xc1\xc7\xe1\xf9\x58\xe5\xd4\x3e\x16\x40\x0d\x5e\xcf\xb4\xe7\x91\xa2\xa2\xad\x37\x29\xcf\xee\xf1\xde\x26\x87\x66\xd0\x0b\x2c\x26\x73\x7e\x88\xf0\x36\x16\xbd\x06\x6e\x79\x6b\x1c\xca\x12\x30\x78\x75\xc7\x18\x4a\xf4\x1e\x5f\xf4\x33\x78\xab\x36\x5d\xb6\x21\xeb\xf5\x82\xcf\x62\xd4\x63\x03\x70\x65\x8d\x7d\x1a\x9e\x8b\x5a\x50\x99\x8d\x12\xbc\x07\xbd\x93\xa7\xc1\x5f\x38\xb1\x04\xfe\xd1\x0e\x1e\x07\x1d\x53\x24\xb7\x01\xcd\x66\x1f\x9e\x05\x1e\x36\x50\x4e\x21\x0f\x05\x8f\xbd\x83\x33\xb9\xcf\xd8\xb6\x0c\x99\x65\xc6\x88\xd3\xc0\x86\x7b\x0a\x42\x1d\x46\x03\x83\xf8\xd5\x76\xfa\x2b\x9b\x41\x81\x95\x0e\x1d\x6f\x20\x35\x7b\xb2\x6b\x09\x10\x7a\x3b\x98\xff\xd0\x5f\xb0\xe6\x7b\xf8\x5f\x58\x49\x3b\x2a\x76\xec\x10\x4a\x2e\x7e\x1e\xe8\x52\x4a\xbf\x57\x79\xe0\x8e\xe5\xe5\x4a\x8a\x5b\xeb\x79\x44\xcc\x6a\x98\xce\x63\x10\xe8\x27\x24\x8b\x04\x01\x0a\x04\xc8\x87\xf0\xb6\x0b\x08\xe0\xa5\x55\xf5\x8e\x5b\xa3\x45\x74\x98\xc0\x50\x99\x72\x16\xe9\xf8\x8d\x3d\x83\xbd\x52\xfe\xcb\xcf\x0e\x64\x37\x37\x8f\xbe\xa9\x4e\xe8\x17\x73\x60\xf0\x76\xae\x92\xcd\x9c\x47\x63\xea\x81\x43\x9a\x92\x36\xc0\xf0\x57\x16\x75\xb9\x71\x30\x83\xa0\xf0\xfd\x96\x4d\x3b\x3d\xa3\x1d\x0f\x02\x59\xbf\x95\x5b\xbc\x5a\x89\xde\xd3\x89\xfd\x52\xf7\x64\x63\x7c\x20\x30\xcc\x9b\x44\xff\xa5\xa6\xf6\xb6\x71\x26\x5c\x78\x94\x5d\x06\x27\x3f\x8b\x7d\x41\x5a\xa9\x9e\xca\x7a\x3d\x76\xe6\x61\xa4\xbe\x82\x18\x74\x94\x86\x71\x04\x32\x31\x08\x03\x37\x68\xfa\x8b\x28\x3c\x90\x43\xad\xe3\x70\x91\x81\x32\xcc\x47\x09\xd7\x7b\x5f\x88\x31\xd4\x81\x15\x31\x3f\x90\x60\xd6\x7c\x69\xa2\x35\x07\x02\x55\xbc\x92\xb3\x2b\xdd\x2e\x67\xa5\x63\x8c\x61\xda\x2a\x4a\x0c\xe8\xa4\x89\x8b\x89\xa7\xa9\xb5\x91\x56\x7d\x8d\x1c\xcb\x14\xa3\x4f\x70\xad\xa3\x42\x50\xbb\xd7\x35\xd5\xa8\xd0\xe6\x32\x9c\x64\xe0\xd6\xa1\xbc\x58\xef\x4c\xf2\x6e\x49\xdf\x25\x90\xc0\xd7\x0e\x4d\x2c\xd1\xc2\x18\xb4\x97\x44\x05\xc9\xfa\x61\xc0\x8b\x1b\xa3\x86\xbc\x50\xec\x78\x6e\x9e\xc3\x1f\x70\xa9\x98\x6d\x86\xe5\x72\x26\x04\xc4\x97\x02\xe7\x55\x77\xb1\x3d\x39\xd0\x20\x2a\xa4\x05\x98\x47\x2f\xd8\xc2\x6c\xf2\x81\xa6\x99\xa0\x3c\x74\x14\xf9\x16\xd9\xbe\x51\x9d\xb3\x9a\x95\x57\xab\xd4\x23\xcb\x6c\x08\xb7\xc6\x2f\x57\x43\x7c\xf8\xe9\x1a\x4b\x62\x8d\x28\xc3\x57\xa1\x44\x57\x80\x89\x0a\x15\xb7\xa2\xbf\x5e\xa5\x12\x6d\xb5\xe5\x10\x05\xf6\x16\x1e\xf9\x84\x4c\xd1\xae\xcc\xbb\xb0\x49\x54\xeb\x1b\x3c\x0c\x95\x18\xe1\xf6\x87\xa1\x3e\x21\x1e\xaf\x2c\x89\x93\x41\xba\x91\xeb\xcf\xaf\xc9\x79\x72\xab\x44\xb7\x29\x69\x78\xab\x56\x37\x7c\x95\xc5\xd1\x1d\xc4\xa5\x79\x8c\xd2\xd3\xaa\x50\xf7\xca\xb5\xee\xfb\x13\xf1\x51\x07\x2f\x5d\x7a\xf5\xe5\x62\xf3\x91\xd0\xe4\x29\x67\x4d\x0d\x39\xe8\x06\x48\x4a\xfe\x7c\xf2\xf2\x45\x93\x5a\xc5\x17\x37\xdc\x4f\xad\x54\x6c\x02\xb2\xe2\xa9\xbf\xa9\x25\x69\x55\xde\x43\xd8\x31\x38\x69\x8c\xe6\x6a\x68\x27\x00\xce\x89\xd0\x86\x00\x5a\x30\x10\xa9\x5a\x98\x25\x8c\x15\xbf\x84\x63\x6a\x32\x56\x8a\xae\x45\x50\x18\x09\xa7\xe9\xb0\x90\xdd\x96\x8a\x99\x2c\x01\x82\x7c\xa7\xb7\xbb\xef\xd0\x98\x18\x50\x6e\x9d\xbd\xce\x33\x87\x49\xb6\x55\xab\x6e\x36\x20\xb6\x06\x2b\xa6\x33\xbc\x23\xab\x4c\xbf\x15\x45\xc7\xcd\xa7\x49\xf9\xa9\x2f\x17\x12\x6b\x28\xa7\xe3\x21\xc3\x6e\xf0\x33\x9f\x23\x23\x6b\x96\xf0\xf2\x12\xd3\x5a\x3a\xcb\x4b\xa4\x07\x68\xd9\x35\x20\x91\x98\xd3\x37\xcb\x0a\xe1\x8d\x0b\xe6\xf2\x78\x7f\x81\x1f\xc2\x68\x2e\xde\x10\x92\xd5\x49\x40\x15\x1a\x1f\x32\xf9\x4c\x39\xdb\x35\x18\x34\x59\xe1\x91\xa9\xa4\x4e\x2d\x1d\x30\xbc\xcb\x7c\x04\xa8\x07\x8c\x69\x01\x3c\xd0\xe3\x4e\xc5\x53\xd9\x2b\x36\xe4\x3e\xc3\x59\xda\x7c\x3d\xdf\xdc\xf6\x2e\x70\x32\x8f\x1b\xd7\x78\x23\xdf\x58\xbd\x96\x55\xff\xf0\xc6\xc9\x37\xdf\x5c\xd2\xb7\x86\xe3\x3d\xbb\xa5\xf1\x56\xe9\xbc\x75\x53\xda\x2d\xb9\xc6\xdb\xb7\xcf\xba\x74\xd2\x3b\xd2\x36\x4b\x65\x15\x25\x5d\xf7\xc4\x04\xe8\x91\xc1\xc2\x2b\x78\x67\x58\x47\x1f\x62\xbe\xfe\x0a\xfe\x9e\xd6\x32\x35\x35\x57\x3f\x44\xab\xb0\x16\x60\xcd\x2c\x51\xa6\xf3\xd1\x06\xea\x05\x63\x7a\x14\xf8\xe7\xa8\x23\x04\xb9\x28\xf9\xe7\x4b\xf2\xfa\x08\x47\xd7\x90\x24\x0a\xbb\x37\x87\xc3\x70\xf7\x29\x19\x57\xda\x61\xe4\x7a\xcd\x1d\x56\x7f\xd2\x20\x34\x97\x01\x71\x53\xd7\x5c\x5a\xe5\x9b\x28\x54\xe6\x32\x0b\xe6\xd9\x3b\x87\xd5\x2f\xb8\xa1\xb8\x65\xc1\x6b\x5d\x0e\xa1\xb3\x63\x2d\x81\xdb\x72\xa8\x95\x36\xac\xc1\xb4\x4d\x7d\x45\xa6\xab\x4b\xdd\x92\xea\x72\x6b\x83\x36\x98\xf9\xeb\xbb\xfd\x60\x77\x53\x8f\x43\x4d\xad\x50\x2f\x09\x8d\x1a\x06\x82\x02\xfd\xf9\x9e\xfe\xa9\xb7\xe5\xb2\xe7\x08\x69\x79\xdd\x43\x44\xed\x5e\x95\x64\x54\x4d\x51\x9e\x44\x45\x8a\xda\x15\x47\x5e\xf3\x4e\x0e\xbc\x73\xc0\x96\x1d\x92\x96\xa1\x66\x7a\x2d\xeb\xe2\x88\x59\xce\x62\x6b\xa1\x09\x9e\x27\xa2\xab\x08\x53\x27\xeb\x15\x68\x74\x8d\x6b\x1f\x52\x4c\x94\x36\xb3\x61\x02\x87\xf4\xaa\xc2\x7e\x2c\x24\xf7\x0a\x72\xf4\x7b\x70\x15\x19\xee\xb7\x60\x48\x4d\x8b\xdc\xe5\xd8\x65\x7d\x7a\xcd\x10\x3f\xbb\x4e\x28\xb6\xb1\x4d\x32\x80\x6b\x05\x7b\x9b\xcd\x79\x1f\x29\x31\x7c\xd6\x88\xaa\x44\xa5\xcd\x6c\xcc\x5d\x62\xd4\xbc\xb7\xa2\x81\x92\x60\x35\x9b\xff\x20\xc1\x6a\x24\xd1\x09\x7a\xf0\xa0\xce\x1d\x44\x29\x79\x01\xfa\x31\xba\x51\x62\x2e\xc6\x70\xe2\x18\x2b\x32\x27\xf3\x1e\xb3\x47\x28\xa0\xbe\xa6\x79\xd8\x48\x19\x32\x13\x5f\xf8\x84\x6e\x70\xa2\x87\x47\xdd\x66\x71\x00\x0e\x33\x60\xe7\x41\x94\x62\x4e\x71\xbe\x21\xce\x17\xf1\x68\xde\x88\x27\x12\xdb\x63\x8a\x8b\x42\xc1\x97\x2b\x68\x38\x39\x89\x07\x78\x67\x91\x89\x0a\x7a\xed\xb1\x79\xfc\x47\xd2\x9c\x9c\x47\x65\x11\x3c\xc8\xc0\xb9\x50\xe5\x7a\xe0\x42\x80\x14\x19\xb8\xc9\xbc\x41\x0d\x0b\x71\x33\xbd\x34\x09\x98\x3b\x05\x8d\x5c\x64\x13\x2d\xeb\xc1\x8b\x3f\x0a\x82\x25\xd7\x63\xb0\x62\x97\xe0\x2f\x4c\x91\xde\x45\xdc\x23\x01\xaa\x2f\xd0\x4b\x8d\x58\x2c\x25\x1a\x91\xd5\x16\x16\x1b\x13\xb8\xa7\x94\xa4\x9f\x1e\xd6\x8e\x46\x08\xac\xe7\xc8\xae\x81\x0b\xd3\x05\x19\xca\x31\x10\xc3\x42\x42\x0c\x6b\xc3\x2f\x0e\xa2\x21\x71\x8c\x88\x78\x34\x73\x25\xd7\xb8\x78\x34\x1c\x98\x29\x43\xb8\x8c\x1f\x41\x9d\x09\xe0\xec\xce\x81\x61\x3d\x40\x29\x65\xf7\x01\x32\xa6\xf4\xc7\x43\xf3\x67\x9d\x33\x03\xd8\xcf\x2c\xe9\x27\xd1\x8d\x94\x2a\x68\x34\x7c\xcc\x5a\x6d\xc9\xa5\x03\x87\x74\x92\xe2\x7d\x0d\x31\x07\x54\x71\xe8\xa3\x82\x63\xf1\x59\xcd\x57\x37\x20\x1a\xfb\xbb\xac\xd7\xef\x65\x8a\xa9\xcf\x7c\xa2\x56\xdc\x07\xe1\x70\x78\x60\x25\x95\x76\xfb\xb9\x21\x08\xbb\xe1\x4c\xf3\x9c\x60\x53\x02\xc6\xa3\xe5\x5d\x9c\xce\xb3\xb2\xce\xf7\x67\x0e\x4e\x4e\xcb\x0e\x0d\x84\xf4\x16\xd9\xe6\xc2\xf7\x22\x8b\x5c\xd7\xfa\x2c\x7e\xd7\x54\x1d\xe0\x52\x38\x3c\xaa\x39\xd4\xf4\x3d\xef\x86\xcf\x30\xdc\x7d\x6e\x95\x0d\xfa\x52\x57\xcf\xa6\x8c\x78\xd6\x97\x77\xda\x8b\x3a\x27\xfd\x77\x3d\xfe\xe6\xc6\xb4\x17\xe4\x71\xbc\xc7\x3f\x3f\xab\x17\xc9\x7d\x8d\xa7\xec\xf1\x2c\xc2\x2f\x04\x68\xe2\x0a\xef\xca\x6d\x8a\x97\x82\x68\x4e\x17\xe9\x95\x9d\xad\x65\xe0\x70\x45\xd2\x64\x36\x77\xe1\xb4\xc3\x7a\x70\xae\x91\xcb\xda\xeb\xd2\xcd\x8d\xcd\x7b\xc9\x18\x42\x70\x55\x15\xeb\x65\xee\xde\xa6\xc6\xc7\xb9\xfa\xcb\x32\x5c\x9f\xfd\xa4\xcf\x3e\x4d\xb2\xc1\xf0\xed\x61\x87\xb7\x27\xf9\x75\x2f\xd8\xe0\x1e\xd8\x18\x43\xeb\xf9\x28\xed\x31\xdb\x52\x0f\x9a\xcd\xe6\x67\x6d\xce\x8c\x4e\x35\x34\x87\x63\x48\x31\x4f\x96\xcc\xf0\x1b\xbd\x2b\xc3\x29\xcb\x2f\x21\x41\xae\x9b\x5c\x6a\xe3\x72\x01\x24\xe8\x0c\x5d\x90\x52\xaa\x97\x3b\xc0\xee\xc4\x66\x69\x83\xa4\xa5\x30\x20\xee\x7c\x8a\xbd\x5b\xc4\x00\x70\xe7\xd6\x0f\x4b\x45\x13\xab\x66\x6c\xe3\x69\x56\x81\x6d\x17\x04\x53\xc8\x55\x1a\xa1\x9a\x57\xa5\x55\x97\x87\x14\xef\x0d\x97\x9e\x37\x70\xaf\xff\x7d\xd3\x16\x91\x66\x06\x7e\xc2\x85\x36\x6f\xbd\x24\xe9\x8d\x3e\x79\x9a\x41\x15\x97\xd7\x7c\x79\xec\x3e\xcc\xe3\xc9\x22\xca\x3d\xff\xee\x4f\x9b\x71\xda\xe3\xbc\x2b\xd5\x5a\x19\xa8\xa9\x84\xfa\xed\xa3\xad\x2a\x18\xfe\x51\x92\x3f\x19\x2b\x49\xa4\xe4\xaf\xda\xf2\x8e\x05\x23\x06\x49\x70\x78\xde\x29\xb4\x78\x9a\x0f\x8d\x14\x4b\x22\x1c\x4a\x58\x0f\xf8\x4f\x80\x10\x62\xc4\xed\x0e\xac\x16\xc7\x3e\x13\xb2\x6c\x81\xda\x9b\xe5\x71\xf6\x3c\xbf\x12\xd7\x21\x7b\x9a\xad\xac\x0f\xcb\xc0\xa4\x85\x2e\x5e\xdf\x72\x49\x14\x81\x94\xb6\x0d\x8d\x2a\x81\x81\x04\xcf\x16\x9b\xcd\x19\x63\x0c\x50\xeb\xb2\x63\x27\x60\xba\x13\x89\x41\x88\xac\x45\x28\x8a\x45\xe7\x49\x0f\xc7\x1d\x85\x08\xe2\x47\x33\x06\xc6\x45\x92\xe4\x71\x35\x08\x70\x61\xbd\x17\x39\x40\xa0\x93\x8e\xa3\x87\x26\x1a\x0f\x0b\x50\x30\x1e\xe2\x2c\x54\xe3\x85\x9d\x29\xf1\x38\x68\x7a\x46\xf2\xb3\x72\x1a\xeb\x60\xaf\x48\x3d\x9c\x4a\x32\xc3\x03\xa0\xa2\xcd\x12\x90\xd2\x2b\x1e\xaa\xe5\xad\xe8\xf0\xe2\x52\xd2\x5c\x67\xb7\x76\x97\xeb\xde\xe7\x38\xbc\x2b\x5b\x5d\xc9\x45\x7c\x00\x8c\xca\x4e\x22\x13\x84\x9c\x9b\x59\xa1\xa8\x37\xc2\x3b\x3c\xdd\xe8\x6d\xfc\x4f\x1d\x65\x94\xcd\x9d\x74\xa4\xd1\x53\xa5\x66\xe3\xb7\x12\xae\xe9\x15\x87\x08\x7a\xc8\x61\x47\xe7\x68\xc3\x1c\xda\xf7\xa0\x99\xd8\x07\x09\x41\x80\xa1\x37\xd0\x02\x33\xa8\x42\x0c\x2a\x80\xe3\x0c\x2b\xd3\x1a\x9d\x0b\x28\x06\x60\xca\xe4\x12\x94\x6b\x44\x07\x32\x61\x3f\x39\x01\x2d\x3c\x17\xad\xf3\xc1\x07\x09\x9e\xa7\xaf\x77\xd6\xbf\x62\x68\xa1\x0b\x0c\xd9\x95\x92\xc7\x00\x5c\xe0\x12\x10\x22\xe7\x60\x9c\xa2\x1f\x10\x2b\x01\x01\x96\xb3\x08\xd2\xda\x5f\xdf\x07\xa1\x9e\x95\xa4\xb0\x57\xf8\xf5\x2c\x01\x41\xf4\x44\x98\x05\xc6\x62\x9d\x4d\x95\x66\x94\xcd\xcb\xaa\x72\x9d\xeb\x5e\xaa\x0c\xd6\x0f\xe3\x0b\x74\xe8\x9c\x73\x04\x07\x08\xfe\xb9\x30\xa4\xc2\xcc\xe1\xf0\x63\x32\x0b\x3f\x78\x33\xf5\x82\xa7\x62\x5f\x38\xd7\x84\x9c\x96\x18\x02\x28\x76\xd8\xa5\x01\x5f\x96\x82\xbf\x20\x24\xe3\xb1\x64\xe2\x7b\x26\xb2\x5b\x06\x5a\x0c\x2e\x66\xe7\xe8\x49\xfc\x50\x24\xf3\x90\x1f\x91\xa6\xac\xf0\x0f\x34\x98\x43\xdf\xc4\x69\x0a\xdc\x11\x0e\x4c\x79\xe9\xc3\xc3\x1e\xcd\xd2\x5e\x9f\xd8\x8e\xd2\x00\x33\xda\x93\x11\x3d\x95\xdc\x93\x40\x32\x28\x67\xf2\x73\x96\xd9\x50\x6a\xe4\x9c\x12\x92\x0e\x1c\xfa\x46\x43\x47\xd2\xc8\x8a\x8f\x88\x19\x0d\x0a\x0b\x38\xeb\x5a\x3c\x41\x0d\x31\x5c\x62\xbc\x2a\x7a\xf4\x4a\x84\xac\x68\xb1\xd5\x68\xc3\x49\x40\x8d\x2d\x8e\xa0\x2c\x18\x2e\xc0\xc2\x78\xb8\x75\x0a\xb3\x40\xaf\x49\xc9\x14\x1a\xb1\x4e\x23\x9e\x83\xb6\xf9\x41\x97\x03\x6b\xa0\x15\x20\x08\x9a\x1e\x94\x45\xea\xa0\xc8\xa3\x9a\x7e\xe3\x27\xf5\xae\xff\xe0\x5c\xe9\xe4\xd7\xc7\xea\x1b\x9e\xc6\x7d\x9d\x36\x8c\x38\x9d\x5a\x81\x04\x00\x58\x6a\x3a\x60\xea\x70\x6a\x44\xa9\x23\x8b\x01\x6c\xae\xc2\xf4\x4a\x8c\x40\xc5\x5b\xe8\x22\x01\x9f\x41\xbe\x13\x53\xc3\x74\x90\xd4\x17\x42\x8c\xb3\x89\x09\x5e\xe2\x56\xaf\x46\x0c\x36\x6a\xc8\xa4\xab\xa0\x21\xd6\x8c\xd8\x0b\x1b\x9f\x72\xa6\xc7\x1b\xe5\xf9\x6e\x4e\x26\x88\x93\xec\xc9\x66\xc7\x57\xe8\xd8\x46\x07\x05\xe7\x46\x75\xd8\xa2\x4f\x21\x25\xbf\xba\x4e\x14\x1d\x28\x58\xb4\x7b\xd9\x70\x0c\x1c\xaf\x81\xfb\x34\x70\x80\x23\x33\xb3\x0a\xbb\x18\x3e\xfd\x00\xfe\xdb\xbe\x5f\xa1\xe9\xec\x3f\xaa\x50\x45\x06\xe3\x99\x64\x96\x0c\x4d\xcc\x39\x69\xff\xa5\xff\xbd\x00\x0f\xe6\x73\x33\x42\x26\x62\xb4\xc9\xcc\xbf\xca\xd9\xd3\x17\x27\xef\xa0\xbf\xb3\x67\xfd\xa3\xd3\x77\xd0\xd5\xc1\x0d\x2c\x04\x3a\xa7\x83\x8e\xd4\xef\x8f\x4f\x2c\x47\x1d\x76\x31\x28\x18\xde\xf9\x82\x0d\x29\x38\x58\x53\xc8\xf7\x88\x84\x0c\xd6\x1e\xd8\x66\x6d\x5e\x90\xc1\x37\x73\x6e\xa2\xae\x83\x63\xeb\xe6\x62\x83\x20\x48\xae\x41\x33\x5b\x36\x0f\xe1\x50\x50\xdc\xb7\xa8\x62\xcf\x9d\xb6\x70\xe2\x58\x29\x33\x31\x08\x18\x75\x1e\x81\x1b\xaa\x30\x86\x9c\x2b\x2d\x12\xdd\x73\xaa\xc6\xc6\x01\xf6\xbe\xd1\xe0\xc2\x51\xa2\x8f\xb1\x10\xb4\x2f\x1e\x5d\x77\x34\xff\x63\x46\xa6\x8d\x5e\xef\x3c\x2a\x8e\x6a\xf7\x07\x0c\x0b\x65\xf4\x5f\x36\x2e\x66\x51\x24\xce\xb5\x8a\xa7\x53\x1e\xce\x08\xc2\xd0\x70\x5c\x7e\x60\xa9\xa0\x23\x72\xdc\xca\xd8\xb1\xa3\xed\x11\x88\xa9\x67\xb3\xf0\xa6\xd0\x1f\x22\x6f\xf8\x4e\x52\x47\x1c\x32\x93\x23\x8e\x59\xa0\xd3\xe9\xcd\xbd\x58\x40\xf3\xac\x2e\x1d\xfb\x0b\x62\x4c\xf5\x1e\x93\xdc\x73\xc2\x12\xe6\x32\x4d\x3b\x5f\xab\xa8\x1d\x27\x36\xd1\x6a\xc0\x3f\x50\x90\x2c\xb9\xc2\x20\x14\x47\x63\x9e\x34\x30\x39\xbd\x78\xd7\x33\xca\xa8\x63\x2d\x9b\x85\x98\x78\x73\x70\xcc\x54\xd4\x8e\xd2\xd2\x67\xa2\x16\x31\x31\x05\x93\x55\x92\xdd\x46\x43\x2f\xac\x8f\x0b\xe7\x63\x43\xf9\x00\xac\x4c\x34\x1f\x7d\x75\x2e\xb9\xea\x7c\xe9\xc7\x4f\xe2\xe2\xa3\xaf\x3f\x34\xfd\x84\x8b\xc8\xf9\x2c\xc9\x13\x8e\x2f\x6d\xb9\xf5\xe8\x79\xe0\x1b\xad\x1c\x2e\x28\xde\x6a\xe4\x7b\xf8\x7c\xb0\xfe\x3d\x99\x9b\xf3\x4c\x49\xe0\x4c\x9f\xb9\x3b\x73\xbc\x20\x01\x55\x86\xd3\xa5\x60\x5c\x7c\x9d\x02\xeb\xe5\xf1\xaa\x56\x3c\x3f\xc7\x08\x3e\x72\x19\xe8\xf6\x06\xdd\xe6\x91\x14\x53\xcc\xdc\xd9\x25\xa5\xec\xc1\xe7\x54\x10\x80\x87\x37\xee\x6a\x29\x8f\x8b\x60\xa8\xe5\x0a\xdd\xe6\x93\x71\x54\x79\x7b\xba\xa1\x24\xc9\x07\x52\xef\x61\x0c\x2f\x68\x03\x47\xee\x3c\xbe\xa4\x4b\xfe\x3a\xa2\x8c\x96\xe8\xd8\x8b\x61\x1d\x91\x85\x17\x74\x3a\x31\x19\x18\xc7\x09\xd9\x30\xc7\x28\x99\xd3\xfb\x19\x78\x50\xe4\x8e\x3f\xa2\x85\x0b\x04\x0b\xa2\x88\x27\x66\x32\xb9\x91\x2b\x5b\xca\x2d\x1b\x6b\x63\x2f\x70\xcb\xff\x81\x03\xcc\x64\x5d\x8f\x1e\x3a\x97\x00\x31\x86\x76\x71\x3c\xd0\x64\xcd\xe9\x2a\x6b\x4c\x8f\x78\xe7\xb9\xfd\xc6\xa4\x09\xe5\x7d\xe6\xc9\xcf\x8f\x1c\x72\xae\xd1\x81\x3f\xee\xb0\x87\x3d\x01\x9e\x59\xd8\xf7\x66\xed\x38\x5b\x61\xd1\xbb\x59\x56\x36\x2d\x7a\x3c\x8b\x64\x86\x20\x57\x6d\x5d\xf3\x84\x86\x40\x11\x9e\x00\x96\xff\xfd\xc6\x08\xdb\x0b\xbc\xda\xed\xe2\xda\x01\xa3\x35\x53\xbb\x53\x56\x9b\x51\x9e\xa9\xbe\x5e\x56\x9d\x0c\xad\x75\xd5\x8d\xb2\xaa\x64\x85\xed\xd5\xdd\x7c\x57\x54\xf5\x73\x5e\xde\x74\x82\xb9\xdd\x3c\xeb\x51\xa2\x6f\x3a\x78\x1d\x05\xfb\x5f\x61\x25\x91\x67\x2e\xd1\xe5\xf9\x4c\xf6\xbd\xe2\xc4\x66\x62\x09\x6a\x0f\x1c\x47\x13\x14\xab\xd8\x07\xe3\x70\x30\x4b\x1e\xd8\xef\x29\x5d\x5f\x98\xcc\x95\x23\x7d\xc5\x6c\xe4\xa6\x23\x88\x8a\xcf\x18\x9a\x56\xd7\x02\x04\x62\xcf\x3b\x93\x07\x54\xc9\xde\x70\xe4\x1a\xac\x01\x7a\x77\x3b\x10\x36\x3a\xab\xca\x89\x81\xe3\xa5\xd3\xbf\xad\x60\x51\xe9\xf9\xb7\x29\x47\x3b\x36\xa4\x7c\x77\xab\x1f\x9c\xa1\x46\xc8\x77\xe6\xa2\x83\x07\x61\x9d\x14\x1d\xe7\x4e\x76\x90\xca\x53\x7c\x86\x91\x37\x17\x8c\x96\x82\xc6\x6c\xb9\x1a\xcf\x2d\xdb\x22\x5c\x8b\x36\x07\xb2\x98\x08\x3f\x78\xba\x0f\x1e\xad\xf3\x92\x55\x88\xc9\x38\x29\x56\x9d\xff\x01\x39\x72\x79\xc1\x28\x0a\x3c\xbc\xb4\x25\x83\xfe\x77\x5f\xfc\x13\xd9\xe7\x26\x1b\xc5\xbc\x16\xfc\x60\xa8\xea\x5e\x70\xfe\xd8\x47\x7d\xe1\x22\xb2\x40\x37\x83\x68\x30\x2a\xa2\x90\xd8\x45\xa1\xce\xbf\x0c\xdf\xdc\xf8\xae\xf8\x1e\xfc\x2f\xc6\x37\x85\x63\xff\x06\xf8\x06\x44\xdb\x30\xbb\x0d\x0c\x18\xd3\xf0\x62\xb0\xfb\xdb\x5c\x23\xe8\x3c\xfd\x52\x04\x65\xe6\x55\x16\xc4\xfd\x9b\x4c\x4e\xad\x45\xf1\x34\xd2\xab\x2f\x9e\x86\x82\x9d\x19\x6b\xc6\x8b\x48\x82\xad\x7f\xdd\x44\x78\xe7\x14\x4f\xc3\x7c\xfc\x8a\x79\x30\xe8\x6f\x80\x71\x6d\x85\x5f\x38\x50\xf3\xfd\x8b\x07\x7a\xe7\x93\xf5\xb5\x27\x04\x14\x5b\x8b\x39\xf0\x8a\xc2\xba\x39\x11\x29\x05\xef\x23\x3d\x90\xe7\x23\x63\xa7\x6a\x1e\x5e\x10\x5d\xc4\x70\x38\xdc\x6d\x71\xf8\x91\x8c\x9d\x1d\x9a\xfc\xb9\x11\x84\x18\x3c\x9b\xd3\x15\x38\x69\x28\xc8\xfd\x30\x10\x15\x45\xd7\x53\x9d\x56\xc7\xaa\x47\x67\x6c\xc3\x78\xd5\x51\xf2\xce\xc6\xef\xb8\xf8\xb3\x5b\x44\xa6\x92\xb4\xe9\xe6\x33\x16\xa4\xbb\x80\xcb\xfe\x62\x46\xc3\xea\xc5\x64\xb5\xa5\x44\x15\x8d\x7f\xf2\x73\x61\x93\xb5\x66\xdf\x0c\xe6\x00\x3d\x53\x80\x22\xd4\x41\x5a\x65\x5e\x49\x43\x62\xe5\x5f\x45\x98\xb5\x8e\xe8\xbf\xe1\x20\x3e\x26\xf1\x30\x98\x84\x1f\x63\xf0\x39\x80\x07\x02\xe4\xbc\x00\x34\x6b\x68\xc8\x8a\x70\xa8\x6d\x48\x13\xd3\xb4\x1f\x79\xe0\x99\xf8\x12\x5b\x5b\xb4\x97\xbc\xb2\xed\x82\xb2\x1d\xb3\xcd\x3c\x02\x7e\x9b\x4b\x79\xb0\xb7\x62\x75\xf1\x8d\xc2\x8d\x59\xbc\x85\x2f\xca\xb6\x2f\x1c\x1d\x88\xee\x22\xc6\x85\x62\x37\x03\x66\xc9\xd6\xf2\x5e\x0a\x4f\x4e\xd6\xa5\xf0\xa5\x4b\x2d\xfb\x0f\xed\x23\xef\x3f\x45\x52\x32\xfe\x20\x27\x02\xc8\x5b\x19\x47\x10\x8b\xdb\xb0\x0d\x7b\xc1\x19\x2b\x1d\xea\x2c\x8a\x94\xa7\x5b\xdd\x3a\x61\xa2\xef\x25\x72\xfc\xef\xee\x29\x38\xce\xc1\xce\xa6\x9c\x67\x50\x41\xcb\x25\x7c\xc0\x53\x03\x0e\xe2\xe0\x31\x05\xd1\x8b\xc5\x35\x04\x3c\xa3\x04\x9a\x8d\xc5\x31\x24\x41\x0d\xa9\xf5\xe8\xb9\x7b\x7e\x63\x5f\x09\xf4\x3e\x00\xc5\xac\x9c\xc5\x20\x38\x6b\xd5\x03\x10\xbb\xbe\x7e\xf1\xd3\x8b\x97\x6f\x5f\x80\xe8\x15\x70\x96\xff\xef\xbb\xba\x1d\xfc\x11\x46\x49\x35\xa3\x67\x10\x9d\xed\x3a\x80\x30\xfb\x05\x9a\x9b\x1f\xf5\xa0\xf8\x1f\xaf\x5e\xdd\xfd\xa2\x4a\xf9\xa9\x74\xd6\x6e\x77\x40\xfc\x7b\xd4\x06\x60\x48\xf1\x61\x7f\x3d\x0a\x2a\xc7\xe6\x6f\xd8\x7f\xf8\x6b\x4d\x01\xa1\xc2\x07\x9d\xf5\xff\x79\x50\xcf\x43\x5b\x47\x68\x9d\x2c\xb4\x7f\x77\xd0\xfe\xbd\x10\xda\x46\x21\xb4\x0d\x84\xb6\x9e\x85\xf6\xca\x41\x7b\x55\x08\x6d\xb3\x10\xda\x26\x42\xdb\xc8\x42\x3b\x71\xd0\x4e\x0a\xa1\x6d\x15\x42\xdb\x42\x68\x9b\x08\x8d\x9b\xb7\x37\xff\xa7\x92\x5d\x8d\x1c\xb4\x9d\x42\x68\xdb\x08\x6d\xcb\x83\xb6\xbd\x02\xb4\xdd\x42\x68\x3b\x08\x6d\xdb\x83\xb6\x73\x3b\xb4\xf5\x76\x21\xb4\x5d\x84\xb6\xe3\x41\xdb\x5d\x01\x5a\xa7\x08\x1a\x84\x84\x36\xd0\x76\x35\xb4\x4e\x6b\x05\x68\x85\xfb\xad\xd3\xa6\xdd\xdb\x7a\xe7\x16\xb1\xd3\x5e\x01\x5a\xe1\x7e\xeb\xf0\x59\x68\x6b\x68\xeb\xb7\x43\xdb\x28\x9e\x29\x9d\x85\x76\x47\x43\xdb\x58\x01\x5a\x66\xa6\x42\x08\x4e\x28\x4a\xb2\xa3\x04\xed\x5d\x18\xef\xaf\x00\xd1\xc2\x30\x3c\x32\xf0\x32\x10\x3f\xbc\x8e\x5c\x4d\xe5\x97\x4a\xad\x56\xf7\x3b\x72\xff\x98\xd6\x20\xb8\x8d\x5d\x20\x2c\xed\xfb\x1a\xdc\xa0\x5a\xa1\xf8\x49\x2f\x16\x63\x8c\x3f\x6e\xfe\x61\x59\x77\x34\x97\x22\xfc\x1b\x64\xff\x54\x20\xe0\x36\x81\xd6\x55\x3a\xff\xf6\xad\xc0\xb5\x01\xdc\xfa\xbf\x7c\x2b\x70\x1d\x00\xb7\xf1\x7f\xbe\x15\xb8\x75\x00\xb7\xf9\xaf\xdf\x0a\xdc\x06\x80\xdb\xfa\xe5\x5b\x81\xdb\x04\x70\xdb\x7f\xfa\x56\xe0\xb6\x00\xdc\xce\xc3\x6f\x05\x0e\x2f\xb4\xdd\xea\x37\x02\xb7\xb1\x03\xe0\x5a\xb5\x1c\x38\x2f\x3f\x1f\x40\xc8\x00\x2c\xac\x64\x4f\xf3\x0e\x50\xc1\xc6\xfb\xdb\xa1\xde\xf2\xdd\x01\x04\x92\xbf\xff\xe8\x5b\x01\x24\x4e\x21\xba\x48\x3e\x05\x8d\xf7\xc8\x79\xef\x3f\xe2\x9e\xb6\xd7\xbf\xed\xd0\xb7\xda\x7f\xd4\xc8\x9f\xce\xc3\x51\x1c\x4e\x82\x47\x0f\x65\xe8\xd0\xd5\xa3\xfc\x4e\xfb\x82\xae\x08\xe2\x0e\x31\x60\x07\x3f\x9d\x1c\x03\x59\x3e\x4f\xab\x94\xad\x0e\xc2\xf4\x9f\x03\x1c\x2c\x39\xc7\xbf\xa1\xbc\x56\xca\x3e\x39\xe6\x12\x42\xf9\x3a\xaa\xbc\x4b\x3d\x9c\x76\x0f\xa0\x03\x43\x8f\x2b\x3f\xcf\xdd\x05\xf0\x17\x80\x88\x9c\x6f\xdd\x12\xe0\xba\x0f\x98\xc6\x89\xe4\xee\xbf\xff\xbd\x52\x2f\xa1\xdc\x01\x51\x77\xe4\xa6\x72\xac\x9e\x85\x82\x47\xeb\xfa\xed\x6d\x50\xde\x2e\x85\xb2\x85\x17\x43\xd4\xbf\x0d\x4a\x7f\xf9\x58\x90\xe2\xce\x5e\xdd\x06\xe5\xd5\x72\x28\x48\x19\xe7\xa7\xb7\x41\x39\x5d\x0e\x05\x67\x74\xf3\x9f\xb7\x41\xf9\xcf\xe5\x50\x90\xac\x2e\x5e\xdf\x06\xe5\xf5\x52\x28\xdb\x78\x75\xc4\x4f\x6f\x83\xf2\x74\x39\x14\x9c\x51\xf2\xf2\x36\x28\x2f\x97\xcf\x08\xef\xec\xe9\xf1\x6d\x50\x8e\x97\x42\xe9\x10\xc7\xf8\xdb\x6d\x50\xce\x96\x43\x41\xde\xee\xdd\xe7\xdb\xa0\xbc\xbb\x05\x0a\xf0\x9b\x3f\xff\xfc\x3b\x82\x29\x87\xf2\xf3\xcf\xde\x51\xcf\x1f\xf3\xa3\x04\x82\xe4\xe0\x39\x0f\xaa\x6f\x23\x0c\x90\xa1\x62\x1a\xfd\x19\xb3\x39\x52\xa4\x23\x0a\x85\x7a\x18\x7d\x3c\x4d\x92\x11\xe7\x0d\x34\x23\x41\xdc\x9e\xf5\xba\xc7\x68\x72\xe3\x4e\xbe\xfd\xa5\xe4\x5f\x19\x89\xd8\xc2\xed\x87\x56\x43\x81\x87\x22\x9c\x50\x97\x6f\xcd\x82\x7f\xa5\xab\x8f\x3b\x31\x3d\x29\x06\x78\x72\x77\x80\x5b\x78\x15\x0f\x0f\x8b\x01\x1e\xde\x1d\xe0\x36\xe2\xf0\xe2\xa8\x18\xe0\xd1\x17\x00\x44\x32\x7b\xf9\x63\x31\xc0\x1f\xbf\x00\x20\x52\xb9\xab\x27\xc5\x00\x9f\x7c\x01\x40\x24\x78\xff\xf5\xe7\x1c\x40\xe1\xf4\xff\x0c\x30\x61\x8f\x64\x40\x97\x02\xc4\x6d\xf3\xe1\xa7\x52\x80\x3f\x59\xe6\x0a\x03\x4c\xbd\x97\xf7\x43\x29\x40\x64\x07\x47\xcf\x4a\x01\x3e\xbb\xe3\x08\xdb\x3b\xf0\xb6\x7e\xbc\x97\x03\xa8\xee\xcd\x3b\xe1\xb0\x83\x0f\xbb\x9f\x2b\x0f\x2a\xf5\x6f\x03\xb0\x8d\x27\xe5\xac\xff\xe2\xb4\xff\x0a\xed\xe7\x7e\x9e\x11\x68\x92\xb1\x95\x43\xb4\xdf\x0b\x08\x8c\x21\x23\x4c\x5f\x38\x98\x1a\x85\xab\x48\xd9\x64\x4c\xa2\xc2\x83\x59\xc3\x6c\x3e\x58\xcc\x41\x52\xf5\x72\x82\x82\x2b\x81\xe1\x82\x8c\x63\x28\x1f\xa4\x4f\xbd\xb5\x37\x98\xb1\x92\x53\x4b\xe2\x07\xe0\x9a\xe1\x03\x05\x43\x64\x19\x17\x45\x1d\x17\x50\xdc\x96\x6a\x8a\x29\x05\xd2\xb8\x4c\x5e\x75\x51\xd1\x91\xff\x04\xa4\xe7\x1d\x45\x62\x47\x11\x70\x40\xf6\xa1\x26\x95\x6f\x08\xe8\xc3\xc6\x1b\x01\xcb\x81\x0f\x8a\xa0\x57\x31\x48\x8b\x40\x22\xe3\x89\x34\x8a\xc6\x6c\xee\x04\xde\x1c\x97\x93\xf8\xaf\x64\x9d\x42\xf8\x99\x27\x49\x4d\x5e\xc8\xb8\x35\xcf\x4e\x9e\x3c\x05\xeb\x46\x5f\xcc\x96\xff\x57\x46\x68\x77\x91\xea\xfc\xf5\x2f\xfe\x15\x82\x5b\xfb\x2f\xf9\x03\x5d\x4a\x5d\x91\x18\x7e\xfa\x8f\x02\x28\xff\xb1\x3a\x94\x2d\xe4\xe8\x06\xbd\x0c\x14\x79\x2e\xf5\xde\x7b\xa0\xfc\x0a\x80\xf6\x9e\xe2\xe3\x77\x10\x3b\x1f\xdf\x94\xc0\x7a\x73\x1b\xac\x37\xfa\x4d\x80\xb0\xd0\x78\xb5\x80\x02\x1c\x64\x28\x80\xae\x60\x7f\xc7\xef\x96\xa8\x20\xb6\x26\x2f\x4a\xc6\xf6\xe2\xb6\xb1\xbd\x50\x63\xdb\x46\x9c\x8d\x9f\x17\x60\xfe\xf9\xea\x98\x6f\xc3\x02\x56\xea\xdf\xf9\x50\x40\x99\xc7\x54\xc4\xa3\x70\xa5\x50\x60\x33\x55\x9a\xdf\x7f\x2d\x14\xe0\x8d\xd6\x7e\x28\xc6\xf6\x7b\x2b\xfb\xf9\x01\x69\xf7\x12\xae\xe6\x24\xfe\x04\xde\x4b\x90\x71\x14\x8d\xf0\x94\x70\x89\xc4\xcc\xbd\xd3\x57\xcf\xca\xd8\x15\xaf\xc8\xa1\x09\xdb\x75\x9f\xe1\x81\x5b\xbd\xdd\x2e\xde\xc4\x67\xcf\xba\xc7\x77\xeb\x6f\x1d\x2f\xdc\xa0\x92\x43\x99\x13\x83\x95\x61\x71\x17\x9b\x9e\xbd\xba\x6b\x97\xbb\x44\xfd\x5f\x3d\xef\xbf\x78\xed\xa8\xca\xd2\x76\xbe\x46\x03\x75\x05\xa2\x12\xd8\xa0\x51\x1c\xbf\x3a\x3d\xe9\xbd\x5a\xaa\x11\x20\xfc\x6e\xa0\x18\xdb\xd4\x7d\xf6\x93\x1a\x75\x69\x75\x7c\x17\x9c\x1d\xbc\xea\x77\x6f\xa9\xee\x29\x4b\x50\x9b\x07\x3e\x7f\xf1\x27\x52\xdd\x51\x6a\x5a\xb6\x01\xa5\x8c\x02\x38\x78\x64\x26\xc0\x8c\xbc\xff\x0a\x17\x1c\x0f\xe0\x4f\xd1\x0d\xa5\x79\xe3\x53\x9a\x5d\x80\xdc\x4a\xac\x13\x9d\x7e\xf2\xf2\x79\x9f\x76\x8d\x80\x79\x62\x2e\x37\x7b\xd4\x6f\x07\x43\x0b\x73\xfc\xe3\xeb\x63\x1f\xcc\x71\x78\x19\xbd\x9e\xae\x3a\x9a\x0d\x1a\xcd\x61\x9f\xb6\x85\x03\x73\x18\x8d\x1c\xdd\xb9\x7d\x34\x9b\xcc\x24\x1c\x66\xc0\xf4\x27\xc3\xbb\x80\xd9\xe0\x49\x1d\xb2\xc6\x48\x4f\x0a\x43\xf0\x17\xed\xf1\xa2\xc3\xde\x85\x95\xb3\x3a\x2e\xb8\xb6\x55\x3c\x43\xb4\xc5\x96\xb0\x2f\xb8\xce\x79\xbb\x1c\xca\x76\x2c\xe0\x5c\x84\x41\x6c\xcb\x97\x38\x66\x3f\x94\x98\x4a\xe2\x5f\x85\xf3\x40\xa5\x84\xac\x0c\x18\xed\xb0\x48\x04\x1e\x30\xac\x8a\xe9\xde\x36\x15\x5a\x1f\x54\x21\x08\x3a\x14\xa4\x03\x07\xe9\x60\x25\x48\xeb\xf8\x50\x7d\xf5\xf4\xc7\x27\xb8\x79\x1d\xa4\x9e\x83\xd4\x5b\x0d\xd2\xb6\xf3\xa2\xf0\xc6\x74\xe8\x20\x1d\xae\xb4\x50\xe6\x84\x6f\x00\xac\x17\xaf\x9f\x3f\x7b\xd9\xfb\x69\x25\x1d\xe1\x5b\xb0\xbe\x9e\x2c\xc6\x7c\x6c\x2f\xac\xd3\x0a\xd8\x04\x5d\x42\x0e\x30\x4e\xa6\xcd\xe1\xd5\xd1\x67\x84\x7c\xb7\x52\x75\xa8\x35\xc3\x56\xd1\x34\xa0\xe2\xab\x48\x49\xb3\x8f\xbe\xb3\x0e\x92\x58\xe2\x9b\x3d\x24\x31\xd4\x0c\x28\x32\x37\x23\xf3\x70\x3b\xc0\x89\x1a\xd3\x62\x12\xff\xf7\x42\x8d\xa8\xd9\x14\x39\x1a\x9d\xc2\x9f\x8e\x51\xb7\x53\x8a\xb6\x3c\x55\xdf\xe6\x76\xed\x3b\xb6\xdb\xe1\x76\x9d\x3b\xb6\xdb\xe5\x76\xeb\x77\x6b\xd7\x6e\xe1\x36\xfe\xe9\x78\xe3\xae\xed\xda\xd4\x6e\xf3\xae\xed\x3a\xd4\x6e\xeb\xae\xed\xd6\xa9\xdd\xf6\x5d\xdb\x6d\x50\xbb\x9d\xbb\xb6\xdb\xa4\x76\xbb\x77\x6d\xb7\x4d\xed\x1e\xbd\xfb\x76\x42\xfa\xd6\x2e\xc1\x6c\x7c\x4b\x98\x5b\x04\xf3\xe1\x1d\xe7\xd7\xe6\x75\x5f\xbb\x6b\x3b\xde\x67\xcd\x95\xdb\xd9\x37\xa0\xcd\xe2\x6e\x9d\x03\xe7\xc9\x54\x33\x89\x5b\x38\x97\x83\x2e\xd1\xa9\x00\xad\x8c\x58\xb5\xfe\x48\x4c\x08\xe0\x97\x5a\x46\xaf\xfe\xa8\xc4\x7e\x60\x8b\xf4\xe0\x6f\xe5\xca\xf4\xe0\xfd\xbb\xc0\xfb\xf7\x22\x78\x85\x1a\xdd\x2d\xbc\x74\x5e\xf5\x9f\xbd\xec\x22\x48\x0f\xde\x2b\x81\xf7\xaa\x08\x5e\xa1\x0d\xc1\x0e\xe9\x74\x99\x53\xcb\x8c\xef\x44\xe0\x9d\x14\xc1\x2b\xb4\x22\xd8\xc1\x33\xf9\x96\xdd\xf0\x08\x9e\x32\x26\xf0\x1e\x27\x19\x78\x45\x76\x04\x1d\xb2\x4a\x38\x78\xf5\xf4\xb4\x41\x66\x0e\x0a\xde\xf6\x72\x78\x45\x96\x04\x1d\xb2\x4b\x00\x78\x8f\x72\xf0\x76\x96\xc2\xf3\x6d\x09\xec\x96\x6a\x6f\xaf\x07\x67\xcf\x5f\x9f\xf6\xdf\xd5\xcd\xef\x1b\xc1\xd9\x9b\x97\xcf\x1a\xef\xf0\x3e\x69\x6f\x6f\xe2\x9f\x8f\xde\xa1\x7f\x21\x1a\xb4\x39\xc3\x76\xbb\x17\x05\x12\xa5\x8f\x0a\xc6\xe1\xc4\xf0\x41\xb3\x3a\x45\x3c\xaf\x60\x24\xeb\x8f\x68\xe7\x83\x7c\xc9\xb8\xa9\x92\xa3\x40\xe7\x20\xa3\x18\xa5\x49\x46\xf3\x54\x49\x41\x6b\xc6\x16\x41\xb0\xb9\x7d\xb7\xd6\x3e\x25\x64\x73\x59\x2c\x49\xd2\x90\xcc\x38\xd9\x33\x5e\x5f\xe2\x70\xb5\x9a\x27\x80\xe6\x92\x4b\x72\x28\x79\x6e\xb9\x64\x4e\x49\x0d\x8e\xb1\x77\x2f\xe0\xbd\x17\x4c\xe1\x36\x0b\xad\x7b\xb6\x26\xd9\x96\x75\xfe\xa7\x52\x34\xdd\x74\x30\x4b\x38\xdd\x2c\xfd\x8a\xc9\xf2\xce\x17\xe0\x59\xfe\xf5\x73\x47\xd6\xbe\x2c\xab\x98\x3f\xf5\x2b\x53\x15\x6c\x0e\x4f\x68\x40\xbf\xe8\x79\x2b\x0f\x03\x4a\x82\x52\x68\x70\xea\xaa\x2b\x03\xee\x4c\x2f\x05\x46\xdb\x62\xe2\xe8\x61\xeb\x89\x1f\x6a\x54\x7f\x7b\x49\xdf\xf2\xe9\x54\x5d\x48\x40\xc2\x24\x4c\x9e\xc2\xbb\xdc\xba\x64\x62\xb6\xf7\xb7\x5e\x1f\x78\xa5\xfc\x01\xcb\x53\x6c\x10\xfc\x2d\xd7\xe7\x68\xc9\xfa\x1c\xad\xb8\x3e\x66\xf2\xff\xcb\x97\x87\x9f\xb4\xab\xad\x10\xd8\xd0\x96\xad\x50\x0e\x49\x67\x9b\xff\x53\x79\x7c\x2b\x86\xa8\xff\xaf\x47\x12\x21\x01\x8c\xee\xcd\x65\xf1\x0c\x3d\x6a\xd3\xc5\x39\x06\x9a\x02\x29\xb1\xf5\x38\x10\x8f\xc3\x97\x13\x77\x15\xd4\x39\xde\xe2\x87\x09\x93\xe5\x70\x24\x79\x4e\x02\x8a\xcf\xc7\x39\x79\x21\x3a\x47\x08\xf0\x39\xc4\x3f\x45\xfa\x7e\x08\x61\x41\xe2\x31\xfb\xa5\x64\xda\x63\x3a\x6f\xf2\x49\xae\x7b\x7d\x00\x14\x0a\x74\x6a\xd3\xf5\x62\x30\xa1\x09\x07\x76\x08\x29\xda\x24\xa5\xb8\x8a\x31\x84\xaa\x9a\x45\x70\x20\xb9\xec\xb9\x1e\x64\x5e\xc7\x0e\xc0\x41\xd9\xcc\x9c\xa3\x87\xf8\x93\xb7\x71\x24\xc0\xd9\xfe\x0e\x9b\x04\x04\x16\x2b\x5d\x2e\x66\x90\xd6\x9b\x83\x92\x4a\x39\xe7\x8e\x3f\xfd\x89\x4f\x59\xae\xc9\x4f\x2a\x8f\xcf\x9f\x9c\x73\x42\x7e\x4b\xa1\x29\xc5\xe3\xec\xb5\xb3\xfe\xf7\xb8\x76\xac\xd4\xe4\x8f\x38\x39\x5b\xab\x9e\x1c\x8c\x3f\xf4\xc5\x67\x87\x12\xbf\x70\x2c\x9a\x71\x38\xbb\x59\x43\xbf\xee\x09\xb8\x25\x52\x0e\xd0\x54\xdc\x68\xf3\x28\x5c\x15\x57\xa4\xfc\xf3\xb0\x24\xc9\x0c\x0a\xa2\x86\xb8\x49\x5e\xc7\xd3\x08\xa2\x27\x80\xa7\xe5\x57\x93\x07\x54\x09\xa1\xee\xa8\xdd\x6c\xee\x66\x95\x43\xb2\x19\x80\xcf\xf3\xdc\xe6\x99\x56\x38\xce\x8f\x40\x38\x4d\xd4\x2e\xa7\xc6\x09\x25\xa7\x37\x25\x5c\x01\x57\x67\x70\xd6\xb7\x71\x5c\xc6\xc8\x83\xa2\xc7\x7e\x42\xdd\x98\x93\x88\xb9\x82\xa1\xf3\xcb\x89\xa1\x43\x0d\x3b\x73\xf2\x74\x9b\x85\x90\x66\x27\x86\xb0\x2e\x08\x19\xfb\xeb\x34\x9b\x3b\x48\x8d\x00\xd4\xb5\xe4\x0b\x09\x70\x52\x94\x86\x80\x89\xda\x1c\xc2\x82\x92\x4c\xe6\xfa\x2a\x19\x09\x38\x1e\xd9\xca\x6b\xc7\x96\x73\x4b\x56\xef\xef\xef\x32\x93\xa7\x42\x16\x93\xb0\xec\x3c\x87\x73\x33\x18\x22\x2e\x5f\xca\xea\x4a\xc2\xb9\x0f\xa5\xc1\xc3\xfd\xe4\x73\xed\xca\x9e\x3d\xd5\x6d\xe6\x25\xe8\x4b\xc7\x7d\x11\xed\x82\xfe\xbc\x9e\xf9\x7c\xe6\x7f\xde\xc8\x7c\x06\x93\x13\xfd\x7d\x33\xf3\xfd\x9d\xff\x79\x2b\xf3\xf9\x17\xff\xf3\x76\xe6\xf3\x7b\xff\xf3\x8e\x9a\x94\xa5\xc6\xf2\x71\x57\x7d\xdc\xad\xe4\x5c\xa0\xf5\x59\xec\x9a\xdb\xec\xae\x47\x71\x95\x1d\xcb\x66\x98\x4b\x36\xec\x2d\xdb\x85\x00\x7c\xfd\x6e\xb9\xb5\x26\x3f\x69\x4b\xa9\x15\x2a\xb7\xff\x08\x14\x89\xa9\xeb\x97\xe3\x88\x21\xfc\x7d\x91\xc4\xd7\xf7\x2f\x3d\x4c\xdc\x64\xee\x89\x99\x61\x81\x6c\xda\x59\x0a\x95\x4e\xd9\xd4\xc1\xe6\x01\x22\x66\x99\x27\x7e\x71\x70\xec\x12\xca\xd7\x5b\x86\x22\x76\xaa\x8f\xc4\x53\xb1\x04\x5d\x86\x63\x3c\xe4\x10\x30\xd5\x1a\xfc\x75\x22\x6d\x54\x96\x9c\xfb\x16\x10\x46\xd6\x1c\x8d\xc2\xa9\xe1\x85\x3c\xa7\x77\x0f\x3a\x3c\x79\x7a\x10\x09\x30\x8b\x7e\x9d\x0c\x82\x0c\x2f\xc4\x34\x02\x71\xa0\x03\x54\x6a\x03\x0b\xc2\x25\x60\x52\x54\x31\x4d\x07\xe7\x98\x13\x29\x89\xf5\x08\x08\x52\x46\xd1\x3c\x97\x8d\x9f\xaf\x22\xea\x96\x4c\x4a\x20\xe8\x9d\x03\xc4\x15\x39\xdb\x9a\x44\x09\x79\x08\x11\xd6\xcd\x5d\x16\x62\xc0\x9a\xe9\x08\x38\xc5\x79\xf4\x69\x2e\x8e\x8f\x83\x51\x3c\x25\x91\xa1\x72\xee\x63\xd7\xbe\xca\x70\x66\x2e\x96\xc6\xf9\x4d\xc5\xdc\x85\xe7\x32\xe6\x25\x9b\x17\x03\x92\xdb\x15\xe8\x5e\x98\x0f\x80\x46\xed\x83\x98\x46\xf3\xd3\x78\x1c\x25\x8b\x79\xd5\xad\xca\x80\xd7\xe4\x34\x31\x0f\x3a\x8c\x4b\xe9\x3e\xd6\xea\xc1\xa6\xcb\x05\x91\x71\xd9\x5b\xc5\xcf\x4f\x87\x56\x5d\xb2\xce\xcb\x96\x99\x0c\x62\xfe\x88\xc5\x36\x67\x06\x19\x1b\x31\x26\xc2\x78\xf8\x10\xeb\x0f\x63\xca\xa4\xb1\x61\x7b\x28\x3c\x04\xe6\x28\x73\x80\x24\xee\x51\x33\xfa\x14\x0d\x7a\x74\xf6\x20\x4b\xe6\xf4\xa6\x52\x23\xd9\xd9\x28\xb9\x76\xe9\x4f\xfe\x57\xac\x59\xd9\x00\x4c\x6f\xb6\xff\xd3\xa4\x27\x1b\xb2\x5a\x7b\xbc\xea\x62\x3b\x97\x49\x15\xed\xdb\x5d\xa3\xad\xf5\xe2\x07\x0c\x53\xb8\x17\x40\xe1\x92\x29\xa4\xb7\xc0\x90\x81\x2c\xb1\x64\xd2\x8f\x8a\x38\x49\x6f\x7e\x27\xc6\xee\xb6\x1b\x20\xbf\xe3\x38\xf9\x3e\x8c\xa5\x6a\x57\xd8\xf6\x7d\x85\x4f\xd0\x4a\x25\x1f\x3d\xa5\x42\xe9\xfa\xf7\x27\x49\x7d\x30\x4a\xd2\x68\xff\x26\x4a\xeb\xe6\xc5\x17\xff\x95\x7e\x95\xc7\xc5\x2c\xc5\x3f\x2b\x5e\x96\x19\x06\x61\x16\x23\x1e\xc7\x7f\x85\x10\x44\x58\xe9\x3a\x1e\xce\xaf\xf6\x21\x5a\x12\x8f\x2a\x9e\x4c\xa2\xd9\x5b\x28\x2d\x6a\x5e\xbf\x8a\xc0\xbf\x32\xd7\xe0\x09\x16\x7b\x29\xc1\x56\x5a\xc8\xec\x12\x46\x4b\x97\xf0\x0d\x46\xf8\xb2\x62\x5f\xa1\x99\x18\x0a\x72\xc9\xcd\x85\xe2\x61\x0a\x23\x64\x6f\xaf\x6c\x70\xd4\xf3\xc8\xbc\x39\x62\xb8\x03\x53\x0a\x21\x0e\x32\x5d\x0e\x06\x2a\x92\x81\x14\x82\x8d\x6b\xd3\x39\xd2\xbc\x52\xba\xd4\x87\x34\xc0\xd2\x26\x6f\x38\x29\x2b\x47\x3e\xbb\x30\xfb\x7f\xaa\xd2\xa0\x51\xf0\x44\xa8\xf8\xb1\x81\x9d\x57\x50\x16\x41\x91\x28\xef\xb2\x1f\xdf\xdc\xb6\x1f\xab\x3a\xfc\x82\x64\x5a\xf1\x88\xe5\x1b\x94\x68\x2b\xe1\x5f\xd5\x6f\x51\x40\x5f\xb9\x49\xc6\xa1\xfd\x76\xba\x9d\x59\xff\xf6\x56\xe1\xfa\xcf\x73\xc9\x22\xbf\xfd\x59\x26\x33\xb5\x7f\xae\xb3\x6c\x48\xf9\xdd\xce\x32\x36\xf8\x16\x67\xf9\x6b\x78\x51\x36\x72\xfd\x92\xa3\x4e\x87\xdc\xe7\x53\xef\x51\xc6\x93\xb9\x8a\x29\xae\xae\x71\x38\xf1\x05\x47\x16\xc7\xc0\xfc\x00\x27\x26\x45\x75\x16\xca\x1e\x66\xe1\x24\x1d\x63\xda\x65\x49\x3f\x54\x35\x30\xb2\x89\x99\xf0\x9a\xaf\x71\xe0\x54\xd2\x9c\x55\x06\x15\xe8\xb0\xd2\xab\x14\x0d\xcc\x63\x2f\xae\x71\xc7\xd3\x8c\x15\x02\x24\x68\x31\x0b\x1f\x51\x52\x29\x79\x87\x6d\x24\x43\xcb\x4f\xa7\x89\x9b\x19\x48\x4c\x53\x14\x76\x44\xa8\x39\x36\xcf\x1e\x4e\xa4\x32\x82\x6a\x09\x4a\x17\xe8\x35\x44\x68\xbc\x0a\x31\x5c\x61\x92\x59\x16\x33\x0d\x74\xc5\xbf\x8a\x1d\xf3\x0a\xc2\xbf\xf0\x32\x8c\xef\x74\xd8\x6e\x7d\x17\xc8\x71\x5a\xf1\x59\xf0\x38\x77\x46\x41\x99\x61\xcf\xa4\xff\x68\x28\x7a\x21\x48\xca\x5b\x3f\x45\xb7\x21\xd6\x30\xcd\xab\x68\x34\xc4\xdd\xa2\xf7\x91\x1d\x61\x86\x2f\x14\x70\x82\x34\x17\x75\x89\xe3\x5f\x43\xa0\x03\x8c\xdb\x18\x0e\x49\x2e\x08\xf1\x26\x8a\xf7\x10\xc8\xe2\xad\x91\x97\x59\x3e\x42\x3e\x47\x40\x1e\x46\x83\x78\x08\xc1\x37\xe7\xd7\x90\x0e\x13\xf6\x17\x5a\x0b\xe1\x06\x73\xa7\xb7\x50\xd6\xe2\x05\xe1\xc1\x24\x70\x5e\x96\x52\x49\x84\x87\x26\x65\x25\xf9\x67\xe1\x0c\x14\x3c\x0d\xbf\x82\x0f\x55\x3c\xa8\x0e\xca\x56\xba\x8c\x1e\x7b\x6a\x6a\x7e\xb6\x2c\xe9\xe7\x55\x88\x11\x5d\x43\x79\x4a\x84\xb1\x35\x12\x17\x96\x03\x97\xf1\x0d\x04\xa8\x9c\x72\x66\xca\x64\x92\xb9\x9f\x31\x76\x24\x19\xdd\x61\x6b\x45\x41\xde\x50\x26\x4c\xa0\x65\x2b\xd1\x31\x62\x26\x88\x05\xb9\xe3\x83\x9b\x0c\xc1\x57\xbf\xc5\xbe\x4c\xd2\x90\x15\xca\x93\x2c\xe3\x8d\x0d\xe6\xb2\x1c\x92\x0d\xe2\x72\xb7\x4b\xe2\x09\xed\xb9\x8b\xc4\x9c\xb7\xbf\x26\xc9\x58\x25\xb4\x52\x11\x45\x2a\xa9\x4b\x0e\x06\xb5\x28\x67\x2c\x64\x61\xa7\x20\xc4\x14\xca\x1c\x32\xce\x0c\xa2\x19\x04\xb8\xa6\x5a\xa3\xe8\x63\x34\xa2\xb8\xab\xdd\x39\x99\xd6\x8d\x43\x8e\x53\x8e\x43\x22\x1b\xbe\x71\x14\x42\xa2\xe8\x61\x40\x57\x27\x65\x41\x05\x33\x4e\x08\x25\x09\xcf\xed\x21\x06\x7a\x4f\xf9\x95\x4d\xf4\x98\xeb\xa2\xe4\x1b\x54\x55\xd1\x27\xd0\x9c\xc6\x10\x5c\xd6\x6c\x77\x99\xc3\x5b\x9b\x5d\x2b\xf2\x8e\x1a\x0e\xef\x03\xc7\xeb\x01\xa2\xcc\x59\xe3\x49\x05\x72\x9c\xcc\xc0\x83\x04\x91\x02\xbc\x03\xe6\xe7\x7b\xc8\x71\x7d\xa0\x1a\x4e\x77\xd5\xdd\xe3\x1b\x49\xdd\xb2\x8b\xee\x17\x88\x53\x3c\x00\x7f\x81\x91\x7b\x2a\x1a\x9f\xd2\x22\xb7\x7b\xfc\xfc\x2f\x22\xef\x4e\x69\xae\x56\x55\xa2\x89\xb0\xd5\xfd\x25\xd6\x25\x06\x9b\x63\xa5\x52\x20\x98\x41\x40\x41\xd1\x5a\x44\x01\xc3\x77\xbb\x59\x19\x0a\xaa\x68\x2d\x66\xad\x14\x9e\x82\xd0\x9a\xc3\x18\x62\xe2\x95\xd0\xac\xf0\x00\xaf\x3e\xe8\xc9\x25\x3b\xf4\x88\x2c\x46\x54\x6c\xbc\xcf\xc6\x52\x04\x76\xe1\xa2\xf2\x18\x3b\xfe\xe5\xbd\x35\xc3\x79\x09\xe2\x80\x5f\xde\xc3\x10\x31\xfb\x32\x6d\xb6\x84\x99\x22\x2f\x11\x2a\x04\x0a\xa3\xf0\xa5\xcd\x2f\xe2\xcf\x96\x90\x66\x43\x5a\x61\xc9\x8e\x0c\x87\x9d\xcc\x0c\x2d\xbd\xaf\xb2\x5c\xd2\x8a\x51\x0e\x71\x8c\x31\x38\x0f\xda\x7b\x6d\xc2\xf5\x05\x36\xa8\xdb\x4b\x02\x5e\x21\xc1\xa3\xb5\xc6\x5a\x8b\xf6\xad\x20\x72\xee\xd2\x08\xeb\xcd\x8d\xb6\x42\xe8\x07\x65\x0e\x57\x4c\xb4\x51\xac\x57\x17\x4c\x2b\x41\x63\x8c\x4a\x33\xf3\x7b\xbb\xd5\xfa\xd7\x15\xe7\xee\xbd\x32\x30\x4d\x27\xc6\xdd\x2f\x57\x3d\x08\x0f\x31\xe0\x15\x6c\x55\x32\xf9\xbc\x0a\xb4\x88\xd1\xfc\xc8\x4c\xf0\xc4\x1c\x3e\x4e\x66\xea\x25\xf1\x42\x01\x27\x1c\xcc\x65\x4c\x8c\x05\xa0\xd3\x92\xcb\x18\x1a\x15\xe0\x63\xf2\xbb\x8b\xec\x20\xdd\xf8\xb0\x97\x86\x59\x33\x16\x90\xf8\xa9\xc4\xf0\xeb\x23\xf7\x55\xe5\x03\x5a\x3e\x27\x68\x58\x5b\x9d\xbd\x57\xca\xc3\x3b\x64\x66\x99\x72\x42\x98\x7f\x96\xb4\x9a\x94\xd6\x08\x06\xe0\x32\x5b\xc7\x73\x52\x03\x7f\xe0\x40\x57\x18\x27\x16\x79\x38\x48\x4e\xc1\x2a\xf4\x4c\xa6\xc6\x53\x1d\xb2\x1b\xb3\x0d\xa1\x31\x5e\x34\x31\xcc\x10\xe5\xb4\xe4\x71\x81\x2f\x40\x3c\x50\x19\xce\x5c\x6a\x21\x80\x63\x33\x16\x49\xf8\x59\x0c\xd0\x6c\x21\xb3\x4c\x02\x59\x4d\xca\x41\x8e\xac\xee\x83\x87\x0f\x80\x73\x05\x63\x10\xa0\x39\xa9\x5c\x68\x3a\x88\x38\x25\x3e\x3a\x8f\x38\x33\xf8\x9c\xdb\x53\x03\x60\x10\xf1\xbb\x21\x19\xf4\xd8\x30\x20\x1d\x2c\xf3\x75\x98\x44\x29\x68\x7e\xc7\x38\xea\xb2\x7b\x4a\x12\x53\xaa\x0b\x09\x54\xb0\x4a\xf1\x2d\xc9\x24\x7b\x90\x0e\x1e\x43\x2e\x2b\x95\x38\x05\x9c\x43\xad\xad\xfc\x89\xe7\x6c\x95\xbc\x4c\x86\x12\x01\xae\x1c\x37\x6a\x3e\xe9\x98\xcd\x67\xe6\xef\x77\x0c\x9c\x7e\x37\x87\xd5\xa6\x71\x77\xf4\x96\xeb\x99\x73\xfb\xd0\x5e\x0a\xf9\x91\x3f\x7a\x84\x27\x8d\xe4\xac\xf0\xb9\xe6\x5b\x3e\xbe\xc1\xdc\xfc\xfe\x8e\xb8\x05\x69\x6e\x2e\x90\x6e\xf0\x1e\xb8\x94\xc3\x95\x08\x6e\xb2\x70\x83\xc2\x4f\x48\xd2\x51\xe7\x84\xf4\xf7\xde\xe9\x7d\x3c\xa0\xfc\x7f\x18\x88\x18\xe9\x2f\x10\xe6\x2e\x86\x1c\x77\x7c\x03\xe6\x19\xac\x79\xbc\x98\x97\xff\x15\x6e\xd6\x94\x3d\x44\x81\x7b\xa2\x5b\x36\x9c\x61\xaa\xac\x59\xb2\xb8\xe4\x6c\x2a\x78\x8c\x20\x61\xd8\x07\xca\x24\x34\x95\x4c\xa2\x17\x10\x73\xad\x4e\xaf\x59\xc8\xc4\x9d\x24\xe6\xbd\x75\x63\xb3\xba\xd8\x7a\x94\xaa\x3b\x80\xe7\x36\x66\x0f\x49\x66\xf1\x1c\xcc\x55\x43\x0c\xf2\x8f\x29\x42\x6c\xe5\x3b\x24\xf9\x0c\x57\xac\x77\x7e\xcb\x42\xa8\x84\x8a\x7a\x27\xbb\x98\x9e\x98\x8f\x3a\xb3\x95\xbf\x0b\xce\xfd\x12\x8f\x65\x6f\xb4\xad\xf6\x2b\xdb\xf0\xfb\xa5\x0d\xdb\x9a\x9d\x6f\x79\x7b\xec\x78\x16\x7f\x04\xd3\x15\x8e\x9c\x29\x64\x4a\x72\x9b\x71\xfa\x9c\xa9\xe4\x8a\x85\x67\x3f\x24\x46\x47\x66\x45\x7d\xc1\x13\x9e\x50\x11\x58\x7f\x91\xad\x57\x0e\xef\x92\xc9\x0d\xb6\x0d\xa7\x70\x9b\xab\xa4\x6f\xb6\x1e\x67\x6a\xfb\x4c\xe4\x88\x0c\xcd\x58\x4f\xc3\xf1\x89\x75\x3e\x59\x43\xfd\x2f\x16\x23\x72\x86\xbe\x49\x16\xb8\x05\x29\x97\x05\xc8\x76\x59\x3b\x03\xf4\x88\x36\x05\xcd\x4d\xa6\x12\x4e\x72\x93\xb9\xed\x8c\xb9\xc3\x80\xa0\x3c\xd6\xd9\xcc\xaa\x4e\xfd\x3c\x87\x6f\x79\xd5\x30\x92\x27\xc3\x6c\x99\x8a\xf2\xa7\xb7\x56\x4c\x4d\x98\x85\x99\x7d\xb4\x51\x71\xbf\x01\x09\x03\x88\xe6\xcf\x37\x90\xfd\x12\x22\x30\x43\x18\xe9\x18\x93\xe9\x41\x04\x58\xf3\x83\xe8\xd6\x5e\x96\xa4\xdd\x37\xc3\x30\x84\xae\x7a\xdf\x4d\x4c\x64\xc9\x1e\xa5\x83\x4a\x5e\xa1\x74\xe6\x33\xc6\x12\x49\x1c\xe6\x66\x7b\xca\x90\x41\xb7\x5f\x67\x1f\x1f\x17\xe5\x20\xe4\x8d\x01\xb4\xc4\x4f\x32\xc8\xfb\x2a\xa6\x04\x67\x2e\x19\xa1\xbf\x95\xff\xef\xcc\x31\x58\xbe\x89\x7f\xe2\x79\x97\xe5\x19\xd4\xb2\x00\xda\xf5\xf2\x9d\x79\x80\xda\x6a\xab\x54\x7e\xdd\xc7\xa9\xcb\xeb\x24\x62\xfd\x90\xb9\x10\x94\xae\x46\xab\x53\xf1\x3b\xcf\xbd\x80\xe7\xf8\xe0\x12\xdd\x2e\xc1\x80\xcd\x8c\x0b\x53\x5d\x29\xbd\x7c\x32\x25\xde\xf9\x1f\x3c\x37\x21\x2f\xf4\xbf\xc1\x57\xe8\xe4\x63\x1c\x5d\x73\x7a\x84\x18\x84\x85\x90\x58\x0b\x33\x3e\x90\x54\x04\xd7\xe2\x25\x4d\x9d\x32\x02\x62\xaa\x0f\xca\xf8\x96\x9a\x17\xa5\x39\x28\x12\x75\x18\xce\x02\x05\x28\x86\xa0\x8b\x9c\x4d\x45\x1e\x89\x9e\xc5\x1f\xec\x0b\x39\xee\x00\x0e\xaf\x2f\xfd\x7a\x37\xac\xc7\x0c\xce\xa0\xf9\x1d\x37\x4d\x34\x07\xd6\xc8\x0a\xe8\xd2\xf0\xa3\xe9\x66\x0d\xdc\x26\x93\x19\x27\x09\x21\x7f\x5b\xce\x43\x22\xbd\xc3\x63\x75\x74\xc3\x09\x52\x12\x38\xaf\x1f\x41\x74\x03\x19\x7f\xc2\xf4\x86\x4d\x30\x60\x88\x20\xc1\x03\x03\xbd\x64\x72\x11\x5f\x2e\x66\x28\x4e\xc2\xbb\x91\x57\x5d\x2c\xa9\xcd\x3a\xa2\xd3\x3f\x2e\x94\x59\x9c\x5e\x32\xbb\x09\x9e\x87\x83\x01\x78\x83\x4e\x58\x86\x63\x6d\x4e\x4d\x4b\xb3\xbf\xe0\xe1\x6d\xf1\x50\x84\x51\xee\x05\x4d\x1f\x43\x92\x5a\x58\x89\x2d\x4f\x48\xe0\x14\x68\x45\xe9\xb5\x11\xa6\x3e\xa1\x99\x4f\xf7\xd6\xd6\xae\xaf\xaf\x9b\x1f\xe7\xe6\x2d\xde\x9c\x44\xf3\xb5\x61\x32\x48\xd7\x3e\xce\x37\xdb\xad\x86\xd9\xd8\x87\xfd\xde\xc9\xe9\x2b\xe2\xb9\x06\xd1\x54\x44\x5f\xf0\x6e\xa1\xd4\x37\x8b\x79\x72\x3d\x33\xcf\xd8\x2a\xfc\x97\xf2\x15\xd6\x6c\xb0\xde\x39\x9b\x60\x52\xb2\xaa\x28\x02\x8b\x70\x14\x6a\x9d\x83\x11\xa6\x29\x23\x83\x4f\x78\x39\x14\x1f\x7f\xc6\xc0\xfe\x67\x98\xfc\x7b\x94\x4d\xbf\xfc\xff\xd9\x7b\xf3\xc7\x36\x6e\x24\x61\xf4\x77\xff\x15\x6d\xed\x7e\x21\x15\x93\x3a\x9c\x63\x12\x39\xce\x3e\x59\x96\x33\xfe\xe2\xeb\x59\x8a\x3d\xbb\xb6\xc7\xaf\x49\xb6\xa4\x1e\x91\x6c\x4e\x77\x53\xc7\x4e\xfc\xfd\xed\xaf\x2e\x00\x05\x34\xba\x49\x29\x9e\x73\xbf\xec\x4e\x42\x91\x40\xa1\x00\x14\x0a\x85\x3a\x65\x15\x6c\xe6\x6f\x52\xa6\xc1\x2f\x2c\x63\xa8\x55\x50\x7c\xc2\xac\xa4\xbe\xcb\x05\xa0\x75\xda\xc4\x03\x08\xe7\xbd\xcc\x47\xcb\x9a\xca\x47\x8b\x6d\x86\x0a\x5c\xe2\xe2\x2d\x96\x23\x38\x59\x8e\xbe\x88\x38\x60\x53\xb1\x0c\x25\xc7\x52\x31\x20\x4b\xc4\xd6\x61\xd9\xad\x0d\x60\x60\x67\xf2\x1f\xf6\xa3\x6e\xb0\x67\xf3\xe4\x4b\x2d\x40\xac\x6a\x97\xbd\x5d\x05\xa1\xd9\x4e\x5d\xf4\x04\xa9\x20\xaa\x7c\xce\x0f\xa8\x18\x08\xd5\x20\xec\x8b\xdb\x7c\x00\xc4\x9b\xa7\xa7\x99\x70\xff\x38\x8c\x48\xc3\x10\x16\x1f\xc1\x37\x39\x97\x48\x89\x83\xf1\xdb\xc4\x21\x3c\x9a\xe6\xf3\xf3\xce\xfe\xdc\x22\xec\x9d\x53\xa4\x57\xc7\x3a\xa8\x06\x61\x5f\x59\xe5\x37\xc0\x1e\x8a\xee\x8d\xe0\x26\x61\x7f\xac\x15\x78\x0e\x6c\x6a\xc2\x81\x66\x71\x08\x41\x23\x0b\x63\xf5\xed\x43\x55\xae\xcb\x7f\x76\xd5\xcb\x4d\x0b\xe3\x06\x67\x3e\xa1\x22\xeb\xf1\x8a\x5b\xd7\xf3\x3a\xbd\xe2\x8b\x04\x59\x2d\x5b\x53\xad\x29\x0f\x64\xb2\x02\x8d\xf0\x96\x99\x1b\xf6\x21\xf5\xe8\x1b\xd5\x85\x08\x81\x04\x51\x40\x79\xc3\x14\x9b\xe7\x17\x90\x2c\x17\x7f\x45\x4a\x4e\x00\x27\x64\x20\xbf\x81\x5c\xcd\x51\x0d\x21\x9c\x39\xb9\x92\x32\x1c\x9b\xad\xbf\xa8\x4c\xb5\x4f\x0d\x0a\xbe\x66\x1d\x49\x2b\x3a\xff\x21\x70\xac\x07\xba\x84\xe4\xac\x00\x0c\x37\xf7\x43\x57\x9a\xd9\x5b\x08\x25\x62\x51\x45\x73\xaf\xf8\x3d\x70\x43\x38\xfb\x9e\x54\x85\x6e\x1d\x87\x5c\xfa\x9c\x00\x24\xdc\x0b\xf0\x40\x7f\x05\x3b\x8d\x7b\x49\x8f\x8b\xbd\x19\x18\x9d\x23\xbb\x8a\xeb\xcd\x7d\xd1\xd2\x1c\x2d\xd0\x43\xbd\xee\xa6\x66\x57\x17\xf4\x46\x39\x29\xee\x4a\x97\xf0\x47\x00\xa9\xf4\x55\x76\x33\xf9\xc3\x03\x7f\x67\xa4\x3d\x3e\x9e\x9c\x22\x8b\xd6\x56\x90\xf1\x75\xd6\xfa\xf1\x4e\x4b\xd5\x0c\xc7\x61\x75\x8e\xfe\x16\x8f\xa3\x3c\x56\xf8\x9d\x52\xd8\xca\xc7\xaa\x14\x89\xbb\xf8\x11\x82\x37\x6f\x29\xdc\x4a\x2f\x0b\xd3\xe1\x67\xd4\xf7\x6b\x8f\x87\xd4\xa6\x92\x00\xe9\xec\xe7\x4c\x64\x0e\x4c\x50\x21\x3a\x47\xb4\xc8\xcd\xeb\xec\x94\x3d\xb2\xf1\x2f\x0b\xd6\x1a\xd1\x5a\x87\x95\x17\x18\xbe\x9a\x9e\xbb\xea\x29\xac\x63\xe5\xda\xd5\xae\xd8\xe5\x9f\x0a\x9c\x08\xc9\x11\xfc\x9c\x98\x50\x95\x5b\x15\x4c\xc1\x8b\x34\x4f\x90\x81\x96\x79\x75\x4e\xca\x4a\x41\xd3\x68\x41\x50\xb1\x45\x85\x06\x6d\x90\xda\x72\xee\x4a\xf2\x79\x3a\x57\xbc\xfd\x8d\xf4\x65\xa0\xab\x12\xb3\x7b\xfc\xa6\xdb\xdf\x4b\xe8\xf5\x9c\x89\x53\x68\xea\xa5\x81\xd9\xd8\xdf\xf0\x51\x84\x1e\xdf\x7e\xb3\x97\x1c\xf1\x53\x88\xf3\x00\xc9\xf7\x3b\x57\x5f\xef\xc6\x7f\x21\xff\xb3\x70\x20\xfe\x52\xb7\x68\x03\x4c\x3f\xae\x80\xce\x86\xee\xe8\x18\xf2\x93\x6e\xfd\xa5\x6e\xc9\x88\x50\x2d\xca\xcb\x0c\xc5\xa9\x4a\x15\x36\xf3\x28\x96\xd6\xdc\xe4\xe1\x63\x70\x09\x32\x04\x78\x5e\x57\xca\xf4\x84\x04\xb0\x6f\xeb\x68\x12\xb3\x97\xb3\x6d\xdf\xf4\xc1\x5b\x9e\x34\xa2\x03\xb2\x28\xaa\x8a\x15\x03\x43\x46\x3c\x94\x7b\xbf\x37\xb9\xbc\x62\x02\x74\x9d\x02\xa5\x1f\x19\xac\x1b\x8c\xc6\x6a\x71\x58\x05\x73\x6e\x4a\x56\x22\xdf\xbc\x43\x85\x48\xee\xa8\x02\x82\xe7\xee\x75\xbf\xe2\xe0\x59\xe7\xbb\x8b\x77\x6b\xb5\x7f\x77\xfe\xe1\x83\xa7\x6f\xc1\x71\xe1\xf9\x05\xf7\x71\xdf\x32\xa3\x1f\x22\x4c\xd0\xab\x59\x58\x9d\xe7\x8b\x23\x8c\x4c\xb4\xc6\x2b\xc4\xba\x2e\xb0\x08\xaa\x70\x50\x5a\x92\x63\xfc\xc6\x38\xfb\x92\xfa\x0b\xbf\xd8\xa2\x4b\x07\x95\x45\xc2\x05\x94\x41\xab\xbc\x50\xca\x7b\x6e\x7d\x81\xaa\x23\x19\x46\x0c\x5c\x31\x50\x76\xc2\x3d\xbf\x8a\x8e\x02\x72\xe3\x55\x55\xda\x32\x5b\x47\x65\xd5\x02\xab\xf1\x3e\x3c\xb0\x50\x10\x13\xd8\x23\xd2\x88\x7d\xf1\x45\x62\x3e\xde\xf5\x6c\x03\xbc\xbe\x25\xb9\xbf\xc1\x12\x66\x7c\x13\xba\x42\xa7\x66\x1c\xbe\xfc\xd4\x40\x9b\x6e\x20\x03\x59\xe9\x0b\xa3\x0b\xb7\x7a\x41\x0c\x3f\xd5\x8b\xe1\x6d\xcf\xca\x9e\xc1\x5a\xf8\xa8\x38\xa0\xcd\x29\xff\x32\x47\xcf\x35\x52\xe6\xb5\xcf\xf5\xd3\x2a\x92\xa8\xae\x67\xa3\x62\xda\x41\x0e\x46\x5f\xe9\x50\x71\x25\x3c\x27\xb7\x22\x16\x26\x97\xc5\xda\xc4\x92\x4f\x14\x8d\x58\x2d\xeb\xbb\xc5\x07\x4d\x12\xb4\xa9\x0b\xdc\x52\x44\xd7\xb5\xff\x74\x93\x05\xe5\x52\xfb\x70\xbd\xf0\xaa\x74\x2d\x6b\x04\x66\x13\xe2\xa1\x81\xa7\x6e\x72\x7d\x06\x9b\x26\xe7\x26\xd3\xb0\x0a\x71\x10\x73\xee\x92\xd5\xdb\x4c\x7b\x54\x66\xe9\xb9\x6a\xa5\xe8\xee\x2e\x0b\x9b\x9b\x1d\x98\xd5\x65\xaa\x85\xf9\x14\x1d\xce\x92\x3a\x2d\xd1\xa3\x00\xc0\xf4\xcc\xf8\x52\xf4\xe8\x02\x95\x03\x7d\xe5\x06\x17\x8c\xf8\x50\x8f\xd8\x1c\xef\x79\x5e\x55\xe4\x14\x19\x0e\x10\x68\xae\x57\xdc\x1d\xfb\x26\x1c\x2a\x56\x98\x34\x5c\xbb\x15\xec\xf6\x4e\x94\xdb\xb2\x94\xdf\xf3\xec\x0c\x21\x8b\x5d\x8f\xb3\xde\x84\x8d\x48\x31\xf0\xc0\x29\x66\x55\xf3\x18\xeb\xe8\xe4\x13\xe2\x23\x1e\xa7\x6b\xc9\x36\xd1\x4a\xc3\x52\x07\xbc\x41\xc2\x9d\xfb\x96\x65\xe7\x1c\x6f\xdb\xfd\xac\x40\x11\x1e\x8b\x85\xf5\x7a\xc6\x2e\x62\xbe\xda\xe8\x75\x13\x06\x0c\xf0\xd4\x09\xc6\x2b\x06\x61\x65\x74\x7f\xfb\x5d\x3a\xfc\xef\x8f\x1f\xb6\xf3\xee\x37\x11\xc1\x96\x83\xbb\x2e\xe0\x9d\xe1\xf7\x1f\xb6\x57\x80\xb5\x54\xd8\x84\xaa\x0f\xbb\xcf\x78\x9d\x6c\x84\x40\xf6\x2c\xe3\x1e\x24\xb4\x83\x7b\x06\x93\x4f\x0f\xda\x4e\xad\x77\xd6\x42\xa7\x27\x7f\x1d\xfb\x9b\x1e\xfd\x9b\x21\xd5\xbe\xfb\xc3\xd2\x94\x74\xf7\x4f\x0f\x1a\xd0\x99\x0c\x5a\x20\xcb\xa9\x8b\x40\x35\xdd\x22\x10\x65\x6f\xda\x90\x15\xb1\x29\x86\xa9\xe9\x88\x40\xa3\x44\xaf\xae\x02\x3a\x26\xbd\x35\xb6\xb4\x8b\x0c\x5d\xf0\x5d\x7c\xa1\xbb\xae\x0e\xff\xb0\x05\xcf\x71\x1c\x58\xec\x2a\x4c\xd6\x40\x80\x1f\x3f\xdc\xdb\xce\x4f\xd7\xc1\xb8\x8d\xb8\x91\xd8\x46\xe8\x45\xff\x30\xd9\xdd\xf1\x17\x5e\x08\x73\xa7\x67\x23\x64\xda\x84\xe1\x64\x98\xec\x06\x49\x39\xfc\x47\xba\x52\x55\xec\xe2\x7b\x9d\x00\x5f\xf5\x82\x50\x19\x83\x69\x3f\x32\xe1\x9d\x2b\x3c\x70\xe9\xf0\x04\x66\x7c\x9a\x6f\x36\xbc\xb1\xba\xfa\xbe\x9f\x40\x9f\xcd\xb8\x92\x40\x2a\xd9\x17\xe8\x6a\xbf\x44\x9d\xe9\x9f\x97\x85\x63\x81\xda\x1e\x10\xaa\x7d\x6c\x06\x72\x78\x54\xd7\x46\x37\x44\x77\x6c\x3a\x65\x28\xea\xd9\x9a\x24\x47\x34\x10\x02\xf3\x46\xa8\xd8\x07\x7e\x24\x79\x16\xe0\xfb\x69\x0e\x1d\xd0\x58\x31\x08\x50\xa2\x86\xb0\xaf\xa4\x37\xcf\xc8\x39\xde\xbe\xee\x8e\x5f\x3e\x7e\xd9\x2f\x4f\xe1\x69\x9e\x6e\xee\x25\x6f\x4c\x81\x7d\xf6\xaf\x2e\xa6\x36\x0a\x48\x5b\x0a\x5e\xf1\xa1\x83\x41\x3f\x25\x0b\xfb\x59\xb7\x30\x6a\x39\x9e\xcd\x7e\x63\xb1\x86\xe1\x34\xbd\x87\xa6\xf4\x5e\xf9\x50\x6c\xbb\x35\x88\x0f\x66\x15\x06\x3c\x59\x85\x1f\x7e\xc7\x83\x3e\x34\x6c\xd0\xf8\x2b\xf2\xd7\x77\xe9\x22\x41\x8a\x75\x7f\xc3\x5d\xd3\x76\xf6\x64\x6c\xc3\x02\xe4\xdc\x35\x58\xaa\xc5\x06\x55\x7b\xd9\x65\xf2\x3a\x3b\x85\x53\xdb\xef\xbd\x7b\x0f\xff\xe0\x0d\xcb\x83\xdd\x4b\x7a\x94\x7b\xff\x54\xe0\xdc\xe4\x21\x59\xc2\x17\xf0\x84\x7f\x3a\x9f\x64\x57\x56\x8a\x29\x2a\xed\x6e\x90\x51\x08\x6c\x5f\xc1\xd8\x6c\x17\xfb\x7e\x99\x8b\x39\x45\x5d\xe8\x42\x5a\x3d\x57\xb5\x9c\x56\xf7\xde\xc3\xc8\x99\x45\x56\x6c\x90\x18\xf8\xd8\x0d\x93\xdd\xa8\xc8\x18\x34\xb2\xd3\x56\xed\xdd\x46\x3d\xb4\x1b\xe5\x89\x05\xef\x43\x6f\xd3\xf0\x66\x6b\x60\x4d\x34\xc4\xb1\x22\x2e\x8e\x16\xfd\x6d\xf3\xb9\x29\x9b\xfc\x29\x36\x38\x4a\x20\x5d\xa3\x07\xc3\x30\xa1\x75\xa0\xd5\x3a\xa4\x1a\x81\x46\x5f\x63\x82\xa6\x48\x2b\x20\x10\x84\xfa\xde\x78\xa3\xe9\xe2\xf3\x99\xde\x5c\xb8\x07\x9b\x24\x28\x45\x54\x4c\xaf\x9d\xf4\xc5\x0e\xad\xf9\x1c\x9b\x21\xb1\x39\x79\xa4\x29\xed\xf8\xfe\x93\xe3\xc3\xd7\xf4\xcb\x34\x4b\x29\x3e\x84\x92\x45\x01\x45\x9c\x61\xc1\x99\x2f\x6f\xc5\x1b\x24\x06\x28\xca\x1b\x66\xe4\xc8\xcc\x6b\x09\xa4\xb4\x87\xff\x62\x97\x76\xdc\xdb\x3d\xfa\xb7\xf9\xfb\x3d\xfd\xfd\xde\xfc\x9d\xd2\x9f\x57\x3b\xbf\x33\x5f\x8c\xe4\x8b\xef\xcc\x17\x19\x7f\xb1\x3b\x32\x5f\x9c\x48\x8b\xb1\xf9\x62\x2e\x5f\xa4\xe6\x8b\x52\xbe\x98\x98\x2f\x6a\xf9\xe2\x7b\xf3\xc5\x85\x7c\x61\x81\x5e\xc1\x17\xc1\xcc\x8c\x04\x28\x4f\xf2\x8e\xcb\xff\xc3\x5f\xee\x7f\xe2\xdb\xdf\x23\x9b\x58\xd2\x1b\x7b\x3b\x12\x54\xb8\x81\xbf\xdd\x34\x2f\x52\xc1\x64\xf9\xdb\x30\xf9\xfa\x33\x60\x62\xf5\x7e\x2a\xb2\x02\xc8\x0f\x53\x8f\xa5\x8b\x56\xe9\xc9\xbc\x79\x98\xa4\xf7\x9c\x65\x64\x7c\xe6\x18\xb7\x99\x02\x00\x7a\x27\x3f\x7e\x78\xd0\xc2\xe8\xe9\xc8\x02\x01\x16\x27\x89\x53\x8b\x98\xa5\x91\x8b\xc4\xc0\xa3\xff\x6e\xa1\x67\x28\xbb\x68\x69\xa9\x4d\x1e\x91\x0d\x99\xc3\x79\xfd\x18\xff\xc1\x0a\x9e\xca\xe4\x96\xd0\x7a\x14\xc3\xab\x9b\xef\x9f\x4f\x16\xc2\xbe\xfd\xe4\xb9\x55\xd5\xda\x7c\x45\x0e\x1e\xd5\x22\x9d\xa3\xa5\xe0\x97\xa3\x63\xd6\xe8\x8a\x2a\x99\x9a\x6e\x9c\x4e\x8b\x51\x3a\xdd\x90\xeb\x2d\x39\x99\xa6\xa7\xb7\xbb\xd2\x23\x8e\x43\x0b\xed\x35\x44\x3b\x6c\x7c\xce\x78\xd4\xb6\xfd\x45\xc9\xb5\x44\xb7\x05\xfa\x7b\x2f\x81\x67\xff\xdc\xb9\xbb\x1a\xcf\x6b\x86\x21\x17\x9b\x01\xdc\x76\x9f\x52\x5d\xf8\x12\x2b\xeb\x9b\x96\x8d\x7b\xd5\xd1\x21\x36\x84\x87\x6a\x13\xe6\x10\x61\xbc\xdb\xf9\x60\x64\xe0\xbb\x6e\x90\x95\x92\xbe\xf5\xc0\x63\x7a\x35\x6b\xe3\x84\x0f\xb6\x81\xc5\x06\xdd\x6d\xa3\x5b\xd9\x23\x46\xca\xe7\xfb\xfb\xdc\x72\x2d\xd2\x32\x26\xd4\x31\xfa\xcb\x76\x6d\xb4\x0c\xaf\xf7\x98\xfa\x28\x35\x0d\x49\xfc\x0f\x19\x94\x6f\xc3\xeb\x78\x23\x34\xec\x79\xbe\x34\x2a\x2e\x2d\x2c\xb1\x01\xe1\x4f\xf3\x8a\x62\xd0\x28\x68\x28\x99\x17\xf3\x21\xdc\x5a\x75\xc6\x89\x02\x3d\xe2\x17\xe7\x57\x73\x59\x26\x3c\x77\x47\xdc\x18\x2f\xd6\x49\xda\x56\xeb\x14\xba\xc3\x30\x32\x8a\xb4\xb7\xdf\x57\xdb\x5b\xe8\xc7\x6d\xb8\x98\xf7\x70\xf5\xe5\x49\x68\x0b\xcf\x93\xd9\x83\x3b\x1d\x32\xa0\xb4\xb7\x16\x53\xb5\x7c\x46\xfc\x35\xd2\xa1\x27\x18\x2a\x5a\xd2\xb0\x1d\x9d\xad\xb7\x19\x32\x44\x38\x55\x4f\xbc\xd9\xca\x11\xf2\xcb\x13\xaf\x15\xb0\xce\xe1\xee\xe6\x3a\x6a\x53\x4c\x56\x09\xbb\x88\xa7\x41\x6d\xef\x3d\xac\xa2\x42\x1e\x10\x74\x50\x04\x8c\x9d\x19\xb1\x78\x27\x1e\xad\xeb\xe7\xf1\x51\x2b\xd8\xfe\xc9\x7d\x3e\xac\x2f\xdc\x54\x02\x82\xc9\xab\x4f\x1b\x90\xe1\xb5\xe6\xd1\x73\x93\xc2\xd5\x72\xa0\x40\xd5\xd0\x25\xb4\x5a\xb9\x59\xfa\x22\xe3\xe6\x9e\x8d\xa9\xb8\xc3\x06\xce\x3d\x13\x5b\x01\x7f\xef\x4f\xf1\x77\x0a\xb1\x80\xbf\x30\x4e\x76\xcf\x84\x5a\xa8\x73\xfe\xb3\x2d\xdc\xb0\x54\xae\xeb\xac\xb8\x16\x1f\x61\x1b\x08\x68\xb8\xd6\x2b\x3c\x86\x9c\x38\x08\xd7\x19\xd3\x44\x4d\x31\xa9\xd4\x49\x8d\xd9\x00\xec\x76\x10\x93\x18\x65\xe3\x74\x69\x6a\x83\xe0\x62\xcf\xb0\x80\x0c\x3b\x7d\x91\x4d\xdc\xe4\x41\xb5\x8e\x2d\x98\xc3\x02\x7d\xf5\x60\x33\x4c\xee\x01\x19\xf7\xe9\x3c\x70\x30\x80\x21\xce\xe1\x06\x25\x43\xee\xe1\xd1\xc1\x06\x87\x2f\x62\x48\xfb\xb8\xc0\x90\x25\xb9\xda\x0d\x2e\xc5\x09\x05\xff\xa8\x85\x4d\x92\xa7\xe4\x9e\x0d\xf0\x72\xe0\x65\x19\x47\x62\x32\xc0\xfb\xbf\xdb\xe0\xc8\x21\x31\x43\xef\x8e\x36\xba\xb7\xd1\x9a\x9c\x64\x8b\xb0\x88\x8e\x4b\x93\x0f\x58\xed\x25\xf7\x7f\x87\x7b\xf1\x64\x77\x2f\xc1\x82\xfb\xf8\xf1\x3e\x7e\xfc\x8a\x3e\x7e\x85\x1f\xbf\xa6\x8f\x5f\xe3\xc7\x6f\xe8\xe3\x37\xf8\xf1\x5b\xfa\xf8\x2d\x7e\x64\x08\xbf\xc3\x8f\xdf\xd1\xc7\xef\xf0\xe3\xf7\xf4\xf1\x7b\xf8\x78\x7f\x87\x87\xd8\xc1\xcf\xbb\xfc\x19\xc7\xbb\xcf\xe3\xed\xe2\x80\xf7\xbf\x1a\x48\xa4\xfd\x6b\x64\x0d\x97\x05\x22\xf8\xf2\x05\x1c\xdd\xaf\x09\xd0\xf1\xdb\x97\x7b\xc9\x37\x04\xe8\xf8\xf7\xaf\x0f\xe1\xfb\x6f\x18\x12\x9c\x72\xf8\xcc\x90\x9e\xbe\xc1\xef\x09\xf5\xa3\xa7\x7f\x80\x8f\x84\xfa\xd1\xe1\x9b\xc3\x17\xf0\x07\x21\x7f\x88\x15\x55\xe0\x0f\x42\xff\xc5\x53\x1c\xe0\x1b\xc2\xff\xbf\x0e\x5f\xc3\x08\x5f\xd3\x04\xb0\x6a\xc0\xd1\xab\xfd\x03\xf8\xf1\x3b\x0f\xad\xb3\x32\xa3\xdc\x56\xc7\xfb\x8f\xf6\x12\xc2\xeb\xff\x85\x26\x84\xc8\x5b\xf8\x40\x80\xa0\xd3\xb7\xf4\x13\xe0\xf5\x1d\xe1\x05\xe3\x7d\x47\x98\xfc\x27\x7c\xa0\x9f\x7e\x81\x0f\x84\xce\xd3\xbd\xe4\x77\x84\x2f\x8c\xfd\x3b\xfa\xe9\x15\xfc\xb4\xa3\x07\x05\x26\x40\xe9\x2d\xb1\x3c\x27\x96\x5d\x81\x2d\xa3\x65\xd8\x87\x71\x08\xc6\x11\xf4\x20\x18\x8f\xe1\x1b\xde\x00\x00\x46\x6d\x7e\x82\x0f\x84\xdd\xef\xe1\x03\xe1\xf2\xbf\xe1\x03\xe1\x02\x70\x7e\x47\xdd\x9f\xc1\x07\x5a\x0d\xaa\x19\x08\x5b\xe1\xed\xc4\x49\x4e\xce\x0d\xc9\x7f\xc1\x7c\x09\x24\x2c\xeb\x77\x34\x08\xd0\xce\xb7\x34\xe1\x37\xf0\x0d\x01\x80\x35\xf9\x96\xd7\x15\x40\x52\x9b\xe7\xf0\xe1\x77\x06\xdc\x61\x3d\x46\x48\xb2\xb0\x5f\x11\x3a\xaf\x5e\x3f\x7d\x71\xfc\xf1\xe8\x00\x76\x14\x3a\x7d\x4d\xdf\xc1\x5f\x2f\x9f\x3d\xfb\xc8\x73\xc5\xa2\x52\x08\x1a\xab\x44\xc1\x5f\xb4\x44\x5c\xd3\x09\x9a\xd3\x4f\x58\x9a\x09\xc0\xd1\xc0\x58\x5f\x09\x3e\xf3\x6a\x1c\xc2\xcc\xbe\x96\x99\xc1\xd2\x7c\xf5\x0d\xb7\xc0\xea\x3c\xf0\x17\x2d\x02\xb5\x26\x4c\xf9\xdb\xaf\x69\x8a\xaf\x99\x46\xbe\xa2\xc1\xb0\x70\x0e\x7c\xa6\x99\x4a\xe1\x1b\xc4\xea\x6b\x33\xab\x9f\xa9\x8c\x0c\x2e\xe8\x2b\xa0\xef\xef\x69\xbc\x9f\x5f\x01\x79\x7f\xff\x3b\xfe\x08\xd4\xfd\xfd\x77\xfc\x11\x8e\xd3\xf7\xdf\xf3\x47\x3c\x4e\x3b\x3b\xfc\x19\xcf\xd3\xce\x2e\x7f\xc6\x03\xb5\x73\x9f\x3f\xe3\x89\xda\xf9\x8a\x3f\xe3\x91\xda\xe1\x8d\x7b\x85\x67\x6a\xe7\x1b\xfe\xfc\xf1\xd5\xb3\x5f\x8e\xf0\x6f\x19\xed\xe3\xf3\xa7\x2f\xf8\x0b\x19\xe8\xe3\xd1\xf1\x3e\xee\xea\x8e\x60\xf6\xf1\xf1\xd3\x37\x4f\x1f\x1f\xe2\x09\xdd\x35\xdf\x1c\x1e\x3c\x7d\xbe\xff\x0c\xbf\xb2\x94\xe7\x0a\x6c\xcc\xb2\x49\x4e\x3c\x0e\x8b\xf0\xbc\xd8\x7f\xf3\xf4\xa7\xfd\xe3\xc3\x8f\x78\x44\xa0\x83\xec\xb7\xf9\xf6\xc9\xcb\xd7\x6f\xf7\x5f\x3f\xc6\x1f\x08\x1f\x2e\x6f\x81\x7f\x32\x5d\xfe\x02\xfb\x6a\x36\x7b\x97\x89\xf6\xed\xd3\x17\xb0\xf6\x1f\x5f\xbe\x39\x7c\xfd\xe6\xe9\xe1\x5b\xfc\xfe\x3e\xef\x38\xee\xc2\x8b\xc3\xa3\xa3\x8f\xb8\x4b\xf7\x99\xe1\xa8\x6f\x79\xc7\xee\xef\xfe\x4e\xdf\x1d\x4f\xd5\x15\x26\x0e\x8a\x78\x7f\x3a\x43\x58\xcc\x61\x25\x62\x67\x33\xfc\xd2\x38\x04\xbe\x2a\x4d\x7a\x6e\x97\x8d\x00\x39\xb1\x73\xc6\xaf\xae\xab\x3a\x9b\x31\x7f\xa7\x94\x20\xe6\xe1\x45\x1d\x9d\x6f\x20\x07\x05\xef\xad\x0c\x1b\x1e\x78\x0e\x89\x6f\xd3\xbc\x96\xcc\xb7\x1b\x18\x23\x8c\x81\xfb\x1b\x0c\x7a\xe0\xc2\xf4\xcd\x2f\x89\xc9\x6c\x1b\x24\xf3\x14\x14\x24\xa3\x44\x17\x0e\xa6\x62\x86\x87\xc4\xb3\x20\xf3\x09\xe7\x9d\xf2\xe7\x2f\xd9\x50\x04\x1b\x37\x26\x86\x9f\x77\x0d\x48\xc5\xa3\xbc\xd1\x8e\x5c\xb2\x6d\xe3\x10\x4e\xd2\x21\xe6\xbd\x4e\x96\x0b\x07\x5a\x67\x7d\x57\xca\x0b\xd3\xc9\x7a\xe8\xb4\x67\x89\xbf\x59\xea\x80\x1b\xa0\x89\xc1\x7e\x31\x44\x31\x32\xe8\x66\xa8\xba\xb4\xdc\x9f\x1b\x59\x21\x91\xba\x68\x2c\xe9\x71\x01\xc2\xc2\xfa\x68\xda\xca\x04\x7f\x25\x0c\x47\x45\x5d\x4b\x92\x09\x0f\xc9\x47\xf4\xfd\xdf\x18\x4f\x97\xe8\xdc\xa2\x49\xf9\xef\x22\x39\xcd\x05\x5d\xce\xf6\x63\x7f\x5f\x07\xdf\x66\xc2\xf2\x1b\x26\xb9\x58\xe3\x25\x64\x13\xf7\x7c\x94\x7a\x35\xff\xec\xa1\x57\xca\xfb\x1d\x3f\x9e\xa0\x21\x06\x3f\x1c\xd5\x45\x09\xf3\xd3\x8e\xef\xaf\xec\xe4\x9f\xf3\xdc\xb1\xcc\x01\xc7\xab\xd0\x62\x20\x5f\x63\x8d\x52\xf2\x22\x3d\x3a\xfa\xbd\x4a\x73\xe4\x2c\x6e\x67\x9c\x79\x56\xf4\x29\x53\x49\x09\x96\x62\x5a\xbe\x49\x56\x92\x21\x8f\x35\x13\xac\x9f\x1c\x17\xf3\xb9\xa4\x24\x5b\x94\x05\x4e\xc1\xbf\x92\x1a\x28\x69\xdd\x19\x77\x78\x2a\x21\xab\x38\xab\x46\x7b\xa7\x85\x1c\x08\x91\x48\x00\x93\xcc\xbf\x99\x7e\xcf\xfb\xa7\xc7\x74\xb1\x6d\x70\xdb\x26\xbd\x94\x1d\xd7\xa8\xcd\x00\x66\xe5\xbc\xb9\x1a\x38\xc8\x90\xee\x07\xd2\xb7\xb1\xc7\x29\xbe\x49\xaa\x3e\x02\xd8\x6c\x86\xe3\x9e\xbb\x6c\x82\xf4\xb2\x67\x9f\x6b\x07\x07\x1b\x0c\x68\xf4\x77\xf0\xe9\xc3\xbb\xdd\x0f\x9b\x2d\x59\x02\xda\x50\x43\x8f\xc1\xd3\x82\xc2\xde\xf8\x8d\xbb\xba\xa1\x3d\x66\x68\x7f\x34\x9f\x7b\x6b\xf5\xdc\x5f\x2c\xe0\xd4\x8b\x7e\xac\xe7\xfe\x5a\xaf\x37\x9e\x41\x13\xe8\xd2\xb3\x7f\xac\xd7\xf7\x08\x4f\x0c\xce\xb1\xc7\x9f\xd6\xec\x45\xfc\x89\xcd\xb0\x3d\xfb\xc7\x7a\x7d\x0f\xe7\x70\xb8\xa5\xab\xf9\xbc\x5e\xcf\xe7\x79\x35\xce\xa6\xd3\x74\x9e\x15\x4b\x42\xd9\xfb\x42\xa9\x37\x9e\xc9\x51\x72\x7d\x07\xf6\x98\x61\xcc\x5c\x5e\x2d\xa6\xe9\x35\x7f\x85\xae\x58\x0b\x4a\xb5\x40\xf7\xc3\x66\xd7\x21\x33\xc8\x60\x5e\x19\x71\x8f\x33\x29\x22\xfe\x02\xaf\xf3\xbd\x56\x42\x8f\x6e\xf5\x40\xb8\xf8\x15\x6a\x3b\x14\x05\xf4\x31\x35\x15\x60\x3c\x2e\xa6\x05\x26\xad\xce\x67\x00\xa3\xda\xec\x91\xed\x65\xed\x71\x2c\x1d\x78\xc3\x70\x4e\xe7\x84\x09\xe4\x66\x00\xcd\x5e\x79\xf0\xec\x06\xde\x0c\x96\x39\x1d\x1e\x2c\x7b\x64\x6e\x06\xcb\x92\x9f\x07\xcc\x11\xe5\x0d\xa1\xd1\x29\xf0\x41\xf1\xc1\xb8\x19\x1c\x8f\x34\x3d\x70\xf8\xcb\x56\xef\x13\x65\x0d\x69\x25\xb4\x26\x67\x94\xa7\x06\xaa\xc5\x86\xa7\xe5\x70\x06\x17\x64\x0f\xb3\xc2\xbd\xbb\xc9\x72\x93\x27\x26\x61\xf3\x8e\x3e\x25\xbd\x39\x08\xa1\x26\xb1\xc9\x50\xb2\x9a\xa0\x3e\xcc\x7c\xa6\xfb\x9a\xfe\xe0\x92\x7a\x3d\x4e\x25\x88\x17\xd7\xfe\xb4\xfe\x09\x59\x7c\x2d\xf7\xd4\x19\x88\x2b\x7f\x7c\x7b\x96\x2d\x4b\x38\x7e\xf9\x78\xeb\xfd\x5c\x74\xb0\x3d\xf5\xa9\x87\xe3\xa2\x79\x15\xa4\x82\x82\xfb\x3a\x4d\xda\x3c\xbd\xc8\x4f\x53\x0c\xac\x85\x85\x3b\x5d\xc2\x34\xf6\x5c\x57\xbe\x78\xde\xf7\xb2\xf9\x70\x59\xbd\xef\x25\x0f\x7f\x84\x3f\x10\xfd\xf7\x80\x27\xb9\xdb\xd2\x37\x16\xe1\xf7\xfe\xb0\xd4\x70\x2f\x79\x9c\x57\x1c\x50\x3b\xbf\x96\x09\x94\xd9\x94\x6c\xe1\xb3\xe5\x1c\x6f\x72\x8d\xb6\x5d\x15\x42\xb8\xaa\x96\x33\x8e\x97\xb8\x07\x3d\x25\x5d\x0f\xc1\xf0\xfa\x98\xd5\x53\x7d\x48\xc1\xd8\xd5\x47\x21\x6d\x3b\xb1\x54\x15\xe9\xc5\xf5\x2d\x7b\x5e\x59\xa6\x61\x5e\x0d\xfd\x8a\x4b\xb7\x20\x0e\x49\x63\xd4\xc3\xf4\x0b\x6c\x72\xee\x3d\x3d\xc1\x84\x7b\x83\x04\x4e\x40\x21\xb1\x7e\xee\xc9\x8f\xa5\x34\x6c\x95\xa5\xe1\x8f\x58\x57\xaa\xcc\x66\xe9\xc2\xe5\x9d\x31\x33\xf4\x70\xc5\x88\xa0\x0c\xfd\xd7\xaa\xa0\xb4\x94\x9e\x99\xcc\xe7\xf3\xcc\xe2\x08\x5e\xa4\x97\x67\x99\x4d\x8c\x6c\xaa\x64\xc1\x2b\xbe\xe2\xe0\x6e\x1c\x8b\xbe\xc2\xb7\x33\x7e\x31\x41\x1a\x9e\x8f\x6b\xd3\xd6\x43\x0e\x5f\xd2\xd5\x10\x23\xab\x6f\x81\x5f\x8f\x4d\xcf\x8c\xda\x3b\xfb\x57\xd2\xfb\x6e\x38\xca\xe9\xcc\xc9\xc3\x79\x88\xbe\xd0\x72\xea\x0e\x4c\xaa\xbe\xb3\x66\xa1\x30\x7e\x4b\x4f\xa2\xe7\x2d\x11\x43\xf7\x16\xff\x93\x1c\x51\x62\xda\x39\x69\x9a\x51\x4a\xcd\xaf\xb6\x74\x63\x42\x61\xcb\x34\xde\x9f\x4c\x92\xdd\xfb\xdf\x99\x87\xd5\x72\x4e\x2a\x7b\xd8\x39\x15\xe3\x58\xd9\x7a\x42\x1e\x20\x35\x05\x00\x64\xd5\x12\x9e\xf6\x81\x55\x25\x9c\x0e\x5c\xe2\xd4\xb5\xda\x20\x3c\xf9\xee\x9f\x2a\xa5\x02\xe0\x7d\x92\xa9\x2f\x8b\xf9\xfb\x5e\x4d\x95\x01\x38\x18\x0a\x25\x66\x38\xd1\x98\xaf\x46\x8a\x03\x10\xd8\x76\x70\x66\x40\x49\x72\x43\xbb\xef\x67\xce\xb6\xb5\xa3\x71\xd5\x9d\x51\x61\xb3\x07\xf0\x0c\x59\x2c\x27\x18\x43\x3d\x1c\x01\x0a\xc3\x0a\x6f\x8c\xb5\x49\x43\xae\x1c\x7a\x7e\x0c\x61\x65\xe8\x05\xb4\xc7\xf2\x35\x82\x2d\xb6\x11\xa8\x90\xf2\xb2\x34\x9f\x7e\x79\xfd\xcc\x04\x20\xda\xb7\x25\x36\x4c\x68\x74\x4c\x58\x36\x5b\xd4\xd7\xc6\xc5\x07\xa7\x30\x2f\x12\x41\x93\x1a\x5a\x92\x9e\x64\xd5\x39\x08\x41\xc3\x79\x51\xdb\xec\x9d\x34\x91\x1b\x4f\x21\xce\x41\x38\x49\x9a\x87\x64\x65\x1e\x69\x78\xfa\x4f\x39\x90\x9e\x1c\x16\xc7\xe4\xd6\x08\x5b\xf0\x36\x1b\x59\xf6\xf1\x42\x21\xb6\xa5\xd3\x29\x5c\x7e\xb5\x55\x94\xa7\xdb\xc7\xaf\xb7\x35\xee\xd5\xb6\x77\x14\xf8\xc3\x63\x16\xfa\x70\x2d\xbc\xb6\xc0\xb2\xfe\xbc\xcc\x31\x73\xc6\x02\x11\xac\x2a\xda\x70\xe3\x59\xb1\xa4\x04\xd2\x54\x6a\x9e\x9e\xa7\x06\x2c\x47\x29\xe2\xe9\xc3\xf8\x55\x3c\x20\x34\x47\x5a\x2a\x49\x53\x5c\xd7\xd9\x6c\x41\xbf\xa5\xd5\xb9\x05\x46\x1b\xa1\x46\x32\x00\xf3\x93\x04\xde\x7b\x18\x90\x5b\x5e\x4b\xc5\x57\x53\xb6\x04\x1e\x99\xd7\x94\x41\xb2\x3a\x13\x73\xa8\x06\x80\xe8\x63\x06\x30\x00\x90\x3b\x86\x3b\x21\xe3\x36\x08\xc1\x9c\x22\xa3\xf6\x4b\xfb\x31\x59\x47\x19\x86\x70\x77\x10\x55\xe0\x7d\xcd\xf5\x35\x24\xdd\x7e\xb2\xe1\xad\xdb\x86\x46\x82\xd2\x88\xa9\xbf\x61\xd2\x0e\x13\x16\xb6\xbd\xce\x96\xf4\xdc\xf6\x0f\x49\xdc\x5d\x9b\xe2\x94\x18\x0d\x42\xca\xe9\xa8\x8f\x85\x83\xf9\x7f\x9b\x24\xcf\x10\x34\x26\xc1\x63\x9f\xce\xe8\x27\x66\x47\x98\x7f\x96\x2b\xbb\x17\x12\x3d\xc9\x3f\xba\xfc\x14\x31\x4c\x49\x20\xbf\x1d\xa6\x88\x9a\x71\x69\xe7\xf5\x3e\x3a\x12\xf7\x20\x39\xcb\x0a\x51\x1a\xa7\xe5\x20\xf3\x6f\xb1\x1d\xd4\x01\xb3\x9a\xe9\x01\xe7\xe8\xe3\xd1\xa9\xe0\xec\x9c\x16\xc5\xd6\xe9\x74\x1b\xa4\xd3\xc9\xf1\xcf\x9b\xba\x15\x88\xcc\x80\x2d\x48\x98\xe9\x24\xc7\x1c\xe1\xf8\x38\xe2\x97\xd1\x20\x19\x91\x0b\x16\x3c\xa2\x36\x23\x8b\x82\x49\x2f\xff\x56\x6b\x42\xa9\x39\x61\x61\x1e\x9b\x9c\x2b\x40\x6f\x28\xe0\xc5\x36\xcb\x38\xae\xfc\xcd\x70\xb3\x9e\x32\x37\xd9\x9c\xdd\x9d\xff\x85\xff\xd3\x5f\x8d\x33\x74\x65\xd2\x33\x62\x39\x8b\x85\x8f\xcf\x2f\xe7\x09\x97\x96\x29\xb1\xa4\x26\xbe\x9c\x64\x39\x78\x74\x94\xf4\x41\xa6\x46\xaf\x47\x94\xb8\xd3\xf3\x34\xf9\xe3\xef\x37\xb1\xde\x92\xcd\x79\x6e\x90\xf7\x81\x90\xdd\x5b\x01\x22\x20\xbf\x3b\x79\xdf\xb3\xdb\x65\xe5\x89\x21\x48\x8f\x43\x93\xd3\xb9\xba\xd5\x96\xc9\xbb\x86\xf6\xc8\xf8\x4d\x1a\xe5\x9b\x0b\x3b\xa7\x88\x69\x09\x68\xde\x12\x53\x7a\x8a\xee\x6e\xe4\xf1\x8a\xd9\x1a\x07\x22\x3b\x64\x98\xf6\x13\xb6\x83\xbd\x49\x7a\x36\xc9\x98\x54\x91\x72\xa2\x10\x5e\x04\xa4\xb6\x34\xd9\x98\x25\xb8\x4b\x8d\xc4\x42\xb1\xbb\x46\x40\x6c\xf0\xc6\x04\x0e\x5e\x65\xd3\x93\x2d\x2e\x58\x80\xb9\x7c\x3c\x84\x08\x95\x10\x01\x0b\xaa\x84\xeb\x23\xbf\xf0\xa5\xb3\x10\x13\x0a\xe2\x67\x86\xac\x1b\x3a\x52\x55\xb4\xda\x42\xac\xb8\x16\x7f\xd9\xd8\xd9\xd8\xfb\xcb\xc6\xbd\x8d\xbd\x8d\xf7\xef\x97\xf7\x77\xbf\xbf\xbf\x31\x80\xff\x33\x7f\xed\xc0\xe7\xa1\xfd\x6b\x17\xfe\xda\xb2\x7f\x7d\xb5\x31\x70\x28\x23\x18\xfa\xfe\x9b\xef\xbe\xdb\xf8\xf4\x49\x89\x53\x54\xe0\x63\x08\x62\x48\x76\x95\xaf\x2f\x64\xfb\x8f\x6e\xa1\x68\x4d\xe6\x6f\xe5\x11\x40\x3c\x94\xee\x66\x1a\x88\xd6\x45\x0a\xa2\x5c\xf2\x5d\x6f\xd3\xc8\x27\x88\x81\xbb\x06\x38\xe3\xcd\x70\x84\x29\x6f\x6e\x45\x9f\x91\xc3\xd7\xc4\x8a\xc0\x1b\xff\x3b\x18\xcf\x66\x7a\x9a\xd6\x51\x4c\x86\xe3\xeb\xf1\xf4\x76\xec\xf7\xdd\xee\xce\xce\x0e\x96\x00\xd8\xf9\xe0\x1f\x9b\xde\xb1\x1a\x9e\xf0\xc1\xf4\xb9\xe4\x5f\x0b\xf2\x0d\x1c\x77\xcc\xec\x55\x45\xb9\xdc\x3e\x7a\x66\xc0\x9b\x9c\x72\x97\x19\xea\x75\x4e\xe0\xc0\x39\xd9\x55\x3c\xe7\xf7\xcc\xb4\x30\xce\xa7\x3c\x9a\xcb\x40\x61\xc5\x2d\xaa\x12\x81\x03\x7a\x7d\xf2\x5a\xb5\x2d\x4e\x4e\xc2\xb5\xf9\x6d\x22\x45\xda\xbf\xff\xcd\x37\x03\xac\xf1\x80\xff\xbf\xf5\xcd\xa6\xac\x4b\x28\x5a\xb0\xc8\x20\xd7\xc1\x85\xe4\x52\x62\x0c\x1c\x42\xd8\x66\xb8\x48\xb1\x7e\x5d\xf6\xd9\x39\x5c\xef\xa5\x49\x83\xcf\x3a\x43\x23\x5c\x9b\x67\x8c\x8c\x1b\xdd\x2b\xe2\x8d\x92\xb2\x23\xe4\x8f\xcc\x94\x38\xc9\x88\xe1\x95\x98\xd4\x3c\x6c\x67\xb7\x49\xd2\xc8\x31\x3b\x25\x35\xc6\x44\xb2\xd8\x76\x30\x57\xcb\xd1\xac\x2c\x8c\xbc\x98\xf2\x35\xe7\x63\x52\x16\x5c\x61\x64\x52\x21\xa7\x12\x17\xbb\x6b\x42\x94\x2b\xb3\x65\x4a\x53\xf4\xf8\x22\xdd\xcf\x18\xcd\xdf\x04\x8b\x9d\xb2\x25\x11\x9e\x45\x41\x52\x66\x24\xff\xf6\xfa\xa7\x47\x03\xf8\xf7\xeb\x9f\x7e\x7a\x04\x1f\x50\xd2\x84\xa7\xf1\x26\x7d\x4a\xe5\x23\x95\x84\x41\x98\x04\x8f\x73\x4e\xbb\xab\x30\xad\x39\x25\x1c\xd6\x8c\x81\x25\xa8\x0d\xa5\x54\x75\x31\x3e\x4f\xfe\xb0\xbb\x8b\xa0\xb6\x6a\x90\x44\xc9\x50\x15\x9b\xd2\x7f\x16\x4b\x9a\x0f\x5a\xb0\x8c\x06\x8d\xdd\xb3\x71\x72\xd7\x89\xcd\xac\x62\x36\x9c\x19\xbe\x3b\x1b\xc8\x56\x0c\xb0\x51\x26\x35\x11\x26\x66\xd2\xb9\x75\xa1\xa3\x87\xee\x79\xbe\x58\x50\xd6\xbb\xa4\x9a\xa5\xf0\x92\x61\x17\x5f\xf2\x13\xc4\x54\x2e\xb9\x9a\x9d\x65\x96\xf6\x86\x89\x92\x90\x3a\x06\x8b\x6b\xe4\xea\x5c\xfc\x65\x6d\xea\x77\xba\xec\x08\x4f\x47\x45\xe2\x0c\x53\x79\x53\xc6\x3e\xae\x1d\x58\x90\xad\xcf\x16\xf5\x31\xb4\x63\x0a\xe8\x59\x7c\xa0\xd9\x50\xd6\x6c\xc8\xfc\x7f\x48\x95\x02\x6f\x81\x58\x07\x5f\x87\xe1\xc5\x91\xd0\x6e\x90\x5c\x36\x5c\xd6\x92\xeb\xa8\x2d\xad\xac\x47\x26\xe0\xa1\x45\x7f\x48\x11\xf8\xb7\x46\xac\xfd\x16\xa4\xeb\xcf\xd8\xa7\xdd\x6a\x71\xc0\x3f\x0e\x87\xea\x50\x8b\x14\xaa\x42\x17\xd3\x65\x35\x9c\x61\xb5\x8a\x21\x26\x42\x1a\x62\x31\x82\x5b\x08\xa0\x4d\x94\xac\xfc\x49\x2e\x8b\x58\x13\x63\x9b\x8a\x62\x6c\x63\x55\x0c\xbf\x50\x85\x3a\x21\xd0\x4b\x96\x5d\xa5\xcd\xe9\xec\x2c\x2d\xe9\x67\x92\x46\xab\xe4\x8f\x1f\xad\x44\xd2\x73\xa3\x53\xd7\x09\x3e\x2b\xe0\xc1\x1d\x2e\xc3\xf8\x66\x9b\xd1\x29\x79\x93\x3e\x19\xdd\x3e\x17\x78\xb0\x72\xb3\x0e\xa6\x56\x26\xec\x11\x7a\xe5\xe0\x0f\xd4\x59\xcd\x9e\x7a\xd2\x9c\xa1\xbf\xcc\xc5\xeb\xc0\x90\x1c\x64\x06\xe0\xcd\xc4\x54\xce\xfb\x7c\x53\x79\xc3\x55\x78\x1a\x53\x79\xb3\xe6\x54\xde\x98\xa9\xbc\x69\x4e\xc5\x41\xf6\xa7\x82\xc9\x8c\x86\x69\x95\xa7\x70\x56\x66\xa3\xfc\x74\x09\xe7\x1f\xfe\x1e\x82\x14\x82\x32\xc0\x72\xb6\xfe\xeb\x6f\x6d\x3d\xf2\x21\x26\x50\xda\xc7\x31\x93\x7d\x33\xa6\x0e\x20\xe0\x7a\x53\x97\x48\x7f\x88\x40\x42\x95\xe6\x1c\xc6\x94\xd6\x73\x48\xfa\xd6\xa1\x50\xe8\xe7\xc1\x91\x92\x7d\xc3\xca\x49\xe2\x50\x1a\xa1\x59\x1e\xdd\xe8\xea\x28\x41\x17\x27\x03\x87\x59\xcd\x82\xdb\xe7\x57\x66\x17\xd9\xfb\x1e\x7a\x6e\x64\xd5\x82\xdf\x30\x34\xaf\xe1\xe8\x1a\xa4\x41\xcc\xc1\x68\xbc\xc8\x6b\xca\xc2\xdc\x1c\xca\x9e\xae\x32\x3b\x05\xac\xa7\xa8\xfb\xb5\xee\x1e\x5c\xcf\x37\x5c\x97\x51\x31\x5d\x5f\x7f\x1a\x91\x8d\x6a\x34\x41\x41\x0b\xbd\x26\x5e\x02\x74\xe4\xc7\x38\x08\x7c\x45\x66\x16\xaa\x06\xe4\xab\x84\xd8\x97\x68\x3a\xd9\x1e\xb1\x25\xc6\xda\x32\x8c\x6e\x08\xae\xcf\x27\x66\x0d\x0d\x7f\x87\x95\x84\x3b\x53\x43\x85\x56\x2f\x96\x53\xf2\x4e\x4a\xad\xc9\x2b\x36\x5f\x24\x58\x1e\xea\x56\x33\x6f\xf2\xd4\x96\x59\xf3\x6c\x44\x50\xec\x7f\x37\xdc\xfd\x06\x55\xe6\x69\xb2\xfb\xad\x2f\x5c\x6d\xda\x19\x93\x43\x21\xc8\x37\xcd\xb5\x49\x9a\x8b\xe1\x8a\xfb\x06\x73\xb4\xb7\x2f\xe9\x99\x6f\xa0\xb8\xe8\xbc\xcb\x8e\xf0\x31\x90\x9a\x54\x86\x46\xf0\xb5\xba\x66\x2b\xa0\x10\x23\xb9\x2c\x31\xd4\xa7\x5d\x1c\x68\x60\x4a\x1d\x3e\x93\x98\x62\x0b\x33\x12\x2a\x80\x03\x01\x87\xe7\x38\x3c\xdc\x29\x5f\xb7\x54\xe2\x64\x07\xc9\x56\xe4\x26\xd9\x78\xf7\xfe\x6d\x5f\xc4\x11\x7e\xf1\x5a\x1d\x6b\xc4\xec\x7d\xaf\xd2\xba\x6b\x55\x3e\xcb\x7b\x0b\xe2\xf1\x5a\xa2\xdc\x88\x92\xa2\x21\x94\xc7\x87\x07\xb6\x16\x02\xe5\x75\xdd\xbd\xaf\xd0\xbf\xc8\xcb\x62\x8e\x2f\xc2\xdb\x62\xff\x97\xde\xf1\xe1\xeb\xe7\x18\x14\x4b\x06\xa7\xe1\xfd\x6f\xbe\xe5\xb7\x18\x47\xa5\x36\x1e\xaf\x46\xd8\x52\x43\xa3\x57\x12\xe5\x3a\xa8\x06\xbe\x0e\xc8\xa0\x89\x47\x76\x78\x92\xc2\x13\x77\xfd\xfb\x3d\x70\xe9\xe8\x6d\x3c\xce\xfe\x94\xbe\x59\x26\x47\x68\xb6\x7d\x5e\xcc\x8b\x8d\x41\xb2\x71\x88\xac\x12\x0e\x9a\xfc\xfd\xa4\xcc\x32\xfc\x08\xbf\x3c\xcf\xe6\x53\x6a\x72\x2c\x54\xeb\x54\x24\xbd\x19\x34\x61\x35\x5f\xa8\x88\x14\xdd\xa7\x70\x2e\x42\xb8\x91\xde\x9b\x4e\xac\x3f\xb5\x5b\xab\x69\x77\xe1\x29\x8c\xa9\x53\x22\xeb\xeb\x4a\xa9\xc1\xf1\x5b\xe4\x57\x58\x16\xce\x1f\x74\x56\xb0\x18\x75\xbb\xb7\x78\x3a\xc7\x24\x19\x39\x7a\x09\x44\xf5\xb1\xfe\x18\xf6\x3d\xa9\x70\x80\x9b\xe7\xb3\x18\x19\xee\x7f\xbd\x33\x48\xcc\xbf\xa2\x76\x06\x37\xd6\x2d\xed\x0c\x67\xc5\x2c\x43\xb3\x69\x35\x64\x27\xd1\xcf\xac\xdf\x45\xf0\xdb\x99\xb5\xb6\xb9\x3a\x63\x8e\x68\x6c\x1d\x5d\xb6\xcd\x52\x35\x38\xdb\xcd\xbe\xfc\xb0\xbb\xf5\x28\x7f\x73\x6c\x6a\x34\x55\xac\x21\x10\xe1\x02\xb9\xaf\xed\xca\x72\x1d\x34\xe5\xa8\xad\x54\x41\x0b\x06\x61\x0c\xdc\x9a\x60\x84\x95\xd4\xc7\xb9\xad\xcf\x8b\xcf\x1d\xf6\x29\x1b\x00\x3a\x5b\x7a\xc9\x32\x0b\x2f\x02\x80\xb2\xaf\xaa\x62\x72\x26\xf6\xd9\xa4\x80\x75\x67\xb4\xf4\x0b\x3c\x75\xe7\x73\xf5\x93\xb9\x62\x39\x52\x94\x18\x14\xbc\xb3\xec\x2a\x35\x5f\xf3\xdb\x9b\xdc\xd7\x04\x90\x8b\x42\x10\x70\x26\x14\xa1\xa1\xf0\xb0\x02\x8b\x31\x1d\xd9\x52\x7d\xce\xdb\x7f\x20\xda\x1d\x31\x74\x7b\xc0\x9f\xd0\x98\x27\x28\xbc\x18\x50\xd6\x47\x55\xa6\xc1\xaa\x8f\xb0\x6f\x35\x20\x8b\x7e\x60\x6c\xfa\x6e\xbf\x78\xbc\xf3\xfd\x56\xc4\x27\xc8\x7e\x3a\x22\x5d\x73\xa2\xb6\x5b\x19\x49\xfe\x22\xf1\x6c\xe8\x75\xf2\xf3\xc6\x5e\xb2\x11\x78\x4a\x6f\x0c\xb4\xf5\x64\x43\xbd\x08\x9f\x61\x6b\x8c\x1c\x88\x35\xf9\x3d\xfe\xf8\xbe\xf7\xfb\xc3\x67\xcf\x5e\xbe\x7f\x3f\x7f\xdf\xdb\x70\x6d\x3e\x19\x02\x9c\xa5\x57\x43\x5e\xc4\xa1\xa1\x87\xb5\x09\xd1\xfa\xcd\x61\x24\x0f\xe9\x5a\x15\x1b\x7d\x9e\x5e\x25\x12\x10\x4e\x95\x16\x1e\x1f\x1c\x0d\x92\x97\x47\x07\x83\xe4\xd5\x73\xda\x9b\xfd\x57\x47\x8e\x40\x47\xd9\x09\x95\xed\xe1\x8c\x00\xc9\x72\xe1\x1d\x22\x27\xc7\x33\xb5\x59\xe4\x31\x32\x87\x59\x4a\x5a\x66\xc3\x13\xfc\xf4\x99\xb9\x0a\xf0\x11\xb8\xde\x6a\x15\x04\x24\x44\x96\x97\xc9\x13\x24\x16\x17\xa6\xb8\x95\xb8\x57\x3b\x96\x3f\xf4\x6c\x46\x7e\xad\x5c\xf1\x16\xa9\xd4\x4c\xea\x54\xec\x5f\xe2\x36\xf3\x39\x74\x0f\xa1\x77\x90\xf5\x05\x62\x86\x95\xda\x04\x25\x92\x06\x85\xd5\xf4\x0e\x29\x54\x36\xf1\x33\x7a\x08\xac\xbc\xbe\x81\xa9\x51\x09\x8c\xa1\x63\x1e\xe6\xa9\x86\x5b\x66\x90\x7c\x35\x48\xbe\x1e\x24\x70\xf9\x7e\x2b\xae\x40\xcf\x49\xb9\xc5\xa5\x6e\x79\x3c\x22\x94\x79\xf3\x91\xd1\x66\x80\x74\x4d\xb0\x68\x36\x3d\xee\xea\xf2\x5a\x3d\x1a\x67\xf9\x04\xd7\x9f\xa1\xcb\x50\x6c\x77\x9e\x0f\x51\x61\x69\x80\x59\x3f\x1b\xb4\x02\xce\x49\x97\x79\x99\x71\x9c\x6c\xce\x76\x0c\x86\xf0\x95\x5d\x2c\x0c\x77\xf9\x2b\xde\x6e\x12\xf4\xb3\x4d\xd5\xb3\x6e\x76\xc3\xd9\x39\x35\x40\xac\x75\xcb\x79\xdd\xec\xb5\xd6\xbc\xf1\x78\x30\xaf\x75\x78\xdb\x61\x71\x60\xf4\x05\x1c\x32\xf3\xbf\xfd\x8d\x17\xbc\x82\x35\x9d\xbb\x37\x21\x8e\x46\x9e\x7c\xbb\x5b\x5b\xdf\x87\xa5\xd3\x5b\x0d\x06\xe2\x76\x76\xcd\x0f\xac\x72\x39\xa7\x98\x6b\x76\x7f\xc9\xf1\x35\x69\xab\x36\xa7\x23\xe7\x0e\x88\x75\xc5\x26\xec\xaf\x65\x6f\x14\x34\xbf\xb1\xd3\x09\xbe\x3c\x36\x2a\x10\x93\xb0\x58\x53\x81\x3d\x37\x5c\x6c\x35\xd6\xff\x98\x62\x10\x19\x45\x92\xb0\x47\x0e\x6a\xb5\xcd\xd0\x4e\x71\x0f\x83\x43\x57\x20\x40\x84\x37\xc2\x97\x6c\xa9\x8b\xd4\x56\x99\xe6\x4f\xfc\x18\xe3\xa2\xef\xd7\xe6\x0a\x35\xb0\xa4\x10\x4e\x72\x91\xcf\xf0\x84\x65\xb3\x74\x1c\xb7\x77\x59\xfa\xb3\xeb\x68\xb2\xb4\x89\x6f\x9e\x49\xa0\xae\x4a\xd2\x5b\x26\x68\xfb\x78\xa2\x15\xde\xe4\x12\xd4\x6d\x23\xf3\xa8\x17\xef\x6d\x1a\xf1\x9e\xb5\x7e\x6c\x72\x2a\x9d\x00\x40\xe2\x1e\x29\x9c\x29\x31\x85\x47\x68\xa4\x06\xfc\xdb\x51\x1a\xdd\xb9\xff\x97\xd4\x7e\x3b\xa9\xb9\x85\xbc\x01\xad\xb9\x4e\x7f\x6b\x62\x13\x6a\xa3\x1b\xfc\x6f\x47\x6d\x54\x51\xfe\xff\x52\xdb\x6f\xa7\x36\xb7\x90\x37\xa0\x36\xd7\xe9\xef\xc3\xda\x88\xd8\x2e\x3e\xbb\x8c\x48\x60\xdf\x60\x81\xed\x8a\xa8\x8c\x6d\xdc\x34\x0d\x33\xbc\xf8\xe2\x0c\x33\x13\x1e\x73\xf3\xc7\x42\x6f\x59\x9f\x0c\xbf\xeb\x0d\x92\x77\xf6\x53\xaf\x4c\x2f\x5d\x18\x06\xab\xec\x6c\x36\x5a\x33\x14\x09\x6a\x93\x14\x44\x58\xeb\x10\x64\xbd\x59\x09\xc7\x16\x9b\x79\x3e\x61\x23\x2e\xd7\xe0\x7a\xcf\x83\xbe\xef\x91\xd0\xf2\x1e\x47\x56\xfe\x5a\x2c\xb1\xa0\x21\x17\x29\x0e\xe4\xab\xf3\xf5\x25\x71\x17\xae\xd3\x65\x06\xac\x24\xbe\x57\x87\xf4\x92\x9a\x7a\x7e\x9d\xd8\x31\x23\xf8\x14\xcb\x7a\xb1\x5c\x5f\xc1\xa8\x90\xe9\x12\x2b\xdb\xb0\x71\x91\xdc\x34\x6c\x80\x0f\xc8\x97\x43\x71\x07\xf9\x3c\xab\x83\xfa\x25\x7c\x66\xa1\xa9\x5b\xc9\xb0\x33\xfd\xd8\x93\xa5\x00\x5a\xcd\xa6\x43\x94\xc4\x87\xb3\xe5\xb4\xce\x17\xd3\xfc\x06\x1c\x57\x61\xb1\xdb\xd0\xfa\x39\x78\x56\xdf\x48\x3a\xbf\x64\x92\x4d\x81\xea\xd0\x3f\x08\x5f\x28\x84\x81\xf8\xf8\x53\x22\x1d\xcb\x2a\xac\x74\xcc\xab\x4a\x0d\x31\x38\x98\xcd\x66\x98\x4c\xc4\xd4\x26\x21\x31\x39\x14\x8f\x91\xdf\xfd\x2d\x0e\x56\xe3\x3c\x19\xa6\xe5\x9d\x74\x92\xe7\x87\x5c\xca\xec\xd6\xb6\xd4\x98\x59\x03\x9f\x09\xf7\x92\xa7\x04\x38\x66\x52\xad\x9b\xf6\x54\xe5\xd5\x50\x0e\xc7\xd5\xed\xbc\x8b\xc8\xe5\xb5\x11\x65\x40\x6e\xe3\x14\x7a\x5d\xc1\x76\xd5\x5c\xd7\x87\xd5\x61\xa1\xc9\x65\x52\x8c\x97\xa8\x6a\x07\x74\x3a\x23\x6c\x6d\xa2\x34\x89\x6c\xfb\xf8\x91\xbe\xf9\xf8\x71\xaf\x25\x62\xd9\x76\x58\x27\x5e\x7d\x39\xaa\x96\xa3\x7f\xf6\x18\x75\x09\x67\xfd\xa5\xce\xa7\x58\x96\x9b\x43\xce\x4d\x5d\xa5\x74\x32\xe1\x52\x89\xd5\xd9\x36\xa6\x61\x1b\x97\xf9\x28\xdb\x5e\xce\xed\x67\x1b\x10\x9e\x52\x6f\xce\x68\x87\xd9\x5c\xaf\x28\xb6\xe9\xd4\x98\x3e\x74\xc4\xeb\x72\x74\xb4\x1c\xb5\x54\x51\x28\x46\xb4\x1e\x65\xf5\x51\x42\xa2\x55\x42\x95\x7d\x87\xcc\x20\xb1\x18\xb0\x6b\x94\x46\x89\x2b\x64\x73\xf1\xd0\x28\x26\x08\xec\x85\x51\x92\xab\xfa\xbf\xe2\x34\x25\x1e\x66\x29\x95\x44\x5f\x8e\xcf\xb2\x89\x08\x61\xe8\x4d\x06\x7b\x31\x2f\x92\x79\x46\xeb\x43\x85\x51\x8b\xb2\xbc\xc6\xca\x4b\xcb\x9a\x16\x4f\xcc\x03\x6c\xa0\xf2\x8b\x13\xc5\xca\x18\xc3\x60\x41\x91\x6d\x5c\x73\x22\x01\xf1\xd9\x41\x01\xac\xb9\x7e\x5b\xd0\xec\x91\x69\xe0\x97\xb5\x76\xe9\x68\x99\x42\x25\x41\xb4\xee\xcd\x19\x1c\x6c\x29\x95\x99\x2a\x0f\xc1\xd0\xed\x39\x30\x21\xf0\x54\x73\xfa\x83\x8b\xb3\x0f\x9a\xc1\x6f\x1c\xf7\xce\x43\x6e\xda\x9c\x0f\x66\xf3\x8e\xec\xf6\xb0\xaf\x1e\x87\x6a\x64\x54\xfc\x55\x0c\xab\x95\xac\x62\x8a\x9b\xab\xf7\x2a\xcc\xfd\x2d\x3f\x73\x69\xbe\xa5\x5d\xb8\x4a\x0d\xe1\x15\x29\xb7\x8b\xc3\x8b\xbe\xf9\xc9\x15\xce\x27\x73\x8a\xfc\xcc\x0c\xe7\x02\x2e\x7d\x51\x44\xe9\x60\x92\xe6\x06\xa8\x24\x8c\x76\x60\x5d\x64\x8e\x11\x1b\xd8\xb1\x54\x2e\x46\xf3\xa3\x29\x4c\xaa\xc8\x5e\x67\x49\x74\xdf\xbe\x93\x0e\xb8\x01\xef\x3e\xb8\x5c\x89\x91\x16\x5b\x8b\x65\x75\xd6\xb7\x83\x7a\x27\xe8\x17\x7d\x70\x39\x56\xe7\x76\x4b\xbd\x0c\x00\xad\xbb\xdc\xfb\xee\xe3\xa2\xcc\xd0\x21\xad\x9a\x5e\x03\x13\x3c\xcd\xb1\xb8\x1b\x50\xc3\x45\x9e\x9a\x0a\x62\x76\x84\xfe\x66\xe7\xea\x6b\x5c\x56\xaf\x3f\x92\x3b\x59\x18\x1e\xb6\xae\xa0\x49\x5f\x79\x17\xdb\xe9\xbc\xa9\xbd\xa7\x73\x4e\xe9\x29\x2d\x39\x53\xaa\xfc\x61\x33\x62\xe6\x00\x1a\x7b\xda\xec\x93\x6a\x2f\x18\x70\x9e\xfc\x90\xec\x78\x80\x5f\x60\xe4\x95\x99\xc5\xa4\x09\x97\xe0\x55\x58\x64\x2a\xeb\xe7\xcd\xea\x82\xcc\x14\x95\x8b\x42\xcb\x41\xb2\x87\x10\xbd\x32\x8c\xe3\xbe\x29\x86\x07\xf7\x03\xd5\x39\xb6\xcb\x85\x0c\x90\xcf\x03\x3a\x5a\x5e\xcf\xc7\x80\xeb\x9c\x76\x6c\xcb\x66\x1b\x61\x5e\xcb\x0f\x36\x49\x07\x23\x06\x04\x90\xa2\x31\xf7\x10\xfa\xd9\x62\x3a\x44\xf4\x9b\x34\x67\xfe\x86\xc4\xb6\x30\xd3\xc3\x49\x6d\xc5\x98\x68\x46\xf5\x01\xcb\x51\x5e\x97\x98\x1b\xd7\x30\xf0\xaa\x2a\xc6\x79\xca\x75\x0a\xc8\xa1\x84\x98\xb7\x0a\xf3\xeb\xa6\x5a\x4c\xfa\x89\xf9\x49\x0f\x2c\xf5\xce\xd5\x62\x29\xa6\x81\x4b\xc6\x1e\x8d\xb6\xfa\x1d\xaa\x74\xd5\x62\x93\xa3\xd6\x28\xe3\x67\xb7\x5d\x83\x56\x92\x36\x33\x8e\x91\xb3\xd4\xad\xd4\x88\x31\x65\x5b\x8c\x68\x88\x6b\xcc\x4f\xd1\xcf\x0d\xfb\x46\x51\x86\x84\x4e\x0c\xd0\xc8\x67\x19\x92\x87\x6c\x14\x6d\xb1\x4d\xcd\x2c\x20\xe9\xc6\xbb\xc4\xac\x51\xf3\x5e\x2d\x7e\x66\x85\x81\x34\x2e\x40\x62\x82\x9d\x06\x11\xa5\xca\xa6\x17\x99\xc4\xef\x71\x55\x69\xe1\x96\x89\x23\x75\x22\x5e\x57\x95\xc3\xd4\x07\xa8\xb2\xfa\x98\x31\xe9\x3b\x8c\xc9\x28\x91\x63\x4d\x0e\x93\x9e\x1f\x7b\xbf\xcb\x3f\xf4\x55\x99\xa0\x1b\x9c\x61\x3a\xc2\x6e\x0d\x28\x35\x05\xce\x73\x4a\x63\x01\xfb\x1d\x63\xa1\x91\xbc\x16\x1f\x94\x4a\xea\x23\x5c\x66\xf0\xbc\x96\x85\x34\x25\x5f\xcd\x90\xef\x3e\x6c\xe1\x02\xa4\x35\x03\xf7\xaa\xd9\xc4\x77\xa6\x89\x8a\x9c\x68\x62\xd5\x8d\x3e\x92\x3f\xd6\x2f\xef\x65\x06\x0f\x5b\x7f\x08\x92\xf1\xdb\x91\xee\x74\xaf\xf1\xce\x5a\x25\xf0\x81\x80\x81\x68\xff\xd9\x45\xdc\xb6\x34\x4c\x97\x26\x71\x3e\xff\x23\x15\x8a\x5f\x17\x97\x07\x54\xda\x48\xfe\x3e\x42\x6f\x16\xfb\xd7\x71\x76\x55\xef\x5b\x8f\x0a\xaf\x74\x71\xb3\xc0\x3e\x0b\xd3\x36\xff\x79\xe5\x8a\xbb\x68\x33\x11\xb2\x05\xb2\x80\xe3\xc2\xa0\x33\x8d\x49\xe8\x5a\x27\xb3\x14\xde\xc5\xf0\xbf\xca\x38\x47\x51\x9e\x6c\x71\x92\xb2\x45\x11\x90\x93\x9f\xa5\x15\xaa\xb2\xf2\xb1\x15\x7f\x8d\x53\x08\x65\x75\xe5\x27\x1e\xa5\x09\x04\x0c\xc9\x2b\x4c\x62\x0a\x26\x13\xa9\xab\x55\x66\xf0\x94\xc7\xcf\xa8\x07\x73\xfa\x1c\x21\x01\x9d\x62\x8a\xa7\x85\x23\x82\x28\x8c\xa9\xa4\xa6\xd9\xe4\xd4\x06\x2b\xc6\xf2\x8e\x7d\x69\x2a\xd6\x38\x3f\x7f\x1a\xa5\x98\xab\x31\x90\x08\x50\x29\x87\x2b\x43\x2a\x39\xb8\x32\xe4\x39\xef\x77\xe3\x72\x0f\xa6\xf4\x31\x1c\x04\xf8\x89\x67\x58\xb9\x20\x0e\xc1\x9b\x94\x7e\xa9\x69\x75\x99\xce\x39\x92\x13\x28\x6a\x89\x97\x94\x2d\xb6\x0f\x3f\x74\x22\x07\xcc\xa2\xee\x55\x62\x6e\x46\x37\x55\xe8\x94\x8f\x72\x79\xf5\xf0\xe2\x09\xbc\x92\x32\xa5\x96\x1c\x78\x82\x7f\x30\x6e\xee\xde\x3b\x76\x53\x26\x8f\x5d\x66\x44\x68\x44\x4c\x89\x2b\x55\x80\x1e\x00\x18\x67\x92\xee\x97\x2f\x5c\x97\xe6\x77\x81\x4e\xaf\x70\x2a\xb6\xb6\xe8\x06\x1b\x12\x40\x43\x9e\x42\x57\xb2\x47\xc5\x14\x1f\x42\x97\x85\xfc\x7c\x24\x0b\x2d\xe5\xf6\xd9\xa6\x9a\x19\x1d\x0b\x02\x83\x97\xcb\x0c\xef\x50\xc1\x8f\x28\xc6\xb5\xc0\xe4\x04\x98\xfa\xbe\x0e\xe9\xc2\xe0\x30\x9b\x9a\x31\x18\x01\xda\xc4\x71\x5a\x52\x5e\x0f\xd8\x31\x5a\x58\x14\x2c\x7e\x7f\xfc\xfc\xd9\x21\x07\x6f\x91\xa1\x73\x6e\x10\x98\x62\x8d\xbe\x92\x96\x03\x3d\x9a\x60\x33\x08\x75\xf4\x2a\xba\xc4\x72\xec\x1c\xe4\x45\x70\xce\xd2\xc5\x22\x9b\xcb\x83\xc2\x85\x1c\x22\xff\x50\x75\x91\x59\xd1\xf4\xaa\x10\xfa\x97\xbb\x4c\xdc\x67\xd0\xf9\x04\x4e\x6b\xb9\x9c\x66\x92\xa5\x83\x4b\x9c\x60\x44\x34\x6c\x9f\xd9\x4e\x93\xd3\xbf\x2c\xa8\xec\x91\x50\x25\x17\x19\xa7\xa9\x24\x75\x7a\x9a\xf4\xae\x86\xd0\xb8\xc7\x07\x8b\x76\x9f\xfa\xd1\x88\x86\x32\x38\x91\xba\x0d\x47\x62\xa6\x06\x4f\x48\xa2\xa8\x89\xd5\xac\x73\x44\x92\x9c\x28\xa6\x21\x71\xba\x98\x9b\x33\xdd\x7a\xdc\x30\xe2\x26\xa3\x64\xa3\xe4\x88\x48\x7c\x07\xe3\xa0\x0c\x4d\x01\xf6\x3e\xb1\x50\xa6\x69\x9b\x89\x9a\xa3\x47\xd9\x79\x95\x75\x01\x46\x38\x08\x68\x48\x23\x44\x9e\x25\xd1\x45\x67\x41\xc7\x26\x05\x37\xa9\x17\xf0\x45\x5a\xf9\xd4\x18\x39\x1e\x52\xbb\x0a\x68\x48\xb8\x0d\xd3\x0f\xf2\x2d\xe0\x8d\x57\xf9\x0c\xae\x1d\xf1\x7d\xa7\x8c\xfe\x88\xc6\x4e\x28\x5e\x4a\x2d\xb6\x4f\x52\x95\x1f\x5b\x1f\x50\x63\xd2\x34\x0a\x14\x77\xf6\xb9\x85\xf0\x4f\x60\x77\x22\xd3\x59\x7e\x72\x94\x65\x72\xa2\x4d\x75\x38\x9f\xaf\xda\x6f\x11\x40\x8e\x8b\x3e\xe3\x64\xe0\x24\xbf\x0a\x34\xca\x44\xc2\xf4\x5b\x89\x03\x71\x51\x60\xa6\xbf\x6b\xed\xd4\x4e\x31\x5d\x93\x09\xe9\x1a\x0a\xa4\xcd\xe2\xd2\x8f\x48\x17\x68\x3b\x78\xed\xa3\x41\x07\xe8\xea\x22\x9f\xf8\xd2\xa5\xec\x57\x50\x1f\x40\xad\x43\x50\xff\x9e\x5e\x13\x63\x8c\xc1\x4f\x27\x43\x2e\x7e\x3d\xa6\xfa\x5e\x42\x9a\xb4\x05\xf2\x70\x75\x5c\x40\x97\x9b\xc7\x16\xfb\x14\xd6\x67\x5f\xab\x98\xed\x9b\x57\xdb\x8b\x55\xb0\x8b\xac\x00\x71\x1a\x7d\x87\xde\x47\xa9\xbc\xae\x77\xee\xd7\x5f\x93\xef\x76\x34\x60\x7b\x35\xa2\xcb\xe3\x80\xfc\xc6\x29\xa1\x50\x56\x62\xb2\x01\x4e\x97\x4e\x3e\xc5\xca\x1b\xd2\x8c\x55\x7b\x57\xba\xa7\x2d\xf1\x6f\xfb\x3e\x5b\x81\xb6\x8c\xf6\x71\xd3\x60\x70\x20\xa3\x53\xbc\x12\x1b\x94\xe4\x8e\x1e\x17\x45\x39\xa1\xe4\x18\x6e\x3c\xfe\xe9\x95\xb9\xbd\xf5\x78\x2c\x7b\xf4\x45\x3e\x73\xd3\x9b\x17\x13\x3e\x6a\x29\x27\x9e\x37\x5c\xc1\xdd\x82\x3c\x1c\xa6\xed\x10\xb8\x74\x83\x06\x63\x02\xf8\x17\x00\x09\x57\x14\xed\x60\xab\x46\xc0\xca\x2c\x46\x28\xb9\xe9\x50\x6d\xe3\x14\x27\x27\x18\xc4\x4e\x17\x9e\xa2\x03\xba\xb6\x75\x4f\x97\x54\x27\x36\x5e\x30\xd8\x4b\x02\xea\x86\x53\x6f\xe3\xd7\xa6\x5e\xa1\xe5\x29\xe4\x44\xcc\x7e\xd9\x4e\xc0\x0b\xb4\x83\xb6\x00\x87\x6b\xf1\xa9\xd9\x3a\x52\xd9\x46\x08\x81\xb9\x89\x79\x0d\x1a\x81\x22\x65\x87\x5d\xe2\x2e\x8d\x03\x14\x9c\x57\xf5\x1a\x3c\xcd\x6a\x1a\xb4\xad\x0a\xa8\x23\x1f\x6c\xd6\x6f\x9c\x9f\x41\x70\x2a\x4d\x95\xb7\xb6\x75\xf2\x27\x61\xb1\x6f\x62\xec\xad\x94\xe5\xb2\x11\x31\xef\x66\x93\xfd\x3d\x07\xb6\x74\x16\x3d\x0d\x27\xb3\xfe\x5c\xda\x37\x60\x9d\xe9\xdc\x6e\xfb\xde\x12\x8d\x77\x57\x71\x55\x1b\xe6\x4d\xc6\xd8\x8a\xda\x2f\x2a\x90\x24\xa4\x8c\x42\xfc\xda\x1b\xaf\x71\xd9\x29\x18\xad\x13\x81\x23\x76\xa0\x78\x70\x47\x91\x9d\x80\x7b\x4b\xb1\x9d\x3b\xba\x38\x8b\xc7\x03\xa5\x43\xf2\xa3\xb4\x55\x3a\x50\x1c\xd4\x6b\x1b\xed\x0f\xa8\x0f\x64\x9e\xc3\x50\x3b\xf6\x9a\x45\xf3\xda\xa6\x06\x20\xf9\xdc\x7f\xde\xd0\xd1\x94\xed\xc8\x9b\x5c\x40\x09\xab\x4c\x10\x0e\xd0\x0d\x08\x81\xcc\x78\x58\xc8\xa0\x93\x10\x4c\xab\xaa\xbf\xbb\x69\xab\x26\xf9\x53\xf1\x1f\x68\x98\x3d\xc7\xc9\x82\xc1\x64\xe0\xdb\x99\x17\x25\xbd\x9a\x48\x82\xb3\x6b\x1f\x37\x7e\x65\x22\x3e\x7c\x3f\xa8\x95\xf9\x91\x97\x86\x63\x7c\xe1\x4a\xc0\xde\x6b\xad\x47\xd5\x42\x4a\xf1\xf3\x2e\x5a\xd0\x1d\xd9\x6f\x7f\xaf\xc5\x94\x49\x92\x92\xa9\x7f\xda\x58\x9f\x70\x0d\x1a\xbb\x4b\x37\x6b\x21\x42\x5e\xe7\x14\x24\x5d\x5d\xb0\xa9\xd0\x5f\x1d\x86\x18\xea\xf0\xff\xd8\x28\x86\x3b\xdf\x14\x6b\xa2\xde\xba\x0b\x66\xeb\x6e\x34\x87\x2a\x98\x44\x15\x9d\x85\xb4\xdf\x02\xe1\x75\x7a\xdd\xf7\x7f\xa4\x69\x55\xad\xe7\x0f\x15\x57\x9f\xe3\xf8\x59\x38\x37\x38\x7d\x8b\x62\xb1\xf2\xec\x71\x9b\xb5\x4f\x9e\x71\xd2\xf8\x67\x3c\x7c\x32\xd5\xdb\x1c\xbd\xe8\x05\x0c\x7c\x97\xfa\xaf\x7d\x2c\x63\x8b\xf7\x19\x4f\x26\xaa\x56\xd7\x3c\x96\xa4\x85\x5d\xe7\x38\xae\x83\xf2\xe7\x38\x91\x82\x7b\xcb\x71\xa4\xad\xc5\x26\x6b\x9f\xc0\xd8\xf2\xbb\x10\x1e\xb9\x7b\xff\x5a\x1b\xc1\x4d\x82\xad\x20\xf5\x06\xf3\xc0\x0e\x46\x29\xad\xd6\x64\x96\x37\x9b\xd1\xe7\xd8\x27\x3b\xb5\x2a\x3e\x37\xd9\x30\x6b\x66\x47\xcb\xe0\xce\x83\x04\x6d\x22\xb4\x89\x22\xba\x26\xf9\xbd\x7b\x5e\xa6\xf9\xf8\x42\x24\xf7\x92\xdc\x2c\x46\xf5\x2e\xff\xd0\xb4\xb1\x0b\x93\x4a\x63\x7c\xb6\x73\x71\x6e\xca\x7f\x35\x9b\xe9\x5c\x21\x66\x5e\xb1\xcd\x5f\x83\xcf\xc8\x42\xfe\x0f\x60\xc6\x76\x99\x62\x84\xb4\x2e\x5b\xf6\x9a\x07\x87\x85\xcc\xd6\xa8\x78\xeb\x30\x23\x78\x2a\xfe\x0a\x1d\x4f\x63\xda\x0a\x58\x04\x56\x4f\xf0\x6b\x16\xc3\xe3\x2a\xaa\x6b\x47\xb9\x6b\x73\xa9\x8c\x8a\x70\xd0\x9f\xcd\xc0\xdc\xe7\x60\x6f\x09\x10\x14\x6b\x04\x26\xb4\x32\x4a\x33\x09\x5f\x25\xe3\x9b\x7a\xf4\x5b\x13\x07\x7a\x4d\xf3\x2c\x10\x1c\x9b\x9b\xd3\x9c\x2b\x47\x17\xa3\x6a\x8c\xca\x7c\x6b\x7f\x5c\x71\x68\xcd\x62\x1c\x84\x7a\x98\x98\x43\x52\xf0\xd0\xc0\x7d\x32\xea\x99\x6e\xd5\x4a\x87\x36\x64\x5d\xdd\x85\x2b\xec\x32\x96\xca\x2b\x86\xbc\x65\x79\x56\x1d\x3f\xda\x9e\x03\x83\x5f\xe7\x0c\x0d\xfe\xb0\x3e\xf3\xac\x24\x95\x36\x57\xb8\x8f\xb7\x62\x8a\xb5\xaa\x31\x34\xac\xcd\x39\xe7\xd8\xc9\xb4\xb8\xec\x85\xab\xe3\x26\xb9\xf3\xa0\x65\x65\x85\x2f\x75\xb4\x30\xd0\x71\x1e\xe8\x8b\x68\x3d\x2e\x90\x76\x1e\xe8\xd7\xa5\xaf\xd1\xdb\xca\x2b\x51\x99\xf6\x37\x5d\x5d\x9b\xab\xda\x4e\xd0\x33\xb5\xca\x2f\x64\x28\xa4\xb7\xbb\x2d\xdd\xda\xd4\xac\x38\xe3\xef\xf6\x76\xf2\xd6\x84\x05\x90\xc5\x1c\x3d\x25\x50\xfd\x8b\x66\x69\x9b\x32\x8d\x14\xbd\xb4\x29\x94\xfb\x0a\x39\x51\x96\x0e\xf0\x48\x50\xf5\x5d\x86\x43\x79\x07\xd0\xfb\x1e\x55\xfa\x1c\xc2\x9d\x95\x68\xa5\xb6\x39\x9c\xb6\x8c\xa7\x89\x40\x7f\x18\xd3\x63\x6e\xc9\xaf\x0f\xe2\x6a\xce\x2d\xd7\x59\x16\x33\xde\x0c\xfd\x3e\x0e\x08\xfb\xbe\xab\x5d\x4d\xca\xc2\xf8\xa8\x9c\x5b\xf9\x80\x15\x89\x59\xd9\xc7\x9f\xdb\xce\xca\x16\xe9\xbf\x27\x07\x70\xea\x27\x7d\x84\x19\x36\xb4\xc7\x06\xfe\xeb\x9c\x9e\x5a\x27\xb2\x62\xc6\xfe\x54\xd4\x39\x7b\x9e\x96\xe7\x1e\x67\x24\x39\x89\xbc\x36\xc8\x36\x2a\x74\x97\xd9\xa8\xe6\x39\xd2\x08\x52\xbc\x36\x59\x90\xa2\xd9\xd2\x28\x05\x8f\x48\xd6\xb3\x89\x6c\x3c\x07\xb0\x72\xda\xb3\x92\x52\x5e\x38\x05\x19\x42\x16\xdb\x2f\x1b\x7e\xcf\xd1\x17\x97\x6a\x22\x73\xb2\x3f\xba\x7d\xc6\xc5\x6c\x84\xc3\xa0\x45\xaf\x40\xaf\xec\x52\x0d\x69\x6d\xca\x16\x24\x02\xb3\x26\x67\x1f\x5f\x0e\x43\xb1\x19\xe8\x75\x99\x6f\x4a\xc0\x91\x21\x9a\x62\xe3\xf1\x27\xb5\x95\x24\xcc\x52\xc8\x08\x65\x7e\xa2\xb4\x6d\x69\x6d\xec\x7c\x0b\xa0\x70\x9e\x69\x1d\xe5\xe7\x12\x37\x39\x9b\xc1\x14\xc9\x34\xe6\xad\x1e\xaa\xee\x29\x85\x0f\x67\xf9\x5b\x60\x94\xc1\xc4\x78\x06\x94\x99\x81\x42\x9b\xa3\x19\x22\x19\x86\xd1\x50\x82\x41\xa4\x01\xd6\x9d\x7c\x92\x10\x79\x06\x28\xbc\x54\x3c\x66\x35\xaf\x04\x9e\xd6\xca\x02\xd9\xe3\x3a\x7c\x0a\xa3\x3d\xb7\xf6\xae\x38\xc2\x97\x42\xad\x89\xea\xac\x8a\xb8\x55\x3e\xc1\x66\x48\x6f\x94\x22\x80\x8d\x0d\x72\x0f\xc4\x64\x19\x62\xaa\x41\x73\x37\x40\xa7\xae\xaf\xf5\x7a\x14\x6d\x1b\x02\x51\x4e\x8d\x71\x25\xb3\x70\x55\xb4\xb1\x17\xd3\x6c\xeb\x32\x2d\xe7\xfd\xde\xbe\xcb\xfd\x42\x19\x6d\x03\xe2\x80\xff\xcf\x38\x1d\x35\xa3\xd5\xf3\xea\x8d\x79\x0e\x37\xb8\x18\x3f\x3e\x6c\x51\x70\x07\x63\x4b\x7d\x67\xbc\x09\xa5\x10\xef\x88\x52\xca\xb3\xbb\x1d\x3f\x31\x68\x18\xda\xfe\xb6\x57\xee\xae\xba\x31\x0c\x06\xe8\xce\xf7\x9b\x06\xdb\xf1\x26\xe5\xb4\xa1\xcd\x1b\x27\x3e\xcc\x81\x08\xf5\xcd\x91\x64\x9b\x1e\x48\x2f\xb9\x63\x9b\x5a\xda\xe6\xc4\xa4\x71\xfb\xdc\x6e\x3a\xa8\x9b\xe4\x8d\x6e\xf7\x92\x4f\x5b\x63\x4b\xde\xc1\xa7\x0f\x0f\xfc\x1b\x49\xda\x6e\x91\x7e\x96\xee\x15\x57\x35\x9f\x2e\x18\x99\x49\xd0\xbc\xb8\x84\xab\xea\xb1\x89\x29\xe0\x2b\x0c\x4d\x7f\xf8\x63\xbf\xd7\x73\x5b\x45\xad\xa3\xb7\x96\x75\x4c\x93\x3b\xe4\x40\xcd\xda\xd1\x2a\x4f\xe4\x61\x8c\x99\x68\x57\xb1\x90\x00\xa2\x92\xd2\x30\x22\x60\x39\xff\x32\x7d\x45\xab\xcb\xf4\x81\xfc\x1c\x62\x79\xc3\x71\x94\xd3\x99\x27\x3b\x45\xe5\x61\x99\x77\xe7\xee\x93\x5c\xad\xf9\x0a\xad\x1a\xbf\x07\xfa\x7a\xe7\x70\x89\xc5\x86\xf8\x30\xb1\x18\x7a\xd3\x79\x60\x1b\x5e\x8a\xdd\x25\x66\xcc\xdd\x42\xa8\x64\x98\x71\x9b\xa8\x28\x65\x0b\xef\xf8\xa3\x7c\x44\x05\xc8\x7e\xfd\x55\x40\xfd\x28\x63\xeb\xfa\xf1\x2d\xd2\x4a\xe3\x67\x27\x03\x33\x0c\xd3\xc4\x71\x35\x59\x9f\x70\x77\xee\x3d\xe4\xd1\x1f\x68\xd2\x0d\x71\x6c\x3a\xdc\x8b\xdd\xc8\xb8\x04\xa8\xe4\x9b\x2e\xd6\x80\x92\xe6\xa2\x7b\x4e\xad\x73\x73\xd6\x5a\x18\x22\x0f\xa9\xe6\x4b\xb1\xfd\xe6\x00\x29\xeb\xc8\xc0\x3a\x20\xd0\xda\x8d\xd5\xfc\x22\x97\x6a\x79\x2d\x2b\x69\x7f\x40\xb2\x9b\xa6\x8b\x2a\xeb\x87\x4b\x3b\x88\x11\x3c\x33\xad\x31\x8a\xcf\x49\x1f\x8e\x7d\x76\x52\x5c\x3d\xa5\x24\x25\x93\x43\xf3\x1e\x54\x0e\xa0\x4f\x9e\x90\x0b\x21\xbb\x5d\x53\x74\x88\xb4\xa1\xb8\x27\x54\xff\x90\x5c\x96\xe3\x4b\xeb\x64\x80\xd9\xa8\x39\x63\x07\x34\xa5\x5a\x8a\xf3\xa2\x36\xa0\xa4\x94\x8b\x35\xfd\x0a\xda\x5b\x8d\x8d\x80\xe7\x79\xed\xc4\x30\xda\x3f\x96\xf7\x2e\x0b\xfa\xcb\x6a\xb0\x50\x0a\x98\x0b\x75\x98\xeb\x5f\xe7\x47\xc7\xbf\x7f\xa2\x36\xd8\xfa\xf1\xcb\xe7\x20\xb6\xa5\xa7\x94\x72\xac\xf7\xc3\x24\xbf\xf8\xf1\x07\xb4\xd8\xff\xf8\xfb\x6c\x3a\x2d\x92\xb7\x45\x39\x9d\xfc\xb0\x4d\xdf\xfc\xb0\x8d\xbf\xf6\xd8\x17\x3e\x41\x7d\x01\xb1\xb6\x8f\xe4\xf0\x95\x56\x95\x67\xf0\xe7\x4c\xc3\xe6\x90\x01\x67\xff\xd6\xe4\xf0\xbd\xa4\xa0\x67\xce\x42\xc4\x1e\x50\x76\x7c\x96\x35\x47\x28\xa0\x66\x7b\x11\x6c\x0c\x22\xf4\xef\x08\x6a\xec\xa7\x67\x70\x20\x3f\xa2\x94\x13\x1e\x3b\x87\x0d\xfc\xf9\x5a\x90\x70\x0e\xd5\x94\x7a\x54\x49\xe6\x97\x32\x8b\x8a\x2a\xf5\x68\x01\xbd\x2e\x86\xa3\x6c\x48\xb3\xe7\x5d\x50\xde\x59\xc6\xf5\x01\xfd\xcb\x4c\xc0\xb5\x81\xc7\xae\x11\xec\x78\x8a\x0b\x36\x4d\xd1\x8b\x8a\xde\x00\xa8\xcc\x68\xc4\x4e\xe0\xe3\x19\x97\xf7\x13\xf7\xb4\xde\x15\x94\x4c\x79\x9a\xd7\x71\x51\x4d\xd6\xdb\xf3\x91\x30\x93\xc2\xde\xce\x21\x82\x67\xc0\x6f\x4d\xeb\x62\x30\x1e\xd3\xbb\xb0\xe3\x5c\xda\x5d\xd7\xe7\x11\x41\x0f\x3c\xa6\x86\x7c\x93\x7c\xd9\x5f\x28\x46\x33\x9e\x16\xf3\x8c\x6e\x43\xba\x9b\x37\xbd\xa7\xb7\x94\x85\x35\x6d\xd5\x57\x78\x38\xc3\xef\xba\xd8\x31\xc6\x27\xd4\xa5\x20\xb5\x63\xf1\x42\x30\x16\xa5\x00\x16\xfb\xf1\x52\x08\x4e\xcd\xaf\x4d\xf9\x4d\xf5\x96\xfb\x37\x0a\x62\xd3\x32\xd5\x2d\xd8\x11\xf8\x82\x1a\xb0\x86\xea\x11\x39\xc8\xbb\x7e\x83\x06\xd7\xb5\x21\x1d\x77\xc3\x69\xc6\xe1\xb2\xda\xc4\x13\x1d\x14\xa7\x38\x64\xa7\x54\x26\x3e\x24\x2f\xf2\xb5\xcd\x41\xdc\x98\xd8\x32\x0b\xce\x1b\x66\x3c\x05\xae\xe0\x28\x5f\xbb\xc1\x75\x12\xc2\x2c\xbd\x1e\x65\x07\x00\x56\xbc\x96\xa2\x9a\xa1\x1b\xdc\x9e\x31\x59\xc6\xae\x39\xc3\xf8\xa1\x43\x92\x55\xee\x53\xc8\x93\xa9\x04\x1c\xba\xb2\x51\x88\x1d\xcd\x9e\x22\x6a\x61\x54\xae\x51\xc4\x5f\xc3\xd4\xad\x5f\xfe\x6a\xa7\x82\xd6\xc1\x6f\xee\x64\x10\x95\x9c\x37\x23\xd7\x7d\x4c\xb0\xc5\x17\xa1\x77\xd1\x07\x2f\x1a\xf4\xc6\x47\x76\x04\x94\xeb\x6b\x6a\x79\x26\x1c\x92\x81\x9c\x88\xf6\x10\x5d\x55\x6b\x8a\xe0\xa8\x13\x2c\x2f\x68\xf5\x42\xeb\x0b\x77\xc6\x33\xeb\xb9\xb1\xd0\xba\x47\x29\xfb\x4b\x90\x2b\xb1\x79\x2e\x7e\xb6\xc5\xe2\x41\x8d\xb9\xc2\x64\x7d\x65\xc5\x41\x5a\x8a\xc7\xa7\x59\x37\x72\x9c\xbb\x39\x2d\x06\x84\x18\x11\xc4\x7e\x10\xa8\x88\x53\x53\x80\xe5\x17\xfe\xcd\x18\xd7\x1d\x13\x4a\xd0\x14\x5d\x76\x62\xd2\x8b\xc4\xb9\xb8\xdd\x37\x4b\x82\x19\xf1\x59\x32\xa0\x3c\xe9\x6e\x67\xb6\xe2\x8f\x22\xff\xf8\x3d\x88\xa8\xe9\xf4\xa4\x3c\xb1\x31\x2e\x66\x9b\xb7\x4e\x84\x61\x75\xbc\x2e\x9a\x02\xa9\x79\xd1\x7a\x14\xf9\x43\x27\x37\x78\xea\xa9\xb8\x2f\x53\x8e\x2e\xca\x3d\x1f\x3e\x97\xa4\xae\xaa\x53\x74\xad\xc7\x1f\xe7\xea\x40\x54\x56\x4a\x73\x32\xeb\x6d\x5c\x8a\x34\xde\x9b\x0d\x5d\x31\xc0\x77\x85\x89\xa6\x59\xca\x39\xc9\x8c\xf3\x86\x71\x54\x90\xd3\x1b\x57\xa6\x85\x64\xd7\xc5\x36\x3e\x45\x8d\xba\x92\x78\xd1\x97\xda\x55\x81\x1e\xab\x56\x71\x8e\xdc\x4a\xb4\xa7\x93\xe7\x39\xc5\x12\x74\xac\x06\x41\xe2\x11\x49\x8c\x91\x2b\x03\xbd\x9e\x89\x36\x73\xa9\x2e\xce\x99\xfe\xf3\x85\x52\x97\x3a\xf8\x73\xe1\xd9\x3e\x25\x9b\x28\x17\x2a\xd2\x09\xcc\x6d\xb9\xb0\x97\x19\x87\x6b\x60\xf0\x1f\x79\xca\x03\x3b\x30\xa1\x30\xbc\xae\x4d\x5d\x2b\xc2\xe2\x19\x7a\xf7\x5e\x44\xb7\xe7\xc7\x93\xb6\x58\x75\xd9\x8b\xdb\x7b\xba\xd4\xa5\xbb\x1b\x1d\xd1\xb7\x3c\xb2\xfd\x46\xc7\x6c\x54\x70\x5f\xf8\x52\xd2\xad\x8d\x2c\xd6\xf2\x80\x57\x23\xc5\x66\xd0\xf2\x30\x5f\xb3\x35\x40\x68\x26\xa3\x6b\xd4\xa3\xa2\xe6\x02\xff\x22\x6b\x1d\x55\xd2\x9b\x9f\x32\x90\x4b\x6b\xe7\xa8\x4c\xf0\x9f\x44\xb9\x93\xde\xb9\x9c\x68\x60\x3c\x40\x7a\x96\xa5\x14\xc0\x8d\x11\x85\x86\x33\x41\x0b\xe3\xee\x68\x64\x33\xf9\x86\x56\xd0\xe0\xfc\x82\x6c\x1e\x88\x30\xba\xc2\x0f\xcc\x89\x26\x6f\x1e\x1b\xc9\x48\x65\x91\x34\x37\xb0\x3e\xc3\x40\x94\x28\xb8\x33\x2c\x5c\x25\x89\x99\x9f\x2d\xc7\x67\x2d\x8e\xd6\x46\x1e\x80\xe7\xb4\xc1\xc8\x20\xf3\x0c\xa3\x6c\x80\xe8\xc6\x67\x59\x60\x61\xb3\x8f\x31\x5f\xf1\x10\xd3\x88\x18\x0e\xce\xd6\x08\x23\xc3\x33\xfa\xf2\xd7\x2c\x4b\x51\xc2\x53\xd9\x72\x30\xaf\x92\xb7\x4f\x5b\x0c\x86\x4a\x43\xe4\x33\x4c\x81\x52\x25\x11\xd7\xeb\xb4\x0e\xbb\xcb\x6f\x24\x71\x9a\x4b\x82\x71\x79\x69\xb0\x5e\x71\x79\x3a\xea\xdc\x84\x3b\xd1\x28\x29\x8c\xf2\xca\x83\xa5\x94\x82\x80\xec\x3e\x50\xca\x69\x5a\x93\x0e\xdb\x9f\x3e\x57\x15\x6e\xf5\x1a\x5f\x98\x24\x2c\x30\x0f\x03\xcc\x4c\xc7\x45\x41\x14\xe2\xe4\x45\x06\x8c\x04\xa8\x1d\x93\x49\x1a\xda\x14\x5b\x32\x79\xc8\x5a\x72\x0e\x08\x7a\xcb\x29\x84\xaa\x16\xd3\xde\xd0\x9b\x9f\x89\x3d\x25\x9f\xf5\xbc\x52\xa0\x54\xbd\x1b\x60\x2c\xf0\x28\xaf\x33\xe0\x4d\xcb\x39\x85\x2a\x62\xb1\x9b\x5f\x4c\xcc\xc1\x40\x55\xed\x33\xc0\x24\x3a\x81\x72\x34\xc2\x06\x9c\x67\xa8\x87\x58\x9e\x9e\xc9\xa3\x76\xe4\x4a\x3b\xa1\x89\xc4\x0e\x3a\x70\x92\x5f\xaf\x46\x83\x92\x5d\xab\xb9\xd0\x2b\xe6\x01\xc3\x67\x6f\xc5\x09\x5b\xa6\x7c\x58\xc5\xa0\x64\xd4\x5a\x51\xdb\xa8\x8b\x91\xf8\xf5\x57\x2b\xbe\xb4\xd8\xcf\x3c\x94\x57\x36\x57\x45\x0b\x57\xb6\xbd\x1c\x13\x2b\x5d\xd9\xae\x06\x41\xe5\x31\xe6\xc9\xb9\xcb\xe6\xf2\x4d\x27\xc8\xc3\x72\x3c\xca\xe8\xc2\xc2\xb5\x18\x67\xf3\xb4\xcc\x8b\x81\x11\x98\x49\x79\x03\xfc\xaf\x36\x79\x36\x99\xd3\xc1\xcf\x65\xa6\x2b\x26\x39\x60\x52\xd5\x74\xaa\xce\x25\xe9\xa9\x6a\x4c\xb7\x01\x74\x74\x0f\x3f\x7a\xa1\xba\x22\xe8\x18\x0e\x8f\x07\xeb\x98\x52\xcf\x3c\x4c\xbe\xf2\xa7\x46\xff\xdc\xd5\x8d\x63\x0b\x20\xff\xe8\x4b\x03\xa6\xbf\x4e\x3b\xa2\x46\x5a\xbb\xc7\xc8\xba\x39\xfc\x68\xad\x3e\x6e\xd3\xc8\x52\xea\xaf\xef\x11\x57\x47\x1b\x99\x65\x1e\x78\x12\xc7\x5c\xe2\x78\x53\xb1\x56\x5a\x32\x0c\x0f\x62\xd2\x72\x0f\xc2\xba\xf6\x83\x2b\x13\x55\x9f\x55\x3c\x20\x1a\xef\xbd\xa2\xb4\x98\x5c\x66\x36\xb2\x6f\xac\x63\xcc\x8c\xe6\xa5\x03\x1b\x66\x0c\x72\x97\x2b\xd4\x3a\xad\x02\x16\xad\x36\x2f\x0a\xa5\x40\x60\xe0\x03\x0d\x3b\xd4\x21\x04\x70\x8c\x9e\xc6\x13\x33\x18\xcc\x1a\x9a\x65\xf8\xe0\xf3\xb3\x07\x8d\x75\x17\x81\xe4\xb2\xf2\x9e\xa3\x2c\x4b\xcc\x41\xa4\xc2\xa8\x5e\xae\xd4\x65\x35\x12\x1c\x13\x2f\x17\x0f\x0b\xb6\x56\xc6\x8c\xdf\x41\x49\xe3\x06\xf2\xed\x5c\xb1\x13\x4e\x8e\x10\x59\xe5\x1c\x08\xd4\xad\xa4\xae\x9c\x63\xd1\xcd\x91\x78\x29\x99\x07\x45\x31\x67\x8b\x5d\xe4\xf3\x38\x52\xcd\xeb\x0c\x4e\xe8\x8e\xa3\xf4\x56\xea\x0c\x89\x33\xca\x01\x8a\x1b\x81\x44\x76\x72\x2f\x00\x1c\x25\xf7\x36\x08\xea\x4c\xaf\x7a\x9d\x3a\x10\x5a\xb9\x26\x75\x32\xf9\x1f\x46\xe7\x26\x80\x94\x8a\xce\x92\x51\xec\xa1\xab\x85\x2e\xa6\x8c\x50\xf3\x71\xec\xef\x95\x11\x9d\x2e\x4b\xac\xc2\xc8\xa9\x00\x4c\x14\xb2\xd9\x79\xd6\x1a\x6b\xc2\x64\x50\xa3\x0c\x58\xf7\x5c\xe2\xda\xe3\x32\xd2\x80\x5f\x8c\xf8\x6d\x3a\xf9\x53\x3a\xf6\x38\x18\x3e\x46\xd2\x3b\xf2\x7e\xc4\x75\xce\x49\x3c\x04\xd1\x79\x42\x6f\x36\xa1\xdf\xc8\x56\xa3\x34\x24\xce\xc2\x0e\x87\xf8\xe0\x70\x7c\xb2\xf1\xb9\xd8\x68\x38\x17\x4e\x52\x31\x4b\x70\x02\x8b\xf9\xc5\x58\xa2\x3c\x06\x15\xfc\xe8\x2c\x58\x61\xaf\x2f\xbe\xf0\x35\x13\xab\xce\x5c\xd0\x5f\xdd\x02\xc1\x2f\x1e\x2d\xf2\x1e\x77\x70\xb3\x28\xbe\x2d\x9c\x2c\x7c\x3b\x74\x0c\xbc\xd9\x61\x49\x23\x35\x48\xe6\xe9\x4a\x56\x38\x2c\xf1\x23\x65\x2d\xbe\x2e\x80\x35\x63\x6f\x76\xb5\x56\xc1\xec\xd2\xb1\xef\xe8\x94\x3b\x0f\x48\x37\xd3\x72\x64\xd7\x41\xed\x8a\xe0\xc8\x78\xd1\x20\x36\x6d\xf2\x7c\xd8\x72\x5b\x39\x22\xd3\xad\x6f\x4a\x60\xfa\xfa\x53\x36\x6b\xf7\x6d\x94\x4d\xb6\xfc\xde\x41\x71\x0d\xc4\xd7\xa4\x36\x47\x04\x7f\x47\xaa\x6a\xca\x08\xab\xc8\x4a\xbc\x10\xd9\xd7\x9b\x6b\x55\xba\x77\x12\x67\x52\x44\x6d\xab\x3c\x94\xf4\xb3\x06\x8d\x4b\x03\x34\x51\x8e\x33\x4a\x74\x61\xc0\x9d\x16\xe2\x07\xe6\xa4\xa9\x86\xca\xca\x2d\xe3\x2a\x3b\x3b\xe3\x1a\xf7\xe6\x69\xc8\x73\xc8\xd4\x51\x4d\xc1\x86\x2f\xb9\xcc\xa5\x6a\x40\x44\xde\x90\x87\x21\x43\x32\xa2\x20\x9b\xca\xf2\xba\x61\x70\xa5\xd4\x31\xec\x85\xbc\xa4\xbd\x74\x06\x40\x1c\x6a\x94\xd5\x97\x3a\x1c\xdd\x19\xcf\xda\x2e\xbf\xdb\x93\xc4\x6d\xd8\x4c\x43\x7e\xec\xa6\x8c\x15\xec\x46\x69\x15\x5f\x3a\x87\x6c\x79\x40\x36\x14\x8b\x71\xaf\xf1\xff\xc1\x0a\xc3\x20\xf3\x43\xab\xce\x70\x96\x5e\x3d\x63\x2f\xb2\xb8\x03\x56\x97\x99\x46\x9e\xf0\x16\xc4\xa6\x3a\x42\xc9\x3b\x18\xe6\x83\x35\xc9\x5e\x76\x6a\xdf\x6e\x20\x79\x37\x8c\x29\x8e\xcd\x77\xd9\x49\xac\x2d\x36\xe2\x9d\xf4\x90\xc8\xce\x93\xe3\xd1\xd5\xc2\x12\x9d\xd5\x83\xa0\x0b\xe7\xb0\x58\x0c\xf8\xe1\x3e\x0b\xcc\x53\x2e\xac\xa3\x95\x19\xf9\x4e\x33\xdd\xea\xc0\xcb\xd6\x5b\x97\xfa\x4d\x32\x54\xf3\x1c\xc0\x63\xa7\xea\x3f\x4f\xeb\xb3\xad\x59\x3e\xef\x4b\xe2\x1e\xb7\x21\xee\x18\x7a\xc9\x41\x78\xd5\xd5\x09\x7b\x52\x94\x97\x58\xf6\x8f\xa1\xb2\x0a\x47\x3c\x79\x75\xe6\x8f\xb5\x0e\xdd\xb1\xf8\x20\x90\xe3\x0a\x05\xcd\x0b\x63\x64\xe0\x13\x0d\x11\x83\x3a\x30\x6e\x13\x93\x0a\x65\x27\x35\x65\xfe\xc1\xdc\x1e\x27\x27\xf0\x5a\xa2\x24\x27\xa1\xca\x0d\xd8\x6f\x3a\xcb\x8c\x33\x74\xf3\x20\x76\x44\xce\x78\xb9\x1d\x30\xcc\xdc\x81\x06\x74\x19\x3b\x57\x19\xda\x38\x31\xc4\x2d\xda\x0c\x84\x0a\x02\x37\x55\xc1\x5b\xed\x41\xfb\x21\x0e\x81\x56\xd1\x66\x25\x94\xb5\xea\x3c\xe2\x8a\x04\x5a\x22\x26\x3b\xec\x6d\x0f\xd6\xd4\x1e\x6b\xd3\x2d\xfd\xb8\x96\x01\x37\x91\x65\x7f\x98\x58\xda\x94\x40\xcc\x18\x8f\x89\xc0\x77\x3e\x0c\x2a\xf6\x5e\x56\x74\xc7\x79\x61\x5e\xb8\x40\x7e\xa3\xe8\x4f\xcb\x9a\x89\x7f\x80\x62\xe7\x33\x49\xc4\x70\xc7\x33\x28\x02\xcf\xd0\x11\x4c\x89\xee\x76\x23\xcf\xbc\xcf\xe0\x47\xa2\x9e\xba\xeb\x75\x95\x1d\xbb\x67\x83\xaa\xb0\xab\x9d\xea\x8d\xd0\x97\xe4\x04\x0f\xbd\xf9\x0f\xf5\xba\x19\xb9\xba\x30\x2a\x76\xdd\x12\x56\xd1\x8d\x0b\x7f\x78\xab\xf8\xd0\xfd\xe6\xe9\xeb\x5e\x14\x9a\xe0\x49\xd5\x69\x18\x83\xa9\x59\x5a\x2a\x8d\x36\x8b\x50\x25\xb9\x0c\x8e\xd2\x11\x96\x0b\x2d\xaf\x8d\x42\x9d\x00\xda\xb3\x4b\x6c\xcb\x4f\xe4\xc3\xe9\x64\xe1\x0f\x75\xca\x9c\x64\x66\x12\xa4\x79\x2a\xd6\x48\x63\x12\x44\x85\xbf\x93\x3e\x07\x85\x37\xca\x2e\x69\x1d\xe8\x1a\xba\x3b\xfa\xe2\x06\x82\x57\x2f\xe9\x59\xe1\xbe\xd3\xf1\xc7\x02\x6e\x71\xfc\x69\x21\x4b\x0e\x2a\x0a\x49\x65\xc7\x2a\xe1\x0c\x25\xec\x46\xde\x14\xac\x5d\x6c\xf1\xef\x64\xfa\x50\x40\x01\x2a\x12\x03\x2d\xdc\xdd\x26\xe3\xf1\xbd\x81\x57\xf8\x21\x31\x2a\xa6\xb1\xbc\x9d\xdc\xd3\xa2\x68\xaa\xf0\x9c\xbf\x42\x43\xfa\x04\x3c\x39\x74\x23\x35\xae\xfc\x18\x91\x41\xa2\x9d\x79\x42\x04\x4e\x19\xe2\x3f\x60\x74\xe6\x77\x51\x67\x0e\x53\xbb\xdb\x25\x69\x68\x9f\xe0\x95\x06\xd9\x24\xd4\xcf\x87\x4a\x8e\x2e\x97\xde\x55\x4a\x97\xdb\xbd\x87\x94\xe2\xad\x03\xaf\x4e\x1b\x83\xa2\xc8\x35\xf1\x5f\xf7\x49\xbc\x13\x55\x43\xe2\x52\xd3\x86\x36\x57\xda\x3e\x5e\xd6\xf3\xa6\x5f\x1d\x11\x66\xc7\xe9\xd2\x90\xdb\x46\x6b\x4d\xa6\xf5\x05\xae\x0f\x44\xa0\xcd\x21\x5a\x97\xfb\xb0\xbc\xf0\x65\xb9\x1c\x53\xf6\x71\x32\x98\x3f\x0c\x5f\xbf\x7c\xcb\x05\x16\xe9\xb1\xa1\x72\x69\xb9\xe0\x6b\x6a\x44\x32\xcb\x2f\x92\x61\xbf\x5a\x2e\x16\x98\x9a\xd0\x7b\xa0\x84\x12\x16\xe2\xc2\x81\x3f\x3c\x0a\x79\x6e\x9f\xc2\xd3\xa6\xca\xd2\x72\xcc\x59\xd4\x5c\x4a\x1a\xc0\xc1\xc4\x7a\x39\xd1\x88\x41\xa0\x5c\x24\x20\x24\xcf\x5f\xda\xa2\xad\x34\x10\x3a\xf3\x1a\xe1\x23\xe9\x08\x6f\x22\x58\xc7\x8f\xd1\x54\x0b\x22\x09\x60\x80\x52\x87\x52\x32\x89\xfc\xbe\x75\x96\x56\xed\xae\x0f\xca\x4f\x89\x23\x0c\x62\xe7\xf2\x93\xda\xb8\xe2\xd2\xdb\xb9\x9f\x28\xbe\xd9\x24\x2e\xe4\xd5\x77\x6b\x40\x17\x8e\x09\xaa\x3a\xe2\x1d\xaa\xd6\xdd\xa2\x27\x3e\x39\x34\xb7\xc2\xa4\xbb\x26\xe9\x5d\x22\x7b\x75\xcb\x95\x4b\x8e\x1d\xe3\xcb\x2d\xae\x61\x62\xdd\xd9\xd8\x78\xe0\x6d\x81\x5a\x34\x63\x5d\xc3\x49\x36\x54\x69\x12\xac\xb2\xde\x0e\xe8\x3d\x68\xf0\x96\x80\x7b\x8c\x80\x17\x9c\xbb\xa3\xe8\xef\x0f\x9b\x3e\x1a\x69\xbc\xaa\x90\x60\x31\x6f\x69\x5d\x58\x9b\x93\xdc\x27\x91\xcd\xa0\x7b\xec\x85\xd8\xff\x60\xe9\x04\x90\x05\x70\xc2\x4f\x99\xf0\x8c\x04\xad\x8a\x13\xd1\xa0\x9a\xfa\x97\x92\x6a\x91\xf2\x0f\xaf\xdc\xae\x3f\xc0\xc9\xd8\x17\x50\x0d\xc7\x6b\xef\x88\xb8\x2f\x44\xbd\x5a\x88\x0d\xf9\x05\x3e\xc2\x1e\xc2\x5d\xdf\x23\xcc\x7a\x9b\xcd\xc5\x9c\x2b\x99\xc1\xdd\xf2\xc1\x11\x98\xd3\x57\x91\xf5\x55\x41\x99\xe4\x67\xc7\x74\xae\x1e\x6d\xc8\x24\xe4\xfe\x97\x26\x66\xd1\x6f\x7c\x38\x64\x71\x6b\x9f\xe1\xb8\x33\xd2\xbd\x81\x2e\x42\xf0\xa4\xd3\x89\xfe\xa5\x72\xa0\xf7\xe8\xa3\xf1\x50\x7c\x75\xfb\xb9\x77\xee\xbb\x81\xfb\x16\xfa\x18\x35\x52\x78\x64\x07\x89\x7e\x65\xa8\x48\x4a\x22\x05\xfd\x0c\x1b\xee\x9a\x47\x97\x21\xcb\xd7\x2e\x46\x31\xa4\x32\x27\xd0\x11\x30\xd5\xa3\x05\xe6\xc2\x85\x78\xee\x28\x86\xa1\x87\xba\xfb\x30\x51\xfc\xc3\x76\xb8\xb7\x52\xc4\x71\x81\x8e\x6b\x31\x15\x14\xf9\x02\x46\x72\x1b\x3e\xe3\x4d\xb1\xc1\x6b\x1c\xfa\x76\x01\xf5\x76\xe5\x73\xbc\xcd\x22\x1b\xb4\xd6\xe1\x91\x0b\x78\x9d\xb3\xf3\xd8\xb8\xba\xdf\x56\x06\xf0\x8e\x04\x43\xbf\xd1\x29\xb2\x0c\xb0\xfb\x18\x29\xbc\xdb\x41\xac\x3c\x59\xeb\x2f\xcc\xda\x07\x8b\x77\x6a\xcd\x53\x15\x30\xc7\x80\xa4\x75\x66\x95\x38\x3d\x04\xfd\xc3\x61\xb4\x15\x7d\x2d\xb2\xf2\x60\xed\x6c\x1a\x66\x1d\x3b\x90\x2d\x09\x84\xb6\xc6\x28\xae\x22\x80\x68\x2a\x21\xa5\x4e\x12\x61\xdd\xef\xf3\x2e\xff\xe0\xbd\x8b\x5c\x43\xbe\x49\x36\xfd\xc3\xa4\x4e\x8d\x8e\x5f\xbc\x01\x2f\x50\x63\x6c\x06\x77\x13\x9e\xd4\xc8\xe1\xb2\xc1\x4f\x94\x60\x99\x89\xc5\x25\xcb\x96\x6c\x32\xb1\xeb\xeb\xaf\x79\x37\x59\x0a\xb7\x03\x47\x2f\x11\xf2\x9b\x85\x55\xc8\x2e\x1a\x73\x88\xe4\x0f\x02\x69\xf0\xb2\x00\x26\x46\xf9\x83\x38\x41\x91\x7e\x41\x84\x8b\x80\x2b\x80\xe1\x92\x17\x19\xe7\x86\xef\x3c\x32\x38\xc3\xfd\xf9\x84\x4f\x73\xf7\x85\x64\xa6\x14\x0a\xef\xc8\x97\xed\x74\x7f\x5c\x87\xe9\x6b\x51\xe6\xb7\xb1\x7d\x3b\xee\xf0\x06\xb7\xcd\xe7\xbb\x2d\xcc\x59\x6e\xac\xa2\x3e\xd0\x76\xdd\x3e\x1f\x19\x9b\xe7\xc7\x5f\xfd\x96\x58\x4d\xcf\x25\x27\x7b\xfb\x47\x25\xe7\x96\x6b\xc0\xa7\xe5\xdb\xf3\xd0\x79\x27\xf3\x34\x2d\x90\x26\xdf\xde\x2a\xdc\xdc\x2e\xfb\x0f\x0f\x7d\x48\xee\x08\xb4\xbc\x07\x8e\x5e\xed\xbf\xe8\xb9\x56\x94\xc3\x3d\x79\x5c\xa2\x73\x3c\x15\x7d\x17\xe9\xd7\x9a\xb6\x29\x81\x0a\x76\xda\xa2\x25\xb6\x8f\xef\xf5\x08\x9d\xef\x3b\x45\xe9\xdc\x3b\x38\x4c\xce\x28\xe9\xb7\xff\x60\xdb\x2b\x4d\x8c\x3e\xda\xde\xd4\xc3\xa7\x4b\x3c\xab\xf7\x3f\xfa\x05\x41\x4a\xfa\x84\x14\x24\xfa\xe9\x22\x31\xe6\x21\x36\x8d\xee\xe8\xca\x73\x08\xff\x5b\xbf\xeb\x6b\xfc\xf5\x93\x34\xa2\x3f\x28\xb7\x14\x06\x6c\xaf\x38\x57\xb0\x70\xd4\xbe\x79\x8c\x68\x12\x64\xe0\x19\x30\x60\xa7\x69\xa0\x9f\x3c\x72\x51\x6f\x92\xf6\x5b\x47\xc1\xb5\xcf\x94\x18\x28\x71\xf1\x0e\xec\xb2\xa4\x81\x9c\x4f\x6e\x3b\x2c\x74\xb5\x83\x36\xc1\xc4\x87\xa4\x69\xe3\x12\xd1\x56\x46\x70\x7d\xb7\xf3\x61\x10\x59\x8d\x77\xbb\x9c\xa4\xd1\xf6\x87\xdd\x6c\x0c\x4a\x7d\x1b\x5f\x52\x4f\x1d\x1a\x7c\xb5\x48\x51\xd7\xe8\xb2\x34\x90\xee\xb0\x64\xff\xfa\x5f\x5e\x3f\x6b\x14\x98\xb4\x39\x18\x3e\xa9\x4e\x47\xba\x7b\x46\x30\xbb\xe9\x82\xdb\xb8\x6e\xed\xa9\x1c\xe8\xb1\xe9\xbe\xf3\x96\xd0\x68\xa6\x88\x22\x1f\xaa\x5c\x0f\xa7\x42\x76\xfb\x75\x7f\xc7\x3d\x59\xb9\xdd\xaf\xbf\xca\xc2\xd5\x85\x29\xa9\xc1\x3e\x0a\xfd\xed\xf7\xd5\xf6\x66\x7c\x04\xef\x59\xec\xa9\x27\xfb\xf1\xc7\xb2\xec\x0d\xb6\xb2\x16\xa2\x4d\x85\x8a\xff\x6a\xb6\x03\x51\x07\x95\x1b\x29\x26\xf1\xfb\x94\xa7\xdf\x07\x6b\xff\x13\xc3\xee\x37\x43\x7a\xe9\xbc\x96\xec\xd1\x73\x53\x79\x08\x82\x50\xcb\x99\xfb\x6b\xcf\x97\x71\x44\xfd\xff\x6f\x99\xab\x85\x12\xcc\xd3\x9b\x40\x73\x96\x6c\xd0\x7a\xce\x4e\x30\xe4\x52\xce\xec\x9b\x74\xc1\xbd\xff\xd3\x43\xfd\x5f\x6f\xab\x67\x9c\xe4\x16\x69\x7d\x86\xd9\x47\xb3\x3f\x2f\x41\xc4\x41\x37\x82\xc2\x84\x5d\xa1\x7b\x05\xc1\x01\xe8\x70\x4b\xbf\xfb\xe3\xfb\xf7\xd5\xfb\xf7\xef\xde\xbf\xff\xd0\xdf\xfc\xcb\xa7\x1f\x7e\xdc\x78\xdf\x7b\xff\xfe\x8f\x77\xff\x9f\x7f\xfb\xf7\xff\xf5\xc5\x97\x83\x07\x7b\xff\xdf\x87\x9e\x59\x64\x72\xe2\x90\xbe\xeb\x74\xfd\x3f\x5b\xaa\x73\x3e\xaf\xf2\x49\xc6\xbd\xdb\x3b\x7f\xf8\xb2\x27\x93\xa5\xa0\x6f\x9e\xa4\x78\x5c\x90\x63\x48\x43\x8d\xac\x8f\x13\xa9\x9e\xad\x9c\xcd\x85\xf8\xe6\xd9\x2f\x8b\xe3\xe2\xb5\x1c\x6e\x2f\x21\x03\x9e\x5a\x01\x44\x86\x78\xb5\x07\x0e\x00\x0c\xfa\x3a\x3b\x5d\x4e\xd3\x12\xb8\x1c\x5c\xdd\x55\x6e\xab\xa2\xc0\xf7\xf0\x5d\xdf\xad\xe8\x3d\x6f\x96\xf7\x92\x8d\x7f\xdf\xb0\x80\x98\x57\x65\x13\xbe\x70\x1f\xfa\x98\x6d\xb1\xa9\xa4\x1f\x1d\xcd\xd1\x88\x0f\x02\xa9\x04\xf9\x90\xff\xf5\x8f\xfe\xe9\x8f\x90\x11\xad\x2c\x45\x1a\x29\xdf\x9c\x2d\xb5\x60\x4f\xca\x62\xb6\x7a\xc1\xbc\x61\xd6\x3e\x0a\xa1\xdf\x97\x80\xdb\xdc\xf4\x88\x6c\xc5\x8a\x6f\xfc\x71\xa3\xb1\xd6\x8e\x38\x2d\x28\x2e\xc2\xf7\xd0\x9f\x93\x70\xe9\xf8\x30\x8e\xb5\x52\xdf\x28\xa7\x91\xd5\x3e\x24\xd0\x3e\x7b\xba\xd7\x98\x1e\x81\x81\x4b\xb4\xb1\x87\xd4\x3d\xdc\x41\xfc\xf2\x07\x8f\x0c\xc3\xdd\x33\x21\xe2\x2c\x0e\x89\xd0\xa0\xf7\x7f\xa0\x81\x19\x99\x08\x07\x77\xd7\x5a\x3a\x99\x50\xf7\xbe\xf9\x71\xad\x4a\x8b\xc5\x74\x8a\xe2\xe8\xbf\x62\xb5\x45\x5d\xe7\x34\xa8\xac\xa8\x2a\x28\xee\x27\x3d\xac\x9d\x88\x8b\xd0\x4b\xa8\x8a\x22\x20\x7f\x92\x5f\x65\x93\xe1\x19\xd7\x84\xc1\xe4\x6f\xcc\x91\xcd\x6b\x98\x62\x94\x5c\xea\xaa\x39\xf9\x90\x8e\x61\xed\x86\x75\x31\x44\xf7\x52\x2a\x7f\x6f\x84\xa3\xde\x1b\x0b\xdf\x94\x0e\xa0\x78\x41\x13\xa7\x8a\x3a\x49\xf4\x8a\xc3\x59\x9a\x50\xcc\xd2\x94\xac\xcb\x6d\xde\x25\xce\xd2\x69\x8b\xb3\xbd\xe2\x14\x5b\x25\x15\x29\xdb\xdd\xd9\x19\xec\xec\xec\x50\x37\x4e\x5b\x82\xad\x54\x11\xba\x5c\xaa\xe2\xdd\xff\xc6\x15\x33\x4c\xa7\x53\x09\x48\x31\x3f\x4d\x8a\x99\xf1\x55\x46\xcf\x40\x32\xa2\x4f\xb8\xb4\x9b\x06\x46\x91\xd0\x69\x75\xce\x8e\x35\xf0\x30\x52\xd8\xb8\x50\x38\x3c\xd8\xde\x74\x60\xa9\x26\xd9\x8c\x32\x3d\x49\x5a\x25\x1c\x85\x69\x30\xc3\x7d\x96\x4c\x9a\x7a\x1d\x30\x57\xad\x97\x3f\xd4\xec\x15\xd7\x6d\xac\xf2\x53\x24\x27\x93\x3c\x89\xf7\x44\xf2\x59\x06\xbb\x01\xc4\x82\x68\x5f\x16\xe5\x79\x35\x40\x70\x19\xe6\xb4\x22\x97\x24\x74\x1e\x46\x47\x47\x17\x91\xa9\x76\x97\x0b\x3d\x30\x8a\x98\x22\xc5\xcf\xec\xfe\xa2\xa8\x4d\xee\x1c\xb4\x72\xef\xee\xc2\xc3\x07\x29\xd3\x0d\x6b\x73\xcb\xe0\xc8\xce\x51\x38\x1c\x98\xf2\x9a\x46\xc6\x56\x43\x26\xe8\x85\x6c\x9d\x55\xe1\x79\x75\x92\x8f\x97\x53\xba\x47\x81\x5e\x99\xb0\x90\x4c\xa5\xe0\x9b\x14\xd9\xc4\x25\x22\xc7\x7c\xb4\xf7\xc2\xf1\xa3\xf0\x79\x7c\xa0\x82\x2c\x51\x4c\x8b\x53\x71\xd9\xa7\x0a\x88\x6a\x68\xa4\xd0\x4a\x27\xb2\xd2\x9b\x2c\xde\x5b\xce\x8c\x5a\xc5\x8b\x14\x62\x7d\xc2\x39\x6a\x0e\xa4\x48\xe1\x96\xdd\x46\x2e\x85\x59\x99\x20\x3f\x3a\xf4\x7f\x5e\xe6\xe3\x73\xf4\x0e\xad\x10\x67\xf1\xc6\x2c\x31\xae\xce\xd4\x59\x4c\xf8\x44\x2a\x3a\x71\x67\x73\x5c\x35\x5e\x23\x0a\xe5\x4f\xde\x91\xd9\xb7\xe9\xe8\xc6\xe9\x82\x42\x47\x61\xe9\x39\x67\x9d\xad\x45\x9a\x5a\x0f\xd1\x32\x95\x90\x3f\x4e\x7e\xcd\x27\x24\xf0\xdc\x34\x47\xc3\x7f\xc8\x9a\x01\xf9\xb1\xd2\x56\x49\x9f\x1e\x09\x9b\xee\x1e\x50\x1d\x25\x93\xa1\xf9\xd3\x08\x8c\x47\x6f\xf7\x7f\xf2\x5d\x4b\xb9\xc0\xd8\x72\x0e\x34\x6e\xd3\xf5\x70\xdc\x3f\xe7\x0a\x13\xff\x13\xd3\x5c\x4a\x7b\x05\x45\xbc\x76\x41\x58\xda\x75\x35\xe0\x30\xd7\x1b\xe9\x39\x28\x9b\x30\xf2\x3c\x37\x9c\x00\x27\x67\x1b\x8b\xf7\x72\xca\x18\xdb\xf2\x6b\x72\xad\xb9\x77\x9c\x1a\xd0\xd5\x6a\xb4\x0f\x3d\xb5\x10\x14\xe0\x3f\x4b\x17\x92\xac\x98\x0b\x58\x3e\xfc\xd1\xa6\xa0\xf1\x4a\x9d\x1a\x2b\xfd\x04\x76\x8a\x92\xb0\x99\x93\x6c\xc2\xe9\x24\xff\x44\x99\x61\x8b\x8f\xfd\x4d\xf2\xdc\x87\xf3\xf4\x42\x4c\xeb\xec\x93\x48\x85\xba\xc3\xc6\xdc\xf4\x8e\x73\xe0\x91\xc8\x02\xc4\xe2\x00\x73\x37\x84\xf5\xe6\x6e\x88\x36\xa6\x9a\x69\xe0\x6d\x63\x0a\x6d\x8c\x5e\x80\xba\xc1\xc7\xfc\x1e\x22\xf4\x97\x4f\x06\x1d\x72\xf9\x99\x2c\x29\x46\x80\xf9\x18\x31\xbe\x5a\x7c\xa2\x6b\x3c\x04\xc6\x2f\x53\x6a\x17\xa2\xfb\x65\xc2\x85\x39\x73\x29\x4e\x0a\xd4\x61\xc7\xc4\x28\x5c\x7e\xb2\x93\x2c\xd4\xc8\x30\xef\x7e\xe7\x9a\x6a\x8d\x82\x7c\xe5\x32\x33\x89\x0f\x61\x8c\x52\x65\x37\x48\xa7\x36\xe3\xb5\xb0\x72\xce\x48\x36\x97\xc0\x10\x4e\x35\x2d\xd9\x2a\xc4\x8f\x1b\x79\x03\x1e\x61\xe7\x5e\x9a\x9c\x15\xe8\x94\x84\x8f\xa4\x0a\xe6\xc9\x0c\x19\x96\xef\xd4\xcc\xdc\x5c\x17\xa6\xd4\x38\xc3\x43\xd1\x79\xb9\x90\xaa\xed\x14\xb4\x83\x34\x49\xd9\xef\x9d\x90\xd5\x20\xea\xc3\x39\x0d\xfe\xd1\x66\xcc\xb9\x63\xe3\x4a\x6d\x41\x0c\x76\xbe\x64\x6e\xe9\x78\x24\xfe\x22\x79\x32\x4b\x2c\x7c\x39\x5c\x14\x8b\xe5\x94\x2a\xc7\xf3\x7e\x31\x24\x4a\x6d\x49\x1b\xc7\xcb\x49\x71\x21\x6e\xa5\x5f\x63\xf1\x46\x29\x79\xe6\x15\xa7\x94\xcd\x86\x45\xc9\xa6\xc9\x02\xe4\x99\x29\xba\xd1\xd6\x69\x32\x83\x3b\x23\xc7\x1c\x1f\xa5\x84\x68\xc1\x15\x5b\x65\xdb\xc0\xd3\xf8\x13\x83\xa8\x1d\x88\x6a\x91\xd1\xdd\x27\x2b\xc9\x10\x79\x29\xb7\xb0\x30\x29\x8a\x95\xf5\x62\x6f\x7b\xfb\xb4\x28\xb6\x4e\xa7\xdb\xd5\x1f\xb2\xe9\xfc\xcf\x76\xa5\x08\xc8\x5b\xec\xf4\xdc\x8e\x8c\xd8\xee\x32\xb6\xa6\x02\xa8\x26\x0b\x5a\x39\x19\x9d\x08\x71\xa2\xf0\xa1\xdb\x1f\x29\xe4\x8c\xce\x90\x49\x18\xc6\xa6\x0b\x5d\x11\x34\xaf\x8e\xe4\xe2\x66\xa1\x3e\xdc\x9f\x31\x96\xc9\x5e\x4e\x6d\xa4\x79\x42\xa5\x68\x0b\x2e\x8a\x5c\x4c\x99\x94\x32\x13\xe1\x90\x9a\x11\x08\xf6\x15\xfc\x71\x50\x55\xaf\xa1\xbb\x4f\xdf\x66\x3a\xfb\xc9\xe9\x12\x93\x89\x07\x31\x15\xa6\x70\x6e\x69\x8a\x30\x93\xa4\x89\x14\xce\xa7\x8c\x77\x57\x4d\x42\x3a\x1e\x99\x7e\x74\xe6\x5e\x5d\xe1\xfa\x7d\xeb\x8f\x08\x4b\x5c\x9f\x99\xbc\x5d\x75\x39\x1d\x5e\x24\xe7\x20\x63\xf9\xd5\xae\xe5\xac\x61\x0e\x94\x2c\x1c\x09\xfa\xbc\x79\x85\x3f\x24\x3a\x1b\x32\x47\xa3\xe4\x17\x8d\x73\x6e\x0a\x92\x86\xe7\xfb\x00\x97\x7c\x6c\x74\xc7\x29\x59\x58\x6c\xf9\xff\x33\x90\xcd\xa6\xba\x0c\x2a\x7f\x5f\x29\xa6\x45\xdf\xbb\xea\xfa\xc1\x0f\x8f\x0f\x1f\xfd\xf2\xd3\x47\x87\xe1\x27\x2b\xc8\xc3\x25\x79\x75\xed\xa2\xb5\x39\x35\x4c\x23\xff\xec\xe5\x59\x0e\xec\x97\x18\x1d\x16\x00\x9e\x60\xb9\x6a\x32\x34\x5d\xa6\xd3\x73\x8a\xed\x62\x99\x16\x2f\x3f\x12\xac\x4c\x0a\x44\x67\x48\x32\x32\x00\xa7\x54\x29\x28\x9c\xcf\x00\xc6\x54\xa4\xe2\x9c\x19\x4a\x23\xe1\xbd\xf7\x49\x88\x81\xe4\x06\xa4\x47\xb6\xcd\x37\x0b\x48\xeb\x52\xc5\x4d\x91\x63\x2b\xae\x27\xb5\xbf\xab\x44\xf2\xee\x4b\x0a\xc5\xb3\x7f\x05\x07\x51\x78\x53\x58\x97\xb5\x8e\x89\xc7\x4c\x43\xa6\x23\xe6\x42\x02\x29\x6d\x94\xe9\x8c\x7a\x25\xd5\x99\xbf\xb6\x95\x69\x58\x8e\x95\x76\xbe\xbc\x0b\xb3\x3c\xc3\x84\xfa\x08\x4d\xf6\xf1\x04\xa8\x4c\x9e\x34\x98\x96\xc9\x5e\xaa\xf8\x9a\x5c\xc2\xc2\xce\x6b\x89\x35\x1d\xa1\x26\xa9\xaa\x86\x98\x36\x77\x58\x94\x43\x60\xff\xe9\x74\x88\x29\x62\x11\x1a\xbf\xb2\x18\x79\x60\xf4\xaf\x0d\xb3\xe0\x5f\xe1\x55\x45\x4f\x20\x0c\x30\xc0\xa9\xe7\x95\xab\xa3\x43\x0f\xa4\x4a\x14\xba\x12\xf6\xf0\x9a\x4a\x22\x3f\xf5\x04\x07\x86\xa4\xe8\xad\x6c\x0a\xf3\x26\x5d\x6f\x04\x2a\x9e\xa0\xe0\x40\xba\x9f\x23\xfc\xa5\x65\x97\x74\x6a\xa7\x7f\xc8\x3d\x3a\xa5\xc7\x61\xb9\xc6\x36\x99\xe9\xff\xe3\x6f\x14\x0f\x14\xdf\x26\xb9\xd5\x2c\x84\xbb\x0f\x3d\xfa\x53\x97\x15\xdd\x8e\x64\x14\xec\x02\xd4\x40\x95\x62\x15\xd3\x64\x51\xe4\x28\x63\xa8\xd4\xd1\x52\xee\xa3\x31\xce\x81\x9d\x5b\xa4\xfa\x0f\x67\x7a\x46\xdf\xe4\x8a\x36\xc2\xbc\x01\x4c\xfd\x73\x95\xb1\xd8\x95\xb8\x72\x2f\x05\xdc\x3f\x04\x93\x1b\x07\xf5\x74\x3c\xa6\x5a\xd4\xa7\x5c\x72\x62\x92\x2d\xea\xb3\x21\xff\xc4\xba\x51\xc3\x25\x8d\x71\xd5\x79\xbb\xce\x5d\xc4\x35\x5a\xc0\xcb\x8c\x2a\xd7\x38\x17\xd8\x2e\x56\xa8\x8c\x49\xc8\xc1\x9f\xd8\xcc\xfc\x9a\x47\x92\x12\x8e\x99\xee\x80\xc7\xd8\x2f\xaf\x1b\x81\x75\xdc\x20\x4c\xee\xdf\xe2\x3f\x6b\xa0\x6c\x51\x5d\xac\x97\x27\xd2\xe0\xae\xd3\xfc\x07\x9e\xb1\xb6\x27\x59\xda\x1b\x7e\x01\x9b\x5e\x0c\x04\x85\xc3\xd1\x2e\xfa\x93\x12\x2b\xb9\x9d\x82\xb1\x7a\x93\x1b\xcc\xc5\xa6\xd5\xe1\xaa\x78\x02\xfc\x53\x62\x80\xb4\x1f\x6f\x2c\x95\x66\x9b\x39\xfc\x08\x04\xd3\xb3\xb2\x98\xe3\x53\x92\x74\x0f\xe6\x86\x25\x01\x5a\xc9\x3c\x48\x1d\x9a\x19\x39\x65\x0e\x3d\x2f\x60\xa3\x87\x97\xc0\x69\x2a\x0b\x8f\x52\x47\x0d\x2c\x65\x05\x27\xd3\x65\xde\xe6\x20\x4e\x1e\x76\x40\x3a\x16\xec\x52\xd0\x11\x40\x88\x69\x79\x43\x5a\x41\x14\x92\x68\x5a\x62\xc0\xe1\x44\x16\x5f\x8b\x90\xa8\x30\x6b\x88\x18\xa8\x90\x9b\x17\x84\x01\x15\xd8\x21\x29\x1c\x85\x03\x3e\x48\x28\x22\xc8\xe9\x40\x95\x97\x11\xb6\x8d\x38\x65\xf2\xae\x99\x6c\x02\x27\xf9\xa9\xcd\x86\x04\x72\x06\x3f\x7e\xd4\x0b\xc8\xe6\x2d\xf4\xca\xfe\xe0\xd3\x86\x1f\x77\x56\x39\xb5\xc1\x9c\x7b\xc3\x66\x9c\x31\x52\x8a\x03\xc1\x2d\x88\xb0\xfa\x9b\x2e\x47\xfe\x89\xbe\x8a\xb8\xcd\x6b\x0c\x6d\xf0\x7f\x16\x7f\x3f\xa5\x90\xa6\x96\x2e\x4c\xc6\x35\xb5\x06\xf4\xb0\xb1\xce\x1c\x45\xcd\x2d\x6b\xa5\x3b\xc6\x1f\x55\xec\xd7\x1e\x18\x6a\x16\x0c\x99\x29\x8b\x7d\xd0\xd2\x8d\xe7\x12\x02\xdd\x68\x4d\x09\x4a\xd7\x92\x52\x83\xee\x15\x8d\x4c\x2d\xbe\xa0\xb1\xc9\xb5\xad\x67\x30\xbd\x70\x39\x63\xbb\x18\x5b\xcf\xe8\x1e\xc6\x17\x34\xdc\x41\x5b\x9c\x44\x2b\x80\x42\x39\x14\x4d\x7c\x26\x6a\x0b\xde\x3e\x58\x75\xde\x6a\x83\x94\x4a\xac\x21\x0a\xc5\x6f\xde\x8e\xbb\x34\x7a\xfd\x39\xd7\x01\x34\xd7\xb8\xa9\xa8\x56\x7e\x2e\x67\xf5\x43\xd4\x42\x6f\x97\xb5\x63\x11\x9d\xa7\xbb\x34\xc5\x88\xc3\x7e\xcf\x48\x4d\x64\x24\xb0\x3f\x5a\x97\x46\x0d\xd9\x7e\x6e\xc4\x5d\xdc\x71\xfe\xf7\xd2\x3f\x5e\x45\xe7\x28\x10\xe7\x58\x32\xaa\x8d\x16\x97\x52\xaf\x98\x67\x0e\x55\xd7\xb9\xd3\x34\xf9\xc5\xe6\x67\x7d\xc5\xe2\xe9\x56\xd8\x7a\xc7\xd4\xde\x4e\xd9\xb2\x40\xb6\x61\x64\x7d\xcc\x6f\x76\x79\x14\x54\xf3\xb1\x75\x71\x6c\xe7\x55\x6b\x43\x0d\x7f\xdb\xd2\xd8\x89\xad\x58\x19\x2a\x15\x60\xb7\xd5\x4a\xd0\x3f\xb8\xd9\x98\xef\x7c\x82\x10\xce\x42\x04\xa8\xa2\x35\x23\xa0\x7e\x6c\x07\xa5\x79\x54\x08\x29\x32\x15\x4a\xa8\x11\xd9\x7c\x2d\x08\xc5\xd9\x02\xc6\x97\xc7\x38\x94\x13\x73\x82\x59\x91\x98\xe2\xfb\xfa\xf9\xc8\x5a\x39\x26\x4c\x91\x7d\xec\xc9\xc9\xc4\x3f\x58\x86\xcd\xf0\xcd\x9f\xfb\xa9\x26\xe4\xed\x52\x61\xa6\x53\xe7\xb7\x98\x52\x62\x1f\x82\x46\xbb\xae\x6a\xa9\xb8\xf4\x55\xc4\xf1\x85\x6d\xc6\x44\x33\x4b\x1d\x76\x4b\x06\xc9\xbb\xd8\xea\x0d\x62\x54\xf3\x61\x53\x89\x88\x77\xed\x58\x46\xa4\xe3\x8a\x32\xa8\x54\x3f\x64\xda\xfd\x05\x04\xb8\x05\x3f\x87\x88\x9a\x49\xa8\x22\xd5\xaf\x85\xdd\xd3\x20\x15\xf6\xdd\x7b\x7a\xdb\x9d\xd1\x29\x4d\x7c\xb6\x1c\x21\xd1\xbb\x0f\x9b\x34\xca\x22\xa7\x91\x39\x8f\x51\x12\x85\x67\x44\x7e\x61\x0a\x95\xc0\xe9\x6c\x88\x76\x71\x81\x4f\x27\xd6\xa0\xfc\xa4\x99\x16\xf5\x00\xa4\xd2\x94\x88\xbe\x0b\xfe\xe3\xee\xa0\xfc\xa4\x04\x72\x91\xaf\xa3\xf1\xc6\x52\x89\xb7\xdf\xe3\xa6\xaa\x20\xa9\xf4\x95\x7c\xa7\xe3\xaa\x12\x2f\x17\x43\x1e\xbd\x11\x65\x27\xda\x4b\x76\x1e\x38\x8e\xd2\x63\xe5\xe3\x1e\x5a\x77\xff\x97\xfe\xde\xf8\x66\xee\x25\xe9\x08\x38\xd7\xb2\xce\xf4\xaf\xa4\x58\xe4\x4e\x2e\x5b\xb7\x29\xcc\xc4\x88\x24\x55\x39\x46\xd9\xf2\xdf\x90\xb0\x9f\x3c\xc1\xb4\x2c\xb5\xc9\x28\x6f\xb5\xe8\x3c\x87\x8a\xfb\x4f\x8b\x74\xc2\x3a\x5f\xa4\xf8\xac\xe2\x8e\x18\x6f\xaf\xaa\xf1\x1a\x3d\x99\x84\x96\xba\xf1\x4c\xe8\x7d\x6f\x56\xfc\xf7\x53\x2c\xf5\xca\xf6\x81\x3f\x10\x2f\xbf\x84\x03\x83\xcc\x18\x87\x11\xf9\x2a\x45\xd8\xf4\xd0\x67\x7b\x69\x7d\x7d\x87\xc9\x5d\x2f\x65\x89\xa2\x7a\xef\xdf\xd8\xb1\x08\xb7\x44\x87\x71\xeb\xa6\x9b\x8d\x3d\xdc\x12\x2c\xdf\xd2\xd0\x68\x8b\x3b\xc4\xa9\x3d\x83\x47\x6f\x46\xc9\x1a\x58\x19\xdb\xbb\xa9\x27\x18\xab\x2e\xe7\xaf\xa9\xf7\xc7\xad\x11\x80\x67\x9b\x96\xab\x5d\x03\x62\xbe\xe1\x14\x5a\x81\x1a\xc3\xce\x50\x17\x52\x11\xb4\xdd\x1a\x15\x93\xeb\x76\x0a\x9a\xa5\xe5\x69\x0e\x24\xb1\xb3\xb8\xf2\x68\x85\xcd\xc0\x8d\xef\xdb\x68\x4b\x51\x8f\xfe\xda\xf8\x29\xef\x25\x67\xf9\x64\x92\xcd\xf5\x6f\xc3\xcb\x6c\x74\x9e\xd7\x43\x34\xe6\x0c\x99\x89\xec\xd1\xfb\xdd\x6b\x04\x5b\x1f\x6b\xb1\xa9\xbc\x1b\xd1\x15\xe4\x21\x4d\x35\x38\x4f\xf4\x13\x1f\x27\x97\x65\x58\xe5\xbe\x20\xeb\x72\xf2\x97\x4f\x3d\xb3\x54\x68\xe4\xf6\xe8\x81\xba\x29\x42\x08\xf4\xf7\xd8\x87\x9a\x1c\x9d\x65\x59\x5d\xbd\xdb\xf9\x80\x4b\x8c\xbf\x56\x54\x07\x3c\xd2\x4b\x76\xc2\x58\xa6\x01\x8b\xd1\xb4\x18\x9f\xf7\xdc\x18\x38\x5b\x68\xfd\x2c\x9f\x9f\x7f\x8c\xcf\x0b\x58\xe1\xb9\xe2\x12\xba\x43\x50\xe6\xb3\xcc\xa6\xe8\xc2\x42\x63\x56\x88\xa3\x3b\xda\xc7\x2f\x1f\xbf\xec\xe3\xde\x4f\xd2\xcd\xbd\xe4\xa8\x28\xcb\x6b\x4e\xc3\x03\xcd\xe9\x98\x7d\xec\xc9\xd5\x66\xaf\x3c\x74\xe4\x3e\xa5\x62\xb3\xca\x01\x97\xa1\x51\x4a\x15\x71\x38\xf8\x53\x85\xca\x33\x9b\xcd\x6f\x91\x8f\xcf\xe1\x68\x8e\x32\xca\xa0\x4f\x76\x7d\xd4\xb6\x3b\x45\xcd\x8c\x94\x3c\x17\x05\xd6\xcb\x36\xcf\x5a\xd4\xa4\xe5\x95\x67\x3a\x63\xa4\xe2\x2b\x72\x35\xe4\x9f\xd5\xaa\x48\xfb\x70\x41\x40\x62\xc3\x15\x41\x4a\x18\x15\x57\x2b\xdb\xd7\xe9\x88\x74\x32\xd8\x67\xb8\x1b\x6b\xde\x76\xb0\x64\x87\xf7\x12\xda\x5f\x4d\xd3\x27\x40\x81\xc3\x93\x74\x96\x4f\xe1\xd7\x59\x31\x2f\x28\x77\x4b\xa3\x05\x32\x03\x38\x51\xdf\xac\x77\x00\xcd\x49\x1b\x02\x4c\x7e\x28\x3d\xb0\x51\x02\xc3\xab\xd8\xf9\xa3\x8c\x8a\x43\x1a\x7b\x0f\x2d\xc6\xeb\x1c\xe7\x65\x8d\xd7\x30\x1f\xc2\xe4\x6e\x3e\x43\xa3\x5a\x3a\x37\x54\x65\xb9\x4d\x83\xa5\xca\x6a\xe9\xa7\x99\xac\x5f\x93\x89\x32\xf6\xbd\x81\x61\x8b\x7c\x17\x07\x6c\x71\x25\x14\x32\x3a\x92\xcd\x31\x84\x44\x36\xc5\x1b\x82\x33\x0b\xf0\xf8\xe5\xf3\xe7\x08\xf8\x28\x8a\xe3\x6d\x20\xf7\xd0\xe3\xc8\x01\x42\x4f\xba\x9b\x42\x20\xab\x9c\x03\x41\xb6\xb8\xe6\x2d\xe2\x36\xa7\x01\xe0\x3c\xbb\xc6\x18\x1c\x07\xe2\x11\xb4\xfb\x39\xbb\x7e\x0c\x5f\x36\x01\x29\x1b\x3a\x65\xb9\xc4\xb4\x85\x2e\x21\xa5\x31\xa4\xb1\x81\xb2\x94\x92\x48\xc6\x41\x85\x94\x94\x2d\x67\x18\xee\x62\x75\xbe\x6c\xe3\xdb\x9c\x30\x27\xe9\x10\x1a\xbf\xe9\x46\xa2\x82\xed\x9d\x37\x12\xb7\x88\xec\x54\x78\x0a\xec\x9c\xdc\x42\xda\x2c\x9f\x26\xed\x3b\x06\x06\xb1\xcd\x95\x7c\x18\xc4\x05\x83\x59\xe2\xe2\x9a\x65\x29\x67\x06\x2d\x16\xfc\xec\x7c\x94\x9e\xb6\x73\x46\x6a\x31\x1c\xa5\xa7\x0a\x47\xaf\xe7\x6d\x96\xb8\x6b\x1d\x9b\x9c\x45\x1d\xfc\x51\x51\xd7\xc5\xcc\x43\x3b\x82\x91\x2b\xe2\xa7\xaa\xb0\x90\x3d\x61\x64\xf2\x2b\x42\x07\xa0\xb6\x29\x97\x9b\x1b\x65\x53\x31\xeb\x33\x7c\xf9\xa5\xcc\x04\x3d\xf6\x46\x24\xd7\xc1\x3b\x52\x8e\x02\x6b\x61\x48\x62\x1b\x5a\x79\x72\xdf\x22\x15\x5d\xea\xd7\x59\x50\x0f\x42\x7c\xef\x91\x8f\x23\xeb\xa8\xa7\xd7\x0c\xcc\xf3\xf4\x33\xb8\x61\x65\x72\xc6\x45\xc0\x58\xaf\x46\x63\x5f\x31\xf3\x7e\x02\xc3\xb7\x6e\x1f\x4e\xc4\xdf\x38\x6a\xde\xd8\xb3\xc6\x5e\x45\x8e\x52\x83\x22\x0d\xb4\xc6\xfe\x18\x94\xfc\x31\xbd\x5d\x59\x0d\x5d\x81\xf2\x59\x07\xef\x09\xbd\xc7\xd0\xd2\xb3\x44\xef\x1a\xc3\x38\xa8\xec\x3c\x96\xb8\xe1\x64\xbf\xec\x64\xe1\xea\x98\xcc\x2b\x10\x6e\xd1\x19\x86\xc1\xa1\x2b\xa4\x75\xe8\x93\xe7\xf9\x68\x79\x72\x82\xb9\x5b\x69\xd5\xaf\x39\x97\x9c\xac\x3d\x19\x28\x7b\x15\xd5\xf1\x61\x17\x91\x2a\xb1\x5e\x53\xce\xc9\x02\xe5\x11\x98\x0c\xe6\x41\x64\x90\x4e\xc0\xe0\x8a\x28\x39\xe7\xf9\x8c\x95\xfb\xc2\x87\xd0\x9d\xc0\x17\x06\x61\xa2\x01\xb5\x20\x67\x67\xa7\x89\xe7\xf4\xb0\xa8\xe1\xe8\x11\x82\xf0\xc8\xad\xaf\xcd\x89\xea\x21\x1a\xe7\x59\xc6\x79\x65\x47\x38\x43\xe4\xaf\x54\x8d\x87\x72\xdd\xa9\x54\xc9\x0c\x2e\xb7\x3e\x4f\x8e\x62\xd9\x61\x94\x3d\xa6\x7a\xe4\xcd\xc4\xbf\x55\xbd\x64\xb9\xc0\xe4\x9e\x55\xd2\xa7\xaf\x89\x97\x17\xec\xcb\x22\xeb\xe1\xdc\x62\xc5\xa9\x26\xd5\xc2\x60\x3e\xcb\x36\x31\x5f\x1e\xbb\x8e\x12\x31\x0c\x82\xc1\x4f\xb3\x5a\x1e\x82\x52\x78\x1b\xd6\x7d\x7c\xae\x45\x3a\x80\xba\x0f\x14\xbf\xd6\x95\xa0\x9a\x37\xa9\x3f\xb2\x7e\xab\x19\xb2\x82\xe8\x13\x68\x75\x71\x6a\x23\x82\x8d\x32\x3f\xe2\xf8\x66\x36\x05\x9a\xfc\x77\x51\xcc\xac\x01\x1c\x6d\xab\x23\xe3\x8b\xc7\x95\x1e\x4c\x45\xb5\x25\x8a\xce\xe8\x68\x66\x9e\x71\xec\x21\x69\xdc\x75\x52\xae\x47\x32\xb2\x3e\xac\x5b\x31\x69\x9d\xcd\xf1\xce\x0f\x9c\xe4\x71\x10\xb8\x2b\xa3\x6a\x9c\x9b\x17\x3b\xf9\x5c\xa3\x1e\x52\xc0\x19\x8e\x25\x33\x31\x13\x40\xec\x93\x29\x5c\x2e\x53\xce\x80\x28\xfe\x3e\x64\x73\x32\xce\x6d\x56\x84\x27\xdd\x81\x27\x9a\x5f\x38\x36\x8e\x2a\x90\x2e\x2d\xc7\x8b\x23\x7b\xb9\x88\xfb\xd7\xe5\xe5\xe5\xd6\xe5\x57\x5b\x45\x79\xba\x7d\x7f\x67\x67\x67\x1b\xa0\xd1\x9b\xe5\x42\xdf\x57\x38\x44\x20\x9a\x5f\xcd\xa6\xf3\x8a\x1d\xf4\x5b\xe1\x74\x02\x40\x3f\x21\x98\x06\x82\xd8\xdd\xda\x6d\xb4\x6d\xbb\x13\xbb\xd5\x28\xc0\x2b\x03\x75\x0c\x46\xf1\x04\x5f\x45\x88\x15\xe9\xef\x8e\xcd\x8a\x8e\xfe\x18\xac\x46\x36\xda\x2a\x43\x8d\x7f\x62\xda\xa2\x02\x64\x29\x3b\x64\x25\x67\x44\xd8\x95\x2a\xbd\xc4\x90\xc6\xe9\xa2\x5e\x4a\x21\x5e\x6a\x39\x71\x19\xab\x4f\x38\xb5\x2f\xf2\x0c\x09\xd0\x84\xbd\x46\xa9\xfe\xf2\xac\xa0\x2a\xdb\x4e\x6e\xa3\xae\xc7\xe8\xe8\x5d\xb7\x9c\x53\x84\x8a\x2e\xf7\x6a\x0d\x75\xa7\x75\xdf\x54\x7e\x9f\xe8\xfa\x77\xad\xbe\x7b\x1b\xa9\x27\x93\x7d\xca\xe8\xef\x64\x4b\xe0\x2b\xab\x89\xef\xf1\x65\xe5\x2b\x3c\x7a\x05\xdc\x41\xb4\x4b\x3b\x6d\x68\x8a\xd2\xe5\x70\x92\xd7\xe4\x11\xae\xfc\x05\xbb\x79\x8f\x86\xd2\x02\xbb\xf5\x19\x82\xeb\xfd\x74\xbe\x58\xd6\x46\x64\x67\xff\xb8\x57\xae\xf3\xb1\x69\xd1\x94\xdf\xf9\xd6\x16\xb7\x41\xdf\x34\x2f\xce\xb3\xe4\x9b\x63\xdf\xa8\x42\x2e\xf8\x22\x9d\x15\x05\xeb\x00\xf8\xb2\xb6\x31\x0e\x0b\x51\x9f\x6a\xbf\x35\x93\x39\x0e\x7b\x3e\x61\x40\x6f\xd2\xe9\xd2\x7a\x67\x1c\x1c\x1d\x79\x4f\x61\xba\xee\xf0\xfa\x31\xb0\x8d\x1f\xbd\x1a\x22\x49\x8e\x9c\xd3\xaf\x7b\x3a\xd3\x18\x5b\xb1\xc1\x8b\x45\xfd\xd1\x61\xfd\x92\xaa\xa7\x83\x68\x71\x41\x88\xe0\x40\x56\xe6\xf7\x27\xc8\x21\x07\xf8\xcf\xe3\xec\x24\x5d\x4e\xd9\xef\xd9\x26\x08\x95\xca\x82\x92\x5d\xcd\xa6\x4c\x5c\xa9\x41\x86\x73\xf0\xc4\x2d\x87\x52\x23\xbb\x45\x1a\xf8\x38\xfb\x6e\x78\x4a\xe3\x70\xe2\xc1\xb1\x7f\x98\xc0\xb2\x08\x90\x28\x18\x9e\x3d\x22\x75\x64\x97\xe9\xa1\x8f\x02\x19\x9b\xb4\xca\x7e\x6d\x30\x9c\x5c\xd6\x69\xf2\xd1\xaa\x70\xa0\x63\x09\x0c\xfd\x75\x2c\xd9\x69\xdb\x92\xf1\xa4\x74\x3e\x88\xb6\x05\x0a\x68\x1c\xf5\xc4\x12\x68\xe2\xf4\x62\xba\xec\x84\x93\xe7\x02\xd2\xd6\xb4\x80\xe6\xe1\x01\xdd\xc1\x9c\x24\xc4\x80\x44\xef\x60\xac\xff\x57\xa4\x13\x12\x07\x70\x3c\xe0\xb1\x58\xab\xcc\x74\x4b\xd0\x0f\xee\x4b\x1a\xc3\x23\x27\x4a\x5b\xc2\x35\x75\xad\x07\x3f\x1e\xbf\x05\xfa\x3e\x4f\xd4\x00\xeb\xd0\xd9\x2f\xac\x14\xd4\x2b\xb6\x2c\xa7\x2e\xfc\xdd\xfe\xb1\x5a\x89\x78\x56\x66\x18\x18\x87\x3d\xb4\x59\xa9\xd9\xcd\x59\x4e\x9d\xa5\x49\x2b\xac\x9b\xfa\xd5\x06\x0c\x5d\xb7\xd6\x9a\xcf\xdb\x06\xd1\xf8\x07\x83\xe8\x1c\xa9\x2d\x83\xac\xa2\x3c\xbe\x7f\x1b\x14\xe7\xa9\xdc\xa9\x4d\xbf\xf9\xf4\xb7\xdf\xaf\x43\xdd\x65\xa6\xaa\xd8\xdd\x84\xc4\xa9\x44\xe3\xca\x31\xaa\xce\x31\x08\x46\x2b\x97\x19\x4b\xf3\xf5\x46\x82\xd9\x3c\xf2\x6b\xf2\xdd\x64\x36\x41\x39\xbf\x75\xe6\xd5\x31\x5a\xf7\xbc\x46\x8d\x8e\x6b\xaf\xa5\x1b\xf3\xe9\x2c\x3d\xf5\x8c\x81\x39\x7e\xb1\xc6\x98\xa6\x23\xb5\xbf\xd9\x98\x12\x81\xe5\x1c\xb6\xe1\xef\x35\x46\x94\x6e\xd8\xfa\x66\xe3\xa9\x34\x0a\x76\x4c\x3f\x59\x51\xe7\xb8\xaa\xbb\xe9\xb5\xce\xf8\x07\x5e\x4c\x81\xdd\x52\xfb\xad\x1a\xd9\x0b\x3f\x70\x7f\x84\x09\x74\x13\x0e\x1b\x22\x11\x8d\x62\xde\x8c\x6a\xc7\xc5\x86\xf8\x11\x9a\xe8\x08\xc0\xd9\xe2\xed\x13\xca\xdc\x0f\xfe\xbb\x9e\x1a\xad\xe4\xc8\xe8\xa1\x44\xf0\xc3\x0d\x54\xbe\x82\xfc\x0b\x03\x81\xf6\x07\xc0\xf5\xe1\x3e\xc5\x6b\x32\xd0\xa1\xdb\x53\xc4\xfc\xcf\x88\xbd\x14\x6e\xc5\x7f\xb0\x05\x52\x44\x5f\xfa\xde\x94\x8f\xe7\x45\x8b\x47\x87\x20\x57\xec\x5a\x38\xbf\x54\x73\xfb\xca\x99\x6a\x78\xf9\xe4\x94\x32\x26\xba\x9a\x18\xb7\x5e\x36\x93\xae\xaa\x83\x9b\x78\x4b\xdc\xdf\x94\x19\x77\xcd\xc7\x45\xe9\xb4\x4e\x68\x3d\xec\x38\xc4\xea\x66\xe8\xf1\xe0\x91\x4c\x51\x89\x76\xeb\x94\xf7\x7d\x31\x9d\x54\x49\x23\xd0\xdb\x84\xcb\xdf\xd8\x93\x41\x79\xcf\x75\x23\x6d\x6f\xd5\xd6\x8c\x56\x46\x31\x66\x1f\xa8\x01\xc2\xbf\x19\x51\x5e\x34\x71\x95\x59\x7d\x99\x78\x88\x1e\x4c\x49\x87\x87\x4a\xdb\xf9\x35\xd7\xcc\x9e\x98\xa0\xca\xd5\x52\x14\xa6\x27\xa8\x29\x36\xb2\x45\x0a\xe8\x0c\xeb\x5c\x23\xd4\x52\x63\x7a\xc6\x19\xb0\x94\xff\xb3\x0a\xe0\xf5\x8e\x16\xf1\x23\x72\x9f\x30\x0b\x2c\xd5\xc0\x29\x7e\x9d\xe2\x2f\x53\x09\xfc\x0c\xdf\x64\x2f\xc9\xd3\xf8\x46\x41\xcd\x66\x0f\xcd\x7b\xc8\xa4\x22\xb8\xf1\x56\x62\x9a\x0a\x35\x6c\x57\xc4\xb3\x79\xa1\xca\xea\xfb\xca\xe6\xd6\x18\x67\x7b\x15\xc1\x26\x2f\xa7\xd9\x6b\x5a\x81\xe0\x85\xfb\x74\x0e\x8f\x3e\xae\x66\xae\x22\xa5\xac\x5f\x2e\x3a\xeb\xa9\xd8\x05\xca\xd7\x80\x2a\x30\x2c\xe3\x84\x72\xbb\xa7\xc7\x47\x78\x36\xdf\x02\x3c\x00\xa6\x05\xec\x60\x89\x6f\xcb\xdc\xe6\x70\x38\x52\xe5\xed\xc4\xba\xae\x8a\x72\xa7\x9c\xc0\xe0\xa4\x39\x37\x4a\x36\xc5\x14\x03\x04\x37\x2f\x2e\x69\x30\x39\x76\xf8\x0c\x9d\xd7\x79\x89\xd5\xbc\x31\x9c\x3f\x73\x25\x8d\x29\x82\x23\xc7\xc0\xf7\x89\x28\x89\x58\x23\x69\xb2\x09\x20\x98\xb9\x8b\xaa\xd1\x18\x78\x3e\x38\xce\x57\xd1\x56\x85\xe7\x54\x13\x4c\x12\x1c\xad\x31\x26\x9a\x9d\x78\xc4\x59\x9d\xe7\x8b\x4a\x16\x8d\xa1\xda\xe4\x01\x04\x16\xe3\x85\x84\x38\xd9\x7b\x4e\x96\x03\xef\xd7\x11\x87\x8c\x53\x20\x88\x64\x12\x48\xb8\xa0\x5e\xc0\x9e\xd1\x53\x7e\x44\x61\x89\x62\x77\xa1\x84\xe7\x56\x2b\xeb\x62\x67\xcf\xd2\x2a\x40\xb4\x93\x44\xf3\x39\x6d\x5e\xe0\xe2\x15\xaf\x99\x64\x6d\x22\x41\xec\x83\x2e\x27\x64\xca\x9c\x68\x3b\x88\x4e\xd6\xe8\x95\xb0\x8c\x05\x52\x78\xc5\x50\x44\xdb\xd6\x56\x0f\xc5\xc4\x63\x44\x42\x31\x3a\x19\x91\xe1\x56\x17\x64\xf7\x58\xbc\xb6\xe1\xe7\xf6\xda\x3a\x76\xdf\xf6\x6d\x36\x1d\x9e\x53\xa4\xf5\x23\xef\x87\xbe\x02\xa9\xd4\x4f\xb8\xff\x6f\xf8\x18\xc1\xaf\xd5\x47\xdd\x6c\x10\xc0\x5e\xfd\x8a\x32\x47\xfe\x69\xc7\xfe\xb9\x4a\x72\x26\x74\x54\x6d\x77\x3c\x6d\x9a\x8e\xdd\x08\xe3\x4e\x7d\x5a\x01\x4e\x75\xcc\xbf\xf4\xad\x07\x7f\xdf\xf9\x40\x4a\x1d\x22\x72\x82\x8f\x41\x30\x81\x37\xd4\xc0\x7d\x6d\xdd\x21\x39\xe7\x72\xa0\xc4\x30\x5a\x3a\x4f\x9c\xbd\x19\x3f\x26\x7d\x4d\x20\x8f\x2e\xae\x3a\x55\x4e\xd2\x7c\x71\x95\xdc\x4b\x7a\x8b\x2b\x65\x63\x69\xd3\xed\x34\x65\x1b\x73\xc1\xfd\x16\xec\x4f\xe3\xd8\x7b\x62\x01\x1c\x9b\x0a\x68\xa2\xee\x77\xcc\xc5\x47\xf2\xb9\xe4\xbe\x20\x7e\x23\x88\x59\x07\x5e\x97\xc5\x02\xb8\x13\x45\xc6\x37\x32\x87\x68\xb5\xe3\x25\xcb\x84\xc7\x66\x9b\xe4\x6f\xcc\x71\xc9\xa3\x10\xd3\xea\xcd\xe1\x3e\x4a\xa7\x3d\xa0\x4f\x73\xc3\x16\xb3\xbc\x96\x1a\x6f\x2e\x53\xad\x4b\xb7\xf1\x29\xd9\x0f\x12\x70\xc8\xfd\xbd\x72\xcd\x64\xdc\x83\x20\x9b\x87\x5d\x3c\x87\xb5\xca\x92\xc8\x57\x13\xa5\xe8\xf0\xf4\x2d\x36\x6b\x47\xa0\x7d\x69\xb3\xe0\x79\xdd\x5a\x8d\x2b\xab\xcc\x2b\x31\x03\x4b\xd4\xc4\x12\x35\xb2\xf8\xbf\x9b\x67\x53\xba\x84\x3d\x71\xbe\x4c\x7e\x23\x79\x42\x35\xda\x18\x4d\x98\x54\xa1\x37\xae\x6e\xe2\xcd\x6a\xd2\x4f\xa4\x68\xc4\x26\xeb\xca\x2c\x3d\x57\x64\x05\xf7\xee\x18\x73\x36\xc0\x34\x0d\x14\x3f\xcd\x0f\xba\xc9\xc2\x05\x7f\x52\x5c\x05\x4b\x77\x04\xf0\x56\xaf\x3a\x8e\xda\x5c\x76\xea\x1b\xf8\x40\xf6\x7b\x7f\x88\xfc\x13\x0f\x4f\x68\xfc\xf3\xaf\xd3\x37\x42\xa2\x4d\xef\x1d\xbb\x86\x66\xf3\xdd\xd7\x8f\x40\x58\x41\xcf\xb8\x9b\x6d\x0d\x13\xcf\x25\xa6\x58\xa2\xfc\x11\x1c\x22\x64\x4c\x72\x68\x5f\x16\xb0\x6d\xa3\x35\x19\x73\x6f\x47\x98\x72\xbc\x7d\xe0\x00\xfb\x87\x40\x41\xaf\xc8\xc4\x41\x7e\x6b\x1e\xb7\x8a\xab\xfd\xfa\x2b\x29\xf7\xef\xac\xf6\x01\x11\xd6\x61\xc4\x06\x1e\x61\x85\xa6\x23\x5c\x69\xa5\x1d\x09\x52\x0f\x59\x70\xf2\xda\xdf\xf6\xb6\x50\x17\x7a\xe5\xc0\xd8\x6e\xcf\x6c\x07\x8d\x79\x83\xb6\x97\x75\x11\x85\x5d\x5f\x76\x35\x46\x00\x66\xe7\x0c\x3d\x04\xfb\xc0\xe9\x9f\x41\xb0\x7a\x10\x0c\xd0\xd0\x5b\x37\x06\x68\xae\x79\xbc\x8f\x6e\x1b\x31\xca\xb7\xf8\x69\x5e\x9c\xaa\x49\xa0\x57\xc0\x13\xb8\x2a\x48\x41\xea\x2c\xe3\xda\x59\xe1\xc1\xaa\x21\x1a\xc8\xc9\x10\xee\x9a\x76\x4a\xc9\x68\x84\x70\x98\xad\xaa\xf9\x16\x2e\xb3\xe1\x4c\x5d\xdc\xb6\x0e\xad\x9f\xe4\x8a\x02\xd1\x27\x64\x3e\x77\x19\x5a\x24\x7d\x1a\xf0\x68\xf6\x05\x27\x4e\x5d\x8f\x57\x2b\xa6\x1a\xe2\x4e\x9b\x8a\x20\x68\x43\x5f\xc6\x2e\xe2\xbe\x23\x75\xdc\x69\xab\x51\x6a\x42\x11\xe2\x0c\x05\xb0\x88\x93\xf9\x99\x01\xe2\x20\x76\x3a\x00\x76\xb5\x0f\xdd\xf6\xba\xba\x34\x8d\xcc\x5a\x00\xe7\x54\x2c\xaa\xae\xf2\x5b\x8e\x92\xed\x51\xc9\xcf\xd1\xf2\xf4\x94\xca\x9a\x65\x98\x89\x2e\x91\x38\x04\x93\xb7\x0d\x49\xca\xe6\x61\xa2\xd7\xa5\x71\x97\x34\xc0\x44\x0d\xc5\xaf\x72\xe3\xf5\x15\x33\x13\xa9\xb0\x08\x19\x04\x8e\x63\xf2\xd0\x32\x88\x95\xcd\xf9\xa1\xa3\x7a\x7c\x45\x46\xbd\xd5\xdb\xf5\xc9\x97\x8b\xd1\xfd\x6b\x02\xaf\x82\x79\x45\x79\xa3\x90\x4e\x95\x96\x4f\x5e\xb2\x68\x7d\x66\x4f\x39\xd2\x4a\xa4\xf2\xa6\x15\x5b\x25\x02\x52\x20\x44\x9c\x76\x4e\x6b\xeb\xa8\xba\x3a\x68\xb8\x35\x97\x50\xc0\xc1\x39\xc9\xa9\xa7\xac\x4e\x86\x4d\x93\xf1\xd8\x35\x7e\xe0\xd9\x86\x8f\xbc\x7c\x55\xde\xd3\x42\x5e\xad\xd5\x63\x3b\xcb\x8f\xea\xc4\xc4\x9e\x6a\x8b\x25\x3c\x82\x2b\x5b\xb8\xd2\xc6\xe6\x24\x7f\x51\x29\x6c\xf6\x58\x27\xf3\xc9\xdc\x0b\xc1\xf4\xf9\x1f\x0e\x98\xa6\x3e\x80\xc6\x71\xc1\x1b\xdf\xa7\xaf\x23\x4a\x1b\xca\xab\xd5\xdf\xb4\xe9\x14\x2c\x80\x50\x2f\xc5\x3f\x7e\x8a\x3f\xed\x6c\x22\x7d\x72\xbf\x53\x8f\x24\x9b\x4a\xd0\x90\xfa\x5a\xbc\x2a\xb2\x7e\x2d\x56\x08\x6d\xa5\x88\x29\xae\xdd\x96\x45\x32\xba\xb9\xde\x5b\xb6\x50\x79\xd0\xd6\x65\x77\x53\x8d\xcf\x1c\xe7\x60\xa1\x88\x12\xac\x59\xd1\x88\x72\x76\xa5\x26\xf3\x0c\x2d\xc1\x28\x93\x54\x73\x5e\x6e\x4b\x78\x80\x61\xe6\x28\x93\x04\x8d\x44\x70\x93\xff\xcd\xb8\x47\x9d\x4c\x0b\x2a\xcb\x7e\x8d\xa1\x6a\x63\xf1\x08\xb1\x27\xcd\x7a\x3d\x5d\x58\xf5\xc4\x81\xd4\xac\xa6\x0c\xb1\x5b\xd5\x0c\xb0\x78\x82\x30\x1e\xe7\xb8\xef\x86\xc0\x1a\xb3\x19\xb4\x33\x03\xe5\x6c\x98\xa1\xf3\xfc\x0c\x1e\x0e\x59\xe2\x27\x0e\x2b\x96\xf8\xd0\xac\xb3\xd3\x12\xd0\x9b\x2f\x67\xa3\xac\x94\xf4\x80\x95\xc9\xce\xec\x50\xac\xfc\xfb\x22\xc4\xbd\x83\x2f\x79\x98\x90\xe5\x41\x34\x8a\x63\x2c\x32\x59\x5f\x66\x99\xe7\xdd\x2a\xf8\xa5\x94\x2f\xba\x96\x85\x93\x2f\xf1\x15\x54\x59\xef\xd1\x11\x86\x06\x4c\xc8\x7d\x90\x38\x56\x45\x4e\xd1\x1c\x6e\xc6\x4e\x86\xe6\xd5\x54\x62\x5c\xe5\x84\x4f\x22\x7b\xe6\xc0\x46\xe5\x92\x5e\x8f\xd3\xfa\xb2\x07\x26\x66\xb9\x2b\x8d\x1f\x26\x6e\xaa\x75\x04\x37\xba\xa2\xc8\xee\x01\x57\x7f\x4e\x83\x26\x52\xa1\x2a\xf8\x9d\x4f\xb3\x6d\xd2\xd8\xc6\x64\xd8\x5c\x67\x77\x06\x02\x77\x6c\x9e\x9e\xb9\x19\xda\x51\x31\x97\xc1\x1d\xa7\x78\x43\x30\x2f\xbd\xc2\xc5\xad\x2a\xc7\x48\xf9\xd0\x48\x62\x19\x1f\xe6\xbd\x06\xb7\x16\x3e\x1b\x51\x21\x16\xf1\xd2\xc1\x9f\x82\xa0\xd0\xe6\x8d\xe3\x59\xa7\x6c\x4c\x48\x33\x00\xc4\x78\x0d\x89\x51\x2f\xe4\x1a\xa1\x68\x13\xf6\xb3\x42\x47\xf3\x00\xdc\x0b\xa7\xdd\x0d\x09\x15\x07\x2a\xbd\x04\x5d\x4f\x2c\x9b\x3f\xc3\x5f\x56\xf4\x46\x82\x8e\x76\x46\x49\x62\xd8\x82\xc9\x2a\x5d\x66\x70\x0f\x36\xb9\x34\x95\xb2\xae\x8c\x70\x6c\x3c\xb3\xe1\x95\xa9\xdc\xd6\x29\x53\x72\xb1\x3c\x3d\xa3\x50\x5b\xde\x88\x0a\x83\x47\xca\x6b\x2f\x1f\x61\x98\x0a\xb2\xcd\x10\x21\x77\x5a\x87\x2b\xb6\xdd\x93\x7e\xbb\x08\xf4\xe5\x3a\x0f\xf4\x08\x5e\x6b\x3d\xec\xdb\xcf\xda\x2d\x7a\x7b\x4c\x61\x3d\xbd\xc2\x82\x82\x09\xf5\x4d\x2e\x17\xbe\xb5\xc6\x51\xa4\x09\x3d\xb9\x60\x7f\xe4\x8d\x43\x2e\x5e\xe6\x49\xf3\x54\xcc\xa4\xb3\x0c\x36\x6f\x42\x69\x8b\xd8\x40\x23\xb9\x37\xd9\xe9\xbe\x32\xee\xbf\x24\x0d\x30\x64\xb4\x88\xb0\x4c\x38\x66\xff\xfd\x2f\xe1\x31\x3b\x57\x49\xcf\xb8\x59\x31\xc6\x7a\xd1\xab\x05\x06\x4f\x54\x59\x4b\x97\xce\x03\xdc\x42\x8f\x5e\x9a\x31\x6e\xa5\x43\xe7\xde\x9e\xfe\xdc\xa6\xbc\x6d\x53\x9e\xcb\xac\xf4\x53\xb1\x91\x3b\x11\x9f\xef\x13\xa3\x85\x69\x26\xe1\x34\xc2\x99\xd9\x38\x7a\xc1\xf0\xc0\xc0\x2b\x07\xf4\x78\xc1\x28\x21\xf8\xd7\xc9\x72\x6a\xf5\x7f\x95\xcd\xc8\x64\x2d\xe3\x9c\x7f\x9c\x73\x24\x52\xdd\x12\xe3\x19\x68\x07\x75\x29\x57\xc8\xcc\x88\xf2\xd0\x92\xec\xd8\xe4\xe7\x7f\x8d\xf9\xa2\xe0\x3a\x7d\x5c\x50\xba\x86\x42\x84\x21\x94\x84\x96\xe5\xc8\x00\xb3\x40\x38\x7a\x05\x8d\xc7\xe4\xb6\x08\x77\x73\x7a\x52\x73\xe6\x37\x23\x47\xb1\x58\x75\x02\x27\x10\x6b\x8b\x50\x01\xa9\xaa\x36\xc9\xea\xf3\xb9\x49\xad\xad\xf0\xa2\x1c\xe5\x15\x7a\xe7\x3e\x9d\x57\x75\x96\x4e\x68\x01\xb8\x92\x53\x62\xb2\x71\x71\x52\x2d\xfc\xb3\xca\x5c\x2a\x6c\x14\x03\x28\xa1\x3a\x2c\x41\x75\xe6\xe3\xca\xcb\xb2\x4d\xa9\x09\x61\xb3\x81\x1d\x85\xd7\x0c\x31\x3d\x56\x9c\xd7\x26\x2f\xbc\xad\x3e\x57\x59\x2b\xa7\x69\x2e\x7e\x9d\x37\xb6\x5c\x9b\x94\xce\xf1\xd7\x11\xd9\xa9\xed\xbb\xb8\xfa\xa8\xb9\xa4\xcd\x8c\x81\xc7\xdd\x4b\x4c\x14\x79\xed\xdc\xe9\xf6\x2a\x90\x6c\xa6\x7f\x73\x33\xdd\xb1\x48\x1d\x41\x13\xd5\xe2\x91\x33\x6f\xf6\x1b\xa6\xbb\xdb\x19\xfc\xd6\x7b\xfa\x75\xda\x35\x5b\xd7\xf2\xc1\x8a\x85\xf6\xd3\x90\x87\xd9\x80\xfb\xee\x3d\x1b\xae\xb9\xa9\xd1\x1b\x4a\xdf\x3f\x3e\x8c\x5c\x6a\x41\xc9\xac\xb9\xcf\x1b\xe6\xad\xb1\x8e\x18\xf6\x21\x65\x10\xac\x27\x81\x77\x7f\x34\x4e\x10\x9e\xdd\x6d\x66\x2e\xaa\x4a\x83\x83\xed\x85\x25\xda\x7a\x02\x11\x17\x8f\xa4\xb6\x6f\x04\x90\x6e\x49\xf5\x86\x7e\xf8\xa4\x53\x53\xd5\x14\xf8\x28\x92\x1c\x82\xd0\xd4\x65\x65\x67\xd1\xe7\x08\x61\xcc\x65\xc7\x01\x8e\xe6\x2d\x0b\xfc\xe9\x3c\xf5\xa4\xdd\x4d\x35\x39\x38\xdb\x03\x1f\x90\x41\xc2\xc1\x53\x8f\x62\xea\x45\xf1\x5b\xe3\x32\xe7\x98\x42\x41\xd0\xdd\xb1\xb6\xcc\xc2\xcc\x2c\x87\x5b\x3d\xe6\x52\xc2\x5b\x11\x98\x65\xaf\xce\xfb\xa6\xc1\xa6\x35\x17\xe4\x0b\xba\xb2\x1e\x66\xc8\x07\x39\xae\xc1\x2e\x9a\x63\x8b\xb3\xd5\xf9\x67\xd4\x69\xd4\xcc\x48\x1f\xcc\xc0\x70\xa7\x38\x90\x49\x85\xf6\xeb\xaf\x77\x94\xc8\xd3\x6c\xa0\x52\x3f\x3d\x4c\x1a\xa0\xe5\x01\xa0\x32\x2b\x5a\x57\x14\x17\x82\x6b\xb6\x67\xc0\xd1\x4a\xfa\xee\xcb\x78\xdf\x70\x15\x12\x1b\x24\xc9\x3b\x47\x79\x28\x59\x55\x67\x05\x0c\x27\x71\xbb\x44\x9a\xd6\xad\xc2\x06\xaf\xea\x09\xb9\x1e\x20\xf1\x66\x65\xfd\x88\xc8\xcf\x8f\x76\x1d\x84\x4d\x1d\x70\x63\xda\x89\xe4\xd9\x0a\x57\x54\xe7\x25\x6a\x5b\x54\xc9\xd9\xba\x7a\x49\x5f\x9a\x4a\x2e\x76\x9f\x72\x7d\xfe\x71\xd1\x82\xa5\x89\xec\x9c\x76\x28\xf9\xed\x8b\xb4\x86\xd4\xbb\x06\x22\x9b\x8d\xf0\x11\x98\x2d\xdc\x18\x67\xce\x77\x6a\xcd\x69\xca\x5a\x76\x4e\xd2\x8a\x8b\x7f\xcd\x69\x36\x11\xd1\x19\xc5\xa4\x58\x41\x3e\x23\xe9\x0c\x35\x38\xe5\x2c\x9b\xe4\xe8\x28\x82\xa4\x52\xf1\xfc\xe4\xbd\xbe\xde\x4e\xde\x59\x85\x4b\xeb\xbc\x9b\xd6\x97\xd5\x9b\xa5\xf2\x6f\x11\x96\x6b\x9c\xc4\x26\x54\xdf\x57\xa0\xc3\x54\x15\x3f\x83\x81\x92\x3c\x7e\x3d\xb6\xc7\xfc\x7f\x96\x1b\xd2\x81\xff\x2b\xdf\x90\x46\x04\xf7\xe7\xd1\x67\x44\xe1\xf1\x3e\x69\xbf\x24\x9d\x67\x59\xf4\x9e\xd4\xf0\xf4\x55\x49\x85\x12\xfe\xc5\x6f\xca\x47\x5e\x1e\x03\x7b\x59\x06\xa2\x66\xeb\x7d\x29\x29\x42\xd7\x65\xec\x3f\x3c\x0c\x85\xd8\x55\xd7\xa5\xe3\x7a\x6a\x97\xd6\xbd\x31\x69\x03\xbb\x2f\x4c\x6c\xe2\x9f\x52\xed\x86\x18\x67\x17\xab\x33\x38\x7c\xb6\x9b\xb1\x29\x6e\x74\x2d\xa1\xbd\x1e\x65\x5b\x72\x7d\xfa\x23\xb7\x86\xc2\x3b\x7a\x61\x34\x18\xe8\xba\xd7\x86\x02\x7c\xeb\x9b\x63\x8d\x2b\xf1\x33\x4d\x2e\xe4\xc6\x7f\xf5\x09\xda\x01\xff\x27\x5d\x88\xcd\x93\xd6\x86\xce\xfa\xb7\xa1\x85\xb9\xfa\x32\x24\xa2\xd1\xa6\x1a\x14\xbf\x29\x27\x8e\xe3\x2b\x55\xf7\xb5\x78\xac\xf8\x7c\x5a\x61\x86\x15\xd1\x4c\x79\x0a\x80\x4d\x82\x1a\xbe\xf8\x37\x39\xe5\x78\x3a\x2d\x81\x93\x5f\x8b\xe6\x91\xf5\x4c\xee\xb2\xa3\x26\xa4\x6c\x47\x1a\x30\xf7\xa9\xbb\x40\xd0\x8a\xd4\x0f\x6e\xe5\x3b\x5c\x29\xc2\x7d\x8b\xe5\xb0\xbd\x89\xd2\xcc\xd4\xfd\x55\x66\xe3\x6b\xb8\x70\x2a\xed\xc2\x4f\xe9\x52\xd0\x9e\xea\x97\xc4\x12\xc7\xf2\x45\x51\x11\x2a\xec\x8b\x6e\x0a\x14\x1a\xb5\x19\x60\x75\xc4\x95\x28\x8d\x06\x0f\xdd\x8f\x18\x30\xc6\x7e\x67\xe3\xac\xaa\xd2\xf2\xfa\x5f\xf5\x0a\xd5\x0a\x9b\x24\xac\x80\xd0\xa5\xc0\xe9\xca\x7f\xff\x33\x66\xb4\x21\xca\xe7\xc0\x69\x98\xb6\x54\x8f\x25\xb7\x0f\xaa\xc9\xc7\xf3\xe4\xf4\xb6\xb6\x38\x5d\x36\x27\x03\x6d\x56\x32\x9c\x9a\xf2\x1c\x50\x8e\x64\xcc\xed\x54\x4a\xa9\xc8\x93\x34\x9f\xc2\xf1\xf0\x92\xa9\xf3\x39\xfb\x05\x01\x51\x44\x85\x07\xdf\xc1\x31\xa7\x54\x58\x91\x6a\x45\x07\xbb\xd1\x4e\x2e\x3f\xd5\xce\xd5\x4c\xe0\x14\xbb\xbd\xc7\x39\x87\x36\x58\xdc\x05\x0c\xcd\xbb\x27\x37\xaa\xd4\x80\x50\xc3\x71\x56\xdd\x93\xd8\x8d\x6d\x41\x1f\x1a\x90\x99\x77\xd2\xad\xbe\x25\x36\x0e\x65\x12\x05\x6a\x91\x68\x2a\x35\xa4\x51\xa1\x7b\x58\xe8\xbf\x9a\xa1\x09\x89\x05\xa5\x62\xb2\x3d\x9e\x66\x7e\x0f\xb9\x28\xca\x44\x67\x40\x6e\x67\x92\x88\x04\xe9\x63\x7e\x5a\x89\x0f\xd0\x69\x21\x0e\x3f\x1c\xc9\x34\x2d\x6c\x35\x62\x4b\xf7\x47\x2e\xaf\x7b\x0b\x13\x7f\x10\x76\x39\x34\x29\xdf\xa3\x0c\xda\x57\x97\xe2\x82\x27\x4d\xa1\x49\x57\x70\x20\x53\x29\xe3\x9b\x5d\xa5\x33\xae\xa4\xa3\x93\xb5\xc9\x51\xcd\x61\x83\x52\x93\x2c\x67\xbd\x18\x12\xa3\xe4\xa5\x0d\x7c\x0c\xc7\xd0\xf8\x1f\x3c\x4f\xeb\xb3\x2d\x18\xaa\x1f\xd3\x32\xae\x71\x59\xaf\x30\xee\xb1\x80\x87\xdb\xd1\x27\x3a\x51\x23\xef\x3c\x50\x7f\xfe\x10\xa2\xa6\x7e\xbc\x77\x4f\x07\xb8\x94\x4a\xed\xac\x54\xd6\xf7\x5c\xfb\xa0\x92\x09\x12\xbe\x7a\xd2\xd8\x73\x46\x3e\x21\xbd\x0b\x4c\xe6\x56\x37\x45\xe6\x4b\xe7\x4a\xc0\xf2\x0c\x50\x0d\x32\x6a\x31\x74\x1a\x6c\xe0\x2b\x2f\xe1\x76\x56\x8f\xcf\x44\xf7\x4b\xa5\x93\x9d\xc6\xda\x1e\x6d\xe9\xa2\x9d\x81\x4c\xd6\xf7\x69\x71\xda\xdf\x38\x40\x06\x8d\x8e\x2a\x04\x8c\x4b\x0b\x21\x94\xbd\x04\x2b\x52\x37\x60\x26\xc9\x08\x2e\xc9\x73\xeb\xf9\x73\x67\x0d\xa1\x4c\x50\x18\x24\xca\x4e\x4f\x58\x00\xbb\x5c\x66\x9e\x98\x65\xeb\xc1\xb8\x75\x7f\xe8\x90\xd0\x8b\x49\xf7\xbd\x89\xee\x12\xb3\x08\xd7\x6f\xa6\x6c\x55\x03\xbe\xa0\x52\x8c\x68\x33\x2b\xa8\x7d\x03\x22\xac\xa0\x15\xa1\xe6\x99\xfd\xe2\x8b\xe6\x41\x5e\x07\xe5\xe6\xb3\xbd\x94\x52\x4e\xbe\xb9\x07\x2f\xf6\x81\xc9\xa4\xc1\x97\x35\xdd\x21\x0e\xd6\x65\xc6\x05\xda\xb8\xc4\x29\xfe\x13\xde\x10\x73\x3f\xb3\xfa\x91\x2f\xd6\xda\xd5\x68\xce\xe3\x56\x4b\x23\xbc\x49\x2f\xcc\x61\xf0\xbe\x5c\x6f\x59\x50\x81\xf1\x37\x5b\x94\x43\xf7\x98\x89\x2d\xc9\x61\x43\x4b\xb6\x16\xf1\x7a\x19\xe5\x8f\x9c\xd2\x3a\x69\xfc\x78\x18\x48\xfa\xec\x38\x96\xa9\x6b\xd1\xea\x53\xb7\x63\xf5\xcd\x44\xe6\xf3\x7c\xcd\xc8\xeb\x48\x80\x5d\x67\x62\xd2\xf4\x38\x0a\x95\xd5\xc3\x0c\x23\xff\x93\x38\x0b\x13\x9a\xa9\x84\x46\xb7\x35\x67\x3d\x02\x29\x37\x1d\x99\xec\x7f\x09\x13\x08\xd7\x73\xeb\x11\x63\x41\x27\x36\x36\x50\xbf\xce\x88\xb5\x18\x70\xb9\x2a\xf8\x64\x22\x57\x6b\x15\x1b\x8b\xa3\xb9\x6a\x09\x37\x59\xe0\xf8\xf2\xfe\x96\xc5\x55\x4b\x1b\x21\xd6\xc6\x50\xb7\xe1\x94\x37\xdd\x27\x3d\x49\xef\xbd\x6a\x25\x33\xf4\xa3\xe6\xa8\xe8\xce\x67\x67\x2c\x80\xb4\x01\xd5\x53\xf6\xb4\x46\xb6\xde\x69\xe7\x19\xea\x4e\xf7\xcd\x9e\x94\xfe\x08\xe9\x67\x84\xea\x0f\x49\x38\x39\x4a\x4f\xd9\x0d\x5a\xd8\x15\xbe\x57\xdc\x43\xce\xb8\x64\xab\x44\x1d\xc6\xa3\x80\xf3\xb8\xda\x00\x2c\xcf\x7d\xd1\xe8\x79\xa3\xa5\x0e\x11\x8e\x84\x0f\xa7\xa6\x78\x70\xc5\x15\xc1\xa8\xb8\x81\x57\x4d\xfd\xd8\xb8\x1a\x9c\xe4\x9c\xf3\x75\x59\x2b\x37\x6c\x49\xe1\x6c\x13\xf5\xae\x91\x62\x40\x39\x0f\x74\xf9\xda\x78\x0e\xfb\x2d\x59\x90\xfc\x46\x41\xb4\x8f\x8e\x0b\x6a\x83\xd6\xd4\x49\x78\x2d\x37\x3d\x52\x50\x24\xb0\x1a\xb5\x46\xbb\x0e\xec\x3a\x60\x36\x11\x0c\x1b\x37\x35\x26\xaf\x90\xf3\x78\x31\xed\xe2\xd8\x43\x69\x13\x80\x18\x8c\x42\xc2\xfa\xa5\x84\x4a\x11\x2c\x69\x49\xce\x54\xc6\x15\x55\x44\x7d\xe3\xda\xf5\x71\xe5\x4e\xd3\x58\x86\x67\x05\xd9\x0f\xdc\x5a\xb5\xfa\x25\xbc\x93\x66\x56\x22\xf8\xc0\xe9\x0f\xf8\xed\xa6\xe6\xfa\x84\x58\x9a\x76\x14\xb7\x99\x75\x4f\xa9\x48\x63\x2e\x7e\xb2\x8d\x20\x9a\x9a\x8b\xa4\x70\x17\x73\xda\x78\x89\x60\xb3\x9d\xa6\x04\x43\xed\xb9\x07\x55\xca\x46\xff\x32\x04\x65\xbb\xbc\x56\x59\x1e\x38\x43\x9e\x32\x4d\xd8\x05\x13\xc9\x13\x16\xe8\xb4\xc4\x82\xc7\x06\x63\x67\x34\x99\x98\x7a\x7d\x2a\xa4\x07\xb1\x59\xb9\xd4\xde\xf5\x10\x2c\x75\xa0\x9f\x98\x17\x52\x4d\xd1\x92\x73\xdc\x9d\x04\x44\x33\x2b\x8a\x49\x06\x8c\x78\x4b\x43\xf2\xfa\x99\x17\x6d\xf8\xce\x6e\x64\x43\x1b\xac\xfb\x46\x9e\x6b\xc4\x57\xbd\x4b\xca\x3f\x90\x31\xf2\xd9\x74\x67\xcb\x23\x44\xc3\xff\xef\x04\xf5\x25\x9b\x49\x21\x31\xff\x45\xa9\x92\x2c\x5f\xe4\xd9\xe5\x62\xbd\x38\x73\xec\xbf\x0f\xdd\xa3\xf1\x06\x64\xf6\xa3\x17\x78\xc0\xec\x1a\x2f\x63\xaf\xe0\xcf\x4e\xa0\xac\xf1\x7b\x05\xce\xcb\xeb\x6b\x83\x5b\x21\x78\xb7\xb5\xc1\x39\x2e\x8f\xec\x6c\x46\x6f\x5d\xef\x4e\x37\x10\x06\x81\xfd\x5a\xf5\xec\x70\x7d\x0a\xe8\x25\x44\xa7\x2d\x35\x85\xad\xa5\x26\x8e\x48\x9e\x4b\x58\xbb\x5e\x20\x19\x62\xcd\x75\xaf\xe7\x83\xc8\x0d\x10\x5d\x37\x6f\xcf\xf4\xb0\xb1\xed\x6b\xb1\x6b\xac\xbf\x7b\x6d\x00\xbc\xcd\x13\x2c\xe2\x7b\xe7\xa1\x18\xdd\x46\x6d\x22\x93\xd6\xcd\x1d\x09\xc6\x58\x67\x81\xbc\x0d\x72\x2f\xba\x46\x38\x71\x58\xea\x50\x57\x8d\x33\x11\xc4\x8a\xbc\x76\x82\x26\xb0\x2a\x80\xbe\xc1\x7c\x60\x30\x8d\x94\x90\x55\x4e\x78\x0d\x37\xc6\x78\x5e\x87\x59\x7a\x95\xcf\x96\x33\xe3\x92\x6e\x23\x98\xbc\x74\x09\x6b\xa4\x7b\x82\xef\x9f\xa7\x57\x1e\xe7\xce\xbc\xc4\x0e\xfd\x78\x24\x03\x23\xab\x52\x7a\x7b\x9e\xdb\x81\xd2\x4c\xc7\x62\x04\x3f\x79\xce\xdf\x43\x05\xa2\x7b\x58\x8a\x77\x0b\x5d\xc0\x69\x25\xdc\xe5\x6b\x8f\x83\x5c\x6c\x54\x27\x80\x85\xd1\x98\x5b\xaa\xce\x2d\x41\xb1\x40\x59\xf9\xc9\xc1\xe0\x7f\x4b\x77\xd1\xf7\xb2\xce\x6b\x95\x7b\xb7\x0d\x65\xa3\x90\xc7\xb6\x0b\xd2\xb2\xa1\x36\x4f\xd5\xb8\x6f\x64\xe9\xf4\x7c\x37\x72\x87\xbc\x63\x03\xd0\x00\x24\x23\x66\x41\x75\x06\x56\xde\xe9\xde\xe0\x00\x32\x90\x96\x1f\xd9\x26\xe4\xc6\x87\x89\xf4\x32\x16\x83\x1f\x5d\x1f\xbe\x41\x35\x72\xf6\x27\x9f\x1b\xda\x3c\x23\xae\xe9\x43\xd7\xaf\xe1\x21\xdf\xd6\xc7\x75\x51\x41\x17\x1d\x99\xad\x56\x92\x9a\x5f\x8b\xe2\xef\x42\x6d\x36\x2e\xea\x5f\x9b\xe0\xba\x39\x0a\xf1\x63\x3b\xe4\xf0\x96\x11\x7b\x3e\x9d\xfe\x00\x7c\xbe\x41\x9f\x3b\x7f\x75\xba\x8c\x5f\x03\x56\x9d\x62\x88\x85\xdd\x3b\x55\x6c\x58\x58\xcc\xdb\x8b\xb6\x08\x6e\x0f\xae\xc3\xdf\xf1\x6c\x60\x1b\x67\xa9\x52\x12\x96\xe4\x3a\x01\x0f\xf9\x2f\x59\x9f\xf4\x25\xbd\x27\x6a\xc3\x70\xd7\xb9\x85\x8e\x3d\x0f\xfb\x78\x7a\xa1\xee\x70\xd0\xf8\xfa\x75\xc7\x84\xae\xb9\x9e\xe4\xfc\xf3\x8f\xb1\x9c\xcc\x54\xd6\x59\xd1\x47\x61\x20\x42\xbb\xfb\xb2\xc9\xea\xe8\x99\x8c\xa2\xa7\x84\x24\x53\xb5\x6a\xbf\xa7\x34\xf8\x5c\x84\x4a\x26\x4e\x7a\x98\x4a\x67\x75\x35\xd5\xba\xbc\xba\x94\xa4\xfd\x71\xb2\x43\xaf\x52\x47\xc9\x14\x93\x94\x98\xfb\x8a\x74\x40\xbc\x4e\xa8\x17\xc0\xc0\xe3\x65\x66\xd8\x2c\x15\x5a\x99\xa5\xf3\x25\xa6\xfc\x53\x86\x7e\x13\x3b\x44\xef\xe7\x94\x57\x3c\x9d\xcd\xd2\x3a\x1f\x0b\xdc\x95\xab\x68\x4b\xa1\x45\x24\xa3\x35\x43\xb7\x2d\xe3\xf0\xe3\x2d\xef\x2a\x0e\xe9\x45\x74\x5b\xef\xad\x66\x58\x6c\xb3\x8f\x44\x76\x6f\xea\x6a\xba\x79\x25\xcb\x8c\x2b\x95\x4e\xab\x82\xd6\x5b\xab\x4f\x28\x92\xb1\x8f\x4a\x63\x2f\xac\x8d\xbe\xa6\xae\x77\x37\xb7\x3c\x78\x52\xed\xa2\x59\x85\x85\x2b\xf2\x78\xab\x8d\x2e\x2f\xba\x92\x13\xc3\xb5\xf0\x9e\x12\x80\x2a\xe3\x64\x83\x64\x49\x34\x21\xe7\xf9\xe9\xbc\xf0\x32\x0f\xca\x3c\x50\x85\x38\xcd\x50\xeb\xc1\x41\x98\x06\x14\x57\x60\x10\x4b\x36\x9f\x32\x63\x5a\x20\xdf\x8c\x39\xbb\x30\x4c\x30\xe6\x8a\x01\xaa\xb4\x16\x97\x65\x41\x21\xeb\x5c\x30\xc6\x46\xfe\x93\x5f\x68\xea\x21\xcd\xaf\x11\x9b\x57\x43\x33\x6d\x2f\x91\x8f\x0e\x82\x63\x25\x84\xa4\x43\x70\xe5\xf5\x62\x79\x10\x36\x83\xf4\xa9\x39\xa5\xd2\xc0\x18\x6c\x4c\xe3\x58\xe6\xa4\xa8\xcf\x2b\x57\x5b\x49\x56\xeb\x2c\xb3\x17\x29\xd5\xdc\x0b\x8e\x9d\x01\x84\x44\x80\x21\x8d\xa2\x1d\xc5\xb7\x10\x16\x2c\xe5\xb4\xfa\xc0\x5d\x43\xb0\xb6\xfa\x91\x4b\xfe\x68\x55\x4d\x44\x4c\xb4\xea\xc6\xe6\xee\xc6\x5c\xeb\x18\x51\xb5\xbe\xf0\x28\x75\x32\x93\x61\x6c\x6e\x9a\xa5\xbc\x75\xbf\x6b\xbe\xe2\xf8\x82\xa1\xd0\xdc\x5f\x2d\x5c\x5c\xcb\x7b\x1b\xa8\x27\xc9\x23\x49\x76\x40\xb7\x29\xd0\x4a\x4d\x15\x84\x6c\x81\xa2\x78\x5c\x9b\xf1\xfe\x91\x52\x7c\x96\xac\x1e\x3f\x7d\x33\xd0\x74\xcd\x28\x18\xdf\x24\xb2\xed\x8c\xae\x93\x09\x6f\x8a\x1f\xd4\x47\xe8\xa1\x2b\x57\x5d\x18\x82\xc7\x4a\x58\xc2\xed\x6e\xb6\xf2\x31\x2e\x46\x94\xea\xb5\xea\x67\x2e\x7b\x0c\x56\x60\x26\xa4\x5e\x31\xdd\x44\x8a\xe9\xf3\x99\x7e\xf2\x64\xe0\x08\x02\xaf\x38\xbf\x6c\x23\x9d\xe1\xc5\xb2\xae\xbc\x0b\x12\x5f\xa8\x18\x65\x5a\xa7\x56\x9b\x8f\xe0\x7a\x93\xac\x4e\xf3\x69\x0f\x56\x31\x9b\x5a\xcb\x01\xd3\x2f\xa5\x56\x65\xa6\x36\xc5\xb4\xa7\xfc\x08\x5e\x2c\x70\x09\xa9\xd8\x55\x3e\x3e\x4b\x26\x79\x69\x8c\x0c\x54\xb0\x2c\x99\x67\xa7\xc0\xf5\xd1\x0c\xcb\x49\x1d\xb8\x8e\x93\x57\x74\xc2\x38\x8b\x30\x3a\x0f\x93\x6c\x0b\xd7\x0f\x05\xb6\xb0\x02\x65\xf2\x1f\x49\x7f\xb8\x0b\xdb\x82\x8b\x83\x88\x6e\x26\x7b\xf0\x99\xf6\xf4\x31\xf6\xfe\x4f\xe4\x00\x0c\xe7\x4b\x17\xab\x6e\x96\xf7\x39\x07\x16\xe7\x59\xf9\x51\x47\x17\x86\x51\xed\x4a\x5e\x65\x58\xe6\x26\xa9\xb5\xf0\x59\x2b\xb1\xf3\x26\xef\xad\x3a\xf6\xd2\xaa\xdb\xde\x58\xf0\xfd\xdd\x36\xf4\xd4\xd5\xf3\x9c\xfd\xcb\x1c\xe6\x52\xed\x2d\xf5\xd8\xf9\x40\x36\xa9\x2e\x73\x34\x97\x89\xc0\x63\x72\x27\xb7\x8a\x71\xec\xd0\xe2\x52\x00\xbe\xe4\x9a\xd3\x9a\x9b\xf1\xc9\xbf\x24\xaf\x15\x10\xf5\x58\x1c\xa8\xe4\xf5\xc2\xf7\x03\x9a\x97\xb2\x9e\x3d\x75\x06\x18\xe6\x3b\x91\x93\xe9\xae\xa3\x45\x2a\x3a\x72\xa6\x69\xf4\x01\xc3\xe8\x7e\x20\xbd\x03\xf8\x38\xa3\xa2\x4f\xa6\xa8\x17\xd3\x2e\x97\x5d\xc3\x1a\x57\x96\xa4\x92\x24\x6b\xf0\xdc\x86\xb1\x44\xb3\x3d\x7d\x0d\x7b\x0c\xcf\x5c\xb9\x62\x08\xa0\x56\x98\xde\x7d\x49\xb6\x07\x27\x6b\x93\xf0\x58\xd5\xe9\x75\xa5\x04\x70\x63\x78\x47\x60\x80\xce\x09\xe7\xf4\x50\x6f\xd4\x92\x33\x71\x61\xbf\x1b\x0a\x9a\xb6\x88\x76\x84\xb9\x50\xde\x84\xa1\x4d\xbe\x59\xe5\x18\x2b\x6f\x3a\x98\xeb\x84\x45\x0b\x9c\xbb\x57\x1a\xcd\x48\x7e\x77\xba\xb2\x9d\x36\x6e\xe7\xdb\x5f\xa5\xae\xd6\xe7\x3f\xea\x1d\x8a\x56\xce\x70\x91\x93\x16\x32\xc2\xd9\x0c\xeb\x62\x38\x06\x2e\x39\x2a\xb0\xea\x98\x3f\x35\x38\x0b\x91\x34\xdb\xac\x76\x94\x22\xb2\x64\x70\x75\x66\x58\x0a\x30\x87\x85\x30\x7e\x5f\x68\x8a\x05\x16\xaa\x1c\x77\x9d\x4b\x74\x24\xd8\xc7\x77\x99\x11\x79\x5e\x6e\xb4\xd2\x65\x97\xa1\xfb\x33\x3f\x11\x3f\xbf\x59\x5e\x55\x1c\x64\xef\x92\x5b\x5b\x1c\xd1\x98\x29\xa5\x21\x71\x32\x70\xdb\x2e\x30\xc1\x67\x56\x71\x9d\x6b\xf2\x2c\x3c\xb3\xa1\x43\x59\xb2\xa1\x6c\xdd\x1b\xce\x15\xc2\x8c\x81\xe0\xd6\xdc\x84\x8e\x7b\x14\x7f\xbe\xe1\x05\x6a\x28\xf8\x46\x21\xed\xb7\x8a\x37\x0d\x23\x68\x86\x8d\x01\x9a\x11\x22\xc9\x7d\xc3\xe1\x03\xa1\xf7\x6f\x15\x15\xdf\x15\x7d\xa9\xd0\x6c\x09\x9b\xad\xe5\x25\x52\xe9\x80\xa0\x66\x90\xb7\xf3\x7b\x81\x35\xc2\x52\x2c\x48\xdd\x62\x24\xa0\x9f\xda\x83\x23\xbb\x71\x20\x2c\x0e\x29\x00\x69\x3d\x1c\x92\x06\x06\x6d\x0e\xb4\x9e\x1d\x23\xb0\x86\x04\x41\x50\x6c\x82\xa8\x22\xf1\xc2\xab\x06\xed\xb4\x0a\x36\xfd\x69\xba\x9c\x21\xda\x6c\x5e\x94\x90\xd8\x65\x23\x5e\xb9\xd7\xf7\x92\xdd\x41\x03\xdf\x35\x0c\x80\x4d\x04\x57\x3b\xf0\xb6\x21\xd3\x34\x75\xad\x61\x40\x6c\xa1\xe6\x46\xc0\xf2\x3a\x61\x6d\xc1\x76\x2a\xe7\x5c\x47\xca\x84\xed\x9a\xc4\x1c\x09\x45\x6f\x41\xa3\x95\xa2\x3b\xb0\x49\x22\xb8\xb4\x3b\x92\x7b\x5b\xbd\x9a\xb8\xa9\x5b\x15\x0f\xee\x5b\x3d\xfc\x5a\x96\x54\x87\x87\xa2\xf5\x15\xde\x35\x6b\x92\x7b\x13\xb3\xc1\x8a\xe3\xbe\x2e\xa9\x87\xf8\xb5\xc0\x6d\x8a\xa3\x4f\xb0\x92\x1a\x5d\xa3\xb4\x9c\x5c\xf0\x54\xcc\x0f\xa8\x23\xa1\x9a\x4f\xc3\x8b\x44\x6a\xd8\x1b\xb1\x3e\xad\x44\x1c\x78\xf2\x04\xdb\xc8\x42\x64\xa6\x4a\xa7\x79\x3a\x4b\xa5\x5e\xae\xb5\x9a\x4d\xb4\x0a\x8a\x47\x5a\xcf\x8d\xcb\xaf\x98\x1f\xb9\x90\xdd\x0d\xa9\x8a\x58\x85\x77\x2f\x1e\x13\x98\x06\x74\x3f\xa2\x3c\xf2\x5b\x28\xa3\xa1\x94\x79\x80\x1e\x1f\xf8\xa8\x83\xa7\x8a\xbd\xc3\x80\xbe\xb3\xf2\x67\x6a\x0e\x9d\x80\x97\x3c\xc3\x2f\x0e\xd2\x4a\x29\xfa\xa0\x13\x8e\x87\xad\x7e\xfd\x35\xc1\x0c\xf0\x75\x0a\x7f\x6c\xa2\x3f\x8b\xeb\xff\x30\xd9\xb8\xd8\x50\x1e\x22\x5e\x0d\x52\xaf\x92\x9d\x27\xdb\xd9\xf2\xb3\xfc\x24\x91\x0d\xc2\xff\xb9\x35\x62\x3d\xaa\x2a\x0f\xb4\xc6\x52\xd2\xe2\xb4\x4a\x35\x71\xe4\xee\x44\x53\x4d\x45\x52\x4a\xa9\x8c\x52\x14\x61\x63\xd5\x62\x04\x97\xb4\x62\x78\x72\xf6\xe4\x57\x3d\x18\xa7\x26\xfc\x64\xdd\x42\xdb\x5a\x38\x5f\x36\x97\x3a\xd4\x2f\x0a\x48\x87\xb7\x91\x97\x8a\x57\xb5\xa2\x8c\x95\x52\xbc\xd5\x5f\x5a\x4d\xfb\x5b\x40\x23\xc5\x82\x15\xf6\x24\xcb\xf3\x63\xaa\x58\xa4\xa8\x5c\x40\xd5\x6a\xe5\x9e\x8f\xd8\x46\xdc\xc0\x69\x0c\x57\x8d\xda\x2c\x36\xbb\xb9\xad\xdc\x9c\x8e\x32\xb3\x91\xfd\xca\x80\x89\x16\x8b\x57\x06\x29\xf6\x57\x88\xa4\x3a\x75\x15\xdf\xad\xda\x76\x56\x4c\x6e\x59\xd3\xe2\xc8\xc0\x90\xe0\x35\x8d\x17\xb0\xb7\xba\xbd\x5a\x1e\x3e\xcb\x4e\xe0\x54\xfc\x27\xea\x1d\xb0\x65\xf2\x1f\x89\xd1\x96\x26\x7b\x49\xcf\x56\x15\x0f\xa6\xe0\xa9\xd1\x66\x56\xa1\xb2\xc5\x8f\x8a\x74\x5a\xa3\x5e\x01\x13\x98\xce\x96\xe2\x99\x27\x47\x82\x3b\x22\x6b\x23\x53\x02\xd5\x5e\x0f\x35\x8c\xeb\x4d\x97\x75\x39\x30\x01\xd1\xe7\xf8\xf5\x95\x1c\x4e\xfe\xdc\x23\x4a\x20\xe8\xe6\x5a\xd3\x4c\xf1\x76\x7b\xf9\xcb\xeb\x83\xc3\xe4\xc9\xd3\x67\x87\x7b\xac\x65\xdc\xfe\x53\xb5\x4d\x1f\x3e\x9a\xe4\xaa\x5b\x7f\xaa\xb0\x29\xbe\x38\x38\x90\xa4\x3f\xde\x4c\xee\xef\xec\xde\x27\x75\x01\xe9\x28\xf2\xe5\x2c\x79\x79\x94\xec\x2f\x81\xd4\xca\x6a\x2b\x41\x97\x30\x6a\x8b\x31\x99\x70\x5f\x50\x6d\x7c\x80\xf1\x4b\x95\xd9\x04\x0b\x15\x87\x5f\x8e\x25\x54\xe5\x14\xf7\x68\x4e\xe5\xff\xe1\x98\x3c\x3a\x7a\x3c\xa4\xad\x4b\xa6\xf9\x18\xc4\x1b\x71\x22\xe7\x8c\xa1\x08\xe9\x84\xc2\x1d\x85\xd6\x9f\x3d\x3d\x38\x7c\x71\x74\x88\x4f\xc5\x6c\xeb\xce\x9d\x1e\xae\x36\xd6\xeb\x18\xd7\x18\x1f\x87\xc6\xbc\xb2\x9e\x64\x8b\x7e\x0f\x3f\x52\x35\x48\x2a\x2e\x8e\x7f\xbd\x22\x25\x05\xa6\x44\x7d\x9e\xce\xd3\xd3\xac\x34\x3f\x00\xde\x84\xa0\xf9\xfb\x72\xdc\xd3\x62\x1c\x7d\x77\xc2\x25\xca\x71\x13\x81\xdb\xd2\xf3\xd7\x7d\xc3\x15\x89\x2b\xf7\x45\x64\x28\x0d\xd0\x12\x03\x66\x75\x1e\xa8\xbf\x0d\xbf\x75\xdf\x51\xb2\xe3\x66\x5f\x3c\xb1\xb6\xb6\xab\x1a\xf8\xcd\x31\xd5\xb4\x30\xea\x0a\x40\xaa\x2e\x97\x94\xfa\xdd\xb8\x8f\x1e\xcb\x56\x27\xe3\x69\x5a\xd9\xb7\xfb\xbe\xfb\x1e\x5e\xbc\x53\x64\x34\xc0\x17\xce\x24\xa1\x45\x88\xdf\x20\xd1\x33\xa0\xf7\xb2\x19\x7e\x77\x67\x07\xe1\x11\xf0\x8c\xf8\x15\x17\x21\x93\xa4\xee\xc5\x6c\x41\x09\x00\x0d\xc1\x59\xf2\x4e\xb1\xc2\x87\xd2\x4d\x95\x9c\x7b\x2f\x55\x39\x73\xe9\xaa\x1b\x52\x79\x7b\x87\x2d\xb3\xbc\x4a\xd3\x8c\xa4\x5b\xbc\x43\xd9\xb4\xb9\x5a\x3e\x47\xfe\xce\x73\x7e\xcd\x27\xe2\x8c\x5a\x15\xe5\x40\x9e\xfc\x72\xfa\xcb\xec\xd4\xa6\xd7\x2b\x78\xfa\x32\x10\xe9\xe0\xed\x82\x6f\x25\xc9\xef\x01\x1b\x20\x63\x56\x51\x2f\xca\x7c\x96\x96\xd7\x2a\xe5\x23\x05\xc8\x83\xf0\x57\xf7\x37\x8d\x76\x92\x0a\xd9\x54\xc9\x9b\x63\x84\x95\x55\xe3\x74\x81\xd2\xee\x9f\x97\x48\x26\xec\x29\x9f\xcf\x2f\x8a\x73\x31\x7e\xa5\x0b\xbc\x07\x4a\x0a\xb0\x0f\x67\xeb\x99\x8a\x69\xa9\xe1\x8a\xa8\x50\xe7\x74\x91\x53\xd9\x91\x93\x29\x41\xa5\x13\x76\x50\x00\x62\xcf\xd3\xf1\x38\x2d\xcb\x62\x8e\x9a\xca\x27\x58\xf5\x76\xb4\xc4\x04\xc1\x3e\x15\x1c\xbf\x7c\xfc\xb2\x8f\xde\x0d\x93\x74\x73\x2f\xa1\xa2\xe5\xac\xf1\x0c\x42\x3a\x8d\xbe\x86\xa2\x93\x4a\x95\xa3\xbf\x92\xa9\xc2\xd6\xf1\xf2\x57\x8b\x69\x7a\x8d\x8d\x2f\xf3\x31\x45\xae\x5f\x22\x29\xc0\x7f\x81\x35\xc3\x28\x25\x65\x03\xc6\x32\x61\x16\x82\x51\xe3\xf0\x65\x27\x23\x10\x31\xff\xef\x9f\x93\x3e\xe9\xfc\xd9\x87\xf9\x5a\x76\x48\x15\x08\xc8\xea\x6a\xb3\xab\x98\x0f\xac\x28\xf2\x8d\xa7\x13\x57\x43\x7c\x61\x4f\x6a\x22\xbf\x26\x73\x58\x1d\x56\xed\x4a\xa9\x35\xfc\x47\xa8\x78\x32\x30\x26\x15\x42\xaf\x27\x7f\x78\xa9\xd9\xed\x6e\x05\x45\x79\xec\xe8\x5a\x0e\x32\xdf\x79\x29\xeb\xd0\x46\x7a\x59\x98\x0b\x06\x43\x95\x30\x23\xa8\x2a\xe5\xcf\xe4\xc6\xc7\xef\xa3\x5f\x4f\x83\xbe\x53\xaa\x1e\xba\xb9\xe6\x40\x45\xdd\xad\xef\xd8\x38\xb4\x0d\xf1\x3c\xde\x70\xf5\x33\xbd\x7b\xd6\xf9\x43\x6b\x24\x34\x84\x69\x81\x62\x00\x2c\x1e\x3e\xa5\x5c\x59\x4e\xba\x2c\xd1\x04\x9a\x24\xdc\xe9\x11\x91\x60\x65\xf4\x97\x54\x31\x9b\xb4\xb8\x44\x44\x77\x24\xf7\xf7\x04\x84\x8a\xda\xda\xdb\x16\x78\xc9\x48\xc1\x29\x8c\xb3\x67\x0b\x34\x97\xe3\x61\xed\xae\xe4\x96\xbb\x2c\x48\xb5\x08\x24\x98\x9e\xc2\x60\x5b\x0c\x6e\x1f\x86\xe2\x06\xb0\x43\x63\xb2\xdf\x30\x66\x28\xe2\x22\x10\x0e\x8d\xe2\xfb\x1e\xe8\x96\xc3\xd6\x73\x32\x3f\x51\x1e\x6c\x3a\x9a\xd4\x91\x01\x46\xd7\xe8\x28\x5a\xe5\x64\x87\x65\x45\xb7\x4e\xd6\xa9\xa3\x44\x3d\x7a\x8f\x3d\xe6\x97\x95\x1c\x32\x39\x3c\x2c\x5b\xa9\x8c\xcc\x5b\xfe\xdd\x8f\xfc\xb8\xb1\xa9\xf2\x3d\x3d\xda\xc2\x74\xbf\xd4\x61\xab\x5a\x8e\xe0\xcf\x7c\x94\xf5\x5d\x4a\x7d\xd1\x37\x8a\xee\x7d\x6b\x04\x6b\xcf\x10\x56\x82\xb0\xd6\x68\xcf\xf4\x77\x23\x10\x46\x72\x17\x08\x2c\xd1\xae\x04\x60\x35\xd8\x4a\x57\xaa\x7b\xe9\xe5\x9e\xe4\x17\x72\x4d\x98\x4c\xca\x2c\x52\x1b\xd9\xe7\x8e\xaa\x81\x12\x9e\xc6\xb3\xb0\x96\xab\x82\x91\x29\x0b\x3c\x92\x24\xb3\x04\x17\xf6\x70\x3a\x2d\x46\x78\x81\x20\x20\x0b\x84\x6e\x38\x5d\x02\xc3\xde\x88\xf8\x12\xb0\x97\x22\xa7\x55\x85\x47\x60\x4e\x65\x10\x31\xda\x6d\xc4\x65\x32\xe8\x6c\xe0\xfb\x9c\xde\x01\x98\x33\xda\x01\xbf\xce\x6a\xb6\xce\x94\xd9\x10\x93\x56\xe7\x68\x54\x1a\x17\x25\x55\xa3\x73\xf3\x34\xde\xc8\x30\xd9\x4b\x58\xb1\xe2\xd2\x7e\xa5\xe7\x5d\xda\x04\xb7\x74\x44\x8d\xf1\x4b\xab\xf1\xa9\x28\x8b\x57\x3e\x33\x9d\x4c\xd0\x13\x29\x95\xb2\x1d\x6a\xdf\xb0\xaa\xf4\x6b\x49\x45\xf1\xee\x83\x19\xe8\x08\x40\xc3\x82\xa5\xa3\x04\x1f\x1b\x8e\xc6\xe1\x1b\x7a\x21\xf9\xad\x29\xf9\x04\xd6\x08\x38\x67\x03\x2d\x4b\x2a\xc2\x8b\x1d\x14\x46\x98\x4a\x4c\x66\x25\x7a\x53\x3d\xb0\xce\x18\xc7\x8f\x0e\x18\x14\xa5\xe5\xa8\xc8\x60\x61\xfb\x29\x1e\x8f\x01\x4b\xbd\x9a\x32\x72\x14\x25\xbb\x63\x19\x3b\x19\x71\x06\x72\xeb\xc8\x5c\xb9\x01\xe9\x78\x2c\x68\x23\x61\x96\xcb\x4c\x2f\x27\x48\x68\x55\xc0\x1b\x83\x4c\x2f\x74\xc8\x13\x14\xa0\x6d\x80\x12\x19\x2b\x50\x70\x20\x94\x49\x72\xb1\x9e\x00\xf4\x4c\x44\x63\x88\x75\x47\x01\x29\x0b\x84\x9d\x89\x5b\xc5\x0b\x79\x60\x1c\x17\x8b\x46\x65\x5b\xf3\x1b\xeb\xcc\x63\x84\xff\xf8\xe9\x1b\xab\x69\x31\x52\xa4\x61\x48\x8c\x8b\x1d\x88\xff\x34\x11\x3b\x21\x20\x1b\xff\xc3\x13\xa8\xce\x50\x02\x32\x6b\x10\x9e\x42\x6e\x74\x84\x6d\x10\x96\x7f\xb5\xea\x5f\xb7\x1e\x3d\x7b\x79\xf0\x73\x74\x1c\x2a\x0a\x2f\x03\x44\x31\xa5\xb2\xf1\x21\xaa\x07\x8c\x1e\xea\xeb\x80\xbe\xe6\xdb\x48\xe8\x94\x91\x06\xcf\xd1\x0c\xa8\x03\x9f\x2f\x97\x25\x96\xf7\x9b\xa3\x80\x85\x22\x04\x3e\xff\xc6\x74\x3b\x5c\xa3\xa4\x34\x2d\xe0\xae\x98\x04\x83\x3d\x42\x80\x07\x08\x88\xa8\x19\x24\xe5\x41\x02\xff\xb2\x54\x0d\x8f\x86\xe1\x88\xde\x3a\xc0\xc7\x5c\x8f\x8f\xc6\xa2\x65\x2a\x5f\x70\xa0\xb3\x71\xe0\x98\x14\xa2\x3d\xc0\xcc\x77\xa9\xb9\x36\x65\x89\x05\x7b\x7c\x96\xe5\xe3\x9c\xd3\x00\x10\x46\xb3\xeb\x97\xfe\x18\x8e\x83\xaa\x6f\xe3\x8c\xb4\xca\x64\xca\x9c\x1c\x9b\xb2\x58\xc7\x30\xc3\x4c\x42\x6c\xa0\x64\x81\x00\x8f\x10\x56\xcc\x47\x33\x19\x03\x43\x7c\x31\xf0\x72\xb1\x64\x7b\xde\x79\x76\x0d\xe2\x1a\x88\xc0\x3a\x3e\x33\x9f\xe7\x58\x2e\x04\xce\x1c\x89\xb3\x2c\x6e\x5b\xa1\x6d\xc6\xef\x2b\x3b\x31\x57\xb4\x3e\xd8\x5b\xf9\x1d\x15\x83\x5d\xbf\xf3\x29\x7a\x39\x7f\x49\x58\xb5\xfe\xfc\xb3\xc1\xb4\x41\xe7\x70\xdc\xd9\xd8\x68\xc2\xa0\xad\x9d\x98\x55\x03\xac\x0b\x2a\x33\xbc\xf5\xe5\xa6\x07\xe6\x53\x5c\x9a\x45\xb2\xaa\x54\xc5\x52\xb2\xb4\x26\x6f\x91\xd7\xd4\x8b\xe3\x4b\x41\x68\x72\x7c\xc5\xdc\x1d\xa3\x0c\xf8\x58\x85\xb3\x73\x0b\x02\x5f\xed\x2f\x27\x79\xb1\xba\xa8\x5d\x8a\xcd\x7a\xee\xa2\x75\x5d\x51\x47\x61\x9f\x9b\x70\x57\x97\x19\x52\x38\x3e\x3b\xb1\xa4\x62\xcf\x52\x07\x2a\x03\x6a\x0f\x19\xe4\x74\x58\x39\x99\x1e\xc8\xea\x1a\x21\xae\x7c\x9a\xcd\x31\xaf\x0a\x6c\x6c\x1f\x85\x2e\x93\x89\x09\xde\x30\x22\x5c\x9d\x15\x97\xf3\x4d\x6f\x2a\x2f\x14\xbc\x67\x79\x55\xfb\x17\xc3\x5b\xb9\x0a\x2e\x33\x1e\x65\x81\xb8\x54\x68\x31\xd1\x12\x95\x87\x93\x5a\xe7\xea\x1c\x38\xb1\x1e\xe0\x51\x26\x6e\x9a\x7a\xb1\x0f\x7c\xf6\xcb\x97\x9f\x7d\x19\x26\x15\xdd\x64\x64\x0a\x7e\x7c\x78\x70\x74\xe0\xae\x3f\xfc\x41\x34\x05\x2a\x13\x78\xc0\xb3\x48\x65\x36\xca\xeb\xca\xb2\xda\x06\x67\x2c\x1c\x0c\x27\xf4\x09\x60\x25\xca\x4b\x76\x7d\xb2\xb1\xdb\xc2\x2e\x54\xa1\x10\xaf\x3c\x77\xc3\x9a\x2c\xfc\x0d\x94\xde\x1c\x87\xaf\x54\xf7\xaa\x55\x27\xee\xa2\xf6\x10\x79\x73\xdc\x94\xbc\xce\x45\x63\x42\x9c\x4c\x75\xb5\xdf\x6b\x00\x46\xbd\xe2\x83\xf9\x89\x48\x65\x9a\x3c\x7d\xc9\x48\x9c\xa4\x63\x4f\x51\x24\xe1\x12\x24\x72\xe5\xe5\x84\x8b\x0c\xa1\xe7\x5e\x8e\x15\x34\xea\x24\xbb\xc2\x0d\x33\x15\x85\xc8\x47\x82\xed\x4d\x96\x5c\x6d\xf9\x55\xc6\x2d\x2f\x3c\xac\xec\xcd\xf3\xf4\x65\x30\x3f\x39\xf0\x74\xba\xd1\x37\x62\x7c\x3e\x9c\x00\x9f\x33\xc7\xbf\x72\x11\x1d\x8d\x9d\xcc\xe6\x28\x20\xd1\xd1\x7e\x0c\x5d\xc4\xaf\x4d\xc9\x0c\x7c\x7b\x80\x4c\xfb\x72\x2e\x01\x9c\x01\x3f\xa2\x51\x49\x56\x7e\xb4\x84\xfb\x7b\x1e\x70\x23\x73\x1e\x24\x0d\x13\x22\x61\xa4\x24\x96\xf8\xd8\x45\x65\x94\xc1\x69\xc9\x8b\xa5\xdb\x19\xc4\x88\x1b\xbe\xa5\x76\xc6\x4f\xc4\x1e\x04\xc6\x0c\x29\xc9\x5a\xcd\xf6\x51\xb6\x32\xe2\xb8\x37\x03\x60\x33\xc8\xbf\xf1\x15\xf4\xb1\xff\x1d\x5c\x7b\xf7\xbf\xd6\xbe\x08\xc6\xed\xc5\x48\x4d\x5e\x8a\xfd\xac\x7e\xc5\x6f\x64\xff\x0d\x4d\xb5\x2b\xcd\xeb\x3b\x66\x74\xd5\xa6\x02\x73\xb7\x99\x4d\x7c\x8d\x39\xee\xe0\x87\x4f\xfe\xfb\x42\xc7\x9a\x4b\x9c\xb4\x27\xab\x54\xb1\x57\xbe\x16\x45\xf0\x08\x01\x2a\x24\x90\xec\x25\x3d\xfa\x2f\x21\xf7\xe8\x70\xff\x39\x7e\x01\xff\xa1\xbf\x7f\x79\xf1\xf8\xf0\xf5\xb3\xa7\x2f\x0e\xe1\x4b\xfb\xb9\x17\xf3\x34\x0a\x2f\x11\x65\x05\x60\x36\x86\xcc\xc6\x78\xa7\xea\x37\x84\xcd\xe3\x87\x7c\x04\xb6\x53\xfb\x7d\xb9\x76\xe6\x6e\x4d\xad\x0f\x81\x2a\x69\xc2\x7a\x30\xc6\x80\x5f\x1e\x89\x32\xaf\xdd\x91\xe8\x96\x46\x9d\x93\xe8\x2a\x69\xd3\x90\xb7\x0d\x41\x60\x86\x76\x3e\x7a\xac\x04\x7a\x62\xa8\x20\xca\x7d\x67\x8b\x3b\x26\x57\x34\x42\xf7\x60\xd0\xf5\xad\x94\x27\xfa\xae\x19\x0c\x1d\xd1\xfe\x34\x43\xea\xf1\xa6\xf3\x57\xd7\xf5\xaa\x82\xa8\x7c\xad\x42\x32\xc5\x36\xd2\xaa\x2a\xc6\xa4\xc6\xc3\xd7\x2e\x71\xd2\x5a\x0f\x2c\x6a\x0b\x95\x48\x05\x98\x4e\x3b\x62\xa1\x5e\x0b\x13\x7d\xe0\x68\xb8\xaf\x34\xac\xc8\xbb\x11\x08\x49\xf2\xa4\x28\x2f\x91\xdf\x56\x58\x17\xc4\xa8\xb6\xb4\xf6\x4e\xc2\xf6\x39\x26\x77\xe2\xb2\x01\x90\x4e\x4c\x0f\x6f\xf6\x8c\x15\x6b\xb8\xf1\x28\x79\x39\xbd\x9a\xfd\x86\xd2\x79\xa1\x5a\xd3\x91\xa9\xe0\x63\xc6\x87\x87\xdc\xdc\xc4\x98\x56\x56\x45\xbc\x62\x63\x1d\x5f\xd0\x04\x64\xd9\xc3\xc0\x43\xab\x4d\xe1\x66\xff\x00\x0e\x45\x79\x6d\xfa\xdb\xef\xb7\xb7\x4f\x41\xac\xe9\x39\x6b\x64\xed\xd4\x79\x6c\x91\xbc\xe3\xe7\x19\x38\xa9\x74\x5c\x3e\x7f\x01\xc2\x04\x29\x89\xa4\xfc\xfb\x1d\xef\x47\xef\x5e\x69\x58\x0a\xfa\x01\x9a\xca\xf7\x9f\x41\xc3\xd3\xfa\xe5\x88\x0c\x2d\x65\xd5\x47\x66\x3f\x10\x5b\x68\x2f\x9d\xd6\xc3\xd3\x72\x88\x22\x44\x6f\xcf\x2d\xca\x85\x9f\xe9\xf0\x82\xd2\xdd\x40\x3f\x9d\xb5\x88\x52\xc2\xc0\x1d\x70\x9a\x82\x90\xbe\x35\x05\x8a\x5c\x02\x32\xbe\x39\x9a\x1c\x97\xb3\xf9\x70\x59\xf5\x74\x57\x58\x25\x34\x96\xce\x51\xb7\xec\x12\x19\x05\xde\x15\xb6\x19\x99\x8a\x86\x80\xa9\x6e\x7b\xc7\xeb\x43\x8b\x0b\x7b\x8c\x19\x3d\x68\x4c\x26\x75\x6f\x50\x84\x75\xd1\xb4\x96\x47\x47\x6e\xa2\x67\x13\x2b\x91\x41\x7f\xfb\x8f\x7d\xfc\xf5\x57\x72\x41\x00\xcc\x7e\xc5\x0c\xa7\xf4\xc1\x22\xbb\xf9\xef\xdb\x5b\x20\xdc\xd5\xb0\x96\x9b\x51\xb8\xf2\xa5\xbd\xe1\x8d\x64\x83\xea\xd7\x9f\xca\xe7\x9c\x0a\xe2\xc2\xd8\x8c\xef\xb8\xfd\x42\xf2\xac\x16\x40\x7a\xc3\xbc\x1a\xa2\x61\xdf\x7d\xd3\xb2\x87\xd1\x31\x1e\x99\x4e\x4f\xab\xe7\x00\xc4\xfe\xd9\x32\xaa\x8c\x75\x93\x11\x18\x70\x0b\xbc\x0a\x7d\x87\x86\x97\x20\x8e\x75\x10\x1e\x2e\x34\x0b\x94\xbf\x7e\x37\x04\x11\xf7\x57\xf1\xcd\x1d\xc2\x30\xed\x0b\xcc\x3d\x56\x2c\xf1\x11\x8e\xff\x16\xa5\xc1\x08\x7e\xf0\x82\x81\x9b\x7c\x88\xaf\x87\x21\xbd\x8d\x5a\x70\xc4\xc3\x8e\x46\x1c\xa4\x2c\xba\x61\xfa\xdb\x7f\x9c\xe6\xa3\xa1\x31\x0f\xee\xf5\xdf\x1f\xdd\xdb\xdc\xf6\x32\x80\x41\x7b\x4d\x96\x16\xb9\xd6\xa7\x53\x55\x8e\xa3\xe2\x4a\xcb\x3f\xda\x3c\x89\xce\x3e\x8f\xd3\x3a\xfd\xa5\x9c\xe2\xb8\xef\x76\x3f\x6c\xb6\x13\xfd\x9a\x98\x24\x17\x0e\x84\xbf\x6c\xf2\x1c\x1a\xea\xc7\x12\xad\x61\x27\x6b\xf9\xe2\x8b\x44\x3f\xa0\xa2\x6b\xd3\xfe\xd0\xf2\xd6\x45\xff\xbe\xa5\x1e\x72\x0f\x91\x25\x9c\xc2\x9d\x01\xef\x46\xc5\x44\xd8\x37\x67\xd5\x18\x3e\xe3\x02\x09\x19\x5a\x64\x7b\xae\x54\x29\xb9\x64\x7b\x23\x4b\x7e\x9c\x57\x0e\x01\x52\xdd\x4a\xe1\x52\x1f\x98\x38\xf1\x63\x17\x0a\x1b\x22\xbd\x53\xea\x12\xf6\xc3\x77\x28\xcf\x60\xa9\x6a\x8e\x24\xe2\xc2\xa5\x49\x9f\x3c\xee\xb1\xf8\xdb\xdc\x07\x58\xcc\xe9\x41\x61\x34\x40\x9b\x2c\x91\xe1\x45\x00\x94\x01\x42\xff\x9c\xcc\x27\x80\x0e\x96\x89\x6b\x54\xa3\x53\x90\x7c\xb0\xfb\x98\xcd\x8d\x54\xa7\x45\x79\x4e\xfa\x43\x93\x52\x18\x85\x1e\x93\xbc\x4d\xbd\x98\x53\xf8\x94\x4e\x8b\x53\x17\x53\xa3\xa0\xd9\x0b\x92\x24\x98\x34\xd9\xe0\x47\x50\x5d\x0c\x65\xed\x86\x6e\xf7\x36\x50\x2d\x5d\xb3\x76\xc3\xfc\x63\x92\xba\x81\x64\x32\xef\xb7\xd3\x1d\x59\x04\xf1\xb1\x65\xf3\xfd\x91\xa5\x86\xde\xf9\xbd\xf6\xea\x7e\xbd\x75\x74\x00\xbd\xcd\xd6\xdb\xe8\x46\x04\x6c\x1e\x48\xd1\x13\xe5\x54\x53\x43\xd2\x4c\xae\xe2\xbe\x70\x5c\x1f\xf9\xda\xac\xfe\xc5\xe6\x83\x56\x98\xf9\x0c\x6e\xec\x95\x30\xb5\xf1\x45\xc3\x7f\x8a\xbd\x3b\xe1\x93\x91\xe8\xb6\xe0\xc9\x00\xd6\x05\xdd\xa8\x53\x6e\x3d\xc2\x2b\x01\x10\x1f\x85\xaf\x58\xbe\xa6\x6e\x7e\xc1\xda\x1e\x74\xcf\x74\x5d\xae\x56\x96\x1e\xce\xd2\xc5\xd0\xbc\xda\xaa\xae\x5b\xd1\x09\x64\xf8\xa6\xbd\xb0\xe6\x5e\x38\x9e\x2f\x49\x25\xb1\x19\x4b\x2f\xc9\x87\xe5\x95\xf7\x8c\x50\x23\x53\xd9\x3e\xab\x76\x33\x46\xcd\x79\xfb\x41\xe9\xb1\xfa\x63\x0f\x5b\xa8\x4b\x41\xbb\xe8\x33\x49\xcb\x07\x9b\x60\x78\x2c\x99\xd8\x2e\x3c\xf1\x0c\x7e\x38\x9d\x02\x22\x56\x73\xff\xe6\x78\xcb\x46\xda\x3c\x4f\x17\x70\xc1\x2e\xaa\x77\xd8\xf7\xc3\x16\x35\x74\x03\x5a\xc8\x65\x36\xce\xf2\x0b\x76\x73\xbb\xe0\xb6\x3e\xfb\xa6\x8e\xef\x4c\x33\x4c\xa5\x26\xcd\xdc\x77\xcd\x63\x9d\xac\x46\x88\x4c\x3a\x7d\x82\xde\x76\x3b\xf2\xa3\x7f\x48\x36\x82\x35\xce\xb1\x52\xaa\xf7\xef\xde\x6d\x50\xa8\x86\x36\x24\x53\x43\x0b\x4c\x73\xcd\x2a\x1a\xd9\x2f\x4b\x60\x67\x5f\x7c\xe1\x6d\xab\x11\x9f\xdf\xed\x7c\x20\x09\x9a\x9d\x68\x7a\xad\xcd\x76\xbd\x66\xfe\x2a\xd7\xbe\xa2\xc3\xb7\x62\x5c\x34\x24\xfe\x86\xf4\x7e\x73\xa0\xef\x2e\x40\x2e\xf9\xd0\xf9\x96\x80\x6b\xe7\x09\xe6\x4f\x60\x23\x8d\x73\x12\x48\xd1\xd4\x57\xb2\x9d\x67\xbd\xb1\x94\x19\xc6\x27\x95\x70\x77\xd6\xe5\xd9\x07\xce\xb2\xd4\xe4\x45\x04\x64\xb8\x48\xe1\x85\x5b\x67\x9f\x89\x3f\x34\xbe\x26\x92\x58\x93\x6b\xc4\xf1\x51\x1c\x23\x25\xfa\x82\x33\xf9\xd9\x58\x87\xf3\xcc\xe3\xff\xbc\xe2\xd1\x93\x87\xfa\x97\xaa\x2e\xc6\xe7\x07\xea\x67\xf8\x61\x0e\x7b\xdc\xdf\xf4\xd2\xed\x7b\x67\xc3\x72\x0e\x74\xbf\x0e\x59\x12\x33\xa5\x1c\x5f\xfd\xe8\x87\xf5\x74\x5e\xf7\xf1\xdd\xf1\x40\x35\x40\x80\x79\xf5\x22\x7d\xd1\xcf\x37\x71\x51\x73\x0c\x8a\xe5\x0f\x3f\x26\xf7\xbf\xf9\xc6\x07\xe7\x67\xa3\xed\x3d\x9d\x5f\xa4\xd3\x7c\x22\xa5\xcf\x31\x1b\x07\xe3\xcd\xcb\x82\x18\xdd\x4b\x7a\xb2\x46\xef\xe0\xcf\x0f\xde\xd0\x61\x42\xd9\x60\xc9\xec\x74\xdf\xe5\x1f\x42\x2c\x88\x55\x9e\x8e\xfc\xe5\x9b\x17\xe5\x8c\x74\xae\x07\x47\x47\xdc\xcb\x1f\x0d\x81\x41\xa7\xcd\x60\x47\x5b\xb6\x06\xfa\x63\x56\x9d\xd3\x91\x8f\x5c\xf8\xe9\x53\xe3\x8d\xe6\xfb\x08\x51\x34\x83\xf3\x5a\x64\x3e\xab\xf7\xb8\xbf\x19\x02\x08\xbd\x97\xd6\x00\xd1\x38\x71\x8b\xeb\x21\x88\x90\x6c\x58\x5b\x75\x7e\x03\x5d\x3b\xf0\xea\x00\x1c\x2a\xf9\x45\xed\x3c\x64\x15\xfa\x10\xfb\xac\x82\xdb\xa2\x4f\x6f\xc2\x27\x95\xfa\xd0\x5a\x01\x87\xe4\xb0\xb0\xd6\x10\xed\xca\xf8\xc8\x28\xa8\xea\x58\x4c\x97\xd5\x10\xfa\xc2\xbf\xff\x3b\x2b\x8b\x21\x86\xc8\xae\x2d\x12\x21\x84\x57\x00\xe0\x39\xf6\xff\x2f\xe8\xfe\x5f\x05\xe5\x84\x8a\x8e\x34\x5e\x6b\x02\x1e\xec\x03\xc1\x3d\x0a\xef\x62\xc8\xde\x42\x37\x01\xc8\xd1\x1a\xfa\xca\x6a\x93\x29\x0f\x6c\xeb\x26\xff\xce\xe0\xeb\x61\x5a\xe5\x29\xec\xcc\x6c\x94\x9f\x2e\xe1\xad\x05\x7f\x0f\xeb\xcb\x02\x2f\x88\xe5\xac\x4d\x80\x65\xbf\x62\xa0\xd7\x53\x40\xe8\xe0\x4f\xe7\xfb\xa6\x77\x64\x8e\x6c\x16\x1a\x92\x92\x64\x88\x7c\x01\xd0\x5b\x35\xd7\x8b\x5a\xac\x49\xdf\x3d\xca\x29\x62\x08\xfa\x44\xb7\x5e\x80\x8f\x8a\x69\x9b\x1e\xc4\xad\x0b\xbc\x27\x1f\x41\xbb\xa3\xf4\x24\x3b\xaa\xd3\xc8\xe1\x52\xc0\x70\x15\x46\xa4\x30\x5b\x05\xb6\x9b\x29\x30\x48\x1c\x76\xbf\x7a\x54\x4a\x35\x7a\x3b\x8d\x1b\xb0\x86\x6e\x40\xe1\x14\x6c\x50\xf3\x10\x3d\x3b\x56\x92\x96\x5d\xee\x03\xd3\xef\x2d\x76\xeb\x1a\x61\x92\x8d\x77\xef\xaf\x0d\xf7\x31\xb6\x8e\x82\x3b\x81\xcd\x1d\x9e\xa4\xb3\x7c\xba\xf2\x44\xe1\x06\x3e\x81\xe6\x4f\xa8\x75\x63\xf7\x08\xd2\x5a\xcf\xba\xac\x46\x30\xf1\x47\x1c\x43\x99\x15\x9c\xfe\xe0\x37\xa3\x64\xdc\x33\xd6\x96\xb7\x9e\xf8\x1e\x1d\x4d\x04\xcf\x8a\x59\x86\x3a\xc6\x6a\x28\x6e\x8a\xeb\xb2\x0d\xec\x88\x8e\x1e\xd6\x2e\x1b\x6e\x05\xb6\x44\xd9\x73\x7e\xda\x26\xc1\x45\xde\x92\xd2\x81\xf9\x75\x20\xce\xc0\xd3\xa0\x21\x3d\x05\xb2\xe0\x7a\xcf\x43\x12\x82\xfb\xbd\x43\xfc\x0f\x0a\x23\x0a\x53\x65\x19\xda\x4b\x0e\xaf\x16\x1c\xf9\xce\x32\x5c\x6f\xb5\xf4\x56\x97\xd7\x31\x9d\x48\x73\x7e\xe9\x64\xf2\x48\x3e\xf7\x95\x96\x31\x19\x93\xf1\xae\xaf\xa3\x3f\x6f\x8e\x37\x8a\x51\x2a\xb7\x7f\x20\xb1\xcf\xd2\xab\x21\x1b\x0d\x86\xc6\x75\x61\x8d\x83\x07\xbd\x38\x62\xef\xc8\xb8\x3b\x34\x77\x9c\x4a\xde\x31\x31\xa5\x65\x36\x3c\xc1\x4f\x6b\x6f\x3d\x75\x46\x82\xda\x2f\xb3\x27\xf8\xdf\xe8\x00\x75\x2a\x7a\x0a\xd1\x7c\xaf\x0f\xbd\x4e\x49\x3f\x71\xc8\x4e\x1b\x11\xd8\xe4\xa2\x40\x57\xe7\x90\xd5\x70\xeb\x9c\xd6\xe7\x81\x8b\x41\xe3\xcc\x2e\xd2\xd3\xdb\x9d\x2f\xec\xd8\x79\xbe\x30\x5d\x0a\x9a\x5f\x86\xf2\x86\xbc\xa1\x51\x0b\x25\xe3\xa2\xba\x72\xee\xad\xce\xc2\x85\xda\xd7\xfd\x53\x8c\x64\x14\x4d\xff\xf3\x74\x8c\x61\x4d\x7f\xd8\x76\x07\x92\x5e\x99\xcf\xb2\x3a\xd9\x07\x0c\x76\xb7\xb6\xbe\x97\xf4\x2d\x92\xe4\x44\x12\x8b\xf4\xd1\xa3\x46\xee\x5b\xf2\x20\xbd\xcc\x01\x20\x25\x3c\x2e\xe6\x1a\xd2\x1c\xa4\x39\x1c\x21\xa9\xae\x61\x2d\xc9\x8f\x90\x32\xab\x93\x3a\xc2\x3c\xb8\x8a\x45\x36\x67\x8d\x07\x3e\xbd\x16\x0b\x83\xb9\x9b\x13\xe6\xcb\xbc\x8b\xb3\xfa\xe2\x0b\xd1\x64\x70\x93\x63\x4c\x2d\x74\x17\xde\xdb\x98\xb3\x62\xd1\xdb\x6c\x1e\x5c\x7b\xff\xc2\x2c\x60\x4a\x2f\x38\xb0\xa6\x65\xd5\x49\xce\xfa\xfb\x2e\x3b\xca\x61\xff\x6a\xeb\x8e\x73\xea\x5e\x78\x62\x00\x7f\xdf\x85\x47\x43\xdf\x67\x58\xf8\xcf\xb4\xe8\xbf\x79\xcd\x71\x3a\x6b\xac\xf9\xc5\x0d\xf8\x16\x03\x7d\x13\x81\x27\x9a\xc7\x21\x16\x30\x9a\xb4\xcb\x43\x72\x9d\x6f\xff\xb1\xbf\xac\x4f\x86\xdf\xfd\x5a\xa6\x97\x9b\xff\xbe\xbd\x69\x6d\xa0\xfa\x8d\xef\x2b\x6f\x7c\x3d\x03\xaa\x3c\x36\xc2\x31\x37\x9a\xaa\x18\xb6\xa5\xd2\x58\xce\x66\xe6\xd4\x0b\xfa\x1a\xb4\x8a\xe4\x43\x01\x17\x99\xa5\x24\xd2\x83\x93\x65\x5d\x76\xd7\x53\xdc\x07\x9e\xb3\xed\x70\xd9\x2b\x78\x5d\xa0\xce\x5b\x37\x0e\x71\x04\x6f\x6a\x71\x59\x5f\x43\xa2\x0c\x83\x8f\x9b\x22\xa5\x4e\x24\x38\x44\x57\x99\xa1\x8b\xb7\x5d\x7b\x80\x66\xb8\x6f\x64\x20\xb8\xd0\xff\xa6\xb4\xe4\x0d\xf8\x1b\x08\xc9\xbd\xbd\xd7\x21\xa7\xb3\xfc\xa4\x1e\x72\x38\xcb\x0d\x9f\xf6\xd4\x95\xab\x7b\x05\x0f\x7c\xad\xb2\x29\x87\xe3\x6a\xa5\x9c\x16\xa8\x01\x7e\x81\x6e\x07\x95\x93\x5d\xa9\xee\x65\xc3\x99\x07\x7d\x1b\x27\x47\xec\xd9\xde\x4c\x4f\xa0\x1b\x92\xc5\xf1\x7a\x7f\x3a\xb5\x32\x3f\xee\x9b\xe7\xa6\x24\x18\xe9\xef\x24\xcf\x4b\xd3\x51\xd1\x4f\x31\x5c\x05\x3e\x5f\x95\x71\x8c\x67\x8f\x3d\x4e\xdf\x35\x3f\xc9\x4f\x4d\x6d\x4b\x3f\xf0\xa9\xcb\xd3\xea\x14\x3d\xad\xd0\xdd\xbf\x2d\x83\xb2\x9a\xa4\x5f\x16\x8a\x1e\xb2\xc8\xf8\x31\x08\x0f\x3f\x8e\x30\x64\x27\xc3\xe7\x06\x27\x41\x40\x4f\xa5\xd5\x7e\x5e\x8f\x4c\x2f\xb3\xc1\xad\x99\x00\x8c\x67\xf4\xd6\x28\xec\x42\x2d\xa3\x69\x0b\x38\x48\xc4\xb8\xf1\xd9\x28\x91\x2f\x25\xa3\xd9\x75\xb1\x54\xe9\x17\x00\x1b\xe3\xb4\xbf\xc8\xca\x2a\xaf\x30\x74\x18\x03\xac\x5c\x2e\x3f\x5e\x88\x41\x52\xa6\x12\x3e\x9d\x72\x5d\x2a\xf6\xee\xb3\xee\x92\xab\xa7\xad\xec\x08\x7a\xce\x84\xaf\x5f\x66\x48\x07\xb2\xd0\xcf\x0f\xee\x34\xe3\x71\x24\x3d\x42\x10\x1f\xb1\x4e\x8f\xa2\x9c\x64\x65\xd0\x3a\x9e\xe3\x3a\x08\xf0\xe1\xa5\x4d\x29\x5b\x23\xa7\x42\x59\x49\x69\x2d\x93\x6e\xd2\x9b\x9e\xf6\x0a\xaa\xe3\xb8\x0b\x4e\xa7\x4d\x45\xc1\x54\x8a\xa1\x79\xe8\x98\xbd\x62\x53\x8e\x5c\xd9\x42\x84\x3d\xe9\xa2\xc6\x36\xef\xee\x76\x5a\x74\x9b\xc3\x6b\xf7\x0f\x41\x87\x8f\x1a\x14\xd3\x4a\x8b\x91\xe0\x9b\x36\x9b\x04\x77\x7d\x70\x27\x1a\xd1\x1c\xaa\xf2\x9c\x8b\x78\xe5\x25\x66\x0f\x83\x79\x06\x71\x34\xda\x83\xa1\xff\x6a\x03\xb5\xba\x29\xb0\x8e\xca\xcc\xbe\xfb\x18\xb9\x48\x9a\x36\xba\xc0\x7c\x48\x13\xe1\xef\x44\xe4\x36\x28\x9e\xf3\x2f\xc4\x43\xc6\x28\x16\x22\x53\x41\x10\x26\x85\x67\xf5\xd1\x45\x41\xac\x38\xa8\x1d\x54\xd1\x3c\xac\xe1\x3a\x45\x89\xdf\xad\xf1\x3f\x10\xf1\x07\xca\xc5\x2e\xe2\x8f\x44\x96\xfd\x5f\xe2\x8f\x29\x68\x6f\x48\xfc\xad\x74\xf1\xf7\x23\xfe\x0e\xaa\x68\x12\x7f\xb8\x7c\x7e\x42\x59\x8a\xc0\x93\xba\xb4\x46\xb5\xcb\x0e\x82\x76\x01\x24\x9c\x97\x6b\x69\x2e\xe7\xb6\xe8\x6a\xca\x41\x07\x14\x63\x50\x9e\x72\xe4\xb7\xbb\x67\xe3\xce\xfa\x02\xeb\x80\x72\x86\x50\xdc\x59\x90\x22\xa6\x39\xee\x56\x2c\xea\x00\x06\x64\x5d\x29\x01\x09\x86\x77\x99\x8e\xa5\xee\x9f\x03\xd4\xb1\xae\x30\xb5\x03\x8d\x9d\x77\xd4\xdc\xf7\x03\x37\xb6\xab\x99\x90\xcd\x2f\xf2\xb2\x98\xcf\x54\x9a\x3c\x91\xba\x61\xb7\xfa\x3d\xf5\x73\xcf\xe5\xab\x66\x27\x15\xdd\x15\x55\x0a\xa2\x08\xa7\x4c\x6b\x1a\xaa\xa8\x5b\xe8\x60\xf8\xc3\x49\xd4\x5c\x24\x73\x99\x84\x6f\xf1\xf6\xb1\xd7\xbf\x9e\x8a\x39\x65\x7f\x71\x53\xda\x53\x2b\x8b\x11\x4e\xca\x57\x38\x2f\xf6\x4c\x64\xda\xd6\x62\x59\x9d\xf5\x37\xdd\x6f\x0a\xa1\x3d\xfd\x87\x6b\x01\x12\xcb\x55\x5e\xef\xe9\x35\xf5\xeb\x16\x4b\x96\x33\x04\x5e\x2c\xfa\x9e\xbb\x00\xfd\xb0\x9c\x13\x79\x4e\xa7\x36\x3e\xaf\xe1\x3b\xc1\xa9\xd4\xd4\xba\x8f\xa7\x70\xd4\xf0\x35\x9f\xc1\xd8\xbd\xcd\xd0\xdb\x40\xd4\x3d\xd4\xaa\x1f\xf3\xc0\xd4\x35\x83\x62\x83\xeb\xf5\x45\xfa\x89\x16\x35\x13\xaf\xd1\xfc\xc4\x63\x2f\x26\xb7\x8a\x79\x38\x71\xfe\x1e\xfe\x76\xc0\x6e\x9c\xae\x72\xec\x0a\xca\xcd\xab\x57\x9a\x83\x77\xb3\x03\x9b\x45\xa5\x25\x8d\x8a\xc2\xff\x29\xcf\x99\x30\xf4\x42\x28\x4d\x46\xe6\xc6\x33\xce\x8f\x5c\x92\xa4\xd2\x9e\xf6\x8e\x22\x7a\xaa\x2c\xe3\xac\x01\xd7\x2e\xe4\x1a\xef\x55\x4e\x35\x5d\x73\x09\xdc\x35\x85\xe2\x60\x63\x9a\x93\xf7\x22\x3d\x1b\xfb\xd8\xb8\x30\xd0\xc9\x5d\x02\x94\xfb\x9b\xf0\xf8\x98\xa0\x8f\xce\x27\xbb\x26\xbf\x18\x32\xbc\xc1\xaa\x74\x60\xdf\xa0\xea\x9b\xe2\x4f\x4c\x41\x23\xe8\xc4\x19\xc9\x52\xd3\xbe\x53\x07\x38\x0d\x6d\x5b\xdd\xd9\xe4\xb8\x79\x94\x66\x84\x77\x9a\x70\x4d\x0b\xce\xdb\x66\x83\xaa\xad\xfb\x90\x90\xe3\xe7\xb5\xc5\x80\xcc\xbb\x4a\x2f\x10\xde\x0c\xac\x68\xfe\x94\x2c\xae\x38\xc7\x49\x56\xe5\x25\x5d\xa9\x32\xda\x20\x5e\xf6\xaf\x4d\x58\xe2\x79\x78\x11\x59\x57\x2e\x75\xe6\xe2\x8a\x9c\xf7\xa5\xce\xc0\xe2\x2a\xc6\xaa\x9d\x4d\x7a\xd3\x2b\x60\xe5\x0b\x14\xb2\x5e\x8b\x2b\xc7\xcd\xb1\xdd\xe5\xf8\xa0\xaa\x5e\x2f\xa7\xae\x80\x6b\xf0\xb5\x3c\x69\x2f\x25\x24\xb0\x01\xdc\xaf\xe8\xc4\xcd\xbe\x4c\xee\x2b\xcf\xb7\xde\xff\xcf\xde\xbb\xf7\x37\x91\x9c\xf9\xe2\xff\xfb\x55\x34\x93\x5f\x22\x09\xe4\x8b\xcc\xc0\x30\x66\xc8\x1c\x63\x0c\xe3\x0d\x60\x8e\x6d\x86\xec\x61\x38\xa4\x2d\xb5\xed\x5e\x24\xb5\x56\x2d\xf9\x92\x0d\xfb\xda\x7f\xf5\xdc\xaa\x9e\xaa\xae\x6e\xb5\x19\x26\xc9\xe6\x73\xf8\xec\x66\x40\x5d\xf7\x7a\xaa\xea\xb9\x7e\x9f\xd9\x35\xea\xbd\x3c\x74\xd3\x17\xa2\x4b\xe0\xcb\xc5\xdb\xac\x55\xac\x44\x75\xcd\xa2\x97\x86\x3e\x20\x76\x01\xfc\xfb\x2e\x3a\x0c\xf2\x14\x68\x37\x10\x32\xca\xdf\x7a\x28\xce\x96\x1f\x61\xeb\x0d\xbf\x9b\x7c\xa3\x7c\x16\xbe\xb9\xf5\x19\xf5\x5d\x06\x6a\x0e\x68\x84\x44\x78\x58\x71\x12\x63\x07\x8a\x5e\x8b\x58\x9c\x1a\x1a\xb5\x1e\x0f\x1a\x9a\x28\xe6\x31\x53\x59\x94\x58\xdc\xb6\x97\xed\xab\x6a\xa8\xc5\x23\xdc\x47\x56\x6f\xb9\x28\x28\x43\x04\x5c\xe1\x90\x99\x99\x51\x13\x56\xed\x71\xcc\x96\x5b\x5d\x4c\xc4\x55\x97\x6f\x95\x99\x47\x2c\xc8\x21\x3f\x25\x95\xab\x9e\xbf\x75\x01\xeb\x54\x83\x9e\xff\x08\x20\x3c\x85\x64\x35\x98\xb2\x7e\xe9\xfe\x79\x30\x78\xfc\x4b\x79\x4f\xc5\x67\xa1\x4a\x1c\x6a\x1a\x26\x0a\x62\xa5\xb6\xc9\xc1\x79\x6f\x7e\x78\xbc\x72\x3c\xdb\xd8\xbd\xf6\x39\xae\x2b\x79\xbf\x72\x13\x44\x74\x9e\x90\xcc\xde\xdb\x5d\xe5\x34\x45\xdb\x5a\xd9\x53\x68\xe9\x36\xdb\xea\x91\x5c\x7c\x4f\x9d\x37\x54\x9c\x41\x76\x4e\x61\x76\xfd\x54\x95\x3b\x81\xb5\xb1\x85\xd8\xea\x75\xe8\xfe\xf1\xd8\xd5\x6f\xef\xc0\x15\x69\x21\x42\x28\x24\x62\xeb\xc4\x69\xfa\x52\xe0\x8c\x21\x91\x74\x1f\x94\x4a\x60\x3c\xba\x55\xcd\x8e\xac\x15\x37\x90\x97\xb2\x09\x40\xac\x76\x24\x1b\xd9\x7f\x2e\x0d\x2f\xd9\x95\xf6\x1d\x71\xba\x0a\xb2\xa8\xbe\x6d\x06\xe7\xad\x42\xb3\x99\x9e\x46\x3b\x09\x8e\x13\x4e\x1a\x94\xb8\xa2\x34\x6e\xe6\xd1\x47\x28\xbd\xa8\x93\x76\x07\x99\x3e\x1a\x14\x06\x81\xdb\x67\xc1\x0c\x7b\x27\x5e\x67\xd5\x5d\xef\xe0\xe7\x6f\x4b\x0b\x6e\xe2\xad\x35\x13\xb5\xf5\xab\x2a\x84\x94\x10\x2d\x8a\xb3\x98\x42\xda\xa6\x4f\x14\x2e\x88\x1f\xb6\xff\xa2\xd3\x85\x09\x09\xc7\x9f\x91\x13\xa2\xbf\xb3\x46\x00\xe0\x7a\x08\x77\x50\x12\xac\x48\xc3\xba\xc5\xa6\x43\x9a\x5e\x66\x8c\x1b\xd3\x46\x38\x60\xed\xb6\x84\x34\x81\x84\x34\xb5\x4f\x49\xd3\x23\xee\xc3\xc2\xb6\xeb\xcb\x5f\xeb\x15\x7d\x94\x4d\x7d\xf8\x2d\x45\x10\x9a\x17\x61\xd5\x58\xdf\xf5\x2a\x21\x2f\x97\xcf\x59\x8a\x3a\x8b\x74\x06\x46\x57\x8b\xb5\x17\xb2\xd8\x76\x87\x85\xd1\x3d\x69\x6e\x6f\x35\x9f\x04\x7e\xce\xcf\xa9\xef\xd6\x7c\x92\xcf\x56\xfe\xd5\xb6\xe0\xab\x82\x10\x07\x82\x66\x91\x2f\xc6\x0e\x3d\x59\xe6\xd4\x29\x9d\x83\xc4\x0a\x4e\x9c\x9c\xcc\x4f\xb0\x19\xbd\x41\xf0\x03\x0d\x35\x00\xfc\xdb\x58\x70\x59\xfc\x6f\xb0\x11\x88\x7d\x47\x68\x19\x98\xcb\x00\x52\x60\x21\xca\x51\xdd\xb1\x62\xe1\xc2\x3f\x55\x5c\x18\x36\xc0\x62\x27\x91\xb4\x03\xcd\xaf\x52\x0e\x51\xa9\xea\x19\xa2\x56\xdd\x3b\x37\xc7\x7c\xed\x94\xd4\x75\x38\x4e\x27\x33\x2e\x01\x69\x0d\xfa\xc9\x56\x5f\x13\xa4\xce\x83\xb9\x9e\x0c\xec\x63\x40\x8e\xdc\xf1\x66\xe8\x5b\xb4\x25\x12\x17\xa4\x21\x8f\xf0\xad\x39\xcf\x46\x29\xe2\x70\xa8\x31\xfb\x26\x78\x5d\x24\x7f\x94\x71\xd8\xd4\x3b\xfe\xf7\x27\x4f\xa4\xc0\x1f\xfe\x20\x9f\x04\xfc\xdc\x7b\xa7\x6b\x2e\x15\x29\x6b\xd1\x7a\x02\x56\x66\x0f\xfc\x53\x95\x51\xd4\x90\x9f\xad\x72\x36\x4e\x57\x19\xf3\xd0\xbd\x95\x26\x7d\xe8\x7a\xaa\x61\xdd\x57\x8c\x8f\xa3\x6a\x7d\x46\xba\x54\x63\x23\x7c\x9e\x96\x26\x55\x81\xea\x71\x86\x3b\xf8\xa1\x62\x52\xb5\xd0\x83\xf8\xd9\x6e\x29\x50\xa2\x91\x21\xa9\x29\x4c\xc3\xf2\x39\x26\x80\xb5\x1c\xd4\x79\xed\xa0\xea\x4c\x9e\x34\xac\x98\xc6\x81\xe8\x2f\xc0\x53\xec\x13\x5e\xa5\xbc\x5b\x6f\x0f\x2c\x7e\x4e\x9b\x5b\x84\xc4\x64\x6d\xf2\x30\xf4\x86\x49\x7b\x9d\x54\xaf\x7e\x0c\x9d\xd2\x08\x57\x2d\xbf\x0c\xe5\xee\xce\x60\x6b\xeb\xf7\x9d\x28\x23\x57\x57\xe5\x55\xba\xb8\xd8\x18\x66\xf9\x38\xcc\xcc\xdc\x2c\xbb\xcb\xc9\x51\x63\xbc\x17\xa9\x4a\x0f\x82\xf5\xfb\xc1\x89\xbf\xb9\xee\x41\xc8\x16\xcb\xfb\x55\x1c\x2b\xd5\x66\xdd\xad\xa2\x2f\x02\x4a\xfa\x7e\x0c\x19\xe7\x3c\x3a\xff\x58\x23\x37\xf3\xbd\xf4\x15\xb7\x93\x12\xfb\x26\x7e\xde\xf6\x60\x33\xe5\x97\x55\x3b\x79\x21\x6d\xdd\x62\x2b\xa5\x4e\xbb\x0d\xe4\xd2\x77\x13\x3b\xa4\xa6\xcd\x88\xde\xc5\x7d\x5b\xf7\x4b\x36\xe2\x59\x26\x90\x06\xd6\x22\xa2\x61\xa6\xf9\xb1\x6b\x7c\xb3\xdc\x00\x6b\x4e\x91\x1a\x61\xf4\x3c\xf9\x29\x32\xdd\xcc\x14\xe0\x10\xf7\x42\x99\x9e\xbd\x13\x6a\x91\x8a\xec\x0a\x46\x9a\x63\x42\xad\xb4\xc7\x59\xa0\xbb\x6a\x05\xd7\x38\x49\xd2\x74\x84\x96\x0c\x7f\x55\xc0\xe4\x33\x5e\x9e\xe7\x53\x05\xa0\xe7\x41\x7d\x95\xd5\x43\xa3\xda\x6e\x5e\x77\x3a\xcc\xfe\xc2\xc7\x14\xa0\x00\x40\x83\x30\x87\x02\x91\x36\x82\xb4\x7d\x55\x78\x34\xaf\x3d\x68\x0b\x10\x02\x51\x48\x5a\x02\x3e\x61\xb2\x2c\x29\x29\xac\x24\x92\x44\xc4\x0f\x65\x4b\x06\xa5\xa8\xc5\xc9\x36\x37\xf5\xa9\x4d\xec\x4b\xc9\x7a\x31\x26\x5e\x27\x36\x04\xb3\x9d\x87\xce\xa1\x52\xef\x46\x72\x88\x9b\x97\xf6\x4c\xab\xe0\x69\xc0\x32\xf1\xa3\x6c\x7c\x83\xb9\x69\xfd\xbc\xd9\x80\x96\x8f\x99\xa9\x31\x0a\x1a\xc1\x40\xbc\xcc\x9f\x9c\xa1\x56\x52\x2e\x16\x80\xe7\x06\xcd\xb1\x0f\xcc\xb0\x98\x43\xae\x04\xce\x99\x72\x93\x2d\xdc\xba\x41\x66\xb2\x0a\x14\xe4\x45\xbe\x58\xa5\x12\xf6\x48\xf3\x56\xef\xc8\x0f\x56\x4b\x0c\x16\xfd\x2b\xa4\xb7\x7d\x0a\x0d\x31\xe2\x42\x36\x99\x2d\x18\x60\x16\xda\x4f\x4e\xd3\x11\xad\x10\xb9\x2b\x56\xce\x80\xcd\xc1\xbb\x87\x5f\xca\xe4\x89\xf7\x20\xac\xfb\x6c\xc8\x39\x3f\x7c\x5d\x5f\x01\xed\x73\x79\x5e\x0b\x51\x76\xcf\x7d\x8e\x1f\x4a\x6f\x40\x7f\x34\xd3\xe5\x9b\xd6\x2a\xb3\x03\x28\xe9\x9e\x77\x6d\x56\x31\x13\xeb\xb8\x51\xdd\x4f\xaf\xa2\xd9\xb2\x21\xd3\xb9\x68\x3e\x2c\xe2\xf6\xc6\x38\x9b\x9e\x13\x43\xfb\x18\x22\xa0\x21\x27\x70\x92\xaf\xaf\xfb\x8e\xe8\x7e\x1d\x08\x14\xfe\xc1\xdb\x00\xab\x59\x38\x35\xbb\xf5\xc9\xa1\x38\xf9\x5d\x29\x93\xe3\x67\xef\xf9\xa8\x59\xd1\xf8\xa5\xb8\xea\x1a\xe1\x27\xe5\xeb\xdd\x23\x7e\x83\xff\x13\x2e\x12\x1a\xf1\xff\xd4\x9b\x84\x1f\xa5\x96\x2c\xcc\xed\x2f\x11\x5a\x1d\xba\x45\xfc\x87\xcf\x5e\x21\x00\x5d\x0f\xb1\xf0\xd2\x49\xf5\xf2\xa0\x41\xd6\xdc\x1e\x96\x6f\x92\x06\x6c\xeb\x43\x11\x6d\xa9\x8a\x55\x18\x75\x83\x2b\x03\x07\xf0\x83\xbb\x2f\xe0\x49\x26\xb3\xf3\xb9\xd9\x88\x72\x02\x10\x9c\x0c\x7f\xe1\xca\xdf\x7d\x92\xac\x73\xba\xc1\xab\x0b\xc0\x4c\x74\x6d\xf9\xf8\x67\xe3\xb4\xc4\x74\xaf\x2e\x97\xea\x11\x0f\xd4\x50\xe7\xba\xa4\x2c\xa4\xe1\x48\xd9\x75\xcd\xca\x59\x78\x7f\xb9\x3e\x40\x4c\xb5\x12\x78\xdd\x75\x60\x6f\x12\xea\x10\xd3\x19\x72\xf3\xbd\xc6\x2b\x44\xd6\x7d\x86\x69\x52\x9d\x13\x81\x9d\xde\xfa\xba\x5c\x2b\x6b\x32\x47\x32\x28\xf8\xd7\x0b\x78\x91\x43\x71\xb5\x2e\x8f\xd7\x02\x2e\xd5\x4d\x0d\xdc\x2f\x36\x40\xf3\x74\xd3\x8d\x7d\x07\x17\x95\x9b\x9e\xcb\x2b\xfe\x2e\x4b\xfe\x03\x32\x14\x0a\xaa\x26\x66\x54\xb0\xd0\x9a\x80\xfe\xef\x25\x49\x81\x14\xfd\xf6\xc0\x2f\x67\x23\x73\x8a\xa4\x25\x25\x5c\x2a\xbe\xdf\xa9\x06\x48\xfb\x81\xb2\xd2\x24\xbd\x56\xaa\x0f\x79\x08\x60\x7c\x94\x86\xc4\x03\x6c\x71\x94\xf2\xc7\x3a\xca\x1a\x43\xa6\x38\x43\x58\xf6\x91\x52\xd4\xf8\xa4\x89\x02\x7c\x02\x73\x65\x58\xce\xe0\xd1\xe6\xd3\xae\x1a\x60\x53\x73\x8f\x55\x6b\x73\x3a\x8d\xd1\xe2\xe5\x0c\xf2\x89\x75\xd7\xa2\x3a\xed\x0a\x99\xae\x87\x23\xeb\x87\x3f\xd8\x8e\x3d\xca\x59\x4e\x1d\xed\xcc\x1d\xd9\xe8\xc3\xb7\xfe\x24\x6c\xea\xb1\xaf\xd0\x81\xfd\xb9\x57\x53\xe8\x73\x64\xc1\x3d\x56\x00\x5f\x96\x11\xce\x25\x20\x5e\xf5\x8a\x66\x8b\x9f\x4f\x48\xba\x3d\xc2\x0c\x57\x8c\x1b\xca\xce\x0b\x4a\xb3\x61\x75\x6c\xa2\x58\xf3\x65\xd3\x2a\x96\xb5\x55\xbc\x7a\x54\xcc\xf3\x48\x28\xc9\xd4\x2a\xd1\x14\xcb\xff\x04\xc8\x79\x2d\x6c\xbb\x34\x0b\x73\x47\x14\x27\x86\x69\xd8\x6a\x3d\xc0\x6c\xa5\x03\x1a\x35\xbd\x3f\xad\xf3\x01\xa9\x19\x06\x25\xce\xe8\x56\xef\xcb\xd5\x43\x03\xae\x02\x82\x60\xcd\x29\x4f\xba\x88\xc4\x81\x3f\x8d\xf3\x69\xd6\x33\xb7\x05\xa4\xc6\x22\xa7\x45\xa5\x05\x47\x77\xc5\x96\x56\x07\x1a\xb0\xe9\xe0\xed\x2c\x6e\x15\xcc\x63\xf6\xae\x58\xba\xed\x55\xfb\x90\xfb\x0f\xa1\x7e\xeb\xee\xa1\x42\xb4\xed\x4a\x60\xf6\xd7\xdf\x74\x2d\x20\xb9\xeb\x6f\xbe\x1a\xf7\x9a\xf5\xcc\x15\x35\x6b\xe8\x80\x56\x66\xc3\x02\xf2\xa3\xb9\x5f\xd2\xe9\xe8\x8b\x4e\xd7\x55\x3e\xcb\x38\x83\x70\xc4\x20\xd4\xf8\x72\x1b\x86\x3f\x36\x59\xc2\xdc\x81\xbc\x1f\xcc\x9b\xbc\x8f\x98\x00\xfb\x71\xcb\xde\x07\x70\x87\xdd\x37\x75\x5d\xac\x14\x4d\x50\x5e\x09\x97\xd7\x3d\x79\x22\xc9\xb5\x3c\xa6\x4a\x6e\x43\x2e\xa4\xde\x2b\x7b\x8d\x91\xad\x87\xae\xc4\xad\x3e\x37\xe7\x5f\xdf\xa8\x9d\x86\x2b\x47\xba\x57\xc2\x87\x1f\x6b\xb5\xa6\x5c\x3b\x22\x0a\xa3\xc8\xfa\xe4\x14\x55\x57\xf5\xfe\x78\xbe\xd4\xe9\x31\x24\x71\xd0\x0a\xb3\x47\xb6\xa8\xd9\x35\x9c\xc2\xee\x78\xac\x51\xf3\xeb\xc5\xc3\x5e\x80\xda\x8f\x73\x8f\xec\x5b\x5b\xaf\x74\xc2\xc8\xab\x6f\x35\xdc\xf8\xf6\x6e\xe8\x95\x96\x2b\xf8\x79\x15\xf7\x05\x0f\x8d\x4f\x6f\xda\xe5\x22\xd2\x5c\x61\x9e\x6b\xf9\x51\x5f\x4b\xe6\xf7\xc8\xee\xc0\xa7\x37\xd9\xdc\x90\xed\x04\xe2\x98\xa0\x50\xd4\x41\x0f\x63\x28\x4b\x82\x65\x1d\x71\xd6\xea\x8b\xc5\x62\xb6\xb3\xb9\x79\x75\x75\x65\x46\x32\xd8\xda\xda\x98\x66\x8b\xcd\x51\x31\x2c\x37\x2f\x17\x0f\x06\x5b\xeb\xf3\xc9\x26\xe4\x08\x39\x39\xfa\xdd\xc9\x83\xf5\xef\x57\x5c\x60\x32\xec\x2a\x39\x18\x46\x8d\xbe\xb8\xeb\x94\x02\xe1\x78\x8c\xf9\x3c\x18\xe5\x2d\x53\x89\xbc\xc3\x5c\x36\x57\x9a\xfb\x84\x1c\xe9\x6e\x29\x00\x91\x95\xe1\x58\x71\x77\x49\x9a\x44\x68\x3e\x14\x02\x2b\xfd\x69\x28\x3e\x04\xb9\x21\x7d\x80\xa4\x22\xd1\x9f\x65\x10\x7f\x86\xb1\x51\xaa\x40\xec\x94\xcd\x3f\xe8\x7f\xcf\x50\x6b\xfe\xa8\xfa\x94\x3b\x0d\xd2\x7f\x9c\x5f\x80\xd3\x3c\x88\xf6\xd3\xce\x82\x9a\x2b\xb3\x6c\x62\x85\x7b\xb2\x81\x66\xe0\x62\x7f\x73\x05\x32\x7a\x4d\xa6\xc5\x96\xe8\x63\xed\xc9\x3c\xac\xbb\x66\x53\xa6\x60\x72\x03\x08\xe2\xa4\x67\x31\xbb\x06\x6e\x36\x5f\xa0\xe9\xf5\x86\x33\xd7\xa1\x93\x2f\xa9\x16\xfc\xa9\x6f\xb4\x64\xfc\x2a\x2b\x0b\xdb\x5c\xd6\xee\x73\x9f\x37\x3a\x2b\x63\x5b\xcd\xeb\xea\xed\xb7\x3d\xba\x12\x49\x0d\x96\x46\xff\xd8\xbd\x92\x14\xfb\xdc\xe3\x19\xa7\x28\xe0\xe3\x85\x1a\x03\xc9\xcc\x86\x28\x02\xfc\x01\xc4\x43\xd6\x34\xa1\xee\x01\xb2\x75\x26\x13\x4c\xfb\x6e\xf3\xbf\x01\x32\xf2\xea\x4b\x96\x7b\xe4\xab\x32\xce\x1a\x58\x93\x70\xa3\x9b\x06\x16\xc2\x65\xf5\xf4\x6a\xa0\x37\x33\x22\x7b\x54\xbd\x66\x3e\xdd\xbb\x57\xd1\xfd\x79\x0a\x35\x31\x04\x07\xef\x9c\x0e\x11\x35\x5f\xab\x15\xed\x8b\xa7\x91\x7c\xac\x7a\xcd\xec\x15\xd1\x98\xdd\xcf\xa1\x35\xf8\x7a\x76\x5e\xa0\x81\x9f\x4e\x60\xe5\xf7\x7e\x3a\xd9\xe0\xf5\xd0\xc6\xe3\x16\x36\xdc\xc7\x15\x82\xd0\x83\x6e\x67\x43\xaf\x37\x0f\xbb\x5e\x1a\xe8\x0a\xd8\x1b\x4d\x58\xe2\xcc\x10\x25\xae\xb3\x7c\x1e\xa1\xae\x4a\x95\xb6\x14\x26\x7d\xff\x76\x24\x76\x3b\xd5\x6d\xb3\xe2\xf6\xeb\xd2\x59\xb4\x8d\x50\x22\xc8\x20\x19\x8b\xac\x6a\xc2\x19\x31\x29\xa5\x0a\x8d\x29\x74\x2d\xc9\xa7\x8b\xcf\xb2\x62\x80\x3e\xc8\x1e\x96\xae\x70\xb3\x29\x34\xb2\x11\x7a\xee\x5f\x7d\x69\xad\xaf\x46\x2f\x58\xaa\xdb\x6f\x87\x1b\x09\x2b\x38\x40\xd8\x18\xa0\x43\x8a\x72\x27\x69\xde\x8e\x4a\x1b\x5b\x7e\xfd\xa8\x17\x48\xb8\x3d\x2b\x7c\xeb\x5e\x17\x49\x66\xc4\x93\xe1\x82\x23\x6f\xe6\x9c\x5b\xf7\x36\xed\xac\x72\x2f\xe1\x6d\xdc\x5d\xd4\xf9\xd6\x7d\xc9\xb9\xaa\xd9\xf7\x1c\xc4\xbf\xc3\xb3\x6e\xe0\xb3\x93\xc3\xde\xae\x0f\x68\x5f\xd5\xae\xd6\xec\x55\x3f\x2e\xfe\x79\xe9\x47\xdb\xcc\x5c\xf1\xfd\x35\xe2\x41\x85\x62\xb5\x38\x57\x4d\x53\x1a\x75\xb1\x01\xbd\x84\xe6\x71\x55\x86\x54\xf3\xce\x53\xfe\x42\xd4\x63\xa6\xd1\xc3\x8a\x96\x15\x64\xd5\xf0\x70\xe3\xa6\x43\xce\xf4\x1b\x31\xf6\x25\xbf\xb7\x63\x45\x93\x5b\x2f\x11\xf7\x2a\x69\x1e\x9a\xb1\x9a\xd2\x72\x96\x0d\x29\xe3\x95\x14\x33\x7b\xbe\xc5\x97\x33\xb7\x98\x97\x36\x55\x37\x99\x5e\x90\xaf\x81\x77\x0c\x0d\x2a\x67\x4b\xb3\x43\x19\x5b\x33\x28\xc3\x38\xf9\x5b\x4c\xcc\x5c\xbd\x71\x47\x9e\xc5\xec\xda\x30\xf7\xe8\x7a\x61\xef\x7f\x7c\x28\xfa\x18\x7e\x1a\xee\xcb\x1a\xe7\xde\x82\x24\x75\xd1\xeb\x0b\x60\x3e\x70\x9e\x2e\x6b\x92\x5d\xd5\xbf\xba\x3b\xcd\xfe\x26\x93\x36\x9d\x9d\x2d\x31\x21\x3d\xfc\x81\x2e\xce\x72\x4a\xfc\x0a\xd6\x27\xcc\x75\xe0\x8d\xb1\x26\x3d\x18\xac\x40\x8b\x08\xe8\x67\x55\x52\xd1\x49\xcd\x71\x74\xee\xb0\xd1\x7c\x9e\xa8\xb9\xfd\xed\x6f\x44\x77\xf0\xf5\x4a\x1d\x2b\xdc\xf0\xc7\x2c\xbd\x60\x74\x2f\x95\x07\x92\xc3\x64\xc6\x01\xcd\x01\xe7\x21\xad\xd3\x7f\xcd\x15\x6c\xfe\xbf\xdb\xb5\xff\xea\x19\x7a\xba\x02\xa7\x1d\xe4\x37\xbc\x4b\x1c\xcb\x28\x36\x2c\x64\x39\xe0\xd3\xbd\x27\x49\xe0\x38\x67\x1f\x8a\x6e\x1e\x68\x54\xeb\xf2\xfc\x7a\xd1\x7b\x0b\xca\x95\x08\x62\xa3\xd8\xba\x8a\x33\x9d\xea\x7e\x4d\x22\x99\x25\xe9\x55\x68\x1b\x23\x06\x83\xf4\x3c\x36\x1b\xb9\x65\x8b\x01\x23\xa6\x2e\x2d\x98\xf9\x6f\x72\x1c\xed\x95\x32\x72\xc9\xd8\x50\x7a\x82\x50\x5d\x8a\x9c\x5f\x19\xec\x27\xf5\x3c\xdc\x0b\x1d\x06\x6f\x44\x6e\x5b\x0a\x3f\x7d\x81\xeb\xcd\x49\xfa\x89\x98\x50\xc5\x07\x40\x16\x62\x89\xf4\x4e\x4b\x9f\x9e\x39\xa9\x47\xb8\x16\x3f\x9d\xbc\x7a\xf9\x2c\xbf\xe4\xfc\xa6\x9f\x31\x01\xf8\x89\x24\x02\x2f\x56\xb5\xd4\xb0\x0c\x92\x4c\x5b\xaf\x82\x69\x54\xad\x02\xe7\x10\x37\xff\x89\x47\xb1\xd9\x74\xdc\x50\x2d\xae\x52\xac\x66\xe7\xa8\xe8\x3d\x2a\xd9\x3f\xea\xd2\xac\x57\x52\x71\x34\x35\x45\xd1\x77\x2d\x5a\xb2\xce\xac\x9a\x3f\xa9\x69\xd4\xe6\xf7\xa8\x6f\x58\x00\x97\x2a\xcd\x58\x00\x27\xad\xda\x41\xc7\xb2\x33\x23\xba\x5b\x03\x10\xfe\x23\x4c\x59\x2c\x07\xd9\x86\xcc\x55\x5a\x57\x11\x87\x7e\x20\x97\x1f\xda\xa6\xda\xaa\xe0\x83\x55\xda\xac\xa2\x8e\xf5\x3c\xed\x5c\x2d\x00\x58\xdd\x4a\x36\x02\x8e\x79\xcb\xa2\x92\xba\xc7\x74\xd9\x2e\xb6\x36\x52\x07\xc3\x6d\x37\x8a\x29\xc0\xfb\x99\x0b\xc6\xfc\xb6\x0c\xb8\x0b\x71\x48\xa5\x00\x69\x17\xf8\x5e\x4c\x31\xb4\x2c\xb1\x69\xa4\xf1\x9f\x7e\x02\x69\x6b\x00\x34\x37\xef\x6b\xca\x88\x16\x1b\xe1\xb1\x2d\x40\xda\x14\x57\x01\x20\x65\xf7\xc1\x01\xe1\x25\xe7\x3e\xe2\x80\x34\xb0\x19\x74\xfa\x32\x86\x96\x95\x96\xb3\x5b\x57\x81\x75\x0f\x2a\x55\x26\x50\x4c\xd5\xde\xc2\x43\x48\x85\x71\xa1\x9a\x7a\xe0\x8d\xef\x20\x11\x77\xfa\xb2\x8c\xcf\xe1\x9f\x14\x19\xa0\x16\xb3\x8f\xaf\x0d\x91\x14\x60\x36\x62\x23\x78\x3b\xda\xf5\x20\x4f\x8d\x52\x5c\x3b\xd4\xaa\x9b\x2b\x2f\x9f\x26\xcf\x9f\x93\xa0\x0b\xed\x53\x2b\x5c\x81\xd0\x32\x4e\x97\xa7\x9c\xba\xbf\xf5\xf2\x57\xc0\xcf\xe0\xf9\x24\x8d\x5e\xb7\xf5\x6c\xaa\xca\xf7\x36\x8b\x76\x3a\x5e\xce\x57\xaf\x19\xd2\x6c\xcf\xf9\x73\xa0\x57\x6a\xb2\x2a\x29\x36\x96\xa2\xa0\x38\x72\x63\x85\x93\xc1\x06\x15\xeb\xcb\xda\xed\xb0\x40\xb1\x3e\x35\x03\x7d\x8f\xab\xfa\xe4\x1b\xec\xf0\x9b\x0f\xc9\x7f\xa9\x08\xab\x4e\x92\x9c\x16\xd7\xeb\xe4\xc3\xbb\x93\x10\xb8\xd6\xba\xf9\xe9\x71\x50\x28\x48\x16\xb5\x43\x69\x32\xcd\xcb\x86\x40\x15\xf9\x04\x32\x81\xa7\xd3\x45\x58\x8d\xda\x63\x6f\xb8\xed\x59\xa5\x59\xfa\x8e\x33\xd9\x49\xca\x62\x9c\x8f\xbc\x12\x9f\xf5\x3f\x36\xae\x86\x38\x9f\x70\x02\xfc\x48\xee\x18\x3a\x02\xf3\xdc\xfa\xe9\xb8\x18\x7e\x0a\x3a\x82\x55\x5a\x4f\xc7\xf9\xf9\x74\x27\x19\x82\x72\x75\x1e\x14\x50\x0e\x7b\x95\x43\x54\x1b\x86\x0d\x1e\xc0\xc1\x78\xdd\x31\x74\x5b\x78\x91\xa5\x23\x36\x8c\xef\x5d\xe4\xe3\x51\x17\xe7\x1b\xec\xfc\xb1\x39\xa1\x8b\xb2\xba\xff\xea\xa3\x0d\x08\xa1\xf0\xf1\x12\x19\x49\xfb\xf5\xbd\xfa\xbb\x52\x0b\x7c\xd8\x90\xe2\x76\x64\x2e\x00\x1d\x1c\x07\xf9\xeb\x7b\xf9\x8b\xae\xab\xec\x29\x0e\x88\x6d\x25\x8d\x9a\xb7\x50\xad\x83\x86\x70\x43\x28\x1c\xcc\x0f\xfb\xc4\x26\xb2\x81\x2d\xed\x44\x4b\x13\x81\x9b\x71\x81\x03\x8e\x22\x6e\x79\xbc\x77\x12\x23\xc5\x19\x29\x64\x91\x79\x9b\x60\x38\xe0\x9d\x64\xfd\xfb\xef\x83\xbd\xb1\x64\x52\xa5\x8f\xdb\x6e\x7e\x75\xe3\xb5\xab\xd6\x8a\x26\xac\x1d\x3a\x6c\x63\xfd\x2a\x3b\xfd\x94\x2f\xd6\x5d\x02\xda\x1d\x23\xb8\xa4\xc3\x7c\x71\xd3\xaf\x1c\x40\xc8\x11\x34\x29\xd1\x1e\x9d\xfa\xb4\x6c\xde\xe3\xbf\x7e\x51\x1b\x31\x1b\x17\x41\x24\xd5\x59\xb8\x08\x13\xdf\xe7\x25\x6e\x6b\x1b\xab\x8d\x63\xa9\x61\x07\xf4\x39\x0a\x29\xa6\xa7\x12\x8d\x4f\x25\xd3\x41\x80\x78\xd7\x01\x71\xb3\x38\x3b\x03\xaf\xa6\x79\xe6\x42\xbf\x40\xc8\xce\x88\x82\xcd\x8d\x02\x1e\x83\x92\xf6\x9f\x7c\x27\x6d\x20\xbc\x68\x86\x30\x15\x0a\x04\x78\x42\x7a\x41\x23\xdc\xa3\x98\x3e\x49\x01\xba\x84\x13\x2f\xda\x54\xcb\x6c\x8b\x70\xf9\x96\xed\xfb\x2d\xcf\x9c\xcd\xb6\xcc\x9c\x15\xd2\x68\x36\x37\xcd\x1e\xe7\x53\x4c\x2d\x2f\x8d\x78\xdf\x31\x45\x76\x32\xcb\x00\x07\x19\x6d\x20\x46\xb0\x32\x0b\xd3\xf3\x7d\x5f\xe0\x6e\xee\xbb\x09\x40\xbf\xc1\x1b\x4b\x9a\x85\x54\x92\xb2\xbb\x6a\xa8\x92\xc0\x7f\x6d\xac\x71\xe2\x46\x53\xef\x60\xd1\x81\x7e\x2f\x0c\x3d\x91\x11\x26\x87\x1f\x50\x7b\x36\xce\xd2\xa9\xd9\x4a\xcc\xe8\x78\x90\x0c\x31\x79\xe3\x59\x8e\xce\x2e\xfa\x60\x3c\xa5\xf1\x7f\xc9\x7d\x52\x6d\xe0\xef\x7e\x51\x0c\xb6\x6a\x8e\x3f\x7d\x88\xbd\x01\x71\xda\xad\xce\xa5\x77\x4b\x1e\xb6\x3d\xc7\x97\x24\xef\x3d\x06\x49\xf1\x9d\x1e\x3f\xd9\x41\x82\x86\xbf\x8c\x4e\xc7\xfc\x77\x98\x68\xc4\x57\x02\xe9\x47\xa1\x36\xd5\xed\x4f\x85\x53\xc2\x8a\x3e\xeb\xea\x1a\xd0\x4f\xc0\xed\x6a\xba\xe5\x6e\x59\xaf\xc6\xb9\xa2\x71\x04\xcd\x5c\x66\x95\xcf\x0c\xe5\x40\xf1\xed\xa8\xf1\xeb\xc8\x16\x47\xa0\x94\x2c\xb3\x9f\xf3\x51\x56\x74\x89\x4b\x8c\x4b\xed\xd8\x72\xad\x0b\x10\x69\x37\x8e\xb2\xd1\x3c\xbd\x8a\x22\x51\xe1\x81\x05\xa5\x84\x35\x39\xa3\x72\x10\xd1\xd4\xd3\x7c\x1a\xa8\x22\x9e\x1d\xbe\x4a\xe0\xa9\x5e\xa5\x0f\x56\x42\x5d\x73\xfc\xa0\xdd\x2c\xdf\x29\x05\x45\xe8\x5b\xa0\xa0\x8a\xcc\xbd\xca\x45\xce\x2e\x56\xc3\x3a\xf0\x8d\xc3\xc8\x73\xa4\xe8\x01\x6f\x48\x54\xb6\x7b\xea\x58\xbc\x77\x09\xb5\xd1\x29\x84\x8f\x8a\xab\x37\xa4\xec\x9d\x93\x4a\xeb\x2c\x1d\x66\xf8\x32\x64\xec\x65\x06\x43\x01\x45\x0f\x6a\x63\x73\xbc\x5d\xcf\x32\xc8\x3f\x82\x9e\xa3\xe0\xef\x9f\x11\xb6\x1e\x2e\xc1\x0d\xd9\xf3\xb0\x26\x3a\x71\x98\xe2\x97\x79\x76\x65\x47\x72\xf8\xec\xb0\x3b\x3f\x37\xa3\x4b\x7b\x3b\x89\x11\x02\x4a\xec\xba\x4c\x2f\x41\xe3\xaa\x3c\xb3\xb0\x75\xd3\x66\x17\x67\x49\xe9\x9b\xfb\x04\x3e\x3b\x24\xd1\xa1\x87\xbe\x6b\x69\x4e\xfa\x38\x80\x7e\x80\x8c\xee\x66\x86\x93\x62\x5e\x51\x64\xc1\xdc\xce\x21\x7a\x1d\xd7\x05\xa7\x87\x19\xbb\x48\x41\x6c\x17\xac\x9f\x30\x54\xc5\x28\x74\x98\x13\x65\x31\xa9\x4a\x6b\xfd\x34\x93\xe4\x70\xba\x4e\x02\x17\x4d\x01\x3d\x0c\xd2\xf1\x15\xb8\x1c\x10\x80\xa2\x6b\x0b\x1d\x82\xcd\xc3\x83\xc9\x17\x73\x22\x53\x17\x6f\x0f\x13\xb7\x8a\x37\x18\x70\xe7\x7a\xdd\x34\xd9\xb1\x4f\x3e\x13\x3d\x9a\x10\x18\x7c\x99\xd3\x05\xd3\x94\x56\x53\xbd\xd9\x7d\x56\x23\x58\x52\xc4\x65\x70\xa1\x00\xb4\x5c\x3f\x68\xda\xac\xb8\x13\x2b\xc3\x4d\xb4\xdc\x7b\x6c\xe4\x83\x93\x1d\x70\x79\xd0\x19\x10\xc0\x28\xf0\xbf\x8d\x1e\xf0\x8f\xd7\xe2\xb8\x0b\xb0\xc0\x98\xa9\xf1\xbd\x6a\xf2\x43\xdd\x71\xd1\xb4\xe3\x1f\x17\x44\x0d\x30\x5b\x0a\xed\xfd\xa6\x47\xc6\x1b\x82\x3b\x3a\xd6\xbc\x40\x19\xad\x29\xb2\x82\xa9\x7a\x86\x48\x64\xf9\x1c\x9a\x72\xa8\xcb\xe2\xc4\x29\xa9\xb3\x6a\xc9\x9d\xc8\xb5\x8e\xdc\x91\x55\xc2\x12\x30\x3b\x47\xfc\x42\xa0\xa1\xd3\xe8\x97\x10\xbf\xb4\x15\x9c\x81\x1a\xe2\x0f\xc7\x0f\x41\x34\x4d\xa3\x87\xef\xc5\xf4\x57\x8f\xdc\x3b\x78\x62\x00\xd8\x4d\xc0\x0c\x34\xce\x04\x93\x53\x9d\x37\x4b\x4f\x84\xfb\xcf\xed\x0a\x21\xd9\x41\x00\x3d\x25\xc9\x4b\x23\xac\xf0\x45\x70\x0a\x76\x87\x2b\x90\x5e\xc0\xbb\x3d\x9f\xe4\xe6\xa8\xf6\x89\x93\x06\xbb\xee\x3c\xcd\xd1\x0a\xc5\x65\x5a\x1d\x60\x66\x20\x3d\x10\x6d\xe0\x9d\xcd\xca\x38\xa3\x12\x05\x6c\xbc\xff\xd0\x64\xd5\x31\x15\x3c\x57\x1a\x02\x04\x72\x4a\x46\x77\x5f\xb0\x2d\x27\x81\x66\x09\x48\x13\xca\x69\xb5\x8e\xf2\x32\xe5\xa6\xd1\xd6\xf4\x87\x3f\x24\x77\xb0\xe8\xb9\x97\x47\x1f\x55\x20\xe2\x82\xe2\x40\x2e\x6d\xeb\x9d\x5f\x18\x24\x0b\xad\x47\xbc\x4d\xf0\xf5\x3f\x8a\x7c\xda\xed\x74\x6a\x5f\xc8\xfa\x23\x5f\x5c\xfd\x8b\x1d\xf4\xe6\x77\x8d\xc2\xb4\x60\x5d\xfe\x19\x0e\x79\xe4\xa0\xb5\x3c\x61\xb4\x30\xb7\x78\xde\xc2\xc3\xa1\x9e\xb7\x26\xfa\xc6\x52\xea\xd9\x09\xe9\xbb\x96\xe0\x8a\x85\xe1\x3b\xc9\x7b\x5a\x5e\x14\x09\xea\x33\x5c\xf9\x1c\xf0\xc8\x00\xd2\x8c\xd7\x0f\x68\x82\xbe\xe2\xae\x87\x6b\x5d\xc1\xaf\xf9\x8d\x68\x16\x6c\xa7\xe6\x20\xd2\x0a\x33\x34\x96\xde\xfc\x79\x05\x0b\xc8\x92\x1d\xb4\x1b\x9b\xee\xad\x92\x63\x1c\x59\xc8\x84\xd5\x70\x40\x15\x1f\xfb\x7b\x35\x3c\x81\xe5\x1d\xaa\x58\xd1\x56\x2e\xc0\x3b\x01\xdc\x76\x89\xdb\x04\x2e\x16\xc5\x5d\x72\x67\x70\x61\x2f\x21\x86\x44\xb8\x0f\xe8\xf1\x37\x1d\xdf\xd8\xc0\x4d\x50\x25\x80\x0d\x7e\x34\x62\x60\x6a\xe9\x92\x6f\x21\x20\xdf\x24\x79\x5d\x2c\x72\x54\x94\xa4\x18\x87\x41\x56\xe9\x2b\x3a\xb5\x25\x0f\xc5\x01\x33\xb1\xbb\x3e\x0f\x05\xbc\xa4\x65\xc9\x29\xb4\x41\xdc\x2d\xa0\x29\xe0\x03\x73\xf4\xd2\xa0\xcd\x81\x13\xd5\x95\x57\x8a\x03\x31\xc0\xcb\x63\x96\xcd\x17\x37\xa8\x7a\xb1\x9e\x79\x9a\x09\x62\xe0\x78\xb3\xc0\xd3\x4f\x0e\x42\x9e\x66\x74\x3a\x4e\xa7\xc8\xa6\x1b\xe6\x7c\x92\x5d\x91\x7b\x12\x83\x2f\xe6\xa3\x91\xa0\x2f\x79\x40\xb8\xfd\x64\x5c\x14\x9f\x48\x2a\x00\xd1\x9d\x02\x0c\x7a\xde\x72\x32\x45\x5b\xe7\x91\x99\x59\x4a\xb8\x29\xa7\x72\x1f\x5e\xb2\xed\xef\xa4\x98\x6d\x52\xe4\x50\x1f\x1e\x6a\xb3\x90\x30\xc2\xf2\x02\xf4\x37\xd0\xda\x29\x5c\xb3\x30\x71\xe9\xc9\xd0\x94\x19\xe0\xd0\xdc\x8c\xe8\xd1\x31\xcf\x48\x60\xb9\x42\x85\xcf\x04\xfa\x98\xbb\x91\x58\x9d\x99\xbc\xdb\xa2\x98\x01\x1f\x67\x71\x6c\x4c\xb6\x64\x3b\xc8\xdd\x91\xf2\xef\x98\x12\x2d\x5e\x6f\x15\x75\xe6\x3b\xd1\xd9\x50\x5c\x17\xd3\x7a\x54\x75\x13\xad\xd2\x39\xab\x60\xce\xce\xc8\xc3\xbd\xf9\xcc\xd8\x76\x2b\x1c\x01\xbb\xda\xe2\x38\x2a\xfc\xc0\xdc\x0d\xa4\x56\xf5\x45\x52\x0a\x73\x00\x40\xe8\x15\x15\x52\x58\x15\x2e\x69\xbc\x77\x3b\x9d\x9e\xaa\x67\x09\xf5\x89\xcc\xea\x5e\x92\xfb\x31\xa5\x14\xb9\x6a\x78\x04\x08\x5d\x85\xe8\x58\xcb\x25\x20\x62\xe3\xb5\xe1\xa8\x8e\xfc\x00\xc7\xe8\xe2\xd5\x86\x5e\x89\x8f\x9a\x6b\x49\x45\xcb\xac\x8c\x84\xb5\xb5\x78\x52\xd4\xa5\x23\x81\x96\x41\xb0\xc2\x49\x55\xf4\x03\x39\xe7\x7d\xcc\x46\xfb\x86\xd9\x5b\xf3\x14\x5a\xec\x28\x82\xdf\x21\x5e\x8b\x43\x6d\x3e\x4b\x24\xb4\x23\xac\x3f\xae\x58\x1c\x6a\xb8\x35\x21\x52\x8c\xb3\xd2\x0d\xed\xb2\x1e\x33\x80\xef\xb2\x0d\x52\x30\xad\xf7\x9e\x8e\x8b\x21\xdc\xd3\x2e\xca\x97\x82\xdb\x1c\x5b\x12\x79\x4b\xe1\xba\x9d\x22\xde\x78\x78\x3b\x63\xfe\x26\x64\x80\x86\x37\xc3\x31\x37\x3b\xa2\x34\x4e\x3f\x9f\xf0\x2b\x57\xc2\xfa\x42\x5a\x83\xab\x8b\xdc\x30\x70\xa0\xc5\x18\xcd\x25\x39\xc0\xe9\x0d\x14\x64\x98\xf4\xd2\x4b\x8a\x01\xdf\x2c\x47\x67\x3e\xe7\xb3\x25\xb0\x53\xcc\xc1\xb8\x17\xb4\x67\x3d\x95\xe8\x75\x84\x6b\x88\x14\xdc\x74\x91\x8e\x51\x48\xf0\x15\x27\xae\x05\x33\x76\x88\x3d\xc0\x61\x4d\xd2\x91\x08\x19\xf8\x62\xe0\x43\x76\xa5\x94\x2e\xe6\xb0\xd0\x8b\x6f\x66\x23\x9c\x58\x3e\xaf\xdc\xfb\x86\x1d\x33\xa3\x98\x83\x27\x1c\x98\x0d\xee\xda\xc7\x02\x3c\xe6\x0a\xd0\xbd\xc0\xf5\x4b\xaa\x95\x33\x51\xb3\x3b\x1e\x62\xc5\xf5\x66\xaf\x77\x7d\xb9\xc1\x5e\x1e\x90\x9e\x65\xc8\xa8\x4f\xc5\x81\xcf\x91\x45\x0e\x14\x05\x7d\xe3\x89\x0a\x1b\xa8\xfa\xb8\xd3\x15\x8c\x85\xb9\x6d\x15\x4b\x6e\xfd\xeb\x50\x3c\x92\xc3\x6d\x1b\x05\x3d\x87\x1e\x8f\x73\x97\xb3\x45\xe8\x34\x66\x18\xe1\xca\x65\x11\x2f\x85\xa3\x8d\x3d\x64\x10\xa9\xcc\xe5\x74\x55\xd7\xa5\xae\xbc\xb6\x16\x0d\xc0\x53\x02\x5d\xa3\xde\xf4\xa0\x2e\x6a\xee\x88\x9b\x8b\x3f\xff\x72\xa6\x1a\x95\x21\x22\x16\x00\xa3\x91\x21\xd7\x4a\x0c\x3d\x52\x64\x45\x82\xe0\x80\x4b\xa4\x1f\x4f\x88\x40\xfe\xff\x48\x31\xc5\x55\x9e\x77\x98\x4e\x09\x0f\x43\xd1\xa3\xb6\x29\x91\x86\x91\xf9\x1c\x7d\x0f\x74\xe1\xf9\x37\xb5\x3b\x0b\x90\xad\x33\xe2\x67\x27\x12\x84\xce\xff\x30\xd2\x59\xaf\xaf\x18\x05\x3c\x20\xd0\x92\x11\xbf\x2d\x42\x88\x2c\x57\xa0\x8e\x5c\x19\x69\xa8\x36\x2d\x2e\x90\xf7\xc9\xab\x53\x85\x6b\x3a\x7d\x98\xb8\x7c\xd2\x3f\xfe\xf6\x37\x8f\xac\x9d\x85\xa5\xc5\xf3\x7e\x1b\x21\x9f\xe3\x43\x9d\x26\x2d\xff\x50\xff\xee\x7a\xe0\x86\x6f\xcc\xfd\xb9\xb0\x79\xc9\xea\xd0\x43\xf1\x0e\x36\x5b\x04\x39\xb2\x6d\x58\x14\x3a\x60\xd0\x41\x45\x82\xba\x9a\xa7\xe6\x72\x47\x0f\xd6\x09\xaa\xeb\xd1\xed\x98\x34\xa7\x23\x82\xca\xc2\xeb\x11\xaf\xbc\x5a\xa6\x5c\x76\x1a\xdd\x78\xcf\xf8\x5b\x31\x0b\xaf\x52\x45\x6b\x12\x97\xa2\x71\xa2\x1d\xb9\xe3\xb4\xcc\xe8\xef\x1a\x5a\x03\x45\xf3\x5c\xd2\x00\xb2\x87\xe9\x90\x87\xfa\x96\xaf\x46\xe7\xb3\xd9\x13\x26\x36\xe7\x5b\x3a\x05\x5b\x23\x42\xe2\x18\xca\xeb\x00\x12\xe8\x99\x62\x36\x49\x96\xf7\xfc\x4e\xd5\x08\x00\x16\x0c\x96\x7a\x05\xf5\x61\x99\xa8\x4f\xa9\xbd\xf4\x0e\x85\x76\xb6\xd4\x65\x38\x17\x88\x42\x40\xea\xbc\x1a\x6e\xc8\x2f\xec\x78\xba\x66\xe1\x4e\x74\x13\x3f\xd8\x8a\x95\xa0\x0d\x1b\x9f\xa8\x36\xf5\x0f\x7f\xf0\xef\xe8\x9a\x38\xa4\x30\x6a\x46\x4a\x9b\x67\x37\x5f\x80\x12\x4d\x50\x30\xbb\x7e\x24\xb2\xa1\x0f\xf8\xea\xe0\x8f\x2c\x77\x36\x64\xa9\xd2\x4e\x73\x5d\xaf\xc4\x63\x5b\x6e\x94\x8f\x0e\x2b\x58\x99\xf2\x11\x6c\xe0\x8b\x79\x18\x68\xd2\x18\x05\x21\xb7\x7a\xc0\x5b\x29\xa0\x25\x3b\x55\xbf\x6b\x81\x11\x45\x8e\x8b\x07\x1f\x6d\x20\x44\xcd\xa9\x09\xc6\x50\xeb\x81\xf8\x17\xaa\x33\xd0\xc5\xd5\xed\x98\x1b\x1e\x58\xce\x59\x19\x40\xe4\x28\x9b\x95\x8d\x58\x0c\x9d\x66\x68\x4e\x57\xdb\x4d\xce\x0a\xc8\xdc\xb0\x6e\x43\x9a\xc2\x88\x43\xa4\xd4\x4c\x21\x73\xcb\x55\x7c\x2a\x3a\xa3\xd2\xa9\x9f\x24\x19\x93\xb4\x00\xf6\xa3\x1d\x95\xa0\x05\xee\x07\x73\x42\x8a\x25\x00\x00\x14\xe6\x19\x98\xb0\x63\x02\x3a\x77\x9e\xde\x98\x57\xe0\xed\xc9\xf3\xf5\xc1\x43\xdf\x69\x9c\x4c\x39\xb8\xb1\x8a\xf4\xf1\xdf\x40\xf8\x7d\x4d\x26\xcc\x6a\x90\x7b\xbc\xc6\xf9\x8e\x56\xb3\x84\x36\xe8\x85\x1b\x29\x1f\x79\x5b\x34\xab\x70\xdb\xc1\x54\x49\x7d\x51\x7c\xca\x10\x97\x4d\x6e\x08\x3f\x31\xd9\x6c\x9c\x03\x26\x5b\x06\xab\x40\xc9\x91\xba\xd4\x03\xb7\x14\x8d\xb6\xc4\x26\x63\x51\x96\x7c\x0e\xf0\x3b\xbc\x18\x57\x43\x10\xdf\x1c\xcc\x90\x47\x9a\x41\xd4\x2e\x95\xb5\xb4\xae\xdb\xf3\xa8\x91\xde\x87\x57\x95\x1c\x4b\x11\x6e\x8f\x27\xe4\xc6\xe3\xe6\x55\x59\xe7\xa0\x01\x20\xe7\xab\x79\xbe\xc8\x9a\xdb\x88\xdd\x4b\x75\xf3\x52\xd7\x07\xef\x8f\x57\x6d\x92\xde\x9c\x66\x7b\xe3\x7c\xb6\x47\x0f\xa1\x02\x5d\xd2\x57\xec\xbd\x27\x31\xc6\x70\x45\x00\xc0\x5a\x45\x50\xb4\x89\x9d\x7b\xde\x48\x7e\x0d\x0a\x0b\xa3\xab\x5a\xc9\x89\x65\x13\xef\xc5\xaf\x04\x99\xfb\x91\x69\xf2\x8a\x8b\x8b\x4b\x82\xe1\x73\x3d\xfb\x9d\x15\x3a\xe1\xe3\x49\xd1\xb6\xa0\x4e\x48\xc9\xe8\x3b\x2a\xa4\xd7\x63\xc9\x68\x58\x11\x99\x24\x1e\x15\x90\x23\xe2\x88\xb0\x74\x93\x60\xf0\x91\x08\x55\xfe\xcc\x12\x2b\x4a\xde\x7d\x7d\x78\x72\x97\x06\x33\x29\x4a\x07\x17\x00\x0e\x49\xa6\xd8\xbb\x0c\x1e\x77\x17\x69\x0e\xcd\x9d\x17\x30\xae\x6f\xcc\x8d\xb8\x0e\x5c\xd0\x37\x84\x60\x27\x30\x75\xf9\x82\xfd\xaf\xfe\x42\xf4\xf1\x17\x64\x88\xfe\xb2\x98\x2c\xaf\xff\xe2\x42\x84\x85\x85\x81\xf6\x40\x36\x1e\x57\x79\x99\x3e\x0b\xae\x04\x2c\xe7\xc9\x9e\xa4\xd9\xa4\x0c\xd1\xb3\xf3\xe5\x6c\x73\x76\x3e\x42\xb1\x16\xd4\xed\xf9\x74\x89\x7c\xfb\x55\x31\xff\x04\x32\x1f\x4e\x0b\x84\xd9\x92\x15\x63\x66\x36\x9c\xd1\x2f\x6e\x60\x14\x5d\x5c\x68\x7b\xa8\xc0\x19\x29\x3a\xa9\x6b\x86\x48\x30\x6c\xc9\x57\x7c\x7a\x8d\xf5\xc5\xf0\x60\xc8\x65\xbc\x2c\x8d\x0c\xb2\x3a\x1c\xcb\x0f\xe7\xf7\x58\x26\x99\x4b\xdf\x1b\x8f\xb3\x86\xbb\xc9\x42\x12\x26\x78\x42\xbd\x71\x3f\xa9\x03\x87\xa5\xb7\x43\xc5\x45\x29\x1d\x26\x22\x47\x18\xe2\x7c\x5c\xfd\x4a\xcd\xea\x02\xd5\x9c\x2a\x41\x4b\x76\x84\x8d\xcd\xe9\x51\x57\x18\x7b\xcf\x9c\x31\x53\x36\xa4\x74\x38\x2c\xe6\x23\xc5\xec\xff\x7c\x52\xcd\x98\xc6\x1a\xfb\xad\x64\x39\x1d\x67\x65\xe0\x90\x73\x61\x08\xec\x94\x94\x35\xe3\x91\x40\xd7\xcf\xf3\xe1\xc2\xb1\xee\xcc\xe3\x83\x4e\x39\x01\x36\x63\xce\xba\x72\x23\x10\x88\x2a\x07\xde\x2a\xfc\x0e\x3a\x19\xff\x62\xa1\x9c\x6c\x23\xbf\x39\xd1\xdb\x34\x5b\x31\xcc\x5c\x91\xf6\x69\xbe\xde\xb8\x3b\x65\x95\x84\x9b\x2d\x1a\x42\x63\x27\xb1\x50\x75\x7b\x45\x7b\x7b\x77\x47\xa7\x47\xd4\x76\x0f\x5d\xea\xb1\x32\x80\x6e\xd5\x19\xa1\xf8\xbc\x7c\xd9\xc6\xc1\xe7\x9a\x6b\x52\xed\x68\xbe\xa8\xec\x25\x69\x90\xc2\xed\xb4\x7b\x79\x61\x9a\x6c\xb7\x99\x6b\x0a\x92\xaa\xb2\x9f\x2d\x37\x93\x96\xe0\xeb\xef\xa7\x1c\xf4\x95\x5b\x2a\x67\x6d\xe5\xae\x72\x41\xbd\xb1\xf5\x77\x88\xc6\xac\x7f\x33\x2f\x40\x6c\x35\x12\x38\x98\xc7\x1d\x7b\xab\x6c\x37\xea\xe5\xcd\x6d\x1c\xcb\x19\x81\xf3\x98\x55\x09\xf7\x77\xe1\xb8\x6a\xb2\x82\xa1\xa1\x07\xf5\x9f\xd6\xd6\xe3\x69\x78\xd4\xd6\xc8\x75\xa1\x96\xbc\x22\x75\x63\x4b\xd6\xdf\x02\xfe\x75\xb8\xe0\xf4\x90\x14\x79\x82\x96\x1a\x8f\x61\x58\xd8\xa8\x64\x0c\xe7\xe5\x11\x63\xe8\xe6\x6a\x0b\x30\xcb\x85\x35\x31\xed\xd8\xc1\xee\x62\x7f\x3a\x3a\x3c\x3b\x16\x0d\x4c\xa3\x6c\x87\xc6\x8f\x27\x8a\x15\x8d\xfc\x59\xa9\x1a\x0f\xb8\xb4\x3a\x7a\x71\x00\x92\xbb\x70\x32\x8e\x3d\x96\x06\x18\xac\x21\x28\xdc\x18\xe7\x12\xc2\x3c\x79\xcb\xc4\x98\xb9\xd1\x4a\x5a\xa5\x19\x45\x09\xd2\x13\x01\x89\xaf\x61\xb4\x01\xa5\x7a\x71\x23\xa3\xc7\xb4\x0f\xe9\xa4\x19\xe7\xc9\xf2\x87\x1b\x9a\x79\x96\x5e\xde\xce\xba\x83\x00\x0e\xb2\xd6\x52\xb0\x62\x06\x02\xc6\xe9\xc1\x71\x46\xb6\xb7\xd5\x8c\x44\x75\x69\x2d\xba\x60\xfb\x3c\x27\x5e\x13\x23\xe3\x97\x0b\x5f\xa4\xad\x10\xea\xd6\xc6\x6f\x33\x2b\x35\xf8\x5d\xc6\x58\xc2\x0f\x7d\x23\x03\x5f\xa6\xac\x1c\x95\xe1\x60\x03\x98\xed\x38\x2b\x25\xa3\x86\x00\x0b\x7c\x85\xc1\x31\x5e\x86\x86\x7c\x6b\xb5\xf4\x2b\x17\xde\xbc\x0d\xbb\xea\xee\xd1\x57\x8e\x55\xf3\x49\x4b\xc8\xd0\x5a\x57\x11\xcb\xa9\x54\xae\x9d\x0d\xc7\x09\x69\xa4\xcf\x41\xaf\xc2\x50\x85\x4b\xab\x94\xd4\x70\x3d\x20\x02\x6d\x78\x45\xa9\xd6\xbf\xca\x72\x7a\xac\xd8\xcb\xfc\x13\xba\x04\x90\x7a\xab\x6f\x78\xf1\x61\x36\x03\x89\x21\x47\x3f\x19\xbd\xe3\xad\x70\x5b\x40\x5b\xf3\x1c\xb4\xdc\xbf\x1e\xe6\x23\xa6\x7b\xab\xc4\xe1\x00\x50\x4d\x0c\x12\xc5\xbc\x4d\x90\xb0\x6f\x2f\x9d\xcf\xf3\xf4\x3c\x63\xde\x85\xa0\x2e\x48\x6d\xa4\x27\x0d\x3b\x21\x23\x27\x67\x81\x66\x28\xaa\x49\x7c\x8a\x55\x15\x43\x75\x0c\x1e\x93\xee\xcd\xad\xca\x79\xbb\x21\x55\xf6\x2d\x44\x4e\x5a\xce\xd0\x82\x89\xa7\xd2\xb0\x36\x10\xcf\x7c\xc3\x0a\x70\xe4\x70\x94\x0d\x30\xe2\x81\xe0\x70\x39\x30\xe4\x05\xc3\x32\x57\xa6\x02\x27\x87\xfc\x97\x8d\x1b\xae\xc4\x99\x44\xc4\x7e\xc5\xb9\xba\xdc\x7e\x43\xab\xaa\x58\x41\x1d\x73\x70\x28\x70\x16\x66\x5b\x49\x09\x26\xde\x12\xd3\x1a\xa0\x83\x64\xec\x40\xc6\x8f\x15\x68\x4c\x54\xe3\xa2\x6a\x0b\x84\x98\xd9\x38\x35\x77\x22\xc0\xc2\xf8\xc0\x0d\xa8\x62\xcc\xce\x16\x35\x09\xee\x5c\x54\xd3\x2c\x25\x0d\x44\x85\xb3\xf2\x7d\xd8\x91\x83\x66\x0d\x26\xa8\x20\x53\xd8\xdb\xbb\x64\xb3\x24\x65\x82\xea\x1f\x23\x9e\x18\xc9\x1a\x07\x08\xed\x71\x2a\x7a\xec\xb0\xe7\xb0\x7e\xc8\xcc\xa5\x6b\xa7\x08\x36\x71\x9a\xdd\x14\x8c\x64\xea\x8f\x7d\xad\x3d\x96\x6b\x36\x37\x92\xf5\x49\xf1\x12\xd6\xa1\x81\x3d\x8a\x63\xa9\xd7\x1c\xf4\xad\xaa\x31\x36\xd4\xae\x51\x36\x30\x48\x0f\x71\x61\x7e\xc4\x09\x07\x29\xbb\x00\xea\xf6\x36\x78\xca\xfb\x30\x11\xeb\xd6\xe9\x3c\xd1\xaa\x7b\x3e\xd7\x32\x8d\xbd\xbb\xc3\xb3\x66\x35\x54\x20\x9f\x4c\xd5\x59\xf3\x59\x6a\x4a\x7e\x67\x63\x13\x19\x44\x91\x4f\x28\x94\x11\xec\x95\x4a\x19\x98\x17\x6d\xba\xa1\x4c\xb6\x81\xe1\x42\x94\x9e\x57\x01\x59\x30\x95\xe6\x69\x39\x35\x37\xdb\x62\x09\x70\x88\x2a\xc7\x01\xa9\xc8\xc4\x6d\x18\xdb\x61\x0e\x9e\x80\xa3\xd0\x83\xd2\x7a\x93\xaa\xc0\x37\xc8\x76\x99\x0f\x11\x1d\x06\xfd\xff\x00\x40\x59\xd1\x22\xfb\xaf\x51\x7c\x37\x38\xa9\xde\x70\xe3\x18\x6d\x83\x8a\x21\xb0\xb3\x9a\x5d\x9d\x09\xc2\x11\xd1\x1a\xbd\xf7\x24\x75\x8f\xec\x65\xc6\xe4\x76\x84\x5b\x00\xf3\x39\x9f\x16\xf3\x4c\x7c\x1f\x13\xca\x0c\x49\x28\x2b\xa9\xc5\x4d\x64\xe5\x97\xac\xc1\x28\xbb\x84\xb8\x44\x02\x05\x02\x9f\x10\xd4\x06\xd2\x94\xd2\x73\xd3\x2b\x2b\xfe\x4d\xd3\x93\x6c\xdd\x0a\x35\xc0\x04\x7d\xa2\xb4\xa0\xfd\xe4\xfa\x6c\x98\x7d\x6b\xbf\x81\x55\x39\xa3\x23\x3e\x3f\x5d\x9e\x83\xa1\x69\x73\xfb\xfe\xf6\xfd\xef\xb7\x50\x2a\x1d\x65\xe6\x8d\x5d\x99\xb4\xdb\x9b\x5a\x80\xec\x33\xf4\xd3\x2a\xb4\xb2\x81\x29\x41\xd1\x5a\xe9\x26\xe9\xf5\xde\x57\x31\x06\x69\x9b\x98\x1d\x60\xf2\xa3\x03\x90\xb7\x3f\xf6\x6d\xa7\xbd\x64\xc7\xfe\xbd\xa2\x61\x8e\x29\xc2\x15\xc9\x3f\x79\x12\xa6\xaa\x8a\x55\x78\xb6\xff\x7c\xf7\xed\xcb\x93\x8f\x7b\x87\x2f\x0f\x8f\xb4\x73\xd5\x6a\x9f\xa3\xf7\x2b\x1e\xa3\x0f\xce\x7b\x2a\x6a\x17\x01\xe7\x19\x32\x77\xda\xbe\x7a\xc9\x0f\x4f\xe2\xb6\x82\x46\x53\x5f\x8d\xf1\x92\xce\x31\x24\xbe\x2d\xbb\xc3\x2a\x06\x7e\x24\xc5\x5f\xb7\x19\x7d\xae\xed\xe5\x7c\x9b\x1b\x18\xc7\xb5\xf2\xd6\x6d\x1e\x72\xe5\x4e\xd6\x37\x65\x0d\x63\x53\x7b\xd9\xae\x3a\x6f\xab\xc4\xfa\x56\x4b\xa3\x26\x62\x6d\x30\x5f\x71\xfe\x01\xe7\xe1\x20\xd8\x02\xf7\x7a\xf6\x5d\x6b\x7e\xce\x21\x69\xdd\x79\x3a\x1f\xa1\x02\xce\xd4\xad\xb1\xbc\xfc\xfa\x95\xdd\x3d\x05\xd6\xf5\xd6\x4b\x2b\x8b\xa3\xf8\x0a\xfe\x39\xea\x5b\x6a\x93\x36\x78\x56\xc5\x15\x42\x54\xee\x24\xce\x95\xfb\xa8\x5d\xa9\x7e\xcb\xcd\xac\x41\x5e\xac\x7a\xa9\xb0\x7f\x3f\xea\x16\xfe\x4e\x5b\xf9\x34\x8b\x26\x0c\xbd\xe5\x56\x1e\xa9\x54\x3c\x1e\xb2\x7c\x93\x96\x32\xd8\xf6\xa1\x4a\xd2\x41\xa0\x9f\x3f\x3c\xe1\x86\xfe\xf9\x09\xe0\x79\x1e\x66\x5a\x60\x1e\x89\xf1\x1a\x2b\xd2\x81\x73\x62\x57\x10\x88\xec\x02\x95\x34\x59\x4e\x43\x00\xba\xe1\x05\xd1\x81\xf5\x93\x60\xc4\x35\x09\xf6\x04\xcc\xc2\x55\xd2\x30\x0c\x5e\x7b\x97\x5f\xdc\x8e\x08\xea\x37\x63\x4b\x36\xc3\xee\x34\xf9\x86\x9b\x23\x0e\x7f\xa9\x82\x04\xb2\x43\x35\x7c\x75\x3b\x6e\x2b\x9b\xc7\x94\x2a\xc3\x5f\x6a\x11\x06\xcd\x47\xed\x84\xb0\x62\x88\x73\x4e\x10\x1c\xe8\x19\x6b\x5e\xc6\xe1\x45\x2f\x78\x6a\x6f\x25\x82\xd0\x71\x5f\x40\xd0\x05\x83\x31\x20\xeb\x69\xc8\xcb\x57\x05\x18\xf6\x99\xd6\x2e\x0e\x95\xa9\xe9\xa4\x91\x48\x34\xbb\xfd\x59\x7b\x0e\x3a\x24\x4c\xfb\xb6\x80\x9f\x67\x8a\xe0\xee\x86\xe5\x65\x34\xca\x52\x2c\xa7\xc1\xdb\xc3\x7a\xb8\x66\xb2\xb2\x99\x0a\x2a\x58\x96\x5f\xe2\xda\xd8\x22\x65\xc5\x9a\x97\xb1\x02\x8c\xaf\x4a\xa5\xb8\x4f\xf2\x89\x73\x3a\x75\x2a\xdb\x8d\x35\x9f\x91\xfa\x5c\xf7\x24\x45\x6e\x23\x1e\x47\x35\xf1\xb4\xba\x87\xb8\x4c\xed\x0d\x54\xdb\xc6\x56\xc5\xeb\xbd\x96\x8c\xe0\xba\x01\x58\x52\xbc\xfa\x55\xf6\xfc\x18\x64\xf0\xca\x77\x23\x59\x49\x6f\x64\xc7\xfb\xe7\x24\xb9\xaf\x48\x6e\xf6\xf6\x93\x2d\x0c\x98\xfb\x71\xe1\x69\x35\xa3\xd9\x4e\x6a\x77\xd7\x3d\x78\x7d\x3f\xe5\xb8\xbf\xe5\x2e\xa6\x80\x10\x45\x51\x19\x40\x81\x00\x71\x64\xe7\x30\x6c\x35\xea\x58\x1b\xfa\xae\xa0\xbb\x35\x84\x9a\x50\x68\x40\xa2\x4c\xc4\xe9\x9c\x5d\x4a\xca\x05\xc8\x74\x18\x0c\x05\x72\x3d\xe6\xaa\x58\xce\x6a\x9d\xb4\x7b\xb5\xee\x20\x24\x51\x9e\x78\x51\x81\x34\x23\x3b\xc3\x95\x00\xa9\x56\x25\xf8\x25\x71\x51\x35\x0a\xc9\x2a\xeb\x52\xb1\xea\xd2\x6e\x0f\xc3\x9c\x6a\x2c\x0e\x73\xe5\x75\xd7\x73\x4f\x27\x9b\x00\x6d\x1f\xc9\xe8\x1c\x0e\x18\x04\x45\xaa\x7c\x74\x73\x09\x6f\xc1\xfc\x73\x9f\x40\x2d\x6c\x1a\x3e\x03\x86\x5f\x12\xd4\xb1\xe9\xa3\x5b\xf6\x38\x74\x73\xa8\x9b\x36\x17\xc3\x82\x0c\x3e\x14\x45\x07\x3f\x4e\x24\xad\x80\x1b\xc8\x93\xc8\x98\xe1\xef\x9c\x09\x7a\x20\xe1\x0f\xb6\x86\x72\x11\x73\xc1\x79\x2a\x4c\xc7\x16\xec\xab\x06\xef\x59\x87\xc4\x0a\xd7\x27\x5e\x93\x51\x94\xf7\x15\x6f\xb7\xee\xe0\x76\x7c\x5f\xed\xf9\xe2\xa0\x80\x96\xe7\xeb\xb5\x8d\x0a\x9d\x63\xb8\x51\x2c\x0e\xb3\xea\x68\x06\xdb\xb9\xc0\x68\x1b\xd4\xee\x42\x8c\x27\x59\xd0\x6d\x53\xe4\x20\x81\x86\x45\x8c\x40\xe4\x4a\xe6\xb0\x91\x82\x0d\x06\x8b\x41\x3b\x08\xc8\xcd\x01\xe4\x8c\xb7\xb7\x12\x53\x17\x26\xd8\xee\xe4\xd4\xb2\x7d\xe4\x4b\x3a\xf3\xb8\xf6\xca\x13\x5d\x7f\x80\xaa\x1a\x2b\x4b\x84\xd0\x2a\x93\x5d\xdd\x21\xb3\x3a\x27\xd7\x90\xa1\xb9\x63\x8e\xa3\x71\xe4\x1c\x92\xf0\x50\x72\x73\xdb\x06\x62\xa4\x8c\x19\x2a\xa4\x27\x69\xb7\x41\x4a\xad\x44\x40\xae\xa0\x59\x37\xd6\xdb\xd2\xec\xd7\x92\x55\x0e\xf0\xee\xa4\x5b\x22\xd4\x88\xb3\x92\xb9\x5d\xea\x81\x1a\x3e\xa2\xbd\xfd\x89\x1d\x73\x91\xa4\x7f\x15\x2d\x62\xf0\x66\xad\xd6\x0a\x5e\xf7\x48\xa2\x13\xcf\x2d\xf8\xaa\xac\x16\xa8\x71\xc2\xfd\x6a\x32\x23\xe5\xc3\x59\x77\x71\x48\x0a\x79\x3f\x6a\xa4\xb0\x10\xf5\x6e\x7f\x22\x16\x9d\xd6\x4f\xae\x6f\xfe\x60\x63\x42\x9b\xdb\x03\x35\x95\x0d\x3b\x46\xa5\x46\xe1\xab\x1b\x57\x73\x72\xca\x4d\xac\x60\xc3\x0d\x6a\x94\xc0\x79\xc9\x5c\x62\xb7\x57\x55\x01\xd7\xe9\xf3\x6e\x99\x12\x87\xc7\x12\x3b\x97\x1e\xc5\xc4\xc8\x4d\xea\xea\xca\xb5\x64\xe2\x4e\xf4\x6a\x5a\x39\x06\x37\x06\x0f\x28\xc2\x7f\x56\x96\x33\x20\xa5\x12\xe2\x4c\xab\x66\x2e\x7c\xcc\xa2\x4f\x96\x0d\x45\x67\x82\x6a\x70\xa2\x45\xd8\x12\xd6\x72\x40\x3b\x97\x29\xb0\x27\x23\x81\xaf\x39\x71\x0c\x09\xdd\x00\x50\x16\x78\x49\x88\xfa\x10\x6b\xa9\xdc\x27\x68\x70\x4a\xdd\xb6\xae\xd5\x66\x08\x47\xec\x47\xb6\x52\xf9\x3c\x26\xcd\x01\xf2\x4e\x8c\x85\x7d\x45\x5f\x0f\x82\x2c\xd1\xa1\x5d\x30\x51\x60\x5e\x5b\x5c\x5b\x98\x6a\x2b\xab\xc7\x4f\x89\x9d\x22\x1c\x88\x46\x93\x6c\x3a\x3f\xce\xb3\xe9\xcb\x2f\xbc\x7a\x7b\x77\xd4\x3c\xaf\x40\x1b\xdd\xd3\xdf\x55\xfc\x58\x4b\x0d\x86\x22\xc1\x53\x54\x1a\x2a\x09\x13\x91\xb0\x57\xd3\x9e\xbf\xc1\x2d\xe4\x92\x36\x34\x5b\xe7\x42\xfe\x3f\x93\x60\x9d\xcc\xe5\xd1\xec\x6f\x47\x89\x61\x9a\xd6\xc0\x24\xf9\xeb\x75\x80\x51\xa2\x14\xc6\xa7\xe2\xdf\xe1\xba\x6f\x45\x9b\x61\xbc\xc9\x6a\x4e\x85\x71\x53\x22\xd1\xc8\xda\x77\x32\x70\x7a\xbd\x48\x51\x2d\xd1\x29\xe6\xf9\xb9\xb9\x7f\x21\xfe\xb4\x93\x10\x0a\xef\x08\xb3\xe3\x84\xcd\x45\xa0\x07\x0a\x71\x63\xad\xdd\x53\x18\x9a\x90\xa5\x8a\x6c\xf0\xc5\x8e\xdb\x56\x6b\x9b\xaa\xcb\xdf\xb5\xc4\x4f\xfd\xdf\xf7\x72\x64\x55\x7d\xa4\x68\x5d\x74\x18\x96\x10\xc5\x11\x2f\x4c\x8d\xd6\x55\x52\x3c\xb5\x70\xe8\xa9\xaf\x8b\x94\xd0\x34\xb7\xf8\x20\x1a\xe7\xd8\xda\xf3\x89\x14\xda\xc4\x0c\x0c\xc7\xe9\x64\xd6\x25\x0b\x46\x19\x86\x89\xe0\x5f\xeb\x64\x22\xd6\x2a\xb0\x6b\x9d\x6e\x4d\xb2\x11\x6d\xf5\x6b\xcd\xfa\x11\xde\xb6\xaa\x6d\xf2\x57\x6d\xd5\x8a\xc5\x97\xbe\x71\xc5\xa2\x0b\x11\x1d\xb7\x97\xa2\xf9\xef\x3e\xed\xf8\x8d\x51\x9b\xfe\x4e\xae\x5b\x1c\xe3\xd7\x3a\x66\x7b\x32\xe5\x68\x5a\xbc\x5f\xeb\x13\x1c\x9b\xae\x8a\xfc\x88\xcf\x38\x1a\x21\xf1\x85\xf3\x3c\xaf\x9f\x67\x14\xb1\xab\xc9\x1f\xa5\x7e\xcb\x3c\x3d\xe7\xff\xb4\xfb\xdd\x9f\x43\x33\xcd\x54\x18\xbd\xe0\x1c\xb6\xa2\x1a\xa4\x8c\xd5\x0b\xbe\x8a\x6a\xd4\xa2\xb7\x25\x99\xd5\x73\xb4\xf4\x52\x37\xb7\x16\xf4\x32\x0f\xf2\x92\x1e\x11\xc8\x6d\x82\xbe\x68\x30\x81\x63\x07\x6c\x37\x47\xec\xe8\x24\x5f\x94\xd9\xf8\x2c\x29\x0b\x9f\x51\xe0\xaf\x3a\xeb\x6f\x0a\x79\x8a\x2e\xe6\xc5\xb4\x58\x96\xe3\x9b\x3e\x56\x61\x9c\x7c\x5c\x1b\xb0\xfc\x1b\xe1\xdc\x70\x79\x57\xf9\x14\x2d\xba\x57\x14\xc2\x28\x19\x87\xb0\x88\x83\xf7\x1c\x16\xe9\x38\x2b\x87\x02\xe1\x93\x0a\x86\x28\x75\xbd\x8a\x22\x3c\x04\xec\x8f\x0d\x3e\xcc\x2e\xd1\x33\x35\x1c\xf5\x1b\xc3\x35\xa0\x07\xce\xde\xa7\x61\x45\xb0\x80\x38\xf4\xef\x08\x36\x38\xeb\x30\xa0\xad\x4a\x65\x31\xac\xe2\xc7\x52\x85\x15\xd3\xe7\x8f\x16\x92\x21\x82\xf1\x54\xbf\x87\xa7\x0a\xcb\xc8\xd3\xb9\x7a\xf8\x1c\x74\xea\xff\x11\x5b\xe9\x98\x70\x2b\x29\x90\x5c\x10\xc4\xdd\x3a\x19\x94\x85\x18\x37\xc7\x3e\xeb\x79\x4b\x65\xae\x84\xc6\x46\x85\x93\x50\x9c\x9b\x80\x8e\x79\x6b\x41\x3d\x8e\xfb\x6f\x47\x41\xa5\x2d\xff\x05\x54\x54\x6a\x51\xe3\x4b\x28\xc9\x35\x50\x4b\x4d\x65\x25\x48\x1d\x8b\x84\x41\xea\x4c\x69\x83\x80\xd4\x22\xce\xf8\x69\x54\x1d\xa7\x11\x8f\x6e\x25\x95\x4d\xfc\x1e\x56\x59\x32\xb1\x50\xad\x9a\x40\x5f\x88\x54\x14\xd6\xa6\xbb\xae\x15\x9e\xcd\x13\x44\x91\xfd\x9f\x60\x8a\xa1\xfc\xa9\x26\x29\x06\x00\x37\x27\xb1\x31\x98\xa6\xc8\xec\x6f\xa3\xf1\x22\xa2\x48\xf2\x63\x9c\x6b\x4f\x76\x58\xf8\x64\x1b\xc4\x17\xb5\x24\x8c\x7b\xb2\xb3\x96\x54\xff\x34\x72\xbc\x6b\x1a\x25\x51\xf3\xbc\x2b\x9e\x37\xb1\xa2\xf5\x63\x3d\xe2\x1f\xbb\x2c\x7d\x37\x2f\xcf\x15\xbf\xaa\x32\x9a\xa3\x89\xb2\x81\x4e\x30\x0a\x22\x4e\x27\xc4\x31\x68\x1c\x50\x0e\x28\x09\xb1\x9a\x80\x21\x63\x6e\x0a\xaf\x34\x76\xe7\xb6\x50\xa2\x58\x7e\xc6\x57\xe8\x1a\xa3\x2b\x88\xee\x65\x4e\xaa\xa6\x29\x58\x47\x51\x91\x82\xae\xe4\x98\x45\x13\xcb\xa9\xbe\x52\x30\xa1\x56\x73\x75\x36\x2b\xc1\x69\x12\x5f\x4a\xbe\x61\x70\xc4\x0a\xf2\xf5\x4c\x51\x3f\x24\xd5\x7c\xc6\x2a\x90\x66\xef\x76\x91\x56\x55\xa9\x9c\x77\xe3\x5d\x05\xb1\xa7\xb5\x9f\x79\x05\xe1\x07\x30\x09\x89\x2e\x72\xab\x89\xa6\x98\x89\x49\x0a\xc1\x2e\x7d\x4c\xb1\xb0\x9c\x64\x18\xca\x44\xd3\x34\x2b\x6b\x0e\x8e\xe1\xb6\x5c\x5b\xb8\x8f\x12\x66\x93\xda\x14\xf0\xe2\x78\x82\x31\x95\x00\x79\x99\x67\x9c\x56\xf7\x0a\x03\x02\xf3\xa9\x50\x98\x6b\x2a\x20\x35\x09\x5d\xc4\xae\xd7\xd7\xdb\xf8\x51\x73\x11\x58\x94\x3b\x43\x67\x17\xf4\x7d\x82\x3c\x18\x1d\xc3\xc0\xb7\x74\x2a\x50\x35\xec\x76\xfa\xdb\xbb\xee\x10\x5c\x68\x0c\xae\xe8\x0f\xce\x81\x29\x71\x7d\xf2\x5f\xd6\xc9\x2e\x6a\x26\x01\x3a\x31\x5c\xe8\xcd\xb8\xa8\xdc\x13\x77\x4b\xd5\xc3\x11\x7a\xdf\x6d\x69\xd0\x1c\xb3\x96\x0c\x9d\x02\xb0\x2c\xb0\xac\xec\xc2\x0a\x07\x70\xcb\xdb\x2d\xe2\xe8\x93\x60\x60\x35\x97\xde\x3d\x29\xf1\xfb\x9a\x12\x32\xb4\xcf\x6e\xa6\x31\xd2\xf7\xd2\x94\xb9\x32\xd5\x56\xaf\x14\x7c\xd2\x5a\xc4\xfe\x63\x45\x22\x32\x2c\xa7\xd7\xbc\x20\xc0\x7e\xf6\x5d\xcb\x44\x19\x9e\x62\x2a\xdc\x49\xdb\x40\x74\x4b\x43\xe3\x6e\x60\x7f\xd2\x1d\xad\x88\x0c\xa4\x13\xd6\xea\x12\xfe\x7b\xdc\x79\x95\x30\x96\xaf\x72\xe9\xc5\xb4\x40\xed\x23\x2b\xea\x1f\x45\xf3\xa7\xa5\x12\xa9\x45\x4c\x2a\xa7\x30\xc2\x15\x3b\x2b\xe6\x19\x87\xb0\xc0\xa3\x16\x06\x71\x95\x8d\x78\xe0\x74\xc5\x89\x40\x00\xe6\x05\x0a\x9a\x32\x4f\x18\x08\x45\x53\x9b\xee\x21\x62\x75\xf0\x23\x0b\x41\x40\xa2\x83\x8b\x59\xd6\x31\xbc\x5a\xde\x61\xe7\xfd\xc5\x20\x1a\xae\x27\x56\x79\x20\x38\x87\xea\xd1\x75\x27\xc5\x50\x6a\xc2\xf8\xaf\x7c\x3a\xcc\x47\x99\x93\x3d\x38\x7c\x0d\x35\x27\xd3\x62\xdd\x56\xed\xf0\x02\x98\xeb\xfc\xd5\x4d\x72\xbe\x04\x1f\x76\xca\x17\x4f\x71\x8f\x46\x9a\x59\xad\xf4\xd0\xc9\xa2\x02\x9c\xcc\x45\xa6\x34\x1e\xe1\x6b\x27\x15\xb0\x9c\xbc\x8b\xaa\x52\x0c\xde\x0a\xd2\x16\xcb\x5e\xd6\x24\x06\x0c\x53\x0c\x76\x7a\x81\x81\xb8\x88\xa6\x6e\xae\x69\xcd\x91\x8e\xd7\x5a\x44\x0b\x7e\xcb\x61\xd6\x34\xfc\x85\xc3\xac\x99\xb4\x1f\x43\xeb\xf2\x30\xb0\x32\xed\x34\x0b\xe4\x5e\x14\x95\x11\xa5\x1d\x3c\x55\x51\x52\xcf\x20\xfa\x70\x39\xca\xe1\x02\x42\x88\xf5\xd4\xc8\xbf\xe0\xad\x36\x03\xa4\xbf\xcc\x30\x11\x2b\x63\x97\x4d\xbf\x4f\x33\xdf\x71\x5d\x91\x05\x5d\x16\x3a\x8b\xde\xa9\x3f\xdb\x24\x0c\x3a\x2b\x54\x6e\xe4\x70\x9d\x7b\x75\x72\x6e\xb3\x2c\x8b\x02\x68\x8b\x91\x50\xc1\xfa\x3c\x94\x56\x6a\xdd\xde\xda\xb2\x0e\x85\xb0\x86\xc7\xff\xb9\xcc\xc6\xc3\x0b\x1e\xc2\x47\x7b\xa1\x9c\x16\x70\x94\x71\x7d\xe1\x6a\x32\x6b\x6f\x9e\x8d\x61\x8a\x6a\x06\xa8\x87\xc8\x1f\x96\x0b\x8c\xb4\x54\xb9\xa2\xbd\xc2\xbb\xd0\xf2\xc7\x20\x3f\x4b\x39\x1f\x76\x7a\xde\x19\x53\x45\x61\xe7\x3d\x6f\x0c\xec\x33\x0b\x86\xbf\x4a\x37\x90\x38\xcc\xde\xf8\xb0\x2d\x2b\xa1\x72\xd0\xf5\x93\x07\x5b\x5b\xd5\xe3\xd5\xa2\xa5\xcf\xde\xc4\x47\x59\xf9\x69\x51\xcc\x5e\xab\xb5\x04\xfa\xfb\xe8\x9c\x56\x54\x62\xdc\xb4\x7c\x4e\x69\xd9\xbc\x3c\x39\xc4\xbd\x25\xba\x89\xae\x9d\x1a\xbd\x7b\x1c\xf1\xfd\x33\xf8\xc8\x10\xed\x47\xfa\x3d\xc9\x17\xe3\xac\xe9\xc5\xfb\xaf\xce\x02\x8a\x74\x76\x50\x89\x65\xb8\x35\x19\xda\x06\xfe\x0e\xef\x72\x07\x5b\xef\x7c\xee\x85\xbb\xa2\x3b\x82\xdc\x80\x1f\x39\x79\x0f\x97\xb3\xf0\x9a\xc7\x14\xcd\x6e\xa4\xb2\xc5\x1c\xe3\x80\xe7\x69\xce\x2f\x23\x75\x8a\x18\x76\x3f\x62\xa5\x29\x24\x3b\x87\x8c\x8b\xc1\x69\xe5\x13\x32\x2e\x30\x10\xc9\xeb\x1a\x52\x3e\x3c\x86\xcc\xe7\xc1\x7d\x23\x46\x00\xa5\xaa\x4f\x4e\xf3\x85\x12\x42\xf5\x17\x7c\x69\x8d\x50\x92\xcd\x11\x0a\xc3\x61\x81\xc5\xf1\xa2\x24\xed\x4d\xb2\x90\x24\x3b\xc0\xfc\x22\x4b\x95\x81\x86\x30\x34\x03\x54\x82\x74\x12\x8d\x56\x44\x8c\x33\x66\xfb\x28\x67\xe6\x46\xd3\xd0\xc4\xca\x6b\xa1\x6a\x4b\x90\xc9\x88\x4b\x3c\xfa\xca\x9f\x9d\x85\x3c\xde\x69\x51\x40\x56\xd2\xcf\xf4\xd6\x25\x27\x73\x02\xe9\x03\x78\x0c\xb5\x06\x9c\x90\x1b\xe3\x82\xa6\xe6\xdb\xea\xa7\xf7\xd0\x29\x3e\xda\x3c\xbc\x85\x2e\x6e\x9f\xdd\x1a\x9e\xbb\x1a\xd2\x20\x1b\xca\x9e\xed\x91\x0d\xd5\x5f\x78\x43\xb3\x6b\x43\x99\xf8\xf2\x00\x43\xe3\x83\x1d\x78\x8e\x3d\xac\xa6\x85\x96\xd8\xdb\x82\xb9\xe9\xd0\xaf\x1a\x4f\x26\xb4\xe6\xef\xa1\xfc\x9a\xd8\x48\x20\xdc\xc5\x74\x7a\xe3\x8f\xe1\xd7\x6f\x99\x9a\xe5\xed\xb7\xec\xc0\xe2\xa0\xb6\xda\xb2\x5c\x17\xe7\x2d\x8b\x6c\x09\x40\x9f\x00\xfa\x3f\x62\x9f\x88\xce\xd1\xdf\x9b\x68\x11\x8b\x23\x06\x1a\x46\xc0\x5a\x39\xcb\x3c\x28\x5f\xd4\x1d\x30\x0e\x36\xb9\xbf\xa4\x25\x61\xf9\x80\xbb\x50\xdf\x99\xd2\x5c\xfe\xdd\x32\xc5\xbc\xc3\xa6\x14\x14\x81\xf6\xd8\x87\x07\x30\x0a\xcc\x3d\x03\xbc\xc3\x69\x91\x8f\x4b\x52\x90\x5f\x21\xcb\x7a\x75\x91\x41\x4b\x60\xc0\x13\xc8\x05\xcf\x8c\xc9\xfc\x71\x9b\x05\xde\xad\x22\xd1\xb4\x59\xe8\x08\x80\x4d\xd3\x82\x87\x7a\x33\x7f\xad\x23\x5a\xb5\xf0\x72\x93\x7b\x8c\x13\x4a\x06\x6e\x5a\x0b\x92\xeb\xd5\x35\xe4\xc5\x19\x9f\x15\x50\x01\x28\x9a\x00\xf8\x3c\xe0\x35\x0d\x12\x87\xc2\x99\xb5\xbb\x40\x73\x15\x8c\x26\xca\x93\xa4\x72\x97\xe1\xd9\x31\x57\x29\x24\xc0\x59\x90\x23\x17\xe1\x3b\x44\x4f\x4e\xc5\x12\xdf\x70\x70\x82\x65\xb9\xfd\xe1\x71\x0a\xb2\x56\x7b\x7a\xa5\x8b\xd7\xef\x25\xcb\x23\xeb\xb7\xdf\x53\x80\xc5\xfe\x35\x9b\xaa\x36\x43\x6b\x59\x5b\xee\x28\x1d\x0d\x68\x6e\xeb\xd7\x5f\x6a\x35\x8b\x70\xfb\x3d\x3a\x0a\x75\x99\xb7\x91\x09\xdf\xad\xda\xb1\x31\x71\xcd\xd9\xe2\x2a\xcb\x04\x6d\x24\x9f\x40\x96\x11\x24\x63\xf0\x0a\x45\x4c\x15\xa2\x6d\xad\xf1\x76\xdf\xf4\x91\xc4\xcb\x33\xa8\xe5\x00\xf9\xf4\x46\xc8\x01\x92\xfe\x2a\x65\xb9\xab\xe3\x2b\x23\x88\x73\xf6\x5b\x18\x02\x9b\x05\x93\x8c\x7c\x0d\x8b\x9a\x18\x2c\xa9\x0e\xe9\xad\xa5\x6d\x01\x06\x2b\xc1\x00\x9e\xc0\x55\x59\xe3\x35\xf7\xe5\xdb\xee\xaf\xca\xed\x77\x7b\x57\xea\x37\xbc\x68\xb7\x03\x72\x90\x8d\x17\x53\x8e\x1d\xe1\x31\x7f\xdf\x49\x58\xfc\xc5\x7d\x38\x56\x19\x35\x2a\xda\xf2\x0a\x62\xe3\x1f\xfe\x10\xc8\x92\x01\xfe\xc8\x96\x4a\x97\x71\xa7\x31\x2b\x87\x0a\x58\x3d\xf0\xae\x53\x0e\xa8\xc0\xcc\x7b\x25\x67\x5b\xb8\x82\xff\x83\xc0\xa3\xab\xf4\xa6\x8f\xe8\xf6\xd2\x4b\x06\x09\xfb\x6f\xa4\xa5\x53\x60\xae\x38\xe9\xdc\x86\x95\x46\xda\x26\x09\xa9\xcf\xb8\x23\xf3\xa3\x52\xb1\xe8\x18\x48\x97\x11\x45\x86\x37\x1f\x1a\x93\x88\x54\x03\xac\xd3\xb1\x99\x39\xa2\xb0\x7c\x8c\xbb\xee\x6b\x68\x0e\x2c\x4c\xf6\xaf\x6a\xe9\x8b\xd0\x2e\xa6\xb5\x22\x37\xd3\x21\x19\xf8\x5c\x58\x71\xa4\x58\xee\x25\xd1\x59\x6b\x15\x10\xe2\x7b\x3e\xc0\x3e\x86\x3e\xfe\x9e\x7b\xd3\xfa\xe9\x18\xf2\xe9\x45\x9e\x0c\xef\xbb\xba\x70\xf8\x30\x10\xc7\x8b\x1f\xd1\x74\x92\x63\x48\xe0\x65\x0e\x78\x72\xde\xd5\x83\x7c\x97\x7c\x70\x66\x61\x76\x62\xc6\x16\xa4\xd7\x7f\x77\xa9\x70\x90\x69\x26\x19\xc9\xbc\x36\xc8\x10\x42\x49\xc9\xa7\x92\x9f\x49\xf6\x12\x82\x34\x87\xc0\x92\xdc\x48\x3f\x25\xe1\x36\xe1\x2b\x65\x53\xb1\x38\x3e\x0f\xea\x98\x61\x9b\xfb\xe4\x93\x19\x13\xdb\xfd\x7f\x35\x67\x50\x59\xc9\xdb\xdf\x44\xb4\x99\x4f\xb1\x85\x36\x2f\xce\xd0\x2b\xcf\x6f\x0d\x5f\x22\x77\x68\x84\x92\xe8\xc4\x79\x37\xa8\x4a\x72\x44\xd0\x56\xe5\xa5\xdb\x8f\x17\x7f\x5c\x51\x66\x44\xcb\x55\xd5\x19\xc1\x88\x7f\x26\x32\xe8\x45\xec\x15\xfc\xa9\x0b\xa9\x18\x1a\x29\x56\x48\xa9\x9e\x66\xa5\x44\x1d\xd5\x66\x31\x3a\x05\x0a\x16\x15\xe2\xd7\x22\x09\x3d\xd4\x2f\x25\x0a\x5e\x97\x5b\x90\x85\xab\x11\x23\x8c\x8a\x75\xb6\x91\x40\x6e\x4b\x22\x2d\x89\x44\xcc\x70\x35\x4a\xd4\x62\x96\x0e\xf3\x05\x3c\x05\x9d\xad\xce\x63\x4f\x49\xe8\x65\xa0\xa8\xcd\x3c\xb1\xba\xdd\x41\xe7\x71\x13\xa1\x7a\x8b\xb0\x62\xa9\x78\xe2\x4a\x8d\x29\xfb\x32\x55\xe7\xfa\x63\x04\xbb\xf3\x9f\x60\x0f\x7c\xad\x17\x3b\xad\xe1\xeb\x0f\xc7\x26\xb8\xb6\x29\xb5\x2b\xe9\xf8\x54\x62\xe8\x30\x90\x05\x9a\xb2\x12\x30\xa2\xbd\xa7\x6c\x58\x6a\x22\xf8\xea\x66\xc6\x01\x83\x16\xc5\xec\xc8\x3d\xe8\x31\xbd\xfa\x89\x2b\xe1\x70\x43\xc9\x6d\x6f\x45\xcd\xa7\x5e\xa1\xae\xea\x4a\xe3\x8f\x92\x53\x4b\xa4\x9d\x6a\x72\xd3\x18\xc7\x16\xb3\xe0\xaf\x05\x99\x30\xa9\xf1\x3f\x06\xa3\x56\x7c\xdb\x9e\x15\xaa\x4a\x95\x6b\xd1\x22\x8f\xa0\xc1\xd5\xdc\x68\xb0\xf3\xf9\xc8\x66\x51\x96\xfd\x34\x82\x71\xba\xd1\x74\x02\x29\xec\x7a\xbd\xb2\x46\x56\xbb\xe2\xdb\xde\x3b\xb3\xeb\xf8\x39\x5d\xf1\x10\x04\x3c\x6d\x75\x1c\x02\x3c\xf2\xe4\x09\x18\xff\xa6\x59\x47\x2d\xc1\x51\xb6\x2e\x9f\x3d\xcb\x90\xc8\x9b\x67\x78\xa5\x1b\x01\xe6\x22\x1f\x8d\x32\x9b\x1d\x73\x52\x00\x70\x91\x35\x44\xb7\xe8\x3b\xe9\x74\x78\x42\xf5\x57\xcb\xc2\xc5\x6f\xe8\xf5\xe2\x05\x47\x7f\xc1\xd9\x2b\x74\x5e\xa9\x10\x45\xf3\xe2\xde\xad\x50\xc5\xba\x3e\x02\x2e\x0d\x94\xec\x41\xcd\x00\xc7\xe4\x42\xb4\xa2\x53\x32\x58\xdf\x6d\x41\xb6\xd6\x30\x4e\xfd\x46\x3b\xf6\x2c\x37\x64\x2b\x68\xb4\xa0\xd3\x3c\xba\x9d\x30\x91\x76\xcc\x4b\x6d\x75\x3b\xfd\x64\x55\x43\x32\x87\xd5\x6d\xf5\x3a\xd6\x22\xf6\x76\x36\x4a\x39\x90\x1a\x52\x96\x72\x32\xff\xc1\xe0\x26\x99\x2d\xe7\xc0\x82\x96\x1b\xce\x8a\xc7\x37\x64\x25\x4f\xb1\xb9\x6b\x8e\xe5\x6b\xd7\x06\x28\xbb\x0a\x90\xce\x45\xfe\xb1\x91\x97\x7b\x66\xbb\xd2\x59\x99\x8d\xfc\xd4\x49\x14\x8d\x02\xc2\x84\x94\xdd\x83\x11\xb9\x76\x7c\x46\x6a\x77\x04\x70\xbf\xac\xe9\x44\x38\x55\x4e\xea\xae\x77\xad\x9a\xa1\x63\xe8\xc7\xe7\x97\x17\xe9\x8c\xb8\xfa\xa9\xd6\xb6\x0e\xc1\x4a\x3a\x32\x8f\xcd\xb4\x84\x83\xbe\x12\x13\x1a\x07\x40\xb7\x58\xcd\x45\x8f\x1d\xc9\xd2\x51\xe7\xc7\xf0\x53\x20\x2f\x6b\x8a\xf3\x6d\x85\x67\x60\x1c\x33\x37\x06\x5c\x1e\xc8\x7c\xe9\xdb\x63\x77\x6c\xe4\xd9\x92\xe0\x65\x00\xf4\xba\x18\x7e\xb2\x5c\x22\x08\x34\x00\x72\x3b\x84\xb4\x20\x74\x47\xc8\x60\x82\x19\xa9\x61\x6d\x3c\x7d\x79\xb8\xf7\x27\x7b\xf3\x51\x4a\xc3\x9b\x71\x30\x03\x75\x24\x71\x1a\x74\x38\xaf\x38\xf1\x61\xab\xd3\xa9\x8e\x5c\x69\x9e\xde\xe1\x85\x21\x1c\x18\x80\x65\xea\x01\xbc\xa9\x69\x9c\xfb\xbb\xaf\xc4\x9f\x94\xba\xbf\x10\xdf\xd4\xdb\xdf\xf7\xd2\x44\xd5\xda\xdc\x59\xcc\xd3\x69\x69\x78\x65\x43\x3b\x61\x61\x43\x60\xd9\x9c\x1e\xdb\x63\x5e\x23\x97\x77\xc8\x2f\x05\xae\x8f\x52\xa6\x53\x16\x46\x1e\xb6\x8d\x9d\x9a\x57\xec\x13\x33\x5c\xab\x26\xfd\xf6\xf5\xb3\xfd\xa3\x97\x07\xaf\xf7\xbf\x6c\xe6\x10\x6a\x82\xf9\x05\x7f\x93\xb9\x07\xf3\x82\x54\x0e\x9c\xbc\x1f\x8f\xaa\x19\x00\xa6\xde\x44\xc0\xe4\x24\xbb\x4e\x11\xb4\x45\x82\xe9\x79\x64\x2b\x96\x4e\x2f\xaf\x5e\x37\xf6\xae\xf9\x3b\xd0\x83\x3a\x04\xf8\xd3\xc7\xaf\x43\x13\x91\x89\xdd\x92\xab\xad\xc4\x61\xc7\x79\x57\x1b\xed\x61\x9a\xfb\xc7\xc4\x7a\x98\x6e\xda\x86\x5d\xb4\x61\xa6\x63\xe1\x17\xb6\xde\x97\x84\x5f\xd8\xca\x2b\x5d\x2c\x28\xac\x22\x2e\xbe\x51\x89\x9a\x00\x0d\x5b\xa5\x2e\x98\xe7\x18\xee\x73\x33\x82\x0b\xe0\x7a\x61\xf9\xff\x0a\x96\xd7\xab\x74\x3e\xa5\xe4\x9d\x76\x1b\xf5\xef\xa8\x08\x4f\x26\x60\x1e\x3f\xcf\xec\x8f\x50\x1b\x53\xa9\x4b\x60\x50\x6e\xa4\x08\x50\x47\x9a\x9f\xb0\xf6\xc4\xbc\xa6\xe4\xdd\x46\xc9\x22\x8a\x64\xb0\xb5\xf5\x7b\xf0\x1f\x46\x2a\x45\xc6\xe0\x42\x7c\xe6\x6c\x00\x3f\xe5\xba\x1e\xdf\xb4\x55\x27\x5c\xb0\x21\x86\x87\xa7\xf4\x08\x38\xc7\x7c\xa5\x26\xc1\x34\xf0\x7f\xcc\x70\xdf\xd1\xb4\xc2\x74\xd0\xa2\x11\x40\x0d\x01\xee\xe8\x5f\x5d\x61\x7c\xad\xb4\x18\xcc\x3a\x84\x5a\x91\x37\xac\x5b\xe5\x7c\x0c\xd7\x62\x5a\xd8\x1f\x67\xf0\xcf\x6e\x67\x94\x5f\x76\xb4\x6f\x48\xd8\x00\x73\xaf\xc3\xb2\x04\xb8\x6c\x08\x9f\xb0\xcc\x5a\x07\xfd\x96\x76\x20\x61\xc5\xf0\xd3\xe3\x8e\x62\xe3\x2a\x2e\x65\x3b\xc9\xef\xce\xce\xb6\xcd\x1f\xbf\xd8\x59\x31\x5d\xac\xc3\xf5\xba\x93\x8c\x0d\x6f\x9e\x05\x8d\xe0\x2e\xae\xcf\xd3\x51\xbe\x2c\x77\x92\x47\xb3\x6b\xff\x3b\x6b\x13\x76\x92\xad\x8d\xef\x1e\xf8\x9f\x66\xe9\x08\x38\x28\xf8\xb4\x9d\x4d\xcc\xff\x3e\xc0\xff\xb5\x7f\xf7\x4b\x1b\x76\x7e\x27\xf6\x3b\xba\x10\xec\x24\x03\xa8\x17\xb4\xcf\x07\x66\xc7\xa6\xad\xf4\xbf\xaf\x5f\x65\xa7\x9f\xf2\xc5\x3a\xf8\x0c\xe0\x04\xd7\x53\xe4\xfd\x76\x12\x10\xa2\xe2\x65\x81\xd4\xd7\x89\x73\x8c\x16\x9b\x14\x7f\x6d\xd7\x1e\x14\x8c\x34\x16\xa0\xd1\x54\x36\x1a\xda\xde\x63\x94\x31\xf2\xcf\x7d\x45\x14\xff\x2a\x9d\x9a\xff\x9d\x8b\xd3\xd2\x51\xc6\x96\xf8\x52\x48\x81\x48\x5f\x35\xc8\x15\x45\xd6\x78\x8f\x09\xb3\x0f\xa6\x8b\xee\x8a\xf7\x0c\x9a\x78\x6e\xfe\x69\xce\xed\x5d\x38\xcb\xbd\x0f\x4a\x9d\x54\x43\x99\x40\x43\xcf\xd3\x49\x3e\xb6\x96\x0b\xdf\x53\xd2\x50\xd8\x19\x7e\xee\x38\xec\xd0\x8a\x22\x2e\x7e\xf0\x36\x88\x81\xd0\xf9\x6c\xe9\x30\xe5\x97\xfa\x1b\xa7\x12\xda\xbb\xc8\xc7\xe4\x8c\x56\x3d\xc1\x4a\xf3\x64\x6f\xfd\xa6\xde\xb4\x7f\x5d\x43\xb9\x0d\x4a\x2d\xb2\xb2\xe7\xca\x05\xed\xc9\xeb\xe0\xf3\x02\x72\x36\xca\x51\x0c\xed\x92\x4e\xd0\x8d\x1b\xe4\x13\x73\xf9\xeb\x7b\xbb\x52\x4d\x72\xb0\x9a\x6b\x37\x9f\x92\x43\xf2\x25\x7a\xe7\xe6\xe0\x17\x82\xe7\x3a\x81\x6d\x00\x6b\xf7\x14\x81\x77\xa0\x29\xa8\xed\x0d\x63\x23\xd1\xf6\x07\xeb\x45\xfc\x29\xcb\x28\xa7\x84\x74\x27\xaf\xc4\xe9\x3c\xcf\xce\x30\xe7\x27\xe6\x87\x25\x1f\x92\xa0\x4b\x14\x91\x20\xc1\xbf\x6d\x0e\x96\xae\xb3\x70\x56\x0b\xf3\x5e\x43\x8c\x0a\x73\x79\x38\xb0\x20\x68\xfc\x2c\x9f\x57\x01\x5a\x04\x96\x79\x52\x9e\xf3\xa2\x98\xbb\x11\x13\xba\xfc\x74\xf2\xea\x65\xcf\x0e\x92\xed\x22\x30\x6e\x0e\xa3\xe1\x69\x78\x18\x1f\xe4\xb2\x4f\x30\xaa\xfc\xd6\x62\xab\xfe\x26\xa0\x0b\x40\x9a\x83\x1f\x14\xf8\xff\x9a\x67\x08\x85\x44\x53\x18\xda\x22\x72\x71\xed\x27\x9e\xf2\x7c\xb0\xf1\x80\xfd\x6d\xc1\x5d\xfb\x4d\x5a\x96\xc8\xb7\xe1\x23\x26\xa0\xc4\x5c\x53\x1a\x33\x67\xe4\x06\x82\xb0\xa0\x2f\xd8\xab\x2e\x84\x4b\x4e\x17\x39\x01\x60\x4f\xc5\x59\xca\xd4\x58\x95\x86\x09\x1e\xc0\x43\xde\x3d\xf5\xf6\x99\xb5\xeb\xeb\x29\x87\xcf\x20\xb7\x5e\x7d\x02\xed\x19\x6c\xd0\xfc\xaa\xba\xb7\x7e\x02\x75\xe5\xa6\xe7\x2f\x78\x9f\x06\x0f\xc2\x07\x4a\x3d\x6f\xd7\xd7\xeb\x91\x17\xee\xab\xbd\x60\x6d\xdf\xa3\x55\x6f\x8c\x3c\x5b\x20\x3d\x71\x83\xa2\xb3\x1f\x3c\xda\x9a\x94\x49\x66\xa4\x9d\xf5\x7c\xda\xee\xc5\xa9\x3e\x5f\xab\xdb\xed\xd5\x6d\xe3\x86\x59\x90\x7d\x73\x35\x2d\xc0\x5b\x35\x9b\x66\xf3\x6e\x07\x35\x89\xc0\xcd\x77\xfa\x8e\xac\x54\x8a\xf0\x0c\x9e\x02\xa8\x62\xe1\xe4\x1e\xdb\x2f\xa5\x79\xf4\xdf\x18\x4e\x30\x3d\x4f\x9d\x0e\x08\x19\x5a\x36\x80\xe9\xb7\x32\x46\x11\x5a\xaa\x6a\xf6\xa6\x7f\xdc\xd0\x4c\x8d\x98\xd6\xec\xec\xdf\xd4\xe0\x6d\x9f\xc3\x6a\x3b\x3e\x1f\x60\x4e\x69\x53\x77\xda\x52\x64\x68\xd8\x19\x75\xaa\x67\xb8\xf2\x9a\xba\xb7\xb4\xf2\x80\x7a\x67\xdf\x8a\x3f\xa6\x2c\xb0\x09\x56\x0b\x04\x80\x12\xe3\xdc\xb4\x09\xbf\x76\xdd\xb5\x20\xa6\x02\x6e\x65\x55\x9d\x6a\x67\x75\xb3\x45\x25\x33\x93\x50\x97\x47\xe3\xa2\x7e\x55\x77\xe2\x7d\x90\x6c\x26\xdb\x4a\x3c\xaf\x6b\x97\x75\xc3\xb6\x49\x09\x5b\xd2\x2d\xf2\x6f\xb5\xba\x6b\x92\x9d\x8f\x05\x70\x00\x7d\x28\xde\x5c\xfb\x23\x88\x89\x91\x9e\x91\x80\xfa\xf3\xc3\x03\xaa\xc6\xaf\xb0\x98\x6d\x44\x3f\x60\x4f\x9e\x54\xd3\xdd\x56\x16\xb7\x75\x4c\x00\xca\xa1\x2b\xe8\xcf\x69\x40\x54\xe1\x5b\x44\x1d\x58\x1d\xf0\x59\x33\xdd\xca\x9f\xa6\x92\x1e\x67\x56\x29\x68\xef\xa1\x86\xd1\x6a\xbd\x4a\xdb\x15\xa0\x13\x28\x35\x6c\x24\x09\xff\x43\xef\x0e\x84\xec\x51\xc0\x84\x62\x0d\x0d\x5f\x60\x04\x5f\x97\x9d\xe6\xc6\xfc\x73\x62\xf6\x3f\x9f\x9d\x16\xe9\x7c\x14\x66\xdf\x5c\xf1\xec\xcf\xb0\xb5\x8a\xd6\x83\xca\xe3\xc7\xe7\xa6\xa7\x3d\x69\xbd\xeb\x3f\xd2\xfe\xc8\xf6\x8a\x19\xc0\x0e\x12\xdb\x65\xbd\x5a\x83\xf1\x59\x1c\xc1\x62\x61\x5e\xdc\x03\xc9\x9d\x87\xba\x05\x7a\x98\xc0\x2d\x1c\x1c\xac\xc2\x24\xd0\x7d\xe0\x1e\x59\xf9\x03\xd4\xbe\x12\xd2\x76\x68\xc6\x43\x00\xa1\x27\x85\x9d\x81\x2f\xd8\xcf\x03\x25\x8f\xbe\x86\x29\x4a\x7e\xdd\x8e\x7c\x1d\x42\x77\x86\x59\xa7\x47\x04\xa6\x08\x95\xce\xb9\x63\xa0\x5c\xc4\x4b\x9f\x57\x12\xa3\x7e\x6e\x60\x81\x44\xea\xc2\x48\x18\x15\x45\x44\x71\x97\x66\xc0\xc5\x72\x3e\xcc\x56\xb2\x43\x66\xa0\x1d\x46\xec\x92\x3a\xc1\x9b\x60\x26\x17\x7c\xaf\xe3\x92\xe2\x8c\x07\xb4\xa6\xb8\x83\x08\xff\x10\x96\x68\xe4\x6f\x48\x7e\x5f\xff\xfe\x7b\x73\xc7\xa9\xfb\xdb\x4d\xf0\xb4\x18\xdd\x78\x6f\x8c\x1b\xb9\x17\xf2\xd5\xde\x58\x84\xbe\x72\xd3\xe1\x05\xd9\x13\x28\xb4\x8b\x8d\x45\xee\x67\xbf\xe0\xa1\x38\xe2\x85\x45\xe9\x83\x14\x46\xa3\x47\xa5\x51\xfb\xab\x57\x2c\xd2\xa4\xfa\x9d\x0c\x14\xf6\x0b\xfd\x6d\x77\x3c\xc6\x25\x30\xf7\x54\x65\x15\x88\x9e\xf0\x57\xa9\xa5\xa8\xbb\x7a\x3e\xd7\xc8\x81\x71\x1f\xbd\xc9\x30\x55\xc0\x72\x36\x03\xd0\x1e\xd7\xa9\xd9\x46\xb3\xe8\x1b\x92\x08\x27\x9d\x96\x56\x99\xe7\x4a\x51\x3b\x94\x6d\x80\x43\x0b\xcc\x2e\x1c\xec\x4b\xf4\x5a\xd8\x9c\x4d\xca\x61\x7f\x1f\xb2\x79\xae\xeb\x16\xbf\xef\x2d\xbb\xa4\xe8\x08\x5a\xea\xda\x75\xed\xeb\x15\x75\xdc\x9f\x22\xf1\x9a\xbb\xdd\x5b\xc4\x46\xbc\x3d\x4d\x45\x7c\x4c\x62\x46\xb7\x90\x0c\xfd\x68\x4e\xfe\xf8\xd8\xdf\xda\x9b\xe9\x50\x65\x46\x69\x30\x5c\xf2\xf2\xd2\xdb\xc2\x1b\x78\xcc\xc1\x01\x48\x4b\x1c\x19\xa5\xd2\x5a\x9d\x66\xe7\xf9\x74\x4a\x8e\x7f\xf8\x03\x27\x70\x63\x03\x9b\xa9\x1b\x21\x43\xf5\xbb\x50\xec\x34\xa4\x69\x2c\x43\x34\xcd\x03\x87\x22\x98\x86\xef\x35\x84\x81\xdc\x31\x2f\xda\x9f\xd7\x8f\x0e\xdf\x75\x22\xee\xb2\x76\x95\x2c\xed\xd1\x2c\x20\x22\x21\xb9\x5e\x07\x0b\xf5\x14\xb7\x75\xc1\xce\x91\xa0\x2b\xc6\x08\x21\x6a\xa7\x2c\x26\x19\x25\x77\xce\xa7\xa5\xa8\xaa\xb1\x1e\xa4\x9d\x1e\x8d\x30\xf4\x27\xcc\xf2\x65\xdd\xec\xc1\x7c\x61\x56\xa4\x94\xd6\x5c\xa6\x69\xb5\x96\x1b\x6b\x56\x64\xf5\x27\x06\xe6\xd0\xdf\xc1\x0d\xd7\x01\x33\x33\x7e\x53\xc4\xe5\x15\x3b\x7e\xb3\xfb\xba\x13\xe2\x73\x4c\xd9\x05\x7d\x21\x8a\x07\xfa\x01\x71\x7e\xe0\x1e\x1e\x01\xbe\xbb\xf8\xa0\x00\x8c\x0a\x8f\xcd\xfc\x48\xbd\x71\x6b\xbc\x23\xc1\x00\xc4\x35\x09\xff\x43\x1e\xc8\x34\x7e\x99\xfd\x31\x4d\x5e\x61\x56\xe8\x76\xfc\x42\xce\x78\xe4\xe8\xe4\x9e\x33\xe2\xd6\xe4\x5f\x84\xbf\xf5\x02\xff\x60\xc8\xed\x83\x01\x0f\x35\x64\xaa\xa2\x21\x34\x81\x66\x90\x78\x9c\xc9\x73\x55\xda\x47\x75\x3b\x4c\x47\xa4\x86\x5b\xf7\x18\x3e\xc7\x89\xb9\x72\xea\xc6\x88\x52\x39\x37\xf5\x55\x68\x1c\xe7\xf8\x9b\x52\xb8\x8b\x0d\xaa\x25\xf1\xcc\xee\xc2\xbf\x1a\x81\x83\x4e\xab\x91\xb8\x55\x01\xab\x48\xb0\xf4\xf5\x65\x64\x8d\x10\x51\x97\x89\x43\x9e\x05\xf7\x35\x68\xa1\x1b\x5c\x94\xe6\x77\xeb\x47\xdf\xec\xc3\xe3\xd1\x9e\xae\x86\x09\x95\xa1\x7f\x7e\x05\x40\xc5\x7f\x35\xdc\x28\x97\xa7\xc4\x57\x77\xe7\x97\x7d\x7d\x52\xfb\xb6\xc4\x82\xc4\x49\x53\x00\x50\x66\x34\xd5\x87\x3c\xba\x36\xe3\x3a\x02\xae\x61\xd8\x99\x76\x29\x9d\x13\x84\x8b\xa1\xcd\x36\xa5\x28\x4e\x60\x24\x46\x19\xab\x4a\x57\xb1\xe2\x11\x7e\xa5\xc6\x79\x91\x1e\x5e\x59\x6d\xef\x41\x76\x7e\x40\x58\xea\x8e\x96\x5f\xc9\x78\x1e\xe3\xfa\xb1\xf0\xaa\xb7\xdf\xd7\x44\xc4\x90\x0c\x14\x8f\x5f\x93\xb3\xc0\x08\xf1\xd7\x81\x43\x95\x1f\xe8\xe0\x25\xff\xb8\x2c\x3e\x99\x73\x72\x7a\x13\xfa\x64\xfc\x29\xbb\xa1\xe5\xb9\xa2\xb8\xcd\x9f\x4f\x92\x4f\x99\xd9\x97\xb9\x29\x9f\x60\x6a\xe5\x05\x0a\x4a\x75\x1a\x6f\x16\xc1\x4e\x38\x2c\x9a\xfe\x35\xcf\x28\x6d\xf3\x42\xcc\xb6\xb6\xc9\x3e\x1c\xdb\xb7\x27\xcf\xd7\x07\x0f\x57\xec\x63\x31\xfd\xf9\xe4\x4f\x76\x24\xbe\x28\x65\x4f\xa4\x0e\xd2\x31\x57\xd5\xe1\xd4\xd6\xf8\xe8\x7b\x66\x35\xe0\x05\xaa\x93\xe6\xf0\x02\x65\x1b\xf2\xc2\x1f\x08\x95\xfe\xc4\x8b\x66\x4e\x14\xa4\xb2\x96\x21\x85\xde\x5d\x23\x4f\xa8\x04\x30\x24\x84\x41\xe3\x7f\x33\x6c\x10\x99\x9f\x17\x79\xc6\xc0\x3c\xe0\x0c\x89\x4a\xca\x12\x4a\xaf\x11\x2c\xda\x14\xd4\xee\x90\xeb\x21\xa1\xd3\x53\x4c\x5f\x41\xc1\x6e\x2f\x66\x89\x59\xdd\x11\x24\x0f\x4a\x59\xe6\xf5\xb0\x92\xd1\x53\xd8\xb9\x59\xd8\x74\x92\x6a\x58\x2b\xb7\x0d\x47\xe6\x59\xb5\x95\x45\x1b\x38\x82\x62\x68\x04\xd3\x6c\xf4\xf4\x46\xaa\xff\x64\x46\x3b\xce\xe6\x1f\xd5\x9b\xf7\x2e\xc3\xd8\xfa\x12\x2e\x00\x08\x71\xc2\xae\x93\x0b\x2a\x28\x71\xc6\xd6\xf7\xb9\x2f\x18\x70\xf0\x5f\x17\x5e\x20\x8d\x09\xf8\x1c\x07\xed\xa3\x6f\x59\x36\x07\x9c\x1a\xbd\xda\x28\x88\x14\x43\x53\x55\x9a\x67\xbf\x13\xd7\x90\xdf\x80\x44\x66\x96\x05\xdb\xbc\xaa\xc3\x82\x04\xe4\x57\xf0\x03\x3c\xd7\x57\x29\xc2\xa2\x49\x63\xbc\x10\x50\xc3\xb0\x2c\x57\x46\xde\xdf\xe0\x4f\x6a\x11\x86\x29\xd4\x04\xd3\x6e\xc2\xba\x6b\xd3\xe6\x29\x3e\x39\x2a\xd5\x3b\x01\xfb\x50\x60\x4d\x82\x8f\x3b\x05\x08\x96\xe0\xfc\x22\xad\xc1\x38\xb2\x61\x31\x17\x67\x49\x6a\xad\x38\xfd\x0f\xf0\x6b\x62\x9f\x1b\xc2\xeb\x01\x32\x01\x03\x95\x59\xfd\x74\x14\x4d\x93\x88\xcf\x54\x06\xc2\x1d\x2e\xe1\x3e\xad\xe0\x13\x6b\x8c\xc9\xce\xb2\x94\x3e\x1d\x61\xa9\xf2\x63\xe0\x59\x7c\xb9\xd8\x98\xb8\xcf\x36\x3c\xce\xfc\xfc\xea\xf0\xed\xf1\xfe\xc7\xa3\xfd\x37\x87\x47\x27\x1f\x9f\x1d\x1c\xef\x3e\x7d\xb9\xff\x8c\x4e\x64\x23\xf1\xc0\x2d\x3e\x5f\x66\x22\x86\x1e\x4e\xc9\x15\x0b\x33\x3f\x6c\xb2\x63\x29\x06\x6a\x8d\x64\x9b\x7c\xa2\x4e\x40\xab\xe1\x0e\xd0\x93\xc4\x1a\xa9\xbb\x90\x61\x10\x54\xc4\xff\xae\x92\xa9\x37\x79\x14\xf7\x92\xcd\xa6\x17\xb9\x95\x13\x57\x4f\x72\x58\xb9\x61\x59\x00\x32\x3b\x32\x19\xd8\x9f\x9b\x3b\x5c\xdd\x27\x23\xc6\xdd\x53\xb8\x5d\xa6\xdf\x9b\x19\x31\x65\xce\xae\x02\xfc\x5b\x65\x40\x7f\xac\x3c\x41\xdc\x9c\x3d\xcd\xaf\xa4\x81\x30\x6b\xe0\x5c\x79\xbe\xdf\xda\x53\x3d\xb9\x53\x21\xc1\x2a\xd7\xec\x82\x9d\xad\xaf\xfd\x74\xc4\xc0\x82\x60\x9f\x35\xaf\x14\x9a\x4d\xbd\x8b\x57\x22\xdc\xa9\xa5\x0b\x48\x81\x68\x4e\x38\xb3\x27\x10\x7f\x49\x27\xd9\x39\x35\x85\xbe\xee\xf8\x98\x5a\x1a\x93\x86\xdc\x58\xc8\xda\x5d\xcc\x04\xfa\x10\xac\xda\x65\xb4\x25\x64\xc3\x11\x36\xe1\x2c\x83\x47\xc6\x9e\x66\x38\xb0\x90\x2c\x70\x4c\x3c\x8c\xe3\xf2\x2c\x13\xee\x13\xf4\x7a\x32\x80\xcd\x5c\xe5\xc7\x6d\x8f\x69\x84\xf2\x5a\x34\xa1\x01\xed\x1d\x9f\xd4\xe4\xca\x8f\x51\x04\xcc\x05\x07\x1e\x11\xb7\x08\x3f\x68\x1d\x34\xa0\x78\xed\x5a\x2a\xd7\xd6\xe5\x0c\x62\x86\xcd\xf3\x0f\x1a\xf2\x7a\x7a\x13\x8a\x33\x2c\x10\x11\x12\x95\x64\x57\x36\x33\x06\x87\x29\x0f\x17\x35\xc1\xaf\xe1\x25\x69\xae\x23\xd8\x4a\xd7\x8a\xe9\x6e\xdd\x0e\x85\x49\xce\xdd\x56\xf4\xe4\xb8\xd0\x6f\xa2\x80\x60\xf3\x6d\xe2\x9f\xea\x2d\x2c\x97\xa4\xbe\x15\x14\xdb\xbb\x4f\x70\xad\x5d\x6b\xf3\x0c\x02\xa4\xe8\x6a\xb5\x21\x7a\xf8\xa4\x9c\xc1\x13\x7d\x35\x35\xcf\xf2\x45\x6e\xd1\x6d\x68\xb4\x16\x2f\xa7\xc5\xb8\xd0\x8b\xce\x1b\x58\x9d\xc2\xd5\xaa\xf7\x4e\x8a\xfd\xe9\xc8\x19\x71\x6b\x67\x83\x4d\x2b\x5b\x6f\xdc\x0a\xec\xd1\x45\xfd\x56\x07\x54\x33\x3a\x1d\x23\xc4\x51\x48\x89\x72\x3e\xb2\x6b\x23\x85\x8e\xdc\xe8\x1b\x67\x66\xc7\x78\x5b\xd5\x2b\x8d\x3f\x36\xbe\xf0\xee\x36\x02\xee\xf0\xc2\x9e\x62\xfc\x8a\x66\x9e\xa7\x4b\xc3\x0c\x4f\x3d\xb7\x26\xb4\xc9\x58\xa8\xd4\x58\xbb\xcb\x59\xd8\xea\xc0\xc6\xb9\xc2\xe0\x0f\xa7\x34\x7c\x7d\xab\x84\xa0\x59\xc1\xde\x6a\x15\xa5\x5d\xd1\x5f\xb9\x1c\x95\x71\x83\xa2\xa0\x03\x27\x3a\x32\xa1\x9e\x1e\xac\x7a\x36\x9f\x12\xd3\x47\x77\x4b\x36\x3d\x4f\xcf\xf5\x08\xcd\xb1\x78\x66\x4e\x04\xfe\xac\x5e\xb8\x75\x61\x15\x49\x94\x05\x74\x5c\x3a\x20\xf6\xad\xd9\x58\x6b\xd5\x53\xf4\x80\x44\x8a\xeb\xe0\xa7\x0e\x99\x40\xd4\x72\xf0\x59\xde\xbc\xeb\xee\xd8\x08\x9d\xdf\xdd\xac\x78\xd7\xb4\x59\x82\x95\xd7\x29\xaf\x93\x85\x39\x0d\x96\x08\x35\x4a\xe8\x51\x08\x4d\xa9\x57\xd6\xba\x7c\x51\x05\x18\xaf\x6e\x0f\x5f\x48\x0b\xea\xb5\xd1\x76\xef\x82\xab\xb0\xdd\x92\x7a\xac\xe0\x83\x5e\xe0\x69\xbf\xaa\x0d\x31\xeb\x3b\xb6\x2d\xd2\x88\x7a\x04\xa3\x64\x1b\xac\xe6\xe1\x85\xf0\x10\xca\x9c\x32\x9a\xa7\xe7\xeb\x92\x05\x21\x75\x0f\x50\xb2\xfb\xfc\x64\xff\x48\x5d\xd0\xf8\xc6\xe8\xe6\x0c\x7f\x46\x67\x19\xe3\x37\x08\x87\xa9\x28\x92\x31\xe7\x24\xae\x25\xf0\x60\xd9\x6f\x7b\x75\x37\xf9\xe6\x7c\xd6\xc7\x99\x38\x42\x96\x7e\x95\x5b\x4e\xc3\xed\x74\xeb\xfb\x06\x43\x19\x51\x54\x20\x89\xa8\x98\x26\xdc\x1e\x2c\x0f\x2f\x0c\xae\x2b\xe0\x1c\x19\x81\x6a\x0e\xde\x35\xde\x73\x0e\x4a\xab\xa4\xfa\x9c\x43\x7c\x3b\x20\xc0\x8e\x0a\x6a\xd9\xb2\x89\x4e\x35\x06\x98\xe9\x94\xb3\xbe\xc0\xbd\xd4\xd2\x1b\x4a\x91\xf9\x64\x92\x8d\x72\xd3\x13\x38\x43\x72\xa2\x3b\x74\x8b\x2f\x43\x36\xa0\xcd\x63\xeb\xb9\x82\x92\x23\x4c\x29\x3e\x97\xc0\xa4\xce\x89\xc3\x05\xe8\x2e\xbc\xb7\x6e\x30\xc6\x0e\x4f\xe5\x14\xd4\x0c\xa7\xe0\x3c\xa0\x79\x67\xad\x90\x20\x09\xd3\xe1\xe8\x49\x40\x45\x6a\x38\xef\xf9\xc4\xf0\x2d\xcf\x0e\x5f\x49\xf8\x27\xc2\x04\x52\x05\x5a\xc0\xd1\x08\x39\xca\x14\x93\xce\x77\x14\x27\xdb\x41\x0e\xbe\xe3\xf3\xa6\x1d\xa5\xde\x68\xa7\xa1\x08\x15\x14\x89\x87\xf7\x0b\x2c\xd6\x15\xe9\x5d\x86\xcb\x92\x71\x58\x56\xb7\x8c\xf0\x8f\x7b\x58\xd8\xd3\x80\x70\xe8\x5a\x1d\x52\x69\x24\x4a\x8e\x0d\x90\x9c\x91\x94\xaf\x6a\x1d\xa3\xe7\xb4\x93\x5c\x10\x3d\x6c\x90\x71\x53\x1a\xca\x5a\x8c\xc5\xb5\xf8\x74\x81\x98\x54\xba\x15\x15\xce\xbc\x72\xee\x54\x2d\x12\xd7\xc2\x97\x62\x6d\x24\x4c\xc3\x68\x40\xb2\x01\x9d\x04\x70\x22\x23\x65\x56\xb3\x23\x5c\x39\x2a\x64\x6e\x62\xda\x28\x74\x20\x4b\x17\xa9\xf9\x44\xfe\x0c\xe2\xcf\xde\xdd\xfc\x65\xba\x39\x39\xef\x27\x9d\x5f\xd8\xb7\x8e\x8b\x45\x55\x7f\xf0\xcd\xe9\x89\x3d\x79\xf5\xd4\x08\xd8\x9f\x00\xea\x0e\xc7\x40\xbb\xc2\x4d\x75\x7e\xb9\x1e\x9c\xbe\xdf\xde\xda\xfa\x6f\xd0\xe0\xe2\x8f\xf7\xec\x8f\x83\xff\xee\x78\x0a\x48\x10\x51\x39\xfb\x2c\xf7\x56\xbf\x77\x14\x1f\x33\x67\x6d\x22\x70\x4c\xca\x7f\xa7\xfd\xaa\x81\xee\xbe\x4e\x85\x47\x1c\x81\xe9\x88\x6f\xea\x77\x08\xfb\x09\x35\xe4\x02\xad\xbb\xcb\x43\x3f\x96\x3a\x86\xce\x83\x71\xdd\x8a\x80\x0f\x37\xd1\x2b\x81\xec\x04\xce\x3f\xf8\x40\xda\x88\x1f\xbe\xdf\x40\xfc\x1f\xe5\x10\xd6\x67\xae\x52\x51\x89\xc2\xa6\xd2\x23\x8a\x58\x51\x24\x94\xa3\xfc\xcd\x57\x11\x45\x03\x85\x20\xdf\xf0\x06\x9b\x3a\x9f\x72\x32\x3b\x62\x2b\x90\x2f\x75\x7a\x5e\x52\xfe\x02\x07\x64\x94\x50\xee\x66\x0f\xae\xa8\x2f\xd7\x3d\xbc\x2c\xc3\x14\xe0\x7a\x93\xec\x3a\x1b\x2e\x81\xec\xbd\x70\x36\xd1\xa0\xe0\x33\x24\xd8\x3a\x66\xeb\xce\xcd\x25\x3b\x31\xc7\x1b\x42\xe1\xa0\x13\xba\xb1\x56\x6e\xf4\x11\xae\x56\x4d\xc0\x2f\x09\xf3\x7b\x3a\x21\x3b\x25\x1e\xa8\x68\x93\xe0\x51\x45\x81\x87\xec\x42\x2b\x14\x60\x01\xa7\xd4\xa0\x90\x32\x2c\xfa\x96\x98\x52\xe7\xac\x9f\x4f\x04\x2c\xbe\x9c\xa4\xf3\xc5\x73\x18\xd0\xb3\x1c\x22\x0c\x1a\x86\x25\xb0\x4e\xcd\x96\xb2\x96\x8a\x39\x1a\xd4\x9a\xc0\xdb\xbb\x35\xfa\xe1\x49\xb2\x05\x5f\xed\x48\xe1\x07\x5f\xa9\x9d\x5e\x16\xf9\x88\x05\x00\x73\xfd\x2d\xe9\x42\xe6\x90\x05\x7c\x5f\x39\x88\x11\xcc\xb5\xe0\x9c\xa7\x98\x04\x21\x36\x69\xce\xcc\x0e\xc8\x1d\xb8\xc2\x91\x3b\xe5\x16\x0f\x04\x60\x9d\x96\x73\xb1\xc0\xe4\x53\x73\xd9\x9a\x27\x77\x5c\xa4\xa3\x3e\xeb\xc0\x48\xbb\x2c\xcd\x8d\x0c\x41\x8a\x1e\x38\x5d\x88\x2e\x9a\x8e\x0e\x90\x24\x2a\xba\x79\x74\x66\xe6\x10\x23\x09\x16\x25\x0a\x3e\xf0\xef\x17\xf8\x38\x5c\x8e\x53\xc2\x93\x77\xfa\x2f\x1b\x9c\x0e\x44\xd7\x47\x8e\x15\xc6\x07\xbc\x4d\x7e\x49\xe6\xa9\x2d\xe0\x29\x2e\x49\x4b\xc7\xb1\xb0\x70\x93\x6d\x19\x12\x18\x2f\xb3\xb2\x56\x1b\x9d\x97\xaf\xb3\x2b\xb6\xa7\x79\x9b\x72\xa7\x2e\x9d\xc4\xdf\xfe\x16\x23\x06\xbb\x77\x91\x7a\xd6\xb2\xb6\x26\xdb\x29\x8c\x1c\xdc\x76\x92\x5e\x10\xc3\x83\x47\xf9\x08\x98\x35\x3a\x85\x7d\x52\xe0\x9b\x69\x9c\x32\x88\x16\x44\x50\xdc\x2c\x2e\x48\x3f\xb4\x26\x9c\x37\x07\x94\xca\x6b\x8f\xf7\x03\x74\xfc\x51\x4f\xa8\x6f\x87\xa8\x40\xc6\x82\x90\xc2\x5b\xc4\x55\x99\x69\x0e\x9c\xab\x90\x5d\x45\xc5\x43\x28\x5b\x65\x08\x7b\x16\x72\x23\xb7\x7c\xe9\x8f\xb3\xf9\x65\x3e\xf4\x72\x5e\x10\x68\x97\x42\x02\x6b\x7e\xa6\x14\x9c\x4f\x3c\x9e\xf6\x4e\x4c\x85\xec\xa1\xf9\xb4\xc4\xe6\xa9\xd3\x4e\xdf\x06\xed\xc0\x91\x5c\x8d\xb2\xd2\xfa\xee\xa2\xfb\xb2\x17\xf5\xb5\x12\x3c\xc9\x96\x8c\x4e\xc2\x77\x77\x26\xdd\xcf\xcd\xa1\xb7\x80\xab\x91\x40\x2a\x77\xa5\xea\x60\xef\x66\x38\xce\x3e\xbe\xdf\xfa\x50\x93\xd2\xa0\x15\xa8\xd4\x3f\x7e\xfc\x83\x0f\x91\x08\xb9\xcc\xcf\xea\xdd\x08\x79\x56\x2d\xa4\x50\xcf\x2e\x41\x40\x41\x85\xad\xb5\x7f\x84\x08\x68\xd0\xcc\x6f\x83\x81\x16\x1f\xfe\xed\x61\xd0\x6c\x48\x41\x0b\x24\xb4\x20\xf5\x44\x58\x95\xcb\x47\xd1\xe5\x44\x7d\x71\x91\x65\x63\xf2\xec\x99\x50\x78\x7e\x8e\xa6\x5b\x7c\x96\x48\x1b\x4e\x58\xa8\x10\xc6\x78\x96\x96\x54\x79\x96\x9e\x13\xf8\x37\x36\xe2\x44\x78\x6a\xcd\x97\x54\xfd\xb8\xb8\x60\x3d\x25\x14\x4f\xf5\xdd\x72\x81\xde\x41\x57\xa0\xeb\x12\x54\x81\xb9\x17\xec\x66\xdb\x5b\xb5\x5a\xd5\x76\x74\x65\xdf\xe3\x06\xa4\x3d\x80\x0a\x36\x2f\xea\xa9\x97\xfe\xc1\xbc\xe0\x73\xd2\x4e\x00\xe8\x92\x4e\xd9\xb1\x4a\xa6\xad\x91\x20\x6b\xa4\xbc\x78\x26\x01\xc3\x21\x00\x12\xad\x8b\xb2\x50\x06\xa2\x29\xf5\x60\x95\xf0\xee\x1d\x89\xb7\xc5\x40\x5e\x80\x35\x0a\x53\x07\x7f\xd5\xc3\xb7\x47\x7b\xfb\xc9\xf3\x83\x97\xfb\x3b\xa4\x29\xde\xfc\x8f\x72\x13\xff\xf2\x51\xa6\xfa\xd1\x88\x51\xff\x51\x42\x69\x90\x53\x08\x0a\xbe\x3b\xec\x25\x46\xd8\xda\x46\x55\xc5\x9e\x61\xb0\x27\xf9\x72\x92\x1c\x1e\x27\xbb\xcb\xc5\x05\xe6\xb1\xd9\x05\x84\x7f\x28\x4b\x78\xe1\xf3\x4b\x10\x2b\x00\x71\xa8\xb4\x48\x3d\x86\x4f\x43\x27\xfa\x21\xbb\xa8\x9d\xc3\x6b\x39\xa5\x75\x4e\x93\xa7\xc7\xcf\xd6\x09\x73\x66\x6c\xde\xb9\xa9\xd8\xea\x89\xc1\x87\x96\xce\x10\x9d\x98\x59\xfa\x97\x07\x7b\xfb\xaf\x8f\xf7\x93\xb3\x1c\xee\x81\xb5\x0e\x28\x29\xc0\xb3\x64\x08\x90\x25\x6b\xc0\xf3\xce\x17\xa3\x6c\xd6\xed\xc0\x5f\x49\xfc\x7c\x7b\xf2\xfc\x11\xfa\xb8\x5b\x3f\x9f\xd9\x72\xb1\x79\xb8\x5c\x20\x36\x09\x5a\x0d\x41\x9f\x8a\xea\x81\xd3\x1b\x87\x29\x8d\xb2\xe1\x64\xb2\x9c\xc2\xda\xaa\xdc\x3e\x8b\x20\x69\xd1\x9e\x54\x18\xe7\x9f\xb2\xe4\x2f\xd3\xb4\x2c\x2f\xfe\x82\xbc\xd9\x5f\x0c\x71\xc2\xdf\x8d\xf8\x94\xe5\xc8\xaf\xa1\xc3\x40\x0a\x7c\xac\xac\xcd\x70\x0c\x81\xa5\x94\x71\x68\xe6\x10\xc7\x73\xb0\xfa\x9e\x5f\xb2\xeb\x81\x9c\x65\x44\xb8\x16\x6f\x08\x01\x0e\x5f\x50\x26\x13\x43\xbb\x8e\xc3\xd5\x60\xa2\x38\x72\x50\x41\x65\xd7\x10\x12\x40\xbc\xee\x84\xaa\x25\xe0\x7f\x34\x0f\x41\x68\xec\x28\xb5\xa2\x8a\x40\x97\x65\x79\xc8\x73\x52\x69\xbf\x20\xad\x9d\xf6\x01\xea\x51\x1e\x09\x27\x96\x43\x80\xaf\x19\x07\xa5\x7a\xf0\x67\x6f\xc1\x27\x20\x55\x06\xaf\x95\xf5\x86\x2a\x6d\x43\x10\xb6\x0b\x7b\x26\x10\x4f\x04\x37\x03\xcd\x8d\x32\x48\x37\x90\x6a\x84\xe6\x83\xb2\x80\x84\x14\x3a\x83\x85\x65\xff\xed\xca\x98\x23\x0c\x42\x11\x09\xb0\xce\x8f\xf3\x34\x9b\x66\x67\xf9\xa2\xdc\x81\x86\xd6\x93\x37\x52\x0a\xe0\x36\x80\x5b\xcd\x4b\xca\x28\x95\x32\x0f\xce\xe8\xb6\xfe\x0a\x04\xf3\xa7\x10\x61\xeb\x9c\x43\xf8\xb3\xe0\x71\x86\x8e\xa3\xcb\x53\x3b\xca\x2e\x24\xaa\xc2\xfb\x19\x72\x8b\xd0\x32\xce\x30\x39\x27\xaf\x1f\xfa\x33\x99\x61\xc1\xa6\xe4\x34\x4b\xb8\xba\x53\x58\x2a\x80\xda\x49\xcb\x9c\x96\x12\xf1\x68\x59\x2b\x07\x6b\x6c\xb7\x17\x47\x46\x71\x07\x76\x64\xb8\x13\x20\x49\x31\xb1\xd0\x8b\xa1\xd7\x8f\xbb\x3d\xa0\x5c\xef\xcf\x97\x0b\x60\xd2\x5d\x7a\x90\xf4\x26\x99\x2f\xd1\x79\x01\x2e\xd6\xab\x62\xfe\x89\xe7\x39\x67\xa1\xed\x8a\x14\xa6\xa0\xdb\x05\xfd\xa6\x79\xda\xa8\x67\xd8\xce\x74\x8c\x49\x0f\xd3\xa4\x42\x82\x89\x24\xb4\x34\xc4\x7a\xf0\x66\xcf\xed\x40\xf8\x0a\xf9\x24\xfc\x39\x76\x63\x1f\x1c\xea\x2b\x59\xa8\x40\x5d\xcd\xf6\x2a\x04\x4d\x16\xff\x5d\x24\x19\x98\xb4\x69\x80\x7d\x81\x90\x52\x65\xd7\xcd\xef\x1b\xb8\x45\x56\x30\x11\x97\xee\x83\x43\x17\x96\xf6\xff\xf0\x04\xfe\x1f\x9e\xc0\xdf\x19\x4f\x00\xe8\x72\x25\xa4\x80\x44\xc0\x55\x60\x05\xfc\x23\xe1\x79\xdb\x46\x2b\x79\x24\x7e\x88\x28\x53\x53\x73\xe9\x82\xdb\x7a\x6e\x9d\x05\xd1\xcb\x59\x3d\x4d\xa0\x17\xed\x9b\x0b\x0e\x1e\xe2\x91\xf3\x4a\xe7\x6c\x8e\xd0\xd2\x72\x6e\x9f\x5a\xb4\xbe\x2e\xcd\x2b\x78\x03\xde\x49\xe3\xb1\x4a\x9c\x97\x31\x02\xfc\xa6\x84\xbd\x6d\xb2\x23\x1f\x5c\x8e\x2c\xdb\x6e\xc8\xf9\x41\x0d\x30\x53\x39\xaa\x6c\xf8\x42\x92\xb4\x8f\x9b\xa4\x20\xa5\x67\x01\x26\x50\x47\x7b\x66\x6c\xd8\xe0\xdb\xa3\x97\x50\x17\x14\x47\x32\x57\x5b\xcf\x56\x3a\xc4\xab\x83\x48\x8c\x47\x64\x96\x89\x0c\x38\xbc\x4e\x32\xd0\x04\x74\xb2\x49\x3e\x99\x51\x80\x61\x8d\x65\xc1\xdb\x5e\x62\x5e\x9f\x63\x33\x6a\x7b\xcd\x08\xfb\xba\x47\x2f\x49\x36\xa4\xf0\xa1\x36\xb1\x5e\xd7\xdf\xf1\x7e\x52\xa9\xec\xb3\xd2\xf8\xb4\xd0\x5b\x35\x17\x80\x1b\xd8\x12\x60\xce\xac\x5b\x6c\xc8\x2e\xf1\x6a\x70\x31\x0c\x6a\xb0\xcb\x09\x4b\x39\xc5\x75\x38\xab\x6b\x16\x5e\x09\xe0\x44\xcc\x5c\x5b\x90\xbc\x11\x87\xf9\xc3\x1b\xae\xaf\x96\x46\x0d\x21\x4e\xf0\xd9\x82\x6b\x79\x45\xfd\x35\xc0\x55\xa7\x0c\x3d\xa1\xdb\xb8\x79\x2d\xec\x2b\x86\x2c\x13\xbc\xc7\xe0\xb2\x4f\x9c\x14\x7b\x27\x9d\x58\x8d\xe5\x5d\x79\x5c\xcc\xd5\x50\x0c\x73\x67\x28\x25\xdb\x62\x85\x27\xcb\x31\x77\x24\xf2\xad\xe0\x15\x00\x17\x0a\x68\xe8\x8d\x40\x54\xb9\x40\xe1\xe1\x3a\x3b\xa3\x27\xd6\x31\x1b\x94\x27\x08\xb9\x25\x7e\xc0\x98\xc7\x10\xf5\xba\xb4\x2d\x4f\x9d\x34\xef\x6c\xb2\xb6\x2d\xe0\x04\x66\xa0\x25\x8a\x0b\x4b\xde\xb6\x00\x67\x13\xd7\xa6\xe7\x90\x9f\x32\xba\x94\x01\x6d\x92\x39\xa9\xb0\xa6\xa6\xbd\x74\x06\xfc\xc8\xe8\x63\x68\x83\xb2\x1f\x48\x7f\x57\x6c\xf8\x0a\x7b\xb6\xb1\xd8\x9f\xb8\x59\xa5\x47\x27\x45\x1e\xff\x5b\x1a\xf1\xdf\xf7\x80\x6e\xf2\xe2\x71\x95\x98\x70\x66\xf0\xc5\x9d\x3e\xf8\x97\x67\xb1\x11\x7b\xba\x23\x8a\x4e\xe9\x02\xe8\x2c\xf3\xd1\x62\x81\x8b\x59\x8d\xf0\x19\x0c\x28\x64\x56\x7c\xda\x26\xed\x35\x6e\x36\x9a\xdf\xe0\x92\x2d\x45\x45\x9b\x4d\x17\x15\xb0\x55\x26\x2b\x11\x8c\x9a\x4c\xe5\x8a\xd5\xf7\x72\x30\x1a\xca\x9d\xb1\xbb\x29\xf4\xd9\x22\xa4\x02\x87\x86\xfa\x9b\x9a\xcc\x98\xc1\x95\x20\x1c\x79\x5d\xbc\x04\x38\x8c\xe8\xa1\x02\x53\x07\xa9\xbb\x0b\xf0\x4e\x29\xce\xbb\x9d\xb7\x53\x62\xe3\x35\x7b\xbf\x83\xb8\xbd\xdc\x4c\xed\x2a\xa6\xee\x44\x36\x06\x90\x7c\xe9\xca\x39\xa1\x49\x73\x8b\xae\x2b\x5c\x2a\xd1\xa6\x91\x74\x3c\xaa\x62\xe7\x76\x60\x5a\xeb\xf8\xd9\xfc\xda\x21\xe3\x99\x5c\xc4\xed\x62\x5c\x4c\x97\x66\x71\xfe\x73\x29\x35\x9a\xf7\xa4\x55\x18\x4b\x8b\x6d\x29\x4e\x51\x01\x31\x1f\x79\x11\x3a\xb4\x35\xff\x76\x7c\xf8\x7a\x83\xda\xcb\xcf\x6e\x82\x68\x94\xe6\xc1\xc9\xef\x11\x3b\x20\x5a\x49\xfa\x89\x58\xbd\xe4\x1a\x33\xe7\x54\x41\x4e\x72\xbc\x9c\xf9\x51\x54\x3a\xe6\xaf\xc1\x3d\xa4\x32\x73\xc3\x47\x75\xff\xe8\x4c\xe0\xd4\x2e\x14\xf0\xce\xac\x07\xbb\x13\x0c\x37\x18\x62\x2d\x69\x5a\xc2\x44\xc6\x27\x17\x77\x8e\x5f\x4d\x92\xc4\x49\xc5\xa9\xe6\x6f\x36\x15\xb7\x62\x08\xcd\x68\x37\x5a\x15\xa5\x19\xb5\xa1\x2e\x7f\x45\x56\xec\x5f\x95\xce\xd4\x8a\xbd\x43\x8d\x4b\x8a\xd1\x59\x8f\xec\x09\x3a\xbd\x59\x64\x01\xce\x46\x0d\xd7\x13\x3b\x2e\x7e\x5b\xae\x99\x99\xf9\x4b\x8b\xe9\xa1\x12\x08\x74\x5c\x2b\xe3\xbf\xbc\xbb\x9f\x4d\x77\x62\xc3\x02\xb7\xf6\xce\x2e\x25\xa5\xb3\x9d\x8b\x63\x3d\x33\x2c\xee\x01\x52\xbe\x17\xaa\x51\xc9\x5b\xd8\x8d\x5d\x83\xb7\x5e\x39\xd6\xc7\xb0\x52\x6e\x3e\xae\x24\xd9\xfa\x8d\x96\x72\x3c\xfd\x67\x5c\x4c\x74\x7d\x99\xff\x32\xed\xd4\xaf\xea\xe0\x61\xf2\x6f\xe9\x65\x7a\x3c\x9c\xe7\xb3\xc5\x97\x93\xe3\xad\x57\x8d\x66\xf7\xa4\x15\x91\x9a\x31\xd6\x2c\x2c\xce\xdf\xd2\x72\xd7\x57\xdf\xc6\x83\x07\xdf\x60\xc7\xed\x27\xef\x51\x94\xcd\xa9\xf9\x9b\x2d\xc9\x78\xda\x66\x51\x90\xdc\xda\x2c\x0b\xd1\x65\xe3\xc2\xac\x54\xf4\x5f\x2f\x3e\xaa\xa4\xf9\xff\x5a\xca\x7e\x4a\xac\xaf\x15\xfd\x7b\x86\x3b\x58\xcc\x97\x68\xc2\x07\x69\xd4\x0b\x32\xe7\xd3\xa7\x19\xa5\xd2\xfe\x68\x44\x35\x80\x6f\x45\x0c\x24\xd2\xfd\x80\xaa\xc5\x2d\x9d\x91\x7b\x86\x17\x10\x47\xe9\x70\xe6\x36\xa1\x11\x87\x4c\x47\x79\xfe\xfb\xc9\x69\x31\x1e\x81\xf9\x30\x07\xdd\x5b\xbe\x48\xcd\xb4\xfb\x64\xc0\x37\xd2\xf5\x74\x94\xcd\x29\xad\x2b\x6a\x64\x4d\xeb\x9f\x32\x56\x77\xda\x61\x79\x63\x16\x19\xb0\x0c\x05\xb4\xa1\x4c\xd5\x0c\x19\x1c\x46\xd9\x53\x0b\x3c\xc6\x45\x87\xc0\x9a\x5e\xcd\xaf\xbb\x09\x61\xd4\x0d\x1c\x97\x0c\xc2\xb8\xa6\x2e\x81\xaf\xdf\xd8\x19\xb9\x65\x81\xa8\x67\x1e\xf8\xd3\x7c\x0c\xb6\xe9\x0a\x14\xb9\x22\x31\x39\x5b\x43\xb7\x15\xfa\xac\x81\xa2\xee\x19\xfb\xe2\x7c\x76\x5e\x39\x27\x68\x9d\xc4\xb6\xec\x6f\x60\x7b\x85\x68\x1a\x0c\x7e\x07\xa1\xdb\x6a\xae\x13\x14\x18\xbd\x81\x06\x32\xa8\xc6\x16\xd0\x07\x4d\x1a\x57\x47\xcd\xfa\x40\x9b\x72\xf2\xf7\xc7\x56\x01\x0c\x6a\xd5\x74\x9e\x83\xaa\xc8\x0f\x10\x66\xa2\x67\xb1\x9b\x70\x0e\x0d\x79\x64\x39\x58\xa9\x77\xa8\xfe\xf1\xd1\xde\xc7\x67\xfb\xcf\x77\xdf\xbe\x3c\x49\x92\x2e\x3a\xf4\x02\x3a\xd4\xf5\x42\x7c\x78\x7a\xae\xdc\xd1\x8b\xa7\x64\xfa\xeb\x5a\x55\x18\x1c\x8a\xce\xfc\xfc\xb4\x9b\x18\xb2\x3a\x37\x44\xd4\xeb\x60\x02\x61\xae\x45\xfa\x4b\x36\xdc\x77\x2b\xc1\xe5\x39\x82\x19\xe0\x13\x44\xa3\x9b\xa5\x46\x58\x27\xeb\x91\x19\x4a\x4f\xe6\xef\x08\xda\x47\xbe\x52\x83\x77\xc6\x47\x4b\xed\x0d\x65\xf5\xda\xe9\xe8\xea\x74\x78\x41\xa2\x2e\xfa\x2c\x59\x05\x21\x8e\x6d\x01\x0b\x4c\x81\xc1\xe1\x78\xd6\x6c\xb0\x72\xa5\x77\xbd\x1f\xe6\x78\x14\x53\xf4\x22\x70\x2e\x51\xc1\xfc\x64\xb4\x3c\xd2\x8f\x7b\x87\x2f\x0f\x8f\x22\x73\xab\x29\xb7\xe6\x7c\xc7\x61\xef\x9e\xeb\x76\x71\x9b\xb6\x1f\x3c\xe8\x27\xf2\x3f\x3d\x07\x65\xc8\x15\x9e\xea\x0e\xb0\x02\xe4\xff\x06\x57\x4e\xc5\x0f\xc0\xed\xa1\x3d\xd1\x69\x0a\x29\xbe\xb7\xc1\xaf\x74\xb7\x54\x7e\x3e\x95\xf4\x7c\xde\xaf\xf6\xe6\xa9\x7c\xf1\x2e\xa1\x6a\x27\x6c\x5b\x88\xfc\xee\xfc\x1c\xbc\x2f\x57\x43\xc6\xe5\xf2\x7f\x5e\x98\x1b\xfd\x19\xb9\xf9\x32\xae\x92\x85\x8b\x30\x04\xf0\x86\x69\xd3\x01\xfa\x89\x37\x55\xb6\xd8\x53\x05\x02\x57\xa9\x83\x33\xea\xa5\x0f\xce\x72\x94\x42\x19\x89\x01\x57\xd1\x5e\x4a\x51\xfd\xd9\x19\x3e\x11\x36\xc2\x1d\xf5\xf1\x29\x55\x84\x19\x23\x1e\x07\x7a\x9e\x82\x11\x50\xf2\x6a\x2f\xac\xbd\xc2\x7c\x23\xba\x63\x9f\xfd\x2b\x82\xb7\xe4\xaa\xf5\x97\x91\x62\x06\x08\xde\xee\x29\x6d\x38\x07\x69\xbb\x79\xc1\x0f\x7d\xbc\x00\x4f\xe9\xad\xa6\xd7\x2e\xe9\x1a\x7e\xd4\xb0\x3d\xf9\x18\x2a\xf7\x70\x1a\x38\x68\x9d\x77\x1d\x27\x6a\x56\x4e\x22\x2d\xe1\x2a\x00\x15\x4b\x36\xb5\xe9\xad\x55\xe7\x5c\xf0\x96\x63\xde\x2d\x9f\xce\x25\xfd\x86\x37\xf6\xdd\x84\x6e\xa1\x6c\x4c\x6f\x14\x84\x2b\x89\x4b\xe3\x37\x57\x66\x49\x33\xb1\x41\x89\x23\x23\x5d\x01\x38\x4e\xb6\x11\xd3\x2d\xf9\x4d\xab\x21\x79\xa7\x94\x75\x89\x6c\x80\xee\x68\xde\x60\xd7\x0d\x87\xb9\x3b\x79\x4a\xe9\xc2\xbd\xa1\xfd\xb6\xcc\x0c\x8f\x29\xb8\xb1\x5b\x0d\x49\xdf\xfb\x10\x0c\x49\x55\xe1\x94\xdf\x72\x30\xfe\x43\x93\xba\x51\xa5\x09\xe6\x5c\x85\xa6\xbc\x07\xc2\xda\x51\xe6\xad\x07\x0a\x0f\x0f\xdd\x47\x1d\xb7\x58\x27\x9e\xcb\x2c\x83\x21\x60\x04\x94\x68\x03\xae\x88\xfc\xe1\x11\x06\xc4\x1e\xdf\x95\x26\xa6\xbd\xbe\x3d\x07\xd0\x6a\x0a\x86\x7a\xa5\xb5\x2f\x7a\xe8\x63\x9a\xfd\x11\x58\x3f\x31\x4a\x40\x58\x5c\xa7\x86\xc5\xa9\xb0\x3a\xf7\xbf\x62\x63\xfb\x6c\x36\xb7\xa9\x81\x95\x33\x1a\x8e\x8b\x69\x04\xff\xc6\x62\x20\x69\x65\xb9\x6e\xa2\x8b\x38\x3c\x78\xb1\xda\xf4\xc3\xa0\x95\xe3\x53\x25\x9a\xa8\xf9\xe5\x7b\xf3\xeb\x07\x7e\xe4\xf0\xef\x56\x9f\x34\xbf\x0c\xaf\xe3\xca\x15\x6d\xfe\x31\x1d\xa6\x1c\xbc\xc0\xeb\x30\xbf\x0c\xd5\xda\x2e\x17\x2a\x63\x1c\xe1\xc5\x53\x65\x13\xf1\xa6\xb2\x69\x76\xd9\x67\x8d\x5c\xd5\xa8\xb7\x04\x25\x8d\xc8\x3b\xc0\xd6\x26\x74\xc9\x36\x17\xe6\x82\xac\x7a\x82\x01\xa6\x5a\x82\x87\x07\xd5\xa0\x7d\x32\x56\x43\x47\x70\x1f\x01\x83\xd9\x6a\x3f\xb0\xf3\x1a\xe5\xfa\x57\x67\x9e\xbe\x36\xd3\xf2\x2f\xcb\x56\xc4\xe9\x2d\x64\x74\xf5\x33\x83\x5e\x95\xed\x77\x7c\xcf\x3f\x08\xb1\xdd\x0f\xce\x8a\x93\x49\xeb\x4f\x0c\xad\x0d\xf8\x80\x63\xc1\x80\x9f\x39\x01\x61\x2c\x3f\xab\x91\xad\xc0\xe9\x69\x68\xfe\x9e\x81\x4f\x2a\x21\xbc\xe9\x57\xdf\xde\x4a\xd6\xdb\x15\xfd\x5c\xbf\xa4\xb9\x95\x2b\x94\x97\xec\xe7\x50\x5d\x19\x1e\x45\xb7\xe6\x7c\x54\x89\x5e\x47\x96\xd7\x1e\x95\x55\xd5\xee\x38\x32\x8f\xfc\x4e\x94\x1e\xf9\xc0\xc4\x1e\x6b\x0a\xe9\x3d\xf2\xc1\x91\x7c\xe4\xa3\x4f\xf5\xb1\x0e\x99\xf0\xe3\x9f\xc2\x74\xa3\xee\x23\x93\x7f\x75\xa9\x1c\x5f\xcd\x40\x6c\xf1\x27\xcd\x97\xea\xbb\x29\xc1\x00\xa2\xeb\x91\xc5\x0e\xec\x71\x8c\x29\x27\x04\x44\x7f\x32\xc8\xdb\xc7\xde\x85\xed\x2e\x73\x36\x27\xa3\xc9\x69\x28\xbd\xcf\xc6\x28\xa6\x39\x90\x42\x31\x56\x53\x20\xa3\xd0\x5f\x9f\x83\xc0\xcc\xc8\x80\x4b\xa0\x31\x06\x65\xa9\x24\x38\xda\x90\x0f\x37\x64\x55\x82\xe1\x4c\x8a\x69\x61\xca\x0f\xc1\x6d\x73\x94\xb9\xa0\x1a\x68\x8f\xf8\x7c\xc3\xd1\x0f\x8d\x2c\x9a\x62\x48\x09\x40\xec\x95\x10\x1c\x7d\xbe\x41\x8a\xaf\x2c\x39\x3c\xee\xa1\x1c\x81\x8e\x25\x9c\xc8\x2e\x33\x42\x6b\xa4\x41\x02\x59\xc4\x15\x3c\x4b\xf6\x8e\x8f\xd9\xab\xb1\x63\xb6\x69\x1d\x26\xd8\x61\x66\x09\x50\x4d\x46\xc5\x12\xb3\xb8\x11\x58\x8c\xb3\x76\x80\xef\x6f\x72\x09\xbe\x34\x66\x3e\x68\xd0\xcc\xc9\x2d\x1e\x1f\x32\x2b\xce\x8b\x1e\x0d\x7b\x93\xfd\xc1\x4c\x6b\xb8\x27\x32\xaa\x3e\x7d\xb3\x63\xc9\x60\x34\xd0\x22\xc7\x05\xe3\xdf\x3f\xfe\x70\x3e\xbe\x99\x5d\xb0\xe6\xe0\x8f\x9d\x3a\x45\x28\xba\xf8\x28\x2c\x6b\xeb\xb2\x82\x9b\x30\xe4\x5f\xc5\xdd\x03\xf8\x11\x4b\x5a\x1b\xde\x4d\x04\xbb\x08\x74\x6b\x78\x22\xbd\xa5\xc5\xdc\xd1\x82\xec\xa8\x47\x6e\x3a\x45\x33\xfc\xf1\x69\x6d\x35\x07\x85\x74\xb7\x67\xc9\x5d\xdd\x51\xc1\xd4\x02\x15\xbf\xbd\xd6\xba\x3d\x0f\x09\xd8\xe7\x1f\xb9\x7d\xe8\x1e\x26\x57\x69\xd3\x81\x65\xc3\x64\x57\x01\x89\x43\xa1\x8e\x45\x46\x95\x5c\x9c\xf0\xab\xca\xbf\x69\x47\xa8\x18\x83\x3b\xb1\x17\x9f\xa1\xd1\xab\xc9\x37\x5c\x45\xbf\x41\xc5\x41\xac\x6c\xb0\x26\x0d\x87\xfb\xd9\x6f\x5a\xc9\x98\x02\x38\x00\x17\xb4\x6e\x11\x4e\xe6\x3b\x49\xe3\xd8\x81\xaf\x41\xc2\x73\xbc\xb9\xb9\x06\x2c\x89\xf0\x2c\x16\xd4\xcc\xed\x1d\x5e\xe5\x61\xe3\x36\x77\x25\x7d\x0e\x5a\x3f\x75\x99\xd1\x57\x54\x11\x54\xcc\x67\xce\xc5\x4c\xb0\x93\x6c\x6b\xf6\x65\xb0\x21\x4a\x7e\x85\x7b\xa6\x86\x53\x01\x73\x70\x0f\xce\x4a\xb3\x51\x02\xbf\xf1\x59\x37\xed\xbd\x2b\x4d\xcd\x43\x23\xeb\x5c\x4e\xf7\x10\xb2\x63\x95\x5e\xbc\xb6\x2c\x76\x38\x81\x7c\x84\xf3\xf6\x7f\xa8\x46\x7f\xd1\x63\x65\x1b\x81\xfe\xf1\x52\x22\x3c\xdb\xa4\x23\xb7\xa4\x1a\x9f\x65\xef\xdc\xc0\x3c\xdb\x9b\xbc\x72\x02\x37\xea\xc2\x47\x4f\x48\x63\x00\x42\x29\x82\x28\x70\x4b\x8b\xa2\xc0\xf0\x61\x73\xa1\xa7\x23\xeb\x66\xe8\x86\x01\x5e\xca\x1b\xb1\xf1\xe1\x32\xe2\x5d\x8c\x57\xa6\xc5\x12\x95\x21\xa8\x41\xc3\x4f\x75\xc3\x0e\x2f\x05\x55\xcb\xcb\x12\x10\x94\xd3\xde\x42\x50\xba\xc2\x1e\x0a\xe4\x84\x78\xb2\x8f\x44\x3c\x67\xc3\x50\xbf\x7a\xc5\xf6\xf0\x1d\x42\x5d\x82\x99\xe0\x1a\x46\x6b\x03\x89\xe3\x8f\x66\xf1\x02\x75\x79\xdc\xed\x6c\x3a\xc2\xa0\x08\x41\xa6\x87\xb6\xc5\x0c\x00\xd1\x35\xae\xba\xdd\x0a\xd3\x8e\x79\x6e\xcd\x00\x25\x9a\x9c\x5e\x4e\x31\xd1\x81\xbb\xf0\xc2\xea\x0f\xa4\xb3\xe7\xfc\xa8\x48\x92\x6a\x2b\x40\x13\x5f\xd1\x77\xe9\x2d\x48\x37\x03\xb0\x8e\x00\x5e\xa8\xd8\x98\x1a\xcf\x03\xf7\x16\x81\x4f\x05\xa8\x1b\x9c\x63\x37\x18\x41\x36\x56\xf3\xd0\x76\xc9\x1d\x27\xa5\x57\xd6\x2e\xeb\x9a\xf5\x0c\x86\xe7\x3c\xbe\xb2\x2b\x1f\x31\x7c\x0c\xb3\x32\xfe\x8a\x89\x63\x09\x1e\x10\x53\xda\xac\x12\x7a\x8a\x40\x92\x5e\x9c\x2e\xe2\x38\x81\xdb\x08\xac\xc8\x09\x03\xc0\xdc\xaf\x3e\x6a\xea\xc5\x73\xcf\x16\x5f\x80\x50\xdd\x3d\x41\x12\xda\xab\x30\x3b\x91\x45\x9a\xd8\xf4\xb0\x0e\x25\x1b\xf9\x23\x3e\x88\xc4\x63\xa2\x3d\x8f\x8c\x1d\x1c\xec\x00\xae\x63\xe8\x5f\x92\xb3\x79\xc7\x3d\xd8\x1b\x4a\x8c\xb8\xa3\xaf\x14\x99\x94\x5c\x30\x3e\xa3\x1c\xbf\x2a\xa4\x8e\x1c\xd6\x5e\x84\x89\xd6\xe2\xf6\x13\xef\xf5\x6c\x92\x4d\x5c\xd9\xf0\x61\xf4\x6a\x35\x3f\x86\xd0\xc8\x9d\x3b\x95\xd7\x30\xd2\x02\x49\x24\x66\x36\xfa\xb9\x0b\xab\xd3\xe3\xe5\xaf\x4b\x28\xb7\x60\x15\x58\x92\x3a\x51\x26\x26\xcb\xd8\x4a\xfe\x53\xe4\x7b\x53\x35\xe8\xe8\xc4\x2d\xde\x83\x7f\x91\x55\xef\x2b\xdb\x8e\xd6\xd8\x45\x2c\x2d\x9a\x8f\x69\xb0\xaf\x04\x3c\x49\xb3\xd8\x4d\xb9\xf2\xb5\x6d\x37\xb0\x37\x69\x3b\x16\xc1\xa7\x82\x30\xc1\xf2\x10\x5e\x8d\x99\xc5\x25\x66\xb8\x59\x51\x36\xc4\xf8\x6b\x71\x4f\x50\x13\x3b\xf1\xbd\x16\xec\xef\x44\x85\xc0\x6a\x83\x29\xc0\x5d\x2d\x22\x47\xe2\xad\xe7\x06\x1a\xf1\xa3\x72\xdd\xa9\x05\xf2\xba\x0b\x6d\xd8\xab\xba\x73\xc3\xe3\x09\xae\x56\xd2\xda\x95\xaf\xea\x0b\x2c\xfe\x88\x79\x0e\xc8\xa4\x80\x30\xec\xdd\x5c\x43\x0b\xe6\xc9\x0f\xc9\xa3\x10\x56\xd2\x69\x7c\x72\x15\xea\x05\xfe\x1e\x70\x2f\x8f\xcf\xc4\xd6\xb1\xfb\xfa\xf8\x20\x19\x3c\xec\x23\x23\xf0\x48\x30\xb9\xc4\x25\xd7\xbc\xef\x8f\x14\x18\x9c\x34\x6e\x75\x85\xb6\xe1\xc1\x43\x5f\xbf\xd4\x17\x8b\x13\x6a\x1d\xe6\xe0\xfb\x68\x9e\x67\x0e\xdc\x93\x96\xf8\x16\x27\xab\x54\x76\x91\x5e\xe6\x00\x9d\x7c\x96\x98\x9a\x13\xc3\xa8\x39\x27\x1d\x35\x22\x0f\xc1\xa1\x4e\xc3\x18\xfe\x2e\x02\x44\x9d\x96\x31\xfc\x5d\xca\xc7\xce\x58\x5c\x91\xa8\x4a\x3f\x6d\x61\x2b\x75\x8c\x39\xd1\x8e\xec\x5e\xdd\x84\x62\x03\x4c\x6a\xa7\x13\x9b\xbe\x8f\x0e\x9d\x4f\xcd\x39\xcc\x45\x2f\xc8\x2f\x4b\xa7\x14\x53\xfd\xf4\x66\x52\x08\x07\x58\xbb\x06\x95\xe9\x3e\xd6\xe5\xab\xab\x50\x69\xa8\xca\xc9\x46\x2c\x68\xfe\x7b\xe0\x88\xbe\xb2\x52\x77\x9a\xb5\x60\x8d\xe5\x8f\x5e\x3c\x75\xe7\x27\xb2\x07\xc1\xe9\x0b\x4b\xc4\xd0\x40\x7d\xad\x55\xc3\xfe\xc6\xb7\xf6\x76\xab\x2e\xe9\x4d\x20\x10\x1e\xba\xd8\x0c\x6f\x2d\x50\x23\x8d\x01\x39\x3c\x1d\x43\x60\xec\x4d\xe2\xf9\x51\x80\x95\xcc\x1a\xc9\xc0\x89\x42\xd2\x26\xb5\x5d\xb4\xaa\x5a\xbe\x5b\xad\x1b\x51\x53\xf6\x92\x1f\xd5\xd3\xea\xfd\xa9\x2e\xc0\x4e\x55\xaf\xfc\x3e\xec\xe4\x43\xaf\x4a\x54\xa2\xdf\x0c\x35\x89\x32\x78\x86\x2d\x2a\xe6\x27\xc5\xab\xf4\x53\xf6\x9c\x85\xe8\x6e\x45\xa7\xf0\x24\xaa\x02\xa8\x9f\x42\x62\x97\xa6\x76\x32\xae\x75\x9d\x3d\xd6\x5b\x49\xa5\x38\x9f\xe4\xd7\xdd\x70\xa4\xfd\xc0\x5b\xc2\xfc\xcf\xc6\x7d\xf3\xc7\x5f\x88\xca\x4d\xd1\xb4\x91\x9e\xdd\xa4\x5b\xad\xfb\x45\x1b\xa9\xee\x83\xd8\x46\x86\x9d\xc4\x30\x35\x16\x88\x55\xc5\x3a\x54\x31\x09\x2f\x94\x55\x20\x90\xfa\x4a\x11\xfb\x4a\x92\xfb\x4a\xd6\xa0\x3a\xf5\x5a\xcf\x85\x1a\x3a\x19\xe5\xef\x2c\x6d\x0d\x40\xfd\x17\x93\xb6\x1a\xea\x6c\x9b\x3a\xc4\x4a\xdd\x5a\x4c\x73\x4e\x61\x75\x73\xaf\x61\x58\x5c\xc5\x57\xa8\x89\xf4\x25\xae\x41\x1f\xc7\x15\x13\xbc\x06\x5a\xf2\xf2\x84\xac\xe6\x7e\x0e\xac\xf4\x85\x2d\xbb\x0c\xa1\xa6\x49\x27\xb9\xdd\x41\x51\x6c\xdb\xfe\xe0\x75\xc0\xe6\xb0\x68\xc5\xaa\xc8\x27\x5a\x33\x2b\xe6\x0d\x48\xce\x1b\x88\xa0\xa7\x3e\x6d\x27\xdc\xaf\x93\x01\x45\x28\xa3\xaa\xa2\x60\x64\x29\x68\x3b\x26\x32\x71\xc9\x8a\xe6\xd0\xd6\x69\x14\x9d\xb8\xb6\xd6\x12\xda\x8a\x75\xc2\x92\xaa\xc3\x9a\x3c\xaf\x4a\x44\x40\xe2\x1a\xa1\x9a\xcb\x56\x0b\x74\x63\x8f\xeb\x4f\xac\x3a\xac\x12\xd2\xed\x1b\x5e\xac\x5a\xbf\x8c\xdb\xf0\xfe\xd1\x07\xb2\xf1\x5c\x71\x05\x65\xb0\x69\x73\x96\x0e\x62\xa6\x42\xab\xc0\x10\xc2\x8c\xeb\x30\xa2\x4a\x8c\xe6\xf5\x3f\x77\xa6\x60\x6b\x6f\x21\xe7\x19\x54\x39\x96\x89\x52\xb6\xc5\x5c\x53\x58\x2f\xff\x99\x0c\x55\x20\x27\xa1\xdd\x22\xa3\x9f\x75\x0f\xb6\x69\xd5\xa2\xc8\x4b\x20\x34\xf8\x2b\x6a\xa3\x59\x4e\x22\x83\x23\x47\xb2\xd8\xf0\x6a\x56\xd7\xa6\xcb\xd2\x8b\x3a\xb5\x4a\x57\x9b\x6c\xcc\xd7\xc4\x06\x19\xad\x24\x5f\x15\x96\xf4\x0d\x18\x01\x56\x95\x04\x0f\x07\x05\x19\x76\x86\x9f\xb1\xd5\x7b\x42\x39\xb4\x6a\x77\x23\x61\xd7\x7b\xc0\x44\x41\xef\x55\xb2\x05\x8e\xa4\x1e\x2d\x57\x4a\x18\x14\xb3\x25\x61\x9f\x56\x0c\x6b\x5f\xbe\xa1\x6e\x78\x8d\x3b\xca\x6d\xdb\x0d\xa5\x01\xdb\xa1\x53\x0e\x48\x4c\x76\x16\x19\x5d\xb5\x3a\xcd\xea\xc4\x12\x14\xf8\x76\x53\x04\x6b\xbc\x7e\x94\xa0\xcc\x78\x51\xf7\x36\xd2\x93\xf8\x12\xa2\x3a\xa6\xea\x01\x55\x71\xc2\xb3\x7e\xa2\x52\x98\xb4\xa3\x31\x6c\xae\x42\x61\x41\x7b\xad\xe9\x8d\x9b\xab\x56\x6e\x4f\x7d\x88\xf6\x42\x2a\x9c\x26\x32\x24\x2d\xb9\xa5\x44\x28\x9c\x61\x98\x02\xfc\xe3\x5f\x8d\x04\x33\xd6\x08\x71\x14\x6e\x53\xd5\x56\xd4\xa7\xd2\xa0\x7e\x21\x01\x06\xc1\xba\x1e\x0d\xda\xdc\xb6\xb7\xa0\x40\xf0\x06\xad\x25\xc2\x8c\x45\x93\x5b\x90\x20\xb4\x17\xd6\x6e\xa2\xc1\x72\x36\x06\x18\x00\xfb\x78\x4f\x29\x82\x63\x91\x9f\x2f\x21\xd0\x7b\xbe\x9c\xe2\x53\x4f\x86\xfd\x75\x5c\x6f\xcf\xbc\x4f\x90\x48\x52\x8c\x5c\x0a\xd6\x2d\xa4\x2d\x97\x69\x88\x6b\x0a\x82\x9a\x70\x38\xfe\x86\xee\xce\xe7\xe9\x0d\xda\xe9\x53\xf8\x5b\x42\xaf\x31\x8a\x18\x14\xb0\xc3\xbe\xf6\x76\xfe\x34\xe0\x05\x78\x1e\x80\x2d\x4d\x88\x14\x3d\x26\x1c\x19\xe4\x12\x12\x81\xde\xab\x8d\x13\x56\x33\x91\xc6\xd0\x76\x10\x9f\xad\x39\xa6\xc0\x2c\x09\x13\xa3\x86\x58\x06\x75\xa4\x31\xe5\x2b\x91\x9b\x59\xb1\x45\xc1\x25\xf6\x42\x97\x69\x64\x87\x0c\xcf\xd3\x40\xa5\xb8\x78\xe6\xe5\x04\x58\xa2\x79\x34\xb0\x3c\x70\xd8\x7c\xff\xc1\x29\xe7\xd0\xe7\xcd\x88\xb1\x1a\xb0\x6d\x4d\x39\x6c\xe6\xf8\x53\x02\xfa\x4e\xd3\x90\x3c\xb0\x9e\x1c\x9f\x60\x6a\xf1\x0d\x08\xb7\x7a\x03\x20\x2a\xbb\x8b\x6e\xce\xa2\x35\xb6\x30\x1d\xce\x33\x76\x87\xed\x0e\x11\x6c\xf7\xfa\xcc\xfc\x31\xf2\x6b\x32\x30\x82\xe9\xf6\x63\xab\x60\x32\x5f\x93\xc1\xf6\x23\xe0\xb2\xf8\xb4\xc0\x94\x88\x29\x20\xd3\xc2\xc0\xe9\x8c\x78\xc4\xf7\x9e\xb8\x1e\x58\x27\xe4\xa7\xc2\x81\x86\xa9\xac\xce\xc9\x30\xbf\x44\x0c\x88\x2e\x10\xe5\x0e\x8e\x9f\xef\x72\x58\x12\x59\x8e\xde\xe7\x20\xbd\x41\x43\xbd\xbc\xef\xc6\x01\x7e\x3b\xb8\x9b\x3b\xb8\x77\xae\x15\x5e\x6f\xd0\xf1\x06\x83\x4e\xbc\x1d\x70\x3d\xe6\x95\x09\x5a\x05\x03\x8f\x71\xed\x76\xd3\x59\xf3\xbd\x64\x57\x45\xec\x5d\x2e\xfe\x35\x83\xf4\xfa\x09\xfe\xeb\x4c\xfe\x02\xa1\x8c\x20\x53\x19\xf1\xa5\xa3\x21\x4a\x3b\x74\xe4\x7e\x3e\xd9\xd8\x93\xe3\xfa\x2a\x9d\x35\xc5\xf8\x2d\x08\x7f\x20\x2b\x0d\xd7\x94\x59\x08\x82\xc4\x86\xd3\x92\x4f\x92\x38\xb5\xab\x9f\x13\x38\xf8\x68\xf7\x29\x3c\x9c\x06\xbe\x52\x4c\x73\x08\x10\x84\xf0\x14\x73\x50\x19\x22\x34\x1a\xa7\x50\xbc\x4b\xe0\x9b\xd4\x04\x00\xe5\xf4\x93\x19\xe8\xaa\xb0\x8c\xbd\xc7\xcc\xeb\xb0\x18\x06\x76\x74\xd7\x3f\xff\x73\x3a\x22\x35\xcf\x69\x66\xc3\xec\xc6\x0c\x3e\x78\x0d\x83\x02\x90\x54\x34\xc1\xe5\xc8\x09\x90\xd1\xa1\x44\x28\x6c\x97\x57\x0a\xd0\x93\xcb\xc2\x14\x37\xcf\x4e\xb0\x14\xf6\x5d\x38\x86\x1a\xf6\x57\xe4\x62\x26\xe9\x1c\x12\xa0\x7e\xf3\x8e\xe1\x54\x5d\xf0\xe0\x37\x0e\x88\x5a\x42\x11\x04\xc7\x0b\x5f\x26\x27\x7b\xce\x0d\x1f\x73\x29\xa9\xdf\x60\xc0\x84\xa3\x9d\xfb\x60\x4d\x10\xf4\x01\x4e\x01\x3e\xc0\x11\x34\x85\xb8\xae\xfe\x70\x00\x0a\x89\xcd\x6b\x80\xed\xee\xea\xd4\x8d\x8a\xac\x3e\x6b\x88\x5b\x91\x17\x73\x08\x52\xcc\xd1\xc3\x0f\x4b\x01\x52\x1d\x85\x4e\x9e\x2d\x11\x7d\xcb\xb6\x98\x60\xc4\x87\x59\x16\x84\xa3\xb2\x0b\x95\x65\xe8\x85\xb7\x43\x4f\xc7\xfb\x9f\x4f\x06\x5b\x5b\x1f\x12\xfc\x0f\x1c\xaa\x79\xf2\x62\x69\x26\x2f\x0f\x0b\xfd\xb9\x58\x2c\x66\x3b\x9b\x9b\x97\x0b\x53\x68\x63\x9a\x2d\x36\x47\xc5\xb0\xa4\x7f\xae\x2f\xcf\x37\x0d\x51\xcc\xcc\xe2\xdc\xdf\xb8\x58\x4c\xc6\xb6\xdd\x07\x03\x6c\xd7\xfc\x27\xf9\x19\xd1\xdb\x24\x6e\x18\x20\x08\x11\xbc\xde\x74\x76\x30\x05\xea\x43\x32\x6b\xd7\xa5\x69\x6e\xdd\x5c\x2a\xec\xa8\xc7\xaf\xe9\xfb\x3f\x9f\xec\x1f\xbd\xfa\x90\xfc\x19\xb7\x68\x8f\x71\x7d\x8e\x85\x1c\xa2\x2d\x5b\x45\xf2\x7a\x5e\x8e\x01\xe7\x05\x3a\x41\xa2\xdc\x1c\x2e\xcc\xa5\xff\x9f\xa5\xfc\x57\x4f\x6b\xef\xe4\xe8\xe5\x87\x24\x79\x97\x7f\xca\x67\x90\x94\x65\x27\xd9\xdb\x42\x9a\xd8\x1b\xd8\x7e\xf7\x40\x37\x19\xed\x33\x9b\x6e\x5c\x49\xcd\x8d\x62\x7e\xbe\x09\xff\xda\xdc\xdb\xfa\x68\x5a\xf8\xb8\x37\xf8\xc8\x88\x44\x1f\x87\xae\x85\xf7\x7b\xc7\x07\xa6\x43\xdd\x23\xda\xfc\xf6\xe9\x20\x40\x5f\xb7\xe9\x8a\x3b\x90\xa5\xf9\x78\x00\xff\x1e\x2d\x87\x44\x60\x09\x84\x0a\x27\x0f\xf8\xbe\x38\x2b\xfa\xf8\x6f\xf8\xdb\x70\x32\xeb\xcb\x5f\x92\xf5\x97\x74\x7a\xd7\xa7\xd9\xd5\x5a\x23\x6e\xa1\xbb\x79\xec\xe6\x4b\xe8\xab\xc4\xd9\x06\x97\x99\x30\x26\x3f\x9f\xd4\xa3\x1b\xe2\x6d\x99\x48\x28\x0f\xa3\xe1\x85\x77\x5c\x14\x76\xea\x32\x9f\x03\xe2\x5a\xe2\x19\x27\xef\x6e\xae\x05\x88\x05\x21\x60\xa2\x2d\xee\x32\xc9\x60\x79\x07\xc6\x41\x29\x70\x55\x1a\x0b\x6b\xc1\xd7\x49\x4f\xb9\x5a\x34\xe1\xa9\x38\xa2\xbc\x81\x54\x9f\x0c\xe6\x8c\xe9\xa3\x10\xd7\xd0\x99\x80\x01\xf0\x18\xd3\x81\xfa\xf0\x86\x94\x16\x36\xa3\x4f\xc0\xa3\x73\x70\xa9\xc5\xec\x02\x44\x2d\xc9\xa8\x72\x03\x09\x76\xb1\x64\x32\x2f\x96\x0b\x0c\xda\x36\x77\xfd\x05\x06\xaf\xa5\x98\xbc\x62\x44\x99\x27\x4d\x0b\x38\x64\xd7\xec\x47\xeb\xf3\xe4\xf0\x21\xd5\x47\x1d\xc3\x63\x5e\xba\x37\xf6\x53\xd7\x15\x7d\x3b\x85\x54\x42\xd3\x8f\x16\x57\x7f\x77\x7a\x93\x7c\x33\xa6\x4e\x01\xa3\x1a\xa3\xbc\xca\x6f\xec\x1b\x18\xdc\xfa\x7d\x1b\xb1\xde\xf9\x11\x1e\xdd\xa4\x43\x11\xdf\x17\x3c\x67\xd2\xad\xdb\x76\x12\x01\x38\xe2\x68\x21\x1a\x84\x39\x57\x1f\xed\x0c\xb8\xef\x57\x5c\xe5\x23\x3b\x40\xaa\xd1\x19\x29\x30\x1f\xfb\xc3\x33\x1b\x70\x0c\xaa\x77\x95\xe4\x20\x03\xba\x03\xc0\xc8\x60\x2e\x7d\x6a\x29\xbb\x1e\x66\xb3\x85\xf8\x95\x01\xe2\x22\x39\x64\x60\xaa\x38\x14\x29\x97\x13\x7c\xe6\xd2\xf9\x39\x7a\xd4\xba\x50\x5f\xe9\x3f\x3e\xc4\x77\x17\x19\xd9\x13\xe6\xf8\xd2\x11\xc8\xd9\x4c\xc2\x84\x78\xf9\xf0\x56\xc1\x35\x95\xf8\xc9\x0a\x50\x0d\xf5\x85\xc0\xbc\x94\x65\x09\x19\x66\x82\xc6\xd3\x69\xa4\xd6\x2c\x88\x68\x80\x28\x49\x69\x56\xe1\x81\x64\x71\x0c\xf1\x25\xed\x3e\x52\xae\x14\x43\x61\x87\xc7\x7b\x1a\x52\x89\x8f\x53\x39\x04\xbc\xf7\x97\xf9\x24\xc7\x48\xb6\xed\x2d\xf3\x47\x3a\xdb\x53\xa0\x00\xf3\xec\x7c\x39\x36\xf2\x40\x76\x0d\x2a\xe7\x92\x13\xcc\x3b\x17\x6b\x24\x2f\xc8\xbd\xb7\x8e\x90\x2c\x02\xf4\x06\x1b\x55\x6e\xac\x39\xd7\x4a\x09\x98\x35\x84\xe1\x11\x26\xb4\xf6\x9f\xcb\x7c\xf8\xc9\xbc\xd0\x25\x66\xc2\x10\x01\xd3\x39\x86\x5f\x2f\xa8\x21\xdd\x38\x49\x6f\x2c\x10\x0d\x87\x60\x80\x20\x98\x44\x00\x70\x2b\xbb\x8e\xff\xdb\x1b\xf4\x36\x26\xe9\xac\x2b\x36\xeb\x20\xe9\x0e\xcb\x07\xc4\x5b\x77\x7e\xf9\x05\xb3\xbe\x53\x0a\x94\xbf\xce\xd2\x11\xa4\x93\x33\xbd\xc1\xdd\x6f\x04\xa4\xde\xc6\xa2\xe0\xa0\xd0\xc1\x43\x23\x2e\x6c\x4b\x4a\xc7\xcf\xbd\x8d\xff\x30\x4f\x3f\x85\x8a\x4a\x58\xcf\x70\xf0\x26\x5d\x98\x71\x4c\xe5\xa8\x1e\x65\xe7\xfb\xd7\x86\xa1\x7d\x0f\x7d\xc0\x98\xef\x25\x9d\x0f\x1d\x7b\x34\x99\x91\xa5\xf5\xcd\x49\x4e\x26\x60\x9a\x11\x7e\xb1\xde\x40\xd4\xfe\x72\x71\x26\xbc\xaf\x74\x10\xb0\xc4\xec\x8c\x67\xef\x70\x21\x5d\x84\x42\x94\xe3\x91\x3c\x5a\x3f\xcd\x17\xd5\xb5\xa5\x6c\x20\x5c\xd3\xc8\xf3\x35\xc5\x08\x81\x5f\x3d\x32\x68\x4b\xb9\x00\xe0\x7e\xa0\x7d\x52\x83\x51\x96\xde\xbb\x92\xb8\x03\x30\x7e\x81\x5b\xfe\x0e\x9b\x94\x93\x51\x52\x9a\x1e\xe0\xc4\x0c\xcf\x47\x26\xb7\xab\x82\x90\x7e\x0c\xf9\xe6\x97\xe9\xd8\xe6\x74\xbc\x9b\xbc\x82\xbc\xc1\x90\x3c\x18\x3c\xff\x81\x49\x44\x7c\x60\xb9\x9a\x4d\x45\xa2\x47\x8e\xa4\xf6\x26\xf3\xce\x06\x79\x07\x73\xc2\x43\x7b\x7a\x63\x83\x74\x13\x4b\xba\x1a\x68\x1a\xb3\xcc\x50\x4b\x79\x59\x2e\x19\xfa\x38\xf9\xc6\x2c\x69\x0e\xb1\xd1\xe9\xf8\x1b\x33\x0e\x40\x01\xe1\x5c\x45\xcc\x3e\x4a\x40\xc8\xa9\xf5\x99\x22\xee\x55\x5e\x57\xdb\x00\x54\x27\xac\x52\xc0\x79\x1e\x5f\x22\xea\xc1\xa2\x83\x2a\x47\x53\x6b\x7e\x23\x00\x77\xfa\x3d\x25\x87\x90\x47\x4f\xf3\x85\xf0\x46\xde\x0d\x12\x23\x01\xb8\x7a\x70\xb5\xe0\x86\x78\xb0\xed\x84\x1e\x8d\x10\x8e\xea\x44\x8c\x73\x81\x34\x72\x9c\x42\x2a\xd6\xb5\x4d\x30\x45\xd0\x42\x3a\x61\xb8\x74\x7e\xa4\x2e\x4a\xd8\xba\x0e\xba\xb5\x0a\xd8\xd1\xd0\xa1\x82\x7a\xf9\x4a\x80\xea\x97\x70\x7b\x70\x82\x66\x82\x22\x79\xb6\xbf\x07\x38\x3e\x00\xe7\x49\x99\x22\x06\xdb\xd1\x61\x99\xa3\x30\xd8\x8e\xaf\x05\xe9\x1c\x67\x08\xa0\x97\x08\x6a\x9d\x68\xdb\xe0\xf6\xc1\x78\x1a\xc6\x27\x53\x49\x80\x60\xe8\x41\x5f\xf6\x38\xec\x4b\x33\xe6\xc9\x30\x07\x74\xfd\x51\xc7\xef\xf3\x55\x7a\x2d\x2a\x03\xba\x9d\x97\x53\x47\x0c\xc9\xb3\xbd\xe3\x3e\xec\x46\x3f\x79\xf3\x0a\x1e\x98\xdd\x37\xee\xea\x16\xe4\xe0\xab\x0c\x4d\x82\xd4\xdc\x72\x86\x1c\xb1\xc2\x2c\x18\x92\xed\xce\x12\x3b\x01\x68\xc0\x89\xca\xa6\x92\x3e\x91\x03\xdb\x85\x51\x04\x11\xb8\x7b\x7c\x02\x39\xd9\xae\xbf\x1f\x9a\x07\x7e\xdf\xd0\x83\xb9\x0a\x3b\x3d\xce\xce\x7f\x37\xe9\x3e\xdd\x7f\x89\xdf\xb7\xbe\x33\xbf\x2a\x15\xd8\x45\xc6\xb9\x95\x92\x6f\xf8\xda\x96\xf1\x7e\x03\xb1\x54\xb9\x64\xaf\x74\x4b\x35\x49\xaf\xa9\x7b\x61\x8c\xcd\x52\x0d\xb6\xb6\xbf\xf5\xd7\xc9\x42\x17\x64\x13\x4c\x07\x89\xa9\x77\x18\xfd\xfc\x8a\x20\x08\x71\xe5\x58\x1f\xe8\x5f\x49\x66\x3e\xf4\x0e\x53\x5b\x8e\xae\xe1\x18\xda\x5c\x8f\x66\x63\x8b\xf3\x29\xe0\xba\x15\xf8\xbc\x8d\xf3\x61\x8e\x72\x22\x2e\x66\x30\x6a\x18\xc1\xdb\xa9\x12\x21\xa3\x04\x7e\xa2\xe2\x44\x5f\x6c\x6d\x6c\x6c\xbc\xb8\xaf\x86\x65\x5e\xa1\x32\x68\xf6\xc5\x16\x00\xf5\xc5\x74\x15\xf0\x66\x95\xef\x3b\x4f\x3b\x1f\xec\x83\xf2\x62\xb0\xa2\xf0\x96\x2e\xbc\x7d\x9b\x96\xef\xb7\x29\x1c\xce\x94\xae\x6f\x89\x36\xf4\x58\x33\x9f\x02\xe9\x0e\x4d\x61\x01\x66\xf8\xb2\x13\xa0\xd9\x29\x72\x64\x82\xc2\x29\xc2\x05\xc6\x96\xb1\x11\xef\xc5\x4b\x68\x8c\x9a\xb1\x6a\x59\x20\xb6\xef\xbf\xc5\x77\x81\xfd\x35\xb7\xae\xb7\x07\x98\xc7\xea\xfa\xbb\x90\xf6\xdd\x76\x60\x53\x30\x0e\x33\x99\x7e\xf2\xf6\x38\xd9\x3d\xde\x3b\x38\x08\xf7\xe3\x25\x1c\xdc\x17\x5b\x9d\xea\x6c\x1f\xfd\xf6\xb3\x3d\x6a\x39\xdb\x94\x67\x7b\x16\x52\xe9\x8b\x23\x6f\xf8\x9b\x86\x69\xbe\x44\x3c\x3b\xb8\x25\x85\xfd\x32\x37\xe7\xf1\x1e\xb1\x66\x3e\x7f\x96\x72\x82\x60\xd0\xec\x23\xa0\x6c\x4a\xe0\x03\x46\x3e\xc4\x16\x40\xe1\x0d\xe5\xee\x1a\xbe\x97\x2e\x61\x86\xa4\xf3\xf9\x12\xc8\x6e\x30\x8a\x8b\x28\x94\x51\xc8\xc9\x28\xbe\x13\xc4\xeb\xa2\x92\xec\xd4\x89\xa8\xca\x0d\x38\x2a\xd3\xb1\x0e\x9c\x9b\x82\x39\xee\x9f\xf0\xc3\x60\x38\x5b\x51\xc9\xb0\x70\xe8\xf2\xf3\x6e\x9a\x1b\x94\xba\x43\x06\xa2\x5d\x9f\x7b\x2f\x0f\xf6\xfe\x04\xd7\x56\x6d\x87\xdb\x8d\x1d\x22\xa6\xb3\x91\x35\x51\x75\x44\x20\x9f\x29\x80\x16\x2d\x28\x45\x2d\x26\xb3\x6d\x37\xf9\xa3\xdd\x17\x09\xfa\x32\x58\x68\x3b\x2b\x04\x26\x0a\x3a\xcb\xd3\x1d\x8a\xad\x03\x12\x68\x96\x89\x87\xaf\xa0\xb3\x2f\x8a\xe0\x7b\xb0\xc0\xe8\x14\x23\x08\x8d\x47\xa5\x30\xe5\x3a\x90\xf7\x74\x09\xa8\x36\x00\xc5\x4e\xf8\xe9\xa2\xdf\x95\xdf\x61\xb6\xb6\x41\xcb\x7f\x87\x56\x26\xf9\xfd\xb3\xf5\x67\x34\x3f\x78\x27\x18\xeb\xcf\xbd\x06\xa2\x21\xa7\xa6\x5f\x17\x6a\xea\x8c\x55\xe4\x89\xee\xcd\x97\x46\x18\x2c\xb5\x5a\x41\x0d\x04\xe2\x06\x05\xff\xee\x4b\x4f\x91\x30\x03\x71\x44\x7f\x92\x04\xbf\x38\x10\x04\x33\xc2\x27\x76\xac\x7f\xfb\x9b\x8f\x56\x64\xd6\x51\xcc\x09\xe4\xe3\x08\x0b\x51\xdf\x98\x91\x5f\x4b\xb6\x0e\x45\xc1\x0c\x82\x65\xeb\x7b\xfb\x22\x7b\x56\xbb\x06\x4d\x00\x16\xd5\x25\xc0\x22\x58\xf9\xb9\xf5\xce\xf7\x51\x98\x9e\x2e\xcf\xba\x6a\xe2\x5a\x5e\xc2\xef\xbb\x22\x8d\x57\xf2\xd6\xd6\xcc\x27\x76\x6c\xeb\x87\xef\x8d\xad\x0e\x8c\x83\xd6\x3b\xb6\xa7\x35\x43\xa2\x15\xf5\x16\xd4\x0e\x2b\x46\xa5\x1e\x85\xc2\x05\x49\x50\x66\x08\xc2\xb4\x3c\xeb\xcb\x56\x23\x3c\x2e\x90\x46\xeb\xe9\x3d\x45\xc2\x6a\xd8\x20\xa2\x3c\xeb\x72\xc8\x1b\xa1\xbd\x0e\x93\x1f\xed\xcf\x3b\x35\x74\x19\x5d\x03\xab\x46\x31\x42\x28\x24\xf8\x69\x98\x3e\xb4\x6f\x8a\x7f\xfc\x6b\x36\x2f\xdc\x3a\x48\x0e\x4d\xb7\x16\x40\xd9\xef\xb7\x3e\xb4\x9e\xbd\xa5\x9d\x70\x0d\xa4\x33\xb5\x10\xd0\xf6\x86\x6f\xbb\xd3\xbe\x98\x7a\x84\x77\x80\x95\x9f\x9a\x3d\xc9\xa7\xd9\xa8\xa3\x72\x37\xf2\xf8\xf8\x28\x4b\x79\x6f\x7d\x5e\x64\x88\x8a\x28\x8b\x83\x1a\xab\x69\xc2\x5e\x0f\xe1\xfa\x48\x26\x11\x53\xda\xfc\x95\x54\x3e\x52\x91\x51\xfa\x50\xdb\xb4\x98\x83\x40\xd2\x66\x59\x72\x53\x5f\x2f\x06\xb5\x6c\x09\xec\x67\x58\x6a\x67\x65\x26\x8f\x1d\x37\x35\x2a\xfd\x41\xd6\xc6\x5a\xa4\xd9\x26\x8d\x97\x01\x9e\xc6\x83\x29\xa2\xcd\xf6\xcd\xcb\xd7\xb3\x11\x14\xbb\x6a\xda\x66\x49\x71\x29\x01\xf1\x99\xf1\x9d\xf8\x2a\x96\xcb\x1d\x77\x9d\xc2\x28\xa0\x2f\x6c\x1c\xf2\xbb\xae\x59\xfd\x8c\xbb\x02\x71\xd8\xd4\x8f\xd8\x44\xb3\x85\x44\x21\xf3\x2f\x7e\x51\xb5\x23\xbb\xa3\xcb\x54\x44\x16\x7a\x91\x0c\x5d\xc7\x1e\x24\xeb\x9a\x82\x92\x06\x65\x98\xa0\x4d\x30\xb3\x21\x76\x0c\x84\x68\x6a\xae\xcd\x66\x70\x51\xbd\x1f\xd8\xb4\xa2\x4a\x38\x62\xf7\x9e\x50\x8f\xc1\x39\xe3\x58\x4b\x00\x31\x02\xe5\x10\x3c\x6a\x98\x86\x89\xc0\xb2\xd5\x2d\x54\xcd\xc3\x64\xa7\x8a\x86\x2d\x75\xe3\x7b\x9e\x1b\x3a\x95\xc6\x8a\x3e\xda\xcc\x76\x96\x65\x9f\x8e\xa4\x99\xe0\x5e\xf2\x7d\x36\xf9\x5e\x12\xd3\xb7\x2c\x44\x78\xff\xdb\x05\xc0\xec\x35\xe4\xf1\xa1\xd5\x50\xd3\xaf\xbd\x08\xd8\x4f\x4d\x07\x6d\x57\x00\x44\xa9\x5b\xcf\xbc\x8f\x49\x63\xbf\x7c\xf2\xf0\x0e\xa5\x21\x99\xeb\x69\xa3\xc2\x0e\x48\xf8\x37\x9d\x3f\xf0\x9f\xe6\xf8\x7f\xd1\x12\xdc\xbb\x57\xbb\x08\xca\x93\x98\xe7\x0b\xce\x41\x93\xd9\xe2\x46\x2c\x13\x8a\x13\xa5\xec\xf6\xa2\x10\x6f\x75\x65\x96\x7b\x9c\x8f\x64\xe5\xa0\x05\x2b\xc7\x06\xd3\xc2\x44\xf8\x4d\xf9\xe1\x89\x3d\xd1\x3a\xb6\xd5\x97\x81\x74\x0f\x97\xfa\x1e\xb8\x44\x9d\xfc\xe5\xe2\xb1\x96\xa9\xba\xbd\xfa\x96\x74\x90\x24\x28\x4e\x6b\x80\xa6\x48\xad\xf6\xc4\x76\x62\xad\x70\x58\x8b\xda\xd3\x69\x88\x17\x21\x02\x6e\xb5\xe2\x39\x64\xca\xf1\xf0\xe3\x7a\x04\x3d\xa7\xdb\x41\xb1\xda\xd6\x7d\xf1\xf2\xb1\x27\xb0\xba\x0f\x0a\x1e\x15\x35\x23\xee\xcb\x96\xaf\x05\x71\x1f\x06\xbe\xc6\xc3\x7d\xd8\xf6\xb5\x1b\xee\xc3\xfd\x56\xcb\x28\x99\x6b\xe2\x2b\xe9\x2d\x01\x17\xe5\xe5\x53\x2b\xad\x56\xc0\x5f\xec\xca\x9a\x45\x56\x5b\x56\x31\x68\xc4\x2d\xa5\x5a\x46\x5a\x3c\xfb\xe1\x28\xa8\x62\x97\x52\x2d\x23\x2d\x9e\xfd\x30\xf0\x3f\xd8\xa5\x54\xcb\x48\x8b\x67\x3f\x84\xcb\xd8\x0e\xe9\xee\x7f\x9a\xc2\x2b\xd4\x0a\x45\x15\x2d\x5f\xa0\xf6\x58\xbb\xb5\xc9\x5a\x5d\x85\x3f\xa1\x91\xd5\x99\x14\x43\xad\x89\x38\x9f\xa0\x5a\x96\xac\xe8\x27\x20\xed\x9b\xab\xfd\x1b\xc8\x24\x27\x2f\xfa\x7b\x74\x2d\x08\x19\xec\x58\x02\x0c\xb2\xb9\xeb\x3d\xcd\x02\xcc\x23\x6f\x22\x4d\x33\xd1\x91\x44\xd6\xba\x69\xee\xef\x62\x0e\x96\x0d\x38\x49\xe9\x39\xf1\xff\x60\x39\x07\xdb\xaa\x79\x47\x32\xb1\xf4\xc9\xbf\xa5\xa6\xd8\x68\x29\x71\x8c\xe8\xa1\xa0\xe4\xa4\x18\x69\xce\x1e\xd2\xd8\xe5\x67\x8b\x3f\x65\x37\x34\x00\xf8\xfc\xb7\x27\xc9\xb7\xee\xfb\x24\x5b\xa4\xe6\x33\xdc\xe6\x7e\xa6\x06\x9b\x12\x6a\x23\x1d\x2f\x0e\xca\x57\xa6\x1c\x04\x49\x66\xf0\x4f\x68\xcf\x6b\xf0\x91\x6b\x70\xb8\x98\x8f\xc3\xfe\x06\x0f\xed\x9c\x0f\x9f\x1d\x76\xe7\xe7\xf9\x74\x94\xf6\x76\xc0\x26\xa5\xd3\xca\x71\x92\x4d\xab\x4f\x7a\x00\x8f\xfa\xa6\x59\x13\xf3\xf7\x87\xc0\x77\x9a\xab\x22\x23\xbd\xca\x1a\x9b\x46\x31\x15\x0f\x3c\x2a\x08\x5f\x86\x2a\x45\x70\xf7\xea\xb3\xc9\x7b\x46\x09\x43\x53\x0a\x2c\xc4\x94\xf9\xa9\x11\xd5\x16\x0b\x00\xcc\x3e\x48\xae\xd2\x12\x5d\xb2\x10\x24\x9b\x13\xda\x81\x37\xf9\x65\x8e\xda\xf1\x49\x3a\x2c\x45\x89\xc2\x8e\xb8\xc4\x11\x96\x64\x7d\x29\x65\xd5\xaf\xcd\x9a\x93\x7a\x7f\x03\x94\x95\x7b\x6c\x3b\xed\x92\x45\x75\x38\x4e\x27\xb3\x6e\x66\x57\x96\x0c\xdf\xc9\xbd\xe4\xfe\x76\x1f\xff\x1f\x10\xaf\x2d\x88\xd5\xcd\xad\xda\x3a\x2a\xae\xaa\x0d\x99\x96\x4a\xc3\x0b\x0e\x2f\x60\x3f\x80\xa6\x45\x82\x19\x82\x4b\x67\xc7\xa5\xad\xee\xec\xb0\xa4\x81\x34\xc5\x80\xf1\xd9\x38\x90\x58\x58\x47\x37\x80\x35\xd9\x4e\x66\xe3\x25\x8a\x73\xe9\x68\x94\xb3\x10\xfb\xf0\x5b\xc1\x05\x38\xc5\x88\xd0\x6c\x03\x9b\x79\x96\x8d\x17\xe9\xbf\x27\x7f\x34\x02\x8d\x91\xaf\xb7\x8c\x64\x3d\xe8\x99\xc1\x7e\xff\xd0\x7a\x98\x02\x6d\x98\x85\x7c\x6c\xe5\x1d\x22\x73\xb8\x65\x7e\xb9\x1e\x9c\xbe\x7f\x05\x26\xe3\xd8\x62\x9c\x42\x43\xd7\xe6\xff\x6f\x1e\xaf\xb9\x29\xfc\x49\x12\x6f\x3a\x30\x08\x50\x1d\x53\x0e\x6c\x42\x69\xc6\x3f\x19\xe6\x03\x32\xf7\x86\x82\x6f\xe1\x11\x99\x59\x7f\xe2\x26\xd5\x62\x81\x6e\x52\xaf\xd5\x53\x5c\x11\x72\xbb\xb3\x79\xa1\xec\x42\xb1\xc0\x84\x0b\x75\x7f\x5b\x3a\x45\x17\x66\x33\xb3\x57\xe9\xe2\x62\xc3\x8c\x0e\x57\x09\x70\xee\xd6\x93\x01\xd8\xd4\x71\x1b\xf5\x6c\x76\x41\x5f\x9a\x5f\x0b\x0b\x3a\x51\x67\xbe\xdc\xa8\xac\xe0\xaf\x5a\xc2\xc6\xc9\x2f\x67\x55\x32\x59\xce\x50\x3d\x3a\x2d\x04\xdb\x88\xef\x56\x9a\x11\xaf\x83\x39\x5d\xe8\xdf\x08\x01\x23\x1b\xb5\xe3\xfb\xe5\x7a\xfb\x7e\xa7\xe5\x50\x40\x7d\x6c\x07\x73\x8b\x4b\x18\x14\xc6\x78\x77\xe1\xf8\xb4\x0b\x04\x58\x0b\x16\xe6\x96\x31\xf7\x9c\x0c\xfb\x34\x5f\xd8\xf5\x25\x8a\xbe\xbf\x6d\xc6\x56\xb7\x6f\x76\xe9\x69\xd3\x46\x23\x28\xbe\xb0\x0b\x93\xf1\x3b\x35\x29\x58\xf4\xb2\xed\xde\x7b\xa2\x37\xbc\xf5\x96\x47\x36\xfd\xd7\x6d\xfb\xe7\xb5\xda\x45\x1f\x8e\xf3\xe1\x27\x5e\x70\xfa\x65\x74\x3a\xd6\x3f\xfa\x95\x58\xfd\x20\x9f\x24\xdd\x58\x36\x9f\x1b\x0e\xb1\xc3\xbe\x2f\xfa\xdd\xa6\x5c\x63\x74\x47\xf5\x93\x2c\x3c\x86\xca\x7f\x5c\x26\xa8\x14\x51\xf6\xa1\xca\x0b\x95\xa6\xce\x95\xf4\xc1\xee\xc5\x09\xd0\x79\xda\x80\x9f\x82\x72\x36\x66\xdb\x94\x48\xcd\xa6\x19\x54\x46\x72\xda\x49\xe7\xec\xb7\x96\xdc\x0d\x5d\x01\xb5\x8f\xb4\x15\xc5\x29\x6b\x1c\xf9\xb0\xc4\xb2\xc6\xb1\x85\xdd\x25\x8e\x0b\xb2\xc6\x45\x79\x13\xeb\xcb\xa8\x99\x12\x5f\xd9\xa9\x7c\xe5\x9c\xf2\x99\xd5\xba\x43\xa4\x00\x53\x9c\xa8\x96\x33\xad\xdd\xa9\xd4\x73\xe2\xa0\xe1\xc4\x95\xf6\x4b\x2b\x89\x75\x79\xf8\xdd\x05\x51\x90\xca\xb4\x52\x08\x85\x42\x7b\x13\xa2\x6e\xa4\x52\xc6\xfc\xcc\xb4\x14\xed\x63\x63\x98\x8e\xc7\x38\x99\x7e\xa5\x80\x1c\x44\x7b\x2d\x84\x95\xe1\x6e\xc0\xff\x0a\x64\x48\x30\x38\xf8\x0e\xff\x51\xe1\xcd\xb1\xf1\x41\x31\xbb\xe2\x54\x08\x13\x58\xbd\x21\x0d\xfd\x28\x1f\x11\x1c\xf7\x58\x5c\xee\x90\x3f\xbb\xd3\xd1\x18\x20\x8a\x30\xc9\x69\xc9\x51\xe5\x57\x22\x14\xf6\x9d\x8a\x85\xd6\xd8\x05\x8a\xb8\x6f\x58\xff\x8d\x08\x82\x67\xa6\xb3\x28\x79\xc1\x19\xe6\xdf\xde\x61\xc3\xf6\x54\x9e\x2d\x99\x5a\x49\x8e\x5d\x15\x4f\xf1\x66\x97\x62\x6a\xa4\x6e\xa2\x2e\xb9\x53\x74\xb2\x2a\x9e\xcd\x4f\x03\xe5\x5f\x0f\x76\x17\xc8\xf3\x4c\x47\x9a\x51\xf7\x2b\x16\x7a\x55\xff\x15\xd7\x35\x39\x8c\x95\x91\x54\x6c\x7f\x15\xdb\x21\x9a\x33\xf1\x7e\x41\xcf\xc1\x85\x0b\x4e\x13\xdf\x41\xcc\xff\x9d\x0c\xaa\xbe\x89\xa4\xd3\xea\xee\x6d\x6d\xee\x0d\x82\x10\x39\xe4\x94\xc8\xfb\xbc\x67\xd8\x68\x70\x49\x55\xc0\xc3\xc3\x02\x03\x38\xd8\x19\x47\x3c\x6e\xe4\x96\xe3\xd0\x01\x9d\x92\x5a\x6e\x48\x38\xa7\x99\x24\xab\x09\x07\x62\x2f\x49\x73\xf5\x22\xd4\x53\xa8\xab\x52\x6a\x45\xcf\x7b\x52\x67\x25\xb6\xa7\x53\xa9\xf4\xb3\xb1\xdc\x2e\x14\x20\x26\xa6\x2f\x1c\xa4\x56\xe9\xa3\x86\xdf\x94\x7e\x0f\xff\x63\x24\xde\x0f\xe6\xff\x45\xfb\x4e\x86\x81\xf0\xab\x23\xfe\x4a\xed\x23\xf3\xfd\xa8\xb6\x36\x7e\xd5\xb5\xf1\x67\xfb\x88\xb9\xa1\xe1\xbb\x67\x5d\x19\xb2\x74\x6e\x78\x0d\xed\x15\xaa\x43\x01\x4f\xc7\x05\x21\x38\xbb\xbd\x12\x99\x84\x6e\xd8\x99\xd2\xf6\x05\xba\xe9\xae\x15\x39\xa6\x1c\xa2\x49\xfe\x73\xa8\x98\xc4\x6e\xbb\xa1\x47\xa7\x03\xd9\xf0\xaa\x80\xc9\xc2\x61\x8a\xbe\xcb\x3a\xe8\x1d\x61\xb8\x60\xf0\x89\xa6\x38\x2c\x3c\x4a\x11\xaf\xa5\x0d\x77\xd9\x0b\x15\x74\x3b\x7b\x7b\x83\x4e\x3f\x51\x0a\xd2\x2d\xd0\x8b\xf6\xd5\x64\x98\x53\x50\xb3\x63\xd5\x6f\x77\xd0\x7b\xec\x89\xda\x8a\x87\x08\xc6\xbc\x3e\xf0\x80\x50\xb3\x39\x79\x4c\x4f\x8b\x88\x57\xa8\xcd\xae\x42\x27\x8d\x46\x4d\x5b\x06\x6f\x41\x65\x34\xf8\xf0\x76\xe3\x43\xb1\xd5\xd4\xec\xd4\xd0\x7a\xce\x36\xdc\xb0\x22\xaa\x42\x74\x6d\x22\x2b\xa3\xa7\x7f\x2f\xd4\x33\x53\x50\x40\x5a\x09\x6d\x49\x5c\xfc\x06\x1d\x79\x50\xb3\xcb\xb8\x92\xdc\x8b\xfa\xa1\x48\x12\x74\xff\x86\xa8\x20\x8e\x18\xca\x5d\x00\x8e\x91\xb1\xc1\x3c\x41\x02\xf4\x90\x05\xe8\x86\xf3\x0e\x1e\xf4\xab\xce\x3a\x22\xcd\x04\x54\x0e\xcc\xae\xa3\x6e\x76\x15\xd0\x2b\x62\x7e\xb1\x94\x6c\x1a\xf8\xa3\x79\xf6\xfe\x57\x07\xf8\x82\x21\xea\xb0\x3b\xff\xdd\x09\x31\x72\xf3\x92\x6f\x56\xe0\xfa\x56\x50\xef\xf1\x41\x87\xd9\x93\x8a\xd7\xbf\xc0\xe1\x56\x7c\xed\xef\x99\x46\x75\x28\x9f\xfc\x69\x22\xf9\xb8\xdf\xc1\x9a\x0d\x2a\xe5\xd9\xc1\xa3\xfe\x58\x4f\xe8\x0d\x98\xfa\x30\x88\x6e\x94\x8d\xf3\x49\x66\x27\xe2\x10\x83\xc3\xf1\x79\xe8\x81\x41\xfd\x1c\x1d\x12\x6d\x84\x41\x25\x8e\x01\x95\x32\x29\xba\xbd\x9a\xd1\x8f\x46\xe6\x63\x47\x84\x99\x36\xb3\x89\x06\xc9\xde\x51\xa6\xec\x40\x9e\x3b\x01\x67\x6a\xf3\x5e\x2d\xf0\x39\xb2\xcf\x21\x1a\x38\x3d\x8c\x7a\x50\x37\x81\xe7\xe3\xc2\x89\x56\xd8\x2a\x06\xa7\xb2\x8f\x06\xf1\x6c\x6b\xb5\x5f\x3f\x57\xd7\x1b\xa8\x69\x4b\x53\xd3\xf7\x7a\xf1\x5f\x23\xe6\xe4\xcd\xc2\xe5\x70\x63\xb7\x9c\x99\xac\xea\xc6\xda\x6d\x36\xe3\x35\x07\x74\xd8\xea\xbf\xd9\x56\xdc\x72\x27\x9c\x9f\xc0\xf0\xc2\xae\xa4\x5f\x9d\x0b\x69\xaf\x04\x23\x54\x7f\x40\x63\xf0\x85\x1f\xcc\x5c\xb3\xce\x89\x5e\xe7\x1f\xe5\x1f\xe0\xbb\xb0\xa3\x17\xdd\xea\x4b\x83\x93\x5b\x3f\xfe\x9a\xe3\xeb\x06\x16\x4c\xa5\xee\x58\xab\x0a\xc1\x0c\xc2\xb7\x75\x03\x80\x84\xcc\xbc\x7a\x6a\xdc\x7b\xb7\x78\x2e\xcd\xfd\xe1\xdf\x16\x6b\xc1\x20\x21\xa6\x79\x6a\x3d\xbf\x3d\x13\xa7\x8b\x7b\x3a\x35\x33\x48\xcc\x25\xbd\xd1\xee\xb2\x91\x27\x2d\xfe\x0e\x6b\xa8\x21\xc3\xd6\x53\xa0\x99\xe2\x57\x97\x86\x8f\x19\x3b\xbe\xa6\xce\x3f\x1b\x1c\xb3\xc5\x2d\xfb\x6e\xf2\x34\x33\x4c\xa3\xe7\x99\xad\xc5\x6f\x87\x9c\x60\x04\xa9\xe5\x64\x39\x4e\x17\x2a\xfc\xc6\x5d\xff\xe0\x61\x93\x24\x80\x92\x67\xae\x81\x79\xc6\x01\x4d\xe4\xd5\x03\x6d\x39\xc7\x9e\x2e\x7a\x8f\x87\x2b\x61\xbd\x6e\x7a\xc2\x14\x5b\xf0\x10\xe7\x46\xc8\xe3\x82\x20\x3a\xe0\xd4\x29\x6d\x7d\x82\xfe\xd8\x50\x80\x44\x0c\x8c\x5b\x46\xcb\x2b\x24\x6e\xbe\xc8\xd0\x60\x91\xd8\x0c\x66\xd6\x8c\x6d\x99\x58\x50\xbc\x71\xb6\x71\x04\x87\x0c\x53\xf5\xc4\xa5\x86\x83\x33\xdf\x83\x7c\x42\x8c\xbc\x19\x56\xd5\x35\x5d\xab\x45\xae\x32\x4c\xdb\x8f\x3d\xad\x71\x14\x82\xe7\xbd\xaf\xe3\x27\x4e\x41\x6f\xb2\x8e\x03\x18\xb9\xd8\x98\x06\x57\xc6\xb5\x28\x6e\x96\x75\x83\xb7\xab\x04\x7a\x98\xf3\x02\xb5\x36\x73\xbb\x60\xe0\xa6\xa9\x72\x18\x76\x2e\x1d\x8e\xc6\xf5\xd0\xdc\xf1\x7c\xfd\x9b\xf9\x25\x81\x97\xfe\x2a\x31\xc3\x90\x25\x2d\x89\xa3\xc5\x95\x8c\xc8\x2d\xf9\x6d\x45\xe5\x1e\xcb\xbd\xd9\x05\xfd\xdd\x2f\xbf\xfc\x0d\x68\xbb\xb7\xd9\x96\x8b\x89\xdd\x62\xee\x06\xee\xb0\xf6\x01\x7f\x19\x7c\x60\x4b\xdd\xb3\x94\x72\x42\x06\x2c\xb2\x1e\x59\xc0\x25\xbf\x2e\x6c\x10\x8f\xf9\x0a\x2c\x73\x9f\x43\x96\x82\x38\x3c\x72\xd8\x60\x5e\xd9\x1b\xcc\x3d\x9c\x2d\x3f\xec\x38\xb1\xd3\x62\xbe\x38\xca\xd2\xb2\x98\x2a\xb1\x4a\xce\x28\x3f\x0b\x7f\x4c\xe2\x51\x14\x22\x6d\xa9\x46\x60\xba\x8b\xa2\x48\xc6\x86\x62\x48\xbf\xe8\xb7\x15\xe9\x04\x81\x89\x0e\xcf\xba\xa8\x3a\x35\x17\xcd\x1d\x9c\x76\xbc\xe9\x6c\x72\x9a\x8d\x80\xb4\x28\xd6\xc2\xef\x21\x68\x48\x75\xe5\xd6\xdb\x3c\x71\xb2\x0d\x3c\x2b\x2f\x2a\xb1\x6e\x46\xa6\x00\xf0\xce\xe6\xfe\xce\xe7\xd9\x88\xba\x8d\x35\xaa\xa7\xe7\x9a\x70\x0f\x9b\x28\x65\xc7\xc5\x79\xb7\xd3\x40\xee\x3b\x34\x82\xdc\x2e\xa2\x6b\x2c\xc6\xa7\xf2\x0a\x58\x9e\xa9\x22\x0b\x85\x05\x7c\x04\x46\xfb\x40\x46\xdf\x12\xe7\x61\xe2\x49\x54\xd5\xbc\x11\x01\xd5\xdc\x0b\x4f\x5a\x2d\x19\x69\xe9\x95\x63\x66\x55\x38\x29\x3e\x59\xee\x89\x5c\x62\x38\x0d\xc5\xdf\x99\xf6\xa6\x9f\x08\xef\x5a\x88\x2e\xfe\x74\x76\xed\x01\x48\x9c\xc4\x18\x2e\x02\x4e\xc4\x3f\x29\x81\x90\xe8\x26\x43\xd4\xd5\xe2\x85\xae\x11\x05\xd5\xb2\xdc\x8b\x6c\xa8\xf9\xd3\x0d\xe4\x4d\x57\x03\x44\x4e\x94\x2b\x90\xce\x93\x1f\x93\x6d\x34\xee\x79\x4a\x41\xda\x1c\xad\x63\x13\xa9\x91\xdf\x2b\xfb\xa0\x71\x0e\x59\xb0\xee\x97\x16\xfa\xd1\x30\x35\x18\x92\x85\xee\x4d\x46\xa4\x82\xff\xfc\x7c\xf2\x60\x5b\x42\xbd\x6a\xb4\x71\xd2\x87\x0e\xed\x47\xe3\xc2\x10\x51\xb0\x62\x17\x37\xf5\x3c\x57\xae\x11\xef\xa1\xca\x87\xf7\x50\xc5\xfa\x81\xde\xe1\x62\x5a\x73\x14\x8f\x91\xea\x05\x27\x0d\x0a\x38\xeb\x07\xa6\x44\x01\x34\xc6\x7b\xe6\xaf\x43\x84\xdd\x81\x9f\xfe\xed\xf8\xf0\xf5\x06\x5d\x98\xf9\xd9\x4d\x17\x3e\xf4\xea\x35\x19\x76\xc8\xca\x9d\x83\x02\xb8\xbe\x74\x78\x07\x58\x7b\xf4\x75\x86\xb7\x60\xb4\x49\xe4\x4c\x91\x27\x07\xcd\xc1\x1f\x81\x5c\xbe\x3b\xeb\x38\xa8\xe5\x4a\xf4\xa6\x3a\x87\x07\x70\xa4\x0c\x2b\xc4\x50\x73\x17\xcc\xe8\xcc\x50\x7f\x60\xf8\x01\x7a\x7c\xcc\x59\xdc\xd8\xd8\xe0\x3a\xb6\xea\x19\x47\x89\x0b\x35\xa0\xf2\x99\x47\x43\x74\x80\xe1\x83\xd0\xc3\x79\xc1\x7e\x72\x5e\xfc\x6e\x5f\x9a\xa2\xb3\xde\x41\xb5\xd0\x82\xfc\x13\x18\x57\x98\xb6\xc0\xc6\xd2\x8e\xb2\xf2\xc7\x24\xf9\x37\x70\x30\xe0\xb0\x44\x11\x2b\xdd\xb8\x50\x91\xc0\x96\x67\x34\xa1\x67\xf3\x39\x40\xbf\x74\x31\x00\x12\xc2\x10\xb7\x3a\xbd\x7e\xd2\xc5\x50\x48\xf8\xe7\x08\xff\xf9\xe6\x15\xfd\x2b\xb3\x91\x89\xd0\x58\x77\xf7\x0d\x97\x3a\x33\xbf\xa3\xf6\x16\x74\x81\xc8\x56\x07\x46\x70\x78\x99\x45\x3d\x0c\xe0\x5d\x22\x03\xd8\xa6\x5c\x14\x24\xf4\x50\x61\xae\xe3\xc4\x02\x2d\x56\x23\x89\x77\x92\x2d\x88\x25\xaf\x5e\x28\x78\x6c\x55\x50\xf9\x96\x1f\x55\x1e\x27\x26\xa6\xf3\x8d\x14\x04\x75\xb6\xfb\xbc\x77\x67\x98\x4e\xf5\x87\x40\xd2\x80\x0c\x7b\xd3\xcc\xcb\x5f\xc0\x6e\xec\xda\x77\xc8\x10\x24\x1b\x7a\xd9\x3e\x78\x59\x7c\x62\xb4\x73\xb1\xa5\x9a\x5d\x3e\x7e\xb5\x79\xf4\x4a\xca\xec\x8b\xec\x44\x49\xd2\x71\x3d\x71\xce\xc4\x76\x6e\x9b\x47\xf8\x4f\xec\x33\x93\xec\xd2\xd5\xf6\x0a\xfa\xe9\xee\xbe\x02\x95\x7a\x15\x26\x68\x83\x2a\x7e\x6b\x2a\x1e\x60\xbe\x1f\x2e\x7f\x70\xf4\xaa\xc7\xdf\x06\xd0\xea\xb1\x79\x87\x36\xd9\x0c\x64\x76\xeb\xa8\xb9\xb9\xed\x2d\x53\x65\x77\xb9\x28\x26\x88\xa3\xf7\x3a\xbb\xc2\x2c\x25\xdd\x97\xaf\x5f\x59\x51\x49\x09\x82\x70\x14\x96\x5e\x8c\x27\x4f\x0f\x94\xa1\x65\x3e\x66\x18\x21\xba\x1f\x6a\x2f\x5e\x10\x89\xcc\x4a\xbf\x0a\x8c\x4e\x43\xc1\x1e\x5c\x28\xcf\x29\xb2\x4c\x99\xeb\xe1\xdb\x8e\x87\x2b\xae\x3d\x05\x69\x3d\x5e\x91\x89\x44\xb4\x5f\x5a\xfe\x97\x36\xb6\xb7\xea\x1b\x81\x45\xd8\x4b\xe7\xf3\x3c\x3d\xcf\xc8\x91\x36\xde\x58\xcd\x45\x29\x4e\x33\xc1\x3d\xae\x97\x0a\xa9\xeb\x95\xbd\x26\xf1\x5e\x24\xea\x0d\x29\x72\xce\xf2\xa5\x22\xcd\x30\x98\x7b\x15\x31\x52\xb4\xdd\xa6\xf9\xcf\xd1\xf1\x49\x4b\xa2\x04\x12\x02\x72\x98\x41\xa0\x2f\x29\x61\xc9\x2f\x0f\x48\xd5\x08\xb7\xa6\xb1\xbd\x3f\x59\x6a\x63\x2a\x7e\x7f\xe7\x43\xf2\x2c\x2b\xcd\x9e\xc3\xd0\xde\x1e\x63\xcc\x28\xb5\xac\x03\x40\xcb\xe4\xc5\xd6\xfa\x8b\xfb\xd8\xc8\xae\x21\x2e\xba\x56\x31\x98\xf3\xae\x3b\xf8\x04\xfc\x34\xe1\x57\x9b\x7e\xbb\x0f\x7a\x9e\xfb\xdb\x09\x7b\x42\x11\xd5\xc3\x50\x0e\x5f\xea\xb1\xc0\xc1\x78\x7f\xfd\x21\x39\x9e\x14\x85\xb9\x9c\xbb\xc7\xe3\xe2\xaa\x97\x1c\xa3\x3b\x0f\x96\x3f\xde\xf3\xca\x3f\x30\xe5\x8f\x32\x4a\xb6\x42\x88\x50\x54\xe8\xb5\x2e\xf4\xd0\x14\x3a\x9c\xe7\xe7\xb9\xea\xf7\x50\x17\xf8\xce\x14\x78\x37\x4f\x67\xec\x34\x66\x0b\xed\xbe\xd3\xa5\x1e\xf1\xd8\x80\xc6\xd6\xe7\xd9\x2c\x33\x3c\x8c\x5d\xd2\xdd\x23\x5d\xf4\x7b\x5e\x52\x38\xc6\xec\x3f\xf3\xe7\xe4\x0f\xc9\xbf\x83\x6f\x01\xfb\x9c\x20\xca\x88\xad\x31\xd8\x92\x89\x5f\x00\x56\x81\x11\x8b\x4f\x0d\x9f\xd2\x9d\x5f\x5f\x2e\x5c\xb3\x74\x33\x20\x76\xe9\x53\x40\x0c\x80\xfb\x98\xb7\xb6\x9b\x2e\x16\x0f\x07\x5b\xaa\xec\x23\x1e\xc2\x1b\xb0\x3d\x60\x0a\x87\xe4\x0c\xb4\xa0\x30\xd8\x37\xcf\x9f\xab\x92\xdf\x4b\xd7\x86\x56\xd1\x52\x41\x4e\x77\x88\x55\x70\xb6\x44\xa3\xe3\x3c\x33\xfc\x19\xd6\xdc\xff\xb3\xab\xb9\x0d\xab\x8f\x03\x96\x51\x98\x12\x27\x7b\xfb\x6a\x25\xee\x6f\xc9\x4a\x40\x31\x72\xcb\x8a\xcc\xec\xfe\x03\x1e\xc3\x3e\xf2\x07\x98\x81\x74\x1d\xfd\x18\xf1\x15\xe3\xbb\xa5\xac\x54\x7b\x64\xab\x01\x81\x9e\x64\x9f\xcc\xab\x34\xcd\xaf\xdd\x0e\x9e\xec\xff\xc9\x15\xff\x16\xaf\x49\x44\x83\x78\xb4\xc5\xf4\xf8\x4a\x53\xe9\xb7\x03\x1e\x2d\xa8\x4a\xba\x86\xe1\x3d\x33\x6d\x75\xcb\x8c\x80\x1a\x32\x84\x0b\xa4\xf4\x1e\xae\x8a\x9c\x1e\x1e\xf9\x6b\x3a\x71\x47\x19\x86\x18\x63\x50\xd0\x9e\x7f\x82\x60\x58\xaf\x8f\xf6\xd4\x22\x7d\xfb\x2d\xb7\x71\x02\x5c\xf4\xa1\xa1\xd2\x14\xfc\x25\x51\xef\xe5\x0a\x29\x52\x5f\xbf\xf2\x89\xd5\x15\x7a\x28\x7b\x89\x54\xf2\xb2\x38\x3f\x27\xdb\x15\x7f\xfe\x8e\x3b\x02\xa4\xc3\x5d\x70\x57\xc0\xe3\x7e\x4c\xfb\xfb\xd4\x46\x3c\xd0\xa9\x79\xc8\x85\xf5\x4d\xf2\x29\xbb\x99\xa5\x44\x44\xaf\xf5\x25\xf2\x10\x5a\x86\x84\x0e\xe6\xee\x35\xcb\x8b\x4e\xaa\x86\xf6\x4b\x54\x22\x51\x9e\x59\xa8\xf3\xd4\xd5\x81\x68\x65\x7e\xe8\x9a\x4e\x08\x01\xb9\x92\x4b\x99\x79\x02\xbb\xd5\xf8\xe4\x9e\x6d\x6f\xa0\x66\xf7\x53\x3e\x06\x74\x0e\xdf\x29\xd8\x75\x0d\xbb\x06\xc5\xf6\x40\xb5\xf8\xaa\xe0\x97\xdb\x2b\x1b\x76\x06\x2e\x65\xae\xaf\xfb\xde\x4a\xd6\xb5\x61\x8b\x7f\xab\x2f\x84\xe7\xc5\x70\x59\x1e\x4c\x37\xf1\xbf\x87\x20\xe2\x5b\x8f\x66\x2a\xfd\xc0\xa7\xa9\xfd\x6b\x46\x3d\xa4\xd6\xd5\x8e\x0f\xb6\xf0\xe2\xe0\xfb\x11\xd4\x71\x85\x59\xba\x09\xba\x30\x2d\x6e\x40\xab\x0b\xdc\xb3\x77\x6a\x4c\x95\x41\x4d\x15\xd8\x35\x5a\xf4\xa0\xc6\x7d\xb9\x96\x9d\x4f\xd5\x37\xe0\x45\xfc\x0d\x54\xe9\x13\x59\x3b\x76\xda\x55\x0b\x4e\x35\x66\x98\x21\x56\x8c\x51\xb4\xe0\x81\x31\x74\x88\x9b\xfc\x7a\x39\x79\x09\xa6\x6d\xf6\x7c\xe3\x26\x1e\x0a\x8d\x80\x4a\x18\x51\x31\xd0\x2d\x99\x9b\x00\xe1\xd1\x94\x77\xc5\xbf\xd3\xeb\xfc\x6c\xff\xa5\x03\x33\xc9\x46\xc8\x12\xaf\x33\x05\x3f\xcb\x50\x01\xeb\x55\xfe\xbe\xd2\x17\x8c\xad\xa6\xab\x6f\xe5\xc6\x46\x17\xd4\xd2\x34\x47\xfc\x1f\xec\x25\xb0\x18\xc0\xa7\x5d\x98\x35\x19\xc3\xba\x10\x1b\x45\xf5\x06\x5c\xef\x2d\x43\xf8\x18\x22\x7e\xf3\xf4\x70\xf7\xe8\x99\x6b\xc4\x15\x0e\x6e\x97\xb7\xf3\xf3\x6c\x3a\xbc\x49\xae\x8c\x94\x64\x8e\xd9\x24\x9d\x1a\x3e\xc7\xc8\xb3\x39\xc6\xd7\x83\x0c\x4d\x8c\xf9\xfa\x0b\x50\xa0\x0a\xa2\x8b\x6b\xee\xbe\xdf\xdc\x3c\xcd\x4b\x05\x3e\xcd\xad\xb6\x69\xa8\xfd\x45\x62\x0a\xc3\x2d\x0d\x00\x0d\x02\x77\x93\x96\x1a\x9e\x81\x0b\x7d\x5f\x5f\x88\x18\xd6\xfa\x9e\x8c\x50\x60\xee\x87\x39\xc2\xe6\x28\x36\x04\x94\x93\x60\x07\xdc\x48\xba\x28\x87\x31\xac\xa5\x11\x11\x53\x74\x53\x38\xbd\x21\xa1\xc9\xdc\x13\x07\xd3\x8b\x1c\xe4\x1a\x77\xbf\x73\x56\x32\xd5\xdc\xb0\x98\x9c\x1a\xae\x9a\xac\xc2\x19\xc6\xdb\x95\xb2\x72\xb8\x22\x30\x4a\x9c\x2d\x71\x76\xbc\xc1\x39\xc1\x26\x79\x4d\x2d\x18\x0b\x71\x9d\x90\xd5\x53\x77\xc1\x96\x1e\x66\x1e\x34\x6d\x1a\x9e\xe8\x03\xff\xc0\xbe\xa8\xd9\xc2\x36\xb4\x09\x7f\x19\xa6\x33\xfb\x54\x02\x99\x07\xf5\x06\xea\x99\x3f\x5e\x4e\x9b\x8a\x6e\xab\xa2\x3f\xbd\x69\x2a\x79\x5f\x37\xba\x77\xd8\x50\xf4\xe1\x96\x2a\x3a\xce\xce\x53\x43\xc6\x12\x6f\x90\x64\x68\xb6\x81\xe3\xd3\xfd\xf3\x60\x70\xf4\xd0\x5d\x3d\x0f\x07\x6a\xba\x3f\x9f\x6c\x1b\x51\xa7\x5a\xcb\x8a\x41\x78\xcf\x42\xc9\x53\xb8\x81\x33\x60\x92\x21\x2e\x2e\xb3\x43\x81\x82\xd0\xda\x7a\x52\x8b\x99\xda\x17\x42\x61\x6b\xed\xd9\x12\x92\x0b\x60\x17\x30\xfc\xf5\x1a\x31\xac\x4e\x46\x32\x14\xbc\x52\x44\x12\xd7\xfd\xa1\x82\x65\x27\xe7\xdb\x41\x67\x87\x20\xd3\x90\x69\x67\x19\xbb\x2e\x68\xc3\x91\xd1\x9e\x04\xc0\x61\x27\xf5\x2e\xd6\xf7\x55\xf3\x86\x11\xe7\x72\x56\x40\xaa\x03\xed\xd3\x46\xdf\x8a\x08\x46\x78\xd8\x04\xb1\xf1\x23\xf2\x58\x3b\x86\xdd\xd2\x4e\xd3\x7e\x15\x3c\xbb\x3f\x15\x93\xcc\xf9\xe4\x47\x5a\xfd\xf9\x84\x5e\xac\xa3\xec\x1c\x11\xee\x0d\x5f\xda\x97\x04\xfe\x54\xe5\x73\xed\x2c\x1f\xb8\x59\x82\x64\x10\x5d\x45\xd3\x05\x33\x57\x28\x46\x28\xa9\x31\xde\xe6\x43\xd7\xe6\x61\x6d\x8b\x24\x74\x04\x22\x6d\xbc\xbd\xef\x5c\x7b\x46\xea\xa8\x6b\xd0\x09\x29\x2b\x1b\x1c\x6c\x73\x8b\x24\x19\x84\x5b\xab\x40\xc3\x7a\xf5\xab\x4e\x74\x84\xc2\xc6\xca\x0e\xb7\xd5\x32\x83\x10\x50\x37\x07\x6a\xf3\x67\xc2\x17\x5a\xd9\xea\xb7\x5b\xdc\xea\xb4\x58\x07\xfe\x21\xda\x6a\x03\xb8\xe4\x8a\x03\xf0\xed\x83\x16\xcd\x3b\xda\xb8\xc5\xfa\x3f\x54\x3b\xfa\x74\xd5\xd1\xb5\x5c\x32\xb0\x1f\xe5\x53\xcb\x33\xaf\x1c\x3f\x70\xd1\xdc\x0f\x87\x43\x14\xe2\x6e\x8f\x4e\xfb\x16\xed\xc7\xf5\xee\x47\xe2\x75\x95\xde\x4e\xce\x6c\x35\x9c\x82\x80\x80\x76\x9a\xa2\xdd\x1a\xc7\xb8\xdd\x3c\x46\xf4\x30\x9b\xa7\xe7\xe5\xaf\x1d\x27\x86\x7d\x7c\xf1\x30\x07\xb2\x94\xc0\xfd\xc6\x29\x01\xef\xa0\xc3\xe9\x21\x31\xd6\x2d\xb6\x67\x30\x68\xdb\x26\xa8\x12\x0c\xcb\xf5\xa9\xd5\xae\xdf\x7f\xd8\x82\x6e\x2d\x79\x01\xaf\x8e\x94\xc5\x08\xcf\x6d\x3a\xf8\x3e\xda\x01\xe1\x63\xd8\x87\xcb\xfd\x78\xa7\xa6\x6b\x50\x7e\xe7\x66\x27\x0d\xeb\x86\x23\x78\x77\x91\x2e\xbc\xf7\xa3\x76\xd0\xd1\x9a\xc9\x13\x55\xb1\xa1\x72\xaa\x2a\x3d\x5e\xdd\x97\x2e\x8e\x26\x5f\x5c\xa7\x8e\xab\x29\x8f\x4b\xa8\x42\xfc\x82\x09\xb7\x1a\xc2\x5a\x8b\x39\x46\x7b\xaa\x7b\x42\x57\x2d\xab\x85\xc0\xd1\xb3\x8d\xdc\x97\xdf\x79\xb1\x41\xc0\xf7\xb6\xbb\x40\x2d\xeb\xde\xea\x35\x04\x36\x9a\xdb\xad\x17\x1c\x5c\x47\x2a\x24\xd9\x22\x08\xf8\xad\x09\x35\x23\xa3\x7e\x8f\xd8\xf4\x7b\x24\x36\x6c\x34\x91\x76\x6d\xf3\xf1\x55\x5e\x31\xd1\x28\xeb\xe3\x5a\xab\xf8\xca\x7d\x49\xe3\x7a\xb0\x1c\xb0\xdf\xad\xfa\x35\x46\x9e\x6f\xc3\x3c\xf3\x22\x3d\x8d\x33\xcf\xf1\x21\xd9\xc2\x6f\xa0\x6c\xc3\xce\x06\xa1\x62\xab\xcd\x95\xcd\x7a\x78\xad\x4a\x8f\xa8\xe3\x55\xef\x81\x6e\xde\xa2\x62\x95\x17\xe9\x9c\xc4\xc0\x88\xf7\x37\x3c\x49\x61\x62\x08\x32\x5b\xa7\x94\xbc\x27\x6e\x1e\x61\x4b\xa0\x8f\x09\xf0\x59\x67\xe3\x18\x8f\x5d\x5c\x7a\xa4\x5f\x86\x9f\x26\x53\x40\x2a\x08\x28\x1a\xc3\x84\x9c\x93\xa7\xc3\xf1\x72\xc4\xc2\x68\x18\xd3\x81\x5a\x05\x9b\x42\x80\x94\x8e\x25\x7a\x6b\x63\xac\x47\xc2\xf0\xa0\x18\x0e\x02\x26\x1f\xf4\xd1\x06\x47\x51\x41\x21\x16\x30\x61\x11\x6f\x4d\x2b\x84\xef\x0b\xa5\xc5\xb2\x46\xe2\x11\x34\x62\x67\x0f\x7a\x93\xa1\x9d\xa1\x76\xd2\x23\x4b\xec\x64\x9a\x01\x56\xea\x10\x4d\xb9\x09\x86\x34\x95\xd6\x37\x20\x15\x47\xb9\x85\x85\x32\xb7\x68\xdb\xac\x8d\xa0\x15\x44\xe1\x9a\xac\xc5\x82\x85\x3c\x72\xde\xfa\x94\xb7\xe5\x0c\xb1\x06\xa7\x14\x98\xa5\x46\x9c\x4e\x6f\x78\x52\xd0\x96\x0d\xaa\x32\xec\x47\x31\xb4\xe8\xe8\x7a\x43\xcd\xb8\xcd\x6e\xd6\x6f\xa1\x05\x60\x26\xf4\xbf\x79\xc6\x23\x76\x44\x63\xbd\x04\xd1\x3b\x6e\x9f\x74\x1e\xaa\x07\x58\xb4\xa6\x1e\xc0\x13\xa2\xdb\xe0\xa4\xdf\xab\x66\x2e\x21\x2c\x5c\x37\x84\xd3\x0c\xd4\xc9\xd8\x3f\xba\x56\xbe\xef\x90\xe1\x06\x04\xdd\x05\x38\x44\x22\x68\x55\xc1\x2e\x82\x1a\x28\xde\x5b\x0a\x33\x90\xa6\x81\x02\xba\x72\xf7\x90\x32\xbc\x98\xe9\x1e\x13\x98\xb2\xb5\xf3\xdf\x7a\x94\x1f\xcc\x28\xcf\x0a\x60\xed\x25\xef\x8e\xf5\x1f\xe1\x78\x6b\x04\x00\x82\xa6\x04\xfd\xd0\xf9\x28\x9a\xf2\x1c\xbf\x7f\x7c\x02\x33\x7b\xba\xff\x32\x98\xce\xe1\x8a\x75\x47\xd7\x93\xca\xa0\xdf\x81\x72\xcc\x0c\x13\xbf\x4e\x50\x90\xa7\xd4\x00\x7e\xa2\x18\x51\x32\x05\x7d\x62\x2d\xbf\xd3\xd7\x60\x61\xe9\xbe\x7e\xfb\xd2\x5a\x6a\x8f\x9b\x2d\xb0\x86\x22\xdf\x83\xa5\x7e\xab\xf3\x41\xdd\x33\x49\x70\xd1\xec\x4f\xff\x73\x99\xcf\x6f\x92\xee\xfe\xeb\xff\xed\xdc\x65\xe7\xe9\xb4\x04\x9c\x61\xf3\x9f\xab\x6c\x8e\xae\xa4\x13\x73\xdb\xa4\xe7\x99\x3e\xac\xe2\xbd\x59\x2d\x05\x33\x47\x2c\x0d\x74\xb7\x9d\x12\x1c\x11\xaf\x7e\x1f\x60\xcd\xaf\x32\x84\x5c\x70\x17\x24\x3d\x18\xf1\x19\x3c\xc0\x19\x04\x77\xa7\x02\x42\x82\x2d\xb5\xbe\xbf\xbd\x9a\x46\xbe\xf3\x96\x41\x43\xb0\xd8\x57\x0a\x46\x07\xed\x04\x50\x8b\x4e\xcc\xea\x3e\x3d\xb6\x6b\xf4\xaa\xb8\xf4\xb0\xb9\xf9\x7a\xa2\xb4\x19\x53\x0d\x46\x25\xe8\x4b\x7d\xc9\xa4\x4e\xa8\xb1\xa9\xf5\x28\xc6\x3a\x13\xb4\xe5\x40\xa2\x13\x0e\x95\xc7\xe7\x76\x5a\x20\xa6\x2c\x50\xda\x10\x3a\xaa\x99\xdc\xa3\xd5\x93\xa3\x61\xbe\x34\x5d\x85\x0e\xd8\x3f\x15\xf3\xfc\xaf\x00\xaf\x3b\x4e\x4e\xd2\xd3\xa4\xfb\xd3\xc9\xaa\x49\xa2\x0f\xe7\xc2\x94\x35\x6c\xc3\x8c\x50\xa6\xe8\x03\x45\x74\xd1\x54\x48\xb9\x6d\x06\x35\x07\xba\x87\xd6\xa4\x06\x91\x3e\x67\xec\x95\x30\x6a\xf0\x44\xa8\x99\xdd\xf7\xab\x67\x77\x56\xcc\xcd\xe3\x3f\x32\xe3\x3f\x36\x1d\x04\x1b\xf8\x12\x9c\x1c\x9e\xa3\x51\xf3\xe5\xf3\x9e\xf7\x3e\xa2\xb3\xc0\x30\x5d\x96\xa8\xb7\x47\x6f\x08\xb4\x7e\x62\x86\x3c\xca\x20\x30\x55\xe9\xa8\x20\xed\x86\x79\x20\xad\x0b\x05\x1e\xcc\xd0\x8b\x22\x32\x83\xb4\xd5\x0c\x26\x30\xc6\x60\xec\x3f\x67\xe6\x51\x18\xca\xd6\xfc\xec\xb6\xc6\x9a\x58\x08\x60\xe2\xe5\xf3\x9a\xae\x4f\xfd\xc3\xa3\x46\xa4\x58\x1d\xb0\xfa\xd2\x02\x3d\x7f\x7e\xeb\x1e\x86\x5f\x3c\x39\xf1\xc0\x10\x2c\xb3\xee\xde\x91\x4f\x7a\x91\xb3\xc5\xc4\x55\xf8\x21\x32\x0d\xd4\x33\x5a\x3d\x3c\xab\x6d\x22\xdd\x50\x77\x2b\xf0\x1b\x02\x03\x73\x02\x06\xb8\xee\xf1\x21\xf8\x32\x7c\x4a\x13\x34\x41\xd1\x87\x2d\xb3\xf5\xc7\x83\x9e\xef\xa2\x91\xbc\x18\x04\xc9\x59\xcc\xa0\x5f\x84\x6f\x8b\x8c\x31\xab\x1d\x23\x43\x2d\x0d\x3a\x91\x11\x1d\x98\x15\x3b\x3e\xa8\x19\xd0\x56\x65\x40\x5b\xb7\x18\xd0\xd9\xaa\x01\x6d\xf9\x03\xb2\x2f\xc6\x21\xa8\xe6\x0f\x5f\xdb\xce\x6b\xd5\xe7\xf6\x18\x7a\xb0\x3f\x07\x52\xe0\xc7\xe8\xb8\x06\x83\xe6\xa7\xc0\x0d\xe3\xec\x0c\xc6\xa1\xa8\xf9\x2b\x0f\xe4\x7e\xf3\x40\xf6\xc0\x99\xd6\x3c\x48\x7b\xbb\x6e\x29\x0e\xce\x12\xbc\xf0\x46\x4b\x8a\x79\xb7\x6c\xbd\x73\x20\xd6\xee\xc4\x98\x66\x63\x32\x81\x88\xf7\x45\x36\xbe\x51\x4c\x0b\x34\x26\x3c\x6b\x76\x9d\x0d\x97\x6a\x16\x07\x0b\x02\x4c\xe2\x3b\x0d\x6d\x50\x00\xb2\xa1\xf6\x9e\xa2\x31\x18\xd4\xa2\x8e\x6d\x18\x04\x4f\x4a\xe8\x1e\x6b\x9d\x29\x21\xa0\x17\xa8\xce\x72\xfa\x15\xca\xef\x53\x01\x78\xf6\x90\x47\xc0\x40\xcf\x62\x8d\x13\x3c\x39\x36\xa2\x02\x21\x6f\x45\x3f\xa0\x39\x3a\x05\x9e\x43\x97\x07\x43\x06\xba\x88\x16\x2e\xcf\xfe\xc1\xa7\x80\xdb\xce\x8f\x9d\xe0\xc0\x83\x67\x73\xbe\x30\xeb\x6a\x0e\xd8\xdb\xa7\x75\x37\xa2\xd9\xdc\x9a\xc5\x4b\xa3\x97\x2e\xac\xa9\xe2\xbc\x48\x6a\xec\x1a\x16\xb6\xe6\xd9\x18\x9c\x36\xef\x81\x0b\x5e\x87\x0f\xa6\x9d\x4a\x89\x78\x20\xac\x02\xa2\xec\xea\x48\x04\x8e\x08\xa5\x08\x05\x96\x8d\x15\x2e\x59\x25\xba\xcc\xf4\x58\x13\x5d\x46\xed\xa9\x2e\x05\x65\x43\x46\x2a\xcd\xb7\x09\x23\x0b\xbd\xd9\x19\x6a\x44\x9a\x0a\xd0\x1a\xd0\x5c\xdf\x7d\x56\xcb\x08\x7e\x77\x56\x77\x72\x37\x93\x47\x49\x3c\xf3\x8f\x40\xb6\xe7\xf3\x68\x06\x9e\xbe\x39\x4f\x46\xfa\x00\x77\x63\x07\x2a\x03\x09\xad\xbb\x07\xaf\x9f\x59\xe2\x79\x99\x7f\x02\xce\x09\x99\x85\x3e\x49\xa4\x9f\x04\x95\xea\xcf\x96\x49\x8c\x8e\xf9\xd1\xb7\x30\x66\x4f\x14\x7c\xdf\x79\xb6\xfa\x5d\x83\xae\x22\xcf\x2e\x06\x9a\x22\x53\xd4\x7d\xbd\xff\xb2\x66\x80\xe0\xdf\x3c\x2a\x32\x40\x41\x03\x40\x2f\x7c\x61\x6b\xd8\xcf\x47\x0f\x22\xc3\xdb\xff\xb2\x67\x37\xce\xb6\x3e\x2b\xae\xa6\xcd\x6c\xab\xd8\x85\xc1\xa8\x6b\x38\xd8\xe3\x9a\xdd\x7f\xf4\x28\x32\xd4\x9f\x5a\x0d\x55\x78\x4b\xff\xc3\x79\x30\x87\x5e\x08\xd2\x4a\x3e\x87\x4c\x0f\x47\x07\x3e\x7f\xb3\x9c\xa1\xac\x50\xcf\xbd\x3c\x1a\x45\xc6\xfb\xaa\x85\x28\x43\xfd\xbe\x8c\x13\xc0\x31\x69\x8b\x88\x5b\xd8\x36\x77\xdc\xf1\xb6\x93\x2a\xd1\xb9\x04\x04\xdb\x17\xdb\xca\x25\x0d\xd6\xd5\x87\x9a\x70\xd9\x65\x14\xb4\x79\xe3\x2b\x1b\x99\x5e\x16\x99\xde\xeb\xe6\xa7\xd5\x1b\xfc\x7d\x18\xfc\xfd\xd8\xe0\xef\xff\xf6\x83\x3f\x8b\x0c\xfe\xb0\x79\xf0\xcf\xb2\xcb\x7c\x98\x39\x2c\x05\xd2\x47\x80\x9b\xbf\x7a\x64\x18\x1d\x2c\x85\xf4\x47\x2e\x30\x91\x44\x0f\x6a\x60\x5d\x1a\x70\x2e\x8f\xe6\xf1\xe5\x54\xa4\x1b\x5f\xc0\xee\xec\x71\xde\x59\x57\x12\xc6\x05\xfe\xc4\xff\xfb\xf8\x98\xf8\x12\x50\x12\x73\xa6\xa0\x32\xcb\x26\xe2\x8d\x72\x3a\xae\x21\xdd\xef\xb7\x22\xcb\xf3\xa6\xf9\x45\xab\x8d\xa5\xad\xc4\x2b\x55\xf0\xa6\xe2\xb1\x6a\x3e\xd9\xa3\xb3\xa3\x21\x8e\x37\xf3\x62\x41\xae\xd1\xbb\xf3\x2c\x35\x24\xf4\x66\xd7\x2e\xff\x4a\xaf\x0d\x99\xde\xc3\xc8\xf4\x7e\x6e\xde\xfd\x7d\x8a\x59\x09\xbb\xdf\xff\x92\xee\xbf\x8b\x74\xff\x6e\xc5\xc9\x91\xf9\x0b\xd9\x1d\x1f\x1e\xdf\xbe\xe3\xd8\x0d\xfa\xe7\x56\x47\xd6\x1d\x48\x05\x1d\xd2\x3d\xde\x3b\xe8\x13\xcf\x6a\xc8\xed\xc0\xbd\x97\x2c\x13\x9e\x48\x60\xc6\xc1\x33\x73\x04\x0e\x4f\x41\xd1\xbf\xc8\xc8\x51\xd9\x4c\x85\xf4\x94\xc9\xb0\x63\x0e\xd1\x6e\xcd\xa5\xff\x7d\x1a\x19\xf2\xff\x59\x7d\x89\xfa\xe8\x71\x84\x9e\xf7\xe3\xe0\xf1\xf6\x30\x60\x17\x9b\x90\x51\xba\x7b\xc7\x07\x5e\x18\x3a\x20\x07\x10\xe6\xcd\x04\x32\xf6\x55\x92\x4a\x27\x0e\x30\xa5\x66\x36\xa7\x91\xd9\xbc\xff\x55\xe7\x2a\x0e\x69\x20\xc1\xc1\x35\x00\x06\xf2\xb9\xe9\x50\x02\x4c\x4b\x70\x04\x23\x81\xfc\x2e\xf6\x84\x23\xa8\xac\xa8\x03\x37\xe0\xe6\xe1\xf1\xde\xe6\x9b\x57\x9b\x90\xfb\x6d\x58\x4c\x26\x29\xb8\x0b\x93\x8a\xcc\xea\xa5\x05\x46\x4c\x6b\xa4\x91\xa8\x25\xb7\x99\xe4\x8d\x95\xe0\x2c\xc3\xe6\x51\x98\x18\x98\x0a\x7d\x0b\x81\xd7\x7f\x21\xba\xab\x70\x83\x10\x7f\xad\xe1\xe2\xe9\x70\xde\xbc\x9a\x3d\x1c\x46\xf6\xf0\x97\x5f\x9a\x4f\x51\x44\x65\x8e\xab\x81\x61\x61\x76\x0d\xf7\x64\x89\xe6\xd9\x98\x4a\xb3\xf6\xa4\xb0\xd5\x29\x7d\x61\xcd\xc8\x62\x0c\xc7\x87\x5f\x41\x5d\x15\x39\xe5\x30\x2a\xa7\x38\xdf\x80\x86\x45\xd5\xf5\x3c\xa8\x13\x85\xef\x60\xc5\x67\xc0\x18\xf5\x03\x6f\x75\x10\x99\xb5\x71\x36\x09\x2a\xb0\xae\xba\x9b\x77\x36\xde\x6f\x04\x6c\x9b\x60\x10\x28\xdc\x8a\x9b\x6c\xd1\xd0\x97\x6d\x02\xaa\x6f\x58\xf9\x0c\x70\x9e\x2b\xf1\xfb\x10\xac\x8c\x59\x65\xbb\x9b\xff\xb7\xfb\xcb\xe8\x5e\xef\x71\x77\xe3\x6e\xef\xff\xdb\x64\xab\x25\xc5\x34\xdf\xb8\xe1\x55\xab\x9b\x36\x4d\x89\xf7\xdb\x1f\x1e\x6b\x9b\xac\x13\xdf\x0e\x51\x7c\x83\x22\x83\x0f\x11\x04\xad\xc0\xca\x1c\xc4\xf9\x4d\x8d\xec\x93\x8f\xc0\x96\x13\x0d\x03\xad\x8e\xa6\x67\x61\x71\x56\x88\x74\x87\x81\x48\x87\xc6\xdb\xe1\x4d\xf2\x8a\x4d\x0b\xdd\x37\xaf\x6e\xff\x68\xc5\xf8\xcc\xff\xfb\x8f\xe4\x45\x74\xb0\x04\xe7\xa4\xb7\xef\x08\x04\x70\xde\x7e\x8a\x31\x6e\xf4\xe3\x3f\x72\x8a\x08\xce\x72\x8d\x31\x87\x6f\xa7\xe8\xc2\x80\x99\x7c\x11\x49\x9a\xa0\x02\x4b\x48\x35\x09\xae\x8f\x29\xfa\xd3\x1a\x19\x18\x9c\xfd\x6e\xac\xf5\x68\x25\x63\xce\xa1\x6c\xb6\xa7\xe7\xe8\xd6\x8b\x32\xc0\x77\x28\xcb\x7b\xe9\xa7\x55\xd0\x5c\x69\xde\x9d\xef\xf6\x06\x27\xe2\x40\x6c\x5b\x78\xe1\x5a\x78\xb4\xb2\x85\x47\xaa\x05\xef\xcf\xeb\xa7\x88\x60\xee\xc6\x9c\x96\xa0\x71\x49\xb0\x4f\xc3\xec\x5c\xa5\x37\x65\xfd\x06\x87\xb3\x7a\xc9\xce\xca\x18\x52\x68\xce\x21\xa2\xa6\xc1\x15\x37\x36\x52\xde\x38\x19\x84\x73\x78\xd5\x5c\x7e\x3b\x2c\xff\xba\xb9\xfc\xfd\xaa\x21\x1a\x08\x6e\x7b\xab\x35\x71\x31\xf5\xd4\x16\x6d\xa5\xa6\x6a\xe7\x0c\xd2\xe4\x0a\x22\x4f\xc3\x0e\x4e\x7d\x0b\xa6\x8e\xbe\x20\x17\x6d\x01\xd4\xf0\xe6\xd2\xda\xa6\xfd\x3d\x62\x40\x7f\xd7\xa9\x5a\x80\x29\x29\x81\x26\xd1\xdf\x61\x68\x20\x54\xe2\xb0\x84\xdd\xb1\x79\xe3\x31\xf6\xeb\x04\x84\x2b\x8c\x0f\x7c\xf9\xba\x4a\x51\xcf\x0d\x89\x94\x41\xe4\x36\x99\xbf\x3b\xc0\x8f\x20\xdb\x34\xce\x4f\xcd\xfb\x0e\x49\x92\x4f\x6f\x92\xcb\x05\x40\x46\x59\x89\x92\xec\xc3\xde\x48\xee\xf3\x48\x46\xc5\xd2\x48\x70\xeb\x17\x18\x96\x93\x90\xea\x67\x51\x00\x86\xf7\xf8\x0c\x07\xf4\xec\xa7\x97\xfa\x90\xfc\x0e\x43\x2f\xeb\x6a\x72\x8c\x50\x7d\xe5\x07\x5c\x99\xfc\x55\xd6\x31\xf7\x3b\xd9\xd8\x30\x1e\xf3\x5d\x50\xfc\xa1\xdf\x57\x50\xfc\xd9\xbb\x8a\x92\x0f\x69\xf3\x77\xff\x18\xc2\x64\xf5\xe9\x23\xab\x3b\x0d\x6c\x60\x66\x13\xbb\x66\xc7\x44\x43\x7a\x6b\x6a\x43\x4a\xfb\xbd\xa2\xb4\x7e\x60\xd0\x61\xc5\xa5\xa1\x88\xd5\xd2\x3f\xda\x00\xf4\xe1\xe8\xaa\xf2\x44\x2f\x3d\x45\x30\xbf\x4f\xfe\x17\x5f\x12\x07\xc7\x87\xc9\xa3\x47\x0f\xbe\x5f\x1f\x54\x14\xf6\xae\xf0\x0b\x2e\x4c\x98\xb9\x95\x72\xf8\x00\x42\x8a\x72\xf4\x88\xa0\xad\xf6\xfd\x22\xb2\xe1\x45\x51\x85\x8c\x5d\x61\xaa\x89\xd1\xc2\xef\xff\x61\xb4\x70\x47\x43\x47\xc2\x3f\x5e\x74\x2c\xbe\xf4\x2d\x91\x41\x68\x51\x45\xba\x89\xe3\x6e\x5c\xf4\xbe\xf4\x16\xf3\xf5\x64\xc7\x36\x42\xcd\x48\xe6\x4e\x3d\x40\x3b\xdb\x4d\xde\x94\xbc\xb5\x15\x73\x62\x17\xc3\xb9\xf5\xf9\xed\xa9\xd2\xa1\x35\xb4\x8b\x31\x3a\xff\x3f\x7b\x6f\xda\xe5\x28\x92\x24\x8a\x7e\xaf\x5f\xa1\xa9\x3b\xe7\x45\x64\x2b\x33\x05\x08\x6d\x9d\x5d\x5d\x0d\x08\x6d\x68\x47\x48\x82\xea\xba\x7d\xd9\x84\x90\x40\x20\x40\xeb\x4c\xcf\x6f\x7f\xbe\x80\x84\xb6\x50\x44\x56\xd5\xdc\x9e\x77\x5e\xe4\xd1\xc9\x08\x64\x98\x9b\x9b\x9b\x9b\x9b\xb9\x9b\x9b\xa5\xa1\xff\x94\x82\xa6\x9e\x42\x67\x53\xd0\xf9\xa7\xd0\x5f\xde\xa6\x24\x7f\x49\xf7\xd7\xb7\x29\xb9\x82\xce\xbd\x4d\x49\x02\x0d\x5f\x18\x9f\x2f\xe2\xf7\x91\x9c\xc7\x33\x8c\x48\x96\x85\xf8\xe2\xe3\x79\x44\xa0\x7b\x87\x76\xea\xab\x81\xba\x43\xae\xdf\x69\xa6\x31\xc8\xae\xb2\xe1\xdc\x15\xc0\x37\x06\xd0\xbb\xaf\xd2\xe9\x16\x33\x7b\xfe\x16\xc9\x02\x30\x57\xe2\xdb\xfa\x09\x04\xd2\xe3\x1b\xe0\x09\xc4\x7f\x73\x30\xe8\x01\xea\xe7\x9a\xbd\x5a\xd9\x61\xf2\x78\x08\x9f\xc0\xe0\xb7\xe4\xc1\xe0\xf4\x00\x9e\x72\xaa\x86\xad\x26\xf7\xaa\x04\xf0\x4d\xdd\x84\xb6\x43\xfc\x40\x86\xe9\x2b\x22\xe0\x28\x9c\x9e\xf0\xb0\x91\x22\xba\x56\x15\xec\x4c\x0b\x7c\x91\xab\xaa\xa9\xd6\x14\xc8\x49\x3f\xfd\xa4\x01\xdf\x80\xd7\x08\xc5\x9d\x69\x9c\x1f\xff\x84\x9e\xd8\x61\x78\xab\x4f\xfe\x20\x4d\xf2\x7a\xc7\xbe\xfe\x74\xe7\xd9\x9f\xee\x3c\xcb\xde\x79\xf6\xe5\xce\xb3\xaf\x77\x9e\xe5\x1e\x69\x30\x9c\xe3\xe4\xbf\x65\x4d\x8b\xb3\x9f\xdd\xf1\x35\x1f\x27\x04\xbd\x21\xea\xf5\x2a\xc3\xd7\x8d\x1b\x0e\xd3\x06\xaf\xde\xa8\x42\xf5\xe9\x22\xbb\xe8\x29\xcf\xc7\xeb\xcb\x4d\x24\xf6\xb3\xaa\x5a\xfa\xfc\xd7\xab\x60\xea\x0b\x8c\x9f\x5e\x60\xd1\xa3\xd3\x9f\x5f\xee\x34\xf0\xa4\x12\xd7\x93\x06\xfe\x74\xd9\xc0\xd7\x3b\x0d\x3c\xa9\xde\xf5\xa4\x81\xec\x65\x03\xb9\x3b\x0d\x3c\xa9\xf8\x95\x6e\xe0\x87\xab\x66\xde\xce\x8a\x72\x95\x49\x2e\xd9\x2a\xb8\xd4\x8c\x50\x07\xfe\x98\x44\x62\xc3\x94\x52\x3f\xfe\xf9\xd2\x18\xbf\xcd\xf9\xf6\xbe\xd5\x0c\x46\xeb\x25\xc7\x6d\xf0\x4a\xd5\x79\xf7\x75\x3c\xa2\x29\x1c\xed\xbc\xf1\x9f\xd9\x48\xd7\x93\xbf\xf8\x64\x83\x1b\x5e\x3e\x48\x25\xb7\xb8\x3d\xd2\x47\x58\x1e\xc7\x20\xde\xbb\x3a\x70\x59\x56\x18\x15\xdf\x7b\xde\xc4\xe3\x48\xc0\x07\x01\xff\xff\xbc\x08\x03\x83\x41\x74\x29\xee\xd5\xd2\xdc\xa3\xc8\xef\xe5\x5e\xe5\x6d\xee\x3d\x48\x1c\xd1\x67\x6e\xe2\xe9\x10\xb6\x9f\x9e\xef\xdc\xdf\xbb\xeb\x2a\x60\xcc\x3f\xdd\xa6\x9f\xeb\x42\x7f\xd7\xb9\x68\xfa\x36\x94\x0f\x35\xfd\xd7\xdf\xd8\x74\x9c\xce\x2f\x6d\x7c\x9d\x22\xdc\x60\xfc\x72\x80\x63\xdc\x74\x2f\x58\xe1\x8a\x62\x38\xa5\xca\xdb\x7b\x41\x3f\x24\xc1\x8c\x76\xbc\x8d\x1d\x98\xba\x67\xad\xec\x23\x0e\x6f\xc6\x71\xb8\xbb\xa4\xd6\xc2\xdc\x6f\xc3\x86\x60\x3b\xec\xc6\x82\xc5\x5c\xd4\xf3\x7d\xf6\x0c\xbe\xcb\x1e\x9b\xe9\xd7\xbd\xaf\xbd\x3d\x8c\x35\x18\xa1\x8c\x0b\x60\xbf\x0e\x9b\x37\x27\xf0\x08\xc5\xe3\x58\xc1\x54\x5e\xfc\xeb\xa3\xec\xf8\x8b\x14\xd7\x3a\xa6\xeb\x05\x07\x94\xd6\x2c\xb7\x59\xc1\xff\xde\xbd\x5d\x86\xc8\x70\xee\xac\xb3\xee\xdb\xbd\x4b\xc5\xd7\x51\x30\xbe\x0e\x5e\x87\x4d\x87\xd7\xa1\xc8\xa7\xeb\x13\x73\x35\xbc\x0d\xb1\x43\x8d\xad\x9e\xc5\xd7\x51\x97\xf1\x75\xa9\xd6\xf3\xb0\xf5\xfc\xbd\xd6\xaf\x8f\xbc\x1f\xb6\xee\x3d\x6b\x3d\xff\xb0\x75\xea\x73\x66\x88\x1c\x7e\x48\xc4\xf0\xbd\x54\x0c\xef\x51\xf1\x9f\x8f\xa9\x18\x7e\x80\x0a\xea\x2e\x15\xf7\x46\xe2\x2e\x15\xff\x7c\x46\xc5\xe3\x91\x20\x53\x54\x90\x77\xa9\x20\xdf\x4b\xc5\x7f\x3d\xa3\xe2\x2a\x00\x14\xdf\x5c\xce\xd8\x3a\xbc\xe4\xa0\xba\xf8\x5a\x49\x9c\x97\x23\xb2\x23\xc7\x4c\x9d\x80\x21\x9d\x80\xd3\x42\xa7\xd3\x77\x9c\xc0\x2e\xef\x3a\xa0\x22\xa2\x6f\xd9\x8f\x77\x2e\xf2\x43\x7c\x23\x88\xee\xde\xbe\xff\x3d\xba\x9f\x91\x40\x5d\xce\xc5\x84\xac\x8b\xc4\x69\xb9\x00\x9e\xa4\xea\x9e\x03\xd4\xa7\xaf\x3a\x66\x14\xdd\x45\x45\x3f\x8d\x63\x64\x60\xfe\x64\x1d\xd6\xa5\x80\x17\x7f\xc2\xf3\x6d\xaa\x17\x94\xb4\x97\xfc\x16\x58\x1a\x99\xf9\xfa\xf5\x6b\xe6\x1b\x7a\xd0\x85\x0f\xba\x2f\xa9\x82\x1f\x38\x39\x6c\x08\xf4\xfd\x29\x9c\x3d\x34\x5d\x1b\xd2\xb6\x8a\x13\x4a\xc2\xb3\x37\xc8\xfe\x00\xd6\xa0\xcc\xe0\xf4\xdd\x76\x70\x2a\x13\x79\x3f\x87\x33\x3c\x03\x42\x58\x5f\x61\x99\x06\xb4\x6f\x84\xaa\x68\x81\x37\x39\x54\x84\x3d\x55\x6f\x3e\x9d\x2a\x3f\x87\x8a\xcf\xc5\x86\x3e\x64\x50\x1f\xf3\x27\xd9\xc1\x4f\x47\x2f\xdd\x16\x2b\x4e\xbd\x90\x20\x49\x36\xbd\x99\x20\x50\xe1\x59\xd5\x2f\x38\x99\x30\x34\xe2\x5e\x13\x8a\xba\xf8\xae\x0d\x2c\x31\x9a\xfe\xfb\x2f\x67\x72\xbf\x65\xb2\xd9\xf3\x37\x17\xde\x08\x6c\x13\x9b\x1d\x57\x5d\xfa\x25\x85\xea\x4f\x19\x2a\xc9\x12\x7c\x7a\x09\xb9\xd4\xe8\xa4\xeb\x06\x16\xde\xdf\x4c\x27\x3d\x4e\x35\xf2\xd7\x9f\x2e\xf8\x92\xa4\x10\x3e\x9b\xaf\x91\xbd\xda\x98\xd7\xef\xc6\x6d\xa1\x7a\x02\x17\xe7\x82\xb0\xbe\x80\x6b\xaa\xab\x10\x65\xff\xc5\x65\x4b\x03\x7c\x23\x1d\xa7\x61\x4f\x45\xaa\x63\x81\x4d\x95\xf7\xcf\x5c\x76\x04\xd6\xa3\x42\x0f\xc0\x92\x68\x69\x23\x6f\x4a\x92\xaf\x69\x5a\x7f\x39\x77\xe3\x9c\x32\xf9\x92\xc4\xf3\xc5\xc8\x8b\x71\xc3\xf5\x29\x52\x5c\xc8\xc2\xea\x1f\xc8\x04\x3f\xbd\x79\xca\xbe\x71\xe6\x41\xca\x18\x7f\x44\xe8\x9e\x24\x47\x1e\x27\x8a\xaf\x17\x98\x1e\x13\xf6\xa8\x3f\x99\x9f\x52\x4d\xe0\xa0\xde\x1f\x2e\x8b\xfc\xe1\x8e\xa4\x87\xeb\x69\xc8\xc6\xaf\x34\xea\xe4\x25\x86\x85\x67\xaf\xd0\xa4\x82\x4c\xc0\xe9\x4c\x6f\x52\x85\xa6\xee\xbd\x84\x73\xd5\x3f\xa9\xd4\x73\x91\x13\xfb\x9c\x31\x35\x8e\xaa\x4e\x72\xc1\xc0\xe8\x94\x1f\xe3\x32\xc7\xf0\xdd\x9f\xf0\x4d\xb4\x1f\x3f\xc7\x87\x5f\xf1\xc5\x34\x6c\x6e\xe1\xc4\x8f\x7f\x3e\xed\xb4\xc1\xed\x20\x16\x1a\x35\xf8\x4f\x98\xd9\xa6\xf9\x85\x35\x55\x17\xff\x8d\x72\x92\x01\x7e\x05\x70\x23\xfc\xca\xfe\x53\xd1\x99\x15\xca\x8b\x6b\x98\x5f\xe0\x5d\x49\x0f\x5e\x2c\xc4\x55\x2c\xe3\x22\xba\xd8\x2c\xb4\xe1\xb1\x1d\xc0\x05\xd5\x93\x10\xfb\x6b\x28\xb4\x01\xa2\xc3\xb5\xd7\x90\x97\x21\x89\xc3\xd4\x45\x02\xe4\xc9\x61\xe2\xe3\x4a\x63\x49\x5d\xf0\xdb\x5b\x42\xb8\x02\xd5\x89\x75\xd7\x8a\xb9\xf0\x64\x9d\x79\x5b\x2d\xc6\x47\xe3\x69\x16\xbf\x7e\xfd\x94\xb3\x91\xdc\x9d\xd2\xde\xdf\x4f\xd4\xc9\xa1\x09\x0a\x8d\x44\x5c\x10\x01\xde\xf0\x2b\x10\xa8\x31\xec\x84\xde\x5d\xc5\x2e\x37\x2e\x90\x64\x26\xf9\x78\xe2\x04\xeb\x37\x29\x79\xee\x9e\x03\x9c\xa2\x5e\x11\xd5\xaf\x98\x29\xa3\xcb\x78\x57\xf4\xd5\x57\x96\x07\x1e\xd0\xe3\xcb\xef\xd4\x6f\x6e\x40\xea\x56\xf9\x61\xbb\xd9\xe5\xdf\x73\x11\xfb\xbb\x7b\xd1\xee\x71\xc2\xdd\xd4\xa7\x78\x05\xc7\xd1\x28\x30\xc5\x87\x8f\x1d\xa7\x1f\x92\xf8\x2f\x18\x28\x15\x5e\x1a\xf3\xf0\x06\xee\x06\xa5\x3c\x0d\x4d\xd0\x88\x1d\xa1\x4b\xd9\x28\x74\x11\xe7\xc5\x82\x05\xea\xc0\x30\xb9\x1e\x0c\xa0\xf4\x7d\x88\x08\x5d\x16\x86\x73\x23\x2e\xe3\xac\xc1\x8c\xa1\xbb\xc0\x8e\x2f\xe3\x22\x22\x62\x91\x3d\x11\x01\xb0\x42\x19\x81\x37\xac\x81\x1e\x84\xc7\x6a\x08\x13\x8c\x35\x42\xa5\x4a\x0e\xb0\x16\x77\x08\xbe\xbe\xba\xbf\x7c\x46\x60\xa8\x91\xfa\x3d\xb5\x3e\x21\xa6\x87\x55\x1c\xf1\xc4\xa1\x7e\x83\x49\x73\x22\xf0\x9b\x56\xa4\xbf\x40\x22\x4f\x86\x4c\xe6\xb2\x07\x18\x93\x9f\x56\x76\x49\x7c\x14\x4e\x40\x17\x07\x61\xc5\x77\xbf\xa7\xe7\x37\xd1\x5d\x6d\xd5\x30\x50\xe6\xd2\x0c\x8c\xfe\xd3\xe3\xaa\xdc\xe7\x84\xd9\xb0\x24\xa0\x15\xc7\x23\xa1\xb3\xcc\x29\x2a\x28\x82\x6a\x4b\x43\x7c\x2e\xd0\x41\xb8\x00\x4c\x08\xda\x7f\x6e\x26\x25\xa1\x32\xbf\xe8\x7e\x48\x90\x54\x9e\x2e\x14\x4b\xbf\xfe\x09\xc5\xcc\xe4\xae\x74\xc2\xc5\x4c\x8e\x11\xa3\xd1\xfa\x29\xb6\x4b\xbf\xaa\x91\xa7\x9d\x26\x75\xf2\x32\x04\xb9\xb7\xe4\xe8\x9e\x7f\x88\x03\x21\x3c\x2e\x61\xc1\x45\x59\x55\xf4\xe6\x75\xd1\x59\x94\xd4\xf9\x55\x73\xd4\xd5\xf2\x53\xfa\xaa\xc1\x6b\x93\x6b\xdc\xc4\x31\x8a\xcd\x5f\x5e\xfe\xf6\x11\xb3\xdc\x46\xf8\x45\x78\x6b\x35\x6d\x93\xdb\xa0\x53\xb8\x64\xde\xa7\x7b\xbb\x10\x92\x9f\x79\xe5\x24\xe9\x6e\xf3\xcc\x47\x9a\xc7\xf3\x5f\xf2\x3f\xd0\x36\x0c\xf1\x87\xad\x57\xef\xb6\xce\x7e\xbc\x75\x74\x67\xe0\xfd\xed\x27\x9b\x5f\x80\x84\xda\x5d\x12\xb8\x8f\x93\x80\xbc\xc3\x0f\xd0\x00\xf7\x2e\x13\x22\xd8\xbb\x44\x54\x3f\x4e\x04\xba\xf2\xfb\x7e\x1a\x52\x97\x43\xb8\x6e\xfb\xd3\xf5\x06\x93\x03\x2f\x89\xa4\x86\xec\x33\xaa\xa8\xe3\x5f\x58\x4b\xb0\x16\xf7\x29\x5f\x03\xba\xad\xbf\x3a\x67\x8f\x84\xc8\xd0\x09\xbe\x0a\xad\x65\x9c\xb8\xf6\xba\x97\xfc\xef\x3c\xda\x1f\xbc\xef\x19\x77\xaf\x0f\x75\x33\x52\xd6\x31\x3b\xfa\x6f\xb3\x43\xf2\xff\x10\x66\xd4\x7e\xd7\x89\xf7\x7d\xac\x38\xef\x62\x30\x30\x00\x1b\x5d\x8c\xe3\x1a\xb7\xf1\xd6\x90\xde\xfa\x07\xb7\x0f\x2e\x9a\xbf\x4b\x36\x4c\xc1\x7c\x7f\x84\xe2\x4b\x53\x70\xbe\xf4\xef\x12\xd3\xf8\x2e\x62\x12\xbc\x8f\xc9\xb9\x57\xe8\xe6\xfa\xe7\xfa\x65\xf2\xcd\xbe\x24\xfa\x27\x75\x97\x09\xb0\x78\x74\xb7\x57\xcd\xe7\x96\xb3\x9e\xde\x1f\xb8\xee\x01\x14\x83\x04\x00\xba\x71\xb3\xaf\xba\xa3\xba\xfe\x2b\x7a\xf6\x19\xee\x6b\xdd\xa4\x1e\x33\xcd\x95\x68\x1f\x81\x05\x0d\x43\x70\x10\x82\x93\xf3\x6f\x63\x9f\xdf\x06\xae\xbe\x8e\xdd\x7c\x3b\x9b\xbd\x9f\x79\xff\xf6\x9a\xfe\x95\x55\xc8\x07\xd0\xb4\x85\xc9\x9b\xf0\xf5\xd4\xcc\x2b\x5f\xfd\x8c\xd3\xdb\xdf\x5f\x18\x5a\x97\x3b\xb9\xe8\xd9\xcf\xad\xf7\x1c\x99\xc6\xf6\xc4\x5d\x73\xe2\xa2\x78\x16\x3c\x49\x43\x80\xa8\x7a\xe3\x55\x21\xc0\x53\xd7\x4c\x48\x39\x0b\xef\x01\xbe\x5e\x17\x11\x48\x5e\x26\x1f\xd4\x23\x40\xaf\x32\x9a\x97\x64\x8c\xba\xf3\x2a\xf5\xe0\xd5\x54\x66\xa8\x3b\x6f\xe5\x2f\x8b\x95\x9a\xf1\x59\x80\xe1\xe9\x21\x30\xab\x0e\x38\x13\x0e\xde\xb8\xf8\x11\x73\x1e\x1d\x12\xe1\xbb\x7e\x3f\x26\xf5\x8c\x5e\x80\x21\x06\x93\x75\xe0\x34\x58\x09\x3a\x74\x73\x37\x1e\xa4\x10\x5a\x78\x99\x25\x30\x76\x4f\xe1\xd0\x71\x06\x77\xe8\x00\x9a\xa6\x1b\x66\x82\x4d\x92\x1b\xea\x71\x07\xee\x0a\x02\x8e\xf6\x82\x65\x47\x90\x14\xdc\x5e\xeb\x84\x23\x2e\xdc\x93\x02\xe1\xbf\x41\x0a\xee\x0c\xe4\xc8\xc3\xcb\xfe\x1b\x52\xf0\xc6\xbb\x68\xb5\xfe\xa8\x14\xa0\x77\xe1\x22\x75\x87\x91\xb1\xa5\xd9\x46\x29\x89\x5f\x9b\xf7\xf9\xd7\xfe\xb8\x6d\x89\x10\xbe\xc7\xae\x88\xaf\xe4\xc6\x04\x54\xef\x13\xd0\xf9\x08\x01\x06\xc2\xf8\x51\x02\xb8\x94\x8d\x5d\x8d\x6d\xec\xd3\x52\x1e\x5f\x2c\xc1\x37\xd5\xc3\x53\x42\x12\xb4\x0d\x86\x6a\xf2\xc0\xf3\xb2\xcf\xe7\x1c\x4d\xea\xc5\x1a\x9f\x5c\xde\xbd\xd7\xb3\x27\x37\xde\xee\xf5\x0c\x52\xfa\xae\x9e\xc5\xc9\xd9\xa1\xd9\x2e\xde\xb7\xda\xc5\x8f\xb4\xbe\x8d\x30\xc2\xf7\xd9\xed\x71\xe3\xd8\x6e\x17\xb1\x76\xce\x30\xf0\x1e\xd7\x4b\x73\x05\xd8\x01\xf7\xbb\x4f\x89\xcd\xe3\x3c\x9e\x51\x9c\xf0\xfe\xe5\x6e\x95\x1a\xac\x8f\x40\xd3\x37\x21\xee\xb0\x2b\xa3\xb7\xbb\x72\x75\x8f\x23\xbd\x1d\xfe\x97\x9f\x32\xe4\x3d\xcf\x2d\xe9\xef\x7b\x3d\x85\xe1\xb9\x4c\x4b\x9c\x02\x6b\x06\xbc\xd5\x0d\x70\x73\x13\x27\x18\x1d\x68\xe0\xbc\xde\xd7\xb5\x37\x93\x1d\xdf\x54\x34\xdd\x2f\x99\xbf\xc2\x38\xb0\xd1\x0f\x99\xd4\x31\xb4\x73\xf8\x9c\xf9\x11\x9d\x79\xfe\x98\x64\x87\x8a\x0b\x4c\xe3\xb6\xbe\xc2\x14\x0f\x90\x4d\x38\x58\x1e\xed\x68\xc4\x70\x89\x45\xa9\x6a\xb0\xa8\xc1\xe1\x5c\xb9\xf4\x44\x26\xca\x61\xe7\xfa\xb8\xf4\xaf\x0a\xde\x9b\xa1\x7d\x86\xe8\x44\x65\x72\x4b\x16\x75\x04\xe2\x72\xe3\xb8\x77\x80\xeb\x22\x24\x1f\xd0\x8d\xcb\xca\xa4\x43\xd8\x3c\x5c\x0b\x0b\xb4\x88\x1d\xe9\x1c\x3a\x9f\x72\x54\x0d\x68\xb2\xcc\x06\xdd\x95\x99\x9b\x7b\x15\xb8\xc5\xb6\xab\x26\x25\x2b\xc8\xf3\x9b\xeb\x8d\x19\x1c\x3e\xf2\x2e\xf5\xce\x56\x51\x1c\x6a\xfc\x4e\xfe\xdd\xed\x9d\xde\x7a\xd7\xc1\x32\x12\xd2\xbf\x8e\x9e\xdc\x00\x45\xcb\x5a\x5a\x15\xf1\x0f\xdc\xfd\xe9\x47\x66\xee\xc5\xc2\xf3\x1d\xfe\xe6\x85\xd1\xc9\xde\x37\x3a\x95\xff\xa9\x46\xa7\x16\xf7\xf2\xb1\xd5\x79\x76\x6f\x4e\x1e\xc5\xd9\xcf\x69\xf4\xef\xfb\x39\xff\xe7\xbf\xc1\xcf\x19\xe2\xea\x41\xe8\xb8\xf0\xe4\x8d\x5a\x81\xea\xcf\x6d\xfd\xa2\xf4\xf3\xc7\xee\xaf\x43\xf2\xb5\x27\x11\x4d\xa8\x30\x06\xbe\xad\x7e\x3e\x1e\xcc\xbc\xf6\x03\x30\xfd\xc0\xa4\xa9\x9e\xaf\x2c\x5f\xc6\x50\x26\x9e\x31\x20\xce\xc0\x9b\x9e\x68\xc3\x30\xae\x13\x9c\x79\xc1\x45\x9f\xd0\x96\x1f\x83\x6b\x4e\x1a\xb8\x22\x13\x44\xd5\xf3\x21\x2f\x5f\xb0\xe5\x69\x47\x49\x86\x7d\xa4\x6b\x75\x2f\x08\x50\x91\xe4\x18\x9d\x1a\xa7\xf9\x3f\xd5\xc1\xf2\xd0\x36\xe3\x9f\xe0\x36\x22\x8c\xb5\xc7\x79\x66\xe0\x1e\xeb\x43\xbe\xbc\xa0\xc5\xe6\x4e\xfe\xc2\x9b\x40\x95\x7b\xab\xcd\xbf\xdd\xb9\x72\x07\x8c\xc4\x7b\x17\xf1\xde\xb0\x19\xdf\xbc\x64\x7c\xb3\x67\x7e\x7f\x50\x44\x13\xe8\x2e\xe3\xb7\x0f\xcb\xcb\x1d\xbe\x43\x54\xef\x62\xfd\x05\xdf\xd1\x88\x5d\x32\x1e\x22\x7a\x1f\xef\xff\xfa\x84\xf9\xcf\x19\xf8\x57\xe2\x1b\x55\x28\x7e\x23\xae\x6f\x6a\xa3\x8d\x9c\x3b\x73\x7c\xfc\x60\x8e\x1b\x1f\x9c\xe3\x09\x46\x3c\xd7\x87\xc0\x17\x7c\xe7\x44\x4f\x25\x33\x81\x66\xe8\x29\xeb\xdb\x79\x87\xa3\x31\xee\x9f\xd3\x5c\xa0\x88\x8f\xf0\xfd\xdb\x20\x57\x39\x6f\x92\xad\x91\x54\xe2\x2c\x55\xcb\x70\xe8\x8a\xde\xeb\x88\xbd\xcd\x47\x04\xe1\xad\x3f\x6e\x46\xc0\x7a\xf6\xf8\x7e\x60\x9c\x21\x10\xda\xd7\xd8\xb6\x7e\xe8\x33\xc6\xda\x9c\x89\xf5\xea\x2b\x0a\xad\xbb\x76\x9c\x1e\xb4\x9c\xbf\x6d\x19\x9d\x36\x24\xf9\x09\x1f\x36\xca\x38\x4e\xdc\x6e\x78\x67\x19\x81\x87\xc6\xb8\xa2\x98\x78\x9b\x09\x10\xb2\x70\xfe\x24\x9f\xd3\x9d\xc5\xed\xbe\x49\x7b\xbb\xda\xa5\xaa\x2c\xde\xf4\xda\xfe\xf5\x33\x0a\x7a\xbc\xa5\xf8\x3a\x39\x32\x4e\x9f\x83\xab\x09\xde\xed\xc1\xcf\x7f\x6c\x17\xe2\x22\x28\x1f\xe8\x41\x07\xe6\x47\xcb\x70\x9e\x7f\xc8\xbc\x76\xb0\xe0\x5e\x3d\xfb\x7c\xbe\x5a\x31\xb3\xf5\x74\x2e\x06\x58\x58\x20\xb9\x2d\x9f\x24\x7d\xc2\x4b\x2d\x3c\x9d\x0a\x1e\x56\xd2\xbc\x66\x8a\x7d\x6f\xf7\xc1\x7e\x92\xb4\x14\x19\xe6\x58\x5a\x86\xf7\xa5\xc5\xf9\xbf\x27\x2d\xa9\xc9\xf4\xa6\xb8\xc4\xd1\x9e\xb8\xee\xe4\x7d\x81\xf9\x63\x7b\xf1\x96\xc0\x3c\xe8\x44\x6a\x2f\x3b\xbd\x84\xd6\xcf\xa9\x27\x9b\x77\xa2\xb5\x1c\x3b\xc4\x71\x15\xc9\x15\xe9\xcf\x28\x01\xce\x21\xd9\xf0\xc2\x09\x88\xf1\xd6\x40\x8c\x15\xad\x9c\xb8\xc2\x48\x06\x17\x70\x8a\x63\xc3\x12\x1c\xb1\x4f\xf8\xf5\xec\x15\x02\x37\x2a\x0e\x46\x7e\x8d\x3d\xb2\xd3\x65\x50\x32\xc3\x7a\x4e\x52\x59\x0b\x38\x3e\x35\xd5\x3e\xd5\x75\x05\x3e\x0d\xba\x66\xa3\x67\x5e\x57\xde\xea\x0b\x72\xd4\x4e\x2f\xd2\xe7\x60\x91\xd3\xeb\x05\x5c\x18\x32\xf3\x0a\xfa\x00\xd4\x5a\x08\x17\x13\x88\xfe\xf4\x52\x09\x06\x7b\xc0\x0c\x52\xc9\x83\x32\x7c\x80\x6b\xb1\x7c\xce\xd8\x5f\xcd\xaf\x9f\x81\x73\x6f\x18\xb0\xdc\xe3\xc5\x8d\xa8\x4c\x25\xc3\x05\x1e\x4a\x4c\x0e\xed\x00\xe0\xde\x74\x98\x2f\x74\x39\xf9\x9a\xa2\x4e\x1d\x5c\xc5\x79\x97\x35\x0f\x05\x63\x04\x60\xbc\x40\x8f\x4e\x80\x79\x64\xce\xda\x8f\xba\x45\xd1\xe8\xfb\xcd\x75\xd7\xa8\x42\x46\x8c\x4c\xd5\x38\xc0\x77\xa2\x8c\x16\xd7\xbf\x3c\xbd\x56\x8a\x57\x4b\x58\x2e\x17\x9f\x43\xa3\x6e\x9e\xbe\x2f\x67\xc6\x97\xbd\xc4\xf5\xd9\xee\xf4\x94\xaa\x60\x83\xfb\x8d\xde\xe6\x89\x24\xf5\x94\x69\xe1\x2a\x8c\x38\xfa\x0b\xd8\x51\xac\xa3\xe2\xa0\x65\x08\x46\x3e\x04\x1b\x9e\x3a\x96\xa7\x1e\x02\xd5\x93\x18\x71\x08\x96\x7f\x08\x26\x9b\x50\x44\x13\x38\xfa\x0d\xd2\x36\xc9\xb0\xe7\x0b\x0f\xa1\x3a\xaa\x05\x44\x58\x4d\x00\x8b\x0f\x01\xb9\xc3\xe9\xf6\x57\xbe\xf4\x10\x6a\x32\xb7\xa3\x53\xab\x95\x87\x60\xc9\x3e\xc5\x6b\x9c\x37\xc0\x39\xdd\x66\xc3\xac\x86\xc6\xec\x5b\xac\xa6\xc9\x87\x60\x67\x56\xd3\xd4\x43\xa0\x34\xab\xe9\xfc\x43\xb0\x0b\x56\xd3\xf4\x1b\xa4\x9d\x58\x4d\x17\x1e\x42\x5d\xb2\x9a\x2e\x3e\x04\x4c\xb1\x9a\x2e\x3d\x84\x4a\xb3\x9a\xae\x3c\x04\xbb\x65\xf5\xc9\xcd\x8c\xe7\x62\xe6\x15\x4f\xcf\x4f\x71\x76\x84\x39\xbc\x05\xe3\xda\x7b\xf3\x14\x6a\x86\x1d\x39\x54\x2e\x3a\x1d\x7b\x06\x23\x70\x20\x26\xb0\x26\xba\xe6\x97\xc4\xc4\xc2\xd1\x38\xfb\x2d\x2e\xf3\xa8\xa2\xcc\xff\xa7\x8b\x0c\xd0\xda\x45\xd9\x09\x60\x43\x40\x8f\x4e\xec\xa5\xed\xc3\x75\x1e\xe2\x79\x9d\x47\x91\xff\xe7\x5c\x0e\x0c\xcd\x2e\x79\xfe\xd5\x0b\xac\x1c\xfc\x2b\x07\x57\xba\x7f\xe0\x34\x0e\xff\x40\x1b\xff\x89\xbe\xad\x81\x8e\x92\xc5\x2f\xb8\xc7\x27\x8a\xaf\xb4\x39\x54\xf2\x67\x05\x5d\x79\x63\x46\xe3\xe4\xd7\x69\x69\xab\x3c\x9e\xd8\x31\xf4\x59\xe8\x2a\x8f\xe7\x77\x0c\x9b\x96\xbd\xca\xe3\x69\x1e\x43\x5f\x88\x60\xe5\x8d\xd9\x9e\x90\x7d\x92\xc4\xca\xe3\x49\x1f\x03\x5f\x0a\x64\xe5\xf1\xdc\x8f\xe1\x53\x72\x59\x79\xac\x02\x62\xe0\x94\x78\xc2\x9d\x82\x87\x53\xe7\x86\xdd\x24\xf1\x78\x72\x5f\xb3\x9b\x24\x1e\xcf\xf1\x5b\x76\x93\xc4\xe3\xa9\x7e\x87\xdd\x24\xf1\xc6\x8c\xbf\x66\x37\x49\x3c\x9e\xf8\xf7\xd8\x4d\x12\x8f\xe7\xff\x0d\xbb\x49\xe2\xb1\x1a\xb8\x66\x77\x32\x23\xca\xe5\x2f\x70\x7f\x1b\xf8\xcf\xef\x9c\x19\xa8\xbe\xf2\x37\x60\x53\x7c\xcb\xf4\x1f\x0e\x6e\x1f\x43\xd2\x97\x90\xf7\xe8\xea\x9f\x66\x1b\xa4\x06\x5a\xfd\xf1\x77\xaf\x14\xfd\x45\xb3\xa3\x4f\xef\x25\x88\x02\x9f\x21\xf8\xd4\xc1\x87\x7d\x48\x58\x60\x69\xaf\xc3\xcf\x99\xfa\xe7\x0c\xfb\xe9\x4c\xe2\xed\xbb\xf7\x48\xbd\x7a\x37\xde\x83\x33\x71\xc4\x21\x4a\xef\x96\xe8\xb6\xf0\x14\xa6\x98\xf9\x11\x1a\x3c\x3f\xc6\xf1\xc2\xe8\x0f\xa4\xef\x34\x34\x1c\x3f\xc2\x8a\x25\x2b\x88\x28\x84\xd1\x7b\xa7\x6a\x23\x38\x7a\x04\xc2\x86\xd0\xc8\x45\x91\xc7\xb0\x80\x2c\x0a\x14\x0c\xf0\x6e\x0e\x50\x91\x18\x09\x74\x5c\x4c\x14\x61\x87\x92\x15\x43\x6c\xb8\x99\x10\xfd\xff\x05\x43\xe1\xe2\x2a\x91\xe7\x61\x25\x8d\x6e\x89\x9c\x6e\x89\xc5\x44\x02\x0b\x1b\x1d\x77\xc1\x50\x42\x58\x78\x63\x16\x6f\x08\xa1\xb3\x2f\x2c\x1c\xe9\x5a\xb4\xd7\xc6\xbf\xfb\xce\xfc\xc5\x96\x19\x01\x71\x7b\xb5\xd3\xc9\xc0\x1e\x9d\xe5\x00\x0f\x21\x0b\x86\xe7\xce\xb6\x82\x8d\x02\xfe\x51\xaa\x85\xc2\x55\xfe\xe2\xb8\x6a\xd5\x0f\xa9\x27\xd7\x1b\x33\x08\xed\xe7\x0c\xf1\xe9\x14\xdd\x9b\x26\x6f\x04\xc4\x90\x83\x1d\xfe\x00\x91\x85\x27\x44\x52\xf7\x89\x84\x0f\xd0\x9d\x8b\x3b\x1b\xe9\x17\x44\x62\x30\xeb\x01\x58\xfe\x12\x4c\x7b\x00\x46\x63\xb0\x34\x67\x5e\xa0\x58\xa3\x90\x79\x18\x1c\x9f\xf9\x0c\x7f\xb5\xce\xbf\x6a\xf0\xd7\x4f\x2f\x27\x36\xa1\x13\x74\xe0\xf3\x84\xef\xb9\x5d\x72\x3e\x52\xbf\xcf\xba\x84\xb9\x08\x61\xfa\x4e\xe0\x4d\xec\xf5\x77\x3a\x8e\x77\xcf\xfb\x31\x37\x52\x9c\x48\x0e\xdd\xff\x02\x4c\xf8\xcb\x5b\xe7\xf1\x51\x3c\x91\xbe\x4f\x7d\x87\xd8\x7b\xc7\xf7\xe4\xed\x3b\x68\x5a\x26\x37\x52\x1f\xbd\x47\xdd\xbe\x87\x5c\xa5\xa7\x2f\xe6\x6f\x5f\x8c\xfd\xa9\x67\x6f\xd2\xb7\x6f\x9e\x3c\xad\xa7\x2f\x17\xee\xf4\x13\x79\x9b\xcf\x5e\x2c\x81\x17\x71\x66\xf9\x93\xef\x79\x49\x3c\x7e\xfc\x14\x4f\x39\x85\x07\x3b\x73\x77\x30\xe1\x2f\x9e\xe2\xaa\xdc\x76\x06\x86\x4b\x2f\xcd\x64\x73\xe0\xe9\xe8\xdd\x19\xbe\x78\xd8\xe3\xdb\xc0\xf7\x87\xf6\xe2\xcb\x3b\x68\xdf\x1a\xdc\x67\xef\x3e\x19\xde\x67\xaf\xbf\x31\xc0\xcf\x5e\x2d\xdd\xa1\xfa\x34\xaa\xcf\x5e\x2e\xdf\x7d\xf9\x34\x90\xcf\x5e\x7f\xc7\x50\x5e\xa2\xc0\xba\xe0\x0a\xd3\x5f\x32\x05\xe2\xe2\xf2\x57\x9c\x2d\x0e\x2e\x8d\xb9\x1b\x23\x01\xd5\x59\x4b\x67\xc5\xf2\x66\xc0\xe5\xb8\xbc\xb5\x78\x46\x95\xbc\x00\x97\x57\xb0\x20\x5e\x82\xa1\x9a\x34\x71\x5d\x3f\xb8\x7d\x81\xaa\xe4\xcf\x0e\x31\x90\x0d\x0b\x75\xa3\x6b\x0a\x09\xb2\xf5\x06\x48\xc3\xcc\x06\xb6\x01\xd4\xe7\xc1\xe7\x8c\x05\x16\xfa\x4f\xe8\x6a\xd2\xd7\x2b\x85\x06\xd4\xdc\x1d\xde\x9e\xad\x25\x11\x5f\x0e\x47\xb7\xec\x32\x5f\x80\x4e\x3c\x5d\x13\xbb\xa3\x74\x2e\x30\x01\x3a\x6a\xb0\xb6\x7a\x46\x9f\x9b\xfa\x12\x87\x17\x9c\x2d\x3a\x54\x70\x2d\x4e\x7b\x1f\xff\x40\xfd\x1c\x25\x8b\x2d\x68\xf1\x6a\xed\x3d\xcf\x16\x94\x87\xe2\x04\xf8\x6f\xb8\x30\x65\xba\xe9\xb7\xba\x81\xbe\x10\x87\xdc\x3f\x86\x75\xf6\xdb\x1b\x6f\xc4\xb3\x1b\xb5\x71\xea\x33\x6a\x3d\x93\x05\x8a\xee\xfc\xea\x4d\x49\x46\x7c\xb4\x70\xea\xf4\x69\x34\x53\x00\xe8\xc4\x1c\x77\x11\x5b\x3f\x69\x4a\xd0\xc5\x39\xc8\x4f\xd4\xad\xd4\x17\x97\x77\x74\x52\xd4\x50\x97\x8f\xd0\xfb\x7f\x4d\xfa\xfa\xc6\x6d\x47\xfc\x73\x75\xe7\xf1\x09\x03\xf5\x54\xcf\xdf\x10\x85\x3b\x33\xee\xcd\xd1\xa8\xf2\x35\x46\x6a\x8f\x1e\x49\xd7\x5f\x80\x6d\x7e\x47\xf5\x9c\xe6\xdc\x95\x98\xd2\x6f\x89\x29\xfd\xaf\x26\xa6\xf7\xba\xf1\xb6\x98\xa6\x94\xcd\xff\x2f\xa6\x77\x19\x78\x21\xa6\x0f\x38\xf0\x0e\xee\x9f\xc4\x32\x41\x75\x6f\x5d\x00\x7d\xa8\x10\x30\xc1\x1b\x92\x54\xf0\x47\x6a\xa9\x7b\xa2\x4f\xc1\x7b\xd9\x4c\xf9\xdb\x23\xb4\x70\x17\xe4\x8c\x17\xb8\xf4\xd7\x88\x1f\xce\x00\xf8\x26\xc2\x9c\x70\x00\x91\x1e\x2f\x7d\x66\x54\xc5\x3b\x7c\xe1\x6d\x49\x8b\xda\x89\x54\x2c\xd1\x9f\xee\xc7\xbb\xdf\xbc\xc7\x9e\x28\x89\xdf\xbb\xbd\x55\x8b\x76\x0e\xbf\x84\xf1\x71\x5c\x26\x49\x97\x82\x03\xcd\x3e\x18\x6c\xf5\x24\x65\x47\x1c\x29\x01\x6d\xfc\x4d\x98\xd4\x14\x7f\xad\x8a\xc3\x07\x47\x82\x30\xf9\xd9\x05\xf0\x57\x78\xc0\x85\xf6\x40\x7b\xc2\x27\xe8\x73\xc3\x2d\x48\x22\x83\xfc\x73\x98\xc4\x2c\x46\x79\x7b\x0c\xdf\x1f\x7e\xca\xfc\x12\x78\xbb\x6f\x3a\x0a\xf7\xf9\xf5\x84\x28\xc6\x11\x64\xbe\x81\x39\x35\xbc\xd3\xa7\xd5\x87\xa3\x1c\x93\x43\xed\xc2\xfb\x03\x4c\x88\xd5\xcb\x3b\x4f\xca\x8b\x2f\x69\xc7\x09\xf4\xe8\x9e\x93\x77\x8e\x76\x80\xd7\xa9\xc9\xb3\xd3\x09\x7a\xff\x18\x3e\x29\x98\x72\x7e\xe5\x79\x5c\x07\xf2\x4a\x01\x11\xa9\x9b\xeb\xf0\xf7\xe1\x9d\x58\x99\x6a\x1c\x13\xe9\xc6\x09\xeb\xd3\x39\xe3\x35\x33\x63\xae\x50\xdd\xcd\xcc\x16\x9e\x14\x27\xc2\xf4\x41\xf1\x5b\xfd\xbe\xe2\x57\xcc\x7c\x44\xa4\x92\x1d\xf1\x9f\x53\xc2\x94\x21\x0b\x67\x14\x7d\x7c\x8a\x8d\x36\x8c\x36\xe1\x19\x9c\x84\x12\x0c\x6f\xd4\xab\xc6\xe1\x53\xc6\x0b\xe2\x73\xbb\xcc\xe9\x6b\x12\x7e\x0d\x7b\x8f\x41\xd0\x8e\x1a\x95\x42\x2c\x55\x85\x1b\xa4\x14\x46\x8a\x73\xf1\xc0\x54\x60\xf0\xd2\x50\xfc\x0d\xc2\x17\x3f\xc7\xc8\x52\x73\x47\x48\xe6\xff\x2d\xc6\x12\xe8\x17\x09\x3e\x04\xfa\x00\x1c\x5d\xf0\xc2\x3c\xc3\xb8\x66\x60\xeb\xea\x2a\x95\x26\x17\xd5\x55\x50\xe1\x76\xdb\xce\x3b\xdf\x58\x0d\xf1\x8e\x20\xdc\x1a\x1b\x8f\x68\xa8\x44\x33\x1b\x1f\x17\xb4\x35\xcc\x15\xdc\xa7\x3b\x29\x1f\xd4\xd3\x13\x3a\x94\x74\x51\x20\x48\x14\xdf\x04\x77\xb7\xb6\x66\xbc\xb1\x58\xc8\x9f\x29\x6f\x7b\x3a\x2a\x60\x70\x4d\x78\x21\x93\x07\xc4\x26\xdf\xaa\x5b\xd5\x76\x54\x7c\x9e\x38\x8b\x83\x6f\x4d\xe3\x8b\xbd\xfa\x7c\x6a\xee\xc4\xaa\x02\xea\x66\xd7\x4b\x5e\xfe\x8c\x4b\x68\xde\x15\xbe\x9f\xbf\x5f\x51\xfc\xcf\x9a\xd3\x4f\x55\x14\xf9\x01\xc5\xf7\xcb\xcf\x24\xf9\x6e\xdd\x47\x7d\x08\x31\xf5\x01\xc4\xc5\x0f\x51\x4c\x7d\x23\xbf\x11\xdf\xde\xaf\xb3\x0b\xf9\x8f\xa0\x2f\x9c\x10\x5f\xd4\x73\x8c\xc3\x05\xd1\x8d\xef\x53\x12\x31\x74\x2a\xa8\xdb\x06\x4a\xe1\x8e\x0e\xef\xc1\x93\x39\xfc\x1b\x85\xcd\x78\x58\xe1\x9c\x8b\xf0\xc7\xf1\xe8\x00\x09\x80\x3c\xf8\xe7\xf5\x7d\x8c\xf2\x48\x6c\xcf\xe9\x50\x71\x42\x9c\x78\xe2\xa6\x42\xca\xbb\xb0\x8e\xd5\x4d\x13\xa9\xc8\xf1\x06\xfc\xca\xc6\xd1\xf7\x97\x77\x0c\x90\x45\x91\x24\x10\x88\xd5\x7d\x2a\x6c\x9c\x41\x49\xd8\xef\xa2\x46\x31\x20\xa8\x78\xed\xc5\xed\x77\x0b\xe8\x81\xd5\xe7\x98\x15\xa7\xea\x8a\xf1\x31\xe9\xe7\x78\x79\x01\x70\xe4\x77\xc5\xe3\xfe\xd5\x7f\x12\x90\xeb\xcd\xce\xc7\x09\x71\x5c\x3f\x8a\xd4\x1a\x0d\xef\x06\xde\xfc\x9b\xff\xf1\x54\x6b\x21\x68\x63\x78\x27\xdd\xda\x10\x66\x54\x0d\xe3\x04\xf1\x38\x66\x09\x95\x86\xea\xbc\xaf\xba\xe6\x35\x69\xff\xfe\xa0\xab\x57\x1a\xee\x11\x58\xda\x9a\xbc\xcd\x56\x8f\x73\x23\xb6\xbf\x8f\xb2\x1f\x9f\x34\xd9\xf6\x54\xb0\x34\xf0\xd5\x10\x35\xd3\x7e\x4f\x2b\x60\x5d\x45\xa9\x24\xae\xd2\x6d\x83\xd9\xb1\xb5\x83\x68\x03\xc6\x12\xe1\x83\x59\x25\x1c\x15\x86\x13\x25\xe7\x2b\xa7\xb1\x06\xd2\xad\xae\x0e\xa8\xa6\xb4\x1a\xdc\xd6\xe0\x83\x74\xaf\xdf\xc1\xa9\x38\x93\x4d\x74\x70\xe2\x64\xeb\x30\xb5\xcb\x67\x54\xa0\x9c\x48\xa5\x79\xc6\xc9\x67\x70\xd4\x0c\x4e\xe1\x92\x9a\x6d\x97\x5f\xdc\x04\x29\x51\xc8\x80\x46\xd1\x37\xe9\x37\xf3\xe9\x37\x4f\x1b\x8d\x49\x04\xc2\xf9\x9d\x8b\xaf\xae\xbb\x98\x59\xbf\x2b\x5d\xcc\xdb\x17\xf9\xce\x17\xf8\xd2\xd7\xf9\x1e\xdd\xcb\xfc\x9e\x1c\x27\x0f\x71\x20\x06\xbc\x9e\x83\x18\xdf\x7f\xbb\xef\x0f\x20\xe3\x6e\xb0\xec\xed\xad\xd1\xdf\x2b\xaf\xcc\x77\xb3\x84\xfe\xef\x25\xe5\x86\x2d\xb8\xed\xfb\x49\xd9\xd3\x13\x0a\xa7\x0d\x02\x54\xdf\x0b\x0a\x46\xdb\xc3\xa9\x72\xf0\xb8\xfa\x1b\xb4\xea\x4f\xa1\x82\xf1\x84\xfc\x48\x19\x38\xa4\xae\xde\x31\xef\xf1\x15\x37\x38\xf3\x86\xa6\x85\x5c\x09\xb4\x68\xb0\xf7\x63\x4e\x83\xef\xcd\xc9\xf4\x2d\xfe\x16\x5f\xfc\x1d\x79\x7e\x92\x93\x0d\x18\x25\x3f\x5f\xa5\x74\x23\x7e\xfd\x9c\x21\x89\x4f\x99\x2f\x64\xe6\xcf\xa7\x43\xcf\xf3\xcb\x2c\xde\x2e\x8f\xdf\x27\x6f\xdf\x27\x93\xf7\x33\x69\x04\x37\x23\x3b\x1e\xe1\xbe\xe3\x7e\xbf\x9e\x28\xfb\x7c\xd1\xce\x5b\x39\x11\x4e\x79\x00\x08\x7c\x36\x78\x27\x23\xef\x4d\x48\x2c\xce\xf1\xfe\xb1\x71\xfc\x39\x78\x52\x4d\x1a\x67\x4d\x4c\xc5\xab\xda\x2b\x40\x81\x1e\x81\xc7\x1b\x07\x30\x0e\xd7\x11\x04\xb4\x70\xcc\x90\xf9\xf4\xa1\xb6\xff\xfd\x49\xdb\x28\xb5\x71\x2c\xeb\xaf\xd0\x00\xf8\x2a\xca\xe2\xa7\x3b\x88\xc2\xef\x4d\x6e\x8c\x5a\xf8\x7d\xf8\x18\xbe\xdd\x17\x9c\xa9\x32\x03\xcc\x05\xdb\x3f\xdd\x77\x43\x27\x2e\x46\x04\xdf\xf9\x9c\xe4\xe1\x80\xff\x9b\xc0\xd0\x5b\xc1\xfc\x4e\xe1\x07\x67\x65\xf4\x2c\xf2\x1b\x9f\x77\xbd\x63\x34\x87\x70\x34\x3f\xd6\xf8\xbf\x3f\x69\x5d\x7c\xff\x0d\xd6\x0f\xee\x86\xbc\xa3\x61\xa8\x40\x81\x26\xfa\xa2\x41\x16\x6f\xa1\xaf\x98\xd4\x7d\x61\xc7\xd7\x96\xc8\xfb\x5a\xcd\x3c\x65\x36\x9e\xa6\x37\x02\x7c\x0f\xd9\xe6\x37\xe4\xce\x86\xdd\x73\x55\x78\xdd\xea\xb6\x77\x9d\xef\xee\xdd\xe6\x89\x5e\x80\x57\x1c\xee\xeb\x81\x21\xf3\x39\xde\xf5\xc0\x29\xbb\x3f\x2a\x46\xdb\x67\x95\x4c\xd1\xe6\x5a\xcd\x86\x07\x92\x09\x09\xb1\x61\xc9\xd7\x86\x1f\x6c\xed\xef\x2f\xbb\x67\xc3\x88\x1d\x90\x64\x89\x3f\xe7\x60\xc4\x96\xf8\x90\x1f\x8c\xfa\xcc\xf0\x3b\xfd\x91\xfd\x33\xc9\x45\x2b\xf8\x69\xbe\x26\xea\x98\x87\x0a\x22\x76\xc2\x18\x8e\xff\x60\x9f\xff\xf4\xa4\x55\x58\xf3\xe9\xfe\xd8\xd6\x80\x52\xf8\x7c\x99\xcd\xfe\x63\x63\xfb\xa4\xe5\x6d\xf4\x8f\x08\x6e\x52\xc1\x94\x68\xaf\xea\x79\x0f\xa0\xcb\xf4\xe6\xf0\xae\x20\x6c\x53\x5a\x75\xcd\xa8\x01\xfe\x42\x31\x73\xaf\xa1\x69\x66\xe2\x18\xdc\x95\x19\x41\x28\x18\x79\xfb\x55\xf7\x5c\x1c\x82\x3b\x4e\xa1\x9c\x25\xaa\xc7\x06\xae\xdb\x29\x69\xf2\xa5\x6b\x34\x53\x03\xac\x8a\x91\xcb\x03\xf0\xa3\xca\xb5\x6a\xc6\x72\x0e\xfe\x1c\x11\x80\xaf\x21\xa2\xbf\xef\xce\xe5\xe3\xf7\x67\x0b\x48\x92\x05\x9c\x03\x8e\xde\xf6\x2d\xae\x5d\x8b\xd4\xdd\x32\xf1\x82\xee\xd7\xb8\x68\x24\x96\x5c\x1c\xbe\x88\xbf\xc1\x19\x35\x3f\xe1\x73\xf9\x37\x69\xa3\xae\x0b\xf3\xdf\x3d\x87\xb9\x49\xea\x0b\xb9\x5f\xc5\x39\xee\xae\xbb\x40\xfe\xfa\xc0\xf8\x26\xd3\x3d\xe1\xcf\xfc\xfe\xfa\xf1\x36\x13\x1b\xed\x32\xc5\x0b\xd6\x21\xc9\x4e\x29\xde\x56\xc5\xe5\xb0\x81\x12\x69\x0f\xbf\x6f\x32\xff\x3d\x1e\xfa\x27\x57\xf0\xef\xce\x2c\x3e\x99\x59\xc4\x77\xce\xac\x27\x4d\xc7\x9a\x24\xe9\x31\xbf\x45\xa1\x9d\x48\x81\xb4\xf9\xef\xed\xee\x7f\xbc\x4f\x75\x26\x8d\x9e\x8f\x14\xd0\x16\x4e\xbb\xff\xbd\xed\xfe\xe7\xdb\xed\xc6\x79\x67\xf0\x8e\x30\xee\x64\x93\xfb\x4d\x7a\x2b\xf3\xcf\x67\xe7\x2d\x28\xcf\x4b\x3f\x13\x5e\xb4\x5a\xfd\x8d\xad\xfe\xd7\xfd\x56\xe1\xec\xee\x49\x43\x8e\xcf\xd4\x9a\x6d\xfe\xcf\x18\x20\xb7\x08\x73\xe8\x97\x7f\x00\x25\x7a\x72\xf9\xfe\xe1\xaa\xfe\xd7\x45\x08\x5f\x81\x2b\x36\x8e\xbe\x7d\xd5\x3f\x65\x28\x82\xa4\xd0\xe1\x05\x37\x07\x46\xa8\xbd\x71\x33\x3d\x31\xc3\x6c\xa2\x39\x4c\xaa\x8c\x2a\x1a\x21\xd8\x10\x6d\xf7\x05\x5b\x38\x12\x00\x87\x04\x2f\x5c\xcf\x70\xb2\x94\xb8\x6c\x83\x1e\x6f\x75\x5a\x70\x1b\x69\x85\xd5\xb5\x9a\x61\xc5\xea\x17\xbc\xdf\xe3\xd8\xba\x09\xef\x69\xa3\xc0\x64\x5d\x5d\x65\x34\x13\x62\x9a\xa1\xe0\x81\x38\x67\x71\xbb\xc9\xf1\x5d\x91\x87\x77\xb8\xcd\xaf\x3f\xfc\xf0\x02\xf7\x52\x61\x7c\x94\x1e\xbd\x00\x1e\xc3\x8c\x0d\x41\x64\x98\xfe\xeb\x0b\x4a\xde\x80\xd2\x91\xdf\xdc\xa8\x03\x1d\xcd\x78\xda\x02\x08\x79\xc2\xe4\xbf\x21\x7d\x97\xf9\x0f\xfc\xf4\x9f\xa8\xb7\xf5\x36\x04\xf4\xe1\x54\x47\xc6\xb7\xbd\xf2\x37\x51\x3a\x07\x66\xe4\xc1\xeb\x54\x97\x0f\x4f\xa7\x3d\x08\xc3\xf0\x84\x21\x49\xb1\xaa\x6e\x80\x33\xa7\xa2\x5b\xd3\x30\xdd\x3d\xcc\x23\x7a\x2b\xb9\xa9\x2a\x37\xe9\xd5\x01\x66\xd0\xff\x0c\x94\x1b\xc0\x19\xa7\x50\x85\x1d\xcb\xc0\x19\x3b\x87\x47\x3d\x28\xc3\x3e\xde\xa6\x86\xb9\x82\xd2\x85\x6c\x3e\xc3\xe5\x71\xb6\x71\xd0\xd7\x86\xa9\x6d\x2c\x2b\x4e\x0a\x0f\x5b\x8e\xd5\x24\x7a\xff\x27\x84\x06\x6d\x45\x9d\xd0\xc3\xbe\x9c\xc2\x8c\x41\xaf\x75\x74\x0d\xd9\x4b\xe2\xb0\x61\x76\x2e\x40\x29\xdc\x8a\x5f\x81\x25\xd0\x81\x07\x96\x60\xb4\x50\x51\x87\x34\x7e\x54\xb5\xe1\x14\xe2\xfc\x5b\xb1\x0f\xaf\xb1\x0f\xd3\xd8\xe1\x0a\x81\x39\x75\x5e\x06\xf0\x86\x32\x7e\x7a\x61\x15\xff\xcb\x8e\xfe\x57\xb8\x0b\xe3\xc1\x33\x09\x4c\x7c\x5a\x1a\xd2\x72\x90\x3b\x65\x02\x8f\x2e\x48\xff\x9a\x30\x07\x01\xc3\xe8\x18\xf8\xff\x29\x9d\xac\xe5\x2c\xcd\x03\xdc\x25\xe9\xe1\xc9\x00\xff\x7a\x3d\xc3\x7f\x82\x25\x96\x5e\x4f\x0d\x82\x6f\xcf\x21\x1d\x49\x10\xf6\xdf\xff\xbe\x87\x7b\x4a\x38\x53\xca\xd1\x57\x0d\x08\xf6\x15\x72\x84\x03\x93\x9d\x89\x5e\x81\x33\x11\x79\xf1\x59\x0e\x59\x3c\x95\x57\xc6\x21\xcc\x71\x5b\x01\x12\x3b\x73\x07\xf7\x7e\xf8\x3d\x98\xbb\xe8\xb4\x0d\x53\x17\xe7\x40\xc7\x29\xd0\x7f\x7d\xf9\x9c\x79\xb1\xe2\x1a\x03\x48\x4f\xb9\xfe\x26\x8a\x7b\x3d\x4c\xf7\x1a\x65\x92\xc3\x87\x43\x49\x76\x5e\x5c\x68\x24\xc9\x7d\x09\x85\x0c\xf5\x1e\x5d\x07\x03\x30\x76\x90\xe9\x88\x6c\x5c\x54\x26\xa6\x2c\xc0\x5c\xfb\x0f\x5c\x09\x3a\x26\x08\x4c\x21\x5e\xd5\xe7\xaf\xa9\x91\xb8\x60\x0d\xe2\x6c\x00\x1e\x81\x37\x71\xc7\xbf\x42\x09\xe2\x62\x9e\x60\xf0\x4b\x16\x65\xfe\x9f\x0c\xb1\x2f\x13\xa7\x98\xa5\x73\xeb\xbf\x20\x4c\xbf\x26\x67\x99\x68\x5c\x7e\x41\x18\xe2\xba\x57\xff\xfc\xaa\xd9\x2b\x9c\xc8\xf7\xd3\xb9\xf6\x02\x7a\xeb\xfe\xc8\x06\x7f\xd0\xc8\x7e\x8e\xab\x39\x5c\x0d\x6e\xf0\x60\x70\x83\xb7\x07\xf7\xac\x30\x4e\x54\x02\x2d\x9f\x50\x19\xd3\x08\x9e\x80\x79\xe1\x3b\x30\x7d\xf0\x49\x94\x1e\xe6\xbc\x3c\x21\xd2\x61\xfc\x7e\x82\x23\xc5\x56\x7d\xfe\xeb\x35\x3b\x2f\xf9\x9b\xa2\x6c\xf8\x51\xca\x82\xef\xa4\x2c\x78\x27\x65\xe9\x64\x03\x69\xbd\x15\x67\xee\x36\xe2\x04\x5c\x28\x11\xe2\x49\x61\x7d\xc6\x5e\x13\x58\x2f\x81\xa3\x82\xf2\xbd\xc6\x57\xbf\x51\x34\x01\xc4\x35\x1e\xdd\xd6\x45\x7d\xa4\xac\x60\x41\xb6\x64\xb6\xc4\xa4\xe0\x34\x3a\xf5\xeb\x54\x40\x70\xa6\x22\x5d\x19\x7b\x63\xdb\x08\x80\x7d\x05\x3e\x59\x0e\x26\x7d\x04\x7f\x52\x14\xf1\x05\xd8\x29\x11\x34\xbd\xa9\x2f\xf4\xd7\x79\xe4\x3a\x4f\x5a\x4e\x2a\xc2\x40\x51\xbb\x0b\xf5\x8a\xd8\xff\x12\xe7\x25\x02\xc2\x96\x48\xfc\xcb\xdf\xf7\x45\xe2\xe5\xcf\x2f\x7f\xdf\x50\x05\xbd\x08\xbe\x80\xda\xe3\xff\x64\xbe\xfc\x15\x30\x4c\x75\xbd\x95\x91\x82\x23\x63\xb8\x0a\x15\xc3\xa9\x10\xce\x0a\xcc\xc3\x17\xcd\xdb\xa7\x00\x29\x0c\x48\x13\x95\x18\x50\x83\x80\xf3\x5c\x94\x82\xc9\x27\x30\x7a\x0c\xa3\x43\x98\x59\x6e\x96\x82\xa1\x13\x18\x23\x86\x31\x20\x8c\x9e\x0b\x52\x30\x85\x04\x46\x8d\x61\x4c\x08\xe3\x5c\xe0\x29\x22\x18\x82\xd0\x88\x18\x66\x86\x3a\x68\x02\xd2\xcd\x14\x58\x29\x01\x23\x63\x30\x0b\x82\x65\x73\x5f\x52\x30\xe5\xb8\x39\x8a\x8e\x61\xe6\x10\x66\x95\x73\x52\x30\x95\x84\x24\x2d\x86\xb1\x21\xcc\xf6\xa2\xfb\x6a\xcc\x4b\xb2\x1c\xc3\x2c\x20\x0c\x0e\x43\xff\x82\x4c\xca\x14\xb0\x96\x00\x27\xf4\x2f\x21\x70\xe4\xf9\x37\x90\x7a\x0c\x79\xe2\xaa\x93\x40\xc2\xec\x88\x29\x40\x23\x41\x99\xf4\xc3\x4d\xb5\x7f\x05\x6b\xc6\xb0\xf9\x04\xe9\x0a\xb1\xd8\x5e\x99\x5f\xd0\xd5\xfa\x14\xe8\x0c\x83\xe6\xb5\x64\x34\x3c\x08\x1a\x02\x7b\x96\x3c\x43\x95\x88\x04\x2a\x61\x90\x9f\x40\xe5\x53\x50\x89\xb8\x11\x49\xaf\xd7\x09\x54\x21\x05\x45\x25\xb8\x12\xe2\x82\x04\xaa\x94\x82\xca\x27\x50\x89\x24\x85\x09\x54\x25\x05\x45\x27\x4c\x49\x70\x45\xa8\xa3\x80\x1b\x5f\xa2\xb4\xa4\x94\x62\xa1\x2b\x9c\xa4\x60\x03\x01\xd1\x60\x5c\x41\x16\x13\xde\x25\x90\xdb\x14\x9f\x2f\x41\x4b\x09\xd2\xa4\xf5\x5d\x32\x76\x97\x70\xe5\x84\x2f\xc9\x34\xdc\x23\xf1\x8a\xf3\x11\x7d\xc1\x25\x47\x4e\xd0\xb1\x30\x52\xc5\x84\x80\x03\xee\x53\x18\x7e\x31\xe1\xfd\x83\x14\xa8\x9a\x80\x16\x62\xd0\x63\x3c\xbf\x81\xa5\x16\xdc\x40\x63\xa1\x24\xf2\x7a\x32\x3c\xff\x01\xa1\x7d\x3b\x05\xa2\x27\x08\x13\x90\xff\x44\x93\xc5\x8b\x6e\x90\x19\xf1\xd4\x53\xf3\x31\xe4\x3f\x11\x9b\x02\xe0\x07\x87\xf3\x2f\x3e\x74\x82\x52\xd0\x66\x32\x51\x4b\x31\xf4\x7f\xa1\xf9\xec\x45\xe7\x25\x38\x29\x35\x89\x31\x7c\xb7\xf6\x2d\xbc\x4f\xfb\x32\xef\xd2\xbe\x71\x77\x2e\xb5\x2f\x05\x44\x33\x73\xd9\xf7\xff\x75\xbf\xef\xe9\x7e\x49\xc0\x09\x85\x95\x82\x61\x77\x60\x02\x8c\x24\x8b\xc9\xb3\x25\x2a\x49\xd3\xff\x8c\xd4\x4d\x08\x68\x41\x01\xe3\x29\xe7\x1d\x56\x22\xfe\x6e\x4e\x16\xdf\xc7\x49\xfa\x5d\xe4\x19\x90\x94\xef\xe1\xe3\x19\x9e\x26\x12\x78\xcd\x8c\xe1\xff\x06\xe1\xf3\x39\x3a\x05\x55\xd0\x62\x28\x32\x9f\xcc\xb6\x5f\x20\xd4\x8b\xbd\x78\x01\x1a\xd0\x42\x27\x33\x99\x57\x1c\x70\x64\x79\x66\x88\xd3\xe6\x41\xb4\xb3\xd9\xcf\x9f\x52\x88\xf4\x53\x73\x89\x0a\xfa\x3b\x44\x44\xe6\xa8\x14\x90\x91\x00\x95\x12\x1d\xf0\x6b\x7a\x6e\x67\x34\x35\xf8\xe1\x72\x0a\xc6\x5d\x2e\xa7\xe7\x20\x0c\xb1\x04\x93\x21\xbc\x9c\x89\x18\xb2\x58\x4c\x4f\xc5\xd9\xe5\x14\x8c\x09\xd4\xd3\x73\x90\x04\xfc\xb8\x98\x79\x31\x10\x9d\x9e\x7a\xaa\xbe\x89\x2f\x49\xa5\x85\x34\xae\x52\xfd\xdd\x22\x53\x7a\x9f\xc8\x70\x57\xb9\x9d\x6e\x21\x0a\xef\x12\xaa\x19\x26\xf7\x52\xac\x4e\x02\x40\xe8\xf4\x85\x00\x30\x2f\x99\x8d\xeb\x00\xa7\xf6\xde\x18\x1b\xc5\xf4\x18\xbf\xf4\xee\xc0\x9e\xd8\xad\x17\xd2\x43\x0d\xf1\x06\x28\xc4\xe8\x04\x79\xe2\xb9\xa1\xa7\x79\xfe\xb2\x39\x61\xbd\xb4\xe5\x30\xb0\x59\x49\x1b\x73\x2f\xe6\x4b\x3c\x48\xf7\xc4\xc7\xa4\xd3\xe2\xf3\xa2\xde\x92\x7b\x16\xa0\xd9\x85\x00\xbd\x78\x77\x60\x4f\x5d\x33\x0b\x69\x49\x82\x78\x2f\xbb\x76\x16\xa7\xd9\xa3\xae\xdd\xc8\x14\x2e\x6b\xfe\xbd\x22\x55\x7e\x9f\x48\x0d\xdf\x27\x30\x88\x96\xdf\x4b\x0d\x99\x44\x5a\x0d\x41\x66\x01\x6b\x7d\x6b\xde\x53\x46\x67\x43\xf6\x17\x6c\x77\x5c\xc8\xcb\x69\xa8\xcc\xd2\x85\x14\xea\x2f\x19\x98\x9e\xd4\x71\xd4\x7b\x62\xa8\x96\xd2\x62\x18\xc6\xe1\x2f\xe1\xc1\xd5\x3c\x98\xea\xca\xdb\xc0\x83\x80\xf0\xd3\x7d\xf9\xa9\x5c\xc8\xcf\x49\xd6\xee\x89\x4f\xe5\x42\x7c\x36\x49\x2f\xef\x49\x4f\xf9\x42\x7a\xcc\x5b\x50\xf3\x46\xff\x21\xf1\x79\x5b\x74\x92\x8a\xf8\xdf\x2d\x43\x95\xf7\xc9\xd0\xe0\x03\x32\x04\x37\x7c\x11\x51\x97\xc2\xf4\x7d\xc2\x61\x5e\xae\x54\x00\x56\xb7\x03\x7d\xe3\xce\x1c\x73\xff\x9b\xc5\xc4\x54\x2f\xb4\x95\xf9\x00\xf9\x69\x64\xcc\x64\x71\xfd\xdf\x78\xd9\xbc\x80\xbf\xa7\xb7\x66\xf4\x85\xde\xf2\x1e\xbc\xf0\x2f\x24\x7c\x33\xed\x5a\x77\x5d\xb1\x24\x2d\x84\x75\x13\x86\xc2\x7e\xb7\xec\x91\xc4\xfb\x84\x4f\x78\xdf\x76\x00\x22\xe6\x91\xcc\x9d\x34\xc2\xdf\xde\xab\x11\xfe\xf8\xc5\xd2\xb8\xb0\x8b\x5e\xa4\x3b\x4b\xe0\x1f\xbf\xac\xcd\x2e\x0c\xa4\xab\xc5\xea\x4a\x38\x8c\x59\x5a\x38\xcc\xf0\x68\x46\xb7\x9a\x09\x65\x06\xfc\x2d\x52\x41\xbe\x4f\x2a\xe4\x77\x49\x85\x8d\xa9\xf9\xbd\xd6\xb5\xdf\x22\x46\x7f\xc0\x3a\x77\x52\x17\xbf\x3e\xb2\x8b\x52\xba\xe8\xd2\x86\xda\xdc\x6a\xdd\x94\xb0\x11\xd7\xc2\x76\xad\x30\xce\xb2\x46\x5d\xcb\xda\xef\xa1\x86\xcc\x4b\x13\xca\x4e\x83\xa6\x85\xad\xeb\x05\x3b\xd3\x02\x03\x9c\xab\xaa\xbf\xc9\x3c\x27\xa9\xf7\x49\x1d\xff\xd4\x3e\x2f\xbe\x4b\x2e\x57\x27\xc2\x0d\xf5\xd6\x50\x3f\x0b\xdc\x49\xf7\xfc\xed\x4a\xf7\xdc\x55\x54\xc5\x4b\x45\xc5\x9f\xdd\xba\xbb\xba\xaa\x7c\xad\xab\xc2\x28\xf0\x96\xe6\xef\x64\xd8\xff\xef\x87\x5a\x2d\x65\xd8\x5f\x2e\x90\xea\xdb\x2a\xb0\x78\x29\x95\xe6\xbd\xee\xa5\x24\xb3\x7c\x2d\x99\xd7\xdd\xfb\x43\x8d\x7b\xd1\xff\x8d\x12\x99\x7f\x9f\x44\x2a\xef\x92\xb7\xd0\xbf\x23\x66\xff\x77\xf4\xa0\x4a\x5e\x48\xe9\xbf\xbd\xe0\xa4\xa8\x91\x69\xdc\x15\x52\xf2\x42\x48\xbb\x2f\x99\xc8\x76\x8c\xbb\x32\xaa\xcd\x2e\x64\xf4\xe7\x14\xe2\x7b\xe2\xa4\x5d\x28\xb9\xab\xf1\x3e\x4b\x11\x79\x21\x45\xab\x9b\xf6\x53\x42\x54\xba\x10\xa2\x2b\xd5\x7d\x21\x1b\x3b\xf0\xc5\x6f\x91\x8d\x77\x1e\xa4\x94\x9e\x6a\xab\xc6\xfb\xa4\x07\xd3\xfb\x50\x49\x55\x2e\x94\x14\x7f\xbb\x0c\xfd\x4b\xee\x3c\xbc\x4b\x41\xfd\x7f\x73\xe7\x41\xdc\xd9\x61\xf8\xfd\xe2\xf7\xce\x9d\xe4\x9f\xde\x29\x5c\x80\x96\x47\x8a\xe9\x64\xb5\xfc\xaf\x47\x56\xcb\x77\xfa\x95\x95\x0b\x31\xbc\x75\xb4\xfe\x15\x5c\xca\x33\xfc\xec\xc6\x86\xfa\xc7\xa5\x0d\xf5\xfb\x78\x9f\xff\x02\x3e\xc6\xbb\x1c\x50\x14\x1d\x66\xe2\x60\xb4\xaf\xaa\x61\xbc\xbe\xe0\x70\x38\x75\x63\xd8\x5e\x0e\x06\xc4\x03\x24\x2f\xf8\x2f\xcf\xb2\xbe\xc1\x74\xe8\xf0\xcc\xe8\x87\x97\x11\x65\xac\xa4\x1d\xc3\x31\xa7\x9f\xea\x7c\x3d\x29\x08\xe8\xd7\x4e\x6d\xcb\x2f\x64\xb6\x61\xd5\x28\x2d\xdf\xb2\xd5\x69\x07\x83\xc8\x5c\xe9\x04\xde\xd0\x59\xfc\x0b\x47\xbf\x64\xb2\x3f\xbc\x30\x52\x65\xa5\x90\x1d\x26\xfd\x43\xab\xce\x46\xb4\x78\xf4\xbb\x19\x36\xf3\x3c\x97\xcf\xdd\xfc\x94\x97\x55\xc3\xad\x1c\x64\xd7\x39\x36\x06\x00\xb0\x36\xf7\x11\x42\xbd\x6e\x6d\x46\xf9\xd6\xaa\x59\xdf\xfb\xb2\xa3\x6c\x75\xb7\xe5\xeb\x07\xb6\xd5\xac\x36\x77\x9d\xea\x72\xd7\x3d\x32\x05\xdc\x0c\x5f\x4b\x10\x08\x52\xab\x3a\x06\x0d\xa2\x6e\x55\x6b\x9d\x66\x67\xc2\x10\x2d\x76\x8c\x29\x64\x18\x80\x9f\xb5\x5a\xdc\xb2\xb7\xa4\x94\x96\xa0\x4e\x24\x4f\x9c\x17\xdc\xd6\xb0\x29\x8a\xae\xe3\x74\xa4\x9d\xad\xd8\x92\xad\x4b\xb2\x4c\xef\xf6\xfb\xf9\x7c\xb1\xa8\x36\xea\xf5\x7a\xaf\xd3\xac\x0e\x97\x35\xf8\x36\x40\x2d\x30\x6e\x0f\x21\xf4\xb2\x4a\x4b\x0d\xe9\x82\xb2\xb7\x56\x8b\x95\x60\xf5\x26\x4e\xaf\x27\xe8\x16\x4b\xfb\x43\xba\xba\x6c\xed\xb6\x92\x2b\x53\x45\x37\x12\x94\x40\x0b\x69\xbf\x35\xb0\xba\x93\x81\x04\xe8\x68\x32\x03\xde\x9a\xcf\x87\x43\x51\xe4\xea\xb5\x5a\x5d\x68\x22\x84\x4d\x19\xfc\x78\xe0\x8b\xfd\xfe\x70\xe0\xea\xab\x55\xa3\x29\x08\x6b\xdb\xb2\x2c\x0f\xfc\xcd\x55\x47\xd5\xb6\xef\xb7\xba\xbd\xde\xc6\xf5\x3c\x9a\x2e\x16\x6d\x9b\x20\xf8\x66\xbb\xad\x8d\x44\x71\xb9\xdb\x93\x63\x65\x11\x04\x44\x7d\x3a\xdd\x1f\x11\xc2\xe3\x62\x05\x90\xf4\x7b\x3d\xd3\xd4\xf5\x32\xdd\x1a\x2c\xbb\x13\xc0\x04\x0b\x32\x6d\x60\xc9\x8a\xc2\xb2\x1c\x07\x29\xa8\x09\x4d\x41\x55\x65\x1d\x36\xd4\xac\x0e\x96\x35\x40\x25\x60\xa2\x85\xf8\xcb\x36\x96\xc3\x61\x0b\x21\x0c\x87\xa3\x76\x38\x3c\x76\x09\x71\xd8\x2f\xdb\xfb\x21\x7f\x9c\x0e\x3b\xc4\x78\x34\xe6\xc9\x31\xfc\x31\xc6\xe4\xd4\x70\xa7\x53\x63\x05\x3f\xa4\xe2\x36\xc7\xda\xa6\x41\x2a\x1b\xf0\x3f\xd5\x1c\x1b\x15\x7a\x3c\xaf\x37\x15\xf4\x41\x08\xe1\x2f\xd9\x46\x7e\x56\xc9\xc3\x0f\x61\x75\xeb\x83\x31\x68\x99\x05\x5c\x5e\xf4\x14\x6d\x21\xa8\x4d\xbb\xbe\x6e\xdb\x3d\xb5\x59\x9d\x37\xd5\x90\xb1\xd8\x25\xa4\x1e\xc0\xb4\x96\x76\xd3\x5f\xae\xbb\x2d\xdf\x55\xd6\x81\xeb\x6a\x08\x61\xe4\xda\x41\xe4\xe6\xdb\xa1\x7d\x6c\x87\xd6\x81\x9f\xaf\x77\x50\x1a\x58\x34\xf8\xf0\x47\x60\x7d\x77\xad\xdc\xff\xb8\x8a\xe2\xb8\xe3\xd3\x07\x21\x4c\x3f\x78\xf4\x19\xd4\x17\x4d\xc1\x02\x6d\x80\xcf\x3e\xcf\xeb\xe0\xb3\x1c\x8e\x9b\xcb\x7d\xbe\x19\xb2\x3b\x3c\xea\x07\xd0\x36\x42\x08\x7b\x27\xd9\xc7\x9a\xbe\x18\x36\xf4\xe3\x08\x7c\x8e\xe0\xb3\x6f\x18\xfc\xa8\xe5\xf0\xc7\x6e\x85\xdf\xf5\x39\x86\x54\x58\x48\xb0\x05\x64\x05\x0f\x02\xd3\x19\x82\x77\x86\xc7\x16\xe4\xbd\x64\xe7\x47\xfa\x62\x3c\xc5\x33\xe5\x98\x9f\xea\x44\x7e\x0a\x99\x3f\xfe\xc8\x8f\xdc\xc0\x23\x0d\x59\xc3\xd5\x0d\xc5\x57\xd6\x08\xa1\xc5\x58\xc7\x65\x9d\xc7\x83\x81\xdb\x97\xbd\xc1\xbc\x5a\x65\x12\x01\x06\x2f\x34\xed\x79\x81\xe3\x54\xa2\x15\x1c\x8f\xa3\x65\xcf\xdd\x4c\xac\xf5\x50\xd4\x88\x72\xbd\x35\x6e\x85\xab\x8d\xea\xca\x6e\xbe\x8f\x67\x0a\x94\x3f\xad\x43\x2b\x74\x61\x7f\x3c\xda\x2b\xc1\xd5\x27\x96\x6b\x70\xaa\x5e\x2e\xb4\xaa\xad\xb5\xe3\xb5\x56\x03\x77\xd5\xef\x99\x43\x41\x63\x8b\x94\x4f\xf8\xfe\xf1\x38\x07\xb2\xcb\x94\xea\xf5\x49\x1d\xc8\x6e\x01\x3c\xf3\x1a\x6b\xc3\x91\x11\x42\x88\x79\x02\x10\x14\xd6\x76\xa1\xd6\x8a\x8e\x47\xcf\x95\xdc\x83\x49\x6e\xc6\xa2\x06\x04\xbd\x50\x80\x0d\xc5\xc2\xbf\x1e\x17\xf5\x63\xc8\x17\x68\x05\x3c\xf3\x56\xaa\x4b\x6d\x0a\xdc\x98\x02\x48\x4b\x05\xa5\x75\xdc\xe0\x99\x32\x58\xcd\x53\x33\x05\x23\xb0\x1c\x6e\x40\xca\x2c\x83\x34\xd8\x70\x4e\xb1\x8b\xfa\x4a\x6e\x5a\x33\x99\xae\xcb\xf3\xc1\xdc\xb7\xeb\xa3\xc6\x4a\xec\x57\xfd\x9e\xd5\xd1\x2d\xdf\x67\x8b\xdd\xc5\x52\x11\x10\xc2\xb5\xdc\x1d\x48\xf3\xe5\xca\x9f\x8a\x1c\x54\x41\x68\x2c\x19\x8e\xe7\x6b\xad\x66\x53\x96\x24\x69\x79\x52\x00\xe0\x47\x68\x36\x55\xd0\xb0\xe5\xad\xd7\x82\x28\xda\x76\x20\x08\xed\x7e\xa7\x13\x82\x9f\xf2\xee\x80\x10\x1e\x8a\xc7\xea\x11\x4c\xef\xb0\xd3\x19\x0c\x76\xbb\x7d\xd4\x6d\x09\xed\x2a\x18\x70\xb7\xd7\x8d\x4c\xf0\x76\x91\x2e\x88\xf5\x8d\x13\x19\x8a\x2a\x14\x27\xa0\x01\xcf\xf7\x45\x86\x50\xd8\x58\xe3\x70\xec\x72\xc9\xf3\xf5\x3a\x68\x1c\x21\x44\x14\xf8\xf3\xc3\xc1\x76\x57\x5e\xb3\x29\x5c\xcb\x5c\x99\x1b\xf5\xf9\x61\x7e\x78\xf5\xe9\x97\x87\x60\xde\xdb\x63\xf0\x01\x73\xdf\x26\x47\x9d\x23\x89\x15\xec\xb8\x36\x06\x93\x9f\x54\x9c\xfc\x54\x8b\xe8\xb1\x41\x35\xa6\x33\x12\xcc\x6b\x92\x26\x67\x35\x5a\x71\x26\xca\xed\x87\x8b\x35\x36\x6a\x91\x6f\x02\xd6\x0c\x10\x6b\x10\xc2\xb9\x32\xb4\x81\x06\x6e\xac\x9a\xdd\xde\xc0\x72\xd9\x13\x1f\xe3\x39\x31\xcc\xf3\xd2\xbe\xc0\xeb\x07\x85\x5f\x8a\xa5\xe6\x72\x64\x34\xc3\xe3\xac\x49\x8c\x72\x1d\x82\x18\x76\x6b\xd2\x68\xd8\x95\xf6\x63\x83\x18\x8e\x49\x84\x90\xd8\x2b\x8e\x74\x54\x0c\xe2\x38\x76\x08\x72\xec\x90\x53\xc5\xa1\x34\x40\x49\xc9\xa8\x4c\x34\xa5\x92\xcf\x19\x97\x9f\x8a\x41\xc6\xaa\xdf\x02\x0c\xb4\x9a\x47\x57\x6c\xda\xe0\xb3\x88\x97\x00\x9a\xb0\x45\xb6\x29\xd6\x03\x40\x92\x82\x66\x29\x67\x09\xcd\x92\xdd\x6b\xd2\x0b\x51\x69\x2e\x27\x4a\xd3\x35\x15\x65\x65\x2b\x6b\xa0\xa5\x4a\xfe\x5a\x6d\x0a\x58\x8d\xa1\x49\xc4\xc7\x4b\xa8\xa5\x36\xd7\x2b\x2c\xd8\xe0\x17\xbb\x19\x80\x0f\xed\xd9\x8a\xe2\x83\x17\xd7\x1b\xb5\x15\x1e\xd6\xa5\x60\xf3\x91\xcf\x92\xf5\xb0\xd8\x70\x1e\x68\x08\x2e\x38\xc6\xa1\x85\x3e\x63\x11\x7c\x0e\x2d\x46\x6f\x56\xc7\xcb\x1a\xd3\xb1\x10\x4b\x77\x55\x5e\x1f\x90\x40\x65\x95\x9a\xe1\x68\xd6\x89\x79\xd8\xa9\x10\xa3\x4e\x65\x3c\x1d\xd6\x6a\x40\x8d\x21\x84\xc9\x0a\x96\x98\x0e\xbb\x16\xd3\x11\x4b\xbc\x7e\x34\xf8\xa5\x34\x6e\x46\xe4\xb8\x49\x82\x4f\x34\x1e\x0f\x2a\xcf\x14\x10\x16\x9b\xd4\x0f\x09\x46\x8c\x38\x8a\x60\xa4\x39\x38\xd2\x90\xa5\x8b\xc1\x40\x56\xe6\x2c\x27\xe8\x3e\xcb\x69\x0b\x52\xe6\xaa\x0d\xb7\xc5\x4c\xe6\xbd\x81\x3a\xdf\xb3\x36\xef\xef\x99\x63\xb5\xba\xec\x36\x57\xe2\x00\x21\x1c\x88\x7a\x65\xd3\x6a\x16\x76\xbb\xe3\x91\xae\x35\xbd\x9a\x34\xec\x58\x34\xe1\x74\x69\xda\xaa\xea\x82\x3b\xe5\x57\x4e\x8f\x99\xc3\xb9\xcd\x33\x35\x1e\x76\x66\x7f\xa8\x36\xf8\x7a\xa3\xdd\x13\x75\xd7\x1a\x76\xe8\x3d\xa7\x50\xd2\xa1\xba\xc4\x83\xe2\x2b\x7d\x11\x2c\xb0\x91\x33\xb7\x8e\x82\x38\x71\x79\xb7\x0f\xd6\x7b\xf0\x4c\x77\x97\x0e\x3b\x6f\xdb\x3e\xb5\xe4\xdd\x5e\x2b\x18\xa0\x49\xde\x80\xf2\xc9\x15\x81\x72\x65\x25\x76\x00\xa7\x54\xbd\xd9\x91\x2c\xcf\x07\xf2\x2c\x62\x6d\x63\xaf\xdc\x65\xad\x2d\x74\x4c\x49\x07\xf3\xb4\xe0\x17\xf6\xa3\xe3\x62\xd9\x6c\xc8\x23\xa1\x33\x50\x0d\x6b\xcf\xf8\xfe\x10\x3c\xb3\x57\x8d\x46\x73\xd4\x19\x98\x13\xdd\xaa\xb0\x2c\x34\xcf\x9a\x1d\x28\x65\x55\x66\x60\x5b\x84\xc2\x4b\x78\x4d\xe1\x39\x9d\xa1\x1b\xcc\xf2\x58\xe8\x10\xe2\x7e\xe0\x88\xfb\x6e\xed\xb8\x1f\x3a\xe4\xbe\xdb\x25\x0b\x12\x71\x1c\x0d\x48\x69\x3c\x1c\x1f\xf6\xdd\x31\x09\xfe\xa7\xf6\x4a\x77\xac\xc9\x0e\x60\x77\x77\x34\x1b\x82\xaf\xba\x35\xf0\x78\x4c\x14\x14\x3c\xca\x63\x6d\x0c\xb4\xea\xd0\xa1\xc0\xd3\xfc\x50\x19\x93\x60\x96\x80\x97\xb2\xe3\x82\x42\xe6\x8f\xdd\xee\x04\x3e\x33\x20\x92\x31\x49\x16\x94\xca\xb4\xa2\x44\x53\xc5\x3a\x35\x34\x1a\x0e\x71\x43\x47\x05\x8f\x32\x59\x92\x49\x69\x3a\x1c\x4b\xe3\xb1\x33\x01\x5f\x4c\xc0\xd4\x9b\xcc\x8c\xf1\xb8\xa2\x54\xc4\x3d\x04\xee\x76\x29\x40\xc1\x58\x53\xc6\xd4\x6c\x1c\x8d\x15\xa5\x42\x03\xf8\xe9\xd8\x70\x28\x00\x07\x1a\xcc\x4e\x2a\x66\x8d\x9e\x29\x15\x3c\xf5\x86\x73\x44\x01\x59\x01\xef\x02\x60\xd9\x50\x1c\x59\x33\xc8\xfc\x61\x0e\x16\x72\x67\xed\xad\xed\xb5\x6b\xdb\xeb\xf5\xda\x5d\x47\x2e\xb5\x0e\xd6\xa4\xe6\x6d\x6c\xf0\x3c\x10\x42\xd7\x04\x7f\x1f\x85\x70\x9d\x0d\x02\xf7\x18\xe0\xa9\x07\x80\x03\xf0\x52\x68\x1f\xd6\x6b\xfb\x10\x84\xeb\x63\x69\x6d\x1f\x83\x08\x3c\xdb\xac\xf3\x42\x18\x70\x5a\xb0\xde\x06\xd1\xa6\xdc\xde\x1d\x8e\xc1\x66\xc5\x01\xf8\x62\x10\x6e\x30\x1c\x80\x09\xf6\xab\x46\xb0\x59\xb0\x65\x2c\x36\xf6\xaa\xed\xaf\xb7\xe0\x65\xb7\xb8\x71\xc1\x9c\x5c\x35\x3a\x91\x4b\xe8\x5e\x11\xa0\xb1\x83\xf6\x2e\xa8\x0a\xe1\x26\x17\x6c\xec\x2c\x61\x88\x35\xd0\xd7\xa9\xe1\xd4\xf2\x8b\x31\x35\x56\x2a\x14\x39\x33\x0a\x05\xad\x42\x4f\x0e\xda\x68\x93\x43\x08\x83\xd9\x56\xd0\xcd\x4d\x91\xd8\x5a\x85\x23\x55\xd6\x37\x9a\x12\x35\xda\xdd\x4d\xbd\x94\x8d\xb2\x65\xed\x28\x1c\x2b\xf3\x5e\xb3\xe8\x28\x85\x35\xa5\xa9\xeb\x75\xa0\x6c\xd6\xeb\xec\xe6\xa0\xd9\xdb\x6a\xd0\x8b\x38\xc0\xfb\xca\x54\x19\x3b\xf9\xa3\x61\xe0\xb9\x3c\x34\x36\xf9\xa3\xd9\x03\x8c\xed\x02\xbe\xac\x37\x80\xaa\x2d\xa4\x6a\xd1\xd0\xf7\x2e\x68\xe0\xc8\xe8\x53\x23\xa4\x16\xce\x76\xba\xd2\x84\x88\xcb\x93\x8b\x43\x5f\x6f\x1d\xa9\xad\x06\xba\x5a\xea\x6d\xfa\x94\xa1\xf6\xb6\x55\x66\xd5\x40\x08\x17\x3b\x38\x03\x78\x34\x03\xf8\xb2\xcf\x78\x22\x1f\x30\x1e\x43\x03\x15\x54\x6f\x9a\xba\x24\xed\x99\xf5\x1e\x4c\x6f\xbe\xd6\x5e\x37\x85\xa1\xd4\x19\xc8\x73\x9d\x28\x08\xfb\xe1\x41\x92\x78\x7f\xdd\x54\x46\x92\x10\xca\xd6\xb8\x59\xc0\x06\xe7\xa1\x75\x18\xf1\x4b\xdf\x13\x94\x91\x28\x59\xe6\xdc\x1f\xb3\x82\x5a\xac\x4b\xa4\xd3\x0a\x42\x55\x93\xe4\x0d\x61\xf9\xac\x22\xa8\x22\x25\x11\x8e\xbf\x5e\xeb\x9a\x34\xf1\x76\x43\x79\xcf\x1c\x0a\xc5\xe1\xf2\xb8\x5c\xb6\x7c\x6d\x30\x11\xdd\x65\x84\x8d\x25\xd0\x5a\xa1\xc8\x2d\x81\x7d\x2e\xf8\xea\x40\x12\x09\x2f\x1a\x87\xfb\xd6\x41\xe5\x16\xc4\xb2\xd6\x5c\xab\x03\x51\x22\x5c\x3f\x42\x0d\x4d\x96\xb5\x65\x24\x74\x34\x59\x9a\x50\xf4\x9e\x9c\xef\x61\x43\x4b\xde\x89\x5a\x82\x2e\xc7\xcb\x28\x45\x44\x7b\xdf\x5b\xec\x6d\x16\xb4\xb6\x6a\xad\x5a\x1d\x11\xb6\xe6\x74\x5b\x6a\x01\xb8\x13\xb0\x21\x57\xee\x01\xfd\xb1\x8e\x1c\xa5\x25\x1e\x41\x8f\x50\x43\x72\xaf\x27\x2e\x97\x7e\xe4\xb7\x84\x91\x00\x7a\xb4\xf4\xb1\xe5\x10\xca\x63\xa0\x63\x80\x35\xef\xef\x45\xad\x3a\x81\xdd\x02\xad\xa9\x00\xe9\x2e\xda\x3b\xbe\x36\x6a\x8f\x49\xbe\xe6\xb5\x71\xb7\xdc\x08\x4c\x95\x40\x5d\xe7\xeb\x80\x7f\x41\x4b\x95\x64\x91\x58\xef\xa3\x21\x70\x39\x16\x0d\x17\xdb\xd8\x4b\xdf\x0f\x40\xb7\x26\xa0\x5b\xfb\x21\x30\xaa\xed\x7c\xdd\x75\xba\x41\x57\xd5\x26\xaa\x4b\xef\x0b\x73\x5f\xd3\x46\xf9\x89\xbb\xea\x0a\x81\xa1\x49\x92\x07\x7b\xe4\x2f\x34\x2d\x3f\x76\x57\xdb\x6d\x53\xc0\xfc\x03\x3d\xb2\x11\x42\x15\x20\x20\x5d\x21\xf2\x94\xd1\x44\xb4\xd7\x7b\xd0\x2d\x55\x03\x5a\x99\x72\xd6\x9d\x1e\x18\x28\x79\x09\x1a\x02\x5d\x5d\x70\xb0\xa1\x28\xdc\xa8\x2a\x68\x68\xb7\x2f\x00\x83\xc4\x2e\x4d\x5d\x6a\xd5\x0d\xbb\x33\x30\x50\xeb\x1d\x1e\x14\xd0\xda\x48\x2c\x4d\x27\x93\x55\xaf\xbf\x99\x8d\x27\xc0\x79\x03\x62\xd4\x61\x06\x4d\xa6\xa5\xa8\xc0\x1f\x69\x49\x0c\x52\xa4\x7c\xbd\x29\x85\x85\x96\x3a\x64\x0f\xc7\xea\x72\xcd\x49\xed\x4e\x4f\x34\x7d\x7d\xb9\xe7\x04\xd1\x19\x1f\x79\x1e\x7b\x52\x2d\x6d\x0a\xb9\xeb\xef\x0d\x19\x18\xa9\x13\xa7\xb6\x0c\xd7\x6d\x7d\x3c\x51\x0f\x80\xe1\x80\x37\x6d\x80\xcb\x8b\x15\x29\xbb\xa4\x5a\xfb\x01\x2f\x80\xd5\xb0\x05\xdc\x22\xf8\x0c\xe8\x6b\x20\x98\x8c\xac\xf8\x43\xbb\x8a\x2d\x07\xd6\x5e\xd6\xea\x9d\x41\x73\x2d\xc9\x50\x84\xfc\xe1\x70\x01\x47\xbb\xde\xe8\xf4\x06\xb6\xa7\xc8\xe5\x02\x2b\x70\x2e\x2f\xf1\xde\x5a\x90\xa5\x01\x18\x59\xc7\x1f\x40\x3b\xc5\xd3\xe1\x0a\xaf\x75\x39\x69\xc2\x1e\x2c\xa2\xc5\xc4\xde\xa8\x04\xfe\x01\x6f\x14\xb6\xd5\x91\x65\xcb\xa8\x0d\x0e\xc2\xbc\xce\x8f\x78\x6f\xb5\x96\xf9\xc1\xc4\xda\x44\x86\xa1\x88\x6a\x71\x5a\x3b\xd6\xfc\x75\xa0\x8d\xe4\x01\x63\x47\x73\x43\x3e\x88\x87\x69\x9d\xac\xf9\x6e\xa0\x8b\xf2\xc4\x0e\xf1\x12\xc0\xf4\x8e\xc0\xa4\xa8\x86\x3b\xbe\xe9\x01\xc3\xdd\x61\x5a\x60\x21\xe2\x81\xe1\xbe\x07\x94\x2e\x9c\x15\x5f\x07\xbc\x32\x2d\xbd\xcb\x58\x60\xc4\x0f\x7c\xd5\x0e\xea\xab\x26\xa0\xde\xb2\xc6\x90\x7a\xe0\x07\xf2\x80\xa7\xd0\x02\x8b\x97\xd1\x8d\xac\xcf\xa1\x83\x28\xd4\xab\x80\xaf\x4d\x1f\x8c\xec\x60\x00\x6c\xc6\x5a\x4b\x28\x8a\xc0\x92\xe5\x9b\xbe\x3f\x1d\x80\x47\xf6\xdc\xa9\x35\xe1\xda\xb4\x46\x7d\x6d\xb3\x43\xa5\xd1\xe3\x96\x2a\x0b\x97\x58\x8e\x69\x2c\x63\x0a\xc1\x3a\x2b\x2e\x96\x0d\x4f\x19\xd6\xc1\xf4\xb1\x9c\x56\x4b\x84\xd4\xf1\xbc\xdf\x5a\x4f\x01\xcb\x6d\x30\x60\x63\xb9\xc0\x82\xf9\xed\xd4\x82\xb0\xd9\x1a\xc1\x89\x40\x1a\x73\x30\x15\xc5\x7c\x7d\xb2\x04\xf2\xa9\x8f\x65\xb5\x48\x63\xfb\xd0\x37\x14\x3b\xa8\x4e\xa7\x64\x6d\xdd\x01\x26\xb0\xaa\x82\xb9\x0c\x66\x48\x70\xd4\x80\x8f\xd8\xdd\xd5\xd8\x1d\xb7\x63\xf6\x51\xad\x6b\xeb\x32\x27\x7a\x84\xc2\x49\xcc\x92\xd1\x19\x8b\xe3\xc0\x60\xf6\x20\xdf\x25\xd9\xf3\xf6\xc0\xd8\xc7\xa3\xcc\x71\xab\x9a\x0b\xbc\x00\x41\x95\x65\xec\x05\x40\x03\x14\xba\x11\x00\x38\xf6\x0c\xf6\xfe\x1c\xb9\x16\x8d\xc4\x5b\xa0\x2f\xdd\x8d\xc4\x83\x40\x08\xb1\x1b\x01\xa8\xe1\xfc\x1d\x5c\xbb\xc3\x5a\x6d\xa9\xd3\xc2\xd0\xe3\xa1\xd9\xdb\x64\xd6\xd0\xde\x66\x6b\x13\xd9\x83\xfb\x0d\x96\xc6\xc5\xfb\x0d\x1d\x30\x8d\xf1\xb3\xf9\x42\x8b\x9f\x21\x84\x1d\x1d\x90\xe6\x5d\x6e\x4e\x74\x74\xf9\x66\xc3\xe2\x3d\xcf\xb0\x72\xa8\x45\x41\xa0\x81\xa9\xe7\x6e\x22\xe8\x3a\xa8\x45\x8a\x24\x01\x0f\x03\x30\x11\xb6\x3b\xaf\xc1\xf4\xcb\x8d\x3a\x89\xc7\x93\x3b\xec\x10\x0f\x79\xa0\xd0\x19\x76\x51\x75\x1b\xbd\x5e\x6f\x20\x1b\xf3\xa6\xec\x17\x05\x91\x47\x08\xa1\x08\x79\x52\x57\xe8\x89\x96\x33\xaf\xb1\x02\x98\x97\xc0\x3f\xf4\x81\xb2\x15\xa5\xc9\x72\xad\xe8\x64\x4b\x14\xec\x89\xe3\x38\x70\x09\x18\x81\x67\x1e\x6a\x98\x3d\x4c\x1c\xa0\xd5\xd7\x90\x98\x9e\x65\x3b\x51\x77\xa8\x62\x6d\x03\x28\xa2\x78\x20\x60\x2a\xa0\xd2\x0b\xc1\x08\xb3\x82\xb8\x06\xcf\xea\x42\xa7\x2b\x2b\xa2\x04\xd6\xf7\xbd\x31\x07\x92\x50\x5f\x12\x4e\x2b\x6c\xc3\x6e\x16\x0f\x73\xa7\x0b\x7a\x73\x84\x5d\x0f\x23\x01\x20\x95\xbd\x03\xf6\x02\xa0\x88\x88\xaa\x4b\x02\x15\xd6\xee\x82\x96\xb9\x5d\xd5\xd2\x56\x60\xe1\xe2\xed\x9d\x2e\xab\x63\xbf\xdd\xe7\x08\x33\x16\x5e\x8e\x07\x6e\xfd\x90\xc3\x52\x00\x3c\x2f\xcb\x9a\x4b\x50\x64\x8a\x1c\x9a\x14\x78\xdf\x46\x1a\x02\x53\x4e\xd6\x0d\xbc\x9d\xc2\x03\xe6\x02\x8f\x0a\x03\xcf\x5b\x0c\x98\x6e\x7b\x82\xc7\xce\xcd\xa0\xb7\xd1\x93\x59\xc5\x4b\xcb\x00\x88\xd1\x00\xc1\x39\x35\x96\x83\xb3\x0a\x9b\x73\x00\xd8\x93\x81\x73\x68\x2f\x0d\x08\x2c\x20\x60\xcf\x6f\xc9\x10\xd8\x75\x1c\x30\x05\x05\x75\xc2\x63\xb8\x01\x80\x03\xcf\x10\xd2\xd8\xef\x53\x06\x22\x46\xda\xc2\x6b\x0a\xdc\xeb\x92\xe0\xc0\x28\xc3\x01\x02\x06\x5f\x40\x4a\x31\x30\x68\xc8\x5a\xce\xd1\x60\xa9\x18\x41\x33\x41\x8a\x1a\x92\xa0\x89\x5c\x65\xe1\x46\x0a\xd7\xc7\x6e\x45\x4b\xe8\x0b\x4d\x77\x47\xd0\xc0\x8b\x90\xea\x8b\xa6\x68\x71\x40\x67\x33\x8c\x6e\xcc\xd7\xc5\xc3\x6a\x72\xe0\xaa\xb5\x55\x53\x9c\x88\xb4\x38\x00\xfd\xb5\xdb\xf3\x9a\x68\x2f\x9c\x46\x38\x19\x37\xeb\xba\x24\x93\xca\x60\x0f\x74\xe8\x48\x72\xb7\x18\xe1\x0a\x8c\xa6\x24\x65\x0d\x99\xf0\xf6\xbb\xe2\x41\x1a\x2f\x3d\x6f\x29\xb7\x45\x7d\x7d\x20\x8d\x70\x07\x37\x1b\x41\x13\xcc\x8e\xe7\xf8\xa3\x25\x81\x39\xc3\x2e\x9a\x90\xaa\x39\x33\xf0\x19\x81\xdb\xed\xba\xcc\x7e\x0a\xbc\x9c\x02\xdb\xc4\xfe\x32\x67\xed\x84\x3d\x3d\x3c\x12\xee\x12\xe8\x78\x8e\x3f\x30\x87\xa1\x5d\xb3\x3a\xfc\xbc\xb7\xb6\xd4\x96\xdd\xb3\x58\x79\x5a\xaf\x36\x59\x9a\xe9\x2c\x64\x8a\xb0\x77\x5b\xaf\x13\x32\xb5\xa9\xb1\x27\x9b\xcd\x81\xc5\x72\xf5\x26\x58\x16\x00\xd7\x38\xac\x1c\x78\xaa\x00\x1c\x08\xb2\xbf\xe9\xf0\xad\xde\x72\xe2\x54\x2d\xec\x86\xd2\x70\x37\x14\x98\xfd\x4b\x8b\xb0\x9a\xb6\xa0\xf6\x64\xba\xb7\xd8\x65\x07\x7c\x8b\x1f\x2e\xe7\xc2\x88\x2f\xc4\x3b\x4f\x6d\xa0\xee\x99\x32\xe8\xc6\xa0\x86\x10\xda\x4d\xbb\xa9\x78\x45\x00\xdb\xa9\x9e\x60\x19\xa0\xb9\x53\x3f\x1c\x13\xb7\xc2\x60\x67\x91\x63\xe6\x7d\x85\x32\x46\x40\xd5\xcb\xbd\x5d\xfc\x4d\xaf\x8e\xb7\x4c\xb5\xa5\x87\xbc\x32\x57\x2f\xd1\xd5\xa1\x75\xe8\x2e\x3a\xc5\xca\x88\x39\xf6\x46\xcb\x12\x6d\xac\xda\x1b\xcd\xdc\x85\x9a\x6a\xb9\x8a\xdd\xf5\x69\x83\x10\xb4\x90\xdf\x8b\x72\xae\x99\x9f\x4a\xa3\x5d\xcb\x5a\x9a\x8a\xb1\x22\x1b\x32\x7d\xf4\x16\x08\x61\x3e\x9f\x5b\x57\xaa\xb5\x68\x9b\x97\x6c\x32\xb7\x70\xf7\x25\xe0\xb0\x47\xfd\x88\x2c\xe7\x42\x79\x56\xe9\x2c\x2d\x26\x64\xea\x43\xd6\xc8\x5b\x9d\x7a\x9f\x0e\xa5\xec\x9a\xeb\xcb\xec\xa1\x32\x0e\x98\xbc\xbc\x6e\x79\xe1\x24\x3f\xa1\x72\xe6\x8c\xb4\xb1\xbf\x9c\xdb\xe4\x75\xab\xac\xd4\x73\x85\xd2\x42\xca\xfa\x7d\x57\xab\xf3\x2d\xc9\x5a\xce\x56\x6a\x33\x5f\xa9\x6a\xfd\xf5\x1e\x2c\x7a\xfe\x5c\xeb\x0c\x5d\x4e\x2f\x04\x82\xb3\x94\x3a\xcb\xc3\xbe\x6c\x37\xbd\x8d\x55\x30\x5a\x5b\xb2\x27\x37\x2a\x6a\xa1\xa2\x67\x31\x85\x75\x73\xbb\xd6\x4b\x0a\x35\xad\x19\xd5\x45\x3b\xb7\x6e\x1c\xa3\xe1\x6c\x31\xe1\x27\xfb\x56\x4e\xb5\xeb\xe6\x71\xe1\xcd\x37\x95\x46\xc8\x29\xc6\x80\x15\x34\xbb\x41\x8c\x23\x29\x97\x77\xcb\x05\xa7\x5a\xa7\x46\xb9\xec\x7e\xa9\xe8\xf2\x6a\x9a\xe5\x31\x42\x75\x7d\xdc\xe6\xf6\x23\xab\xe7\x8d\x6a\xf5\xec\xbe\x24\x76\xd7\x03\xba\x9b\xf5\x80\xc2\x13\xf7\x9b\xf1\x74\x57\x2a\xb5\x8c\x82\xe6\xba\x23\x77\xd3\x52\x97\xd3\x52\x81\xa8\x34\x1a\xc4\xb2\x2e\x0b\x5b\x66\xd8\xf7\x77\xb3\x9e\xc8\xf4\x0f\x62\x9f\xd1\x29\x2c\x36\xcb\x95\x59\xdd\xb1\x54\x03\x8c\x56\xcb\x19\x54\x65\xa1\x50\x28\x17\xbb\xa5\x4a\xbd\xc5\x2d\xf6\x74\xd6\x2f\xaa\x55\xc9\xa0\x4a\x53\x71\x3b\x3c\x4c\xdb\x2d\x20\x6f\x05\x59\x21\x17\xed\x6d\xc1\xf1\x7b\x73\x65\x74\x24\xc2\x6c\xd5\x5d\xd5\x48\x03\x5b\x5f\x7e\x14\xac\x3a\x45\x09\x88\xdf\x84\x24\xa7\xf3\xb2\xde\x18\x19\x44\x4e\x74\x35\xab\xc7\x18\x7b\xfd\x30\xd9\x75\xa0\xc7\x19\x28\xf9\x59\x57\x9c\x29\xc0\x2d\xb0\xe5\x40\xa0\xb3\x51\x7f\x1d\xad\x3a\xe3\x76\xcf\x9c\xf4\xea\xd4\x72\xbc\x95\x64\xdc\x65\x9f\xea\xb7\x72\xf3\x25\xe7\x14\xd4\xda\xb0\x47\x8f\xda\x75\xb9\xaf\xe8\x4d\x29\xbf\x95\x3b\xe4\xdc\x9b\x8b\xf4\xa2\x51\x73\x56\x87\x49\x8e\x1a\x15\x5a\xa5\x65\x3d\x14\xe7\xd3\xc9\xa8\xdc\x25\x0a\xe3\x6c\x9e\xcb\xd5\xfb\xeb\x16\x39\x30\x80\x25\x52\xef\x63\x05\xcb\x1f\x1b\x60\x41\x17\xd9\x7e\xd3\x5e\x4d\xaa\x52\x54\x6a\x9a\xad\x6d\x6e\x56\xe8\x45\x47\x76\xef\x8f\x8e\x8a\x32\xc8\x72\x32\x3f\x6f\x4c\x67\xeb\x3a\xad\x32\xec\xc0\xb1\x4b\x54\xbd\x35\xef\xd2\x5e\x6b\x9b\x9d\x4f\x75\xc6\x67\x5a\xd0\x77\x98\x20\x84\xe5\x3a\x15\xa8\xcc\x94\xee\x4a\x3a\xc3\xae\xc6\x51\xa9\xc4\x1d\x15\x86\xcd\xb6\xc3\x86\x3e\x36\xb3\x03\x7a\x9e\x1d\xb0\xe4\x6e\x9e\x53\x82\xd6\xa8\x0f\x1c\x0c\xa3\x59\x76\xad\x91\xc9\x18\xa3\x70\xd0\xf3\x6a\x12\xbf\x02\xee\x33\x80\xed\xcf\xf7\x08\xa1\x38\x1c\xca\x4b\x61\xa2\xb4\xa6\xbd\x9a\xdc\x2f\x8e\x69\x86\x0f\x6c\xbf\xe5\xf1\x8b\xa9\xc5\x50\xbb\x16\x30\x60\x44\x7e\xef\xb6\xaa\x6e\xb9\x46\x30\x45\x8b\x9f\x86\x56\x41\xa5\x95\x90\x69\x37\xa3\xa0\xc3\x96\xb2\xb3\x79\x49\x12\xda\x5b\x79\x82\x3d\x7a\x23\x0a\xab\xbb\xda\x8c\x74\x8f\xf2\x51\x24\x6b\x65\xaa\x4b\xce\xa9\xde\x21\xa2\xcc\x52\x91\x05\xcc\x11\x09\x91\x09\x81\xcb\xde\xee\x77\x7a\x56\x4b\xac\xb4\x86\x5c\x69\x5e\x9b\x32\xc5\xa5\x14\xb6\x6b\x5d\xa1\x5a\xd0\x99\x82\x3e\x1a\x6e\x2d\x11\xef\xc1\xf6\xf5\x7c\xcd\xa9\x54\xf6\x93\xfc\x60\x64\xe7\x3a\x8d\x61\xb9\xca\xbb\xc5\xc9\x6a\xab\x8e\x07\xcc\x68\x37\x5c\x0f\x85\xc5\x61\x37\xa8\xb0\x41\x30\xdf\x58\x43\x8a\x11\x46\x61\x7f\x60\x0e\xf4\x65\xc0\xf4\xac\x6a\x6f\xae\x8d\x78\xf1\x10\x4c\x07\x05\x82\x43\x08\x97\x5d\x7f\x6a\x44\x93\xc5\xa4\x04\x66\x64\x5e\x5a\x98\xd3\xbc\x54\x29\x58\x4d\x43\x75\x66\x43\xe0\xa3\xb9\x6b\x09\xac\x7f\x7e\x21\x3f\xe7\x0c\x9d\xdb\x39\x16\x5d\x9a\xe9\xda\xec\xe8\xb8\x83\x0e\x63\xa9\xec\x72\x5e\xd2\xb3\x33\xbd\x6a\xd5\xb2\x58\x0e\x67\xbb\xea\x74\x76\x34\x41\x97\xf4\xb6\xdc\x0a\x81\x74\x0f\x98\x60\x34\x5d\xac\xe6\xb9\xcd\xb4\x7e\xc8\x6f\xc9\xc6\x32\xef\x8f\x8b\xb9\x7c\x54\x08\x36\x93\x32\x39\x2b\xfa\xc1\x4c\xeb\x50\x83\xfc\xa4\x3b\x3e\x54\xca\xec\x4e\x8a\x34\x6e\x37\xaf\xcd\xb1\x7d\x38\xd9\xf4\xcd\x6d\xb1\x67\xe6\x68\x45\xad\x0d\x24\xdd\x12\x82\x71\x48\x1b\xe6\xec\x38\x27\x47\x60\x75\x21\xab\xfc\xbc\x00\x7c\x12\xa7\xaa\xf2\xdc\xae\xa0\x65\xb5\xfe\x6c\x29\x78\x61\x3e\x6a\x32\x1b\x33\xbf\x6d\x29\x3d\x7b\x9e\xb7\xd4\xbc\x53\xc4\xda\x26\xdf\x17\x67\xcd\x25\x70\x69\x89\x3e\x23\x96\x8b\xfd\xbe\xd1\x2e\x59\x65\x4f\xa7\x84\xc8\xec\xd6\x04\xe1\x28\x0c\xcd\x79\x6f\x4b\x59\x2d\xaf\xd6\x66\xfb\x53\x57\x9d\x6e\xfb\xec\xa0\xd9\x06\x0f\x56\x84\xa6\x4d\xd8\xf0\x18\xc8\x8a\x2c\xef\xf8\x12\x76\x6f\x1d\x6a\x91\xdd\x8e\x0c\xa9\x34\xf6\x97\x14\xd9\xb6\x25\x62\xa0\x2e\xfa\xcb\x03\x98\xdb\x8d\xb5\x26\x71\x44\x4e\x0e\xe5\x9e\xa1\xd1\x66\x91\xed\xf9\x25\x9e\xd0\x39\x9b\xa0\x19\x2f\x37\xb2\xaa\x65\x65\xcc\x74\x6c\xa3\x38\xcf\x31\xe5\xa6\xc9\x22\x84\xdd\xa5\x5f\xcc\xed\x01\xef\x38\x85\x6f\xf3\x72\x73\x99\x3d\x6c\x9b\xc5\xc1\x91\xec\x76\x8b\x4e\x73\x16\xb1\xb9\x62\xb3\x03\xc6\xac\xd5\xed\xad\xfb\xa3\x8e\x69\x30\xee\x41\x5d\x14\xf9\x90\x18\xb0\x4b\xa7\xe5\xdb\xe2\x64\xd2\x58\x0d\x28\xce\x93\xf1\xf1\x47\x7d\xc2\xb8\x51\x96\xb0\xda\x03\xb6\x26\x70\xec\xca\xa7\x06\x92\x34\x50\x72\x64\x34\x8f\x94\x2a\xdb\x92\x7c\x60\x6c\x96\xa9\x63\x9e\xf6\x74\x2f\x60\x8b\x94\x37\x2d\xad\xd9\xc2\x81\xf0\xfa\x0c\x98\xa1\xde\xbe\x41\x15\x76\x63\xd7\x6a\x36\x66\x58\x7d\xed\x6b\xbd\xa0\xec\x98\x8a\xce\xae\x49\x61\x9f\x57\xb6\xdc\xba\xc2\x5a\x6a\x31\x5f\x61\xf6\x9b\xc6\xa6\xdf\x6d\xe7\x4a\xc0\x4e\xaa\xd1\xfc\x61\xd7\xf2\xd7\x8d\x1a\x33\x05\x1e\x0b\x11\x2e\xc6\xda\x86\xe9\x02\xef\xd1\x68\xeb\xc1\x66\x26\xef\x7a\x1d\xbc\x89\x61\x57\xd5\xa2\xcd\xd0\xc5\x32\x23\x03\x9d\x5a\x74\xbb\x6c\x67\xaa\x5b\xa3\x6a\xb9\x21\x0e\xd7\x2d\x7a\xbb\x2b\x73\x0b\xc6\xe1\xf8\x3e\x58\xeb\x44\x67\x9a\x63\xfa\xbb\x7e\xaf\x25\x38\x95\x3d\x5c\x46\xfb\xee\xca\xdc\x52\xe6\xc4\xcf\xe7\xa7\x16\x5e\xe8\x77\xf9\xea\x76\x76\x2c\xba\x87\xfa\x32\xef\x1d\xfa\x65\x79\x24\x84\x5c\x6f\x7b\x04\x1e\x64\x7b\x60\x13\x1e\xa9\x17\xbb\xc7\x90\xea\x51\x7d\x8b\x9a\xd3\x0c\xd7\x6c\x81\x6f\xea\x7d\x42\xed\xae\x0a\x7b\x82\xad\x5a\xe3\x59\xa3\xb4\xa1\x46\xd1\x61\x86\x17\x7a\x7d\xd8\xdc\xc8\xcc\x61\x30\x67\x6b\x39\x67\x2b\x0e\x99\x28\xb2\x98\xe2\xa8\xaf\x4d\x14\xa6\x62\xa9\x52\xa0\x4c\x18\x09\xac\xc6\xd9\xea\x9e\x2e\x0d\xf2\xb9\xa0\x5c\x6a\xec\x25\x69\xad\xb8\x2c\xc1\xba\xd2\xa6\xe3\x78\x8b\xda\xa2\x11\x91\x56\x15\x1f\x2e\xac\x56\xdb\xcd\xb4\xdc\x69\xba\xe1\x42\x5c\x17\x26\xcb\xa3\x78\xac\x8b\x45\xaa\xc7\x37\x9d\xde\x66\x36\x99\x98\xc7\xfd\xc4\xdf\x16\x6b\xc0\x1b\xb4\x5a\x63\x27\x9a\x4d\x6b\x72\xd4\x65\x98\xd5\x5a\x22\xf6\x03\xaf\x4a\xc8\x6d\x7b\xea\x15\xf4\x5a\x61\x80\x9d\x47\x9a\x5b\xc9\x64\xc4\xb6\x99\xa5\xc2\xf5\x80\x17\x3b\xd7\x96\x39\xa6\x93\xcd\x31\x3b\x91\xe3\x0c\x07\xf8\xcf\x4c\x47\xaf\x2d\xc4\x92\xb7\xd3\xca\xf5\x71\xf5\xb8\x35\xab\xb6\xb2\x3d\xae\xb4\x88\x8a\x6a\xb4\xd6\x2e\x78\x46\x97\x94\x05\xa7\x5c\x1e\x61\xd7\x8c\x07\x26\x92\xb2\xdd\xcc\xd6\x15\x99\x1b\xb1\x51\x67\x37\x66\x06\xa0\x8f\xbb\x7a\xd4\x75\xa2\xa3\xa8\x36\xb6\x4c\x55\xe6\xf2\xa3\x7d\x7b\xbc\x58\xdb\x43\x26\xdb\x53\x98\xce\xfc\xa8\xaf\x79\x6b\xa8\x33\xbd\x9d\xc7\x59\x5b\x63\xb4\x0f\x47\x8d\x36\x76\x1e\xf9\x5a\x31\xeb\xf5\x34\x2a\xdb\x67\x9a\x65\xdd\xee\x0f\xf4\xa9\x55\xf2\x7b\x72\xb6\xbd\xd8\x0f\xc4\x2d\x35\x5b\xb8\xb5\xcd\x22\x4f\x5b\xf5\xdd\x31\x4f\x12\x39\xad\x2e\x14\x8f\xf9\xbd\x35\x2a\x97\x4b\xa6\xe7\x4e\xa4\x36\xaf\x56\x0d\x82\xde\x35\x4c\x7c\xae\x27\xef\x8d\x85\x6e\x8d\x29\x71\xbf\x15\x77\x2b\x62\xec\x29\xd3\xd6\x70\xbd\x1c\x72\x05\x46\x1c\xe4\xdc\xcd\xd8\x63\xa4\x70\x5a\x82\x1b\xf5\x1d\xb6\xab\x8e\xc1\x94\x74\x18\x76\xb8\x1f\xe5\xc8\xbe\x3b\x5b\xb7\xd7\xe2\xb0\x5b\xd5\xe6\x53\x8d\xc0\x73\x59\x33\x03\x9f\xcd\x6b\x15\x7a\xe1\x6f\x26\xbc\xb2\x60\xb9\x2a\xd5\xd3\x8d\x69\xcd\xe7\x04\xde\xe2\xaa\x33\xbd\xd6\xef\xec\xca\xf0\x20\x59\xda\x8d\x68\x67\x25\xb9\x05\xc2\x71\x77\x81\xdf\xe9\xcc\xfb\x83\xa6\xb0\x28\x6e\x08\xbe\x3c\x0b\xa8\x2d\xf6\xa4\xd8\x95\xd5\xe9\x1a\x4d\x27\x50\x42\xdb\x5a\xa8\x73\x67\xb1\x31\x8a\x4c\x6d\x6c\x65\xa3\xe3\x74\x27\xad\xa6\xed\xfc\xa8\xd5\xf6\xd5\x85\x3a\x11\x18\x1a\x6e\x6f\x03\x75\x50\x9b\xad\x5b\x96\xc0\x28\x44\x79\x1a\x44\x62\xde\xd8\x47\x83\xae\xac\x63\x73\xae\xbf\x95\xf9\x7a\x99\x73\xb6\xc1\x60\xd8\xb2\x58\xd3\x9f\xef\x56\xdd\x49\x6b\x11\xd5\xd7\xae\x5f\x1c\xf3\x7d\x71\xcb\x9a\x25\x9e\xb5\xa5\xfc\xda\x6a\x69\x03\x66\x57\xa5\xdb\x66\xb9\xcd\x74\xaa\x9d\x79\x43\x03\x02\xc4\x38\x96\x90\x8d\x6a\x61\x01\xeb\xc3\xac\x7c\x68\xe9\x95\x03\xb7\x6a\xa9\xf9\x60\xdf\xee\x6f\x9c\xfa\x6a\xbf\x0b\xa7\xe3\x4a\x2d\x5c\x52\x4b\xba\x6f\x87\xc0\x5b\xe7\xca\xb5\xe5\x0e\xd8\x65\x15\xab\x85\x76\x49\x56\x87\x65\xb8\x20\x38\xa3\xd6\x51\xda\x6d\xcb\x3b\x96\x3b\xd9\x5a\x7c\xbe\x6c\xef\x64\xd6\x6a\xee\xb3\xc7\x86\xcd\xc1\x23\x5b\xe0\x99\x75\xfd\x1a\x19\xf6\x2a\x2d\x7f\xac\x1f\x78\xbb\xa2\x06\x64\x41\x76\x1a\x56\xb0\x89\x0a\xb3\x7e\x6b\xb5\x34\x5a\xc5\x2d\xbf\x53\xfa\x07\xa6\x31\x60\x9b\x7c\x55\x0a\x9c\x0e\x0c\x25\xc0\x1b\x92\x94\xc0\x88\xc4\x60\x9d\x6d\xed\x86\x21\x4f\x33\x2d\x25\xea\xac\x98\x6a\xb1\xbe\xea\xc9\x3b\xd9\xe9\x35\x95\x6d\x74\x94\xba\xc6\x22\x30\xd9\xd2\xcc\xee\x2c\x27\x4d\x82\x73\x59\xb6\x08\x3c\x01\x41\xcf\x97\x99\x8a\x17\xf2\x35\x67\x24\xd6\x79\x0e\x2b\xd8\xac\xae\x99\xc3\x2a\x47\xa8\x43\xbf\xdd\x58\x77\xfb\xbe\xa3\x0b\xb9\x52\xb1\xbd\x5f\x51\x81\xef\xae\x0f\xd3\x50\x6e\x4d\x86\x76\x0e\x1e\xee\x33\x02\x3b\x58\x56\x3a\x1c\xd3\xb3\xb5\x00\x6e\x37\x55\xb9\x6a\xb8\xf6\x3d\xaf\xbf\x89\x8c\x2c\x81\x3d\x7a\xce\xac\x58\x45\x9b\x37\x6c\x79\x6a\x8d\xdd\x01\xd3\xa4\xb3\xf4\x2e\x5c\xf2\x2c\x6f\xb3\x8e\xd7\x1d\x14\x05\x9b\xc8\x09\xa3\x01\x31\x58\x4c\x66\x8b\xfd\xd1\xce\x32\xe6\x66\x2a\x78\x9d\x05\x3f\x9e\x0d\x7a\xca\x31\x20\x0e\x15\x9a\x5c\xb7\xad\x0e\x15\x4f\xbd\xfd\x56\x53\x7a\x6b\x7d\xaf\x14\x5b\xc5\x65\xe0\x04\x0b\xfa\x40\x2d\x2a\x8c\x61\x09\xd5\x3d\xe8\x7a\x2b\x1c\xb7\xe7\x9a\x4e\x53\x9b\x75\xa1\x4c\x67\xbd\x8d\x68\x74\x59\xdf\xe3\x6c\x6e\xdc\x08\x8e\xd9\xc9\x51\x62\x72\xd5\x6a\x54\x2d\x33\xa3\xf8\xf4\x36\x3f\x27\x1c\xd0\x0d\xe6\xa8\xd7\xb6\x59\x31\x3b\x13\xc5\xee\xd2\x94\x27\xce\xc8\xd7\xf2\xb4\x3b\xa3\x86\x33\x77\xbd\x6e\x99\x1d\x73\xe9\xcc\x1b\xcc\x6c\x53\x02\x73\x87\x67\x38\xe0\xc3\xf8\xc2\x70\x19\xb5\xb3\xc2\x72\x50\x9d\x74\x76\x32\xb6\x1c\x24\x14\xef\xc1\x09\xa1\x5f\x26\xf6\x73\xbf\x42\x4a\x8b\xf5\x80\xdd\xe5\xf7\x74\x41\x37\xa3\xf5\x72\x31\xe0\x0f\x9b\x7c\xbd\xc2\x16\xbb\xd9\x61\xb1\x40\x48\xeb\x72\x6f\x6c\x5b\xa5\x5d\x0f\x18\x2c\x9b\x15\x61\xaa\xb4\x23\x54\xfb\x9e\xaa\xb5\x42\x84\xb0\xa8\xb6\xd7\x96\x36\xef\x1f\xfd\x2d\x2d\x0c\x69\xbb\x57\xb5\x9d\x5d\xb9\xac\xf8\x72\x69\x4d\x36\x7b\x1d\x5d\x63\x44\xa6\xc7\x8c\x23\x57\xe7\x56\x9e\xa6\x07\xcb\x3a\x2d\xd4\xc5\x52\x4e\x59\x85\xcb\xf1\x64\xd8\xad\x55\x5a\xc4\x50\x6a\x08\xbd\x15\x1e\xe5\xc3\xa1\x32\x61\xca\xd5\x6d\xb1\x0d\x9d\xb1\x61\x87\x1b\x48\x0c\x5d\x0f\xec\x68\x36\xee\x50\x8e\xae\xcc\x1a\xf9\x41\x7e\x94\xdb\x2a\x74\xa9\x45\xc9\x8d\xb9\xee\xb2\xea\x71\x31\x33\x0e\x9b\x31\x55\xb0\xda\xcc\x31\xd0\x09\x1d\x7b\x53\xf8\x7c\x99\x9b\x17\xfb\x06\x7c\x50\x3f\x4c\x16\xb5\x09\x7d\x10\x75\x30\x6d\x55\xca\xad\xeb\xde\xac\xb1\x9f\xec\xcd\x9d\xc0\xb4\x2d\x67\xc2\xfa\x6d\x69\xbb\xdb\x2d\xb3\x52\x6f\x5e\x30\xbb\xf5\x83\xd4\x0b\xc9\x1c\x5f\xcb\xfa\x4a\x90\xdd\x18\x85\xde\x11\xbb\xb7\xf5\x9d\x6c\xc0\xed\x3e\xca\x2f\x50\x6d\x5b\xb4\x18\x39\xa7\x8c\x9d\x9e\x6b\x3b\xbc\xd5\x58\x15\xeb\xf9\x9e\xbe\x93\x17\xc7\x66\x69\xdb\x5b\x90\x51\x71\x1f\xee\x69\x31\xef\xb0\x72\xa5\xc8\x4b\x60\x29\x07\x02\xce\x32\x6e\x5f\x6e\xd0\x7d\x0f\x6b\x1b\x99\xf3\x5a\x40\x35\x4d\x4c\xa0\x89\x5b\x8a\x5d\xca\xed\x4b\xc5\xdc\xa1\x51\x6a\x1f\x81\x5f\x56\x98\x1e\x87\xc2\xaa\xd6\x77\xb7\x66\x27\xb4\x9d\x41\x63\x37\x8e\x63\x1f\xf2\xed\x41\xb5\xdc\xe7\xa0\x4f\x59\xb5\x54\x62\xb0\x59\xb0\xed\x78\x19\x3d\x9a\x2d\x5a\x2d\x2a\x39\x7e\x38\x66\x19\xc9\x61\xf8\xea\x1a\x78\xc4\x25\x76\xc0\x32\x1b\xc6\xda\x1c\x6b\xeb\x66\x3b\x72\x17\x8d\xbc\x60\xd0\xbb\x99\xe0\x69\xab\xde\x9c\xc9\x1f\xcb\x85\xf5\xc4\x1b\xf6\xdd\xca\x7c\xe7\xf5\x1a\x5e\x15\x28\x1d\x2c\x36\xda\x0e\xfc\x5e\x28\xd6\x1a\xcc\x66\x3a\x73\x1a\x5e\x7e\x66\x52\x51\x54\xaf\x4c\xa5\xaa\xc9\x54\x64\x57\xe6\xd8\x01\x30\x3b\x82\x1c\x39\xe0\xca\xcd\xed\x86\x83\xfc\xf6\x35\x89\x19\x70\x02\x45\x75\x5c\x3e\xdf\x2b\x95\xc7\x8c\xd6\x18\x8c\xf0\x89\x4f\xbf\xd9\xef\x7a\xa3\xca\xb1\xab\xe7\x1d\xaa\x67\x96\x46\xcc\xb8\xcd\x74\xd9\xcd\x6c\x54\xee\xa0\xe8\x8e\xfa\x71\x44\xf7\xc5\x32\xfc\xdd\xe3\xdb\xf5\x86\x46\x6d\x54\x6e\xb7\xe3\xb7\x24\x3f\x99\xd7\x02\x5b\x5a\x6a\x8c\xca\x28\x54\x29\x37\xc3\x87\x5c\xca\x6a\xa4\x4c\xb5\xc9\x31\xcf\xee\x26\xfe\x42\x52\x3b\x8a\x30\x5c\x94\x0c\x85\x68\xe5\x72\x96\x64\x8e\x0c\x7f\xcc\x03\xaa\x94\x5e\x2d\xec\xee\x05\x66\x31\x00\x03\x97\x65\xd8\xbe\x27\x97\x5b\x8b\xc2\x81\xda\x2d\xcc\x32\xb9\x08\xa7\x7a\x0e\xef\x2c\x8d\x7a\x83\xc9\xa8\x2a\x2b\xac\xcb\x2c\xbb\x55\x7b\x3d\xde\x6d\x18\xaa\xdb\xaa\x40\x8a\x78\x56\x60\x22\xe0\x18\x87\xb3\x30\x07\xbc\x83\x4a\xa7\x57\x21\xc5\x4a\x60\x94\xf9\xc6\x48\x69\xac\x8e\x5c\xa1\x23\xbb\xb3\x01\x98\x87\x87\x5c\x8d\xd5\xe3\x2d\x53\x60\xf6\x16\x74\xda\xb2\xe9\x63\x79\xc8\x74\xc3\x9c\x5b\xac\x75\xa7\x63\xaf\x52\x1d\xd3\xc5\x56\x9d\x64\xd9\xea\x66\xb9\x76\x76\xb9\xb1\x5a\xa8\x97\x06\xda\xa6\x3e\x16\x9b\x59\x4a\x55\x54\xaf\x3d\x6d\x05\xc6\x78\x41\x1d\x1d\xae\xa2\x14\x00\x5e\xec\x8d\xd6\x8e\xb9\xc2\xe0\x68\x8d\x15\x2c\xee\x39\x6f\xaa\xef\x0f\x5c\x71\x32\x1b\x6d\xb2\x44\x65\x6c\xe6\xf4\x52\xb1\xd8\xa2\xc7\x23\xa6\x2e\xd5\x5c\xa6\x40\x66\xc7\x4c\x57\xb0\x73\x83\xbe\xd7\xdf\xc9\x96\xcc\x2c\x99\x12\x59\xe8\x35\x68\x91\xc0\xa7\x15\x05\xa1\xda\xd8\x2e\x2a\x95\x4e\x67\x5d\x1e\xf5\x6b\x7a\x3e\xf0\x04\x65\x55\x07\xfe\x33\xa9\xb9\xcd\xf9\xd8\xd2\x4b\x53\xa6\x83\x83\xc5\x3a\xcc\x84\x1c\x6b\x83\x1d\x30\xd2\xfd\x63\xcf\x6f\x19\x59\xc1\xa0\x66\x3a\x6d\x8b\xbd\x22\x35\xc3\x27\x3e\xdb\x4a\xd6\xf5\xb6\x1b\x9b\xdc\x49\xdd\x3e\xb3\x20\x0a\x95\x6e\xbe\x37\xde\x1f\x97\xb4\x35\x2e\xe5\xfb\x2e\x5f\xae\x35\x19\xaa\x56\x70\x87\xeb\x7c\x89\xdf\x02\x72\xb7\xed\xe9\xac\x46\x07\xd5\x82\xd4\x6a\x31\x3b\xba\x38\x9f\x14\xdb\x0a\xa7\x15\x42\x7c\x94\xd9\x36\xf6\xd9\xe5\x11\xea\x43\x36\x3b\x9f\x1d\x2a\x85\x6c\xa5\x58\x50\xb8\x76\xbf\xc4\xe6\x73\x63\x67\xd4\xe0\xb6\x55\x5e\x88\x06\xf3\x91\x4b\x0b\x36\xd0\x82\x3c\xa3\x01\x3f\x65\x32\xea\x87\x21\x24\x7a\xea\x9b\x26\x19\x8d\x03\xef\x28\x63\xe5\xb0\xa2\xc9\x5d\x95\x54\x4d\x39\x5a\x0a\xb3\x70\xd7\x2d\xe4\xc4\x69\xbf\x47\xb4\xaa\xab\x79\x2f\x47\x3b\xaa\xe4\x05\xd1\x36\x17\xd2\x24\x35\x3b\x68\x66\x6e\xd5\xeb\x1a\x2b\xdd\xe3\x1a\x2b\x76\xec\xd8\x1b\x82\x1b\xd4\xd9\x89\xd3\x97\x73\x05\x61\x87\x95\x83\x4b\xb5\x73\xcb\x60\xd3\xef\x14\x07\x25\xef\x48\x47\xdb\xea\xe0\x90\xd5\x94\x7c\xe3\xd8\xb3\xb3\x56\xb7\xc1\xd0\x55\x85\xb7\x98\x9f\x10\xf0\xcb\x0f\x9f\x92\xbc\x70\x77\x22\xff\x74\x6f\xa5\xab\x51\xce\x50\x23\x18\x50\xf9\x12\x99\xfb\x28\xe7\x3b\xaa\xbd\x82\x41\x7f\xe2\x66\xf5\x39\x93\x27\x32\xcc\xc6\x82\x39\xf0\x0a\x19\xa2\xf4\x67\xaa\xf4\x67\x58\xad\x8c\x00\x3f\xef\x41\x8f\x32\x12\x38\x9e\x95\x83\xc9\x94\x6d\x6f\x75\xdb\x08\xf9\xb5\x50\xfc\x10\xa6\xfb\xb4\x42\xfa\xbe\x10\xc5\x2f\xe4\x7b\x90\x59\x76\x94\x6b\xf0\x4c\xf5\x16\x4d\xc5\xd0\x49\x92\xd4\x0a\x65\xbd\x64\x16\xd4\x59\xb9\xa8\x93\x5a\x5e\x25\x74\x2d\xaf\x11\xb4\x4a\x51\x6a\xd9\xd0\x67\x60\x59\x4d\x35\xf2\xc3\xff\x1b\x00\x00\xff\xff\x57\x48\x8c\x41\xfb\xf8\x07\x00")
+var _staticJsHtermJsGz = []byte("\x1f\x8b\b\x00\x00\x00\x00\x00\x02\x03\xec\\{s\u06f6\xb2\xff\u07df\x02u\ue328D\x96,\xf9\x95\xd8qR\u0671\u04dc\u0263c\xbb\xd3s\xc6\xf6\xf1\x85(HbC\x91:\x04eYm\xdc\xcf~\x7f\xbb\x00AR\xa2l\xf7\xcc\xed\x9d\u04d9\xabid\x12X,v\x17\xfb\xc2\x02j\xab%.F\x81\x16\x83 Tb&\xb5\x18\xaaH%2U}\u045b\x8b0\xe8\xf5\xe3\xb4\xd5\v\xa2\x96\x1fG\xbeL\x9bz\xd4\\k\xb5\u0107T\x8c\x00\xdcS*\x12c\x99|\x05x\xa2d\x7f#\x8e\u00b9\x18\u0109\x98\xc7\xd3Dh9P\xe9\xbc)\u0119LG*\xa1\x81\xe9HFB\xf5\x83T\xe0\xbf~\x90(?\r\xe7\r1\t\x95\xd4J\x8c\xe3~0\x98\x8b8R\"\x1e\x00V\xa1M\x03\x93\xafh,\u0468\x9bM\"\x80^-q\xbf\xe8\x16\x9e\x9a\xbf\u8976\x9bI\x1c\xce1(\xac\xec\xf4\xe30Nte\u05e0\xb2u\xac\xb4\x96Cu3\x96\x11\xfe$\xd53&j\xa0\x12\x15\xf9\x0f\x83%\xcapU\u0669\xd38\xc1\u0207\xfan\xfcQ\x12\x8f\x1f\x06\tc_\x86\x0fB\x8c\xd58N\xe6\x95 \xa9\xd2\xe9\x83\x1cL\xd3\xc1\xcbrG:\n\x92\xfe\xcdD&\xe9\xbc5\xf3gA?\x1d1\xe4\u0337p\xa3T%c\x1a\xcf\x0f\x95\x8d7\x83D:\xb6\x16\xba\xbe\xaay/\x96I\xff\xe1\xde\x1b\xe8j?\x88\x86\xfa\x110<\x8c\xe5\xe4q\xa0\x89L\xd1\x16U\x03\u01934\x88\xa3\x15SA\x12\xda\t\xaf\xb2\xef&\xe8\xab(\r\x06\x81JV\xe1X\xa5N\x8bp\u04de\x9e\xf6\xaa\xfb\xb4\x9f\xc0JW\xf6\xc5a\u0613\xfe\u05c7\xfa'q\x92V\xf7\xd3W\x1095[\xd1{\x13\u010f\x00h%\x13\x7f\xb4\n\xe8.\xbd\xc1*$Ao\n\xb5\xac\x06\xbaMW\xb5\x83\a\x19E\xab\x04\x87~\x7f$\x13\xe9\xe3\xed\xc6)\xc4\x1aA\x9e\x7f\xf9\xe9\xec\xf8D\x9c~\xf8x\xb2_\xe9k\x8e\xe3\xc9<\t\x86\xa3Tx~]t6\xdb\x1d\xb8R%\x8e\xc94\x83\xe9X|9\x17\xddi:\"'#\xbaa(\x18V\xc3Ob\xe9oU\x9f\xfd\xe8O\xdaz:\xb8`\xe3\x12\x84\x1f\xf7\x95\xc0\xeb0\xbe\x85\xe2\x19?,\xc5\xd1\xf9\xbb\r\x9d\xce\xe1\xa4\xc3\xc0W\x11\x86\xc1\x93\xa6\x02\xbc\xc1\t\xb3s\x8c\xa7Q_\x04\x11yM\xf1\xf1\xc3\xf1\xc9\xe7\xf3\x13\xf6\x98\u0375\xb5\u0694\xfc($\u89f5\x83\xb5\xb5` \xbct>Q\x98\x18\u0708\xef\x0eE\rc\xd5 \xc0l\xb5\xfa\x9a\x00\x8a$\x9e\x89H\xcd\xc4I\x92\u0109W{\x1f\xc6=\x19\x8au\x80\xaf\x8b\xb8\xf7\v\xbc\xb6\x90!y\xfc\xb9Pw\x81Nu\xb3V\a\xe6[\x990\xcaC\xf1\xdb=^[\u03df\xaf\x89\xe7\u24dc\x10\x93\xeb}5Q\x98'\xf2\xe7\xeb\"\x8d\xc5\xe5\xba\xe1x\xbd!\xe0\u052f\x9b\x00%\xe8\x13\xe9\x8fD\x0eJ\xa2\x90\u065c\x11\xbcC\x033|ULKs\xa018CC\x90\xc4\xfc4\tY8\x84\xcc\xe0\u0448(\xdce\xd0\xd0L\xad5\x1a\x9fLa\x7fc\xf5.\x9b-P\xfaf\x81\xf8\x8f\xe0\x8e\xa8\x1fL#\x9f\xad\xdd\b>RX\x190\xd1\xc3ZE\xb71\x05\xc0\xfe4\x81\xe3!\xfe\x13\x99\x80\xee(H\x03\x19\x06\xbfJ\x1aV\xe2N\x85j\f\xcb\xcfV\x8b \x8f\xa5\xb1C\xcc/\x93D2\xdbA\xaaU8\x00\xf7\xe9,\xde\xc8\xc6po\x93Q\u0656M#\"\rMKy\x95AD_\xc1t\x83\x1e=2\xdf3X\x80\r\xa9<\x9dH\xe2i\x8a\xf5n\b\xa8\xc6`\x1a\x12>\n\xdb}\u055b\x0e\x87\x18\x86\xa0\x9d\xe1og\x82\xf5-\x8dN\x16\xb9 \x17X8\x14\x97\u05f9\b\u03d4\x1f'}\xa2\xd1\u02bb\xb0\xbc\x99\\8\t1\xdalI\x12\xb3\x11\x92\v\xe4\x11HK@\x05d\xad\xee\xe0\x0f\xb5\u0173\xb1\x80H\x98\x05\xf7\xe3\xf1\x84R\x19\xea\x05\x0f\xc8S\x807\x8aI\xd6)Af\x8b&\xc1D\x18n\fB\xd5\x1f\xa21[4=\u05e9\x1a\x8b8\u0255\x87\x91\xa7p\x11_\xe1D\bcM\x8b_\xa6P\nJi\x14\xa1\x1bK\xe8#d:\x89\xb5\x0ez!\xb7\xb1 \t\xc4\"\xd2b\x16\xc0\x17LS\xa2=\xa2u\x81\xb4\x8cTa\xef\x99\x14\xbe\xe4j\x0e6\x81]O\x94O\x01\xa2/\x90m\x99\xb5\x857\x11\xa7X*u'\xc7H\x9b(\x1f2\x83\xe9\xc3J\x9db>\xafF\x8f&\u01e95\x04\xbf\xfd\xe8\xa2\xc9'\x13L\xc8f+&f\xdd&\x99ANI\x1c\xdb\\\x90P\xd40\xf7?\xb0\"c(\xe8\x94}\x10\xa9\x06q\xeb\x87D\xae\\\x10\x1b\xccNF\xf3\x82\u0659\xa5\x06\xd3a@\xaa5I\xe2!\">\xe3#\xedb\xfa\xe1\u0766\x89:[6M\xaf\x8eE\x86\x14\x90bL'XPB\x06\u0142f\x93r\xf0(c\x9c\x84iI\u0540\x009\ubb72I\xabr\xf4|\x8fh\f\x1a~3\xe2\xbd\x17pb72\x19j\xf1\x85\xd2\xd0\x04Ii\x92y\x0e]\xbd \xb9?!\xd1C\xfb3\x03\xf12\\u\xf1\x1b\xfc*\xb9G\xe3\xac`\x1cp\xb3P8j^v\xb8\xb4.\xe2\x1e\"I\xe1-<uW\xb7p\x8c \x85*v\xd9G\x1cB\t\x9a\xfc\xde\u05130H\xbd\xdaU\xc4k\x8a\x0f%\xe9\x918\x97\x03\x99\x04\rV4\xd8\xce4LI\xf5\n(fH\x8f\x05g\xed,\x9bN\u66e0~\b'\xac\xbf\x06\x19\xa5U\xb7A\x7f\x8a0`\xd9f\x05\x85\xd3\x18S\x8a\x04\xf7\x17\fX\xbb\x90\xcf7y\x10\x85\x99|\xa6f\xa8\xa2a:\x12o\x0e\xc5V\u018e\xc8b\xdea\x81\xa4\xcb\xceu3Q\x93P\xfa\xcak\xfd\xf3J?\x97\xe9\x95~\u0442\x0eg\xac\u0743H(\xdfC8\xda\v8\x86&\x80\x91\xad}_BEr\xa6\xb5 \xe7G\xab%\x02 \xda<\xc0\x9f\xd7\xe0o8eYX\xda\xd1\xfa\xe2Eq)\x90\x1c\x8e\x00\xee\xe0.\x83\xeb\x03\xc7:w\x06\x11\x88\x82\xc1\xc1\xf52a9\xe7N]\x9ar2\t\xe7\x1e\xde\x1b\x8c\xb0\x9aI\x9a\x8e\x1c\xd4!\xdb\\e\u0ea4\u0456\x00C\xc2w\x18Q\xb7\xef\xe2i\u00ed\xebv#\x9a\x93\xa9\x1eyF\xc4%\x99\x15B\xe4\t\x9b\x9e~\xc4\xf6H[`u\r2)\xda\x03\xde\xf9\x8a\xd3g\x13]\xa0\xffy\x8cD\xe2\x03\xff\x12\x01\xba\"b\x18\x95\x85k\n\xe3\xe1\xd0\xf8s\xd2\uefddcu#\x1d\x87\xec\xf6\a6\x1c\u04362\xe5\xfdd9\xa30\xc8\xd9}1\xbaD\x06\x10v\x91\xac\u0728W\xfa\xa3\x9b\xa2\xa5\xe7\x16>\x91Z\x83.\x88:\x99\x1aCw\xcaeuB\xac\xca=Jv\xce2\xe7\xf4\xe3p\xe5\x80\xe2\x9a\xd3 \xe3\xc0\x0fy\xa2\xcc'\x98\xd4,\xf7\tR\xf4c\x9f\x15\x96$F\u9d68\xcd`\xde\xf1\xac\x96Ezk.\xd6o\v3j\x16c\x9f\x0f\x03A\x00\u0330\x91\xcf\x06\xab5\xcaSjMG\x05\u0181\x06\xcf \x15\u07fe\t\xea\xb7\xdaSehLu\x95\x91Y5\xf6\x18\x00\xd6E\xb2\x03\xf2z\xde/\u072a\xcfd\x12y\xb5O\x01b0\\\xdczM\xbc0\xe2~!j\x9c\x1aRT\xe3H\x86p\x98\u02f6~\xe0\x10\xb9u\x1bHX^\xde\xdeC\x9e\xfb5{\xbd_\xb3\x0f\x86G|_f\xc4]/\xb8\x14&\xdd \xadWz\xf9\u06a9\fH|\x15:\ue3d4\xff\x95\xd6\xed\xbe\x98F\rA\xb0b\xeb)'\x97\xa5\x84,\v\xb1+@\x8c!f9+\xe4\x990\xda\xc4@\x99pJ\x99\x17[\x8f\xcd\xec\xa0\u0714\x8e\x9a1\x94\x19R\x12\x9b!\xb4\x06\xa4|\x15\xdcR^E\xe2G\x0e\xc4AU\x81\xdc\x06\xd0\x05\xfe\x88\xf0q\x9e\xea\u0195\xb3g\xce\xf6\x82\x94\x13\xb8\x10\xe38\xfd%,i1o]N\xa8\x17\xa37\xad\x86\xe8\xdal\u0624\xc1\xb0gP\xc6\x1d\x15)p\x96n\x0eL\xd2G\x9f<\v.\xce\xe0L={\xa8\xdf\xe7)\xf1\x03\x12'F\x13\xbbv\x06a\xa2\xd2i\x12\xe5\x18\xefMN\x94\xe1r\xa2+$\x16v\xfc\a\"\xbc\xe0u\u0306(\x1bi\xccb9\x1f7N\xfc\xb2\f|\u036aoI\xc9\x1aK\n\xf7!\xe3G\xb1\xd0l\x8e\\\xca\xd8y\xed\x97R/Kl\x95j\x97\"\x01R\fV\vV\x01\xce\x14\vCW\xe9o6\xff\x87r?\u959eGT\x18\x8b\xe2)%\xc9\x179\xcd\xd9&\xc0\xecX\xc9\x05Q\xf6J\xb4\xf1\u0387\xb7H\x11\xcb\xd6-ZA\xe1\x174-w\xf9\xf7\xd9(\x9a\xaa\xb8\u0716#\xa3\u04cbtfZ\x96iz\xb5\x92='\xec\x93\xf4\x06Q\xee4\xc3\u070d\x84)9\xc17\x17\xa7\xd3\xca\b\x92\x1dfy\xbaD\x85\\\xcc\x05\x1aa\v\x98\x94\xb1\x97wnE\x8d2\x1c5\x16\xe7\xce\u00dbI#\x96\x95\x8cc\f;v4\x7f\xa6\xa8\xb2\x14\x1d\x8dO$\x1d2\xbe\xbe^Jo\xe0B8\x99\x9a7\xf5(\x18\xa4^\xbd\x98\xca,\x92\xe3\xbc\xf3B\x87W\xa3\xe9\xf7\x05\xb9\x7f \xbc\u073cvh\xe8\xb5}\xedq\u0760)\xb1_\x19{\x19\xa9\xf5\xea\xa4\xcb\xc8\xc2+\xe6=\a\x99g\xb7\x05\x14\xab\x00TC\u0258\xad\xad\xf0\xf6Yh\x8aID\xb7X\xa2\xbe\xcb\x1c\xf7-\x1e\x1b\xa9\x1f\xce:<\x03\xa4Uz\x81.81\xc7FCl\x9a\x90\xf1`\xf9j\xb1,\x9e\u05f1:\x9b\xed\xbd\xbfH\r\u02fa\xa8\ufa57&\xb9\r \xe8\x1f-c\x9aM\xfc\xe4\x1c\xfc\xec\xbe\x10\x03%S\xceOg\u0295\x12\x80\u0318\x80\xa9\t\xa6\x13\xbd\xdfj\xf5\u056d\n\xe3\t\xfc\xee8\xfe\x15hd3N\x86-\x15m\xfct\xdeB\u02a4[?\xab^\xebo\xf2V\x9esPi\x9de\xdb\u95a9\x8f\u0758]\xb4n\x9ds,jMd\xff\x9c6\xab\\p\xfb\xce46\xb1\xe5McR\x9ef\xd6m\xac`ew\u044c\xf0>T\xe9G6\x1e\xda-\xf4\u0368\u030e(\xbf3\x01\u0396\x81\xc8)\xda2]\x18\xe3]\xc15\x0e1\x12\xbep\u0135!l\xdd\xe3\uf33a\x16P\x8b\r\xbbO\xb0)\x993\xdd\x12\xd0k\xe4oug[\x1cF\f9\x1e\x8d\xcdrN\xb3\x15\xb2\x84\x8a\xc3\xc3C\xe1j\x8d\xd9\xe0B7\xec\xb6VJV}\xa9M\xf4\x01\x10\xb13\xa6-,\u0726\xa0\xb2\xadf\xae\x9a\xd5\xe4\xbd\xc9\xf1f\xee\xa6b\xbe\x1c\x06\xfbE(\x8aWF\xd2ZF\x02\xc7\xd2\u0398\xb3l\xe70\x9a4\xdb\xdbl\x94\xc4IC\u0292aGr\xffg+\xdf\t\xa2\xc2J\xd5C\xe7j\xc5C\xe7\xff\xab\xdd\x7f\xbc\xda\x15\xd9\xe6\xdd\xce\xc3Z\xe8\xd4\xee\xe1\xe8P:\x17\xfd\u02deq\xd8\xf8\xf0\x99\xf6f\x13\xe9s\xa1J0k\x02Y?\xf6\u0148\xa4y\x12dx^\xa8\xfc\x9f\x06\x89Ni\xaf8\xa6\xdc<\x8a\xf8\x8c{8E\xe2\x90U\xa2y;5S5\xe4\xb3\xc3\xd8*6\x91\xc1\x14\xdaCu\x9b=f\xe9\xd9\xca\xcf\xd1Y\x17\v\xf2\x0f\xac\xcb\xf9\xc9\xc7\u04e7\x8c\xc0\xa7\xf1;>\u0367@~{s\xf3Z\xfc\xfe\xfb\x13@\xb7\xfe{cc\xa3\xb6\xd1z\n\u06ad}\xfa\\\xdd^=\x0e{\x18\x1f\x1a\xe0\xc6\x13\x80\xc57a\x81\x19\xfa\x81\x01\x17?\x9c\x88\xb3\x93\xf7?}\uc789\x93\xbf\xffxvr~\xfe\xe1\xcb\xe7\xf3\u01e7\u879d\x88\xe3/\x9f>|~_\xd84'\xaaF\x1b\x05\xa4\ts\u079e\xd2\xce\u07f80@CiT\"C\xda\x17\x88\xdc\x11S5>\xb83\x9a:\x1b\xcd\xe1\u0622\x1a\x97\x9e\xe6\xf1\xf4\xad\x10_F\xbc\u0341?\u053191(\xcd0K\x80\x946\xcd\xc610\x96~\xac4p\xf0\x89E\x02=cl\xd8\xc8\u0289*l~\xb0K\x92\xfd\x06\xe54:\x8d\xe3\x89)\x83A\xe7\\\u0773.\xc8\x18\xbe.*9\xfa\xf9\x88k\x8d]\xdd\xf1\xf9\xb9\x18\xa9;c\x19\r\xf1\xec\xec\xfd\x11\xf954\xb5w\xf7E\xeb\x99w)7\x06\x9b\x1b\xaf\xae\xebUO\xad\xa0\xb1\xb6\x02\xcf\xd9\xfb\xf7G\x19\xaa\xcev\t\xd5o\x9d\xfb\xfa\xea\x972\xced\xd8\xcbp\xe2\xd1K\x92\xa41\x1c\x0e\x1b\xbd^\xafN\xc8\u0476\xcf)\xf6\x99\x1a\x9e\xdcM<\xebi\xbd\xda?[\xfa9:\xf1\xdd\xf2\xf0\xe5\xb5\xfa\xbf\xb5\x1b[\xc0\xae\x9f7\x16\u07f1U\xc8v\x13\xb5\x85\xbe\x16}\xfdW-\xeb\xae\xe7E\xe5\xabVk\xd8\x10\xb5\xab\xabZ\x1d\x7f\x02|?\x89\ua1942\xa3\\>H\xba\u011f\x12e\x8f\xf2\xb1\xf0^\x1c\xec\xbd\u0777\xdd/\xf0\xd8j\xe2o\xfd-\x01\xd5\xff\r\x0eO\x02\xd2c\x01U\xa1\xad\f\xfet-Cw\x0f3\xf4\xf6\xff\x86\xa3\xb7\xff\x06K\xd8X\xff\xbd\xdd\x16\xeb\xa4O}|Z\xeek\x1d[\xd3pJ^\\\u0735\u06eco|\xa0@O\xb9\u07b6\x1b\xdb\xf7\xf5\xab\u05a3\r\xa0+\xd7\xef\x93h\x18\x06zd\xa3\x12\x15gh\x16\xfa\x8b90\xf0\xd7k\xfa\xc2\xe8+}\xfd\xa2\xd5(Vf\x8e\xe3\b\x813\x85\xe3\xb0\xea\xe6\x81\u0506\xfdW\xb7\x18\x99p\xf2\"1U\f\x89\xbfB\xbb;q\xe4\xb5$,\x85N[#\x1cFqb\n\xec\xb6\u00a3%6\x9a\xb4\xff\xef\xcbT\x8a\x11\xfcZh\x8bd\xeeh\xbb\x06\x02j\\\u0688#>\xe2\xe6\xd3\xfbH!\xc2\xc3\xd1\x19\x92\xf234x\xd2>\x9e\xc72\\}\x18G#8\xe7(\xd3Hd\xf9F\f\xe5\xa2Z6\x92\xc6,0M\xfa\x1aM\x91\xa6\x04&]5\x8d~<\r\xb3\xf3\u03bc6\u00d8M\xf1\xa7\xec>\x87\xbd\x8b\x98\xf0\x96N\xf9\x80\xc7d\u00ee,\x03\x7f\x1d*\xef\xd6U\xf4\xa9 \xfe\x89\xaa\xf2\xe3\x00\x03\x1a\xa2\xb3\xb3S\xc7d\x9d\x9d\xbdz3\x8dm*\xd7\u07b5\xb5\x06\u02cc\xa9U\xfc\x8a\u030e\x86l\x9b\x14n\xadT\x881\xab9\xa6\x93B\xaf\xec\xe5\x89\xd4;\x1eR>\v\xb2\xb8I\x10\x9cO\xda\xf7\x1a\xa94\x95M\f\xe5\x00\xbfl_S^Yk\x95[;\x95\xad[\xd7\xe5ju\xae\xa2\xa1\x1aJ\x7f\xee\xd6\x02\xad\v\xaa\x99\xe9p\xb3\u066cW\xe9(V\x12\xc1\x92\x0e\xd9i\xd1\xe8\xc4q\x9f\x9a\x91\x8b\xf6\xa8\xd4CA+\x8f\xeb\x1bo\u0430\xb9\xb9\xf9\x1e\xff\x8e\xf0\x8f ;\xdb\x19$\x87\xa5\"$@\xdf\x03\xf4\xe8\xc8@n\xed:H\x80\x02\xf6(\x87<\x03\xe4{@\x1e1\xe4\xf6\xcb\x1c\x92@\t\xf6\xc8RKGI\x89\xa1v\x1c\xebTh\x98\x12\x14\u07a7\xe2\x03\x06\xb9(~\x91L\xe9R\xa5\u02ac\x8e\xab\xbf\xfdx\xc6E=C4\x95\xd3}\x93\b\xd74WWIZz:\xa1KYK\x19l\x13>\xea\auw\x11\x13PQA\x8d\x1a\xb2\x1e\xdc6\xf9\x04]\xff\f7\xee\u055e\xd5\xea\x15Z\xc1\xfe\x89trb*\xbfH5(=y\x86<~@N\x8a\xb4\x19x\xa6=\x18\x9bg\xb7%\x18q\xa6\xf8\x16\xc14\xfa\x1a\x11\x13:\xf8\x953\x16\x9e\xf7r\xab!v\x1b\xe2U\x03\xebv\xdd\f\xb0\x19\xbb\xfb2\xf0n\xdd\xf6\x06;\xb4\x8dv\xb5\x82\u66238\u06a04\xc3\xc8+C}k\u057fu\xf9O\xebn[A}%\xaas:\x15\xb37/8\ub3e7i3;\x9c\xa7Z7\xb1\x16f\xfb\xb0\xad\x03\u06d5\x14Y\xc6\u058a@\xebY\xe7\xb0\xd8I=\v\xfd\xbd\xc5~2\x9d\"\x98!\xed3\x1d\xa6\x9bz{,\u06bb\x99\xae\xe4N\x05\x0ey\xdc\xde-{\x15\xbeK\xf8!J\xc9C,\xfa\x0f\xc3\u03e1\u8237\x80\xddwF\x82\xb9\f\xfa\xb5BF\x9c\x01\xb7\x19\xf8\xf5k\xb1mF\x00\xf8\xe5\"\xec\xadx\xf3Fx\xdb\xd0a\xc3\u0386\xe8\xd4\xeb\a\f\v\xbd\x85\x01ou\xec\x90\xfb\xb5\x927\xb3z\u02b7\x98.bJ\x1e\xbcK\xa4I\b\u02fdk,\xe3\xc43,\xd6W8\x93\xa58\xf6G\x9c\b\x8f5\xa3\xe8\xc2IO\x95\xf1\x99\xe3\x11s:M.\u0146\x8c\x81\xf3:\x84\x86\x9c\xe4\b\x9f\x96\xfb\xb2\xc7\u0345\x98g\t\u04f0\x1b\xad\u034d\xe7m\xd1\x0f\x86t\xa0E\x17\x9f\xf9\x04\x00>\x9d\x8e#\xe9F\x10\x18\xd8\xe6+\x1a6j\xf4\x9d\x0f\x18\x04|I\xcc\x1d\xaaQ\x10}<R.\x8a\xe8)\x91r1\xba\xfe/DJ\xf8\xa2U\x8ehU\x94\x84\xfa\xfc(\x8dP\xacK\xa4[S\x059\x0e\xe8Z\xb9\x11%\x9f\xf0\x04\x9a\x05I\xce\u025b$qO\xf6B\x1b\u500a\xbd\x02p\xdc\xf1}c{u\x8b\xae\xa9\x04\xfe4d\xb1kiN\x83Lv\u00de\x96\x81\x85VjL\xe7$\x19*\xe8+\x9fnR<\xb3+gDbo\xc9Db\xa2\x12\xd2\x11[.\x88\u01fd \xb2G\xaa\x83\f\xc9P\x8e\u01e4'\t\xddzGW\xc3J\xdc\x14(\xd2DF\xda\\\xa7\xe1>\xc2\xfc\xaf)B\x86;\xf0t\x05'\xe7\x9f\xc8Z\xf3C\x14rnFO\xac\xb2M\xa4S0\x16\\\x8f\x0e\u0628\u0714\xdd\vtw_!\x9d\xf5\xc1:\x96\x15\x94+\x9d\xe3[\x1f\u0cce\xdes,\x14_,$\u0354\xc29aW\u0671\x17\xa5i\x0e\xe44\xd9E\x02\r\x9b\u02b1I-\xfci\u02b3#\x90\xb8\xb4\x10\xe8\x7f\x06\xe8W\x1bm\xc6A\xbf\x1f\u04b6VMX\b|\u066e\x1fO{a\x01U\x99\xfar90\xf7\x88p\xb3E\xafx_-\xc2\u0382\b\xc7\x01\xd5x\xfaJ\x86\x826\xec \x8f,\n\xc2\xd4t\x13\xd3\b\u05c5\xec\x05\x91\xe6x8\xe1\xf5hyI\xc7\xc5tbES'i\xb2\xaa-T\x8e\f\x1cPS\x1a\x90\xe31\x12\x8f\xe639\xe7\xed>\x95\xc3X$\x96[>\xbcL@\x13\x9d\n\xba\xcdJ\xa58\x1e\x17\xc5VI\x14\x17\xa3D\xa92\xbfd\x18\xf6\xe4\xde\xda\xc1\x92R\r\x98\x12\x1e\xd5\xccq\xa9\xe6\xb0)\u069b\x83L\xc7\xe8y\x90\xf5s>A\x8b\x95\xc5\xc8N\x99LZ\x16\x96\x8eq\x8c#\xba\xa8\x96o(\x9a\u0150\xc79vB\x85Bo\x81qDs\x12\x7fU\x0e]\x9d?\x9b\r_9\x83\xce\x1d\xd5\x0f\xb4\xfd\xb1'\xe3&\xc35\xc6\xdb,\b\xb62\u04ea\x8a\x87\x85\xbc\r\xde\xd0\xf0NG\x91+\aP\xb0\xe2\xf8i\xc1\x99#>;\x9dd\xc5\xdfv\xf1\x80\x7fE\xec\xa5\x11\x14uY\xf7\xaa\x83\xae6?\u01f1\xf7 \u025f\xd7l\x1e]+\xef\x199\x12C\x1cA\xe2\x02\xb1\xbdV<\xceb\x16\u07c13\xbbK\x177(\xc0\xf1\xfe\xbci\xe2\xa8\r52\xb27P\x1d`#\x0f\x9evG\xdf7\xe1\x81\x02UuT\xfcf\xae\x1e\xbe6oo\xee\xe9b\x88\xf1\x90\x85\x00\x9f\xd8\x1b\xd7\xf0d\xae\xd5\xf8\xfeR\x84\xab\x8a\x9dK\xf8\xf9\x1e\x87\xe3\xccM\xe0\xf2\xd5r\x84\x1c\u0452\u04dc\x85\b)\x93a~\xd6\xceu8{\xda^PLn>\xc8a\x90rU\xc1t\xb6\xcd\xed\xb3,\xd8Z\u00bcQ~\xa1\x94\xd4\x14\xaf\x05\x0f\xb0\x9d{\x00r\xf2\x87\xf4\xed*(<q#'v\xd4\x106y+\xde\u02322Z\x7f\xb6N\x87\xf0\xf6\xdf\xd0\xfe\xeb\xd1?w\x9b\xaap\xb4^4H\x9a\u04d8$\xb3Q\u03cf\x82\x8aW\x1a\x17\x93\xfb\xd2V\xd63\x17\xc0\xac\a0\xbbY\xe3\x06\xb0wm\x88B-\xa9\f\xd5y\x12\xd4V\x0eU\xaf\x1d\x14o|a\xfdV\xde\xfa\\q\u0274\xfa\xe6\x1b:\xe8\xc6\u06e1[6\xd3P\xbc\x8cP\xbc\xad@\xf3\x96`s\xb7`\xa5\x82\xb6\xa7\u0677K\xa3\xc9tKv]m\xf9\xae(=\x10CdI\x14\xad\xb8\xbe\x99#1\x17\x90e8\x19I\x84\a\x15\xf6\xf3K\x9fB\xce\xe4\xfc?\xcf?8\x19,;\x89\xa2s3jk\x1d\u019f\xe8)\xb8\xea\xf4\x03\xdb\u3ca7X2p\x8aZ\x85\x9b\xa4\xf9\x8d\x1d\x8b\u0367_3P\xec\xc8\xc2\xdb#\xb6U4\xadgdW\x85\xba\x94\xe7\x95\fc\xf3\xbaN[G\xb2\x8dok\x0f\x1e\xc0x\v\xc6\xc9\xe3\xc4\xcb?8\xaec\xc7m\xd6\xcbe\xb4\x86\u062d\xffE\xed\xf2B\xda\xcbp\u6390\x8f\xbd\x8f\xb16>\xbf\x0ex\xa5y\xdbA\x83y\x83hv\xc0t\xea\x10s\xec\x95\xe5\xad\xef\x19\u03e3\x1f\xd9\xd0qq\x81\xab\x0f\xcb[9\u05f5\xb0\x9d\x03Eye\t/\x0f\x96\x96*\x02\x1f#pW\xaa*\u0297M\xfa!*C\x95P\xa1\xa1X\xba\xac\u030b\f\xea\u028a\xe4\x16\xc9i[\x94~RU\x14\xa3\xf5\\\xc6V\x97\x84Q\u021f\xca\xe68/\\\x92cWwX\xbc\xec&\xdePv\xfdV\x98\xf0!\xf6E\xfb\xa0\\|\x95\x1c\xb2\x8c\x11\xb9\xf0#\x8cq\x94\xdf;\xc5w\x9e\xc9\u01a1\x02\xb7_\xc0\xab9]\xcc]/6LQ\xa4Brb\x86\xd1\x16+\v\xf3\xb5\u0126Vi\xd7r\xe1x\x04x\xc3\u0aba\x0f\xb8\u02bbX\x8e\x0f\xcd\xc8'%\xa5\xe5\x95\xfb\x14\xdc\u047e[%>\x96K\x0ey\xd3)\x056\x1c\xa9\xb5\f\xb3v\xd88i\xb5\x82\x9bqP\xf2\x9d\x04\xd9`\f\x8d\fo\x89\xa3\xf6\n\x96h\x9c\xab\xea\x01\xae\xb3\x02\x8e0\xd7\x0fV\xfd\xb0d\xfb@\xbcx\x11\x14]4U%\xcc\xe5\xc7\x0e9\x97\r\xa6\xc1\xfd\x9c\u013e\x00\xa0jwc{)\x19a4\xcf\x1dG\x8b\x9ef\xb5\xbc\xdbe\x81\x9b\x1a\u948e8\x1bq\xb1\x90\xaa\f\xae\xf0\xe5\x12\x81/\x91\xd0S\xdfWZC[\x96\f-\xfb\xfd\x86!\x8a/\x94\x9f\x1a\xbfe\xa3_![ l\x19\xbcV\\\xc9h/\xadm&\xf5\xe2\x02sW\ue6ccR\x14\xbd\x13qU\xab/\x87I\x03\xb9\xea<E\x16\xc2ea;(\xaa\xae\xad:\xf7>_\x11\x1a\x9e:\xe9\x1f\x98\xd3\xfdb\xa7\xfd0\x19\xa4\x14\xd9\x0f'\x94\xb9\x9ezL\xb1 \xba\xaa\xc1\xa6H\x9e\xe6\n\xad\x11c\xc1dMB\xf0Xi\x96\xef\xda[\xa3,e\x94\xa5\xb8\xf49\xff\x99#\x1d5L\xa8\x1c:0\xd50\xf3\xf3\xb3<?\x02\xa60\x9eA\xada\x7f\xa6\xe0J*b\xa6\xe1\x8c\u03de94l\x90\u04f9v\x15\xaf\xab\x87\xf6\u01fc\x05*\x81\x99T\a\x9b\xe0\x89\xbd\xba\xd6WT\xeb\xeb\x8bA\x12\x8f\xed\xad\xb6\xd8\xffJ\xdc\xd9\x02p3\xbdK\x8bw{\xaa\x7f\x83p\x91\x9d0\xb8y\x1e-\xc2riP\u00d8\xb8\xa0Y-\xb8r\\\u03a2\xdd\xe2o\x02r\u0377KQ\xf2R\U0010717f*>\xe7\x10\xfc\xa3\x81k\xf6d\x8c\xe9\xd0\x1cT\xa7\xf1GZ\x8ec,\x87\xe7\n$\x7f\xceT\xf9\xe9\xbd~\xc1\xc7\xf7\xb5?a\xc2U\xda}\xe1\x96\xdf,\xe5D\x86*M\x97\x17\x82a\x8e\xe9\xf9G\x03Q\x8e\vY\xbe\x83\x99\xbcK.\xac)\xb1\xde\xfd|\xfe\x01\x89\xf2:\xff\x82\x97\xee4<\xdb\xe4\x0f\x05\xf6g\xc7\xc7\xeeq\xfb\xe4Uws\u05f4nw\xb9\xd5\xc2om\xef\xeet\xb7\xb9goggs\xef\x88\x1f7w_\xbd|\xd5\xe5\xc7w[\xef\xf6\x8eO\x1d\xfc\xce\xce\xce\xde\xce\x16\xf7\x9c\x9cv^u^\x19\xf8\u0363n\u06f4\x9e\x1e\x9f\xbc\xda\xce\xe1\xf7:\xafNi8\xf5t67\x8f\x8f2\xf8\x9d\xa3w\x06\v}\x8ek\rW\xa5#\xc6v\xefv\xad\xb4\xfci\xcf\xfc\x0f[\x96\u0623\x87\x9dS\xf7\xf8r\xcf=v\xf3\xd6wy\xebiN\x14\rtXvN\x1d\x96\x9dS\x87e\u7d1b\xb7\xbe\xcb[KX^\xee9,/\xf7\x1c\x96\x97{\x0e\xcb\u02fdn\xde\xfa.o-a\xe9\xe6\xb4tsZ\xba9-\u075c\x96nNK\xb7L\u02fb\xffa\xefK\x1b\xdb\u020dD\xbf\xfbW\xb4\xfd\xb2!iS\x14I\xddr4\xb3\xd45\xe3\xc4\xd7Z\xf2\xf8m4\x8e\xb7E\xb6\xa4\x8eI6\x97MZVf\xbc\xbf\xfd\xd5\x05\xa0\x80\xee&)\xcf$\x9b\xe4%\x13\x8bd7P\xb8\n\x85\xaaB\x1d\xae/\u01ee/\u01ee/\u01ee/\u01ee/\xc7~_N]_N]_N]_N]_N]_N\xb9/\x06GN\xed\"\xe1W\x01\x83_\x05\f~\xed\xb9\xa7\xc7\xee\xa9\xea\f\xae\x8b\x85b\x17\t\xbfX(v\x91\xf0\xeb\xb1{\xeaA\xb1\x8b\x84_-\x14\xbbH\xf8\xb5\xe7\x9e\x1e\xbb\xa7\x1e\x94\x9e\xebK\xcf\xf5\xa5\xe7\xfa\xd2s}\u9e7e\xf4\xfc\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xfb}9u}9u}9u}9u}9u}\xf1\x17\t\xa7E\xc0\xe0W\x01\x83_\x05\f~\xed\xb9\xa7\xc7\xee\xa9\xea\f\u03a8\x85b\x17\t\xbfZ(v\x91\xf0\xeb\xb1{\xeaA\xb1\x8b\x84_-\x14\xbbH\xf8\xa5\xe7\x9e\x1e\xbb\xa7\x1e\x94\x9e\xebK\xcf\xf5\xa5\xe7\xfa\xd2s}\u9e7e\xf4\xfc\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xbb\xbe\x1c\xfb}9u}9u}9u}9u}9u}\xf1\x17\xa9\xe7vR\xcf\xed\xa4\x9e\xdbI=\xb7\x93zn'\xf5\xfc\x9d\xd4s;\xa9\xe7vR\xcf\xed\xa4\x9e\xdbI=\xb7\x93z\xfeN\uae5d\xd4s;\xa9\xe7vR\xcf\xed\xa4\x9e\xdbI=\x7f'\xf5\xdcN\uae5d\xd4s;\xa9\xe7vR\xcf\xed\xa4\x9e\xbf\x93zn'\xf5\xdcN\uae5d\xd4s;\xa9\xe7vR\xcf\xdfI=\xb7\x93zn'\xf5\xdcN\uae5d\xd4s;\xa9\x17\xec\xa4c\xb7\x93\x8e\xddN:v;\xe9\xd8\xed\xa4c\xb7\x93\x8e\xfd\x9dt\xecv\u04b1\xdbI\xc7n'\x1d\xbb\x9dt\xecv\u04b1\xbf\x93\x8e\xddN:v;\xe9\xd8\xed\xa4c\xb7\x93\x8e\xddN:\xf6w\u04b1\xdbI\xc7n'\x1d\xbb\x9dt\xecv\u04b1\xdbI\xc7\xfeN:v;\xe9\xd8\xed\xa4c\xb7\x93\x8e\xddN:v;\xe9\xd8\xdfI\xc7n'\x1d\xbb\x9dt\xecv\u04b1\xdbI\xc7n'\x1d\a;\xe9\xd4\xed\xa4S\xb7\x93N\xddN:u;\xe9\xd4\xed\xa4S\x7f'\x9d\xba\x9dt\xeav\u04a9\xdbI\xa7n'\x9d\xba\x9dt\xea\xef\xa4S\xb7\x93N\xddN:u;\xe9\xd4\xed\xa4S\xb7\x93N\xfd\x9dt\xeav\u04a9\xdbI\xa7n'\x9d\xba\x9dt\xeav\u04a9\xbf\x93N\xddN:u;\xe9\xd4\xed\xa4S\xb7\x93N\xddN:\xf5w\u04a9\xdbI\xa7n'\x9d\xba\x9dt\xeav\u04a9\xdbI\xa7\xdeN\x12\xde\xefz\x9a\xdc\xf1=6\bD\x13\xc5\xfa\xed\xe2\x7fT\xaf\xd3\xc5\xff\xf8\xeb\x11\xfeG_\xbb\xdb\xf8\x1f}\xddh\xe3\x7f\xfc\xb5\x87\xff\u065en\xd2\xff\x84)\xc6\xff\xf8p\xdc\xc5\xff\xe8+\x01a\xd8\xdbG\xf8\x1f\xf3\xc6\xdb\xf8\x9f#\xef\xd4\x19&\xd9=\xfc\x8f\xbe\xeem\xe2\x7f\xfc\xf5\x04\xffcrA%\xe8\xeba\x17\xff\xb3P\x0e\x8f\xf0?\xe6\u02a9-\xc6\xdc6\xfe\xc7_{\xf8\x1f\xb3\xc9\xd4[\xc71\x9f\x90q2\xaa\x8c\xb5\x9c\u045fO\xa7\x89Ui\x89\xa4\xd14Q\x85\xee\xf8.c\x9e'S\xd2\xe3]\x97\xdc\x12\xf4+\x05\x90\x82|\xe2\xbb\xc8\f\x8c-\\\xdc\xc7PMb\x90\xe0\u027e\x05\xc1\xb7\xd8\xf2K\t>\x81\xa2\xe7\xa3\x18\xaf\xa1/Ah}\xb4Ov\xd5\xf5\xeef\xbb\x19u7w\xd9\xf4\xf5Q\x93\n\x8dg\xe9\x7f\u03d3\u06dbt\xe6\xcama\xb9\x8d-\xf8\xd3)+\xd7q\x05\xb1\xcc\xc6\x1e\x16\xdc+)\u0635\x057\xb0\xd1\xee\x06\xfcio\x96\x14\u0730\x05\xdb\x00\xb1\xb3\u05c5?;\xdb%\x057M\xc1\x0e\xb6\xda\xd9\xe8\xa01c\xdb\x14\xfc\xefy<\x8aA\x98\xb7#\xe9twh\xb0\xd8\xc1n\xa1Tg\xb5bv\x14\x9d\x0e\x8e\x02\x87\xd2\xd9\xdb-\x14\xb3c\u8d3b8N\x1c\xc8N\xb1kv\x04\xdb4\x00\xfc\u04f1#\xfd\xcb|\x1a\xac\x16u\u02ad\x16\x16\xe8,-\xe1\u6f7b)=\x86?\xba\x84\xeb\xec\u0786t\x16\xfe\xe8\x12j\xa6;\xa6\xa3\x1bf\x91/\x93\xf4Zu\x14k\xd3\x1f\xbb\x14\x97i\xfe\xdf\n\xf1\xa8\x8f]\x9a\xb8m\xafDgy\x91\x00\x89:\xd0\xdf\xce\xee\x86W$@\x9f],\xb2\xb5\xeb\x15\t\x10\xa7\x8b\xe5\xda;\xa6\xc80\xee\x7f4\x05`N\xf1\xff\xee\u0578\x7f\x93\f\xe2\xe1(\x1b\x0f\x02\xc4\xf7fM\xef4\x86\xe1V\x05\xdfu\x16\xbd\xec\x06/\xedj\xe1\u02cd\xe0\xa5\xd7\xe4\xa6\xffR\xad\x11\xbc\xfc\x94f@k\xdc\xd0a\x027q\xbd\xbbv\x8a\xf1\x02\u063e\u07c6\x01mv\xf1\x9f~\xed\xaf\xd1\xf6&\xfe\xd3\xef\xfd\x05\xda\xda\xc3\x7f\xfa\xbd\xbf:[\x1d\xfc\xa7\xdf\xfbK\x83\x93\xbaa\a8\x9f\x0e\xefn\xb3\xccM|\x17I\xc3\xee&\x0e\xb4P(@\xa6\x0e\xe2\xedV\xa1\x94\xdf\xdd\xce\x1el\xfd\xcef\xa1T\x80R;mB\x9a\xb0T\x80U\x1d(\xbak\n\xf5\xe3A2\xd3H\xb1\xb7Eh\x89f\v\xed\xb0\x8c#E[]\xb3\x99\xb6\n\x90\x1c%\xc2U\xeav\xf74\xa6\xd8Rno\xd3d\xe1\x00\x1d\xca\xd8R\xb6\xeb\xb4[665\xea\xa0Y\xdfl\x9a\xc0IW\xa4\x90\xedB\x99\xce*\x85J\x88h\xb1P\t\t-\x16*\x12PW&\x83S0V\aY\a\x97\r\xc1l\x14\xca\xf8\xc8B]\xdf\xd8\x0e\v\x05\xb8\x82]\xdf\xd8\b\v\x05\xa8B]\xdf\v\v\xf9\x98B]\xb7e\xb2i<,\xf6f\xb7\xad\xdf\a\xdd\xed\xc0z\xedn\xeb\x02AW\xdb\xdb!\x04\xbf\x9b{\x1d\xec\x85~\x1f\xf4\x10\xc9\xc0\x8e{?\xbe\"\xed\xbf\xc6\xe7N\x1bgw\x93\x90P\x97\xcc\xd3\xe1G\x7f'\x12\xcb\xd1m\ae:\xab\x14\n\xa8\xffF\xd7Cf)\xe4\x0f\xadK\xfd\xda\t\xbb\x14\xb2\x0e\u06dau\xe8\xdf\xc5cEH\x83C\x15\xdfv\x16\xbf\xd6\x04<8p\xf1\xb5&\xe1\xc1i\x8b\xaf5\x11\x0f\x8e\xdaA<\xfdX<Z\xfc\xf7A\xefK \\g\xc3A2\x9e:B*4\x14\xfft\xca\xca\x05\xf8\xb6K\xb4\xab\xac`\x80w;HM6\xcb\n\x06\xdbd\x93\x8e\u1c82\xc1B\xb5\x01Swu\xb9i|\xe7N,,!\x7f\xbc2I\xe2\xcdH[\x1d\xe9R`)\x90\x8f7\xf1\xc7\xd4\xcd\u05de\xe1,,\u06c0\x85F\xf15\u0788{].\xacO6L?%^\x9fv\x99\xffP{\xcc/\u799f\xc8\t\xef\xf9niQGYw-{\xda\xde,-\xea\xe8\ubda1\xaf{\xed\u0492n\r:\x06\xa1\xb65\x9e\x00\xc1\x18_\xfb\xfc]g3\x98c.SBg\x8b\x85J\xe8l\xb1P\t\x9d-\x16*\xd2Y\xbfL\xff&u{`\v\x96\x93d\x1d\x7f\xbe\xa8\x90;\u0548Tv\xf5\x86w\xa5\xdc\xe4\xef \xef\xe3\xed{W\xca\xcd\xfb\u05a6i\xb1\b\xcbu\xbd\r\xa5\xfc\x13\x19KM\x93A\x88fzl9\xb1\xa8n\"\x89\t&\xb6E\xe3M\x9e\xc4\x1e\"v6\x89\x9f\xc6Y\xdf\xdc()\xd7\xf1\x05\x05Z\u00fd\xb2\x82\n\r\r\t\xec\xec\xb6K\n\xaa\xc9\xd82r\x927\xb3\xa6\xa0\x9a\x8f-C\u053ci\xcb\xf1`\u0574q\xa7\x8bh\x1a\xce\x1b\x15\xd3Tc\x13ppg\x0f\xff\x95\x95R\xacX\xa7@\uaf52\x8a\x1d\xeb\x14\xa8\xbeWR\xb1d\x9d\xc2\x01\xe0\x95tlY\xb7\x94\x90K\xc1d\xf1`f\xf3\xe9\x7f\u03f34O\xbccg\x1b\xff\xe8b\x81x\x80'p\x9b\x18gS&\xb9L\xe3\xb1\u00bb.r\xb8\u021b\xb8\x12\t\xde\xda\a\xe7=\xf1\x05;A\x91\xce\ne\x02:\x80\xff6\xc22\x01\x19\xd8&z\x11\x94\t\x8f\x10\xc5\va\x91\xfc\xe3]p\xa4\xd2&W\xcb\xec\nuV*\xa5\x8f\x7f\"\x05\n\x11\\)\xcd\x05\x10)PH\xe0Jy\xcc@\xdb'\x03\xe9\xc8;\xfe\x98\x10ny\x1b\x03\x8b$\x8b\x8bd\x83k\x9f\x95\u06e0\xd5\xd8\xf4\x06g\vuV*\xe5\x96nW\x18\v5\x05\xb6\x94[<\xe2<\xb6\xbd)\xb0\xa5\xdc\xf2A\x81\x9d]=\x03W\xe94\xb9\u0128\x1a\x1e\xe1\xdd \x82\x19\x16\xf11\x0e\xb1{s7,\xe3c\x1c\x0en\xb3\x00\xc7\xc78,\xb7Q\x80\xe3c\\\x17\af\xd8s\xe0\x9c\x81\xbd\x0e4lDUH\x1dg\x10\xf3*\x9b&\xf9\xcc#\xcer\x06\xa8\xb1]\xc7\xe98\xbf\u0326\x99\x13\x88\xdb\xc46k\xde\xf9\xfa&\xcbg~{\xc4\\\xfb\x9a?\xe4\xb7\x02\x81Y\xc9[\xf8\xb6\xb3\xf8u\xc0\x9a#\x9f\xa6_\x87\x12\xf4\x86\xff:\x14\x9dw\xfc\xd7\x1e\xb3\xda%J\x80\u0689\x8dnX&\xe0/\xf0\x94\xb2$\xa3\x8aI\xc5\x13\xcaMi\x05\x83Jc\xde\v\v\x85\x94\x85H\x99)\xa4\xb7\xe6\x1e\xd1\v\xfe\xa3\u07b7\xcb\xd5L\xde\xc1\x83C\x80\xff\xebW\xb6\x1ac\x96\xc2.~\xdd\x0e0\xcb;\xb4\xa8HG\xefO\xfe\xa7_\xdb\x19Bm\x1f\xff\u04ef\xed\xdc [\xc1\xff\xf4k;+(U\xf1?\xfdz\u02fe\xde\r\xf6\x0f\xbd\u07b6g\x19\xb4\xcb\xff\xf4\xeb\x1d\xfbz\x83\xd5W\x9b^\u06fb\xf65\xb4\xcb\xff\xf4\xeb=\xfbz7\xa0\x01\xde\x11\x8e\x9a)\xf8\xbf~e\xe7\x94UVJmE\xaf\xed\x84\x12OG\xff\xf4k\a\x19\xba\xc4\xff\xf4k;\xa1\xac/S:3z\xed\x94\x1c\x1dfi\xb6\xbd\xb6\ud1326Ni\xe4\u8d5d\xd0mh\x97\xff\xe9\xd7;Z\x83\xc2\xff\xf4k;\xa1;\xd0.\xff\u04ef\xed\x84\xee@\xbb\xfcO\xbd\xb6\u3099\xdeu\x82\x1b\xbd\xb2\x13\xba\x83<\v\xfd\u04ef\xed\x842;\xa3X\x1az\xdd\u055c\x11\xff\u04ef]\u00e8\x1a\xa1\x7f\xfa\xb5\u3ad0}\xa1\x7f\xfa\xb5\x9dP\x14\xf3\xf8\x9f~m'\x14o&\xf8\x9f~m't\x0f\xda\xe5\x7f\xfa\xb5\x9dPT\xc5\xf1?\xfd\xdaN\xe8\x1e\xb4\xcb\xff\xd4k\xc5\x053'\xd3\xd14c\xb3\xed\xa9\xcc\xcc\x1f]\xa2\xb3\x88\x15\xa0\x12\x8e\x8fE\x89\xd4\xfc\xd1%6|qP\xfe\xe8\x12J`\uc4ac\xaa\x05V*\xb1\xe5Jl\x89\xae\xb4\xd3\xf1\xfa\xb1\xedJ\xec\u0211\x00\x7ft\x89\x1d\xc7G\x93d\xd3\xd6:\x1c*\xb1\xeb+?\xe5\x8f.\xb1\xe7Jl\x99\x9b\x80\xae\xee\x87\xeb(iF\xf1\x9f~\xdb\xf6\u051d\xe6\x8f.\xe1f\x9c8&\xf9\xa3K\xb8\x19'1M\xfe\xe8\x12n\xc67H\xf8\xd9\xd2\x1ao*\xb1\xe9\xa9\xf5\xcd\x1f]\xc2\rd\xb3-\xf2yg\xd3\xeb\u01f6/\x06\xca\x1f]\xc2\xcd\xf8&\xc9\xf8[Z[N%v=\xf9\xc1\xfc\xd1%\u070c\x93<*\x7fT\t\xd7\r:x\x95\xaa\x89\u07b6=\x81\xdd\xfc\xd1%\x94\u0306\xf2\x80\xfc\xd1%\u070c\x93\x06^\xfe\xe8\x12J9\x82\"\xa4\xfc\xd1%\x14[\x8a]\x90?\xba\x84\x9bq\xa4\xba\xe6\x8f.\u11baM<\r\xff\xd1%\u070c#\xed5\x7ft\t7\xe3\xa4m\x93?\xba\x84\x9b\xf1\x9dm\xbaJ\xd5\xf7\xa9X\xc25b\xe4,\u0747\x1d7\xe3H\x87\xcd\x1f]\xc2\xcd\xf8.vP\xfe\xe8\x12]_\xd5(\x7ft\t7\xe3\xbb\xd8A\xf9\xa3Kl\x06\xea7\xfe\xa3Klyj\x1a\xf3G\x97p3\x8e\x94\xd9\xfc\xd1%\xdcd\xecm\xd3\xfd\xa3\xbe\x84\xa4\x12n\xc6\xf7Hs\xcf\x7ft\x89=\xc7<v\x84\x19\x86?\xaa\u012e+\xc0\u04afG\xb7v\x1d\x03\xd7&\xb9pSk\xa5\xa8\x84R\t\u048d\x0e\xff\xd1%\x1c\x97\xdb\xde#Q_\xcb\xfbT\u00b1\xb8H\xa0\xcd\x1f]b\u04d5\xc0.\xc8\x1f]b\u02d5\xc0.\xc8\x1f]b\u06d5`\xd3\x00m\x1f@%v\xbc\xfb<\xf3G\x97\xd8\xf5\xaf\xb0\xe5\x8f.\xe1f\x9c\xae\x9d\xe4\x8f*\xe1\n\xa0\xe6\x8a\xfe\xe9\xb7n\xc6\xe9\x1eM\xfe\xe8\x12n\xc6\xe9\xdaA\xfe\xe8\x12J\xae\xb0\x17\xc2\x1e\x95\xdes3\xbe\xb1C\x17%\xfa\xb6\x84Jl\x06\xe6\x19\x9ePH%\u070c\u04f5\x9f\xfc\xd1%\xb6K\xee\xe2=*\xbd\xe7f\x1c\x15F\xe6\x8f.\xb1\xeb\x9b\x7f\xc8\x1f]\xc2M(]R\xca\x1f[\xc2W\xb9{\xf7\x80\xbe*\xb1\xf4m\xe1\x02\xc5{[\xb8?\xf1\xde\x16\xaeO\xbc\xb7w\xc9p\x98\xddz4\x93\x15\x02n\xf8\xc9\x12\xb9-\xa9\x96\u06d2j\xb9-Y,\xb7%\xcb\xe5\xb6d\xb1\u0716,\x96\u06d2\xc5r[\xb2XnK\x16\xcbm\xc9b\xb9-Y,\xb7%\x8b\xe5\xb6d\xb1\u0716T\xcbm\xc9b\xb9-Y,\xb7%\x8b\xe5\xb6d\xb1\u0716,\x96\u06d2\xc5r[\xb2XnK\x16\xcbm\xc9b\xb9-Y,\xb7%\xd5r[\xb2XnK\x16\xcbm\xc9b\xb9-Y,\xb7%\x8b\xe5\xb6d\xb1\u0716,\x96\u06d2\xc5r[\xb2XnK\x16\xcbm\xc9B\xb9-Y*\xb7%K\xe5\xb6d\xa9\u0716,\x95\u06d2\xa5r[\xb2TnK\x96\xcam\xc9R\xb9-Y*\xb7%K\xe5\xb6d\xa1\u0716,\x95\u06d2\xa5r[\xb2TnK\x96\xcam\xc9R\xb9-Y*\xb7%K\xe5\xb6d\xa9\u0716,\x95\u06d2\xa5r[\xb2PnK\x96\xcam\xc9R\xb9-Y*\xb7%K\xe5\xb6d\xa9\u0716,\x95\u06d2\xa5r[\xb2TnK\x96\xcam\xc9R\xb9-Y(\xb7%K\xe5\xb6d\xa9\u0716,\x95\u06d2\xa5r[\xb2TnK\x96\xcam\xc9R\xb9-Y*\xb7%K\xe5\xb6d\xa9\u0716,\x94\u06d2\xa5r[\xb2TnK\x96\xcam\xc9R\xb9-Y*\xb7%K\xe5\xb6d\xa9\u0716,\x95\u06d2\xa5r[\xb2TnK\x16\xcam\xc9R\xb9-Y*\xb7%K\xe5\xb6d\xa9\u0716,\x95\u06d2\xa5r[\xb2TnK\x96\xcam\xc9R\xb9-Y\"\xb7\xddd\xe3\xe4n\x90\u0716\x18\x95\xdb\u04582\x9dU\n\x95\x19\x9f[\f0\x85J\xec\u03ddY\x89)Tj\x82\u07b1\x85f\x05\xc3\x03f\x92v\xdb~\x91\xd0t\xb2]R\xa6\xc4z\xb2\xb3\xbd\xe3\x97\t\f(\xb7\xe92\xdc/\xe2\xdf\x0e\xe2ae\x1d\x050{\xafoKAP4Oj\x8b\x04=\xa6\u07b4\xb7\xc3R~\x9f=\x06\u0516\xf1\xfb\xbc\xab\xed\x93m\x99b\xa7\xed\x01\x9b~\u02a6w%\"\xaa]t*\xd0YZ\"\xb4\xe2\xf4p\x82J\x84&\x9c\x1eBP\x89\xd0~\xd3\xc3\x06\xcfV\x8f\xb1s\xc3c\x9b\xa8@hq\xba\xad\xd9&*\x11v\xb4\xad\x19<*\x11\xba\xaa\xecjv\x98J\x84\x1dEQ\xcbL\xe80\xfe\x84i\u49ae\x19\xd3U\xb7gM\x99\xcb\xe1<\xbf\tz\xdc\xd6\x04\xc2+\xd8Y\xb9d\u8573\xa9\t\xa8W2\x1c\xeb\x06\x99\x93\x97\x95,\xf3\u02f17\xec\xc3\xf8v\xec\x1b\x9dQ\x9b[\u0280o\x98\x8c\xb2q\xff&\xbd\xbaR&l\xceH\xc2\xca=\xba\\g\u0542\xe1\xa2nh^C\x17\f\x91\x90X\xc92\x88\xe1pw\xb4\xd44\xc4\fL\x9e\xa14\xa9\x9c\xc8\xd8\u014a\x13\xb6\x90og\xc8\xceTV\x03dK\xf9v\x86\xecIe\x85\x06[\u02b73$7*5#\xa6\x94oghh\xab.\xe5[\xa4\x93\xfcAV=]\xafEmu\xccX\u4aefl\xa1\xceJ\xa5\x02.\u0237\xa6\xb3\xa56|3C\u07d2\u0396\xda\xf4\xa5I\u07cc\x8eJ\x15mLx3t\xb4\xcc\xe7\x97\f\xdd\u07b6\xab\x81\x86[\xac]\r5\xdcc\xed\x02*U\u065e \xe7c\x85\x03\xbf\xa4\xaf\xf2T\x8cA\xc7\xef\x842X!w\x19\xf3\xc7/\u464b\x9a3\u075d}\xa6\xd4rP\xc5\x03\x9b\xac\x1c-\x9d\xb7\x85\x82\x03p\x87d\x90\xad\xb0Tphow\xb5<eK\x85v\xe7\xec\xb4\x10\x96\xf2\xe7\x96\\u\xda^\xdf\x03\xf3Z\xea\u05f6g^\xab\x8auV,\x17\x8c\x80l\xe2;\x9b\xc5r\xc1\x18p\xe5\xf7v\x8b\xc5\xfcA\xa0\xb6l\xdb\u00cf\xd0\xf8w\xa3+\u058a\xceQ\x91\xcb\xf9\xf6\x91\x1dvt\xdb\xf6\x0e)U\xae\xe3I\xad]Rs\xfb\xfb;\xb4\x92\xeclo\x1a\f\xf1\xb7xh(I\x96\xb5\x84%\xc1.\x0fm%\x89\x1d\xebn\x14\xb6d\xc1F\xb8\xb3a\xf4\\a\x1fC3\xe1N\xc7\xfa\x89lm\x94\x94LV(9K\x92\xa1\x7f\x14\x18I\xb5\x1b\xe0\x83)\x19X\xfew\x8b\xc4\xd2\x16\r,\xff;\xed\xe2t\x9a\xa2\xbe\xe5?\x89\xfd\u111a\xa2\x81\xe9\x7f\u025c\x86\xd4\xc52}\xdd\xcdb\xb1\u038a\xe5\xcaX\xc4vI\xb3e\x8c\xe2n\xbbX\xae\x8c]TS>\xf2\xfd1\xb6\xcca\xa2\x10|\x9c\x8c}\n*l\xa5\x14\b<?\xf8FK/\x96\x14\xe8,-\xe1\x0f\xdd[E)\xe1\x0f\xdact\xa4\xc4f\xb5\a\xca(\x9ef\x8er\x11\x06\xa2\xb2\xcfjJ\xf8\xbd\xdf\u036d\xae\xd6\x1cq\x89\xc0TvW\x8bH\\\xc2\xef&m]{Jp\x89\xc0LV\vH\xa3d\x90\xceG%>\xdc%\xee\xd4\\\xb6\xc4\xe3\xd6M\v\x95\b\xfc=PS\xb5\xbb\xa5\x8f%]\xccgS:m\x8fD\xe8\x82>\xa7\xb2\xb7\xe5-\x98*\xe7\xf3*>\x11\xd3\xe5|nek\xcb[<*7\x99O'C7#\x9b;\x86\x84u\xca\xcau|M\xe4F\xbb8\x10.\xa8\x94\xab\xb4=:\u0151pA\xa5\xd5\xde\x11\xa3\xf4p(\\\xd0\xd1\xe3\r\xbe\x83\nG\x12\x1eAt4\x92\x9e\xd2j\xeb\xa5`\x81p\x13%jo\x16\xfb\x98O0\x80_\xf1\x02\x9a\xad\ucf62\x05\u01c8\x9d\xae\u0578\xf9%\xd97B\xfb\xdc\xec\x91>L\v\x84\xa3t0\x0e\x99}&\u061a\x89\x1b\xa5\xe3Y\x7f\x9a\xc4#_\xd9#B\x8b-\x94\xcf\xee\xa6Y^\xe23\u07f5\xb7\x1c\xb6Pg\xa5R%\x9e\xf3\x8e\x01\xb4\xa5\u029c\xe7\xadF\u0616*\xf3\x9f\xb7z\xb9Q\xd6\xef\xc7y:.q\u6dd0\xc6\xf1\xa7\xf8\xcfY\x89\x15|\xd7c\xdbT\xb1\u038a\xe5B;\xf4\x1d}\x01\xa0\u0285\x06\xe9\x9eP\xa0\u0285C\xed\xa8{A(v\x17xbZ\xa1\b\u07d5xj\xda\xf7\xc0\x9cc\x18E7\xaa\r\xa3\xf2\xb3g\n9\xe0\r\xa6\xf1\xa5\x7f\xb3\x87\x9aC\xab\x9e\xb4e\x94\xe4h|\x04\xb7\xbba\xa1\xaew#\xc0\x1e\xfa\xbba!_n\xf4\xcfA[\xa8\xc4\x1d\xcbJ\xf8e\xee\x80\xdb\xcaJ\xa3\xd4\x15\xb0X `\x87\xb13~\x81`\t76\xc2\x02\x01\x1b\xdf\x0e\xdfk\xfd\x1bM\xd8^I\x89\xce\xf2\"~O\xb77K\x8a\x04a\x0f\xb6J\x8a\x04\x91\x0fvt\x11}p\xb1\xff\x03\x13\xfcM\xafD0\xa5\x1b\x1dMS\xc2\u04ca&\x95t\xf6\x96\x82\x05\aU\xd7^5\xbbK\x90\xf0\x8c\u00ae2e7\x87?\x06\u02a9\x90\xa7Y\xc2h\ub09e8\u027ah\n\xd4\xd0\r\vu|\xac\xa4\x01ZrnKu\x17\x89\xa6\xb6\u0506\xafzb)\xaaPjS\xdb\"\xb0\f\xa5\xcb\x14\x0e\x8f\xce\xceVAS\xe1\x15T\xb7m;\x05\u0347WR\xed\xd3\xcd\xc507\xbc[\xd9@\x03\xe2\x95\xdc\xf4m\f|-\b\x96,\x9cqt\xe7\xc3F\x00\x9b;e\x05C|k\xebKN\xafd\x88v\xb4\u01a5\x8d\x87\u0637\x19\xe2\x96-YDB\xab:\x98\u0113\xf8.\x06\xfa=)\vNdK%q\xfff2\xbf\xba\n<\x9bv\xb5~\xc1\x16\xea\xacT*<~\xbc[][*<|\xb6\xb4\x16\u0096\n\x9d\xa2\xf6\xb4\x1ab\x92L\xe7E\xfag/\xb2\x8b\xca\x15\xd6\xff\xe9\xf7\xa1W\x7fG+t\xcbT*{\xfa\xf2\xb7L\x9b\xb2\xa5\xef\xe3K\x14)4\x02\xfb~8wL\x10a\xc469\xaeu\xd4\xfb\xb0\x8b;\u0796\x81\x02a\xc0\x01\x8f!\xc4\x02\xa1\x1f\x97'\x17`\x81\u0407\xab\xeb\xed\x8b\xecv\x10\u0139`\xad\u01a6>\xa8\x03\x86\x1c\x87A\u05cc\x9b~\x81\x8e\xe7\xeb\xec\xfb\u07c5,8N\xe5\xa6?\x98\x80\xf7\xee\x8a\xf7\xa1\x1a\x8d\xcft\x93l\xe3\xa9%\xc3\xf3N\x1d\x88\x85\xdd\xec\xbf+\b\xa5\xea]A\x1cU\xef6\xab|\u0501\x8b\xbc\xf3\xc3\r\x89\u05f9\xbe\x84\xb1\x85J\xdc\xfa\x9c\x9e\u0416*\xf1\xebs\xca\x00[\xaa\u0131\xcfy\x9c\xdbR%\x9e}\xce\xdej\x9a\xdd\u015e\"g\xdb\x1e\x94\xddB\x99\x8e\x16.8\xde\xcdV\xa1\x90\xed\xfa\xf6\x8e\\J\xba\x85\xb7\x85\x9c\xb5\xe1\xae\b\x9a\xc5\x1e9\x1b\xce=\xe6D\xdc\xea\xe71\xe6\xf1\xf3'\xbd\x10~&TlZm\xbfe5Ju\x9a\x9bm=?\xa5\xeaL<\x1d\xacx_\xaa\xc8\u0113f\xd7o&\xa0\xf1h\x80\xb9c\v\x8c\a>\nuq\u00d02\xd1j3B\x01ss\xdb\x1c\xe5;A\x89\x8e>\ud17d\xd8\v\xca\xd8\x11\xed\xd8\xd8\x1a\xd6F\xaa\x10\xd0`{\u01f2\x16a\x99\u0345\xdd\xc9o\x92\xe10\xb8\xbf\xf3\xb4\n\xa6Lg\x95B\xe1\xe5\u00deV6\x9aB\xe1\xb5\u00ce\xbe\x133\x85Jn2\xdd5F\x9e&\xe3q\xec\x91@Tq\xd8;G~_\xc20X~\x81K\x940\nVk\xcd%J\x18\x04\x87\x13T\xa2\xc8\x18\xb8Y\xa9\xd4e[\x89\xaa\xa0\xc6V\xfa\ue80c#\xd7Dg\xe9\x84\r\x9bRQ\xacv\u0158\xccm\xdbPoMW\x1b\x1d\xef\x04*j>\xb0+{\xde1f\xcbt|\x1b\x89\x8e\x17\xa0\xc0\x96\xea\xfa\xf7am\xef\xfa\u0416\xda\xf0$\xbc\u077d\xd2\x067\xb5\x95\xf1v\xbb\xd0q_\x83\xde5\xc4\u0132\xe4%q6\xf6v\v\xb7\x06%16v\xb7\nW\x06%\xf15H\x91\xe5\xab\u068a\xb15xa|\xcdv\x89R\xbf\xa4\xf3\xe3\x82\xde\u06fb\xba\xc7\xf7\x9de\x05J\xae\xa3\x9d@\x86\x05J\xae\xa1\x9d8\x86\x05\u02ae\x9f-\xc7\\\xa5\r\xdb\xd2\xf6\xae\xaaPg\xa5R\x05\xf7\f\x17tC\x95*\xb8i8\x9bfU\xaa\xe0\xaea\xed\xd8\v\xf7%;\xd6\x10\xd7\x1e\xeb\u015b\x92\xbd=\xb1ST\xf8S\xb8#\u1622\xfe~-\u070e\x90Nh\xd3c\xb1\x8a\xf7\"t\xb7\xde\xf60\x7f\xa6n\xc2\u017eH\x1b\x9f\xcc\xe2q\x89\xeecG\xd5.\xd1|X\x19b\x16\x8f7\x16\xf0\xfd\xb3x\\\xd4zX\x86\n3\x03\u03c6*\"\u07b6\tcb\xa3\x8eJ\x91P\xdd\xe6\u026aR&\xd4(z\\\x8b\x94\t\xf5\x89\xdeU\x93\x94\tUl\xdeN\x9ce\xa3x\x96y\xbd\xd9\xdbS\xc7\x06\xbf\xef,+\x10\x98Gu\u0571\xc2\x05\xfc\x8e\xe2\xd2\xdbS\x85\v\x04\x86Q\x9b\xeaT)\xa8\x02\xb6\xad\xb5c\xbbP\xc6\xdba~h\u01e2\xfc\xdf.\x04v,J\xfe\xedBX\u01e2\xcc\xdf.Du\xf4\xa3\xfd8\x16\u0375T\xd4\a \xa1$\x1d\x8e%\x81\x15\xaa\x00\xbaV\xb4d\xaeB\v@\xd6\u06db\x85B\x81\xa6\xccs\x0e\xa8\x90\xfdqd\u058f\xe4\xf6&\x89g\xber\xbd\xeb\xdd_Q\x81\xd0|\xa3\xa3\xad\x96\xa9D\x88\xddd}\xbd\xa9K\x84\xb8\xbd\xad\aM%B\xcc\xde\xd64\xb0,\x06\x8c\x87\x0eT \x1fe\x1f\x93E\x86\xa1U\xf7\xafm\xef}gY\x81\x92\x1bW\xbf@\xc9U\xab_\xa0\xe4\x8e\xd5/\x10(\xfb\xb4r\x19s\xfc`R\xe9Wo\xdf\x1c\x9dD\xa7\u03de\x9f\xecc\xb8\xecA6[\xffs\xbe\x0e\xdf>\\\xb5\xfe\x9cc\x91\xa3lr7\xc5k\x96\xa8\xdeo\xe0I\u0625`\xddG7\xd3l\x94\xceG\u046b\xb3\xa87\x9f\xdd`\x10\xec\xa87\x1cFT\x16\xd3O\xe5\xc9\xf4\x13\xa6\x9f\x02\x18os\x97'=\xcf\xe6\xd3>\xa6z\x1a`\xea\xaa\xe8:\xfb\x94`\x9a*L\xa3\x1dG\x87g\xc7k\xf9\xecn\x98D\x18={\x9cc\xf2\xbexF)\xbf/\x13\x84t\x85\xa9\xdf0\xe5\x11\xc6\xe6~\xfe\xec\xe8\xe4\xe5\u0649D\xe4~P\x9b\xe7\x9cI\xab?\xab\xb9\xf0\xde\xdfM\xe3\xcb\xe82\u018c\xeb\xd1|\x96\x0e\xd3\u065dM\x15\xa5\"\x88c\xf6\xb9\x9ftZ\xaf)\xa0S\x02]\x9a\x8f1\xfcu\x94\x8ca\xac^\xf6\xae\x7f\xcf\xe7\x93\t\f3\x8f~\x1a\xa6\xe3\xd9\xd1M\xd2\xff\x98\x7f\xa9L\x87\u054bn\xe6#\x18\xc7\xd5\x14x\xe6\xc1\xf0\x8e\x9f^QZ\xcb\xcb\xf9\xf5\xb5dZt\x89\xb1^]\xfe9\xe9\xcf0%\xab\xee\x02\xcd\xc7m6\xc64e\xd9h\x82\xc9\u00d2\xff\x9e\xc7\u00c8\x12\xd3\xdd\xc1\x14\x8f\xaf)\u01da\x1aZ\xabO\x839\xc1\xfa\xa5y\xb2`b\xdf%\x18Z\x1d\xc6\xcb)D\xa3\x8cZ\u01cc\xf5\xe3\xcc\x01\x8d\xf2\x1b\u0298y\x89\xa5%\xdf\xf9(Z[\u00fc\xec\xb7\xf1xFY\xa3\x11\x9cY\n(\x02\x9c\xc7(\x9d\xa5\x9f\x92\\2l\x0e\xefZQt8\x9f\xc9\xc0\x93i\xce)\xee\xd2q\x7f8\a\xac\x00\x04\xe1\xccW*/Ur+\x1d\xe3^{9\xaa\xdep\x82,L'\x97\u0197\x18z?\xb9J\xa6\u0278O9\xb9aH.\x8f%\x16\xffA\x8aq\u6d4c3\xa9a\x92\xde\xe8\xdfN\u07fe<:\x7f\xf6\xeae\xfd\x87\u079b\x97\xbd\x17'\x98\xaa\xde<Cd\x85\xe5\xcb&8w\xf1\x10!%y?\x9e$.\xfd,.\xc1d\x02K+\xb1\xe3=t\xc1\x14\x7f\xc9\xe7x4\x19&\x9c8\x97\x97F\xb2{A\xa7\xf2\xfa\xa3\x7f\xab\xe3\x96\xc5D\xf2\x8df\xf4o0\x02\xd8$o\xdf<;2\t\x06y\xf0\xb8\xc5\x1f\x97\xa6\x86\xfd)2\xf5a\xd3\x7f\x8f4\xa0\xba,'\x19\x83r\xdfe\xd9\xf50y\xf2\x88\x93QS_\xdf\xe1r\x00j\u03c7\x98]U@5#.\xf9o\xdd\xc3G\x1a\xb9\xd4\b4v\xc1\xa47qIrF1YHx\xea\x12\x9a\xfd[\xfd\"^\xfb\xcb\xfb\u01cd\x1f\xeb\xf5\x8b?\xfd\xd8x\xff\xa4\xf1cc\xfd:U\t\xb6)% \xfc\x1e\x13,\x87\xb1&\x1f\xe0\xecn\x82\xd9l\xb1\x9d\v)\xf0\x1e\xb3x\u05c0L`\xb6\xd8dPk\xd8t\xba\x94p9\xaa\xbd\xe5Ty\x16_8\u04df\u0516D\u069c\x9cp\xfa\tF\xe4\xc1\xb6\xaf\xb1\xf1\xab\xb1I\xbe\xe6\xcdB\u02d2\x17/)\xf8'\xc9HPQ\xf6\xe2j\xfc\xbe>\xfdd\xd3\x16J\xa6DnG\x03\nF\x11 !\x0f\xe6jl\xc1<\xf0\xd3 N?I\x16D\x7f\x0f\x9d\x9anh\x82\x8b\xbbXRH\xeb.\v\x92\x1c\rS\xccyIe\xe3\xc1\x80\x91\xde\xe4\x18\x84\x1f\xc9\xe7\x19\x10\xba\x124oT`\x8f\x9b\v\u0261`7\xc0\xbe\xfb\xda\xd4\xcf\xed\xc6\xd8/yF%ir\xbe?\x7f\xf1|\xdf\xc3L\x9d\xf6r\x14O\xa4=Jl\xf1\xbb\x1aL\xe1o\x87\xb3\xa7\x92\xe9\x02\x1e}C\x8f\xae\xf5\xa3\xdf\xd2#\xd8\xcd\xea\xd9#z\x06\x8c\xa0*\xf8\xa8\xf6\b\x1f\xfe\x9f\x8d\xbd\xa75\x9ew?S\xbb\xb7\x1f.~\xf7\xcdo\x7f|\xf4c\xed=\xa6\xf9s[\x00:k\x8aC_/F\xef%m\xfc\x17\xbd\x80\xdfar\u041b\xc4fx\x8c\xfb\xfdd\x82\x99#\xdf>\x8b\x86\xf1\xf8z\x1e_\xbbD\xe5\u6032mp6\xe8/\xb0\x96\xc3\xe1e\xdc\xffh\xf1\x01\x172\x1d\x7f\x02\x96\x88\xf1\x00\x9b`\xc2\x00\xc7=2\x02\x86\xbc\x10\xc4d\x96L\x89N\xdan\f3J\x86\x82{G\x1f\xb6\xad\xebd\u05a3\x1e>7}\xf3\x92\x97J7\\\x16\u01eaZ\xad>\xf2!\xc9\x19\x1c\xc5\x19&\u02ac\u06cc\xa6\xfc\xa2\x95vv\xc7%\xf5\\\x13O\u00ec\xa4y2;OGI6\x9f\xd5m\x87\xf4\xfe35\xeb\x17\xe3\xf8Sz\r\x92\u02b4ef\u062d\xe5\x1a\xa5j\xfcPk\xbcw;\x1a\xf93\xb7p\xab\x0eIO\x8cGKo\xd3\xf1 \xbb\x95\xe2\xd1o\x7f\xab\x87\xecm\xee\u05d8)\x17\x16\x05\x98\x88\xe9\x9d9\x96%;\xe9M\x9c\xdfx)Bg\xf1G<\x1a\xa3\xf9t\x18Vp'e\r\x17\xb4s@\a\xdco\xf1{\x97\xbf\xd70m)\x82\x92T\x9f\xb9\xce\xcf-,\x85>q\x7f\"\xcc\xe8\xc0\x16\xe1\xeaM\xfa\u0775\xbf\xa3/\xc4\x13Q\xde\xfbk`!\xc6\xcc5\xc1)\x9b\xe0q3\x02<L\xe1@\x8df\xe9\x88\x0f{\x84\xac{\u074c\xb21\x1e\u020c\xa8\xc3\x18\xb0\x923\x7f\x13\xc7\xc1pL=\xc6\xeb 9\xebx`\xf2\xdb#\xb70\x89s$\x89H\x82\xe7\xd77\xc0\xc0\x84D\a\xa8&F\x92\x84\x0f\x9c2 \x8b\tM\x870\x04r\xa4\xf2DT%O\xa5\xee\v\x17\xc6\xe97\xa7\x92\x8f\x862\x1es\xf6W\x98VN\xe6\xcb\xdb26\xdbp\x98\u0114\xbd\xa6\xf6m\x8d\xb3\b\xc3\x17\x9b@8\xbd\x06\x06Lg7\xbfj\x11\xc8\xff\xa0\tSh\xa6\xba\u0da0z\xe8%\x12\xfe\u05a49\xd7\x1d?\x88\xbc\xe2\xf3K\x18\x05\xe5\xe4}\xa0N\u059f\xbe\xd8\u07d38%\xf6\xc1\xab\x85I\x98\xeb@ji\u04d4\u5466ZeY\xea\rH(Je.\xd2\xf7\x06\xdcAM6\xe4\xf4\xd3Eq\xfd\xeaX\xfc\xa2\xfd\xbe\x81\u0266\xab^w\xde\x172K\xe3\xb1\xeam\xea\xb7o\x9e\xeb\x19\x9d\u0133\x9b\x12j\x06\xa5J(\x98> dOO\xe7c\xc4q\xa9\xc3\xe0t\xe2V|P\xec\xc1/&%\xd2l\xf1\x894\xe0gB\x1e\xc2yh7*\xec\xfa\x04x{b\x8a\xa3|\x92\xf4\u04eb\x14z@\xc67!\xeaK\xd9/\xd1'\xc2x\u07a1P\x11p\xb6\x8f@\x19g\x8b\xc5G\xb0s\xb1\x02|\xa6#\x10n\xf8\xd0#\x19\xc0\xf2\xde%\xb5\xe2\xcf\\+\xfe\\Y\xcbJN4&5m\x9f\x9a\xd8Z\x13+\xbb\xf5\xfc\x04\xb8\bO\xbd\x85\x83\xdfO\xed\xebo\xa8\xbc\xf7:\xfe\xac\xb2J\x7f\xf2&\xf2yr5\x83\x15\x1d\xc0\u0101\xc8vi&\x91\u7571\x9d\xb7\xbd\xd9\xed\x7fI\xa6Y^NO~\xb6\xc3\x16P8r\a\x15Z)\x9f$i\x06K\x0f\x92<\x05\xb2!\x8f\xaa\xb37O\x88\xdc\x19\xe0q\xeeI^fB\xff\x82\xe3\xd2B(\x95n\np\x0f)\x8d\xc0G%\x1a@\xaa\x06gHv\xea\\\x14N\xd7v-\x14\x049\u04f7!\x99p\b\xcdb@\r\xa4\xc4\xe6\xf8\xe0\u03994\u06d8Il\x1a\xf7\x81m\u027dC\x108\x99\x9bl\x00\x8b\x94\x12\x04\x1eJ<K\xfbp\xfa\xf7o\xac\xd48\x8c\xa7p`\x83\x94<\xca`[\xe0SV!!h\x12\x10\xe1\f\x84\xd1\x00Q\xcbg\x94\xe7\xfd\xd9L$h\x94\xdf\r\x83\r\xcbp\x9d\x8c\x93)\xe9\x1bp\xe3\xe4\xf18\x81C\xebf~\x9d8\u0414\t\xdeB\xaf\xdcA%\xebV\u05bbV\xd9\xc9\xd33\x13\u7c90\xcb@\xed\x18\x14\x12(V\ue745\xab\x97V/)Q=\xee\xda\xef\x80|{[\xa1V\xb3\xc7\x00jaP\x88\xf0\x81\x9a}\xf4\xf0\xaa\xe5F\xc0 \xf4\x13\xa8[s\xd2-\x03\x85\xb7\xb0\xadM\xd3\xdfx\xe5[\xba\x83\x01\xa8'\a\xde\xef\x90\xdc{`\xe4tk[$f\xa4\x8c\x04+O\xc6\xf9|*\x8a\xac\xd8)\v\u049c8I\x11\xb0HO\xd1\a\x8e)Ff\x04I\xee\x10\xb5&f\x99\xcfR\xd4\x1b\x00\xba\x00\x83\b<u\xf6\x11\u016c\x8f\t\xcfU\u02d4\"Yk\x9a\\\x03\xef\x9dL\x9f\x8d\xe1\xb4\xe3\x15\x8a\x01OG\xf5l\x8c\x8f\x1aV\xc8'D'\xd6`\x98\xe1\x06\xb9\x05\x11W%\xbe\x83\u0353gC\x12@\xb9&\x9c\x18)i\x83D 0\x1dGX[\xc05C\x85\x81\xddE\xc0\xa2\xdce\xf3\x1a\xb2L\xc9\x14Y=\x84\x9c\xe3\xe1\x92M\x10\xd3I\xb4\xc0\x19\x19\xc5w\xc4rB'\xc6t\\\xdc\xc0\x16\xb0\xe0\x10\b\xb1\x93\xf1\x98x/\xe8\xe6`.\xd5S\xa4\xb1C\x104\xa4h\x9cS\xbf\x8d\x82F@8\xc1\xc4\xef\x9a\x01g\x98\xdb\x01\x9c\xeexB!7\b\xd3\aD\n\x85('\x10\x99uk\u04b8`\xd2\x00C\x99\xed\xba\x9d\"\x1b95{\x18\xd8\x14\xf8{c\x86\x02-\x00|\x98G)\x06D\xe0\x04H\b\x01\x96\xa9F \xae\xf2-\xeb^\x84\x92q-\xe0A\x81B\xe1\xa0e?\xdan\xdd\xd2\x0eG\xad\xdbcl\n\xa8\x19\xfed\xf1\x85\x044X2\xf8?2O\xfd8\x87\r}\v=Kh\x02D_\a\x92\xb3\xc2\xcf\x19\x9e)\xf9\f\xc1\x01\xc3\xc3s\x00\x02\x11~1m\x12@\x83\x02\xc2\xee\u01a6M\x90\xfa'\xd0%\x8b\a\xbc\xad\t\x01\xad\xfa\x83\u0471v\x95\xcc`\x1e\x98\x17&\x9e\xcc*\u0172\xacE/Y\x03Z7\xe8{6\x87\x83:\xcf\x1b\xcd\xc8<9\x8d\xd3!\xf4\xdd\xe1tA\xb0}\xac\x85Z$\x8aZY\x87\x93K\x1a\xc21C\fO\xc2/\x88L\x1fFy\xf4\xca\xe0\x94;><\xd4CXqj\x99\xffi\x9c\xe2\xa2\x1b\x9e\u0702\x8f\xa2\xe3\xe4*&\xa5Z\x1em\xb5\xdb\xed\xa8n1\xbd\u17eb\xa6\x9b_\x10]\xed\x00H\xb4v#\xb8I\x8c\xe0\xc2L\x84\x13l.\xad\\\x8e\xef\r\x12\x198,B\xf8P\x8d\x94Q\t\xd3\x00\xbcL\xfc>\x00\u0298\xd3+'=m\u061a'\xf7\x1bL(\x88\xfaM\x99k\xa6\u01a4\x97Ay@\x16\xe0\u77c1&<\xc6{\xdf\xf6Sy\r\xe71\xf4\xdd\xe0\x14\xec\xc63|`d\f\xe9~Q\x82\xa7<\xad0b\xc0UX\xc8\x12j\x9c\x8e\xd0\x03\x05FCj\xeag\xb3Z\x1e\u0456\x815\xee\u01d3\u065c\xb0\x1d\xc6i\xa0\xe5\xfdl\xc2z|\x9c6\xb3\r\x8cn\xb1\xe5e\x87\xad\xc9\xeb\x9a\xd3U\xe3\x8d\b\xef\xda\xcb;\u059f\x19\x10\x8e\xe2\xa0\x10Jt\x82!\xb9\xcd/$\u014a<\xa6\xea\xc1\x12%\x06\x96%A\xfa\xc0jP-PT\x9e22\xd4\x1a\u0477\\l\u07e1\x0e\xebH\x9d\x02\x19@\xd0\u01f7Q\xbd\u01baGV\xd2\xee\u04f1.\x1a\x13>JZx\xc2\xd4k\n\x11\xf6\x03\xb21`\buX\xf1uZ\xec\x06\xfc\xaa\xe5\x16j\b\x10\x0e\xae:\xe1\x81}\xe3f`<\x1f\x0eE\xd5\t\xdcz\xde\x10\xbd\x1b\x0e]\xe6\xed;Ks+UO\x8aK)\xd5\x05\x91\n\x9a\x9b\u050f\xa1\x87@F\xa7f\x05L\x89\xa7\xaa@YG=}\xad\x93\x00\xcd\xd4\xd3\xddB\x1d\x8b\x03JL\xaf\xe7#T\xbf:\ud4a7^T\xba\xf1\u0495\xf5\xc7\x16N\x88\xaf\xa3\f\xdf\x06\xba\xb3F\xbd\x94\v\x9f\u933ex\xd8\U0004636fp\xdf\xe5\x1fS\xcc\x14S\u0197_M\x8d\xae0\xe4\xc6\xe9\xd8A\x9d2\xf3\u0306}\xf6\xae\xd0H\xdd\u00cc6\xf7\x1eU8\b\x88\xcf\x12\xefp\x1fG\xa4\xf6l\x02\xa4~<\xa7\xbbF\xc7\xf6\xf0D!G\x80\x9a\x1f(\x96\xc3\x06E@\x03!\xe1\xbc)c\xa4\x0f\xc8\x13\xdd\u04bd\x1c\u07c2\x99\xce\xf7\"X\x82\x14\x06\xcf\x130\xa2[T\xe4\u0788yS|\x9b\x8f\u0475\xb3\fG\x8c\xa3\xb9M\xfb\x1fI\u07c4\xac\x1apJ}\x98\x9bZ3\xa4y\rsz\"u\xa8\xfa\xdf\xcb\f\xc4\x173\xc6\xd1(\x8e\xfe\xe4\xf1\x81t\xad\x87FB\xacF\x86% ^S\x98\xc1?\u7987M\x98o\xbc[\x96\x1b[\xa3\xd5\x13\xe9\x84\x18\x9b1\xcb\xed\xd2\xf5\f\x16\xe2S\x82\x17\x94\xa4\xcbBD\x0e\x0ek^{>lYEuJ8@$3+\x1e\xbd\x8cH\x8c'\xc2\xfa\x10\xcaSU\xd6J\x83L?\xc3K\u045a\x99\xa3\x1a/\x01\x1eu\xc3[\\\xcc\x12]\x98)\xab\xc9A\xd8'w<y==(v\xfe\xdb\xe2\xa3'Q\x17\xe8b\xd7J;4\x10\xc2Az4\x9b\xde\t\r\xe1+\x1e<LO\xa6S\xd8p\xa2\xa4\xee\xe3eXTO>\x1bZ\xe3\x00@\x0f\x92\xcf-\x9e^Qt\xfd8\xae95\x95mN\xf6\x01+\xdf\x02\xad\x9a\xee,+\xd8\\\x03eZ6\x05\xf0\"\x8d\u05bc\xfa\xa8?s\xb5Q\xfffU\xe3\x7f\xfa1\x7f\x1c\xcf~\u031f\xac\x83\f_+\xa8\xd2\x14T\x8f\xae\x1c\xa7\x9f\x80Kg&\x7fv\x9b\tB\xb0\x8a\xf6\nv\xd54\u05f7\x13\xcdh>\x1e\xe2\xe5<?CI~\xc0\x97\x13\xf8\x94t\xb2\u011e\xa3\x1c\xd1\aD\xa0\f\xe39\xdeN3\xcf\xd3D\xc6\xd0`4\xde\xc39\x82B[(I\x87\xe6\xc6\xde0\xd9@B\xae\xe6C\u4c19\xfa\x19E\b2\x0fS@\xa8\x18\xe5g \xa5\xd3\xecs:\x8a\xf9\xa2\x8b\xaeHP\xf0A@\xach\xe6\xf3>\u03e2A\x86$`\x00\xc3&\xd6\xdf\u073f\xe4\x89\x1d\xfa]\x9a\fQ\xf2qw\xb5f($4\r\xb3<a\xd5\xd1\xed\r\xd24\xaeV\xb5\xfd\xe0\x93\xe9{\xd9K\x10\x8f2\x90\xe1\xeck\u00e7\xca{\xb5\x8b`\x0e\xa7\xb3S\\\x0f^\xb0@\xd9\xc3M4#\r\xd1m*\x98\x01:\x11\xa5\x18p\x01\xaa\x98\xe1\xfcd\xee\xa1\xe0\v\x10\xb4Z\xf8\x13Px\xd80j\x02\xf3~\x8d\xc0\xfd.j\x01#\xd118k\x0eU.S\xb8\xfc\x91\xd7\x04\x98\x90\xcaB\xfe\xb2\xdcdF\x88\xe6\x87Q<\x86\x8f\xe9?\x89\x01\xcd\v\x1e\xd5\v\x1e\x14*daW\xc1\xde\x19\f\x13>\x90\xa7\xe3\x98it\xfa\x17\xe8\x06\x1f\x9c\xf6\x00\x87c'\xd9\xd77S\xd0gT~\xe5\U000ebaf4\x9f\xf2\x95\t\x1d\xbf|\x1e\x12)\xef\xb4p\x8a\xa6I\rq\x1bNv\xec\xaf\xe8\xa6Ei\x80wT\xb0%\xe7\xe88\x9c\x0e\x99\x93\x06\xd0|(\xec+\x9b\x87\x9b\xd9l\x92\ufbef\xf7\xa7\x00\xa7\x05'\xdfzg\xa3\xddm\xb7M\x91.5\x85\xc7\x151*8\xa9\xa8\x92\xc0#\xfd\x12U\x9a\xfd\x8f0\xea\x01\u06d1\x1cq\x17\xe8b\x1b\xb7\xa4\xed\xefF9\x10\x020\xe5\xebXD\x95i\f\x14\xde\a\t+:\x1d\xaca\xa9;\xd5\u9c86\xf4\xae$\x9a\xfa\xc5\xdd\xebF\xcf\xcdu\xab}\x02\xdb~\x98\u0143\xa6Y\xeal: \x95Db\xdbq\xa6<X\x90\u0513/\x93[($h\x9c\x9bK\xff\b\x9dK\xa7\xa8\x0f\xc0;\xdfZ2\xae\xc1\x1aZ\xe1vN\u059a\xc8\xe5\x00\x01e\r\xb0hb\xae\xd2)\xf4\xcat\t\xb7f:3*\xa4x8\x056\ff\x03\u045c9&& \x01\xb6iu\xa2\x19\x1boeR}\xd9g\x1fP\x12\xb47\xa8\xa3xR\x17\x0e\xd7VO\x86\xea\x1e=\x19\x96\xdc\xd4\u04b5\xba\u0410\x00z\vO\x8f\u03ef\xae\xea8\xfa\x06r\xd2k\x9d\x86\x1c\xd5~\xc1\xf98\xbfI\xaff\\\x90\x8fu,a\xe7\x94\x0f^u\xac\xf5\x06\x03\xcbm\x91\xc9J*v\x18\x99\u01c8\x19\x9aRrU\x1b\u07ac\xe6bX\x06\xcb\u00a8'\xe8d\xfa\x00t\t\x8e\x13\xda\xf3Qt\x96\x90\xaa\xe0wf\x9f\f\x80Y\x1b\xa2\x8eN.\x83h\xcbXD\xcc\xd7q\v\xaf\x19H\xdfT\xad[\v\x0e\xb9Y\x86\x02H\vP\xe2\x85\x1b\xbc]\x0e\x18\xaa,\xa4eA>&w\x88\xad\xee\r\x93{\xf8MwqW\xf9\x05\x94x\xaf\x04\x9c\x87\xf0\xb0E\xabxC(\xaa\xecm\xbcI\xa7z\f\xc3<\x13\xc9P\x93~\u278d-\u0663\u07e0\xfd\xd7o\x1eE\x1a<\x1f\xc1\x8f~\xd3y\u050c\x92Y\xbf\xb5b[\x16\u0554\xf8\xb7\xfe\xe3o\xd8\xf8\xe9\x02\xb8\xa1\x1f\x7f\x83\x96O\xbfYO\xaf\x9b\xaa\x883\x00iF\xbe\xe1\x93'\xbb\u0649\xf1f\xe2\x82\f\xe8f\xd9sL\x1b~\x04\fL\xbd\xf1\xbe\x85\xf7!\xb0\u0674\x18\xfaE\xe4\xc7/\xa1=\xc9s\xa0\tj\x17;2k\xf7\xb3\xc1\xcc\xcb9\x1e\x05U\xb7\u0653x\x86'\x04Z1N\x87\xf6\x97w3\x83\x13*zI\xbaT!\x93\x11C_H\xb9 \xa4\xea:kU[\xaf4\x8d\rK6\xc6\xeb\xdaa2K<+\x96\xcb\xc4\xea\u06d1AC\x9a\xa7tt\xa8\xff\x91Z\"A \x8b)\x82_lz&T6gE$2{\xc4|\xc2\xd4\xf05?\xdd\xc0k\x8b\x17R\xb4\xb9Y\xf4\x8cd\xe4N\xa2\r\xab\x9bI-\xc00\x98\x05\a\x89\xc8\xf2\xf2-\x06Dc\xd0\x1b\x0fp\xc9\u02b6\xda\x03\xb6\u03e1\x99o\xaa\xe9ql\xd7P\x19\xe1\x84\x04\r\x96\n8W\x16A\xa8,\xf5\n\n^\xbc7\x8fx\x02\xe4\xd1\x03\x87\xb9\u0416\xb1j1m\xa2\xbaffQ\x197\xb1\xf7 r\xe0\x1d5g\x82\xda(\u0772\xb6\xe9\xaa\xe2\x8eZ\xb8\x12\xfe\xbd\x0f\t^/\x81\u0119\xbeV4\xe5&\xae\u039dlJ\xeb\xde\x16\x92)\t@\x16/\xde\xcd\u0261\u058c\x0f\x1d!\x16o\xac\rk\xdd.\x9d;\x01\x9b\x0f\u0285\xfc\u2137.\x019\br\x13\xa5\x90\xe4+\xab^\xc50\x15\rf\x84\xdd\xf3\x86\x91[\xc3\xe9\v\t\x89=\xfe\xae\xe0L\x81-_r\x14-G\xf3\xe1\"\xfc\x06\ua0b8-w\x04\xacM\xce\xc6$>;<\xff|\x83\x1c\x05\xca\xd5\xff\xf7\xc5\xf3\xef\xe1\xc4{\xc3\xf7\x9au\x1e\b\xbcnecZ\xdc\xf1\xa0l\xc9\x10\x8d\xb0\x10\xe2\xec<\x8f\x1e\x1e\x00;\xdf\xf6\rRu\xbbv\xa6\xd5CU\xbf\xf1\u0537\xcd\xf40\x96pA\x9d\x9d\xf5\u07df\xbdz\xc9\xe6:\x04\x02\xf8\xa6\t\x9c\xc7\xc99\xcc|C0\xd0\x0e\xbf^\xbeP4\xbeI2\xae\u05fe;9\xaf5q\u03a8 u\t\x86\\/\xb7\xab\xfeM\aX\xf3\u07cc\xb5Y\xb5\xb5\x05L\x86\t\xa9!\r\xef\x11O\xafE_Vu \x8c\xf2kcc\xaeN\x01\xcd\xea M5\xfaM\xd5h\xab\x84\x03\xa6\xe6X\x01\x12\x00\xb3\x00X\xa8\xaeD\xaf\xc2v\xd3\xeb\x0e}%U\xabo\xc3\fO\x1d\xf7\b\xe7\xf8\x8f\x83'\rm\xb1\x19\xe1\x89M\fcA\x89\x8c\xb0.\xe8\x15H\xa7\x9d\xf7\xa5\xa6\xb8\xaf\x93\xe9\x1a\xaa)\xe31Iy\x93;\x9c\xdbB7W\xd8/%C\xa3\xf6V\x99\x05\u07f04v\x87=\xfb-4\xad^\x0e\x98~\xaeLg\xb9\xd1J\u00c1\x9b-@\x00:\xd4\u02d1\x80^\t2)%\xe4u2+[\x7f\xdcX\x84\x03\xf6\x86.^\x11\x19\n\xddBPF\xb7k\xa1YK$Y\xbfT:&C`a\u019c\xd7$Z\u00d1\xffF\xe9\x89\xcc\x10\xa88L\x9e\xb4\xb0\xc2\xea\xe1\xfd\xb2\x8f\x8av\xe2i\xc8M\xddcukf\xf8[\x11dlW\xc7>\x9fjP\xd3t\xf0 `c\xa5\x1e\x1f\xe8\xdeI\x88P={1\x12\xeb\r\xb1s\xf0\x02\x03\\\x19\xa8\xe9PC\xf3\xf1R\xc9m\x17\xff\xc6\u0218\xbaK1\xbe$rp\xbc\x1dfn=\xf4r\x06\xfe\x00\u0477v\x01\xf7u\xb9\xe0\x18\xa7\x9e\x99\xd9\xf6m\xb7\x829~X\xb7xh6.\xf4\x80\xf9Q\xaeh\xdf\x03\x8fd\xbe\xbf\xd7\x17\x95\x15G\xbf\xb4\xe4V= \x15\xd3\f\xc9}\x84ZK\xd93\x8fp\xbe\x1fE7\xb3\x11\xec\x85\x19\xe0\xf6\xe5\x1c/f\xad\xda\xc7\\\xb8\f\xe0\x1c\xbe\x9a\xc6\u05e3\xc4\xddW\x9c\x93\xaa\x14\xd0\xfe6\x9b~\x8cn\xf0\xd6gLV\xb5\x13n\xe7\x19\x80\xee\x19\x98+\xa0pY5_\b\xccF\x0es\xc7\u0640\xde\xc2\xc3\x16\x9b\x81\xc2\xe1\u049fe\xd3\xdepX\xaf]\xe0\xb8\u078bH]f\vJ\xd5=-\xb5;G\xcb:R\xa7\n\x17\xe9\xfb\xf2)Usi\xa7\xd1\xe8R\x9c5#\xc2\u0433G\n.W^\xe4\x16\xa1F0\xf7x\x88\x1b\xf3_\x163@r\x13\x01\x03\x84\xf9\xb1\\g\xe0\x1d\xbb\x05B\x92\x84\xbd\x04\xd6\xd6\u021a\xb8h\xcb\x1b,\xa6ZB\x1bo\x14\xb3><\x8a\xea\xb8\r\xa6y?\x9b\xc2f\x83\xa6\xe1\x9c\x02b\xcdT\x8e5\xd8F{C\x1ar\xe0-\x8eXf4\xe8%\xe7\xbdi\xec\x85\xee\x01i\x19\xe9\xbcF\x8a\x99\x91\r\x8cB\xc1l\xec\xb4\x13\x02\x86\xf9\b\xbeW\x9b@\xcd\xf43_z\xa1E3\xe0\xc1p\x88\xb7\x16\xe9\xf5\x18\u0770\x9c\xfb\x94\xbe8\xfb\x1d\xc0\x9e\xe1\xfd\xfd\u0806,\xcc\x1a\xff\xae\xf9^O\xb8,\a\xb5\x9f\x1e\xe1\xa5\xfb\x1a\x88\xb1\t\x85\xfb\xf8M:\x00A\x1e\xa6\x05\xbe\x9f\x9d\xbc<\xfep\xf8\xf6\xfc\xfc\xd5\xcb\x0f\xcf{\x87'\xcf\x1f}\t`|\xf3\xbbu\x86\xfd\x8dZo\a\u0427\xf4\xc6\xe2\x1ae\xca\xf9\x8c'\xd5k\xa3\xf7\xe6YO\x1aj\x89\x9a\x94o\xe7\u2660\xde@#\xde-\xae nG\xb9\xfb\xa4;\x104>\x9c\xb9BMc{\xaf,\xcd\xc5\f\x9f+\xbd}\xfd\xfa\xe4\u0347\x1et\xe2\xed\xcb\xe3\x937\x11\u927fr\x1b{Z}\xd8\x04\u058f\xf0\x88[\xe4A\xe0=\xe1t\r\xba\xb56\xc0\x90&\xf9\xa3\x10\xad\xc97\x80+>\n\xba\xf7\xc8\xf6O[\x9b\xcc\xc7\x1f\xc5\x7f\xa7\u0503\xc6\xea\xf2Z\xb3\xec-^Z\xb3\xea\xc3\xc9e\xb4A\x0fx\u07e2\ub165\x065|S\xb3w\b\x0f\u0759f\x98s\xef\x86N\xe0(\xa6\x9c*T\xdc\u04d9\xe3,!\t\xa0v\x14\x8f\x7f\xac\xcd\u061c\x9fM&\xb0;\xb3\xf8\x1a}\x0e\xd0\xe2\xe1\xff\u0607\xe9\x00\x7f\xf3\x89g[0\x17\x84\xc9g{w\x06\x13H\x82\x16Y\x959\xbe#W\xb4J\x88\x97O\xa2\xf2V\x89\x06\x8e\x1a\xd2\xf62\tuF\xe3cRc\x04\u03d3\u064c\xef\xc1\x8c\xa9\x17\x94\x81\x89\x01H\xca\xe0\xc2\x1c\xb7\a\x04Z\xd4x\x02\x1d7\xf6\xa3\x83\xab,\x83\xbd8M\xd6\xcc=\xbc\xe5\xfb\a\xde\xcejY\xa6A`z\xae\b\a\xb5\x86\xe3!p0\a\x91-\xe6\\\x10\x84Q\xa9\xea\u04d7\a^\xd7~\xc3]\xeb\xc7\xc3\xfe\x1c\x83\x94\x14\u063a\xc5]\xfa\x8d\xf1\x8e\xd0-2\x1e\x17\x91\xb0\xd0Y\xb2\x7f\xf9\x80\x8b\x0f\xfd3,\x13\xf6,e\xd6{h\xb4tF\u0568\xa7\\\xd9\xd2\xd6}n\t;\xcb\vu@\xbb\xc5\xd8\xf3\x10\x1a*\xa2O\xd3\xc7U\x90\x01\xd4\xc5r\xddo\x84\x85F6\u05eb\u0794M\xec\xf2\xfe\x93]\x96\xc1\xcc\xc1\xb39\xb2-\xb4\xad\x90\xb0\xbe\xb6\x835\xb7\x1a|.+#\x17\xbc\u0515\x87 \" \a\x86g\xe0\x04\x8d>\xf3\x19II7\xe87A\xb7\x029\xbb*\xe4\u0404\x91\x96A\bI\xaf\xeeD\x9d\x89\xc4\x06/PsVtN\x94\xd8\xceP,\xa70\xf3Mj\xcc\u0643\xa6=d\xae;Cc\u01be\xb9%\u02adUJ\xe6\xcc[\u0475r\v\x81Iw\x9a\x11 \x04BA39h\xb5\x86\x862w\xe4\x0e\xce\xf6\xa7\xd2\xc6(#6\"\x8a\x9e\x89W\xd9|\xc6F\xa8\xa2\xff\x94\xeb\xb3\xd8\\\xfb\u0153\x94\u01ce]\xca\xef\xc6\xfd5\x9a\x04\xc4\xe9uf_\xc8\u03c7\xd9$\xa0N\x032\u0111k\xfe\x82\xab\x15\xae\xca\x19w\xb8\xf5\xf8\x8b\x9dJ\xf6\xb6\xe2\xef\xc2:A\x9b\xe4\x16O\x17\x91</\xf6\xfe\f\xfbR)J2;\u36f0\u0233\xc0v\tI\xb6[$\xad\xf7\x16\x17\u02e8\xb6^s\x8e\n\x9e\v>\x1f\xecy\x82\x1d\x00\xd24\xc4\xcb\x1b\xd2\xc5\u0724\xc94\x9e\xf6o\xee\xac\xffwj-\xb2\xaf31\xf3\xbe\x89?\t\xca\u00f8\x06\xb2g\x80\x98\x93\xd6\x1aN}\xbc\xbe\x1f\xb0\x1b\x19w=\xb8:$:g\xd85\xe8$W\xc4\xeb=W9\x9d\x19\x99\x97\x90\x17KY\x8e\xa3\xb81<\xffqA(7\x9b\xea\xe2\xcf,\u04c1Y\xb0\xa7\xc1\x9bW\x97D\x11\xa6\x1f\f\x15\xcc\u01b2\xe2G\xb4\t>\x14\xb4\x98X(\xcd{}\fU\x80\xb5H\xe5i\xc1\xc6\xf8\x1c\u6e2eJ\u03e6\xe2\xf1\xc0%\x8d+\x1b\xaf\xf2\x81F\x83\x9f\x7f\u0191[\u609f\xb6`\xdf\xc9)\xb1nN\t)\xff\xe4\x80\xcb?\xb0\x02\x8c\xc0\xe4/\xfe\x8b7\t\xf0\xf3\x03\xba\x02e\xa3\x1e\xa6\xfa\xc3\xec2\x1e\x9ai\xa0\xb7\xa2\x9e\xa7\xd7\xfd\x9bt88\x8d\x91P\xa5\x89\xad\u02dc\u010bxB\x97\xc9@{\xd6\xe8\u0102\x85\xfbi\xc4\x0f\xa9\x1eu\xc3\\Ib\xcc\v\xac\xd5CZB\xbc9\xfc\xe2G\xaa)\xbc\xa1\xe6f\x1e\x183\xb5\x1a`\t\x12\u04f5t\x90\x03\x8b\xe3^\xc0\xabl\x9c\xc0\xa3\x02\x824u\x99\xd9m\xb6\xac\x8c\xe9\x0e\x9b\x81\xea\x9eA\xfd\xabivY\u04b6WG\xbe}yP>\x16\xff*\xf7mNl\x16YD\f9\f\x04\xa6y\xeb3\xd7 \x94\xcf\xd8D2\xd5\x12\xb1\xca\xed\x7f\xd9[\"\x05\xb2PHJ\xf3\x19y\xf4\xb0B\x83\xeb\x8aB\xc3)c\x1d\x14C\xf0N04\bF<\x01N\x0f6`|\x8d\xceL3>\x1a\x19\u020b\xb7g\xe7D\xe2j\a\a\a\xb5\b\xe8Q\xed!~a\"\x15\xf7\xfb\xe8n\x91,\u0633JP8>9\xed\xbd}~\xfe\xe1\x87\xde\xf3\xb7'\xd64\xdb\x05\x1f\xa9\u05e4\x04\x89\xf1\xe6\xfe{L\x93\x04\xe4b\x1e\x0fK\x86\xe0\x1f\x8e$\xf6R\xc3b0\x9d\x94 \x00\xb978?\xabqb]$\xd8l\x85\xa3\x96\f\xd2)\x80\x1c\xde-\x1a\x1bo\xad0hJ\xd3,\xc4\x0f8\x85\x8a*)\x83h\xbb\x0fuQ\xbe\x17\xb6?m\x19\xc1\tS\x86\x9ey\x93iKff?\xcbv\u0586\x04|\x89hU\xc687\xfe\x8a g0\x13\xaf\x0f4\xa1A\xe2L6r\x00\xf02\u02d3\xe53Q\xbd\xd8V\xb3\xbc2\x82\xe8\x8b\x06vY\xd2\xfe6\x8c\x7f\xd6\u04c8m\xea\x00k\xd5N\x11\x9e\xa82\xa8\x81\xd8\xf1\x19G\xf0\xd2\xce\xc1a-3\xeay\x87X\xef\t\x13\xfd\x80M\x8a\xc57\xa7\x9f\xa4\x9fX\x0e\xc0\xab$i&T^\xbb\x8e6\x9d#\u0200l\xf5\xcc\x00D\x90/\x1e\x83\xc0n\u062b\xe2\xfc^\xab\x12\x0f\x06\x86\xe4{f\xac\xf2L\xe1\xaa\u0164\xd6d\x9e\u07f8\x12>E\x1bO\xed\u068c\xddTY\x93\xf4\x8a\xa9W\xb3\xda\u00c9\xf8\x94f\xf3\x9cn\n\x18\x98\xf6E\xb9\xcf\xe8\xa6\xc9\b\x18\xf8\xe5\x034\xaa\xc1`\xa0\u0188G\x8d\x95\x0f\xe44\xfa\xc6:%\x06u\u0418\xb6\x0f\xd2}3\xea\x04\x11S\xc8}\xc9j\xe4\xac\xc4\xe1S\xb0\x95\x87\x16\xa8\xfb\x9d\xd7d\t\x818(#\x11\xfa\x8er\xfdOu\xf1\xfe\x15\xe7\xd9\u07ec\xb7\xf0\x040\xca\xf1\x02aj\x04\x0e\x01\x85\x02E\xb7\x82\x12\xe2\x06L\x8bq\xe7\xd265\xefll(\xe7\xd7v\xf4\xea\xf5\x7f\x9a\x9d\xe2\x9fjy\xc6g%\x9cISR):@\xa3l\x00b\x8e\xdc\xe8\xe05OfD):\x03\u045d\x82h\x82\xb9\xf6\xf1\x00\xb7\xfc\x11*\xcd\r}5\xf6\xfew\xf5\x92\xc9\xf1\x14\x03\xd5S\xe4\xdb1\x17\x16\xceC\x1f`F'\x05\x8a&\x1c\x95\x1c\xf8S%\x87!\xaf\x1b\u043b#\xd6\xf5\xa0\bWd\xed\xf3[d\xd7`B\u040b\xaf\xac\x05\x14<\xc6,\xc8\u5651\x93\xe8\xe0\x1cPp1\xc4G\x12+Qu\x14_\"\xa8\x14\x86\x02\x12\x06.\xa5\xea\xcar\xb6\x00\x04Za\x9e\xcb1\xfc\xa1\xcfz7JM\xe0k/\xd1jP\xe0\fj+\xf1\xec2q\x01\u0668\x97\x8a\t\x8d`uP\xb2Y\xb6\x02\u0193\xd4\x1187\xd4A\xd5\xe22w\u00aar;/);P0#g=^\xe0\xd0\xf9O\xbb \xc2\u0148\xe3(\x16\x8a\xd1\xe0;\x9d\xa5hx+\x1e\xb5)2'1\x19g\xa6\xe8\x99\xe2[g\x8a\xfd\x13\x9f.V\xa5\xdfw*\x8b\xd5\xd6s\xf1j\xae\xb4\x98=1\xff\\\xba\xa0h\xb2RXOu\u022d\xb2\x98o\x12Q\x92]\x06\xcb)N{\xb9\xde!vq\xff\xd3\xf2\x90\xb0\x00<\xe1\x19.c\xf9\xacS,\x85)}1&l\x1c*\x80<i\xaf4\x1e\xc8\x1d4\x8b\xf6%[\x93\x98\x8cQ\x06m\x88O\xa1\xd2;\xe8\x9e\v26\x91b:\x86\x97\xc4\xef\"\xae\x8c2v\xf1\x1d\xd3 <+R\xab]\a\xc6f>\xcda\xe2\u990e\a\xb9\xd7\x1c\x82r\u009f\xdf\xe7\\p\xee6\x19\x0e\xcba#\xba\xa2\xda\x06\x10a\f[\xa5)4\xcb\xf6\x14\xdb+NR\xd3\xf8\x7f?\x1e\xcd\xf3\xd9cv\xb25\xae\x96\u02d8\x90z\x8351\x96\xa5\xb4\xb7\xfaW%\xc1\xad\x9c\xdfklM\xf9\xf0\xde\xccX\x05\x0eV\xdb\x1bX\xfd\xcc\xea&<7\"\u07f3\x904\x05\xc9\x18m\x10\x8fpV\x01\x1e\xdde\x06\xf6s\xf4\xce\u069d\xe93~m\xadP\x1d\xeac\xa4\x16\xaf\xb1\a\xce\x02\xc9\x06\xae\xf2\u0742\xe8\x06\xf2@\x1c\xe4Z\xf8\xab^P-4\x96\x9bTk=\u0153(\x19z\xe6G\x81a5)N\x1a\x0f\n\x8eo\xaf\x95\xae\x12g\x92\xef=\x14dE%\f1\x80\x83\xea\xd9,\x19\xe5u\xec\xb9\n\x9b\x96\xe2C\xdf\xe5\x95a<g\xbb\xcb\x03\r\xd7\xdc\x1b\x1b\x83\xac\u008d\x88\x0f\xcc:\xab\x90\xb8F/\xd5\x05B\xe0a\v/\x8cB_w\xa0\x11\x14\x86\x8dp\x06\x1b\x04]r=\x83\r\xadq\xf8\xedo\x1fT\xb9\xf7\x85\\\xcc'\x16M\x1f\x1eT\u0588\xca\xf8\x1e\xbd\xe8dC\xfc\xdeca\x1a\rg\xb4V\xa2\x81*\xa9A\x01\x14\x1d\x03i\xb0\xd7\f\xd77j\x0e0\xfa\xc9\x13\xcfc\x96V\x1d\xea\x1c\x99\x19\x11a<\xd8%\r\xedL\x1b8\xd5b\xd3\xf7\xd96^48\xaf\x80\xb0\x84>\x8eko5R\xce\x00\xa7[\xa6\xd1Hs+\n\xa1b\xd9\xd3)\x18y\x12\x85E\x1c\x19\x12y\xd1[\b\xdbV\x02\xb24\xe2\xecy\xa5Dj\"C\x98kj\xc6KR\xa9\xe8\xb8\x01\xb2\x9b\x8ddS\x94S%\xde\xc1\xed4\x9d\xcd\xc8xAN>\xb37K\xc2\x11\xb1@\xf2\xf3e\x06\x9b>\x1e\xff\xccT\xe7g\xb2\x95\xf9\x19]\x9b\xbf\u0236:/\b\x06\x1c\x02\xc7`\x82?\x9a\x9e\x89|\xab\xa3WN\x13\xf1.\xe1\xcbO\xb2\x88\xa0X\a\x00/\xb5D>\x14\x12\xbe^\x91\x80F\x9eV\xec\xb5Fa\v\u039a\x12]F\xa5\x9a\xc1\xc0[\xaem\xa8P3\x18\x00\xbf@\u06e0Yz\xc4nW\xa2`\x8e\xcb(-\x9de\xf3WFe\xdc\xf0&\x06\x9cQ\xaeU\xd0\x11#\x9ds9\xcfl\x9a\xa7K\xa2i\xd4Uc\x8d\x12\x8f\xbe\u016dD\x8eB\"\x83\xbaH\\/6dN5o\x84\xaaY\x8fU\xf5\n\x95\x11\v\x1b\xcep\x12\x9a\xda\xda(2\x16\x9d\x90\x10U\xb8\x85\xd9\xfb\x96\xde\xd8\xc8\xc9W\xd1\u019a\xb1\xb9a\xa7\x06\x13\x87\x06X\xf3\xc4\xda\xe3XE\x15\xd5\n\xac\x97\x10\xcd.\xc8f\xc8,\xab\x8c\xe5\xbdB\x1f\xa6P6(\xe8J\xba\x90j\xb4\n=\x86hX\x81\u05d02\x013%\xca|\x95\x8d\xb8\xee\xc1\xb70/\xd2\xf7\x17\xed\xf7\x96\x06\xd3\xefN\xf0\xbb\xfb\xbe\x18u\xd5P\xf91\xfb\xd7a|,\xf1\x11\tYe'\xb6\x87/H\xa7=H\xaf\xe8\xf7\x8ce\xff?\x03\xbbKT\x94\xacj\xd52*\xb3.\x96\xf2$\x04KB1\x85\b4\u01e9\xb6\x16\xc4\xe4\x01Vd\xd9\xcd\x110\x02*\xec\x85Y\x12\x12\xa6o\x9c\x95~\xbe0,&7\xa8-\xa0\xe8NDZc\xa3B5:\x05TM\xa0\\2\x95xu\x18\xe6\b\xce\f\xd1U@\xa3\xd6:\xb3(b\xf81\u05c3s\x0eg\xfb%GW\xb7\xe1\u0535\xa7N_\x0ey;Z\x9cW\x17\x1cG\x02\xab\xa7\xe3*a]\xa44\u06cc\x1c\x98}\xba\x92.b9\u06f8\x95\x1e\x95\xf6\xaev\x96\x897Q\x801\x06\x9a,\xe2@\xce\x02\x8aX\x90g\\\x1f:\n3\xbd\x0eDe\x9du\x1a.\x9a\x16/\x14G\xb1\xba\xd3\xf4>\x9c\n\xb2\u035bp\xb49qa-\xaao\xd5\xed\xe0\x1d\u032d\x1f\xee\xc7p\ra\xf0:{\xd3,\xa8g\x9c\x02\xf0\xee_\xaf\x03,\x93@\xb6p\xc3\x13OE\x15\xc6=\xb1\u020aB\x8e;\xb3\x94\x03\x8b\x03H\u0369\xdd\xe2:\xdd\xeb\x94S\xe2\x99\x7f\xc6\x19\xachz\xd3%\a\xdc\xfaz\x19\vH\xb7\xee\xd9pP\x86\x00j\xe5\x1fT\xd1+\xd7\xe4\xc5\xfbf%g/\xf7\u0756O.\xdcx7m\xdfY\xb7Yv#|a\x8a\xbc'[n7\xc0\xa7%w\xa1^\xe1\xe0V\xd4\xde\xee \xe2\tqY~\x8bsjq\x91/\xb2\x01\v\xdd\u0750\xc5B\xb6Q\xa6%\xc7X\x8bw\xc1\x89\xc3\f\x0f\xfa\xab#kit\x0eJ\x9f\x96\x8d}\x96\xcf\xe4\\\xc0\xcb\xee^$W\xde\xfar\x96\xad\xe9\xfa*\xb8\x95\u07c0i4h'\x1e\u07ed\xa8[s\xfc\x82w\xf8\xf1$`\xd8\u0449S\xb5\xc9\u0300\xec\":yy\xf0\xf0 \xaa\x99\x9a\xb5\n\r\u07331\x91j>\xba\xf7\xa5f^s\x82:?Qw\"\xa1A\x01\xdf\x1bI1g\v\x8f=\f\xed&\xedam$[;\fc@\uf27c\x9e\xe6\xa1\xf1@\x87\xbdW#0^\x01nyT\xfc\xa9\xa7\x0f\x1e,\x92P5[\x861\xd5\xe9i\xc9\xf1\x9e\xe6\x93\xd8\\\xf30\xa2F\xee\x06\xd6h\xc5\xc2n\xe4\xca\xc0J\xec\x98$4\x88\xaf\xbe\xa5HHZadtM9y\xed\x8b\xc7~\xc6\xe1\x01g\x94Z\x02m\t\x90^\x92\xd3$\x16By\x98YD\xbc/)\xeb\x04\x9d{:\x9e\xbf\xdc\x16\xd8#~P\xca\x1f\xd0\xe5\x01\xf1\"d2\xce\xf1\x051\x19\xb9\x90\xdd&o:\xb6\xc8f\x91&\x87~\xf4o\u0321\xaeX\x1a\u0471\xac\xb4\x01\u0614\rM\xfb\n\xda\xe5\x02\x16\x15\x91E3{\fIh_\xddZ?z\v\xfc23\xc7e\xc5\xf2\x8a\xb7\xc4/\x96\xb8E0\xe5\t\xbf\xcfLH\xff\xcb\xf3\xb6\xdcG\x8az(b\u0503\xaf\xdcL\x14y\xc5W\uc20c\x83\xf6\xa5\xd5~\x19\u5d23\xdcO#,\x06l\xb7\xc8\\\x9e\x12\xaa\xb2-\u943b\xbd-\x11\x04\xc22\u0606\x86\xde\x14\xd9U,\xc3\x02\x84\xb1i\x81,wQ\xc2\xeb\x19\x0e\x84q\x87K\xe1\x01\xa9=E\xacQ\xe0\r\x86\xdc\xf2\xb3'`\x96\x99\x18\xb9\x19Q\xc0pT\r\xb1\x16\xc0+\x9d5\xc3r\x11o\x13\xb2>\xb8\u07f1M\xbe>\x9aJ\a\f\xcf\u0161T\xd1\xf2<cKMe\u06c7\xac\u051c\x82\x1d-e\xb8)\u0789\x1d\x19Q6\x9e\x1a\xc3zY\x01\x04\x89H\xa5\x99$\x8d\xfe\x957\x17$pp& \x91:\rcT\t\x05\x86na\xa44Sh\xe7;\xc5\xe8C\xb4\x0ef\xb6\x04\xc6\xf2\xbd\xc7caQM\x87 \xb1\xec\x97\xe9{5\x13\xb6\xe4\x7f\xdcme\xae0\u0235\xbd\xb6\xe5\u03de\xda\xf7O\xb5\xb2!\xb5\xfa\x90t`\xa2\x8f\r\x9cq72\x91\xc6\xda\x01\x8b>t\x01KJ6\xff\xf1\x9cO\x16\x99i\xde\xf9v\xa5\x9d\xff\xc1\xa0Q\xf4\x06\x04>\xf7u\x8aq\xfd0\xb2\xfb \x1b5\r:n\xae\r\xd2\xebt\x16\xdd$\x9fut]\u035d\x8b\xfd\x1f\xdf\xccK\xa4\xe6\x870\x9e\x9f\x7f\x8e\xca\a\xe0<\xad\a&\xfa\x13\ai\xa2\xaf\xdc\x018,\x1eG\xed\xcfW\xf0?\xe8s\a=A$\x90xg\u06ea\x86\xa9\xbe\vH\x0eM4\xa3M\xf7V&\x19\x17\xd8i\x82\xedD\x13\x96\xe2\xac\xf0\xa4\x94x\xff\xd34:\x9b\xd6\xc5\xec\xb5p\xe4)\xc7\x11\xd0U\xad\x81\xa9\xbb4)\x14A\r\xe7\f=\xe4\x1a\x81mg\u0218_\xa4\x03\xcb\xc9Ke\u01a8\x81X\x00I\aX\u036eP\x10\xbb\x96{QU}\x18\x1e\xabOBi\\T\x13Xr`\b\v\x17\xcdK\xcaZ\x0e\x04\xa9\x11\xc5\xd1\xcc\u0246\\C#)z\xc073+\x91*}*+\xb2\x15\xf8\t\xf3\x1b\x17R\x90\x85\xecR\xb2\x03\xd8\xe0H\xe0\xb3\xe3Uo\a\x11\xde\x02\xb2\xa2)\x02\x8eW\xd3\x04\xaa\xe6\x97\xc5\xf5\xa2b!\x1a\xacDQ\xf0\xea\xca\xdff\xce\x1e\xca\xdboX\u02b7\x83r\xf71%\x88\"\x1ba\x90P\f\x96\xc5\x18Y\x1e\xbf\xbf\xea`ug\x8a\xe2\u0358\xa6+\xd7G\xb5\xbe\xd9\xd4\x1e\x1e&\xf2\x14\xf393{\xfd1u\xe1J\xad\xaf\x94\x8e\xf3)\x97\x0fS!\x9bpz&\x9f1_\x04\xddj\xa3\xb5{P\x92\xf4Hl\xfd\xfe\x15\x87(E\aM\u01eb\xa2\x9c-\xf3\xd8w`\xf78\f\xbf\x7f\x05gvOG\"\x93\u012e\xec+\xe1\xb4\xc1\xcc*\x84.\xf1Sg\x91\xcf\xceB\xc9Mgc\t\x9b\xea&\xcd?\xac\x14\xabj\x80y\xf47DA\xcb\x1c\xd7\xd3\x01\a\x99\x93B\r-\x9e.w)_&\xa3>\nO\xd4G\xfa\xa85\a\xab%\xb0\x81S\xfa\x97\x90\xf6b\x0f\v\xbb\xe7\xc8\xf3P3\xd2W\x1fs\x11\xcdn\x13T\xfc\xddf\u0507<T6q\x9c\a\xdaL*\xea\x91.\xc4\xecpA_\xc7\xdb\u054b\x01K\x11\xb2\x88aE\xdfZ&x\xf8\x15\x89\xf9#\f<\x9b\x8d\x1f\xe1\x06\x99$\xd3Y\x9a\xd8k\byr'\x91\xe5\xe2H\xbb\x1b\xac1O\xf7_h\f\xf4_\xbe/p\x93\x89\x80\x17K7F\xdb\xe8\x1a\xd7\xfc\\kF\xf2\xf5\xae\xf6^\n\\\xaa\x02\xfcT^\xe0\xa4Y\xadY^\x8f\x9b\xd1e#:\xf8\xc6:\x02\xff\u012c\xf8>|\xb1\xf0\xf7\xc9F\t\x83L\xcb`\xe1-\xfc\u086a\x92w\xb6$\xf2\n\u0383\x18\x01\x8a6w\xa0&&\x8as\xf4\xe2b\xb9\xf1\xbf\xe2\xff\u009d\xa9\xdd\a\xb4<\xe1\xdd\xff\\0\xb9x\xff\x05\u6072\xdcd\xf9\x8cT\xabR\xa9\xb0\xf8U\xd5/\xf1\xfe\x88C\xffU\xd4+d*\x1dksL\x7fh\xeb<!z\xe9\x17\x90\x17\x7f!4i\xe15\xf9\xc9K#E[\u01ec\u0317\xe6\x03wt\xab\avA\xe8\xf7\x97J\x192.\x13\x1a\x91\n\\\u06932\u01a8\x01!K:\xfd\xd4\xe2&.\xf0\xf5{e\xbbV\x88$\x05E\xa9\xb7e%\xcdv/\xeb\xdaeU\xd7\xea\x97\x00\b\u95c1\xdc@\x1eZ?\xe5\xaeYe\x1a\xf2=\xe9\xd8Ze@\x01\x99\xaf\x8b\u02e0KeI\xae\x8c\x91\xa4\xd8s\xa5\x7fIT\u01bf\x8a\xb3;W\xd7\x02\xd6aE\x90\x99R\xb3\xa5r\xe3\xc5l\x1ds5\x85L%\fc\x96r\xaa\x9c\xbbh\x94\u6506\xd6\u0661\x01\x99![2\xb3O\n6e\b\x90\xf4Z\xc6H\x81\xac\a\xd8\x12Q\x19\xb4\u047e\xa3\xc0l\x94\x96\xc4e\x8a\xf3\xeff9/\xc2e\"\xdc\xce\xd7\x1c\xf9\xb9\x9b\xc6\u05afg\u01c6P\u02c2\u06edt\xa6{V6\v\xee=B\xb3\xb6EvmE\xb36Q{\xfe\xfaVm\xe2\xb3^\xa0Zrq\x90D\x8f\xf9j\xfb1{@\xc6\xda*\xba\u5afa\x9eU2\u046e\x1d\tNcQpfB\x9d;\x1b[\x9cPA4\xd3V>c\x84&\xe0\f\x8c:,\xd51\x02\x99\xf3\xf4\x1c\xa4y?\x9e2KI\xdd\x03\xba\xcc]+\x98\xed\x95\xf29A\xe2\xbdU\x88n\xdd\xcd@S\x9a\xabV\xbc\xb9\xb2U\xd9\xf8Hzv\u0140\xca\xe8\xf8\x00\u0703g\x14\x18\xeb@Z\v\x05\x13\xf1\xb1\xd7E\x9d\xd7Fd*\x89\x9c\xa2\x8b\xb1\xc8\xe2.\x1b\x16K$\xbe\xc9\xe0/\x90\xe4m{\x1a\x86\x97H4\brD\x1e\xcd\u011e\x8b\xe7\xf5Re\x8c\x82$\xe4<\xb0w[A\x9b\xa0ljV\xd5\x1a,1\xd6\v\xf4\x13\xf6~\xa3\xee\xef\xfb\xc6\n'\x9e,j\tN-\x97.\xb9.\x1eg\x9e\xa9\xce\u00d0\xc0\x94\u0496j\xb3?O^\xcd)8\x9a\x7f\xbf\x9b\x92\x0f?\x8b\ttOS<\xc6\x06\xfa^\xa9`\xe4\x97\x16.\x0fXr\xe3\x9c\x06\x12\u06fd\xfc\u05b4p\x1b\xe1w\x8d\xb4\x04\xab\xaa*r\xdf#\xe9\x7f\xe7\u05a1\u010f\x03\xad}\ubfb5\xb1+\xef\xec\xc5|+\u0507\v}\xa6\xcajT\xb9a\xde\xe3vI\xf0\xc3\xf3\xef\xcf#\xe3\xde\bk\x9cN\x8b\x98\xb2\xe2\u0494\u07901\xc5\xe2K=\x17\x8d\xd5\ucac5\x02\xb7\"\u056b\x8b\xcez\xd3\x06\xf2\xb3\v\xe5\xa6\x05VOOU\xbe\xfb\x97^\xeeY+\xf2e\x96\u01cb\xd7|e\xf3\xe5*4\x88\xecu\x1e\xa9OUx\x95/_g^\xef\xdb\u05578\xe4)\xeb\xfa0\xbe\xe7\xc2\xdd\u00b6\xf1\\\xc4\xf4\x19\xe6\x1b\x05\xefz\x11\x99+M\x9aMb\x1f\x14b\x91F\xddf&\x18\x99cT\xf0LK\u066c\x05\x80\xae%\xe8\x7f\xae\xd4s\x97\x19p\xfe*\x82\x99\r\b\x06\xec\r\x06\xfbB\xfcf\xbd/\xf0\xabX\x80\x00\xf8\xca\a\x04eRq\x90\xbfWTG%\x9c\xd5w4\x9a\x1c\xa0\xe46\xcdm\x1a3\xec\xb3G\x86M\xb03d\u81d4\xe9\x92\x03P\xdf:_\xc5\xfeM\x82\xc9\xd1\x02\xf39\xf2\tq\u05f8\xd1\x1b\x95\xeb\x8f\xf2\x18\x9a,`\x04BF\xc1\xdc\xf7g3rh\x84\f\xfc\xccd\x91?\xba\xa4\x89\x96\xf44\x97\xca$0$\xf2\x8fQ\xb4\xef9u\x9e\xb4\x12\xea\x03/+\u02ac`\xf7\x04-\x97\xcb\xdc\xc0\xa4\x8a\x92\x15\v\x06\xa6\x8b\xcd\xc8$A\xc3U4\x81\xfe\xa3\x9csW\xa2wTJ2\x16\x1b\u0770\xe0*\xaa\xb5\xb8A\xbb\xd5\xfc\xbcD\xf9U6\xc0C\xf4f\xb5\xaa6k8.v\xe4|\xe0\x85\xfe\xadq\xa3\x11\xe4\xfb(\x13gcj\xf3\xd2W\xa2\xf1Q<+\xb1>\xaf\xb6\xe5\x0fr\xbf\xe4\xf3KJ\x92\x81\x82i\x89\xaf\x94\xbe\x05\xb6\"\xd1 KLb\x84Y2]%P\x84Ip\u00fe~\x84\x97\xc4M\xa0\xbf\x9ag\xd2\x1eE\xefX(\x8cg&\xa6c\xb3\xd4\xe2\x81\xf5wl\xdbg\\?\xefg\xee`o\xb1i\xfb\x98XC\x1a)\xe1\xf0\xff\xc1\xda\xf7#'\xe0\u03f2\xb9\x1d\xbc\xaf\xe1\xb0g\x0f^\f\xd7`Z\xfd\xdb\xf3/N\xe0\xc0mbX\x13\xed6\xacz\xa7b\xae\x1d{\xd3\x02\x8b\x8b\xa6d\x8e\xeex1\xa3\xbf|=\xe3c\xb2!R<\x17\x0e\x13iM\xdc\xc4\u029b)Uq[H\xa0%$\x00\xb2\xa1-\x1f\x15\x84\xbc0\xe3{Z\xd6\xefeU\x1e,\xe2\xb7V\u0738ev\xf5!b\x97Z\xfe\x11r\xaf}\x13\xa9\bS2?w6^\xb1\xc3a\xcfE#\xff\n\xc4\xf5cO\x1b\x13\xb9\xd0\x17M\xd9\u0395\xf8B\x90\x81>\x9a\xb4\xa1?Z\x91%=+\x11X\xc25\xff_\x90WphEq%\x0f\x82>?\xd6\xceA\xf6h\xc3R+y\x00\x99\xf5\t\x1c\x81\u00a4\xef\v\x15c\xc9\xdf\x15u\x11MP\xa5=V@}LQMrBSM\xcb]\u07c3^\x95\x8bO\xfe\xb6\xf7X\u04dc}6K\xa48\x05\xbd\u0093\xe7^R\u06aa\x92\xa3S\x1c\xbeK\xacO2\x1c\u0604\xbf\x11\x06\x96\xb5\xd6R|2\x8a\x1d\xa6\xb1\xf7\xb7\xd6\r\x14\x01\xed6q\xcaA\xe3B\x9d|\xa2x\xb7d\x12|\x95r\x12Y\r\xc9\xe4\xa0\x04\x92\x8a*I\xf1\x8f\x17\x8a\xcf\xe0\x14S +\x91\xa3\xb6A\x80\xe6I\xa2\x8c.]WPS\x12\u07d1g\x05\x87\xc6``\xde,\xce\u01f3\xd4$hT\xddm\n\xa9`\x8d\xbaJ\x8c+\xb6\xab1yq\xc8`9\x83\xa4\xbaM7a\x11\\\xf8\r\x13|\xeb<\x9cF\x9aA\x95D\x1a\xc6\u0179\xb4r1\xa2\x8e\xfb}\xb2!\xa2\xe5\x18$\x13Z\x901C\x8b#\xe5X\xee\xc1\xc56\x95\"g\x91\xa8#)v\x9aQ\xdb?V0\xfa\xbd\x17\xe3e\x15\xef\xcbrjv\xbd\xaa\xea\xe5\xfa\xefA\xf1b\xae|<\x92Rb\xab\x01\xa7\xc38\x1b\xaf\x993\xd7\xf3k\u0283\x88\xd7\x1e\xcf\xcc&~l\xda3\x06\xde=\xa9\n,`\xa3\n,\x9f\xb9\xe4\xf3$\x9b\xcez\xf9\xef1\xabH\xa9v\x84/\f\xbf<\xbd\xbf\xcaa\xbcDs\x82\xb7h\u01a3Pr\xe3x\n\x95\xe0&\xc1\x8b]_\xaaR\x97Je\xcaO_\xa9.\x05I\xa5n\x93CI_X7\xf1S:\xd8'S\fL\xb7\xb2\x1fX\x14\x8d\x8d5\x917}\xf5\u0197F\xa0N\x0en1W\xc5F3\x81\xe5\xdci\x19sZ\x18\x85;\xdb\xfcx:\x9e\xb2\xa5\xfc\x92\xf2\xd9\b\xc7d\x10\xf1r\x98]\xfa.\x1d\xb9\x0e\xdf\xe2\fE\xe9\x8aR\xcfG\x91)\x12{\xd7_\vwS\xea\xe8\xe94\x1b\x85\u060b\x8bVa\x01\xef^\xad\x8a\xa4\xa1\x82\x0f!\xf8kU\x89\x8cXc5ldu\xdf\xfb\x96\x18\xad\x06-\xe3,\x94]\xa9\x88\x86q\xecl\xc3t\u0100\x87a\u0746N\xb7]\x05\xd7\xd9\xf1\x1af\x8d\xd2g;\x8b\x9b\xb2\xda\xc1Z\u053d1\u0454/\xde\x19\xd62\x8e\x9btS\\\x95l\xedH%&\u00c0MEC\xc5b\x14\xdf\x15\x05\x8c\xa2\x1bX\x99\xa1\x96\x8e\xac\xeaEXP\x17\x9e\x15\xfd\x8d\x8d\\\xa2\u0647{v\u044f\xccz_)\xc8S\b\xa7\x9f\xfd|L\x18}c\x18\xe7\xb3gr\x99\xa8\n\xe2a\x8f\x14\xa8\u0768\xb8H\xfb\xe2n(\x8b\xb1<\x8a\xd1C\xbcK\xc6E\x1eM:8\x1a\xe5\xfaNG\xa4\x15\u0118\xea%q\xb7\xd8\x10\x94\u4698\x1ci\x8dQ\x82\xe8\xc4Z\x0f\x96t~9\x95v\xe34\xfa\x99\x03+D\xb6|F\xbe\xda\x0f\xa4H\x9b)\x1bo\x18\xbaNJ\x97\x92\xfc\x00p\xfdS\x06D\xa5\xad'\xd6\xc9&\x81\xd3F(\x94x\xa6{nX\x9e\xdd\x1eZ\u0268W\aD\x1d4Y+\x179\xcaF`)\x82O\nV\x13\x8e\u050d\xed\xa2\xcb%E9\x16\x87W\a\xa1\x97\xe2\x9e\xff\x93\x04U?\xd3Q\xaf\xe216eF\x18\xc4P\xc7\xfd1\xcfYjC\xb6\xf4\xf7\xf1\xa7\xf8\xac?M'3\x0em\xad\xb6Q?\x1bbz\x19\x805\x98\xb3\x9b}t9\x17KX8\xd1'r\ra\xf2g`\xa2\n\x145\x12\xbc\xf3\u01d9\xa8!Y\xb3\x13\x1d\x0f\x06\xf5V\xab\xd5\xe0<\xf3\xb9K\xacJy0\xfe\u0754{$QgQ\rNFH\xb2n \x87\xacs\xa2\xc5V~\xa3\"\\\xc1\x180v\x1b\xaa\x97\xd9??/h\x9e\xc5\xe7\u04c6\xcb\xf6\xa3\x81\x89\xa0{\x87~@\xa6\x13\x92z\x03\u01c3\xfb\x8bc\xc6\x0f\x87\x94e\\\x91l[\xfc@\x92\x9f\u024c\x7f@\x1b\xba0\x83ml\xdf/\xd4\x18\an\xfa\xb6N\xa4\u00ed\x990\xe9\x94\xe2Vl\U000699ea\x9b\u0320\xd9>\x99\xbc\x82\xf9M\xcc\x1e\u0554k\xb9\u050a\x9a.'z\u0448\xaeh\xf0{\xd8\x19\xba\xc6x4\x8do\x1f\xb1}\xb7\xe8\xf5\xc4\xfd\xf2rX\xd0i\x0f\xe2Y\xacTRrx\xeb\xf9\xf0'\x14\x91\xa5\xa8E\u00be4\t\x16\x13 \xaf\x86\x9b|\xcb\x10\x8b\x06\x10j\xeds]\x1bwe\x9f5)l&\x01\xf0\xf6\xe9/\x1b=\xfa\x12\x1c\xe02\xd9?\u0665\x16b\xe5\u50d2W4\xca\u053a^H6\x9fG\xf8\xf8\x913\u07f5\x83G^\x1c\x8by\x92\xdfJ\xb7\b\xb6\u0152\xb4o\xbe\x99\xbb\xbbI\u0216$l\xb30M\xe2j\xbcjq\u01e7\xb2e\xcd\xcamY\x1f\xe1\x14\xa3E3\xf6\u05183{c\xf7,Z\xed\xc2]\x97)\f\xc3!h\xabx\xc36T,\xff\x12\xbb\xf4\xb2C\xce7N\xb7\xa2\xbf\x81\xe9\x04\xffJ\x1b\xf4\xd2\xf0\xa6\v\xf1\xb3\x1c\xd1<\\\xfa\a\xc2\th\xa1\xb0\x15\xca\xd7\xfa\x187\xc9\xff\x87\xeb\xdd\xc2)Y\xb2\xe8\xa4\x0ebz4\x9f\x0e\xff\xb1\x96\xbf\xe7:\x1e\x81\x10\x93\xa1?.^\x99\x92\x0ex)\xbd\x17\xc4x;\x1d\xae\x8a\x1b\u0335\xdb\xf37\x84VU\xf7\xa9[\xae\x1au\x18\x97\xdaV\xa4\xd3\xeeITkzO\xed\xca-f)\x8d&\xfd\x9f\x83\xa3D\x916\x9f\xc4\xe2IF\x06\n\x18\xffJ\"\u9802\x88S\xef\x90\x12|\x92\xe5yz\x89\xf1s\x87\xd9|\xb0\x86\xf6[\xc9@Ecu+\xee\"\x7f\xa2\xae\x95\xaf\x14Qo\xba\xd2\xd4~\x90\x84\x99\xff\x1c3,\x831\n\x81\xcb\x18\xadm\xc8,B\x9cC\xc6\x1c\x10\x96\xf3e\\\xc5&D\x82d$\x9a\xb2\x06\x01\xd9-\xebV\xc4\u046a\xbd\xdc=\xe1\xd2\x15\x96\xa2u\xc4\xf9\x83\x8a\x89e\x8a\xc9d>\x94d\x93\xc9J\xf2\xa7\xf8Ck\x99\xfbP\n\xf6\xf6\x9c\x90\xc6\xc4%\xb6\xaf\xaa\x8d\xaaD\x95\"\xb9,\xcct\xf9\xc3RV\xfd\xe6}\xce\xc1\xd0S\x1dL\xc2\x1fr\xa0\x03\xe2n\xe8y\xb0\xf1\x83\x81e\x8e\xdd%\x03\xc9\xec\xde\b/L\x81\xf7V_kf\xac:\xd2K\x18\x01\"+\x8f\xfd\xa0/\xb23/\xee\x83t\xaf\u032a\xd2f\x8b\xd0\x0e\x10&\xb4PE\xac\xee\x82W\x05*\x90\xbe\xb8\x98B\x9e5N\x99?\x05\x83uQ\xba\x02\x05W\xe5\xe4Wdd\xf0\xa3\x01\x87SDZ\xfbr\xa3c\x9d\x92!4\xe1\xf9U\xf31T\x8e\xa8:\vC1\xc4q1\v\xc3\ak\xd7\xef\xc5R\xd5n\xc7e(Q\x9d\x88\xe1\x98-\xc1)\xfe\x13\x9b\x00\x98xn\x8a>\xff\x1a(\xc0&\xe7K\x82CW\xce\x1ay\xb2/\x8e\t\xedm-\xae\xa0.\xf2W6R/\\b\xbeq\x97\xb2\x05\xa3\xb2\xd8\u0454Y2Zv\xa3\x89\x9f\xc6Ky>Y\x10-\xb5\xb1\xfa\xb4Z\x13'3\xb3\x97\xe8\xac:\x15\xfeq\x95\xa9\x95\x10\xd0zr\xc9\ff\xd1\xec\"\x17\xe5\x17b&\xa84\xb9G\xeeY\x11\xe9\t\xcb+bp\x92\u056f\xcd\xef\xbbl\xcaH\x99}\xbf\t\xcb\xc9wi\u0454\xad4gy0i\xf9J\xb3\x96\x87\xd3\xe6\x9b\x17\x89#\xfc\xb8j\x03\x96a\x95\xd1\xc2Xn\xfd2\x11U\xc3\n&@\xael\x85!\x10\xaa\xed0`\x7fb\x1d\u0749\xa3\xb0\x96@}\xf4\xe8/\xe8v~\x91\a\x9e\u0355\x97\xcc<\a<\x9d\u04c1\x13\xf0e~\\{\xac \x16\xbbD\xd8L(0\x95\x93hj2\x1a\x98\xc8\xc4)\x87\x98\xf22\x0f\x90Y\xead@\u05d9\xcaBB'\xbc\xaa\u010e\xbcbG\xa9\x80\xbeEZ\x9f]\xfe\u0666\xa0\x83\xefty\xe0\xc2\x7f\x87\xa8\x84\xf7cP*\x00V\xc0&\xbb\xeb\x04\ubaf1\xaa\u0502\x0f\xfa\xb0.5\xd9T,\x00\xf0\xaf\xb56k\x9d\xfb\xe9\x94\xfe\\\xb6\xca\xf7^A\x13\x10\x86#\xe8\xfb~\xb7\xab\x1d5d\xc5G\xae\u027f\xferI\f\xd5_\xb8b\x06\x9a\x89\xd7\xf7\xd7_1g\xcdV\u0620\xcb\u058c\xab\x96\x94-[6\xbb\xf7\xe8\xa4[\xb8zU\xc7\u07bf\x96o\xd1\U0009573e\xab/`^\xb6\x82\xabi\x1ah \xff$\x8a\x86[\x10'\xb2\xdb\x16\r\xe9\xec\xfe\xda\x06\x0e\xa2\xed)\x1c~\x81\xb6\xe19aH\xc1\xf2\xac\\\x95P\xd4>\x94\x8c\x05\x8b\xc9c\x90$O\xd0,\xd3\xea\x18jR\xb5\xd6\fR\xdc\xfeM\xd5\r4\xe62s\x0eO\u06e0\xb4\vV\xb1\u0403\xad\xb6\\\xa5\x00X\xf1\xfb3\xd6f\xe7\x85\xf0K.\x8d\x1b!\x1b\u0170\xc12\xa3\xc9\xecN\x126\xb4\xa2\xb3,\x12\xe7.\x06\x97\x8dA\xf6\x95JW\x8a\xeb\xc4\xfb\xc6)\xe0\xfa]\xcb\xc5Fgg|\x05\xae\u9095\x8b\xfd)&\xe0\xc6\xe8\xbfd\x15\x86Z\xe4\u02c4\xa1[o}\x14\xb9\xcd\xcd?L\x90\xb1\xd8\xfeVg\xa1s\xcf\x1b\u047e*\xf5\xd4\x05$p \xac\xd1B\x00\u0099\xa2\xef\xabR\x06D\xe6\u0633\x8b\xa4%\xec\x19+`Lk\xfb\xae\xafr\xa1(0\xf6m\a\x16FO\xf9:]O\xf6\x8f\xa6\xe5\tq\xfe\x1f^\xc9\x13\x0e\xe8_:\x9e\x15t<\xe1\xa4\xfdK\xc5\xf3k\xa9x\u0099]M\u00e3\x93r\x15\xf4\x16\xe4\xfc\x01\x95T*2\xbeN\xfdd\xefPy*l\xf2\xd2\xd9\xf4N\x99\xcd2XEm]\x1a\x18\xb4\xfa\xea\x93\x7f\x949\xe6\u0138\x8f\x1d0\x80\xbb\xa9\xcd\xe4\xbcQ|%9\u0599;\xc9\x19\x9c*\xee\xccPV\xcd\n\x01\xec\xee\xa5\u00dd\rY\xb9\x13\x05t\xf8g\xd0_\xad\x80\x0fK\xb5W\x95&\xff)\x1bs\x1a\xeb\xfah-\xea\xe0\x01\xf6\r\x1fdkk:\x1e\x02\xee\b.mM\xecW\u0174\xe0\xe6\xbe\x12\xd5|d#\xc3w9\x9e+\x10\xae\x1c\xe5~!\xd2\xf9-\x7f\xf2\xed\x13K\x8c\x1bi\x02\x8b\x81AW\xc5\xdd\xe9\xa7\"\xe2\xfeK\x81\xf8\x0f\xa9T\n\xf7\xe7\xbd\xf5\x87\x05\u0352\xd9D\u03684\xb1a\xf5\x99\xb9\xea\x89\xf9/\xe5\xe2\xdf\x0e\x0fV\xd1-\x86\x06\xfeP\u0313\x18VB\x0e\xa3vn\x14\u04f3}\r\x8e\xfcK}\xf9W\xc0\x89_\xac\xbd,rr\xbfp}\xff\xa5\xe7\xfc\ubbb3\x1f\xc0uz\xb7p\xfb\xebP\xac\u04fbJ\x05B\x19N@y\x8c\xcc\xfa\x8b\xb6\xfej\n\xd4\x114\n\x9d\xfb\xe7\u0420>\x1b\xaf\xf1x\x9cV\xe5k\ucd28<\xa5;\xff\x1a\xcd\xe9\v\xee\xc1W\xabN\xab\x92\x8e\xfd]\xaa\x8fx\xb0\xffL\xfa\xa3\u0088\xfe\xa5@ZA\x81T\x98\xb5\x154H8a\x89U\xe4\x86\\\x93\xafJ\x17\x82\x99\x18\x91\xee'\xa7\xe6\xf5\n\xd2\xfb\xa6\xd2\xf5\x1a\u01fb/\x96\x96\x96\xed7\x9f\x9c\x06\x1b\xf7\xab\xf5\u00e5\x1ab\xcf\x01N\xddn4\x8dw\xe0\xbf\xd4g\x8b\xf0\xea\x17\xea\xcf$\xb9\xfd\xbf\xf4f\xffhz\xb3*D\xf8\xfbS\x9c\t\x8a\xfdKa\xf6/\x85\xd9\xff\x0f\x8a\x92\xc2\xc6\xfc:\x8b;\x17\xfb\xab|3\x15\x9f\x9a\x1d\x12*\xd4l<1\xc7[\x94\xb1\r\xc5\x10b\xfb\xdc\xc5\x7f\x00v\xe0_\x9a\xc1\xbfC\x84_E5\xa8\xd1r\xb1\xa6\xf0\xfe\x9c\xae\xd1\x18~)F\x8d\xab\xda0V\xc9\xf8\xb4\x84n\xff\xaf\xa0\xfd\xaf\xa6\t\xfb\x97\xa6\xf3W\xc5\xf1{\xa9:uF\x83r\xc6\xfb_j\u03bf\xefE\xfe\x95\xf5\x9c\xa5\b\xc1:\xce\xf7\x7fE\x1d'\x06\xd2\xfe 1\xcc\xfeI4\x9c\xff\x8eo\xb1\x91Oir\x1b\xa9\xa00\xf31 \x13\x0e\x18\xd9\xd7+\x8c^}\x9bM?\xd2\"\u9812\xf1\xd8r\xb1\xb1~\x8e5\xfd,U\u0610\xc9*\xca\x01\xb9\x11w\u03a1\xdc\v\x95\xd5t\x9a\f\t\xd5H\xcfJI\xf0z\x1cfr\x94\x8d$\x1fV:\xab\xe5\x14]\xd1\u0169\xa1\x10\x99\x18U\x1c\x9a\xa0v\x18\x95\xa9$`y\x9ea\x06\x99\xbb(\x1f\u015c\x95\xaa~\xf0?\x9d\x8f\xd0\xfe8A\xc6\b\xdbe\xa0\x80\xf8\xb3\b\u02a7\xbcAL\xb2e\f<F`)\xd4\rE\x8c\xc1\xf1!\xa4\x9b\x18\x96'\xcf9\xca}J\u0306\xaa\x98c\xb0P/\xaa9t9\xbb\xc5)\x95\x01r\x9cx\xf1\xadW\xa9\xfa\u00b9Y\xe38\v\x19\xf4\x8fU\xd0\xd8i\x98\x90\xe9\xdd$\u00e4\xbb\x14\x00\bC\xba\x91\xb4\x91\xa0d6ger\x11X\xebyv\r\x00\xe1/\x06=Ey\xe4S\xca\xde\xf9%e\xcf\xe6@\x13\xa1t\xcfL\xb7q\xec7\v\\R\a\xbfS\x15Y\x12,\xbb\xa0\xe8\x9b\xf9\x18J\xf3\x13\u018c\xe4s\u049f\x9b\x96b\xa2eK\x9a|\x93\xe4\x18d3h\x14\xf7\x19<\x16\xaf/C\xf3q\x12%\x82\x89l\x15\x8b\xec\xd1\r,}<\xed\xdf\xdc1Z|L\x92\t\u033e\x042\x18\u00bc\x95\x87m)\x99a\xa6\xf7X\u0152\xfa\xb2up\xf0h\x13\xc1\xa3\xdc\xe43W\xbbQ\x12\"!M\x03\xba2\xf3T\xa6\x1aM\x02\xfd(\xb4\xae\x14\xe4\u0617\x03\xdb+\x0e\xf0U\xd6'\x8agZ\x9e\xd7\xdd`\x96\x99?\x9bV\x9d^\x18\xd2X!\a\x10\xc5\xfd\xac\xe2\xc7\xf0\xb19\xc1\x8d\xc0I\xdc\x11HN\b\aK>\x9f\xd4\x1bM3/\x13\xe8\xc5\bd\xe2\xba\xecW*\x8aA\x9fr\x13\xa4\xcau\x03\xfa\at\x83\x88\x8eY\xe6\\\xf2\xc6+6>\x1c\xf8c\"\xba\x18\x1b\x18I\x01f\xe5\x9eb<\xdf\xf9\xc4,\x87\xea\xdd-\xdd\xf3@9\x03\x8f2fp\x8e\xb4\xe2\xaa\x14\xb2\xa7\x1b\xa4\x0f\xb5\xd9\x12\xa0Ot*e\xab#5%0\xafTZ\x10\x80\u042e\x17\xccq\xd6O]\x00\xcf\u00a2YN\xc1R\xed#\x893<\x8a\xeft\xd2x\xa6pxr\xd2\r\xd8\x04\x83\xfcL)\xed\xa0\x19\u0332I\xc8\xc62\x8c#\u00dc\xa8\x89\x98\xf1\xab\x06\x8b4\x81m~r\x95Q|h\xea\xf8\xf2!\xc1o\u0105%{\x95I\xc7\x17\xa1\x15&\x9e\r~\xf5\x90\x1c\xa8\xc4\x04\xe6\x88\xc2D\v\x12\x19\xb2\x16\": 9%3\x84\xc3.\xf9\xec\x81q+\xb2l\x92\xb0\xdckAz=?\u0735fD\xc8R\x9c\"\x13~z\xc5\x19\x82s'\xcdo\x8a\xd7|_=G\x02p\U000376e3,\x9f\xad<I\xc7\xc4\u03f0+\a\xf5\xd8P\x11\x8ca>\x99\xab8\u0337Q\xef\xf53\x9b\xf3\xc3&\xe3\x91T\"\x86\x1c\v\xf1\x06\xe9\xbau\xdd\xc2\x00\xe9\xf9|BAu\xd3\xf1U&\u050br\xd8\x01\xd5J(\xbe4~\x99\xf5\xe1\xa4g\xf5\xe90\xfdh\xa1\xb5\xa4\x92\x14XDD\xa5\xf9\xf3BW\x88\xad\x87\xb1$\xc4 \r\xe5\x84G\x0f\x91\xf9\xf5\x8d=d\xceL49J\xc6\r#\xc38 8^\x19\x1eFl\x1f\xc4\u04c1\x05\x0e\xef\xca\xd7\xe29\x1d)>\x15\xe3:\a\xf2\xa9\x8dUPN9\xe0\xccDV\x057\xe0\xb8P\xb5\x9a}\xc2A\xee>\x94=<\x9b\x01\xb3\xfe\x81\xb3f\xb2\x8b\xc9Q<\x01b\xc9\xc3\xd5+C\xacQD\xbc\x11\xa9\xa8h\x91\x89\xab\x8e\t\xb5(\x0f\x11\x05$\xc4j\xb9\xb8\xbfp\bB\x90m\"\\L\x93\xee\b\x10\xc0$ \xe4\u0514\x18P\x9e\x83&\xb6lh|\x18TFa\x91s\x93e\x1aA\u046c\xe2\xed\xfa|J\xada\xec\xe3:!\xcbmb\xe7\x9f1\xa4\xd12c\x951|\x90\xc3Z~\xe2T\\\xd4`I1o\xf3 \xb9\x9c\xd3\x17\xc4\x19\xfcD\x18\xf8IXV{o\x93X\u0547\xc0\x82\x0e1U\xb3\x88NCT\xe1\xe5\u05ef9\x92\xa0\x99c\x90\x8c\x80B\xe0\x15\x80\x94\xb79\xcap\u07a4\xb9}\xef\x19\xb5\xe8?\xe2\xc6\xf7\xed\x05\x80n\x87\xe0\xb6f\xd9\xdb\t0TGP\xbc\u0790\x94\x8d.\x98\xf1%\u043b\x8f^\x8cV\x1c;\x10\aF3or.\b\xe0{\xa7\x9b\x92\a\x15\xe50d*l\xaaxz\x9d\xab\xc9P\x81S\x119]\xb4[\x87\x9aO\x0e|\xac|\xa2F\xf5$Bx\xad?\x03\x96\xd5kQ\x8d\x06\xf4\xe3\xd8\x0e\b\xbb\xdd\xc2\xe0\x88wu\xafKM\xaaf\x14V$\xaf\u06ac\xa9\xef\xa6\xf1\x04c^\xb2`~\r\xfbvb\xb7\x17a\xdbE\x8d\x1e\xe2Z\u04d7#\xe0\xca\xe3\t\xb0\x1fz\xd1\xe9\x8d\x1a\xa7L\xe3w\x04.\x9c *\xac'\x92\x1fT\x94\u00c9\x1c\u0197\xc9\xf0\xa0V\xf3f\x92\xa1\xf3;/\xcb\xe7=\xa7\x97\x00\x043\x19\u0485(\xaa\xb5\xa6\xc0\x99\u01f3\xfa\x93'\x05\xfaP2\xb3z\x02N\u0183pl\xadkya\xe9\xcd\xf5\xb2\x928\x0fj\xfc\x16\xb4I\u07f7\xa0\xcbkk\xe5]\xfeRr\xf1\x9e\v\xe3M\x03\x98\xce1\xb3\xaa\xd2\x18Q\xd2^N\x96{\x93LQ\xfb3\xcdF\x9c3\xbaD\x8a3G\xca\xdb<\t\x92\xd6#CW`\xf3\x85\x11\x97\x94]\xc4\x18\xfb\xd9\xed\x11\x16\x87x\x1c\xa2\xb69\x9d\u0275Vyg\xadb\xca\x01D\x15V\x9f\x1d\tI;\xa5\xb8L+\x01\x10\xb7\xef\xb8\xffh\x94\xccn\xb2AN\x01H\x93>\x88\xde1\xd0y,\x83\xa1C\x9dT 9\xe3\xbc\x06\xadp\x8dJ\xa6\x17w8?\xb9\x04$+\x9d\xafzM\n\xd5py\xa4\xae<\xf2\xd5\xf5\xb4\xab\x9c\x19\x0f\xf3\xf1\x8fm \xebd\x96\xcb\t\x88\t\xc1q\xb2?\xf3W\x18\x04,Z\xf2\x19\u00fb\xdb\x1cq\x85$M\x9d\xb6\x02\u0181W\xedQn\x02\xaa\x9b$G\xfd\xcf\xcd\xe8'\x84\xbd\x0f\xd5(O\xc1c\xd9\n\x95\xfd\x9f,\xe32\xf5P\x90S 9\x1c\x8e\xb1O\x94\u046d\x8f\x8b\x80\x19\xde2\u0526\x90\xb4\x80\xa9\xfb\u0592\xab+bH\x10\xd10V:\xc6\xdfU\x90\xe0td\x8cKg\x86\xaf'\x13$\xad,0r+\xc7\xe3'\xeb\xb6\xc7\xd1\u009b\x03\x1c\xb9\xd3\x14>\xd6\xe4f\xc8Q\xea\xa1Bj\xe1|)L\x0f\xf4\xec0\xce\xd3~\x14*\xb3l\x84a5\x87\x80r\xf8\xa5^\x9bd\x935VS\x02]^<\x89\xaa7-\xa8VW\xa8\xe5.\xddi\xd2P,\x9e\xf2\u0589\u04e1d\xa6\u00ee\xd0aK;1\x9fe\x13r\xe0m9\b\xa2\xf2\xe0\xda'\xffQw\xcdq\x0f\x9b\n\x15\xd7\xf8\xa2\xddo\xbf'\"\x02\xf2\xa7p\x10a\u0198\xc4\xe4\xd1\x13Y\xfd\xf2\x8e\xb8\x19+v\xf3\xa6,v\x02\x8b\xd7\x1bn\xba\x1b\xdeD\x9f\u0154\xfe0\xbe\xd7TS\xe9\xb5{M8\"J\x9e\f\xaf\x84\x96\xfb\x03&\ab\xa3\x94\x0fm,\x1f\xbb<\n\x85yE\x88\xfe\xbc\xd2\x13o^\x8b\u0543\x19\xf1pO\xe6\xff\x1d\xaa\xf1;\xed\xf6(w\xb96q\xe9c\xbcy\x88\u0138\xc4RSL\xaci\x94\xc7\xc9g\x9aQ\xb5\x0e%f\x13M\x84\x1d\xac\xfaR\x944h@'\x8e\x13#1\x1f\x14\xaa\"\u066e\xb5k\xfbln)\x8ax-j\x14\x9b\xd4\x11\x8eD\x94\x97pZ\xd6\x11\xcd\xc5\xff~\xdc\x14e\xaa\u029a:\xcb<p|\xeb\x01\x83\xa3\x04TE\u071b&\xff=\x87\xa6p\xf8\xf5\xae\x8c\xb8\x80\x85E9\xcb\xdc\xe1\xd1\xe9\xf7\xb2,\xe4\xaa;\x1c\xcbe\"\u0598\uac0a\x06\x94\xdcs\x98\x13\x11\xcfG\xd2wHM\x8b\xb8fE\xd4;\xe4!\xd4O}%k;z\xe0:-\x01l\xcd\xe9\x00\a)\u9244\xaf\u0186\xab\xea\xc9[\xd9o\x12a\xb5\xc8J\xc8{[~\x90\xe6(#-\xac\xa3\xca\xd8z\u05c0\xa0\x8b\xea\xc8\xfb\xb0\xbc\xa4hYX\a\xcb\xd8z3y\xe0\u0324\xed\xe3\x17\xf1\u40f5\uc827\xf6lt\u0649\xf9\xb0\xaa\x977h\xcb7,\b\xcd\x02U\xf4\x93\u05a8\x1c\xa0aY\x92\\L\x99\x01\x8c\x97|\n\x1fx\xdc\"M\b h92:xM\xa3\xf2\x96[\xc0\x9b\xe4\x0eDQu\aQ\x8d\u04aaW&\xe2\xa7\x17\xe6\x9e\xf6\x05\xa5\x02X\xc8}\x9e\xbb\x03\x837\xf8$e\xed/\xf2a\xaa\ts\tz\xc79\th\xfe\x17v\u03e1\xac\xa7L|\xc91\xe4\xe1\u06e9<v\xf16\xcc{k\x1fl\xf0A'\a\xab\x1d\xcf)\xbe\xfdL\xb6>\a\x92\xc7H\xc1\xa6\xba\xb5\x10\x9aq\xfbU\x9a[Q\xdbV\xf4\xca\xca\x1e\xa6\x13\x17\xa6\xe0{\xd9\xfc^\t\xc2fF\x0f\xfc\x19\x1au\xe3jRXi\xdet\x03\xcbWUM\x9f\xbf\x83\xffq\xa7\xd0h\u04c6\xd9u\xbdv\xacG\xefZl\x01\xbf:,&\xef\xf9\x8e,\x06Ko\xb3L\x1aC<\x9f\xb0\xf7\xbf\x1a6\x97&b0s\x1a\x1e=\x83$O\xa7j-]$\xee\xb2N\x9b\xd8\xect\x0eJ-\x922l\x98\x16\x11@n\xe3\xdces\x88\xf8\x16y\x11\xaa8\xa2]@\x13\xef\x06\xa3\x02\x9b\x8bs>\x16\u6984\x80\xb1\x94V\xaa\xc9\xfe\u06d0\x15\xff\xc4\t\x8c\x98\u0081\u04a6,\x98\u0339<\b\x98\x1c\"\xd6\xe2\xb5\xc1\xabf4\x99\x1b\x86:qI#$\xf7\xb3H\xf53\xa50\u05e2#\u027fd\xb4\xa2\xe4\xc7\x1c\xb6>u\x15\x05d'5\xea\x04)\xe8\xa64\x1e\xf04]&6\xed\xbb\xbd\xe0\xe6>\xd6r+\x8b\xcb\xfc2'\xc68\xe4R[\xe7\x96)\xf5n\xca\xd2\xfe\r\t\x85\u0400\xc8\xf7\x03Z\x01RI\x1b+\x17\xff\x1a\xa0\x15E\xa7\x00\u02b0\xb3\xeaZ\xfc\xc5]p\xe2.\x91\xbe\x03\xf18_&\x1f\v\x8f\x1a\xdcJp\xfa\xe7\x1aV\xab\xb9\xb5\x991&\x19Y\xca\xdc\x15\xb0\xe1\x8dY.+\u010b\xc8\xdfd\x1f\xb0\xdb4O\u00ba\xd7D}J\xa4\xff\xaa\xab\x80U\xafP\n\x15-\x86\xb8\xabX1\xcc@\x04D\x82\xb3\xae\xf3:\x8b\x9df6\u05b3Z\x86\xc4t\xebj\u018c\xe2\x04\xe0\x13\x87\x97\x92\xb9a\f\xbb\u04b6M\x9c\xe5!\xd79\x06L\x06\x95\x00)\x16\xecQ\x0f\x1d\xcaRF\u3c9bQ\x87N\u0548\xf2\xfe;\u0443~$e'\xbdG\xa4\xfa\x16\xfe\xe2\xb3}[\x1a~\x15\xd3H\v\xa9\xa1\x1b\x03\xd9/}\xbe\x9b\x93y\xc4\x1b\xe5\x82\x18a\fD\xcc\xf2\aq\u01cc\x84\xe7\b\x1c&\xc9]\xcb&\x9c\xcb6\u0631\b\f\xc9>\x9c\x15hQ\x04\x13\xfc\x115\xca\x00\x84^\xaf\xdd\u04ad\x0fn\x9c\xa6$\xe9\xe5{\x9f\xc90\xe6L\x12\x03\u031ek\xbaE\xf7\xe1\xb4\xd5\xe9\x02\x0455\xb0\u0733\xc4,S)5#A\x91\x8b\xc9\xe2#\xa8\x98\x94E\xa9\\\xa6\u041d\r\x91w\x93#\x8ff\x83F\x84\xb9O\xdd\xed\x9cR\x80\xf0\xc5<m/\u05ee\xcdG\xc3h\x06\xacL?\x9e\"a#\xc5 \x1d\x01h\xc3c\xde\v\xd5G\x1c0\xfbt\x9a\x8c\x04\xfd=\u02e5\u0798\xb5Y\x11k\xb3r\x145\xe9\xb7Y\x90\x92\xc1\xb3\xe6\x04\x9a\x81r\xa3I\x86\x99\x12h\x17*\x92\xd6\xc4M\x00\x8b\x869\xe2\x81m\xc5f\x8f_\xbd\x80\x15\x1dH\xf6)X\x81\xfe|D9\x16F(\xe1\xe7x\xc7\x05/\xae`?\xce\xec\xe0E\x1aO\xeej\x94\xfcnf\x93#\xcfH'\x14\t9\xa3\xa3\xaei\xac\b\xe1\xc1(\x9a\xc6$\xb1\xa3\xd5\x12#\u02dc\xaf\xadF~\xbe)\x84\xd9\an`&k\x9dNyM\x95\xad\xa0\x88\x0f\xb0\x03/\xd1\u018a\x94\xcf\xc9\x15\x8e\xff\x06q\x8e\xec\xd6p\xf9\x84\xff\xd0y\xbapr]\xc8:G(\xe2KT\t\xb8U\x198\v\x1cM\xd6~\xdd[\xe5\xd5\u0395\x957:\xec\xa0\xc94Yc\xf4\xa0M\xff7\xdc\xe5\xba\xe5\xd5\xf68q\x04\xe2\x9f2\x17k\x1cN,\x86\xb9\xdf\xc6p\x84\x03\xd8\xcb\f\x96q:A\x03=\x86\xbc>K`\x9ba\n\x1d\xb6W\x1c\xf3nB3Fa\x1c\u0312\xe7\x7f\x855\xff{\xb6\xe3\b\xb1ir\x0fK\x8e\u5215\xe53^_\x9c\xff5\\\x80\x7f!\xd7\xdf\vr\xfd\r\f`\n\xc8u\x1f\x13\x18n\x1e\xf5\xaeh\x83<\x9eq~Gm3\x99\xfa\"J1\x8d\xa49>\xe9>`:\xb3\u0591\x8b\xb42Vx\xa0\xb9\xd0G\f\xde\xfaX\x13v\xab6\xa3\xf3\x1a\x0e\x0f8\xa0\x06\xcb\u0586\x1a\x12\x8d\xed\x11\x19\u01de\xfbl\t[\xcc:\x16\xb7\xc0\u01f6\x96J\xe1l\x11\xefd\xf1T]U4\xe9\x9cd\x9b_\x91\xe0\xf4\xeaK'\x8c\u05a0\xe8\x1aP\x8ekMY\xaa\xc6\x17O\xc7\xe1\xf9\xc2*sFq\x1d\xf0\r2\u9d0d\xac\xbc'\xb77q$\u05b2\x96c\x89\xd9\xde\xc0Fg\xf0q\xb2(|\x17\xf6M\x11IC\x05\x81[\x9dJ\xed\r\xf1\u0784\xa6\x91\x90\xb2\x05k\xe8\xdf`\x93\xd3)\xf4B\xeb\xc4\x19\x15\x0e\x14^\xb0\x91\x85n\xa0bYKV\xb4d)u\x8b\x16Y\x0e|\x95\x96\u05da$$-i\xee>M\x19\u075574\xa5\xce\x7f\x12\xd5.\xb4j\r\x1f\xbc\xaf\x19\x03\x93\u0415\x9a\f9=\xaci\xe91\x99\xc51\xf7\x0f\u6de7\xe38!s\xed\xc4\xdfOZ\xd1\u0437\xb1\x95\xe3*\xcbm':(\xb2\x12\x97\xd92\x88\xf1h\t\xa7\x8aC\xc1\xeb\xe4\xd5\xc8\xc6\xca$\xbdZs\x8a\u07f5\xbf\x8bo\xd3\xcb\xd0\xc4\x00\xce\xfad\xe3\x1a\xb0N\v\x99\x7fL\x9d*\xc6\xcf7\xa4K\xc1\x00\v\x8b\x95\xf8-\xff\x82\u022e\x90\x98\x1a\xc9\xf5\x17\xe1CS%\x82/\xf9\u07c59$\xa4\x8e\xd8\u07b6\xfa\x9f\u0143\xcf\xfa\x85\x7f\xd6\xc9\x16\x93\xcfv\xb5J\x14v<\xad\xf4\xc8\xd8\xf7\x1a\xc3\x1f\x15\xba\xda]\x88\x02\xb1\x9d\r\xc7\xf5\x1a\x11\x8ci\x9c\x12\x85R\xb1\xacYk\x9b|\u05a9\xae\x93\u03ed|f\x1d\x87\u00a7\xbaw\xe4\xae\xe5\xe7\xad\xf6\x9a5u\u0108\xeb\xc7q\xad\xd1X\x90\xb0\xba\xb4n#\xf0l\xf7\xc6g\xeeBqx\x1f\xcc\xe2\x9c\xf6\x9e=?9n\xb2)d1\xc2\xf3[a\x92\xfa7\x19\x9a\x13\xfa\x0e\x10\xec&3\x1f\xb3\xb8\xa6e\xf4|\x88\xceE\u00fbh\x94Q\x16\xe7\xf1\xa7d\x8c&\xdc\u0143\x95O\xec<\xa9\xb4\x17\xaa\xb0X\xaf7\x96l\xaa/\xfa\x92\u0492p\xeb\xe0S\xa2\xc55g\x8e\xd9\xd5\x15\xacR\xcf\x1eJ\x9e\xd3\x009\xe4\x98=\x9a\x9b\xa3N\xf1\x9a\xea\x84\xc4I\\\xac\xac\u0104\x87\xe3A\xfa)\x1d\xcc\xe3\xa12&\xaa\xde\xfc\x81\x15\x7f\xe9e\xaew\x04\xa8)\b}7\xac\x16\xadx\xb28\xf7\x0e\xef\x0eX\x03?\xbb\x01\x1e\x17\xa8\xb0!%\x01t@\x8fav\x1d\x80f\x87\x10\x05\x12\x9f\x14\x8f-\xebD K\xb0\x9a\x8f\x84\xef\xa5\xc1\xd0n\xb2[+/\xe0\xea\xb0Q\x99\xf5\u03a8p\u02d0\x9bP\xbf\xef}4*\x85??\xffl\x9c\x9f\xfd\x83]\xeeC\x95\x9f\biK0E\xe9|\xcc1\x9bP-1\x9f\x16 \x9b\xc7.\xad\xe1J\x90\x19#\x03X\x13\xef\xba4\x9cWJ\xb4\xad'\x18\x10\x00S\xaa\xd3%\r\x05\xceg-\xffM\x9c\xa3\x9f'\x854\x91\"\xd1\x1d%{\xf5\x98\x1e|s\x1c\x93\xed\x01V\xaeh\x10\xd8\xfbQ\x8a\xc9\xc2\x13X\xceAn\x95H\xae\x173\f\u0322\xcc8tw\x18\x98\xeb\x93\r\xe1T\u04a1\xc1|\u02a2gU\x7fF\x19\xb9h\xf5\x91FyG\xaf7\x01^\u07e4Y\x99\x05\x06\x85-\x03\"\x8d\x9dg\xeb\x00z\x04\xa4\x8e\x84I\xb3\x9cNR%^\x01\xc3I\x19?\x19\xd3\x02\x83\u04ce0\x1e\xc6q\xf8#\xe1W\xca\xc6\xf4r>\xbad\xd1r\x14\x7fNG\xf3\x91C\xb1\xc8\xdfI\xcez\xeb\xd6\xdc\"\x00<\xaa\x9d\xca^\x01\xba\u06ff\xe1-r\x15\xb5qB\xc4\xf3K\xebA\xcd\u0250'\xe2\t)\xfaTr|i\xa2E\xddXV\uc2a5x\xecP0.\xe8\xeb\xa9C\xf9v\xb0L\u04f9\xa4\x82P\xdeU\x11\xdf\x1a\xc1\f\x0e\xf1^\xa7\x1f\xcf\u0643\x15\xc8\xee|\x9c|\x9epW\x10\xbd\xd2\x12\xe6|\x12\x8f\u04fe\xf3\x03`\xb6\xd4\xd8/L\x00\xb4ua4\xc4\xd7\x11\xc2\xff\x98'\xf3\xc4&\x1cUG&\xd1}\xbex\x10\xea\xef\xdc\xcaxr@\x02%1I[29\r4\xb3\x91\b\x89\xaepx6\x17\xd2}uF\xf6\x9e?\xffp~rv~&\xa6\x1eWrj\x9e\xc0\x92\xd6k\xbf\x83VHc\x92\x7f\x83\x86\xa4\xbe\u0444\x16\xbc5\r\xad\x14\xfe\x8b\xadso\xcb.d\x95\uf15b\xbc\x82\xc9\xc0\xaa-\x14\xec\x9a\xd8o@\xc9u\xe8\xad0\x89\x01G\xa7c\x17\x9eB\x1e\x883\x83\xf9\x05d\x9b\xfae\xa7\xced\xe2\u0d8eH\xe9L\xd8\xe8\xcc\x02\xe4\nV\t=\xeanVr\x05\xd8k\x9d?\xb3e\xe8\x9f\xd12T\x8aXO\xf2?;Orer`\x8a]\xfcY\x8c\xe1\x01-_f\x06Un\x13T\xb2\xcfq\xbd\xa2G\x0f\x0f\x0e\x1ei\x1d:>y\x04\x1bL\x17\x1d!\xebL\xca\x06\x06\x85K\xeb\x10\u5314\f\x96\xdciX\xf6\xea\v]WD\xb7\"\xf9Z,\x03l\xa6\x11:\x12\u0323\xcf\x12\x9br\x8a#~\x93\\\x9f|\x9eh\x96\x98\u04adKIB\x14\xc2\x0e+\xd26\x1aJ\x8a\xc0\x8e\xa5c\x15\u0309ydc\t\xe2\xe4\xe0\x87\a\x91\x87\n\x15\xd55\xc7,\x97\xb5\x06\x9b\r\x8e\xb2\x1d\xa3\u014a'O\xc2\xfc\xeb\xeaep\xf5>\xe4;\x9b1\xb1v\xc4\x15\xf3n\xc7d\xe9<\xe3|\xec\xe4\xc6w\xd3U3\xb28\xb9}\xb1A,\xd5\xc7\x15\xca\u0239\x9c\x9c\u0433\xdb*3\x8e\x9fy\xa2\xbf\xd8\r\xf0Z>\xe7\x1eY\U000bc689\xd6/\xa0/ME\xb1\xe2\xa9O\xa8L\xf5\xd8f\xe3\xa1d>\x96\xa20\xfb\xf39\ue4c4\x80\u0219\xd0AQ\x0e\x83;o`P\x83\x06\xa1\t$\xbfg\x19v0Ps`\fR\x803g\xfb\x93\xb1=\x14\xf1\xa6K<\xa1e\x19\xb0K\xa4\xfac\xd6&\xb1\xee\xfc\xce\u0593\x0e\x1e%\x1c\xacN\x11_[\xc2c)V\x818\x15\xa8ME\x1c\x8a\xa5fz%A*4l\xe3\xe6\xa2(i}\x19\u030b\xf4\xfd\x12\xf9]\xfegF\xe5E\xbex\xa8\x9a\xf7\x8cJQ\f \x8f\xb3\xda\xcbL\xaf,\xc6\xf7H\x8c\x83\x7f\x7f\n}\x99\xa61\v\u07c5\x06\x96l\xbc\uf041\x04p,\x16H\x8a.\u0604\xe8\x1df\xbc\xb5\x95kr\xaa\x187\xd67X\u065f\xdd8\x88\xa6\x92\x96\xc7\xd9N\\g\xc0j\x00\xe3\x01\x02\xef\xaaX\x91\x8d\xdfJ\x8d\x13\x03\xffC\xe18\x1b\xa1G\xc95\xb0\xbc\x18\xef\xa1I!\"p\xf6dR\xe5\xad\r\xc1Z3\x10W\u0442\xa0\xbb\x14 \x14\x1c}\xb2\xaa\x05hx\xb7:\xcf\xf7\x85u\x81\xf2\x1c\xcfU)\x8e\x84\x83\x8d}sr\xa4n\xf2\x00\xf9\xbbzC\xb4zh\x11\x14\xbb\u0434\xe8\xd4X\u00fbs\x06f.\x8b\xaf3\xda\xd4\xc85\xc7C\x16\xcc\xd3Y\xa8\xdc\xf7\xd5\x18\u0700;\xd9b\xab\xb9Ig\xec;\x89LX\x1e_\xa1t\x98\x83d7\xec\x8b\xcd\x16#\x81\x19\xb9Jh\x86\xf9\xc5\x12\x1f\x83\x8b\\w!\x03\x9aZ\x14\x8a\x85h\u05c3\x14\xa0\x85\xfa-\u00dc\x9e`7^p\xc5\x0f\r_3'B\x1d\xda,\xa1};\xb9\xd4\xe2\xe0\x98\xbdE\xcd\"\xea2\xdd=S0SF\x85\xea\xfa)cB\x92B\xdc>\xf4\x93wA\xcd\x05\x0e-v\x95\x91\xc1&\x81\xf3_\xbe>yy\xfc\xec\xe5w<\x1f\x06(\xf9~3L\xbb\xd3\xd9\xeb\xd8\u034b\xeb6\xce\x10\xd5|\x02_-\xbbM\x1b\xbeHuJ\xba\x10\xdaQ\x16\x1a5\xeb\x02\xf0\x9b\xd4\x1a\x85PA\x9fO\xfcA;\xcb\xf5\u0547\xedc[I\x81P\x81\xe6h\x92H\x15E\xcfx$EV\xd6\xd2\xf2\xa4\x1f\x868\xb4%\x04\u0491\"\xb2c\xb4\xe75\x8c\xa9\x02(N\xce$\xb1\x17\r\xa9\xe9\x911t\xb2\x95\xfb\x14\xb4\ub025\xbcL\xd15\x8e\x94\"9jj@ \x98\x8eH G\x8b\x12/R\x93xC\r\x128\a\xa6\xea>I\xa9a\x9c{\x85\xe6;.\xb3\f\xa4\xda1\xfb\x88\xe7\x1f\u04c9\xb8~\x90\x19\xc8t\x9e\x88\a\x91<\u0123\x1f\xcaL\xc4J&\xbc\xb4\"\u02ac\xe6&JG\xa3d\x80\x9a+r\x8f\xa6)\x12\xdd;\xf1\b\xe6n\x97\x88\x0e\x12\x91\xd47\x17[\x1c\x1c\xa2\x8cZ\aA\"\x8a\xb4:\x18\xa6\xb3I~X\xfa\xc6]\x7f\xa4\x86\x05\xa1MN\f\b\u066c\xe0\xe5\xc4\x18\xba\xc3Qq\xac\xe7L\xab\xd5\xc2\x00Q\xa4\x94\x80\n\x97\x96\x82N\xe8\x98\x13\xf5\t.4]\x9d\xde\xc6w\xca3\x13x\xb1k\xd2}\x920>\x13#\x9e\xc4\xd4J\xc6\x03\x03\u0346\x80\x9a\x91\x97\x0eH\x13\xb7\t\xe5m\x14_s\x89W\xce\x17\xec\u043d\x19\xec&\xba\x1f\x17\x84\xc9\xe6S\x03\x8aG\x88:\x8e\xf1|B\xf6\x93\xbe/\x90\xe4\xc4\fg\xd8\x0f\x17\xd9$\xa4\x11\x06<\xa0e\xa1~\xa7\x8e&V\xa8{\xaa7\x1a\xd1Z\xa0\x8f\xf2)\u04b5\xe7(k\x1fS\xf0\x03\xa533Qt\x91:\xf1y\xd8,%M\x9e\xcaNWb\xa3#\xacTUk\x94\x9fgg\xac\x05\x13\"cF\xd4P\x94)\x9f\x8fF\xb0\x0f\xff\x92\x88\x84\x19\xf03J\x0f\x14\xaak\x8b3\xccs\xbb \xedh\xc5\u5631oSA]\n\xe1Z\xbe\xfa\x9a\x8bMt\x91\x10bH\nw\a\\\x88\u037el\xc3rKeA]\xcao\xc2\n\xf3\xe5\xc5\xf3\xb0\x16\f\xa2\ued48\u8bb7\x9c\xe5CPx\xf6\xb9\xea\xfe\xaax0Z}\x95\u029e:\x8e,\xe4\x8a\x031R\xd7M\xdfF\xf6\xeb>^Ty\x1e\xe0\xa2\xec*p7\xd3\xf0\x94\x97\a\xaf{gg'\u01cd\xb2\xcezU\xa8\x11+{\xcb+\xbb#\xbf\x89\xb6\xda\xedF\x19\xd3\x7f6\xccn\x8d\xba)\xfb\xe8\xf8$o3\x04\xe0\x1a\xfeV\xd5;\xb8t4\av4|N{\x93o\xf7*\xe9\xa1\x043\u050c\xc9Ao\xb4M\xbc\xbb<ECUc2u\xba\xb1\x89r\xa2RMy7{E\x94\xf88F\xb2*\xbb\xc40\xe58S\xd3\x12\xd6G\xa2X\x94#Iq\xc9|\x9f\x81R\xf4\xa07p\xfe\xbeL>\u03c4\xdf\xfeUH\x86\xdb\xe8\xc2\xfa?P\xda\ue078b:wNy#g\xb6\xbe\u039f\xe7s\xe2\x88D\x99\x8aG\x14\xc5i\xbb\x9c__\xdf93Os\xb9clC\xa5\x05\x12\xff\u063e\x8c{\x8a\x97\xbd(q0\x17\x02\u077d\x8ea\a\xb2\xf42\xf6\u0743u\x9a\r\xbe\xf7\xa4#\x9c\x82\xafH\x9c\x1e2\x18\xb6\x97\x1a J\x03\xe4\xbe\u01dds,\x18TZ\u364a\xe76\xe7\x01\xa1h=4Grh\x8b\xe5\x9b=\xb8)\x90\x16\x05XrzZ\x8e\xd2`mm\xb90G\x06DAa\xea\xa6\xd5\\\x06\x90\xb4\x86\x02E\xce\x12E\u0219;Go\xe2 \x10\x16y\u0192\xbf=\xf0\xa4\xe86!\xee\xd8F\x84+p\xb0\xcf\xc6dA\xcd\xd6I\xc0\xb8\x9a\xb5t\x92w\xef\xf9\xbb\xde\x7f\x9eEh\x12\x9c\x93\xaf\xad\xb9I5\xbd\x9c\xa4\xc3\xe4oq\xb6\x14\xec\xae\xf0\xd6\xe6\x8c\xf7\xf69\a#\u00af\xfe5\x15*$F\x93\x99Hg@\xb6\xa6\x03\xef6\x99n\xba\xe2i\xb5#S\xf5\xf9\xf5&);\xc1\xd4\xd9\xd3T=\xf4\xa3\xeb\x19\n\xf2\x1c/\x18,?o\x02M}\x15\tQM\u0650G\xe2\x12M+<TM\x910j\u058f/\x7f\xf8\x02\x91B[\x0e\xb29\x1cgk\x13\xd2\u0513\xf96\x83\x93\u05e34\x9f\u778f3\"\v\a~\xe2T4\xa8\xa50\xe1P\x84\xae\x1a\u0345\"\xad\x94\x88\x86\x8ab\xe2\x832bl\xa2\xfcc!\x17\xe9\x7f\xf1\xd9\xe0'\xc0f\xe3\a\x90\xce?\u03ec\xc9\">\xf8o\xbc\xe0Xu\xbd5\x81-:vY\xa1\x9c)\xf4\xcf?G\x0f\xc3{\x14\xe65\x1b\x05\x9a^\xe4\xab\xd5AY\xb8q\xfb\xedo\xcbY\xd8o\x0e\n\xb7sU<\xcc\v\xff\xb2Q,\xf6\xe5\xfe\xb0\xc9\u05af:,h\xabVr\x12\x95\xf7ZN$@\x93\xd7I\xf2\xd1\b-xoI\xc0\xc8\x1d\x81\x15>&F1\u07faN9\xbc\x99H&\x8cb\x97 y0,&\xa5Mua\"\x91\x8c\ai\x0e=\xba\xa4F\x00C\xcd\x0e\x12\x86\x17G\x95J`d\x04#tY p\xf4\x00n\x10\xa0\x93\x8d \xd9 {w<\xfe\x1a^\xb4\xdf\xdb{'\xe17J\xaez\xbf-SQp\xf9}\xc5\xfd[\xbe\x96\u056f\xf4\x1e\xf1\xa6\ueec7\x88\u9032Ql\xf8w6\xf4\"\x88\x95T\x14\x9c\x8a\xaf\xea\x01Xg\x12h+\x98A\x9a\x18?\xaat=\xe4\xc6C\xc6\xfbK9C-\x81\x1d\x82\u021d\xec\xb1#7ax\xdfN\xc4\xc8j\x1aq\xae\xe4<u\xc6;\xa5\xb8mU\xb5FqL\xe0\x99\x94~\x1d\a\x1e-\xc6\xf7\xa2\xa8\xeb\xcb+\xc1t\xdbK2\x1dq\xa1`)P\xe2\xcc\xcc/\u015d\x99\x8d\xf5\"u\xe1U.\x1b\x990H\xc5V\xc2\xd5\x12\xf9h\xb5\n~\x8bB\xde\xf2\x9b\xf4jV\xffEr\x94\x89\u030a\xc8a\xba\xf2\v\xe5\xa9\x12\xf9\u3bf3\xce\xfen\x9f\xa2\xed\xdb\xd3\xca\x1d\xa0K\x19\xad\x18\x97\xa3\xb1\xbb\xfb\ffr%\xa1\u0588\x99.\xcf\f\xc9e\u0779\x86]\x83.\f\x14\te\x94\xc4\x1c4{J\x17\x8f\xb3)\x1d\xe6\xe6\xdc+\x84\xe9n}\xdd\x1aA\xff\x7fuq\xb7\xe4\u0736\xf7|\u0694\xca\xea1T\x88)O\x05?\x1f\x17T\xae9\x05\xe3\u01bb\x06r~\xcb\xf3\xb9\x18T\xb1\xf2R\x8b7J\xf7k\xad\x9f\x15\xef\x0e\xb4\x19\x18\xe9&i\x9aX\x8b\xa7m\xa4\xd9y\xd1\x181\xe3\xc0\xad\xd9\xd0b\x1d\xb2\x05B\xaa@4\xb7\x9bY\x169\x0f]P$\xfa&*$'\x13d\u0744#'\xfbL\xa8j\xbccE\ueaf6$\x84\x01\x1d\xdeY7 \xb1z\x12/k\x13\x1a\xa1)\xac\xb9\x18\xcb`\xf4\xf7\xc4F\x8e/\t<\x8d6Mh\xadu9\xcdns\x90\x8c\xb4\u00d1<\x13wOh\r\u036f\xa6#\xddY\x12\u00cc\x91\v\xc7g~\x97\xb0\xff9\xdf\b\xb3\xe7\xa0p\x01\x19\v/\xac\xbe\xb4\\\x82,5\x1e\xa4\x13\x8e,f\x1dQ\xaf|'C\xd4\u0532#b\xcc\x0e\x8f\xb6\x8b,.]\x91\"wl\x8c<\u0672\xc2z\x10Y\xfb?\x98\x8d\xf2 \xd1Q6-\x9ex:\x9c,G\xc6\x13\x97/Z{\xb6\x91\n\xcc\xec\x985\xbb\a\xc3Z\x91\x04\xd4\xeaOko\x84\xf1\xb1j\x9d\x02\xbfj\xaf{\xeay\xa3V\xa1\xd1\x14\xc2Y\xbc.U\n\u29e5f\x87V\v\xfct\x05=\xc6i6\x1d\xc1\xbaz\u05881f\u07c8\xfbb& OW\x9d!\xad\xc3\xd2S5\xca\xf5\x8d\x7f\x1f\xcd\xdc\xe0Y\xb4\x8e\x91\xb0\u068d\xd6,;M?'\x83z\x97zm\ufda1\x1c\xccU^\xf3\xe3\xec\xc8\x1e6\xb9\x10\x8d\x92\x88\x94\xc4w+\x1b(\x18\x9d\xf2\x02\xc1#\x10\b\x96&\xcd\t\u0297\xa5\xccQg\x01+\xe6\xf6\x1d\xa2\x98\xea\x17\xe9\xfb\x92\xab=\x95\x89\xcdv\xb0(\n\x95\x9b\x19\x9c\xbb\x8b~C%\xf7\x17\"h\xc9\xf1cQ\x96\xbd\x8d)r\x98\x15d\xfcC\x86\x95\x01B[\x8d6\xe2\xca7\xb5+\xf1i3\xf6\xf1@B\n&\nM\xa2=|\xae\xeb\x84+\xe4\x9a\r\u06c6bWJ\xdc\f\xe5\x8c\xd9svW\xf6r\x87\u0758\x9c/VJt\x00E5\x91\xa8\xcc5\x19)\xcf$\xb3\a\xc0\xb2~\x93\x83\x81\xb9=\xcf=\x83A\xa2\xe9N\x19\"\x9dwq\xd5\xc4o[\"SHtp\x8e/(\xa1'm\fP\xcb\x1c\xac\x01\xc6B\xc7o\xa7x \x89\u027c\xd1\xc0\x91ZJ\x05\xa6]\xa8'\x92\x1d\xc0\xde\x01\xc8\x06\xe0\xb1a\xec\xe7\x9d\x17\x9a\xef\x1e\xe0]\x1f\xbaD\x0e\v\xdd\x00\xc5\v\x90\xe0\xb3\x06\xd9\xf3\x183j56\x830\u02a8\xa1\xb3\xf7\xb2-\x19\x83\xb0\x85C\xe2\xf18\xcb^\x16w\x16\x03,\x92\a+&\x841\xf0}\xb9\xa0\xe8K\xb0l\x02\x83\x99\v\x9d\n\xd8wA\xbe\x15\x8d\xb3\x97L\xdf\xe2a\x16\x9c\xf1\x8c\xddf\x85w\xc1=A*\x8b\xcd\n+\xf7\xdb\xc4Z\xca\xd3\xdd\xfaph\x83\x91\x1a-\x9e21\xbfMhO+\xcb\xf2\xbf\x86m\xfd\xdf\u032e\xde\x1cN\xa2:\xf5\x1cVK\xd1\xc1\\\xa5\xf0/1.1\xfaF c\x9e\xd5N0*\u04a6S\xf0I\x91-\u04382\x01^\"&\v\x05\x06Yjwc\xfb\xaf\xc8\xf7\xebL\xe2\x83H\x8e@\xe3\x99(]\\\xb4\x83\xd4\xf9*#@\xa3\x181(\x87S|i->\x13#\xac\xc5_W\xa9\u0117NTI\u0336\xb4_\xa4\x91\xb2(\f\u06b8\xfc\x02\x17\xadt\xe1L\xc0X\xc9@\xa8\x1bD\u01531E\xfc\x18glu\x9a]\x998%\xac\xee\u032b\xed\xc3K\f\xcf*ob\x89?3\u0507\xbf\x94\x9b\x84\x97\x00\xd5i\x182\xb1f\xae\n\x8fU[\x01\x9eb\t\xcaU\xe4\xc2\x15\u051a\u078d\x9c\xae\xc0\xcfu\xee\x9a3\u0736\xea\xd6`!}\\\x05\xb1Jy\xf0B|\xd9\x15Yc\x1a\xe0T\xb2\xb9\x04*bw\xb9\xa9\xb7$j\x8bE\x0f\u0356\x1c\x1f|\x05\xbb\xe7K9H\a\x12b\x95\xc3u\x8b{\x04j \xdc+\x8a\r'\xa6\xcd\x00\u04aa\x86%\xe8y\xc1\fk\x99\u78b3\x8f\vH\x86\xa1?L\t\xf2\x80J(\xb3+\t\x9e\xc3i\xa0\xf0\xe6\x8e\uf174\x19(\xb2#t#Q!\xadR\xde\r\x90?\xe7\x1c\x95B[\x05r\xd0u-\xbd:\"FAi\x1f\u00fc<\x8e\xe2\xf9,\x03\xd9D,\xbf\x88\x81\x12O$\x7f\\\xa9\r\x9c\xa7\x1c\xcbV\xc4%\x9e\tM\x11=\x7f\xf9\xd9T\xed\xd2*\xfa\t\xa5|\x91\xca\u0196-\xa6\x01\xc2\xf5\xcdM\xac\xdc\x15\xfa\x97\x8d\xc5\\\xe8C\x85\xd89s\xaf\xed9\x14\"\xf0C\x1f\x81\v\x06\x9c%x\xebb\xfa\xd6\xdc^Y\x01\x15\xd54\xf8\xf1\x8ac\xb5\xc6\x1c\xb1\xd8\xe2{\x18\xad\x18+\x1fzY\x86\xa8\x96h\x8aH\x13\xc7Y\xaf)jq\xac\xf8k\xc5U\xe8]Et[\x1a\x1adQ\x9e\xb5\\\xa4\xb9xi,d\ue271\xda\u00fdC\xf1XRw3Li'\xb1\x1a\xc7\u322dy\x9f\xc8s\x9c\x84\x9a\xaf\t-\xe0\xdcF\u0082f\xad\xda\xc7\n\x06$J\\\xce\u0140\x8dTk&\x96\xbb1\x9esr\x95v\x90\xa7-\xe5[\u0412!\xb2\n\xc5\x1cxQ\xd8\xd83,S\xc5\xd1\x15\xaa\xca\xe3;\x906H\xa8\xf2\xcd,M6\x95\xeb\xcc\xc4\x0f\u0512\x19\xb7E\x94\x86\x1c40q\x1b\x81\xb2\xd2\x04\xba\x95\xe70A\xa23Bo\xd4a\x06\xa4\x85\xc4/\x1b\x04\x9c\xcd\xf6P\xb4+A\x0e#\x0e\x90{\xc3(\xd7.\x7f\x9a\xf1\xb3A7W=W\xd4\f\x95(.\x9c\xccm\xc8>\xa7\xf5@'F\u03e6\u03feW\x06in\x97\x96X\x00\xcaK\xcf\xf2o\x94\x87IR'&~\x8e\xbai\xce\f\x02WF\xd0.\xdc\xe1k\x85\xa7\x8d\xf1^j\xbd\xcaacm\xe2<yg\rN`\u0340\xb2\x91\x95\n\xb2\xd0.t\xe9,\x93\x88\xb33\x91\x8f,\x0fd\x85\xda\x15W\xc4#8>a\u01b14]7\x83%*?\xb9\xbdszu\xc3I\x95xY8t\xc3\xe4\xf8w6\xa8^\n\r\U0001c7aeh\xee\x14\xd6qF\x0f\xe6F\xcaY,Y\xadO<\xbd\xa6\x98t\xf6\x8e\xfawQ\x17o8\xddL\xa8\x90\xbf\xd5w^\x1e\xdbWf\x11)\x11\xefQ\u0238\xcd82,\xbb;\xc1&\x89\x87+\xae\x1fU;\xf9\x0fo\u901b\x00\x00M+\xaa(\x8ba~E\xf7\xb5\xf6\xad\xbe#\xb7%\x90\x03\xb3%\xec\x91\xc7/\u037c\xc0\xa1g\x8a\x94Y\t8\xc7\xd7\u0494\xb7\x1a\xd4\xd3\xe8\u0253\xb4ao\x95\xf9\x1df\xb1PM\xc0O?\xc0\x86j\xc0\xf3\xadPs\xdc#\u074f\x1c\x8fciS\x18DN$@nb4\xe1F\xcdd\x05<*\xe61m\xf3\\\x12w*^\xacvppP\x8b0Vj<\xa3\xc0\n\xce<\x9e\x83\x7fQ\x80\xf5~\x96L\xfb\xca\xc4L\xac\xa8*s_`\xefF\xf1\xf4\xa39\xee\x8c\xcd\x03\az\u0518E\u03bc\u02a63\x17!,$W\x8f\xbf\x98\xe1S|\x06\xfe:Jb\x14\xc0\xd4Xuy;\x13.\u06a9]\xef2J\x88\x1b\x84\x82\xfe`\xbcUC\xd3\xe8\x81Q\xeb\xa5\x03\xbc\b\xb9\xba\xf3\x8c\x98\xdc$\xa8{>\n\xe3@\xa7\xa6\xb8\x83\x1bn\xc00\xcd\xe8e\xb1\x8f\xde\x156\u07f3x\xf0P\xfa\xb1Uw\x8fd\xb9(\x98@\x85[\xa8i\a'\n\xaa\xf5\xe8\xed,\x1d\xa6\xb3;\xef\x06\r\xd8\xee\xd9\xec\u0384>\x95H\x14:5\x10\x9c\xc9u\x9aI\x1dh\x06\xbb\x02\xbd\xe7\x19F\xf7\x1e\xf6%\xac\x05\xe8N\xef\x85\"\x92,6\xc3K\f\x96I\x05\xe8S\xfb\x12\xa3!\x13\xdfLvH3\x0e\xf9\xd2\x1a\xc5\x13\x9b\x9f>\xaac'\f\xf0 \xc3=\xbc\xfa\"\u0418$\xdeY\x83\x9d\xa8\xe3\xd4\xed.\u0745H/xG\b$\x91R\x0e7Y\u0244\v\x97]]\xa1\xe68\xc5\xdb\xc0\xdb19\u0158\xfb.\a\x89\xccg\\Vb<\x99\xc8\xef\x12\xcd$Q\xaa\x15{Mi\x89$[\xd3T\u02df)\x1c,e-\xbbS\xf1nD\xbf\xef\a\xbb1BcYI\xefL\xe0\xfd\x02{=*\xa3\x9bF\x87tl]\u02e0\xf7\xa3\xcce\x80\x85\x15\xce%\x98\xa8\x96\xe3\xe2q\x8dtT\x1c\xd6gb\xdcB\x83\xb0>\x0f\xbc\x14c\x86\xe2\x17\xc9|I\xfc!D\x851\a\u0472\xbb\xf3[\t\x9ce\x1fP\xe0\xach\x9fr\xe4\xe9\xe8 \x98\x85\x86\xf7\a\x16\x1fk\v>\xc9\x1e\x96\xcc\xc8Hw\xfa<\xeb\xd3I\xff\xa1\xdei\x94[\xf9\t\xees\x9f\xa9\f9u\x93\xbf\x14\xbfr\u00e8&\xe1\x8et#\xa9\xff+\xd0f\x8e\u05e1ds\u00d2q\xc3\xff\x85\xcd\xfe\x17\x87M#\xcb/2\x9c}\x04O\xd3\xfc\xe6\x91\x7fb\xfc\xedI\xbce-\xefE\xe8\xff\u0469w\x19\xe7\xe3\x13\xeb`\x03\x93\xbb\u03c3\xbf\xc6F\xf9\xe5\xdbD\xa8\xb9l\x93FI\xa6<;}\x94\\\x82()\x89(&Q\x15[\xac\x90\x89Lq\x7f`\x9e\f\x8c\xe9~\xc3~\xb2\xcff\x8cI\xb9\x17\x89\xac\xc96=$\x80s\x16j\f\xe7\x8cd\xd6hg\xb9\r\x1b!\u07ae\x9do\xe0]*KR\u01de\x91\xe1\uce45D\x0f\xf9V\x0f\x87\b=k\x9bP\xab\xf2\x8a\x0e\n\xb9\xc8\x12?G\xe7\xbc\u060c:\x14\xe6\x7f&\x11\xf8\xa6\xdck8`dS[o}\x83\xeb=s\x8aH\u05d9\x04E\x8f\xbcy\xe5S\xf8\u044a\xc8X\\d\x8d\x98n\xd8E\xef #F\x9cp\xe6\xdc\n\xf3+DP\x9e\x8c\x03k\x98\xa4\xcf\xf6\v5\xb3O\xa2\xee\xfb\x90\x15`\x8c \x17\xf8\xfaz\xfd\xe2O\xeb\xef\x9f\xec\xff8x\xd2\xc0??6\xbe\xfd\u037ao,\x8b\x95\xbe\u017f\x17\x1d\f\x05_\xfb\xf6\xdbok\x055\xe8\xbb)E\xc0r\xea\xcfL\xdfF3\xfb\xb3\xca\u0709b\xccS\t0\xc8 \xb4\v\xcar\xd6\n\xc4\x14\xf16\xc9\v\xa0\xa8\xbe\x95\x8c`0r!\xf3\x99\xba0/W\xeb V\xb1f\x84\xd6% \xc4\xfe&\xe1()\xdaL\u0098\xfe`\u0223*}\x01R\x133aV\xf2W3H\t\x1e3\xc5@\xae2\x83\xa4G\v2\x14{SX&\xd86\x8a*u]Oy-Wk%\xc5w\xb2\xb8\x02&.\xd1\xff\xf2\n\xac\x82}\x1c?\xb5L\xf5[2p\xbe\b\xd3\x03\xc7\x14\x7f\xaf\u07be9:\x89NaN\xf6Q\x1d0\xc8f\xeb\x7f\xce\xd7\xe1\u06c7\xf9\xecj\xb7\xf5\xe7\xfc\x01y4L\xee\xa6\x18\xbb0\xaa\xf7\x1bQ\xb7\xdd\xe9\x12\r<\x82q\x8e\xd2\xf9(zu\x16\xf5\xe6@\u0426y+\xea\xa1>\x11\xcb\xd2\xcdM2\xfd\x842\x17J\x1d\xb93\xb2\u0233\xf9\xb4/\xe9\x9e\xe1\xe75\xe6\x1d\x19\x9b\xf8\xa3\x87g\xc7k\xf9\xecn\x88\x9eS\xfddl\x9c\x85\xc4\xd4\x02\x9dg\xd1k\xc4\x1c\xda\u03df\x1d\x9d\xbc<;\xa1\x83\xa5\xf5\xe0A\r\xad\xb8\x10a\xfb3\xba\xe7[\x8f\xce_\x1d\xbf\xaa\x0f\xe2O\xe9\xe02\x197\xf6\xa3w\xc62P\b)\xde\v\f\u0115\x82\x88\xb1\x89\xca\r\xb2\xd3\x03\u0283)A\xb3yy%\xbc\ue63d\xaa\xd2\xf1\x9a\xb1\\\xf3\xa3y\u3431\xf6\xcdl6\xc9\xf7\xd7\xd7o\u04cfi\xeb\x16\xc6q{\xdd\u02a6\xd7\xf4{\x9d\xcf\xcc\x13\xe9\x80.n:\xd5BK:]\xcfq\x97l0\x82y=\u07de\x9f\xae\xed\xa2;:L\xa7\xe2@\xe0\xf1\xee1?,\"\x89xZ\xbb\xd8/\x97wx\xd3I^\xd62\xb3\xf6\x92\x1aU\x9f\x12\xf6\x90\x10\x89\x8a>\u01d2\x12\xffI\x80\xa5d\x8fr\r\xab\x9e\xf3\xd2RvoX4\x9c]\xee\u0780\x12+8\x00\xdfDm\x95U{\x90\xbc\xa6\x1a>X\f\xe13\x05v\x16\x17=\x1b+\x1d\xb7kc\x01T\xaa}H\x95\t\xac\x97\x83\xabO\xf9\x1cbf\x86e\x1a\xe3Y\xdcD\xed2\xb9'\xa0\x85g\xdcg\xcf\x066e$\xaf7\x90\x96?\xa5\u065c\xd8\n\u0292\f\xb8\x94\xc4#:\xdcm\xda\x1c\u01acd\x1a\x92\xd33\xab~\x9dre\x8a\xec\x81E\x9b.\xea\xb7\u1b5dL`s\xc3+)\x92\xf5\xe28\r\xf3qZ\x88\x19\x8e\x13\x02\xb3?\xbb\xc5\xd8=\xed\xcf\xed\xb6\xca\xd0\xd8\xfe|z\xeas\x18\xa6[\x14\xa1\x1e\xbb%+&\x93\xa0\xa5\x13\x9c\xa9\u03b6\x8byUD8E\xa4\x18L\xe9\xcd\x19\x9e\xf1\u043cMr^\xa6mCE@\x89\xc1\x1ce\x05\x15=A\xff&\x9e\x1eA\x1b\xbdY=U\xa2\x7f\x88\xab\xca\u06c9\v\xf4\xa3\xdf\xc1\xb3\xcf;\xa7~\xf8Y\n\x06d\xe0*\x98\x9e\x8bk\xfb\xf3Q\x1b\xab\xf7Q\xdf(\x80\x8e=@\x05\x9c\xeeGk\x11V{\xea\x17\u047b\xa9\xf34\xf4*\xd1\xc8\xfby\xb7]\u0693\x93BONV\xe9\xc9\u0262\x9et\x97\xf5\xa4\xbc+\xa7\x85\xae\x9c\xee\xac\u0415\xd3E]\xd9X\xdc\x154\x11\xad\xe8\xccn\xa13\x87\xabtfwAg6\x17w\xa6\u06ee\xee\xcdQ\xa17\u01eb\xf4\xe6hAo\xb6\x16\xf7f\xb3]\u059d\x02\xae\xd7~\x9c_]]\rjA\xcc7\xbf4\x0fb\xb7\xb0\xbe\x87ET\xb3=\\[{Z=\xbcz\xf0\xe4w\xbf\x8b\xb6Q\xb6\xac\xf3\xb8w\u06cd\xa7^\x00\xbc\x85\xdbY\x14q\xdf\xe1Uh\x84&)\xee\u0512\xeb\n\xe3g\u0251O\xf88!o\x0f\x1f\x02\xb0\x11\xe8\x1c\x87\xec^\x0e\xe7_v\xcd\xf7\xb2\xe9\xd4j\xea,\xf5Qc\xf1\x87\xf2T\x95$:\xe3\xc6\x18.S`I\xfb\xf3\xcf8\xc9\u01f0\xbbh\x9am=\x9cn\a\x84i\xcd\xe9i\xa3X\u06d5\xfa\x86\xb6\xc6)\x16\xf3f\xa9r\xd5K1Df\x85X\x14\xd4\b\x19\xd2or\x94\xceg\x93\xf9\xac\xe5\x15\x0fG,;4\xec\x85\xed\a\x9f;-<W\x8f\x84\x90\xbb\xfa\x8d\xa7^\xa5\xd2\xfeq\xaajo\xb1ZA\x01\u05df\xb5\x02\xc9X\xa1;\x05{gY#@V5\xd4o\xbe\xf9&\xea\xc08\x7f\v\xaf7`\u069be\u054e\xb8\x9aZZ)\x1d\x8e\xf4A\xd9\xf7/U;\x19Y\xa5,\xa3\xcbyf\xe4\xd0\xd0\x11\x84\x85t\x8d\x98\x00\xb7\x19\xde$\xe8L \xfc\n\x87\xb0\xd1@\u063fc\x98\x89+\x049\xf0\"\x84\u0583\xa5\xd8S\xce\x1a\nN8J\xf0E\xa9\xa8\xad\xcc\x0e\x1f\xa5\x9c\x99c\xc9Z*\xb4\x9a\r\x9c\xdeO\xbc+\n1\xa6!\x01,\xb1\xacY\xea\xbc\xf0)l\xc4\xff7\xec\x18W@\xa6L3_(\xd5y\xb6\x7fus\x11\xac\u0637z\xa3!\u0579\xbc\x9fLbl\xd8f\xafa\xee\x18\xad\x98\x95\x88\x03\xd1\xeb\x98\"&\x91\xc3X\xec\xc4\x17\x90\xfdr\x9d\xff\xc8H{.F\x03\x96\xf6\xf6wD\xea#\xa2B\xb7\x9c!#\xff\x16\x04;\nV\x89\xaeY9R!\na\xf11\xb9\x9b\x90@\u00be\xc8l\x9eF\xa6,b8M}AN/\xee\v\xe1\xa7\xf4q\x88\xfd\x87/^\x7f\xbb\x00Y\u039d\fI\x06\xa18+\xd5k\xa8\xa5M\xc6&\x9a\xaaf\x15^\xe9\xcb\"\xde\xd2\x012Z<\xcbY&\x11\x8c\xb2\xa8\xc4H\xc0\xed\x85H\xf0kp\xe0x\xdcRBL\xe8\x03\xf5E\x89|\xa2-\xc1\x9a\xabr\xebB\x1b\v,\xb5>\xbf\xfa\xc4\xd5\xc0\xa3c\xefJL\xaa\xef\x96T?\xd4\xd5)\xf2\xc1\x93\x8e7$},a/\a%\xbd|\xd2\tX\x11\xd7\xd7\x0166(\xeb\xab9\x97n)\x06m\x01\x83\xf5\t\xd5w|,\x1f)\xf6P@\xa6\b\x8f\x14x:\xb0\x0f=\xf6\x82\x83\xedV\x9e\x8e\xe1\x8c-<D\x8a\x85\xbd\u8fce\x0f\xe8\xe3\xce3;]&\xceR~\xb7\xa4%\xf2\xd5\"\xe9\xca\x0f=\xac\xd6\xd6\xc2)\x02*;\xadI4\xfb\x19\xab\u127c\xedN\xd6\x12I\xab\u060a\xcf1-l\xe6D5\xd3\u95b7\xd3\xf5\xdaY\x7f\xac\x9b2\xec\xd9\xe3\xf5\xd5\xda;\xd5\xed\ud5b7\xb7\xf1T/\xd9\xed\rFt\xac{\x9a\x117\xb8\x12>}a\xfb\xbb\u053et\xa0\xbe\x8d\u018d\x06B\u00f0=\r\xef\x0e\xbap\xc0Wh\x1c\x81\xeeO\a\x1f0H\xe7\xdd\xfam\xff6\x1d\xccnH\x05y\u06efR@n~\xb5\x02\x12\xa9\xe2m\xffo\xa8\x82T\xf1\xef\u0561\r\u0758R\xe2\xe7<\x12\xebP\x9b\x1fZf\x00\x86\x1e\x8d\xb2\xc1\x9c\x9d{1\xf5(<\xb1W\xbd\x19\f\x91\xb4`A\x16A\xf1\x17\xe6\x0e\u01b3}:EE\xab8\x9e\x8c\x00\x02\xaa\x11'q\xffc|\x9d\xac\xbb\xa6\xe8\xc40\x9dU\xfd4\x01\xa1\xa0\v\xa8\x1f\x9f\xe7\xd1\x1f\xe67c\x14\xa4\xb8j\xbd\x11\xf4@Yn_eH\xfb\xe8\xd8\xfb<\x19\xc6c\xe9a\x86f\xcev\xb4v G\x01\xa0\xfd \xa8\x15\x9a\x17\x162&\xba^\xa0\xaa\xfe\xb6\x9f\x9b\x9fu\x9bA\x9d\x18\x89g'''\x80\xd6\x03\xf4(\xed\xb6:k \xa8w\x1at\u073d\xe5\xe3\xcb\xf0,8W\xa8\xaf\xbd\xbdme\xc0IP(\x03\x9a\xb2l\x8cWk\x93\xf9e\xbe\xden\xef\xec\xb57\xf7v\xb6\u05ad\x83\x9d\x9d\u025b\xd9h\xf8\xcb\xe0\xe4\x1e \t\x16u\x85\x0e\xb0k\xf4F\xa4.`\b?\x01r\xe6\xcd\xe89\x1a\\:\x1e\x86\u009eGY\xbf?\x9f\xdcY\xafJ\x04\xf3\xa8\x9f\f\x87\x8f0r^j\xa6\x8f\xed\xc7\b,:\x9c'\xc0'\xe7x[\x9e]O\xe3\xc9M\u068f\x8e~\xff\a\x05\x99L~\x1902^\xf9\x1c\xf9]\x00\n\xbb\xee\x19\x9a\u0593\xc1\xc2%[\x17\x19N\x97=\xcd\xe3\u16b94\xa7\x94Z|\xd3\xc8\xe1\x16\xea\xb3d\x98\xa0\xae\x90\xf7\\C\xb1c\xa6r\x1e\xd9\v\x13\xf2b \xb9\xc0j\xeem\x1e\xcc\xf8z\x9a\x10~\xa0\xa2X\xfc\xe7-,1B\x8e\a\x9fb\x8a\xad\xf4\xd8h\xb9\xf3lJ)\xc9\xe0\x98\x1e\x91_;\x8c\xc8\xce\x12\f\xede\x86V\xc9\xf1\xe5\x90\xf2F\xf2\x95+\xad1Z\xbb\f\xe2\xe9 \xe74\xef\x18}GX4\xd7\xfe[\xc3\x1d\xa9~\xb8\xf5y 9wJ\xdaE\x10%\x13\xd1\x12\x9fX\xc0\xa7\x19\xdel\xa3\xdd%\xcd*\xc7\xfa1\x81\xb7pqi\a\xd0\xcd:\xae\xd3e\x02lo\x8aC\x8dsN\xe1\x9d\xd3v\x8a\xa6@ar\xbb0\x92\xc4\x14%\x8e\xc94\x03\xd6\xdd\xc5\b0C\xc1\xf8VH\x15\xe66\xbb\x15fN&\x1d\xba\xa0\r*\xe7-\xd24\xbd\xcaf\u0388$\xa4\xfdt&\x81\x05h\xb7\xe6\x9a\x17_\xa3\xf9`\x94\xff\x94\xc6\x04\x85\x87\xe4\u04a5&\xd1\t\x06.\xe8\xe5)\xcb\v\xa7\xf3\xe1\xf0\x1d\u0568\x83\x00\x1e\xbdCV\xbe\xfe\x0e\xbe}\x1f\x0f\xafd\xfb\u053fo\xf05\xfb\xcbx\x8a\xf7t\xf5\x97qC\xe50\xe2\xd8l,D\xe6\x1c\xad\x8e\x870\x15o\x92(\x1e]\xa6\xd7s\xc4q\n\x99$\v\xcd\xc0c6\xd2\xe7\u0152\xa5\x9ec\xa8=\x9c\"\xb5E\xe5\xe8p\xbd\x8fz\x04\x15\x8d\xe8\xeb\xbd\x06\x05\x83\x90\\\x8cx\"\x10\xec\xfeM\x06\x1b\x1e\xe6\x00]\xe6\xe0\u0618Sn'\x8a)\x86^3\xd0AqdF+\xf9[\x98c\x13_\x03\xf6\x9alJ\x16SS2G\x03\xb2:\x03\xe2\xcb{\x1cz\xf7\x0e\xed\xe1\u1b1e\x90{\x7f\x9fe\x99#\xccpF8DdD\xa6PRs\xe5\x897$\xb2\x81\xa3\xb8Aha\x84\xe66\xb15\xbc\x00\xdc\x02\xea0E\xdf.2\xe9\xe7\xf0\xcay6\x9c\xf3\x8d(\x87\u05a0\xae\x98\xf6\u0169n\x90\x82\xb0\x17\xdf\xc9\xee\xf7\x9b\x84Z\x125Mf\xc8\x1d-ft\b\"86\b\xef\x11\xf5\xee\xa2\xfa\xee\xdae:\xb3R\x99\x02Mn\xec\xd26\xdb1y3\x80\xf8\xd3\u0666\xca\x19\xe2\xad\xee\x86Dv\xc3I\xfa\x0e\xe8\xd1G\xf2v:\x02\xfee\b\xad\xc2\xcbY\xbf\xc5\xc7\x15yn`\x1e\xf5\xbb\x89%\xb8}\t\x1e\x17{~\xdb/p\a\x0f\xe9bmH\x9eU<]\x82\x11x\x0e\xeau\xc1\xac(\xc1\u01a8\xbfL\xe6\xb3)\x1a\xb0q\x8a\xc2\xe8\x04)\x16N\xaa\x9dn\xeb\xe62\x00\xce%&\xf3\b\a\x15\xba)\xfe\x1e\xe1\"\xb4\xd0\x18\xe7\u05a5\x8a\x85\xf7\xd4QN\x8b\x8e\xcc\x13\xe1\x80\x1b\"ylqv\xf9\x8c}\x80P\x86\xb7\x94\x8e\xce\x13N\xaeg\x17\x03\t\x18Q(\xf67\xb5\xfe\xd4'/\xa2\xb3\xd7=\xe0&\xe1\xe1\x0f\xaf\x9e\xbf}q\x12={y~\xf2\u075b\xdes\x15?\x05\xc7t)\t\x93\x95\b=\xc0\xc3\x0f\xa3e\xf3\xae\x88\xfd\x05\xbe\x1e\xdeMnZ>\x1bC ,\xddu\xc4~\x94\xd0N\x84yM\xaf\xc7\x0e\x90\xa2_<\\\xac?\xe6u\xf0\xe8\xa3\x10\x83\x94\xbc\xd3\u0638\xc0\xe1\xa8\xd3|YG6\xc9\xea\x96\x03\x8e\xe4W\x00$\x03>R\x02\x97\xe32\x90\u02d1\xc1#$\xdf\xe4\xa5DU\xcd1\xc6\x1a)>\xc9\x1cI\x96x*\xc0\x1d\u00e1\x12\x03'\xcd>%\xa3\x8c\x13\xdd\x1b\xadZ\xd2OIa\xc3\x13\xec\xe3\x9aF4\xb5~\xa6c\xe1\"\xc0\xc9\xe2m`\x9a\xf5\xdc,\xda]B\u058c\xf18\xbf\xe5\x81\u0719c\xea\xcedE\xb6'\x98c(\xcdI\x83g\xd8%E\x12\xe5\\=\xad\xe8,\x99\xcdd\x19\xe7\x13\xa2\x9a\u0230\xb8\xf1\x9b\xedc\x8fJX\bf5J\x0eb\nF\x9a\x8a\xf3\x14\x05\f\x87nOI\xa3\x05\x9c\xee\xf0.\x97Df\x14|\x1dY\xad\xb8\x8c\x1b \u0680\xae\\\x14!\xd5\x14\x93\t\x8a\xad\xf1u\x93\x8e\u05d9\xcd\xee\x12\x93\xb0c\xb7\xa3\x87\x98\x14w\x14\x8dDm>\xf2\x1ccXMK8\\Q\xdd\x10_*\xdf\xd7%\x1c\xea\xfal\xda\xe9\xac\x1b\xf2\xe38\xffhm\r\xe4\xaf\xf6\xceZ{k\xad\xbb\x1d\xd5\u0348\xb6Z\x18\u0398]\xc4q\x8a\xf2\\,\xcb\xe7\x18\xe1\xb4\x0f\xf2[\x13\xa5\x198\x15\x9a\xe2\xe1\x8a\"\xd2%f\xa5\xb5\x12\xd9\xd5\xecV\xb8\x19!9x\xc6M(\xc3\xe6\x98=\x82\xc9q.\xa1\x83\x18\x0fd@\x1f *\x88I\xbcSyZ\xe4\xd4\x00B\x97\x8e\x98\x19\xbeE\xd3c\xd86\x89XpL\x93k\\o\xc9f\xa8\xda6s\x84\x01B\x01\xa5E5\xb9\xaf\xe7\xac?l\xf5\xe3Q+\xee\xb7\xe6\x1f\xd7\xffgt\xfd\xb1\xbb\xb5>\xef;\x01\xa0\xefIR\xbe\x18d\xb5\u0546\xdda\x97\xad\xe1|4\x16B\xc1I\u069e\x9d\xbd\x02Ae{s\xdb!\x8a%\x7f\b+7\xb2Q\xb4&f\x1cCEQ`Q\x9e\xf0\x95\v\xa1B\xa1\x81vK\xaa\xbe\">\u0a3d~\u0521M2\u0346\xde\xe9\n\x93~|\xf2\\bc%1\xc77\xf1\x8c\xfa\x11\xdcZ\xc7\xc0{\x99\x8d\xd7r\x10-is\xa2\xe5\u0538?d\xee\x01\x0e\xe6K\xe6E\x15\xfc:\xfb\x17c\xec\xa5Yr\x8dD\x8c0\xe9\x85\xc9K\x008\xf0\u0086P\vwu\xc38$V\x8e\xee\xec\xd5\xe9y\xf4\xfd\x7f\xbe\xfe\xfe\xe4%\xcfH\xef\xb8jF:\xfe\x8c\x88Q\xe5\xf2\xae\x1e]UvO\u0180\xd3\xf0\u01d37\xaf\xa2w\u03ce\u03ff\x97\xd3\nz\x03[\xe8p\xf9\x10\xbe\x8f\xc7\xd7@O~\x1f\x8f\xb2\x88\x92;\f\xa3O\xd9m2\xe4\xb51V0\xc0\x8d\x8fc\xccE\x06p;\x9d\xed\xf6\x1a~\xa0b\x89\xc1KO\xaa\xe7IVl!wj8i\\\x14\xf5\x18\xf9m\xc3V\x9f\x9a1\xdb9B\xf6\xccJ\xe1v\x8a\u0393\xfe\u0358d\x04\xf1[\xfc?\x9dN\xc5L\b\xc0\xae\xe9j)\xbb\xac1\x16]W\x81\xef\x18\xfb\x96;\xa9\x01\xc4\xfb\xfe\xe8\xcf\x1f]\xed\xaba|M\xac\xeb\x18NF\xa1#wU\vc;B:\xa6d\x14\x17q\xda%\nG\xc2C\u0589\b\x98\xb6\xf4\xee\xee\xd6\xdeZ\x87\xd6\xee\xddw\xcf7\xcdt)N\xc0\x9e\x0f\x85\xddh\xf8\u018a\x9eu\xfc\x10\xe0>\xc3\u02c1\xf7\xcc\u034a?]\x86\xf5M\x15\xd5\xe1\xeb\x83\aB\x1b\x0f8\x7f\xeb\xfaz\xf4\u0392(\xa48\x0eRK\x8a\xb6\xe0)\x97\xe1T]~\x95\u0098l5y\x13T=\u01551^\xa4\x92!\x99\xc2*/\xc1\x02\v\xb6d\xb5]RK\xafo\xe3%0]O\x150\xd3\xdd.C;c-\x9e\t\x998\x06Z\x88:\xc5!\xb0+r;\x96L?\xa1&C^\xe6\x85m\x87PL\xc8\x05b\x8d\x1e\xc1\x99\x8c\xf9C\x9f\xc0\x8e:\x00R\u021fc\xfe\x04\u06b3\x864-\xe2=\x8f;>\"\xb2\x12\xf5\x1f\xb9\x895d\xf7 \xba \xbd\xec\x05\xde\x13m\xb4\xdbM\xfa\xdc>\x8d\xde7\xf9\xd9\xe6\xeeF\x93?\xb7\u0573]y\xb6\x17I\xaa3z\xbe\xb5\u05e1\xe7[\x87\u01f6\xec\xd6\xe1\xa9<s0\xb7\x8e\xa4\xdcQ\u05ef\x7f\xb4)\u03f7T\xd9\x1dy\xb6c\x9fmK?\xb7\xdb\x1b^\xfd\xed\x8e<\xef\xb8\xfa\u06db\x87\xfcl\xeb\xc4=\u06d1r;m\xbf\xfe\xf16??\xd9teOv\xe4\u066ez\u0593g\xc7^\xfd\x9d6\x8f\x15>m\u065d\x0e\x8f\x15>\u0773\rn\x7fg\xb3\xe7\xd7\xefq\xfb;\x87mW\xf6\x84\xfb\xbfs\xbaa\x9f\xed\xb5\x19\xe6^\u06df\xbf\xbd\x8d\xa3\xa6|\xba\xb2\x9bRvsW=;\x96g~\xff\xf7\xb6\xa4\xec\x96\x1b\xff\xdev\x97\x9fm\xab\xf6w\xa5\xdcn\u01ef\x7f(\xed\x1f\xaa\xf6e\xad\xf7\x8e\x14\xcc#i\xff(h\xffD\xda:qm\xf5d\xac=\x1a\xab<\x93q\xf6h\x9c\xae~O\xc6\xda\xdbTe7w\xe4\u066ezv(\xcf\xfc\xf6{\x82\x17\xbd\x1d\xb7V=\x19koW\xc1\x94q\xf6\x0e\x83\xf6e\xac=\x85\xbf=\xc1\xdf\u0791j_\xc6\xdf\v\xc6\u07d3\xf1\xf7\xd4\xf8\x0fe\xfc\xf0\xe9\x9e\xc9\xf8\x0f\x83\xf1\x1fn\x9c\xcas\x87\x7f\x872'\x87\x9b\n\xa6\xac\xffa0\xfe\xc3-\xc6?\xf8tew\xb9O\x87j\xfc\x87G<O\xf0\xe9\u05d7q\x1d\x1e\xb9\xfd\x7f\xb4qB\u03ce6\x1dN\x1fmn\u02f3]\xaf\xfe\xd1fO\x9e\xab\xfa[[\xfcL\xf5\xe9H\xe6\xff(\x98\xff#\xa15G\x8a\xd6\x1c\x1dI[G\xaa\xfe\x91\xd4\x0f\xe6\xffH\xe6\xffH\xcd\xff\xb1\xcc\xdf\xf1\xa6~v,\xcf\xfc\xfa\xc7G\xdc\x7f\xf8te\x8f\x19\xe6\xf1\xf1\xa6z\xb6-\u03f6\xbd\xfa'\x1b\xdc\x16|\u06b2'\x1b\x9b\xf2\xcc\xc1<\x11\x9c>\xd9<\xf1\xeb\x1fJ\xfdCU\xffP\xea\x1f\xee\xa9g\x87\xf2\u031f\xbf\x93#\xa6\xeb'j\xfdN;\xfc\xec\xb4\xe3\xea\x9fn\xf0\x9a\xc0\xa7W\xfftcG\x9e\ufa32{\xf2L\xd5\xdf\xe1~\x9e\xee\xf8\xfd?\xdde\xbc:\xddusu\xba\xbb-\xcf\x14\xcc=)\xb7\xb7\xe3\xd7\u07d3\xb6\x14\xfd9\x95\xf5?u\xeb\xdfiwi\xfd:p\xe0\xe9\xfa\xf0\xbb+\u03fb\xae\xec\u01b6<\xdbQ\xcf\xf6\xe4\u065e_\x7fk\x97\x9fo\u0671\xe2\x19L\xcf\xf0\x186\xcf6\xb6\bO\xf1\u04eb\xbf\xd3\xe1\xf6w:v\xfc\x9d\x1d\xe9\xd3\u0386z\xb6%\u03f66\xfc\xfa;\xf2|g\u00d5\xe5\xf5\x87\xcf-\xf5lG\x9e\x1d\xfb\xf5y\xae\xf0\u04d5=\xe2\xb1\xee\x1c+\x98\xc7\xc7\xf2\u032f\xbf\xdb&\xbc\x82O\x8b?\x9d\xdd\x1e\u05c7O\xfbl\xaf\xcbs\xb2\xd7\xf5\xce/\xf8\xbd#\xcfw]Y\x19\xff\x9eZ\x93=\x99\xff\xbd\x8dC\xaf~\xaf\xc3\xf5{\x1dW\xff\x90y\x05\xf8t\xfd?\xe4=\x85\x9f^\xfdCY\xebC\xb7\xd7:Bk;\x87\xeeL\xed\x1cnr\x9f\x0e7\xfd\xfe\x1fn\xf3\xf8\x0f\xd5\xfc\x1f3\xad\xec(\x9a\xd09>=\xe1g\xa7\xde\xfa#\x93\xd6\xe4O\x8b+\xddv\xb7\xc7\u03fa'\xee\x19\xe3\x14|n\xf8\xf5\xb7\xa5\ucdaa\x7f,eO\xec\xb3\r\x81\t\x9f^\xfb\x1bm\xde?\xf0i\xfb\xda\xdbm\u04dc\xe0\xa7zv(\u03fc\xf9\x87#r\x8b\x9fwm\xd9\xd3\xc3\x0e\x8d\x15?\xed\xb3\x13^\x13\xf8\xf4\xda?=\xe9\xca\xf3\xee\x86+{z\u0694O\xfb\xec\xf4\x94\xfa\t\x9f\xfe\xfa\x1bf\x01\xbf\xb8\x15\x80\x1f[\xe6\xe9\xb6~zd\x9e\x9e\x06P6d\x1b\xf7\x14\x1e\xc0\x8fS\xf3\xd4\xed\xe4\xe3\xce6\xa3\x1c|\xf1i\xc11\xecXy\xe3NN\xfc\xb1e\x9e\x1e\xaa\xa7\xbd\x9e<\xed\xf9;\xea\xb8+\xa8\x06_\xec\xfe\x87\xe9\xe3q\xd2\x17\xf5\x94\xa7\x0f\xbe\xecx#:iw\xda\xf2\xa6\x83X\xf0\xe0\xfd\xfd%\x93%\xb2U\xb5\x88B\xfa\x8d\xb5^\xb4&\xb2\u029a\xc8*k\"\xab8\xa1$V\u0498\x12J\xda=>,\xe0\xd3\x12u\xe0\xdc\xe4\u0666z\xb6#\xcf|\xa6\xa2\xcds\x8b\x9f\xaa\xec\x89<sB\x01pX\xfc\xecp\u04ef\x7f\xb8-\xcfU}a@\u068a\xd1h\xcbA\xd3>\xf2\x0fu\u0640\xf8\xe9\xca\x1eK_\x8fw\xd53\xe9\u04c9\xcfT\xb7O\x04\xee\x89c`\xda'\xbb\xf2L\xf5\xe9D\xfa\x14\b%\xedSi\xffT\xb5\x7f\u0695g\x1b\xea\x99\xf4\xe9\xb4\x17\xd4\x17\xb8\xa7G\xaa\xac\xf4\xf5\xd4\xcd_G\x18\xd5N\xdb\xef\x7fG\x04\xa0\x8e\x12\x80:\x9d\ry\xb6\xa1\x9e\x1d\u02b3C\xbf~\x97\xc7\xdf\xe9:\x06\xa0\u04d5\xb2\xddC\xf7L\x98\xa7\u0386/\x14vx7\xe3\xa7*\u02ccbG\t\n\x9d\xcdMy\xe6\xaf\x7fgS\xeao\xaa\xb6\x84\x01\xec(F\xb5\u00c72|\x06\xedoK\xff\xb7U\xff\xb7\xa5\xff\xdb\n\xe6\x11\xcf)|\xfa\xf5\x05\x7f:\n\x7f:\xc2T\u00a7z&\xfd?\x0e\xfa/\xccf\xe7x[\x95\x951)\xfc\xeb\x1c\xf7\xe4Y/\xa8\x7f$\xcf\xdd\xfawEP\x84O\xf7l[\x9em\xfb\xeb\xdf\x15\xa1\xbe\xab\x04\xc0\xae\bE]%\xd4w\x99\u0440\xcf\u00e0\xfe\xb1<ws\u07559\xe9\xaa9\xe9\u0298\xba\xc7A\xfdc\xa9\x7f\xac\xeb\x9f\xca3\xb7\x7f7Dy\xb1\xd1\xf3\xfb\xbf\xd1\u06d0\u7381\xdd\x10F{\xe3\u020d\x7f\xe3H\xca\x1d\xf9J\x91M\xd9\x17\x9bJ\x80\xdb\x14E\xc5\xe6\xa6R\xb4\u021cnnu\xfcC\xbd#\ax\xa7\xed\x0eu\xde?\U00039b5e\xed\u02b3\xbd\xa0\xfe\x91<?VL\x85\xc0\xecv\u0573My\xb6\xe3\xd7\u07d0\xb2\x1b\xaa}f\xca\xe0sC=\u06d2g[A}aj6\x0eU\xd9\x13y\xa6\x98\x9a\x1di\x7fg\u04ef\xbfs*\xcf\x15S\xc3B9|n\xbag=\x19g\xcf\x13j\xba\xc0\xa57\xe5\u04d6\xed0G\x80\x9f\xea\u065e<\xf3\xe7OhUW\xd1*\xf8\xbe-\xcf\xdc\xfcw\xba\u0727\x8e\xcf\xd4v\x85~\xe1\xa7*{(\xcf\u071c\x00\xdd\xe0g[\xfe\xf8;[R\xd6)\xb0\xba\"Tt\x15\xfd\xe8vv\xe4\xd9N\xd0\xff=y\xbe\xb7\xe7\xca\x1e2\xaet\x0e\xd53\xa6)]\xa6)\xaa>\u04d5n\xc7\t\xb0\xdd\x0e+\xc5\xf0\xd3>\xeb2\x8f\x81\x9f^}@(y\xbe\xa1\xca\xee\u0233]\xf5\xecP\x9e\x1d\x06\xf5O\xe5\xb9[\xff.\x9f)\xf8\xa9\x9em\xc93\x1f\xff\xba\x9d\x9e<\ufa72\xc7\xfc\xac\xebp\xba\xdb\u0750g>S\xdd\xed\n\xdc\xee\x96*+\xfd\xef\x1e\xa9g'\xf2\xec\u012f\xcf\xc2\x06|\xaa\xb9b\xa1\x02>\u075e\xec\xf29\x83\x9f~\xfdM)\xbb\xa9\xda\u06929\xddr\xfb\xb7+8\x11\xd0_\xf8-\xedo\xab\xf6EP\xe8*\xfc\xe9nK\xff\xb7}\xa1\xa4\xbb+m\xed\xaa\xf5c\xa1\x1c>\x15\xcc=\x99\xa7\xbd`\xfeY\xa8\xc0OW\xb6'e{jN\x0fe\x9d\x0f\xfd\xf67X(\xc6O[vS\u01bay\xe2`n\xb2\xa2\xb4\xbb\xb5\xe9\xe3\xcf\xd6\x16\x97\xddrBYwkW\x9e\xed:\x9c\xda\xda\xe3v\xb6\x82\xfeo\xf5\xa4\xac\xe3?\xe1\xfb\x86<s\xedo\x1dJ\xfdC\x1f\x7f\xb6\x98\x7f\x84\xcf\x1dU\xf6H\x9e\xb9\xf5\xdf:\x92v\x8e\xfc\xf5\xdb:\x92\xfaN\x81\b\xdfe\xacG\x87\xea\x19\xaf\xdf\xd6qP\xffD\xfau\xe2\xe6z\xeb\xe4T\x9e\xb9\xf1o\vM\xdcn{\xfc+\xfc\u0793\xe7{\xaa\xec\x89<S\xf5;\x8cg\xdb\xc1\xfe\u06d6\xf3\a>UY\xa9\xef\x84B@S\x1e\xff\xf6\xa6O?\xb6Y\x02\xc2OWV\xd6\x7f{\xbb\xa3\x9em\u0233\xa0}\x96\xd0\u0ce7\xcaJ\x9f\xb6\x8f\u0573Sy\xe6\xe3\xdf\xce\x06\u04ca\x1d\xb5WwvxMv\u0719\x84\xb2\x18\t\xa5\xbb\xbeP\x8fn\x13\"\xac\xda\xfa\xa7mSX?%G\x0fV\x16\xb4\xf99\vjl0p\x98\x8e\xd1,<O\xe2i\xff\x86\u0360\xc4}\x15od1\xdb\xfc\xd8y\xdc\xd8\x1b\x7f\xf2\x8b\xc3\x1b\xa5D_Z\x15\xa2\x18%\xd7\xc9\xf4K4\xef\xe7Q\xaf\x04\x886\x83\xb6>L64\xd7\xf9t\x9e\xf8\xddX\xdc\xfcS\xbej\xb3a\xb2\xf0\x1a\xef6\xcdU\xfaO\x90\x05\xd3\xfc\x8cji\a\xb5~nCT\xf4\xe6\x9f\xd3a\x8a\xf3\xe1\xf9\xf9]zs\x94\x8e\xad\b\x1b\xd1]\xabI)9J10\x0f\xcc\xf4(\u01bc\xa8\u1758\x89\v\xb8\xc6\xce \\c`#\x86\xe2,\xfd\xaeP\xe9\xa2\xfd\x1e\xfe\x8f\xae\xb6\xf8\xfe\x9b\xe2{h\xeb\xfdE\xe7}Y<Q\ub3c1\xfd\xf9\xe6\x00\xfbg\x9c1\xa0a\xe8\xe1\x8bxv\u04fa\x1af\u0674^\xc7\xce?\xc1\x9e7\xa2\xf5\xa8\xab\x1c\xa5\xaa\xdaM\a\u052e\xf5\xee\xe0\xd1#\xe0'%\xde.\x15\xa3#(m\r\x85\xa6\x0e\xa1\xac\x05P\x82@\x84.\xab\x9f\r?\xe8\x8f^G\xc6+_V\xc2t\xd2H\xac\x80\uca28\xe0({\x95w\xb6\x7f[\xf4/\u04dc\x90\x01\xae\xee\x90B\xfc\xf0^\xba\x80\xff\xd5(l5(\xf7Aa[\xa9\x02\x85\xdd\xfb\xbf-\n\xabv\x7f\x01\n\aP\xfe\xea(|l2\u855ap\x95 \u026f\x83\x8e\xb6\xd6\xf9\xea\xadZ\x9c\u00e7\xc6h\xa1\x88n8\xa5\x95\x86\x13f6\xa5\x1f!\xc07T\xc1\x96&\xa0\x85\xb8\xd6\x15u\x8f\xd3|ZU\xfd\x17\u03785\x184\x86#HZ\x96\x92\x8d\xfc\xefi\xa1\x8asSuRRT\x7f$\xa2l\xd0^\xb4\x1fj)\x9ap@\xc13J\x16\xc5\xd8\xef<\xf5\b\xc8\x06\x05\x11\xe7]K\x8e\x98W\xe8\xf5\xca\xef\u069f\xe3v\xa3\f\x94\xb6\xe91Af1h\xdc\b\x93\xeaaG{gG\u03deUt\xf0w\u050a\a\xb6c\x80\x1c\x86\x87?\xdbWUZ\u0574|\xdc\x16\x8e\x83&\xcfk\xa0m\x1a\xe0\xec\xae\xf1t\x8a\x01\xbe8\xc1+\xf6I\xccyce\u02d8U\x1aO\xb6\x1c\xed\xe8H\xa0L7\x7f\x1d\xe0\x00a\x06\x99\xf8\xf0x\xf9\xf1\xd6\x15Nt\x10\xd9B\xdb\x00\xa2\xefKKY\xfc\t\xfd\xe25%\u1a7bg\b\xbby\x10\xc3\x03)\xe7\xba\xd0Mv\xdbv\x11\xf1A\xbc\u067f\xb2}b\x88\x0f\x0f\xe8\x8eh\xe3\xaa\xe1\xf7\n\xdd1\x7f\xff\x87\xa8\xd5jE\xff\x99\x16 \xc7\xfd\xb6\x0fy\xb0\x13o0\x047\x98\xb3\xbb\xe1\x10W-/T\xbf\xda\v\xaa_\xc5WW\xb6:\xb6{\xe49\xb4<3\xbej%\xa0\x92N\x00*\xe9\xecYP?`\xecW4BDc\u03f2\xca\x1ba\xe5\xedE\xfd8-\x87r\x15\x8e\xe6j\xbbm\xa1\xa0\xf1$\u04c4\xaa\xdaIX;\xd9n\x94.'\xf9\x8e\xeb\xa2]\x8c\xceQZv\xa3Pv\x83\u02b2\xe7\xae\x04\xcc\u06cf\x92Q\xf6\xe7T\x1b\v\xce\xf39yn\x18swf\xf7)\xecF:\xf0\xbdr\x86Hw\xafo\x18\x9c\xe2\x8bx\xb0\x18\xd2.\xca1e\x00\xc6\xc5FF<:c\xff\x00\xdcv\x83\x01\x15H\xc9\xd66\xb7\t\u0192\u0477\xbf\xec0\b\x0f\x01\xe7\x1a\xf3\xf7~\b\xbcY\xe1\x04\xf0\b\x9c>\xb8\x8bt\xae\u0292Q\xa7#X\xf9\x8c\xfe\x8a%qaJ\xcas\x92Lm\x8c\u06ef\x9d\xcf0\x10\n\x8c\x04\x1e\x158\x1f/\b\x868nM?\x89\xfd\xe9\xd2P\x18^ :\x15\n\x8aB\x1b\x98\xdf*\xbe\xc1\xad4\x1fNm!\xd6\x11.%\x17\xfe\x9d9\xa4\xed\xba\xac\t\xff\n\xdd|r\xc0 \xa5\x12\xfe\xae\a1\xa2`[\x03\xc9\xfa\x16N\xa0}\x8eC\xa0Y\xda\xe9'o\xf50\x94\a\x05\u015c_J\xe4\x11I!((\u0293\x9d]]\xe1e\xaf\x8f\xbdj\x1d\x16\xad\xaa\x1f.\xe5:\x99\xa9\xb6\xd0w\xa7U\xba\xdf8\x10\xbf\x04\\fOt\xbf/!\xacr0\x18\x1d\x96'\xb5\nu<\x00\xa5\xa1\x97\xcf\xc3R\x0e\xbb\xe8i\x80[\x92D\xa0\xe9\xdaV\xc9\xe8\xf0\rE<nF\xc9x \xdfn\xed6$\xdcs\x85X\x04\xbc\xb5\xe6\u046a~\x10\x9f\u017dp\x81Z\xb8\u0793\x12\xd4\v\x02\x9d\xb8\u028d\x02.~\u00e0\r>^N\x93\xf8\xa3\x97{\xc6\xcd0\xf0\r\xf3\xb1\xd8\xfd{I\x91\xcdH9I\x8e\x9d\x007.\x17\xb8\xc4\x16\xd5\xc3\xc3C\xcb\xec\f\u06dc\xaa\xb4\xf2@\r\xf4F\xc3M?\xccWq\xccn\xe9\x1e\xf8\xfd2\x113L.j\xccVaP\xa3^\xb6\xba\x8dp\xff\xb9*z\xde\v{\xb2b?\xf2\xb6`\x1f\x9b\x81\xbf#\xfe\xf6{\xb0\xbc\x16v\uc722\xa0\x0eJk|\xd5\x1e\v\x92X\xeam\x06\xedxq\xad\xbcza\xc9hM\xf0\x99&\x1c\x8bN\x13\x8e\b\xd2\x02\x0e\xa4^\x93\xb8$\x803\xe3\xebd\x98]\xaf\x8b'X\xad\x19\xd5f\xc9\xe7\xd9\xfad\x18\xa7\xf0\xebA\xad\xd3\xeala,\xfcZ\xedAC\x12s.\x015\x88gI\x11N\xb7\xdd\xd9Yko\xafu\xf7\x14\xb40\\\xca\r\x1e\xb1\x18\x9f\x99\xbe\xfc\xa3\ag\xa6\xb9\x9a\r\x92\tMR\xebl\x96M\xe3\xeb\x84r\xde\xcb\x0e\xf8w\xac\x88\xed\x7fJ1\vW\xd2\x1f\xc6S\xf1\x9a\xe3\x19xLY\v\x98\x15\xe5\xc8\xf9\xa3\x04\x03\x1c\xa4}\xf4\xbdG\x9f\xd19%\xbbIM\n\x00\xcc\u0141NBY\x16\xe5#\xf2\xf2\xc7ho4\x13\xf0\xc9I\t\a\xd4_Ie\x8b\xe4\x9a\u06b2~0\u03b1\x8f\x92p\x90\xf3\xf5x\x90\xddF7\x19{Ts\u05c2\xe8%xV\u0158U|J\xe7'\x97Ay\xae\xdehE*O\x11\x96\x1e\xc3\xd7\x14\xba>\x86\xbe\x93\xff:\x86<\x80G\x7f\xb1\x01T81-\xf7\x90Aq\x1f\u03b1G6\u06e3\tv\x1fOI\\U\xa1\xda\u0171\xdde\xbe\x90\x80\x05\x14A\xcfD\xb4\xfeK\x96\x8d\xb4k\x94\x8c\xe8?\xb39\xad\xb7\t\x8cM\t2\x80\\\x9a\xec\xea\x11\xbauCg\x13\x9b\b]\xf7\x13\x81J\x87\\R\xcd\xda\x1f_\xbdz\x81\a\aH\xc6\xff\xa6\x82\xe6\x1cN\xd3\xe4*bc\xb5;\xdb\x7f\xeb\x95\xcf\xdd\xc5}\x84\xdd\xecg\x13\x89^A\f\xe80\x9d\\f\xc0\xb2\u06ac\x91w\xe8\x8c\x16c|\xfftf\x1c\xe8\r#\x7f\xf8\xbcw\xf4\x87\xe8\xec\xe8\xd9\xd9\u066b7g\xca=\x97|s\xefx\xc4\xe2\xbc|\x8fAk\x04 ?\xe0\xb0\xeb\x98\xfc\x94\xa7w\xcdvx\r\xc4\"\xd8[5\x15\u0501\x90\xc0[\b3\x9dX\xf6\xea\x0eI\x80\x9a\xcd\x1f\xe7\u075dv\x17\xe7\xd1b+\xceQ~\x83\x1dM\xd1C\x1dP\xfe\xe3,\x9bDT]\x82\xb1X\xf7g\x83\r\x9c\xber8\x04\xfc\x04\x88\xddm\x8e\xa5h\xe7\xec\xe4\xd9w\u07df\x7f\x1f\xbd|u~\u048c\xfe\xad>Kg\x18\xbb\xc5\xcf{\x89se\xe3\x87X,\xa3\xa2z\x14\u049d\x97\xaa7\xe7XF\x06\x83Wz\xb6\x01\xfe\xad\x90\xe4\xb9\xd85RtG\u066b\xe4\xbdK\xf9\u032d(\xd7\u31f0\xb2c\fO .\xe9\x92\xc7\xd9d\u033e#\xaf=\x8e\xe6\"\xc9=\xa7\xf3\xf1\xd8\x1eF\xdc]\x04t\x9cL\u0200\xb1\u018f\xce\xfa\xd3l8|\x9dM9{^\x8e\x04\u07beI\x92\xb1yZ\x88\t\x1a\x99r\xe72;a\xfd\x1f\u0397\u05c52G\xf1\x18\x884\x97|\xef\x93)\x9e\x12$\"\xf6\xe4\xc4\u0416\xd7iN\xd9p\x19\x91\xf9\xe0\xe2g\u03d8,\x05\b,\xe9K\x06s:\x85\xb1|\xea\x953\x1c\x80i\x03\xb8\xee1Bb\x1fhs\xd1\xe3\xeaE\xb7\xe4\xb4:\xa7`\x0f@\xf3\xb2\x8f\t\xed\nsc\x18P=\xda\xe1.\xd7\xe7\xfa\x83B\x8fy2`\xe6\\2\t\xea\x00\xb3\x05\xb6\a\xd9\xf8\x1d\xd1\xca:\x93L\u00e2\x96\x90Q\xfe\xd1B2\xcf\xec\x9e\xca\xcf\u0260\x9bQ\xdbqv\xaa\x85\xf3\xf8\xb2>\x8b/\xbd\\i\xf1%3\xb0\x04\x133\xa6\x8e\x12\x15\u0690~K\xf3\x94x\a+\xc8\xefg\x83&\x91\xf4\xa6\xed{yN0\x93\xed`z\r\x85\xe2\u01be]:\x8a\xec\x84\xea\x15d}\xe6\x13v\xaf\x8f>u0\x96B-\xa7x1\x18\xa0\n^N\x98r\x19p/\xe2\xbb\xcb$\xf2&\xa56\xce\xc6@\x9cnM\xa8\t\xca\x17\xab\u00bbP\x86]\x1b\xad\xc0\xc0*\x99]\x00\x84\xe1'l\b\xd9\xca\xc9\r2\x9a=44\x83\x88\xb9p\rZ\x1c\xe7\xb41\xe3\xf8Sz\x8d\u0673Z\xc0uL{\xd7\x18\x01B\x92\xc8\xfc\x98\x13s\x94\xfc\xb8^\xffq\xf0\u3831\xae\xd2\u03d9h\xa4\a\x92H\x06\x90:O\x9e\x8dgu\xce(\xd3\x00Y\xdaH\xe1,)\xa8\xe5\xa4\u0213\xbc\x909w\xab\xf8\xa4\x85\xe9r\x95\xa6\xd56\xf8M\xd4U\xf9\xe9\xca\xc6(I\xca\x15\xaf\xd4\xe2q\xd4K\x9a(\u01d0\x15\xc1b&\xa0a=\x9c|\xc9\xc7 \x8d\x01z\xe6&g\x06*\xc6\xf3\xf9D\x02\xd9\xc1\t#\xf1\xe5(\x13x.\x01\x1f`\xe3\xf6g|\xbd\xcb\xc0\xe0\xec\xacQ\xdc\f]\x9a\xcf\x18`\u0650\xfc\u01f7\x14\xc7\xc8\\\xe8\xa7\xf9k)\u0643\x82\a\xeeRr\xd1JL\x91\x8d*{\x82\x9b\xecE<N\xaf\x80fj\xf4\x19\xc93\f\xc1^Y\xc1LN\xd8%S\xb9\x85C\x81&\xf5\xef\x96\xdbg\x9e\xe8\xec\xc1P\xe1U_\xebI$\xb6\x95\x02\xec(&\"u\xcc\x1a.G\xabH\xa4\x98\\p\xf6`&!?!9\u06cfj\x93l2\x9f\u053e4,\t\u04d8\xb2hB\xb1%/\x91\"\"\x05&\x91\x92|!\x9c\xda\n\x9f0\x8f\x85\x84\x8f\xceWX\xd9G\x92T\x04\xf5\xc8|\xae>\xe2\x9ct\x14[\xc6\x00\x04V`\x94\u184e\xa1\x18\xfa\x9c\xc4\r\x88\xa1O*i\xc0\xae\xd9:\x11\xddr\xac_qF\x84\x1e\xb9)1\xb8\xff\xa5Q\xc8e\x86Ap0v\xceOFsx\x93\x90\b\xf6Eh+\x8b\xe9\x03`\xa0\u01e2\x196\xcc\x03vy\x98B\x8f\xcf\xf0&L\t\xb3P\xd8\x13`\xe17\x16\xa68\xf10Q\\\xe9\r\xec\xa1ziv5\xd3#\x15\xb3i\x95^\x14\u0522\xf7\xe8FK40\u055d\x91YY\xb97\xdfs\xf9\xaf\xec\x0e\xb7\xe6\xe7*\xce&wA6\x9bab\xb3\x9e\x92\xe2\xef\x0e\x18\x88QQ^0\xec\xcc\xf7\xe7/\x9e\x1f\x03\x16b8\x05\t\xc7-\xbf\\6 \x0f(\u01ba\u0443\xc3\xdfg\xa6\xc0yvd\x1a\xf2G\xc9 \xc3\x1ck\xe6y+\xf9\x9c\xf4\x8f\xb2\x11\x90\x93A\xbd\x86\x10k~\xba\xb5\xab\x14\x84\x85\xec\xf3\x89\xc91\xa5\xc8\u0233\xeb1\xa7tO\xf3VtzZ\x968O\f[\x90G\x88\xf9\rft\x938f\xf62\x87\xf7&\x0e\xd7\xde\xe0P*Im$\xd1\n\xaf\xed_\xc7\xf9,)\x9dh\x8e\xd1A\x89r8X\x05\xcf'\xedx\xb3\b \x11\xc0\xce|6fmF\xb2~\xca\xc3D\x8a\xb8\x0e\"\rp\xef\xd8\xfbd\xfc)\x9dfc\xca\x10F\t\xe7k\xc0\xc4S\x98q\tY\xf5\xc86\xfa&\x89\a\x8f0\xf3\xbcD(\xc2\\\x82c6N\v\xc0p\x9a>B\xc7xx\v\x83\xa5\xb8D\x98\xadLb\xd5\x19\xca{E\xb9\u1266]\x82\x14\xf81\u01f8#(b \xd6\xe7\t \x1e^\x10bdM\x15\xd0m\x05\xec\u00ac\xbc4y8O\xad\xe5VI\\8\x9fC\xe3\xc9\xc0\x97\x12\xe9\xd5)F\xf3\xbd\x0f\xf2\xd9\x1dW\x86\x83\x04\xf2+\x91\x10\xb1p\xb3M\\A6\u0108\x1e\xccL\xa6\xe3~\x06\x9b\x94\x12[K\n5\x1fG\x15\x0e\x06\xa8J!\xe10B\x11\u0201\xdcmRi\x1a\x8c,\x9a1y8z\x04\x8bC\xf1\xee\x90\x0f\xd2\"q\xb8Z\xaf()\ue5c8~\xe6\xd1\x0f\xf1\x14\xb3@\xf1\u03c4\xee>\x8d\f\x1dB)\xa8c\x19D\x8b\x84ZV&\u0477\xba\xf0f\xb9!O|\n\x03\x93\xce\xe2\xef\"X\x97\xd9\xe0\x8e\xd3\xc0\x8a*\x80\x1e\xd41J\r)I\x1aE\u0141F\x03\x86\xe2.)\xa0'\x98\xa6\x05\tg\x13'n\x88\xecK#:\xf8\x86h)%\xc1\xb5z~`\x94\xe9\xe1\xbe-h\xd82\x99\xaa\x03\xaf\xf4\xcf?G\xea9\x9e\u00ac`7\x0fY\xd3\xc6\x12H2\xbdf\xfa\x81l|-\x97\x98\x87*\x15\x9b\xd1\xea\xe4\x1c\xdd\r\xf1\xeb]\"\x99,0\x18P\x94\xce\x18\xd4 \x15\xe4\xc2h\xb9\x18\x18\x0e\x958\x80D\xf9l~ue\xe4`\u0137\x1c\t\xdb\xf8\xa3a;9\xa7,uK\x18\x8a\x1a\xcelm_O\xbc\x91\xceki\x1fZ\xde\xc7^\xc9\xd8[\xf8\xa4\x19y\x9aa8\xc1\x8e\xe3Y\xfcv:\x14\xa9u\x1d\x8e\xcb\xeb$_\u01f2k{\u06f5\x06\xa5\x0f\xf9b\x12\xbc\xceD\x1b\xa2\xa0\u04a3\xa6\x91'\xed&e41\xb3\xff\x90\x7fr\xbaD\xa3Qa1\x19\x8b\x98G\u0637\xab\x96\xe8k\x00\xab\xf3\xfab\xbd\f\xf0L5\xaa\v\x03\xa5\xcf/\r\x97\x8bV\xe4\t]\xa9.\x9d\x95\x99\xa4\xee\x8d[\xd9\x18\xc8r\xffc19]dFEg\x81a\xb59\xc9\x0e\xe6&\x91T\xa3O\x1dW0\x0e\x0e}\xa0\x06\xd39\x06F\x14\xd6CT1\xc8qahDw\xca?\x93P\x92\xb9U\x7fS|L\x0e\xb34\x99_B\a\x91t\x0f\xd6o)c\xe8(\xc1|y\xb91{\x90@\xa0\xccwT\xda\f\xb8\x8bGu\xe3\x98\xe6\xaa'\xc5:\xc28\x91\xfa\x86\xbf\x16k\x99\xad\x1c2\x92\x1eG\xaarB\x9a\x8b6{oFOo\f\xcbU\xc2=\xf5\x06t\xc0\xbb\x10\xb4n\xb4%\xfdY2xD\x8a\xaf\x9a\x00\xac\xb8\xd2$\xa8\xacs\xb0\xd3\xfej\xb3\"<nL\x9c^\xd5<\x98\xa3\xda\xf5\x0e\x93\xf7\xd2P\u0722\xd9@\xa6\x8e\x93\xc4<\xb9v\xae)\\\xa3E\xae\x8a\xa1\u0096\x18'\xc5Mdv\x86\xd7b\xdd\r\xb9\xa9\a\xeaK\x14gb\f \x93\xc0\xc1\x17\xf5\xc2\xd9~\xdbX\xd2&\u01fd\xeaa\x80\x11z\"H\x1c\xa4(\xf6\x92e\x9e\xb9f{\aY1R\x94\xe32=R\x84S\xb2\x94\xf8\xb8U\xb1\x9e\xf4\xaedQ\u0240\x12\xb3\xc6\x14\x06\xe2F\x8b*x\n\x98Ng3\xe9\xf4W\x1cf\x15\xc8%l\xdd%T\xb4e\x85(\xf9X\xb2\xceCi.t\xb6(\x9dL\x1aI^>\x9b\xc6 ZM\xaa\x9eUT\x06x\xb3Z=\xadv\xaf\xc8\xe5\xad\r\xfe\x1a\xcft\xce\x1f=\x1f\x8b\xf3^\xb3&\x81\xf3\xb9\xa7r\x17XE\x9b\x9c&\xd9A\xaf\x98\x8dYvV\xb8]\xf6\xe6\xa2v\xe1\xea\xa9\f\xe9bs\x10\xa1\xbe\xde<\x93NP\xce\xf5\x95\u03a57\xd9\xedQ6\xfc\xf5N&f\x9d\x8d]\x80\xa7\xc7g\x18\x1c\xa40!\xfe\xb9\x86\xd7kWC\xe01#\xb4\x1c\u683e\x9cv\x9d\x15\xf3|)*w\xa7\xa4\x9d71\xe61\x98\xe6%\xc6\xf8\x1f\xc5\x03*<\xca\x04A%\xaa\xbe\\\xfa\x9b\x8c\xcal\r \x167\x14R\x9b\xefF\"\x93\x94\x17\u00faJ\x02\xa7\xdb\x04C\x8e\x96\x82\x13\xb3\x1f\xca3\x8d\x96|\xfc\u0605\xa7\x16\xb0tu\x97\v)3\x83\xc41\xb2\xcc\xc7w\xdd\x14\xe8Z\xc0c\uf447\xe2\xc4S\xdc\r\xd6\t\r\xef\xf8\"\x10C\u049a\xc1\xa3x\x86\xd1\x1d\x89\xc2*\xebG\xcc\xed\u0301\xec\xa7\xebC\n<I\x81\xf9+\x0fH\\,\xa4\x11\xf8\xb9\xca\xc1(\x93\xa0\xec\x98\x16\u0532\x14\x05-Y\xec\x1c\xd8\xe4\xdd\xf2\xda,\xb2\xdd_8c\x8c\x94f\v\xe1R\x9b\xfa\xbel)\u022b\xf6\r\x8c\xa4)}kz\r+R\x8d\xa3=\xc01?u\xe9\x7fi0\aR\xd3>\xb7\xbd>\x88\x1e>\xd4\u042a8\x15\x1f\xfbW\xe5S\xcc2\xe0j~\xc5R\x10\x12\xfc\xfd,\x87\xa2l\xb4'\xff\x97W\xe7+8&\x1e\x87\xcf3\t\xaaUpM\xb2\xee\x9c\xf4\xc0\x10\xbe\xcaiY\x95k\xe2\x8au3-M=\x1dM\x7f\x0e\u0299\xa8\nt\\\xc6BI\x87K\xb9\v37\xab\xb2Q\x85\xc1/c\xa4x\xfd\xe9L/E\x02zS\x8d\t\xf4\xba\x14\x11\u02b9\xacp]W\u7cca3Q\r\xf6\x97\xf0Z0\v\xebf\u0357sZ\x85\xf9^\x81\u05ea\xbb\x89w3o\x19-3\xf3\xde\xd4\xeb[\xc4\xc2\"\x04\xab\xd0\xf8\xdbse\u523f\x88'+\xcc\xdbR\xae\xacn\xd82\xae\xaa\x183l\xddg\u02e4\x1f\xe6a\xe5\xd4\x11\xdf\xd6(MW\xe6\xdb\xdf}\xb8B\xb5\xdf?\x99\x15\u0795\xb6\xbf;\xa5\x94B\x83i|e\x8d\xbe\xc9\xd5\xfa\nM\xa0l\x82'm\u0683\v\x8e\xa9z\xd2\xe9\x80l\xdd\xd0\xe4)\x1ef\u05e11\xc9\x14\xef\x14\x90\x11\u00dc\xcc\xf6\u8db9\xa2\xbe\xe1Z\x11^sN\xd1>.\xb3\xc6\x1f\x11\xd9\x15p\xfa\x85\x04\x15\xfd\x949A\x92\x8a\xf6Y=\xbd\xf6\x8d\ud405\x80\x13D\x91\xecygcJ\x84>\x9a\x06\x02\x03(yr\xfc\x9a\xb6\x0f\xd9T4\x87\xae\x8c\xbc\xc1\xdfh\r\xe5\u929fE\xa8\xcac?\b\xcbpS\xc3l\x02\x1aa\x92\x10\u048c\u0455\x81\u0601\xb9\u0525-/\x7f\x80\x15\x19D;M(g\xb5\xcc|\xa3fz\x1c\x90H;\x05?\xf9\x06F|\xcd\x00e\xe8\x92\xc1\x14\xe2#Ds+\xf3\xe9\xd0Oa\x8a\x0f0eB\x16[\xd4\xe2\x1d\xa0*\x11\v \xfaR\xab.\xb7\f\x8eyc\xfa\xcf\xd5#\xca!bc\x96\xfb\xfc\xcc)\rXSN\xe9q\x13\xfb\xd3\xd4\r\xaa\x03\xcc\x14\xfa\x80\xa7\x91|\xb7'\xd5 \xfd\xa4\x9f\xd3o\xfb\x12\ay\x80\xa0\xdd\xc1f\u057fzp?\xffLJj)\x93\xd2H>X\xd3K{`r\x8e\xd9i\u1368\xe8\x8fn\xd0lk\xe8^+\"\xfd=\u7f95\x92*c^jg\u075b$E7\xb3\xb1X\x03~\xd03'F29\xb0Mx[\x93\xb4(\xb12\x1a\xd0\x1a\xb5+i\xc5k\u993f\x86\xc6Wk\xd9\xc7\u06be\xbb\x95\x7fG\xb7\xfc\x86u\xcb'\x19\xd2\x1d\xa0\fx\x7fC\x99~H\xc2\x1bE\xa6:\xd1\x02\xb2\xa9\u00dc]\xf9\x8d\xb9\xbf\xa7\xf1cq\x83\x90\xcf\xc6W\u0647z\xe3\xa9\xe7\xeb\xf2Tu\xc8n\xc9\x14J~e\xaf<\x18U]Cz\x8f\xe9\xd8\b7\xe9\r\xe5e\x84\x19j\x9a*h\xf7\x8a\xb6\x03\x11\x1a~\x9a\x8b\x16NS<\x15\xa9\xd4\x01\xeb\xcbe\b\x9aQf\xb7\xde\x048\xd4h\x11%o\x19\x93\u0703\xa8v5L>[\xb3\xa82ti\xa1\xa5M\xa7\x85w\x95\xc6\xe8\x93Q\u056c;\x9b7\u0cc6\a'\x1b?\x87\xdd[>\xd7r\x8f\xb2\xef\u04b1\xe6\xc0\"\xb5\x80\xd0\xd5ko\xc7l]i\xda#\\\xa4\x89\u0647\u04d41\xa9\x04\xa8\x7f\xcbFW\xf5h\u0147\x97}x\x9eM9\xd3r\x9a7\x81j^\xcf\x01\xb6%\xa23JG\x85W8bW\xc4\xe9\xcc't\xe4\xe53\fA\x99\xb3L\xfe\xac6\x12\xfb#c\xc7\u0277\x89~\xfe)\xbc14\xc7\r\xec\x93\xcb\xf8rH)\ng\xbcj\xf9$\x89?\xba\v\"x\x82\xcb\xcb42_i\xa7\x05,Jq\x1f\xf3\xae\x8dx\x058\x1d\xf5b\xc0X\xeeC\x91\xf3\xa9\"\x1fp8\xbc\xf0\x9e\xf2*\x7f\x15\xfa|\b\xf0g\x01\x10r\xa3PM\t%lI\xd2%\xb1\xb6\x99d\xf9L`\xd7\x05K~B\u00b3\xef\xa8\r\xe0Q<\xbd\xfe\xb4\x1f]\xfc$-\xa15\xed~u\xdb\xdd/\xef\xbf45r\xd3ypQ]\xfe\xbd\xcf\x04\x1b|\x1c\xc1\xa6\xf3\xb0q\xf9\xb2T/\xf6\x19\xa5\xe6\xf3x\x19\"8\xca\xf6~5\x12^ \x90EL\xe0[;\xa0~\xbd>\u0791?G\xdfj<)\xea\xb6\xdc\xd0<r\xf6Z4@\xbd\x1c>u\x85U\xb8P\t\xa4c\x1f\xf2~d!*kd4\x93f\xb36`\xc1\xb3\xe9~p\x04c\x0fO\xfd\"\xf5\x86\xaa\xee\xac\xe2*\xab\x1f\xfaE\xbc\uab3c\xab\xacz\xe4^{\u056e2\xb6\xc0*\xef-\xbf+T8\x8dG\xe9\xf0\xae\xaa\n\xbf\r\u0196'o\xdf<\xdfwk\x05\xbf\xea\xb5\xf5ZC\x89\x1f_\xde\xdb\x1f\xc6\xecL\xed?\x1fi\u07e2\xc5\t]\x9b\x8aB\x95.D\x91\x10\xce\xc8\xf0\u0631Uh\x83\x95M-kZ\x8d\xd0G\b\xe1\x88AV\xd1\x1b{\xed\xea\xed\x9f,\x17&w)6s/\v\xb0\xf9\x8a:\xe0\x94\x80\xb3\n\x9f\xb5\x98\x12\xbf\x04a\xa8\x11\x1c2EVK\x15nM\x13T\x7f\x1d\u0764C\x9eMU\u0311,\x99\x023\xbc_H\x1f\x8eJ\x86\x1a\x10\b\xe0\xe5\xefM\x0f\u0516\xd5\xc0\xc7\u031b\x00\xe1\fg4 \x81b\x03@f5xV\x9c\xa0\xd9L\xbdf@\xf6\xb9\x985\xe6\x05\x96j>i\xd5\x1an\x82\xcb\u027f\xa6$B\xd1]\x97\xf6\xe9\xef\x97@/f\x18\xac\xb7\xcfD\x0e\xd0\bd|\x16\xe4\xb4\u0327}\xd3%\x14;\x12q\x8a\x12\xe3,64\xb5\xae\t\v\xc9\xe9\ri\xa6\x02\xfc#_\xdcdx%\a\xe0S\u07ca\x7f2\x93\xe9\x15\xce\xe8\at\xd0\xd2&\xfd\xf8\x16%!\x04a\u0104\xc0c[\xbf\xba\xc0\xf2\xef\x9f>\xf0\x8c\xab\x14\xe8\xa7\xda\xe2#\xec\x16\xb9\x10\x04;\xc5i\x87\xca6\x8a\xe1\u914fKx\xc1Y\x9e\x8a\x87xut\x17}J\xf3\xf4r(v\\>\xe7&\xfd\xb8\x81r\xc9\xd4\xdae\xd6:\xdb\x13\xe4M\x8d\x8dP\xfaI\xac\x0fJ\x8c[\xebV\xdar\xd6!\xe6\x8a\x16'\xb7F?\xe0\xc4\xd9\xded{[nOZ\xa2\x12\xfc\v\x8al\xee\xba\"CNu_\x97\xc6\xe5\x0en-\x12'\xebuvv'\xb3\x99l\xa2\v\n\xec5k\x04@E\xcdP\x8c\xdd\xddAH\xde\u035b\x0f\xb6\xac\x9dpS\xd8\x13\xf4\xac-N\x9f\xec\xcaNX\xac\xad\u05e0\x1b<\u0476\xb4\xb0\xfe\xfd<'\a-\u8ab1\"2i\xa0a\v]R\x96\xdc\xe4\xa9\xd3Y\xd5DV\xd8\u01d07\xde\v\x94\x1c\u0598\x8d\xa5\u02a2\xa3U%`J\xf6\xa3N\xfb\xdf\xf43\x9c\xd0\xfdh\xd3{F\x93\xb9\x1f\xed\xf9%y\xe2\xf6\xa3]\xff1L\u051ay\xd5\r^\u015f\xd7*j]f\x9f\xd7\xf2\x9b\x18\xf8\xc3\xfd\xa8\r\xffu'\x9f\x9d\xb6n1\xfb\x80J:\x1f\xd4\x14\xb0t\xff\xbe 0\x01q:x*d\x0e\xb7\x18)w\x95\xdd\xe2KJ`i\x15\x16\xfa\xb4\u015c\x9c\x98\x0eZ\xbf7\x9e\xa0\xb4i$\xd1r\xcbz\x16\xc8\xe3\x150$\x92\xb2\x95\b\xa2\x91\x00\x17\xfd\xa9\xd6h\xd6$\xff\xf2\x9a0\xe1\\d\rN\x1e\xbf\x98Y\x17\x9c1o\x9f\xfb\xb3\x8b\xf3k\x190\x80I\x9c\xd6\xd7-\x14\x80ZX\xbf\xc0\xe8\x15\xeb#\x1f\xb6\x96\x13\u71b4\xa8\xe4\xe5\x95piU]t\x9c\x9a\u0335\u06cf\xa4\x82\x1b0\xbf\xc03\xd2\x10z\x8d\xeb'\\\xd6J\xeb\xc7e\xf1\xa6\xa57\x93D\xa7\xf5\xda\x14\b1j\x9f\xf9eX\xb4z\xa9G1\xbat\xad\xd1\xde]\xdb\b\a-o\xa7\xbc\x98\x85\xd7\xcc \xefG\x93\x8ct\xb7O\x83f\xd12\xf4\x88\xf1D\xdc-\xe3\xeeU\xcd+\x12\x0f\x06'(\xaf>\x17\u027b^#\x0e\xb4\xd6\xf4\xf8'\xc3B\xfa\xbc\xab\xc2e=\xb9\f\xb9\xe1\x1d5r\xe6\x1f\x84*\xb5\xaa\xd9\xe6\x1251v\xa4\x03?\x1b\x0fY<S\u068eP\x98\x95\xa2\x95\xa4\xb7j_\x11q\x05\xa4+\xa1\x92\xe4\xb6\xec\x01\xf7\x96\x1d\xb8\x183W \xa3.(\x97\xc4#\u031d\x8d\x85\xa7\xf3$8+\xf4\xf4qu\u015d\xe1)\ub570\xf5V\xba\xc9\xf8\x98\u0731\xf3\xc3?\xcfe\x063$\x7f0\x03\x83//\u227e\xdc0\xaf\x8c\xf6\u03b0\x9f\xa8r\xa7t\x99\xd9\x18\x8a<fU\rg\\e/U|\xf3\xc39\xbc\x83v\xd1iU\xa4\xae8\u03f3>z@\xb2\u065e\xa7sW\xeau\x16\x02\x12\xba\xb6\u060f.\xfe\xef\xf9\u025b\x17\xef\u0467\xc0z{\xd3X?\xcd`-\xca/=}E~\u0404\ua1b9\x1f\x87\x19\xb7\xeb\xabXd;\xfe\x12\u5e8b+\xe8\xae\n>\xcd\xf8\xf2g2M$\u009dG\\=M\xbb\xabl};\x12\xf4\xf5s\xee_\xfdx2cOb\xd373\xd1p\x96Z\xe0\xe6\x9d\xecy\xa7'W\r`-\xb3\x869\x87\xees\xb9\xd4i2\xad\xf26\x05\x1aN\xc8d\x14\xb39\x1c\xe2\xf1'\\1\x04\x97g\xac\x14f\xd4CGw\xbc\xa4$\xafgI\x1b\x8d\u04a4G\n\x9b|\x81#A\xd1\x06\xb6\xe3\xa6?\x1fl\x92\x9b(\xba\xa8\x91=s6\x9f9\xcay\x8aO^\xcdg\x9aH\xbdo\xda\n0~\xe0'\u01ae<,\xda1<\xa8.\x8e\x17\xb9\xb9W\xfe5>\xa9\xae0\x9fx\xa5\xdfN*\x8a\xe29\xf1l<\u045d?7\x8f\xbc*P\x83\x85\x1c\xdag\x91\bt\xc6\xff\nZ\x04\x89zBL\x11\xa0\xa2[g\u061d\xa2\xc6,\u0779\x86~\x9b\x1a\xd8 \xde\x03\x96\xd79\x94\xb7\xaa\x96\xed\r\xf2\xcc\xfb\xd1q\x9aS\xdcH4\xe9\xea\rg\xdfMa\r\x87\xb4kF\xf3\xf1\xb5\xf1\\~\x1c\xf5g\xd3\xe1Z<\x84\x83\xb5GYt\xa3#x\xf0\x04j\x80\xf8\x19\x8fs\xae+e\x91\x8f\xf6\u0292\xa4R^\x96H\xa6W\x98\tnii;O1>{\x81d\xd48b\xfbc{vE'G\x13\xa4\xec\x14\xfa\xf2\f\xa8\xe9T\xae=\xaf(\xda\xc9\r]\xbc\x1a\xb5\x83qa\xa2\xa4\xd8\xe4\xd1\u04f2p\x88\x13nR\xb1\x8f\x96\xd4\x11\xa4K\u04ab[\x1b<\f{\x12t3\xc7\u05b9q\xf6\xff:\x90\u0ea5}\xbdA\u03ee\x84\x8c\x8c\x87C\x1bK\u04fbV\xce)\xbc\xc2%:wc\x94\x17\x04o\xab14\xaak\xae{\xa2\x1f\u03b1\xd3x\u07a0;\x88\x19\r\xdf\xdf\xd8\xe6r\xd2\xd5BQ*\u01f6C\b\xca\a/m\xe7\xc1\x10\xf15\x1e\x01\x1c\xf8A%\x16V#<#Q\x1b _\x02\xd9h\x8a+\x13\xc9\n\xe8f\x1f\xcd'\xeb\xf4\x89;<\x80\x8e\u03d7A\xb7\xf3\x87\x18\xb9\xf6z8\xcf\xd7_\xa4c\xf8\xfb\xc7d\x9a\x99i\xcc)\x8aKaU\xa9\n\xe3\xc8\u008aR\x92^\xcb|\xfd\xe9C\x93\xa1\xb9f\xa9\xde \xb3\xf1\x1c\xfd\xb1\xe0\x0e\xc2b\x04\x04\x8b\xfe\x11\xe3\u0294a\x04m\xad#\x0e\u4493[\x1b\x8dO\xda=B\x84Cd\xc37\u03b5K\xaa\xd1`\xa0rYa\x06\xe3\xc0\xaa\xca^/\x8f\xc8[\xb4t\xb2\xa9\x8d\x1fx\x8f\x14\xbb\xf6\xc3\n]\xfb\xa1\xb40\x83q`\xab\xba\xf6\x83\xd9G%};\xa1\xb00\xeb\x03C\xd1&\x93\xa1\t\xe9\x82\aB<`x\x86\x16\xa7\xb9X\"\x88\xf1t|\ag\xea(\x01\x16\x8a6:\x1d\x9f\xb4\xbf\ud173\xe2\x1e<b\xe4\x1a\xfa\x03\xb5\xb3R\xf7\x88UR]\xb4\u01b7\x83di?\xa5\xecWw\x93/\x03\x96l'\"\x8c\xc8\x1bPT)\x89\x13C\x94\xe5\xf0,\xaa\xd7~\xfc\xdc\xde\u017b\xaa\x8fq\xf4\xa7\xef1v\xd3+c\x02\xc6p\xfc\xeax\xdci\x10P}\xe7\xaa\x16\xf4\xd0\x16\xa7\u06e3C[\xb9\xb4\x9f\x1cS\rH\x16\x87t\"\x15(\x92\x14\xbc\x82]F\x97\xad\x99\xf2\x89\x01\x00\xc7\xc8|v\xb5\xb6\x1b\x9c#h\xbchS\xaf\x93G!\x00\xa7\xb1\x10\x0e\xc7h\x9bM\xf5\x93\x1c\x18\xb9\x04md`\xf3\a\xada%\x1a\xd1\t\x17*\xdb\xf2\xba!,\xbf\xf6\x03\a\x0e0&\xe3Y\xd90\xf0\xe5\v(\xfcC9\x151\x04\xcc(\x9a\xe1\u0424\xbe\x93u9\xb2e\u0786\x90!\xb4\xf8\x7f\xa2\x9f\x1fG'gG\x14\x80)\xfd,[\x99#k\xb7L\xb9\xde`\x10u\xba\xbbf\xb2\xe7c:5\xa0\xcb.&l\x8c\x16t\xd1g\x89\x06F0\xe4\xc0]\x83\xee\x00\x8cwq:\xb3\xaa#\u00fb\tCK\xe7\\\x82\x11q\xc4\x00\u061c\xd5\xe8wm\xc0\xf9\xff\xab\u04de\xb9%\xc7\xc7\xdbl\xfa\x11xa8;`\x8b\x818;\xa30\xc7\x12\bF\x81+\x05\x84\xfe\xd1\\>\xb6\u0795\xb1\xcb\xd3@A\xd6b\xf2\xb8D\xc7\xe7>\x9c\xb1\x8dp\xe7\x8a3&G\xbd\x1a\xa1\xcd\xfc4gV\x19+B\x01 \aP\xa0/\u06d7\xf0\xab\x0e\xaf\x9e\xd1\xc2Fi\u03b0\x98\x1c6\nL\x10\xa1\xd5;\x9c\x1a@`^\xc0%\x18l\x90\x00\u01913\xbfcp\xba\xa9\x9d\x87'\xd3l0\xa7\b\xe2\xb4\xdc\xc2\x03z\xc1\xc4\xed8\xd1p\x14\x96\x9f\xa3r5\r\x8bA\xc1\xd5\xf8\t\x8a*\xf8 \x9e\xcf2\x0e\x7f\xe2\xac}\u035a\x14\x19<\x99\x82%DjJf\x96\x99\x84U\x89\x8eO\x9e\xd3\xf0D\x86\xb2\x81\xeehv\x01\xe8\x9a#I\xd9X\xf6\t\a\xf6\x00Y\xfe\x93\x18\x17\xc5\x04\xdc\xc2\"t\xd4#v\xda9`Z\xc5b\x0fC\xab`\b\xbci\x8a\xeb\x8d\x11\x8a\x1c\xe0f\xd02\xde\u0660\x8eB\xf8,\xe8=4\x05[\x0eK\xa3w/\u07f5]&d\nw\xe7\xc4W6\xf4 S[[\xe4j:\a\x9e\x94\xa5\xed\u0204\xf6K\u047c#\x1dM\xb2\x9c\xae5h~2\xa6+\xb6\x17-\x9aD\xf1'\x96\xc5\xcbYJ\xc6\xfd.\xcc\xcd-\xbd\xa7\x19A\x17U\xdc\u5e19\xfc\x19\xe2\xfdZ\x9c\xe2};\xc7\xde\xe3&B\x15>5\xf1\x90\xf2:#&\xb0\xc9\f*\xda3\u0166\rf\xbc\xf5\x18\xc5!\xc7,2o'\xbc!\xa3\xee\x00q#\xf5\xc2\xcdl6\xc9\xf7\xd7\xd7\xfb\xd3\xcb\xf95fxY\xef\xeclnv\xdaQ\x11\xe1\xec\x81\u00d8\xb7\xe4\xfcy+t\xf9c\x92L`6\u043aILC\x8d\x88\x87\x83\xa6\xb3bF\u182cG\xd18A\xd7jJ\xfb\x92M\xdda\xb9\xa8\a.\x04\x1e3\xd1D\x16\r\u0174\xc2\x10\xc3re\xc9\u0713\xedLct\xf8\x01\xa4cdb\xf2\x87nN\xe6~\x05\u0351\xa6l76P\xe6[\x8f\xa3G\x18\xd0\x0fK<B\x9a\x00\x04qvg\xc6i\xf7Yq*\x8d\xb8\x9d\fl\x1c\xe9\x12~\xddn\xbcQ2Hcfg\x8cd\xc5\x1bD\xba\x92N\xa3S\x9aJT/|\x8a\x87\xb6\xcd\xe8\xa4u\u074a\x1e\xe1D=*\xa9z\xdaiif\x9f\xdb\x13\xe3W2F2R]\xe1\u0106\xfe\xa0\xdc\u045b&\xa7\xf8Y\x8e\x02\xdfgC1r\x819\xffD!\x10,\xbd\xbf\x8a<\xf2L$\xff\xf8\xe4\xe8\xec\xe4<\xa2<\xea\xecY\x06H\xfa\x8eB\xbd!8x\xfd\xe6\xcc\x7f\xdd\xf4\xa1XVp@\xac\x95\xf5\v`\xb5\x0e\xad\xb4\xc8\xf6s\xd2\xd6d\xf3\x02\xcb \x1d\xed)\xb0\xbe6\xc9\xf2WH\xd1\x00uG\x93\xc2z\xc3$S|Of\"\x9aF\xf1'\xa7%Y\xb3\x8f\xb3\xdbzCN\r\f\x06\xd2$l\x05\x81>geW\x8a\xea\x92\b\x15\r\xe3\xfe\x1d\xe0)\x1a\x87%l\rgX\t+\xf4>{\x15]\xde1\xac D\xa0\xb67P\x9a\u0222R\x85tU4\xa2\x12\x03\xd33\x89\xb3O\xe3\xa1x\x19\xcc[\x1f\x918Lq\"\xadnn\x18\xdf\xf1\xa4\x16\u0507\xf8\xa5\xd7\xd7\x11\x12\x1c'\x86*\a\x9cy\xe8\u0131\xe1#\x90\xaf\x99e\x93\u05f0\xa9\xe2k\x1dx\x92\u0554\x8a\xfd\x11q\x92a%\x9e\\t\xd4{ytb\xcdj\xe4^\x00\xa4\x98z\x8d\xdf\xd4\x1a\u0340iF\xf2n\xb8\x1a\x1d5\xc2Y\xae\xf7\xbd \x98\u0221\x91\xe6\x80\xc2O\xb1\xf2\x99a\x998Q\xa6\x86\xe8\x16\x03M\x89u\xa9 \xd5\n:\n\x92\xf4C\xfc\x86\x05\xa5s\xd5T(V\xbc>\xa0\u02d2 %\xc8K\xe8j!t\x94\xbb\x927\x83h\xae\bTF-QI\xb0\xe7\xb6\xe3d%[\x97\xd3\xf2\xaea\x8f,\u0392\x90\xce<6y\u035c\x9b\x02\xc40\x7f\x1cHY\xe2q\x1c\x9d=kJD$yk\x06\x16\x93\x83\x9e9\xad\xd1\x14%3n\xa8\xdex\\0\x15\xe4\xd2\x00\x11\xfb\xd3\xf4\x92Got\xe5\xc6\xf6\x9cc\x94\x1ap&\v\f\xbez\xf4\xfah\ud32e\x14N\x8d5\an\x92G\x18\x8eG\f\xa2J\x06f4O\"+\xe0\x89l\x17\x17\x9fU,\xa9\v\x16k;cj\u0341 O\u0246\xd9D\xf9\x93\x0e:q\x01\xd5T1E\xbd\x13\x7f\n\vd{3\xaas\x92\x9c\u06bf\xd7\x1a\x04so\xcb>\xfa\x00(\xce\xec\u00a2\x86,\xb0B\x83#R\xe9@\x1b\u012c\x8fg\xe6\xccD\xb3\xd9<\xaa\xfd\xe9\xdfkV`m\xb7kN9\x86\xb7^\x7f\xfa\xe0^v@\x9a\x05\xd1\x03\x0351C\x828z\x93^3\xdf\r\xbf\xdbP\x04\x1b\xc1,%\x8e\x19p\xebF+\x89n&nFy\x88\x14\x0f\u0653,\xdcR)\x91\xee\xde\xcbD\xb3\xe6\xb5\u03d1\x97\r\x17\xa3\u04fa\x99I\x9bO\xf0\xae\n\xe4\xbd\"\xe6\x8cX^q\xfd\x004\xbaJ\xaf\xe7S>\x8as\x91'YHi\u0494]\u05bc\xfdn\xfb\"\x11g\x8b;\xd5\x11\xafDi7\x8eON{o\x9f\x9f\x97QAy\x15\x92\xc1#\xf6M\xf6\x83\xf1fhj\x83G&\u01656g\x81w\xf09\x11i\xc8\xe7\xbcRu\x88X:H\x88\xe0\xa0\x0f\x9d:{_\xf7\xce\xce\xca\xfa\x87\xcf\xc3\u0389\xb2\xda!\x04\x87\xcfB\xc6\u032d\x89;\x92\x8f\xe2I\u04c9S\t\xeb\x9ca\x97\xb7\x9c\x9a\x04\xfbo&Z\x0em\xa6\xa2r\x8b\xc2\xf7BI\xcb?\xa2\xea\rSI\x88\xb41.\xb3\v\xffl&|\xca\xd5|(\x8e\xfcB\xbe\x06F\u01a4\x18\xbb\xccn\x02\xb7\x89\x1c\xe1\x18\x83\xd9\x0e\xef\xe8\xb2r\x92\xbb\xcdi\t\x1fg\u0593\xbe\x98%pA\xc6@\u0200\t\xe4\b\x9ar@|4\xa3\u0169>;\x7f\xf3\xecu\xd9\\\u04cbZC\x9f\xfc\xa4\xfeI\x9c\xff_\xdcGO\\\x05\xb9\x86h\xbbf\xd4L:\x14u)\v\xa0<\x1d\x19rY\x9a\x15g\xc1V\xd4BY5\x94\x97\xaa\u01bb_l}\x9a\t\xf4\xb7\u79fb\x04\xf6\xa9\x9fO\xc1\xb7N\xa5\xfb\u0164p\xbb\xa8\x0fXuU*\u05d4\x9e\x9b\x9a\x93\r\x95n12\x90-D\x14\xb3\xfb|g,\xa1\xae\x8d\xdb\x17\xc5J0\xf7\x1a$\xa1\xb9\xb38\x9d\x86\xaa\x15Ll:\xbf\x14\xb1U\"\xd2q\xaf\xec=\xf0k\x00J\xeb\u016a\x05\x177\x0f~\xd8\xdbJ\xaf\xbf\xf6b\xb4,\xf0\x9c\u072a~\xb1\x80\xbc\v\xdb\x1b4u2\xb3vc\xc2\xfd\xf6e\xf4\x18\xe6\xd7\xf8r\x1a=\x87V\xf1.\xbaqV\xf8\"}.\xbb\x8b\x96\x8e8\xe41=;8(\xbf\x1cn<\b\f\x83u%c+Y^\x89-N\xfc\xbePt\xd0Fe. \xff\x9a\xd7f`I]\xe2\x152\xf9\x12\u03e0\x83\xa0\xfcE\xfa\xde\x05\x11\xf6FJiF\x04\x1b\v\x867R\xff\xa2\xfd\xbei@cP\xe2\u04a8\xa7\xa5\xc3m\x95\xdca/\x81jLt\xaa.\u4973~2(\xc1\x04\x7f\xf7\x19\xe4\xf1v\x19!/L\xbb(km<[\f\xaf\x91Q,6\xa5\xd72\xe18\x96`\x95\xdd\vex\xa5\xcc\xda+V\xbc\u8f23\ueea5+f\f\xef\u022e\x812\x03\xf6g\x9c!\x8d<\x96DK\u00bei\t\x8a\xe1\xa8\u00fa\xc5\xdb>#7\xbe\x88\xfb\x86\x97E\u058d<Z\xe9\xc4\xf0\x1dh1\x920\xab\xdd\xf3\xbb1\x14\x9e\xc9E\r\xc9\x19\xa4\x03d\x01\x7f\u025c\xe8\xeb\xfa\x12\xaf@2\x1c\x17G\xaep\x1f\x89\xa7`>\x19b\x94\xf5Z\xa3\x05\xfb\xe1$\xee\xdf\xd4}\x02\xed\u02e2\xd6\"\xc0\x16hTL\xadQ\x9a\xa8\x99]8\x0ek\xd3P2\f\x93\x8e\xeb\xe9\x83\n)8i\xa1\xca\xf2\f\xe5{k\u038b\bv\x10\xb1\xabk\vO\xda#\xc9\x15TOZ\u0130:\xd3\xe3\xec6\x99\xfe\x81\x8a\xe3\xe1;\u02de\u30e3\xd8\u0124\xc3Y\x84Jxc\x87\xa5~\xfe\x19\xdaC\x06\x11~4\x90\x04\xd5\x1d\x008\xf2\xfa5,\xe1=\xfaTk(\xeb\xd3Wc\x0e\u061a8}lTG\\\u00df\xc8p6dc\u045d\t\x86\xdfd\xed\x18F\x81Xw\xf7\xf9\b\xeayBy/<+\x00#\ub683\xc8\xec\xbd\xcb\xe4&\xfe\x94f\xd3V\x99Q8\x11,\xd1uY\xaa\xea\xab\xe4a\x1c\ua8a3\x86\xa5\x12\x9b\x7f\x89\x12S\xea\u0220\x94n\xf3\x1a\x06\xc5\u02b9\x84\x02\u842a\x14\x7f'\x9f'\x126<\xa0\x0e\xa2\u024a\xc7\x06\x90\xbe\x91\xa0\xcd\x06\xc3\x1d\xa4\x03\xbc\r\x81=\x87\xe1\xe4I\\\x02\xc0\x1c\xd5\xf52\xe1\xa8\x1b\xa8\x88\x93T\xb1\x16\xd4\xd8\xe4\u0688\x9e\xbd8\x91\u0235&l\x10\u0666q\x0fi6\x8dF\x8a.z\u0586)kk\x11\x8c?\x8f\xeb\xeb\x0fl\xc0l\x15\xe8\x88FM\xd7$t+a\xe2g\xa2<v7\xc1\f\x95\x14\r\x15(\x88\xba\xc6\xe1\xe3\u0600\xa3\xd42z\x01\xf0R\x82L\x8f\xed\xdd\b2\x175\xba\u04689s\xe4\xfeM%\u058b\x16H\xa5\xc4z\xe88\xec\x86\r\xc4M!\u048b\xbb \x8a\x84\t\x84\x97*\xedV\x1b\xadyA\x86\xa2}\xa7\x129+\xdc\xf8\xe6 \xda\xe8Z\u03c5\x1b\u06af\u6947\x81\xfd\x1bup\x97S\xa0z\xd9\u0420^ChZ\xc8\xf5?\xa5\xa7\x81n*\xf0yz\xcdu\xec\x8e\xf1Tg\x98\x7f\x96\u0305\x8c\xd4h\x9d<\u9838\xa1dy\x98;\xd6\u0613\x89b\xd6E#\x8ej\x18&\xde\x04\xbf\x84\xc3H\x02d\x19\xf7\xa3\x93\xbc\x8fi@\x98\xab\x94|\x1c\xd82\xc5.14\x81^\xe2\x0f\x10Z\x99\xa26\x1f\x88\xb0\x86\x97\x9a,\"cPX\x14a\xe8\x94\xc6\xce\xc0A\xe4\x1a4=\u00e3\u01e4\xa4XL\x95e2\xb9^o2y\x99\x8d\xd1\xf6\x81L\x1fd\x86+O\x1d?\xd0<\xba\x7fyO(\x94~\xe9S\x99\xa9F@\xa6\x04]\x15\x11. o\xd9\xea\xe32/8u\xac\xa5^\xc90\xaa\xd4\xffK@\xb2\xb9]\x15\xbcR\xf5\xad%\xc0\xb2C\x91\x9avv\xd5^\b{Q\xf2\xf0\xb7\xd1\xff\xd4;\xd1\xef~\x87`\xcc-\a\xe6Fo4\xca\xe1ww\x14\xfcU\x16\xba\x9eT\x9f\xf4(w\xdf\xe3\xa0'c\xc7\n\xc4\xf9E\x93\xf0s\xf47\x98\x83\x15y\x10\fs\x8c\xf6@0lR\xbc\xc2\xc6\x1ck\x85\x82(W\u3232\xc5)\xf5\x02\xea\xd2(\xf2\u02585\xc3\x0fl\x88v\x8c4<\xfc\x84\xd0l\xe8\x01\xda\x16!s\"\xe7x\u0228\x189\xc4NA:\u0586\x9a-\xea\x88\xd1\xfa\xdb\xe2\x0f=\xcbL\x10vr\xb1\xc3T'\x8a\x16\x8e\x14\x94\xe8\xa0\x12\xfe\x85\xadl|\xe707\x86\u05a8\x87\xc6@\x8eEl\xd9\xf3\xcbk\xeb\xe0 \xaa\xbc\xc4h\x89\xee\xac\xc4\u0474\xea\u052887\x96\x9dO\xaaK\xd5\xfew0\xbc\xe3\xe4*\x98\x1e~\xe8\u03cc,0\xbf\n\x9d\xffn\xe3\xe9\xb8^{\x89\xe6\x02W\x94WIn:\xa4:\xfb\u0284\xc7~\xd0\x1b\xb1\xb76I\xefDk\xc1v\xdd\u05d9(\x8f\xe6|K\x83=g\x14L\x06<B?3]\x89\x8f\xa3\xf2\xbc$\x97v\xeb\u07aaxE\x93\xa5\xd6)\u0642P8\xf2p\xccae\x8c\xb2\xd8*Qc\x03\xc8\xe5\xc1Bo\x0f\x8a^\x9f\xce\n5\x06\xa8\xf4\xb2\x91\xd8=\x95l\xd3@\x92Q\x9a\xbby\u0492\xb6\x8c\x8bg\xd9\x04@\u05d4KQl\xb0\x9f\xd7\u0378\x88\u06a4QP\xc9\xcd52\u05a6\xe7\u0583\xdcB\xe0/d\xeevW'\xbfS\u0196ft\x01\xd2'\xc3\x7fo\u0719\x10x\xecv\x83\xe0<r\xea\xe4\xd4\xfa\u0425g*\xb4\xe3V\xc7\x16\xf1}Z\xb9\xa4\xc6\x1bw; v\x15\xa4\x81\x9eb8\x8f5\x89\x8dV\xafA?j\x8d\b\xaf\xda1k\x13\x9b\\\x00Q\xa4\xf7\x98A\x81\x8d\x06\x98\xbe\xe5\xacr\x9b\u0154\xaa\x01u\xba\xe8\xff':(\x94\x16\xe6i~\x83\xec\u0375\xd3\xebKy&\x11\xf4\x8a\xc1\xe1\xfcb\xc2!hw\xe8\xc533\x1c\xfa,3^8. \xdc\xe5\x1d\xa7\x96\xa3E\xe4;\xc7h\x11Q\xe1\"F\x8c4\u04fd\x02\x192UPc\xbe\xb0<\x160\x85I\u5ef04\x95\xf0\xfcY\xa7\x14\xc4\xd3\x1e\x0f\x06\x14JU\a\xa1m\u04b7b\xec\xb4oO\x10S|\u0126K\x85\xf2\xf5\x8a\xa3f\xdf\xfd\xb0\xbdIsG\xdd\xcd\xc6h\xa9\x87T\xd0D1\xf2\xcd\xe2\xfd@F\xc6v_\xe2\x05I\xae%\v\x1bS\x1a\xc9\xc0\xe1+\x94\xf3\xb2\x1a\x99\xcak\xee\n\x89\xed\xf2\xa91N2\xd0\x1f&\x98\x1f`>\xf3\xee\x0f\xe5\xae\xccI\xa5F\xc5\xcf\x06\v\xb7h\xf5G7C\x89\xbdprg,\x11\xb7\x81e\x92Z.\x1a\x8f\xac\x90MaA\x9b\x92VG=\xfa\xf2@\xa5gVSa\xdd\r\xaa\xe7\"\xd0\xe6X\x05n\xc8<v\x1b*m\xdd/\xec\x96\xf1\x98\xf8\xe5\xbd\xea\xfc\xd2^\xa93\xd7\x100#k28\x03\xbf\x8c\x10J\x91\x9a\u03a4E$\xd6!UY5\x1cyX\x05w\u00e2:\xf8\xbeV\xcc\u0635\x98<;R\f'\x1c\xec\xb88\xffx&\x02\x11\xa7\xc0\x80\x83\xb5.\x99\x1d-\x80\x06jP\x18\xe7\x89\xee\x91[\x04\u07fa>\x10\xdc\xe6(\x02x}4\x1f\xcfD\x18\x1546\\*\xa1\xbc\xb5\xa3\x16E)j^(B\xd8\xdd\x039\x8f\xa7\xe4*\xed\x92MZG1R\x8d\x90\x01\x04\x02W\x8e\v\xe7\xf1\xa5\u1055\x855\xc3{tt\xf6,\xfa\xa3\xe4\x16\xa3\x1f\x9d\xe8i\u0505G\x86f\xf3h\x0eP4\xf4f\x83tUFX\xd4\x1aB\x12\\L\n\x10\xcb7Y\x9e\x89\x19\x02\xaa\xb8\xaf 4\xb17\u0609\xff\xb2\x8d\xfe\x97X\f\xa2=\x1boo$5\xfb\x06k\x19\x109\x06\xc1\x1f\xfe\x85k\xbeO\x7f9\xef\x85\xf4J8mCo-\u334e\xd4\xc2xK\u01ddT#\x85\x14Su\xe4\x111{\x1dy\x99\xe2\xbdO\xc6*k\u02a52\xa5\xc0X\xe8\x1e\x95x6\x1e\x8e\xa9\x9a:\x7fw3\xbfn/\xf2\xf6\x1by\xb6\xad\x95l\x92\x9f\x1c\xd2\"\xb7\xf4\xbe\xa5v\xe8W3J\xa8?\xa9\xb3y\xa9Gc\x9a\x91\x9b4\xa5q\xc2\uebec\xeet\xfd0\u0484\x9b\xefwb\x05\ud677y\x10\xd8P\xb4\xda8\xdc*u\x9f\x8d\ud6e6o$\xce\x1b\x82B]\x9a\x10\xe8\\\u055e6*V\x1dne\x97\xc0\xd3\u0776\xdbv\xfc\xac\xa2G\xf66\x1ecrZCJ\xbe\xe5Di\x94\xb3p\x0fQ/\x8a\xa10\xfb-\x7f\x11\r\xa7\xe2\xa6\xd61\xa2\xc4\xe6\x00\x8bP\xc1\x9c>4\xc4\x18\xcb\xe0\x8a\xc0\a\x11\u0306\xafQ\xb6\xd6dh\u00e1\xaec\x94!\x80$%\x96\x19\xa3\xac\xa5\x9c\x17\xdai\x94})\xbc\x98q\u02108\xd2+'\x9fS\tC\xe8y\xa4\xb6T\xaf\xc8<9\x1e\ap\x9b\xf8\xbc\xdcH\x81\xafEL\xf6\xd6\a6\xaa\xe0\x98\xad\x91\xc9\x18\x1f/\xb9\x99\n\xb2\xd9L_\x167%s\x8aR\xd53\xa5)\xa3\xa5\x12\xe6\x16\x97\xcb\u065e0\xf7\x88\xccw\xd3\xc57\x96`\xabd\xbd\xa0s\xc1Yz!\xb6\x98\xe3\x8f<\u030ct\xe2\xc3\xc4w^\xf0\xcdO\x9d\x81\xb9\x11.M9vb\xc0\x98\x83\"`\x02\xf1\x11\t35\x99\u0112\x80\xaf\"\xad\xbe\x01fn\xda\t\x15\xfd\xf5\xaa\xbc\xd5P(GS`O\xe1\xa1O\xc8\x14\xed\n\u0137\x16S\xad_A~S\xd2\xfer\xf9M\xef\x10\xe9\b\x1b\xc8\u022d4)\xb0\n\xed\xf9%\xf3\xf9%\xacm\xbd\xcet\xfb[8/\xf7\xa3v\xa3\t|\x95\x9d\xa3{\xa8\u030b3\xca\x02P\xe9\x15\xbd\x94z\xe8\x0f\u011f:\x14HY6\xab\x95\xeb6\x9e\x8d?\x81\x988\x90\xf2\xac\xd0\xf8\xfd\u066b\x97-\xae\x95^\xddI;\x8dJ\xed\x06\xde\x17L|\xa46yK\x8bN\xf5\x8e\xc1\xc9S\xb2s$s\x12\xf4\xe3\xc5:\f\u0402\xc1p\xfd\x86Y\xa2\x84\x19\v8&\xa3\xaa+;\x16\xf1\xce\xd0p\x9an\x16B\xb4T\xccd\x05\x10\xe2;=\xec\xbeGef@\xa5vx\x9c\a\x9b\u0260U\xbb\t\bH\xb5\xd1\xfc\xed\x82\xce\u023a\xd0oE\xd1\t\xf94)?\xf7\xd57\u018c\xce\xdd\xf3IV\x92\x81\xc9\xe5\x06Kx}MY\u035d\xc9.\xd1\x032\t\xec\xb3\xe6\u0299%\x98\x15\xa2\x13\x17=K8kd\xc6V\xb0Z\x174\xcb\f\xa8R\xabU!\x9f\u0201\x1a\xdbY\x97P8\x1b\xa8]\xcb\x1b\x8c\xce2\x7f\x02\x94\x00\x035\x90\az\u06ady\x96\x1d\x8a\ry(p\x16V\xdf(V\xb7\xad\x1b8\x81p\xe3*o\x16++iY\xb5\x8f2N\xb1\xfa\u0582\xb65\x1cO\xec6\x95\xb7+\u01ed\xab2\xb6\x14*\xef,\x1fu\xe5\xa0wM\u0750\xca*J\xba\xe1\xa9\t\xc8yITL(gX\x9f8f\xbe\xfe\x82\xae\xd1*?\xe4|\x8c\x01^\xac\xb9`+$\u02bc?:H\xbd\xb0OO\"\x7f\x1fu\rA.\xcb\xfd\xfe\x8a\x1d\xa48[)7\x0f\x9b\x03\xb8\xfb\x9c\xadrm7Z\x15G\x8f\u06ec\xfe\xa0\xf1^\xc4tH\u016d\xf4k\x15\xab\xa8\xa9,$\x97.\xb2wnV\xbf\u2112\x9a%\u04ba\u0644\xce\x00\xba\x02n\xdbM\xad\xbd \xe7[l[\u057f\xccve\xb9Y\xbe\xbe\xde\xded\x04\x83_\xbf;\x88\xf6\xb6t?\xd4\xd0J\uf9b1\xd2\x1a@P\xa0\xbf<\u041f\x1a-\x17\x89#|\xd3\xef\x04\x11\x85\xbd*\u01fc\x1a\xa2\x11\x89\xca.\xebW\xecy\xc3\xdb9\x1c\x99\x1b\x1d\xab(&\xcdp\xb6\x1ez\x03Sn\xe1\u051a\U000e23d6\xb9R\x88s\xa7\x91\xb5F\x0e\u072cr\xb7\xa6\xf4\xc4S\x1b\x9bs\xc0R\x15\xb5c!9)\xc8\xd1\xef\xfeM\x02\xdcoI\x97\xdce\xd1\xe2\xd9\x15\x9b\x8a\x06\x10?\xbbN\xa4\xb6\xb1U\x02\xc0\x8d\x12\xdc\x16;\xf0'J[\x1e\xda\xdaU\\\x1b\xc5\xe6\xc6h\xf5\xb0N\x1f\xacj\xa0\"\xbe\xd3\xd6?H|'\x93\xed\x89|\xdd\xc8\xee\x02U)E5\xf7k\xf28\xa6t\xdc\xf1\xd81Vlu\xe8\t\xb3\xa7d\xb8q\xcb\xe3\xb0Ae\xccH|\xe5\x13y\x8c\x1a[\f\xba\xbe.\x8fU\x03\x1dv\xbevH\x90\x87\u6138\x9c\xa7\xc3\xd9Z:6ap&\xb4(\x1c\xf1\xbcF\xf6\xb5\xe3\xb4Og\x16\x9b)\x91\x83\xab\xf8U\x88\x8b\x18\x8a\x89\xe5\xc1n\xd8\x1a\xbe\xf4V\xfd\xd0E\xcb)\xb3\x834\xe3\xfe \xa9w\xbdT1\x94@\x8a\f\x9d\f\x12-j\xc1\v\xfa\x8b\x8a%\xd7b\xb4b\x93\xe8Z\xcf\xd9.\x8c\xba\u01e6\xc4\xc3E\x8d\x87Q\xef\xf53\xe1\xfcr\x0e\xd5\x05G\x1b9\x02P\b\xac\x9c=\xef's61 wX\xf2\xd3\xe3\xa4y\xf1` \x9de\xdf<\xe4\xdb\x06\xb0a\xd3aE\xbc\xad\x12\xc4\xfa\x82\v(\u07cb\x19\x99\x7f6#\xfe\xb9\xea\x02\xe6\x8b\xe0\xe4\x8a3\xe9\xba\xec\xd9B\xb8>\x98\x13\xdb\x19A:\u0760\xc9;A\xf6\x8bi>\v\u0545\x1f.\x1c\x9c\xc2}2V0\u052b\xcc\n\x1a\u07d7\xd9>\xbb\xda\x17\xe9\xfb\x96j`\x84\x97\xadn\"\xd5\x18\x1a\xfa\xa8t\xdd\x17\x18\xeeH\xb4\xfaz}.*\xc9#\xd0p\xfa*C{\xd6\x15\x14\xe8\xae\u015f\\\x9f\xf6\xa3\xe2\x1c\xef\xcb\xe7\x17\xc5\xd4?\xd4\xf3\x14\xad0\xbf\x18\x16L\n\xbc\xaf\xb6\xde^\b\xa25\x99\xe77v\xb4\x96\a\xa2\x15\u0273\xe9\u0305\x81\x8f\x9b\u0465\x9e\\\xb9\xa7\xad\xc4n\xaa~\x94\x8d0\xf0[\xfd\x81\x0e\f\x11\xb7\xf4|\\\xaa_\x96g\xf9\xe2\u064d\xaf\xb4\xad\xaf\xc8M\xdbmIa\t\f\x117\x92s\xf2\x19\x86\x96\x93\xa4'N=\xee\xe87\xb0^\x90\x14\x86\x8e\xadWl&-@rN\x05\x0eb`?\x19\xb0 H\xf4\x94\x9c\x1c\xd87<\x1d\x0e\xfa0\x0f\x180\xea;4&@p\xf6@\xc0n=\xa2\u02c7\xde#\x927\xf9\xc7c\xf8\u0654\xa4G\xf6\xb5\\\xe0\xb1F\xd6<U\u0438\xfb\xb4\x11,\x17\xe4\xc0\x11\xfb\xc3\xfe;\x03\xcao\xa9\xa7\u0249\xc2\xc2\x105\xf5t\xd8<\x9bl\xde\xcb\xeb\xfb\x1aI\xe3\xb4E\x14\xd2\xd2\x1f\x03\x13O\xbf\xe4s\x8c\xa9w\xf6\u065b\x03\x197\x04'\xc9\xc0%\u029368wY\xf7\xf8\xae\xfc\xd1Mz\x17?|\xd4\xe2\xfa\x8eT\xd5k\\\xb7\u058c\x1e\u0568L\xed\x11\xe2\x86n\xa5\x8fN\xd3\xc3\xc0u\x16\u075f\xa6\u0250R\xd7S\xfav\x15[\xaaQ\xd2L\x0f\x8e\xd4che\xd9\xed{\xd8x\xf29\xe9\xcfgr\tK\xfeP\xb0\x8e\xd6\xf5H\xe9cJ\xc7u\x0e-\xfag\xe9\xe3b\u0794\xef\xf0\xba+:\x7fX3m/\xd8|\xc1E\xfec\xb3\x97\x1e\x97\x1c0\x7f\x7f\aSp.\xf9\a\x921\xf3&S!6\xd4Y\xc0\xb4\xf1)NQ\xb1r^\xfd[\xab\x15\x13\xad \xb2O%*A\xe6\xd7\xdda\xe9\xf5\xa4J\xed\xf7=k\u05e3\x19\xee96-r\xfb\xcb\\\x17\xfa\xb1\tyO\x89\xa2s\x82\xc9\u0193\x19\xb6e\xfd\x04\x8c\x16\x80M\x00AH\xe1\xfeY\xb5\xd5\x01\xd42;\xf2L\x1eJV{\xd8\x13\x9c\x9e\xe9sy\x04wx\xfe\xb4J\x83\xfdp\xd2J\xf3#I\x94Vo\x94\x03\x98\x98P\xf0'dZ\x8fv\u029c\x94\xd7\U0010e567\xe6W\xb5\xbe\xb4\x82 \u0478\u061c\xca\xcajF7JW\x03x\xf1\x86\xd7\xfb\xc1\x9a*%y\xb0\xacf\x86\xbd\x85t\xb3\xaa\xa4\xaaI@\xe7\xeaVYR\x98\xd5\xcay\xf5\xb3\"}\xf9_\x9a\xdf\x02*\x97G\xc64l\x94\x85\xa6\xd0=8{m\x02%{\xa8!\x03\xcd\x11|\xe6\xe2V\x88R8\xf4T\xc8\u017e]\xd3V\xab\xf5E;m\x91\x1b\xb1\xde\v\xe4\xafE\vOj\xd1x\"\xd7ocx\uee99\xdbH\xac\b\t\x1b#\xd7\xeb\x9c\xcb\x15\x88\x94\xa3J\x95\xe7\x95!\xbb\xbf\xf4\u060a\xcca\xb5\xef\x0e\xabf\x00\xfb\xab\x0f\xabH\x8e\xa8\xfd\xa5G\x147\xf9% \xfa&\x8f\x1eL\u063d\xe9\xb2'\xf2\x01\x00\xc6Y\xcb\xca\xf3\"E\xf6E\x01\xf1\x98\x84\xc2{dA\xdf7\nY\xbd\xce\xf1\"R\x05\u069ar\xfc]\f\xab\xea1O\xb1\xb1\x99\xa8\xcc\xc0lL\x8d\xc5s\u06d4-\xa6l]q\x0e\x9c\xf9qp6\x1dYC1\x81\xfc\xf0a\x91\xdb\x16)\xa8\x984\x95\xc4x\x81k\xae\x87\xe8\x19\x1a+2S\xe7\u06e4\x1a\xdb\x11NwL+\x8c:\a\xf4\x99e\xf5\xd74\xe1\bN\\\xbbU\xb1\xf8\x06L\xcf\x1c\x90\xc6(\xdc\u031b\rS\x84[\x8c\xf4\xce\xc6C\x97D\\\x93\\Z\x8aa\xf80\x1b)A\xc20\xbb\vU\x8a\x06A>G\x06(\x9a\x85J\xf2\xd6\xd1\u070e\x94\xf9g2*\xe6+\x97j\x99\xc2\xc1^q\xfd\x9c\x15K\xb0~d\x9ba\x05\xddJ\x91\x16\x8b\x15\xed\xa3IP\xd3\u05aa\xd6\"\xf9>\xe2\xad/a{\"\xaa\x12A\xcb\xe4^\xec\x95\x1dD\x90,F\xaa\xd93\xc0\xeb\xe1=\xb4}\xacN\xfd\xa7\x8e\xe5.dS\xc7s?W\x96\x19\xa2^\xa35\xbd\x91\x00\x8c&\xb8\xfb\x8c\\\x9fb\xabBdv\x92\x83\x1eQ\\3\xb2\xad\x8f\xea\x18\xe1\x93|\xaa\xac\xc9|\xde\xe0}\x81\x8f\x11\x982\xa6G{\f\xa6\x03Apu\xce\xffJ\xa1(\xad\u03e2\rM\xac\x8fT1\u0661\xc0\x8d\xac\x97\xca\xd9\xd1\x10\x0fM\x13m\xab\x10\xcc$'\x0fc\xb1\x1bAX\u0388T\x1b\f\xf9\xae\x8b\xcdP\xf9.\x11hn\xa7\x19\x85\xa82\a\xb4\xccbS$\xa4)'\xc1\xb5\xd6?.(@\xae\xfc\u070e\xd3+\n\x151\x93\x98Q\x18b}\x0e\xa4\x02\xc6p\xfc)\x9b\xc6\x1f\xbd\x91z!\xea\xa9-\x1ak\xc6\xee\xd0\x02\x81\x1cc\xd8\x13\x92\x94\x91f\xfe\xe0\xa4!t\xca\xc6~\xcc\x03\xf1\xe6$[\xf0\xf9\xf4\x92\xe2\x95<6\"\x1d\xe6\x15\xe7!\xab\xf9G\x1a,\x81\x05S\xe0T\r\xbb\xa0\"\x02\xa1.\x98<\xfc\u079e\u0646r$\xe4T\xd0>y`\xc2\xf4\xd1\u0544\x9f\xea\xd7\x06\xaae\x9f\u0598\u0366\xb0m2ag#\x1e\xe3Z\n\xbd!\xfd\xb2$+N\xc7dT\x84L\xa0\xac\x8a\uef7auT\xb4\xd8\x1aA\xe1N #\x1f\xeaAU\xca\x01\x84EY\a\x9a\x1c\u04895\x15\x86iJ\xe4\x1a<\x9d\xa1\x81\u04a3\x9e\x84\xf2\"\xf3n\x8a\xadT\x15\x1b\x8c\xe3\xbak\xfaM\xaf|G7\xe3\xa4o\xbe>U\xefh7\xb2\x92\xd8y\xa1(\x13*\x89}%6\xfb\xc1\xeeCk+\xd1\xf0 FX\xb7(\xebI0j\"\xe5\xb2\xf6\x9cE\U000ee218\x972\xff\x00{\xa21\xb0[g\xe0:\xd4\t\x12<_);\x0eNRNbM\xa3D\xfb\x8d\xfc8S\nEe\xf4\x8a+\xdaC\xd2\x17p;7\xc6M\xc1xK_e\x18VA\x0e\xf7\x1c\xc4\x0e\xbe\xf1\xc4\f4b^I\u0708\xb5)a\ue72cCLS\u045a\xc4\xda\xd12\x9e\xc9\xf4~\xa7\x02\x05\x01\x89A\xe6\u0712(\xe1|\xb1a\x1bD\x1e\xe3?(\xaa\x01\x8c<g[\xbd\xcd\x14A+\xc1\xbe\aa\f+\tr%m\x8a@\x00\xa3\x8a{\x94]\xe7\x10\xffv\x1e\xd6x8\aOj\\P\xc0\xe0&v\x94\xb4\xbck\xf9|J\xa4\x857R\xfe\xdfs\xe4i/\xa1\x87B\x8dy\xb7 g\x7f\xf1\xec\xe5\xd9{l\xef\xe2\xf9\xc9\xe9\xf9{l\xea\xf0\x0e\x17\x82\xa2\xf8\xa0}\x90\u07de\x90\x1eIR\xe1\x02w\t\xbc\xcb\xf9\xccD4dT\x92\x03\xd1d\x98\xd0Aj`m^\xb2O\x92\xb0\xa0\xc6T\x05\x91\u04cd\xc5F\x8e2\xb9\u0193;c\x1a)\x11C\xa5mc\x86t\xe9,e\u018e'\x84\x81\xe1E\n\xb9\x13Z\x0eW\x92\xf3\xba]\xa8\xfa&q\x98\x7f\xa5\xce\xc5\xc3L\xd3#C\x99\xbf\xbaw\xbd\xe1\xec\xaf\xd33\xed\xf0q\xef^I\xf0\xe3\xbfB\xb7\xe8~\xfa\xeb\xfaeh\x97\xa4EQA\b\xab#Ab\xec>I\u06c4\xbc!6\u010e\xeb\x01%%\xbb[\xbc\xa2\x9dN\xe3\xbbR\x97\xbd\"\xe9e\u057c\x12\xe5%\x84\x9d\x97\xbf\xd9\x0f\xa08\v\xed\u0228\xbd\b\x03<?\xa6\xf9\x06\xd9},\xb7\xabUVf\xc2\x1f\x10qg~\xd7Z\x7fI(Us\x16c\u0332\xb5Y\xb6\x86\xda{\x1bOI\xa6\x8c\x1b\xd6\x17\x18\x18:y\x86\x81)\x14\xb5\xa3\u0439a\xa8G!\xa6\xe8\xae\xc1\x17\x1c\xd6\u028dc!\xba\x18\x886\xfe!\xe9L\xfc\x10\x88\x9a\aXpf\xfb\u0284?\x18/\xd4P\x8e\xa6\xe4\x98\xce%\xbb\xc4]\x18\x8f\xefF\x89\xc1\xe6\xf1\x9c\xc3\xf2'\xbe\x13\xaasA}`L\u0705D\xaf\x11{x\ub233\x8a\x04g\xe3/XBK\x01L\x1f]\xb4Z\xad\xf7\x8f\x1ePr\xf3\x96\xefW\xf6\xb0\xbe\xfe\xa7\x1f/~\xbc}\xf2\xe3\xfb\u07ec\xb7\xd0\u06b9>\xb0FA\r\xdfy\x9b\x9cm\xd5\xd5\x1d\x14\xb4N\x18\xe2\x16J\x0f\x95\xfd/\xe5\a\x95W\xab\xb8\x1b;c\x12\xa3\x0f\xb5\xb5\xad>\x94\xdc3\xe9\xa9oW\xf9\xd0\xdaU6<-\x8e\xe7E\xad\xba\xefz\xe9]:\x0e\x12Tk.\xa8\xfa\xb4\xecJ\u03ea\x15\x03Y\x89\x03\xc8\n\x1f\x83\u033b'\xedX\x9b\x80\x19\u015b4\xa7\xb0\xae\x0fx\x0e\xf3\x9brN\x8b\xe95'\xe7$\x81<\x8a0\xfa\x10\x91\x13\xf3<-\x83\xa1\xf6I\xecv\xbd\xe9G]\xe8\x82\xebJ\x96}d\x9b\"\xd2\xdea\x1d\xa4u\x97\xe95sW\xb7\t\u7ba7\x882\x14v\x9d\x84@\x83\xc7N\xb9\x89\xf7\t\x86^\x03\xfd\xcaf\xac\x811\xee\xfd\xe3OdV\x8b\xa1-9\x1a\x1f\f\xa6\xd0s\xe5\xc0\xb1m\xe3\xc0\xedGn\u07d9\x10\x88\xa1[\xf2c\xe7\x87h<\xb0\x1c/Kv\xf2\xce@\xaa!\a\x81ly\xb7\xd1\xe5L -m\x12\x8fELf\xc7[\x1d\x94\xee\x1e\xc4\xc3SD\xc2\xc2~\x80\xb5\xcb\x03m\xa4\u04bc\x98\x95\xcd\xcb\xd4/FG\u0250\xeb\xb6\xecE\xfa\x1e\x83\x98=\x88\x8a\xff\xfbI&l?\xf2Jw\xcaKG2\xadA\xe9nUi\x99\xf2\xa0\xf8FUq\xf6\xee\xd2E7\xab\x8a\xb2\xeb\x97Wv\xeb}Y\xd1/E\xdd\xec\x19eq\xf6d\x1a>Xt\xc0eN\u01b5\xc2J\x92\xb0Ra@\xe4\x8bi\v\x05\x9f\xb2\xe4\xc6\xc61\xc5nE\t\x03n\x9ct\x1e\x8d\xe2\xfe4{d\xdf\xe7\x12\xd5\"\xc2P\x9c\x1c\xb16\x15\x9b{\x1d\xfb\xdfx\x9a\x93\xa7W#\" \x96\x12\b\xe1 \v\xb1;\x89\xb7H%Z:\x14\x81\xd8\xc0\xd7\xcd^\u008d\xa7S@\xaf\xe0\xe0\xe1y\xc5+\xf7|\xf1\xebx\xbf\xd4{\xfe\xd9\x15\x8b\x02\x85\xbc>Q\xdcd\xfa}\xe9\xf4R\xb9Q\xf3L)d\xfe\\\xa6\xa5\xa4\xb28\u04a43\xcbI\x1aFR['\u06d9\x88?zv$\xd2[\x17\x97EML\x10\u06a0\xee\xdc!\xd9\xfb{Y\x04\x12mX\xa9\xff\xf7\xd0D5\x10\x17\xe00\xffP#\xfa\x16\xe8\xed~t\xe9_\xe4\x95/\xa2\\\xef\x05\x13\x8d6\u039c\u0326,I\xd1\xd7\u0377T\xbe\xef|\xf7\xff\x8e\xe7\x9b\x13)\xfd\n\xf3\x8d\x13m\x13d\xacQ\x98\xc35/{\x92\x8f\xe6z\x82.\U000ef760`\\U\xe9\x97~\x95\xc1\xa9\xb5(\x1fF~\xf3\xd5\xc3P\xb0\x83\xbe\x06N\xcd&M\xd2/\x1b\x88`N\xf90\xe0\xe5/\x18\x87\x80\xfe\x15f\\;\x05\x96v\x14\xde\x7fuG\uff73~\xe9\x0eA[\x034Q\x8a-S\xe7\xd4\xef|\xab\xcaw\x8c\x9e\u02ee\x1d*\xc8\xc2\x18\xf0\x0ex\x1fi\xb6<\"^`\xf6O\x1e\b\xae\a1\xa5\xbd\x91DcN\u04ce:e\n\x9f\xca1\xa1U\xa3\xf5\x91j\xd1\xd9\xfe\u02bc\xea\xd8\xce\x17\xa3\xf7\xf2\xf8\x8b[D\xa1\x92\x8ct\xb3\xa9\\\u04b8L)\xfeb&\x83\xfa\xd5x\xb5\xa5\xa4\xeb?\x7f\xe7\x17\xf2\x9dh+I\xe8\xcc!9\xca\"Eh\xa2\x02\x11\x04\xd7\x013\xf9o\x12\xca3\xcd\xf4\x1f8\x88OY:\x88\xc6\xf1\xa7\x14] Qt\xc0lu8\xcd\x1a\x9a\u0391\x83\t\x1e[\xa1Af\x10\xd1l{\x9bq\xc9{\xb6S\xf2l\x17\xd0\xcc#\xe0\xcb\xcc\f\xa2\xfd\x15\x8b\x1bWm\xed\x8a\x12\xa0\xf0U\x15\xfa\xe2\xd6\xc1\x80\x83\xc6\xd7\xc1\xd8F\xa1\x97\x94\x15Xm\u011a\xb3\r\xf3\xf0U\xcd\xf2\x89\xff\u0401u|!%\xaf+\x9f\xc6\x1c56\t&\xd1\x01\xb6a?\xba\x90\v\xad\xa6h\x87\x8dP\u05f41!(\x14\x04\xc9\x02\xef\x1f\x94\xf9Ks|`s\x9b\x87\x88\xd1v\xa9\xdah\xd7`\xbc\x1at\xe0\xc6,\x1c\xda\x1a\xcb@\xb3\x11\xbc\x06\xac;\xe3+c\x16\x84/\xef\xac\xfc\xc0\x92\x03^\xfa\xdb\xf4A\xd1E\xbbI\x9a\xf0\xb7/\xff\xf0\xf2\u057b\x97\xa8\r\xc79+\xfe}\u07f4\x9d?\xa5\b\xffS\x8eL\a \xba;M\x04\x01\xf8\x82\xd5\xe1\xa3\x19\x95\xffOV\xaf\u9fa8\xa7\"D]t:]\xd4\u021fv\x10\x18Q|\u012f'Q\r\x8dQ\x11\xff\xe8kC\x01\u11cf\xba\x1b\xff\xf3\xa8Y\x84\xb6A\u043a!\xb4\xffp\xd0\xfe\xa3\x14\xdaf)\xb4M\x82\xb6\x11B{\u383d)\x85\xb6U\nm\x8b\xa0m\x86\xd0\xce\x1c\xb4\xb3Rh\u06e5\u0436\t\xda\x16A\x93\ua76d\xff\xa95\xabV\xc1@\xdb-\x85\xb6C\u0436=h;+@\xdb+\x85\xb6K\xd0v<h\xbb\u02e1mtJ\xa1\xed\x11\xb4]\x0f\xda\xde\n\u043ae\xd00\xb5\t@\xdb\xd3\u043a\xed\x15\xa0\x95\xe2[\xb7\xc3\xd8\xdb~\xef\x16\xb1\xdbY\x01Z)\xbeue/t4\xb4\x8d\xe5\xd06\xcbG\xca{\xa1\xd3\xd5\xd06W\x80\x16\x8c\xd4\x10\x823\xce\xf0\xe1(Ag\x0f\xfb\xfb_\b\xd1\xc2\x00\x1e\x19y\x19\u0303\xd3$\xae\xa6\xf6\xa7Z\xa3\xd1\xf4\x1br\xff\x13ZC\xe06\xf7\x90\xb0t\x1ejp\xfdz\x8d#v\xbe\x9c\x8f(\x8f\x0ejp\xf0Yo83\x8f\xe87^\xc7\xf0\x03\x03n\vi]\xad\xfb\xef\xbf\x16\xb8\x0e\x82\xdb\xf8?\xbf\x16\xb8.\x82\xdb\xfc\u036f\x05n\x03\xc1m\xfd\u06ef\x05n\x13\xc1m\xff\xe9\xd7\x02\xb7\x85\xe0v~\xfbk\x81\xdbFp\xbb\x8f\x7f-pt\xa0\xed\xd5\x7f%p\x9b\xbb\b\xae\xdd(\x80\xf32k#\x84\x00`i!\xbb\x9bw\x91\n\xae}X\x0eu\xc9{\a\x10I\xfe\xc1\x93_\v s\n\xc9U\xf69Z\xfb@\x9c\xf7\xc1\x13iig\xe3\xd7\xed\xfav\xe7\xaf\xd5\xf3g\xb3x\x98\xc6\xe3\xe8\xc9c\xd3ul\xea\xc9\xe3_\xa3)\x86\xb8\xcb\f\xd8\xe1\x1f\xce^#Y\xbe\xcc\xeb\x9cg\x1a\xd3M]\"\x1czrI\xbf\xf1y\xa3\x92}Rq\x82\xa6\x9a*\xefq\v\xe7\xbdCl\x00\xe8q\xed\u01d9;\x00\xfe\x88\x10\x89\xf3mZ\x02\xdc,\xe1\xcbv\x89\xdc\xfd\xf7\x7f\u051a\x15\x94;b\xeaN\xdcT\x81\u0573Phk\u077e[\x06\xe5\xddB(\xdbt0$'\u02e0\x9c,\xee\vQ\xdc\xe9\x9beP\xde,\x86B\x94qv\xbe\f\xca\xf9b(4\xa2\xbb\xff\\\x06\xe5?\x17C!\xb2:\x7f\xbb\f\xca\u06c5Pv\xe8\xe8H\x9f-\x83\xf2l1\x14\x1aQ\xf6j\x19\x94W\x8bGDg\xf6\xe4\xf52(\xaf\x17B\xe92\xc7\xf8\xd32(\x17\x8b\xa1\x10o\xf7\xfe\xcb2(\xef\x97@A~\xf3\xc7\x1f\x7f&0\xd5P~\xfc\xd1\xdb\xea\xc5m~\x9aa\xcc>\xda\xe7Q\xfd]B\xf1\xbaT\x88\xc5\u07f3\x0f\x16\x05^\xe4\xe8\xfc\xc7\u0267\xf3,\x1bJ\xc6o\xe8\t\xcd\xed\xc5Q\xef5YA\xb9\x9do\xbfT\xfc\xaf\x8aDl\x13\xfa\x91!\x97\xcf\xde\u0440zrj\xae \x18\xda\xd5'L\xcc\xcf\xca\x01\x9e\xdd\x1f\xe06\x1d\u0143\xe3r\x80\xc7\xf7\a\xb8CsxuZ\x0e\xf0\xf4+\x00\x12\x99\xbd\xfe\xae\x1c\xe0w_\x01\x90\xa8\xdc\xcd\xf7\xe5\x00\xbf\xff\n\x80D\xf0\xfe\xfc\xfb\x02@\xc3\xe9\xff\x1ea\"\x8e\x04\xa0+\x01\x12\xda|\xfcC%\xc0?X\xe6\x8a\xe2]~0\xf2C%@b\a\x87\xcf+\x01>\xbfg\x0f;\xbb([?\xdd/\x00T\xe7\xe6\xbd\xe6\xb0K\x82\u074f\xb5G\xb5\xe6\xaf\x03\xb0\xb3\xc1:\x98\x97\xe7'o\u0224\xf1\xc7)\x83\x16\u07e4J\x80\xf6}\t\x81\x012\"\xf4Eb\xbbr\xf4\xac\\\xac\xf8L\x9e\"4x\x98\xce\xfa\x18\xb2!\u00b4G\xa8\xb8\xb2\xb1\xbbl\xde\x1br\x1f$\xfat\xb4\xfe\x03\xe5_\x96\xa4\xf0\xf4\x02\xb9f|\xc1\xb1\x99E\xc7\u0149pl\xacS\xae\xcb%\x8d\x91\x05\xd181\x19\xb3\x01\b\u528e}sb\xbc\xb1N\xfc\xc0\xef\u020c*R\xf9\x03\x03}\xbc\xf6\x83\x01+q\x98\u02a0\xd7)f\x9c\n\xa3\x88\x8e\x0fI2\x12\v4\xf4\x14\xba\x1e\xa7\x7fa\xbb\x15\x9e\x9fY\x965\x8c\x84L\xa8yq\xf6\xfd348\xf5\xd5l\xab\x13\xda=\xa2:\x7f\xf9\xa3\x7f\x84\x10j\xff\xb1\xb8\xa1+\xa9+\x11\xc3\xcf\xff\xb7\x04\xca\xff]\x1d\xca6qt\xfd\xa3\x00\x8a\x11\x97\x8e>x\xa0\xfc\x028\xedG\x8a\x8f\u07e5\xd9\xf9\xf4C\x05\xac\x1f\x96\xc1\xfaA\xcb\x04\x04\x8b\xec\x89K(\xc0a@\x01t\x01\xfb\x9d\xde[\xa2B\xb35~Y\u0477\x97\xcb\xfa\xf6R\xf5m\x87\xe6l\xf4\xa2d\xe6_\xac>\xf3\x1d\\\xc0Z\xf3w>\x14\xbc\xcc\x13*\xe2Q\xb8J(\x88L\xb5\xd67\xbf\x14\n\xf2F\xeb\u07d6\xcf\xf6\a\xab\xfb\xf9\x96h\xf7\x02\xae\xe6,\xfd\x8c\x9eq\xb0A\xd9.R)\x97X\xcd|t\xfe\xe6y\x15\xbb\xe2=r\xd3D\xf5z\xcfi\u00ed^o\x8fN\xe2\x8b\xe7\xbd\xd7\xf7ko\x83\x0e\u0728V\x982\xa7\x06\xab\x9a\xc5=\xaaz\xf1\xe6\xbeM\xee1\xf5\x7f\xf3\xe2\xe4\xe5[GU\x16\xd6\xf3o4\xe8\xae\xc0\\\tlr/^\xbf9?;z\xb3\xf0F\x80\xe7w\x93\xd4\xd8P\xf6\xf9\x1fT\xaf+\x8b\x93\\pq\xf8\u6937\xa4\xb8wYB\xb7y\u821d~\x96\xb41\x18\x83\u06d8\xe5r\x92+\xea<1\x13h\xd9\x7f\xf2\x86\x16\x9c6\xe0\x1f\x92;NQ,\xbb\xb4x\x13\x11\xac\xc4\x06\xd3\xe9\xef_\xbd8a\xac1`\xbe\x87\xc3\xcdn\xf5\xe5`xa^\x7f\xf7\xf6\xb5\x0f\xe6u|\x9d\xbc\x9d\xac\u069bM\xee\xcd\xf1\t\xa3\x85\x03s\x9c\f\x1d\xddY\u079b-a\x12\x8e\x030'\xe3\xc1}\xc0l\u02a0\x8e\xe5\xc6H\x0f\x8a\x92>\x95\xe1x\xd9f\xef\xe1\xca\xd9;.<\xb6\x95o\x10\x99\u01db(t\xb4\xceE\xbb\x1c2\x89\xb3\u01fa\vxLu\xe5\x10\xa7,\xde&\u0123\xf1\u0763q\u0425\x84Y\x19;\n\ua52c\xcd\xf2\x95\xa1\xcb\x033\x11>\x8c\x95\xa6\x82{B\xe2\xe9\x9bg\xdf}O(\x1b\xf7\ub89c\xc1SU.\x85\x8eV\x83\xb4\xe3\xdcY\x9a\x91\x82t\xec \x1d\xaf\xb4<\xb0\xaf\xe9\xb2\xeb\xe5\xdb\x17\xcf_\x1d\xfda\xa5\x9b\xc1wh\x06?\x9e\x8fd\xb3^Y\xef!\xb4\x04\xba\xc6|\xb5hk\xeb2\xb1\x90\xf3\x0e{\x03\xe6j+k6\xad\xa6w~\u037f\x18\xe5\xfb|\xf2\xc6v\x90\x8cK\x04`\x8e\t\xe4\n\xa0\xd8\u020c\xed\xf4m\a\u01eaO\xf3q\xfa\xdfs\u0563V\xcbh\xcfx\xef\xfd\xe15\xdd\xe8TN[\x91\x96\xefH\xbd\xce=\xeb\xedJ\xbd\xee=\xeb\xedI\xbd\x8d\xfb\xd5\xeb\xb4\t\x85\xff\xf0z\xf3\xbe\xf5:\\o\xeb\xbe\xf5\xba\\o\xfb\xbe\xf56\xb8\xde\xce}\xebmr\xbd\xdd\xfb\xd6\xdb\xe2z{\xf7\xad\xb7\xc3\xf5\x9e\xbc\xff\xf5T\xf3\xed=\x86\xb9\xf6k\xc2\xdcf\x98\x8f\xef9\xbe\x8e\xac\xfb\xfa}\xeb\t\x9e\xb5V\xaeg%?\xd6_\xbdr\u07bb RM4k\xb8Mc9\xec1\x9d\x8a\u0236H.\u051f\x18\xc3\x01\xfc\xd2\bn\u04dfTX\rl\xf3\xed\xf7;sPz\xf0\xfe\xc3\xc0\xfb\x8f2x\xa5\xf7\xb8\xdbt\u053c9y\xfe\xaaG =xo\f\xbc7e\xf0J-\av\xf9&W\xf8\xb3\xa0\x7fg\x06\xdeY\x19\xbcR\u06c1]\u0693\xef\xc4\x1f\x92\xe1)\x13\x02O$\t\xe0\x95Y\x0ft\xd9\x16\xe1\xf0\u0373\xf356nP\xf0v\x16\xc3\xdb+\x85\xb7c\xe0=)\xc0\xdb]\b\u03f7 \xb0(\xd5\xd9\u0648.^\xbc=?y\u07c4\xef\x9b\xd1\xc5\x0f\xaf\x9e\xaf\xbd\xa7\U000e4cf3E?\x9f\xbc'GO2cs\xe6\xec\x16\x17\r$\xcec\x1a\x8d\xe21p?\xd3&\xa7]\xa9Q:\x8dOd\xddC\xdc\u0228\xa5\x12\xa9a\u3a19\x18\xe6Yp\xdfT\xcb\xf1\xaeL\xec\x80\x10\xb9}\xff\xe2\x13\xce\f\xec2\xae\xb3~!c#\"\x8e'b=\xdfV\xf3\f\u043cqE\xaeN\xcf\u045b\x8d(\xb9\xc2kj\xdd\u02fa\xe3\x85\xe7Xf\x97\xe5\xc2d\xb0EY\xf7\x7fje\xc3\xcd\xfb\xd3l\u0231{\xf8+em\xbe\x9cc\xac\x82_>vb\xe8\xab\xd2\xdb\xfaC\xbf\x81\xa2hix\xc6\x1d\xfa\x93\x1e\xb7\xf2+\xe0|i\xa5f\xa6\xae\xb82\xdb\x0eZ)1\xd5\xfe\xc97\xdf\xe3\xd9\xfa\u078fw\xae\u07fd\xe2w_\x1e\x84n\xfa..1\xcf$\x0e\x9e\xe3l-]2c\xac\xf7\xb7^\x1f\x94M\xfe\n\xcb\xf3\x87\xbf\xfa\xfa\x9c.X\x9f\xd3\x15\xd7\a\x06\xffw\xbe<\"\u022e\xb6Bh9[\xb5B\x85I\xba\xd8\xfa\x9f\xda\u04e53\xc4\xed\xff\xf2I\xe2I@S{8,\x9e\x93ks>\xbf\xa4\xf8Z\xa8\x1b\xb6~\x06\xc6\x03\xf1\xd5\xd8\x1d\x05M\t\xfa\xfcq,d9\x1e\x9adk\x11G\x13\xc5\xd0\x00P\x00\xe3\xbd\xc4\b_\xf2\fq\xba\x91\xc7\x18h&\x1d\x897JP\x1f-\xa9\xc59\xbc\u9d41P8\xdaz~7\x86\a\xb3\xb4O\xe1\xa9\xc6\x12*$\xe6\x90\xd7\x1cY#\xa5\xc0\x16j\x14\xd1aLA\x97\u01e6\x1c\xb4qE\r\xa0\xa78\x8c\\\xe2\xd1\xf8\x83\xb7\x91I0\xea\xc1=\x90\x04\xd5\x14+\x1d.\xd0I\xeb\xc3\xc1\xf9'\x9dK\x87MU\\\xa8\xa2\x93\t\xfe\u05b9$\x14Q\x8a\f(\x9e\x86\xc7\xce\xc6\xff\u01b1cu%\x7f\x8d\x9d\xb3\xbd\xea\u03a1\x88V\x7f\xdf\x04\u01a8cV\x9b\xa7\x02q\x0e\xd8\x13\xed\x84Z51\xcf\u04f1%)\xf7\x98\x18?\xf0\xd7/t\xe4Z~\xe6|+k\u076bE\xfbr\xaa\xf4j\xffK\xcbs\x0fD\xfe\xb5\x16\xc8a\xee\xdf\xff\x12\x1d\xba%:\xf4\x97\x88\xf37J|\xb0Q<\xbd[\xa7\x10\x15ct\xf4\x85\xb1&\x98\xc2X\x1c\u04cb\x8b\xb7\xea*\U00065e77<&'YI$'7\u0677\xe9$\xc1@0\xe8\xbb\xfc\x8b\x89\x04]\xa5\u049dk\xa7\xd5\xda\v/U\r\x1a\xa2\xa4\xe4E\x00\x91\xd3\xd6\xc9N\f\xc2\xdd\xe0\xeeI\x86K\x8e\x0e6\xbc\x93\xbc\x89\x18<\x00\xe3\x8e\xd8\xd8Z#\x92\xe2(\xf8H\xc6\xcd\xc0Y\xf6\x19\a\x82\x8d_\x8f\xe1$_\xb3#g\x0f\xd1i\x8c\xd92S\f\xb5E\x90\xa9\xbdn\xab\xb5K\xe79\x82\xba5i\xff\"\x1a\x14g\x13\x13\xb6\x80B\x12\xb3V\xf3\xf6&\x1b\x1ap\u04b3\x95\xd7N,N\x17\xac\xde\xff\xbe\xabY\xf1\x1c\xb73\x89\xcb.c\xb8L\xa6r<\x7f\xad\xb0h\xf2FW\xe7\x00\xf2sHwj\xfb\xf6\\\xec\b7\xceo\xba\ue379\x95\u04ef7\x82\xd7\x17\xfe\xeb\xcd\xe05\x9aj\xe9\xf7[\xc1\xfb\xf7\xfe\xeb\xed\xe0\xf5\x9f\xfc\xd7;\xc1\xeb\x0f\xfe\xeb]5(\xcb\u03d8\x97{\xea\xe5^\xad\x10T@\xefE\fk{\u07ed\xb8\n\u018a\xf9\xf2\x02\x84]\x82.\f\xe0\x97c\xcb\u0492\u0599\xacb\x86\xc8(\xe4\xaf1E\xc6D\xfc\xeb\xe7H \xfc\xefN\x920\x0e\x7f:\xa2\xfc\xab\x98\xdf\x05\x84\x88Y\x10c\x99$\x14\xb4\x15\xc2(\x86# \x96\xf7\xa1|G\x8b\xa6H\x82Q$\xc6\u00f7b\xba@\xe6:\x96hV\xf5\x06\xfe:3uT\xb2\u02c7\x16\x10\x05\t\x1f\x0e\xe3\tH\x13^\xb0\b\x0f:r\nG\x18\x9d5\x9c~\x9d\u04cd\r\x96\x8cI\x11\u0341\x0e\x1a\xac\r\x93x.q&\xcd\x15f\xcb\xc1y-\xf9P\x8d\xd5\x15\xaa\"\x87\xc9lf\"\xf8\x05\tZ\xb9Y6\xc5\xc2@\xa4\x0e\x90\x14\x94\xa4\xc9&\xee\xcecL\x94\x04gYL\xb1\xb78\x04\xf7,\xf9<3\x0e\xc3\xfda:a\xa5\xbbr\x8a\x15\x97\xd8\xda`\n\a\xcb\xda\xe5]\r\xce\xc2\u02d6\xf2\u05adX\r\xca+dW\xa0w\x05/p\x1a\xb5\xefn\x9e\xcc\xce\xd3Q\x92\xcdgu\xb7*}Y\x93\xf3\xec\x04P\b\x83\xed\xba\x97\x8df\xb4\xe5R\xba\x05\xae\xae\xab\xf8\u01ea\xd4l\x0f\x17\xac\xf3\xa2efC\xb2\xbf\xc6b\u00de!\xc6\xc6\x18\xe1QZ+\x8c\xbfJQ\x9a\xf2\x14\xd8\x1e\xc9\xe1\x8cm9@&\x84[\vSe\x1c\xf1\xde\xc3d\xf7\x93\xbbZ\x83\xb5\xcf\xc3\xec\xd6e1\xfc\xbbX\xb3\xaa\x0e@k\xb6\xfd\xf3\xec\xc8 d=\x88\xfa\xbf\x92\x04\xa0\xd2\x02\xb8c\xb4\xbdQ[D\xe1^\"\x85\xcb&\x94\xfb\x02\u00f8\x8a\xce_H?]e\x0f3\xe6\xfd\xef\xc5\xd8-;\x01\x8a\x18\xc7-\xb7\xb0/u\xbb\u00b6\xed\x1bR\xe2\xd4j\xc5xD\xb5>q\xa5\a\xe3\xac\xd9\x1ffyrp\x97\xe4\xcdi\x92\xa7\x7f\xe1\xafF\xb8\x98\xe6\xf4\xb3\xe6%\x8b\x14\x10\xb0\x18\xe9(\xfd\v\x06\xf5\xa2B\xb7\xe9`vs\x80\x81\u07e4W\xe9x\x9cL\xdf\xe1\u04f2\xea\u035b\x04\xfd\x92\v\x15\xbe\xa7\u01ffL\x94\xc3%L\x16.\xe1\x0ftHa|`\xf8\xc5\xd7&\xea@\ncP_& F\xa4T\x83\xb3#`y\x89\xb9l\xd4e9\xe6Q\xd0V\xa4l\x8e\x80\rr\xb4Dh\xb3\xb2\xca\x0f-\xde\xcd\x12\x97\xf1\nPz\xa2\x12\x14shW,\xf8i\x8d\x1a\xaf\x91\x82\x8e\x03\xfeJ\x87W\u0172\x1f\x96aY]\a#1i\x10=\x12\xf8\x03\xdd\xf4(\xa5x\u076f\U00070c8a\xca\a\xfc\x8e2\x81+7u\x1c\x18E'\x03q9\x19~b+\x10\x8e\xc1;\xb4g\xd5\xfa\xab3\xce\xed'\xf3\xa6\x92AJ} \x8c \x1e\x02V\u0791U\xf1(\xee\xa3F\x96K\xaf\xeb\xf5Q\xd9\x1dl\xe2\xf2\xef\x81\x06~\xc2k;:\x11)\ry4\x9d\x8f9\xa9\x05\x1cidF\x82A\\\x11\xf9\xe8r/\xc5\\\xf0\xd1\x15\xa6\x9c\u3206\x98/\u0400\xbb\x8aEB\x17\u04a0\x8fi\x10\xea\xe1\xact\xa8U\xbf\x81]|5\a\xd2\xde\x00\x12\xf2\t\xb1\xa4\xf5`\t)&\\\xa8\x87\xb1\xe7W#{\x18O\xe5\xbegc\xb0\xc7:\u06e5{\xac<\xf0\xf2\xafK/\u0644\xf6\x9f\x8b^\xc2qy?zI\x15~\rz\xf9K\xf8}1\xc0\xcf\xf4=\xb4aA)\xday\xb5 \xc0\x11\x0e}Y@\u04a3\xe9\\\x1a\x8aUB\x12\\BC\xa9\x0f\xc2s\x91\x91\u0658/\xddI\xbf3\x8d\xc7\xf9\bo<\xc6&Sk\x1d`\x849l\x89\x95jH\x9cm\xbe\u07ef\xf5k\xd8`\xed\xa8V\xd61\x8f\x85\xbb%\x8c\xe7\x11\xab\t0\xc1\xfa\u5284\xeeSH\u0157\xb1\u0088\u00f1\x1b\x99%\xcf\xdc\xc8\xf0^''\x85RB\xf6-\x14\u075c\x92\xd3\r\xb1XF\x1a\x1c\x968y\x1aob\x8an\x9b\x05\xcb\x02\u00e00!7\xa9\xa3<\x94\x17\xeb:N\xef\xb5\u0656\xca^f;\xad(z=-\xecQ\u052d\xda=\xe9\vfeR\x18G\x89\xa2\x19\xa4,\xd2rAv\x99\xe00o\x92\u1030E\xe3\x91\xeda\xc0{[\xfbB\x994\x17\x11N\"\xcfc\x10\x16\n\xf3\x1b\x0fX\xf7\x8a\xb1p\xcaq\bo\f\xad\x01*,\x1fO\xbeD\xfe\x1f$\xfdt\x80$\x7fv\x9b\x00\x8a\"~\x91M#!\x98\u06fd\xa5\xfa,/@\x18\xe5\xcb6I\xaeM\xb8%\x97\xa1k(\xbb-\x90\x04q\x0f\x94\x88\u07ff\x80\xd7W|\xbe\x0e%Y\xb9\x8c\x9e\b\x00%\xbfX\xb6\xff\u02c3\x95\x8f\xa1\"%\xa2\xb8?\x99\v\x19D\xcb\xf8\x03\xc63\x06:O\x89]\xb2q\x91a\x8azl\x10L\xb5\x15\x05\xf9\x81\xc2@\x11-[\x89\x8e1wW\xe0!W\xddX?\xdc\xe3\x14\xfb:mNxu\xc8\xfa\xa2\x1fl\xa0\xa9\u0150l\x80\xa9\xfb\x1d\x12\xdf3\xce]e\xb0\xdf\xfe\x92e#\x95$TE;\xaa\xe5.\x8f2\x96\xc2\u8f14At\xc61\xeb\r\x8b>\x8b\xfa\xc9\x14\xf3!p\xa9!0i\x9c\xe27\xea\xcd\xd8\x00x\x14K~\x0ea\xcd8Pz\x9c\xcf1\xc07\x1f\x9d\x04\x12\xcd\x04)\x00.\xaa4\x06\x94\xe0$\x17M\x06\xd3c)K\xb7\vx\xa1\x9e|\u018b\x9c\x14c\x91\x03\xba\x9b1\xbc\xb3\x19K\x13o\xabQ\xf7L,1$\xca\xd7\xfc\x9e/j_gS\xf4n\xa3IA\u0781\xb8\xd7\xc7\x12s\f\x8b\xd1pW\xc5\x1e\u07d4s\t\x16=,QYy\x00\xfe\x88=\xf7.\x92}JK\xe2\xc7\xeb\x17\x7f4w\n9\x8f\xd5^Gi\"l-\x142\xeb\xaeG\u0569P%\x10\u029c\xa3\xa0h[\a\xe5`\x87g;\xac\f\a|\xb5\xd6\xfc\xf6\xa6\x83c\x96\xc3f\x8c)S_\f+\u0727\xa3\x0f[r\x1c\xb5Gd)\xda\xeb\u06870\xce+\xb2\vW\xb5\xa7\xd4\xf0\x9f>Xc\xc1W\xa8r\xf9\xd3\a\xec\xe2\xa7x\x98\x0e\x18\xd92a\x8a\xcc\r\x13\x11}\fb\xc8A\x97[_\u015f- \xcd@Zq\xc9N\x81\xc3\u03a6u\x8a\x1c\xde\xf1W\x8c\x93t\x92\x045\x8b:\xfb\x1d\x9e\xeb+\xaa\u0434\x87\x04\x8aD\u0453\xf5\xb5\xf56\u3b59H\x12;=E!\xd5g\xa1\a\xb1\x186W\u02b4\xd1\xd8\xd8\u03c5V\xa2]\x8b\x11{:\xed\xf6\xbf\xb5\x1e\xdc_\xca@\x96\xa2O\xf9f\xaa\xafw\f\x0f\u0457\x15l\u05c2\xbc\xcd%7\xc6\xc9\xec\x14\x06x\x06\x9b\xaf.'\x8f\x8e\x9bNJd\u0718\x8b\x98\x18\v\xa0\xa1\xd2F\x9b>\xac\u0550\x8f)b\x17[k\xbb\xfeQ+k\xb0f\xa5)\xa3\xe9\xed\x13\xf7\xf6\xc1\x83\x15\u01c4\x15\x1b\xab\xb3\xf7\xea\x82\xf6\x1e\x19\xc9&\x92\b\xad\"+\xd9\xd6?HV2\x13\xf9^\xd2\xf9a\al~\x068\x81\xf8\xaa\xdd\x04\xe1\xa3\x18\xd6\xc4\xc3aR&1\x90\b\xb2_\x9f\xeb\f\x0f\x94e\x8fL\x86\x9310CSJ\x02-\xfdB?\xa5\xb4\x1f\x95\xa5\xd4C86S\x9f\t\x8dMa\xe5-dQ\x12\x11\xab\x89*\x06\xcc\x02\x869\xad\x1f?B\xce\x15M\u0590\xe6\xe4\xe6@\xd39'8\xe1\xdf%e\xcf\xc6<\x1bR\x9f+ \x83H\xef\x81d\xb0\xb0\x01 \x1d,\u0287\x99\xe4x\xbb>\xa2^W\x9dS&\xf9\xaf:\x90\xf0\x9a[\x19\x17\x98\x04\xddG\xb0X3\n\x14\xaf\xcc\x0e8\x18&\u074c\x9b\x9f\xb4\xcfV\xc9G\b\x94\b\xe7\xcaq\xa3\xf0J\u06d0\\\xc0\xef\xf7\x02\x9c\xbf\xc3f\xa5)x\xea\xe9Z\xa4\x1c\xec\xdb\xc7\xf6P(\xf6\xfc\xc9\x13\xdai\xac\xcb\xc6\xd7\r\xdf>\xfb\a<\x1d\x02\x8cX2in,\x98V\xfe\x01\x86\xbb\xc0#\x11]\xf8\xf1\x04\xc5O\xcc\xe9\x04\x1f(|\xd4\x1e\xbc\xd7x\xdc\xe7<\xef\x14$\x9d\xe8/\x12\xe6\x1e%Jp|\x03\xe5\x93ox\xbc\x98I\xee\u0242\x0e\x9c\xac\xb9x\xaf#\xf7\u0127l<\xa5\x14\x91\x9c\x8d\xdc\xe4k\xe9c\xaa\r\x93Aob\xb2\xb3_a<\xc8&K\xb3\xb05\x87Y\x96cRU\x93\xcd\u0316\xa3\x03\x12s*\u0712$\x9ff\xd3t\x86F\xf51\u5121\x8cR\xb6p\x98IsA\xd2\xecx\xc5r\x97K\x16\x02\xe7\xe9H&Ta\xb2\x8b7\x8c\xb8\x12\a\xa8\xfc\xbb\xe8\xd2\x7f\xe2\xb1\xeck\x1d{\xc3\x18V\xfcfa\u014ef\xe7\xdb\x1e\x8e\xbd\x9e\xa6\x9f\xd0<H\xa2\xfa\x1a2erzJ\xda8\x99G\x16\xfba\u0358YQor\xc9eJ\xb9+07)Y\xa4\xe6U\x19L\x11m$u\xe9L%;\xb5\xe5L~W&Gl\x0e+wa\x12;\xdd\f\x16]=\x81\xfa_\u0347\x1c\xa8\xe1.\x9b\x13\nr\xea#T\xb6\xcb\r\x18\xd2#F\n\x1e\x9b\x19J<.\ff\xd9\x1es\x9b\x81@y\xac3\x8c\xaa\xc9\xed\xbc\xc0w\xc5\xebw\"O\xc0lAA\xf3\xd3[+\xa1&\xc2\xc2L?\u0648\u077f\x02\tC\x88\xf0\xf3\a\u0334\x8c\xd1\xe11\xc4}JId\u047a\f>\x98n\xed\x87$\xed!t\x03\b]\xfd\xa1\x1b\x98\xd1\xec{\x94\x0e\vy\x0fMc\x8d \x9d6\x0f\x18\xc7f[\n\u0220\xc3\xd7\xe9\xa7\xd2\u073b\x82\x18\xc5\u4e82W)'\xf6tIx}T\xfe\xff3\xb7n5\x12K>\xda\xca\xfc\xbaZ\x17\xc0Xo\xde\v\x0f\xd0Xm\x95\xaa\x8f\xfb4wi\x00\x8dZ?\x16.\x84\xb4\xab\xc9\xeaT\xfc\xdec/\xe19\\\xc6\xdeE3 E\x9a4\xd4\xc6*\x9cp6a\xde\xf9\x1f<'\xaf,\xf4\xbf\xe3[l\xe4S\x9a\xdcJ\xea\x96\x14\x95\x85\x98\x87\x91\xf2\u0528\xf4p\xaf&\x92>\x0e3\xe1R\x82\"\xcet\x9a\x83D\t\x1b\xc5DD\u01fd\xc0\xc1\xd31 \xac\xe4\x802B\xa2gU\x89xa\xb6;\x82\xa3\xe3KK\xef\xc0zLq\x0f\xc2wB\x9a\x84\x12\xe5Z\x05]\x1ec\x06\xd0u\xbc\x95\u02e6\x92\u0688c\x01H\xf6$\xd3:\n\xabx#H\x9a\x86\f\xf7\xeb'T\xdd`\x82\xb88\xbf\x133\x17\xec\"j\xf0\xd0\b2\x1b_\xa5\xd7\xf3)\xa9\x93\xe8l\x9cx\x89\xf4^\xc1:R@\x12Z(X\x9c\xa3lz\x17\xbd\x88\xfb}\xf4Y\x1f\x8b\x0e\xc7\xda\xf5BM\xc0/\x14\xbc\xed<\x94\u0368\xb4B\xe6\xa51k-\xac\xc6V\x06d\xe0\x94\\S\xb3\xb4\x11\xe7>\xa1\x99M\xf6\xd7\xd7ooo[\x9ff \x8b\xb7\xc6\xc9l}\x90\xf5\xf3\xf5O\xb3\xadN{\r\x10\xfb\xf8\xe4\xe8\xec\xfc\r\xf3\\\xfddbT_(\xb7p\u00ae\xf9,\xbb\x9d\x82\x18[\u01ff\x9c\xa7\xb7\xa1\x03\x89\xb3\x9d+'7L\x12t\\!\xad\xd6%Z\xba\xc23\xb6\xaaE\u0461|\xff\xcb\x14\x1c|\xc1\xd1\x7f \xe5\xf4+\x99\x06\x9b\x96\x80\xb4i\xf0\x86\x99\f5\r\x8aP\x98\xa9\u0507\xb9\x00\xb4\x96\xb1\xb8\x03a\xc3O\xd3\xcb\xf9\x8c\xf3\xca\xf1\xe5\fev\xc6\u065b\xcc/ak9\x04#\xec\x80U\xc5\xfc\xcb\xec\xf2)\xe9f\r\x16[\xbf\n79\xd0\x03;\x92o\xedW]`\xdf&\xf1\x90\u0731\x98\x055y\xb7\fB\xb1\x9c:\xe9\tRFh\xf9\x82%\xa82\x10\xaa@X\x17\xd7\xf9\b\xb07\x8d\xaf\x13!\xff\xe50J\n\x86\xb0x\x0f\xfe\x90r\xfe\xa6r0~\x99r\b\x87\xc3t\xfcqa}.\x11\xd6N\xc9!u\xc1<\xa8\x02a]\x99\xe5\x1f\x80>d\x8b\x17\x82\x8b\x84\xf51\xb7\xecG\xa0S\x03\xf6\x87-\x87\x10\x14\xb20\x96\x1f?\xb0\xf4x\xb3\xf8\x0f\xae{\xb9oF\xf8`\xcfG\xafq\x16\xca\x13\x05\u078dg\xf1g>I\x90\xd6\xf2u\xaa\xbd\xcb\x03\xa6,\xc3[xK\xcd\r\xf9 \x88\xd3bR4\xea@\x84]@\x86#\xfa\x89\x138\xb2\b$\xd3\u014fH\xcb\t\xe0\x04\r\xe4\x1d0\xd6\xec|\x15\xc2\x19\x93\xbd.\u00f1\xa9D\xb2\xdcd\x87\u05a0\xe01+I*\xbb\xf3\xad\xc0\xb1f\xfe\xe29\xb8\x040\x1c\xdd\a\x140\x85y?=\x11\x8a\xc7J\xe0D\xf3&\x06X\xdc\x1c\xf6\xbe\xc7V\xa1]\xc7\t\x16\xac\xd7\b@\u0135\xa0\x1fh\xb0`\x87\xf1$\xaaqrP\x03ca\xcbx\xed\x8b|\xc8,)\xae\x8bf\xe7h\x82\x0e\xf4\xbc\x9bT\x83\x8b\xa0\x17\xb2\xe0qU:\x85?\x00H\xa5\xb0\xb2\x8b\xc9_\x9e\xfa+#\xe5Qzr\x9a,\x9a[\u932f\xb4\xd6\xd2;MU\xd1\u06ca\xf59\xfa)nG\x91VXP\x91\x8c\xb2\x9e<\xa2N~\xca8\xaf\xc7-\x89\xbeI\xb40\x15\u0405\xd03y\x88m\xc4\x1b`\xcf\xfe\x90\b\u04c1qtD\xe9\x18\x93-Tr\xcdf\xef\xf8\u02c2\xb5\xb7h\x95\u034a\b\x86b\xd3\v\x97\u0689\x95\xac\xf4B%G\xfes\x86\x03!>\x82\xe5\x89\x01eEW\x1e+<I\xe3\b\t\xe84\xcd?\x92\xb6R\xbai\xd4 \xa8\u0662\u0134\u0597v>v\x99D=\xa5+\x9e\xfe\x86\xfd2\xd0UJ\xf2}\x16\xeaz\xfb\x11\x89\u03c9X\xde\xc6^\x8c\xaaG\xbdG~\x17\xa1\xc6\xf6\xd6~t\u01b2\x10\a)\x93\xe7\xed\u03db\x9d\xf27d\xa4\x166\xc4\x0fu\x89*\xc0\xf4r\tt\xbe\xe9.mC^\xe9\u048fuI\xee\b\xe5.\xbeM\x90\x9d\xcaU\xd6E\x0fci\xceM\x90PIe\x8d\x04\x01\xe4\xeb\\\xdd=!\x02\xf4l\xdee\"\xf6\xb2\xb7\xadP\x1f\b\xf3\xa4\x12m\u0495\xa2J\xa7\xd34h\xc4M9\x01\xbeH\xe5\x15\x11\xa0\xe3\x140\xfd\xcc\xf4\xba@h\xac\x1a\x87u06\xc51\xd2\xcd\a\x94%I\xe7=\xfd\xe8\xc4\xfb%\x1b\u03e6\xba\xfat\xb1R\xf9\x8b\x8f\xef\xdf{\n\x17l\x17\xe4/8\x8f\xeb\x96\x18\xfd\xae\x84\bzN\x94\xf9\xc7tr\x86\x0e\xd4\xf6\xf6\n{=\xcb0i\xb6PP\x9a\x92s|b,\xaaI\xff\x85\x0fZt\u8836H\xa8\x80\xba\u045a~R\xda{.\xfd\tuG\u048c\xdcp\x95\x81\xb2\x03\xae\xf9\xd9\xda\xe6}\xa3\xe9R\xe0Z\xb3\xec\xed\x04V\xf6(\xce\x13g\xf1\x8d`M\xf1U\x17\xc0\xb9\x90;\xf3\x86%UZ7q\xfe\xeav\xfcZ\xd4=\xa6\u02466~\x17%\x9dM-\xb5lY\x05\xc6\xfb\xa7\x16\x02\x0e\x06\xb0\x82\x94p\xbf\xfdmd\xbe>\xf4\xae#xE\xa7dq\a\x8b\x96\xf0\xd9\xebRq\x9b6\xf8\xb8U\x13\xd8p\r\x19\xc8JE\x19,\xd5*sj\xa9\xb77\x9f\u02e6\xd5\x1e\x06+L\xa9\x87ZK!\xaa\x19\xf5\a\xe4\x00\x16'\xee\xed\x18M\xeeH\vY=c_\x96\xa1r~7\xba\u03065?S\x9d\x82d\x15\xad\xae+.c\xf2\xe0\u07a4\xc3!\xdcdetK\a\n\u04ecz\xf8b\xf2\xbe\xe1-\x1e=\x02\xa0\xd8]W\xfe\xcb}&4\xf9\x8c\xb1\x1a\xe1X\xe4YY4\xad%0\x8b\x10O\f<\u0141h\xdaQ\xbc+/\x12;\xab\xc9\a\xf6\xec!]\u05dba_N\x93\xf8\xa3*\xa5p\xee!3\u024d\x05=\x9bMc-\x84\xc4h)\x17\xcd\xe2)\x9aB\x00\x98\x9ai_2\xc9}B\xa5F]\xd9\xef\x05-\x1e\xe8\x16\x8b\xed\xbdH\xf3\x9c\xac9\xc3\x06\x02\x95\xfb\x923\xafg|\xe5\xca\xf2@\x87s\xb7\xe4\x98xPzJH\xb6{\xef\x82$<\x1aV;\x11\u008d\xb4h\xab\u0112YZ\u0463eeC*\xa4\u0474\u053c\xbe\x1a\u0505\xaa\xfb\xde.\xfb\x02z#F\xf2\xe5\xfbC\x82\x02U\xee\x05\x9e\xe1\xe2VX\xb8\xfeI\U0009177a\x17\x8bU(\xc2`&\xc7Z\xcd\\\f\x99G\x8fjO\x975\xf0\xcc\t\x06K\x1aam|}\xfd\"^\xfb\u02c7\xf7\xebic9l!\x00\xab\x02n\xaf\xed\xbd_o,\xdf\x13\xe7\x82\xdf\x01TM4|\x02\xeexC\x04\xb2o\x0f\x80fD+\xb8oz\xf2\xe5i\xd5\xee\xf7\xf6lh\xf5\xe5\u03e3q\xf40\u07314\xa9\xd6\xddo\x96\x86\xa4\xab\x7fyZ\x80\xcehP\x01Yvo\tTS\xad\x04\xa2\xacMUg\x85m,\uba69\x88@\x1f,9Rh\x9b\xd4VX\xd2Eh\xe8<<\xcb'z\xd1\x11\xe4o\xb6@\x1d\x81\r\xcb\xc5\x12\xa35 \xe0\x87\xf7O\xd6\xd3\xebUz\\\x85\u0708l\x97\xe8Fp\x10u\xda\xfe\xc4\vb\xb6k\xd6a\xabJ\x18\x88\u05a2N\x10;\xc9WR(UM\a\xf5\x15\x04\xf8s-H\xcckzZ/\x19p\xfb3n\xb8x\xed\nF|\x9d6\n\xe6h\x8b\xea\xfe8\x80:\x8dr%\t\x1eyC\no8\xc8\xe6\xa83\xfe\xefy\xe6H\xa0\xbe\x10\t\xd5^6=D\x06\xf8gtctV\xc7C\x86\xa2\xc4\xf6(:\xa3\x86\x10\x98\xd7B\xceN\x00\x97\x12\xcc\x03\x9e\x0fS\xa8\x80\xb75\u0360KT\x10\u0595\xee\r\x12\xf2\x0e\xb0\xd2\xed\xf9\xab\xe3W\xf5\xe9u:\x1e\u010d\xfd\xe8\x87x\x9a\xd25\v\x1b\x98gC\xeb\x06\xa5oJ^\xf3\xa6\x83F\xbfD\x13\xfb]\x970jI\x1eM\xaf0Yk\xe10=A[j/\x15\x94\xabN\r\xa2\x83I\x8e\xb7AV\xe1\x89\u03f8\xd1\x03C\x06\x8d\xc1&?~H\a\tb\xac\xfb\rgM\xd5\u0793\xb6\r\t\x90}W \xa9\xb67\xa8\xdaLn\xa37\xc95\xec\xdaz\xed\xe2G\xf8\x1f\x9e\xb0\xdc\u0613\xa8F\x89Q\xae\x05\xce}\x04\xe9)<\x88\xf3\u0673\xf1 \xf9l\xb9\xa1,\xd7\xf6\x16\t\xf9Y\xd7\x15\x8cF5\xfb\xf8v,\xd7I\xea@\x17\u0532\x8c\xa3\xcc\ue4c3\x92=\x8b\xa4\xd8t\xa2\xe9\xf7n-\ua532\x9eA!;lU\xde-\u0501](\x8f-\xf814\xb7\rO\xb6B\xaf\t\x87\xd8Y\u0189\xeehp\x9c\x8eMN\xfb/e\x8d#\a\xb2\xa8\xf5\xa0\x19F\xb4\x05\u076alR\xb5@\xad\xaf0@\x93A\x1b:\x10\xf8\x93\xdf{\xa1\xe9\xe0\xf3\x89\xdeX\xa8\a_\xc9P$\xbf2\xbd~T\x97\x8bxM\xe7\xf8\x1a\x16\x8b\x93I\x9e\xba\x1d\u875e\x9f\xbc\x11\x8f\u0518\x1cd(\xa6\x1f`\xc4\rf\x03{\xfcU\xb4A\x9c\xa0Ji\u00c8,\xb9y.\x01\x95\xf6\xf1\x0f\xdb\xf4\xe3\xda\xee\xd3_\xf3\xfbG\xfa\xfd\xa3\xf9\x1d\xd3\xcf\xcf\xed\x1d\xf3\xe0R\x1e\xec\x9a\aIM\xc2i\x99\aWR\xa2o\x1e\x8c\xe5Al\x1eL\xe5\xc1\xc0<\x98\u0243=\xf3\xe0\x93<\xb0@?\u00c3`d\x86\x03\xfcd\xb4T\x95\x87\xff\xfb\x9f\xba_\xf8\xf4\xf7\u0426,\xb2\x92=\x1d\t*\x9c\xc0\xdb\r#\xd9JO\u6fec'\x9b\xbfBO\xac\xdeS\xb9\x96\x00\xfaa\x84HXi\u062a\xf0Q\x10\xa9\xb8P\xa3\x92\xb92\"\x11c\xfc\xbe\xbb8\x82J\x96\xae\x9b\x11B\x03\x17\xf2\xf2\xfd\u04cas\x80v4\xe0gv\x159\ud2d999g\f<\xd6-\xa2\xe5,\x9b\xb0i\xa6Nd\xd5\x02K\u2b22\x8c}e\x0e\x129\x99mT\xee\xd4\xf0d\xe7\xe3\u92c5\u0433\xdf<\xb3\xb3\x99\xbe\xdd#\x03\x98|\x12\x8f\xf1\"\xe5\xed\xd99+\xbcE\xd3NE\x1f]\x0f\xb3\xcbx\xf8HN\xbf\xe8j\x18_\x7f\u0749_bX5\xd1VU\x84\x00\xc6&\x8f[\xadZ_dl\xa7h\xd5A\xbf\xf7\xa3\xb3I<v\xe6\xc0\xc62\x9da\u0239g\x00W\x1d\xb7\x88\x11\xf1\xf4\x0e\x9e\x9a\x92\x85c\u05e1)\x16\x049\xb6\bs\ra\\\xb4\xdf\x1b\x16\xf9\xa1kd\xa9 `-\x14\x19_\xcd\xdc8\u0784\xaf\b\xcb\x1a\xedT\u1b6c\x11w\xca?\x16z\\r%\xd427\xcc}\xb4'^\xb4\xd0\u04bc^c\xaa\xa3\xb4A$\x10\x1c0(\xff\x8as\x81\bQ\xb8\xee\xf4\x99U\xb1\xf8a\x86\x0e\x10\x7f\x98\xe6\xe4\xa3GNU\xd18\x1b\xaf\xc1\xa16K8\u072b\x87\xfcb\x1cl\xce\u0488\xc7\xee\x90\x1b\xfd\xe9\x16\xa2\xb6Un\x85\xd6B\xdc\x19\x85\xda\xeb?\xe6\xeb-\xb4sw\xf4\xebA`\tk\xd9M(\v\xd2\u02c8C#V\u0b09Te.\x94\xd5\xf4\x19\xee\xd80\x8f\x1e\u07e8pI\xc3vx\xb6\xdabH\x13\xe1P=\ue9d5\"\xe4WW^) \x9dk\x9d\xc6*\xdaY\f9\f\xab\x88\xbbA-\xef\x13\u0300E\x06\"\xb4Q\xbcK\fC\xe2\x1d\xf7\xb4\xaa\x19\xcc\a\xad\x7f\xfb\xe7pGBG\xf7D\x14\x98\xd0\a}\xbf\x0e\u009c\x87\xcfE\fW\u04c1\xfc\x96\xdaz/\xb4\x17\x10\xfb&\xd1%9\x19\u0773\xe6Z\xac\x9b\xad\v\xa3\x92\xa8\x91\x15\x05\x14\x9f\xe3\xc5\x1b\x872\xa0\xbc\x064\xd0q6\x1d\xc1\x8e\xfdK\xe2|\x00\xd3\xf1d>\xa3\x8b\xddK\xb2\xaa\x84CR$\xf4\xe8\x11&l[\xeb=b\xff\"\xbeL\x96\x1f\xe4\"\x1a?b+F\xbcY\xee\xa39b2\xd0Q?\xf7\xa3\x97\xd4wr\xeb\x87\xd6\u047b\x11Wd\bl\a\xdd\r/\xbfoZ8k\xfe\x05!\xb3\xac\x94\x9dq\xdfz\xe2\xc0\x13\x1c\u00fe\xf1\u023117\xd1n\x14\u04c3S\u0716\xa3W/\xcf\u07fc\xf2J\xf5\x9e#\x14r\u07c1_/N\xce{\xfb\u018dG-\xd4\x1fl\ua8b9r\x8bX\xbcB\xaf\x91\x84q\xe0/\xc4Q\f\xf36\u0120pW3\x8c4aQ\x99\b\xece\u048f\xe7&'\x16\xae\xdf\b\x13\xa7\xb1=!\x99[\x98H\xe0\xd6f\n\u38e0\x1d(.\xa7\u01350\xf10\u0181\xed\n4\xf11\x91e=9;z\u0534\xe1\x12\xfa\x19.\x9b\xb0E\xa6/\xd9\x159\x96\xa9\u93e2gd\xfa\x0f\xf0R8\a\x12\xf6\xf2e\x80\xdd\x1d\x8d5m`\xf8\x1f\xfd\x95P\xd4t_5\a\xd2\r\xfe\x94_\t\xfd\xaa\xc0S\xccX\x8aQ:\fC\xd6W\xa8\xa12R\x99\x94W0\xe6G\x02}@\u07c0\xf9e\xe0\x12\xf9\xc9\x16\xfcU\xf6\x81w\x9d\xbdx/\u060b\xdd\x03c?{\xee\xf2\xec\xc0\xfc\xf4^\x03]\xee\xee4\xf9\x97\xf9z\xda\u064f:\x9d.}\xed\xe2\xd7\r\xfa\xba\x81_7\xe9\xeb&~\u0762\xaf[\xf8u\x9b\xben\xe3W\x86\xb0\x83_w\xe9\xeb.~\u0763\xaf{\xf0\xb5\xdb\xe6&\xda\xf8\xbd\xc3\u07f1\xbd.\xb7\xd7\xc1\x06\xbb\x1bM\t\x89\xf1\x06\u03e8\xdb\f\xbb\xfb\xea%\xf4u\x93\x00\x9d\xbf{\xb5\x1fm\x11\xa0\xf3\xef\u07dc\xc0\xf3-\x86\x04\xc7\r|gH\xcf~\xc0\xe7\xd4\xf5\xb3g\xff\x17\xbeR\xd7\xcfN~8y\t?\xa8\xf3'\x98\xa0\r~P\xf7_>\xc3\x06\xb6\xa8\xff\x7f<y\x03-l\xd2\x000\t\xd1\xd9\xeb\xde\x11\xbc\xe4\xdf\xf0\xcb|=\xa3/\xaa\xab7\u04c4\x82\xff\x9d\xf7\x0e\xf7#\xea\xeb\x7f@\x11\xea\xdc;\xf8\xc23\xbd\x1fm\xd3+\xe8\xeb.\xf5\x15\xfa\xb0K\xbd\xfbO\xf8B\xaf\xde\xc2\x17\xea\xe2\xb3\xfdh\x87\xc6\x00\xfd\u0661W\xd8x[7\n'\x14\xc5\xff\u017c\xdf\x1f0\xb5\x1b\xac#\xcd\r>\b\x7f\x9b\xef@\xb9\xb6\xa9\x01\x1c\x025p\fOx\u0160%*\xf3\x1d|\xa1\xae\x7f\x0f_\xa8\xa3\xbf\x87/\xd4Q\x80\xb9C\u0541>\xeel\v\x05}\x97\x90\xf0\x98\x8c\xc9~\x11\xf6\x82\xbd/\xbcN\u0238\b]\xd2\u0415\x06]\x10\xb9\x94\xa8;$ 3l\xe4N\x9ba\x19\"\x87\x940\x02\x01p\x02\xf4\x8b\x03CS\xc2\x04\xb4\xf3\xa7\xdd{\x89\u446c\xf1S\xf4 \xb8\xa3\xfd\x04\x1b\x12##H\xb7\b\x84\xa1\x85\xf9:\xf0\x90\xd7\xc0\xc3R\x04i\x13\xf1U\xfa\x17\x0f\xa1#\x03\xdc\xcf\x1c\x98\xe6\xcet\x8c\xfd\xd9\xc8l<\xe3\xe0eT\x91\xa3O\xc0HP\x7fl\xc91\x91\x0e!\xd0\x11y\x0e\xa7}\x91Nq\xf51\xa33\xe08\xcd9\xfc0_\u07dc\x9c\xbf}\xf3R\xfd\xe2\xafj\x99S\xb2\x00\x8b\xfe\b\x88E\xcb\x038\xbdK\v\x06\x1bw\x9b0\xeb\axB\x8b\x01\u0237\xcdH\r\xcbCe^\xc0\x97\x1d\x03\xeed\xd6GH\x82\xd5\x1b\xb4\xb4\x88\xd4\xfc\xed\xf5\x9bg/\xcf?\x9c\x1d\xc1\u0182\xea\x9b\xf2\xec\x1c\xe9\x03\xff\x80W\xaf\x9e?\x17T\xc3l\xa1\xfc\xec\xb9\xfbE\xc9@\xe1\xd7\x1e\xff\xb0_9\x8b'\xc0\u0652_\xe6+\xe6\xe5\x84\xf6\xa9\u03ef{\u07dd|x\x8b\u0761\xa9\xc0\\\x9b\xe6\xfb\xf1\xc9\xf3\x93s$\x03\xdb\xf2\xcb|=y\t\u8ef1e\xabc\x02Gx\xb0\xc9\x00\x82_\xf6;\x01\xa6\xe9\xe1\x12\x9b4\xafo\x98*lP\x8f1\xf3\"|\xa7\xe9\x95\u03098\xcaM3\x95\x9c\x87\x10w\xc4k\xa0h{\u0519?\xbc\x06\x82\xb6\xb7\xc3_\x81\x9e\xed\xed\xf2W \xa0{{\xfc\x15\th\xbb\xcd\u07d1\x82\xb6;\xfc\x1dIh\xbb\xcb\u07d1\x86\xb67\xf8;\x12\xd16\xef\xbc\xd7HE\xdb[\xfc\xfd\xc3\xeb\xe7o\xcf\xf0\xb7\xb4\xf6\xa1w|\xac\x7f\xbex\xf6\x92\xdfK\xbb\x1f\xce\xde\x1e\x9e\xbf\xe9\x1d\x9d{\xcf\xce{\x88\x91\xedmS\xe9\xed\xf3\xf3g\xaf\x9f\xff\xa7~v\xfc\xec\x87g\xc7'H\xca;\xe6\xc9\xc9\u0473\x17\xbd\xe7\xf8\xa8m:s\xf2\xe6\u066bcy\xf2 H\xf56J\x06)\xf1\x1a\x98\x0e\xf2e\xef\x87g\xdf\xf5\xceO> u\x85\n\x82\xad\xe6\xe9\xe9\xab7\xefzo\x10\x12#6'Z\u00dfL\xa1\xde\x02\xfa\x19\x04\xed0\xf9z\xf7\xec%,\xe2\x87W?\x9c\xbc\xf9\xe1\xd9\xc9;|\xdee\xec\xc3\xe5|yrvF8\xd5\xe5\xb3J=\xe5\xa5\xefvv4\x0f\xf7L\xb1\xe1b\x83\x8e2\x80\xbb\xeb_v\xf2\x1a\v\x86\x03\xdf\x04\xfd\xf5\xd4$\x8aq\x11g\x90R:\x87\xab\xfc.\x9f\x01i!>\x8b\xc2>\x19\xe5\x11Ut\xe6\xdf\x1c\xf8a\x7fih\x88\xa6gs\xfe.\xc6X\x87\x14A\xfe\x11\u0181\xc0\xe0,\x8f\x18t\u04c5b1o\"\x13!>\b\x8a-]\x90\xa8A\xfb\xcb\x03\v\xf9\x9dx\x1eD\xb7\xe2\u0602\xfe\xf8%\xe2\x95\xf4\u01b5\x89!F\xf6\x97\x84 \xf1[;s\xe92\x8c\xcf\x0fI\xb8\x98\x81\x05\x98M\aZ\xe7\x1fR\xfaYS\xc9\x1aaV\xe7+\xba_x\x98{t\x13\x1d\xba\xcb:\x8a\u079f\xf7\xeb\xea\u05e6\xd9X\xdeYA\x91YV\x98\xd2\xf3\f\xb8\xce\u057bisd\xfd\x95zx\x99\xcdf\x12H\xc8\xeb\xe4!=\xff\x1b\xf7\xd3%\f\xb1\u0764\xa0\xb3%\xb9A\xa4\xbb\x1c\xd1\u037e_\xa5\xbf\xc5\xc4\x1f\xf7\fd\xb4\x826\xc7\x06g\xfb \x99\x13\xff\xd1\xddk\x95\x83\x13~\xbd\u00bbf\xfcr\x06l&\x8cO\xfb6\xbd\xb6\x83\x7f\xc1c\u01c4[\xec\x92H\x93\x81t\x8d\xb5\xe2 \xf4\x9d\x9d}\xafB\xd9)\x1d\rGp\x17\x9d\xf0P\xc2>\xc6\x18zu\x90L\xc9V\x81\xb5\xab|\xc7\xd2\xcf\xc6c\t;\t\x1c-\x0e\xc1?\x92\n]\xd2\xfa\x7f\xae\xf0L\xc2\x12\xe0\xa8\n\xe5\xddMJS\x90D\xbcEe\xfc\xc5\x10\xab~\xb4S\u018bu\u04f7u\u04ad\xdbv\x8d\xea\x1f`\xe6\xce\xf0\xb5\xd0\ai\u04bd\xa0;\x03v*@\xe16\xaf#\x80F1\xe4\xc2\xc7 \xf3\x10\xbb\xd588X\xa0I\xad_\xc0\xb7\xf7\x17\x9d\xf7\x8d\x8aH0U]C\x13\xed\xeb\x8c\\\x9bYO\xb7\xbc\xa0\xddfhba\xbe\xd7V\xaa\u065bL`\u05cb\x8e\xbf\xe6~\xadV\x1b\xf7\xa0\xf1e\xac\xd9\x1f\xab\xd5=\xc3\x1d\x83c\xac\xf1\xb7\x15k\x11}bK\x93\x9a\xfd\xb1Z\u07531ln\xa9j\xbe\xafV\xf3E\x9a\xf7\x93\xe10\x1e'\u065c\xba\xec=P*\xda\u7c95\\\u0766\xddf\xe8\x17\x9d\xe6\x93a|\u01cf\xd0juBr\x1f\x9d\x0f\x8dE\x9b\xcct\x06c\x87\x89%\xb1\t\x03\xf4S\x94\x0e\xf6\xa3{-uS\xa8\xf8\xe7\u067e^\xf3\xa8\x8e\xe1\a\xa1\xc7\xfdl\x98a\xf2\x87t\x040\xf2F\x8d\xae\x97Wn\xc7\xe2\x81\xd7\f\xe7F\x88\x18A\xee\a\u042c\x95\a\xcf.\xe0\xfd`\x99\xdd\xe1\xc1\xb2[\xe6~\xb0,\xfay\xc0\x1cR\xde\x13\x1a\xed\x02\x1f\x14o\x8c\xfb\xc1\xf1P\xd3\x03\x87oZ\xb5/\x14\x19\xea\xc1\xea\x94QD\rTO\xaf]O\xd7Fp@\xd60\xf2\xe7\xc5}\xa6\x9b\x8c\u05a97\x17\xf4-\xaa\x8d\x81\t5\xc1\xab\xd6$r\x15\xea\xa5\xcdw:\xaf\xe9\a'w\xaeq\xb8X<\xb8z\xc3\xd9wH\xe2grN\xdd\x00\xbb\xf2\xa7w7\xc9|\n\xdb/\xed\xb7~\x1c\xcb=RM}\xaba\xbbhA\x02\\A\xc6u\x9dF{\x1c\x7fJ\xafc\f\x9e\x00\x13w=\x87a\uceea|\xf0\xfcXK\xc6k\xf3\xfc\xc7Zt\xf0\r\xfc\xc0\xee\xff\b\xfd$\xcf\x04zb;\xfc\xa3\xdf,\x15\u070f\x8e\u04dc\x83&\x8c\xefd\x00\xd3dH\xe6>\xa3\xf9\x18Or\xddm;+\xd4\xe1<\x9f\x8f\xd8%\xee\t\u0514\x90l\x04\u00ebcfO\xd5!E\xff\xa2:\xaa\u04f6\x12sU%\xb58\xd3z\xcdK\x10\xba\x96\xe6k~\xee\u03ef@\x0e\tUW\xc3\x10;lUS{v\x85AU\x9b\x11\xec\x80L\u0739\x9d\u020f)\xa9l\xbe\u03f5o0\xc3\xe94\x19\xc5\x13\x17[\u030c\xd0\xeb+:}&h\xa2\x9b\aIN\xf5\xc8d<\xbf\xce(\xce@\"\xbd\xbdIl\xf0{\x93\xaf\x15\xa4\xf8\x9c\x03x`[\xf4\beg|0@\x1c\x1e\xf7g\xa6\xac\xd79\x94\xa4\xf35\f\x9e\xf1\x15\xfd\xab\xb1\xf9\fw\xed\xc2\xfe\x8aj\xbbk\x97)\xed9\x11\x9c\xd7\xd0mDv\u0751\t\xc7zSLY\u02f2\xf4\xa0t\xbfEb\xac\xd3\xe2\xffEg\x14||L7>\u0225\xa6\x9f[\xba0u\xa1e\n\xf7\x06\x83\xa8\xd3\xdd5\x82\xd5|L\x17l\xb0r\u028d=\xb7y\xf9<@j\b\x00\u022a%<\xed\x03\xabJ8\a\x87\x84\"\xd1j\x83p\xe7\xbb\xff\xe5\xf1\xffc\xef\xdd\x1b\x9bH\xb2<\xd1\xff\xf9\x14\t\xb3S\x92\nI\x18z\xaa\xa6\xda\xc6\xd5\v\x06\xba\u0606\x82\u0166\xe8Y\x8afRR\xda\xceFRj2%\x1bw\x15\xfb\xd9o\x9cW\u0109\xc8\xc8T\xcaP==sw\xee\xde.\xac\u030c\xe7\x89\x13\xe7\xf9;W\xe0\x88\xea\xa3L}Y,\x7f\ueb71\xc2\x0e\u5ec2\xc4lN4`\x92q\x91\x1dl\xb6\xb99\u9401\xccp\xf7\xfd\xea\b0t\x041\x86Uw\u03bdA\u03f4'd\xb1\x99\x01L\xc6hb\x860\xaa\xe0\xc6\xe8L\x1a|\xe5\xa0\xfa12+\x83\x1a\xd0>\xc9\xd7\xd0lq\a\x1aeR\u0794\xf2\xaf\u05ef\x9eI\x8e\xb9\xd5-\xe1\xc5\x04{\aP\xca\xc5j}%Q\x8c0\x85e\x91\xf00\xf1EK\u04b3\xac\xfa`\x84\xa0\u0472X[\x84f\x9c\xc8\xceS\x88s\x10\x02\xc2\xf4\x06Y\x89\x92\x06\xa7\xff\x8c\xb0R0&{\x8a\x91\xdbf\v\xded\x13\xcb>~T\x03\x1b#dN\u01589\x97\xbf\x1b\x17\xe5\u065d\x93Ww\xf4\xe0\xab;\xdeY\xa0\x7f<\"\xa9\x0f\x16\xc3{\xd7\xf0\xac\xff\xd8\xe4\x00\x8f\xb4\x82\x11V\x15\uee04\x87m\xb0J\xc0\x9b\xf3\x8c\x91h\xa4Y\xcaD\x87\xe3\a\x18\x05pBp\x92\xb8V\x8cE\xbf^g\x8b\x15>K\xab\x0f\u03b1\t;\xa1z\x92\x06\xf3\xd3\xc4(|\x00\xbaP^\x8d\xa9\x80\xa6\xd4T1Z\xe6\x15\xc2\x04W\xe7\x1c\u04e1\x1b\x80\xe1\x03\xcc#\x15:\x91\xe6f\x18\xa1c\xa4`\xc2AZ\xfbU\xa6\x89\xae\xa3\x1c\x83\u067b\x91U\x8c\x82M\x85\xaa\xb8\xc8Mr\xcb[\xb7[z\x10\x88\x15\xa9\xfe6\x93v#!i\xdb\xfb\xd8\u049e\xdb\xff\x11\u02bb\x9dIN\xc9\xd1FJ9\x9b\xf4\xef~\v\x11\x90\x18\x05\x89\x02\r\xb6F4x\xe2\x13\x1a>\"~\x04 \xe38?s6(C\x9e\x1e:\f\xa2\xd8HQ\"\xbf\xdeHah\x92\xb6C\xeb}|\xcc1\x8e|\x98\xd5@\xb1\x9f\x86\x93L\xcfb;\xa8A\x114\xd73\xac\xa3/g\xe7\xac(\xc6g\xf3;F<\x9d\x9d\xfci\xa0\xdf22\xb3\x19\xad\x111\xd3Y\x0e\x85 @;\"\xd5h\x98L0\xcc\xd4hQ\x83\u0222\x00\xb2\xf1\xdfkM\x10\x7f\xd9,\xcc#\x01\xd6ZC\xa9\xa0e\x16\xdb,\x89\xbe\xfb\xbb\x8d\u0346\xfb\xed\xb29w\xf7\xfe\x19\xfe\x7f\xfd\xd3\x14}\xa8zF$h\x91\xf4\xf1\xe5\x05=f\xd3<%\x12\xd5\u0601\x8b\xae\x83\x87\xc7I\xdf\b\xd5\x10\xd9\r\"w\xfa!M\xfe\xf2\xc3\x00\n\x17\xda\xc2\x162x\xbf\x11\f@Q\ra#\xffz\xfas\xcfn\x97\x15(FF|\x1c\tp\x7fu\xad-c\xc5\x06\xf7Hb\xc3\xc5\xfa\xe6\xa0E\x10\x15\x83A+\xc6\x1c\u04d2B\xcc.F\xf5\x03$\uf405\x87\f\xb0\x9d\xcdvPH\\\xcf\"Ir9F'\v\xc1E\x80vK\x81\xdc\xe7DX\xd5\x13Cn\xd8k\xc4\xc8\r^\x9f\x86\x83W\xd9\xfctLUi\x00\xaf\xcd\x1b\x10\x0e%\x1c\x80m\xaa4\xd7G~\xe1\x8bg\xe1H\x10\xa8\x85\x18\xb2~\u0451\xaa\xa2\xd5\x06b\x85\xb5\xf8\xe5\xd6\u07ad\xfd_n\u077e\xb5\x7f\xeb\xe7\x9f7\xf7\xee\xfe\xfe\u07ad\xa1\xf9\xff\xe4\xaf=\xf3\xef\x91\xfd\xeb\xae\xf9kl\xff\xfa\u076d\xa1\x1b24\x83\xbf\x7f\xf3\xddw\xb7>}R\xf2\x14Vq\x1a\x199$\xfb\x98w\x97\xb2}\xad\x9b)Z\x93\xf9\x1b\xd6\x02\x90\x87\xe2\u074c\x1dQ\xd9g\xaazuIw\xbd\xad\x15\x92\xc0\b\xf45\xb0\x9e\x9e\x1b1\xcd\xe80\xc8\x15\xae9\xb4\xb6#Xl\xd6\x10\xfb\x04$+EM\x80b\xcdPfe\n\x00\xac`%Z\xe1\xf6\x1a\x8eC\x12*@/\xda\xe3W\xa6\xac\xea@\xb8\x02\u0086\x03\x1a\xdcEF\x15\xd1\u03b3\xf4\xe2J:A\xb5\x0e\x96b\x91~\xf0+eHch)\xe3(\f\xf4V1\xba\xd1\x1a\x97\t\x10\x86\x00\x06:_\xaa5\xa2\xd5\x19\xe1\xa0F\x93\xcd\xec,\xbb\xf6\x16\xde\xdd\x1bbR\xaa\xec\x1f\xdc\xd5\xc1\x16\x10\xcfZ\xe7\v\xf4\xe1.\x8c\xeceX\x11@K\xe2y_\xae\xdd*R\xf5:\x9c\xb7\x15\xbb\x96t\xaa\x82\xa5\x04\xaeF/R\x90\x9e\xe1H\xc9e\n\x98\xf3\xa2\xc6,At\xa0we\u06a0\x83\x98i\u00d1\xfd\xcd)c\x96\x01\xab!\xaa0\xc79_S\t<\x14hR\x94q\xa8J\x84\xabw\xa1fL\xd2\xf5\x1b\x1c.\x14\x9a@\x90\xce`\x83q=\x01O\u07d0\x1c\xb6(E\x8a .o\x9c\xd8\xe6\xde`i\xd3\tH\xa0\x97\x91\xcdq,\x1e\xd1\x00G\x13\x80\x03\xbc\x16_\x8f\xacK\xfd4c\xf3\x12|o\xfaS0\x98\u0451\x8c\xa6W\xd3\xf9\xf5\u0116\xb7w\xf7\xf6\xf6\xa0>\xd2\xde;\xff\xba\u9768\xeeq<P[ \xa4\u0368t\xf0\x00\xa2\u148c\x80]\x85\xeb\xbb\x041#qP\x1aYN\x86\x80y!\x99'\u051bC\xe7\xb2j\n\x96\u0402\x0e\xbdo\xf2\xb5z\xb78=\r\xd7\xe6\xf3D\xf1\xb4\x7f\xef\x9bo\x86P\x00\v\xfe\xdf\xf8\x9b\x01\xafK(\x92\x93\xa8\xcdb\xd4\x05\xe3L\xd2\b\u0700\xe0\x1ds\xa4\xa02c\xf6\xc5%\x83\xde\v\xa9\x11D\xc6v\xd1JE\xff\xe7~\xa3{\xa5\ub046r\x05]\xe6\x04\xc0&2\x06\x04\x9d\x85\xef\xd9mb\x8c]\x12C\xd0\xfe7c\x88\xff\x16\xa1\xc4J\x02\xf6h\x83\f#!i\x98$\xc0\\\xc1.v\u06c4\x10\x93\xa7aJs\x8c\xb2\x03\xa3\xe9\x14\xe2F\xb0-\x8ayc\x94`\xc7]\bN,\xf9\xa7W\x7f|84\xff\xfb\xea\x8f\x7f|h\xfe\x01\x1a\xdax<\x1e\xe0\xbfR\xfe'\xd6\u02c36\xb1=\nzw\"d\xba\xe6\b\xde\n*\xba\x96k\xa1\x94j]L?$\x7f\xbe{\x17\x9a\x1a\xaf\x81\r\x83\x8776\xa5\x7f+68\x1fp\xfd\x8a\xe9\x99r\xb3`rW\x0euN6\x9c\x04%w6\x80\xadHc\x93\x8c\vF\xcdd\u04b9\x8d\x01G\v\u0447|\xb5BH\xe0\xa4Z@\xdc1\xe5\xf7`\x92\x00\xc0\u0729\xc9Y\x19\xc3\nfQ\nR\xa7`u\x05\xc2\x10\x15\xc6\xebL\xfc\xce\a\x14\x11\x85\xc0\x00\x0fW\xde\x14C \xa9vu\x81>r[\xf0PHG\n8\xdb\xf1\x98\xd7F\xbcd#\x12\x9bFX\xa9\xfa\x1a\x03ka\xebk\x17g)\xfb\xc32\x1a\x95U\xe7\u02acv\x91 rbdG?B\x8c\x9fk\x8f\xabYvD\xa1Q\xc2:\xdcb\x11\xa4\x10t\xe7]{\xe0AX\xcd7\xd5h\x01\x85\xbcF\x00\x119\x82:M\xd7P\xdb\xeaC\xb2\x82\x01\x06\xbdCP\xec\x1d\xac\x17v\a\n\x86\xf95\xbc\xd4\xf90_\xf1\xaa+@\xc1\u058f\xf9M|\x8c:\\\x95\xfc\u5f55\xe3{\xaew\xfcT\xd5\xed\xf5\x96a\xba\xdbf\xb4\xea\xab\u8181\xac\x85\x15\xb8\xe8sY\a)\xd5n\xf6\b\x82\xd9\xe0\x01~\xacf\x8f_\xe2\x9c\xcd\xf7<\x17\xef\x03j\u0275L\rx3\x91*\xcf_n*?Q\x81\xc2\xdaT~\xea8\x95\x9fd*?\u0567\xe2Z\xf6\xa7\x020\x8f\xa3\xb4\xcaSsV\x16\x93\xfclc\x8e\xbf\xf9{dd\x10\x90\x006\x8b\xe5\x97w\xbf<\x06h\xc9\a\xd0g\xf2@\xfa\u0539\x83T\x8a\xf3\x12\xe8\x0f\x06\x90`\x11^7bD<\x1f\xa1\x9bb\xc4\x14\xfae\u0188uP\xcc\xca1\xa6:\xf6\xe0j\xd6\xd9\xf1I=&\x80.\xa5:)\x10)\x1e\xbd{\xded?\xf7 \xe0)\xabV\xa4\xf9\xe3\xbcF\x93+#\v\x02:\xb5$\x90\xad15\xa6\u0795\xd3\xe6\xb233\xea9\xb8Ll\x94\x14\u0569\x0e\xd7eR\xccg\x9f#\x19\xad\xc1sk\xde\xd0k\xe2\u0546\x01v\f\x9d\x98\x9f\xd0;\x89\x85\x12}C*\x85\xe0\xcdgw&\xe4\xc0\xb4.@\xb1\xa8\x9a\xcb\U000c9b21\r\xa3\xc7\xfc\x1f\xdd*T\t\xdf\xcc1\xa8/\xb5\x9e\xe2\xd8|\x81`\xa9\xabk\u037c\xceS\x1bfM\xb3a1\xb1\xff\xdd\xe8\xee7\xe0iJ\x93\xbb\xdf\xfa\xa2\xd5\xc0\xce\x18\xe3p\x8dtS_\x9b\xa4\xbe\x18\x85\xd8\xd0js\xbc\xb6\xc2\xd4ej\x9a:IW\x89\xee\x13\xd3z\x8e\x8a\x9f?>+\x1c\xa0\xfbh\asd\xeb]{\f\xaaJ* \xd4\"\x96[\x17\x92\x95\x9f\x90\xd1]\x96\x90\x85\xdc,\xad\xd4F\x8a\x1f|!)\xca\xd6\xd4\u01a1@\x15zh<\x99\xe5eF\xa5V\xb8\x88:\xc5=7\x0e\xce\xe8\xf3w\xef}A\x93\xc1+\xb5\xb10\xb2\x9f{\x95\xf6H\xa9\u02a7\x9e\xa6\n\xc7\x7f\x03R-\u0231B\u020f\x1e\x1f\xd92V\x88\xc8\x7f\xf7\x9e\x1a\xfeE^\x16K\xd0W\xaf;\xfa_z'\x8f_=\a8\x0f\xf4#\x8f\xee}\xf3-i\x8a\x84\xa7QS\xadE\x16T]C\xb0!\xa24UC\u07f2+\xc3\x04\x962:M\x8d\x02~u\x9d\xb3\x84}\xdfz\x94\xfd5\xfdi\x93\x1cC4\xc6\xf3bY\xdc\x1a&\xb7\x1e\x03+7\x8c\x80\xff~Rf\x19\xfc\xd3<y\x9e-\xe7\xf8\xca\tS\xad3|\xf6\x16\xe6\x152\u0787\xee\x05\xf6h0g\xc5\x01\xd7*\xb3 G\xf1\xa7vm\xe7\xcb\xddo<\xfb\x9a^_W\x05\xd7\x1c\xbfU\xfe\x11*\xfa\xfa\x9d.\n\x12\xf3\xaeg)H\x97\x00\xef\x059\x97\xb3\xa8\x97\xc5\xef\xc3j\xbbj\f\xe6f\xfc\"\xae\xc3{\xff\xb27L\xe4\x7f\xa2\xdeC\xd7\xd75\xbd\x87\xe7\xc5\"\x83h\x88jD\xb1\xdf_\xd8k\x03\xcd\xdf\u026c\x13\u0755\x88uD#1\xe7\xe4\x15\xa0B\xbe\xf63\xab\x98\xc2\xe76Q\xe4\xa7\x13)\xafY\x91\xfd\x82\x85\x1f\xe0\xbe\xf6S\x92;\u036b\x94\x14\x9d\xaa\u0582Nh\x04nM i\x8fK\x1b^7\x94\xcd\xe7\x0e\x0f0\xe9\x0fb\xa8=\x98\xf3\xc2K\xecA\xdc|e\x17\x95,`\x01\xefwg\xb4\xf4ks\xb6#\xf1\xfb0\xfcPI\x1e$\x1a\xd5\xdey\xf61\x95\x9f\xc92\x80Q\xa9\u0710K.\xe2\xe6$\u00e8f\x8e\xb1\x02\x958\x84m\x95e\x97\xc43d\xdb\x13\u01efx\x8d?\xc1>OA\xb8\x92\xa6\xa0\x84\xb6Yj|\x97\x8d,\x10\t\x93b\xd2P\x96\x04N\xe3go^-geT\xe6=F_Q\xa26V99\x7f\xd1\xceMF\x16\x98\xafG\x7f\xba\xb5\x9f\xdc\n\xb2\x1en\r\xeb\uf49a\xfa\f\u0786,\xa0\xd8+?\xc0\u00df{?<~\xf6\xec\xc5\xcf?/\x7f\xee\xddr\xef|\x12\xaa[\xa4\x1fG\xb4r#!\x82\xce\xd4gc`!\xbd\x0f\u037f\x8aw>O?&\fP\x83\x95\xb1\x1e\x1d\x1d\x0f\x93\x17\xc7G\xc3\xe4\xe5s\u0710\a/\x8f\x1dUN\xb2S,\xb3H\bE\xc9f\xe5\x9d\x1c\xa7\\\x10\x89\xd9\xc1C\x96\x1d\xf1\x91\xb4\xccF\xa7\xf0\xaf/\xccJ\f\xf30w\xdaZ%\xf41e\xe5e\xf2\x04H\u0565\xfe\x8f\x13gJ\x80r\u055e\xfb\x97\xddH~\xa6W\xa5f\xb2N\u0655\xcd!p_\xc2 \x12F\xfa\u0678>\xe2R\xa9\xc5Sc\xd46\xf2\x1c\xb8A\x81\x01lD\u0458FT\x9b~\xd8Q\xcfo\x15\x15)D\x1f\"vP\x95 c\x9b\xb9%\xd6P\xce\f:\xab\x9a\xed\xcc.\xdc\b\x8e\xf4\x05\xf9\x13f\xd9\n\xdc,Kk\x19\xbdE\xe3\xc71\x8f\xa8\xe5[\x8e\x19\xb3\xce\x18\xeb\x83\x10\v(\x9e\x0en\x00\xde4\xf4}}\xc5\xe3\x85\xdf L6\xc7\xf4\x9c\x92\xc4\xdb`\xe5t\xcf\xd7Y\xb40<\x19\n\xb2\x98Ky\x98\xfcn\x98\xfc\xcb01\xb2\u02b7\x1c\x10\xf9\x1cW\x0f\xfb\xe35\xc4#\xb6\xac\xeb\x8cMQ\x18\ue5619\x85\xa8\xab\x8b:\xba\xc8g0}o\x87(\xecf9\x02\xbb\xb34\xe3\xe2\f\xfbt\x8b\x00e\xd9\xf8X\f\x8dX\x82\xa1\xba\u0581\xa6\x00k^\xa6~\xfaR\xad\xcdh\u0146#_X\xbf\xf4Br\x8f\x18B\x10\xa7~a\x8e\xa8\x1a\xb1\xbb\xbb\xdc\xc8\a\xd1\x15\xd8\x03\xc0 \xdc\xdf\xfe\xaa4wRy5\xe0\xf7\xd5\xebw\xb1\xc4(5\xddO7\x1fs#\xadE_\xbc\a/r\x1a\x18\xb9\x9b\xe2\xef}\x0eU\xd7N\xe5\u07cb\xb4/\v\xa32\"\xfa\xfc\b\xc1\xc4F\xf0\xed5\xa8\x1b\x87\xf3\xf6/?\xff\\\xfd\xfc\xf3\u06df\x7f~\xd7\x1f\xfc\xf2\xe9\xfe\xf7\xb7 \x1a\xe6/7\xff\xe7?\xfd\x8f\x7f\xfe\xea\xeb\xe1\xc1\xfe\xbf\xbf\xab\t\u00ef\xb2\xb3\xcd<\x85P\f\f\x9ce\xcb\xfc9\x04\xa3\xe2\x80X\b \xb8H\xd8QD\xb9\x1bH}F6P7\xac\x0e\x18^\xb0\"(\xf93R\x15=B)n\xa6\xe52C\xf7\x14\xcb Se\xa4\x1ak{\x17\x97\xe4\xbb\xf5\x7f\x19*e|KW!4z\xd9*]\x9f\x03\xc6\f\u0781\xa0\x1c\xe3@\xc56RTY\xf3\x9a\xeff\xe1\xd9u\xd1\xff\xef\xf8\xf3\x96\x9dI?\x83\u008b\x7f\x8fUo\\&:\xac_x\x9d\xde}\xddqm\xb8\xf03'\xe6*S&\xdboht\xbf5!\xba\x7f\xbd\xe6*Sf\x94\x12\t\xe5\xfc5\u0566D\x85NB\x1f,4$\x82\xb3\xda%\x86\x88\x88\xdfPq\xe34\xf5;X\xd3{7\xe5\xcd\xdeB\xb5&:)p\xdeg\x8e\x93\u05949\xea\xcc{;T\xe4\f;\xae {eDz\xcd\xf5\x95\xb9\xc0\x00\xad\xa59g\xb3\x84\xde0\xf7\xe4\xeex\xfc{\x9b\xf5\xcd\xc0W\x8dw\r'J\\\x91\xed\xb0\xdc,\x11\xad\x8b\xe2\xb51$F\x04\xd6u:q\t,P\xed|F\x19\x066\x1e\n\xe2\xc5\xe8\x92\a\xa3\u06ad\u02b0/(!]\xc0\x97\xb7\x1c*\x17\xa0N\xcd\x01\xf6\x00s\x9f)\x84\x1c\xdc\xc9\u04b5\x17\x8fc>Mr4\xd2M\xc0\x88\\:\xa5\x0e\xbd\x03J\n';#\x8e\x8f\x01iT\xb8\a\x97\xe75b\xc1\x02\xa4\xa1l\x91N\xe3'\xc3\u049f]G\x81N\xe7l\x12\xa9\xea&\xeb\x9a(Q\xdf~\xe3Y\r@Ie80\x8b%\x81_\xd1\u07a6\x91|/\x9by\xc1r\x94\xd3m\u0452\x81b\x0f\xc2Az\x84\x86\x1e\xb8\xbf\x1f\xa5\xa1f\xf9\xffH\xed\xf3I\xcd-\xe4\x0e\xb4\xe6>\xfa{\x13\x1bS\x1b\xea\xa9\x7f?j{\x0e\xdd\xfd?j\xfb|js\v\xb9\x03\xb5\xb9\x8f\xfesX\x1b\x12\xdb\xc5\x17\xb7\x84`\xb3?%g\u067aB*#\xa9\b\xa7\xe1Bv1x|\x94IB\xf7\xee&\xb1\xdef}:\xfa\u0388\x8ao\xed\xbfzez\xe9\x12\x87\xc9\x1beK\xc4HW\xa8Z\xcf\xd2u\x9a\xd8\bv\x9b~\x85cl\bV\xcbg\x14>E\x85\xc1\x7f\xa6N\x7f\xee\xa1\xd0\xf23\xf4\xac\x12\fHb\x81\x10*\xa08#_}\xe8.$\xbb\x04\xf3\xb6\b\x9c\x8a\x11i4\b\rz\x88\x97W\x89\xed32\x1e\n\xe9\xbd\xce`\xda\xc4\u02a6\xd18\xec!\xec6\x18\x8f\x91/G\x1c\x87\xf9eV\a\\'`L\x84 3%\xc3.\xb4I\xd3a\xe1\x8c\xe6\xf9\"\xbf\xd6RD\xac\xb1\xd0\xf5\"\xfd\x98/6\v\x15\x88\a\xa7\xd2l\xc7j-*I\r\x89\a\xcdH{\x92eey#\x8c\f\xc3\xfe\xb2\xa4\x98\xcf \xda\x19\x9b\x02\u029b\x95\xc5jE\xeci2/\xa6\x1f0L\xe3\xde7\xdf\xc6f\b\xd1\x1f\u05df\xe6\xb7\xff\x92|\r\x00r\xf2\x9f\xc6\t/\xb2\x05\x80%\"\xd7dvW\x9b(\x8e\xd7\f\xa7\xfa\xcdf<2\xfc'\x9b\x1b\xcd\xf4\n\r\xbd\xa3\xd4(\\\x97\xa3\x9dL\xd6\xed\xe4\x8eW\x0f\xf9\xaa9'\x1a\xf0\xeb\xd1hfF\x90\x99\x87\xb2\xa7\xc0\x13\x1e=>:\xfa\xd3\xf3\xa4\xff`E%8A\t<\"\xe7\xb7L\x9aj7\x8a=\xca\xf4F\x864\x9c\x87\x9c)L[fcR\xb6\xd8\xcc1]\x15fF\xf6\xed\xe8\xa5$\x18E\t8\xe0\x8b2-\xc1\xad;#(\x02\u0721s\xb3\xc4V\x11E\x85\v2\xa7\x1b\xef|eB!\xdc\xde\u034a\xae\x7fZ\fP\xd6 J\x05b\x86\x06\xb0\xbb%[\xbd\x17)\xe9}*\x8f\x95\u0758\xd9,_cd\xcbE~g\x99.\v\xfc\x8cZ\xa3\xa5\xbc\xb3^l>6lpa.\x0e\xb3\x12\xeb\xdc,\xec\x0eb\x92>\xc0uR\xb6\xedY\xff7\xfa\xa0\x93Y67W\x85!=\xda\x15\xde\x0e\x84\x13\xb5\xc4n\xd5Y\xda2|\x13\xf0\xa7(\xc4\f\xd06\xa5\xc21\uad61>\x8b\xd4\xfaw\xb8\tk\x17\xa0H\x19\xde\xd5,<\xfb\xb3F\x94W\xc5\xe8\xde\u07bd{\x02;\xe0\xfev\xa3\xa5\x7f\x8c\xe0Dg3\x19\xac\x8e\b\xb0\xb7\x87\x1dy\xff\u044b\xa3\u3e05\xf9\xe9\xf1\v\xec\x81C\xeaT\x94\x1fA\xb3\x96\u9c9as\nv\x1fa\xa9\xcf\xcatu\x9eO\x11\xba\xb5\u048d\xbe>y2\xfaN\xceK\x95T\x9b\x959D\x82(PTM\xf1\xf9YBS\xa1\u8425\x00ixK\xcf\xd0\xcc.\xb6\x1b\xaa\x8f\x19I\x16\xd3_\xa4)\xb4\xb2\u06f9\x93\xe7\xc8\xc1\x004\x05\x9eK\u02a3\xb9\xfd>\x90\x8d\x93\xe6\xb1Yb,\x1fH\xe0\x142\x05\xc2\"\xd45\xb4I3\xf4\xb6\xe5\xc4\xd9Y:\xbdJR\u01f6\x14\xa5\xa2S4_\x1aQs}\xed\x98\xd4X\xf8\x15\xb0\xa0\xdb\xc9Sl8\x16\x9a\xba\xae\u01e5\xaa\xe0\xf0r4\xad\xaa\xeb'\xdc\xd6@\x0e0i\x1d\x91\xdf*s\x94\xd7T9\x9e\xdc\xf6ah\u062c\x98n $\xa86\x9c\x11\xf0\xb9\xeb\x8f\t\xf9\x11$G\x8f\xfc@\x95M\x05\xa2\x15\u012b \x1f\xc5D\x003Pa\xe6\x16\xa4\x0f\x86\xd3\x068fk_$\x87\x98\x1b\xc9(h\x84\x87\u040fc\xb8\xd9o\x06-\xf8Y\x86\\\u032eM\rwoFb\u06ce\xff\xb7\x99T\x9b\xc9\x7fu\xcc?\x86\a{\r\x1b\xb9\xbeb\xb3\xf2\x86\u0561tfT\xf0\xcdd\x9eW\xe7w\xa04\u01f4\xcc'\u065d\xcd\xd2\xfe\xdb\x02\xec\xa5\xf85U9\x81\x02`\x1f\x11+\xe6Lb\xce4\x82\xd8fr\xbc\x994\x14\xf0-&\xb8\x1ee\xf5\x9e!\xe6\x14@\xed\x037\x98abG@r\x8c\x1e\x92\xd1\xec\u038b\x19\xaa\xd0\xf1\x91\x10\x1e=G'q\b\x15\u0135\xb3o\x8d\x13\x8f\x10\u033e\xd8L\u03f3\x19\x9b\b \xc9(\x87\xcc\xd0d\x99\xe1\xfa@C\x97Ei\xa4J\x02\xe5\x86\xc5\xe3\xb8,\xf2\u0739\xc6\xc3:7D\u029f\xa03\x12'9\x17\x9a\xd6\x1cI@r9\u030f\xf5\xf5\x1b\x9b\xd7\x1e\xca\v\xba\x1e\xcc\u4bee\x82\x19Q(\xd7\x14\xd4_\x13\"\xa6\xad\xe2\xbdP\x95\x89\xa9uw\x8a\x18R\u0434\xfbv\xf1\u039d\x96\xe05\xf3\x8cp\x04\xa9\u02c1\xc5\u0414\xcd;\xb6\xdbC)\\\x84|\x01v\x81S\x89h\xadx\x15S\xd8\\\xbdWa\xb9H~\x8c\xeb&\xff\x06\x13\x8a\xeab\xac\xbf\xb3\x8bC\x8b>\xf8\x94@~\x0f\x8a\xfd\x18\xc7\u018f\x89\x83^\x98k\x87\xe5~\x8d\xcdQ\xdf\x00U\x98\xc7v\xac6\x82\a6\xb4}\xa9\xfa<\xf2\x90N\xa8G\xf6\xbar\x8e\xfb\xf5-\x7f\x00\x1b\xf0\xf6\x9d\xab\x9f\x13yc\xbc\xdaT\xe7}\u06e9w\x82^\xeb\x83K\xd0'\xd7[\xeaM\xd0P\xd7\xe5~\xe0\xfe\xb9*3C\xbb\x9bj\x0e\x88\xf3g\xe6\x8c\"\x12\xa1\x91*\xa8NR\u2db3?h]}=\x96\xed\xeb\x0f\u43a8\xa2\x87\x8d+(%\x8dn\xc2{\xba\x96V\xef\xe9\x92\xca<\xf1\x9bT=\x8b\xff\xb0U\x92r\xd34|i+\x12\xa9\xbd\xa0\x86\xf3\xe4~\xb2\xe75\xfc#\x00\xd9\xc8,f\xf5v\xb1=Hi\x9ef\xfd\xbcV\xa1\xea%1E\x15\x1b\xdep\x90\xec!\x04\xa5F\xbc\x7f\x14p`\xa4\x84S\x94\x15\xdcr\x01\x03\xa4\xf3\x00\txW\u02e9\x19\xeb\x12wll\xd1[\x89\u05d2\xe2\xc7\xf0\xba\x1c\u0115.\xaf\x00\u02d9\xf4\xc6\r\xba1\xe5\xcc\xefHl+\x99\x1eLj\x1cc\xa2Y\xf2\x00\xb2\x03'\xb9\x11\xa0\r3\x16\x06^U\xc54O\xa9\xb4-z\u04d1y+\u0624v\xaa\x85BPP\xb3\xea\xc8R\xefR-\x96b\x1aS,\xa8\x02\xa9nB\xbb\xf0C\xa5\x16\x1b3x&\x19\x19\x85\xed\x1a4\x92\xb4\xcc8F\u0390\xf1\x1e\f\x8c(\u06ce\b\xbb\xb8\x02\xbc\xcf~.\xec\x1bD\x19\u0530\x00\xef\u0088\xf1@\x1e\xbcQ\xb8\u0176\\\x1f79\xe4B4T\x7f\x82\x12\x90\nii\n`\vf\xa7\x8d\x88Re\xf3\x8b\x8c\u1432\x8fPR\x86\xb9e\xe2H\x1d\x89\xd7\x15r\x96\x92\xb2U\xb6>\xa1\x91\xf4\u07481\xbc)\x872\xceR\xd1\x15\xbe~\x9b\xbf\xeb\xab\xca\xf2;\x9ca<\xc2n\r\x10\xea\x13cB\xb0/\xc3~\xb1\xe8N\xbefM\xa7\u24ba\x97Y\xaf\xe4;\xea\x8a*\xec\xf0H\x90\xff\x82\xfch(\x88\x1a\xf7\n\xa0\xc7w\xa6>\x14>\xd1\u022ak\xdfpM1\xc2o\xd4\xefC\xe7\xe1\xdb\xef\x82\xfa\xad\xb6\xa7\x1b\xedk\xbcG,d\x8b\x88Kf\x8e\xff\xae\xb0\u0597Rk\x95\xf1\x9b\xe94\xbe*.\x8f@\u94ff\x8f!\x8d\xc0\xfeub\x14\x9a\a6\x94]#b\xffO\xe8\x1c\xe6p\x91\x1bi\x8b2\xe1Q\x98\xb651+W\x0f\\\a1\x00[\xc0\xd0cX\x18\xc8b\x90BU\x10S\x93/\xd7\xe6\xff\xaf\xbc\u0689\x9c\x9db\xeb\xe8\x12\x12E\x05\x8e\x96|j\xc5_\x89\xc6\xc7jU\xa4\xb3b\xd9\x053BL\xc7\xe1T\xf3\x19\xaa\xfch\x0f[\x14\x88y\x81&M\xebm`\x12\u0410\xdd4-\xe8\u0448\xc2\x00\xcd=\xcffg\x16\xfb)\x86\xe3n\x8b\x9c\aV\xe7b\xa9\xfa \b\x0fZ\x19t\x18Ay\x9c+))\xa3>\xa3\n\xc1\x9c\xa5\x0e\x1c\v\r\xb70\xc3\xca\xe5\xf6\xf3\xb8\xd1%\x95\xca[P\u0526\xa2\x94\xc6j\x03\x97\x144\x85\xda \x98B\xda\x06g\x98\u017aWq\xc8/d\x88\x99\x8f\xf2I\xceZ\x0f-\x1e\xb7Wb\x81\xa2\x92\xf0\b\xe0\x0f\x1a\x9b\xbb\xf7N\u07141\x95\x93\x18\x11\x84\xb8\xa4\u0215*3<\xd3\xc04\xe32fs\xa9\xa2\xc5\xe5\xcbV`22\xa7b<\xc6\x1bl\x84\r\ny2]\xf1\x1e\x15sP\x84.\v~|\xcc\v\x8d\x13\x9eb\x00\u030be&\xc6Dh\x8c\x03\x1fe|H1\xee\rkN\x0e\xe9B\u01b0\x98K\x1f4\x00\xdcD([T\u044eYs\xf9\x0f'\u03df=&L\x0f\f\xc3Y\xca\x00\xe6iy\x86I#K\xb4\x1d\x98\xcd\xc0\xa1C:\xc7ev\x01vk\f.\x83v\xce\xd3\xd5*[\xb2B\xe1\x10\x9c\x80\x7f,\xa1);g(\x04Q0\xfd\xf3]\xc6y\v\x10\xf5oNk\xb9\x01\x1b\x1a\x82\x9cRUl\x00\x983\xdb'\xdb)u^\u02e2X;\x8b\xea\x94\xec\x1c0\x95d\x9d\x9e%\xbd\x8f#\xf3r\x8f\x0e\x16\xee>~\x87=\nePqM\x8bRAL\r\xc2+\x81\xa2f\xd6\xefK@\x15|\xa2\x88\x868\xf0})g\xba\xf1\xb8%\\Y\xce\\\xecd\xe3\xa3\x15\xb74\x05\xa6u\x8fX\xb0\x82\x9e\xad\xb0G`\\\x945H\xb6\x00\x11\x0e\x02\x1a\xd2\x03\xc2\b\xbf\u8893\xa0c\vE\n\x94%h\xa4\x95O\x8d\x91\u3040\xe2(;2\xb7!\xfa\x01\xbee\xfd:\x9c\x14\x8dU^a\x18{\xa1x\tPGgPS\x16\xeeNz\xfb\b_\x8e\xbb\xc3\xe8\r\x015\xca+\x96\xe9,?9\xce2>\xd1T\x7f\xba?\xf0\xf9\xaa\xfd\x15\x1a\u0217\x944\x82l\x1a\xe4Wn\r\x91]\x89~+\xce\xdc, V\x10\x80?\\\x88 B}\xccfhk(\x806\x8bK\x1f\xe0\x8f[\u06c3k\x1fL\xb6\x86\xae.\xf2\x99/]\xf2~\x055c\xd5:\f\x82z= |N\x87\xe8\x1f\x19\xe1\xf9\x85\xe0\x86\u0292&n\x01+\xae\x8e\vp\xa5\x0e\x94\xc7\xe0\x8d\a\x88\xf6b\xb5U(\xc3G\xab\xed%\xb1\xdbEV\rQiU7<\xb0\x04\x85;\xf7\xeb\xaf\xc9w{\xbaa{5B\xae\xd9\x10\x13\x8a\x11\xa09+\xc1<I%\x13\xfdT\xde\xca\xf6\xb5\xf6\xaet\xcfZ\xe2\xdf\xf6}\x8aQ\x18\x8b9u #8\xe2\xde\x11\u0202\xc2\x1d\xf8\x8e\x9e\x16E9C\xacQ\xd7\x1f=z)\xb7\xb7\xee\x8fd\x8f>\xcbgnz\xcbbFG-\xa5\x82\x9a\xc2\x15\xdc-H\xdd\x01\n*\xb7\x8b7h\u0427i\xfeG\xd3\x12\xac(Dil\xeb\x01\xaau\x8bP\xb2kWM\xfd\x14\xa7\xa7\x80\t\x88\x17\x9e\xa2\x03\xbc\xb6\xf5\x97\x0e\xa48\xd6_\xd0\xd9\vl4\xec\xee\x959\xf5\x1f\xb9v%E\xbb\xa2\x1b\xc1l\x88\x8bxu\xbb\x02\xbf?\x84\xa8\xe1\xe7\x10\xb0\xfb\fb\u01a5\xb9\xe8\x1b\xafP\x12n}\xe59e\t\xc8;Jc\x7f\xc5U\x02\x1d\xa7\u00dcRJ\xd3ubg`\xb3\xb4\xa5\xa2\xdd\x1b\x9f\xeaoGj\xb03y\x12\x8f\x13\x1dU\xc4\x1cBF#\x9eW;\xd6\x01\x17Q:\xeaY\xb6\xc6Nkv\\\x1e\xa4#jx\xad_;\xd5\u00c0W\xb0\x868hZ'\x7f\x12v\xf4\xf5\x11{+ey\x7fD\xf8\xdcm\xb2?d\xbc\xe1\xf1\xe9F'\xd3}.\xcd\x1b\xd0e:\xd7\u06fe7x\xf2Z'\xa47\u031b\x8c\xb8k\x9b\xafO\xc0b\xa4\xaa\xab\xf1\xcbx\xda\xe1\nVm4N\xc4\x1c\xfc#u3\xb4\x94\x83\x0f\xee\x14.\v\x7fC\x97\x11\xf783\x7f\x90|\xcf\xef*\xcb,t\xea\xbd\x1b\xfd\xde\f}\xc8\xf3\x1c\x856\xbbW\xa408\x1c;\xd4\x1a|\xa5K\x17\x14\xcd\xeb\\@\x89\xd0D\x10\xae\xa1\x1d\b\x01\xbd\xa5Pl\xb3\x95\x10\u4b6a\x7fw\xf0v\xef]l*\xbe\xda\b\x10\xc9NB\r&\x83\x95D5\xa6\xd7v\"\t\u03aeU\xb9\xc6\u0792\xd0\u1eefV\xe6{Z\x1ab\xf8\u6882\xaf;\xadG\xd5@J\xf1\xf3\u03b6\xd9=\xdeo\x7f\xaf\xd9c\x8c\xf2[\u00b7hm}\xc25\xf0v\x17><\x91;\xbf`\xf1\xb3u\x1a\\\x98 \xd8X\xf3\xbd:\x10\xb1\xe1\x9b\xff\a/\xc5\xc6O\xb7E\xc7\xe1Gw\x02[8\x11\x19r\u05c9T\xc1L\xaa\xe8T\xf8\xfd1\x84\x06\\\xf5\xfd\x878\xb7\xaa\xf1 \x82]\xedK\x9cC\xdb\xce\x0e\xc7pU\xac\xb6\x1eBz\xa7\xf3\x11\x94\b\xc7\xff\x8a\xa7\x90\xa7z\x9d3\x18\xbd\x89\r\x03\xc6\xef;\x9f\xcf\xd8\xe2}\xe1#\n\xd6\u07ce\xe7\x13\r\xc5]\xcee\x97a\x7f\xb1\xa3\xc9\x13h8\x97\xb8\xc7\xf0J\xe7\xa3\x18\xdb\a\x87\xf1\x00?\xb6\xce\xcb\xd2+\x19ON\xac\x19\xc5\xceF\xf4\xa6\xf1\x17\xdcEz%\xd8G\xec\x978i\v\xbb\xe5\xb7:\xb2\xdc\xdfd%\xaa\xf1oB\x19vQ\xaa\xf8\xaa0\x89\xd8\x00\x04\xf0\x99\xee\x1d$\xe0-\xc2A\xb1\xf8\x9c\xe4\xb7o{5\r\xe3K\x98\xdcNrY\xc6\xeam\xfe\xae\x1e}\xc0\xfc1\u0741\xbbo[Je\x9bk`\x83\xb5{A\xb3\xbf\xd6\xe5\xa3\xd6b4\u0541\xff\xf1*\xff\xbd/\x89\b\xa9Q&\xb3\xe7W\x18\xff\xa3\\0v\x89c\x14\xda\xf5\xaa\xf1^\x0f\xce/F\n\x80\xad\xb3\xc5s\xe3yU*\xc8D\x89\x19\x88\xcc\"\x90E\x88Tu@\x85\xa9\x10}\x1e\xcb/!\x90;\x1bq!^V\xda|@\xc0f\x9c\x90\u0367\x1e\xa0\xa5\xc5N\xc9PM\xe8\xefTv\x16\xebUB\xa8}\x9c\x05\x869\xa1\x87?\x85\x82\x16\x88$VM\xc1\x7fb]\xbe[\xb8\x81,\xc6Qh\xfa\x8a\u0140\x05Z\x14\xec\x93X\xc4\u06adY-\x06\xa8Vs\x91\xda7W\x9bx\xca\u0143\xe5h\xf0\xf2l;\xba\xb8=G2\xbe\xd6\x19\xca\xf8\xcd\xfa,\xb3\x12\xbd\b\x87I\xaf\xd70K\xa6Xk\x8d\x04_\xe6\x92\u043fO\xe7\xc5eo\xd08\u027d\x83\x86\x95e\xfd\xb6\xe5\ri\x1d\xe6\x01\xf1\xac6\xc8\x05h\xe7@\xab\u03be\x11u\x9cWl\xa5\xee\x0f\\i\xe6\x8fk;A\u03fb\xcdO\xd07\x8b\x86\x89s\xc0.\x04(\xb8\xba\xd9\xc8\xf9\xdb\xef\xdcI\xdeH\x9e \x06)\x14K4\xb8C \x80\xc5.G\xd3:\xee\t\x82P\x03\x13\xcb\u04a1\xcd\u02e7f\x10b\x0f\xb2\xf1\xc0\x89BheY\tq\x01\x12\x817\x96\xd0\x1en\xfc0\x89\u0399\x9e\x1e\xc4\xed\xcac\xf71/e\xfc5\b\xb49\xc2\xc1\xf7\av\xb9\xd1:\x1b\uf542a\x8f\xc8r\x9b\x95}x\xdctR\xc6\xe8p\x98\x1d\x993?\xebC\x9b\x83\xa6Cc\xfe\xeb\xa2\xcc\x1a'\xb2e\xc6\xfeT\xd4){\x9e\x96\x1f<\xbe\x88\x02\x1f\x86\u02603\x9a\xa9.\xb3\xf8]XX\x02\xe8]\xfb\x88\u0432o)\x14sI\x19}|\xc6\xfbN\xa8M\x04?^\"\xb8\xa3\xb3\xfdqa\x88\xb1\xf5\xb4\x7f\u0230*\x88\xe1\x7f\x04\xba\x8fw\u03f4XL\xa0\x1bp\xa1\x16%\x97\xf9\x90.\xad\x13\xdf6\x89\u046f\xe2\xe3\xf7\xc7KY\xa9\xb6\x84\xa2\xbd\x80\x05j2\x83a\xb2S\u035f\xd48\xe1\x94\x1c\xf4\xfa\xc9#\x84OO\xd7\xe2X]\x19\x02\xa7\x99\xae\xa3\u071ca\x14\x16\v(|\x82~V\xbdzC\t\xc0'\xb4\xfd\x15$\x1d\xce$\x14\xa3\u0324\x15\xdc\x1c\xcd\x0e\xd1\x13\x0f\x9e)@\x01\nF\xdd\xca%q \xcf\xcc\x10^(\x0e\xb3\x9dS\x1a\x8e\xd6\xc8\x00)f?T\xee\xc1\x81\xbe\xf6.8\x1c/\xe2\x8b!\xd5Y\xebw\xa3d#:\x01\x82\xe1\x91w'\xd4!\x94$\x83,5x\xddu\xd0j\xc6l\xbc\x1c\u0650\b\x8d\xa8(\u04b8\xfd\x9cy*\x045\x14\xf3l|\x99\x96\xcb~\xef\x81C9\u014aL\x01q\x98\xff\x97Q95\x1aV\x8fc\x90H\xf8\xf1\"\x9c`1\xbe?L:\xf5\x9d\x95eQ\xf6{p\x0f\x82\xb8b(g\x825\x11)\xbe\x91t\x1e\xec\x06\xb7\xbfIo\xbf\xab\xee\v\x19\x01\xc4O~Vg{\u07a4\x9c\xa1\xb7~\xdf\u013b!\x93s\xac'\u07a6\x03\xfe\x8ao\u063a\x01\xba>1~\xb9yn\xbbv\xea&\xb9\xd3\xdd^\xd2i\xabm\xc9[\xf3\xafw\a\xfe\x8d\xc4\xef\x8e\xd1\xf4\x8c\xf7\x8a\xb5\xa8\xdf\xc4\v\x86g\x12\xbc^\\\x9a\xab\xea\x91d\xa5\xd0\x15\x06\xbeVx\xd8\xef\xf5\xdcV\xe1\xdb\xd1[\xcbF\x02\xf2\x1dr\xa4f\xedh\x95&r\x18c&:6/$\x80\xa8\x9c4\x8a\x88W.\xa0O_\xd1\xea2=\xe0\xc7\xe1(w\xecGE\xf9y\x92ST\x1a\xe6y\xb7\xee>J\u055a\xaf\u0a916\xd0\xd7;\aK\xccN\xdb\xc3\u010e\u041b\u0381}\xf1\x92]J1\xef\xf9\x18ZE\x9f\x93\xdbDE)c\xb8\xe3\x8f\xf3\tf\t\xfd\xfa+7\xf5=\xf7\xed\u05b9QZ\xa9=v\x120\xb5!\xaf8\xae\xc6\xeb\x13\xee\xce\xedC\xea\xfd@\x93n8\xc6z\x86\x03\xbb\xc4$\x06C\xc1*\xb9\xe4\x0e,^\x03\xf1Pk]%c\xad\x85!\fI\xab\xeb\x89\xcd7\x87\x91\xb2\x8e\xa5\xad#lZ\xc7\r\xcb\x13\xbeT\xcb+^I\x87\xc6e6u\x9e\xae\xaa\xac\x1f.\xed0F\xf0\u0134\xa6\x88j\xd57\xc7>;->>Ed\xce\xd9c\xd1\x06U\xc4\xed\x93'\x18\xb3Iq\ue60e\xc3\xef`\xe6\x1c\x18PP.\x03\xe0\xbb\xd3\xd3a\xa2\xab\xb4\xfd\x15\x82\xa7\x96\xc5Z\x9a\xe2Z\xc4\u05ab\xcd\xc3\x1e\xd76\x02K\x7fY1\f\xf7\x8f\xe4\xbd\xcb\x02\xff\xb2&5\x90\x02\x96L\x1dr\xfd\xeb\xfa~\xf0\xf7\x1f\xf1\x1dx\xfb\u044b\xe7P\xdc\xec\f\xc1\xb5{\xf7g\xf9\xc5\xf7\xf7!D\xe2\xfb\x1f\xb2\xf9\xbc\x80\xd2a\xf3\xd9\xfd;\xf8\xcb\xfd;\xf0\xb4G\xc9\aT\x8b\fW\x14#\xec\u04aa\xf2\",\xa8\xe2\x8f\x1c2\xc3\u067f\x95Z:\x97\x98,\x89x\xbb\x14qf\xbb'Qs\x02\xf2i\xb6\x1f\x19\x8c\x8c\x03\xff722\x8a\x8b\x94!`\xdcVJu\x87\\\x80\f\x81\x8e\xd0\x18\\\x00;\xd6\x00Q\x82\xf9%O\xa2\xc2J\xd3Z>_\x17\xa3I6\xa2Bl\xb8\t*\x1aNBM \x9eO\xe0W\xa4=\nE\xa1@_X\xafy\nQk\xa8\x02\x80%c\x1d3\xc3\xc3\xea~\xa2/m4\v\xd64\x9a\xe7\ube24\xc6\xcb\xed\u0164\u0224\xe0k\x17\x80B3 E\xd3\x06OL\u0369h?\x96v\xd3\xf5q\x84\xa6\x87\x1eO\x03\xb6\x89\xb9\x03|\xe7FY\xe7t^,\x95\x8e\xc7\xfcS\xe9\xe2Gd\xad\x10>\xa5~\x82\xf3\x1a\xfe\xd6\u01a1!Gd]\xf2@\xf7\xecX\xa1\x19;\u0320-\x8a\xa5\xc64\xa85)\xa0\xfcL}\xcdWr\xb4\x89\x81\xe5\xb3c\xb3K\xe6\a|\x81LV\x0f1I\xc1}7\xac1b\x9bVss\u0669]\xb2\xa3x\u0484b\x1e\x8f)0\x98\b\x12H\x0e\xe3\x9ds\x84v\x90\x8c\x19\x17\x914\x9d\x1bF\xe1N\x83\x0eEl%\x8eEz5\u024eL\xb3\x1c9\x165\x15\xedp\xa1\xc6\xc4\x1b\xbb\xe6\xd4\xc6\xfd\x16\xe1V\x85\xb0\x01\x9b\xb6\xf5/1\xcd\x11g\x8f\t\xf3\xa6W*\xbbM?\x9b\xa9\xdb\u0708\xed!\x14\x8d\x9d\xef\x1eR\x11\x15\xa6\a\x11\t &\ub092\xe8\xdd\xfd\x81\x92\x03\x19\x11\xc0\xa2\f\xe5\xfa\xa6[\x9a\t\xa5\xc5\x00w\xc2=\x84p\xe15\x95\x01I\x00\xf5\u009a\x8a\xba\xcb{\x12\xae\xf6\\\xdc\xd0NO\xa5\xe8\x10\f\xe7\x16\r\xf2\x8b-\x96\xc4\u0211cDJ\xb2\x90-\x01@\x1f1\xeaV\xd6\r\xc3\xe4v\xa7\u0140\x10#\xb2\xd9}n\x15\xc6T\x97iI\xe9\u07cdq\u0644\x8e\xba4\xb3\x17\x13h8\xd7\xc8\xed\xbe,\t\x14\xab#a\x01\x8b\x98\xb9\x9d\x19\xc7\xf5$\xff\xf8\x1dD,wzR\x9e$\x19\x97\xbcE\xfd\x890\xac\x16\x85\xa3.\xa3\x8a\x92\xebQ\xe4\xfdVn\xf0\u0533y_\xa6\x94\xe1\x95{\x11\x8b\x0e\xac\x1d\xfd<\u064c 4\u0741\xa8\xac\xe0\xe6\xc4\xd8\xeb\x04P\xe9q\x0fj\xc6c\u04fe\xab\xb5\re[\xf1,J\x98\x8aDc\xf0\xe9\x8d\xdb\xd7n\xec\xc06>E\x1d\xd6\\u\xc0\x17\xe4\x15\xb8\x87\xb5\xb4\xb8`z%\xedS\x81Z\x1d\x98\x8c\xad\x03^\x06\x8aL(DF\xae\f\x88<G\xda4\xd3*\u0299\x94\xe1\xcbW\u0282\xea\xda_2\xcf\xf6)Y2\x8d O\x13\x8aJnV\xf62\xa3\x94\x19H\xc0\xc4l\x05\xc3\x0e$\x1d\x89S\xe8j\xe6Wh\x8bf\xe8\xdd{\x11s\x1f\xe5\xf4F\x93@\xd7%\xb9\xf2l!\a\xe7o\x8e\x87\xf4\x13\a9q\xf7/\xfd`\x04i\xd3\xc6P\xf4\f\x9eN:\x87\xb8\xf6+\x91\xe3 {\xa9b\x99r\x8b7\x9b\xe2\xfa=\xdd\n\x9a\xb7#p\x97\xb6;\x8d\r\x06\x01\xff\xa5\x13r\x7f\xb8\x1f|\xf1\xed\xda\xee \xeb#\x81;\x1b\x13w\xb8\xa47\xaf\xce\u06ad\xf2\xe4\nl\xbe`eAp#\xf0+.rTS\xa8\x91K\ub469$3\x94!\x10\xd0F^\xcetc\xd4Azn\xd6\x19\xbb\xc9\x17\x99\xb0L\xf3\x86D\x9d\xba\x9d\xbbI~\xb8\xe4\x0f\xea\xb7}+T\xf2\x17\xb0\xd8vN?\xa2\xfb\x06&\x04y\x14CaE\x18ke\xd3`\xb1D\xb9fc\x96:\x10\xf1\xfc\"\xa3\xb6`\x15\x19pa\xb1\x99\x9e\x8f\xdb}e\xb7\x0f\xed\x1cd0\xcf E\u02d0\xd7\xf4<\v|\x85V\xb1\xf4\x8d(1\xeb\x8e\\=\xe4Y\x11\x85\x84\x86\xcf\x7f-\xb2\x14DS\x05\x04\b\x90\x91\xde>\x8e\xa9\x19,8\x99/\x00(\xaa\x8a\xc5\xed\xa7\xeb\xf0s~\x86\xa2\xb2\xdcn4\x96\x172\xea-\xb7\xbe\xa3\u0781\xb9\xcc\xc5\xe0\"\x868\xaf-e\xe04\x83}`(\xe9\x8c\xf0\xc9J\x7f\xfa\x0e\x99(\x9ar\xb0\x12\xb8*3\x0fiL\xa6\xe3Rh\n\x0e\xc1CgLbN\x03\x94\x1c\x10\xdaU\xb10\x8e\xdc\x03\x82\x1f;\xe3V\xd5\xe0\xa4\x1cy\xf3\x93\xc4eLx\xc8+\u0554\xaa\xa1k8\xe2j\x9e\xad3\xc3T7K\xccs\x85\x02\xba\xaf%ae\x88\xbeH*\xae\u4cae1\xb5\x05\xe1\xa7\xcd\x06|\xc8\xc0\xa6\xb29;g\r}\xe2\xcaE\x83\xbb\xc7v:t\"ko\r\xce1\xbbVK\xa6W\x808\x05\x1d\xbe\"\xf8\xa2\xf9\x8cAz\xd09&&\xba\xa8\x97\xd7%\xd8\xfc\xfa\xabJ\xa4\x8d\xfa\x02\xbd!o}\xddM\x7f\xfb\xbb\x97Sd\xb5[\xdf[\x1b\t\xeb\x11 \x8a1\xc3\x198\r\xc4,\xc7\xc3\foZX\x8bi\xb6L\u02fc\x18\x8a\xa4\x8f\x86(\xc3\x1f\xd7\x02!N\x9c\xd0<.3]\x85\xd95V\x94\xf9\x19\xa5\xf7\xdas\x896\xb75`\xb5\x18:\xba\r\xff\xf4\xf2\xbcYB\x93\x1b\x00\x0e\xd6\t\x02\x1f\x1d&\xbf\xf3\xa7\x86\xffwS\xbf\x1c[\x80\u011a\x9d\xed\xa5b\xa6\xdf\xe5=\xa4F\\\xbbG\xc0\xda)w\xad\xd37n\xd3\xd0\xeb\xeb\xaf\xef1U\\\x9f\xc82\x0f\xfdL\bN\x02O\xd9\xf3j\xc90<\x88I\xc3=i\u05b5\x1f\\\xa9`\u01ad\xe2\xd9\xf4p/\x16\xa5\x1d\xc9ef\xd3B\xa7:AQ\xccH-\xa3!\xc6\xc0w\xbd\x1aZ\xab\x87\xc3\x0e\xab)\x1eDY>\xa8\xf1\xa1n;4~4\x98\xc5=1\x84\x9a\xe9`%7\xff\xf0\xf9\xd9Am\xddY`\xb9\xac<=\x9ad\x8d%`>.9\x03\u0699R\bP\x81/\x1e\x92\u022dp\x1c\xbf\x83\x92\xda\r\xe4\xfb\xecb'\x1cc:\xb2\xca\x19\xca\u052d\xa4\xae\x9c\x1364\xa2\\\xcc \x94le\xb4%*\xf3e|P\xf5\xeb\u031c\xd0=G\xe9\x8d\xd4\x19\x12g\x94\x03\x14;5\t\xec\xe4v\xd0p\x94\u071bZPgz\x9bZ\xed\x9a\xd0VAB\xe3K\x1cw\xbb\xbdSC\u02b6h\xc9(\xa6\xa1k\xa1+n\xb29\xf1\xf7JD\xa7\u02f2\x00y\x16q$$\x85]v\x9eL\xe0\x9a0\xa9\xa9IfX\xf7\x92A\x11\xe22\u0490T]L\x88\x9f\xfd\xd5\x10\x8e\xe6`\xa0E\xa57X\xf1\x85u\xceQ<4\xa2\xf5\f\x95M\x81\n\xa9o5HC\x1c\xc6\xed\xc6\x10\xef\xdc\x1c\x9fl\xfa\x81\xfdM\x04\xa4\x94T\xc4\x12\x9c\xc0\"O\u012b\xe61\xa8\xe0\xa1\xf3\u0185_}\xf5\u054d\xb6[\xb5v\xe6\x82\xef\xd5-\x10<\xf1h\x91\xf6\xb8\x85\x9bE\xc7\xdb\xc0\xc9B\u0761\xa5\xe3A\x8bW\x10\xed7\x99g\xe4\xd9\x12|EJJ'\xbe\xce\rk\xc6^\xff\xd4z8\xb3K\u01fe\xa3Sn= \xedL\u02d1]\v\xb5+\x82COL\x8d\u0634\xfb\xf6\xb0\xe1\xb6rD\xa6\xdf\u0795\xc0\xf4\xf5\xa7\xfc\xef\xee\xd7(\x9blx\xdeBq\xb5\x81w\xa46G\x04\xff\x89TU\x97\x11\xb6\x91\x15\xc7Sr\x19!\x02\xec\xb2z\x12\u1282\x99\x98\x15%\xad\u0580\xa7l\x98P\x8d6@I\x91\xe6\xce\n\x8eis\xd2\u0538\x99\x82\xb7\xc5\f\xd0X\aM7\x80/\xcf\x01S\a3\x06y\xf1\xbcRK1y\x83\x15CjIDA\xf2\xfb\xe5\xeb\x9a\xf3\x18q\x87(\x9ez\x83{\u9f19\b\xff\x9d\xad/5\x96\x81\xf3\x046]~\xd7'\x89\ubc19\x9a\xfc\xd8N\x19[\u060d2\x87\xbep\xa1\xe5\xac@\xd6,\xa2\xf1\xf8\xf7\xffg\xe9$K'.\xde\x7f\xa2\xa13\xc00\xe9b\xeb\\\xa4\x1f\x9fQ\xa4^<\u022d\xcd\xef\u0166\x05\xdb\xc4@\x1d\xed\xe4\xad\xe9\xf1\x9d\xf5q_~\xae\xd5\xd0EL6\xf8J\xdc5\u052f\xbf\x16h\xe3\xad>\xaa\x81k)rt\xbe\xdf\xdd\x7f\xa6\xee\xe9\x97\xca\xe6\xe5e 9l\u06b5\xd4\xe0S@_\x86WO\xcfY&v\xe6\xa4\u0162`\xfc;\xd3\x12\u057e\x00B\xca\xd2\x05\xb1m\u016b=\xbc\x1b$\x05\"\x83Fi\xa3\xd3E^\x9bit\xe5j\vl\x03\r\"\xd1x\x87\u021a<]\x0fB\x8b,c\xb2\xb62\bY\x1e\x15\xab!\x19w\x16\x81\xef\xd5%@\x8d[\x94\x12\x15$\xd6n2\xbel\x94\xcc\xf0\xbbY\x06\xa6\xc0#\xa3\x10W\xfd\xe7\xe9\xfa|l6\xa0\xcf\xc8`\xeep8V\u077c\x1b\x8a\x19?)\xca\u02f4\x9c\x8d\xa8q\xb2\xf6q\x00\xbbF\x18\xea\u011fO8\xf6\u0195ud\u06a3\xc6g^Y\u00ca\x8a5\x00xYv\xbaF\x841\xc0\x10:=5\x8a5\x82)\x85\xd6Y\xc3\x01\xd3E&9\x00u\x9e\u0752.\x16\xf2A\u0574\x19.\x8dN\x82\xa9,\x92SC\xd4\x065b\x96~\x13\xf1\x1a\x8c\x9ba8\xc21\x04\x06h\x8b~\xcak\xd5\u0280\x15%4\xa4>\xb7\xf8\x94\x0f::\x1atx\x02>\xec\x14\xa4\x90\xf0\xb2\x1f&\x96D9\xa3:\xc6\xf6#\xed\xbb8\x1d\x85\xa6\xc1+\xba\u708f/\x1c4\x87\xf8\x8c\xd2rMg`\b|\xef\x19C\xab\xf8Ns\xc3:t\xda^\xa2?\xdb) \xf5\v\xc4J)\xabH\xb7Oy\xc7n\xdbLB\xf8\xd4Nu\xa7\xe13\xdc\u02217\xff\x91^7Q\xc1\n\xf1\xc6\xe87\xcd*\xba~\xcd\x1f\xde*\x1e\xbag\x9ei\xf7\xc7B\x13<Z\u01451\\\xb2\x9d\xa4T\xce\x0f\x92\xb6K\x8c\x94\x9d\xa4\x13\xa8oZ^\x89\xef\x05\x1b\xb4g\x17\u0656\x0f\x18F\xb0\xd5\xe6\x0fu\u029c\x10/@\x8c\x9e5>\xf22\xea,\xcc\xe6\xd1\xf4\ar>\xa2\xd8\u06b8\u045a\x99\x17\x7f\xd8AF\xef%=\xab\a\xb6\x06\xb7\u0646\x1b\x82\xdb\x1a\u02122\xe9BR\u0673\xf6Z\xa1\x84\xbb\x11\xf5\x93\f\xd1\ra\xcdD\x1f\xaaQ\xd3*\x10\x03.\xdc\xcd:\xe3\xf1\x83\xe0\xb7\xc4\xdaI\x1c\xbb\v\xac\xe6\xc1\u0423\xa2n\xedu195E\u014c\x932\x96R\xc9`\x81D$\xd4\x02D\xdb\f\x02\x8f\x02\x81\xee&\btfj7\xdb%:\x17\n\xbf\u0577\x9f\x84\xae\x9c\xd0\x1e\xd6\x16\u027e\xcd>w=\xd5\xf9F\xd4g\x13\x8e\xab\xd5\x1d\xa5(\xb2\xe3\xf8\xbbZO\xf6\xa2\x16kXj\xdc\xd0\xe6\b\xab\x8eI$\xdb\x13!m?m\xce\x14\xfbR\xa7\xc94\x1ak\xf4\x81\b\f\x7fH\xeb|\x1f\x96\x17\xbe,\x97\x034(\xc1;\xfdy\xf4\xea\xc5\x1b*\xa8\x8dz\xa9\xc2\xecs\b\x11\xf8\x12\xca,R\xeeY\xea\x03y\xbal(aQ\x145\bb\xd4\v&,\x9c\x19-\xb8\xca\xd2rJh\x8d\x0ed\u028cAR\x1c\x9dhDM\x80\\\xc4M0\x9eh\xda`\u0616\x16Z\x91\xca@\x9f>\x86\x9b\u022c\xe3\xfb(^\nK\x02\x90\x97\xd7b\xbfN\"\xcf\xc7\xe7i\xd5\x1cE\xa3b\xf1(\xb1&v.?\xa9\x8d+.\xbd\x9d\xfb#&\xf5\v@*\xad\xbe[\x03\xbcp$\x97\xf0\x98v\xa8\xea\xbaEO|r\xa8o\x85\xd8\x19Pz\xe7tv\xfd\xe6\xd6%\x87\x0f\xe3\xcb\xcd\xe1\x8f\xec\b\xbcu\xeb\xc0\xdb\x02\xb5h\u2205I\u05ac\xae\x9c\xa3\xd5m\a\xf4\x1e\xd4xK\xc0=\xb0\xfa\xbb\x06F\xd7\xfbC^\xb2\x1a0_\x15\x12,\xe0#\xaf\v\xeb\x9e\xe4\xfb$\xb2\x19x\x8f\xfd\u022eb\xb3t\u0710m\xe0\x94T\x99\xf0\x8c\x04o\x15\xa7ll\a\x9b$\x186\x18\xd2\x15q\u03b7n\u05df\xcd\xc9x\xc0M\xd5\x12\x0e\xbc#\xa2#L\xd1\x12/\xe1\x06?\x82\x12vh\xee\xfa\x1e\x8e\xac7\xa8/\xa6N\x85r\xb7|p\x04(\x1b+\xb2\xbe*\x17\x19cI\x89\u0395\xd2\x06L\x82\xef\x7f~E\x16}\xe7\xc3\xc1\x8b\xbb\xf6\x19\x8e;#\xed\x1b\xe8\x12cO[\x93G^\xa8\xc4\x11\x8f>j\x8a\xe2\xcb\xeb\u03fdu\u07e5\xdd7\xe6\x1b\xb18\xbe\xaf\xa5\x0e\u05f3N\\\x82\xa6V\xc3FwE\xe9\x12\xb2|\xe5RsC*s\x02\x1d6\xa6\xbehhs\xe52\x9b\xf7\x14\xc3\xd0]\xdd<L\x14\xff\xb0\x1f\xdc\xde*\xe2\xb8\xfc\xdeNL\x05D\xbe\x80\x91\\\x87\xcfxS\xac\xf1\x1a7|\xbb\x80z\xbb\xf2%\xdcf\x91\r\xeatx\xf8\x02\xeerv\x1eI:\xc7ue\x00\xefHP\xeb;\x9d\"\xcb\x00\u06cf\x91\x1aws\x13[OV\xf7\x85\xe9|\xb0h\xa7:\x9e\xaa\x809\x06$M\xb1\xf5\x97\x19\x94zD\x7f\xac\xb5B\x01\xa2\xa2\x1f[Pf=\u03e0{\x9a\x03|\xbd\xf9y\xec3o\xd5\xd9!G\xb6\xd5\xe9S\x1f\xc9\x16j\f\x1a\f'\xa9\xc3=:\x11\xb5\xd7\xd6\xde@\xae\x8a\x18;h\x00\x03\x1bOAX\x86\x06\xa2\xb0`\u0298\xf5\xa3\xcd1W\u07fc\xcd\xdfyZ\x99\xb7T\x96\xff\xc5\u03acN\x1a\u0781\x13\xa9>\x06\xc1\xcd\b\xfb\x109\xda6\xe5\x10a\xe4\x89T]I\x00\xde\xfc\xd8\xe5\xf9[\u078c\xf6|\u064e\xa3W\x18\x06\x80\x9bU\xc8.js\x88@v\x19Y\xf4\xb20,\x14!\xbb\bOL\xeb/\xe1\"\xc0\ndXt\x98*`\xb4\x1eX\x98\xe1\x83\xe5\x8cxI\xfbu(S\nU\a\xb8\x15\xect\xbf\xefr\xe5hA\xea\xf3.\x1d\xdb\xefh\x87\xbb\xee\xcb\xddUr\x96k\xab\xa8\x0f\xb4]\xb7/G\u01a2\xfc\xfc\xe6w\xd4vz\xb6H~\xff\x98\xe4\xdcp\t\xf9\xb4|}\x1e\xbale\x9e\xf2\x06\xd0\xe4\x9bka<\xd8e\xbf\x7f\xe8\xb7\xe4\x8e@\x836r\xfc\xf2\xc1\x8f=\xf7\x16V\xaaH\x1e\x95\x90\xc51+.\x11\x1eO\x17/ \xd4\"\xf8h\x8cKlU\xffn\x84N\xf7\x9d\xa2t\xfa:8L\xceK\xed\xbf\xff\u03be\xaf\xec@\xfah{S\x0f\x15\xa7x\x95\x80\x7f\xf4\v\x82P\x1e\xd1<\xa3\x15'\x06v\bGS\xfb\x1c<\u064f\xcd\xff\xdf\xfd\xd3W\xf0\xf4\x13\xbf\x84\x7f \x9e\x1b\xa2$\xb4\x9f+\xb3p\xf8~\xfd\x18\xe1$\u043d4\xa4\x86\x9d\x9d\x03\x1fy\xe4\xa24\xa2\xe6[G\xb5k\x95\xa4XSZbs\xcea\xb4\x7f.g\xd7\xed\xd6|j;\xad7\x13\xef\x12\xa7\rK\x84[\x19\x19\xeb\u06fdw\xc3\xc8j\xbc\xbdK\x80\xab\xf6{\xb3\x9b\xb5N\xf1\xdb\u068f\xf8\xa5N\xbe\xc7*\x1d\x95\x82FA\xcbeI\x89 \xaf_=\xab\x95\u0475\xc0'\x9f\xd4G\xc7\xfas\xaa\xfc\xd1N\x17\xf4\x8e\xfb\xac\x19?\x05U]\xf7\x9b\xb7\x84b\x17C\x8a<T\x00+gLv\x0f\xd6\xfd=\xa70\xd3{\xbf\xfe\xca\v\xb7.\xa4p\x10\x05J\xf4\xef\xfc\\\xdd\x19\xc4{\xf0\x94r\xcf8\u068f\xab\xea\xbc7\xf0\x96\xf5O\r\xd4P|\x9d\xddv\x84\x1f(@\xb2\x98\xc4\xefS^=K\xa4\xc3\xff\xc5F\xf7\xd9-\xbdp\xe1u\xf6\u8e69\x1c\x1aA\xa8\xe1\xcc\xfd\xd6\xf3\xa51\x82\xf7\xe1s\xe6j[\t\xe6\xe9M\xa0>Kr\xa7\xbd\xae(\xda\x05K\u021b{\xf34?\u06d4\x98z\x83\xa4\a\x18q\x80%XI. \x04r`E\x1b\xd3\xd2aS\xb9\x1cYB\f\x10\xe1\xb7\x0f\x1b+\xe7\x1cXH\xcd*\x9fe\xf4\xfaas\x11\x1d\x1e9b$\u0405\xc3j3\u0198\xd4,\xd2\xfal\xa0\x15\xdb\n\xcdT;t\x99\xbd^\x9d\x14\xaf\xf8\xa4z\xf8%p\x04\xb9!\xf4\xe9\xab\x05u\r\x98N_eg\x9byZ\x1a\x96e\xee\xe1\xca\x15r2\xbf\x9b\xdf\xfan\xc9n{s\xbc\x9d\xdc\xfa\x1f\xb7lC\xc4x\xb2\x19\u075e\x87\xfe\xc8\xc6\xe4u\xe9G{s\x1b\xee7\x01[\x0eL\xc5\xff\xf9{\xff(Gh\x02W\x16\xf3\xdbT\x98\xcfX-\u0613\xb2Xl_0\xaf\x9b\xcet\x1dF\xedqs\x83\x81GS[V\xfc\xd6_n\xd5\xd6\xda\u0462m\x8a\xea\x86\x1e\xfasb\x96\x1b\xef\xc6\xf1I\xfc6\xca6x\xb5\x1fc\xd3>\xaf\xb9]\x9b\x1e6cn\xc4\xda\x1e\xe2\xe7\xe1\x0e\u008f\xf7=2\fwO\x10\x15H\xb6a\t@\xef\xffP7&\x02\x0et\xee\xee\xa8t6\xc3\xcf\xfb\xf2\xb0SqX\xae<\xf8_\xbd@lC\x05W\x81\xbc\xa7Z}\x17Rk\x11\x8b\u059f\x86eP\x04\fV$\x94?e\x19\xc0\xe3$\x90vq%\xc1m)\x148\x85L\xf1\x99\x14\x8b\xb4\xea#\x01\xd0\x06\x15\x1d\xc1i\x88`\xad\x90\xc6TnH\x1a\xaf\x98\xfa\xa7E\xb5NNS\x0e\xeaC\u0234\x9c\xbd\x8d\x98\xf4kkm\xaeLSX\u00db\n\xa7fW\x86\x9a\x04\r@u\x86\xf0F\x1bZa\xf8\x1b\xdd\x1a\x00z\x86E\x00%\x92'^X\xb3\xfa \x05\x13\xb3\x85E \x97\x8e\xb1\x14Je\a\x97\xac\xe6\x9b\n\x9d\xa1\x15\xfa#\u037c\xaa!F\xfa@\xbd'\xd4>I\u0751\xac\u06af]>-U@|\x8c\x95U7\x88Q\x9e\xc2\xdd\x0ed\x90\x1b\xca\xc6\xe6\x05\x8ct\x95\xe6\x10\x1a\xe9p\xbc\xe05\xac\x86\vQ?\xa7\x1c$\x98&k\xbc\xf9$\xa2Q\x00z\x11\xd5\f?\x01y4C\xe4\x1f\xb3\u0612\x80\r=\xeeAcP\xbb\x92\xab\xed\xa6\x90E\b\x04g\xe3O\x92\xe4\x95l\x02\xa2\xa2 =N\xcf7\xcb\x0f\x88+~\xf4\xc3\xeb\x1f\xff\xf4\u07a8[\xc7\x0e\x1c\xff\xc4%H\x9a\xd7\x10\x18o\u0150\xfc\x1f\fIU\xb8P\x1c2\xce\xf5\xb1\x0e\b&\x00L\xc6\xdcW\x96\xce) \x1e\xf7\u040541L\tl\xf4\x15\"Z\x81\xcd\x02\uabfe\x91|6E\x0fgH@\x98f\x9fS\xe4&\xda\xd6Ks\xfe\xd6p\xea\x16\xf9\x9aR\x83\x8a\xf9,\xd3\x03\x9e\x95\x05\xe1e\xc1\xee\\\x9e\x03\x82\xa9\x14\xa0\u01c1\xc9\n`\x18>L\u02bc6\x99\x17\xc5\x02\x8e\xa7\xca\b5\xa3=3R\xbe@\xb0\xe7\xe6\"*.\x81D\xd2*\x93h\x7f\a\x1fG\xb7\xa5\xd9-`\x01\u0547\x9c\xc3\xff\xa9+\xe1\r`b\"\x19\a\xb4K\xae\xc7\t\x81\xf2\f\u02d2\x97\x92\x1bH\x05\xb5p8\xe78\x91\xd3\xfc#\x80:b\x9d>\xb3\x80g`\xb1J/\xd3+\xf2\xe2\xe7\x12\xdbj\xba\x8b\x97<U\x18\xbb\xf1\xfa\xc8\x1a\xcfN\xc2Z>%Rl\x12\ad\xffp\x99\u028c=\x1d\x84\x95J\x0fJ\x93\xb1U+\x1d\xba\xb2\xfc\x04\xfa\xb0\xfc\x9b\xe4\x81\xe6b\xa0\xb1\"z\x9al\x82Z\xa0s\x15\x97\xd6\u07b0!\xa1|\x013\xe2\xdd_d\x86\xaf]\x11\x9c7\x17\u0705\x1e\xb1X2P`\x15\xf4\x04\xbfI\r\xb8\xbd\x1dg!\x14\xebJ\x83\xac\xfd\xb4\xfe\xaf\xf5\xb6\t'\x98H-\xf9\x05\xb06<\x18\x845ot\xb8$y@\x95\xb5\xf3\xb5W\u04d7\x1a\xc3`\x108M\x80@\t\xc4\xc5\xe3!B^\x9b3\xe9\xe2\xa2\r\xf1YN\xce\xe3\ff\u03bf\x06\x93\xbf\x93<\xaf\x15\u05b3\x05\x1fq\x01a`p\xfc\x8c\x9c\x8b\xfckY\xd0\\\x98\xfai^\u0514W@8\u58de\x02\xf4\x11\xc0\xbb\xe0!\xa4|\x1ay\x86w\x12\x00\xcfL2\xd3\xc7j=VUp\x9eA\xc3~e\x02\x18\x8f\xfe\xd9\xe6\x1d\xe1\xf1}_+$\x1bc\xd3CZa\"\x17w'\bj\x9f\xa0\x8b,R\x84\xb3\xa3\xb6p\xc3\xe9\xdd\x0f\x19V\xf2\xce]qQj\x16;\a\x83\u027b\x03\xef\xc1\xd3\x19>\xfa\xe5\x93g\xc2\xf8\xb1v<xE\x88Un\x969\x92Uv\x91O#\u022er\x86\xd4\xc5p\x98\xdc\xfb\xe6[\x05\x9d_?\x15|\v03'\xda\xe2.\xd5Qi\xee\xe6\xc5O\x8f_\xfd\xf0\xf8\xc1#k\u04cd\x0f\xe4\xeb\xe4\xf7\xb1iN\xf2\xb5\xe5\x02\u0330\x15\x1bO\xf9.b\u0198$\u03f9\x92\xb6\xb9+\x81\x97K!\xeb\u02e2a\x88O\x7f|\xf4\xf8\xcf\xef\x1f>=\x81\x95\xf8\u077d\x7f\xfd\xf6\xbb:\xe2\xae\xe5\x8a\x1b\xf6\xa7*\u05b8\x03s\x05]B~h\x18\x8dgJ\x94f\xae\xc5d[ji\xe2\x15S\xab\xee-\x13A\x81b\x92]\x15L\xd6\xcc}\x14wpI\xbap6\x1d\xf3\xc0J\xd2m(\xf7x\x00\x1bJr\x12\xeb\r\xf8D\xb4!{\x94\xbd\x96\x84\xbb\xcf\x14_\xb7\xe49$Q\n\xfe/l\x7f\xdb&<\xa3\xe9\xfb\xf6\xdcg$\x9b\u0611\xf8E\xb8,\x9f\xb1S6\xdaV\x03+r\x93\xa1w\"5\xa5\xe6\xf3X\xb5\xa1\xfa`\xf1fh(s\xe0q\xf0\u06c7\xfa\xea<\bX\xa1w\xa3F.\xd9\xf8m\xe8s4\xf7\xc1\xdd.<\xed%\\z\xae\xf2\xfalFU\xa1\xf8Z\xd3(T5j\x95Zj\x9c9[f\xe8\xe4\x83\v\x81\x183\xdf\x10e\xa6\x19\x1ae0\xeeV\xb6.P\xa7H\xb4\x9f\xcd\u019d\xab\x01o\x11\x01\x88:\x95\x10@\xf5\xad\xae\xc4K\x91\xa3\x83\x05h\x91oO[%\x8c\x15\xc0lAnAi\x8a\x95\"\xa3\x13l\xa62uPg\x16\x11\xf0\xd8:1Q\xfcrs\xf1\xbd]*\xaba\b\x05^\u0687\x1e\xa5\xbd\x8d\x91\xdd(\xb9\xab\x02*n\xd2w\xe6l\x10\x7f/\xa1~9\x12]\xeb]\xe2\xfb\xfc\xf0S\xed\xe0\x83\x01\x91\x80r\xc8\xedZj>\xb0/\xd1\x03\xb8]\xfa\x83\x03\x1f@\xc0\xd1\xfe\xe8\x90\x1b\x1a55\xf4\xe9\x86j\u03ab\u016eG\x0e\x0f\xfbAx8\xaf\v\x96f\xa4)x\xcf\xdd n7\xccB%d\xb4\xce\x16\x9b\xb3\x1b\xfe\xbe\xcfw\xbb.v\u05e1O\xb3\x04\u060bz\x9d\xb6\xf4\xf6\xed0\xfa\x1c\x1f\xa2\x84\xf2\xbe?\xd8^B.\xca\x00b5\xe4\xcc\xdaB#\xe1Q\xfd\xed\xeb\x8e\xd2\xcb3\xbe\xc4X]\xc5@v:\xacy\xa9N\xe5S<\xb8\f \u00f5\xec\xc0f\x02\x00\xe91m\xa7\xfd\xa0\xb6\x172mM\xa9\xb3\x05\u046du\xbbb\x02\u0149\xf6%Y,<\xee\xb6\xe24\x1c\xfb\xef\xe9\xf8\x8fF\x9fy\u06b7R)\xfd\xb8Y\u0289\xb4_)o\x15\xc9e\x92\f!\x84\x1c\xb0\x0e\x87\xe5\f\xc6\x1e\xbb!\u07a5(\xd5S\x129\x05t\x9bs\xaf\xd4 \xad|?~>\xb61\x06\xd5\xd7h\xc4\xcd:\x86g\a\x1b&\xc3\bO(V\xfd&n0j\xe4\x06A\nH\x01\xf8Z\xf5\xfa\xf1\x84\xa5\x11Z\x0f\xc9\xfc\xd4Vo\xbd\xb9~\u55aa\x95hN\x16\x1b\x87; \x1c\x12\xd3J\xfc\xe0\xf8\xb4 \u0271B\x96\x8d\u0108\a\xe2t^\x14%\x97\xf8\xbc\xd3z\x9f\xbc;\xb8\u0451\u0628\xb5\x7fnm\xed\xe0F\x8d\xf6\xf0\xb3\x83\xe6<\x8fW\x96\u04e9l\x0f\xbbrP\xb1\a\x87C\x06\x81\n\xac\xaa\x9f\xbdQ6\xbdC\xf5\xa9^\xec\xb01\xec,\xfb\xcd7\x86GLd\xef\xba\xeew\xdb\v\xb5\xca'\x99\x11\xb6/\xcf3\xac\x11B\x06\x14\x88\xfa\u0257\x9b\xcc\u64a3\xe2S,1\x8e\x1639\x86\xf6\x8b|\x8dL\x9c\xe5\xb9 <\xcf\x010\x7f\xf6\xceL\x8a\xc2\xc8\xfa\xcbO\xdbv!\xaf\xccJ\xc4\n\xa0\xfd\xc6\x1bq\x93\xb9\x98\xcc\xfdm\x87\x8dx\u05fc\x11b\x99s\xc9\xef0\\\xc0L\xe4\xca{fr\v\x17\x1ag\u1c87\xa8\xfc/\xd9\xec\n\xa1\\\x805\x0e\x8cf\xed\\/\u0655.y\a\x18)\x0e\x88\xdc\x1a[1G\x0ejXq\x14\xd1\x05\xeb\x1aR\xcboH\x15\xae,\u04ac\xd5Dv\xd9\xea\xb4V\xf5\x8d\xe5\r\xfe\xc8\xc8\x1a\xe7i\x05\x06\xe8\x13e\n\xe1\x9f<\x98\xde!\xcaN\"r\xd4\x16\u075c\x90\x13\xfa\xfa\a\xfc\x98\x10dv'/\\\x9e\xe7\xe9\x15\xc7\x19D\xea\xdc\xd2\xe0~\xeb\x13\xbf\xb0C\xe8s\x87M\xac\xd3_\xac\xc0\xfc\xaf\x8c\xff\tX\xf28V\u0323&\x00i\x02s\x18\x7f\xda\ry'*D\xbaM}\b\xe5kP\xfeds\x9eo\xe5j\xe0\xb5\xe1&\x06X:\xb4\xe6\x84\ak\xfew\xbc.\x9e\xc1\xec\x8e\xcc\xe4\xfaV\xe2[\xa4\u0547\x98QN\xd9\xc4X\x0e\x82\xb7\u03e5\x1f\xb6\x94\xd6U\xc0\xdb\xc9=L\xf7/\x9b\xb4\xc0s\x11E\xf3\xc5f\x0e\xc3\x1cC\x1a\xc5\x11\xc4l\x19n=\x18&{\x1f\x7f\x9f\xfd\xee_\xff\xf5\xf7\x93\xbb\x83\xe4/\x9ew\xbf\xf93,\xb0\x00\x9f~\xf7M6\x99\xa6\xff\xfa\xaf;}z\x0f?\x9d\u079b\xdcK\xb3\xdf\xcdX\xa8\xa2\xa9\x92\xeau\x9e|\x85\v5L\xcc?\xbf\xff\xfe\xfb\xe4\xee\xb7\x03\xfe\xa9\x96VK\xdfy\xd4\xf7\u0228\xfd5'V\x95\x18\xb1,\x9f\x87*M^E\xb4}e\xe8@G\x9d\xf5\x82-A\xf1W\x16\xfb\xafw5El\xbd\xc5IE\x8b\x17\x8e\x99z\xce\x00\x8eq\x8f\x89\xf8f\xc1\xbc\x14\xd9~?\xb0\x93}\xf5\x95'y\x7f\x1f\xd8\xd1\x06>6p?\xb4\xa1\xc9\xe7N\x02\xfe>\xb4\xb3\r\x06\u06d4\x931B\xcax\xb2\xbc(\x02\x87\x81\xfe\xd0$\xee\u01d5\x16_Y\xd6m(x\x9e\xc08g\xd1I\x84\xcb\xd1\u07e1\xc1\x8c.>[T\xca\x11G\u0215\xe2\xe6\x86O\xbc\x10'\xb5o=[\xb6\x15\u0565Ji\xa0\x19t\xb7$y\x84\xe4l\f\x8e\xa4T\x01g\xcd^T\u4e2a\x02Ii\xa0M\xc5\xf3\xc2\xc8s\t\x1eB\x13\xa4R\xb7\x965,l\x1fk\x82%X\xfb\xdaO\xe9|c3\xf4\xb9\xb9F\x8c\x81\xb0\x81\b*\xa4kB\"\u028e\xe9\x97\xf7>\x9c\x85_\xca\x10c\x97,\n\a\u0267\xbejj\x18\u05eb\u0372\xcf\xcd\x0f\xedP\xb4\xce\xcfu\xb1o\xbb\xa0qK\x96\xaa\x15\xa3\xe1\x92\x1b\x1c\xd6\xff\xac\xa5<\xee\xa0\xf1\xd6\xcdU\x15\x81+\x8a\x84H\u046f6\x04\v\xaa\xef\u00e47(b\x02\xc170\xc8\x00M;1O\x8b\xa5Nt\xd3=\xa0\xff\x90b\x86&\xcfh\x0eA3\x9f\x14\xa7^\x17\xfdF6\u02bbxM\xf7D@\x10\u0684\x90\xf7\x84\xf9\x02\x95a\xd6\x14\\D}\x80|\b\x90yK\xb6I\x1b\x01\x15|\x89\xa2\xccq\xc4\x00\x03\x06\xa7\x04\x8c\x9a\x97\xf4\xb1\xa0\x8e@obV\xd7\x04\x0f\x8eFs\x8c\xfe\t\n\xb7\xeaw\x9c\xa1\x85\xc6p\b\x02\v>\xd9\xf7\xde\xfbT\xab\x81\x83qm\xf3\xf4\xacr\xb4\x1e3\x00GW\x1bZ~\x02\xdf\u0184\x027\x91\xb7\xed\x1f\xbf\xcd\u07fd\x1b\xd8k\x80\xc6\xf2\ub879Z\xee\xdfO\xf2\x9a\xb9\xd3\xceoZU\u0422\x9e\u07d8\x7f\x1b\x02LWUA\x1e\b?\xb6\x7fG\xe2\n\xb1\xc7}\xfa\u03e7\x83`\xa9\xbdv\u0362\xf7~^\xe2\xda\xd3\xcf\u04aa{\x80\xadx5fs\xcb\x02\xac\x9b\xe4\xadi\xfb\x9d\x04\xf0\xc1s\u00dd\xa0\x1e\xc2)\xa4\xa0\u063c0\xff;{\xeb\xaaKJ\x1e\xa00\x83\x7f\f\u00a7\xb6;0D\xccB\xa1\x06~Q\a\x9b\xc3M\xd6\xf5\xab\x80\x0e\xb6\x8b\xc9\xda\xfd\x1e\xf25;O\xf7\xed\xae+'\xa1\xf6\xd6\xc5\xf6\x04\x87.\xb5\u01a7\xed\xbe6\xcf\xf6\x13\xb9\xd8\x02\r[\x99\x8d\xac\xbb\x96\x1b\xe1\xf1\xf4y1\xadp\u03b7a\u07281\xa8a\xb1)\x84\xb3\u0352\xc2DY\xe6\xc0?+\xd2\xc1\xdf\xd5\x12ai\xf5\xfe\x10{\x19\xad\xb3\u027eu\xef\u0cdaL/gM\x13\xdb[\u06dai\xcal\xc0\xbdw\x91</\xf8\x06\xae$F[\xa4\x99\f\x93\xf0S\x10\xef\xc5\t!8f\x87\u1166-\xa8D\xe3:\xdb\xdeC\xe3\x89n\x82\x85\xf5\xb1\xd7\xeb\xe0\xa0v\xc1\x06W1\x1d\xef\x80\xffZ$\xafec\xa9M\xec\x10o\x8f\x19\\\x11\xc1\x80\xae\x97\x97 \xa2\x84\x1dN#\xe8\x11\x0f\xad\x9d\x14\xe1%\x87o\xe4&\xcb,\xce1\xe2:[\r\xd9a\xa4\x11a\x88A3\x8eQ\x1e\x86\xacS\x1a\x89\xdf\x11\xe6.\x96k\xa2Ob\x05}\x8el\xd6C\x04\xc3~\xea\xe5L\xdd8Cb\xc1\v\xdd\x03\x1e\xbd\xe9\u02e1\x83\x1b\xbb\xd3X\x0fe\xa5\x1b\xca9\x19X\xca\u07b9V\xab\x16\x89k\x88E\u3a29\x06\xb3\xf1\x03f\xa9\x86;:\xbe\xdc\x18\xad\u00caQ,\x80\xc09^]\xf8W\xc40l\xae\xc8z\xf8(k\x87\xcet\xc71\xa7\xe8\xa1\xe7\xf0\xaf\xf9\x1cZA,ll\xf3eZ\xae\xab\xb7{\xefLs\x84\x9d\a\xe1\xda\x18\xe9c\xa3\xa7\xeckl\x92\xb0q\xea\x18\x0f\xa4\x8b\xce\x03\xb0-\x0f\x858\x885\xf9\xb0k\xd1F\x0e\xa7\xeeo\x8a\x1a\x86\x1f\x9cy\x97\u06b2E+UE_\xf8\x98\xee*78\xe0\xa4\xecP{m\xde\xfc\xdd=r\xabm\xf3\f\xd0z\x13#\xbe\xee\u7ab0\xa0|\xff]\x97\xcfi\x82m\x01\xcf\x10~\xf0\xc7\x12\x04Wt\xb8f3\x04a\x8c\xef/\xef-\x04\x12\x95\xf9b\xc1@a\x10}\x84\xc1\xde\xd1]\x85e\xdfm\xd6pIx\vW'\xd4Z\u0618\xf8Q\xa0\xe6\xac\xf9\xd1\x06\x9f\xbb\t\x04\xc3\xca\xd9OC9\xb4\xb1 \x98m\xc1o\xb7\xdd\xfc\xc84\xc1\x17\x97>\xad3\x88}\x84\xb8sI\x921;8\xc9\xf0(\xe1\xe9m4'\x8b\x1ey\xa2\x95,la\u04d0\xa6\xce\xe6\r\x8c\u00e4\x7f\xaas\xd0\xc6 \xb4\xef\x99\xd4L\xdf\xf4\xc8\x1a\xe7\\\xc1xZ\x88D\xbb9p\xaf\x1f\x1e\xaa\x15\x99{\xa8\x9f,\xc6\xc4\b\xe1\x86g\xd5[\xa4\x1f\xfba#\xd0\xf80\xd9F0\xe2\x02\x86\xef\fGp\xad4\xc6;\x04;'\xd8\xe3\xb5\r\xb5_\xf3\f\xe0?\xbe\xc1\a\x85\x9b\u0682\xbc\x93{\x8f4\xb5\x967Q$\x82\x14#?\x80K^\x81\x80\v\x1f\xdc/\xaf\u0391\x82\xac\xbfd(p\xf7\xcc\xe8T\xfdu\xd8\xd4:\xa5\x89e\x1b\xf9A\x83G\u043e,\x0e\x04\xe7Yy\xe3\xbbr\x1aYhA\xa9\xd8]i\xcf\xf7j\u0441\x96\xa6\x9d\xf0\x9dk\xff\xbe\\d\x14\x95\xe2_$\xa4#\xc1\x9f\x83\x83\x90\x91\xf3\xcd\fe\xc0Dd\x8e<\xb7\"\xf3\x00\u03bb\x96O}\xbe\xeeZ\xf3v\xae\u01bf\xdd{v)\xff`\x94\xde\xfdh \xde\xedC\xdd%\x10J,\xb6\xc6\x16\u0222T\x17\xa7v-8r\x16Xw\xd7M\xc0\x10\x88\xb8\x81XV}4\xf2\xd6=2\xee\xd1am\x1f \xbe\xc1\x9bG\x9d\xbb{\xbb\u0420\xb7t\xf1\xa0_\xc3\x1b\u06e2a\xf29\xe9\xb6|[\xbd\u4ba8\x00]G\x83\x1a\u0292\x93\x95D\xbf\u04e9\xd5\xe125\x10\xeb\xc1\x8d\xa6F\xf7\u07a9$L\xc60\x88\x1d\x8bA\xbb\xf7V3\v&6\xe5\xaf\r}q\xa9\xf2\x9b}\twh\u073bi\xa4\x82\r\xda\x18\xab\x021\x11s\u03f9\f\xc2M!\x02\xc3U\xd6\xf5F\\D\xbd\xa1\xda\r\uad94\xf6\xd9\xdb\u0452\xed\xb8Q\xe3\x1a\xf9\xa4\"F4U?\x13\xdb|K\xafB\xd4\x12\xf8\xab\xbey\x97|\x95\xf4\xd1R\xd6wO\xbeJ~ww0\x18\x04\xf0T,3\a\xe1z8,\xb5\xbf\x0f7\xb9\x14\xf1\x8cJV\x9e\x17\xe2\x95Mq\xb4,\f\x8c\x9f\x7f-\x10J%`\xfe.\xdbj\xed\u04a3 \x8d\vs\x9f\xa0\x01\x16\xd4/K\u02b2\x90b861\xb0\xc3&\x81\xc87C;O\x83o\v\xd4,?\x14\xceca\x83&41\x9f\xd1\xe9-\xc2\x16)\x8cL\f\xfd\u059e\x03WE?\xe0\xfa\xef\u0309\xed\xf5\xcc\xd9\x04\x8b\xe1\xc03\x15Z7\xecv\xbf>\xf6:\x86\x95f\x9d3\x14f\xb7\t\xd9\xca\x11|'\xf9\u077d\u01897\xd3f\x1bU\x8a\xfd6\xa4\xcaZ\x19\xf4\x97l\x00\xb7Q \xa9\xd95\xc3bXX\x8f\xa4 \x0eQ\xe3p\xe2\r*\x9a_\xa3\xb0?#)\xb7\x8b\x8f=$\x1c`\xc2u\x8a\xb1\xd2m\x9dG;M\xc1SV\x83\xdbN6(\xa2\xc3Z\x8e\xa0$b'u\x1a\u058c99\xfd\xbdaR\x13\x12\a-7m]\x94\x8dH\xb1m\xea\x18\v\u02b6\aw\xa2\xfa\x83\x06\xc9\xc4\x12B\x93\xf6\xf3\xc7\"\x91\xc0\xf7\xba\r\xc11\x06\xa4\x01.\xaa\xc9q\xb7\x1d\xb7\x8fbG\xe3\x1bx\xb3m\a\xc5\x1c+\x1b\xf8\xe5\xf8\x82\xba\xbe\xe3\xbcA \x9cjDd\xff\xddf\xf8h\xd8\xfe\xfa6D\xb5\u072e\x19\xfa\x80\xfe\xf4_=C\x1f \x14\xca\xf5,[\x81\x91m2>\xed\r\x93\x1e\x11\xd4\xcb\xcd\xe4x3q\x7f\x1f\xe7\x7f\u02c0%;\x13[\x0f\xd2\xf9a\x11z\t&\xf6\x9b\xc1c.\xef\xe8<\u00e5@\x8aE?\xa0\x80\xcfa\xedZ\x8b\x06\xc4\xccij\xd6n\xb4.FPvlR\xa4\xa5\xd5\xc1z?\xd9\xf6s\xae6\x8eAJR\xbf\x1c\xaeV\xc89\x85YJ\x89n\x9b\x94\u0173\xe7\x80P\x00\aeF\xfa\xb2,.\xf2\x19g\x1f\xdf\xdd\xdb\x1b\xee\xed\xedq\x00\xfbdC\xf7\xafJ\xc0\a\x93\x0e\xf4q\xef\x1b|\ac\xa1\xd2\xf9\x9c\xc1D\xe5\u046cX\xa8L\x1c\xf6\u00f2\x92\xa1\x1a\xbb\x04l5\x88=\xe2H\xc9Wj4.\xbb\x0eN\x997\x1d\xb3T\xb3l\x81)B\x1c\xb9\x87\xb9\u8099\x90/qT\x85\xb7\x0e\xe6\x8d\u0505\u0418Y\xc8^a\x1eyV\xe5g\u84f5)\u07b0'T\xe0-\xdc\rC,0\xec\u02e2\xfcPa,Xv\x91-\xc9p\x84\xd6\xcbRW\xeaV\xbb\vT\xaca\x1d*\x02\x87\xe21\xfdX\xac3'\xf0\xfc\xf9\xee\xdddQ\x00e\xbang\x82\\\b=\xbb\x02ra\u01d2\xe8\x18\xf6\xad\xbaL\xa0:\x9d-P5\xcbOO\xf3\xe9f\xbe&\xe8\u05cfDX*k\x9d}\xf3\xb0DX\xb0qI\x12\xdcy\x96\xa2\u0636J\u035b\xf3\xe2\x8cK9\xce\xd3\xf2Lw\r\x14\xea\x05/\xe9M\xe6R-*\x12\xdd\xfcO\xb1V\x19ZF\x17\x85\xec\x8f\xf4,Y\x82G\x80\x9dcc\xbb\x8d\xe6\xb8o\u02ac\x92\xe2\xcfx\xe8\xffc\x93O?@)\xa8\n\xc6\u0325\x97J\xa8\xb7\f\u9f2b\xb9Q9\xe8D*:qgsZ\xd5\x12E\u0510?yG\xe6\x81!\xf9\xc9_\xa1\xe1i\xba\x12t\x87\x15>\x85%\xa3\xc3g\xcbA\x95)\x97\x82.J\x97\xabV\xbf\xb3\xf0h\xf8\xc9V\xd2!]\x17\x9a\x1f\x01\x9e\xca\xc3\xec<\xbd\xc8\v*T\xa6nc\xf5!g!\u029fb\x10=~\xf3\xe0\x8f~\x1d)2\xcbRT\x1a/\xa7a/X_;w\xb9\xd5\xf6u`\x82~2\x93\xf9\xa1\x7f\xd7\xc8!w\xf7\xac\x19\x19\xa0=0>\as\xef\x80\xe7\xb9\xee\xb8q\x8e \x12YcN#\xf6\x8d\xac\x95\x82M\v\xb3\xa7`\xcd\xc6\x16WM-\x04\u051c\x85Ll\x8ey\xe30\xfb\xef\xe1\u07d8.\x00\xa3\xc9\x10\xe5\x03\xab\xdb\x11$\xff\xcc\xec\x14\u06b5\xe5$K\x99\xe5\x8cP\x10\xcb\f\xde0\"\x0ef\x10\x9a\xf3\xf4#\xe3\xe8\xab\xf2x\xe1\xcb\xf4\xaa*s\xc9\x15'a\x14G\x80\xd4\xe2Mx\xf7a_\xa6\x91q\xdbZ\u04f6vs0t\x19\x8f<\x0f\a\x04\t\x9a\x16\xca\xcb\xf0\xa0\r\xcab\xc4\u01d0\xf1\xad\xb9\x00\xda\x1a\x0e\x81\xb5\x9eC|\x82aN\xf0\xee4\xc5\x04\\\xc0\x1e0\xe7\xd4P\x87\xed\x13\x8cO\x84\x90\x87hEn\xfe\xb5\xe7?\xe0i\r\x17H\xf4v\v0f\v?\x01?\x84J\x9d\xe8f V\x8e\xe7Nl\f\x0eA\xc7V\xee\x83]\xcf+8\u00ae\x96Tr\x0e\xc07e\xf6\x1f\x9b\xac2\xf3$\x86l\x96\xefLf.\xd7\xc5%\xa4\x86/{\xec\x16\x02_\xd2f\xc5\x01\xe6X\xcc\x15h\x12\xf5\x15\a\x83T#\xea\xc7K\xec\xfc\xbd\x16\xf6\u0677&V:\x8e\"$n\xe9\x81U0\xcf\xc9J\x80\x9e\x18\xad\x8a\xd5f\x8e\x91O\xb4_\xd4Ru\xb5\x9c\xd2a\xa1\xe5\xc4ho\xb7\u04afX,}\x1fz\xf6x\xb3\u0362d\xf3de\xe4\x999\xd4\xccZ\xa7\xc9\xc2\xdc\x19\xf9j\x9e\xd3e\x9d/\u1eae\xb2;\xb3\x8c\xfeA-\xb8\xc8V\xa8\x1a\x83W\x1f/$5H+9N\x8e\xb3\f\xa4\xca\xf5\xaa\u06bfs\xe7\xac(\xc6g\xf3;\u055f\xb3\xf9\xf2?\xecJa+o\xe0\xab\xe7\xb6\xe7\xf7\x94Z\x1c\xac\u057a\u0618\xa3\xc1\x9bt\t\xf0\x16\x97\xba4\r=\x9e\xa4@\xd1\xd4*\x18\x87\u032dH\xa8\x0e\x1clu\xc5\xef\x99e5\xdc\xf04G\xde\bNHf\x8bh)w\x88H\x05\x82T\xc3\a)B\xefz\x8b{\x02\x0f\xf4y\x12\xc0\x10M\xc38t^+<53\xb5z<p\xa0\xf1K\xb6\x89\bL\x91\x8f\u0451W\xc7,eP\xf0\x87#&\xe9\xf3Arf\b\xbaV\x92Q\u23f9\x06\xea\x90qh\x00\xb0\x18\xcf-\u044b\xea\x89?\x14E\x8b0\xc7^\x82\xdap\xf7[\xbfGm\xf5\x9f\xae\xcb\xf9\xe8\x02\x03\xa6\n\x9b\u4230Gtz\x01\x06(\v{2\xdf\xfc\x04%I\xb3\xbaV3\xcb/j\x9cC#!h\x8eq\x04\xeb2\x15\xf0W\xda'\xc4.\x80\xa8\x1f\xb3\x89\xb39\x81\xbd\x90\x92E\xbfWj\xdb\xc883A\x1d\xa5\xac=x\xf4\xf8\xe1\xeb?\xbew#\xfc\xe4\xec\x16e\xf1\xf1J`\xab\x8c \x83\xfd\xba\xeb\x8cE\b*\x9e\x8a\xac\x93\xb1\x9e\xce\t)\xfa2\x9d\x7f@\xd4\x13\x92\x92\xe1:\x15\x94~\x92m,\x12\xb4H\x15\x84\x1dU`\xe1hixZ,2\xae\xed\xd4\x16\x90\x057\xe9'&\x06\x94D\xe0T\x11\xb8~\x1d\x8e+_\xc2H\xa7Y\\\x88\x19\u01c1N\xeds\x15V\xe0~\u0122\xcf\xf6\xaf\xe0\xb40\xb7S3\x0e\x13\xe8}\x16\x9b\xd8\x0f\r\x7fg\b\x00\xb8\x1bs\x14U\xa1d\xce\x06\xfeA\u07e0\x86\xf2t-\xef\xf9\x12\xb4\x99\xa5\xd1V\x19T\x87\xf6\xf1\xd4P\x19+I^\xc2\"\xe8\xa7\x1b\xb3\xb0\xcb5W5\x9f\x80k\xb5\xaaF\xc0'FE92\x17J:7:\x05\xb5Fz\x9b\rCx%'\x9a\x9e\x1a=\r\x95*`/\x9c\xc9/\xa3%\x95\xabbDV\xae\x9a\xf8\n\x9d9O=Q\x84q\x85\x1c\xbd\x95u\xf5`j\x16<]U\xb1V\xe1\x04\x05\a\xd2=V\xe7k\xcb.\xe9\xec\xed\x7f\xc8=:Cu\xb3\xec\xb0M2\xfd\x7f\xfc\x8d\xa2\x8e\xe2\xdb$n\x0fi\xe1\xe6\xa1G\x7f\xeaF\xc1\xfb\x16Q\xbd\xdb\x1a\xaa\r\x15+\x1e\x03\xfeN\x0eRK\xcaW@\n\xa9M\x84*\x1b\xf6sd\xe7vX\a)\xffc\x0ez\xb6C\xf3\x13\xad\x82\xc1B,,;\xca@\xd6\xc5gu\x0f\xd8?\x8e!\xa7\xcar\xe9\xd4(\x85\x02j\x0ex\x89\xab\xf5\xf9\x88\x1e\x11\u009bu\\0:\xba+\x96\xb5\u031c\x87#\x9f\xcfJ\x18W\x99\xb9\nZm\xacP\xd9!\x81\x83?\xb1\x11d\x9aG\x12\x9c;2\xdd!\xf5\U00060f2a\xd5\xe5\xa5\x17t2\u010d\xe6\xf2[\xd2\n\xd9\xf6^\x9c\xf2\v7\x1dtoPX\xcb\u03cd\xa8\x01\xfb\xfb\x81\x8eXM\x17w\u045f\x14\xc3\xdc\xdb)\xe8(\xc0\xf2b\x10\xa2\xdcC9B\x15]\xb9l.\x1d\xaa\xfdR5R96\xa2\xeeyY,A9Ek\x86\u0730\x92\xf3)2\x0fP\x87fF\xce<\x84\n\x8b\xd9\xe8\x11\x00\xefU\xb6\xbd\x14\xe1f-e\x05's\x95\x8b'\x8bj@S\xb7C\xb4\xdaX\xe4\xc4\x04ZL\xcb\x1di\x05\x86\x10wR\x991\x9c\xf2\xe2{\xc0e\x807\x16\x8a\x18\xec\u0384\x11\xc00\xc9=\v\xc2\x01\x1d$\x10\x11\xf8t\x80\x11M\xe4w\x11\xa7\xd0\xf6~\x99\x91\xe4\x8b\x12\xc8\u0666d\xab\x95\x913H\x9dR:\x95\f\x16\x16\a\xc5YT\xac@Y\"u\u045a\xbbn\x11\xe7\xbeE\x1b\x9e;)\xc55Ao a\xf5m\xe5e3s}\x15\xd1;\xaf \xf4\xd1\x7f\xcc\xc0\x00\n\x84\x16\xdftU6\u076b\x16\x01?|\xf9\x85\xaa\u0483\xaf[\u058aw\x8c\xdf+\x03\xd0{\xcd\xe0kA\x97\x99\x82\xdc\x0f\xdet\xfd}\xbaq\xad5\xc5V\u0696\x14_h_\xd1\xc8\xd4\xe2\v\x1a\x9b\\\xd3z\x06\xd3\v\x973\xb6\x8b\xb1\xf5\x8c\xeea|A\xc3\x1d\xb4>TmR\n\xe5P\xf0\xbf\b\xf2\x9a\xd1} \xd3\xc7\u0697\x94\x91\xad&\n\xc5o\u0796\xbb4z\xfd9\xec\x7f\x00=rSQo\xd9\xd0\xe1\xf0\xf3\xa8\xdf\xca.k\xcb\"\xbaBy\xfc*\x14,\xee\xf7DjB\xb7\x83}hs)u\xcb\xf6\u07f5\xb2\x8d\xaa|\x1f\x7f\u03df\x9b{\xbb\x02\xe4\u05ac,\x8b\xb2\xdf;\x0e\xc49\x92\x8c\xd6b\x17\xc6\xc4hQs\xf6\x93\x9e_)L\xc2\xc8#\xf3\xb3\xc5^$\xe0\xcf\xe2j[j\x10jo\xa6l^ \xfbbd}\xe4\x99]\x1e\u056a\xfc\xb3qq\xec\xc7\xdb\xd6\x06_\xfc\xbc\xa5\xb1\x13\u06f2200\xb7\xadV\x82\xbe\xeff#\xbf\xf9\x04\xc1\x9c\x05\tP\x15{\x8e4\xf5}sS\x9aG\x85-E\xa6\x02Rpl\xf3\xb5 \x14g\v\x90\xaf\x1e\xe3PN\xcc\tf\x15I\xab\xf0\ak\xe5\x18\xef-1\xaa\u065dD\xfeA2l\x06:\xbf ?\xa5\v\xceJB\u0765Z\xf6\u05aa\xf0\x90Q\x8d\xa45\u00b9\xa0\x98\a)E\xce\xe4\f#\xd1e\xad\x03\xd1\xccR\x87\u0752a\xf26\xb6z\xc3\x18\u057c\x1b\xe8\\\x1b\xdb\xd7\xc0\x82\x11!%f\x97\xc9c\xa2\xdd\xd7F\x80[\x91:\x84\u050cB\x15\xa1\x8cK\xdb=\u0764\x1a}\xfb\x9e^wgt \xae\u03d6#$z\xf3\xb0N\xa3$r\xdaX7\xc2L\x9a\xe5\x17\x12\xcajNgM\xb4\x8b\v|N\u031beF)I\xd7\x1e\x8c\x91iR#8\x92\xbd\xcb\xfc\xc7\xddA\xf9ii\u0205\x7f\x8e\x96+\xb7\x19=\xf4jO\xc5\x00\u0477\xb5\xe4\x1d!\x8f\xde\xc4hIY\t\u0441\x8e\xa3\xf4\xc8\x7f\xb6\x0f\xfe\xe2\x7f\u05bfKq\xa5\xfd$\x9d\x18\u03b5Yg\xfa)\x1a\x16\u98deu\xcf\b*)\r$\xa9\xca)\u0216\xff\x04\x84\xfd\xe4\x89Q\x91_\x80\xd0|\x99W\x99\xb3\xcb\xd3\x1c\x181x^\xa43\xb2\xf5\x02\xc5g\x15}\bI\x05\b\x84Y\xa1\tL\xecd\x9c\x9d\xe8\xfa\x93\x1c\xda\u07a2\xf8\xdb\u04e5Y8\xf28\xfc\x19y\xf9\xa590\xc0\x8c\xa1\x1b\x96\xafRh\x1b\x15}\xf2\xc0\xae\xafTx\x93,e9\xa5\xbc[\x9c\"lI-'\x88_\x1d\xd4\xf6p\u0323|\x83]\x83w\xef1L\xed\x99Qz33:s\u06601\xb6\xb7kz\x18\x99.\x97\xaf\xf0\xeb\xf7\xe3\x89i\x9e\xbcd\x03+!\x181\xbf\x96\x10&?\x04\xa3{d\xe1e\x13\xf8l<)fW\xcd\x14\xb4H\u02f3\u0710\xc4\xde\xea\xa3G+\xe4X\xae\xfd\xdeD[\x8az\xf4\xcf\x12,\xb7\x9f\x9c\xe7\xb3Y\xb6\xd4\u03cc\x9eW\x15\x86v\xcd\xf4\xfa\xa3\x11\x9e\xbb\x11z\x1fF\xf4d\xc4y\xb0\xea\x93\xd1e6\xf9\x90\xafG\xe0Q\x1a\x11\xdf\xd9G\x95\xdf{\xc9PK\uc341/\x93\x91EX\x95d}C\xc2z\x0f0t\xb3\xc9\xe6\xec\f\x8b\xb3#bn\xc2\xcb!\x0eiXR/\b\x122\x96\x906\xa51\x8b@\n\xb6\a\x8es\x18;jtigjw\xb8\x93\x93b\x95\x1c\xfaX\x96m\xaf?,\xd6\xe0\x85w_\xf4\xa6\xe9|\xda\u05eb\n\x1e] -\x8eu\x19\x18\x8e\xf8\xbbA\xcf\x17\xb69A\x14\b&\xcc3\x84G\u0114\xa8c?7\xcfR\x12z\xff\x93_\xd4N$\xe2\xd2\xdf\ad\xff\xe9\x87\x03\uf650R\xdbH\xfd/0\xb3n\xd7\xcf>\xd1\xd0ab\x10\x15\xe1g\x0er\xa6\xb5\x9cs\xa0\x9a\xa3\xaaz\x96/?\xbc\x8f/\x86\x19\xc2\a\u0160\xf5\aA\x1a`\x99\xcd!\x1e\x89\x92m\u03f3l\u076bw\x84U\x89\xb6\xaezt\xe8\xb5f,\xcf>y\xf1\xe8E\x1f\x0e\xf5,\x1d\xec'\xc7EY^Q\xe4\xa1\x19\f\xd2\xe8\xfb\x1e\xcb,V\x96\xa1\xea\u00a9\xba\x13\x89\x94-6:\u0166\xfc\x15\xf2\u029ebB\x19\x06\x97\xe4\bp2\xc9\xd6\x10,\x80! \xe0Fq\x168D\aN/\x8a|\xe6\xec\x15`\"\xcd+6/\u00e9\u02f0\xe8\t\r\xf04\xcf\xe6\u6f98\xe5\x84-\x81\xc1;\x10\xearvn\u0778\xe0\x19\u06a0\xf5\x19\xfd\xc8F\x1e\xb8\xc2\xd1s\x0fh,\x86\x062\xaa\x92lO)F\xb7e\x14\xd54S\u054dx\xeeh}\xba\xc8Kh\x9b\x9a\xfa\x90]al\x0f\x89\x7fO\x9f?\x86\xc9?\xdcP\x8d\x96\x04\x83.\xa0\x823H\x16\x10\xbe\x03Q>\x84\x15\xba\x02\x7fU6\x87\x98H\x8c\xbc\x91\xb9\x9bA@\x98\x10\u0301\x9a\xc0h8\x18$\xa3 \xe3p\xf2e:3L\x13\x0e\x97\x99\xe3b\x03\x85\x17\xcd\xf1\x04\xab\x0e6\xcd\xcbv\f\x93\xa1U6\x8dX\xd4:\xa92b\u0683\xb0$R\x89TM\x90\tD\xbd\x80\xb3\xd4H{\x10/\xc4\xd9\x7f \xc6:\a}\x95\x9ef\xa6\xef\xfcl\x89\xc5J&Wl\x1b\u33dd\x17\x8e\xc9)N\xc0\x1fG\xf4X\x9d\x16~?8(|m\u026e\u00e1\x01\xbf\xe8\xd6\xef\xcc\x1c\xe6\xf3\xe9y6\xfd\x00\x9f\xa0_o\xeb7\xe9f]L\x8b\xc5jn\x04\x06\xf8\xca\xec\\\xc7o0Di\xa7O\xd2\xd5:\x9d\xa38\x90\xf4\xe0\x06\xda\xfa\x95\x119i\xf6\xe68O\x8a\x8f[\xdf7\u02c5\xf6b\xf8ft7\xf6z\u04e5?5\xb4\xb0\x1e\x99\xa3\b\xf7\xef\xbaL\x97\x15)\xbd\x9ao6\xb3\xeeS\xb3a\xa3\xd3t\x91\xcf\xcd\xd3E\xb1,\xcc\xd7\u04ec\xf6\x060d#\x11|\xe3\v\x10\xf8\xc8\xf0\xee<5\xff\x9d\xe7g\xe9\x1aB\xc4\xea\xb7x\x93\xa0!\x12\xc5\xc8\xf4M\x06\xa1\x03\x9b\xb30\xfa\x18\x933\xcc!Xg#\x1c\xe3>\xc4\xdat\x11[6k\xb8khT\xc9\xcd|\x01\x1e~3`f\xe1V\xaa\xaa1d^ym\x82\u2f68\v\x8b4\xfa\xdeP\xc4?\xd29\x02\xf1ok+\x18\xa9\x116\x82\x81\x18\xbb\xb6\x84\x01\x12\xa8\xf1\xba\xe6(6\xe2:\rA\xcc\xf7\x97h\u01ec\xef\x97hf\n\x9e\xf0\xf9g\xb6\x04\u19ae\t\b\xa3\u07b5\x05\f\xa0pM`\xd8D]\xe0w\xf4Uk\xc0\xdcJP\xef\xd85\xf1\u043c\xf7\xa7\xec\xea\x91\xf9\xb1\u0790\n\xa0\xa2\xda\x12PxJ\\q6\xe6\x81bI\x18s\xc0F'\xa2?\xa9\x81\xb7\x1b\xb5I\xb1\x1b\xfbr3\xc3if&N)\xc5atU\x1e\xa2\x9a\x000\xcevM\x80\u0788\xecTx\x90\xed\x9c\xdcB^\x16\xec\x891B\x06\xa0\xdf8\xa1\x9f\x02\xd88\xfe\x8e\x84\x9c\xd5\x15\xa9\xbd.b\xa5X\x91\x85\xf0az\xd6|c\xe2\x1b\xa3Iz\xa6\xc6\xe8}y\x9d%n[\xc7]\xa5\xe9:3\xd5\x19&\xa8\x8ax\u04cc\xcc`:7L\x1516\xec\xda\xfeH\xae\u2264\xbeBE\xbdSXb\xacR\x94\xcd9\xac\x8a\xda\xe7'F\x9a\xa1\xe9P\xe8:\u01993\xf4\x03X\x00\xa4\n\f\ue52b\xe0G\x95\xf0b!\xe0 \x03a@<\xb9\x1f\xe7W\x1c\x99\x17\xad\xf6W\xcaX\xb8\x19\x1b\x02/\xaes\x99\xf7\x13\xd3}\xe3v\xc3D\xfc\x8d\xc6\xd7k{\\\xdb\xdb\xc8\u046bQ\xb0\xb4V\xdb\x1f\x19\x92\u07e7\xb7+\xdb[WM\xf9\xac\x86\xf6\x04Mm\xe0\xc4\u07c0\x0e,\x8c\x06\xe4Z\x88DO\x90~8<S\xa4N0\xa7o\x16(o:\xb8\x11\x1b\xfd\u0356W\xaa\x95\xc6\x01\rWF\x00W\xda5\u011e\xf4*#\xf3bz\x89\xd9\xff\u0285\u063a\xf89\xd0H\xccd\x00\x95i)\xf8X,\xa8\x92\x18\x9e\x1b\xf1\xbc\x00t`\x851\xcc\xc7\x1cl\\a\xe4$\xb4\t\xb11\x9c\xe2d\x9d\xacO\x197c\r\x99'f\x80\xf9<__\xc9\t\xecI\xd1-\x9a\x14\v\xe5TK\xa1\xbcbCC\xbe\x9c\xce73\x9e@n\x03d\x1d\xc5Rv\x01\x85\xd7\xf60\xf4\x95\x9eU\xbdd\xb3\xbaD\u0565\x8f?#\xef\u01f8N\f\x98\x81\xf5p9\x14\x1c\u0518ju0_dP\xbc\xec\rcn\xc1\x8e\x0f\x83\xce\xcf2\xa9\n\x06o\x98c`\u059d\xea\xbe)_\xdd\x03C\xf1\x9d\xae\x10\xf5z\x9d\xfa#\ubddd\x81\xab\x16}\x02\xad.\xce,\x16\x9a\xf8i#Q\u04b2)\u657f\x15F\u0652\xd8&\u02bf\xe7\xc0\xedy:\xcdl\xee\x92Y\a\xc3=!*\xd9\x16\x94\xc2pz\x89\xc4L\xe7\x19\ub9ecM\x8cc\xfa:EZ\xb9\xa4!d\xc9F\xe5\xae\u010b\xb4\x14c,\xaa\xb2\xe0b\xe2\xe6\x84c\xf1Ld\x020\xfadn.#\x88\x857\xda6\xeby\x18N \x91\xd0V\x89G\xb3\xb0S\xce!\xf1E\x86\xc4\xc0\x03\x10\x06\xbc\x8f\x06\xae*\x13\xa5\x9aK*N\x1d\xe8\x9c,\xb0\x1d\x9a\x14\x11\xfe\xb8\x98c\xaeb\x8f\u06f9\xbc\xbc\x1c_\xfen\\\x94gw\xee\xed\xed\xed\xdd1\xbb\xa36\xf7\xc2\xdd!`Zo\xb3\x9e\xffx\xdc\u01f6\xc1\xe4r\xa1\xafOh$P\x9c\xf0Es\xdc\xf1\xbf\xado2\xc44hXw\xc7wk\xad6\xdd\xc5\xed\x96v\xc3s\x03\x8b=\x14w\x0e~\x8a\x10=\u04315\x9aT\x10\xb2G\x9eFqh\u0222\xff\x95\xb6\xea\x14\u009fS\x8a\xd9M\xce\xf1\x80T\x12%bv\x8cZ\x02-u\u00e5Q\xf1\u0359\xc3X2\r\x00\x17\x01\xdeS \xdaMe6\x1b\x14\xa2\xcb\xf3\"\x01\x15\xd2\u024b\xf8\xe9\td\x175\u0673\xa0U\xc8\xf3Rk\xa8?\x1a#Hb\x8f\x02\x90G\xf8d\xb4\xc6G\xbd\xf8\xfb\x1dUa\xff\x9b\xe8~\xb5\xed\x96SC\x95\x16k\xb5F\xfd\x1bo\xa1\xf9\xc9:w{tI\xfa6\xf4^a\xee>\xdc\u057d\xa6a\xb2A\u4c58\xc1T\x9cx;\xcf\u04ed4\xb4]\xd3(,Q\x9a%y\n\x06&Q-(\xe4\xfa\xa5\xfb\xf8D\u07a8\xeb\x19$-p$zP\u058e2<0\xdc\u04da\r\x98\xbc\xc0H\xb0(\n\xb2\xc0\x91\x90`\x13\xf1V\uc44b\xe1\xdb\xc0\x97O\xa8!\xc4\xfa\x15)\xec\xe8\xf8\u0633N\xe05\v\u05de\xb4\xedW\xf0\xc2.\x92\xe4\xd8e\xa68k\x06\xf61\x8eu^\xac\xd6\xef\u0768_\xac\x80r\x8cHs\x81\x03\x81\x8e\xacn\xe2O\x90\xf2\xe2\xe0\xff\x1ee\xa7\xe9f\xce\xd5\xc9lAX\u02a4\xc6\x10\u01b5\xd8\xe7\xb2\xd9V\xa7\xa49\aO\xdcr(\u03e4[\xa4\xa1?f?\xb2[\x19\x8aN\xbdv\xec\x1f\x02o\x1ai$\xda\f\xcd\x1e\x06ul\x97\xe9\xd0\x1fB\r\xbb\xb6s3\xbd\x9e\x8f\xd2\x04\x8e\xea#\x9d\xf0&\xf4\u05f2dgMKF\x93\xd2 +M\vT+\u0758J6\xa4\xb3\xf7+\x19\xce/\x19\xa5I[\xd3\x02D\x1c\r\xf1\ue1f9.\vi\xd20,\x10C\xc0\x97\x8ab\b\xf4gx\xb2\xe4\xe1c\xe8kQrYo\x9f\x9cl\x8d,\xb8\b8\x8d\f\x8e\xdf\n\x12tf\xaa\x83.t\xf6\x9a\xbc\r\xafK/=\x7fS\xce]\x86\xbe\xfdc\xbb\x7f\xe4\xbc\xcc \x81\x1b\xbe\xd0\xc1\n\xf5\xcf\\<\xce\xe0F\xd4'\xd6\xea\x1b\xc16\x06\a~tJk'z\xfcA'\xb4\x96\xad\x9dl#>\xb7\x8e!\xa4\x10BZ\xb9\xb3\xa9};\x81\xcb\r\xad\x18\xdb:\"\xd9 \x0e\x14)\x1ec|\xa7_7\x87\xd8\u07fb\x9c\xa42;\u00c0\xd9#0'\xefr\x9c\xd0\xfe|\xd0a\xc1Z\xfa\xc06\x1a9\u0694_\xef\u0593\x99\xcdCs\xa6\xae9\x9b\x89\xffi\x97y\xb5\xf4\xd6>\xafI\xed\xc3\xe9\xee}>]\xa4g~I.\xf8\xa1C\x9f\xf2!\xbe\xbf[\x9f\x9c\x92\xec\xf2\x8d\xcc\xdf\x1dz\xe4\xcf\xe0\xed\xdd\xfa{\u0262\x9d\xeeS\u013d\x0e\xfd\xaa\xcf\xe5\xab.\xfd\x1fy)qvK\xed\xaf\xaag/{\xce\xfd\xe1'Wp\x10\xce\x06S`#\x95\x811\xff\u0407,\x8086\x14S\x9d\x9a(w\x91o\xbb\xc0\x97\xb6r\x7f\b\xb0\xc5\xf6\xc3\rT\xa1\xee\xf4\x84\x1a1\xef\x1f\x99\x1b\xc6\xdc\xddp%\a\xae\x11{\x8a\x88\u044a\x88\x8d\xf9\xc7\xf4\a\x05\u0430\x98\x8d\xbf\xd3\\F\xad\u024d\xc0~\xdb\x16\x8e\xda\u063erl-7\xaf\x9bi\xf0W\x8b|\xb9\xa9\xae\xbfl8\xc2vn\xe2-q\x7f\xc03n\x9b\x0f#\x97\xb4M\xa8\xdb\xe8(\xe7x\xb7\xe1Q\xe7M\xe0}\xd6\x02B6\x8cb>\xab\xea\xc8'\x82\x1f\xb3s \xdeY\xbc\xecv}\xd0\xf6\xfa\x8e\x8c\x93\x06$\xc6?\xab<\a\x03\xfe\xec\x81\u04a2\x85\xd5\x0f\x1b/\x13\x1f\xc5\x1f\x8bE#\xea\xfd\xf2\xcah\xdc\xd3s\xf2\xd3\xfc\u060cM\xa1:\a\xbc\x9e5\x82\x054H\x01\xad8\a\x1d\xb0\a\xf4H\xcf\xc1\xf0\xed\xa5\xef(D\v\xefh!?\xa22\u0612 \x8f3#@\x17\x04$H\x19\t!\xd4\xff^`\xa2\xccN(\x1f\xb2\x87\xa2{\t6\xcf\xce[Y!\xe0\x93\xed\xb6\r\x02D\xb4a^}\u07e0\xde\b\xfaa\xaf\"\xb3\u025by\xf6\nW \u0426\x9f.\x8d\x82\xb9\ba\x7fl\x14\x1a\u011a\xab\xd4;\x040\xc28\x91R\xb0\xbb\xd5\x19\x84\xf6,\x00\x11\x14[/\xcc\x0e\x96\xa0\xc7\xe6\x16\xd4\xe8\x98\xc3D \u0786c\x88\\\x98\b\x16\u8791->\x98\x9b\xaa\xf9i\bnY`\xc5\u07d2\x8f\x1d\xa8\xbc\xcbu^B\x8c\t\xe0\xdbdH.\x92\a\x88\x88\u04f3|\xc6\x06,\xb2\xba\n\xbc\x0e4\xb3tI\xa1z\x04^\b\xa9\v\xb5\x17\xd7'c/\x11IP\xb2\xe1\x14iv\xe6\x11g\xf5!_U\xbch\u052aE\xd3q\x88vD\x9cC\x1d5\x03\xf7\xeb\x840T0\x8f\x91\xa1u\xc0\x9c\\f!{\x86D/D\xf1\x15\xdf\x12B[Z\u02f3\x03\x938'x\x1a5\xd0V\x12\u0357\xb8yA\x84r-3\xd1\xf7\xfb\x04\xa9{*A\x11\xe2\xaak\xbe\x1e]\xb2\xc9}\u0650\aHI\x82\xac[\xb1%\xd0\u04e1T\xf9$I'\x8cd\x12\xb62\"\xe1V\b\xff\x86H\xb7^\xa5`\xb0[\xb9_]U=\x9aS\xe4\xed\x87\u0783\xbejR\x99\xba`\xff\x7f\xa2c\x04\u0219\xef\xf5k\u00e0\xed\xedZ\x94\x1c\xf9\xa7-\xfbg\xb5V\x8b|\xa0\xb6;\x9aS\xe4\xa5\x1e\x86\xb0\t>\xad\x18NuBO\xfa6\x01\xad\xefB\xf8g\x19\x84KQ\x0eW\xac\x05['\v^p?\xdbh\xfea\xb2\x17\x94\x9d\xda`^\x04O\x1b\xdc\x1av0\x80\xbe\x84\u01cb\xa3\xf3\xd2\xcb\xf4J\u02f4\x02\x0f\x83g\xbf\"\x96\xc4\u070fs\xd8!\x85yiT\x13J\xc5AO\tD\x8bc&e\xae\x0f>\u3a290^\xc2*#\xa0\x1e\xb6\x9f\u06c8v`$\xab\x14`mg\x9c.M\x06\x17\xac\x1a\x05\x99\u03d0\x9e\x9e\xac\xd3\xea\xc3\xd6sz:\aXl\x9ae\x97\x8d\xa6\x05\xb1iGpu\xcav\xc5\u07e4u\xe7m\x8b\xbe\xe2%\x105\xd3U\x87.\xd5\xdbm\u0746\xd4\xc2H\x86>\xad\xd4M\x82\x16\x11\xa9\x067*\x99\t`\x93\xf3T\xa2\xdd\xeet\xb4/\x06:\xcd\xeac\xab\x89\x94__}\x84ZQ\xab\x8f\xca]\xd5d\x8b\xac\xcb\xc7\"$}\xce\xe8\xcf\xe2\xa3\xf7DK\xc3z+\xc3W\xd6\xfd\x96\xb9\xf8\x83|\u0380bxg\xf1\xc0l\x0e\x93\x83\x0634\x8fpCU\x93\x8d\x1e\ucf57\xa4W\x9c\xc86\xf1\xdf\xe6\xf2fd1\xbc\xf8zK#\u04e4\xf3\x9e\xa1E\x91\u048aE\xbe^\u04cd\xe70\xa1\x1d\x86\u0667\xe4A\x80j\xc62\xe0\xd65\xe3~\x8f\x02\x884\xbbxn\u0536B\u070f\xb6,'!\x0e\x8b\xc385\x82A\xca2\xaf\xd3\xc4\xeaK%\x9eO*\xef\xf9\xe2\xf4\x19\xe3\x16\xdf\xddCHo\xaf\a\x8c\xbcA4U\xccv\x8aue\x95\xd8\xe6\x9e\xe0[\u018c\xe5n<\xfcTBp\xf3\u031c\x16\u052d\xbd\xe2\x90\xf5\xd9{\x9f5\xbaA\xb79Bc\xae\u042834\xea\x0e\xf5\x9f\x8b\x11\x01\"oU\xc0\xa6\xff\x12\x1b\x14j\xef\x88\x01\x9a<\xab6\xbc\x9dS\x93\x04\x9d\x8c\xca!\"\xf5R\xc0:\x1f\x10H\xb7\x00H/3Mi\xc5G\x81\x84\x9c'#\xee\x9e\x16\x1f\x83\xa5\x83\x8aH\xefw\xaa\xf3\x14|k8\xe82+\xa1`\x9a\xca\xff\xe8\xf7\xfe\xdc3\x8cse\x1a\xe9;R\x18`e\xbb\xb27\x90G\x1e=Fv\xb5\x1e\x12g\xbb\x95\xf5r??4\xd2.\xf4\xb5\xdblh\xbd/\x01\xb4\x12\x10E9EZ\xfc\xcd\x10\x84\xc1\xcd6\xf5V\xe7\u02bd=\xe6\xc8\xf1\xf7};\xbaY\xa8\xb0\xe6\x87]Y\xd7\xf2\x1b\xb1\x8e(\x96\xf6\xeb\xafR\x01u[\xa0\x14\x9f\xb6\x03\v\x0f=\xb7\\\xa7\xd1T\x16\xae\xb42\xaf\x05`\x8e\xb696\x17\xddQ\x87\xbf=\v\xcd}\xc9\xcc\xebN\x12R\u010d.\x04a\u05d6\x12\x84\xa0A\xd95\a\x83\xed\xed\x01Uw2R\xf9A\xd0A\u037bR\ub83e\xde\xf1o\xf4\xbb\x91\xc0\x91\x86\xd8\xed\x8b35\t\b\x9byb\xd8*Z\xd7]\u0207\x8e\xe69\xd8\xd6Emp\u0705\xbb\x9f\x9dE;\x8a\x8e\x12b\x7f\xd6\r)e6Z\xa8\x1b[\xe4\x8a\x002\x14Axf\x18\x17\xe2\xae+\x06\xa35,\x8d2\xb7\x90\xb1\xad\xa7\u06ed\x9a59\xa7\u027e\x14\xbc\x83?\xc6n\xe0\xfe\xb6(\x82W`LIfF\x9a\\V\b\xd7\b\x13R\xb6D\u0597\u1aa4\x98C\xb4}\xa4,\xe9\xb3\xf7\x15\x1aRM\xb0\xc0\xe5\xc2\xff\xba\x18\xd4Z&\xdb\b\xb8\x17\x1cs|\xe0\x9b\u0113Q\xdd\t>u/\x1fx\xden\x1f&\xd2\x13>Y7\xae\x1e\xd9Y\xbe\xef\x0fZ\x15\xc2\xd5\u01a8\xda\u0579\x8d\x02\x91\x04\xd6\xe4\x17\x85\xf3\xb6Oj\xd6'a(\xc1\xf4\x95\xf2G\xdf\x000zAzt\x1f\x7f\x8e\x98\x86\x10\u03b2\xef\n8\xda\x06B\xeb\x17=\xfc48\x88\t\xff\"^P \xa3\x12\xa3-\x82os\x05\xec\bQG\u05af\xc1\u05e1}!1\xf3\xb8\u06f2\b\x90\xaa\xfb\x9a\xb8v+\xa8\xaazYL\xee6\x06\x8c\x12\xe2\xe4\xfeD\xf4\xc9T\xe0\u0678,\x19#\xbcz\x90\xd2FD\axE\u0259C\xd1F\xf4j\t\x10;\x9d\x17p\x82\x96W\xa0\xfdN9\xc6\u015e4\x1b\xf7ua\x8d R\xf1\a\x81\xd9\xc7\xd5\u008c\xe2\t\xb4\xf1(\x87}\x17\x02\xab\xcdf\x18a\x15c\x89;w\x88I\x90\xb6\xb00\x02Y(n\x17\x9b\x12\x8b6\x9f\x95fxK+GK.\x03\xec\x95\x1bbe\xfd\x1c\u0471\x7f\xdd<\x14o$\xe8\xdf`\xbb\xe54\u04f5M$N\x98\u01c75\xf5\x8a5/\x1c\xff\b\xd2ee\xe3p'\x90\x941\xc3@L\xe4X\x15\x86\x97SN6\x85k\x8a4Z\x02\xf8\xc0\x8cN\"\xc5\x1a\x99\x8d\x92b\x87\\i\x01\xf5\x056DPD+l\xaa\r\xa9\x7f\xe5\n\xe7\x86+`n\xe3\xe7\u0629\u050e\x0e\x9e\xd3i\xb6\xaf\u05361\x19\xd5\xd7Y\xd5\xd5\xf0\x03\xdbiz\x92\xb7\xdc<\x14Q\xafo8\xf3\x1e4\xf3BU\xd3m1l\x8a\xc10n\u0734\xea\x8f\xd7\xe6\xed\x1a\xb7f>\x1b1T\xa2e\xb3\xde\u01e7\x009\xa1~\xe3x>0\x9b\x8d3n\u02a6\xb9d\xd7a\xc85B\xebC\xf8\u0779\x10{\xfd\x00\xdc\x0e\xa7\xdd\xde\x12(d\n\x83\t\xaf'\x12\xe2\x9e\xc1\x93-_\x03AG?\x86<\xf7Q\xc3H\xb6YL\x83{\xb0\u03a5\xcd\x0e\x10\x9c\x82\x069\x86\xf8S\x95\x00\x80\x05\n0\xb98\xb7\xf8-\x15\xa4\xed\x94W^\x99\xd0\x10\x81\xb9\xc9\xdd\xc1wZKP\xbb\u0753~#\xab!\xc8\xcaN\x88\x11\xfe\xb8nw\xfe.z\u05ae\xf1\xb5\xc7\x14:5\x00\x9b\x1b\xdc\xe4|\xe1[\x9f\x1f\xe6\xec\xa0ln\xf6\x87\x85a\fZ\x13\xd9\xf7);c\x17\x99\u067c\x19b\xfb\x91\x1b\x88!\xaf)}\xa1\xd2\x06\\n\x19\xfc.$\x13N)\x13\xe2k,\xe3\xe9\x90A\xe9\xb5b\n\xf8\x13\xdb\x05\x06OT\xd9\u0150\xbb\xbb\xb5\xbe\x94>\xaee\xa9w&_+gyv\u0568\x89\x9e7C\xe9\x145\x80a\x02\xe9.\x96\rH\xd5\"\x9c\xc9\xc6!\xbe\x06u\x8c\u015f.3\u02b72\xffs\xba\x99[\xbbJea\v\xad\xff\x9d\xca~\x10\x90p\tv~\x89u\xb4\x9d:\\2tf2\x8c\xb8dL\\\x01\xa8\xa2\xb9N\x1f\x15\x88iT\xb00\x04\x92\u0426\x9cHc\xb6\x11\xca\x03\x02\xa37\x06b\x9a\xbb\x99\xeap\xaa|%\x12\xabN\xe7T\xe6+\x05\xe7_\xb5\x96\x1a1\xf9R*Z\xa8qai\x90j\x8dH\xe6\xd5:Kg\xb8\x00\x8b\xc2H\x12W\x16\xb2\x92\x90'9\xa9\xdfV\xa0\x001\x00\xa1\x10\xcc\x12T\xe7A\x1e\x0e.\xcb\x1d\xf4}\x98\xcd6\xec(\xbcf\x90\xe9\x91i\u057a80\xc4\x18\x00\xd7+\xebK\x95\xd79Rug\xff\xb8TRh\xa8L\r\n\x9c\xcd\x01\xact\x01*\a\x1f\x05\xc7\xddC\xef\x8bh;[b\x17\x18\xf2\xfb\xef\xee\f<a\xa9#xE\xbd\xf1\xd09Q\xfb5\a\xe1\xf5\u070a\xddT\xbfV\xefi\xe3Z\x1et-\x86\x11\u0175\xef;}6\\s)\xb1\x1cJ\xdf\xdf\x1fF.5\x9f'=^\xfa\xbca\u06585\n\x89/\\}\xc8\xc6+x\xf7G\xed\x04\xc1\u067dC\xccE\x15Grm{\t\x9e\xb6\x8cO$\x90\x84\x90\x9f\xd7\f\xf2\x8a6\x1a\xc8,@\xe3\x8b*bDG\x11\xe5\x10\xacy\xe7.+;\x8b>\xe5f\x03\xe0+\xa5\x8a\x8a.k\xf8\u04c7\u0513v\ajr\xe6l\x0f\xfd\x86d\x10\xae=\xa5\x14\xe3W\x98\t7-s\xca\xce\xe4\x01\xba;\xd6V7\xb2\xb5i\xdd\xea\x11\x97b\xde\n\x8dY\xf6\xeab|jlZsA\xba\xa0+\x1b\xc7\x06|\x9025\xec\xa29\xb6\xb8\xd8\x0e\u04a6N\xa3\x17]\xad\x0ef\xad\xa0\x9c\xe5@\x82\x17\xfa\xeb\xaf:\u053c\xfe\x82\xc2G<LjM\xb3\x02\xa0\xe0\x87m\xc0\x8bKf\x96\xed\x19R\xbe\x96\xbe\xfb2\xda7X\x85\u0126\x9b\xd2\xce!X\xf3\u0606\xcb\a\x12\xb7C\x9b\xb6\xc1\x1b6\rXO\xc8}a$\u07ac\\?D\xf2\xf3\xf3\x86\x87Ic\xe3b\xff\x8f\x80Q\x86+\xaa\xc1\xfb\x9a\x16\x95\x81\u0377/\xe9\v)\xa0f\xf7)\xd7\xe7\x1f\x16-X\x9a\xc8\xce\u9c15\xcf_\xa4\x1b\x1d\xa5\xe6\xf6\x81\u053d\xdff\xb6\xe6\xc68w\x11Z\x1d\xa7\xc9k\xd9:I+.\xfe\x96\u04ec\x0fd\xe0\xc1\x87c\x8d\xa0|\x81\xd2\x19Xp\xcaE6\xcb!\x02\x84\xea\xa1R\x000\xe9\xeb\xddv\xf2\u01b6\xb14\u03bbn\xa6\u07feY\n\xa4\x12G\xd9\xe1$\xd6[\xf5}\xb0->\x8d\xf8\x19\f\"\"\xe2\xd7c3z\xc2\x17\xb9!]\xf3\xbf\xf1\r)\"\xb8?\x8f>\r\xd4(\xef\xb3\xe6K\xd2\u016fE\xefI\u075e\xbe*\xb1\xe4\xcf\x7f\xf3\x9b\xf2\xa1\x87\ba/\xcb@\xd4l\xbc/\x19G\xbb+c\xbf\x7f\x98\xc4Zn\xb9.\x1d\xd7S\xbb\xd4\xf5\xc6\xc4\rl\xbf0\xe1\x15\xff\x94\xea`\xc78\xbb\u060e\x85\xf1\xc5n\u01ba\xb8\u0476\x84\xf6z\xe4m\xc9\xf5\xe9\x8f\xdc\x1aj\xdc\xd1\v\xa3\xc6@\xbb^\x1b\xaa\xe1k\xdf\x1c\x1d\xae\xc4/4\xb9\x90\x1b\xff\xe6\x13\xb4\x1d\xfe\xff\xe9B\xac\x9f\xb4\xa6\xe1t\xbf\rm\x9b\xdb/C$\x1a\xed\xaa\x01\xf1\x1b\u0445\x1c_\xa9\u06af\xc5\x13\xc5\xe7\xd3\n\xb0j\xd82\xe5\x19\x00\x06\xd8j\xa8\xf1\x0f\xa8.G:/\r'\xbfb\xcb#\u0659\xdce\x87\xaf\xa0\xb1\x1dh@\xeeSw\x81\x80\x17\xa9\x1f\xdc\xca7\xa8\x9c\x92\xfb\u056c\xe5\xc0\x9b(\xceL\xdd_e6\xbd2\x17N\xa5\x13\x05\x10x\x06\xfc\xa9~%J\x0e__\x15\x15\x0e\x85\"\u07a5.\xb0\x98\xcd\u0328\x8e\xa9\x00\xb4X\xf0 F\x85\x1a\x86l\xf6l\x9aUUZ^\xfdw\xbdB\xb5\xc1\xa6V&\xa8\u0340\xd3V$\xe6O\x80\r\x84\x94O\xa9\xe0f\xdaC\xdap\vV\xca\xf3$\fx[\x136[\xa2\x83\x16\xa2\x93\xf1\x1aD\xe4\x06,$\x00(YR\xa1\xf94\xcd\xe7\xe6xx\x15G\u873d\x86\x860o\xc3k\u07f5#\xa7\x94Y\x91z\v\x0fv\xed=\xbe\xfc\xd4{\x03\x85m\f$\xdd{\x94S\x02\x85\x1d;7\x83\xf3\xee\xf1\x8d\u0285\x92Tw\x04=\x7f\x1a\xbb\xb1m\u04cf\xa5\xc9\xcc;\xe9\xd6\xde\x12\xeb\a\xe1\xb6\r\xb5p\u0396\xeaRL\xe8\xde(\xf4_\xf5\x04\x88\xc46\xa5R\xcc=\x9e&\xcfC.\n2\u0479!\xb7s\x86b\xa1\uc54a\x11\xaa\xcf\nN\xef\xa7|\xa9y\xb1\x1e\x87eS\x8e]\xf1\x93\x06&~\x10~\xf2X\xea\xa2D\x19\xb4o.\x85\x05O\xeaB\x93.s\x84\xaeR\x1ao\xf61]P\xb99\r\x93\xc7G57\x1b\x94\n\xecP\xb7L\x151\xf2\xe2\x06>2\xc7P\xe2\x0f\x9e\xa7\xeb\xf3\xb1\xe9\xaa\x1f\xb32v\xb8\xac\xb78\xf7H\xc0\x83\xed\xe8#\x9d\xa8\x9e\xf7\x0e\u051f\xf7\u00e1\xa9\x87\xb7o\xeb4\x9aR\x99\x9d\x95\xc9\xfa\xb6{?(\xf7\x05\x84\xafT\x1a{\xce0&\xa4w\x01\xb0x\xeb\xba\xc8|\xe9B\tH\x9e1T\x03\x8cZ\x8a\x94\u06a4\x9eK\xaf*E\xb6\x9e\x9e\xb3\xed\xf7}\xbf\xd4\x16k{\xb4\xf9\x13\x1d\f$\xa5Q\xe6\xc5Y\xff\xd6\x110h\bT\xc1\u01a8\xfe\x1e\xb4\xb2\x9f\xdc2\xb3\xac\xb5\x99$\x13sI~\xb0\x91?7:\be<\x84a\xa2\xfc\xf48\n\xc3.7\x99'f\u0662in\xdd\x0f\x93\xb0\xb2\x89C\v\x93\x1c2v\x8bPR\n\xe2~\r\xe9\x82J!oNV\xb0\xa5&Z\xeb\x80\xeag\xf6\xab\xaf\xea\a\xb9\u02d0\xebj\xbb\xd4;\xf4\xdd=\x04;\xcd\xd8 tY\xe3\x1d\xe2\u06ba\u0328\x8a)U\x16'\xa5\u01bf!\x96~\xf9\x91c_\xac\xb5\xabQ\x9f\u01f5\x96\x86y\x93^\x98\u01c1~\xd9mY\xc0\x80\xf1w[\x94\xc7N\x99\x89-\xc9\u3695\xac\x13\xf1zeW\x8e\x9d\xd1:\xa9=|\x1cH\xfa\x148\x96\xa9k\xd1\xdaS\xef\u010a\x80\xb2\xcc\xe7\u015aa\xd4\x117v\x95\xb1K\xd3\xe3(X{\x16\x00S\xfe\xff\xc4Y\x88\u0424\\(\xe5\x9a\"\x8e\x93\x91r\u04c9\xe0(&D T\xf4\xb4\x87\x8c\x05\x82\xd8\xc8A\xfd*C\xd6b\xcb\a\xa9\xaa\x88\xb6N\xa6\xca\xc0\x85\xde\xc67\xae\xb3\xc0\xf1\xe5\xfd\x9c\xc5UK\x1b!\xd6ZW\xd7\u153b\ue4de\xa4\xa7\xafZ\xc9\f\xaa|P\xeeu\xab\xda\x19KS\xbd\xfc\xb1\xa9\xf0\xa5\x9dw\xa3I)\xce3\u051d\xee\xbb=\x11\xd0\t\xe8g\x02\xe6\x0f\x86\ue724g\x14\x06\xcd\xec\n\xcb-XEN\xd2/T\xea\xa4D\x14\x10\"\xaeMl\xf1\xc2\x17\xc5\xce\x1b\xad\a\f\xedp\x922\xa8l\x98\x15SQi\x00\xac\x00\x04\x00\xb9\x8c<\xe1\x10y\r\xbb$\xf4\xdc\xcdZ\x85a3x\xb6\x85H\xee\x00d\xa0\x82\a\xdabm<\xa4\xe1\x06P'\xff\xa5 %D'\x8f4\xb5V\xb7Ixo\x0e\xea\u0655!2r\xd3\xd0j\ufd4c\xae\xa5\xcd\xfa\x00\u00d7\xeb\x16\x93\x97\xc0y\xbc\xccy\x0e\xecAp\x06C\fb\x90\xb0q)\xa1Q\x04\xea>c0\x95\x84\xa2\xb2\xa8/\xa1]\xef\xb7\xee4\xf6%<+\xc0Xpk\xd5\x18\x97\xf0\x96_\xb3\x12\xc1;\x02Y \xddM\xcd\xf5\t\xb24\x1d(n1\x8a\u03f0\x92q\xceq\xb2\xb5l\x8b5U\x12\xa3O\xe4\xb4\xd1\x12\x99\xcdv\x96\x12H\xe8\xa7/\xfec\x83\xf6\x86%\x12\xbe\xfdDcI\x10\xe6\x9frM\xd8\x05c\xc9\xd3,\u04199\x04\x16\x91D9MfR\xd4V\xe5~\xc0h\xb6'!\xeb\xeb!X\xea\xc0>aK\x0e[r\x8e\x87\x93\x18\xd1\xcc\xd5\xf0^\xb6\x04\x9e\b\xc9k5/\xfa\xe2[\xbb\x915k\xb0\xfe\xb6\tz\u00bb\xa4\xfc\x03\x19#\x9f\x81;[\x1e!\n\xff\xbf\x11\x14a\xae\xc3\\\x02\u0286\x86\xab\xbe\u0233\xcbU\xb7Ld\xf8\xfe\xc1|\x1e\xcf7@\xb7\x1fj\xe0\x01\xb3\xabi\xc6^U\xbc\xbd\xc0X\xd3\x1a \xdd\xdd\x1a\xdc\u0602w[\u02d8\xe3\xf2\xc8\xde\xe0`\xeb\x9d.-\f\x93\x10\xd0\u0719\xb4\x9bC\x9f\x02z\t\x87\xd3\x04\x80a+bq \x92\x17\x12\xd6l\x17HF\xc9\xdd\x03\xff\u02c3\xc8\r\x10]7o\xcft\xb7\xb1\xedk\xf0kt\u07fd\xa6\x06\xbc\xcd\xe3Q\xc4\xf7\xce\x1bbt\x1b\xb5\x8b\x8c\u07ee\xefH\xd0G\x97\x05j\xaf\x0f\xecrN\xc3z\xc0\xba\xb4\xaa\xa4\x99*\xf2\xda\v^1\xabb\x86/#\x1f\xcaH#u\xd6U\x10^-\x8c1\x9e\xf9\xbfH?\xe6\x8b\xcdBB\xd2m\x06\x93\x97P\xdf\x01T\xca\xfc\xfe<\xfd\xe8q\xee\xccK\xfd\xef\xc73\x19j\xe0\xe8^\xe4vK.F[\xf0\xf7H5\xd1\xde-\u6ec5!\xe0\xb8\x12\xee\xf2\xb5\u01c1/6\xac\xb8p\xda\x18\x96\xaa\xd1\a0\x17(+?\xb96\xe8\x7f\xf9s\xb6\xf7\x92\xcdk[x\xb7Me\u00c2|M\x17\xe4\xd6H\xd5xld\xe9\xec|;\x85C\xba\x044\xd3$\r\xcc6\u0552\xc0d7\xb9i\x83\x83\x96\ri\xf9\x99mLnt\x98\xd0.cG\xf0\xbd\xfb\x86nP=8\xfb\xc8\xe7\x86\x16\x89\u00bdz\u8fabE\xc87}\xe3>\u919f\xb5\x95\xd4\xfc\xaa\x1e\xff)\xd4f\xf3\xa2\xfe{\x13\\;GA~l\xbb\x1c]3c\u03e7\xd3\xfb\x86\xcf\xd7\xe8s\xef7\xa7\xcb\xf85`\xcd)B,\x14\u07a9r\xc3<\xed\x03B9t\xb6Ep{\x80\t\xaeUm \x1fg\xa9\x80\x0f1\xe3\x1b\x14\xf9\xaf\u025e\xf45\xea\x13ka\xb8]n\xa1\x13/\xc2>\x0e@\x83\xee\x18\xf4\xa86-\xf0\x9d\xd6\f\u040e\xab\x87\xa1>\xff\x18\x8bG,\xa4\xcb\xfa=\f\xd3\x0e\x9a\x83\x95\x05)\xd2s\x10E\xcf\x04\u02a1j\xd5~@\x18\x7f*\xf6\xc5\x13G\xabK\xa5Q\xb5\xa4n\x9cW\xaa\x19m=NR\xe8U\xea\xe0H}e\u03b0\xaf\xd0\xe2C\xeb\x04V\x00H3\xded\xc2T\xb1@\xcd\"]R\xd9N\xe7\u0597L!\u0516SZ\xf1t\x01\xc8]Snw\xeb*\u06aay\x119\xa8c\xa2\xb6e\x13~v\xe5\xcd\u00c6\xfcm\x1b\xabUO\x82\xad\x7f\xc3y\xdc\x03]`>\xafx\x99a\xa5\xd2yU\xe0zkc\t\xe6-\xf6\xc1D\xec%\xb1\xe1\xcf\xf8\xe9\xcd\xc1\xd8k\x8f\xab{\u052b\xd7P%#\x1f\xf17\xad\xbc\nX\u052em\xef\xe9\x92\u04cf\x10\xc0\x10\xfd\x86\x92`N\x05A\xf5\x11\xa2y\x80\xc1p\x9e\x81\x8d\x83R.\xa5)\xaa \xc1~k:e\xe2H\x18R\x10\xe8%\xa1\xb6mV\u0720*\xb1|Y\x16\x98\xa0N\x85vl\x9e?F\x81\xa6\u07a0\x03\u0608H\xf8]\x1dJ\xcc\x03?p\x95\x18c\xa8\a\x83\x00\x925\u01f2\u0390q\r\u0410e>\xe3\u06b5\xb6&\x15\xaf\xd6yf\xafM\xac\xd1\x18\x1c;i\b\x88\x00\x12\x18\xd9\x16\n\x9a\x0f\xd4\xf0\xa6\xb2\x00\x86\x97\x86\xcd\u06aaQ\x0eP\xd2\x1a\x96\x90\x98p\xd5\xc5\xc3\xee\xfa\xect\x8c\xb0ndx\x94Z\x99\xc9(67\xcdR\u07b8\u76af8\xbe \x14\x9a\xfb\xab\x05\x8bkyom\xe8I\xf2\x90\xa1\r\b\xa0\xafX\xae\xb1\xf2\x92-\xec\x14\xcfb\x93X\x1f.yh\xc9\xea\xd1\u04df\x86\x9a\xaei\b\x12\x89\x84\x9e\x9c\xc9U2\xa3M\xf1S\xf8px\x10\xb8\xb5.\x84\u0842\x18s\xbb\xddV>\xc6\xc5\xeau=\xfb\x99\xabd\x9e\x8dyP/\x89n\xb2YMF1\xc7\xe7I~\x06\xc1p`\x83\a\x8c\x88\u04d4+\xad\u042e\x00e\x01\xac\x19bH`7\x12\x861\xcb\xe6\xebT%o\xcb\b\x1e\xc1\xef2\f\u03b5\vs\xbc\x95\xf4F\xed\b\xa7]kQl\xad\x84\xb0]\xb4\x8fuL\xefX7i\x1c\xe6\xf7\x9bM\xc3S\xac\xf99E[\xb9\x91s\x15\xb9\xd4cwC\u0192\\\x9798\x8f*\x95a<\x8e\xd42QB\xe1\x1a\xc4A/X\xd7?\xedt2.1\x86\xc3V\xb9\x16\x8cX\xe2\x9f\xe0l\xc9z\x96*m\xb4sa)\u05f1\xebU\xca\x16c\xdaf\x88\x88\x82\\w\xc3\"\\\xd9.)\x16F\x85\xf2\xa8\x9c\x1b\u053c\xb2d\x90$Y\x8d'\xd5\\\aG\x8c\x80\x96Y\xf2J\x13\xc5\x17\xc4ci[\xf5\x94(\xa4(\xacI\xf4)\u0250uP\xa9:\xdd\x00\u0326, \x90\u0407\x04$\u010fO\xc9\x0f\xdcm\xdfZQ\x06\x1e5wQ\xbe\x1ce7\xc8\x12L\u0160\x99\\\xe6\xe0?\xc0\xd3g~{\xae\xbc8pk&nJ\xe3G/\x9e\xbf\x7f\xf4\xf8\xd9\u0243\xf7/\x9f\xfe\xf9\xf1\xb3}\x97\xa8\x8d\xfdp\v\xff&\xaa\x8c\x1a\xcasJg\u03f3\xf2}\xc4\xc7\xda\xdc\u03f3\xa7?>\xde\xd6M\\c\u06a1\x93\x97\x0f\xfex\xadN\xd4<\xf1x\x98\u3b51\x8c\xbc\xfe?\xa9H\xb2\xca\xc8\x1e$\x98cm\xf4\x19\xddwX\xea\x11(\x1e\xc9+\xfb\xb8\xe2\xa2zL\x1e4\xb0\xaf\x93\x11K\xc4\u05fc\xc31\x95\xfc\x1f\xfb\xf6\xc6j\xc6\x1d\xef\xedp:]\x9an\xb9\x98\xf0\xf9\xeeW\xd2\xe3\x8f\bB\u012ao\x06\xc1\xd7\xd67v\xe2F\xc89\xf7\x14\xbbfE\xc8\xca\u07373W\u0713\u079c\xe5Tip\b\xf7/@=\x94\x19C\xf4\xe0\xcdF%\xec\t&\xb4J\xfa\xf3\xfcCF\xb8g\x03\x06\x04\x87\x96\x16H\xa3\x95Q@>H\x1c0\x01\x89A\x90\x17\xe2J\xb0\xa2\x03\xf1\x1a0\x12tw\xe2\xf5_-\x10b\x9d\u06b7\xc0J\x10\xda\x01\xda\x00\xafb\xb56Lr\xec\xee\xba\u0364\xb6sk\xe1$^\x8d\f\xb3\xb43#\x90\x8e\r\xa5.\xd7P\x18\xac\x94P\xc6+\xf8\x99\xc0\xc2\xfeM~\xfb\xe8~\xfb3\xfd\xf6\u900acp\xd7\xf9\x90\xc8\xe0\xc0cf\xb0\xe3\x1e\x1f\xd3%\xc1\xf7]\xcc\xcfqz\x91\x05\xa1\u05a4M \xe6B%A?\x18$\x99S`dn\xae\xfcl\xcc\xc0\xcb'\xfc\x1e\xd9\xd0\x0f\x92\u06f7s\x1d\xe2\xb3\xe6%q\xeb\xd3\x0f?}\x9b\xbfSQ=V\xe7\xa2U~\x8b\r\x98\xa5z\x87w.OSbk\x15\x8b\t'\xca5\xc2\xf7\xc3\u07e1\x04\xf9\xbe\x8e&\x03\xf5\x1f\x80\xa9\r\xcb\u026b5)-8.!\xd7\x1e\x06>,\x8dr\x91\xcd0\x84\xe7Zkb'\xa8!\x95\xd5<#\xab\xa2\b\xe4\xddA\xfbl\xb1@\xbb\x9a\u059bt\xfeA\x97\t\x90)I\xc5\x04@Hq\xfa\xde\"+\xcf2\xf5z^\xba\x96\xd8&\x00Y,\x05~\x86\x8cXN\x8e\x99J\xe5\xb0Z\xcc*\xa1\x10\xc5\xe2\xcb)\x14\xbf)\xc7^$6\xdd.{\a\x7fo\xb2\xa2\x9eo\vXO\x8c\xc0\xc6W\x88`\x04\x7f]]\x8f \u076a=\u016b\u03620\xba=`P1\xa7!\x13\xa7\x03\xbd\u016c\xbdh\xfa\x97\xf9r\u01a8gn\xf0_\x1f\xe2\u59d6\xb3\xab\xa4ns\xa9\xb4\xb4\x1eJ\xec\xd2h\x17\xa9]7X\x93\u071b\xa4w\xfd\xd1V\t\xfe\xcbJ\xf1\xdb%\xf9(OQbK\x01\x003X\x91\xc4\x1c\x06(\xb2Z%\x04\xa9G\n%\x15\xa3\x83 LsM\u066c\x0e\xb80\xecN\xc3Hb\xe2w\xc3\u036e-D\x9e.\xeeh\x04#R\xf0-\xa8f\xb4A2sF_\xb4k\x1av\x7fU)K\xb0D\x80Bc+\xbcS\x03g\tc\x87\xc2w;\xda@\xc5`\x14\x13/\x10\xc0kdq\u00ab\x1c@\x9b\xe4\x03\x91\x95\xc8\xea\x05s\xf7\xaa\x1d\x8bQ\xb2\x15\x98\xbd\rotG\tqZ\xac\xae\xfe\xb1\x05D\b\xb7\v\x179i #\x98\xcdh]\x8c\x8c\x00\xb1\x9a\x14P\x00\u061f\x9a\x91\xc1\"Ue\xc8\xff\xcdU\x150\xf2\xcf\xc5\x03\"\u0491Y\bI@\x80\x98@C\xfa*\x83\xcc\xe5\xe6E\xb2\xce\xfd\xd8m\xb9G\xcey\xc8\x16\xe6\x10M;\xf9)_\xbf\x8b\xbc\xaa\b\xed\xc9\xd5r\xb1c\x84\xa8:\xae\xf6\x0e\x93IV\xc5\n\xf5W\xba\xe5\nLq9\xb79\xecYrK\x05]\xder1\xb9\xd2\a4\xd7q\x13Z$ix\xbc\xa3 }-l\xa5k\x01\x9f\x84\xa9\u0723\x0e\xa9\xca\xc9=_\x96\xf5\xa27\xfe\x1e\xf0Lm0 j\x98\r\xf8-k6\x92W:3\xbd\x8e6\xe4\x02\xb0\xcd\x1aA\xe5A\xa0n\x8eV\u0642\xd2\xd1>\x06\u04930\x13\xbe\xdb\x18\x92\xda\b\x9a2\xb9\xbc\x80\x9a ,'\xc8\u01a7X\x98*\x02\\\xb3\xad\xd3\xd6\xf0\xb4z`w[TnS\xf0\x15V\x1c\xe8\xdf\u0606\xb4\xa2|\xdfw\x87\xb5\xf1v\x88D\xab\x0fp{&Y\xf7\xc4\xe9\x0e\x91l\r\xd4\\C\xce\u90af\x10l\xa7\xca\x12s\xa4\x8c\xa3\xedH\xcc\x11L\xa4\x86a4Rt\xcbh\x92\xc8X\x9a3\x1a\xbd\xad\xdeN\xdc\xf8Y\x15G\x99\xd8\xde}\xa7\x90>7\x8e\x1b\x9d\u00fc;\x92{}d\xc3-\u01fd+\xa9\x87\xe3\x1b\xb6a4x\x81\xd5P8\x18\xafQ\xca'\xc7\u00a6\x1c\a\x03\xee;,q:\xba0b\u0395\xd1V\x96\"\x8b\xa7\x15\x8b\x03O\x9e\xc0;\xbc\x10\xd9,_\xa3\xfc,^\x9d\x05\xc0~L V{\x8a\xf1\xe5\xca;J=u\xcb'(\x96\x0f\x8b\xd9\u055f\xb2\xabGf\b\xb1\v\xd9\u0750\xaafk\f\xb5\xd3L\xc3|~\x8c%o\xc6 \xa3\x81\x94y\x04\xa1\xc7\xd9\x18\xf5\v{\x87\x19\xfa\xce\xca?\xe1\xeb\xe6#\xc3K\x9e\xc1\x0fGF\x1dwN\r\xd0GM\x7f\xf0\u05af\xbf&P\xacf\x9d\x9a?\x06\x10X\xed\xbe?Ln]\xdcR\xa1\xca8\xf3\x13\\\xe2\xa0p\xb3'\xdb!2\xb8]#\xd9 \xbf\xe4\x10\xb9\xf8U5\xcc\x0eK\x89\x8b\xd3(\xd5\xc4\a\x17\xc7<\x8d`\x9b*hSL\xf5\xb6\x1e[l\x17\x1d\xb6pr\xf6\xf9\xa9\xee\x8c0\xb2?\r<\xd8\xd3\xc8\x1b.\xa9\xc2a\xd8\xfb5\xb0\xe3\x00\xa9\xb4\xaa\x15B\xa7\x7f\\?]B\xb5\x18oi5\xed\x8f\r\x8d\x14+.W\x06tB\xcaT\xb1J\xcfR\xb4\x1f\xa5\x95\xf3\xdc`\xfdY\xcaG\xc4>f\xe2\u0374\x8bM\xf9\x16[7\x87>\x7f\xe9\xe6|\"#\x8d\xedWf\x98h\xb1z)\x83\xa2\xc0\xd9\b\xe6>X)\x10\xb9\xc1E\x14,\x8a\xd95\xcbo\xd9r\t\x8c\xa2\xe0\u0546^\xa7\xeb\xe6\xe2\u0420\x96\x9d\x9aS\xf1o`4\x807\x93?$\xe2\xc8O\xf6\x93\x1e\x15\t\xea\u0566\xe0yx\x17\xd6\xc72&\xa5\"\x9d\xaf\xc1\x18\x00n\xac\u0146\x8d0\x9e\xfd\x05X\x1bF\xb9\x84>\xaa\xaa\xfbt\u027dc&\xc0.\x1e\xbf\x9c\xa8\x1b\x93?\xf7\x88_\xc8|\xe6\xde\u0199\xc2\xed\xf6\xe2\xf5\xab\xa3\xc7\u0253\xa7\xcf\x1e\xef\x93\x03\xfc\xce_\xab;\xf8\x8f\xf7\x82\xf2?\xfek\x05\xaf\x82\xc6A\x19\xcd\xfd\xe9 \xb9\xb7w\xf7\x1e\x9a\v\xd0=\x98o\x16\u024b\xe3\xe4\xc1\u0190ZY\x8d\x13\xc8M\xc0w\xc1\xb0n\xee\x8b\v(\xcfe\xdax]e\x16\xe9\xab\"\x1c\x90)\xe7L\x9f\xc1\x1e-\x81O_\x99c\xf2\xf0\xf8\xd1\b\xb7.\x99\xe7S#\xdep6#A\xd7CK\xa7hogZ\x7f\xf6\xf4\xe8\xf1\x8f\u01cfAU\xcc\xc67n\xf4`\xb5\xa1\xb4\xd8t\r@\rPd\xa0\\\u03f2U\xbf\a\xff\xc4\xe2\xe7\x95a\a\xf8\xd7Kk\xf8\x7f\x9e.\u04f3\xac\x94\af\xdc8@\xf9\xfbr\xda\xd3b\x1c\xfev\n\x0fi\x13\r\xb7E\xf5\xd7\xfd\xf2b\x05;T\xb9\x1f\"]\xe9\x06-1@y\x91\xa1\xfa[\xf8\xad\xfb\r\xabn\u053f\x85\x13\xfb`m\xe6=\xd9\x18\xed\u053d\xff\xd3\t\x16\xad\x12s\x85\x19\u053a\xdc`\xb1\x1a\xc9c:\xb1\x85\x12\xe7ieu\xf7\a\xeew\xa3\xf1B\x01\xc5\xc2\xf0\x85sFV\v\xc77L\xf4\fP_\x96\xee\xef\xee\xeda)Eh\x9c\x1c,Ts\x97\x1d\x03\xc5bE&k\xe9M\xc8;\x85\x12^\xca6U\x12\bt\xaa\x8a7\xe0U7\x9a\x9bS5w\xa3%\x96Wi\x9aa\xdco*\xebB\xbe\x1f\xb2\x9e.s\xd2\xe6\xc5GQ\x15\xe5\x90U~>\xfdevfq\x9e\xc91$\x03\xc5\xf0\x10\xbb\xe0\xe3\x04\\\u02c0\b?d|\x9c|\x91\x96W\n{\x1c\rxF\xf8[\xf7\abR\u011a{U\xf2\xd3\t\xb4\x95U\xd3t\x05\xd2\xee\x7fl\xc8\x15\x85F\x87\xe5E\xf1\x81\xe3\xb2\xd2\x15\xdc\x03%\"=\x85\xb3\xf5\xa2\x18q\xa9\xcd\x15Q\x81\xcd\xe9\"\u01fab\xa7sl\x15O\xd8Qa\x06\xf6<\x9dN\u04f2,\x96\x10$\xf0\x04\xeaVN6P\xa9\u00a7\x82\x93\x17\x8f^\xf4!\xccv\x96\x0e\xf6\x13\xf4\xedR\xb0A\x80-\"\xf6\x1aL\x93/UU\xa1\x8a\xa7j\xb6\x8e\x96\xbfZ\xcd\xd3+x\xf92\x9f\"\x84\xd2%\x90\x82\xf9\xafa\u0366\x97\x12\xcbR@U\\\u06c2\x98q\xe8\xb2\xe3\x1e\x90\x98\xff\u05df\x92>\xac\x12'\xd3]\xf1\x0e\xa9\x92F\u067a\x1a\xb4\xd5\x1d4+\n|\xe3\xe9,\xa1\x13\v\xd4nOj\xc2O\x93e\x8a\xee<\x82\x02\x94\u0283L\u0173\xa1D\xfb\xe0\xf0z\xfc\x87W#\xc8\xeeVP?\xd0\xf6\xae\xe5 \xf9\xcd\xc3N\x06+\xf1e!\x17\f\xe4\u0303\a\xca\xd9-\x99\xdc\xe8\xf8\xbd\xf7\xab\x7f\xe1o\xca\u05037\xd7\xd2PQ\xfb\xdb\u03a5~\x8b\xbdw\xb7\\\xb9x\xef\x9eu\x89yz\x10\xba\x85y\x01b\x80Y<vE\xe8\xcb\x12\\\xfeIB\x1f=D\x12\xac\xc4~\t\xd1-T\xac\a\x89H|\xa53#T\xacm(\xd8\n.\x19\xae\x8d\t\x80O\x14\x1cI\xf5\xf6\u023a\xcb \u01d7\x05\x9a\x16\xc1\xd4~f:\x1bSs\x0fLW\xf4\x82\xd9!\xb35\x1722\x10q\xa1\x11\xca\u0467\xfb\xde\xd0-\xe1'\xe5\x98\u044c\x05Y\xf0h\xe2\x87\xd4`t\x8d\x8e\xa35\xd9\xf6HVT\xc1\v\x12o\\\xa2o\x90R77\x15\x1f2><\xb5\xd2 c\xff\xee\a~\\\xdbT\xfe\x1d\x95\xb6\xb0\xee\x04~0\xae6\x13\xf3g>\xc9\xfa\xae\xb6\x13\xdb\x1b\xd9\xf6>\x9e\xe4\x1c\x9c=\xd8\u0684\r\x94\xf4\xa2\xd2vjB$wn\x81$\u06ad\rX\v\xb6\xb2\x95\xea\xaf\xf4r\xcf\xf2\v\xbe&\xa4\xa4\a\x89\xd4\"\xfb\xe8\xaam\xe1iT\xa9\xf3\xb562\x15\x1c\n$I,\xc1\xe5\u07de\u034b\t\\ \u0410m\x04o8\x05i\xeanD\xd0\x04\xec\xa5H\xf8\xfeF\t\xa4\xd8\x05\x80]\x80\n\xe1r6*\nzA\x87j\xea\x1a\xbf\xca\xd6\xe4\x9d)\xb3\x11\xf8\xe0s\x88y\x99\x16%\x16\xd4u\xf3\x94\xb483Y\xf2\x12\u069f\xf4\xbc]\xa5\x05\x8ag\xe0\xb83m\xc6\xc72r^\xb5\xf8t6\x83 y\xd0\xd2\x03z\x9d\xa4\xd3\x0f\x82\x89\x16\xd2,<\xeb\xfbc\xb3;xL\xb1\x1d\xe9$\x01u\u011d\x02\xf3\v\xeaP\xd0\xde\xdbw\x1eN\x1aD\x92|\x00\x06d\xc4q\xbc*\x98[\xbbVhJXs=+!\x15\xe0\xc0F\x12\x9f<<\xe2\x1aJ\x80 W\xa1K\xc3~\xa7n\x01\u022d\xef\xad\x11<\xae()\x97@<i\xc8;0&9s\x95\xb1\xf8\xc3\x13\x1e6\x90n\xb9\xc9\xf4\x82\x1b\x19\xae\n\xb8g\x00J\x88l \x01\x11\xdb\xe6\u04a3;\x03D\v\x1c2\xca66\x8c\x15\x15\xc9\xe5Ly\x8a\x8d\x1cf\u0121\x99[\xc5\vVAN\x8a\x95.\x9e\xee=#\xabz\xech<z\xfa\x93\xb5\u0148\x9c),\x8b\xc62V\xe9\xf9\xe6OI.\x0f\x1b\xb2\xa9\xea4\x81\xea\x1cd$Y\x83\xf0\x9c\xd2K\xc7\xf0\xce{[NO._\xfdt\xfc\xf0\u064b\xa3?E\xfb\x01\x05A:\x88\x8e\xf4\b\xde\b\x87zD\xc3\x03\x8b\x9e\xa1\xaf\xe5\x1d8\n\b\x9e\b'ma\xa8\x03\x14\x9c\xcb\x12j\x15/A\x04\x03!\x03\x14\xc4)\xde\x1fW K\xcd\vs\x9b\u0302\xce\x1eB\x83G\xd0\x10R\xb3\x91\xa5\x87P\xa7\xd7R\xb5Q+F\x13\u0506\f\xa7s_\xbc\x17\x9f\x97\x14i#L\x1e\x89>\x9e\x15l_\x00\x90\xe6T.V^b\x1e=(n\xf9\x94]\xcbT\x8f\xf1\xea\x85\u07c7\xe3\xb1\xea\xd78\xab\xad2\x9e2\xd5q\xc1\x82+\xb1\x91\x01\xe8%\xb90Id\x80#\x04\xf5\x8c\xc1\x91\xc6!\\\xe6c\x88O\x06+\n\x90\xf0\x87\xec\xca\btFH\xd6P\"\xf92\x87\xcav\xe6\u0321\xc0\u02c0\x95\"\xd6-H\x03\xb3\x13\x03&s\x861\\\xc1\xde\xf2s0\x1d\xb6=\xa7S\xf4b\xf9\x02G\xd5\xf8\xf8O2\u04867Pg\x7f`D\xf2Kx\xb3v\x18\fO \x9f\xa5\x04\xc9Zw3Y\x18\u0224Tf <\xb0\xc0`8Tq)+i-\xb2\x8a\xefd\xe9\xfa9|\xfc\n\xbf\"\xbc\x14#{9\xe6#W\xd0$3\u032e\x82%p\xabf~z\xb0\x99\xe5\xc5\xf6J\xbe)\xbc\xd6s\xf7\xb5\xfb\x14L\x1dVk5W~\x99\xc11\x00\xed\x15J/\xf7,\t\x81Ma\xed\r\x06\xd8\xe1)\b\x82X0\xcd\xddF\u023a\u03f2%\xe0\x04\x9a\xdd\xef\x83\xec&\u0222F\x15b\x19\xed\xbc\xb8\\\x0e\xbc\xa9\xfc\xa8\xda{\x96Wk\xff\xf6x\xc3\xf7\xc5eF\xbd\xac`,\x158^\xb4`\xe6\x8dI\xads\xf5\xc1\xb0k\xdd\xc1\u00cc\x13\x91\xf4b\x1f\xf9<\x9a\xeeP\xab`r(#z\x94\x1f=>:>r\xb7(<`\x83\x83\xaal\x1306\xb4\xbcM\xf2ue\xf9q\x8d}\x16\xae\rw\x0fs\xc3J#\xe0jQ\u8ab7\x85\n\xb1,3\u070b\xe3ZM*oHo`\xfc\x13\f[2\u00daa<\xcbP\u03b3aIF\xf9\xdd\x00\xb4*\x86Q\xe2da\xc8x{\x92\r\x9f\xa5&#\xbc\xcc\xf0S45\xb0\xf5\xd3\x1cuj\x14\xf5Y\xc0\xd2e\x1b\x11x\xd2\u031b\xf9\x02W\x1f\nU.\xb2!\xb5\x04}\xf0[\xf8\xb3\x91\x92fg$!-rs7\x12d<\\\xae\x8f\x97f/\x18\xcc\x1e\xfb\a\x1e\x86\xbad\xc5m\xc1\r\x00S\xd3@\xb9F\xab\x87\xca\xdbX\xe8\x1b\x8c\x87T\xe3\x9ej\xab\x98\x06\xaf$\v\x0e\x12\xad\x84<\xad\xa9@\xdd\a\xd8\xf0+Y2E<\u00a4`\xf0\x0fq\xec\ufc58\xbbK^2\x1f\x99O\x1cwz\xfb.\xfe\ft\x92\xaa\xed\x05*\xbd\xf7\u07ab\xfc\x88\xfd\xbe\"\xec\x9a\x1ac\x83\xc86\xdc\v \x9a\x90\xa3awr\xd5f\xbc\xb8v\xea/\xa9\xe3c0\x01\x12*re\x03%\x87\xa8\x91\x19\x99\x96\x1a\"\x9eG4X0\x17\xa6\x95\xcafJ\xba\xf5\xa6\xf2\xa8\xa0\x12\xe4{\x1ea\xd2&\xa1]&\xa0K\xd9p\xac\xf7\x85\bU\xd0\u064a\xd1H+4\\\xb2\x10.\x86/#\xc2\xd2\xd6c\xd9\xd47\xd9$y\xa3i\x80\xfb2m\x7f\xc8Vk\x96\r\xd1x\x8f\x9d2\xa3\xe2\x9c\x06\x0eT\x9e\x82L\a\xd7\xd5\xd0j\n<D\x8a\u01428\xe2r\xa6\xae6\xea\xe4%\u0367N4@\x9c4\xa8\u021d$\x8f\xc0o8/\xce\xfcm\u07ecO\xef~\xfb\b\x17\xa5\x8c^U\x84DR;\x8e\xbc\xbb\x15\x8f{\xa8sGq\xc9m\xd97j\x8b\xd6\x1b\x19\xe3f5C\xb5\xff2\u035dP\xa9\xe0\u01d0\x12\xed\xcc\xf3%\xf5\x1a?($\xbfZ\xaf\x9ec\xc3_cQ\u016f\x93\x97\xe0?\x9a\x0eQ \x19a\xec6\xe2 Zz\r\x98\x89\xbd\x81\x88\x11\xf1\xe4\xa8)\xfc\xa2\x10+6\xba#\xc9rqy^\u0305\xdf\f\xbdYT\x899M\xd0\x01\x115\\9\xd4\x16\xden\xb3\xb2X\xad\xe0.\xc0%f\x02\x00s\x1fS8[+O\xfd\xb2\xe0\x12\aE\xee\xea\xaf\xd1\xf0A\xcc\xd1\xdaS\xb9)9\x8b\xb0\xd0 IP`;1M\x8af*\xa8<x\u0263\xb2\x17\xaf\xe0\x94G\x1a\x9d\x9eo\x96\x1f\xc0\x7fO!\x97p2\xacl\u01bc\x11\x1b\xbb\u3095\x80t\x8e\xd7\xe9\x1aT\xa2_h]\xf6\x93=\xd0c\xab\xab'\xeeO^\x0e\xf5\v\xcc\x19\xff\xd5\x10z\x81\x97\xcc#s\xea\xce\xf1\xf5E\xfa\xf1\x7f\xfb\xbf\\j\xc27\xbf|\xf2\xb5\xb1\xd0V\xab\x18v\xa9\x14(\xef\x1e\xfd\xe9\xa4n\x7f\xf8\xc0~\x03\x91\xd6\xed\xb7\xf6\x81nA\xbc\f~;\x7fDQg\x9e<}\xc1!\xa2\xe9\xd4\xf3\x970|\x05Z\x1er\xd3\"\x16}\x86\xcd\u0361\xa2\xe9\x1ara\x8a\xca\x1e7f\xc5\x10va\xc5-\xcaTp\a\xab\xf0Fe\u056b\xa7/\x82\t\xb2\xc0\x8a\xd2)\x84\bN?\x8c\xcc\xd1>\xf3s\xbc\xe2\x92H\xb6\x04;\x01\x8a\xa6\x8f\xcc'\x9cr\xae\x14cR\x91\x8a\x95QI\x18P+`_\xd8\xeb+\x10O\x8e\xa0g4\x1eE\xdf\xc1'\x0f7F\x91]\x06lLd>\x86\xceF\xb0DI\xbfC\xe3\bEsN2C\xfe\xb9R\x13a\xd0\xf4\xde\x1b|M\"*-\x93\xa1\xc1\x83\xb0d\xe3K\x1e\x80\x8dA\fW\xde$\r\x03\x02=\x06.\xcb\xf7\xfd\xef\fm\xde\xfb\x17\x1d\xb5'\x01\xa2b=\xf0\xaa\"\x9a[\x94\xac\u027e\xb5\x19b\x06\xac\x9d:vF\xb4S\xddf\xef\xf0\x1e\xbd\x82\xb2\x04\xa6\x97\xe4\x93o\x8a\xd3\xf8\x80\x8cm\xe7)\xedU\xcc \xaeur8\xe4f,\xa8\x99\xef'=\xfc/\x8e\xee\xe1\xe3\a\xcf\xe1\a\xf3\x1f\xfc\xfb\xf5\x8f\x8f\x1e\xbf\xc2\u0735\xa4g\xff\u074b\x05\u518a\x92r\x98\x93\xa8\x8eLT\xca<(s\x9b\xad\xbd\x00\xac\xcf\xec\xa7\x0e\x91v\uf252\x99\xdap;U\x86\x96X!\x8d\x80\x8ct\x89\x8aD\xb9\xc1\xe9m\xb5\u06b4\xd1U\xf2\xb2\xac\xf4>\x04`\x1a:N\xf7\x91\xb2lQ\xbc\xf8i\xf2\x9d\xcb\x19\xf8\x88=\xb4wf>}\xc3%\xa5\xbf\xab\x03\xd8E\x1c%u\x18D\xd0\xe6\xfc\xd5]\xa9d+\x1fIQ{[\xa4@jZU\xc5\x14=^`\x18Fv\xbb\xd6\x1dK\x02\x89\x03\xbf5\x8c\xa9y`\xa1\v\xc8\x1d\t\x04\xa1O]\x00p\xa4\x8d$yR\x94\x97\xc0\x95+\xa8\xe6*~ \xed\xeab\xb0EBR\x9b9%`I\x92\x89\x1b\x80\xec\x1ay\xa1`\xebA\xaasN(\xfb\v\x82\xb0\x83\x0f\xd0\x11*\x8fG\xfa_\x97\xe9R\x90\xc1*\xebO\u0772\xb5\x8e5h\x12\xb2\xcb1\xf4\x86\xd5\u4772\x7f\x18&\x85h\xc4\xfd;?\u07f9c\u010f^O%|;\u07d7-[\xa1\xd1!O+\x8d\xa6H?\x18\x95\x19=*h\x9d\xf6J\x93\x9e\x06\xdai\u036d\xde\x0f\x86\xa90\x1c\xa8\xe9t6{1\xc1\xa8\x84\xb2\xea\x03\xbb\x1fr\xe0P/\x9d\xafGg\xe5\b\x14\xe5\u07be[\x94\v\xbf>\xc5\x05\x82\x14\x9b\xeft2\t\x02\xf9\x9a[\xe0,]\x9b\x8b`nhrc\x06\xe3\xc7n\xc1w\xbdl9\xdaT=\xfd\xa9Y%\x88,Z\x82#\xd6\xe5\x05\x05\xa1\x88\xf65\x8c\xab\x18\x99\x91\xeawox\xdf\xe0\xe2\x9a=\x06\x1cV\uc4c8\xdd\xeb\x14\u06ba\xa8\x87\x96E{\xae\x0f\xef\x93N\xb8\xb9y\xe7/}x\xfa+\xc6\ub651\xfd\nui\xf0\x1fv\xb0\x83\xffqgl$\xf7\xb5Y\xcbA\xb4]\x89$\x17B\x15\xf9\a|\x95\x7f,\x9f\x13\x80\xe7\x85\x04X\xddp\xfb\x05\xe4Y\xad\f\xe9\x8d\xf2j\x04Qp\ue5c6=\x8c\xf6\xf1P>zZ=7\x8d\xd8?\x1bz\xe5\xbev\xe9\x81\x1anh\xaf\x82@\xdb\x11\xe4(\xb7\x10\x1e,4\u025d\xbf~7\x9a\xe4\xeb_9\x91ed\xbai^`\xfab\xcb\x12\x1fC\xffo@f\x8c\x8co3\x83\xbb|\x046\xb2\x11Z\x00\x1b\xc6\b\x87\x1d\"\x1e\x80\xb2\xf0\x8e\xe9\xdf\xf9\xcb<\x9f\x8c$\x96f\xbf\xff\xf3\xf1\xed\xc1\x1d/\xc5\u02fc\xef%\xde\xc9\xe0\x1a\r\x84U9\xedu\xa9\xa3\xc5\xff\xa7cy 2\xf6Q\xbaN_\x97s\xe8\xf7\xed\xddw\x83f\xa2\xef8\x92\xe4b\xe0gw\xd9ec\xa3\xdfH\x9b\x04q\r[Y\xcbW_%\xdaL\x18]\x9bfs\xa2\xb7.\xfa\xf9X\x99+\x0f\x81%\x9c\x99;\xc3\u858a\x89P \xeb\xb6>|\xc6edd\xf3F\xb6\x0fu\x02\u020c\x8f\xf9K^\u03ccj\xfc\xd2\r\x00\xfd\x9c\x13\xc2d\xf1\x1bc\xb0\t\xf8\x04\xe1_\b0\u0655Y4\xbf\x81DS\x00\x04\x17\"\u00a4\\\xd6\x1e\xd3\xd3\u048a,0\xaa\xc1b\x89j\x87\xa8W\x03\x92\xc9\xe0\"0\x94a\xc4\xfe%\xc6\x1a\x98\u151b\xa5'\xbc!\x1c\x8bj\xc9o\xf6\x01\xe6t\x83\x17\u0468\x89\xe8J\x93BP \xf6\b\u4fb2\v\xa7\xe6_\xa9\xd1$-\xae\xb9n\xcd^\x90(\u00e4\xc9-R\x95\xd6\u0148\xd7n\xe4v\xef\x16\xf8p\xd7d\xc3\x0f\xeb\x1c\x18\xc9d\xd9o\xa6;\f\x9f\x01\x95\xccVi@#\x1a\xaa\xee=\x0f\xd9\xd3\xfb\xbf^\x17Kwo\xd0x\x1b\xedD\xc0\xceR\x139Q\xceK3B'\xdd6\xeek\x8e\xebC\u07f1\u04ff\x18\x1c4\xb6\x99/\u030d\xbd\xb5M\x1d\xa9\xa0\xdb\x7f\n_\xb7\xb6\x8f\x11\x15\xd7m\x1e\xa3E\xdaZ\x17\xa7\xc1\xb5{x\xc9\r\xc4{\xa1+\x96\xae\xa9\xdd/X\xfb\x05\xde3m\x97\xab\x95\xa5G\x8bt5\x12\xbd\xadj\xbb\x15\x9d@\x06j\ud14d\x8d2\xc7\xf3\x05\x1a.\x06\xb1\xa2 tX^z\x8a\x84\xea\xd9\u0200\u02b9$\x11@\xcb\xe6\x83\xd2##\xc9>\xbc\xa1.\x05\x9d\xcf\xe6\x17\x12\x91E\xbaX;\xf4\x93\xe7\xe9\x8as\xf4\x9c8\xd6\xfc\xa2y\xed\x85,P}\xd7H\xb1\x1e\xa1C\xba\xc3IQ\x1e\xdc\xfe\u035b\xad\xad\x8d\u042f\xdd\u0426\\dj\x17\x1e\x94\xa5a\x18_}\xe5-\x9c\b\xa8o\xf7\u07a1\x8cJ\xe6\xc2^\xe3kw\xbd\xd7\xfckh\xed\x1b\x13|\x97\xf9EM\xa6\xae\xc9\u01fb7\xfa\xf6\xc2\xdc\xfc\xefZ\xa5u\xc0\xd2\x02\xa4I\x8a\bp1k)\u0115\x94E9\xee\u0717\xf2\xf9\xfb<6\u071d\xae\\\xf1\u02051D\xe8\x06~\x1e\xadR\xa3C\xae\xb3/t\x02k?#It<\x97\xf1\xf1\xa83\x99\"}\x15\xe5\x97;\x9c.P\x9c\xfe\xf3\x92z7\x9b\xa1\x9eT\xebb\xfa\xe1H=6\x0f\x96f\x8f\xfb\x03\x0f\x8f\xc0;\x1b\xb6\x18\x1cd\x03\x19Y\xe0\"P\x04\x01o\x05\xf4j\b\v~\xba\\\xf7A\xb2?P/@\x83y\xf5c\xfac?\x1f\xc0\xa2\x02\xa8\xc5\x1e\xfd\xe3\xfb\xe4\xde7\xdf\xf8\xcd\xf9UzzO\x97\x17\xe9<\x9f%\x94\xcc\x02\xf0W4nZ\x16\x18\xd1\xed\xa4\xc7k\xf4\xd6\xfc\xf9\xce\xeb:,\xb4\x13,\x99\x9d.\x00c\x04\xa3\xc0\xd2ug\x13\x7f\xf9\x96E\xb9@\xc3\xe6\xd1\xf11}\xe5\xf7\x06\x8d\x99\x8f\x067\xea\x02}dk\xcc\xf7\x806|6\xf1\aW\x93Ij\xec\xd7\x0fY\xc5\xe4:\x17DO\xbcX\xefq\x84/\x87\u0474\x9d\xdbPGnu52R\x1aEhl;\xc0\x81\xd1\xdb0\xeb\xa09\xb0\xb6\xb3qwDv\xea\x11|\xb3\xad\xdd\x06\xabu\xbd}4\\\x8fl8\xc9\b\xc3\xe3:u\xd1l\xf2\x8e\xf4\x02\u0584\xd5|c4mCt\xd5\xe8oYY\x8c\x00\xb2\xa1\xb3\xd4\x01-\xbc4\r<\x87\xef\xff\x8f\xf9\xfc\xff\x14\b\x96\x1d\xedi\xdai\x02^\xdbG<\xf6h{\x17#\x8a^\u0765\xc1\x9f\xc4Iqq\xb0El;\xb2o\xd7\x19xf~\x1e\xa5U\x9e\x9a\x9dYL\xf2\xb3\x8dQg\xcc\u07e3\xf5e\x017\xc4f\xd1$#R\x9e\x8b\xa1\xd733\xa0\xa3\xbf~x _G\xe6H\xfe\x99\x11\xda!F\xc0\x18\xcc\xf0\xb6\xcd\xd5\b0\xf4\xd9w\x0fs\xcc`5\xdfD\xb7\x9e\x1b\x9f\x14\xf3\xd9\xd6\xdb\u0328l\x0f\xcd{\xc7\xe9i\x06\x9e\xc2\xfa\xe1R\x8d\xc1*L\xd0&\xb5\xad\xd9v\xae@MB\xb7\x0f\xaa\x87\x94\x14\xa5\xa6\xb1\x03kho\xa86\x85N\xa2\x1c,\b\xbc\u063a\x1a\x16\xafc\x04!\x89Y\xe7\x9d;\x92\xef\xde\xc0gm\x83\x9de\u04fb\xf7:\xb7\xfb\b\u078e6wj\xe8dt\x9a.\xf2\xf9U\x97\xa9?1\xaf?\xc1\xb7kS\u01d6:)a\xd9\x1a\x9a\x89\xab\\\xd4\u02a2 P\xcd\xcf\x1e\x92\xc4\x15v\x96\u075e\xf8\xa1\x88\xf5\x01\x9e\x17\x8b\f,\x82\u0548#\xf0\xbbr \xf8\x10\xe2\x0e\xad\xaf5\xdc\nx3\xc7\xf8\x82\xaa\xbb\xe6\xc7\x1f\x10\xeb\x0fD#\xa3f\xd4$\xb1@\xae\xec\xa6\u0321@\xdd\xef=\x86\xff\x80`\xa3F\xaa\xfc8\xfb\xc9c\x84}\x84\xf0\fl\xab\xd7AM+\xafb\x16\x8c\xfa\xfc\xd2\xd9\xec!\xff\xbb\xafl\x82\xc94%\u013c\x8f\x9f3n\x10\xc9T\xfd\xc4@\xfa_\xa4\x1fGd\xe2\x1fI<B\x87\x83g\xbe\xa2d\xf4c\x89a\xa8\xef\xf8\"\x9b\xe5)\x11SZf\xa3S\xf8W\xe7\xad\u01cf\x81\xa0\x1e\x94\xd9\x13\xf8o\xb4\x83u\xcaV\x05\xb6Swo}\x9d\xa25\xe11EbD\xda\u01b0\x03rA\x90E\xad\u04cd\xdc\x107\x10o\x1d[\x1c\x91I\xae\v/x\x1e\x04\x1c\xd48\xc2*=\xbb\xde\xe9\x85\x0f[O/@\xfc\x82+f\xc4\xda\xee\x8e\x0e.\x90\xe1\x8b\xea\xa3\xcb\vq\xde.\xb0\xc4>8\x03\b\x00\xb6\xfa?O\xa7\x90\x0f\xfc\xe7;\uee23>\xfc,['\x0f\xcc\b\xee\x8e\u01ffg\xc8\xe1\u0083\xa0\xefC\f)\v\x06\x98X\x81x\x93X\xb2\xaaX\ua596F\xec\x84\x1e\x92\xea\u02ac%\x86\xd7cm<\xf4\t\x8ajX\xac\xb2%e\u0103\x92\xb8Z\xc9\xc8=\xffH\xff&\xcc\uaaef\u061dH\xaf\x9c\\\xad\xb0$g\x0f\xc0\x9eV\xbdA\xb3\xf5\x06fa\xa6\xf4#\x05;5\xac:\n\x84\xff\xb9\xcb\x0e\x02\xe3\x7f\xb7u\x879\xb5/<\xb2\x97\xff\u0705\a\xa7\xdf\x17X\xf8/\xb4\u87fd\xe60\x9d\x0ek~\xb1\x03\u07e2F\x7f\x8a\xb4Wf\xd3,\xbf\xc8FP\x82z\xd6,m\xb1\xb0p\xe7/\xfd\xcd\xfat\xf4\u076fez9\xf8\x1fw\x06\xd6\x1f\xaa\xad\x11\xbe\x99\u0277\x88\x80q\xe6V\xd8\u7b7a\u0448\xfc\xaa\u0617\xf3\x9f9CH\xd4`\xfb\x98\x9b\x8b\u0312\x8b#\x98\x93e3Y\xba\x19\U00043112\xe6v)\x00\xb3k\xa3.L\xfc\xa2\xe6\b0\xc49\xb2Q\xfb\x9d\xfc/:f\xbd.\xacR[#\f\xed\x1cQ\x1c\xec\xb6V\x830\xf7p\x8c\x14\xb89\xe2\x00\xee\x0eC|\xa3\x03\xa4\xeb#t\x19\x8a\xa3\u0255\xb9\xeb\xe7\xf9\"_w\xb9\xea]\xfa\xe23\xf8\xa4\uadf4\xfc\xe5\x1b-G\x9cl\xd7a\x05B`\x95\xa6E\xa0\xfa\x1d\xa3Ez\x85\"\xdb\b\xc0\x03.G]d\u00a6\xf4\xa6\x8b\xd6~\ns\f\x1dfI\xe7\x89\xd4!S\"\x13\x82\xf1\xff=\u064a\xd7\xe1g\xf0\x14g/\xea\xc2Y\xce\xf3\xd3\xf5\x88R\x82w4G\xe1\xa7O\xf1\xcb&\tX>\u06b6\x8e\x02\x1a\xee\u067a\xd9>\xb9\xdf\xe8\u018e\xaca\xad\xc3\xd8:\x92\xdf\x05\u00ca\xb1\x86\x85\xbb\x00\t\xcf:\xaf\x8a\u047d\xbd{\xf7z\xfb1\xff\v\xb0ll\xfa\x18\xaf\xda\xd7\xeb\xd3\xefB\xa7t\xdb\xfb\u03ca\xe9\x87l\x16\xfbBUJpc\xc1\xed\x1e\xcd\xf1\xa3]\xc6C\xf1\xc1;\f'\xfc\xa0y4\xbf\xe90\xdaW\xe5S\u034a]\x8e\xa6U\xb5\xa3C\xfb\xb5\xf9\uca2a \u01a7v\xea\xa5\xc9\x11\x98\xe1\xae\xd7.\xa2\xea\xd5\x1a6\x97\xcel\x84\x93\x19\xa1H8\x82\b\xb8\x1dm\x8c\xd0\xc6Ch\xe29\xb4\xf0\xcc4\x105\x04\xd7L\x8am\xdf5\x0f\xf0:VP\xbf\xa7Wl\xae\xdcy\x88\xc1\x87\xcdc\\\xe4\xb3\xd9\xf6\v\xacu\x90\u03f1\x89\xeb\x8c2\xfc\xf2\x13\x04\x9d}\xaa\u0162Bt\xfe\xec\x98r\x94\xebPt\xfaE\f\x98\xb9z0\x9f[#\x18\xdc/^\x94-\x0fQ\xff\u0198\x9e\xf5H{\xbf\xd2a\x15\x84,W\x92\xe2L!\xe7\x04\u057c<\x85\xdaN\x84\a\xed\x83\\|\xedU\xcai\b\xac\xfd\xd4\x1eP|\x06\x01\u0150\xe0\xddT\xdeQ-\x86\x97,\xf0\x18-\xc0\xa0\xd3\b\x06\xfa\x04@\x1a \xf7\x91\x81\xf1  7\f\xe0\x9e\x14\xe6\xaeH\x97\x9f\x18\xd0\r\xa2\xb7\xe9\xaa\x00\x84\xa0l\xbd=\xfa\xf9\xa1t\"\xf7[#\x98\x9cd\u014e'\xe1'\xf8f\x14\xf9\x8eP\x04$\xbc\xdd\xc2\b\b(\xf6U\xb1Q\b~f4\x92\xb0\xbd\u028c\x1cZ\x01\xfa\x14d\xa0\xbaJL\xb4n\u00e4L\x19\x81+Eh9\x8ez\xb7i\x04Ma\xee4\x9c\x13;\xb0\xae\x8b\xa4\"\x05\xf4\na#j\x85\x02\\\x04||\x10\x81w`<\xbe \u077e\xcb\x17\x98\xd4\x18\xbc\x1d\xaf\xf7\x19\xe0E\xd0|S\xc4\xf4'\xecM\x8f\xd6y\x81\xb6\x92v\xc3B\xd4\t\\/\xc5\x162\xa7\xac}*7\n7\x92\u01b9]\x86iQ_\x96\xf8\xad\x0f\x96F5k#\xff\xa6T\xacf\xe2w\xfbK\xcb\xff_\x90\xf0\x1f\xd6H\xb4\x91\xf8#\xe0\x11Ma\x0e\xf4\xe9A\x1c\xb3+t\x0e\xba\u052e\xaa\xaf\x81\xd6C0\x8aa|\x18\xcdp_\xbfYG\x8d\xb1\x85\u4a92\u0677\x9f[\a\xf2\xd0DE\x80\xf8;\xe3[\rO\x90\x85}#\x84\xc18\xe4\t\xa69f*\xbfQ\x8aT\x18M\xd4&8~}-\xe6\xd0B,u\x06\x11._\xf4\x04\xb9\xa5\xff/{\x82\x02Ge\xdb\t\x8a\xc0\xab\xfc\xbf\x13\x14s\xf6\xeex\x82\x1a\xa9\xe8\x1f\xee\x04\xb5\x10K\xfd\x04\x85\xab\xea\x97cA\xe0\x19\x00\t\xcd.\xad\xf7\x982\x06\xec\xba0\xd4\x15\xe6\x02@\xe0\x7f\xbe\x96\xd0{\xccC\u0134\xc3\xf2\x8cp\u04dc\xd0\x10\xcf\xde\u3d8e\x10q\x93N\x89\x0f\xb0Z\xefw\x1c;f\xa6Cr\xc7b#A\xf7\xaeDg!\x98\xa9\xd2P\u02fa\x9a\xa9\x1d\xe9\xd1y'\xd0\xfd>t}\xbb\x02\x96\xd9\xf2\"/\x8b\xe5B\x81\u0333\x1ecv\xab\xdfS\x8f{\xae\xd0*\xc5\xd4\xeaO\xc1\xaf\xc0\xbev\xc4)\u05ed\xb2\u03c5\n\x87z\xdd\xfd\xf2\xa9\t\xf7\x9b\xb3\xbei\xfb(\rPOE\x0e\xdf/nJ\xfbje!\xebY%\x0f\xe5\u017e$\xb4\x8fW\x9b\xea\xbc?p\xcf\u0500\xf6\xf5\x1f\xee\r#;}\xcc\xd7\xfbzM]iO\x85\x11\x0e\x8d\x17\xab\xbeg\xa3\xc2\a\x9b%\x92\xe7|n\xd3\xfak\xa1\x9e\x04D\xae\xd6}:7'\x10L\xfa\x99\xe9\xbb7\b\x83#\xd9\xe7\x83o\xf5c)\x19J\x7f\x8dv\xae\xd7\x17\xe8\xa7\x1fc6\x9cF\x92\x9f\xfa\x85\xfd\x18\x99\xb4\xf2\xd0o\xe9\xd7!\x99~\x88\xc9\\\xe6.\x9d\xda2\n\x91h\xdb):\xaf^j\x86\xdf\xce&,6i\x038\xa9\x9a\xd7SZ\v\x1cy\b\xc9\xc0J\\DavI\xce\\\xaa\xc9s\xeda\xeao\x95e\x84\xb4w\xe5`\xca*\x8b\u9099@_{\xed\xb6M\xde\u07f0\xfa\xe4=\xe0\x88\xda\xfe\xd6\xee\x17\u0206c\xbc\xae\xfe\xc0hX3\b5\xfed\xd7\u4d50\xe7\x0e\xab\xd22\xfa\x1a\xb5\xef:~d\x16z\x80NVb\xec\xd7\xe6\x9d:\x82i\u8c2e\xbd\x01a\u0341\xa8\xc4<U\x90\x1dls\xde6\xcbPm\xa1\xef\x043D\xae\xec\b0\xb2LY`\xc2\x1bC\xca\x0f\xaf>\x12rhV\xe5%\xde\xc0\xdc\xdb0\xb1\xf5\x88\xbb\xc8V4\x0f/u\xfb\xa3+Ha:\x81,?.\u0177\xfa\x18c\xe1.\x1cN\x03F\x84\xf2\a\xaf\xd7\xea\xa3c\x0f\x0e\xe4M\xfe\xc50o\xac\xabSf\xb9\x91F\xd7W\u008f{\xa3\x11Ng\x84\xb8,\xa6\xc1\xd1%\xc0\n\b\xb4\xab\xee\u056f\x04\x8c\xafAX\xfa\xeac\xef\v\x8f\x80\x8a\fo\x1f\x02\x17#\xb6cPl\xe3\x8fb\xeca\x16X#\x9d\xb0\xf8t\a9\xa8\xbe\xb1Q\u03a6O\xb1\u0765\x0e\xa3\xa3H\xca\u03d0\xd3$\x96q\xe7\x11\xba\x10\u0208\xbecD\xfb\xe4\x96\n\xf5\xbc\xb53\x7f\xf1#-\x1b\x98K\x84\xbcyX\xf1\xe3\xc1q\xa7\x83\x0e\t\xc7\r\xe7\xcb\x06\x8aj\xb0\xe2X\xccrmQb\xf04d+\xe2\xa2!\xf5\b4d?C\x14_7\xeb\x82\u02b5\xc3\xf5cX\x82\x00 ^uX\xc6\xe7uT\x9c`1\xb1\u049a<\xab\xcd<\x12\x1a\x17\u0288\xf2q=\xf9\xaa\t\x97\x87\xbe8h*\x11Gy\xe7-1:?\xf7\xff|\xf7\xee\xc1\xcf\xd5m\x95\x84\x8e\x0e^\xf8\xd2\b\x86\x94\x10\x8e#:*_\x1co\x1d\xcf\xdd\x03\xaa Jn\x026\xe5\xd9\xd4\\/\x1f\xac\xa9\x89{\xd4\x04\xf9Cj-\u010e\t\xde1\x18,P)\x10u\x8e\b\u0408\x83~d\x81`\xa9Dc\x19H\x83\xd3\xf86\xdcA\xbaZ\x99\x83\xe4\x10L\xc0B\x89E?\x05\xed\x19\x11\xf0\xfc\xfe:PW\x18\xc2\xd0zT-24\x1cW\x0ey\xa8\xd1[-\x90\xe2Z\xe75\x1e\xe8\x11\x00\x1bE|\x15\x05${\xebs\xa9\x12\x0e\xe8@\xd6N#\xb4\xb4\u02c1\xf4\x98E\xfc4\xbaL\x82\xb8\xba\xe6\x12*,\xe5\xabOn\x06\x01p\x1dl+^\x87\xee\x0fU4\xac{\xf2C\xa4\x85\xc8\x11';\x10\u07ce5v\xce\xd5_#\xa5[\xa9,\xe4|\xb6\u04d7=Y+\xa9\x82^\xc9&\x00\x9b\xb1#\x19g\xff\xb11\x9aM_\xdawl\xc5}`\u02e4{\xf1\r8o\x85\x1c\xc4\xf44\xdbGTL\xac\xd6\fo\\\x92\xf4aDM,\x8b\x10\xcdp\xec\xe1\x19\xa5A!F\x91\xbd\xe7\u0370\xf7\xe3\xdfl\xbb\xa5])\xc1]i\xc1M\xbc\xb3\xf9\xac\xf1\xfb\xf6\x93\x87\x89\xb5\u0463\x87O\xe0\x00t9\\6Y\xa6\x81\x13}\x8e\xb4I\xf9\xd2Ks\xfaG\xb3\r!\x85Z\x03D\xe3)\xc54\x9f\x01\u0528\xda\x1b\xffk\x85\x15\xaa\xf6zq\xb9\x89n\rAY\u00caI\u0782\xd4L\x82\xe2J\xed\"\x02\x1cc{_~Q\x18\x0f\x90r\x96\xf1u\x7fM 9\xc1aR[\xfd\xdd\xfc\xfc\xfc\xc5\xeb\xe3\xc7\xef_=~\xf9\xe2\xd5\xc9\xfbGO\x8f\x1f<|\xf6\xf8Q\xf2\a]\v\xc9\x1c\xd6~\xb4#\xa0\xb9\x81Y\xccN/\xaf\n\x84R\x1c\xf4\xa2\xc6\u0594p\xff\x8a\u04d8\xc3Q\x80\x18\x1a\xdc\xea\xaf \xb1r\xfe\t/Z\xfa7\xdbN\x01\u0116\n\x99H\xc5fiX\xb7\u0636o\xe9E\xc6\b\xd2]\xec\"\xec\xa9\x14\xd8\a0\x1a-\xb3~\a\xe32\x00)\xbb\xb3{]M\u00afV\xd5m\xc4>\u06c8\x1e\x88\xa6\xe1\x05\xd6V\xbf%2\xb9\xba?\xbb\xba8\x9a\xe7\xe0\xb7\x1f)L\xb7\x0e?m\x99[d\x17\xbc\x12\xe6\xa7)\x1a\x9bA^\xcb]\x89\x91\xc6\xf0\x0e\xb1D\x9c\xb4\xb77\u07ba\x85\x90N\xfb\x84\xfa\xee\xac\f\xfa\xba\xf5\xdfl\v\xbe\r\x1f1\xfdh\x16\xf9z\xee\x8a\xc6\u025cz\x95\vo\x8f\xef/~vb\x1b\u8ea3\x94\xf9|\x82\xdf\xe8\xed\x84\x1fhbAU\x94\xf1\x9a\xdf\xc5\xff\x06\u06c6\xe5?\b'\x11\v\xbe\x9a\v\x990\u071bX\x05\xcf\xc2\xe7\x14\xfc2L\xc6\"\u00d3\xf1\n\x9a\xdf\xe6\x03\xa0\xb7\xea|\x81Zu\x02$H\xf6\xe4v;5\xac ]\xac\xf8\r\xa8\xfd:\x04D\u0720\x96\x91\xd8EF\xc9]+eQvq\xbc\x19z\x16m\x89\x8c<\u0490_\xbfQ\"/,:\r\x0e\x87\x1a\xb3\u0096\xd7E\xf2\xbd\x8c\xc3\xd6'\xf7\x9f\x1f\x1e\xca\v_}%\x8f\xa4B\xa4'\x0070JyWE@~\xf2\xb1G\xb3T\x87\xfd\x18b\xb5\x9f\x9c\xce\u04f3-;\x86\x89\x924\xe9\x17\xae\xa7\x06\x15i\xcb\xf88\xe0\xd2\u74d5\x1a\x1b!\xb36\x1c\"*\xb5\x82U\xa9\xf0_\xbb\x05\r\t\xa4\xab\x8b+\x81\x1fjAC\xb6V\v>>P\x85\xeaA0\xa0\xa6\xb0\xb2\xf5\xa7\x98a\xab6\x85\xeb\xc5\xf5\xd4\xc6\xda\x14\xd7C\xa3\x8dY\xa1\x89\x88\x83\xba4C\xaa\xfb#\x17\xfa\xeb\xa7\x16~\xb5\xc9<L\x94y\x04H\xe3\x1d\x98\x15A\xb3j\xbf\xba|\xecl\xc1\xea\xc7$\xa6\xe6Ai+\x16\xda.\xb9\xc1\xde\u077d\xbd\x7f\xeeE\x15\xb1\xa6O\x9e\xa7\xeb\xf3\xf14\xcb\xe7\x9e\xff{\x9ba\xf7k9\xa0j\x8c\xb7#\x9f\xd2-e\xf3\x14p\xe2/?\x0e\xd8({\x10EJVm61/\xcdo\u03b3\xd9f\x9e\x1d\x1b\xd9\xd7g8\xef\x1b,\x96\xcc\xfe>{\xc3K\xe0\xf20\xef\x13\xd7h\xbe\x94\xaan[(\xe0\x87\x8cci-\tHsn\xffm\a[6\xff\\\xda\xdaa\xf7\xe5\x9bn{\xceo\x7f\xed\xe6\u0736\x7f\xd1[bh\xbf\xbd\xce\xde=\xca\x04d\xcf\xeaC\xbaJ`\x873I(\xc1\x16\u065e\x9eT\xe3\xad\x1b\xeb>\u9c31z\x19\x1a\x8e\xb7Z\x87\xe8A\xbfy\x18\xbfe\x15\xd0.\xf7\x82g\xc9;-\x03\x8b\xd0k\xa7\x10i\x8eOP\xad=\"\xc9\xf7}\xb5O\\\xec\x03\n5\x80\xc3\xde_{\x88l\x98o\xce\U000a5097\xf7@\xae\xab\xfaiVm\xb7\xef.q\x99`{#\xfe<\x00^\xc5\"6\x02\x0e>3\xbaP\x04\x18\xdck\x0f\xda\x02\xfc|\xb4\xbel \x8f-\xd9@\x95\x98\xa7\x101\xb3Ze\u02ca\x90.U\xdc\x15\x96\xe7\x90b\x8a\xe6\x92a\x10L\x9c7\x96\xc8\x05\x9c[(\a#\x05u :\xc5C\xa5\xa4b\x10X\xa4\xdd\x10\u0319\xa18(B1\xb50\xd8\u0169\xf6(\u04c0e\u2bf2\xf9\x15p&\xb6\r\x88\u030f\u05fa\u065b\rb\x93!\b\xa6\x94\xab#\xaf\xf6\"K\x97T\xec\x87p\x1f\xa1\x06\xb3i\x8ecT\xa7E\t\x05u9\x14\xf5\u02b0G\xbbnh2\x0e+%\x9c\xe7\xeb\xcf;i\xdbO\x0e\xd1\xf4N7\xe3}\xeb-\x85\xb0\xb9K$\xd4\u01c4\xce`\xb4\xb2l\xb1Zsq\xb29\x16\"Jg\xb4\xb4\x94\x80T;< \f\u03f2\xf9:=\xa2a'\x87\xde\xd4F\xbe\xfcv\xc6Wy\xdfw\xc4\xfa\xe2\xb1\xd7BTNv\x8f\xe3\xa7\xd9\x1b\xd0\xf7f\xba|\x11X,\xee\xa0\f\xe1\xc0\xe3\xea\xf5:\x03Mb\xbc\xee\x87\u0308\xda\x19b\x11\xd0r\xb1\xc5\xdaj\x8d\xe3y\xb6<#M\xe0\x00\x00\u0360\xdaL\x92\x8fF~\xb6\xb6\xff\r\xe0~\xdd\xf76\xe0F\x90\\\xa4g\xe1\xbaR!9\x9f\xbc\u06edaE\xe3\xdct\x1b\xff\xe1\x1b\xef\xcb1 \xbf\xc1\xff\n\x1c\x88F\xfc_\x87\x05}\xf6\xb5\xcd\x17`G\xa1lw\xbeC\vJ\x8c\u01ffd-\xd7\x01\x8f\x19\xa0\xe1I'u~C\x83l`8V\x12\x94\x06l\xebS1#\u0632s$p\xf5\x03.\x83\x03\xb8\xefX\f\\\xff\x14\xb1uf\xf6\xaeZ@\xa1\v\x06\xc0t\xef\x7f}\x98\x8c\xee\u0491\xa4\xbaF\xae-\x1fc\x1cj\x8a\xbd\"\xfd\x1b\x86a\xa6\xf3\x8a\aj\b\x1a\x98\x87\xe2\x16\xf2\xee(\xeeUd\x8e\x03&\x01k\xedh\xe2 \x96\xf9P\x87\x98\t\xc8\xcd\x0fZ\xb9\x8e\xac\xbb\xe19\xe6]\x17\x97g\xa77\x1a\t'\xba\xe1\xe3\xa8\xfb\x1c\tRr\xe1u\xb5.\xda\xdd\x06\a~v\xecO\x10\xf1\xd5y4P\xd0&K\xfe\xba\xa9\u05b6<\x05\xd6\xf1\xb5\x1e^\xa8(\xeb\x95\xe6\x1e\u0089\x13F@\u0177\xa4%\xa5\x7f+\r\xc7\xd9Z\u021c\x84Z\xe1\"\xfd\xa8lIrA\xc0\xf0\xa8\xf8\xb5\x87\xcb\xea\xc8\xe1\xfb&\xf2\x99\xa7%\xd6\ued17\x97\"\xb9\u00f6m\xf6\xa9\u023d\xc3\xea\x11\x8f6_\xf6\xd5\x00\u06da;P\xad\x95t\u48af\u04feW\xfd\xa0G\x87$\xa9wy\xb3t\xfb\\\xba-\xd6\aet\x18\x0e\xfe\xc07t\xc12\xdfnx\xe9Sd\u077c\x9b\x9e\u8228\xc7'\xb4O\xba\xae\xd0O'Dj\xaf\xb23`qTG\x83c\xf4\x94\r\xc7\xda\x1e\xc5\xe0\xe8+\xd3\xf5\nP\xd6|\xed\x11\xa3\x848L\xb0<\xfc6\xc5\x18\xdf\xff\x01\x90\xe4;\x84\x01\xd1,\xccy.N\x8cL\xb0\xd7y\x80\xd9\xd6\xf8kj\xfa\xf1r\xb6\xdb0\xa8\xa6r\xbf\xce\u06f6\x0f\r\x84\x06\x00\x822\x875\xe9#l&\xfe4\u03d7\xd9\xc0\x1c\xfay\x8a\xd5\xed%\x88\x9c\xac*\x18\xc4\xdf\xd1\xc3D\x036\x1d\xbc^\xc5\xc3\x10\xf2\x98\x83\x1d\xbc=x\x04\x9e\x1a\x11\xe5c\xbf!\xdb\xc1\u07c7\u073f\xb4\xfcH\xbc\xbb;\xac\u012c\xb8\\\xfe\xb6k\x015\x04\x7f\xf3\u0578\xddn\x7f\xef\xb0\x1a0q\xa0\x8b\x86\xa9\xef6\xefg\xa6\xb1\xbf\v\r\xec29\xdc\xea/6\xbd\xbf\u04f6\x06\x13$\xe7A\x18=O%h\xf5/ReqW\xdex\x99\xaf2\x80^\xc5\xeah\xdd\"\xaf,rcdB\x84m\f\u057cY\x04|\x1b\t\x17\x19\u01a3@\xdeA\"\xcfc\xf3\xad\u02db\xa7\xd9\xc9=M\x81;X\xdd\xfe\x90'\xee\u02eer\x91\xf1KJbp\x15$Q\x82\xa7\xdb\f\nG\xe2\x9b\xfe\u034b\xf3\x83\xdbB\xbaWj\xa1\x9fw\xaf\x038#\x96\xc6\xc8\xfa\xe4\x84bR\x8f\xf1|\xb2\xd1\xf5\xacq\x19\xb7{\xf2\xb2u\u00d6\xe1\x14\x1e\xcc\xe7\xba\x06`\xa7\x02\x81n\xee\x91}\xeb\x9afg\v\x164\xb4\x1an|\xf7\xbc\xbaZ\u02f5B\x05\xb5 \x1a\xaf\xec\x81\u07b4\x8bu\xa4\xb9\xc2HZ\xf2\xa3f3\xe6\xf7\xc8\xee`i\u00ec4d\xbb\x80trx)\x9aB\x80\xb9\xd8\x15U\x98\x810I\xf8\xee|\xbd^\xed\u07f9syyiFrwoo\xbc\xcc\xd6wf\u0174\xbas\xb1\xfe\xe6\xee\u07a8\\\u0701\xa2\xde'\xaf\xfe\xe9\xe4\x9b\xd1\xef\xb70)\x19v\x9d\x1c \x9e\x94\x86d\xd9\xe3\x8a\v\xa4\x17\\t\xd6\x1f\u53b5\xbf\xdf`\xf1\xf9K-\xff\x1b]^-\x05\x14\x97\xe1\xca2\xb8\xbb\xa4\xe7c@\x16\xaa\xe7\xb5\xfet\xcd\x03D\x00\xf6k\x87\xeb\xc72\x88?#\xf0]\n\xe5k\xb1\xd3JA.0\xa6\xbd?\xaa!\x9a\x11\xa0\b/$\xc4\xe6k4\xba,{\xb6\xc4r\xb6\xb0f\x17r\xebc\x9d\xe7\xabK\xb0\x9e\x8cw8\x04u\x94\xf7\xeed\x1e~\xeb\x8a\xc4b\xa5F\x00\xf4 \x89&\xfb\xb8\x9a\xe7\xd3|\x8d\xd1\x04W\x15\x17\x1d\x824$2\xfa\xf8S\x1fw\x94\xd9k+\v\xdb\\5\xee\xf3\x907\x9a\x93a\x82\xad\xe6u\xf5\xf6\xdb\x1e]A\x19\x03\xe7\xb9\x7f\xec\x00\xb4K\xf7x\xca\xd5\x16\xf9x\xa1-\aQ\x12\r\x1bC\x10D~\x00Z8\xdb\x00\xd1*tj\u0194, \xf6B\u07a6\"O\u06d9,\xf7\u022c2~\xfd\xdb(\x87\xd6h*|\t\x97\u0573x\x82E3\xb9\x1f7|\x9aG\xb7o\u05ec\xb2\x9e\xa9Sb\x1b\x82{N#u\x98\xa7\xf5\x0f\ud367a\x8e\xad\xe1\xd3\xec\x15\u0458\xdd\u03e9\x8da\xf0B\x17\x80\x06~8\x81\x95?\xfa\xe1d\xcc\xeb\xa1\xe3!:\x84%\x1c\xdch\x1bt\xb7\xb0\x90\xe6\x88\a\xd7K\v]\x81l\xa3\tK\xe2s\xa2\xc4u\x9a\x97\x11\xea\xaa}\u0495\u00a4\xef\u07ce\xc4v3\xaa\xb7\x9b\u053f,\x9dE\u06f8[\xf7\xaf\xa7vU\x93t\xad\xea\xc3\u0498B\xcb-Dj\x9e9\xefQ\x02\x95\x1e8\n\xd6}\xb0%\x90\xaf\xbe\x19z\xfe_|ym\b\xd2\xe0F\x04\xfd|\xa7-q#\xa9\xe0Z\xc8H\xa9\xc08+\x15%\u057e%\xb56\xf6\xfc\xef\xa3\xc1M\xe1\x16m\t\x83\xfd\xb1H2\xa3\x9fL\u05dc7l\x0e\v\"\xd7\xee\xd2\u03b6\xa8)\xde\xc6\a\xeb\xa60\xd8\ub72d\x86}\xcfA\xcd{q\xda\x0fB\xd1r\xd8\xdb\xd1\xdd\xc1\x8d`W\x1b\xf6j\x18\xd7\xff0\xebV\x18K\x97\x99+\u067fAE\xa8Q,P\xaa\r\xe9\xf05\x84\xa6\xc810\x1fh9\xd7\x0eq\bw}\x89\x81\xcbhMN\xa3\a\xf6\x84\x01K*:\xe0\xb8\xe9F.3Z-\xafb\xf2\xcfv\xac\xe8\x10\x1d$\x125(\xcdcEn\x9b\xe6\xb4\u02a6T\xc2[^3{\xbe\xc7\f\x9a[\xcc\x01H\xbf\xb8\xc8g\u064c\x1cc(\xdb\xc0]\x86\xee\xae\u04cd\u0661\x8c}M\x12\xf8\v\x8d/\xcc\\\xbdqG\xae\xc6\xec\xa3\x11\xf01\xd4\xc7\xde\x01xY\f\x11S#\xdc\x17)&\xbe>O\u05cd,\f\xa0\xdfp\xae\xae\x10\xb4]\u067f9\xbef\x7f\x93\x89\x9b\x0eO7s)\b\r\u075c\x1a\x81\x10=mFL\xc3\xf2\x8d\xde8\x1bj\x9e\xc3*\u0336\xb3\xcbGur\x11\x8a\xb3\x13p\a\x8e\xe6s\xa8\xe6\xf6\xeb\xafD{\xf0\xf4R\x1d-\xdc\xf4\x03\xd6b\x10\xb6\x84\xde\a\xb2+\xa0\x86f@w \x81H\xeb\xf4_\u00c6\xcd\xff\xdf\xef\u06ff\x06\x86\xa6.!P\f\xe5\x0e\x8f\x91\xe3;J\x1c\vE\x0fxt\xfb0\tbB\xede\xd1\xcf\x03\xa3x\xfd\x10Qx\xa8\x873`V\u0548\x0ep\xc5Yo$D7\xd8< \a\xd1\"u\xbcC\xef%\t\x1ad\xec1\xa4\xb0Y\xae\xf3\xb9\x13\x8f\x017\xb0)(\xda\xfc79\x8e\xf6JE\xc6el\xa8E\x01\u0608EPm\x87%\x90\xef<\f\xb1\xd29;yu\xd3%A-\xbf\xf7\xb3\u030aj}R\x1c\xbb\xa7\xf0-\x1c\xf8\xd2w\xb3\xc4\"\xd1l\u05cf2\xf0[\xcf8h\xcch\xfa3\xfc\x01\x87\x11\xb4\xd5a7 \xfd\xafe#\xc0\xf4\xf6\xfa\xe4\xc9\xe8\xbb\xcf\u0612\xd7f\xe8\xdfa\x11\xbcO\xd4\x1d*z\xf4/\xbd\x17]\xd7\xfe\xe1U\x90\x80\x80Mm\xdf\x02\xd00\xa1z\xfc)\xd4\xd2\u016c\x96\xa1-\xbak~\x02o\xbbaq\xe66\xda0\xf0\x8f\xacM\xf3\xf6\xd1\x1b\x15\xdeo\x831-\u0290\xbf\xfb\xec\x1d\xc5y\xf2\xe4j\x8dF\xb7\x96\xbe\x9b%\x84\x81\x8eW\x84\xd94\x80/Y[xF\u0726t\x99/0A+A\x84q\x8c\u4026\x10\xf4<\xb1\xa0\xe7m\x87\v\xf6\x10(\xe3\xee\xb7\n\xb7\xc7\xdb\xcb:\xc7\xc7 \a\u033a\xa5k\x99}^4\xdcd\x92\x01\xd8\x11M\u00b4\a\u1950\x13\x95\u0344\u055b\x0e\nFl'\x98\xf5lfV\xbd#\xd5\xc8\"\a'w\x88\x83\n\x88g\xe2!\xb9\xfbg\x18\x17\x94a\xe3U\x03\xcd\xdbl\xf63\x1c\x04\x9e\u056e1\x9dbB\ng\xce\xdd*B\xf8\u07f8\u05fc\x9am\xfb\x1d\xdf\xd7_\xa9\xe8\xd0'\x00\xbc2r\xca\x03KN\xf4\x18\xc9)e\x12\x11\xb9D\xb6\x06\x8e\xdb\xd2\x1c\"B\xa4\xff\x02\xbb\xbfe[\xf5.\xe8\x1d\u0161\xeb=\xa5\x83\x9ba\x9d!~\x9f\xf0\x8f\xf0Me\xf5\u056f\xc0\xbdX\xf1{\xbc\xcc\xee~_[\xdf7\x9d\x13H\xa7D\xbc&|F#{\x94\xadP\xea\x8c\xf5\xce\xf6\x0f\xfb\xc1\"\xfd\xf8\xbf\xf576\x8e \xf2xX\xeb\u010bj!:z\x02[\x1c\x86\x03;&A\x02\u018b\xd7'/_\x9f\xbc?~\xf6\xf4\u8c7e\x1cyS\xc8\x10\x80\xdd\u0308\x1et\xd2|\xc5Y\xbb\x8c\x8eVB\xeem\x92\xcef\x14<\xe1\xcd\xf7Q\xb1\xcc\xdeCirdB\x10\v\x96/\xf3\xea<\x9b\xd5R\xb5,\x9d\x04\xc1\x90nl\xf6\x18m\x95\xdb\xec\x9b/i,\xc7\xc0\xa1\xdf7e\x93\xaf]\xfc\x89\xbfWo\xa9\f-iR\x1cU\x80\x81GfR6\b\xc8\"\x81a3\x87I\x8f\x8eKO{v\x8a\xd3S\xb2`\xd7;y\x81\x8f\xde\x1f\xd8w3\xf4\xa1\xdb\xf8\f\xfe\xf4v\x12LVo\xe0\x90\xb7\u023br\x1a\x99\x0f\xb7\x88\x10e3#\x10\xeao\xbd\xfc\xd2\xc8\xff\u047b\xd5fB\x93\u4da0\xff\xd9 \xd9O\u0721Jh\xc50\xdb}f\x84Sz\x91\x9e`\xbc\x1f=8<\xf4\xbaW#\x8f-\x92\xf9\b\xbf\xfd\x83\xd1|\xa0\xb3Y-\xe2R:\x95\xe8\x8e\xf9\x15\\\xd7X\x99\xe3\xbd0\x87\x96\x85\x1c\x04\x03\x84\x91\x15+\xf4r\xba\xa1\x82\x9a\xea\x86\xfb\xc9\x06\x83\x15\xcb\u0317\xf6\xfcs\x8f\xa1.\xfdA\xd3\x14\xe9\xa0\xdc>lfG\xf5\x06\x14\x03\u0685\xef\xe0\x90\xf9\xd81]+Nq\x02?sI\x11a\xcePi'y\x93M\x12\x12|\xc04Z U\xcb)~\xc4\x1a#\xc0\xbf$\xe8J\u0ae0\x82\x17!|\x8c\xa8\xafD\xe9\x11\xad\xe8\x17i>\x87\x1c\xf0mx\xbf%A\xfd\xd2e\x84\x02)\\6\xde\xc8\u072d\xb3%\x89H\x97?i\x83\x01\xbe\xd4/\xbeGO\r\x8d\u6aef\xcc?\xfb\x9c\x17\u024ba~\xe3\x1f\xd4<\x1d8B\xa4\xc1\x9a\xc1LI\xab\xd8E\xf0#`\xae\xce\v\xf7\x9de\xf8\xf6\xab1\xeb\xb6^\xd1\u07b0e\u0289qF\xb1\x9a\xbc\xe2\xc6\u06e4\xc1\xf8\xcd\xd1Z\xfft2>\xa6\xeb\x7f<E@Jz\xc1\xa3T=T\x00\x17\xac*\xf0\xee\x1c\x8ah\xe3\x0e\xa9rB\xab\xcf7\xeb\u04fb\xdf\xf2\u028a\xd3N-v\x1f\xeb9\xdc\xfdv\x9e\xf5\x06\au<\x99\xa5H\u0109\xc5p\t\xa5\x15M\x80\xa8\xaa<DY\xfeW\x91x\xf3%|n\xf5\x16\xa38\xb0&a$1\x16\x8cX\n\x16Q\x9a`\x13\xe9}\x80\xabu\x17\xd95\xa4\xa3-\xa4]SL4m\xe3\u0435H\x04\x97\x8c\u06c1_\xf0\xf9~\u00afI\xb9\x91}{\x7f\u050a\xafD\x00g\xa0\xf1}\xfc\xdfOJ\xacu[\x0e\x03|N]J\xce\x1c\x8f`(U\xefi\x85\xd5\xfdi\xb8\xfc\xdbw\x86\u037f\xc5'\xeft\xa8\x9d\xe3z\x97\xfa|\x98\xd9\u073e\xddpt<\x16\xf7\x03\x85t\x8b0kz\a\xf4\x86\x94|\xc7\nY\xa8\x8dJx:\x8f!d\xdb\\A\xb8uvN\xe7\xc5|&yq\x13\u0248k\xd9@}\x02<qV\xf1\xa4\xb6i\x8fF\x8d\xd3\x16P\x18\x9c\xe9!\x9fes\x85\xed\xe3!\x02\xdd\xfcw\xf7\x90\xe2\xfb\xd9x\x96\xaeS\xb8\xde\x18S\b<\xb7\xfb\x91\x03(\x16\ai\xe0\xee\xb7^\x03\b>\xc1M\xf0\u5e5f\xec\xf1\xdfx\x91\x9b?\xe1\x94:\x11j'\xa5\v_4\x94J\xbdY\xed\xab\x0eC\x15\xde\xff\xfc\xe1\xd3%\u0220\xeb+\x9f?m\xd1\xc1\x9a\xb4\xb0\xda($v\x80\xee\x06\xb9G/\xd3*\x01V\v\xca\xf9\xe9)\xc7|3S\x82g\x1c\xdcoI\xad\xf1\xeah\xbd\x1e<\u04dd_\xeb\vm\u073eJ\xf0\x001\xaf\x90\xc98\xeaG\xf0`\xa1|^0<\x11t\xa9;\x0f4\x98\xed\xa1\xf2Kx.D\x89$\x82;\xd1\a\xa0\x96\x7f@\x98\\\xe8\x8dB\r\x81\x10\xba\x01@TI\xfd\x88\xc8<\x81\x80h\xca\u0118\x8dwT\x1b\xd4g-G0 \x16\u03feD\u02c0\xa3\u057e\x15\x125\xf7\x90\x8c9\x8a\x9f\xe6*\"\xe3\xfdD\xfe\x16\x89\x11\xd3\xf0)\x19B\xb7\xc7Z\x028\xe5\xec\x17o\xbd\xb6n\xdf~\xe7T\x04\xeb\xd50_|\xff\xfd\xf7\x92\x05@\nji\x1b\x81\x83\u0232\xba\f\x8c\xc5uOQ\u040f@\x00\u05628\x8dU\xfd\xa8\x8a\xb9$_\x81\xc9\xf9\x97\x00\u0366\xd1\xd6\x11\x9c\xd0\xc8\x17\x98e\xa0^\xdf*\xaa\x02\u05299Qh\xe0\xe7\xc3\x04\xc6\\RCm\xb3F\xd7\u00ca\xc3\xda|h~;7\xc7\x0e\xc8\n\x03\x96\x1c\x89\xc0\x9fo \xb1)\xb0\x85\r\xad\xc4i)\x8a\x84\xcfy\n\xe1 \x11\vKr4\xcf1\xf4\x10,\x8b\xe0\xab/\xf3\x19\xd38B\\O3m\xff0\xff\xbc\xc2\u0120!\x9an\xb2\x8f)Xb\x8d\xf8\x80\x10\x87\xd3\x0f\xcb\xe2\xd2ty\x86\xa0jV\x9097\xf7j\x8b\x8b8\x92Z\xa84\xfd\x92m\xb0\xdd\xceG\xc8\xf9|\xff1%\xfc\x84ZD\xb0\x84u\xb5\x81\x9a\x14;\x03\xee#Y\t\x14\xaf\xcc=\xc5?\xa1\xca\xf1\xe9ez\xd5Qqp6{\xd0\x1dfez)K\x8e<g\xa57\xcf:\x95d\x0f\xb7\x15\xce\xd0WV\x9bB\x11\\nN\xa38h\xb9\x02AE\xbf\u066c\xca\xd5\xfc\xae\xe6\xday`\xfe6\xab\x89\xb1xb\xda5\x8c\xda\\x3\xab\x9e\x01\xd7F\x8d\xaa\x18;\xc6\xd5\u048d\xbeR\u3195\xfe\xc0\x03\xaf\xab\x14\xf8\\]\u01cd\x9b\xdcH\xfd\xd5~\xda/f\x16}\x9e~\xcc\x17\x9b\xc5V\x9b\x128\xe5\x91$&WL\xb3bI\x83\x12\x01\x98\xe8\a\x99\x8b9\\~\x86\x1b\x9dg\xd3\x0f\t`:R)\xcf(\xb5xV\xb6\xc3\xe4_\xf6~\xff\xadBy\x93\x02\xed\x10\xffgX\xd1\xfa\x12.\xb9\x80\x91\xa0h\xb0\x00\xff&\xc5EWC\xaar\x05%\n\xaa5\xbc\x8a6\xd8YY\xacV\xb2\xe7q/\xfa\x93W\x0f\x9e?~\xff\xf4\u01d3\u01ef~z\xf0\fP=\xf7\xf6\xf6\x92;\u0277{\x1a\xc6\a\x89\a\x13\x13\x03\x17\x81\u02c4\xe4\xd3\xea4\x13\x14\xa9\xf3\xd9,[\u0698\xc2*1K\x02\xae\xe9p:Xm!M8\xe4\x11\x0e7N\a\x00\xb0\xb3t{\x92\x89\xb6p\xd6\xcdy\xf6 a_<\x99\xf7\x90\xd1\xef\xd0\xf7\xd5yq\xc9\xc0\x16\xe0\xed\x1c\xa7\u147c\xdf\xd6!8\xcdOh\xf4}%\x97\u04d0\x94\xf6\x1a\xe4{\xb54\xc8'\xf6\x81\xac\x146\xd5\xdav]\xc9u\xe6]ow\x90\xe5MJQE\x1e\xbdx\xce\xe6_\x88\xd2\x1e60@\xcfE\xf0\xc2^z\xfa\xa48\xaf\x1f\x11\a\x1d\x01x\xabZA\xe1\x00\x1b\xb2\x0fiQF\xc05\xc7\u0105\x04\xb0O\x82\xbaI\x12L\xf3*\x96\xf3+\a\xb6*\xd5\\@\x97\xc6;\x96zA\xd3\x11\x04Q\x10\u0167\x97\xb5\u0700\x04A\xf4\u043d\x8f\xcf\xedc\x0e\xb0\xa1L@\x9c6G\xe0pfSL:\x05\x1f>\u0429\xe1\u04cb\x15\xe3k-\xac\xdd\x1b\x874\x04\x1a\x9a\x92\x14\x82\xf5/\xec\r\x12\x91\aZ\xe3\xdd\xdd>\x87\x11\x06v\b\xba\x88L@Bb\xd7qZC\xe7\x1b\xe3G\xbe\x15 x$\xcd1\x1a\x98\xae\x04:\nx^\xb94\n`V\x8a\xb7\x86\xf0o\x19\x1c\x197\xff0\x89\x9e%\xa3\u018b\u0095\xec\xab\xd1sU\xe3\x83 pbE!\xe7P\xc8d\xbc\x94\x04R\x14\xb7\x01\xcb\u070a\xdb|\x19\xd9\x15\x13p*\xb0\xc1\xff\xa2\xd3j\xb7\xdfk\t7-\xa6\xd7\xe6+N\xe5\xc6\u0586\x99\x8cx\n\xdf\x1f\xf2\x82\xd4\xd2d\xadL\v\u05f1\xa1\x99+\xffbu\xbb/\x95C\xbf\u0505Z\xe3\x8c\x14\x19\rI?\xef\xeb\xacN=\xf4\u02d8^7\x8f\x8ff]\xfb\xfat\xbe\xa9\x8c\xb0\x03\xe7\xb4\xef\xe3\x85Gn\xfb\xce\xee7\xbaen\xdfv\xbf\xd8\xdd\xc5\x7fx\xf2V+]\xd0\u05d3Mu\xf5D\xb5\xd9\xe8ks\xaa?\xbd\x8e\x81H\xe0<\u0357,\xe8\xdb0Z\xb33\xc88\x94\xfe\x0f,\x12#\u0288C.\xc4\x04\xe0\xf3 \xa3<b\uf801c/p\x11\xb9\xfbM\xa9\x92\xdc9\xfb\x91\xb0~P?hl\x14kk\x90\xdciu\x00\xb5\xca\x14*!\x1d\xc6\xcec\xf8^\x92\xfeeIYV\xe1e2\x1bC/z\x84\x12\u0330\u0363\x01\xab\xe2\xcf\xec\x0f\xaa\xb6\xa8\xfbu\x9f\xb9$\xaf,\u0289-\x86\x9d\xba\x1cy\x92~\xa0\x10q\x15\xa5\xfb\xe8\xe9O\xb6\xb0TZ\xf9Qf\xb3\xbcZ\xcd\xebj\xca\x0f'\u03df=\xca/\x18B\xf6\x93y\ud0aad\x98\xffB\xeay{K-\x97\bX\xe5\xca\x00\xda\xd74\xaa\x81l\xf3\v\xf4\xa1\xe5\x17\xf1*\x18\xd2\x02~\xb6\xbd\xd2\xdd\xd3\x05\xd8skYI\xae\xe2\xd7(\x877\xbcr\x00Mm!\x10u[ST\xbd\xa3CK\x16=\xb1\tzX5*\x01\xb7-\r\xab\x1a\u02f5\x96l\xd9\u6b5f\xa3i\xa3\xf1{\xaa\u046c\x13\xb8\x10w\xec\xd4\\\xa5\x96\xdb\xe1\x1f\x9ewD\x05\x99\u06ea\x18m\x95O|&\ub5e9PmY\xe49\x9b\xbb\u0484\x1e_\x8e.\xe8\x15\xaf\xed\x96\xd2\xf47Z\xe1\xe8G\x97\xf0\xc5\bd\xb4\u0442\xbe\u0261X\x82^\x16\x11.\x1a\xb2R]\x8d\x9f\x83\x16l}\xfb\x96\xdff\xac\x1f,\x15d\x98\xc3\x14\xd2H?\xae\xcdo\x9b@\xed\x10\xeb\x14]\x94\x89\xab\xe6U,\x11X\xda9\xb9\xf0\xcf\xd0\xc1\xc5\xe8\fF\xf3\x83\x12\xb0\r\xd3:\xb6/\xd0\xc4\xdc\a\xe3t6C\x17\xc43\u023f[\x82+\f\xb1\x9d!=\xb87\x941t\xfch\xb3\xda\xf9\x13\u062c\xe0\xa3\xda\x04\xc0\xb9a\t\x02\x8c\x96\xf42.T[\x0f\x02\xa5\x8d\x94/\xb5k\x8cz\x04\x7f\x12j\xaeZ\xcc!\x8a\x80D\x87\xe6\x0e\xa6F\x905\xdb\xf5 x\x9dJ\xf0x\u052a\x93\x01\xfe\xc9\x13.pd\u06a7V\xf8\x03\x12\x7f'\x9b\ty\xab\xbb/\x7f\xadFv\xa8;v\x99M=/\xb7\u02e2M\xe6\x9br\xfb\x9a\x91W@\xcbW\x84\x82\x1e\x1c\x02r\xeb\xf2\x8de\x8e+\u0098\x13\x85 4\"\x1c\rN\xb4\xb6\xf8\x88\xfd\x1e\xe7\x19 \"\xfc[\\\xd5\xc3[\xd8\xe1\xadw\xc9/\n\xa8\xbfg$\xe4\xe2\u3220$\xf7\x13*\x7f<2?\x1d\x04/9\xbe\x8d\xe9\x8f\xfb\xe4\x845\xd7*V\xdf\xcb\x17\xa0\xfc\xa5\xcbu\xf8\x19\xb5\xc7\x10f\xf7V\x1f\xe3\xcfq&\xfbF\u06d9\xe73\xef\x8dO\xfa\x8f\xf1\xe5\x14\xe7\x13N\x80ohp\xa3Bz\xfeh2/\xa6\x1f\x82\x8e`\x95F\xe9<?[\xee'S\u023b,\x83\x17x\x88F\x9f\x9c\xf65Z\xbb_Hj`d\x89{\x83\xe0S\xecT\u0412\xa2\xdf\n\nh\xe3\xd4\xf6\u02e2X\x87\xf3\x8a\x0f\x81\x00\x99\xba\x97\xb3:\xd8\u04a8\x86y\u06a1BUC\xb3\x91:\x04\xfb\tT\x17hx\xbf\x86\x9c\xbf\x8f[\xd5\xe5m\x86\xce\u07d7h\xfd.\xdf0\xa1\xb5c\xf77o\xd3\xff\xfc\x90]\xb1e\x902\x8d\x83\x1dCg\xdd/F\xf6M\xa7F\xe5\xdeO\xee\x8e\xf7\u032d\x14Pb\xa1\xdf\u062b\xbd\u14fc[\u03f0/k\xe4\x18-\u0340\xf6i@\aM\xef\xb8\xcd\xd0s\x8f\xec\u05a0\xb1\x89|\u034e\xca\x11\xba\x1c\u0e21i!k\xfc\xc2\xc8\xff\x86\xab\x8c\x84\x13\xef'Yj\x96:_\x8e\f\x0fn\x1ei^f\xfc\xbaMg\x0ev$V\xa0\xed\x1c,\x98\x04)tt\x9e\xcf\xc1\xf5e\xb6Zc\x05\xb8Z\xef[\x99\xac\x91\x00U'\xbaJ<\u05ad\xfd1E\u011f\x9e\u2c7d\x96\x9a\xf2S\x12A\x15w\x16\xd1\xd7Lqb\x98\xde&\x98\xe1\xbaX\xed'\xa3\xdf\xff>8e\x96\xcf\xd5\x19\x1cs\x86\x16\xc6\u5f7e3\xb3\x1a]f\x93\x0f\xf9z\x84L\x9f\x87\xce4<\xac\xdd\r`\xdc^T\xc8\x16S\x9f\u035a\xc3\xf6\xb7k\xb5\x11Cf\xa0J\xc5M\xb8\f\xd8J \x1b\xef\x8a\xe8\xd0\b\x11\xde \xaaj\xf2\vi\xc1\x01\x1b\x80\xa3\xad\x17\xadu\xdf\x03C \x86(d\x18\x7f/\x18\xfc\xe0\xb5\u03086\x13:\x1e\xf3+j\x8c\xb0\x18k\x05Z\xd2\xd35\xe5Y\xcc\xf3\xe9\x87qB\x89e\x8b\x14J\x82\x1e\x9d\x97\x80We\xa8\xb8\x98\u6133\x06\x19\xf4\x9b\t\xe5\x98p}0\x10-E\x02\xe3\xfa\xddb\xe6\xa5\xeb5+M\xb3\xc7b^\xe1F\xbc\xe7\x18\x96\x9c\xac2\xf3\xaf>\xc6\x1c&SX\x98\x81\x0f\xb6\x05b\xc3\xd0M\x00\xfa\r\xc4?\u0285K%/\xc4}\x86It\xf8\xd7\x18?\xa1\uf7ae{\xd0\ufe61'\x82\x0e\xc8\xe1\a4C\x83\x83\x92L\xe2W\xc9S\xf0\xd0\xceg\xe8\x9c\x1b\xfb\x82\xf3C\x1a\xffu8E\xbd\x81\xbf;\v\xb8\xbb\x17|\"g\x9d\x1e\xc4Xg\x9cv\xebsi(\xdf\u0668b$\xc9[O\"W\x8a\x8e\xa7\xc0\xf4\x90L\xe1\x1f\xb3\u025c\xff\r\u00cf\xe0\xf6 U\xa8\xda\xc7M\xab^\x13\xcd\xf1C_WR\xc0<\x8ae\xef\xf6\xa5[\u010e\xdf5\x00\xfd\xb4\x8e\xa0]\xad\xa9+6\xa1\xb5BB:\x1a0\x86\xb2\xf5+\xf0\xebT\xd9O\xf9,+l\xb0R\xd4l\f-7BN\x91U\xd6Y\x95\xe3\x95e\xc0\x04g]\x95\xe4\xd5\x05\x05?\u0357\x81\xe1\r\x1cfp\xb5\xd6K\xff\xa0\x15\x8f[\xd8^yA\xdel/\xbb`w\xd2GOB+PX\xe5\xa6\x15\u05c3\xccF\xdb`\xf8\xecJ\xb6,\x123\x19.\xeeN6O@\\\u010cp/g\x18Y\xed\"[\x9f\x173\x17B\xf9\xaa\xb8|I\x19\xc9\x1c\x80s\x9aN3\xbc\f2\x867\x83\xa1\x80\xcd\x13\xfd\x83\x14\xd8r\x9aa\xd4\b\xb9\x05\x8ddM\xe5\xeb+\x8a\x90A\xe0\t\xaf(\xe3E\x9e\xd9\xd28\x0e\x11\x94\xbe\x87\xb7\xcd\xf5\xfe\x01\x82t\xd1\xef\f!\x8b(\u0262\x8f\x90\xa3L\xc4\xe8\x0e\xdde\xe6\xac#6p$\x91\xd1F\xd6\xe0\xecq\x12\x90\xa7<\xa2<e\xbb,\u00c4\xab\xec\xcdB\x806\x9b-\x85\x9e\xa2F\xc4\xc7$y\xb1\x1cq\x89q\x9c\x06\xc6p\xa4\xf3K@\xc0\xc1p8\xd5\x16\"\x84V\x10\b?\u02e7Y5\xaeQ\xa954\xc3x{\x1fG\xa6\u015e\xbd\u0299\xec\x95\xebA\x05\x90\x94Ts\xa8\x9d\xb4\xcd\x16\xb3\xe5JE\x1c\x9bUp\x1e\xf9\x9cc\xe1\xda\xe0E\x95c2\xfe\x9e\ub25bw6\v\\(\xce\xd1\xe0\xadiE\xc0=h\xa8\xb8\x05K\x8d\x81\xacoU\x93\uf68e\a\x16\u07da\xb2\xd1\xc3;\x1eX\xcfI\xc1(\xfffG\xc4\x1b\x82;*6\xdf\x1d\xcc\xcbP\xea\v\x90\x951\xe6\f+\xb9!0\x16VH5D0\x95\nK$\x9d\xe4+\xaaG\xdeD\xf8D\xb8M\x84\x8f\xd2\x10\xbe\x01\xb3s\xc7@H5\x84+\xbc\xce1\xb0\xfeu\xff4\u010fA8|\xc8\x04h\x1b<f\n,?{\xe0\xb1\xe2<\xc9\x03\xf0\x04\x9e\xcd3\xc9\x13P'\u03d2\x13\xa2\x94I\xbbBGv\x10@NI\x02p\x8d\xcc\x11&\x10\x0eqIp\x90\x19F\x93\x02\x9fCY\x19\xb0F\xca4GT\x04~\xa7\xd3Qf\x11\xd1\vd+%\xbf\xeb\x17\xaf\xfe\xf0\xdbwm(\x03\x90\x9c\xa5!\x9e4x\x92s\x11\xe6[\u0602\x95/\xa0v,\xa6c\xb60\a\xf4\xb1\xe4\x03+\x1eE\xb0\x9a\xbc\xaf\xf2\xca\xfcW\xcaN1\xc2A-H\x95\x8a\xb1:\u02fc\xe6C\xb6';:xS[Ccc\xc1wL3\x16\x13\xad\xdfC\ub77c\xd2\x1b\xe8\f\x1dY%\u02a2\xbb\x8b\xe1\u07f6\x80W\xd8}\xef\xe7eo\x10fx\xc1\u04ff\x16\xf9\xb2\xdf\xeb\rvgf\xae\xec\xdc\x7f\x13\x16\xd6~w\x13\x00=\xac\xcb?\x00\xfb\x8a\xb0\x90\x8e\xbc\x83\xd6e\x87+<<\xf6\xbf\xdd\x15N\xa7\u053f\u009b\x0e\x18\xbfe\x9b\r\x8f\x97\x8f\u0643\xdbQei9=\x17y\xc6fe\xe5\xcbp\x97\xd2\xe5\xcc\xf7\x045\x81\x1d\x18i\xc8\xf0;L{\xb68\a\xf3\xa2\xf8\x00\x1d\x8c\xa3\xf1\xc7\x10w05tu\x9c\xa1\x91\xc9l\xb1\xd1K\xb9*\x05\xc0MT\xb8O\b~XV\xc9\x02@\xea\x17.G\xc2/\xa1jw\xec\x18'FR\x1cMr\b\xf5*\x962;\u0190\x04\xb2\xe3Ps\xa15,\xa0\xbe|\x8e\xa5\xe1\a<\xefGX\xff\x94O2\x1e\xac3\xae\xf5Uf\xd5f\xbe\xde\x06\u0104\x01\u014a^p\x91\x86\xf5\x99{J\x8e\x83\xda\ff\xc5\u07a8\xc6F\x1a\xd9V\xb16J\x9a_\xb8B\xb6\u06a8\xb0%\xa4cA\xf5d>\x850uz\xea\x17\x88\xe7\x13[\xab\xbc\xf9\x1bq>\xc0X1l\xdf\x15\xb9\x0fXH\xd955\xdeM7\x18\xf4\xd6\xe3.U\x00\xb6\x162\xadU\x8f\xb8\xdd 3[\xd9Z\xa7g\xa0\x9d\xca)\xd1x$\x81\bH7\x03\xad\x0e->\xa4|9\xa8\xf9\xb0\xd0\\\xb8\x0f\x985\x01\x01\xa3R\v\x05\xaci\x00\x9a4\x9b\xb1\x8a']2\x13\x00.\x98@\xa4c\x8e\xb6\xc2tM\xc1\u0719\f\x067\x17\x87\xe2J\xca2\xce2\x0f\x05\xe0me\xc9)\xe8T0\xb2\xa0)P\x99r\x84\u05a2\u03413\xd9\x171\x8eQ\xb2\x01\x9a\vKD\xa3\xf5\xd1\u0182i%\xe1\xe9irUl`\x81\x97\x1f\xf0_\x97\xe9r\xcd3\x9a\xcc\xd3%*\xb5F\x8f]d\x94\x8c\u0154\xbe\xc8g3\xa9\x1b\x9b\xe9z4C\xe2S\xa8%\x83\x9d\x8b\x90\xa1\a\xder2E[\u012f\x95YJ\xb8o\x97r\xab^p8\xc7I\xb1\xbaCQ~C\x8ei\x83\x11V\xe7`\xc2D\xe8\x18\xb8\xaca\xe2\u0493\xa1)3@8\u0215K\x1e\xbbJ.\xd1\u6e40>J\x8d)\xc1fc\x11l\xc56Ia\xf9\fp\xb6\xe7\xc3S\xe4K#\x1d\xc0-'\xe2m\xbc\xccV\xbc\xc0\r\x9eD$\xd0\x0e\x99aR$\"\x96\xf4\u254byU\x87\x06\xad\x1f\x91\x18&D\xe3q\xb3\xed\x1e4\xc0\xabRZT(k\x97n \x8d\x86c\xb2\x05\bt\x8d9#5\x03l\xf8)\\\xdex5\xf7z\x03\xf5\x9d\xa5\xf1\xc3\xc4\xc2U\xe4\a\xf5\xe2\xb2 \xa4BU\x18(<\xe3\x05\xb8\x9afK\xa9\xe4\u04fax\x8d\x95\x12$\xae\u04f5\xa4\x10\u04b7\x16\x99\xb1_u-2\x13d\xef+\x10\xf4\ua62dS\x8f\x8d\xca\xe4g\xe2s>\x8b\x8b\xafUq\xa3\xae\xb4/\x90\xd0\xf7[\x96a\xa0\xca\xcft 9\x8a\xcbT\xd6\xd6\al\xef\x0f\xea\r\xdb\x06)y!D\x95\xa5c\x03\xd6Rk\x81\x03OQ\xb4\x9c\x0eq\x1d_\xe6\xb2\xe9u\"\u076b+\x18\x82B+\x12U\xe63\x90\x84\xe5\x8c\x1a)\xfbJ\x12\x01\xe01\xea\xb9\u0550\xc0\x14\x89\xf9.X\x16\x06\x9a\a\xeeSA\x92\xc3\u4286\x8a\xe9\xa4\u0136\xabB\x0f\xd0\x1a\b\x85k\x93\xa4\x8f\xd7\x12\xe9\x1dv\x968\xc2\x0fYfF\b\x1c\x15\xfa\xe2\xf4\x81\nSc \xcf2\x06\"0\xbe\xaf\fp\xdf\x7f\xa2.O\xcey%\xa50\x91J8\x179t+7\n\xa82(\xc0U)@B\xfb\xe23I\x1a\xddb\x1a\xc3\xf3x\x91\xa3\xfa\xd0\xf0\xb2\u322el\x0f\xa6\x1e\xf0w\xb1<\x83\x13\xab\x96\xc0\xc52M!\xa4\xea\u0534Z\\*\xba\x82\xed\xc0\x9b\x9d\xb27\xf4\xca8\x1a\xa2y\u0666\x0ecq\x97\xfcP\x06f\x7f\x18\xa3\xd2\x06G\xc6(\xd2\xf5_\x1d'\xbb_[9\x15,\xec\xd8\"\x04\xe7I+\xe6f\xa5-}0\x9f\xbf\xc2\xfap\xdaO[+\xcf\xd0~\xc0;T\xa0hq\x80<\xf5J1\x04\xc8\x1eM\xcc*(\a\xdeT\xc8\xc3\u0187[\xa0\xaa\xad\xf5A\f\xffa\xca\x00\xc6R\xcf^z\x95\u034b)\x88\x8a\xaeF\x17\u0574q\xfauD\x9c\a\x89\x0fr\x1a\xb5\x1cA\x02\xa2d\xc8\x19\xe1\xf0j:\xe7fg\x1b\x94\xcb~:\u176d\x80{\x17\x15T\x1e\u0327\xe7Hz\xb3\x12\x8c\x1e(\xcd\\\xc1\x8bFR\as\x84a\x1d\xba\xaa\xe0\xe4\u0299&\xcc\xe3|\xb5\x01\xbb\x00\xeb\xe2N\x88\x1fXPE\x12\xd0A\x12\x1a2l<\xc8rs4\xe4\xf9\xbe\f\x95\xc9T\"n=\x0ek\x91\xce\xc4\x10\x88B+\xca\u0497\x99\u01c5I\xe90\xb3\x11\x93B^\xd6D\xcf<\x83Q\x94\x80\x9e:g\xd6)\x9c\x0f\xbd#$\x01\xa2\x86\xb2<\x15g\xb7Sc\x9a$,\u062f\xa7\u05aaBV\x11\xeb\x1f\xdaI\x1e\x83\xc3\x13\xfdh]\xb8\x0e\xe0v\x00\xa4\x1bX\x1d\xdbM\v\u00f4\x92\xaff\x92v\xccC\x1a\xd0P\xba\b\xad\x9c\xfe)\u036cp\x1b6P\xc7m'\xe9\x14_\u6d87\x89\xadPgS\x9e\x86\x02c\x05'\u052d\xe4}\x7f<\x0e\xfa\u057eB2\b\x81\x85\xc9\xf2\xdcv0e\x9e\x19S>\xe6\xf7\xf4\xa7\xaeK\xfdq\x03\xd7R\xc6\xe0\x1d\u060fw\xd0y\u04e3\x9a\x91\x9c\xf5V?\x8aP\x18\xdc\xd3\x19*\xf4h1\xe3\x9b<\xb0\xd0q\x01!$\xeb\x9a(B\x99\x87u\xcb\x10[\x03\x00\x03\x03\x8bo\xaac\xa2\x03N\xae\x04\xca\n\xa5\x06\u015e\xfa\xa0\x18\xd1\x057\xcb\x10L\x15\xf4\u06e1\x1cl\xfa#[O\aC\xa5B\u1e45\x96\x96\x85+G*\xabU\xf9n\u0366\x83\xe8\xbc3\xdb\x0e\xa18Bx\x01\x83\xb7\xe8(Q\xd09\xc34\x13\xc7=9\xd7\xccW\x86\xb7=\xb7\u0451P\u07350T\x9dx\xa2\v\xf4t\xa8G\xf0\xeb\xaf\xde!s\xc1\xf6\x1d\x94\xa9]\xdc\x15,\x8a9\x97`\xfe\xaeY\xcb\xf9\xe4g\x9b\xaf\xcd)\xe0p\x1f\x05:,\xe2\r*\xd9\xe6&Z#\xad<8>z\xfa\x94\x10\x1f\xe8\x1a\xc2G\x84N\x81\xfc\x9em\x8d\fF\xcez\xb0\xadt][v\xd3\xfa\x8fiiF\xfa\x12\x15lL\xe1\xbb\xf3\xf6/?\x7f\xbc\xb77\xfa\xf9\xe3\xbff\xef\uee11\xbe\x84\xae\x9c\x89Tj\x11\u018c.\x86\xb6!W\xbd\xf2@\xeb\x89\xc1\xe1A\xbc,SC;\x88b\xbd\xc0p\t\x84\x1f'\xb7\xf5\x8c*\xa1\xe3u\xc7Sj\xb0\xf3\xc8\x11A\xa8\b\xa5XDT\t>\xa4R\xa3\"\x9b\xc2\xe1\v@*\xd9\xf2[%_\x9bU\xf9\x1a\xa1x\xd8\xd9\xcf\xe0\xc6S\x1e\xeak\xbe\xea4b\b\xdbE\xf2S\xc9\xfb\xefq\xe1bsd{f\x1b1\xbc\xcd?\x885x\\\xb7\xb0\xb8\xab\xdb@\xbcp;b\xb8\xd2\xf6\xb2x!T\xbe'R\xf5K\x9f\x92\x925\x06\u0601\xf0\u0124\xe2!\x8f\xe1^a\x065\xd7_N\x81\x948\xda\u037d\x05\x02\x06jK\xb9\xd1\xf4>\xe4+\xdav\x8a\xe7\x06j\xdc N?\x15\v\xa8\x88\xdc\x00\xd0b\x1b)\x8e\xd7\xe6\xe6\xb6\xf8.\fV\xf3\x86\v~\u06c6\xfe\xa0 \xac\x93}C6\x93\xf1\xe5t,o\xf2\xe7\x0e\xb7B\xaf\xcb}\xdb`\r`\xcf\x16`R\x94*\u0654[\n\xad\xd4@\xf7\xf8m#\x1b\xe6k\xf0\xc6Z\x17\xa2\x8f\xbcg\x88\x1e\x9e\xba\xca\xdb\xd6\x14!\xc8Av\xfa#\xbd\xbd\x0e\xcbg\x96\xcf^8\xbf\xa1\xca\xc4\u0175C\\\x9f\xb0\x8aFk\x89\a\xb9\xe2\x03\xf3\x82\xaa\xf1m\xa7\xeaw-\xd9\xd55\x84\xcdH\x05\x9b.\x95&\x82\u06ac\xb2\xf7~\xeds=\x04\vz\x15\xd9G\x15\x8a\u01cbBK+\xc8GjiYV#\xac\xfc\xdb\xfeKv+\xee\xba\xf8\xba\xdaN\u0253\xc0I\u0735c\xdb\xf2\xa7Z\x9de;1\xe2\xaa\xcf\xcd\x11\xd4\x13\x8bH\x96\u01c4\xc0J\x9d\ry\x04a\xb9\xde\xda@\xbd\x86\x80\xc4/\xcb|\x9duk+Z\xe8y\x91^M\xb2\xa3y\xbe:\xa2k\xc1\xab\xfa\xacO'd`{\xf5{\x8b\xa5\x91\u3170t\xa9\u079d7\x1ebn\xd9\xf8D,W\xcen6c\xeb=\x001B\xaa\xb5;\xfd\x14\xe6\x8c\n\x19\xbb\x84\xa4)\xc47Cn\f\xd56,Wd9m\xa2@\xd0\n\xdd\xe9\u0635p\xf2\xe2\u044b}\xba9\xed\x1d\b\xe0\xe5\x1b\xa8vY\x18n\xbd\xe0\x90fLsD\x84H\x86R\xf7\x8a#\xf8\x94%\x9c\xd0\x12\xec0i$m\x95\xc3\x1d\xfd,B\xecqR\x0f\xe8g\xb7\xc1\xd49\u07fa\xf8\x90-+\x8b\x1cz\u25c6\x83B1k\xd3y\x06\xab\xe0\x91$\xb7\x14\xad.\x86M\u01aa\x8a\xf1\xe9\xc2\xe7 \xbf]N\xc1t=\x88\x1f\x85\xa0J\x1d\xbdkY\u07ce\xa7\xb5\xed\xbc\xba\xf1\xb8y\xedzN\x1b\u06b8\xb1\u00fc\xd4m\xc2\xfb\xd3\xf5T7\x9d\xe9O7:\"7\u0768\x99\xce_p\xf2}\x1d\x18W`1\x82K8\x02T\xe1\xee\xa8\x18\xcc\u0735`+\x04\x82.(\f\x04G\xdeZ\x91\xd8N\xe3I\u02f5b\x8d~u'\x91\x80%\xe8>\xc1\x12T\x03\xfb\x9c\xfdk\xa1\xe0IU\xeb\xc0\xf4\x9aR\x11\x13\xc4\xef\x92Q\x05\x06(1\x1fI]7\xa8\xc0\u02a9s\x81\xd0M\x1c\n\v\xf8\x88\x81\u025fYb\xcdj_\xff\xf8\xe2\xe4k\x1a\u0322\xa8\\\xd9MH\x910\xaf\xbd\xc9@0v\x15\x1b\xa1\xb9\xb3\x02\xc6u\xcbp\xda\x11h\x10\xb7\x12t\x04N2J\xa6\xc8\u05dc\x11\xf2\xefDw\xff\x8e\x02\uafef\x17\x9b\x8f\xff\xeeB\xa6D\xfc\x87\xf6\xc0N8\xaf\xeb\x01C\u059e\x16Y\xca!\xdc\xd6\x0eG\x8eft\xf5\x8cVg\x9b\u055d\xd5\xd9\fM|r\xff\xc0\x1a\x01\xc6&\u063fpZ`\u062b\xd8O\x99!FWs<\xa4\xb8F\u00c0\xa2ZEwE'M\xcd\x101\x86-\xf9~h\xaf\xb1\xa1\x8d\xf0XN\xe7\x9b*\xbf\xe8\x00Y\xe7\x97\xc5\xf4\xd4\r\x99\xcb\xd0\x1b\x8f\v\x02r\x93=4\xdc\x17\r\xe8z\u0707\x87me\xbb\xb5qY\xb9\x94}Pj\xef)5\xab_\xa8Ci\x05-\xd9\x11\xb66\xa7G\x1d1E\xab\u8495\n\fK\xa7\u04e2\x9c)E\xf9\xa7\x13\xef\xd0\xe31\xe2\x00\x8a\xbdd\xb3\x9cgU\x90L \x80\x93\xa6\x819\xdbw@r\x98\xae\x9d\xda\xcb\xfa1\xb8\xf8\x13\x10_J\x0e]x\xea\x90\xd2\xe0\x0e\xc4\xe7`\x9f\xf6\x19\v\xfa\xa5\x10\x1f]5'6\xec\xf6\xa0\x123W\xa4}\x9a\xaf7\xee^U'\xe1\xf6\x00\x13\xa1\xb1\x93X\xc9G\xcb\u06bd\xbd\x8b@\xb4\xd5w\xf8@E5\xee5\xc5\x04\xf1y\xb9\xde\xc6!\xa6f\x9cM\xaa\x1d5l+\xdcK\xb2\xa6\x87\xdbi\xf7\xf2\xdc4\xd9m3\xa1\xa1\xc6\xfd\uce19\xbc\x04_~C\xe5\xa4o\xddS9l[\xb7\x95_\xd4;\xdb\xccD\u0316+\xe3U\x016\x9f$M \xe8\xd5\aW\xe7X\x1au\xf5\xe6\x16\xf5\u152a\\\x9bU\t7\u0615\x16\xe6\xa8$\f\xbcAg\x90\x8d\xbd\xf1\xec\xcajo\x84_\xa8%\xaf\x99\xac\xb0%\x1b \x8e\xd8z\xe0S\xba\xcc\xc9-\x04\xb18\xe8\xbbV\xc3^\xdb\xd2~X\x0f\x8fG\x8c\xe8y\xdb\x03;\xd9\xfe\xd0P\x18\x12;x\xb0~\xbc\x9c\xbd8=\x16Ck\xab\r\x01\xad<\x87\xed\xe5A\xb6F!\x04\xe2_\x13\xbd\xb8\x8a]\x0f\xe0h\x1c{2\rHXS0\xf3\x0f\xc1\tF\xe6,\xde2\t.\x1bw\xb2\x8a\u040c\xa2\x04\xe9\xe9\x96$\xd88\xc0@\xd9\b72\xbaM\x87\x82^gH\xc7\n\x88c\x1f\xed\x98>x\xbd\xea\xdf\r\xea44\x06el\x99\x81\xe0L\xda\xeb\xd1E\x92x\xdb\xdbiF\xe20\xb1\x11v\x84\r\x88\xc2&\"\x04\x12P\xb1k\xa8F\xa8{\xe3\xdffVj\xf0\x0f\xb8X9>\x18\x1a\xe5\xfa\"\x15\x885\x1e\x0e6\x00\xa7\x93+\xd6[\xcb\xf9\x97\x19\x1c\x17\x9d\xd5:B\xa7\xa5\u07fa\xf0\xe6rx\xa0x\x8ff9\xd6F.-\xa1Dk#\xc0\xad\xa8\x12\v\xba\xf1\x03\x9a\u0215w\xb7\x0eN\x1a.\xadr\x8d\x01{\xf8+\xc6)\a,j|\xe3\xcb.\xa7'\x8b=\xcb?`\x88&\x99Q\x87F\x18\x9ff+P\x19r\f\x7f\xd7;\u07a9\xf81\x98\x81\x9ed>t\xf55k\xe5\xc6l\xbc\u044a\u03f1\xba\xc2\xe6nJ7\xeb\xe2(-\xcb<=\xcbXx\xa1z\xb1d\x8f\u0493\x86\x9d\x90\x91o-w\a\xdc'>\u017a\xed\xa2>\x06OJ\xf7\xe6V\x17\xbd\u0750\xea.\xb0\xa0\x04\xf9f\x85\x1e\t<\x95F\xb6\x01\u0230+\xf6\x1e\xa1\x88\xa3\x02\"\"\x11\xa1\xae\xb8-f\xe1#\x88\xd1l\xab\xcf\x11\xb3\x89\x9f\xb5n\xb8\xd2gl\xea\x81\x12]\x15\xf4\xa8\xb5\x81l\xa1\x8e\x12\xa24]0\x9f\xfdHi&\x01\x9a6\xac\x01ft\xc5\x0ed\xfcX\x81)F5.6\xbc@\x8bY\xcd\x01_\x1e\x8a4\xf8\x95O\xd1v\t\x00\xe0\xc5i\xac\x02\xb5\x03Z\x00|z\xd4\x1fB\xc9\n\x8c\x9b\xfd\xf2\xcc\b\xd7\u900d\x9cl\x1a\x05\xdbf\n{\xfb5\x05J|\x1d:A\x11\x84\x01\xf9HI\x03\x84\xf6\xb0\u02d4:\x1c\xb8\x82\xd9\xe4+\xd5_\xa7X\xadu\x92]\x15\x0e\xd4W\x8d]K\xce[\xc8#+\x8dj}R<\x83uh\x11\x8f\xecn\xa7\x17\xbc\xf6-\a}\xaf\x1e\x01\x12\x9a\xed\xc0hz\nT\xf6\xe6\xdc\xfc\x88\x13\xe6\xeb\xc29h\xee\x06\xa0\x1fE)]\u04db>'y\f\x13\xb1\xc9ZQ\x80s\xde\xf3R+5\x96w\x87g\u035a\xa8@AY\xaa\xb3\xe6\x8b\u0538\xea\x0e.%!\xb8\x14>\xa1\xbahv\xed\x1d\x98\x17m\xba\xa1Lv \xe3BT^\x88\x15\xc5M(\xd3\xd3fi8\xdbz\x03@<\xd6z$\xd1\xee\x92\xe7\x88\xed\xb0\x04O\xd5\xd711\xcaF\xf9),\x8eY~z\x9aO\xb1\xbc2\xe6cd\x86G)Z\xe4|\x02BC\x83\u0533+n\x1c\xbd\xf8h\x19\x82\xe8\x0e\xb3\xab+\xf1\xcc\xeb\x98\tR\xbbg\x96\x991\xb9\xbd\xc2-\x80\xf9\x9c-\x8b2\x93\\\x14\xc8\x05\xa8\xa4\x1co*;!\xd6/Y\x83Yv\x01P)\x95-\n\x8e\xe6@\x9aRzfze\x8f\x82iz\x91\x8d\xacR\x03B\xd0\a\xc3\ud2f9\x91\x94>\x9eN\xb3\x7f\xb1\xcf \x96%\xa3#^N6g\xe0\u043cs\xefw\xf7~\xf7\xfb=TKg\x99\xb9c\xe7U\x1b8\xf6\x96\x02\x13\x90P\v3\xefv\x18iu\x02\xeck\x15c\xbfM\x98\xf7\x93\"U\xec)\xc2\xe1\xa6\x1f\x8f\xbe\x88\xdfR\xbbo\xdd\x12\xfcA\x95k\x94\x1f\x87\xb6S(\x8c(\xff\xaeY\xbfcFzuj\x0e\xad\xc6\xd5\xf6\xc1\xa3\xc7O\x1e\xbc~v\xf2\xfe\xe8\u0173\x17\xaft\xd0\xfb\xf6\b\xf1\xb7[\xee\xb3w.\xd6=\uacc1X\x01\xf2\xcc\u06fe\x06\xc9\xfd\u00f8\x1f\xa3\xd5+\xdd\xe0g'Vp\x04\xc8P}\u07c9J\xa8%`\xb8&\x0eY\xf7\u00fb\xf2v\xaa\x9aLW\xfe\xbe\v\x13\xc7qme\xdc\xedC\xae\xb1u\xcdl\x1bd\xa3F~\xbd\xed\xbcm\xb3\ftZ\x1a5\x11\xeb\x1f\xfa\x82\xf3\x0f\x84\x17\x17\f\x1e\xe4\xddr8Z\xbbD\x00\u0564\xcf\xd2r\x86F<\xf3m\x83\xf7\xe6\xf3W\xf6\xc1\x04\xa4\u07dd\x97V\x16G\x89&\xfcs4\xe7\x87.p\x907\xb5\xc7s\x8b\x1e\x96;\xa5u\xeb>\xea\x10\xd0\xdfr3\x03\xf93\xf4\x919\x15\x99S6\xd1<\xf1w\xda\u0287\x19G\xde|\xd6V\xe2\u01660\xec'bDm3t\x06\xdb\xee\xf6\x1bDD\xa4\x81Cn\xe8\x1f\x9f\x00\x9e\xe4b u.G\x14\xb3Hj\xad+\x18./\xb1r\x89\x89\x1c\x82\xd8\xea}\rS\xb7\xb9\x00\x9d\x8b\xe1`|u\x81\xba9\xcd\xe7[\xc1\x94`\xf0:\xeb\xef|7\"h\u078c=\xd9\f\xbb\xd3\x14Gg\x8e8\xfc\xe3~S\xa2\x1b<u;n?6\x97)}\f\xff\xb8\x1f\x17s\xf0\xa1\x0e\x90\xd82D\xd4\xd8\xcd'aI\xd9\xf8\xcd8=\x0f\v\xb7\xed\xa4\xc5p1q\u0223e\x889\x94^\ry\xf9\xd6\x04#\x81\xd3\xday\xf4\x12\xa5\x93V\"i\x8cr~\x81\x06\x12r3\xf3\xddB\x05\x12\xc1&j\xa4\xe6G\xa4\xdcT\xe2}\r\xee\x9eNY\\xj~(\x16Y(\xf1^+\b:`,<\x02#\xa3\xfc\x90)\xe6\x032\xdc\xc4\xfaj\xf7\x94U\xf21\xa98.Z\xdeY}\u01f1:\xc1\xb1+)\u008dx\x1cVS\x8e\xf1!~\xa7\x91\x035\xb6\xb1W\xcbQl$#`7Pl\nY\xbf\x98L\x83\u02e1\xf3\xbd\x91l\xa57\xf2\x05\xfec\x92\xdc\x17$7\xcb\xfdd\v\x03\xe1~^x\x86QK\xf1}\xee\xf3\xa0mw\u07457L<\x13\x89\xbf\xe5.G\x8b*\xfd\xa1=\x81\x12\xab\xd8\xc6\x1e\xc8\x17!\x9eM4\xb0=\x8c\x7f\xc1<\x11\xc8]V\t\xaf|\x90\u0492\xc3R\xaa5\xe8t\x98\xdf\x0e\xa6\x81\xea\u0730\xf0\u036a1\xbbd\xb0S\xd5F\x9a\x91\x9d\u158dVV\xc5\xeb\xe4\xab7\xd84\xeb\xa2K\xcd1L\xbb-\xea\xb1U\x89Y\x1d\xe6\x8fG\xae\xe7\x81\xce\r\x05\x83!\xe9\xe8\x8c\xf0\x10\xa4\x87\xa1\xabO\xf2b8]\x10R\u01a0(KY\x98\x86OA\xe0\x87\xd6\x14\xb0C\xbf\x1a0\x1a\xc7T7m\x18\u00da|F\x94sfK\ue82d\xc0\x0e\xe402f\xf87\xd5D%1\r\v\xdd\xc8\x17*E\xd4\xe1-\xa8\xa4j\xfb\xe2P5x\xdb\x06K\u05a4>\x89\xe8\x04\x0e\xfb=q\xda\u0468\xa3\xac\xa7;\xd8M\xeek<_\x9c\xcd\xd4\xf1|\xfdh\x81>JL\u07ccAk\u0503\xd5`;){\x11\r\xc4\x00\xdbANx\xdb\x14\x05YP\xe5\xe22\xb3\x1f\x99\xc3F6:\x18,&A.\v\x87,\u0165\rv\x01\x89\xb0\x87\x8e\x8d\x91\u06ca\xef\xc0K\xdd\x0e]\xa3\xc4H!\xb2+O\xe0?\xe8~\xf6\xea\xc6.K\xbf\xd0*Sl\xd3\xf9\xb4\xe6*\u05d0!\xd7cN\x1dt'!\xa4~\xfa\xe1\xe6\xa1k v\n\xd6\x10W&=I\xbb-\nn\r\xd4b\v\xb9\xbb\xb1\xeeJ\xee_J\xcdy\x8al\xb7R\x19\x8c\x8e\x96\xd8\xc4\x1d?3\x1dE\x90\xc0\xfb\u0555\x8c\xb9\xeb\xdd.\x8fc<I\x9fE\u01c8\xe5\xd1h,\x03\xa1\xe2nS\xce,\xeb\x13\f,\xd0%.\xf9\x8b\xa9\xaaEy\x99\x96\xb3\x91\xcb\u06c4\x82\x96\xd3\xfc47\xdc+j\xe4Fc\x94\x02\x84\x88\xfb\xa2\xaeS\x9fy7\xces\xc4\xe5\x11\x9bv\x8c\u079a\x85\x97}\u073a\x8aY\x18\xfc\x81\xaa7\x1f\xb5=\xe7\x15\v\xa7\xfdA\xdd\xf2\xdcdFl\xf0\xa15\xd9\xe6y,\xb13\xedQL\x8c\xdc\xe4[\xfdq#\x998n\xb0\x9dV\x8e!\x00\u00c3\x1c\xf3o\xb3\xcd\nH\xa9\x02\xb8\x80\xba\x83\x0e/\x97\xe8MiA\x8d\x98\xa0Z\xe2\x7f\x11F\x91\x8d+\xd0\xceE\nR\xd1L\x90BO\x9c\x1cD\xdc\x03\u07a5\u04b0\xce\xcf+\xbc\b]e\xa9\xdbV-$\vM9\xa5G\xfck\xbehKsX\x83\xadO\xa4f\x8cR!`\x15\x9d\xd1\t\x13\x9d\xab\xda\xe5-,\x0f\vpd\xb3\x9dN\x91\u014e\x91\b\xac\xb6\xf3\xe3b\xb2\xae\xcf\xf0\x9a=\xf5\xd1\xc0\x02\x85\x80\xef\u0106\xbe\x12\x03;\x1aN\x14\tN\xd0V\xa9\x14[\xacx\xb5\x9d\xf6\xfc\r\xee\xa0\x0eu\xa1\u0666\xe8\xf7\xff\x9a\x04\xebT=\x8ff\x7f;J\x84\x94\x96\x16O\xe8\xe7\x9b\x1e\xa3D)BS-2\xc5u\u07c96\xc3T\x99\xedR\x0e#\xf0E\xd0\x1bt\xd4\xe7i-\x9a\x1e\x9a\xe9\x15e~\x06%\u04a1\x00NB%M\x00O\xa0\xac5\x17A\x90)$\x00\xb7qOahB\x96*)\xc3\xd7vv\xfd\xacS\xb0Z\xcd&\x12`<\r\xb9\x99\xa6\xe8.Z\x17\x9d\x99\xe6J-\xd0\xc24\x18{\xc9\xc8\xd2)\x14\xa9\xf9\u06f6p0\xbd1\x80\xe8%'\xbaI`\x12\xe9\xd6t\x12\x17z\xa1\u06ed\x8b\x19\x9fu\xeb\xa2v\x0e\x12#\xc3=I\x1f\xd3y\xbaX\xf5\xc9SSK\xa9\xc1\x7f6)pl=\xe1(D\xdd\x1a\xfdh\x0e\xe8\xb01|!\"L\u05edj\xfe6\xb5l\x91\x9c@+\xfb\xfe\xb6{\x13\xa7\xaa\u05bd\x89.yt\x85T\x12\xd2\x7f\xde\x02\a\xcc\xd0q\x80\x86\x9b\x04\xc7\xf8\xa58\u0211LYI7n%?7P;6]\x95\x8f\x13\x9fq4o\xe5\x9a\xf3<k\x9eg\x14\u05b6-\u00a7y\xcb<\xcb\xf1\x7f\xb5\xab\u02df\xc3.\x87\xf1\x95\xef\x01\xb7(\r].\x84\xed\v\xbe\x8dj\u0522w%\x99N\x88\xe7\u0479u&\x16\xb4\xcay\xe3\u018a)\x14\x1d\xe8c\xa6\x99\xe6\x00\xca\x10\xee\xb9l~\x9aT\x85/\x00\xf1S\x8cY<\xc7\xf0\xfc$\x85\xe2\xcc\xe7e\xb1,6\xd5\xfcj\x88\x9fp15B\x0f7\xafVk\x90^/\xf3%:\xc8/)\xabT\xca,\xe3+\xaeB\u0134H\xe7Y5\x15\x84\xb9T\xcaPP\xd7\xdb\xc8\xc1+\xa8\xf4\xbe\xbeZl\xbc\xc7|l\xd3\x1b\xa2pr\x05u\xee\xa1\"0\xff|\r\xb1\x1c\xd5X\xcb*\x82Y\x0e\xc0j\xb8\x0e\xe2i\xb2Y\u07f1X>\\H\xba\x8c-G\xae\xb5t\xa8+RE\xeaU\xb1\x81\a\u06aa}l\xc1+\xe0\xa1\x0f\xbf\x88\xab`\x11]j\x1e\xc86B\x98(\xbc>\xcf\x0e\xeea\x16\x11\xdf\xf8\u03e0\a\xa7\xa1\xb8<vT\x9a\x82|j\xa7\xa0\xb3\x86\xe7\xe68d\xdb{\xa5\\\xc8\xd0\u062cp\xea\x9b\v\xdd\u0439\x8c\x1dH\xd0\xcf\xf6oJn\b\xf1\x02\xb6\xa3\x05\x04\xae\xed\bqV\xf6\xcbk\xd0c\xa55\xba\xeb\u0424k\xa0\x91.\xeb\x80\x06\xf8J\x14\xd0`\x98\xdc\xddk\x97\xfd6+\x8c\u01af[=c\xd0s\x9d\x94\u07c5\xdf\xc36?5\xbe\xd4h\x8d\xd1\xfc\x99^\x85\xb5\u93f4]\xb9}\x82h\x19\xf9\a\x98b\xa8\xe6\xabI\x8a\x8f\xc6\xcdI\xdc@\xa6)\n\xea\xb0\xe9\x9a\x11\x8d/\xf9C\\WI\xf6Y\xc7g7\u0475Z\x12u%\u067f\u045e\x01Z\x97\xbeohlr-\x7fo\xcf\x10#\xd7Qc\xf6\xa9]\x96\xa1\x9b\x97\x97\xabQ\xb7\xcc\x11\by\v\x9d`\x9aL\x9cNHz\xd1\xc0\xfd\x9cq\x14\"\xe1\x81p\u0212\x1d2G\x8e\xf7\xb7\xd8\xff\xf8\xfe\x8a\x99\xb1\xe0o\x88B\\\x92Eo\t\xbeo\xb4Wa\xae\x81i\xfc\x8cx\xa9\xea+\x05\ayK\u017a\xa8\xaf\x81&q]\xf2\r\xb3g\xb6\x90\xaf\xe7-\xbco\xc8!\xc6Ky\xe6G\xbb\xa5\xe2\u054d\x1f\xbc\x1bojXQ\x9d\xb3\bj\xd8Ry\xa5\x92\xc9\xd9\xe0OI5\x8b\x14\xb2\xa1@\x11ZV\x9bE\xc6\xe8{0M.\xab\x92\xaf][\xb8\x8f\x92\x87\x05\x18R\xac\xe2pX\x11&\xdd\x1a\x8a\x98\xe7\x19\vN\x97\x981\x9a/\x85\xc2\\S\x01\xa9\x8d5\x90\xd3h\xd4%J^\xc1\x1a\u075c:\xd7m=t\u07bau\x8c2\xd11dD}a\xb7\xd3\xdf\u0791\xc6\x03\x831\xb8W\xef\xbb\xf0\xb4\xc4\xf5\xc9\xff\x18\x91\xeb\xdaL\x02L\x8f\xb8\xd0w\x9a\xf0\xec8\x98V\xf5\xf0\nc+\xf74\\\x93YK\x06\xd7\x01\xe0\x1eXV\x0eP\x86\x03\xb8\xe7\xed\x16i\x17I0\xb0\x06\xa6w[\xde\xf8\u75a2\x05\x1a\xb9I\xafU\xdc\x0eq[\xbd\xf3\xcf\rA\x9euP\xa7\x9a\x9d\xc2Bw\xd3\x00A\x90\x1d\xba\x96\x892<\xfb_\xb8\x93\xb6\x81\u8586\xfe\xf7\xc0\u0367;\xdaf+\u0105\xec\u0104\xff\x1e<\xaf\x96\xa4\xf4E\x98^\xcc\"\xd5=of\xd8\x06\xc9\xd0\u0460\xd5!i\x99\v\xf4R\xdctQf\x9c\xa0\x04\x97Z\x98\xe5W\xb5\x16\xf0!\x16'\xaa\x05xq(\xab\xce\\a\x84\xfa/\x05\f#\xce\x1d?\xf5\x14T-:\xb8\xe0a\xc90\xff^\xeea\x17\xdb'\x05^mOl~A\xf8\x16\u0563\xebN^C\xfd\v\x13\x04\xf3\xe54\x9feN\x8b\xe1\xfcF\xb4\xe2,\x8b\x91\xfd\xb4\xc7\v`\xd8\xf9\xf3\xab\xe4l\x03\x19\n\x00\x9b \x89\xb1F/\n\xc9\xd5V\r3J\x9c\x91\xfe\x19\xbd\x99\x82\xdb\u033e\x8c;\x18\xb6]\xe5\xe4\x00^y\x9d)cMx9\xca\a\xf8\x9e-\x94\xe0>\x8a!\xa7e\xeb'v\xeb\x8f`\xa6\xfdZ\x05{G\f#\\\x8b\xde p\xdb\xeb\xd6\x1e\u0697\x1bZs\x94\xe6\xb5\x16\xf1M\xec8\u0306\x86\xaf9\u0306I\xfb9\u066e\\\x1f\xdb\x01'Y\xa0p\xa3\x8e\x8e\x00\xd1\x10\xb6\x8c&\x82\f\xb2Y7\xb3\x1c\xf8\x15\x96PJ\x8d\xe2\r\xa1\x8b\x00\xec[eF\xe6\u061a\vo\xfa}\x98\xf9Y\f\x8a,t\xd9o\x8a\x91\x9b\xf8\xb3M\x0e\x9b\x80\xf4\xce\xea\xeb<hR\x8b\xdbU_\xd4W;\x8c\x84^\xd4+O\x1f\u026a[%\xf7\xde\u079e\x8d.\x855<\xfe\x8fM6\x9f\x9e\xf3\x10\xde[\xfe3)\xe0\xe4\xe3\xfa\"6r\xb16\xb7\u0314\x8a\v\xc0w\xbe\xc1*\xd2R\x8d\xa3{/?\x80\x96\xdf\a\xd5>\xabr\xda\x1bxgL\xbd\n;\xef\xc5\xc8`\x9fY0\xfcm\xa6\x84\xc4!\xcf\u01c7m%\x0fU\x90}\x98|\xb3\xb7W?^\x1dZ\xf2-'\xb3\xac\xfa\xb0.V?\xaa\xb5\x04\xfa{\xefB\x89\\\xfd\x14\u00cb\x9fP\x19r\x1d<\xb4\xb4\b\xa1\xb8!\xf5\x05\xd1mC\x8d\xfa\xf7\\~\x95\u07f3\x10\xac\xc7\x04L`\xf4\xa7u\x89)\xdde\x9a\xf3\x1d\x06\xd62#\x9aA\f\xe9\x1f\xf0##\xfc/\xa7\xf3\u0708\xe7\xfeAa\xe2\x9c\x17\x98\x10\xe6u\r\xd5\xd4\x0e\x92O\aM(\x91\xca\xc0\x9fL\xf2\xb5R\x17\xf5\x13\xbc\x13\x8d\xfa\x90\x95\x88j\xe2p\xdd\xe2\xd8_R\x97\xd4UA\x051\x15o\x93\f\xac\x82\xa1\xf3\xa0\x96,\x95h\xe0)\x12q\xb1\x90^\xb52\xccDC\xb4\xab0\x8e\xba\aB&#\xa9\t\x98\xb3pz\xba\xedz+7r\xb3\xe95\x18\x12\x1e)\xe6g-;\xddz/\x9c\x89\xa2\u02ddW\xe8\xd7\xed\x8d\xd7 \x1d\xd7SKdC9\xc3 \xb2\xa1\xfa\toh\xf61\xaf\b\xa1\aD\x0f\x1f\xb7\u008btb\xd3,f8R\xf8\t\u02fda|;\xfar\xb0\u0694\xb7\x87\xf2kb3\xb2*\xaadu\xe5\x8f\xe1\xf3\xb7L\xcdr\xf7-{j\xb1r;mY\xae_\xe7-\x8bl\t\xa0\xd8@U\x1b\x84\xb1\x11\ub83f7\xd1W,$\x1c\xd8\x02\x016\xe74\xf3\xe0\x9eQ\xcb\xe7z\x00\\\x19\xac\"X&\x88\x9f\x1a:\a\x1c!J\xd8b`\xf8\x16\xbc\x02\xedqP\x13\xc0M\x18>\x03\xd7\xf6\xa4\xc8\xe7\x15\x19\xc5/Q\xb8\xbc\xe4\u04b0\xb0\xbbE\xc4I\u0312l\xf6\xe5\x05\xc7\au\f\xa2.\xfb\x92\xc6>k\u079f\xd0 \xe6oM\xc4\\\x16\xf2Ba{\x04\xec1\x0f\xc2\xdc\u05a4\xb0+\xae\u5947S\x851.\x0e\xe7\x9f\x1a\x1f\x1e\x10\xb5.\xeb\x9aA\u050e\x10\x9d\x8bJ\u00e9Z\xd4x\xd4\f\xe7\x85R\x94T\u0703\x91=\xa2\am\xb9\xc39\v\x96e\xf7\xb3\xe6,_\x9d\xf6\xf4R\xbf\u07bc\x97\xac9\x8cv\xdfS@Z\xff\x9cMU\x9b\xa1\u0367\x1dw\u0506\xa1 <\xddg\xf2\xc0\x86E\xd8}\x8f^\x85F\xca]\xb4\xb77\xdbvlN\xf2m\xb6\xbe\xcc2\xc1\x99\xc9\x17P\xd4\n\xc9\x18\xa2j\x11M\x87h[\x9b\xb2\xdd3}$\x91\xd7\x06_9(F\xbd\x11r\x80\xa4\xbf\u06bb\x82Z}i4l\x04\xee\xa1!\xb0\xe70\xc9(V\xb3hH\x9d\x93\xcf\x1f\xa7\xd3si[ \u1e02\xa4\xe1\xac\rQ\x87\xd7\xdfv\x7fUv\xdf\xed\a\xf2}\xcb\x05\xb8\x1b\xfe\x86l\xbc\xf8h\xec\b\x8f\xf9\xf9~\u008a*\xee\u00f1*\x99T3\x83\u05f0:\xbf\xfa\xeaF\x1b\xa4\xe7\xdb=U\x0f\xe9fk\xd9%\x95g\xfc\xd4c\xa7\x9c\u03025\xb0+\xae\xe7r\t\xff\x0f\xf2\xc5.S\xa8\x04\xbeqE\xec\xcc+\x8b\xf4JZ\x9a\x80,\xc6\xe5\x9f\xc7Vo\xe8Z\x05\xaa\xb9\xc0\x9b\u032f\xb9\xde\x00T\x19\x8a\x16\x1b0\x0fZ\xabD\xd5\xf3\xe2\u04f9\x999\x82\u7f0f\xa7>hD\x15|\x99\x1c[\xf5\xb7\xcfC\x87\x97\xb6_\\-\xa7\xe4\xb9s\xd9\xe0\x91\xd7\xf2\xb0dd\x87\x84\x9a\xa06\xa5\x19I\xbf-\xecm4\x99Ce\xeb\u0215\xe1=W\f\xc7+\n\x8d\x0f%\x98\u013ct\x91\x03\x92\xa0\xc7zPL\x93\a\xce\xdf\xcbA\xe0\u0602\xf4\xfao\xae\xf4\x1a\xca\u0624R\x99\xdb\x06\xe5GxS\xcaP\xe5\xa7R\xf4\x89\xd0\xec!1'7\xcaRE\x88]~\xc5m'\x16\xc27f\u0606\x9f|0cb\x87\xfegK\x06\xb5\x95\u071d\x13\xd1f>\xc4\x16\xba\xdc8S\xef}\xbek\xa4\xa6(\x8dPJ)\xb9\xb0\x05\xf5\x91\x1c\x11tB\x89\u0462\xe5\xf5\x83\x9a\xd9!\xfa^\xdd\xf0\x10\x8c\xf8'\"\x83A\xc4\x11\xc1\x8f\xfa\x10\x06\xd2J\xb1BJ\xcd4+o4Qm\x16\xa3S\xa0`1\xf6})\x92\xd0C\xbd.Q\xf0\xba\xec@\x16\xee\x8b\x18a\xd4\u072e\xad\x04\xb2+\x89t$\x12\xf1\xaf5\x98;\x8bU:\xcd\xd7p\x15\xf4\xf6z\u0458 \xa2\x9d\xc6b&\xdb\u06fd\xdb;h#To\x11\xb6,U\x80l\xe6&V,\u0579~\x1fAm\xfd\a\xd8\x03\xdfH\xc6qmx\xfb\u00f1\t\xd86\x88\xa9b(T\xe5\x9e\xc3D \x040\x14\x85\x19\x81\xfeS\xf6\x18\xb5\x11|}3\xe38OkW\xc68Vh:,t\xec'ko\xf9\xf2\xa1\xf7R_u58\bA\x1a\"\ud102\x8d\xad\xfa\xb4\x03B\xadn\xfc\xfb`\xd4Jn;\xb2J\x95W\xf8]\x00c\u0413j8\x1a\xec|\x8e\xa5\x8a\xbd\xfd4\x8aq:n;\x81\x94\xf2>\xaa\xad\x915\xc6\xf8N\xf5\xde\xeac\xaf=v\xaf\x81G\xf92m}\x1c\x82\x17sx\b^\xbde\xd6SK\xf0*\x1b\xc9c\u03c7#\xfa\xe6)\xb2t\xa3\xc0\x9c\xe7\xb3Yf\x8bD/\n\xc0\x9b\xaaae\xb7\xf4\x9d\xf4z<\xa1\x1b[\x16\xac\xb6^\xbc\xe0\x18\b\xb8z\x8eQ)5\xa2h_\u072fkT1\xd2G\xc0U\x16\x93=h\x18\xe0\x9cb\x83\xb6tJ\x9e\xe8\xafo\xec\x80\x14I\xfdF;\xf6|,\xeb|=\xcfz\xc3\xf6j\x050\x8f~\u03f4\xba5\xfcl{;\xc3d[C2\x87\xedm\rz\xd6w\xf5z5K9\x11\x1d*w\xafQ%I\xef\u07bdJV\x9b\x12DP[\x89\xd3q\xc8\xc3\xf6\"\xf5\xd6\xd5k?\x80J>\xf2\xc78\xaf\x8e\xccv\xa5\xab*\x9b\r\xea\xe9\u05a8L\u023bG0\"\u05ce/H=\x98\x01\xd03\x1bF\x11H\xb78\xad\xedZ\xbd8K\x80\x8dP\x9d\xa7+\x92\xea\x97\xda8;\x05\x7f\xe6\xcc\\6\xcb\n\x0e\xfaV4p\x1c\x00q\xb1\x06F\x8f\x1d\xc9\xd2Q\xe7\xc7\xf0S\xa0/k\x8a\xf3\xbdz\xa7\xe0\xc62\x1c\x03\x98\a\n_\x9a{<\x98\x1b}\xb6\"T \x80;/\xa6\x1f\xac\x94\b\n\r\xc0\x1bO\xa1\"\f\xf1\b\x19L0#5\xac\xf1\xc3g/\x8e\xfet\xa01Mi\x91\x0f\x1b\x8e$N\xa32\x97\xe7\xf4\xdcl=4a\xc5r@\xcdj\xeb\xe9\xf1\x83\xe7\xfb\xb6\x9e#\x9c\xees\t\x1b\xed\x99~\xfb\xa3\x11~<\x82\xdd\x01\x15p\xc4\xcah\xef\xc0\xfb\xa8\xee\xcb\xed\xad\xcbtY\x19\xf9\xd6\xecw\xf8\xb2!\x8a\xac\xa4\v\xf2\x98\xe7\xe5\xcaD\xf9oA\x1c\xa2\xbc\u04eb\n\xa3\xc3\xda\xc6&\xe6\xe6\xf9\xc0B\u04b6i\xbe\xfe\xf1\xd1\xe3W\u03de\xfe\xf8\xb8a\xae[x\x19\xe4\xa0`\x99I}?}\xb1\xb9\a\xf3\x82\xc2\x1bd\xfb\xa0\xe3e\x06\x80U\x86\x11\xde:\xc9>\xa6\x88\x8f#\x00\x02<\xb2-K\xa7\x97W\xaf\x1b\x87\xba\xfc&\x14\xa0H\x15\x7fz\xffe\xa8 2\x95\x1de\xcfZ\xb6y\\\u00b4i\x1b\xa6\xb9\xff\x9c\xa4\r\xd3M\xd7\xfc\x89.\"o,\xfb\xc1~\xf7%\xd2sTk\x87]bB\x1a\xb4\xae\u0584\t\xfbIS\x9a\xce1\xb0a3\x82s\x10Va?\xfe\x06\xfe\xd5\u02f4\\R\x19W\xbb\xaf\xfaw\xb4_'\vp\x82\x9fe\xf6G\xf8\x1a\xea\x05\u0694\x9f\xdc\b\xff`E4?\xe1\xd7\vs\tR\xb4\x19U\xf7(\x92\xbb{{\xff\f\xf1\xbcH\xb6x\x9f\x9fK\f\x9b\xc5-0\u06f7\xca\xca\xf9UW+\xc09\xfbOxxJ\xfd\xc79\xe6[\r\x00\xa6\x81\xffc\x86\xfb\x86\xa6\xf5\xbe\xc1\x00\x80\x8a=\xee\xe8\xdf\xdc\xcbx\xc9h\xed\x95U\xffFM5\xfc\xb6.\xb0\x18a\u00f4\xf0x\x9e\xc1\x9f\xfd\xde,\xbf\xe8\xe9\b\x90\xb0\x01\x16:\xa7U\x05\xe0\xe4\x90\xce`e\xac\x1e\x06\x06\xedC\x85\x91\u91c3\x9e\x92\xbej1[\xfb\xc9?\x9d\x9e\xde3\xff\xe7\xbfvZ,\xd7#\xe0j\xfb\xc9\u0708\xd4Y\xd0\b\xee\xe2\xa8Lg\xf9\xa6\xdaO\xbe[}\xf4\x9f\xb3\x11`?\xd9\x1b\xff\xeb7\xfe\xa3U:\x03\xc1\a\x1e\xdd\xcb\x16\xe6\x7f\xbf\xc1\xff\xb5\xff\xf6\xdf6R\xf8~\xecw\f\x14\xd8O\xee\xc2wA\xfb|`\xf6m\xa1Q\xff\xf9\xe82\x9b|\xc8\xd7#\x88\f\xc0\t\x8eR\x14\xd9\xf6\x13\xd0}\xe2\xef\x02\xa9\x8fH\xe0\x8b\xbe\xb6(\xfe\u05ad=x1\xd2\u0620\x8dN\xc6f\xc1\x1e_\x18\x8a\x80\x88\x9fl\x99\x95\xfd\x1e\xc6\xeb\x18\xd9\xdb\x12k\x16`\xdb\xd2\r\v\x9f\x8f\xa9&\xc9\xd1y>\xe7x'f\x0f\x01\xf0O\xadW\x98\xcf\x11\xe3\xc8Q\x8c\xees:e\xcf\u04e5\xf9\xdfr\u0335L^e\xec\u3bc4\xfc\u8e29\x06\xf9CQK\u079a\xd1U\xd9\xd3\u5ebfE\xb8\x80&\x9e\x98?\r\xaf\xf8\x1a\xf8\xc7\xe0\x9d\xb2<5\x9c\x06\xa0\xdb'\xe9\"\x9f['\x87\x1f\xfeh\xa8\xfa\x14\x1f\xf7\x1c:l\xcdf\x17?\xecjU\az\xb1\xcd9\xd5\u03f8\u0794[\xf1:\xd78\xf0kgm\xedM\a\u0375\xbcW\xdb\ub19ek\x97\x82\xa7\xdaC4\r\xa8\xe4\xa8r1\x8aN\xba\xc0PnPe\u0305\xa3\xef\x8a\xdagR\xa9\u05f0\xfa|IA\xc9\x17\x18r\x9bC\xc4\t\xf2\x92\x04\xb6\x01\x1c\xe3K\xc48B\u0419\v\x96\x11T\x99\x0e\u5ab0\x91\xc4\x1f\xb2\x8c\n\x8fHwr3M\xca<;\xc5\u02b0XE\x98\xa2S\x82.Q\x9b\xba2\xad\xda\xe6`\xe9zk\xe7\xe00B\x03\u4a70pIh8\xfe\xea\x9c\xe6e\x1d\vG\x80\xb7\x17\xd5\x19/\x8a\xe1\xc7X\xf5\u71d3\xe7\xcf\x06v\x90\xecB\x81qs*\rOc\xdcTk\x84\xefwl\xd5\xdf\x04\x8c\x16Hs\x88\xb0\x82\xa0^s\xf5\xa1>i^\xb6h\xb9\xaa\xfd\u0133\xb3\xdf\x1d\x7f\xc3A\xb4\x10\xb2\xfd2\xad*\x14\x1e\xf1\xe2\x14\xd8i\xfeR\x1a3g\xe4\n\x12\xb1\xa0/\u062b>\xa4L.\xd7\xf9\xdc\xd5f\xe4/\x06\x1d.\xdd\x17\xbc{\xea\xbe5k7\xd4S\x0e\xaf^n\xbd~\xed\xda3\xd8b$V\xdf\xee|\xed\xea\x8f\u06ee\xdc\xe0N\xbc\xfbMx)\xaa+\xf5\xe3\xc7Q\xe4V\xfdb\xb7f\xd7;p\u06fd&W%(m\u0720\x98\xf7\xef~\xb7\xb7\xa8\x92\xcc(Y\xa3|\xd9\ud5ab_\x99\xdb\xdb\x1d4mc\xe4VD\xa3#\xa8\x14\r7c\x06W\x01|b\x91\xfb\x0e\xec\x93\xca\b\x1a/\x8d\xf4\x99\x9e\xa5\xce\\\x84B4\xfb\xca\xf4]\x19\xa3\b\xad\u06b5\x87\xc8\x1f\xb44\u04e0+\xb6G\xf0\xb75\xb8\xebuXo\u01d7\x03\xcc)m\xebN;\x95\f\r;\xffO\xfd\f\xd7nSw\x97\xd6.P\xef\xec[\x95\u02fc\vb\x825\x18\x01\xc0\xc5<7m\u00af}\xc7\x16\u012b\xc0\xadl\xfb\xa6\xdeY\xd3l\xd1\x1e\xcd$\xd4\xe7\u0478\xcc_\u055d\x04*$w\x92{\xcaR\xd2\xd4.\x9b\x91m\x93\x92\xba\xa4[\xe4\xdf\x1a\xcd\u0724\xc0\x1f\v|\x01\x86[\xbc\xfc\xe8\x8f \xa6\xbaz\xfe\x04\xea\u03cf\xf9\xaf\xfb\xc9\xc2\xd7l#\xfa\x02;<\xac\xd7D\xae-n\xe7@\x7f\xd4}\xb7\xd0_\xef \xf2\xf2\x0e\xa9\x04\xd6\\|\xdaN\xb7\xf2\x7fmoz\x92Y\xedE\u02c7ZF\xab\x8d;]W\x80N\xa0|a\xd3C\xf8\x0f\xbd;\x90\xb6GY\x10J44r\xc1:S\xf5\x87\xae\u031f\v\xb3\xff\xf9jR\xa4\xe5,,\u047a\xe5\xda_akM\xb83\xf4\x19\xbe\xf3\xc4tx$\x9d\xf4\xfd\xbb\xda\x1f\xe0Q\xb1\x02\xa0G\x92\xbel\x1cl0L\x8b\xdcX\xac\xcd\xc5\xfbT\xea,\xa2Y\x83\xee'\x88;\x87\x90\xac\xb0`\xf8\x10\x84H6D\x01\xd1\xd7\xd18E\xee3\xff\xe5@d\x19\xc9\xd4\fm[j\xa5y\x85\x00\\O\n;_\xdf\x02Q\x06\xe6)\u037b)\xbd~d\xe79\x82\x9c\x91i\xd6\x1b\x10U*\xea&\xe6\xe0\xa4.\x97\xfb2\xf4\xd2M`9EU\u00dc\x18\x95OD\t\x9bf\xc0\u0166\x9cf[e(3\xd0\x1e\u00ce\xc97\xc1Eb&\x17<o\x12\xad\xe2\xd2\n\xb4\xa6D\x8a\x88\xd0\x11\xbe\xd1*\x14\x91\xa1a\xf4\xfb\xdf\x1b\u01a8\x98\xbe\x9b\u0918]y\x17\x93\x1b\xb9\x97\xfc\xd5\xdd\x19\x85\xb1x\xcb\xe99\xf9+(\u024b\x9dQ\xeeg\xff\xc5\x17\x12\xe8\x17\xbeJ\x0f\xe4et\xaa\xd4\x1a\xb5\xbfz\xafE\x9aT\xbf\x93\xfb\xc4>\xa1\x7f=\x98\xcfq\t\fs\xab\xad\x02\xd1\x13\xfe*_)\uab9ffr\xf7=}\x8c\xd1jXAb\xb3Z\x01n\x90\xeb\xd4l\xa3Y\xf4\xb1\xd4GJ\x97\x95\x03\x1a\xb2oQ;T\x84\x82Y\x8a\u0645\xa7\x8f\u01e1\u05cf\x9b\xb3\xb5Z\xec\xefSv\xff\xf5\xdd\xe2\x0f\xbde\x97\xca-AK}\xbb\xaeC\xbd\xa2NdT$\xdep!x\x8bX\x03\x06\xab\xd4L!\xae\xdbt\x8bhi\xa8\xb1\x99\xb9-\v\xd27\xb1\x902\xbdT\x03\x0f#\xc6\xf4+|\xf2i+J\x98\xdb9:\x881\xb7aH\xe8~\xe6(?<\xf0\x89\xe7j9U%yZ\\\xaf<j\xba\xf2\x98D\x8e9\xbd\x01\xa9\x95S\xc1T=\xb5Iv\x96/\x97\x14\xbaH\xb0\x05T9\x90]\x84\xe6\xdb\b\xa1\xab\xdf\xe5L,\xc3S\x83\xef\u0429\xe1\x81\xc3+X\xff\xf1G\xc8{\xb9i.\xda?\x8f^\xbdx\u04cb\x04\xfc\xdaU\xb2\xd4M\xb3\x80\x9c\x8a\xe4\xe3\b|\xecK$\x9c5\x87w\x82\xd9\x1cS\xa2\xb8\xd8y\xb1\u02280y\xbe\xac\xc4j\x8f\xdfA\xc9\xf4\xd9\fs\x9d\xc2\xf2r6Q\x00\\;fE*i\xcdUIWk9\xbe\xe1p(\xbc\x89\x81C\xf7\x9f\x80\xb0z\xe0(\xc7g\x8a|\xbd\u05ce_>\xf8\xb1\x17B\x87,9\x88~-\xf6\x10\xfa\x01!\x88\x80\xd3\xcf\x00\xa2_\xa2h\x00\xe1E\xb07\xcd\xd2,\x15\xae\a\xefH0\x00\x0f\xed\x81b\xa8i\xfc2\xfbc\x9a\xbc\x82\xd3\xd0\xed\xf8/9\u01da\xa3\x93\xdb\xce\r\xddP\xf8\x13\xfe\x15V\xfe\x82\xa2R\x98\xb2\xd1@\xa6*\x9fC\x13\xa8\xf9\u0652\xe7\xb6z\xa3\x8a\xff,gd\x1d\x1c\xc5b+\xbc\xf7\x14O\xaaQ87\xf3E\xe8\x1b\xe7\xf7\x9bR\xb7\xcblj$\xef\xcc\xee\xc0\x7f7\xe2\x063[+a\xab\x17\xacm\xc3\xd2\xd6\xf5H\x1a\x91\xab.\x14\f0\x04\xdfA\v\xfd\x80I\x9a\xdfm\x16@{\x04\x92G{\xfa3,\x04~\xe0\xb4\x02\xf0:\\N\xc7\xd5fB\x17X\xbf\xbc\x18\xeaS:\xb4o\xacI\xc35/\x00\xf8\x8d\xa6\xf8P_\xf0 \xde-\x017(\x0fL\xbbTC\f\x92\xdd\u0417\x9dR\xca*\x88)\xb3\x8c\xad\xb7\xdb\x04\xfd\x884\xd4\x10zI\x97\xae\xac\xb6w\x19\xbb(&|\xeb\xa6V\xa9)\xa8 \xa6S\xe0\u02fc\x12\x8d\x83\xf4\x8d#1\xc4\x04\xa5A\xf4\x9bPzz\x1f\x83p0?M\xc3+\x1bsQ|0\xe7dr\x15F\xa7\xfc)\xbb\xa2\u5e64$\u055fN\x92\x0f\x99\u0657\u04bc\x9f`I\xf0\xb5/\xe4\u05151`\x0f'\x9c\x03N\x7f\x95\x19\x95\x1b_\x8b\xf7\xda69\x84c\xfb\xfa\xe4\xc9\xe8\xee\xb7[\xf6\xb1X\xfet\xf2';\x12_Q\xb3'R\xa7\x18\x19V\xf5bi\xbfx?h\x00\u06a8\xc1\x18\xaa\x93\xe6`\f-D}1\xb6c\a\rOh\xe5\x03/\x1b\xfc\x03\r\xa3\xf0\xd0Z\x99\xa2O\x95YA\x9a\xf6\xe6\xd8\xf7?\u0356P\xdd]f\xebo\xe7\xb3\x14J\x05\x9a\xabnS\u0389\x0fbvv:i\xda%x\xef\xf5\xabgp\xf0\xe6\xf8m\xed\xab\xb6\x9d0j\xd8\xeb\u0483\xf60\xed\xb9\r \x90\x831\x84\xa2,0K\xc3\xfba\u0311\n\xeaB{b\xe4\xe9#z\xfb\xe2\x1e\xb8\xb0\x8cj\xac*\xafm*\n\xf4N\x1e\xbc|\x8a\x11G\x1c\xa7\x00\xd5\n\x97\xdcxE<\xdd\xef\x02Gz\x92N\xfa\xbf\xf4\xcc\x00{\xfb0\xedO\xf5\x18u,\x1c\x94\x830\xcd\x03\x85\xcf`J\u00e4\xf7~2O\x97\x1f\xc4#a\x9e\x93~f\xab\x96\xd9-x\xb1\xe2\x84G\xab*\x98\x06:,\xe41\xbfn\x16\xb4)Hp]\xb6q\xa4\x1bJ& \xcb\u02b2p\xacu\x88\x18\x14\xe0y\xcb>\xae\xe0?x\u5cfb\xef*AW6\x05\x00\x92+\xb6L\xc4R\x18\xe0\xdc` &\xb5\xe14\xe9V-[4\xb6\xad\u00d7\t\xe0`0\xe8e\x99dT\x1c\x14\x8a\xe9\f\xf9>\x1a[iB\x0f\xb3Vt]$\xc1\xe76\xbf\n\b\x1d2\xb7 \xd3L\xfcu\xb0\xf4\x14w#-J@\xfb\xf7\u027d\xbd\x7f\xf9\x0elr\xf0ce\xae\x9e\xe9y\xff\xce\u06df\xab\x9f\xdf\xfe\xfc\xae?\xf8\xe5\xd3\xfd\xefo\xf5~\xfe\xf9/\xff\xfe\xee\xce\x00\xeb\xe3\xd5l\xaaND{\xfd\xea\xa9\xe9\x19D3Re\x01i\x9b\xacZH\xba!h\x06\xaa\xb4\x15%\x8eB+o2[S\xee2\xbd\x02\xd1\xf5\u00d2\xa4/\xbcF9\x18\x0fb\xad\x16)\x84{%i\x85X\x80\xe7\xeb\xf5J\u03cc'\xd1\xfb\xcb\xdbt\xf4\xb7\a\xa3\xff\xf3\x8e\xff\xbb7\xfa\xfd\xed\xf1\xe8\xdd\xd7\xfbw\xee\x18\x19\xeb\xbeW\x9dU\xfaF\xb0\x80|\x9d\xcd\xf3\n \xd1N\r\x87@\x026\n;[\x02 \xc8\x05\xd0\x0e\xcc\xfc\xf25 \b\x12\xe4\xe4\u018a\x86K\xa4\xb7\rC\xa0\u0739c\xe4\xcbg\xb9\u065cE\x9a\xcf\xd7\\\xeb\xd5\x06\x89\xc2pW\xf3|\xdd\xef\xed\xf7\x86F\x1ey\xbb\xf7Ne\x89@8e\x8f\xbe\xeb9$P\x1bn\x17\t\x1d\x14\x02\xec\xc1\xa2\xc0D\xa1B\u00ba<\x88}\xec\xa7J2\x9bCC\xe0\x01\x9ct\x17d<\xf3,\x95\x00\xb6\x87s\xe6\xbf\x19\x96\x8e\xd8\x14\xae\b\x02\xbf\xc1\x02\xa0\x03\fW\x88a7\x97\xe0\u0485\x92M\t\x89A\xc5\xf29\xbc\xd8\x1f\u013c\xfc\xdb;\x82\u0483)\x1bR\xbd\xba\x00\x98\xb0\xe2\xe2\bm1j5\xac\xf0\xae\xc0\x8b\xca0J.\x94i\xdf#?\xf5r6\u03f6\xde\xd88\x17\x8f\xad\xa9\x98.P\x04\x8biVU\xd9\xec\xe1\x95|\xfe\x036\\\xbe\xf7)\x110d*\x90\xfd 7\x97\x06A#(\x05O\xc3&\xed\f\x05\x95\x14\xfe\xabk\xa3Qc\x02\x87\xca\xe04\x18\x14m.\x8a$y\xae\xf7\a\u9e98\x9aO\xa5y\x0e\xc5t\r\xf9\r\b\xa4\x00\x9cA\x8c\xc0\xa8\x0fk\x02\xf5\x84\xe0\a`\a\x97)\xae\xa34\xc6\v\x81\x15A\x93\xf5e>e\x15\xe5\xce\x1d\xb5\b\xd3\x14\xbe\x84\u0984=\xa9\xa6\xcd\tj\x1b\x86\xabMS:`\x045G\x19\xa1\t\xeau\x94\xd9^\x01\x83\x90\xd6`\x1c\x99\xe1\x1f\x12\xe5O\xad\x15\x93\xbf\x02?\xe10TB\x90\x03\u0082p\t\xb3\xfa\xe9,Z\x96\x195\x94\f\xac\x86\xb8\x84\x8fi\x05\x0fmh@v\x9a\xa5\xf4\xe8\x15\xbeU\xbd\x0fRb.\xd6\xe3\x85{l\xf3\xba\xcd\xcf\xcf_\xbc>~\xfc\xfe\xd5\xe3\x97/^\x9d\xbc\x7f\xf4\xf4\xf8\xc1\xc3g\x8f\x1f\u045d\xd1J<\x16j\x9b\xd8\xe8\x8b%\xc5#c\u0267;\x9c\x11\x81\x19\xc63\xd9&\xff\x18$`.wG\xee0\xb1!S}\xa8h\f\x0e\xcb\x7f\x83\x1c\x95\x0e\xa90\x83\xe4N\x9b2\xd6)Af \x85/\u0770,$\xa6\x1d\x99\f\xec\xcf\xed\x1dn\xef\x931Lo+$I\xd3\xef\u054a\xf4q\xe7\xe5\a\xc1\xae6\xa0\xef\x9b Q\xedi~.\r\x84U\x8aK\x95\xb2\xb5s\x8aUr\xb3F\x82u\x83\x89C\xe9\xb0Ib \x10!\xd4-D\v\x19\x05\x05\x83x<V-\xd0,\xd4\xd29\x94\\6'|h!\x92\xf9$\xbb\xb0\xde0I\v\xf5(Kc\u0490\x1b\v\xc5^\x15+\x01\xe3\x85\x18\xab*\xda\x12Z`\x10\x1e\xe84\x031\u079ef8\xb0P\x9cxN\xea\xabS\xf0\xad\xc4\xe4\x13\xf4(\xb9\v\x9b\xb9-\x01\xc9\x1e\xd3\b\xe5uhB\x97{\u9583\x86\xe9o|\x15\a\xf1y;\xe4\xcdu\xcevS\x17~#\x95\xebX\xa7\f\xc0.\x8cz\x06\xb2a3\xbd\t\xc5\x19\xed\x97\b\x89\xde\xe4`n3\x06Wq\x05\x185\x01\x82\"\x934\xec\b\xb6\u04b5b\xba\x1b\u06610\xc99nEW\x8e\xc3,!\n\b6\xdfV\xfc\xabsa]\x8f\xc0\xa5\xaa[\x01\xfd1\x01\x88\xf7m\x04N\xa05\x11k\xb5\xb9\xe5x\xa5\x9c\xc2\x15}\xb94\xd7\xf2ynQ\xdch\xb4\x16\x17\xae\u00f80\x8e\xdc\x1bX\x93\x8ea\xfdF'\xc5\xe3\xe5\u0305\x145\xce\x06\x9bV\x91G\xf1\x98$\x8f.\x9a\xb7:\xa0\x9a\xd9dN\xa1\xc1\x16\x99\x00\fB/X\xc5\v\xc8\xf3sT*mn\xea\xe4\xe7S\x06\xcd`\xccn\xc07!60?E\x027\x7f\u0085\xb2.\xe7L\xee\xd9x\x91\xadS\xf3\xc7\xc0#\xf3G\u0664\xd8`Is\xe0\\$E8\xb8Z^\x0e\xbeV\x138\x14\x10\xfe\u0260\x88\xb3bcv\x04\xdfP\x14/V\t\u050fr#6\xb1]\x00\x89\xfd4/3\xd2\x12\xe9,H\x0fV\xb8B\x0f\xa4k\r\x15\x18Z\xe0l\x16\xd8\u0339\x92#\xe1uATi\xa2\a\xdb!+\x9d\xd5\x03\x7fKj\x8f\xfdH\x17\xabWh\xad_\x83anM\xd3t\xff\xf7\x8d\x8d&\x89\xe2\xa6o\xe5h\xf4J\x9f+f\xc3\x01\x04Y\xe3\b\x16\x81BO\xf0~7\v\xbb\x06?\xe3ar/\xb9\xf35#\x04\xf2\x8f_\x1b\x05\xf8\xd7_\u0550\xf5\xeb\xae]l\xed!>\xd0\x01>..\r\xe3N\xfa\x03\x1d\xcf\x03\xa8\xf6\x85a\u065c\xf1\xd2\xef\x1da 2\xa2\xd4\xe2\xe0\x16\xe9r\x93\xce\xe7W\u024c\x92Q.\xb3\t\x00\xd6a\x95v\x10\x11z\x83\x03\x1f\xe7\xbceY6\xab^8\u067d\xe8\x11\xd67\xe2\xcdv\xbe\xa4\xbd\xaa\xc1\xbdt\xddS[\x1b7\xb87zt:k\x13\x1a\xe8\xb1*\x89\xef!\xe9+t-f\u02f3\xf4L\x0f\x10\x8e\xb4a\xe6\xf8\xb3\x12\xceF\xa2\xe5\x90\x01\x1eJ\r\x10o\xb7b\xd2\xf8F\xa7\x9e\xa2\xbc=\xf2\xbaN8\xefQX\x88\xb7\x1c\xe0\xe8[l\u683e\xa4%\x88*\x1f\f\x9b\x02\x13s\x95\x81p\x97\u0692F\xe7Y6\xf7\x86\x18\x18\x88\xdf\xc0\v\x0f\xa0\t0\xbb\xbe\xaf\xf3A\x7f\r\xad1\x16\x8b%\x10\x1c+'\x96Y\x98\u067cz\xa9\xa1\xaf\xfa\x03\xff\xc0\xa9\xbd\xc2\xd1\xf5\xf4\x99\xe0\x9a\xd9\xeb4\xea\xd8w#~\x04\xef\xf43\x15\xb9\x06_b\x89]\x8b\xe8^\x991\xac\x9f@\xb9\x82G9\xa4\x00\xf4=\u0782P\xfa\xe9\xa4\xeacw\x83aGM\xc4Vo\u0c668\xd4\xde\xcf\x1f\xefN^\x80e\x85\x9a\x03SR\xf2\x87\xa4\xf7\xb0\x97\xec'\xbd\a=5N\xb1t\x83\xac\xcd\xf5\xb3\xa1\x11Hg1\x82@\x1f\xa70\xd0\xdd4\x87\r\x7frW5\xc9%\x86?\xd9\xed\x8d\xdc\xd9_\u07e9\u016dw9\x13\x1d\x18)+6\x17\xd13\x83\x8eQ\xcc\u0541\xa6\x94\xc6`\x93)\xe8\x03\x18\xafn\x0f\xa5}\v\xc4;\xeez\x98\x03\xb1\xae\xdb\x19\xf3\xd4\xdao\x06A:\xf1\xb66$`\u05a9\xa0\x91F\x94@\x1f\xe5c\xc1j\xbe8\x17}H\xc5\x1c\xcd\xca\xf4l$G;u\xc2t\xf2\xe0\xc9\xc9\xe3WJ\xd8DyY7gt\xcd\xcb\xf3|zN\x16D\xc2N-\xc0\xf7A\u0225\x8d\x1c/X\xf6]\xc5\xd0.\xe4\xab\xc1t\xc8\xf6\xa7\x02\xde[\xae\xab\x9d\xef\x1f\xc4\x13A\xb3\a\x89k\xc52\xe1\xf6`yxap]\x01l\xb4(\xd3\x12\xe2\xd6=\xd5\x04|\xaf\x11\xd5\x04@\xa6\xa0\xbe\u00ac\xa0\x96\xad\xca\xeb\xc4-\x10\x0f\u0264_\xe0^jK\x14Z\xc4\xf2\xc5\"\x9b\xe5\xa6'H3\xe2j\u0758\xe4Z\x85*M\x17\xc5\xc1K\xb2\xa2\x10\xf3J\xb2\x99@\xe1.I[\a\xb8\xddS\xf6\x84\xa4\x84\xc4\x06\x16\xf6$\x9d@X\xae\xb6\x03hs,\u0279\x0e\xfbZ\xf2\xa5S#\x9f\x94\v\xa3\x83=z\xf1\\0X\x9cL\xc9\v8\x9b\xa1v\x9c\u03b1\x8c\x83\xd2\xca{h\x8d\xe8\xf9zvO\x19w\x7f+\xfblh\x9eM\xbc\x188P0/\xc9N=\xddT\f\x9fX5\xa6\b3\xa2\x04%\t\x9b\xb5\xe5\xbf%7\xd8+ \xda:4\x04h?\xc2\xde<\x0327\xd8TK \x82\x8e1\x94Ah`C\x8d\xcd\xe1\xfc\xfa2z\b\x97G\xbdW\xf9\xf6\x1b\xa1\xd8o\xc4\xd7+\xa8\u0128`\x8c\xb6\u039d>{\xdf\x14\t\u041c[\xdf2\x1a\x8eQD\xe9y\xa6\x82\xd1\xec\b[\xc9\v(\x9a\x04\xef]I\f\xa5\xff\x98\v@\xc9\x0f\x14\x9d,)\xad\xfd;?/\xef,\u0386F\xac\xe0\xf4\x1a~-\xea\x0f\x87g\x83x=\xae\x89\x91_>\x00\x8e6\x8e\x81\xf6RK,o\xef\xed\xed\xfd_\x90Z\xf0\xc7\xdb\xf6\u01fb\xff\xb7\xe79\xfc\x03Y\xa5u\xc7)-\xbfd\xa7\x0f\xc8\xfa*\x84\xbf\xfbZ\xe3\x87\xd6+\u04fa\xc0\x10V\xd3\xe4b!)\u01cc\x89o\x9f7\xe8\u07c6/\xe4Rh\xba\x9fB\xa5\xb5Ik\xf1*9\xecE\ua3f4\x1d\bB\xef\fr\x04\xf0\u04b7\x98\x04\u0333A\xf1\x9b\xe5\xe0\xee4\u05c38\xb9`\xffI0@\x10\u068a\xc1\xf2\x11\x8f\x16\xd9+\xe1\x15\x84e\x81@\xae0\xdf|\xc8)\x1a\x10[\x99d\xf3byVQ\xc53\x87\x90\x8a\xfe\x9e\xaf\x13\x0f\au(W\x18\u0716\xd3\x14*v$\xd9\xc7l\xba\x81s\xe5!p\x88\x85\x1b\xafV\x01\xed4[wf\xf6|a\xf8\a\xa0w@'\xc4S\xb7n\xf4+\\\xad\x86 \x012\xb6\x1eq5(U\xaa,\x86\x01G\x9a\t\x85l\r\xb6\xfa\v::\f\x8c\x1e\xbaw\xe0j-\xcaP\x1a\x94\x91\xe6a\t^l\xbb-\xa4\xa3\xe3\x84\x06e\vb\xb95\xba\x0f:\xbeyjG\n?\xf8N\xc7\xf4\xa2\xc8g\xac\xe5\x1a\xfe\xba!\x8e\xcf\t\xce(30\xee\nDR\x82\xe1G\t>Bl\u049c\x99\x1d\x90;H\xba3\xc7\x10,\xd0 \xe0\xc5nJq\xec\xe7K\xc3\u034d\x181/\xd2\u0650}\x14\xe4\xfd\x93\xe6f\x86 \xc5\u0416\xae\u01f6\xfc\b\xd6\v4$\x89\x8eH\x1e\x9d\x999\xc0\xbad6\xf4\xc1gE\xf0p\x8a\xaat\xa5\x1d\x1d\x0e\xf5\n\x88n\x88R8\x8c\x0f\xe4\xb5\xfc\x82\"\xc7\xf6@N\xba /\n{\u0741\xe9\xedA\xa4\xc5&\xab\x1a\xbd\x85y\xf5cv\u0261n\u07a6\xdcl*@\xe7Y\x99\xec\xff\u067d\xbby\xd8\x1c\xf4f#)D8\x05n'\xc5\xd1\x11\xc3h\x96\xcf@\x00\xa5S8$\a\xab\x99\u0184\xa3G x\xe1\x8a\n\v\xe7\xd5\r\xd1&\x18\x03\xc7\xc3I\x86\x8e\xdf\xeb\t\r\xed\x10\x15zq\x00z\xb2\x03\n\x83\x99\xe6]\x17\xc1oWqPK\xd1=fL\xe46qgGQ\xe28+/\xf2\xa9W%\x8f\u0400\x15\xc4p\xfb5\xa5pB\xe3\x10@7\xb7\xa2\x94v\x04\xfdl\xf2\x1e\xee\x02\xa3\xe6Hn\x1b\xd0*&;z\xd1R[QY#\xe6\xe2\x00\xee8\xb8}\x17W/\xbc\x05\xdc\xc5N\xec\r\n??\xba\x9a\u03b3\xf7\x10X\x13\xafj\xd6\t\xad\xf6?\x7f\xfcw\xdf\r\x1ak Y\xa7r\x1b\x96r\xfd%\x05\xa7|\x01J\x17:\u052c\x7f:\x84V\u01b0\xbf\xdf\x04\\9>\xfc\xdd\xf1\x95m\x02r\a\x88\xe5\xa0\xfa\\\xf8)\xbf\x7f\u043c\xdalm\u0160\xfb\x05!\x8a\xe5\x18Z\xe3\xaa\xccQ\x01\xb4\x04@ON\u04ca>^\xa5gT\x84\b\x1bA\xb3D`\xb6\xad\xad\xe5\xddp)\x05\xb3\xc3uKJ\xb1\xfb\xb3ky\x9acgd\x05\x83\x9e \xa3\x95\x1eV\x86mv\xdb\xf2\xd5\xdb\xd1\x1f\xfb\xd1\xf1\xa0_BQ\x12te\xe8\x92p\xe6J/\xc9\x04\x03\U0002ee8c\xdf6\b\xca\x06\x9d\xb5A\xaf\x8c\x9783\"\x03\u053cpI\xda\u0289\xb3\xa4\x1e\xfa\x1e\xa8QK[\x1ca\tU\r`\xea\x90W\xf6\xe2\xf5\xab\xa3\xc7\u0253\xa7\xcf\x1e\xefS$\xfa\x9d\xbfVw\xf0\x1f\xefe\xaa\xef\x8d\n\xf6\xd7\n\xde\x06\u0145<P\xfd\xe9 1\x8a\xda=\xdcft\x11\xe6\x9bE\xf2\xe28y\x80q\x88\xd58y\x00\xa5\xc7\xe0]*dT^\x80\x9e\x01\u0626\x95\xc5\x045\x82\x1b\xa6\xd3N9\x9d\xe4\f\xae\xcf%\xads\x9a<<~4\"t\u02f9\xb9\xf8\x96\x12\\E\x12?\xb4t\x8auPX\xc6\x7f\xf6\xf4\xe8\xf1\x8f\u01cf\x93\xd3\x1c\x18\u00cd\x1e\xd8U\xc8\x1b\x05\xba$\b\xc1\xe5z\x96\xad\xfa=\xf8'\xa9\xae\xafO\x9e|\x87\u066e6&\x7f\xb5Y\xdfy\xb1Y#\xa2\"\x86y\x80\xd1\x18\r\x12\x93+W\xbd\x06\xf5\xca\xc5b\xb3\x84\xb5U\xe5A\u00fa\xa7G\xf2\xc1\x1c\x82-\xff}\x99V\xd5\xf9\xbf\xa3\xb0\xf6\xef\x868\xe1\xdfF\x9f\xcar\x14\xe00\xc2+\x05\xc1V\xd6f:\a\\\x1a*Z\xbar\xb5\x8dr\b\xd39\xbb\xe0X19\xdcXKG\xc2\u05e4D\u045a\xaa\x1b\x1a\xdau\"\xaf.[\x80#\a;[\xf6\x11\x92\x83I\xf8]\xd0g\t\xe4\n\x94!t\xa6\x1d\xa5\xb6\xc6Qy\x17Y\x1e\xcarR&>\xa8\x8c\xad\x83\xea\aT\xe0\u03a9\xf4\x80\x0fd\xc6A5\xe8\xfc\xd9[\xbc<\xa8\xe1\xc7ke\xa3\xff+\xdb\x10\xa0\xfe\xc0\x9e\t\x98,\xc5\xe5b\xb9\xad\f\ua825\xba\x16\xcc\u04ea\x80\xa0_]Z\xcf\xea\x03ve\xcc\x11\x06-\xa9\n\xaaIM\xb2ev\x9a\xaf\xab}hh\x94\xbc\x94\xb7\x00!\x10\xc4\u05fc\xa2\xa2\xb4)\v\xe5\\G\xc3_\x81`\xfe\x840d\xa3)\xa9\xd2\x05d\x87`\x92\xd7fbG\u0647Z\xb7\u0230\xa1\xe8!-\xe3\xaaX\xb9\xf5\u00d0U3,\u0614\x9cf\t&\xe6\x14\x96\n\x00B\u04ca\x191V\xbe`C\"\xac\xb1\xdd^\x1c\x19e \u06d1\xe1N\x80j\xc5\xc4BW\x88^?\xee\xf6\xe9\x12{~\xb2Y\x83\xd4\xee\xea\x16\xa6WI\xb9\xc1h3`\xac\x97E\xf9\x81\xe7Y\xb2\x16wIVa0`\x83\x11\xd7\xdcu\xd43lg:\u01fa\xe9iR#A\xf3mYl\xce\u0381X\x9f\xbe<r;\x10\xdeM>\tG\xf3\x7f\x9f\xbe\xd0,Y\xa8@\xb1f\xcb\n\xc1\n\xc6\xff\x16\xd5\x06&m\x1a\xe0\xe0M\xa4T\xd9u\xf3\xfb\x18\xb7\xc8j*\x92z\xf9\xf4\x85C\xb5\x80f\xbeF<ls\xa0 /\xc5Lpa\xa3w\xc0\xb3\xca\xc1\xa6\xd9y\xeej\tb\x06Wx\xb4@\xd1\x1c&\x98\x0fN\xe1\xcdP0\x16\xca\xdc\xe1\xa1]B\xfdw\xb3\xa1\x05Dl\xa8\x14\xea\x1cl;d\xe3\x99B\xac\a\x9e\x87\x14z\xa6v$~\xe4H\xef\xe9\x86D. '\xaeL\x99\x03\xffD\x97\xcerz\x85\xca\xe7\xd7wT\x02\x8e\x97\xb3C3\xff\x7f@l\xff\x0f\x88\xed\xef\f\xc4\x06'r+\x16\x9b\xa0\x80\xd4\xf0\xd8|f\xe0\xe5\x04F?\xf2H\x1c3\x94\f\xb7:\x05\xbf\x95\xb5M\xf2IV\x972\x98\x88\x87\x86\xb5\x83\b2s\xb9\xb3\xd9\xd4HsD\xa5\x9c\u0644\xf5\xd0\xe0lR$\xcee\x06\x89-\xae\xeax\xc6U\xb6\xee\b\xf4\xc7\x1d\x8e9\x87k\x81\xd5\xfc\xb1\x9c\x1f\xb4\x9b3\x95\xa3\xf5\x8aY1\xa5N\\dw\xc8VL\x17\"L\xa0-\xb3\xed\xe4<\xb3\xd9mEje4\xfb\x9d\xfd\xe8\x052M\"1\x1e\x91Y&\xf2\xcf\xf1:\xc9@\x130O'\xf9bE +\r^\x1co{IlG\xd4\xe2 Wn\xa8{\xf4\x90x \x03\x8f\xda\xc4\xef\xfa\xfe\x8e\x0f\x93\xda\u01fe\x12\x81\x97\xaa\x14,\x94\xea\x9ffD \x96\u069c\x8fPP\xe4\xd5\xe0\xd70\xf5\xda.',\xe5\x12\xd7\u1d29Y\xb8\x1fA\x063s\xed@\xf2\xd9Z\x1e\xbc\xe4\xef\xd5\u04a8!\xc4\t>[\xf3W\u07ab\xfe\x1a\xe0\xaas2c\xfd\xa2\xb5\xf77\n\x8b \x89@b1\u0250\x1cH{b\x8d\xb7_\u02f5jXC1\u035d\x1f\x9c\\\xc75i\x14~\xacHb\x87\xa0\x0f`(\xe0\xac0\xaa`\x8d\x81\u0095}zJ\u0085\x13\xb3\xa8t+\u0289|u\xb3t%\x9e\x06i[.yi\u07b9\xdcm[p\x99\xae\xc0`Vm\xdf\x16\x90\xe9\u2385\xbc\x80\xeb2\xb6\x94\x01m\x92\x13\xae\xb0\x0e\xba\xa3t\x05\x92\xd8\xec}\u8e73\x0f\u0214Y\x8c}\xdf\x05\xbb\x9b\xecO\u072cr)\x90M\x93\xff\x96F|\xc9&\xa0\x9b\xbc8\xa8\x13\x13\xce\f\x9e\xb8\xd3\a\x7fy\xce+\t\x97pD\u046b\x1c\u0107\x15\xbb:,0\xc6\xd9\xc4\xd4\xee`@\xa1\x98\xe6\xd36\x19\xf2q\xb3\xd1i\tL\xb6\x12k5;f=\x04y&+Q\t\xdb\"!\x94\x92\xe3U\xa47\x94\xbb\xe2\xcc\b\f\xd5\u069e\xf8\x8dCC\x8b\xcbr\u0585%\x88.\u0494\xd5\r\xf1@z\xa8\xe3\x1b.Bt^\x9c\xf5{\xaf\x97\xa4\xc0h\xc5f?\xe1T?h\xa6q\x15Sw\"[\xd3\u072f\xbbrN]\xd4\u04a2\xeb\n\x97J\f\x8bd\x17\x98\xd5\xeb\x93\xf4`Z#|l~\xed\x91\x1fQ\x18q\xb7L|\x90\xe3\xab\xec?6\xf2E\xfb\x9etJ\xb6\xef\xb0-\xc5\x04M/\xe5\xcc\xc3\x11\xa0\xad\xf9_\xc7/~\x1cS{\xf9\xe9U\x90\xd8\xde>8\xf9=\xe2\x12E\x87\xd10\x11\a\xa0\xb01sNU}\x00F\xf50?\x8a1\xcb\xfc3\xe0C\xd8\u0401}\xa8\xf8\x0f\xb5m\x1fA\xcdM\xf3\x82wf\xbd<\xd2`\xb8\xc1\x10\x1bI\xd3\x12&\n>\xb9\xc4\xde|6I\x92$\x15\xa7\x9a_A\xe8;\x03\xa9[\t\x84f\xb4\xe3N\xaf\u048c\xbaP\x97\xbf\"[\xf6\xafNgj\xc5\u07a0\xad\t\x10$\xbe\xb3\xe7\u01f7\u01c4\xe2\xce\xc3+\xf0uB\xb8\x17\u02233\xbe\xd2A\xbb`\xfdG\x14\xfbdr\xb5\x16TA\xf2\xc3b7\xa8\\\xf1I\"]\x14\x98/\xe4,\xdb\xc2\xc7XG\xa3a\x85_\x9bu\xfb\x0e\u02fd\xfe\x8a\xff\xfb\x10\xeb\v{\xc7\u055f\r?\xa0P\x04\xccX\xc6\t \x10B\xbe\xec\xb0\xdch\x8e\x03k\xe3V\xd4\f\xef.b\xaf\xaa\xb8\x17!\u033a\xf7\x80\n\x91\xdb\xce%'\x8d\x05(w!\xaa\u0683f\b\x86\xeax\x16\xe0.\xa3\x7f\xfa>3\xd53h\xc3+\xac\xf1$\xbc\u06cb\x1e\xe5\x86D\xf82M\xabe\xdc\xd6&\xee}\x1f\xc4\x19\xb7\r\x8a\xf3\u013ca\x8d\xad\xe8\xe1\xd5)2\rvQ\xd1RH\x98l\xe1c3o9?\xed\xc0\u0463$\xb2#I\u0317\xff)D\xb1e\xbf1\x10\xab\xfcy\xd9\xf39\xa3^\u057b\xdf&\xff+\xbdH\x8f\xa7e\xbeZ7,j\x875\xdcy\xd5hv\x87\x9d\x0e\x9b\x19c\xc3\xc2\xe2\xfc\xed\x99\xec\xfb\x0e\x818\xbe\xcbK\xec\xb8\xfb\xe4=\x8aBM\x88\xf1\xce~\x9b%\x99/\xbb,\n\x92[\x97e!\xbal]\x98\xae\xae#B\xbe\xf8o\xe6>\xba\x9cB\xe1?Z\xefc[\x95S\xbb\x92\x1e$4q6^Z\x96\x89}\x016\x0e\x86\xa3)\xa8]U\xef>_N\u76d9\x133\x90,\xa8\xb5r\xb3Dcb\x05S\xe26\x00\x10da\xe4\u05dc\ri\xd8\v\x87\x05`\xa8\x1cXw\x8b\f\xbd+`\t</\x8c\xac\xb2YY\xd7/8\x83\u0452F\xf6I\xed\xbc\x87\xc1\x80\xe1\xc5\xcdQ\xc2X9(O\x85R\xad \xd4\x13\x13\xfc\xab\xa1\x05y\x98\x9eo\x96\x1f\xc0\xd6\x0f\xaeU\xb3\x06\x10x\aK\faM\xe5f\x0eS 3\xe1\u0691>\xc8\x05\u0547|\xb5\x82\xa0e3\xfce\x81\x01\x99\xb9\xf3\u00b2\x19e\x810&\x90qsY\x82\xb1\x97$0\x12\x0e\xcc?\xcc!\u0105\xc6\xf6p\xf9@\xb0\a_\x8d\x19\xce\u071eE\x80sKfe\x81\r\x04\x91\xa28c\x12U\xd7\xc1&\xa46e\x9dZ\x1eJ\xb5B\xeas\x86Z\x84\xad\xfc\xc5_B\xba\xf1\x19$o\xad\xc4\xf7\xae\x00\x11-\xeb0M\xcb^e9D7Xy\x93\f+\xdc%yd\x92F\xdf\xf3)\u0105\x0eh/\xb4;\x0e\x8d*\xcb\xe7\xe9z*N\xa4b\xf9\xc8\f\xca\xf9\x91\x80\xfb\x9cqd\x819{`\xac\xdd\xe2Sq\x83\xf7L\xf1\xa8\x81\xe2\xf9\x8fq=#\xc0\x95W\x01\u04db\x17\xc5\a\xd8\xdfq4N\x03\xccn\x10\xcby\x9ca\xdd\x04s\xb5\xbd9\xcf\x10gCGy\u03b35\x06\xa3\xa2#r\x01\xf3\x8cr\xd1c\u0693\x88\xdfgHC\x1b\xd6\xfb\xdb\xea\x11\x92X\x19\xfd\x11\xbcq\xf3f\xad-\xfb2vfm&\xc1\xa7\x7f\xe0e\u06a7\xff\x8e\xd7\xc53s\\\u02e3T\xbc\xfe\xf8\x91!,C\x10\xef-\xac\xbf;\xb0X\xab\x98\x0e\xde\x0f\xf8R\x1f\xdb\x19h\xe7\x15\x1a\xcdA\x90\xb0\xfb5L\xc8\xf6\xaf\x8f\x04\xe5\xe8\x96\xec\xa5Q\a$\xc3SG\xe9\xbe3\x1d\x9b\v\xa6zA}2\x94oO#\x9f6\xeb\x13\x83\xfe\xcd1\xd4+Y+v\xcc\xdf8\x8b\x93\x0e\x7fz\x1f\x89x2\xa7\xf4}-6Z\xdd\xe8'\ucea8\xc0\xb4\xc2\xd3f\x1e\r'\x94[Ft<\xcd][Hi|\f\x97\xc8\xfb\x93\xa7\xcf\x1f\x9b\xf1|W\xd3)\x81me\xa9!9\xa4Il\xb9\u010at3w\xc4_\xc9\x1a\xd9\xf5O\x91\xa1\xb7\xe1\x15\x03\xda\tbyI65\x8c]\xb9\x8c\xc8'H\xf6H\u042f\xa9\x83\\\xe9\xb7S\feI(\xb7\x06\xee\xc4*\xc9>\x9aK\xa82$8\x14\xac$JXJ\u047f\x87\x01\xc6\nX\x03&\x84\\\xb8\xc6(\xac\x8e\n\x1f\x9c\xd0\xe5'\x03\x13\x1c^\xd7\xc68\xfa)\x03\u019c\xa0k\x1f\xff\xb9c\x03\x04\xb3\x19v\xafxo\xfb\xb7GM\xfd\xc7Zh\"\x0e/\xeb\a\xd7Kq\x9e\x1b\x1cM+hQC\x1e\xf2\xd0uoXO\xddLQp$4]i\xca\x0e \xb8\x16r=u\x1d\x19\\\x04\x81\x99T\xfbh!Y\xd1\xddg\xe0\x92\xa1\x1bJ](K\x00i\x92\v\x05\b\x8dc\x9f\xf12\x04\x9c\xad\xaa\xdbX\xa6\xa0[\xce\xeb&\xdbFD\x80\xf7\x83\x83\b[\xa8\xfb\x99=\xb9\f\xe4(qd\xd2\x19\x91\x88\\\xe7N\u0117\xba\r\x1a\x98N\x93\x959\x1c\x93\x80\v:FZ\xb3\x9a\aL\u0416\x87\a\xa9\n9E\x84\xdf\x1f\xfd\xf0\xfa\xc7?\xbd\x7f\xf5\xe2\xcd\xf1\x81\x86\xff\x06\xa4\xa20\x12\x00\xc7\xc0\x96\xb8z\x98\xc0\x88?\xbc\x9fl\xe3v:\xbfQKS6P\xdf\xf0\x8c\x8a\xd7Q\x8bwc\v\xfe\x98s\x9d{L\x9bX\xa4\x1f\xfb\xfe\xbd0R\xab\xe4\xdd\x04\x92\xf1RKz\b\x16\xd2\x03\x13=p\x19\xfd\xd4\xef\xf7\x87\xeeS@\x96Q\xb7r\x00\x1d \x84\xbd\x05\xf6\xc16\xab\x86M\xa1w^\xa6\xff\t\u0763\xe6\x9c\x1a\xd2#Y\x1c\xac\x83x\x05@\xf2cea0x\x93\xa8\xdd\xfb.\xa8]\xa39\xf0\x122\xf0\nl\x11\b\xc7\xef\xe9\xa30\xe9\xd5\u01d1\xb1D\x05\xe0\u0772\v\xf9\xb2\xdfWi,\xd4\xfe\x1dG|\x88P5\x00T;\xf9e[Pq}5l\x9a9\u0695\xdccl\xf2yzuD\x89F\xd4\xf9\u0413u\x06z\xf2\xc1\xfa\xc8\\\x82r6\xddVH\u05a8\xb6J\fe6\xbf\xb2\xf8\xe5\xa4xp\xb4\x83\xbdn\xa1\xf3!\xcc(]\x1a\x19\x12\u0313r9\x04P\x01\xc7|0e\xb8\a\xe1|\xdcK\xdf\xf3\xe8\x15\x1e\x82\x97\xcf_\xbd\xa2@\x04\xb3W\x97\xef\xd5w#\xb3E\xfe*\xd8g\xa3Q}\xc6n\x91\\\x13n9\x8d0Z[;\xfb\xde\xc0\x88\xa8\xe1D\xea\x19\xd6J\xd4\xcb\x19\xf1\xba\xe1h\xfb&\xfc\xcf\x11\xf42\x8a\x8c\xc6{*E\x01\x00|\xb6\xf9r\x93Y\xecB\n\x1b\xa9\x1bh\xac\x14@\x83\xc5\xc0:\xfc\x17\xef5`\xb5{\x85&DU\xe9t[\xf8\xbb\xa6\xef\r\xa2H\a@\xbb\xdb\x1d\xe1X\xd0\xfd\u0219\xd3%&\xd4So0\xf6H8\xcf\xec\u035bQ\x9e\nI\n\xfcv\x90\xd2\x01\x941*\xb8\xc1\xde v\t\xdbs\x847\r\x9e\xa3%m\u0450\xc3'\x11\x900_Wt\x84\xb2j\xd7\rrJ\x8b_v@m\x99m\"\xb6\xbbJ\x87\x97/\xb7\xef\xab:\x1f-\x9b\xda\xf9\xb6\xb2\xaf\xc3}\xff\xf6\u0741+\x9a \xa7\bSt\v\x05\xa6\\\x92J\xd0\xd44\xaa\vP\x05\xe6@\x04\xcf\n\x03\x10\xfaq\rTZ\u06d7\x7f\xf9Z(\x9b\xed\x99g\xc5\xf8\x91\xe9\xea\xf6\xed\x01B\xfc\x98A\xdf\xd7IY>\xea;\x8e\u4bc5\xe1\xf8\xbd\x9e{XHm\bLR\xc6\x19\xbf8\xed\xeb[Z\xbb\x14\xe9\u56c7\xc9\xe8\xee@-\t\x12\x10\xddo\xfc\xcam\xad~\xf3\xe9p\u0084HM\xf8\x0e \xbb\xad\r\xb7#\xebV\xc1\xe0\xfb\x1a\u028c>\xc1\x18\x83\xc8\x17\u04b9*\xa7\xe8 'Pp\xb6\xdc\x10\xba\x1d\xe3\t\xa0\x7f\xb2BP\xbfZ\xdd\x17\xc5J>0\xffb\xd0?v\x8en[974\ay\xc1\a#\x03>\xae\xf9(\xfc\x98.\xa5M[,\xec\xe3\x9a\xec\x90x\x90\xb9N}\xc98\xb9\xa9(L\x90,\x9cE\\r\xe8\xff\x19\xdf'\x03\xd0\xf7\x9f\x88\xcaOT\xbb\xda^\xea\x9f\u07d0\x03\xf0\xb8\xe0\xe3\xf8\x10\xa3\x9f[\xdbR^\x01qh{\x92\xb4R144+\u0122\xf5\xa5\xe2\rdu\x9e\xe0M\x10?re\x81\xcd\xe4]\\\x912\xe5\xb6!At\xedi\xb0:TR_F\x8eMI\xa4\x1c+\xb1\xc3\x1avu\x94\xd5YS\xact@\xfb\u044d\x8f1\rk\x1e\xe6\x1f\x00\\3\x8f\xa3Qj\x89=\x8c\xf0\xcb}:\u055cz\x02\xb0\x95Z\x88\xe9\u04fa\xffAV\xfb{|\xfb\xad\xf9\x9fw\xf2\u027e}vX{h\x85\x1b~eT\x7f\xc5\xf2\xb8\u06f7C\x12\xff\xc5\xfc\xba\xaf\xf5\xee\xfdzA\r\xdb\x1aU\xe1\xe8\xef\xc9\xf4\a\x83O\xdd<!\x1f\xd7\xefSWm\u4fd7'\x04K\xb0V\xda\xf3aDv\xf3\xf6\x06\xf3eA\xc9\xf6\x8a\xad\xb0\x1fR\x87\xe2T\xf6G\x80\x94\x03\x1d(\xc5\f<\x98\x19!\x04\xca\xd2%\xd5\xc6\x1c\xb0\x14\xa1\xb3\xb9\x04\xec\x1dh\xc4\x15\x8dMp8\xc3dR\xcc\x11\xf0$\a\r1_\xa7f\xdaC\u0296\x1d&\u6d6ctG\x03f\xf6!\xe3\x88\x03;,o\xcc\xe2\xe8\xae\xc2\x10\xc0\xa9L\xd5\f\x990#P[\x01\xc8)\x89R\xe5,\n\x1d\x11\xe6&\x841\xf8pz3\xc0\xb45\x1c\xf7c^\xa1\x14\xe47vJ\x81\a\x10Lh\x0e\xfc$\x9fC\"\xa8M:\xaa7ky\xec\xd4m\x85fy\x10\n\xfe\x88\x13\xdf?\xb9\x14\xf8\x13t\xe2`[\xf67\xae\xfd\x80\x86>\xf4\xbe\u062c\x90\x04C\x12\xbd\x81\x06\x86\x1d]cG\xb3\x10i\\\xd9F,\x88\x92yO\xfe}`\xed\xd3\x10\xb8\x9f\x969\x04#\xfb\xf8\xeaL\xf4\xa2wa\xc5`C\x1ed\x92\xda\xe7\xbai\xaf\x8e\xde?z\xfc\xe4\xc1\xebg'\x86\xd9 \"\x10\xd4`\xfc\xb8\x96\x84\xf9\x81{\xef\xd5\x1f\x1f2S\xb2\xc1\xd6p(z\xe5\u0664\x9f\x18\xb2:3D4\xe8\xc1~,\xf8+\xb2\xd2\n+\xab\x15Y\xa1+\x1a-\xe84\xbaU\x8a\xce\t^\u05c1\xcc\xdf\x11\xb4__R\r\xde%\xf6YjoyW\xaf\x9d\x06\xa7O\xa7\xe7d\x90A\x80\x00\x1b\x82\x8ec[\xc3\x02\x13\x90g8\x9e\x1b\x16\xb9\xbd\u05bb\xde\x0fs<\x8a%\xa6\xec:\xfc\x81`~2Z\x1e\xe9\xfb\xa3\x17\xcf^\xbc\x8a\u032d\xe1\xbd\x1b\x0e|\n\xf6\xee\x89n\x17\xb7\xe9\xde7\xdf\f\x13\xf9\x9f\x81\xab2\xcc\x1f<\xd4\x1d\xe0\a\x86\x9d\xc3\xff\x1b\xa8\xc8\b\xe0\x1e\x1a\u028a\xa6\x90b\xe4A\xf0+\xf1\x96\xda\xcf\x13\xce\xc2\xf6\x7f\xb5\x9c\xa7\xf6\xc4cB\xf5N8{%\xf2\xbbK*\xf6\x9e\\N\xb9\xfa\xa5\xff\xf3\xdap\xf4G\x04\xbfcM\x90\x12\xec[\x94/\x996\x83\xa28@\xd1\xeb#\xf5B\x80K\xf0\xf4\x94z\xc1\x821\xf9\xd9R\xc2uq\x15-S\x8aFh\x9f\xe2\x15a\xe1\xfe1\xe3#\xa5\x0fa\xc6\b\x12\x8b\xae$p\xda\xce\xf2S\f\xb7\\\u06cc\x18\x94\xa3P`\"\u042fK\xaa<\u035f63#%\xe1P\x11\u0647\xb4\xe1\x8cX\xef\xe6\x05?\f\x91\x01N\u8ba6\xdb\xce\xc8,F\xa2\xbbH\xf39|<\xc0i\xe0\xa0Q\xc8\xd6\x135+'\xb0\xd3\xc0\n\xc0\u04d4-\xd7\xce{`;\xe7\x17w\x1c\xf3\x83\xea!\x8d+\x1c\xfb\x83\x84\xb8P6\xa7;\n\xf0\x0e\x05?\xe4\u05a5YR\xa9?cQC\x88\x05\xe4\x14<\x80\xf9\x97\xc4%ou\x1a\x92wJ-\xe4\f\xd7\xc45<\x92\xb59;:;(v\xfc\u0285Jl\xf7\x8av\u074a4<\xb2\x80ow\x1a\x98\xe6\xfe\x80\x0fM\x9f\xc2Y\xdfq0\xfeu\x93\xbaQ\xa5\xe4\xdf\xc4x\b}M\xd8|\x9d\xb2\xf3@\xe1\xfa!\xae\xd4SZ\x17B\xcbU\x90\xa0\a\xb2\x01T\x9b\x81\"z(\u03a1\xa3\x9e\xe0\x96\x84\xec^R`\x01\x946\x86\xfb\x99_\x83\x10@\xe0\xcbs\xc1\xc2\x02\xa4\x03\x9a\x02Ej\x92\xa7\x061Uq\xf2\x18D\xb1\x02\xd8G\x8cV\x90*\x14\x00\xf4\xa4\\%(\x91\x94\x02\xec\f9*\x97a18o\xba\xcf\x1f\xfc\xf9\xfd\xf1\u027f={|l\xe6\xf9/{\xbf\xff\u059f&\u0344k\a\xf2\u0407t\x87\x92$K2l\x0e9\x1aOg\xc9\x1e\xf2\x91%\x81\xdbYPC\x197\x8bj Z1\xa7I\xed\xf7\f\x04\b\x98\xa0@\xee\xe5\x06D\xa9\xcce\xd3A\xba=\xe4?\x97W\x18,Sa\xa0\x8e\x91\xe80\xf8\x02\xc6&y<\xd8\xe0P\xaeQ+5\x11\x88#\xb4\x84~\x0f$\xa8|\xe9\xa2bN\xe7\xe9Y%H\x13 \xb0 @v\xa1oj\x00l\x84\xc8b\x98K\u02ca\xd2\"\x81\xd8\xf4\x16\x98\xf6;\xb7\xa0\xcf\xd3\x15\x03\x98\xe2\xa4!\xf8\x1c:\x94\x15\xdc\xd2\xe4\xd3\x196\xaa}\x7f\x90\xe7c\xb5\xf0\u0208Qf_\u0488\xed\x92P\xf26\x7f4\x81\x19\x91\xaak\x17\x8f\u05a2m8\xa6\xbd'\xb8^f\x8e=\xbc\x85!\xf6\noX\xb8\xe4\xe0\x0f{\xb1\xf6\xba\xc0\x9a\xf4\xbc\xdb\x16\xbe\xa7\xeb\x12\xfe\x057$\xfe\xfb\x9dO\x9a\x0e'\x8a+\xb4\xa0\xae/q\u07d74Y\x10\x86\xa1\x82\xa4\x0f\x17\x11\xcbS\xda]\x12\xef\xc4D\xcc\x16Hk\xd7\x12\xb8c9\\3\xc8sE0<Q5]\u008dg\x9f\x88\x8d\xed\x93a\xafm\rl\x9d\xd1t^\xf7G\ub69c:-J7\xd1\xc7\xcad(\xe0\xc0Y\xed\xc3\ap\x04\xf8v\x13\xa3Ay\xf1\xd6\xfc\xfa\x8e\x85M\xfc\xb73\x11\\\x84bQMT2\x7f,\xa7)\xdbhy\x1d\u028b0\x81\x89\x03\xa9\\\xcdM\xb2\x97\xd5\xd45\x94\x18 P\x0f#\xbf\x18\xa8\x85\"\uba37\x045\xfe\x88<\xc6\xfc\bq\u020c\u0ca6\xfcM\xa9I\xabZ\x02\xf2\u0184\x97!\xa5%CG \x17\x80\xa2\xd7i?\xb0\xf3\x06\a\xf7\x17Wb\xbe\xb4\xf2\xf0\xdfV\xbc\x8f\xd3[\xa8pjq\x0f\xa1\x84\xba\xef\xf8\x91\x7f\x10b\xbb\x1f\x9c\x15g\x1bj>1\xb46\x00|\x86/\xf6C\xb7\x9d\xb9:\xf3\xd3\x06\x1b\a\x00{L\u037f3\x00b\xa2\x8a\xc3Z\xfa\xae\xf9\xe3,\x1c\xee\xce\xcdm]\xa1\xbc\xe2\x8c\xf6\xfa\xca\xf0(\xfa\r\xe7\xa3N\xf4\xbe\x7f\xb7\xe1\xa8l\xfb\xec\xa6#\xf3\xc8\xefD\xe9\x91\aL\ucc66\x90\xde#\x0f\x1c\xc9G\x1e\xfaT\x1f\xeb\x90\t?\xfe\xc8V\x96\xaa=d\xf2\xaf/\x95\xd3o\xb94e\xfcJ\xf3\xadk\xfd\x94d:\x94\x10m-\xeb\x81\u0208$\xa5 f\u029a<\x96h\x8b\xeb\xc4\xcc9q\x18\x93\v\xa7\xd2;\v\x9d\xaeh\xf6\xa9sR\xa0@K\xf47\xe4t#32\x90\x12h\x8c\xc1\xbb\xf4&@*\x10p\x19\u05814\xc3Y\x14\xcb\x02\vwB\xeaX\xe6\x90$\xa1=\u04b7\vp\u01d4h\xb8\xa1\x92\xcf\x15\xa0\x9c\x9f\x8d\xa5\xd8\u02cb\xe3\x81W\x00\x16\x92\xb90t\xb1\xde \x15\xfd\xc6\x15<M\x8e\x8e\x8f\x19\xb9\xa7g\xb6i\x04\x13\ucc70\x04!iTqF|B.\xaf\r\x05\xee\v@M0\xf3\xc1\xd4\u055c\xb0\xe0\xf0\"\xb3f5\xb1gco\xb2?Fe#\xbc\x18;\xaa!=\xb3c\xc9`4\xd0\"\x03|\xe3\xbf\xdf\xdf?\x9b_\xad\xce\u0642\xf7}\xaf)5\x03\xc1\x1c\xcczC$\n\xec\xb8\x05'\xc0M\x98\xf2\xaf\xa2\x10\x80<bI\xcb\xf7\xdf\xc0.\x02\xdd\x1a\x99HoiQ:Z\x90\x1d\xf5\xc8MhM\u032e>\xadm\x97\xa0\x90\xee\x8e,\xb9+\x1e\x15L-H:\xb2lM\xea\xc2\xf0D\x02\xd4{j\x1f\xba\xc7H\x80\xb0M\x17\xe6Fj\x85.DK\xbf8\x0f7\xae\u01e1}\xf3\x0f|\xbc\xa3\x13\xa4n\xb1\x89\u0671\xf9.\xa8\xdd2\x94V\x06\u027e\x87\"I\x9f\x99\x0f\xde\xf7\x1d\x90g8h\xc2_6/\x8d\xf5\xce\x1f\x86\xb4\xa0\xa3#\xe0\xed8\xb7q\xcal|_\xeb<d\xe8)\xdd\xc8\x04D\xef\xae\xddo@H0\x9d\xc7\xe4n`\xb8\b\xd0\xfc\u034fC\x87\xd9\xd4E\xf3\v\x89\x06\x97\xa9\xa1\"2mU\x94\x16x(\xfd\x1e\xbc\xd4s\xbb\x8b\x038\xa4u\xc5?l8#\x1fR\nn\xd04\xa8D\xbf\x9b1\x99\x8ew\n\x112I\xde9\feF\xbfA%#nm\u043d{\xa4\x9bv?\xfbM+k\x9e\u0506\x80+X\xb7\b\xbc\xf7M\xc6\x16\xbb\x1e<\xed\x05\xf3\x85\xbbY\x91\x9fH\xa5\xb6\x96\xa6;\x9dxY\x87\x8d\x1f\xf3\x1a\xf7\xe8q\xd0\xfaD#\xb9\xf2\xa2S\xd8\a\xa9\xd3\u012e\x05~\x1c\xfa\xb7Z\xb6\xaai\xf2I\x87l<rx2R\xd3\xcfvg\x85\x03\x9b\x12\xea\x7fp\xdb|\xe1\xbcq=\u056d\x96\xa4]\xb7\xbat\x90\x16-\u069a\xc7\x18$\xd1\xf4U\x0f\xa1D^\xeb\xc5kKz\xe0\x82-\xe1\xbc\xfd\x1f\uaa37$\xaf\xc4\x17^.I\xbd\xeaV\xbc\xf7\x96\xdce\x83\x8a\x94s\u04ef\x13\xee7\x8c\xf7\x1d\xb7Z\x7f\xf2\xbe'\xd1/\u049a\x1e\x80XAbC\x90\xb6t0\x19~\x84\x0f~$\xa4\x1dy\x89\"y\x92\u07a0\x95U\xbe\x92\x8bE\x9b\x00\xc5T'\x91\xfe\xda\xec\xe6sNb\x90\x8eyR\x1bhv_3\xb8\x19\x94d\xcf.\x85y\x1e\xa3\x81\xd0:P\xd1pi\xfb\xc3\x04$\xf9\x99\xec\x8ax\u0467K\xc2U\x95\x04s\xcc?\v\xb9\xb1\x17J&M\xa2\x97w\x8fe\xb7\x92\x02\xa0\xd39$\xcf]a\t\x9cE\xbad\xd3fe\xa3@\u012c\xcb :\u0172\x9b\xb2\xe6n\xd58\xdbf\u0577\x8d_\tS\x06kI\x8d\x99Bf\xf0\x81%\x1d\xc5L\xbd\xdf-\x81\xde\u6ad7\x9e\xf5\xb1\xf7?$w\x93}\x00z\xbf\xedq\xb2\xfa\xef\xc4\xfb\xdc\xcf\u0716be\xf5o\x1c\xe3h\xf8\xce?\xf7\xb5\xef\xf9\xe4\xc9\xef\x11\xe1\xa5\xdddj-H\x94&O\x1f\xdd4\xda\b\f\xec\u050ck\xe6G_\xd2\x1b~7Uk/.\xc0\x93\xfe\x94\x18\x99\xef\x93-\x16w\xaf\xe3=\u05e5\xba\xc8\x03\xe1\x88^8e\xdb+F\xf5X[Z\x8e\xbf\x98\xff\xdcO\u06ad\xb6\x12\x83\x93\xe4\x10\x00\xe8\xaa\x7f\xc1\vo\xdb?}\x9b\xbf{'\x15\ti\x14\xbf\x1e\x9a\x8d\xb9\x7f?\xc9-Gr\x1b\xe3-\u01c1<b\x9e\xf7\x8b\x98\xef\xf7Y.\xc2\xf6\xf6\xe9?\x04\x9a\xdbac\x9dl\xaa\xec}\xf6\x97\xc0t!u\x8d\x04It&\xa6\xe3\xbe\xc0Y\xd4\xc4\xff\x01\xeaH\xc2{\xa8|\x06\xb0\x10\xfc\u0470\xb0 \xa4\"\x0e~\xb5\x9c!(-\xbbT\xb1m\xe1t\x80n\xec>\x9f\xa2\xedz\x82\xe1-F\xce4\x03\x94\xf2\x1e\xa4\xd5IB;$\x05\xaf\xadm[:{\u00acx\xb5)WE%\x8e\x01\xab\xf3\x0eU\xce3z\xee\xa0\x0e:f\xb3\xb9\xe96\xa0s8=\t\x90]0\x9a\xcf\x02k\x8a\x93f\x8b}\xc7.\xb9\xd3\xf2\xf5\xca\xdaeuAw\xa0j\xc6Wv+\xcf\xe5\xc0\u4e06%\xf06\n\x86\x03\xf1j\x1c\x06\a$\x9c\x00x\r\xac\xc8\tW\x19\xfb]]\xe1R\u0698WQA\x95\xb2G%\x9d\xc1\xad\x95\x8e\xce\xe0\x93\xcc\xda\xc8\u0281\x91]\x14\xf6\u0090\xb2\x00S\x85X69\a\xfa8\x95q\\\x97ed\xd0\uebe8d\"\xaf\x89<\xe1M\x8bm\x97\xa2\x82\x99\xd7De\xd3o\xa9\u07ed\xe1\xcb\xd7\x1d\x03\xf5\xc2~\xa0E\x8e\x9a6qx\xe8i\rmV7\xf7n\xa8\x10x_\xb5+\x01\xd0\xc8\u035b5- \xd2/\x99\x961a\xd8\xcc\xc4\t\xe0\xf5W\xc58\xed\xb7L*\x80o5\v\x8du\xb6\xf9&\xfb]\u0300g?\xf2\x85o\x1f,\xaa\xc51%\xa8\x9f^%1\u0650\xa1\n,\xd2n\xaaH\x98\x8fV\xedZ\x82{\x025\xad\xdd\xd6\xfcz5C\x9e\xa9(\xc4\x0fv\u048e\xceIZa\xe6\xa5\x15C\x91\xe7\x12\x1a5f\xddb\x90\xaf\xb5\xb0\u01ccJ\x12\x8f\xaf&v\u20c7\xd8\u07c9@\xe1\xe2\x858\x14\u01f3\xc4x\x8a\xec\xd4\rt\xdc\u059dZ \xaf\xbb0\x80r[wnx<\xc1\xed\x9eI\xbb\xf2u\xc1\xd4V\x9a2\xe7\x9a\xe2Y\x9e\x82\u02ff\x9fky\x01$\x8d\xef\xc2\x02\xef\xce\u0351+\fo\x80]\x01\x86??\x15\xe5\xe1\xc1\x8f\xc7O\x93\xbb\xdf\x0e\x01\x96!\xf9n\xec\xe5\xee\x19\x19\xe66\xe4j\xfb\xb5m\x9f\x9e:\a\x99m\xf8\uedfeSe(\xe1N(\u0616\x00He\xee}Fd\x97\x96\xf8z \axv\x9e^\xe4\x05:\xc4\u0357\v\xa3\x9a:\xac\x1c5\"O\xcdnr\xab\x85\xbf\x8b\xc0\xd6\xe4Z\v\x7f\x97\xf7cg,\xee=So?\xec\x10\xa8\xe7l\x15D;\xb2{M\x13\x8a\r0i\x9cNl\xfar-b\xa5&C\xb2\xe6\x1c\xe6\xe2\f\xe3\u02ecWI\x9c\xe8\xf2ja\x9a\x18sY\x9b\x865\xa8M\xf7@\xbf__\x85ZCu\xf5=\x12\xbe\xe5_\x15\x8e\xe8k+u\xb3\xdd\xf5\xd3\xfa\xfe\xab?>t\xe7'\xb2\a\xc1\xe9\v\u07f0\u0570\xc3\xf9XWM\xcb\xfe\u01b7v\xb7U\xfftC$\x16b@wB\xae\x05\xbe\x13#\xf1WV\xb9\xf6\x82x!8\xcb\xc6fA\x04\xef\xf8F\x87EV\x8bV\xf7E\xf7\xfb]\\z\x03k\u022e\xfd_}\x01\xf6\xeb\xce\u0537a'\xef\x06u\xa2\x12\xa7^\xe8>\xd3\tP\xd8\xe8I\xf1<\xfd\x90=a\xbbb?&\x18E\xac\xa2\xcdSHt=\xd8\xf8d\\\xeb:\xef\xc9[I\xe5-^\xe4\x1f\xfb\xe1H\x87A\xa8\xae\xf9\x9f\xf1\xef\xcc\xff\xf9\vQ\xe3\x14m\x1b\xe9\x05\v\xf4\xfb]\x9c\xac\xdb7R\xf1\x83\xd8F\x86\x9d\u012a'\xad\xb1*!;\x0e!\xc5\xc0s#\x90\xcfk\x19\x98\xc9v\x88*\u0481\xfd\u0734\xb5\xae\xe5\xcbx^\x95\x88\u07feM\voE-\x89\x8fw\xf5KP\x80\x1b7^+\r\xd4\xea\xed\x89E7)\x97\xcf/\x81N\xd0fNy\xcb_\xf9f\x9b\xb1\x18\f\xc6\u0165\xb95lT\xd5M\x17.5\xf0L\xc2\x1c\x1d\xe8\x1e\x8fs\xa8\xe0LN1\xff%\x977\x18\xf1{\xb9\x8e1\xf4\t?wi\x86\xcew\xe2l\x1ed\x8d\x88O\xd1l\x8fXS\xfa\xb4\xf0\xac(\xc0/:j\xa9f\x93\xad\x13\"Dp\xa5\xe1\xf6\xd5\xe3\x00c\xc4H\xea<z\xbbO\x84\u06b4\xe1C\xdaw\xfe*h\x9b}\xabM^TBcY\xb5\u015b\xe2\x12F\x15\xf3\xa55\u023bP20I\xc4\x16\x1d\x88\x02\x1f6\xab\xe8\x10\xf4E!cns\xf0\x13\xb5C\u0698\xd6n\xf8j\xb2\xb4\x9d\xb6\x19\u0520\xbb\xb7\xa7\xa1\u076c\xbcp\xbf\x85\xd6\xfcx\xc0Zm\xe3%\x9e(\x16\xa4z\xca\x14\x11\xdbt\xef\xf4\xe3\x96\xcb\xde\xc7\xd9\f\xad\xcd\u0279\x97\xb0B\xfd\x0f\xc1\x04\x86\u0463AX\xa9h'[l\x90-\u0465\xea\x84x\xb0\x88\xceJ\xc8JJ\xb0\x1f\xf8\b7\x81_K\xbe\xff\x1e\x8aCj\xe9\r\x7f\xfe\xca\xfc\u021b\xd1\xd1\xe6\xe9\xedS\xe3\xceH\x94\xfaZ\x85I\x05\xa6\xc6Jl\x8d\xff\x1f{\xdf\u079f8\x8e,\xfa\xff|\n\u03dc\xbd\a2I'<B\x1e\xdd\xdb3\v\x84\x10 @\xc2+\t=\xbd}\x8d1\xe0\xf00\xb1!\x81\xcc\xf4\xf9\xecWU%\u02721\x8ft\u03dc\xdds~\xb7\xf7\x97\x9d\u0116K\xa5R\xa9T*\xd5\xc3=\x10\xce\xdc\x0e\x95\x7f\x12\xfe\x06{^\x95\r\xcf0\xf6\xdfl\u22c3?D\x98\x89o\xc37\t\xf6\r\x1d\xb3\xdfl\x1b\xf4\xa2\xd5\u058d}\x9d0\x91\x1f\xaedo\x82Q\x1c ^a\u05be\xb8/\xe5\xae*66\xf7S\x90&?\x84\xac\x9a\xca\xe2\x9e,\xfa\x11M^\t\xf9`\xb3\x8d-\xbe\xc9\xce(.\x99\xe5\xd6\x19'{Z\xdc\x7f]\x8f\x7f$4\xde\ufaad\x8d>\x15\xf7\xf1|\x97J\x84Y\xdax\u02d5\x8bv\xf9\xcdF\x8b\x1b\xffZ\xbdT\x97\x1f\xae\xb3\xb1)\xdf\xf0\xbbr\xdf'!\xc63\xfeE\xf0\xd2W~\x16\xb8)\xde,K\xc5b\x15\u054c\xfc\x9eh\xd2\xcf\xc9\rwj\xfcW/\u020d\xeb\x8a\x7f\xa0x\xb0\xed\xb2\x96\na\xbe\x93\xd2j.\x183\xdcp\x1ej9\xdfL\xff\xbe\xe7\x1b+\x1d\xd0h\x17\xc3KxWS\xbc{\xc2\xf64\xb9\x9fI]\x06\x1d\xb9Lz\xac\xf6 A+\x10\xc5n\x05\xaa\xf3\x86\x14$A\xe4(\xc2-\f\xbd5\u0505\xc6T<=T\xe3\x91\xfa\x8c\xdf/\x81\xe3\x12\x8c\x7f\u01d6~\x8f\xae@b$Q7'\xd0P\xb9\x8ac\xdb\xd8\xf69\xa1\xf0\xfa\xb5\xb3\xa1\xf1\xf3\a\xa4K\xc0\x90 \x91o\x95\x7fG\xe4\u04a9\xf0\xdc\x14K\xc1c\x81z\xbf\xa7\xe1\xb7O\xa8\x87\xde\xc6\x19]=<\x01\xc2\x12uLq#\x93S\xac\xf8A\xae|N\xa3jH\x86\x02E\x99\x8a\xb7\x84\x7f\x1f\xcaP\f_\xbc\n\uaa83\xf8\x16\xa6\xaa\xd3\xe7\x01\xae\xe2\x89J\x0e4^\x86~w\x1e\xa3\x84\nA\xc6\t\xc0\u06d9\xdf8\xb8\u054fw\xe7>,\xf1H\xe6\xfdMlHW\xb3\x92\x13\xa11f\xcd\xc4?\xfe\xb7\xb1\xa0\xc9o\vx\x01\x9aM\x9f\xee\xc4}\x04\xe4{\x180P\xa7\xc6\u01c3\xa6\xb8?z\x03\aB\r\u04b5L(\xb2$\xbd\x81\x05\x01^\xf0\xeb\xcdG,,]\xa1d\t\xa7\xdc\x123\xab?\x87\"G\x98o\x1a\n8\xa0\xab\xf3;$\xb8\xcf\xe1\x99\n\xa1\x8af\xe4dM\u03546\x1br\xcf\ar0#:\xfe\x19\xc54=\u8e6c\xc3o\x1am\xc7x\u01a0T\"<\v\x80$\x00!<\x03_lpz\x12\\\x8a>\xe4\x1e\x1fX\"Y\x03F\xd4n\x1c\xb02\x12\x01\f\xef\xb2\xc3G\xcb\xd6)hKB\x8bQPt\x03\xdf\u023c8\x9e\xf78\x1c4\xf9\u0376\x8c|\xa5`n\u0507\x98\u04b31^\x91\x11\x8fm\x9dP\x8c\xd4\t-\xaa\x14\xb0;x\t\xbd@\xf2\xc0\xe9\xf2@S\xcb4\xaf1\x060@b\x87\xf5\x19y\xd1,\xe4\x1cB\"\x98\x1b( \x98\x9eE-%E\x9551\x1c\x93\a\bF\r\xed\xef\f\u07a2\xc7\xfe\xedq\xa7\xa7\xc4\ay~eo\xb5x\xe2\f\xd4,\xbe\\`H\xa4\x15\x18x\xa3\x1d\xf7.\x148\xc6\xfb\x1f\xbd\x1e>\x84e\x9a\x04\xc0\xc1L\x98h8!?\x1d\x86\xfa{\u011f\vs \x89 \xc7\xde\xd7@\x12\xcb\r\xdfY\a\x1e\x1e\x10\u0240\xb3\xf9\x1e\xe7\u0383\xc2\xe9\r\x17\x80\x01\xa45\xdf\fx=Z+\x03\x94\xd6g_r\xbd\x9d\x87\xb3b\x86\u0652L\xe8y\xf6\xbf3\x7f\u0401\x86\x7f\xf5\xc4/Po\xe2\x02k\x039\xbe\x98^^s\xa1\xd58\u030a\xf5Z\u05a7\x9b\xd2\x0f\u0368\xf8\x96\xe92\xbd\u0254U\x834Y\xf3\xc4K\xbd-C\xd0\xe9\xb1\x06+\x1f\xbd\x02l_\x912.S\x188\xac\x8e\x89\xb5\xd90u.VD\x9e;.\x19Y\xd0Y\x94@@\x95\xc8\x03m\n7\x19\xd8F\n2\xb6?\u030c\x80\xfb\x96\xd7?\xffs\xd2%CO\u01d4\x19\x80F\xbc\xe6\xf8\x02\x90\x82\xac\xa8\xe8\xa0a\xa1.@W\xd20\xa1^\xc9H\xb8\xe8d\x14\xb0Ys\xb6\xef\x04H\xe1z\xd5\u02a9\x90\xa1WY\ts\xb5s{6)3\u010e\xec\xd9\x11o]\x97P\xc6\xdd\xddk\x04(\xf5\x010\xbd\x90p\xc5\r\u030a\x10\xb1\xad\xc6\xfa\xea\xcc^\xe1d\xb8\xde\xe05m\x83\x93\x15Z<\xf2\xd9r\xa0n\xaa\u6ec3\xf7\n\x16K\x18\x81\x82\u03f2\xb9=)\xdbsW^H{%\xb5\U00031692T:\xaa\x8c\xe1M\x8d\x92Z\xf2\xcf\xca\xd5f=\xf7\xa5\x96\xbb\xa9\xd6\x1a_.\n\xf5t\xe6:w!\\\xbcnt\a\x17\x0f\\-\x8c\xcc\x1eU\xb6U<\x1d \xbb\xc0\x14\xda\xf8\x8b\x14\xcf]^\x81\x14^\x81\xb6\xc1\x13\xf8\xc8\u029bP\x17\x13'\x94M\xc0\x92\xad|j\xa99\xf6|\x86\x89\xb1\xd4Dup\x97\x8aY\x9f\x00\x02\xd5F\x94`\xbfH\x9fA\xaf\xbe\xb5\xf2R\x8d\xcffK\xf6F\xbe\x8azM\x9b\x93\xe1\xc4~\x99|\x91nm\xe9\xc9R\xfbiD\x9d2\xce\xedb\x0e\r\xf7'\xb9\x98\x03\xec{ \xb3\x82E~\x05\xe9\xa1E(\xab\u0580\x8f\x99\u0304\x12\x8e&\xca\x14\xf2HpB\"[/|\x91#\xe0}\x97\xf9'_xd\x83\x82\x1dSh\xad\x91\x1f=(\x92\x02VD\xb9\xb8En\a]\v\x8e\xe5\x80 \x99\v\x03\xf2\x04r\xbfL\xa8\x9bL~G2\xdf\u812d;X\xaf\xba\xd3\xc7\x15\xe8\xa5S\x12\xfd\x87\xa3(R\x18B}o[\xd4#\x9f\x8a\x10pN>\x03\xc3\u0340\xa6\"G\xcdJ\xb99\xeaK\x872F\x94\x81\x1e\xb7~*p\x8b\xd9!<\xeb\"\xcfe\x1d\xa8\v\xfdbF\x1c\x13\xa3\x1f\xb9b\x89U\xa2\xe5<\xf2\u0308\x13\xb6We\xd5\u0088|9\xb9\x06d\xf9\xbd\xb6\xc6\x16f)H\xc4\xd8?\xd1YVI\xbc\xe6\x98\xfd\xf9\b\u04a1.\xc0zFI\x83\xd40+d/\xf0\xa0\x7f\x87\x05\xc0D\xb9V\x98(\xf7P\xe0\xae$%b\x8c\xe1cL\x80\xf64\xb7\x8c\xe1h\xa9\xb9\xb0\xe5I=\xdd\v\xfa[\xcc\b\x90\n\x9c\xf4P\x11\xe2d\x80-\x95R8b)\xf4\xa8\xb7\x91e\xe3{\x87c}\x1a\x15\xae\x19B\u0399>\r\x89\xb4\x84\xc8o\xbf-\xc0\x97\x9e\x12\xec\xbcN\xf5n\xd4D\xb5,\xcb\u64e9z{\x873\x9b\x94\xceh\xfc\x84)>\tq\xf7\xf0uOI\xab*\x82\xe1\x8c\xf8\x8d\x0e\xa5R&b\xa9\xd6\xcc~n\xc1v\xe6O\xd0\a\u0f2fE>G|\xb5B(,\x02)\xc5t\x83\x15J!\x85\x94\x9a@ VD\xf5iq\xbb'h5]\x8a<iPKWf\t\xc12r\x87\n\x92u\x06s'D\xd9\xf2\xef{\xd8r\xfd\x81\xb8\xc1\xa2\xf3\t\x15m\xa3\xaa\x83\xd2E\x8f\x87\xef\xcfzB\xe5\x10\xbd\x044\x91\xe8\x1bA\u00c8\x90\xe7\xac\xc9\x14*\x89\xe0I\x88\x89\xab)\xc8\x7f\xca~\x0f\xaef3\xac%\xefRS\xba\xd9\x1a\xeb\u0390i\a#kh\x06\x91\xf0\x84\x007<s|\xa9j8\x9eF\x04v\xc2]\x01\x86\xa2<\x8fF\xd8P\u07dd1j\xfdN\xcaB\xa6Z\x16\xaa1;\x01\xc8\xcc`rg\x959Q\xa1\u0334\x10Z\xda\u067b\x8e5[\xe5x\x97\xb6Q\xfa\x92\x9d\x17\xd74\xa3j\"\xca\u058f\xc6\xfa\x01\xdc\xf2\xa1/\x80F\xc9\xeb\bL\xd7\ua89f\xb3\xed\fA\x19;E\x90B^\xb9\x94\xfb\xc7d\x8a\xeah\xc4\xeft^l\xa2&\x13*\u05b3>\x12\xc2\x13\xd2\xe2@*\xa5\x81\xed\xa2\xeb\x01\xc4e\u06d0\xcf]l\x98\xecC\x92\x12<\x87\x98o0w2\xbdY`L(J\xd9b\x10\x89\xa94)P\xa0\x96\x8c\xc3\x19E\x7f\xb6!M\x94\x86\x95T\u0739(\xdf\xf4\x13#\xa9\x05Y\xc1\xf4\xd1O\f\x0f^\x03\x80`\xa2\x96-B\xb0;\xd2a\x93\xf3\x0e\xd7y$\x00\xf8\x9c\xea\xc0[\x93g{\xf4\x8c\xf9\xfef\x11\xb4i\xb1\xaf\x9c\xa5(\x1e\xacj9\xe4\x8dv\x96\xb1fB\xfd\xf3\xc9\xf50\x16\x80\r\x01\xa9\x05r;\x95\xf0tj\x90\xf0X#PT\xac\xc7\xc8r\xcd\x18YS,;\x1d\xdauV\xbc\xa5\xf2\x82J\xac\xa3\ucf26l_0u\x11t\xd6\x17\x05\x0f\r\xaf\xe2:i\u07d4\xe8\x13\x97\xe0\x1cd:)/<\xe9\xd0E.\v\xb5\xfc\xa0T:l\xc8&;\u11a2\xc5\xd6J<\x11N\v2jM\xb18\xb1&*\x02\vk\x0e\xec\t\x18\xc1\xcek\xbf*\xf5\x93\x06\xa2\x9e\x83\u05d7\\\x0e9\x01\x86m\xe4\xb4:\xfd}\x96\xf5\x858\x92\u049e9\x9fx\u0320]d\xeb\a0\x1b\a\xdaM\x19\xb6\xfd\U0010dde12\xbe\x01W+\b\xe6\x87;'\x027\x9f\xa2\xc5H\xc9\xd6g\xd0\xe5\x90dvJ\x1d\t+\n\xf6i\x1ek\xcf\xcd\x19\\\u03c5\x13V\xb4\xde`B\xf7\xb7\xc59\x14\xc4\xcb1~`\x1bTd\x0f\xef\x99\x01J4\x93\xbb\xc6\xf7\xb1S\xf6T1\xb1\fLQ\x19\xe4'\xbe\x99\n|\x7f\x82\xec\x05L\xee9\x01R\x8d\xf5\x05u/N\x1c\x8cT\xf1X\xe2\xd8O'\x99\xb4\xcf\x1cc\x12.\x8c\x03t)\x7f\xe9\v\x95wF\xcaq{\x93_$Ay&\u050e\b\x96\xc7\u05f0\f_D\xb4\x05\x9bX\xbb?\x81\x9a\xb96*\x1d\xecHl\xcd`\xd1!1\x03X\x03\x06\u0349\xcc\x06kvC\x19\x9c\n\xfcQ\x14\xb8H+\xa8\xe0\u0154\x03\x17S\x97\u259b\x8f\x1d\x1e\x1e\xe6\x93l^\xd9:\xdc[\xc7Pe\xf8&\xa0\x7f\xabGfWlf\xbe\xe3\x13\xbf\x8b\x13]\xf8Q8\x94bP\xb4\xe3\xeb\xbcY?J\u05f3\x85\x02\xb4\xc2b`K\xda\xe9t.\xc1\xf4\x11\xa3\r\x17w\xa8\x8e\xf3\xe5(\x048%F\xb3\xa0V\xdb\x10\xa2o \x13\xa4\x94\x9aR:\x82\xfa\xc5@\x18\x03\xd1m\xdf\u0467\x03\xcbp\t\x9a\x0fW-\x9a\x9d9\xa3w\x95=&\x8bAc\x9f:6V\x1e\xa4\x99\xd41\xe3\xa4-\xa5\xbe\x00\x04_\x120\xcc\xd8!\xa4\xa9k\x8e\xf0f\x13R\xf4._\xa0\xa2\x99\xack\xe3\x98\xe8#\xae\xf5\xe7\xacs6\xbd\x90)W\xe7\xd9u\xa05A\x93\x15\xa2\xa6\xb2\xf2\x96\x8e\xc0@?\x9aY\x06\xaa\xaf<\xba_\x9d\xcc|L\x1c\x12\xf3q\xf9[B\xfe\x96\xd4>\xfaR\x1b\xa8\xb3\v12\xec\xbf\xd1H&\x122\u03f4\x81\x8a\f+\xbe#\x8b_\x06\xd0.\xa6\x03\xeaX\u5117\x95\xed\xe0IE\u0518\x17\x87n\u0327\xc1\xef\xe9\xf2\xd7\x00\x8c\u03cc0\xbc\x02\x11\u038fy\xf1d\x04\x15[$\xe2\x00\"\xb68\rJ\x1f\x8f\x19\x11\x14\xe0\xc1\x06s\xc0\x98MCf\v\xd2\xea\x1aDg>\x16Y\x1d\xed\xd9_?\xda\u068e\xa3\xd5\xf9h{+S][\x8b\xbe\x882\x91;M\xa0\\d@EA}\x86\xeb\x98Z.[N\xbfK\xa6\xbc\xca\xd9\x18\xd0\u0737\x85@\xe77\xf9\x1ap\xb2\xa2R\u022ex\x12\u0151\x8d\xa5=g\xb6\x1d\x147\u062c\x8e\xfb|\x93\xe9\xcf+\x99\xaa\xd4\x06\xd7\x04%pn\xac\xeb\xcf\xe8\xc7\n+F\x9c\xbf\xd8&]\u03d2z\xec?\xa0a\xf6\x1c\xd24\xdc\x19l]:\xf9%\xb6\x1a\x04\xe1\x80\a{\xff\xcc\x0e\xbe\xb4\xdf\xf3\n\xc8~U\u07c5>\xc3m\x14YT!<#\x85\u07e1\xa3\xc2\xf4}\xb4\xf90)G:\xa5b\xa3R\xc2]B\x8d:\u071c\xcfA\xc1\x18s\r\xae\x83\xb0\xa3\xad,\x00H\xd6!\xea\x86i\xf4\x93\xa3\xf9\x94w\x87s\xbb[\x9f\xd9\xebB\xb6\x04;\xe4\xda\x0e\x13\x1b;\x04\x86\x01\v&\xde\x14P.\x7f\x1d2C\xcf /\xa5\x8b\xcdv\x1c|-\x9d\xd7\xd0/CVR\x96V M\xc9O\uecc2\x8ak\x1b\xb6P\x87\xae?\xe2_\x9c\xab\xe4\xe9\x12r\x81\xce0\xbc\xb3g\x99\x90\xab\xb3'\xac?^\x96&:R\x1ex\aQn\xa9\x16\xcfE^N:\xae\x8a\x03x\u041c)\x9e\x7f\x95~\xfb\xec\x81OT\xe1\xf7\x8e\x0f@h>!\u05af\x97G\u023bw\xa3\x88+\xdfx\xe5aX%\xb5BA\xd5\x0f\xdaC\n\xfe>\x10=\x85\x84\u04c9\x80\xab\x8fZ\xe0\x89\x97\xe1\x8ea\xf8Q\xe2\xfa\xc7\x1f\xfe\x94\u040c\x8e\xe2f\x84|\xf9\x81\x10\xeb\x81\xe9N_$w\t\xcdT\x17 \u06c1o^\u011c\xad\xa5\xc1\xa6\uc12b$\xc0&\xf8\xf1\xa5\x8cB\xf3\xa7\xba\xce\xcc{Qe\xe0\xaa\xc1\x04\u07e7\x859.\x10C\xb8v<a\xcbv=\xfa>\xdc\xd6eZ$z\x87\xcd\xe9\x1a\x94\x88\xa2>\x82J\xb4\u00b8\xd4\u01e1  )_<f\xba\x9e\xf7\x0e\xc4T\xa3\x1a\x05\xac\xb1\xf3\xf02\xc8X\x1b&\x888O\xbaO\xf2\x89P=(\xa1V\b\x7f\xfc~\r_\x86\xd2@\xdaQ\xb5\x91\x05\xe6\xa6\r\xc3\a\xf8\xac\xf9\x97W\u04f1=:X\x13F8\x91\u071eR\n3\xce\xfe\x14\xfb\xbc\xf3\xe8%\xef\x04i :S\b\x01\xb0\x0f\xfd\u05d0\xaa_\xa9\x8a\xe1\x8f\x1f)\a.f\x98\xe0.\xa6\x12\x06\u00cf/e\xd1\xdeG\x9f\xbc\x89\xa5'\x04q\xd0dM\x01&}\xefjL\u0407\x92\xa5}\x85\xd6\xecW\xb2\xf9\x8a\x0fy)\x044732\xb2-k\x17\xb2X\xec{\x95\x18\x04Y2X\vH\xad\x06t\xc84L84j\xad\x84n8\xea]\xb8\x83\xc2\x00Wca2\x8b\xa27B\\\u050bD[\xbe\x87=#)\x92\x12\x8a\xfd\xf0\xe4\xbd\\\x14\v\u13b3~(o\xc7\x118\x9b\x97=/\x9a\xd4\x13\x81\x88\xf6\a_\x84\x809\x13\xf9\x85\xf8\x13\x7fSeF\xd2\xddg]\x9c\x8e\xfd\x06\u0535\xc5\xcf\xf0TK!64\v\xdc\xf2\x88\xebS'x\xbb\xcc\x06o\xaaN\x88\xe1\u0559\x94kl\xff#\xf5\xb8.\x8b\x8fc\x82U\x14v5P-P\u05a8\xb6]/+\x19f\xa6\x15F`\x1c+@Z\x19\xae\xf0B\x11\u02f3\xb1\xbd\x8f]F;5\xcdaM\x80\t\b&\xbf\x03*\x17L\xe2\x1a_\x10bo\x1d\x01\xa8l,z\xaf\xa8&\xcf\u025fM\x04\xecgM\a\xbbR\x00\xac\x02o\x1e9[H\xdf5x\xac\r\x16\xe4su\xd8h\x1c\x06\x16\xfeK\xc7\x0f\n([\xff\xdfD\x02\x88\xfcXC\x04\xc5-\x9a\x8f\x17\x1c\x9d\xc6\xd3\xd9R\xdcM*\xaa\xa8\v\xb7\xb1\xb2X\xd8N2\xd3\xcd\xda`Q\n\xcb\xc5\x1b@ZdB\x95):` |S\xf9\xfbG\xb9\xa2\xd5$\x0e\xfeC\x90\xda\u00f3*\a\x9e\xf1V\xeey\xf6A=TE\xf7\xd6CR\xb3\x01\x80\x91~M\x1aa2\xe1~\x94\x9d\x1cz\x15\xe1\xd9W\x04\x8f\u06ee\xe45\x88\xaf\xce\xd0\xea\x87}s\x16\xc8\x0e\xbeG\x81^*\x1c4 \xc8o\xf3\xd7\x1f|Gs\xef\x85R\x84\u01b3\xcf\xe0\x1bO\x1f\xf6\xcc5\xf8\"\xee\xbdH\xf8^$\xbc\x17I\u07cb\xe4Nd\x84[38\x04\x87S\xd2G\x02\u0794\x93O\xa1\xb4B\x01?\xb1Wh\x16BmA\xc5\x00\x10\x8f\x94\n\x19\x89x\xf2E-\xf0\x89g\xea\x8a\xf9?\xf1,_q\xff\v\xcf\x10\x96\xf0\xbfHz\x16\xb2\x00\x19w\xcbc\xee\xe1\xb2\xc1\xa4\xb62\xd3\xe1mcj\xdb\xc4\x1b\xe0&wh\x1bb\xfb\n5'}\x83\xcd\xe3\xed\x0e+\x8a\x18\xbcB\x17\v\u03e1 h2\xa1\x02\xb0\xdc\xfcO>4\r8\xea3\xb1\xfe\x93\u6686\xd8\xcd?\xa1\x7f\xd3\u7d46\x86\xa0\u01cd:\x9ff \x9b\xado \x9bF\xa2\x86D\xc9{o\x13by\xe1\x06\rV\x11\\\xd1\xf5\xb0r\x8a\x83\x9e\x15l\x0f1\xc5=\xbf\xf8[|)<40\x9d\x9e4Ba9R\xbb\xab\xaa\xf5L(\x0e\xac\u07acd.\t\x01x\xfd\xc7G\xed\xd8{?6g:{\r\x92<\xeasP\x02\x7f\x02\xba_\xd3G\xb3\x82[f\xed\xb0\xd2*\xfc\t\xf0|\x00\xcf<\x80\xc6\xcc\x19\x05\xfb\x8b\x9f\xc81W/\xaaQ\xa7oM\xba\xfa\xde{0,r\xdf\"\xcc\xc8,\xec\x8b\u0098\x84\x16\xc6#F\x13\xf6\xfb\t\xe8\x9cLL\x98\xa2\xee$]\xf6\xdbN\x17o\xab4LL\x8d\x86S\xf0Z;\xe0\x0e/S\x1b\xa6\x9f\xe9\xe3hl}\x9cCA<vN\x9b\u0360\xbeJ\x01\u02a9L\"\xdcq\x00oG\xb8[\xfc\xb3\x85\xb70c\u0750\x16}\xeePL\u06a0K\xb7|\xae\xa0:T\xb6\xa6k\xa4C0\xc9f\xb9\xe7D\x94\x17,\x1a\xe9\xe3i\u0514\x94%\xb7\x17m_K&\x0e\xf0\aj\x8a\xc9\xccx\xcb7\xc1\xaa\xd9/\xab\x80 \xa4\x9b\xee4\xa0%D\xef\x89\\\x9e\xe0\x9a\x1ay\x19\x98\xe6(\xf2\xde\xcbyC\x8b\x05\x1f\aN*\xdc6\x17\ar$\xb4\xe9h\x8e\xc78\xbd\u06f5\xf8\xe1\xf5\xe4X\xe4\xbd\xe9`\xc6\x03\xd6a\xd7\x1c\xcd\xf4\a\xb6\x18\xa1P\xee/\x90\a\xf1W-\xc6\xce\xd4qH\x88\b\xc5yD{\xc6\x18\x8c\x8a^\xcd{\xe2q\x101\xbf-\xe2\x9dOep\xc2\b\xa3D\a\x00A\x89\u06a5\xac\xf3\xce\x06Q\x82\x82 3_\xba#\xacS\x83\xa5\xa8\xa9\b\x16\xf9\x8a\xb3\xa5\x8eBC\xc9|\xc61b\xe3\x1er\x90D)\\\xde`\x95T\xa9\x95A\x9a\u041d\v\x9a\xb4}\xa4\xe2'%$U2!:E?l62,|\u03f0cd\xa2\xf6\xe0K\x83\x13\xa8\x0e%\rfRk!\x14\u03f1\xb2\xda\xdd\xc3\x15\xf2}\x17\xfd6\x8e|>]\xe5\x92\xf9\x14\xad\xa2\x13[\xe4\x04\xe4R\x95\xb2\xb1s\"\xb0u\x05udM\x88y9\\\x8b\xdfo\x8bD2\xb2#*`5\x96\u023cA\xfc\x82\x9d\x18\xa5\x16a\xe6\xaa\xceOpM0c\x12\x86\xc98\x818D\x83\xf3\u06d7{\xd8\x054\xdc\x16\f\x9b;tP\xe1p\u05eb\x8b\xab\xc2\xe2 \xd0]\x8c\xa7\xbdg\x88\xa2\x7f\xe5\x7f\x92\xa34\xb2\f\xbe\x87D\xfc\xf4\bn \xf0\x8a\xb7\xbbw\xa0B\xe3w\x97\uaf4b\xd2/\xfb\xcd1M\xde%`\\\xe8\xb1)\x99\b\x1b\xf6\x18zR\xa1\xc9NgpeMC\xa3@r\x8b\xbb\x13\xf2\xe9b\xa0\xee\xcc\b\xd3\ucef6\x8ca>\x94\x90\x80\x85\x15V%gR\u01f2\x1d(\x1d\x8a\x97\xb3\"/\x15v\xf1\x1eG\x7f\xc0x\xb9\xdb\x05\x81\x8b#\xf6\xa0\xd1~\xc1\xc7\xc0h\x14[\xc4\xd5\xe9A\xe8|r\x91\x8a\xd4\xf2Pi\xd0\x01\x9bA\xec\x83|\u00a3\x02V\x01\x1f\xaf\x03L\xa8\xad\x03\x1d\xdf\x01tb\x1dh\x9a\xdf5\x90\x13+\x90W\x80\xe0|h\x03\x06\xc5t\xe4L\a\xe1$\x158\xbeiIw\xbbl\xaa(\xe5/\xe5\xee\xe4\n\xd3\xd8\xe6\xe7\x7f\x1f\x98\xc0\xa4\xee\"\x81Bd\xd0\xf7I!9\x80U\x19`\x8c,c\xc8\xd7?=\xe9vF\xeaC\xffG\xdc\b&^\xc1y\xdc\x1e\x99\x87\xa6\xe3\xb0cJ\x84;\x16\xaa\n\xe4{\r\u0424\xcd\xf2@3\x83[\x82\x12\x90!\x06\xa8\x98C\xa5\xc6d\xd9\xec\x803\xe9rOI\xd9\xd2_\xd7R\xf8\xa2{\x0e\x9f\xe0\x98\xa58\xef\xf3\xab`\u0149\x11M\xe26M\x85\xe7s\xfe\x83\xe2\xec\x10\xa8\x9e\xd5P\xedAl1wL\xeeA\xd8\x05\xcf\a\u0519\xfa\xc2\xdf!\xc2]\x8a\u0789\xeb\xd9\bH\v\xac\x89\xb9b\xddS\x8c\x05r\x18\x8av\xec7\xb9\xcb&\xe4 \xd8\xe5\xb5\x14\xf0\x0fl\xba\x950\xbc|\xa7\x97z\xab\x03)\xb2\xc5H\U00032643\xdb\xe39(\xe8\xcf\u0312N\xe3[B\xd3\xe0\xea:~\xa2\u0714I\x8c\xb7\x0f\x9b\x8f)4\x06+\xe8\xb0\xee]\x00A\x13dQ^\xc7\xfc\u01d5\xa6\x9e\x11&\xba\xa7\x1a\x9d\u057b\x19\xb5=<\xf7\u00b0\xe8\xa6b\xa5\x11\x9ab\xa4\x1a\x82\x16\u02556\xec1_<\xa1}\x1cB\x99\xc7(U\x80\f6\xd8\xe3\x1f\xcam9\xf81\xec\xcd\xf8_\x91\x91.\x80\x1c\xbc\x87\xff(\x19\x12\xc2\xf0\x83f\x92\u0168\x11\x14\x82\x8f\xdc\xd0\xc5X\xd7\xeaR\x89\xb3\x91pu\u01d3\u044f\x115\xc5\\(\xc3\t\x8e\xc2|\x06\xc4tX\x9fqb\x878\xa2z\x91\x01:[(\x16\x85\xca:s\xee\x9e,y\x06\xbc\x8b'\xfe( Q_\a\xbfR\x12#\x1f\x88\fsl/\x06\xf7\xab\tUq\xd4\u0570\"\xf25b\x8d\xb615\x8d\xe1M\xbc\f\x16\x99PF\xde8\xa1+/\x02W\x86\xbe\xbch8\xe4/\x9c\xff\x03[^\xb8\xb0\x90M\xd5)\xa3\x97\x9e\x80\xf8\x93\x84\x19\xf7\xae\xdeH\x82\x10\x9fJ\xe9T\x19R\xc8\x06!\x82\x7f\xb5\xb7\xe6efo\xe7C\u0218\xe8^\xe5\xed\x03\xc2<\xb3\xe8#\xee\x05XQ\xe0\xaf,)\xf0\x02\xd1\xfd\xa3\x11\x0f\xbc\u2f0e5$\xc1?\x90qxWT\x02P\x19\xab\u0266\xe4\x8c\a\xe8\x12r\xb8\xab\x88\xeb\x1f\x82s\xb8\u0586.\xfa\xf1\t\xd9-3\x80r\u06f7\xa1\xc0\x837L\x84\x140\xaa\x17\xfb\xea\xec\xa8o\u51b4\xc4*\x0f0\x06S\x1f{1\x9d<\xf8E\x16\xbcQ<\xde\xd1\ua3bb\x90\xa3\xbfH\xef\xa6\x03\x8aF&\x0f}\x10\x12\xabQ\x1b\x83\xf9dX\aW\u03cf\xdaY\xfc<!N\xfe`\t\x12\x81\xbba\xb1\xb9\x88\xa2\x97\xa8\v\xef\xcb\x04(\xb1\xda\x18\f\n\x12\rQ\xb9\x0e\xa1\x10\xef2*e,X\xf0\x0f8Tw\xde\xc1\x10l\fq\x85\xe0\a\txo/\x98\xdaK\xdd\u01e1?\x11\x01\xe2\xdf\xcfqz`\xad\xfa\xb7Y&7\x91]U\x8b\x1d\x18\x7f &u6u\xdf\x1f\x1d\x99\x93\xc3\x17khM\u036e\xa5\x1f\xdaN\xff\b\xfe:\"(\xeb\xf8\x87\xce\xe1\xb0\xdeBW\xb1\x12\x9e\xef\xb5\xe4+3L\xbc\xf0\x05\xa5\xc4\xcdS\xf7[\xf8w[\xff+\x01!\x82\x8a+\x98\xac\xb8\xff\xac\xb8\x0f\xa1G\x13*w\x18\x1b3\xf3B\xedE\xfc\x10\x1d\x14\xe3\xab\xf1It\xab\x15\xcd\u018e\xb2\xf1@\xc0?\xeea\x9f\xb2\x8d\xda\xf5g\xe9\xe4\xea\x15\x963l\x8cF\xe5\xae\xdf\u00bf[\xa8\x98x\xcf\u01b76\x91\u57eb\xa7\xfc\xdc)\x12e\xf9\x11\x91\x1a*\xd3{\xf1\xf4\xd8]Kf\x7f\\\x90Bio\x1f\xe2\u16d0\xd0Uw\xd8:T\xa3\xa9\xd4d\x00\x1d\xf0>\xc40[9>\xb1>IC\xf2@\x92n\xa4jX\xca;\xae[\x85\x05\x15\x1dB %\xa6\xbd\xd5P\xbf\x110\xc6<\xd1W\xe87\xe6\xc24P;\x16\xad'<\x11\x04\x05Q\u0437\xbf\xd2\x7f\x0f)5\xc8{\u037b~\x93Y\xb9|\x9fa\xf7BD`2\xe3\bz/\xce\xc7\x1d\bZ\u4588\t*\x1d\xa1\xc1f\xc2\u04cbOQ4\x92\xcd\xc6#\xe8Q\x85\xf28=\x8bB\a\a\na\xf8\x11J\xa1\x14\xbf\x98\x8d\xc6\xf7>\xf8\x8c\xe1\xca\xe1\xeaG\x1c\x96\x82hC\x96\xb6\t\xd5\xc5dYy\xb9\xbd\x04\x14\x0e\x98\xae_5\xe5\x9a\x15\xe9\x80\x04[E\x10\xd5\xf4h8v*P\x0f\x1c\x1c\xf3\xf0\xdaZ\xa1\xf6\x9ew\u0772\x81\\\xea\a+d\v!\x9a:\x9d\xef\x90\v\xf7\x83\xd7\xc47\x80\x9d\xba\\E\x8a}\\v>?v\xd6\"\x7f\xbd\x8b&\xe9\xa5\xce\f\x8d\xc8Z\xb3J\x91Lk\u0569\x1f\xc3}|\xf9\xd6\xfd\x89\xdf=}f?\"\x17\xaa\xb8\xb8U\xdfyz\x95\xff\f\x8e\x9d\xaf\nT\ny\xd6e4\xba\f\xf7(\xc0\xdf\u0779a:$\xcc\xc0\xee&\xe6M\xb3f\xea6\xf5)[/|\xa6\xe0V\x88\x82\x9f\xbbfo\x0e\xee[\x10\xa5OvP\xbd\x03\xa4\xa2\v\x02\x83_\x10l\x90d\x10\x1f\xbcI\x8a\x91\xb2\x10\x907\u0737\xc2+\xa5\xc3\xfd U\xa6q \u06e7\xa8\xac5\xd0~a\n\xd2?P92\xf0~>\xf2_\x11\xdf\x1a#/h\xda3\xc0\x98\xb0e\xe9\xd7\v\x91\x8351\xcd\xfb\xeb\"\x89A\xa3\b\xab\xa2\xbeI`\x84;U\xfe\xe0\xb3\xc5\x19XA\"\xf2A\x1d\xd0\r\xf03\xe6:\xe8\x9a#\b\xf4\x15\x03\xf1j\x9d\x05\xf1\xf3\x95\x00\b\xf9^\x89\x9f^\x89\xd2F{\xb1\x8e\xe1c\f\xfbn\x97\xbd\x8c\b\x1b\xd9.\xa3\tMf\xf2\xa3\xe2\xa7\x17\xb0Y7 (\x91\xed\xc43\xdch\xe5F\x8f\xab\xd8W]\x15\xcc\xc6\x10A\xa4\x98\\\x11*\xd5k\x8b\xec\xad\xd8\xddB\xde~]\xa57pSL\xe5\xa6s\x95\xf8\x15,\x1cA\xe1\xa9>\x9f\u3a60\xea\xe1\x0fo\x99\x8c\n\x0fW\x97\x9f\xffeS\xf1\u0199\xf0\x9c \x8d\x81\xa4d\u0414+\xdc\t\xa5\xcb\xe5;-\xfe\x99\x14w\x7f\u04995t\xd6T:\xff*\xfe\x00\xc7\xcc\xf7*\xd1\xe5}p`\xe5\xae\xc7\x7f\xcd\xf2\xf5\x10\v\fe\u0772V>\b\x8c \x18\v~\b\x19\x1f\u0678\xf6\x14\xbc\xb3o\xd05\x98\xfc\xf0K\x8b\xa0\x1d\x01R\xcfLd\x04\xa5\xcf}\xcb\xcb\xea\xd0a#\u0418\x90>\xfcaG\x9e\xc0a\xad\xd1b\xd4\xe4[\xec\xc0Bi4\x14M|\u03b4\u0351\xa7}\xae\x8bs\x84\x00G\x11\xde\xf8\xb3\x961\x99:\xec\x8bpTmH^\x86+\xdd0\xe6\xe3\xf9H\x9f)\xc9\x05<\xf1\x0f\xee\u00da\x06\xa9\xee\x99\x18pL\x9e\xae\x81\\\x961\u0161t\x19\x8e\xe2\t6H\t\xe9R\xbc'\xd4}\x99\xe5\u034b\x91\xe0xA\x8a\x108\x83t\xd9\xf2\x14i\xb1\xa0\x01\x1d\x9e0\xbd\fz\x95u\x96lVLt\xc8\xe0e\xc4T\x17=\xe9\xd7\x0e\x06_\x8a\xbe\xa5R9\xc1\"\xf3\xe1\xe7\xa1B\xcf\x1f\x899\xa6#\n\xd4W\\\t\xf1T\x8dy/`\x03\xe1Ey~\xe0\u047c\xbe(X5\x0e\xb9\x03\xe6\xf8w\x88@\u05cb1\xdf\x10\xa7\x11\x9e\xe0T\x86\x93J*\x81y\xbfo\xe3e\x80#\tF\xd7z\x18\xd6\x04xF\x9e\xbd|g\v\x83\xc9x.\xfe\xd9\xf8\xb4@\xb4\xeb\xb6\x03\x14cK\"\x89\u01cb[\x15\x91\x95SQ\xd0\xcf5\xea;\xb2(\\\xfe\x91\x14p<\x8fE\x8f\xa2p-\xf4\xdbo\x7f\x00o\xef\x1d\xed\xaa\u0144I1O\x02G\xb8\x8d\x17\x9f\xc4?sO\xa4\v\xf0<\xf2\x17s\bb\xf6\x11\x9d\x14\xbc\xcd\u02d6\xc1\xf0\xec-\x9c=\x0ex\xe8\x7f \xcb\b9\xa3\xf2C\x87\x0f\x99}\x1c-\xdf\xd8q`\x1d\u06d9\xd5L\u0775'\x8a\x9d\\\xacQYg1<\x1aY\xb8\x81+@`\xb8P\xdf\x13\xec\xc4tm\xe5\x87\x15\xd2\t\x1e\x13\xab\xbd(\xde\xc81A\xf3#\x0e;\x1c\xb49\xee\x98]`-\x8aY\xf6\xf7\x10\x00\xa4t\xe5\u045bmqb\x1a~\t\u0279\xb2nD\xac\x01\xe8\xceL~[\x8e\u0665n\u00c0\xaa\xc3\xf3@x\x1b\x9b\xb8\xeb\x1b\xd9\xfdhd\x03\xbb\xbf'\f,ID\x0fX\x98\x9e\xca) u\xa6\x95cc\xb0\x81?U\xb6\xa2f\x85\xec%\xde\xf1\xddw\xf8\\\xad\x92\x1b\xe0\x9a\xfd\xe0J[\xcbF\xea\u045fg\x04R\x92\xe5\x90!Xn\x91s\fK\xa7<\x16\f\xdedHE\xab\x04\u04c5o\x9dQ\xb9\x00\x94\xc3u\x90\b8\x10\xffJ\x11\a\xf3\xd8A`0\xc4];\xec\xd0kN\xcb\nY\xf6\xc3\v\xac(\a\xf9\xc0\x17\xe0\x82\x8d\xe7\n\xe4s\xedW-\x81\xfeK>;>M\x8ej=\x14\xa7F\xbe_\xc9\r\x8d_c\x82\xf7\xa2+st3\xa5\x06S\x1b\xa0\x11\x99\x1d\xa9\xe0?\xadF*!R&\xac\xb13\x8a>\xd4\xc4exgm`\xba\xd20\xc1M=;\xb2>D\xab\xf1\t>\xf9\xfc\t>\x91A.?\xf2fj\xa9\x81\xf0\\\x03{\x81\x95\x06\r\xbcKu,\xd7\vi\xb3\xf7\u066f\x06\xa6G\x84G\xc5z\xb5rH\x02\xd3\xea-\xa3\xf0bo\xbd\x1dH\xa2\xec\xe1|H^2\u07ca^\x81|l\xfe\x1c\xf4f<-8j\xa6\xa8\x93\x83\xe5\xe0\x17`\x97\xd3^\u012b\x97\xb4\x92\x05EY\x87\x05XRL\x15\xe29\x81\a\\\u0459\xa2\xfd\x80\xe9\x03\xb4\xf9\xb0\xb5xxx\u023fQ\xaa\xc8Q\x0e,\xc1\rhW\xe7\xd8\x10\x1f\x90\xf7P\x042.\xceB\xf2\xe0\x1c\xfc\xe0\xf9,qXps\x8a~F\xbc\x00\x04M\x81\xccI\xd35\xdd_5\xad\b\x0e\x94<\xbd\x878Vzx\xa1!\x81;\u05e1\x9f\xa0\xe9@\xfa\x02-\x8a\x89D \x9dG,\xb2w\xa0E1\xa5\b\xfc\xd9\xc5?o\xca\xf4\x97)3|\x00\xb0h\xfa\x86\xb7\xea\xb1\xe7h\x97\x06\x8b-\xaa\xd5\x01??\u0619\x85\xe1\x9bW\x8f\xc13\x80\x04\xe5e\x13\x81\x1eV\x94\xebpf\x01\x88\xab\x19y\xdek1\u0214\xb5*Pp\xd9*)\xb3b\xfe\x9cY\xe1\xcc\xc4\xf9\x9c_\xcc\xd0\xed\xfa'o\r\u04ea\xfe\x1c8i@F\x0f\xe9\xe9EE\by\x8c\x9e\xea\x1b\rW\x8a\x96\xe7\x18]\x98<\xdbC^\xb2L\xb8\xe8\xb0Y\xae\x97\x8fjey\x8d\u875e\x80\x7f\xe6\xbe\x04#\x18\xa7FW\x88\xae\x05\xa9\x8fdn\x92\xf5\xe6z8G0\xf4\u0281\xcbUCdV\x9e)\xee\xd4t\x03\xfbQ\x03O-\xe2r\xac\x1f\xac\xe1\xc7\xd1B\xad\x1c\xe6p\xc3:\xa0fe\xbaE\x11f$\xf5 \xcd\xe1&b\x02pz>\xb3\u01d8*\xb9b\xbe`\x95\xd2\xe8ue\x1dxh\x9c\xd5\x1d\xc7\xd2\xfb&\xc5\xe1\x84w\xb3F\x16\t\xbf\u06c0\xa8T\t\x8b\x13X\x96\x92\bE\xcfjng\x98t\x87\x1f\xe1\x94\xd9\x0f\xe6\x1d\xda6\xdf\x14\xad\x7f\xc4\xfeS\xab76\xcd\x1bk\xb1u\u0684\x8f\xb1\f\x85\xa4\x16\xf1\u061e\xcf\xdf8\xfe\x9e\x92\x9b\xe5\xb2\xd9R\xd9gNX\xf54\x9fB\xde\x1b\xb4\xa5fE\xc4\x0ev\xb8\xd6;4\xe9\x01\xaf^\x97\x83\xfe\xa1\xeb\xb2\f\xaav\x9c\x95)\xa7T\u0114\x12\xe0W-\x9e\x84\xbd\xff,\xb6\xa78\xb9\xf9?1\u0621\u03b9\xb2\u01e6\xe7I\x1c\x02\xb5\u0568\xa3'r\xcd\xeccvq\xbc{\x85\xff_\xc9>\xbc2\u0194\x1cc=[\t\xa7 \xeb\xa0fb9\u0316\xd55m\x85GC!\x9eH\x88\u0575\xf0\xaa\x8e\u0577&\x81\x85\x15\n\xedTBK\u07ed\x05w\xe7\xe8Sr\xc3\xdf\x06.\x9ex/|s\xd9\xfa\u01ec[j\x0e\\\xff\f+i\xb5\xf6\xd6\x13\x9f\x98)\x03\xa0\xb6\xf5\x9e\xf0\xa8\xdd\xc8\xe6\xd6\x0e\x87 \xb6(\xfb\xcb6\x98\xc9\x18\x1f\xd1\xc0~\xe1\x0e\xe9\x1d\xddY\a\xba.\x1a\xec\b\xfd\x98COc\x06\xb5\xb3\x18\xd8\x18\x19\xd3F\xf9\x9a\xd8C\xe1\x12\xda\u0646$\x9c\x9bW\xdd1'\x12\xe7\xb9w/rr\xd7w\xe6\xb1\xe8\xee\xacp\xc2Y\v* 2!\u0306\x87\x01/\xec\xd8\xe2\xa2\xc1\x06\x83>p\xa4\x99Ryo\xb3l\x91\xed\xeb\xf0yF~\xbdm\xac\x90E\xe5\xbd\xea\xd7k\v\xcfQ\xf4?\x95\xe9S\xbc\xbe\xfd\xd1MQ_\xd5\x1f\x12*\xab\x8e\xea\x94Y\xe5\xfd\xa6\b\xa2\x0f\xe1d]N\f\xf4\xcc\xc7\"C\x1b\x82\x19 9\xcb\xc6q\xe0\u0357\xa3\xf7\xdd\xef\x1d\v:\xdd\xff\xb5C\x89\x8b\x15\x85k\x05Ms\xf6\x8cm\xeb\xe8%;[\x82\x85w:\x9f\x85\xf7\x82\x9fT'Ul\xb2\xc3\xf4\xc7\xe3\xeb\xfb\x02vD\xdf\xfa\x8d]\x95\xcc%;[\xb0\xfdx\x87\u0792\\6\x03\x97b\xea;L2\x87\xd1W\xfc\x96\x03\u0390\xac\xdf\xcd\xdc\x0ea]\xc8\xe89J\u033bC\xc7\xe7a\x1d\xa7G\xb3\xf0~)1\x82\xd4\x05\x94\xfb\x925\x18\xc1\xc1\xc0b\xb3\xcb \"bw\xecT\xfc\xc5\xef;\xff\x96/e\x96\xb2-\x1f\xeb\xcaG\x1f~xSs4\x87!\xf9\"\xaa\x97\xfdJ<\xc0\xb7\x0ex'\x14~\xd8a\x8c\xa1=}\xf8\xe1\xdb\xc8*s\x9fl\xd4I\x8e\xb9d\x86d\xffip\xb8\xc5 <\xb6D\xc0\xe30\x83\xae\xe7*s\xb1\xe6\xeb6\x05\xf9\xf5.\xaa\x06\x83t\xf6^&\xf8\x12\x999u\u05d7\xdeKv\xa3\x04\xa7\xca8r\x1f,\xce\xf2\x80\x1f\xf8S0\u0801\x83>w\xb8\x89\xcd\xd7\x02_\xab\x80l\x1ad\xa8>\xe9A[\xb9S\xfc\x16\xe0*\xb2<h;\xba\xb7=\xee\"\x11\x8b\x1d\xf3\x1d\x18\"iM8\xaf@Z\x01:l\x1c\xae\x9bR\xd9\xf8\x06\xdan\x98\xd3@\x9c\xc6v\xa3\xce\u68d4z\x1a\n9Q\x05\x02:\x94\xe3\x95L\x8c\xe4\xb2\x03<9\u01c68\x1b\xc1\x06\x19\xacr\xc0SQR)\x9a\xf0\xf30\xb7\x97\xf8\xa3\u00bf\xaa\xa5%F#/:9\xa4_\x9e\x82\x9cNs\xba\u0201\xa1f\xb1\xe0E\x1e\x8c\u045c\xf2\xfb\x9a+>}\xf0,\x1b\xc3!d\xe3`\x02\x82*\x9e\xe8\u04c2\xbe~\"\x19)\xba\x03\xc2\x19\x1f=Y\xe0:]\xe4<\x16\xa9\x8b\xc5\u0253A\xa1l\xc2\xe4TL\xf6\a\xba\xf2\a r\xf4\xb0\x93\x18r\x84\xeaU&\u066b\xc6\x13\x132\xb3\x1a\x14>\x86\xae\u036e\xb4\xa0\xea\xe2:\xd1Kg/3\xaes\x93\x1aQ\x10N\xbe\x1a\xd9\xd4D\xe6\xe5\xae\xe7\x1cFEHz\x98nnBA\x02\n\u01901\x93\x06\x85\x9e\xfc\u00b9\xba+kT\x04\xbdx\x18\xdel6\xd7O\xa1L\xf7L\t\xe0\x98H\xa4?\x15\amq\x97\x8aw\x889\x14[j\x0f@\xb4M=\x80\xbd8\xba\xc1\x95io\xb5\f\ae\xde\xf5P\xe8\xb0s(\xaf\xfc\x8d\x17\u041f\"d5\x1cC\x9d\v\xb86\u01bcE6\xbfHU\x8b\x05\xf8H\xc1\x10\u0644(\xe4r\x8eV\xa9\\\t\x1b.\xb9{i\xd2\x1a\xfaf,!\x19{\u03c6c\x8b(\"#\xad\xec<\xf0\x16S\xc0P%5G\xa9?0\xa3\xf6<\x8a\xbb\u0780\x91er\u05c1\xe1T\xb7\xd0\x1d\r\xf4+H\u07c1\xa2\xc4\xd0\u0137c\xb4\x81Py\x88@\xc9\x13\u02c5\xb3jP<\xe0W\xfeN+\x90Z%Zi^\u02eb\xff\xfaf\x93\x1b\xe3\xc8O`\u03ccE>k+&s\xd5%\xfbin9K-\x9a\xab\xdcz^\x05\x8e>q\u01d8\x86\xd6}1\x1d\xbcq\x1f3q\xa3\xf7Mu\xb5\x8aK\xee\xd5V0tL\xa9\x80^\t\x13\xcaH\xc3\u024f\x89A_L\x8c\xbc\xf7$$\xed\x18\xe1CHm\x1eB\r\xe6T\xbaH\xec\xad\x01r\x8a@\u00b2px\xa9K\xe0\u049a\xc1\t\xa4\xdb\xf3\u0385\xd1L]\u04a8l?\xfbR\x81s\xf9D\xb5S&\xaaw\xa5H\xc0\xa3\xc6\xf4\x00Y\xa4\xe3\x05~3\xd6!\x05\x02\x14\x93\xe2q\u04f8\xdbNl\xcc+\n\xacf@Gk\x06w\xb6}p\x84\xe65\xeb*\xe8\xa7re;\xd6+\xe4\x92\x1di\r\xbd\xa3E\xaf\x1a\xdb\x06\x89W\xdd3\u0596i\rSJ4D/\xc8k\x98\x86\x02[7C\xbf7w(\x11\xf3\xcf\xf2\vW\x06=c>4\xf2\t\x03\xab\xeb\x9a\u045do\x1f]\xcfv\xd8\xee\xdfe\xf8\xd7Y\a\x81\t\xbc\x06\x83\xee%x\xc0E\xaf/\xf7|\x1b$\x9a\x82\r}\xee\xe2Q\x06-\xbf=h\x88\x05\u07e80\xc3D)\xae\x04\xb5W\xd8\x0e)\xcd\u01782U\x8b\xf1\x9a\x11\xe8;\x8d`\f8\x06poAyrCLM\u02db\x1a\x19\xaaF\xa9\x06\xae/\xd7t\xdd\xf1/\x1e\x05#E\xd7a}s\x02]^\xbe\xb9\ac\x87\x1e\x84\xbd\\$\xae\x8afk~&\vYE\x9c\x8dl\xbf\xcf\xe0\x06>\xe9n\xa7\xb24\u04d1\x89+\x1a\v\\\xa4@f\x14\xad:\x9fi\xd1zu\x8f\xed~C]\x83d\xc2\xfcE\x8cMr=\xbe\xe77\xa8k\xf9x\xa0\x16\x8ft\xa5\x0e\xc1\xd1\\\x8b#\u03ed\x13\x8f\x84`T`\x14\xab\x17\xd6 \x14[A(\xf6\x06\x84z\xdb\x10\x8a\xf9\x11\x92{C\x95\xe1t_\xad\xc8\xce+L\x85\xe2\x93\x04\x9b\x92\xa7\x83\xcb\x05\xe7\xcb\xf3R\x10\r~\r\xc5+\x1e\xdf,\xf4=4z=\xc0C\xe1\xdb?\x19\x91\xe4fD\xb2\xe0]\xc0\xb6\x9el\xda#E\xa1\xa7\xa1h\xeb\xce)\xbeIj\xf0\x9eG\x85\xea_\x81\t\x1f\xc6c\bn\x9a\x99\xa3\xa5\xa2\x9f\x88\xca\u00e0\x9eB\x14\xc8\\\x19EaF\x19r\xb8\xf4\xc2\x1b]\bfW\xe6\x9e\xdc\xd3x\xf0\xf8:\r!\x1e\xd8<B\xe2f\xe8v\x19\xc2C\x80\xeb\xa4R\xbf\xc2\xf9\a\xd4\x00\x83VA\x1b@\xcfw[\xd4\xf3\xf2\x14\x86\x95\xcc\xe8\xf2\x94\a<G\xab\xc0\x17+\xea\xcb;\xf5u7\x1f\x90\xb0\x18\x80\u022f\x91\xc0\x82\aW\x0fk\xc6\xe8\xca\x16X3\xb3N\xf6\xb1\xc9]C<=T\xf8\x01M\x15\x1d\x8b\x0e\x88Q\xa6\xad\xae\xd9 \xe2\x9d\xcds 5Z|\xc1\u0b34\b\x8f\fP\xb2\x0eFU\xd7,\xee\"O.[>\xef$5\xe0\xdbs\xb7e=\xaeq\xb7%xJ\x97\"\x16X`\xba\xb7\xbb\xaf\xf5\u05e0{\x0f\x8fp\x17\xa0\x02\x81y\xe8@\x1a\xbdX\xab\xf2\x9d\xf6\u05ad\xdc#\xedL\v/)$\x12t[Nhi\x9f\x03\xaa\x85\x01\xfe\x17^\xc88\xc4[E\v\x95\v\xc9<\xd7PLiBj\xc1\x01\x1d>\x87\"\x13\u047dT\aCq>;\x06\x9c}\xa7\xbeO\x91\x8b\xed\xfb\x1at\x15\xa2=\xa0\xe7=\xaa?\xd1J\xeez\r\x82\xe0\xf0\u0475MH{\x05i\x9cp\x87]\xa3h\x9e\xa5B\xd0\xcb}\u06f6\x1b\xae\xa0^\xd8/\x93\xcd\n*\xf87\xc3R\x80\xfbo\xa6\xab\xd6\xd7\xcc\xfe\xd9Y\b\xaaW;\xa1*\xb4H\xff\x8b~`\f{\xc1\x8c\x9cx\x91%\xf8\xa1V\xf0\xeb7\xf3)\x9e\n\xd6k/g\xdd\x10|\xcb;\x1cZ\xa8\xdf\xebp\x06\xa8\x93a\x88\xb4\x85\x04\x93q\xf5\x84w\x80\xa4j#\xec\f\x9bOh\xb2b\v\xd2\xd5\x1f!\u956dQ\x12Yo\xdceC\x86g\x86\f\xaf\xb2yk\xf5!\x9f\x04\xe4\x93a\xc8'\xffz\xe4{!\xc8W7#\x7fa>[\x86\xe9\x05\x97\x91\xe9\x01\xfc\x9e\x94M\x86g\xe1\u0461\xae\x92\xe7\xa9M\x87\f\x02\xf0N\x00\x10L\x80v\xedO\xf7\x8d\\\xad\x8c\xf9\n\u07ea\xee@AC\vJ\xde\u0216\x80\x17x\x7f\xdc\xd6\xeb\a^\x8d<*A\u46908\x8a\\0:\xa35\xac{\x1e\v!\xcf\xcd\xe6\x1dmmp\xc1\x8a\x03\xe7J\x9a\x93p\xe7\xdd\x0f\x81\xba\xe7\x0e1\xc7\x1c\xea\xfbt\xb5\xb4c\ua301n\u0492\xf8w\xe0\xca\nz\x95\xa4\u00da\xc1\x9d\x84\f\xae\xb5\u0368\xd2]\xed<\xf7-\x9d\x9f\x86t~\xb7e\u0548\xb1\v\x96\xabW\xebo\xef8Lz\xde\xef\xb4\\\xbd\u0168\xc4QF\xeb\xd9\xc2\x01\u9acc\xd5\n\xde^\xc9\u03c3\xb2No\u10b1\x7f\xb5\x03\xf6\xfc\x19&\xbf\x1c\xc3P\xc8\x1c\xa9\x19\x11\xb6\x80\xd2k\x04\xfe\xb9\x1e\x82r{\xbb\x00\xf5gh\xa2\fU\xbf\xc6?$\x8c\x80\xaa\xb8)L4\x9a\xad\x17|19\x10FE\xd1\xd3c(\x03\xb8R\bY\xf3\xa2G\u05cc\xa6\x132\x9aO\u07f5\xa66\x95\x9c\xddR\xeeu\U000c2118\xd5\xc0\xf2\v\x89j\x92\xf4irwRy\xcc\x01\xe9wT\xadg\x8fn\xcaGPP\u03b0\xc7c\x1d\xfc9\xc8\x10&\xcd\xcf\"]\x84jx\xfe\x81\xd7\tCi%\xb2\xe7\bOU\xa8\xef\x85>\xb3p\x1b\xe8\xbf\b\xf0\xf5o\v\vUp\x820\xdd\xca\x06\xa1\x13\xe1\xc5\xf8\xd6\u0321\x112\x87\xbf\xfd\xb6y\x15\x85X\u0191\x1a\xe8#\xbb\xe7U\xd0\xe6$r\xcc\x11\xb5\xe6\x96\x13[~N5\x11\xd7`\x16\xa6l|\xfe\x0e\xeeZ9\xa3TC\xcf(\x9e3\xc0\x06\xa2\xaa\xdf\xf9\xe2>\x95`7yt\x86\xb4\x92\xfe(\x04\u0563V^dn:\xa4\x00]\xd5n\xee\xa4\xf3s\x17T6\x11\x90\xa5\x04\xf1-\xcd\u0646\xbe$\x88.\xa5\xd0\xd1\xd4T.!1y\x98\xe0 z\xf4\xcf\xe8o\xdd\xfd\xbd\x0f\xd1\u00df\xf7\xfev\xc4/')\xc0c\u9877\xfa9\x83\xc9Z|J|\xf69\xd0xG\xb7*\x1e\u0760I\xfcsH2\x86\xc0Ur\xc0\xe9y\xc2\xce=V\x17\xaelB}\xe2W\xb1\xd9\xdbS2km:\xceU\x03\xc79\xbc\xa35\x96Z\x99_ Do\xcao\u07f4\xc2t\xcc\x7f\xfe+\xf5\x90\xb4\xe7\xbc\xcaFH\x95\x01\xc5>\x02\xde\xeco\x1fb\x98&\xfa\xe5_9D\x8cT]$\xc0\u01709A?\x05\xacUl\xf2\x1a\xc4tKk\xa3\xe3(X\xb4\xb04\x16\xf80.\xe5\x1d\xd1V\xa5\xfc=\xc58\u029e.Y_\\\xff?\xc5s\xbc\xaf\u04b8\xe2\xde\xec\xb2}\xe74\x1b\xa7\xadG\x85\x90\xf7 \x9cm\x85p\xa6@\xf0\xfd\xabd0]\xb5\x87\xb3\ue0b5E\xc3>\x99\xb2\x03\x15\x1c\xd7OppT\u05c8\u04cc\x9c\xbf\xd9:\xc4\x14\x12 \xe2F\xec\x847\xd2\xe2\xc11\x947\xb7O\x04\xdbW6\xb7O\xae\xde7\x03\xc3%b;3\x17\u77b5Mw2Q}[\x9c\x91\xea\xf1!\xb6\x86\xf78\xf4\x18\f\x1d]>\x06\xbbf\x93@\xc9\xf5\xd5W\u038e\x14\xd0\xff\x88\xf8/z\x83\xd4\xfa\x8f\x7f\r\xa9\xb81\xef,\xb2'\xbc\x94\x85\xd3U\x1a\u02a1b\u0461\x06\x1c\xe9\xc0)6}]\tw\x8a\xed1\x06\x8dFr2\x82\xf3\xedd2]\xd6\x1b\xa8SU\xbc\xe9\xceR&6\xae\xc5D/\xaa\xd9\x15S\rR\xed\xff\xfc\xf7R\xcd\x1f1\xf5\uc55cT\xaaQ\xf2\xdcT\x98\x1b\xde\xe4A\xe9<\x19\x1fS\xc4h\xcb\x0f\xa4\x0fY-?\xb9\xe7K\x19\xc1'\xe9(\xe2\xb9-m\x9e\xd9\x1d\xb3S\xac\xd3@\xd8nc\xc0]\xb3:,\u0594q\xaf\xcb+\x94\xcbX\rC\xc9\x01A\x89t\xff!3\xe8\x92_\x9d,\x86\vU>\xb5d\xea\xd0\xefI\xb6\xa96\u7a83\x97\xe8$\xbf\xae\x13\x91\vnK\x17\"\x12v}\x0fG\xfe\x1e\xaaP\x04\x1e\xce\x12puD%q #\x8a\r*<P\a\x14!\xaf\xdb\x1d\x16\xdf:\"\xfa\xc6H.\x91\x98<\xeeZ\n\xf2@\xb3\xab\x90f\x89\xd5f\x85\x90f\xc9C\x9f7(E\xf3b\xb6~,\xa9MMQ\u00bb!\u027bw\xa7ohKYgu\xb5\xad\x7f>B\x1c\xfbvw\xef\xdb\x14Z\nb\xf9\xffhG\xf2L\x18\x1e\xba9\xd8\xdb\v\xc5.\xe8\xc0\x1bD{\x05\xe5\xdd\xd0\u0744\xea\x1b\x10U\x90\xfc\xfa\x8d2\xd9o\x18%\x8d\a\xf8>ZW\u0310\xa4#D\xb5\x1b\x97k\b+\xf7\xc7\xd1V#\x1e\x8b\xa9Z\u051e\xd2:\xbe\xda:\x91\xf0\xb5\xfeYi\x9d\xd8\xdaz_i\x9d\xdc\xda\xfa\xddfL\x92~\xbc\x0f7c\x12h}\xb4\x19\x13\xd1\x1a5}\xb6\xd8\xc2<\xbcLc`\xaf&?\f\xdb\a\xa3!\x9a\xfd^\u0233\x9fC\x9e\xed\x87<{\x17\xf2\xec0\xe4\xd9\u047a\xfd\x97BM\xff[t\x17\x9e\x84\xe2\xf7\xb7\xed|\x01\xa46n\x89\x94dq\xba\xb1\u0591T\x11\x013h\xfc#\xc3MV\xbb\f\xec\xe7<\x86\x94M\u06ca\x1b8\x96ub\xdf\x7fX\x8d\v\x90\x9f\xedE\xa0\xbc\x8e\xfc\xf3]\b\x94\xf8v(?\xfb\xa1\x1c\x86@Il\x87\xb2\xef\x87r\x14\x02%\x19\x80\xf2CX\xbc\xc3\xdaX\xd7@\n\x0eaV\xf0/(\xb8\xb6\xf9I8gC,\xfeO\xef\xfd\x8a\xfb\xb7\nA\xf0\xdf\x13\xd7r\x10\x16\xe6Yj[\x8d\xe3\x049@\u03e7\x87\xda\u03b7B\xb8lN\xb6\x18\xc3!\x16\x81\a\xacF1\f!T\xf9]\xef\x95\x18\x16K\xe0/6\x8b\x15\u0654.j\xe1]\x9c\xed\u0505\x12\x01\xf0\xd5\xe7\x18\x06nu\n\xf5.U\xea%\xe2\xdfJ\xbd\xf3\xcd\xd4S\xed&Cs9\u057b\xd8y\xe9&]\x0e\x1d\xe3\xc7\xedf\xfe\xb0\x80\xe2\x12\x81\xfe\xb8\x9a\xb8\xa3\x02\x87\u347f\xefJx\u07ff|g\xdf\\UVwm\xe9\v\aN\xcd\x0ey\xc3\x19\xb63\xa1bS.\x1e\xee6[\x8e\xbc\b\x00W\x94\xa91\xec\xfe\xc4z%\x9fg\xf2\xcd}\x11\tx\a\xd3k\xe8\b\xfa\xc9\xcc\xfbPm\x80\xa9\x8f\x8c#\xc8I\xder\xc94>\v\x1b\xfd\xe5\u627c\x04\xb7e*\x8c\x1c\xad\x15\xc2\x0f\x80\xc6Z\x02*\xd9W\x83\x97\xde\xfc\x85B\xb5\xb29\xb6\x9d%\x1e\xe7\x8e\xe6\x13\xf8\xcf\xce\xc65Dc\x14\xb27\x8e7\x8fN\xf1\xc4K\x80'\x1e\xc4\x1b\xab\x8ex\xe8#\x15\xbc[\xd7\xddUg<\xecl\xb2\xcd\x13/\xe1\xf7\xc4SzOB\xef\u0270\u0793\xbb\xf6no\xeb=\xb9\xb6\xf7\u0101VC\xc7_@\xa2\xb6+\x16\xb50,\xfeX\x8fE\xed\rX$j\xbb\xceD(\x16_\xb7a\xb1~&\xe2\n\x16\xf1P,\xe2\xbbb\xf1_\u06f0\b\xb8\x8aR\xa8\xb6f\x19\x10\xf9\xc0\x8ey(\x9a_\xacI\xd7~\xd1f\xd6ld*\xf7e(\x13(\xa3\x1eb\x15l\xe6\x0f\x80\xf8\x14\xd9b\x05\fI\x98\x00\xf0\x1a\x00.\xec\x96 \f\xefm($\xfckQ\xa0\xe5K\x88q\x045a \xb6\x88\x89\u03e9>2g\xb3PP\xc7[=\x1e\u04d0z\u0380\x94\xbe\x10\r\xe4z!V\x11\xccw\x16\xff\xe0\xf4;q\xed\xf0\xf0P\xfb\x80\x0f*\xf0\xa0\x12Q\x92N\xd3I\x9c\xca.p\x17f\xd7\x1c[\x80\u06c4\xe7\u205b:\u04d7\x92y\xaa[\x8e\xac \x18\x9e\xfe\x0en\x8c\x10j\x142\xdc\xe2Q\x15\x93\x90\xb3/\xb3X\x9b[\xa9C\xaef\x19=\xd2\x122\xb1\x1e\x12\xe8\x86\xe8#4\xe2\xcd5l\x95\x0f>\x04\nPb=\b^\xa4@\xadR\x00\x18U(\x00\a\xcb\x15(\x7f\xff\xddC\xf7\x83\xb6\xbf\xef\xbd\xf1\x9d \xa0O\x99*]\x1d\xd2'\x05\xd4\xcfZB$X\x93\x1fa\xa1s\xbc\x17[i\v!\x9dj\xbe8\xa5\x93_>\xfa\xe8\"\xb2\xafy\n\xec\u031a\xcc\xcd\u0dfc/L\xc5\xea\xbbE\x84\u052ccS\x9f\xb8\x988\x8d*ZR\xad8\x9e\xc1R\xf1i'\x86U\u02bek\xfe\x81@\x91\x02|\xc0\xb6\xc4~\xa7a\xdf\xc7\xe3Q\x15\xd7O\xde0\xbcls~\x14\xf7V\xcaq\xe1\xbcQj_\x85\n\xfb\x908\x19\x95p\xf9\xa5gU\x934P\xd4\xf1u\x88.\xe2\U0004676d\u05e3>H\xeb\x11[7\x1e\xed\xa3\xd2Eh\xd9-\x1a\x88:][\x1d<>\x1f\xe3 \xfd\x10\xa8f\x05\xa4\x8d\xde\x17\x99\xa0|r\u0282+\xb0\x84\xd6w\xec\x17T'\xac\x1eW\xe5\xdc0\x19s\xbeU\u01a0~\x866\xe6\xee|<\x15\xa6\u0699\xe5\x98Ja\f\xcc\xe6)C\xaf\xb8\xf8\xc3\u0397\xd1\xdf#\x1d\xbb\xbb\x8c\xbc\x0f\x11\x11_CE,\x9aq(\x11<\xe4o\xedSz\x0e$o\xd8\x10\xe2\xb1o\x97\x93\"\u05ab\x83\t\x1cg\x8eN\xe2\f\v;\xb0}\u01da\u0200N\f\xddcm\t \x84\u06e9\x97,o\x90\x84JV\u0415\u04baR60\x84}R\x90-\xa55|\x8b\xc2\x13\xfd\u0663{\x12\xba\xf8fMj\xa8KI\xd5,4\xf4\x9a\x7fP\xd35z\x19>cBd\xac\xb9\xd7gm%W\xd2\xe2\t\xccP<\xf2y]\xa6\xb0\u03eb)\xa3V\xd9\x00D\xd1V6\x88\xff\x7f6x\x1b\x1bd$U\xc3\xd8\xe0\b\xaf\xba\xcd\xf7<?\xb1\xa8p\fC\x8e'\xf61\xado\x97\x13\x87;0\x1d\xfe5\u0313\xd8\xce<\x1a\xb0C \xe9\x98\x12\x0f\xe8\x0e\xf4\xa9T+\xbd\x1c\xf9\x96\x97p\x8f\u01e0\xf0\x80\x11\xf4\xe7\xfb\x89W\x01\x87o?R\x88\xeeO\a\xdc]\x80G\xec\u0491\x93\x92\x9a\xbd\x97fj\xf01\xc8\xc0\xc1\x8e\xfe\x8c\xb3?\v\xef2\xa6>\xa6\xbf\x13\xe8\x82\xd0e\xe7Xkb\x06\xce\xc0:\xde\xf2cZ\u016e\xf9\x0e\x82\xc8m\x88\xb8\xa6B\xaf|\x06\xe8h\x8cR\x9e\xc1\x02\x15\xad\u012dV\xe8\f\x86\xb18X\x95\b\xcd9\xcdzM\t\xbbB{\x16!\u03f9\x9b\x1bTB\xa2'\xa9\u030c$]p\xb9\xa5\xb6H\xdd\xcd+\x81;\x13\xa9$\x8e\x1e\xee\x1dY\x81\x85\x11\x9a\x84.\x8bJ\n\x1c\x94)\x9f6pd*\x86\x9d\x91).T\x93\x0f\xc9a(.\xc5x~^\x7f\xa9\xe98\xbf\xc5RQ\x8c\xbf\xe73y\xb89\xb9\x16\xb6\x8e\x12\xbd\x1a\xfe\xc0\x01|u\x98\u0265\xcb\x1b\x8a7'B\xfaN\xbc\xf7\xb8\xe6{\xbboV.r\xb5\xebB%\xb71\xb5\xc5\n\n\xb1\xf7\xc4\xd7\xdf=\xfa\xebj\xb6\x14\x9a)\x90\x0eF\xe4\x12\b\u025d\xa6d\x8f\x92N\xb8\xe0\xad\xea\xfam$\x90\xed`\x8e\x19\x02]\x93u\x02\xe5|\r\xee;\u03b5\x1eMK\xb3\x99\x1f\xdb\xe0\xc1>\x9dR\xa6t\x9db\x9by\xe1\xf4\x8e\xcd$\xd5\v\xfb\xd6\xe47\u7ebc\n\x91H0\xa8\xc0v\x90\u0342)?\xfah\xb4\xa4Xav^\xc6\xe4\xf9K{\x0e\x06b\xd7\r\xe4\x8a\xf0\x00t\xf5\x99\xfe-EM\xa9:\u055aR\x80\xb4\x16\x13\xdfqR\x94\b~\xe8\x9c\x1c\xbf\x03$\xe5\xf9P\xf3\x8f\x80 MU\xf9)\x9cT]\xf2R\"OX\x9eg\xe3\xde\xfb\x92\xaaBv\xbbX\x06R\x03\x17l\xc3$h^\nW(\xbf\xd5\xe7N\xa1\x986\xe1\x1eS\xdc\xd3%1U\x86\x1e\x8d|\x97\xc3;\x89\x98\x7f~2\xa6n,\x9eH\x1e\xa7NN?\xff\x8c\x8e\x8bG;\xec\xbf8[\x1f\xf9q\xffP\x9f\xd9\x1d)'\xc4\xc7\xd0$lk5\xec\xe9\x92{\xa3\xd9YA\x02_\rY\xfc\u04af\xfb6k\x8bg&\xd1\xd8\x02\x87D\f\xf3\x91\x9aY\u00abr#<\xb4i\x85 \xf5\xd9f\xe0\xb0O\xdf\xcd'\x96,\x03\x04\xb9d\x83\xa0\xb4j\a\x93&\x8d\x96@V\x1e7\xc17ul\v1\x99L\u0377\xc7\xe2+\x91\x02ad\xb9P?\xb0g\xbe\xa0\xcf3\u0184\xc1\xae\xe7\x8a\xdc+P|\xa7\u02eb\nI\xacMc0\x81\x90\xf0\x11\x96ktLZ\xb9\x1a\x95\x1c\xf2\x92\x04\x93\xe79\xefQ\xb3;\xe6\x12=\xce\xfeNO\xd0B\xf4\xcb\a\xf1\x17\xcc\xc0\x01\xebh\x8e`?\xc8*7\xdd_BV\xc5\xe9\xe9\xe9.[\xd4RhXs c\xd9\xeen\xd1\xdd \xc36{\xf0A\xddA\u0127\xfe-\x84\xce?j!\xfaK\x1c\xbc\xf2\x80\x9a|@k\xd2\a~\x80\xe2o\x01%|~ NV\x1fd\xb1\x9b-.\xba\x9f\xfe\xf9\xe1\xf3\xfe\x87(\xfc\xe7\xe7\xbd(\xfb\xe57\xf7\xb7:\xfbu\xefW\xe9\xb2\x1b\u2d2bQw\xdcS7\xfe\u067b\xe2\x17\xe92\xe8M\xf2s0\xc7V\u0e07`\xd8\x16\u01b1\x17\xc7?\x0e\xe5\xeb.\xf9\x94\xc2}\x13\x90\u031cW\xb6l\xf5\xeb\xf2%\xf1\u073c\xd1\xceH\x9f\f\xf7\u0510\xcah!{\xb5\xb7\x9a$\xe6S\xe4\x1fo1*Z\b\xbf\x0ey8T\x8b\xa2\u0170\x83D\xf1\xf1\xc0\xaa\xe7w(\u0369\x16\xcd6\x9b\xa1\u0767\xdf\xd2=m\xb3\xcd\xe9\x1b\xfa\x86PF\xe8\xfd\"\xb4\xf7\xcc\xdb{\xc7\xd8\xc8\xdd\xfb\x17\x97w\f\x85\xcbP\x14\xb2oG\x01m\xdbo\xc0\x01NB\x02\x89L(\x12\x17oG\x02\x93\x98\uc383\x12\x04\x9b\xad\\\xef\x05\xa5\xff\b\x82a\x95);\xc0R*S\xdf9g\xcc4\x11\x99\x82\n\x13\x10Mx\x95v\x91\xc2\x05\xc0\xeb`\xeb\x1b\x8d\xc2F\x99\xfb\x93g\xfb\x8dy-\xf8\xf0n@\x05B\x9d\x88\x93\xe3f39\x9a\u04ff\x84\x18\x97\x7f\xea\xc2\xfb6Rxw0i\b6\xc3\x04\x00\u066bt(\x8b\xe6\xdfx\xf9\xe1\xeb>\x14m\xc8\xc7\x1b>C<8\x1c\xd6\xcbM(2W\u07c4\x8c\x80\xbb\x1e\x9d\x83\xf0\x82\x18k*\xf3\xd1\xc7\xf1\x8dc\x11\xf2G\x89\xd9f$n\x84\x8e\xaa\xb0]\xa10\xd4\u06cd\xe0\b\x80\rD\x03\xb0\xe2\xf4\x0e\x8d\x91>\x9eF\xf1\xd9\x01\xdc\u02ad\xa4a5\xcd\t\x143>|\x814\xc7{\xeb\n,\x1btIa\xed\xef\xfb\x12RlH<\x14\xd8\x17s\x0e\xa8,\x90\x8b\x92\xd2ph\xd1\xdc\xc5\x01%]\x0f\xdf\x18\x8a\xfe{h|\xf6kq\x17'-\xae\xb6\x87\xaa0\xbe\xaaI\xe0\xee\x83\r?zF$\xff\xb0L\xc0:\x03\xb9\x0e\xa2\xc1\xb4\xf6\xfc\xc3\xf8\x86\x0f\xd3\x1d[$\xbf\\\xfd0\x11\xfe\xa1\x92\xe2r\xf5\x9b\xa4\xbf\xfe+\xf7_\xe8\u0686\xcb\xce,KJ\xe9G\x97-?\x11\xbd\u0475\x852\x19\xfc$\xca\xd7D\xd8)\a\xcd\xed\u0615\x00\x87yI\xf8\u0538p|\u0486\xec$)\x03\xbex\xe2m0\u0618\xe6\xd8\u055c\xb9Hr\xb9\x1e\xfd\xd0\xe9\xa7\x1cQPe\x02\xe7\xfe:t\xeeKas_\xfaW\xcc}\u00e6\xad\xfe\x1bf\xbfa\xe3\x06\xfd\xb6\xe9\xc7/aW\n\xa1!W-\xe1-h\x93\u193b~\xbb2\x89\x00wQ$x\xae\x11\x8e\xc0E8\x02\xe5\xb7 \xd0E\x88oE \xab(\xd5\x17\\\xa9VR\x99Q\x9c(\u06aa]\x99S\ro\xed\xb0\xfa\n\xb8\xf7\x1cxy&u\u07e6.\xb2\x92\x84\x8d\xec\xe6\xed#\x03Lw\x1a\x19\u03e0\rzz=\\M\xaf\xbf\xa5\xf7g\x9e*\x7f7E\x9dwN\x8az\x9d\u0131\x96\x86 \xf5Ha\xc2\xc8\x01\xd7\xf3\x03\xb6\fF\x94\xd6\x0e3\xa3\xcf \x91-X\x8f\x0e\xb5\x10\xc7\"\x12E\xac\xebY\xd8P\x1a\x9b\x87\x12\bRU\xad\xfd\x7f\x87%\x17\xb2l\xc4xw=\x1a\u053cj!<\x8dg\xcf\xd4gs\u01d4I\\\u9a0a\x85C\x82U\x16\xc5\x05\xb5\xe25\xfeI\xfb\x05|\xa4\x1b2\x84\x0f\xdc\xe6F\xcb\x03\xed't\xd1\xfaId\xb8\u4944\xa9\xafC\xc8]\x05d\xa2H@\xb4\x14\xf2v\xb2\x16e\xc7\x1a\x81\xc5Q\u05a8\x94hb\x1e\xde\U000542bc\xea\xec\xbb\x1e\xda\xeff\x12K\x91\xfe\x03\a\x02\xb0\xc6<\xa8\x8f\xc1\xf2\xc5\x1b2\xbc\xa9\x82\xcd{\xefz\xe1\u00a6\xaaG\xacG2P\x1d\xa1;\xcdH\xef@\x00\xc5\x1c\x03\x81\a\xe6B\uf6865&?n~\x13\xc1\xbf|\x9a\x9b\xce\xf2-\xdf&v\xecUD\xc5\xc07\u025d\xfb\x93_\xed\x16d\nL\xfaKcKr\v\xdc\xd1TQ\x94[s\xbe\xbf\x7f\xcb\xca\xf5\xed:\xdfp\xc0\xf4i\x99\x99p-\xb3\xfd?U\xcb\xec\xf0Q\xaeW3\xbd\xf3\x8c<Bx\a\x9b+%\xf5H\x1d=\xc3\xdco9\a\xfd\xdf@\xae3~6\u0688D\r\xf3\x13<#\x12\xb5P\xa8\xfa\xf7\x9c\xae\xb6\xa4hZW\xe6o\u00d9&ThNE\x14\xe0T\x9e\xa0\xfb\x8e>\x1dX\x86\xafN\xf1\xdbr\v\xc1\xe0;[\xbc\u0221\xf0\x02\xcf$\xe49di\xd1\x1b\x87I\x10\xb6\xee/\xbcy\xf5g\xf9\x11\xa7y\x86\\\x97\xeeC\xf0.\x81\x17\xb5\xd5\"\xe4\x02\x80\xb7\x01i*\x90\xd8\u0570L\x10\xa5\xa0\x80\x99\x88\x90\xdel\xcd0\x01G\u01e4\xed\u00b0\x1d\a+\xfarp\xba\x86\x119^E)\x1bo ~&\xe3\xf5hD9\x00\xe1\xfae-]\"\xb8_\xbaa\xe41\xb6o\x98?\x86\xdc~3\x157\xecN|\xad\u01bb1\x05\xcc\xcaeZ\xf8\x94\xd4M&|\xbb\xdf?)\x91\x10\xaac\n\xf6]\b\xef\xa3:\u0397\x9f\xec\xe8\u01b4\x13\xe5\x7f1\u07a4O\x87\x10\xf0\x97\u0607D\xea\xe4C,\x98G\aMO!B\xaau\x13.u\xbao\x94\x0f\x02\"I\x82\x1a;\xc1\xeeh\x82Q\xd2\u0301\x1e-3\xefz6\x99\xab\xd6\xcd:9\xba\xddp\xd3\v\x91\x9eW\xaa\xf4\x84\f\xbfYL\xa0\x10md\xb2\xa10\xfa\x7f\xd5z\x80\vi\xca\xdd\xc0s4\xc3\xf1\x80\x8e\x06kO\xbb|3Js\x99\x1b\xc5@\x86\xe0\xa9/\xbc\xdf\xe4J\xbfx\x05)\xf2C\xaf\xed2=\x1a\xf1^\xddhxE<\xaa\rX/\x87\x92o\xb0%\xcbf\xc8\xce\x1c\xae\x8f\xafn\xd5J]\u00d51[\x9f\x0f0\xc2d\x15\xe3`u\nJjH\x15\xf9BG\xf0\xeb_;\x04^\xe2\xef\r#(C\xd6Z-kO\x97Z\xb4LL\x1bxv@\x19\t\xa6L\xeb\xedY\u019e?\xad\xbfL\xf5$Rq\xd2&\vW\xd6N\xe8\x01+\x8c(V\x98\xd5\xc4\u06924\x1eO\x15\xc4-\xb5pn\x19\xfd\xeb\xb8EYJ\x1b\u0645G\xd6P\xed\xc6p\x86\x19\xfd\xcb\x18f\xcd \x14\x8dS\xdd>\xf3^B\xf0B\x88g<^\x95\x83\xff\x96H^s\x80i\t\x97\xc2P\xa7\vX<\xaa\x01\x8a\xc1\xb9\x94@\x99{\u07cb/\xf91\xf60\x8cZ\xe3\x1d\xd3\xf02E\x93\xedmQK\xcdk\xb5\xee\xe4\xceH\xba\xcfNy!2\xd8Bot(\xbd\x9e\xf2'\xe1\xe5\xf5\x96\xd4z\xd9\xc1=\f\x81\x1eh1\xaf\x96\xbd\x8a\\\x83\xadUr=\xdc\x1d\xc5\xd4f\x14\x13\xa1(\x8a\xfbt'\xe4\xc8\xe4C\x91\x9a\xf5\xd74K\xfa\x9bu\xd64;\xa6f*]\"N\xbf\x13E_n,\xdf|\x00\xbf\xf6\xbd_;\xf0\xeb^D\x12\t\u0364\x8cU\xdc]\xc2\x1e<\xbbi8\xe1\x04i\x11\xa0\x1a\xac\xb6\xe2\x10\xf7\x8d\xab,\u0528K\xd4P(!\x8c\xab\x7f\u05d21\x7f\x90\xb2b\xe7\u016d\x96G5F\xb9\xa9d\xcfK\x04\x112\x84uf_\xaa\xfdd\x8f\xba\xc1\xaf;\xecY \x17D\xb8\xf9\x97<6tk2\v\x82\xe8\xc1\u00ed0\x92\xb2\x1e0\xd3\xd5,#\b\xc4\u00a7[\xa1\u022a\xc2+\xde\x7f\x02\xd0\\\xbc\xd8\n+%\xe9\x02\xf5DW\b\x03\x0f\xb7\xc28\xf5\xaa\x1ccF\u07d5a\xd1\xe3\xadp\xce\x148T-4\x04\x12\xbd\xd8\n\xeb\\\xc0\xca:6V\x9b\x82\nP\x01h\xe0\xd264\x85\xac\xde:\xff\t\x8f\x19g\x1a\xb2\xcc\x7f\xe2\x0e\xdf\v\xe3\a\xceR\x81l2~^\xf1\xbd\f\xe90\xa9vhm\xe6\x98m\xb0\x8eUX\x92=\xba\x9b\x18g\x1b\u0214\x8f\x1e\x9b\xd8g\x1b$\xc9@\xf5\x99\xa9w\x97\xeb\xf9g\x1b \xc9A\xad\xed\xfc\xb3\r\u05b9:<cw.\xf2\xc3\xfd\xe1\x87\x10\xf0\x7f\xd7R1_\xc8\x15\xcf\xe8\x06\xa1-G\xc1\xc0\x06*y\u01abt\x0e\xf4Q\x0f\x94\x89\xf8\x89?V\xd0\x03%>\x00\u0141\xed\xf4\xfefX\x1d\x86\x17\xd8\x03\u04d6\x8b\xba\xed\x927\xb2&l+F/V\x01\xeci\xce\u062bg\xb1\x81\xc3f\xe5\x1ch\x10\x10\xb1\x87\x0e{\x87\x01i\xcdd\xf8\x99\xea8\xc6Y]\x86\x95\xd4)$\x1b\xdd\xfb\xd9\t6\x19\x93\xc1Y!b\xd2\a\tD\xae\xe5\xc0\xed\xe7\xc04\x86d%g+\x95#\x8d9.xZzMq\x93\x13z\x04\xeb1\xa0V|\xf0'\u0151\r\x7f\xa4j\x91\xfelH\ub1c1/\xea\xb5\xec\x97Z>\xf3a\xc3\x17\\\xb0`\x1f\xbe\xb4BL/`\xf2W\xc9\xe5\x13\xac\x8dH\xf2K\x0eZ\u03a6\xd2\x00\r\xbf4DR\xebTL0\xde\x03\xe8\x89\xc3\u0692\xe4\b\xb1I\xf8\x1f\xe1\xf7\xbf\x88\xb1n\x881\f\x8d4\xdcB@C\xcdb\xb4\x9e\x15\xcewc*9\x1b\x17\xb9\xcbt\U000fac4e\xbb\xfe\xae\x1d\x87\xb0\xa9\xb7\xe6\x02lz\xbc\x89M\x8f\xff\xdd\xd84l\x18\x9b\xd9T\x116\xff\x9fMC\th\xac\xad\x96\xbb\v\x13\xad\xb2\xe5\xa6}\x81\x8d\xe1<\xa6\xfd\xe7\x7f\"\xf3\xfd\x9d\xfdq\xea\xcd\xf2\x16y\u02be\xdb\xd7\xce>\xac\x03\v6s\x0fn<\xb6\x02x\xed\n\x80/\x11\xb2L\x8e\v}\xf0\xad\x8f\x1d\xa3I!wW\xef3\x82\x11\x85{\xe1~Z+\xdf\x05C\u04027\xdf\xe6\x8c.C\u07f9\xdc0\xa3\x89$%t_\xfa\xc6;\xc3\xf1N\xc5\x10\xe0\x003wE\xb1\xf1\xe8E\xbd\xb6\xc68\x94\x82\xac[j\xe3C0u\xc0\xedn\xb4Z\xda\x03\x1b:T\x99\x8ci\xe80\x7f\xc2\x1as\x90\xab\xc6\u061b\u069e\xf6\u0271_>\x18x%\xf4Y\x02\xe20\x1c\xed\x03[S\xb5\x901M\xde|Y\u03cd\x9b\xa9\x9d/\x19b\x93\xc8n\xf6\xd2\x13\xf5D\b5\xefCN\xaf\x9e\xbd\x1b\x02\x98\u3f98\xf8\xf5\xed\xbd\x9b2\xf1\xc9v\xcb>\x1e\xb7\x19\x12J\xac8\xfc^\v\xb9-\xb9\xe0\xd7\xfa\xbc^\xb8\xa3\xe6t\xef@\xb83\x96\xbf\u051e\xc1^(\x18\u936c7\xf9sY\xefD{\v;\xe1\r\x00c\xa3_\x15F\xd2\xe2)\x0f\xc4\r\xd92\xb1\xd4:\xeb_6\x8f\x03\xf7B\f;\xd3\xd4\xf74\u06d1\xe9\x85\xc5\xeb8\xbc\x86\xd1S\x134\xac&\x14\xc0\u034b\xd2\n\xd0\x04\x01\xa5\xec7\x90~\v.x\xf9\x1b\x84\u01df\x130e\u0754\xc4\xda_\x85x\xca\xc6\x15g?1\xfca0*\uc0c1\x96\x1e\x9b\x8ee\xe8\x13%12\xd6=\xd0\xd9\xd6\r\x95\x93d0\x93Kv:\xb8\xb7j5\x8eA\x80j\xf3)\u0555\xed\x9a\x13\x88\x1d\x93\x82\aG*\xc1A\x8b\xebR,\x8e7\\\x90\xb7\xf0\u0664\x02.Z*\xe9a~m\x1bX` \x88xJK2d\xc5[\xfdY\xb7F\xc0j\a\xb0\xc8\xc8\x7f\xc4\ucfb3&\a\xb2;I\xaa\x14\x0e\xb3b\x8b\x8f\x0f\xa8\x90e(\xf3\xfd\xfa\xcdB\xe2\x7f\u050a\xde&\x9e\u2a77\u072b\xc6w\x95z\x89\xb7\x80M\xec\x0e\xf6\xe4-\xd8&>\xc4?\xc4>\xec,\xa9S\xc97\x00OI\xb0\xbe\n\x8b\xfc\x9aX\x04\xa1\x91\xb3+\xf8H1Q\xd5\xc5\xc4\xea\x98h\x92=\x19\xc0\xdfxeb\x93\x98\xe1\xde|\x948\x02\x801 \xac\xe5r\xea\xed\xe8-\x8cU&\xcf'\xe9,%\x97\xab\xe2\vU\x81\xcaR+](.OW\xf0\xca\"\xb71\xbfs\x1c\xea\x10\"\xa2\x94\vy\xc5\xdf)\x8d\xa9\xd1CA\xf3\xf2\x89\x13\xdb\x1f\x0e\xd9g\xab\x7fr\xc0I!\xeb\x1dr;\xe6\x01\xdfTX\xbb\xf87ya\xfc2\xdd\xe2\x86a\xf7f2w'wH\xc3[\xbaF\xb8K\u02cf\u04f7\xa74sY\x1f\xb5\x90\xb4f5\xca\xd9Li\xdb\xe9\xbe\n\x8b5\x95\xf7\xbei\xa8\x7f[3\u0500\\\xfb\xdb6\x8a\x98\xb3\x90\x1c\xf2\x94\xe8\xf0\xfa\xdb0\xfbi\xba-\u065a\xce6\x84\u0705\x8b\xdd\\\xef\xd2\v\xdbM1\xb6\x18\x12\x10(a\xcdlu<[\xcel\xce\xe6\x12\xe1A\x98\xf1H_b\xf2\x89\x9f}yZ\x81\xbb\xf5\xc9\x12\xeb9\xeb\x8e\x19\xea)\xf1\xb4\x03\xa5x\xb6\x84\xd9rdr\"5A\x01\x81:\u07f1P\x0e\u049evJ\x02\xb0\xd9\xdd[\x98\xff\x15\x97\xef5~\xdb\xdf\x12b\xbe\x16\x06\xda\xc0\xa3\xdeu\xf1\xae.\xe0\x7f\x01\x12\xa1.\t\xc1\x98\x82?+\xd8\xff[\xc9q\xfc\u07ca\xc8&\x92\xa4\xbe{b\xbc\xf4\v\xdfJ\x8d\x93\xff.\x1cV\b\x11\x96\x12C\x04\u022a+\x98\x02d\x19\xbaa\x1e(h\x81Vj\xbf;L\u00e5kY\uf19a$\xc0[\xaa\xc1\xa1|\xdcA\u041038l\xc05\xb3\x8f'\x16\u07252\xe1\x0e\x0e\u03b7&\x1a\x11\x81\xdd\x14\x1d\u04f0\xa7\"\xd9\x1a\u04c1~\r\xe4j\x8b}>\xd0\xe2\xb1=\xed]\\{//\x8d\xbd\x8f3d\x91\xe7\xdf\xc7W\xbf\x8f\x8b\xef5\x15\xc0\xca\u0336\x1a4v\x1awTbv\xe0\xebgS\xb8\xa0\f\x91\x8b\xd1\xddjH\xb2\xdd\x15\xff\vLJ\xf6F[\u026f\u0396\x82\u0494\xa4Iq\x8e\xb0\xc0\x8d\u0598\xb1\xc7\xf3\x11#\x1c\x95\x13d\xb8d\u04f5\xf4\u079b\xfa\xfe\x9b\xb3C\xd6b\xce\xebQ\xd08\x0e\xeb\x0f\xf5\xbd\x10@\xee\xb7\xe6-\xc6\x1e\xfe\x1c:\xba\x9b\xc7B)(5\xa6\x9fXS\xe9\x19\x8e\x97:\xdd\x19|s BT\xe1\xbf&\xd3,'\x90a\xc4}\u3a9cms3\xa2K\xb7\x1df\xb3\x06\xb3\xf9\xb6\xce\xff6\xdb.\x12v\x8c\xf5x\xa3\xd1e\x87\x8eA\x802I\xf4\xae\x03$~\x86C)\x97|w\x99\x96\xaa\xfa\xec\u07ab\xb6\x95\u0634LW\x188\f\xd8\xfc;\xd2b\xc3\xf0\xc6:\xf8\xf5\xae\x8e\xae\xfc\u0363\x9bo\x91\v\xe0O\x17.\aj\xe9\x03n\\\xa1l\xdcoe\xa3\xe7m\xe5L\u0446wi\xc1\x9d\xa7@\x81k\xb2\xb9\xcb\xda\x1b{\xfb-\xf2\xb2m\x1a\xe9\xc4#k\x82\xdex\xb6$\\(\xb9\xdb\xc6M\xba\xf6\x8d\a\xa0\xc56\xce\xc5\x1d\\\xaeW!\x8es  \xf8\xa9/\x9d\u037dq\xcc?o\xe9\xf5\xd2\xc24\xd9!s{\u0244\u0081?Q\xfd\xdb\xe6vK\xcf\u03f3/3\xb0\x85AR\x9e\xa8\xee\x19\x1d*\xe9\xea\x00\x9c\u04a1\xcf\xe6\xa4b\u03ae\xd8_\xb0\x13hQ\xd74\x19\xbc\xd9\xd4}\x7ft41g\xd0\xec\xc5\x1aZ\x87\x86=>\x82_\x8eZ\n\u031e\x90=\x16;,\xcat\xc8\xfe\xc3XOwH\x16\xe3!\x8bu\x80\x15lu\xad?ZN\a\x88\x019\xbc\xe3\u07e1\x8b\xf9\xf5\xdb\x03\xebD\\\x9d\u7c75\xf9l\xb5\xe2Y%\xfc\x98\xeb>\xac\xa3\xbct$1.\xd5U\xa67\x94%n\xefp\xbbW^\xc0\xe5.L\xa7\rK\xd6\v\xb4\xbf\xa0$K\xc1\x01P\xee\x99\r\xe1\xbcl\x1c9\x8f\u0587o\xefQ(h\xfe h\x12 \xc2\x1aK\xa6[*\x87\xcd$\xc8u\xed\xdbV\xf2o|\u06b7D\xaa\x85.\xab\x9cXV\xb1o\\V\xaf;\x89\x111\xe2\xdc3F\xe0\xa2\xf4\xb8\xce}\xebp\x7f\xdfMn\x8aN\xbdk\v4\x18]\xdf|k\xbf\x7fl\ue5c7g\x93\u0759\x06Y\xc8~\x97\xd0\xfa\x8dg`\xdfp\xa9\x83\xf1\xd07\x9a\xeb\xeb\xf6\xe2{\xbb\xfd\xaf\xf0nauW\x9b\xb5lN\xbb,\\\xe7\xdeS\x83\xa3G\xf7\b\x7f\xf9\xc2d\xa8k\u84c9\xe9\x1c>\xba\xd0\x18\xb6j\x87\xb2\xc0\x1b{Z\"\x16O\xe0\xe5Hv\xc0\xb4Ok>\u05aau-=\x9f\r \xcf(\x16\x0e\u00b6.\x1a\x16\x9dg\x98\x05\xf0J\x84\x90\x9e\x1e\xc5\x13\xf3B\f\x067\xaa\xf6\xc1`5!9\xadk\x99\xfa\xc5;\xb2,\x8d,\u00c4H L\x1e\xc6\x10\xd2:&@\xea\xa1c\x02\xcf\xc0y]\xc8\xe6*\xf5\x1cD\t\x99\x87?\xfc\x10\x01\xab-\xf8^\x19\xb3\x88G\xde\x7f\xc0[\xe8\xe4\xd92_\xb4:$\u8689\x14/bS\xb6\xe7\xb3\xe9|Fa\xb5\u8c2f9\xf3\t\x15\xc8\xe3\xbe\xfc\xbe\x82\xcaL\u06c6\xdak\u04a9jJ\t\x8d\xa9\xda\xc7\xc4#y\x9d\b\xc9\xd3\xf8\xb9\xa2\x1b\x04;\x9fA\x19g\xea\x92\xd79f\n\xfb{\xea\xd8\xee\xa1\xf1\x0er\xfd@X\x1b\x04@\x89\x98\x02/\x17\x15\xdd;\xf1\xf6!\xef\xe15\x80\t\xa9\u05dd\xd6:\x90\x04\f\xbe\xf3\xfa\xc6\xecq/\xb6\x86\t\xa43s\bE\xa6\xe4n\x94\bq\x86\x81[8\x11Tu\x8e\xbdw\u063c!\x15t\xed\xce\xechw\xb63d\xc3\xf5P\x9e\x82\x1d\xd2\xcby\xfa\x0e\x87\xf4\x9e\x9b\xbb)jL\xd0\xc4\xc5\xf0^tbc\x8c1\x9fX\x14\u0285_\xd9l{F\xdd?\x99x\a\xa9O_l\xa7\v\xd9\xe8<\xe4iO\xe2\x9b\r\x1b\x15\xa4\xb6C\xf2a\x02\x01r\x9d\x87\x7fX}\x84q\x1a\x03v@\x11\x83\xf8\x1d;Z\x01\\Q\xb9G\xd0\xd2W S\xa4j\x84\xc9\xc6k@\x8b\u0368\xc2,\bMN=\xd8Jl\xb8\xaa8\xc4\u06c0\xa9C;\rS\xcd\xf9\xac\xac\xf4\xb1\x1d\xc0\x05\x91\x8c\xedQt?\tIB\xb8\x9dWa\x00\x0f`\u05dc\x9a\x10\x8e\x021\x03\x82\xd3\xe1j\x91WI\xa0\xc9\xea\xda&\xddl\f\xd8I\x01o\x10q\xc6\xcd%V\xfcrg lp\xe7\xc5\x15*\u0423pJ\xc1\xfbp\xc3\x015\xab\x15V\xe776|v\xc1\xdad@F\x13\x91\xae;\x84]U\x1as\tDW0\xee\n\aS\xc5\a\xb6p\x86\xa69\xa5\xac\x8fL\"\xe0\xe1P0\xc4!\xc5^PbH\x06\xe1\x19\"\u02f3$J\xb3\xf1\xd5\xee)\xdbe\x90\x86\xc8\xfe:\xa5\xd6\xe4\x13\xadM\xe8&\xc9\x1eu\xf9ppy\b\xc20\xb2\u02bc\xb3\xf0\t\x9b\xaa\x02\xb0#\xf89\xb9\x04\xca+\xf7\xed\xd8X\x9e\x13\x80`\xce\x17\xc7d\xc3r)\xf3\x82\x17-\x02\x0e\x984\x05<\xa3\xb5<D\xc1\xd8LH\xd2\xc9\x05\xb6\x7f\x1b\x10\xd2g\xcd\xc1\x10\u03c4\xea\x06\xc1\xdb\x1f\xe6k\xd5f\u50b2;\xcb:\xe5\xa6>\x96!\xf8|\x92\x1d\x12@\xbe\xa2\x9c\xb08\x19%\r\u012c\v3}(:\xe4\x1f}Q\xf4*|.\xbe\xf5^\xf8\x92Z\xd0\x18\x10[&\x04\xa6#L\xb3\xcd(\xc6:\xef\xc1\xbc\xe5\xea\xd9\x03\xccV\x8a7\xde\xde\xc4\xe1#\xcaP\xea#\xba;gr\x8f\xa1X\x85\xef\x00\x7f\tF\xfdD\xb6\x0f\xa7)\xa7\x11\xc6?\xac\xbe\x04X\x1f\xe1\xbez\xe5\r\xa0\x88\xbej+o\xea\x8dZ\xa1\x92g/\x93k_~!\xb8\xc7\xea-\x12\x04\a\xcdT1\xc8\u01b0\"G=!.\x17,\xc8qrJd\xef\x01T\x0f\x94{\xb6\xa8\xbb\x8cO\x99\x84\x9f\xbd@\xc9]ooXC\x86r\xfa\xfeK\xadY\x01\xacb\xe7'\xaaJ\x83\xbd\xfb\xf7\xbb\x90\xedN\u019fze\x06\u1206L\xa6ldTxD`\x05\xd9B\xa9\x1e!;\xcdv\xf9e,\xee\xf4xD\xd1~W6\xb0?h:\xbf\xb2\x8e\x01\x93*!\x84\xe5o\x0f\xd0\xf3Y\xcc7\n_\x90 \xf0N\xec\x16\xb0\xc5\xf8B\xe2e\x17\x02\xacd\xfcFhR^%#\xef\x81\x16\x99\xcfz\xef\xce\"\x8a\x7fL\xc4\xd1_\"\x04\x97G\x00\xfd^\xed<2]\xfb+\xc2\xc3=\x9aoSl\v\xa4\xd5\x06\xc2B\u0761\xd7\u030c\xb7}\x80pPe\x00R\xe2@b\xee\x99\xc7\u0658\x84#\x06\xad\xd5/+m\u0149\x12\xb1`\u02d5)TM6\xa5\xf1\x13\u0108\x9du\x1d\xe1^)Z\x02\xdeTN\x85{\x87\xcc'\xb4j\u47e2\x84\xbct\x93_\x13b\xe4\x01_\t+\x02?Rx\rs\x95e\x88\xa7g\u049f\x140\xfdd}&\xafM\xf9\x81\xe5z\xbd\xaa\xd2\xf0\u01f5\xe2P\xfb\xe3\x0f\xaf\x9a.\xc3\x06Kq\xff\xf1\aw3\x8d-N{\xe0Li\x80+elq\xdeS\xaa\x83\u023e|\xa5\xaauJT\xf0\x85\xe9\xd4J\xe4\x13P\x87\x81\xf1\xbe\x01\x8c\x14\x1a\xb1\x0e\x91\x80!h\xf2\xa5\xb8\xe7yqB\xec1VD\x81O\xa8\\LT\x81\xf5+\xdeA\u013c\"\xad\xca\xd4\b\xc7V\xdf\xf4H\xa4>\x88w\xfb\xfb\xfe\x1a&\xf3\t\x8dq\xf7\x9e\x7f\x90\xb1o\xbf\xa3\x92'8*\x99 \x8eb\x0f\xf7\x0e;\xc8\xe9\aByd\xff\xcf\x1f\x05kv\xfb\x84N0e\xb6`\xe2\x7f\ai\u12420\x19\xc0\x9bo[\xd8|\x91n]\xdb05\xb2g\xc6O\xbcs\xd5R\x84N5\xa06\u3e21\x00\x10\xe1\x10asE\xcf\xdes\u02c9\x9da#&\xc7\x1f.\x1e\x94\xc8B\xff>\u03d85\xb0\xc1\xb3\xce\xfd\xa8\x85\xa8\x06\x8c\x01@Q\xa6\xc9t\xa2\x1c\xd9\x03\xedw:\xbff\xaa\xe5\xf7\xe8\x95\xfeU\xbd\x16Uu\b\xf1\xbb/L\x12\xe7P\u063b\xd6\rV\xe0D\xd5\xd1=\xf1vF\xbc\x88\xedU\xf9\x16.\xa7\xd4f>I\xc5\x01\x934\xa2V!\x02\xebk\xf0\x0ew\x136^\xc0\xac\x98G\x95\x9c\"\x8f8g\xe0\xdfI\x8d\xf3\u0227\xbai\xc1\xc7\xd4\x13n\u046b\x9c\xae\\\x03\x9bD\xcf\r\vI\xac\xa0\x86\xa85\xffM\f\xeec\xb6\x156\xf76\xae\xad\x14\xe2)\xbc\xe5F\x146m\x84\xa6\x9c6\x88)8\x8b\x9fK\xef\x0e\xf69\x894B\xe7\x10N\xbdY>{\xbc\xee\b(\xaf\a\x1c\x8e;\xef\xe8\x84\xc4\x01\xc6##\xa8=Y\x87\x84\x13\x02\x80RU\x93H\xb0T)\x14\x90\x81\x03\x89\xa4:\x96\xfb\b\x9eO\x82S\x80\xd9\xf1\x81\xfc\x06\xe5\xe4\x97_\x03\x1fl\xd5\x14\u011e\xa4\x92\xda\xf0\xc8\xec\x9d'\x820|Y\u0395\xfd\u0517\xe8\u073f\x9f\xbe\xff!\x10\xe9\x11[\xc4;+\xa5z\xe5!EQ\xad\u00ca\xff\x12\x80\xf3\x1d\x000\r|\x03\x00\xdc\xd2\xc5\x1fg\xea\x1f]\xf5\x0fS\xd5\x06\xbc \x12\xfe\xb6\x17\b\x01\xba\xc8\xd6\x0f\xb4z\x95\xfd\x1f\x9e9n\u02a8\u0225o\xb2\x87[p%\xb5?\x98F}\xa5\x10\x88B\x9b\x10\xaa\xa6:\x01t\"\x9f\"\xdfC\xa3\x94J\x89\x94J\xb0TO\xfdc#\x8dR\xc10\xa9\xc8g&\xe2#7\xf0\x7f_\xe0\xff\xfe\x19A\"E\xee#o$\x92\x8a\xef\x8f\xc4U\xa8Q\xa9:\x9b\x01\xf5\x86\x16\x89\xde^\x00\x89\xf4d\xc9\xfa`B\xaf\x83\x87\x16\xac5\xe1\x8c!\xff\xc7L]KhS\xa1\x12\x88r\x15nDQ\x1c\xa8w\x9cGF\xfe?yu\xa0\x86z\x1cS4\xd4Ss;\xb47\xa2M\x13\x11\x82y\xecT];\u019b;^a\xc1]H\xe1\x1d\x99\xdf8\x80/\xca2\xf2\x83\x16\xbck0\xa5(p8x\xbf\x86\x1d\u00eb\v\xa0h\x06U\x15\xd4cn\xca&k\xdc{4\xe5h\xa6\x0eQ%\xbc\x9c\x02\xa6A5\xb9\xa1\x85\u0336\x10\x99u@%\x9cl\xb1G#CZ\xaf\xa6p\x87 \x05#\\\xe4Sge\u075a|Y\xb5\x0e\x91;\x93\x10\xf5\xb0\xa7\x06\xbf\xe7\xc9$\\s\xd4;\xb4'^\xd9\a\t\xc8T\x0fg\x84\xf2Gi\xa4\x82\xffF\x99\xf6\xaa\xcf\xf4C\xa1\xaf\xd2_\xbec\xa6F\x1f\x1e\xe2\x98>\x8a&\xf0\x17\xbd\xc5\u07a7\xb6;+S\xffQ~Z\xfeD\x9f\xb1\x83\xc3\x01\x87\x00\a\x86\xcf!\xa5\xd4\xc5\x1d\xa7b\xb9f\x132\xa1T\x9c\x8aIML\x197\x98Z.\x93\x0f\x16\xe4\xe6\x14\xe6\x7f~\xa3!.8\x8c\x91\xee\xfa\f\u7308f\x17\x8c\xach\x882\x1ck:\xc3+\va\xa8\xb6_&\x87\x1a\xdcpa\xe3\xdf\x03J\xfc\x01N\xebW\xc1\x0f.\x19\x040\xf9\u0644\xac+\xaa=\x00\xc2B\xa5m~o\xfd\xa1\x05\xb484C\v\xb1v\xc0K\xc2@]O4mc\xf3\u07d1\x8edo#4\x90\xa6\xe4\xf9#\xaa\uc821\xd7\xe9z\u0512\x8a\x1e\x91u\x8d\xa2GFBN\xf9P6\u0724qpF\x15\x91\x89p\xe1\xe5]\xff\xfc\x06\x15XVv\x9f\b|\x81\x90\xd8\a\xbf\xb7\x1a\xef\xb5\u07ff~\rm\x18bC\x057I\xf1\x17F\x96\x04*\xc4\x0e\xcd%\u04047Q\x17\xc03\xaf'\xca_}b-ym\x14\u009e\xf4\u0295>\x0f\xa1G\x80\n\xf9_\xb0\xff\x15<\xc5I\xe6Y\xd6m\x15D\x84\x83\x1b=}\xaf\x15\xeb\xd5\xca!\xf1\x00T^\xc1\xc7{a\xd9$Em\xbd\xaf\x1b\x06\u6a4bb\x88\x9b\a\xe1i\x97\u06c7\xb3\xf2\r\x92\x8a\xa8\xed!\xb6\xb9?E\xb411\xa5\xd4\x14\x9e;`\xc3h\u05ae9\u07d1\xa1\x8d\xfd\x1d\xe5x\x80\xa4\u02cc\xecN\xf4\x13\xef\x814\xf3\xdf&\x91\xbd\xcf\xec\xf0\x04\xf8\xbc\xd7\"\xb0\x14\x8e\x1e\xf5g\x9d\xd6q\xe4\xeb\x9e<a\xbc\bN\x06H\xc4\xd6Q\xd6+\xbe\x87~\x1d\x13\xeaf{\xfd\x8aw|\xb1\xd0\xe7(\xa1\xb6_\xd1\xcae\xfbe\xacO\xff\xa7_\xd4B\xf6Yg\xd65\xa7\xd1\b&\xa2\xc5Y[I\xb0\xc5\x06\xaa\xd9H<!f\xca\xec\xdc\x05\x82\r\x051\xb7\xbdvy\xfeeL\x81\xaf\b7t\x05\xa2\v1\xbc\xfc\xe5i\xb40\x12\x0f\x03\x89\x1a\x8a\x86\u76b2\x8f|\r:&s\xf3\xc4\xe7i \v-\x06\x0fa\xc2\xda\xd35\x89G03\xa46\x98\x8f\x19m *\x10\xddG\u0517\x82\xe00\x95* a\v\xee\x8f`\xec0\x97\xf9kh\xe4\r\x9av\x000\xa9\x93\xa9\xca\x7f\x9b\xa6\xba\x04\x88\x17\x8cf\xaa\xacU\xd08\xa0~x-8\xa0\xbe\x06\x9b\xe4\x00\x02\x13Ul)\xca\n\xf69\x95^\a\xbc\xb0\x17\xbe\ue69dy\xbf\xcfk\x87\x03\x1e\xd2\xce\xe3\x81\xf9\xa8\x02\xe5\xa5Dy\x9f\r\xbc\xf4\xe2\t\xc0\xd8\xe0\f\u0327hC\xac\xd8DR\nX\u049a0\xe5l\x041\xb7\x8c\xcf\xf2\u05c1\xde\x18\xb1>z\xc9\xc7@\xbf\xa7H-\xbc4ds1\x9f\xf0@^\b\xd6\xe4Vza,\xa4\xa9\x90\x85\x8du8\x8e\x83?\x19f,\xd5'pOG\x91ST\xfe\x9a>\xb2\u064a\xf2.Y\xe5\xc5\x17\x925\xc34MP\xb6\xf0\x0f\x81P\x85\x9d\xf1\xdd\xe5\xc4\xe0\n\x1b&a\x11W\xb4\xba\x8bj\x03\xe5\xe3!E\x94\xb5\xfc\x12p\xde,\x88\x8f\x06\xe6\b\xec2@}\x86\x18k\x89\xb7q>\x90\x82O\x9b\xb0\x148-M\xc1O.O5\x17df\xe2\xc1_\xbfj\xf6t\xf6\x85\x181\xdd\xed\xa2+\x0e\x83+?\x06\x16\xa4\xc0#\\Z\xf6T\xa9\xa0C\xba\x9c+\xbb\xda\xc0\x9a\xea\xb5\x05\x8cVeU\x89\x80\xacVX\xe8\xf1\x9aq\xb48q\xa1\xa2#\xc0\x84O\x0e*(HM\x98\xa6C\x9f\x99R\x99\x15v,\xfa1\x00}\x95\x85\xa8\xfc\x18z\xeax\xdf\x7f\t{\xee\x98_B\xf3\xa6aR\x1fBj\xe6[\xcbtGL5\x0e16\x10,=\xbc\xc6\x1e\xb5\xe0\xa32\xf8\x85/\x01\x83m\x86\x04\"FOBv)*\xb0\xed\xf4\xd9\x04\x03\ak\u013d\xe0\xab\xf2\xc2\xef\xfcF\xa6>\xf11\xaf\xa0\x8aG\x00o\xf84FF\x02\xe2\x82C\xa6\xd7Z\xfdI\xf4\xf7\xaf\aA\xce>\xf0\xf8\x03\xf748\xb2\x85\xc0\t|%7\xe7\xfe\b\x84\x89\xeb\xf5\xc46~\x9e?\x82\xbe\xdd;d\xff\x1f\x8d\xb2\xc7{\xda\xc7_\xf8\x8e\x1d\xf9\xed\xb7\x05h\x15\x94\xbd\xfcu\xaaw\xa1\x81jT\x8d\xed\x1d\xcel\x1e\xa6\x1a?\xd9S*,\xe14\xf1\xbd\xbaf\xf6s\v\xb6\xf9`\xe40GE\xda\xe5@\xfd@\xe3D\x9f+\x13\x1ec\xc0}\x17\xa0\x83wO\xa06C97\x0f\xfa\x01\u06c7\a\xf8^\x19\xc8'c\xf09\xac\x8a\x01,,!K\xa4\x1c\x91\xcb+\xcav4C\xa7\xeb\fvF\x99YcS\x9bO\xbbp'\xee\xe5\xf0\xe5\xc1\xffT\xb2@\x9f,\xf9E)\xe6X\x9eU\xd9\xeat\xac\xae\xe9z\xb5E\t\u4a9f\\\xf8z$\x8eYQ\xd3i\x19\xbe\x98\xe8>\x02\xc5\";pE\xbb\x91\x8bq\xcdF\xd0\xe9d\xc0\xefg\x10\xb8\xe0D\x95e~\xfc\xb8\xc24\n\x7f\x86I\xc42\xb0\xbf\xe8X\xa4\xcfD\x01\xed\xed\xb0\xe2DG\xdb'\x90\x1eD-\xee\xef\xdd9;\xfd\x18\xc2G\xc6\\X.:\x8b\u0259\xd0\xc9k\xcb\x15\xcbL\x9c\xc5|\xad\x85\xb4\u04e2/X\xfaR\xf1\x88\x80\xf6\xe0\xbfS\x9fw\xc8|4\xf3\xa6\tP\xc4l\xe3\x16\x960\x85\x18v\xf43\x9b2\xcd\x11jr\xa2\x88\x85I\x84\t\x85\x8e\xdcpi\xadj\f\xde\f\b\x19\x8d\x00V\x06\xb6\xa3PV\x19I\xe1\x05Er*\x13#\u0101\x8f\xd9\xc9\xf0\x8d\xbea\xaa\xe23Uo\xe6\xc4\xf11\x14\x9d\xafL\x99\xf2Y%|\xba\r\xaa\x04\xab~\x1bk\xc6c\x8c\xec\x89\x19~\xf6\x1c\xa3\xa2\xb4\xb6\xa3hP\xa1Y\x11\x89\xb2\x00\xecN\xfc\f\x9c\xa9R\xd7'\xfc\x94S\x02j\x0f_}y\xb6\u0250`\xa8\x8a\xf2\xa6\xe9t\xd78\x04\xc1g>\x7f \xdfG\x87<\xab\x0f\xfc\xfe/\u05a7\x00Q\xa1Ny\x98\xfb\u04f2\xdb\xf6\x90\tH\xc6gb\xed`\a}\xc6\xf4\xa6\xc37\xc7\xc0\u04a9s\xad\x1dJ\xc9\xe2\xca\xc1_\xb81\x8d/\x9f\x11\x03;\x9f\x1e\xee\u00a3\r\xfa\n\xf3mX3&\xedP.z(l\x9a \x85A\xfb\xe6,\xa0\xb1\x03Z\u07bd\xae7\xfe\u00c1\xeeV_&7\x0ex\xd7\u0316\xd4\xce\x7f\xc7+\xdb~\x82\x97\x9f}\xfb4o\x03\xc9\x1e{\x90\x052\xb0j\tmFOX\x10\n\xf5\u0493\xe5z\x12c}\x1b\\\xe0H\xcb\u040d\xe7-S\xe0;\x1c\xad\xa1\xbb\x90{|\xc6\x04B;\x92[\xefvC\xc8}\xa0I\xe9\u69f9\xf6\xf1\xe3\xc7\x00O*\xbb\x93XPk\x94'\xef\x93\x0f\xbe%H\x93\u00fe\v.\xf5\x9a\xd4ig\xb8\xe8\xd1y\x8d\x91\x14L\x88D\xed\xa0\xfe \xd5\xfe\x1d\x86\xbef\x7f\x0f\f\xf8\u01cf\xbb\b\x88\x10\"\xec\"Uv\xdd\xc5q\xf8\xeb\xb6>\xa4D\x1a]y\x19\xe7\x84o\x12\xa45\xbb;Rf\u0766\a=\xfd\xa5\\\xa1Z\xe1p)X(\xff]\u0578H\xdb\x14m\x16(+h\xe1{\xeeG\xd0\x00fM\xael\xef\xee$\x9c\xe7hS\xf4\x12'\a[\xf9\xb7)xA\u03c5\xff\x82'S\xa4\xabSW\xe0u\xb0aC\x8d`v\x17P\xc1\xe5\x9a\x13\x90\xf7B\xafPD\x8d,>\xd5\xd2\x1e\xf3\x86\xadP\xe5?\xb0\t+=PQ\x99|\xb00\x8e\x94C\x104\xf6\xfe\xe8\xe8y\u019a\x1dN\xcc\xd9\x11\x14pd\x7f&\x12\xb1w\xce\xf8\by4\xf1\xee\xf8p0\x1b\x8fv\xc4\xe0S$\x86!\x1b\xebi\x84d\x8d\xf0j=\xe0\x14#OB\x8b\x93X\xe4}\xe4\xb7y\"e\x9c\xb0\x17\xb0\xd3\xfe_\xed\xdd/L\xd8\xeac\x1b<\xcee\xbb8ow\x9e\xe0\xedth\xd7w\xcc\u5ece\xbdP\x1a&\xa8\xe1q\xec\x9c7\xec@\xc3\xc1\xd1Li\x93\x14m\f\xde\u01806\xbd\xa3\x9e\xd2\xe6X\xb4\xe9\xf26]hc\x1c9J\x9b\x94h\xa3\xf36&\xb4\x19\xf9\xe0\x9c`\x9bX\xac\x13\xe3mz8@\x93\xa1n*\xcdNE\xb38o\u0587f\xfbG\xef\x946g\xbc\xbb\xc41o3\x806\x93\xa3\x91\xd2\xe6\\\xa0\xd4\xe1m,h\xf3\xec\x1b\xbe\xcei\x19?\xe3m\x1e\xa1\r%\xe6}\x87\xf6U\xa5qG4\x16\xf8\x0f\xa1\xf1\u031e\xae\xb44xKI\u0551h\t\xf1\vJ\u00ee\x00)\xc61V\xfa\x0f\xb45y\u06e4\x00:A\x123\x91\xf0\x0eS\x19+M{\xd44\xd9\x11\xb3aCS\xb8\x12\x8b{\xadNc\xa2\x95 \xd0T\xb4J*\xad\x04\xbb\xc5\u0128\x9fD\xab\x94\xd2*!`\t\xe4\x1c\xd1\xeaTi\x95\x14\xad\x04'\xb9\xa2\u0579\xd2\xeaX\x10E\xc0\x9a\xe1@\x195\xde\xcdTN9\xe5L\x97\x92\\0\x87\x868\x19\x81\x96'\x82v\xa2\xe5\xb3Bg\x7f\xd3S\x01T\xf4\xfe\"\xe6\xce\xdf\xeeL\xd0E,\xc3\x05\xb2\x17\xaf\xd3\xf3\x0e\xe6Ei\u03591q\"\x10X\u0498\\\xf7\x9d\t\x19\x99\x95\xa6\xbah\x9a\xe2M_\xf9\xfaf\xba\x80\xb3\u049a\x982\x964\xc4\xf4\xfc\x0e\xad\xa7\x96\xd2\xc4\x10\x00E\x93?p\xb1\u0633\x15`]\xbe\xf4\xf4$o\xf9\x15\xc9\xe4X3\xcb\x1d\xbc\x9b\u008d\x80\xd2\xda\x14\v\xf5\x94\xb7\xfe/\\\xcf61\xedW\xe5\x12 C\x10\xbeY\n\xa7\xde&\x85\xd3;Ia>,\xbf\x14N0\x16\xd5\xfc4\xf8\x8fp\x1a\xa8\xe3k\u05b5t=[(\u0409ab\v\x8d\xe7pg\x943;\xa1<w\x19N\x98RW\xf1\x9a\x9d\xc3\xf5\xfc\xb7R\xf6\xe4m\x94=\xde\t\xcd.\xa0\xf4-t\xf5\xda\x1f\xc7D\xfb\x8e\xc9\xdb\xff\x03\xda'\x8f\x8e\x95V\xa9\x0eo\x15O\x8aU\xf8\tZE\xac\xc7\b\x93\x8c}L0\xa1E)Q[\xdf\x16\x97\xe2\x00\xb6\xd7\xfbuO\x01d\xc8\xee\x84h\xfa\r\x00\u014f\x12J\xa3\xaeht*d\xc3gu\xcd3\xfd\xdd\xf9\xc1\xbf4\xf9\x90\xcf\u0535\t!zl\x91\xb8\xfe\x15J-ON\xd4%\xda\xf3/M\x8e\xa0\xa1\xae\xcd8\xa3\x87oE\xf2F\xc7\xea\x92\u050d9O'\xaf2\xed\xa55\x99|\u03e2<}\x1b\xebd\x03u\x91\u05b7L\xed\xc4d=B\xdf\xcff\x92!b\u01b1\x8f!\xd2\x11m>\x1e\xe9\xf3Y\u061cwO\xd49\x8fTC\xdaJ\xf2\x1b)u\xea\x01.E(\u0256r\x0e\xba\x86:\a\x91\xb9\x84\xea\xd7\xf9\xa8\xb1y\xae*}\x113\xc2'-\x8c\x9d\xccc\x95\x9d\"\xfa*\xba\x1eC\xf5|\f\x15\xb1C\xda\u02a1\x99)\x95\xb3\x00\xae\x7fh\x1e{\xf5\xd6\rm\x85\xc7\xc0\x88\xf4\xed,v\xf66\x16\xab\xed\xc68\x88\u04df%\x9e\u0318*\x9e\x80hL\xbb\x7f6\u00c4\x94\xa7\xf8~\"=\xc5\xc77r\xca\xccS\x1f7\x1a\x11\r\x8a|\x8eFz\x18;\xea\xa7*;\xba<\xbb\x97\xbb\x1cwl(\xadc\xcf\xc1\xd0\xc0\xce\xf3\xa1|t\xee\xe3#\xc9salt\xeec\xa3\xb9\x18e\x18\x17\x9d\xf9\xb8\xc8\\mj\xae\xc8Ed\xa3\xcd,\x94\xd5':;\vM\xbe\x99\x97\xce\xdf\xc6K\xb7o\xe0%\xb8\x99C\xe4\xfcL\xf5mLb\xfaw2\xd6\u05b0\x1cc>\xee\x8d\xcc\xc5w\xb3\x8b\xa9\xfb\xa4\x97\xb9\x06\xb8\x9c!Sl\xbe\xff\xa4m\xd5\xd7>L\x8e\xf5\x8e}r\xcc^\xf3\xc1\xbf\x11\x13\xf6:AY\x16 \x89\u028cy\x13R\x8c~3\x0f\xc6coc\xc2\xd2n\xe6\x04Dj\x1d\xefI\t\xf1\x8f]%\xc4_\xbf\x89v}\xfaS\xa4\x19\xb25\xfe\xf5\xdb]\u03e7H\x056\xb1\x00\x93t{*\x93\x98\xee\xab9[\x95TX\x00\xec{\xb8#\xfe6\xeex\u0609;,\xc2\xea\xcf\xda\uff87\x9d\xfe\x82\xfdO\x8a\x8f\xcf\xeb\xf4&E6\xf9u\xac\xf9\xaa\x14V\x98.\x16d\xba\xa0\x00\xf1x.\x11\xe4\xb9?C,\x99~\x15\xcbR\x9b\xaaLW\xb1\x9d\x17\xb3\xcf&\xf8\xe8B\xff.u>\x9ex\x1b\xf7\xe5v\xd6\xe7Ov\xe2\u04c9\x1cHW_U\xec=\x06\x942\xe9\x1f\x01\x99\x14*\xc0N\xfc\x02,\xe7\x1d\vCe\xd8YP\x86\xb93\xc7\x1e\x9a\x7f\xd2A\xe0\x9fk\xa5\x9dr\x10\xf0o\xa0\xfaf\xd1x\xe2\xe7R3lx\n\xa7\x9e\x05958\xbc\xbf\xf40P\x9f~'\x87&\xdf\u01a1\xed\x9d\xf8\u039d\x86\xb0\u06ffF>\xeaq\x1f\xb7\xfe\x18\u0470L\x1e\xa6\xbf\ta\u05b8\x8fY+\x11mf\x8d\xba\xa1\xbc\xda\xe9\xf9x\xf5W\x05p\x18[u|\xc2/0\xef\x1e7\xc5}\xdc4Y\xe9_a\xa6S\x1f3\x05D\xba\x8fG^\u060b\xef\xe1\x917^\u061c\xee,\u016ev\xe3&\xc2\x7f\xad\xf0:\xf7\t\xaf\xdc\xeav\xf5oi\xc1\xd8Ip\xfd\xef\xb4`\xd4_,\xd7\xfdvv|\xa3\xe5\xfa\xe3\x8eL\xc6pZ'\xb0\xa4\x96\xf3\x1f\ubd1co<\x97\x9e\xfb\xd8q\xf5\xa0\xf6\xefp$\xf5\xda\xf7Vt\xae/~\x9d\xeb\xcf9\xbd\xfe\x1b\x9cMv:\xc0b\x88\x86\xc9\x03c\xf4n\x97G\xde\x1c\xe9\xf3\xaee\x1fA\xde`p\x91\xa5\xbf\xec~\xff\x03x@\xc2]\xd5\x0f\x91F\xa2;i\xbe\xa4\xb3i\xf9\xefb\xf0t\x97*\xe1\xaf\xe5\xcb\xe7\xdc\xe3C\xe6\xaa\x7f\x99\xe8$\x8b\x96~_\xa6&\x0f\xd9S\xd9\xfc\xca\xc8\xd0/\xd9c\b\x1a\x8a\xa4\x9b\xe7\x93v\xbc\x9cV\xff\x1d\xeb\xa3y\xbd\x9f\xc3\xdfM\xb7\x90\xcce\x93G+\xff\u0386\x17\xdd\xf1\xf9\xf2a<z\xbd\xbae\r/\aS\x04h\xe4\xfb\xf3F\xb28)\xe4\x17\u04c7Q\xfb\xd9\x18\x17\xa7\xc62S,\\\x14^\xca\x17\u00d7\xcak:E\xdd\xe4.\x05\x80R\xb3x\xd1b\x1d\xe2\xb0..\u02c5\xf2]:V\u0334\b\xc3t\x9a\xc1\xcf\xf4\x8b\xd9au\x98h\x17K\xfa]\u04ee\x0fR\xe3b\xadP\xaf\x8fG\xa3r\xf3\xc5j[M\xcbh><\x1c\xbf,\x16\x83\xc1\xe3\xe3\xc5U>\x9f\xaf\x96\v\x17\xb5\xe1%|\xcd@\x97\xd2\xe3*\x02\xb4\xf7\xdbE\xdd=N\xb5\x17\xfd\xc9\xe3\xa4\u052f\u078d\xaa\u0552\xd1\xcf\x1cOk\xc7\x17\xc3\xe2\xcbss\xfc\x908\x19\xcfJm\xa7\xe3\x1eO\x8b\xb7\xfd\xca\xddm\x93\xe1QH\xdf\xe6\xfa\x83A\xadV\xafg\xf3\x97\x97\xf9R\x01\x01\x16\x1e\xd8?\x9b\xbdX,\x96\xcbl~2\xb9*\x94JOV\xbf\u07f7\xd9\xdf\u064b\xc6\xc5\xf5tZ\xacT\xab\xf3\xb1m\x1f\x1f\x9f\x9cXV,\x96+\\_w\x1a\xf5\xfa\xf0e\x11o\xb5\x1f\x1d'\x96\xbf\xbf_\xbc\"\xc0\xd7\xc7\t\x03rS\xad\x9a\xa6a\x9c\x1d\x17o\x87\x95;F\x84>\x10\xed\xb6\xff\xd0ng2\xd9,`pY*\x94t\xfd\xc1\x80\x8e\n\x17\xb7\xc3K\x86%#b\x1f\u96f9\x1a\xd6jE\x04\xe8\xd6\x1a\xd7n\xed\xb5\x12\xab\xd7n\u03acE-\xf7z_+\xc7Z\x8dV.\u0782\x7f\xddV\xfc\xbe;\xbe\xbf\xefN\xe0'\xde\x1e\x17Z\x9d\xf9U\xbc=g\xffM\x14Z\xdd\xf3\xe3\xd6 _h\xe3\x0f\x02\x84_\xf6\xaf\x92\xbd\xf3$\xfc\xc4\xfa\x95\xfcm\x8b\xf5\x9caT~\xac\xb6;\x8f%\xbd`\u57ee\xad\xaa^\xb8\x18\x14t7\xdd\xcf\f\x01{\u05a68\xb4\n\xd3\xe1S\xa58\x1d\xb7\x9f\x9c\xf1\xb8\x83\x00gc\u02d9\x8d\x93\u05ee\xf5z\xed\xf6\x97\xb9\xc1\xd3\vpC\x06'\x1f\xfe\x952\xd3\xf1S;\xfcg\xdcn\x8f\xc6-\xf9\x83\x00\xd5\a\xeb~n\xf3\x8f\x85R\x9f\xf5\xc1~\x16\u025c\xc1~\x86\xb5Va\xb8H\x16\xdc\xcc\v\xcd\xfa\x92\xf5\x8d\x00atM\xeb\xf5\xd2x\xac]\x19\xaf\r\xf6\xf3\xca~\x16W\xdd\\\xa38\u02bdV\xces/7\xd9t\xbc\x9d\x01\x84\xfb\x8cWh\x12\xd2\xe5\x1a\xfb\xa6\xf6Z\x04\xda7\xadd\xc3xl\xdd\xd3JyM\xde\x1b\xb1\xe4=\x10\xbf\xf5\x96\x7f\x0fW4\xd3@\x9al\xbe\u06de\xb6\x9f\x10`?\xdd\x7f\x1d\xe6s4\x19\xd4\xff\x83};\xb8\xb8H\v\x06f\x1f\x14\xacA*\x9b\xd5cE\xe7\xf5\xb51\xac\x8e\xe7w\xfd\xa7Z\xbd\x13;\xcb\x17[Ew2\xd7\xc7\x0f\xe3\xe4\r\xad\x14\xe0\xbfN\xf9\xb8}\x9cZ\xbc\xbeZ\x93\xd2\u0638\ub3fbY\xdd8K\x15/\x8aO#\xbb8\xb9\x1dOn\xaaf\xad\xd4\u025c$\xa6\xb1\xe9\xf4\xf5u\xc0x7}\x9a\xcf\xdf\xe5\x19\xef\xa6\xd83\xfb\xea\xa9;z@\x80\x00\xf9\x8e\x01H=Y\xa9\xcb\xe2\xec\xf5\xd5\x1e7\xc7K3>o\xd5;\x8c\xd1S)\xe8\x883\xffS\xeb\xc4xus\xa9\xe36{fO\xf4qb\x9e\u02b6\x12\f\xe8i\xaa]|\x9d\xd3J\xb9\x9d\f\x94\x95B\x00\xfa\xa3\xecm\xfc!\x93F\tV\x1b$2\x8f\xf9\xc9C\xa1\xdf{8\xce?\fn\aS+\u07f8\x9a\xd4o.\xa6\xd5~\xd9\xe8O\xa7\x99\x93\xca\xe3\xb0]B\x80O\x0f\x95\xdb\xe6`8\x99\xde\u05f3 \x82p.\xd3\xd9\\\xee\xb2X(<4\x9b\u0361\x14\x00\xec_\xa9P\xd0Y\xc7}\xfb\xe9\xa9T\xaf[\x96S*]\u07d4\xcb.\xfbw\xf6\xb2D\x80\u02d3\u05cbW\xb6\xbc\xddr\xf9\xf6\xf6\xe5e1\xab\x14K\xd7\x17l\xc2\xc7\xd5\xca\xccd_\x9f\x1c\xa7\xeay\xa6st\xdbz\xe9\xe4\x8eu`O\xa7\xf5t\xac\x9d\xe1\x12'\x9b\x19\x0es\xb9|\x9eu\x8e\x00\x11\x83\xe9`\xb9\xb4\xc6\x13\xbbP(\x05y\xee,\u06f8\xc9\u0552\xb5\xc0\xcf\xcdY\x8d\xad{\xab\xc5~\xd8\u06b7\xe2\x8d\xf2k\x9c\x04l\xeb\xb2\xc5\x16\x7f\xbc=J\xdewf\u01edn\xe2\xea\xbe\x17g\xeb:~\x1c\xef]\x1e\xb7Gw\xed\u055f,\x97\xd8\xd8c\xae\xc0Hs\x8b\xa4A\x80\x83v\xcdb\x12\xf8jR\xa8To\xfb\u3324#_\x13\xb5d\xae\xb9H\xe5\x8ce;7\xac\x9f\x16\x86\x8dn\xc1}\xed\x15b\x8d\xa3r,V\xab\\6\x1b\xb5Js\xd1\xea\xc6j\xad8\x02\x8c-\u06a3\xe6k\xbb\x1b{m\x8db\xf1\xd6(~\xdf\x1e%:\f\x93\xd3\xee\xf9]\xa7}\x9e<\xea\xfa\x7f\u03bbq.\xfa\xfb\x8c\x80\xfd\xc2\xeb\xb8^\xb0\xd8\xcf#\xdf\x02\x8ecV=S\xa8\xe7\x1d\x86R\x1bWi\xb6_*\x9cZ\xd5\xc2\xf1c\xbd]\x18\u07b5\vc\xb3\u075eX\xed'&\xa5N\xa7Oz\xa1Db\f\x17Q\x8eo\xa1}\xbd\xf04!\xc6f\xbfX\x05\x87\xfd\x1c\xdbV\xbb=e\x1f>\xcd\xf5\xa2\xbb|:u\xe6o\xf9\x19flb\x9b\xac\xcd:\x82\r\xa7\xbb,\xe2O\xab\xce~\x96\u0174Q\xb8h\r/\xd3\xe5>\x92\xf4\xe5\"g\xdc\u0199\xc8:-\xb8\x8d^\x99\u04f0|\x1ek\x94\xcf[\xf7\xb5\xcbK&\xc6\x10\xa0\xd8\xc1\x84\xea\xf0RL\x97\xeb\xa79\u3d5b\x1b6[\x85Y\xbcU\x88\xb3\x9fY\xabu{\xbeM\x00\x11\xdb(\xff\xe2l\xc6b\xafu6\xd3Y\x98i \xe9\xe3\xed\xedC{\x90\u0256\x8ci&\xdby\x8c?d/\xae\xc6\xc5\xf4\u0760z\xab\x0f\x16\x19+7]\xa4_/.\x86\x95\u00a4~\x8b\x00o\xeb\xc6\xf9\xbcXH\xbd\xbc\xbc\xbe\x1e_\x16\xec\xcbf\xad\xdc?\x8e\x8d*\xc7\xc7\xfd\v\xa34\xbe\xcfMF\xd5\xf4\x00\xd6v.}\x99\x83\xc1,\x96\x17W\xb9\xfc\xd5u\xb5n\x8c\xfb\xb5\xf2\xf1\"\xdbN4\x97\x17C\x9a\x94i\xfb\xa6\xce6\xd8\xd9h\xd0\x7f-\xd5\xef\u01b9\xf1\r\xdb\xef\xd93c<\x1ce\x06\xd7\xd641\u030d\xabE\xe7\x16\x17\xf9\x15\xf0g\xf6\x84\t\xd7L3s\vK*_(7\xfb\xf6\x94\xf1s\x9d\xa4\x8d5\x19\x0f/\xafKe\xb3i\xb0u\x9a\x9a\xa6\x16\x8d\xd7\xc7a\xe1\xea\xa1Q*\xdf\xea\xdd\xfe\"=\x9d\xd6\xd83kruUh\x94o\xcd;\xa3\x7f\x9e\u0240zV(\x03\x97]\xa4o\xad~\xac\x9dk\u049e\x92\xcb\x1a\xe9\xe3\xab\xf4\xf05U\x8e\xd5\x17\xb7\xa3\xfa\xa2r\xf9\xba\xa8\x8d\xe2\x8bJ%\x9ej\xc6^\x1b\xb7\xf1f\xab\xd6Z.*\xad8\xfbob\u046e\xb4:\x0f#F\xeeJ\xa3Wc\xaf*\x97\xecq+\x96j\xd3,\xb7:-&Uk\xa3\x04{\x9a\xac\xb5[q\xb6J\xd8G\xfb\xadT;\x9e|\xadT\xee\xe0Y\x17\x80\xb4\xe2\xf1T\xfb\xfc\xfe\xbc=\xbbo\xf7eG\x8dZ\x8d:zm\xd3,\xc7O\x1f\xe2\xcd\xfbZ\xab\xd9j\x8d\xee\u060b;\xb6\xf4\xeez\xddV\xeb\xbc}^_@\xe3J%\xc10hu\u06adD\xaf5k\xb5\xdb\xe7\u01ec\xfd}\xab;J\xb0v\xac\xc3\xfd\xbbs\xf3\xf2\xb8\xd7>\xa7\xa5W\x1b \x06\xf1s\xf6-k\xfc\xd0m\x8f\x1e:\xddxr9`\x1b\xf9\xe8\xc9~\xb2\x9e\u0196\xf5\xf4\xf44~\x9a\x8d\x13O\xceS\xbcc\xcf-\xf6\xdc)\xb9c\x93\xfd\xfdZr\x9f\xf6\x1dg\xfc\xea\xd0\xd2c\x8d\x1d\xf6\x91k-\x9f\x9e\xac\xa5\xe3>\xbd\x9e>Y\xaf\u038c=\x9b?%K\xae\x93\xed8O\xcf\xcel~v\xfd\xb2|\x85\xccy\xac\xfd\x89\xe3\u03a9\x1dk\xe3,&W\xce\xfc1sFlcM\xae\xa7O\xcf\xec\xe3\xf1\xc9|\xcc\xd6\xe4\xe4\xaa<\x1b\xc7\f\xfb\x84\x81\xb1\x9c\xeb\x17\xe7\xa2\xe4\u038f\x9c\xb9\xb5\x1f\xeb\xd6/\xd9X\ufee3\xcb\xe4c+\xd1j\x9f'\xe2\xbdn*\xd59?\xbe[v\x1a\xf3#\x04\xe8\xf4\x9eK\x869?\x89=\xf7S\xaf\x893c\xdei\u03ee\xae+\xf3\xfc\xe9\xfel\xff\xac\xf3Zz=\x1fT\v'\xa3v\xea)\xd1\u045f\x9e\x9c\xf6\xfc\xe9i\x7f\xbe\xecX\xcf\x17Nu\x96e\xb4?\xbfo\xb7F\xc9\xd7n\x97\xd6r\xad;O\xbe\x9aUF\xd8\n\xa3\xcb\u04dca\xf5\fX=^\x19\x8b1\xeb\xe05m\xdcw\xdd\xc4\xe3\xe8\xf9~\xd2)\u0372\xc9\xf8\xe3\xf2\xc6(\xbe&\x9e;l\xa8\xa7\xd5\xf9M\xa2\xabW\x9f/\u0493+\x04\xf8\xf8\x02+ \x87+ w6M\xdb\xf5\x9c\x93\xb6\xd3\xc7L\x04\xe5\v\xa6\xd1l.\xd2O\v\xb6\xbcs\x97\xd7O\x85R\xadY\xbe}\x18\x18\xb1TiQ[6\x9b\xb9\xe9S\xa1\xddh\x96\u0707~\xab\x90\"\x85sY\\6r\u00e9]j7\xea\u037e9\x98\xb62%\xfd$\u07cc\x8f\x8a\x8e\xabw\x9a\x0f\xf3X\x7f\x9ai\x97\xf4z\xa2\x19\x1bM\x9f\x9e\x8cN\xf3\xce~\xa9=,\xd2\xcb\xd4Im\xf8:\x1c\x16\xa7\x9d\u06fb\xfax8#e\x89\xf5\x96:\xc9\x0e\x99~^\x9a\xea\xb7\xcdz\u031e\xb5\xdcEq\xa9g\x1fc\xc3\xcb\u0093~[o\xc6\xc6\xd3\x19vt7\xbc\x1c\xceJ\xe5\xceC\xf3.q\xbc\x88\x0f\x16\xd0\xd107\x9a\x15K\xc6\x03\xdfF\x13\xb1\xd9bj?.\xac\f\xebmR\x9c\x14\xcbu\xe8mT)\xea)v\x9c\x80\x8e\xc6\x0fU&?\x9ef\xa3v\xb1\xfe\xcaF\x84\x1d=T\xab\xf5\xe1p:\x9b\x16K\x8d\x12\x1b\xd1pJ\x9a\x83\xfb\xd0b2\x86i\xf3\xd3E\xbdsq\a\xc3b\xbd\xe9\f\xe8\xcbl1\x9av\x1a\u05edx\xee\u04be\xa6a\x8dgl\xa98\xfaS2\xcf\xe8\xe7\x14\xf5\xe6C=\xf6\xb4\x98\xd5\u0611\xe3\xf1jL:\xf6p:u\u0630\xee\u0630\x165\xa6T[\xc9\xfcxTq*z\xe7N\x1f\x1f/R\x83i\xa7\xd3H\u078d'\x95\x92\xd3\xed4\x9b6\x8ch\xfa\xd8\xe9$[\xe3\xc9\xf3s\xa1D\xf4c#\xb2\x10\xa0\xce\x00\xc4\u01e5\x99\xddn\xdc\u056d\xa7\x05\x1b\x96\xdeaR91z*W\xd9D=\fYGl\xa8\x8fY\xe8h\xe6\xceu\x9du\xf4\xb2H1\x85\xc4:\xbd\x1f'&\x15\xb7\xd2c\x13\xf5\xf4B\x93\xc2zk\xd4O\xef\xef\xee&\u055by\xafu\xc7\x0eo\x8c\x8d\xca\xe9\xdbB\xba\xd8\xd6\xd9y\xa4\xd8L\xa3 \xcd\xe5\vM7U\xd4k\x99\xe5\xeb\xc5\xf0)\u06fc.W\xeb\xe6\xd4\x18.\xb2\xa5\xfa\xa8\xf5\x9a\xcb\xd1I\xaa\u0639\a\xeaN\x17\xdd\a\xa6\xa4\u078d.\x87\xee\u04f5\u047a\u04d7\x8c\xe0\x8c6\xd7\f\x96\xcd\x05if\x98(.ns%\xb6\x1b\x16\u0671\b\x9e1y\xcd\x183\xfd\u041e\u05ac\v\xd2\x1c2\xd6\xf02_\xbe-<5\x1f\x80\x85\xa6\xb5\xda#\xccv\xfe\xaa\\\xbd\xb5\xec\xf6\xc3Y*S\u028es\u035c\xfdTzh\u07b2\x99\x1dMoAO\xb1\r\xd8\xe1;\x95l\xf3.\xb3\xec\u01cai~\x1am\xb2\xff\xb1\xd3(\xf4U~x\xe8w/o\x97\xa5A>\xd7\xc8\u0653\xa7\x87\xdc\xed]\x7f>\xebv\xdbu\xfd\xe4\xfe\xf2\xf5r\xfa\xe4t\x1a\x0f\xb7ik6\xe8>,\xeb\xcb\xfb|\xfcr:v\x8c\xfa\u00dd\xe5\xd2\x16\x90\xae\xbe2\x95\xe2\xc2}\xc9\x15l\xa6\xb8\x8f\xd2E\xb6\x11\xe5\x98\xe2\xbe`\x98>\x8e&\xb9<\xa3\x95\xd97*\xe9>\x9b\xf1e\xee\xc2r\xf2\x93\x02\u00fe\xdfo\x01\xf6\xec\x1c\x98c4\x05\r\x8co\xa3\xf3\ac\x00\a\xc4R\xfe\x82\u04750e3{{\xcbt\xc6\xcbb\xe9\xa4\xce4\xd9\\a:\xbd\xbfe\x8f\xac\xc1\xe8\xb2\x00{\xd3\x13\x8e\xf5:Sk_U\xb3C=\x03[l6}5\xe4\x18\xb2}\xb6\xfe8\xbc\xb2\u06f5<[>\xfdQ\xb1X\a\xecr\xb9i\xf1\u9791\xdcb\x13\xd6zHe\xd8\xfa\x1e]:n\xa1\u0600\x85\x10\xef\x0e\xd8R\xac'\xf3wC\u019fF\xebA?9&\xfdp\xdam[\xce\xc5\xfd}\xfc\xf2\xa9\xccT`]gk\x99\xad\x10\xe7\xb5\xc3\u0388\x95\x97\xcb\xccK\xf6%\xbd\x98]V,\xe3![\xb7c\xedl3=L\x1b\xe9~6\xcb&\xb3\nto>\xd8\xf6\x82)\xfb4\xcb\xd9\xec\xe4r\xccN\x01%\xfd\xe1\x81N\x01\xa0\x80\xc21\x825\xe6'\x83\xc5t\x80G\x8b+qZ8\xf6\x1f7\xc4\t\x02\x01\xd21\x82a\x93\x9d\xbe\xc0\xde\xed^^\x0e\x8d\xe3R\xcd\u0381\xda[H?\x81\xbe\x9d\xb9\xbc{\xb0\xc1\xde\xd0\xefd\xb9\xbd\xa1\u03161=\x1b<v\xf83\x04X6\x18j\xb6\xdf8Q6\x1eV\f\x16\xbb<#\xe1p9s\x9c\x0e[z\xe3\xf9\f\x8e\x0e\xfaI\"\x1eg4t\xd8Bx~\xb1\xaf\xd27gW\xf98\xcdgv\xf9\x824\xcc1\x81\x9e\xce<^\x8c\xaf\xaa\xd5\xea\xedCwPx\x98\x9e\x94\xea9\x04\b,d7+\xa5j\xbd?\x1a\\fJl]\xb2\xf3\xe1\x94\t\xdbz\xf3n\xf8\xd46\xe2\xc5z\u027a\x1b\x8dF\xb0\x054\xd83\x1b;\xce,\xefFL\xaa?\x012\u057e5\x9aUj:I\x1b\x86Q\"\xc7\x18LgX\xda.\x9b\xe1L\xa9\xfe\u011e\xe5K\xe5\xcaC\xbb\xded\xfb\xfb\xa2;`\x9c\x90\x1f\xc6FE\xf7\x1a\x86y\xb2\x1c\x8c*l4\xaf0twVb@\x1f\xec%\x9d\x02\x80E\xea\xfa8\xceD\xd8u\x85\xf5\x9c}\xb9\xe8w&l\xe3\xcaY/\u0183\u079a^\xdfdc&g\xdel\x8e\x1d\xebkY\xe2\x02v\xf2\xea\xf7\aM`\x99\x93,.\n\xb2\xdb4kL\x95{0\xbadN\xc91\xe2\xb2\x13\x155\x1e\x14\xd3l\xb9-b9:\xdc\xdcV\xe7\x86XU\xb9\xe6\xd0alt\x8b\xedF\x97\x99,\xac*R\xe7Xc\xfb\x81\x1d\x0e\xada\x17\x1a\x97\xb0\xb1=->@\xe3\xf1h\u0116`I\xbf\xcbQ\xbb[\u058e=C\xa0\xfc\xdc\u05fe\xad\x13\xd0\"\xed)`\xebj\xc2\u0134k\xb7\u0618\xbd\x00L\xa91\xeb\xa8?\x1c\xe0d\xe9\x04\xa0 \x80bGMP\x91/2`H\xc9\xde\u0431\xa2X\xba)\x15\xc6/\xb1cv\x8ah\xe6\x1f\v\xf5~\x96\xc9\xect\xda\xe8\x0e\x9eN\x96\x93\xbbe\xf6\xe2rR\xa8\xdf\u054f\xeb\xb7l\xbc\xd6\xf5\xe0\xb2n=\x8e\xae\u073bV!o4\x1f\xe2\xed\xdb\x05\x93\xa1\x8d\xe6\xf8\x99\x00N\xd8l6\x9b\xfb\u0747\x98\xbdx9Y6[C\xdb\x1e>\\\u05cd\xa7e\xbc\ubf80\xb1\x91u\x91~\xc9es\xaf\xfd&[3\x99\xc7\x02`5H\xdfN\u04e5\xec\xcbK%\xbd\xb8g\xa7\x9cT\xa6@\xe7\xe5l\xff\xa5\xb48\xae\xbd\xc6\xc6C&\u3cf9ezY\xb3.\xfb\xe5\u0720\xfa\xd4\u05cbV\xb5\x9fy\xb8\xcf_\x142\xc7\xe9\xf2\xe3C\"f\xbd<\xdbe7}y\xdf]\xc4\v\x85\xdb~&\x9b/\xb0m\x81Q-K\xc2!\x97H\xb1\x03D\xfcf^\xce\x15\xab\u00fb\xd1E\x9f\x8e\xa1\xc7`\rej\xff\xb0\x1f\xeb\x17\xac\x92^}8\xae>\xbe\xec\xdf\u62b9\xdapPj\xe4R\xdc\xf2t\xcd\xc4}\xfa\x8c\r\xe3\xf6\x12\x01Z\x05\xab\u0436OX\xdb\xf2\x85l\x9bf\x92[\xf9\x97M\xf3^\xd2tX\u0326\a7\xedD\xb7\xc1D\xfdC\xf5\x85\xbf\xa9\xe6\xc9d\xda\x19\xdax*\x1b\x1b\xa7\xc7\x17\xb5\xfe\xb2\xf2X>9o\xa4_\xab\x8d\xe1\xe9qwr=\xef\x98/nG\xef\x8f\xdbVez\u070d\x95:nnQ\x7f8*$\uf6cd\x97b\x7fh\xb6\xbb\x93\xf8\xd5\xc3\xf1\xab\xfd\x88\x00\x93\u0263\xa7\xf3\x8b\xcb\xd9s\xb2i\u014f\x1e\u01cbSv`\x9f\xdd\xcc\xe2gG\xeeC\xef\xbc<\xec\xa7\xddt\xbe\x96\xe9&\xfb\xe5\xfc\u0371\xdb\xdc\x7f\xca\xde<d\x96\xe7-'\x9d|x*\xda\xee]\xf2.qd\xf6\xe2\x16\x9d\x97\x8f\xe6I\xa3\x7f\xd6\xce\x1f\xa5N\x1f\x9b\xfb\u04dbq'\x9f+6\xfb\xc3\xdeD/$\xcf/:7O\v\xb6\xe9M\a\x9drm\x9c5RNi4l\x96\x87\xcb\u0159U\xb0\xe7\xfdT\xb7\xf8\x1c\xaf>\\\x9d\xeb\xa9sc\x9f0\u031b\xcfO\xc6i;q\x7f\u067dx\xbc>z\xbaz\x9d\xd5z\x8fw\xb9\xbbE\xf1H\xb7\xf2\xe6\xeb\xa3=\x98\x9f_\xb9\xd9v\xf76S\xeaXW\xb1\u05acy\x94\x1c\x9f\xa5F\x17\xf9D\xe3h\x7f1l\x1b\x0f\x93\xfb\xfd\x1c\x01\u051f^\x9f\x8f\x16\x8d~\xd5n\\\xe6\xf7\x17\xa7\xf5\xca\xd3\xedqe\xdff\x02\xaf\xbe\x98\xb7\xee_NO\x8b\xddTg<n\x8c\xe7E}x\x7f\x9a\x8a\x9d_]\u0146\xf9\x87\xd2s\xbav3}\xe9U\xeb\xe9\x9be\xfd&m$\x88m\x86\x13\xf3\xe2%\x93\xb8b\xb3U\x1c\xdd^<\x94R\xa9\xb3\x93\xca\xe9y\xbe\x98}\\\x1c\xefOO\xf4\x8bf7qz_\x7f\xae-\ufbcb\x8c\xdfR\x0f\xed\xf8\xe3\xf5sj4\xad\x0e\u068d\u05d8\xbb\x7f1\x9e\\\u01bb\xa4}Mg\u03a4|\xd2d\xecw\x17\x8f\xdf\x0f\u038c\xabF7vT\x1fw\xfa\xd5twa,\xef^\xcap\xe2t\xda\xc9^\xa5\xdek\xb3c\x81\xf5\xe0\x94\x8e\xf7g7O\xb3I\xb9u]5\xef\xaa\xf9\u0130\xf5\xdc|\xa0!O\x137\u0163\xc10;J\u95f5\xeaq\xe3:\xffp\xd36\n\xcd\xe4\xf3C9>\xb0\a\xf5\xe3\u01eb\xcb\xd1dyw\x94h\xa4\x8a\xa7\u00fc[\x1f\xdc\xdf5\xce*\xb1Tk?\x99=\xca\xdf<\x15\xe3\xb7]\xa6\x89\xe4oH\xc0\xe6^\xaf\u0606^\xcf\xdc\x14\xac\xc9\xddEsvZ0\x8b\xcfG\xbdTu\xf6\x9aYL\x1b\xaf\xed\xf6\xed~\xf6!7\xb8\xba\xef=\xe5\x8f\xf5t\xe6vd\x9d&\xf2\xc5A\xe5\xd8.>\xef\x0f\xee\x8d\xf44]\x84\xb3\xc3\x1d\x02<\xcb'\x1c=}\x7f\\i\x1a\xe9\u03245;=\u037e\xb6\u04d9\xfdk\xf7\xcah\x99\xfb\xb7\u01c3\xfd\xdbL\xfcep\xd4v\x8a\x8d\x1bv\xc0\xe8\x16\xce\xc6\xfd\x86\x99\xee6\xdc\u06ea}\xd9\xccM\xd8\U00059d7d\xf9\x7f\x95\xbdW\x8f\x83l\xd0%x?\xbf\xe2\xbb\x1b\xad\xd8o\xc1dF\u068b\x87d\xa2\xc9\xf1\xce\x04cr\x8e\xbf~\xe9\xd7\xefjF\x9a\x91vV-\xb7m\xb0\xab\tU\xa7\u03a9*\x9a\xef\xf1\x8fA\u01f6\xa3Z\rb%4\xc4\xc8$}\x1c\bS9(\xbdP\x85\x05@w\xe5&0\x8ep\xb4\n\xdf\xd2\"\x02\xc8B\b\xe7\x82x\xe3\xf1\f4y\x99t\x96\x82>_\xcaS\xb5-\n~\x8a>[f~\x17?\x8f\xf6\x8a.\xe7!\xd2\xe8\xeb\xf1E\x8dsAs\x8ad\xef\x83\xe3 \x0e\x98o\u026e\x99\xbaQ(\x0e\xa3\xd8\x1c\xf5\x15C@\xd6\u07ac\x89/\x95'R@\xa4\xae\xbd\x15\u03af\x06k\xa6\x98\xd80\xcc\x11`\x96[\u00bad\u04fc\u0412A\xb7\xbd}\v\xb8\xbb=\xdaju\xee\x16\xc3N\xd3w-l\x14\xa8\xeelZ\xb9\x95\xd6\x130\n\xde\xf8&\xae\xe0\x9cSh\x11\b\xf7\x8f\xc1\xfa5\x84\xd9\x12T\x01uG$\xe6Uy\x88y\fQ\xc8\u067b\xf9\u0637FkG\xef\xce\x7f\x03\x81}\xb9,\xe5\xf6\xa6\xc0\xa9O\x9a|\xae\xa6\xb5tP\xbc\xd9\xfaK\xa5\xd0'\xe5\v\x11\xfa\xf9\xe1g\xe7\xc3\u03d5\u07fb\x94j\x912\xdf\xdem\x81\xc9\r\xab\xee\v\xaf\xe1\xf3\u0136\x87Tc\x83O\xc2\xd8BLk@?>\xe40}\x12\x1d\xb5\xb0\xe0\xe5\x9f\f\xcd\xee\u0792p\xfbW\xfc\xfe\xf8a\xb0\x9a\xf9F\x1a9\x8c\xc7o\xd1\xf2\xd2B\x9d\xfc\x19\xcf\xf2\xcf\xf5}\xb8wvy\xf0\u0097\xb85I\u00ff\x05n'\x12(1?\xb5\xda\xcf\xd8\"\x835\xc76%6\xca/V\xbc\xb1\x86\xfc\xa1\rf:\x1f\xb9\xbe%-b\x02\x87&M3\u04e8\x82\xeeST]\U00097a2a\x97j\xe7_cC\v\xa5\x175\xd6\f\xdbw\xb8\x99\xac%k\xf7\x82\x0eI\x92\x80\x9d\xaf)\x8a\xa3h\x17\xa8\x9f\xbcm\xd0\n\xda\xdc\u0323\xfc\xa1F\x1fZ\xe9!\u05bb2\xeb\xf3\x8emiL<\x0e\x81\xa392\xb2\x04\xcfI\xd6\x18(\x01I\xb9\x12\xc1A\x0f\xbb\x05O\xc7>\xd0\u02cc\xfc\u0080\x96s\xf6\x1f\x83\xafz \xe1\xe3>v\\,hB$\xd7\u0439\u0264u=^/\xb2\x91?\v\v\x93\xb2~\x9f3\xe5e\x8c\xa6\xab\xe7\x19h\xcfwE\n3b\xb1u\xa3\f\xa5\x13\x04Rg\xa1\\\x1f\xfd\xda\x1f\xcf\x00\xb4\v\x84\x14\x9a\u014a*\xc7v\x03jy\x9e\x15\u00cf\xe5\xbb\xc4<\xabx\xc3M6i\xf4\xc2\xf0>\xed'\x96D\xfb\x90\x1aY\xe2Dz\x13\xdc\x11\xda\x1f\x12J\xec~[\xc8\xd2\xe7\a_\x87hLt\x93\xc7);>\xd4\x03\x8b7nd\xd8\xe2Mb\f8Vi5_\x1aL\xdd<I\u0105sW\x86Q\x12Ax+\x16d\xae\xfcd\x05\xaf[=fZ:\xad\x9fh7\xf4_\x11\xa3\xe4\xdfd\tp\x92\x06\u044d\xa9d\xfbb\xf50-\\\x9e\x96\x1c{T\xf0m\xa7\xb9\n4\x9c`\u07b9\xceiB\x18\x98\xbbi(j\xc3\x1c\x7fi\xd4l\xbb|C\xf3`\xc0\xb0\xb0\xf8%\xfa\x1d\xe3\xb7\xcfE\xb6\xe7\xb3\xc6\xfa\u04e4#W\x9d9c\xbbn\x05\xa9Y%\xd2?R\xf2u\u0368\x81\x9a\x05\xfa\xc5\x01'+\xf7\x9a\xa7\x89\xbc_\x1dq ,_\xf8\x1f\x89ZQw9?\xbfD\x9f\xda\xf2\x1a\x81\xd3\xfa\xb2\"\xdcl\x8e\r\x96\xa5\x00\xa4k&A\f\x98\xe2\xedMq\x00\xbc;\x1bC\xfc\x81S\x16\x06O4%\x1d\x9e7\xc6-\x8b\xb0\xad\xb7\xeaM_\x89\x95\xb4<\n\xfe\xd7\\\xe8\xbam\ri]n\xe7\xca\x19\x89\xa0\xbe\x9c\xeb\u9428!\u020d\xb1~\x82 \xbf\x8e`\xd8H\xf1V\x83\x85\xe27\xcb'\x14\xa3\xe5\x05@7z\xc8a\xf5<\x12ie\xd8\x13\xa9HX?\xf1\x88s]\xf4XX\r\xd41g\xdc*\xf6\x9b\xd40\xd0!\x18\xec\x0e\xc7eM\xf0\xd7\xc3M\xc5\u02a1\xfa=\xa1\x9f>\x7fm9_\xc6\xdb\xd5%\v\xba\x88x\xa2\x11}\xf6zDjC\xd3\xeeO\x9a\t7E\x8a\xb7\xf532\x11\u7c8b\xbe\xfb\xc0\xba\xf7q\x7f.\xaff\xb9\x9c\xb7\xb4\x01>\xe20\xf7\xd0\xfcj,m\x00\x191\u043fW:\n\x85\x9d\x02c\xef\xb9b\xcb\xdccv%\xed'\x1e\x05\x91\x84z#A!\x13\xc8tZ\x9aV\x1a\x16\xd4`D\x90V\x1d\x96\xb3\xa1\x9f\xaa\x15\xd7\n\u00cb\xe7~a\x0f\x04N\x9e*yaG\xe1\xd24\x95\xf7m\xe0i\u009b\xcf\x10|\x97\xf2__/:\xb2*-|\xd496g\xef\x10\xbf\x8fC\xc5\x1ek\x9b#\x80c\xc1\xed\xea\xf7\xc0\x9bC\xea\xafP\xaf\xb3\xaf\xb7\x7f\x87d\x03X\xfbp\xe1\x87\xd9~Fmt\xec\x17\x9f|\xc3\x04\xf9\xc5r\x92O\x03\x8b%\f^\rk \xc4\x15\xcb\xf1\xa8\x91f\xa18p\xaaPp\xfc'\x15M}\xa7\xff\x1a\xc9\xde\xee\xe2M\xe7\xb5\x04\u04b4\xfb4\xe8\xfa\u05f4d\xb5\"WD\xa0?\x13\xba\xfd\x94\x14\xdb\x15\xfa+\x93\x9b)\x9e\u02e2z\x7f\x9bj\xcdH \xfa\x05\xb4\\\xe1\xeeu\xa1\x86\xb9\x8a6\xbc\xabw\xa0\x02\xdc\xff\xa7\xd1^\x8a\x9fQ)T\x10#t8-\x0e\x96\x1d\x8b\xf5\x8a\xd2\x1f\x9d3\xb7Hx\xd2\\\xb3M\x96\xad\x14l>|\xf7\xee\x15(\xd5\xf2\x1c\u06c1\xf4\x05\xd3\xd9\u061c\x12\xd8\xd2\xc3\xc6BI,\xb0\xf3\xb8\x96\xd3\x1a\xd0y\xfd+%\xb7\x03\x81\xa6P\xa1E\x9c\x89\x1f\x1eB\u0469\xa4\xcc\xc9u\xca\x1b\x9b\x0e\xcd\\\x9bgw\xecs\xe83\xe2\\\xa35n\x96\xf3\xad\xd69Z\xac\xf7\x9b\x971\x85\xf2O\x95\xa4;\xeb\xb9B\xb8L\xd4cM+\xfa\x8b\xd6!\xf1\xdf\xfer\xb9Gl!\x1f\xd0%\x95\xdc_\xcb\xf6Vf\xafA|\xcc\x06\xa3\f~z\n%\xf3\x9e\x1eD\xd4H\u0174.\xc4\xc7T\xba:S\xc8M\xd8c\xf3\x04\x92\xc5\xca\x02\xefM\x8d\xfe7J\xf0+H\xa2*p\x10k\x84\x94\u075e\x05\x1c(\xf1\xa2w\x80'\x9f\x9d\x11\xedQc\xc8\xf1\xb6\\\xde+\xab\xa6\x9c\xa5>\xa5^\a2\u00b5,K\xdeJ@M1\x1a0\xfd,\x88\x8d\xeb<\x05\xee\a\xb0P\x9a\xe46\xcf!o{\u0424\xf1e\x0eM\xaa\xc2\x14\xa9\x1d\x1d:\r\xedx\x86s\xa4\x04v\t\xff5\xf7\x81\xcaZ5\xa3s\xc0(\x93\xe9\xaf\xdc\xc4s\xfc<\x0e}o\xaeK\x06!?E\xcf\xe5LA\x96BVFa\xe1\xb7\x16\x90q\b\xdf\xe7Z`\x85\x92m\xfa\x97E\xaa%\x02\xab\xae\x85XU\U000293ab\x84@\xbe\x86j\xafW\x82\xff\xb1\x8c\xf8\x9a\x90\x93\xc1\x1f\xa3V\xe8\u8fe1wlIl\x8c\xe9\x11\x93\nYO\xcdT\xe1'Z1 +T\xfe\xb8w]\x99}\ud6e48\xba\x8e\x04\x8dC\xfd\xead/v\u8e52\xf3\xa5\u9082\xcb\x030\xcf/<\r\xdc\x7f\xbb\xb7\xd8\x17i\xee\xdd\x00W*n\x90\x03}\x1c\xe7U\xe7Q\u0438C\x82\xe1\xed\a\xb5?\xed8*\xb9\x9e\xd7\xcdW\x02\x9f\x95\xbacG\x00\u072da\x06\u056e\x17\rRk\x8b\x0f\xf4=\xfa1\a\xef\x9fy\x0fN\x9d\a\x1a9\xbe\x03\xf3\xf0\xaa\xd1bw\xec\xc0\x894_\u01ba\xb2\x84s\u015e\fK\xbe \x9b$\x10o\xa4\r\xbf,\xa8\u0778\t\xcb\xda!\xf9\x1boT\xde\xec\u07c92\xffc\x90|kc\x91|\xcdk\xd8p\xd5\xc6K\x83/\x9b\x9d\xa6\xe3!\xa2\u0187l\xe8i\x02\x1c`\x00\x7fiS\xae\xeb\x93t\xaa\x9f\xb8\xfat(8\xee\xe6\xda\x0f\xec\x97\xc8(\x88\xedI\xaa\xd1\xfd\xce\xf2y2\x01\xa0\xf9\x8d\xd4\xfe\u0118\xads\x96\a\xf0\xe7T.\x1f_G\x9b4\xfeH\x98\x85\xb9\xf0\x16\u3502F\xd27m\xd9\xf7U}\xb2s\xf5Q\xa2\xd0\xc05\xa5H\xfaSS\xbf\xfe2\xf7%\xcd\xeco\xc1\xf3\f*1\xc0O'\xbd\xc3\xf6\x8d\xb6\u03f4\xffHGp\xe4\xbb\n\xb4\xa2\t\xd8A\xf3\xb6}\xaf!\xcf\xf8\x12\xf9\xebyz\xc6\xfc\x80\x05\x11\x1a\xe2\tZ3\u00b8~\xf2\xf6\xb9G\xd9_\xb9\x0f\x1d\bT+\x9d\x02Dp\xec7F[6B!u\xe4\x133\xd2=\xaa.\x99\u068c\uac50\xc7|\xe0\x0e\u05b0\x11C\n\u079d\xcao\agAkF\x12n\xf6?\xb4\x89\xb8^\xb9\xa1)\xc8o$V\u2482\x0f\x8a\x84O\x89\u04ae[\x97\x11\xe1e\xab\x9dh\xb6[\xae\xcfecI\xbb\xff\xef\xec\x03\xa6Y<mr\x7f\x9a\x92/\u0788\xb5V\xac\xf6o\x1a\xbdr\x05\x7f\x931,\xd8>\v\xbc\x06\b\xfcx+b\x8a\xb5X\xb0\x82b\xbd\xc4Q\u0596\xb6\x9205\xc3\xf7\x8f\xda'\x9d\xf1\x05\xd8E\x13c\xd0\xdbf\xcb|\xf7\u0790z\xfe\x06\x9d\x9f\xdb$\xfb\xfd\x9a E\t\xac\u19d1z\uc4e3\xcb\xf2dB\x8f\xcf\x01\x13\xb5\x11\xc7Z7\xed\x98\xe0\x87\xc5\xd1\xf2\xb6r\x7f\xc7{H<`q*\x8a\uab40\x19\x14\xed\x83D\xb2\xdc_\xc7\u01d4\xcdW\xef2\xd7+\xc5\x1a\xd4\xc8)\x17\xf8\x1ax\xb1\xeb\u01e5\xf5\x7f\xa6;\x9e\x97\x8b\x9b\x0e\xfd\xf7\xba\x17\xb4\xa7\x94\xa0\xeb\x9b\xdbwa{\b\xc1W\x9cJ\xafN\xc0\x1b\xc4(\x05\x7f~M\xae\xb8s\xe30\t.\x8c\u0743\xa1\xf2\xdez\xac\xda\x15\x95\u0148\x02\u00c5\x97\xbb\xd9\xe0\v\xf7V\u01468\xbf\x0e\x15T\xd6}\xe2 \xc0\x9a}D+\x15q\xa2{\x95\u04cfj\x0eS\xf8WYr\r+p\xf9(f[P\xbf\xf8r\xf4\xf7\x15\xa0/\x85\xf9\xdb\"\x81U\xc1r\v\xe3\xf93\u00f7:`t\x83y8\u0314\u0442\xe4\xc6Rwq\x84\x1e\xb5\x1f\xeb\x8e\xc3\x13\x16\xd9\xf4\u07d2\xe9M{\x89\x14/J\xfc\xa2m\xf0\x9a\xe1\x96\x14_\xa1\xdf3\xbc\x8f\x93\xca\xf3\xc1\xb2\xfcZ\x8f\xcd\x0e\xfbo\xe2IY\xc9\xfa\xf4\x1d\x19B\xdf\xf1\xbb\xd7Be\xca\xfc\n\xbd\x1a\x8e\x89\x89\xdb\xeeO\x8d\x8a\x17LXW\xe1\xc7?w\x87\xfb0=N\x8e\f>\xee\n!\x8c\x9f\xc3)E\x92\n\xee\xbb\xe0\xe9\x89- \x1e\x90\x0f^j\t[fo\xeeQ\x11\x81\x1aP\x0f\u0090p\a\xf9u+\b\x95\x97\xb6\x8aat}\xa4]SL\xb1\xa9W\xe3\xeey\xeb\xe7G\xd2\xca_\xbfH\xa9\x10\xe8\xbfa1\x1d\x04\x0f?\xb1\xf6\x9b\xa4\x0f\x971(\x19\xa4f\xe8'\xc5K\xc7 \xd1\u03ef\xe3\xb31P\xdbok\xf9\u063d\x97\t*\x84`^\x98\xe1\x1fW\x8d\x17>\x85\x99\xad@\x8b2@E\xa2\xb5G\x8c\x12\xb6{s7-\xfc\x88\xf8\xc4\x13\x9e\xa2\x80\x1d'\xbf\x01\xa9\xc5\\B\u033fV\xa6\x96\x1dP}\xfd\xe1!\v}?'C@\fI\u011cfR,\x06\xfb\x8d+q\x1b/\xa8\x8b\xf5u[\\-o\x14\x14@r\xeb\x94\xc05\xe7\xf9o\xa3\xc3!\xcf\x1f\x8b?\xf5W\xf4\x03\x87\x0e\x7f\xec\xfc\xe3\x9dGK\xad~\xe6\xfdE\xc0Nh\x1a\x88\xc2w_\x03\u019b\xb7\xd7O\xcb\x06\xcf\xf8\x03\xfd\x9cI\x0ew\xc6+\xeb\u049e\x93:\xd6o\xca\x15\xe1\xac'\x1b4f\x04\x13\xea\xfe\x03\x87\x16\xd5\xe0zZM\x9d\xb4\xa8\xfe\u0097\x8d\xb7N(\x891\xe92J\xa8xI\x00\xe7c\xa1\x00\xff\xf7?\x1f\xfe\xaf\xff\xe5\xff\xf8\x7f\xff9\xf3\xffb\xf2\xafl\xff\xfe\x19=\\\xa6}\xf7\x9f\xcc\xdfh\xe2\x7f\xfdg\t<t\xff\xe3\xf4_\u9cc6\xbd#\xea\xb3\xe8\xff\xf6\xf0\xe5x_\xc1\xfb\x9b\x03x\xfe3jTp\x7f\xdc\x1c\xf0e+\xa5\xf8?K\x9e\x19\xeb\xfeQ^\xedir\xf0\xf1\xfdgL\x04\x88\x97Wg\xbfX\a*eH\xc6\xdfd\x16(\"\xe4\xeb\xb8\xf7\a\xf2\xf26\"s\xf7\xb7x\xf2\x9f\x15\xc6_o\u073b\xfd\x8e\x1f\xff\xcc\x1b\xc3\xfd\x9e\xcd\xf6N\x1bl\xf3\x1f\xf7\x88K\a\xc9~\x15P`\xd2\x00\xdey\xb8\xd7\u042e\xfe\xc7U\x9b\xdd\x11\x9b\xeb~\xb1\xca\xf7{\xad\xd4\xd9\\\xf5\xe0\xec\xb6!\xaa_\xc5\x16D/\x7fMK\x186s\xa8g\x04\x8c!\x17M\xe2\xcc\xca_?\x83\xeda\x8be\"\xcfF\x18\u04fe\u0739\x8a\x189\x01\xf6N\x17\xe1\x91.A}?\x8b\xa4\x8c\xf8\xb6(\x04\xa0/\xbfV\x7fG\xbb\u0616l_\x04oY\x00\xbc\u0235VX7K\x8f\xe0\xbf4k ]\x16\xc8xr\xc4\xef&\x90\x94\xb2so\x7f\xb0\x15\xf16u5\u03151\x14\x05\xd1)\xce@^\xb5\x96C\xc2\xf1\x8f\x13b\xa0wN\x11\xdb\xd6*\u0346\x15\x06\x1a\xd9\xeb?\x8f\x1f\xa2\xff\xbd\xf1V\xb0L=\xfb\u00baO\xae\xceo'\f\xd6\xe9=m\xf6\xe6Mn\u05e4\xa9\x0f\x13\xb7\xbe\xe5\xed\xdcV\xc5,\xbd\x852\xd9][\x80&\x94!\x0f{\xfc\xa5^\x18UJ\xd1O\xa0\x9b\xd7rn'^\x8e\x00A\u072e\x80\x83Pz|\xb0\xa75\x8bu\x89X\xc9\x05\xa5\xc0\x7f\xa0Un\xd7\xee\xbe{\x19z~f_\xa6\x19\xa3J\xb4i\xefzE\xd6vZ\xe8\x81!\x03\xb1\xf8E\xd2\u03bb\u0711\x02\x85\x15\x14\xb9\x94A\u04572\a\xe4\xe2\xfea\x95\u74196w\a\xe5l\xde\\P\x01eI[\x05\xa8aS\x16k\x87e\xad\xed\x8bYvm\x85\xcbM\xcd\xd4\xe1W\x86\x91\x98d\"\xbezY\x7f\xd3\x02\xb7|<\x8b\xea\x02\xd8\"\xeb\xd4m\xe3\xb5\xdd@i\xad\x16\xd2SC\x8f\fa\x98\xaa\x82\xf0\x16W\x9b\xb9+\xa4\xd6\x04\xf8\a\xc5@\x14Di\xb3\x89m\xcb\x0f<v\x06<\xe2-\xd9\u014f\xa5\xc3\xd3\x03\x06'O\xe2\xaa\xc6n\x84\"\xc9oy\x97\a\x99x\xcaI\xbee4:!2f\xe8\u0566|\x8c\x9e\xf8|\xb8q\x7f\b_\xd9n,\xab\xc4\xde\x18\xf5\xe3\xe0\xc8{\xf9\xb8>\x8b\xa2\xe6W^\xa5\x85!\x96\xaec'\x8a\xb8\xa4\x17|G\x8b\xd3G\xd5y\xf8\xbe\xcb\x19\x9c\xf91\x82\x173??k\x0ee\x1fX\u00e7;9\xea\xce\xd336\xec\x1dD\xfc\xafW0\xe2\x18+\x84\xa1`\xd9&g\xa9\xc4(6\xb9\xa8g\xd9j\uce8f\x05\xaa\u01c6\xa2\x7f\xfa\xe1wi\xb1j\xaa\x96m\x7f`\u06ea=V3\xbcc\xd3+\xbe\xf5\xb3\xd1\xccPa\xe2-\xfeqp\x8d\xc2\u86d4K\xb3\xf1\x15Et\xc5\xde\u04adJ\x14a\x03\xc17\x87:\u0514x\n\x89oz\u0426\xe9Gc\x1d\x95\xd1\x1f]\x88\x80\xb1\x8bDG-o\x1a-\x97\xc6U`5\xfa`\x7fJ+\x92\x82G\xa1\xd7\xf7\xd1\xe3Y\x16\"\xa5\xfa\xa9\xb9Gk\x7f\x92\xe3\xc3@c\n\xd3\xc1|\xe9Ls\x89\fs\xab\xf8e?b\x0e\x8c\u011eX\xa5\xce\xd9B`\xb25\x1ff9\x96\xcb8\xfd\xcb\xdb\xd07\x87\xa1\xc7\n\xe7\v\x9cb@\x85\xe0\u0579N\xcd\xdd\n\x95\x9aZha\x05\x9c\x8b\xc1C\xb2\u07e2K\xf5\xe3\xcbRo\r;\x8f\xec@>\x9e<\x93K,OQ\xe1\xda)\x0f\xb2\x87\x7f\x05Kr\x84\xe0TS\"\xcdD?\xdf\xeb\xf3|\xd6vT\ueb2d\xa2\x9fN\x83\xb1\u04be(xua\xba\xfb\xac\ub17aG\xf3\xa6\xa1oh'\niy*\xfb\xd6V\xa5-|M\xb1\xd5\xd5\xf95\x12\x1b\x99\x1d\xdeK)\x88`\x00\x9c,J\x12\xdc\x00\x18~I\x15\x86\x8d9\x92\x9b\x9b\xa5\x84\xc2\x1bV:I\x90{\xc0F\x19\x83\x12\xf0e\x98\x1fH\xa9\xd8CW8\x18>\x8f\x10zF\xef\xf8\x17)O\x10\xcf9\x82\xac\xf9ce\xcf3\u042d\xe9)4\x99\xef\xab\\\x90\xdcQ\x01H\xa3\xcb\v\u02e4\x18\x86\xba\xb6\xb7)\xa1\xc5s\x96\a\xab\u0302\xb5\xb7\xf7;+\xa3p\xc2_\x14\xd2\x7f>\xbf]\xeeD\xf9\r\x7f\xd2\xebB\xcd\x11\xfd^Nb\u05f3\xc6\x1d\xf3\u02fd\xfdI\xa6\xaa\x88\v\xe0\xf2\x9b\xc1)\xab\x06\xb1\x1b\x7f\xadT\xf4\x99Q\xaf,\xa4h\x85\xbd\u017f\xf58\x1b\xbeP\xf1}\xf1\xab/bTbT\xdb[\xb8%\x9bV^m\xe4\x17\xf7\x17\x03\xe4!U\xb9\xa1=\xdf \xf1\u02a1W\xdc@\x02\xea\xfe\xc6\xd5hh%N\xf1X\xa4\xb1\xb8\xdeC\xe6TE\nNWlg\x1c\x8d_\xaf@\xca\x1bD\x18\xe3A\x1eD9\xe1o0\xdewCGO\xaa0\xf0\xac\v\xbe\x93s\xf9\"\xcb\v\x97>\u051e\xf6\xd2\x11\x9c\x95\vqv\x1eEq\xbc\xbcK\xf5\x9d\x92\xbb5\x1f\xfb\xd7A\xff\xb7=b\x8f\xe8FH\xaf\xb0\u04b3\a=8\x92\x9f\xc7\u077av\xe5Mn\x06Y\xbei\xa9\xfc\xed\xbc\xb1\u0612\xc7\xe2a\x06\xab\x8ae\xc0e\xfa\x99\x016`%(\x91{n\x03\x98\xfd\xf2\x18\xf5\xc7py\xa3|\x7f\x9fhx\xe7\x90k\xbe\f\xfc%\u0571\xfcJo\"\xbff\x99-\x95\x98\x1f\x88v\xae\xa5\xc1Ig\xdf\xc3 \xde\xe2\xb0\xd5\xdfw\xcb\x13\x92\xb8[\xd6\xea,\u016e\x99\xc3l\\\xef\xdf\xcc;\xf1\xe4\xe1\x93\xc7u~G+\x9f\x9b8]rjoo\xf7\x19\xab9\x1d\xf0<\xf2\xe4\xe2\xa1|7\xfa\x13K\xca7\xbeL\xfe\xac@G\xad\x00\xd5\xf1\x9cEG\xfa`v\xac\xa9p\x9f\u067f)@\x0f\x9bFh\xf3K\x84%\xfb{A\x1c\x9e\x90\xdfS(\xa6\xee\xac|M\xbb\xbe\xe9\xb7\x7f\x94\xe2\u0317\u03fe5\xae\x05\xe2g\x98\xbe(S\xbe\u068f\x8d1\xb9\xf9\xb8]\xcc1\x84\xb2\xb2\x91\xdf\xe4\x9a=\x8bS\U00050761\xad{\x8bI\xdd\xf5s\xa8\x13\x9bHm\xef\xf5J\x1c\xb4\x8d\u0247v\\d:\xff\x9a\x0fZZ\xc3d9\xb0k\u06fe\xb6\xa5\xba\x99\xd8j\x16\xe0z\x17\xcd\xf6\x88\xf9\x81\xc3\xc7\x0e\x9a\r<\xda\u01e1\x9c\xa8,\x14EmN\x9d\xb7\x85,\xa3#\u0373~\x97\xfe\x01\x1d6\fxk5m\v\f\xc3;B\x94\xcfe\xb0,R\xf5\"\x98q\xe3L\bF@\"j\xf8\x9de\x9c\xe7\xf9\xac\xddqJ+\xce\u0092\x92d\xa6\xe4\nW\x86\xa7.\xef\xd5\xd3\x16S\x119D%\xe53\x01\x19\xbc\x04\x8b\xac\xc77\nf^t\x8e\u03c7\xda\nI?\r\xac\xae\xf5g\xf9\x06\xbf\xe6\xc3\xe5\xa4`\xbfX$\xf2\x9b\x16\xac\xb7\xec\xb8,\xa9V\xdf\xde0\xb8\x12\xb8\xb5\x94fu jq\x05\x7f|r\xae\xc9\xc03\x97rT|s#\xf3\xc9BK7\xe9q!f\x964\x9ag\xf23\x88\x0f5{\x1b,\x9eR\xaf\xeaY*?iT\xd8\x11[%\xbd\xd1=$\xa0\b\x92\xc3rZ\xebK\xdc{\vw/\u075fC\xa8+\xb2\x83F\x9d\xff\x9dF\xe4\x91\x02\xc3:j\x8e\x8a\xf4\x9ft#Jr\xdbK\x92\xd0\xfc\xdb%d\xf5\x81<\x95S\u04b6\xc1um\x84\x8f\xe3FY\x04A?lH\xf6\x15\xc5u\x1a\x11\x88Y\xac\xe1\xd4}\xfc\x8ay\x9f\x84\x18\v\x11\x92\u07f0\x1cH\xd4o\u040c\xf2[\x1a^\x90\x99\xee\xf4&c\u030a\xfdJ\xdc\xeb\U00064ca6\xc5\x19\xa4\xc0&\xf9\xe2\x16\x988%9(\x01\x91\x1dO\x8b\x90\x8c\xf4\x0f\xf2\xd6\xe8\x19\x8f\xeb\xee:/7\xd4A_\xf8?B\xea\xac\xf5\n\xc2\xfd\xc6xopl\xeel\x1e\xe9\x01\xf9\xbd\xc1^p\\2\xd8v\xe6\xbc\xf0 \x93\xe3Q\xae\xda|s*Gs\x02n\xbd\x95\xd6\x17y3_x=\xf8\x19B\x8b\xa0;\xf8\xea\a_\x14\x93Yj\xf5m\n<\x89\x1bx\xab\xcb7\xdf.\xf5\x16\xbe\u0132m=[\xbf\x05Gd\xd4\xec\xe04\x99\xb3\x16\xcc\xe3\x16Q\xa5\xccg\xe1\xbe\b\x9b\x9b\xf3\xaf\xe6\x88w\xec\x841\xdc\xe4\x7f\x8e\x9d\xad\x1aW\xc2:\x0e\xe5\x16\x12/D\xcae\xf2\xe3\t\x8b\xaax\x14D\xab\v\x8cMM\xb6\x1e\xb8%\f\x96\x1b\xa7;\u1969\xa1\x8f.\xe7\x04\xa0F\x1c\xafZ\xad1\xf6%#\xf7\xef\xe0\xc7\x0f\x89y\xe7C@\xedM\x8b$\xa2P\v\x06\x9fTW`^-?\xba;.\xf1\xdd\xfd\x96\xa0\xe6=\x93Ru H\xa8Zr\xb8F\xfcuZlO\xee\x1cS\ty,b\x90\xe8\x13\xa6\xbfJ|\xbcP2\xce,\xf76\x12\x9aB\u0105H5:H\xe6\x17\xc3~\xcaP \xd6\xe5\x1b\n\x97\u022a\x90;\x80\xef\xe4\xaf\xdd-\x11sa\xc0y\v\xef\xcf\u04d2\xa1O\xedT\x1d\xbc<\xe7\xf8\xa7V\x83\x140\x15\x16V[\r#\u0452S\xe8\xc6\xd3\xe2\x19\xefp\x84\xfa\xef\u057e\xb5\nNcr\xcbwP/\xa24\xaf\xc1\xd7(v\xd8\u0795\xf0\x91\n\x8e\u04fb[-\x1cG\u01b2\xaf\xb2\xf9\u01e0\xd8q\xa0\xd1X]\x87\xa4oVc\xd2\xe2~{Yx\xb8k\xe3\xae|3\xa7\xa0\x00\xeb\xeb\xe0\x00\x19\xbe\b\u0244\xcc7\xfd\u0343Y\x02\x85c\x9d\x00\x89/q\xa2\xe5\xa7t\xfb\xdaZ\xe7\xff\xa6\x80\xec\xd3\xea\u0190\xd0{\u045c\b\xfa\xa8\xc2\u069d\xab\xa8e8$\xaa^\x8aS\x88\x9b\xb4\x02\x93\x1a\x13\x1d`\xee\x90\xee\xa0\x7f\xf4=o\xec{\xa5\xba\x12j\xf1\xdb\n7\x05\xd6p\xdd\xfe+e\x91Lz\xa4\u03a0\xa4t\x16+f\x01\xb8<_A\xf4->\x88\x99\x91Ju\xea`\n\t\xf8\xd9\xc4\xf4\\\xa0\x98G\xb8\xdc\a\x12\x9c\x05\xb1D\x8e\xbb\xd3A\x94\x8a\x0f\xecQ\xbbx\xf3\xfd\x15\x8a\x06\u07b9\xc5\xe8\t\t\xe3\xc3\x04a\x04\xe4HbW\xc6\xf8'J\xf2-m\xf4\x0fu\x82\x9a\xa2\x89\xcbYC\xba\xa4\"\x92\x8e\x8d\xfe>\x04G\x16\xd0/\x14^q\xd7\xcen8\xa4\b\xf1W\xda7\u0371[1\xbe]\xa9\x17\xce\xd8\xf3\x15h\xe5\xf9\u070a\xa7\xfd\xd1qJ\xaa^\xd9\xd5\x16\xa4G\u05b6\x06f\x04\u075fwT\x959\xbb\xff]\xd2\xf3\xd6=\x9e\xeae\x92\xfa\xb4\x82\x94T\xdbo\x9c\xb0\xf8\xb4\x13\xeb^\x18C|v\xe2\xce\U0006a292C[\\\x06\xb2s\xb3\x98\xc6\x04E\x86G\xee\x0eqv\x1do\xee\xb3B\x12\b\xed\x82D\xf1\xdcq\x91\xeb\vg,)\x86|\xa5b\xae\xf7\xa3\"\xfen\u0642\xd7/\b\x109A80\x8f\x8e{\xb6\x10\x80\xbfg\xbd\xd7}s\xb1\v\x9e\u06b5\x80\u01c9\xbb\x15|\x1d\x9c|z\xbb\f\xe5\xed\xfc6;\xa2\x13\xe9\xf1\xdcDqFx\x98\xfb\xa1\rB\xc4]\x89U\xc3\xf8\xd0#\x18\x128\xaa\xea\x9c\x02\xfe@D\xc1\x92\xcc\x19\xee0\x9bv\x11\xfb\xe1\xe5\\\x9f\xa2\xb7\x16\x90\xe0\x96\x93b\xdbV\xc3}<\u01e1\xe5\xec@\x1f\xd1\xf6\xad\x15\xf2\xaf,=\x8a\xa9gQ\xba0\rD|\x8cm\x17#\u0281@\xb2\x12\xbcXy\"\xc6a\xbe\x1a\x9a@\xe1\xcf>PX\xfc\xe20so\xbf*g\x01/\xe0\x9e`%\xf4\xf5\xd5L\xa5`\t'y\xfd&\x86\xc4\xf7\xaa}\xa5\x82\xb4\xb8\xe6\x95\u07c1\xcaD\x96\u0325\u06a3\xc4j\x1a\xc6=%\x83\x938\x96\x04\xf7\xb9?\xb9H\xa5\u03eb\u06b1/\xbeIb\v\u00b3}0\xd9\xf1y\t\x88\xb0\xa4c\xfd\xd3)\xaeo\xbaY\x86\x8c7?\xb4\xcd\xd7\xfb^sX\xa0\x04\x88\x9b7\\\xaen6\xef:}\x18\xb8\x91\x92\x10\u07de\"\xec\x11\xa9\xc1\x90\xec\xfc4|'\xc3\x162D\x1e\b`\xb0\xeb\xf9-\x7f)@\x9a\x97e`q\xb6\xff\x96\xde\u07d5GE\xde\xe0\xfa\xf1\x18o=\xdfE\\\x92z\x05\xbe\x0fZ\x9az\xef\u064f}N\x03\x8a\x17\x7f\xef$\xe6\x0e\xc4ws\x03n\b;\x90\n\xb21?\x91_\x19\xe6s\xac~d\x8f\xe4\x1dWYH(+\xf7\\\x88\xe3+\x801\xa8G\\\xe6p\xfd&\xa7\x89\x8f\xc0\x89\xa6\x90_\x06\xcd\xda\xe6\xad\xc8O\xc6\xfd\xd6\xe7\x95\bLa!S\u0112\xcd\xe0\x14^\xfa;\u02dcKsHg]\xa6\xb7q|\x8d\xf6Ty\u039ew\xd3\xc9\xdb\v\x1d\x8e\xeb\x94x\x1e\xf2\x91d\x17\u04fb\xb1\xc39\xa6'\xf7U\xe3\xa1]a\x0f-vu\xd6\xcd\x1e\x8da\x01\xc2\x18\xea\xdf:\xb7&j8-\xe8\x928>3\x18>\x90\x1ag\x8ah\xb7!?\xf0\x9e[\v\xac\x83\x7f\xa0\xcf8.\xfa\xe3\xb1\f\xe5\xea\xbcI\xc9\xe0\x14Y\xa1\xd7\xf6\u826f\xa0\x19\xc7\u6226P\xfeBO>R\x9b(\xb3\xf0u\xf9\xe3\xb8wV\xc8\xc6\xc5w\xa2'\xa2\x85\xd5D*\x8ek\x86\xfa\xd7\rg\xf0\xccn\u07e2(Az\x1a\x13\xc4\xc20$\x9e\xde5\x7fxD\xb0u\xca\x16\xe5\xba\xfa\xb7p^\xa1\xec\xcbm\x8b\xee\xebya\x9a\xa1/\xdc\x19Xo\xc09\x92\xf7%\xc0\xb6oa\" Z\x83\xa6\xa5|6.\xe0=\x15\x97\xe9Z\xa1\u00dc\xe7\xf3\x19V\xc1\x8eQ\xf7\xe1r\xa6\xc8\xfb%)b\x19\x14C\x19\x05\xdc\xfd\x1a\x0e\xe0:\u023e\xc0\x1f\xf7\x83\a\n\xb4\x85\x8c\x0e\u07e0>s\x16\x8fG\xab\x04\xb3\x18/\xb5h\xc42\x04z\xca)\xce\xc5/r\xa5\xb7|\xb6\xfe@\x92\xfds\x9b\xe9\xf0\xbf>+>G\xa9B\xf1\xb2uLl\x98E\x0f\x9cM\xc49\xc2\x1c8\xfcM$O\x9a\f^\u059d\xc0\u03e5\x95\xb3\xdd\x1f\xb1\xc5Qz\xe2\x9a\x16\x19Q<\xbd*\x81r%\x13\v\xff[_\xa4#\xbb\xe3\x82W\xa7\x19/LY\xc5S(\xe5\x8a\x06q\xde1~\x8a\xec\x1a\xa2\xd4\xf6\xa2\x17\xcf\xe6S\xf1\x12\xbb\xf3\x8e\xa6^w\x1cfv\xacA\xef\xa8\xdc\xfe\u0288C\xdc\x04\u077f\xeckA\xdccu\"V\xedS\x0e<X\xd5;\xe4BgOdy{\xc0\xe0J\xbf\xac\xcb\u01ab\xcb\x0e\x81\xc5D\xec\x84\v;\x0eK{\xea\x059\ry\x1b2\xc3\xdbj1\xea@\xf9F\xd3~\x03\x8f\x1e)\u01f2\xec\xee\x86\xc7M\xef\x1b\xb5\x04\xbb_l<M{\xdeR\x80L\xf1Ov\xba\x99\xabnb=\xd4m\xb0\xcfd\xd2\acA\xfa\x90\xabb5\x10$\x83\x8cA\xfa|\xa2i'\xca\u07d8?\xc2\x04zI\xec\x19nr\xb4\xa5\xf1R(=[Y\x9a\x1eO:+f\xc3(\xfa\xd3PX\x86\u00b4\u0286UG\x8b\xc4hY\xcf\xf6\x88\xb8\xd8\xf0\xbcE\xa7/\xb4\x84w\x9cN\xcd\xc2\xfd\xb9\x8dn\xf2<N\xe6V\xf8h\x9f\x14I;\xed8B#\x10\x05\xdb\xd8e\xcb\x01N\xecg,(-\xd9*\n\x99\x1e)(\x85A\xe5pB\x11\xb3E\v\xbbE\x8c\xcdK\xbf\xa9'n\xcf\u3fca\x9e\xd5+c\xcfm\xa7\f\xbf/C\xdc\xed\x12\xe1Z%\xf9\n(\xeb\u07be=\x0f/\v\x19\xd2I\xf7\xdf^\xcdW0\xf2\xe9\xae\x021\x91\xbe\xa9\xc7\xef\f\xe1o\xeaq\xf49@4\x95[\x7f\xbb,O\xdf\xf6\x83N\u0295\xbe\x99\xb4A\xbc\x16\xf3\x901\xee\xc1\xf8\xda}\x94\x00\x0e3\bY\aP\xb9Xu\xbc\x165\x8e!\x92[[\x97\xa5\x12\xc9\xd5\"\xc84\xc6\x16E\xa0\xbe\x87?'\xfb\r\x05`\x02\xba\x1ce\u05d8\x8aq0\x17]S a=\x97u\xeczj\xe8e\x83\x9e^\xc6\xcb\\S\xcf\xc3W\x9c7\r\x8a\u07e9\xaau\x8fB\xc3|\xe4^1\x19\xab\x15nN\xff\xf5^?\xf6\x85N\u0745?\xac1\xcd\xcc\xd7\xe2\xcf\xf6S`\x13\xa3\xe8\x92\xec\x8eM_\xf5\xe2\xa0\bF\xbb\xc3?w\x18\x1a\xbd\u03e6/\x01\xbd\x16\xc9\xecz\x8dz\x81{\xe9Kr\xe8\u033c\x04d>~n\x93\u03726n\xf3s\n\xfbTx\xdaQ(\x1ew\xa2\xf5.\xe2\xa4P&\xa7\xa2\x1d\a|\xb5\xb6\t\n\x94>\x18\u0443[\xa6=\xfb\"\xaee_\x14\x1e\xb5\xda\x10\u02ccT.R\xe5r\xbf\n\xe7\x1bQc\xf0R\x9f}H\u04cd\xd7C\x03\xd7\u07a4\x028\x91\u0782J\xa0H\xe1\x8ds\xfd\xeb\xcc'>Z\xbdX\xb2\xef<?\xa2\u6ee3'\xf8|\u0569\x0e\xcaq\u06e0a\x17\xc5\xe07\x95?Xc\u0490\xe5\xfc\x1e{\xdf_\xde\u056c|Xd(\u00dd\x13\xca\xec{J\x03\t\x9b\u04b0f\xddg\xa6\v\xbe\xc5\x13\x84:B\xe8\b\xd9N\bp\xac\xdaP\xa3\xea)\fF\x91\x03\xfa\xb1\xaf+\xc5)\xf1$\xf5\x17,\x1ba\f\xc5\a\xbb\xc9\x02\x99\xe7\\\xbf%\x1d\"\x86W\x15\x8e\v\xbeN\xc2\xec7\xcf\u0674\xe8\x97(\x99\x88m\xc2Y~\xe1\xf3\x063O:^Uz\x1f\xd1\xf574z,\xb5}\xfb\x13\x9e\xbef*\xc7\x16\xf2\xf1\x12\xc2p\xf7e\xdf;\xf3G\x0f}\xa0\xae\vg\xf7\x117\xd3^JL\xa6V\xda\x00\xb9\xb1\xff\xed\xed\xd7\t\u07e9\u041c\u032a9?\xe0\xe2\xcb\x1f\x9d\xfb\xa0\xf4V\xf08\xf0!\xb0:D6\x12\xef\x15\x13W\a\x96\x11\x99%Y,\xd1)\x8d\xda\xe7\x00\x93\x15\x87\xad\xb6\x04mf\xa4\xb8%_!\x97g\x8b|K\xf8%\xb7,<\x10\xfaP\"\xbf\xca\u048d\xe7{\u038e+\xc45\xa5\x14-\a<\xad\xdc\xf0\f\xe2\x15K\r\x1ev\xd2|E\xe8\xb2\xf7J\xf1\x9b\x86\x0ft\x92\xdc\x13\xb1\x84\xd0\xcdv\xd5\xd7|\x8a\x851\x94\\\x16\xec#u[\xfbS\xa3\xb6\xa5\xaf\xf4\x86`o \xd8r\xe5\x9e\x1c!\x83Eyf\x05<SF\xa5\xb5\x89\x14\xb1\xb7\x8e`\\\x7f!W\xd1g\x1f\x98\xaf\x87\xf1\"\ue4fc\xeb\xaf;\xf7nI\xfa<\xde@\x8c\xac\x9f\n`\xb4\xbf\xf1OQ\xa6^5\x93\x16\x198\x8d\\C9\xb1q\xe8\u041c\x12\xde\xebc\x97\xc3\x1b9?|Y\xd9\x11\x93\x91o\x88MY\xff\xb8|\xc3en\xc4\u0612r\xdd\x02\xa3\x8a\x98\xee\x17z&{\xb4\x1a\x87,I\n=\x1f;\x18\x94\xe0\x94t\xd7H\x8e\xb4\xda#\x16\x02Z\xc1\xba\u070b\x86n62\xbc\x11\vX\x9e\u02efH.Ag\xda\x0e\x04k,\xe7\xd3wZd\xc2\xd9\xf2\xc7\x0f\xc9=j\x951\xda\xff.\x04\x93\xdf\xe1<\xa3\x18\xc5\v\xb2\xed\xeb\x91\xe8Y\xb2\xd0u\xfcn<\u067d\x7f2\x9f\u03c31\xa1%t\t\x94\x8dK\x7f\xe1l\xcd!yz\u05d1\xcb>\u020f\xf2\x1bN\x81\x8d\x8ba\x1eUf\\\x03\x16\x0e\xe8\x9b)}\xb5q\x9b\xf7i\x896\u0358\x91\xe9\x0e\xf4\xae)\xfa9\u32fc\xbc\xd6H\"\xa0\u03f8\x1d\f\x15I\xb2e!a\xfa\xf1\x16\xbb\xad\xbd\xa2\xfb\x95\xaa(\x88\xceV\xb7\x7fL\xef\xa7Q=@\xc3\"n\a\x8c\x96\x89H\x03#B\x85\xd0\xc1\\\xd7t\xb3\u0409n\xb4\xfae\xec\x92\x10\xfds,\xcf\xcc\xe8\xaa\xc8&{\x8ed\x01\xaf\x12;\xffs\x9b\x9c\xceP\xde'\t\xa3\xc02]}z\xeb\xeay)\xb7\x89uj\x02\xd8\xdc9\xbb\x8b\f\xfe\x06\x06\x80\x81\xece\x9f\x8fw\xf7\x04,\a(\x83\u0664\xbfu\xd9t\xd0\xf8\x9c\x15\xec\x9a\xfcb\x99\x98\"B\xe6\xdex\v\xd3N\xfd\xc8;\u0775\x10\x04\xa0\u0153f\x13\xd5H9\xb6\x1d\xae\x028E\x85\xe3:\x05\xc1\xfd[\xf9\x84\xc3_\xcd\xe6&i'B\x81`\xf6\u012f'\xdb\u0359\xff\f\xa6F\x9a\xe5\x8c1\xf8\x92R\xbc\x83\x8e\x10\xdf\xfb\xb7\x18\xb5\u03f7n\x8d*G\xc9.n\xed\xf3\b\xad%7\u06cf\x87\x1d~/\x0emR\xa0f\xb4\xe8\xc1c\x9aH\b\xcb\xf3\x90\x18\x8c\xf7\xf8\x03\xd8\xe2\f\x14\xe7+\xd5\n3\x1c(C\xd9a\x96usY\x06\t\xb7\xaf\xdaFx\xa5\u00bcC8\x89\x1c\xb6\x11\xa8\xce'\x8c(G30\xf2\x80B\xa9\xaba\xf0\xf9\x0e\x84\u0611{uc~\x91\"\xb7\u0482N/j\xe0\xe7[\xfa\xc0\r\x11\xf8\xb2\x91\xcf\xf6.\xd1n2\xa3c\xb1oaI\xae\xea\u0118,\xb4\xd2k\u0577N\xae6}\x17?\x11\xbb\xb5\x1b\x12\xa4\xa6\x94\xba\xc0\xe2\xe8\x7f\xc7g\xe0\xf5)$\x84m\xba\xfd\x17'+,\xf9rG\x8a}\v\x8ca\x8b\x8e\xe9\x92y7\xff.\xfe\"0a\x8amt\x19\r\x1f#\xe8\xdc?\xf0\x10\xdd/\xdb>P\xf5\x81`\xe3\x03=\x85\xf0W\xc4 \xd8-\x9dN\x86\x91\xf1|_e\xa2\x8e\xb2\xb9\"\x1d\xd98|\xa2oCc\x1f\xbe\x0eyoV\xf1\xd5\xf9\x1d\x11\xc0\x16\n[\xef\x14\xee\a\xa8\xd3\xe7\xed\xe9\x80\x11\x91\u02a22,\xc3\xd2_\x95\xb8F\xba\xaa\xb7 &\xa1\xb1W\xa9\"\xbe\xdbIy\x97\x19c\xd6i\x99,G\x94\x8aE\n\xf2\xa2\x87!/\x8f$O\xf5\xa8<\xc4Az\xbfx\x19j=\xa4\u00c6\xac\xa1\xdfL\a\xbd\x0e\xe5\u07fa\xcdZm\x14\x82!\x99AG\x9b\xa4=\u0689\xbe\x829b\x9bx\x8a\xcf\xd6un\xc2\xdfX/\r\xf8=\xbc\xb5\xc7,\x1f\x9c\x8f,Z\xae\\3\x85&=\r\x92\u0791\xa8\xc78\xf5\xce\xf2\x9b\xbar\xe8\x95 )\xf3:U\x9a|2\xfd\x81\xa1g\x15<\x1a\x8f\x84gw\x8a\xc4ok\x8dA\xec<3\xa7\x8d\xc7\xc1\x8f\x9b\xd1\xc7\xe4+=\xea\x98\xccoU!\x0ey\x12\xb4.\n-\x15\xa9\xff\xce2E\x1aK\x968\x1a\xf9(\u038b\x0f\xdd&F\xbe\xaa\xc0X\xcc$<\xa7I\xa5WA\xcb\u04c7\x9fBI\xaa\xc8\xdb\xc7\xdeO\xfd\xb1\x0f\xe5t\xa2\xb3G\xf4\xc3f\x8f\xd1\u00a5\xab\xa7\xb2\xce/\xa7(\x91\xf5\x81\xad+\x15C\x84\xb3_\x88}\v{\xb3\xe3\x89Q\x89\xa9\xbe\xf6UN\x8a2\xdaG)\u0636S\x9d)\x00\xc8\xf7\x14F\x93Y\x93\xa0gwk\xfbp\x80\xcdV\x9c\xc5E`\xd7_\xa4h\xe3<\u04fd+\x87Lsy\"g)\xcc\x04\xca\xca\xf6\x19\xd4_*\xf7\x90\xceq\x1d\a\xf5\u04aa\x0e\x12W\xe8\x98\xd5\xd3\xd3.\xed:\x8f\xef\x1av\xb5\xf3\xd2H2\xe8\"\x9b\x85\xd4\xee\x97\xe8\xf9\u05d9IwR\x8c\xaf\x81\xf3\xa8 \xf0V\U0003c3bd\u069a(fR-h\xf149to\xe0\u046d\x1e\xad\xeb\xaa\xfd]\xf0d\x8ez&p\x19Z[~a\x1f'j\x02\x1b\x89\xe2\xdfI\xb9\xc1e\xab#i\xc7\t\fR\x9e*#\xa8\x99;e.\xc2'\xa8\x1b0\x9cA\xf2\xf9\xd39\xbfR\xbe\x04\xa1?\x1a\x9f-\x04#\xd5\"[\xc4\x1c\x1b\x1b@(mo\nv\x16&\x9e\xbe\xb1\xdf\xc5\x1c\xe9\xa0x\x1e\xb5\v6\xec\x03\x8b\x1dUT\x82y;\x86\xbe\xf3\xc0\xe7\xf4C\x88\xd4\u065ac\xff\xe1\x17T\xaf\xbe\xd4\xea|\xe6\xc5\x1c\xbeV\xd1\x100\x04\x8d\xf6\t~\xd2b\x8e\x0e#\xfe\xf9\x01\xac\xfc\x89[k\xab\x12)\x89\xc9{g\xf9W\xfb{\xa0\x87\vI\x10\u1e54{\x1e)*\xfd\xb5a\x95\xd0\x16\x03\u026e\xa3\xd0n\x8c\xf6u\u0181\x88\xc4\x168u^@5\x17\xfc\xea\u061a\xab\xef>/\x1cF\xe5\xedF\x05\xce{\x05r?\xef\xc6\u06e9\xff\u018c\xc0\xed\u0236\xffE\xe2\xe7\xfdewX\x12\xd4\x1e\xe2\xae\x06z\x05\x0e\xfdD\x0e\xddAv\u0777\x0e\x9d\xef\x7f\x94\xd8\xe0\xfb\xf3\xc5!\xfb\x8b\xef\xef<\x9b\xbci\xf6\x9f\xd6<p<\u07f0U\x82\x8bd\xf9\x7f\xa7;\x9e\xf6]\xfa^\xe0\xbf;4\xfe\xb5\xc6\xff\xb9k\xf4\u043c\xcb\xee\xaf)\uef17\xff\xf3?\x1e\xd4\x7f\x18\xe9\xf2\x1f(\x82\x92\xff\x81P\xff\x8d`\xfe\x1bN\xff\a\x84 \xff\xca\xec\xff\x0f\xf3\xff\xdc\x1f\xa0\xe9\vx\u02e7\xf9\xef~\xdf\xff\xd3\x1fy\xfc_$\xfd\xff\xcb\xd2\xffz[Q\xe4A\xfd'B\xfd'J\xfeo\x18+\xca\x05\x96\x04\xc0\xff\xcff\x8a\x7fn,\xbf\xfd\xe7\xf0\x9e\xe6\xfc?\xfe\xf9\xcc\x7f7\xf7_\xfe\x1fB\x17\xb7\xfe\xfdU\t\x00")
 
-func staticJsHtermJsBytes() ([]byte, error) {
-	return bindataRead(
-		_staticJsHtermJs,
-		"static/js/hterm.js",
-	)
+func staticJsHtermJsGzBytes() ([]byte, error) {
+	return _staticJsHtermJsGz, nil
 }
 
-func staticJsHtermJs() (*asset, error) {
-	bytes, err := staticJsHtermJsBytes()
+func staticJsHtermJsGz() (*asset, error) {
+	bytes, err := staticJsHtermJsGzBytes()
 	if err != nil {
 		return nil, err
 	}
 
-	info := bindataFileInfo{name: "static/js/hterm.js", size: 522491, mode: os.FileMode(292), modTime: time.Unix(1440919621, 0)}
+	info := bindataFileInfo{name: "static/js/hterm.js.gz", size: 159545, mode: os.FileMode(420), modTime: time.Unix(1792223996, 0)}
 	a := &asset{bytes: bytes, info: info}
 	return a, nil
 }
@@ -203,21 +168,23 @@ func AssetNames() []string {
 
 // _bindata is a table, holding each asset generator, mapped to its name.
 var _bindata = map[string]func() (*asset, error){
-	"static/favicon.png": staticFaviconPng,
-	"static/index.html":  staticIndexHtml,
-	"static/js/gotty.js": staticJsGottyJs,
-	"static/js/hterm.js": staticJsHtermJs,
+	"static/favicon.png":    staticFaviconPng,
+	"static/index.html.gz":  staticIndexHtmlGz,
+	"static/js/gotty.js.gz": staticJsGottyJsGz,
+	"static/js/hterm.js.gz": staticJsHtermJsGz,
 }
 
 // AssetDir returns the file names below a certain
 // directory embedded in the file by go-bindata.
 // For example if you run go-bindata on data/... and data contains the
 // following hierarchy:
-//     data/
-//       foo.txt
-//       img/
-//         a.png
-//         b.png
+//
+//	data/
+//	  foo.txt
+//	  img/
+//	    a.png
+//	    b.png
+//
 // then AssetDir("data") would return []string{"foo.txt", "img"}
 // AssetDir("data/img") would return []string{"a.png", "b.png"}
 // AssetDir("foo.txt") and AssetDir("notexist") would return an error
@@ -251,11 +218,11 @@ type bintree struct {
 
 var _bintree = &bintree{nil, map[string]*bintree{
 	"static": &bintree{nil, map[string]*bintree{
-		"favicon.png": &bintree{staticFaviconPng, map[string]*bintree{}},
-		"index.html":  &bintree{staticIndexHtml, map[string]*bintree{}},
+		"favicon.png":   &bintree{staticFaviconPng, map[string]*bintree{}},
+		"index.html.gz": &bintree{staticIndexHtmlGz, map[string]*bintree{}},
 		"js": &bintree{nil, map[string]*bintree{
-			"gotty.js": &bintree{staticJsGottyJs, map[string]*bintree{}},
-			"hterm.js": &bintree{staticJsHtermJs, map[string]*bintree{}},
+			"gotty.js.gz": &bintree{staticJsGottyJsGz, map[string]*bintree{}},
+			"hterm.js.gz": &bintree{staticJsHtermJsGz, map[string]*bintree{}},
 		}},
 	}},
 }}
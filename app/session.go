@@ -0,0 +1,282 @@
+package app
+
+import (
+	"bytes"
+	"log"
+	"os"
+	"os/exec"
+	"sync"
+	"sync/atomic"
+	"syscall"
+	"time"
+)
+
+const (
+	// broadcastBufferSize is how far a client may fall behind the shared
+	// output before it is dropped.
+	broadcastBufferSize = 1024 * 1024
+
+	// replayBufferSize is how much output a resumable session keeps for a
+	// reconnecting client.
+	replayBufferSize = 256 * 1024
+)
+
+// Output sequences after which the screen can be redrawn from scratch.
+// Late joiners start replaying from the last one still in the buffer.
+var screenResetSequences = [][]byte{
+	[]byte("\x1b[2J"),
+	[]byte("\x1bc"),
+	[]byte("\x1b[?1049h"),
+	[]byte("\x1b[?47h"),
+}
+
+// ptySession runs a command that is not tied to a single websocket: the
+// command shared in broadcast mode, or a command kept alive for a
+// reconnecting client. The PTY is read into a ring buffer indexed by the
+// offset in the output stream, and each client follows it with its own
+// cursor, so a slow client only falls behind itself.
+type ptySession struct {
+	// id is set for sessions clients can resume
+	id string
+
+	command *exec.Cmd
+	pty     *os.File
+	exited  chan bool
+
+	ringMutex *sync.RWMutex
+	ring      []byte
+
+	// Offsets in the output stream, accessed atomically
+	head   int64
+	screen int64
+	closed int32
+
+	// clients are kept in join order; the first one owns the input.
+	clientsMutex *sync.Mutex
+	clients      []*sessionClient
+
+	// expiry stops a resumable session left without clients
+	expiry *time.Timer
+
+	metrics *metrics
+}
+
+// sessionClient is the outputSource of a client attached to a ptySession.
+type sessionClient struct {
+	session *ptySession
+	cursor  int64
+	ready   chan bool
+	closed  int32
+}
+
+func newSession(cmd *exec.Cmd, ptyIo *os.File, exited chan bool, bufferSize int, metrics *metrics) *ptySession {
+	return &ptySession{
+		command: cmd,
+		pty:     ptyIo,
+		exited:  exited,
+
+		ringMutex: &sync.RWMutex{},
+		ring:      make([]byte, bufferSize),
+
+		clientsMutex: &sync.Mutex{},
+
+		metrics: metrics,
+	}
+}
+
+// run copies PTY output into the ring buffer until the command exits.
+func (session *ptySession) run() {
+	buf := frameBufferPool.Get().([]byte)
+	defer frameBufferPool.Put(buf)
+	buf = buf[:readBufferSize]
+
+	for {
+		size, err := session.pty.Read(buf)
+		if err != nil {
+			break
+		}
+		session.metrics.ptyReadSize.observe(float64(size))
+		session.append(buf[:size])
+		session.notifyClients()
+	}
+
+	atomic.StoreInt32(&session.closed, 1)
+	session.notifyClients()
+	session.pty.Close()
+	<-session.exited
+}
+
+// stop closes the PTY and signals the command.
+func (session *ptySession) stop(signal syscall.Signal) {
+	session.pty.Close()
+	session.command.Process.Signal(signal)
+}
+
+func (session *ptySession) append(data []byte) {
+	head := atomic.LoadInt64(&session.head)
+
+	reset := -1
+	for _, sequence := range screenResetSequences {
+		if index := bytes.LastIndex(data, sequence); index > reset {
+			reset = index
+		}
+	}
+
+	session.ringMutex.Lock()
+	defer session.ringMutex.Unlock()
+
+	for written := 0; written < len(data); {
+		offset := int((head + int64(written)) % int64(len(session.ring)))
+		written += copy(session.ring[offset:], data[written:])
+	}
+	atomic.StoreInt64(&session.head, head+int64(len(data)))
+
+	// Stored after the head so that the screen never points past it
+	if reset >= 0 {
+		atomic.StoreInt64(&session.screen, head+int64(reset))
+	}
+}
+
+// read copies output starting at offset into p. It returns false if the
+// data has already been overwritten.
+func (session *ptySession) read(p []byte, offset int64) bool {
+	session.ringMutex.RLock()
+	defer session.ringMutex.RUnlock()
+
+	if atomic.LoadInt64(&session.head)-offset > int64(len(session.ring)) {
+		return false
+	}
+	for read := 0; read < len(p); {
+		position := int((offset + int64(read)) % int64(len(session.ring)))
+		read += copy(p[read:], session.ring[position:])
+	}
+	return true
+}
+
+func (session *ptySession) notifyClients() {
+	session.clientsMutex.Lock()
+	defer session.clientsMutex.Unlock()
+
+	for _, client := range session.clients {
+		notify(client.ready)
+	}
+}
+
+func (session *ptySession) isClosed() bool {
+	return atomic.LoadInt32(&session.closed) != 0
+}
+
+// join adds a client that starts reading at offset. A negative offset
+// starts from the last screen reset still held in the ring buffer. It
+// returns false if the output at offset is not available.
+func (session *ptySession) join(offset int64) (*sessionClient, bool) {
+	cursor := atomic.LoadInt64(&session.screen)
+	head := atomic.LoadInt64(&session.head)
+	oldest := head - int64(len(session.ring))
+	if oldest < 0 {
+		oldest = 0
+	}
+
+	if offset >= 0 {
+		if offset < oldest || offset > head {
+			return nil, false
+		}
+		cursor = offset
+	} else if cursor < oldest {
+		cursor = oldest
+	}
+
+	client := &sessionClient{
+		session: session,
+		cursor:  cursor,
+		ready:   make(chan bool, 1),
+	}
+	notify(client.ready)
+
+	session.clientsMutex.Lock()
+	session.clients = append(session.clients, client)
+	session.clientsMutex.Unlock()
+
+	return client, true
+}
+
+// leave removes a client, passing the input to the next one if it was the
+// owner. It returns the number of remaining clients.
+func (session *ptySession) leave(client *sessionClient) int {
+	client.Close()
+
+	session.clientsMutex.Lock()
+	defer session.clientsMutex.Unlock()
+
+	for i, c := range session.clients {
+		if c == client {
+			session.clients = append(session.clients[:i], session.clients[i+1:]...)
+			if i == 0 && len(session.clients) > 0 {
+				log.Printf("Passing the input of the shared command to the next client")
+			}
+			break
+		}
+	}
+	return len(session.clients)
+}
+
+// detachClients disconnects all clients, e.g. when a client resumes a
+// session whose previous connection has not been noticed to be dead yet.
+func (session *ptySession) detachClients() {
+	session.clientsMutex.Lock()
+	defer session.clientsMutex.Unlock()
+
+	for _, client := range session.clients {
+		client.Close()
+	}
+	session.clients = nil
+}
+
+func (session *ptySession) clientCount() int {
+	session.clientsMutex.Lock()
+	defer session.clientsMutex.Unlock()
+
+	return len(session.clients)
+}
+
+func (session *ptySession) isOwner(client *sessionClient) bool {
+	session.clientsMutex.Lock()
+	defer session.clientsMutex.Unlock()
+
+	return len(session.clients) > 0 && session.clients[0] == client
+}
+
+func (client *sessionClient) Next(frame []byte) ([]byte, bool) {
+	session := client.session
+
+	for atomic.LoadInt32(&client.closed) == 0 {
+		head := atomic.LoadInt64(&session.head)
+		if client.cursor == head {
+			if session.isClosed() {
+				break
+			}
+			<-client.ready
+			continue
+		}
+
+		size := head - client.cursor
+		if max := int64(cap(frame) - 1); size > max {
+			size = max
+		}
+		frame = frame[:1+size]
+		if !session.read(frame[1:], client.cursor) {
+			log.Printf("Client is too slow for the session output, dropping")
+			session.metrics.slowClientsDrops.add(1)
+			break
+		}
+		client.cursor += size
+		return frame, true
+	}
+
+	return frame, false
+}
+
+func (client *sessionClient) Close() {
+	atomic.StoreInt32(&client.closed, 1)
+	notify(client.ready)
+}
@@ -0,0 +1,84 @@
+package app
+
+import (
+	"os"
+	"sync"
+	"time"
+)
+
+// resizeQuietPeriod is how long a client must stop resizing before its
+// latest size is applied.
+const resizeQuietPeriod = 50 * time.Millisecond
+
+// windowResizer applies the terminal sizes sent by a client to a PTY.
+// Dragging a browser window sends dozens of sizes per second, each making
+// full screen applications redraw, so a resize following another one
+// closely is held back until the client has been quiet for a while and
+// only the latest size is applied.
+type windowResizer struct {
+	pty *os.File
+
+	mutex          *sync.Mutex
+	timer          *time.Timer
+	rows           uint16
+	columns        uint16
+	appliedRows    uint16
+	appliedColumns uint16
+	lastRequest    time.Time
+	stopped        bool
+}
+
+func newWindowResizer(pty *os.File) *windowResizer {
+	return &windowResizer{
+		pty:   pty,
+		mutex: &sync.Mutex{},
+	}
+}
+
+func (resizer *windowResizer) resize(rows uint16, columns uint16) {
+	resizer.mutex.Lock()
+	defer resizer.mutex.Unlock()
+
+	now := time.Now()
+	quiet := now.Sub(resizer.lastRequest) >= resizeQuietPeriod
+	resizer.rows, resizer.columns = rows, columns
+	resizer.lastRequest = now
+
+	if resizer.timer == nil && quiet {
+		resizer.applyLocked()
+		return
+	}
+	if resizer.timer == nil {
+		resizer.timer = time.AfterFunc(resizeQuietPeriod, resizer.apply)
+	} else {
+		resizer.timer.Reset(resizeQuietPeriod)
+	}
+}
+
+func (resizer *windowResizer) apply() {
+	resizer.mutex.Lock()
+	defer resizer.mutex.Unlock()
+
+	resizer.timer = nil
+	resizer.applyLocked()
+}
+
+func (resizer *windowResizer) applyLocked() {
+	if resizer.stopped ||
+		(resizer.rows == resizer.appliedRows && resizer.columns == resizer.appliedColumns) {
+		return
+	}
+	setWindowSize(resizer.pty, resizer.rows, resizer.columns)
+	resizer.appliedRows, resizer.appliedColumns = resizer.rows, resizer.columns
+}
+
+// stop drops a pending resize.
+func (resizer *windowResizer) stop() {
+	resizer.mutex.Lock()
+	defer resizer.mutex.Unlock()
+
+	resizer.stopped = true
+	if resizer.timer != nil {
+		resizer.timer.Stop()
+	}
+}
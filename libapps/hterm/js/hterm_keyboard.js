@@ -175,6 +175,13 @@ hterm.Keyboard = function(terminal) {
    * nulled out.
    */
   this.previousAltSendsWhat_ = null;
+
+  /**
+   * Time stamp of the key event being handled, on the performance.now()
+   * clock, for measuring input latency.  Handed over to the terminal IO by
+   * hterm.Terminal.prototype.onVTKeystroke.
+   */
+  this.keyEventTime = null;
 };
 
 /**
@@ -298,6 +305,8 @@ hterm.Keyboard.prototype.onTextInput_ = function(e) {
 hterm.Keyboard.prototype.onKeyPress_ = function(e) {
   var code;
 
+  this.keyEventTime = e.timeStamp;
+
   var key = String.fromCharCode(e.which);
   var lowerKey = key.toLowerCase();
   if ((e.ctrlKey || e.metaKey) && (lowerKey == 'c' || lowerKey == 'v')) {
@@ -349,6 +358,8 @@ hterm.Keyboard.prototype.onFocusOut_ = function(e) {
 };
 
 hterm.Keyboard.prototype.onKeyUp_ = function(e) {
+  this.keyEventTime = null;
+
   if (e.keyCode == 18)
     this.altKeyPressed = this.altKeyPressed & ~(1 << (e.location - 1));
 
@@ -366,6 +377,25 @@ hterm.Keyboard.prototype.onKeyDown_ = function(e) {
   if (e.keyCode == 27)
     this.preventChromeAppNonCtrlShiftDefault_(e);
 
+  this.keyEventTime = e.timeStamp;
+
+  // Most typing is unmodified keys with a plain action, which need none of
+  // the resolving below.
+  if (!(e.ctrlKey || e.altKey || e.metaKey) &&
+      e.keyCode in this.keyMap.plainActions &&
+      !this.bindings.hasBinding(e.keyCode)) {
+    var plainAction = this.keyMap.plainActions[e.keyCode];
+
+    // Printable keys are sent from onKeyPress.
+    if (plainAction === hterm.Keyboard.KeyActions.DEFAULT)
+      return;
+
+    e.preventDefault();
+    e.stopPropagation();
+    this.terminal.onVTKeystroke(plainAction);
+    return;
+  }
+
   var keyDef = this.keyMap.keyDefs[e.keyCode];
   if (!keyDef) {
     console.warn('No definition for keyCode: ' + e.keyCode);
@@ -405,8 +435,7 @@ hterm.Keyboard.prototype.onKeyDown_ = function(e) {
   var alt = this.altIsMeta ? false : e.altKey;
   var meta = this.altIsMeta ? (e.altKey || e.metaKey) : e.metaKey;
 
-  // In the key-map, we surround the keyCap for non-printables in "[...]"
-  var isPrintable = !(/^\[\w+\]$/.test(keyDef.keyCap));
+  var isPrintable = keyDef.isPrintable;
 
   switch (this.altGrMode) {
     case 'ctrl-alt':
@@ -152,6 +152,16 @@ hterm.Keyboard.Bindings.prototype.addBindings = function(map) {
   }
 };
 
+/**
+ * Tell whether there are any bindings for a keyCode.
+ *
+ * @param {integer} keyCode The keyCode.
+ * @return {boolean}
+ */
+hterm.Keyboard.Bindings.prototype.hasBinding = function(keyCode) {
+  return !!this.bindings_[keyCode];
+};
+
 /**
  * Return the binding that is the best match for the given keyDown record,
  * or null if there is no match.
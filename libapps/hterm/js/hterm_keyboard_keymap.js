@@ -30,6 +30,12 @@ lib.rtdep('hterm.Keyboard.KeyActions');
 hterm.Keyboard.KeyMap = function(keyboard) {
   this.keyboard = keyboard;
   this.keyDefs = {};
+
+  // The unmodified actions that hterm.Keyboard can use without resolving
+  // them, by keyCode: the default action or a literal string that modifiers
+  // would not alter.
+  this.plainActions = {};
+
   this.reset();
 };
 
@@ -70,7 +76,18 @@ hterm.Keyboard.KeyMap.prototype.addKeyDef = function(keyCode, def) {
   if (keyCode in this.keyDefs)
     console.warn('Duplicate keyCode: ' + keyCode);
 
+  // In the key-map, we surround the keyCap for non-printables in "[...]"
+  def.isPrintable = !(/^\[\w+\]$/.test(def.keyCap));
+
   this.keyDefs[keyCode] = def;
+
+  var normal = def.normal;
+  if (normal === hterm.Keyboard.KeyActions.DEFAULT ||
+      (typeof normal == 'string' && normal.substr(0, 2) != '\x1b[')) {
+    this.plainActions[keyCode] = normal;
+  } else {
+    delete this.plainActions[keyCode];
+  }
 };
 
 /**
@@ -103,6 +120,7 @@ hterm.Keyboard.KeyMap.prototype.addKeyDefs = function(var_args) {
  */
 hterm.Keyboard.KeyMap.prototype.reset = function() {
   this.keyDefs = {};
+  this.plainActions = {};
 
   var self = this;
 
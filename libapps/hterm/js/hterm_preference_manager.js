@@ -147,6 +147,23 @@ hterm.PreferenceManager.defaultPreferences = {
   [hterm.PreferenceManager.categories.Miscellaneous, true, 'bool',
    'Whether or not to close the window when the command exits.'],
 
+  'batch-rendering':
+  [hterm.PreferenceManager.categories.Miscellaneous, false, 'bool',
+   'If true, output is interpreted and drawn once per animation frame ' +
+   'rather than as it arrives, so heavy output does not make the browser ' +
+   'lay out the page more often than it paints.'],
+
+  'render-frame-budget':
+  [hterm.PreferenceManager.categories.Miscellaneous, 10, 'int',
+   'With batch-rendering, the time in milliseconds spent interpreting output ' +
+   'in each animation frame.  Output left over waits for the next frame.'],
+
+  'worker-parsing':
+  [hterm.PreferenceManager.categories.Miscellaneous, false, 'bool',
+   'If true, output is decoded and split into text and control sequences ' +
+   'in a Web Worker, leaving the page more time to draw and handle input.  ' +
+   'Works best with batch-rendering.'],
+
   'cursor-blink':
   [hterm.PreferenceManager.categories.Appearance, false, 'bool',
    'Whether or not to blink the cursor by default.'],
@@ -422,6 +439,16 @@ hterm.PreferenceManager.defaultPreferences = {
   [hterm.PreferenceManager.categories.Scrolling, true, 'bool',
    'The vertical scrollbar mode.'],
 
+  'scrollback-limit':
+  [hterm.PreferenceManager.categories.Scrolling, 100000, 'int',
+   'The maximum number of rows kept in the scrollback buffer, or 0 for no ' +
+   'limit.  The oldest rows are dropped in blocks of 256.'],
+
+  'scrollback-byte-limit':
+  [hterm.PreferenceManager.categories.Scrolling, 64 * 1024 * 1024, 'int',
+   'The maximum memory used by the scrollback buffer in bytes, or 0 for no ' +
+   'limit.  The oldest rows are dropped in blocks of 256.'],
+
   'scroll-wheel-may-send-arrow-keys':
   [hterm.PreferenceManager.categories.Scrolling, false, 'bool',
    'When using the alternative screen buffer, and DECCKM (Application Cursor ' +
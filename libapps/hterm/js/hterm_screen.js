@@ -392,7 +392,7 @@ hterm.Screen.prototype.syncSelectionCaret = function(selection) {
  *     occur.
  */
 hterm.Screen.prototype.splitNode_ = function(node, offset) {
-  var afterNode = node.cloneNode(false);
+  var afterNode = hterm.TextAttributes.cloneContainer(node);
 
   var textContent = node.textContent;
   node.textContent = hterm.TextAttributes.nodeSubstr(node, 0, offset);
@@ -462,8 +462,12 @@ hterm.Screen.prototype.maybeClipCurrentRow = function() {
  *
  * It is also up to the caller to properly maintain the line overflow state
  * using hterm.Screen..commitLineOverflow().
+ *
+ * @param {string} str The string to insert.
+ * @param {integer} opt_width The column width of str, if the caller already
+ *     knows it.
  */
-hterm.Screen.prototype.insertString = function(str) {
+hterm.Screen.prototype.insertString = function(str, opt_width) {
   var cursorNode = this.cursorNode_;
   var cursorNodeText = cursorNode.textContent;
 
@@ -471,7 +475,7 @@ hterm.Screen.prototype.insertString = function(str) {
 
   // We may alter the width of the string by prepending some missing
   // whitespaces, so we need to record the string width ahead of time.
-  var strWidth = lib.wc.strWidth(str);
+  var strWidth = opt_width != null ? opt_width : lib.wc.strWidth(str);
 
   // No matter what, before this function exits the cursor column will have
   // moved this much.
@@ -596,13 +600,27 @@ hterm.Screen.prototype.insertString = function(str) {
  *
  * It is also up to the caller to properly maintain the line overflow state
  * using hterm.Screen..commitLineOverflow().
+ *
+ * @param {string} str The string to write.
+ * @param {integer} opt_width The column width of str, if the caller already
+ *     knows it.
  */
-hterm.Screen.prototype.overwriteString = function(str) {
+hterm.Screen.prototype.overwriteString = function(str, opt_width) {
   var maxLength = this.columnCount_ - this.cursorPosition.column;
   if (!maxLength)
     return [str];
 
-  var width = lib.wc.strWidth(str);
+  var width = opt_width != null ? opt_width : lib.wc.strWidth(str);
+
+  if (!this.cursorNode_.nextSibling &&
+      (this.cursorNode_.nodeType == 3 || this.cursorNode_.textContent) &&
+      this.cursorOffset_ >= hterm.TextAttributes.nodeWidth(this.cursorNode_)) {
+    // Past the end of the row there is nothing to overwrite, which is the
+    // common case of output streaming in.
+    this.insertString(str, width);
+    return;
+  }
+
   if (this.textAttributes.matchesContainer(this.cursorNode_) &&
       this.cursorNode_.textContent.substr(this.cursorOffset_) == str) {
     // This overwrite would be a no-op, just move the cursor and return.
@@ -612,7 +630,7 @@ hterm.Screen.prototype.overwriteString = function(str) {
   }
 
   this.deleteChars(Math.min(width, maxLength));
-  this.insertString(str);
+  this.insertString(str, width);
 };
 
 /**
@@ -0,0 +1,552 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+'use strict';
+
+/**
+ * @fileoverview The rows that have scrolled off the top of the terminal.
+ *
+ * Keeping every row as a detached 'x-row' element makes the scrollback of a
+ * long running session cost far more than its text, so rows are packed as
+ * they enter the scrollback and turned back into DOM only when the
+ * hterm.ScrollPort asks for them.
+ *
+ * A packed row is its text plus a list of runs, one per child node of the
+ * original row.  Each run is a (style id, text length) pair, where the style
+ * id refers to a table of the distinct span styles seen so far, and style 0
+ * stands for a plain text node.  Rows are stored in chunks of CHUNK_ROWS rows.
+ * The last chunk is open and keeps one string per row; the others are sealed
+ * into a single string and typed arrays.  When the scrollback grows past its
+ * row or byte limit, the oldest chunk is dropped as a whole.
+ *
+ * Sealed chunks also keep a bloom filter of the trigrams of their lower case
+ * text, so that searches can skip the chunks that cannot match without
+ * reading their text.  The filter has a fixed size and goes away with its
+ * chunk.
+ */
+
+/**
+ * Create an empty scrollback buffer.
+ *
+ * @param {HTMLDocument} document The document to create rows in.
+ */
+hterm.Scrollback = function(document) {
+  this.document_ = document;
+
+  /**
+   * Public, read-only number of rows in the scrollback.
+   */
+  this.length = 0;
+
+  /**
+   * Public, read-only estimate of the memory used by the rows, in bytes.
+   */
+  this.byteCount = 0;
+
+  /**
+   * Public, read-only number of rows dropped from the start of the
+   * scrollback so far, by the limits or by clear().  Adding it to the index
+   * of a row gives a number that stays the same as rows are dropped.
+   */
+  this.droppedCount = 0;
+
+  // Maximum number of rows and bytes to keep, 0 for no limit.  The limits
+  // are enforced a chunk at a time, so up to a chunk more may be kept.
+  this.rowLimit_ = 0;
+  this.byteLimit_ = 0;
+
+  this.chunks_ = [];
+
+  // The distinct span styles, indexed by style id, and the reverse mapping
+  // from style key to id.
+  this.styles_ = [null];
+  this.styleIds_ = {};
+};
+
+/**
+ * Number of rows in a chunk, the unit of eviction.
+ */
+hterm.Scrollback.CHUNK_ROWS = 256;
+
+/**
+ * Memory used by the per row arrays of a chunk, in bytes.
+ */
+hterm.Scrollback.CHUNK_OVERHEAD = hterm.Scrollback.CHUNK_ROWS * 9;
+
+/**
+ * Number of bits in the trigram filter of a sealed chunk.  Must be a power
+ * of two.
+ */
+hterm.Scrollback.INDEX_BITS = 32768;
+
+/**
+ * Set the document used to create rows.
+ *
+ * @param {HTMLDocument} document The new document.
+ */
+hterm.Scrollback.prototype.setDocument = function(document) {
+  this.document_ = document;
+};
+
+/**
+ * Set the maximum size of the scrollback.
+ *
+ * Rows beyond the limits are dropped the next time rows are added.
+ *
+ * @param {integer} rowLimit The maximum number of rows, 0 for no limit.
+ * @param {integer} byteLimit The maximum estimated memory use in bytes, 0
+ *     for no limit.
+ */
+hterm.Scrollback.prototype.setLimits = function(rowLimit, byteLimit) {
+  this.rowLimit_ = rowLimit || 0;
+  this.byteLimit_ = byteLimit || 0;
+};
+
+/**
+ * Remove all rows.
+ */
+hterm.Scrollback.prototype.clear = function() {
+  this.droppedCount += this.length;
+  this.chunks_.length = 0;
+  this.length = 0;
+  this.byteCount = 0;
+  this.styles_.length = 1;
+  this.styleIds_ = {};
+};
+
+/**
+ * Pack rows and add them to the end of the scrollback.
+ *
+ * The row nodes are not kept, and may be reused by the caller.
+ *
+ * @param {Array.<HTMLElement>} rows The 'x-row' elements to add.
+ * @return {integer} The number of rows dropped from the start of the
+ *     scrollback to stay within its limits.  The index of every remaining
+ *     row is reduced by this amount.
+ */
+hterm.Scrollback.prototype.appendRows = function(rows) {
+  for (var i = 0; i < rows.length; i++) {
+    var chunk = this.chunks_[this.chunks_.length - 1];
+    if (!chunk || chunk.rowCount == hterm.Scrollback.CHUNK_ROWS) {
+      if (chunk) {
+        var bytes = chunk.byteCount;
+        chunk.seal();
+        this.byteCount -= bytes - chunk.byteCount;
+      }
+      chunk = new hterm.Scrollback.Chunk();
+      this.chunks_.push(chunk);
+      this.byteCount += chunk.byteCount;
+    }
+
+    var bytes = chunk.byteCount;
+    this.appendRow_(chunk, rows[i]);
+    this.byteCount += chunk.byteCount - bytes;
+    this.length++;
+  }
+
+  return this.evict_();
+};
+
+/**
+ * Remove rows from the end of the scrollback and return them as new
+ * 'x-row' elements.
+ *
+ * @param {integer} count The number of rows to remove.
+ * @return {Array.<HTMLElement>} The removed rows, oldest first.  Their
+ *     rowIndex is the index they had in the scrollback.
+ */
+hterm.Scrollback.prototype.popRows = function(count) {
+  count = Math.min(count, this.length);
+  var rows = new Array(count);
+
+  for (var i = count - 1; i >= 0; i--) {
+    var chunk = this.chunks_[this.chunks_.length - 1];
+    var bytes = chunk.byteCount;
+    chunk.unseal();
+
+    var row = this.createRowNode_(chunk, chunk.rowCount - 1);
+    row.rowIndex = this.length - 1;
+    rows[i] = row;
+
+    chunk.popRow();
+    this.byteCount -= bytes - chunk.byteCount;
+    this.length--;
+
+    if (!chunk.rowCount) {
+      this.chunks_.pop();
+      this.byteCount -= chunk.byteCount;
+    }
+  }
+
+  return rows;
+};
+
+/**
+ * Return a new 'x-row' element for a row.
+ *
+ * @param {integer} index The index of the row.
+ * @return {HTMLElement} The row, with its rowIndex set.
+ */
+hterm.Scrollback.prototype.getRowNode = function(index) {
+  var chunk = this.chunks_[Math.floor(index / hterm.Scrollback.CHUNK_ROWS)];
+  var row = this.createRowNode_(chunk, index % hterm.Scrollback.CHUNK_ROWS);
+  row.rowIndex = index;
+  return row;
+};
+
+/**
+ * Return the text of a row, without creating its DOM.
+ *
+ * @param {integer} index The index of the row.
+ * @return {string} The text of the row.
+ */
+hterm.Scrollback.prototype.getRowText = function(index) {
+  var chunk = this.chunks_[Math.floor(index / hterm.Scrollback.CHUNK_ROWS)];
+  return chunk.getRowText(index % hterm.Scrollback.CHUNK_ROWS);
+};
+
+/**
+ * Tell whether a row continues on the next one, that is, whether it had the
+ * 'line-overflow' attribute.
+ *
+ * @param {integer} index The index of the row.
+ * @return {boolean}
+ */
+hterm.Scrollback.prototype.isRowOverflow = function(index) {
+  var chunk = this.chunks_[Math.floor(index / hterm.Scrollback.CHUNK_ROWS)];
+  return !!chunk.overflow[index % hterm.Scrollback.CHUNK_ROWS];
+};
+
+/**
+ * Tell whether the rows of the chunk holding a row may contain a string,
+ * on their own or with the rows they overflow into within the chunk.
+ *
+ * False positives are possible, false negatives are not.
+ *
+ * @param {integer} index The index of a row.
+ * @param {Array.<integer>} hashes The trigram hashes of the string, from
+ *     hterm.Scrollback.getTrigramHashes().
+ * @return {boolean}
+ */
+hterm.Scrollback.prototype.chunkMayContain = function(index, hashes) {
+  var chunk = this.chunks_[Math.floor(index / hterm.Scrollback.CHUNK_ROWS)];
+  return chunk.mayContain(hashes);
+};
+
+/**
+ * Return the hashes of the trigrams of the lower case version of a string,
+ * two per trigram.
+ *
+ * @param {string} str The string.
+ * @return {Array.<integer>} Bit numbers in a trigram filter.
+ */
+hterm.Scrollback.getTrigramHashes = function(str) {
+  str = str.toLowerCase();
+  var mask = hterm.Scrollback.INDEX_BITS - 1;
+  var hashes = [];
+
+  for (var i = 0; i + 2 < str.length; i++) {
+    var h = Math.imul(str.charCodeAt(i), 0x9e3779b1) ^
+            Math.imul(str.charCodeAt(i + 1), 0x85ebca77) ^
+            Math.imul(str.charCodeAt(i + 2), 0xc2b2ae3d);
+    hashes.push(h & mask, (h >>> 16) & mask);
+  }
+
+  return hashes;
+};
+
+/**
+ * Drop the oldest chunks until the scrollback is within its limits.
+ *
+ * The open chunk is never dropped.
+ *
+ * @return {integer} The number of rows dropped.
+ */
+hterm.Scrollback.prototype.evict_ = function() {
+  var count = 0;
+
+  while (this.chunks_.length > 1 &&
+         ((this.rowLimit_ && this.length > this.rowLimit_) ||
+          (this.byteLimit_ && this.byteCount > this.byteLimit_))) {
+    var chunk = this.chunks_.shift();
+    this.length -= chunk.rowCount;
+    this.byteCount -= chunk.byteCount;
+    count += chunk.rowCount;
+  }
+
+  this.droppedCount += count;
+  return count;
+};
+
+/**
+ * Pack a row into the open chunk.
+ *
+ * @param {hterm.Scrollback.Chunk} chunk The open chunk.
+ * @param {HTMLElement} row The 'x-row' element.
+ */
+hterm.Scrollback.prototype.appendRow_ = function(chunk, row) {
+  var text = '';
+
+  for (var node = row.firstChild; node; node = node.nextSibling) {
+    var nodeText, styleId;
+
+    if (node.nodeType == 3) {
+      nodeText = node.nodeValue;
+      styleId = 0;
+    } else {
+      nodeText = node.textContent;
+      styleId = this.getStyleId_(node);
+    }
+
+    if (!nodeText)
+      continue;
+
+    chunk.pushRun(styleId, nodeText.length);
+    text += nodeText;
+  }
+
+  chunk.pushRow(text, row.getAttribute('line-overflow'));
+};
+
+/**
+ * Return the id of the style of a span, adding it to the style table if it
+ * is new.
+ *
+ * @param {HTMLElement} span A span created by hterm.TextAttributes.
+ * @return {integer} The style id.
+ */
+hterm.Scrollback.prototype.getStyleId_ = function(span) {
+  // Spans with an interned style are known by their id, without reading
+  // back their style.
+  if (span.styleId) {
+    var key = '#' + span.styleId;
+    var style = {styleId: span.styleId};
+  } else {
+    var flags = 0;
+    for (var i = 0; i < hterm.TextAttributes.spanFlags.length; i++) {
+      if (span[hterm.TextAttributes.spanFlags[i]])
+        flags |= 1 << i;
+    }
+
+    var style = {cssText: span.style.cssText, className: span.className,
+                 flags: flags};
+    var key = style.cssText + '\n' + style.className + '\n' + flags;
+  }
+
+  var id = this.styleIds_[key];
+  if (id === undefined) {
+    id = this.styles_.length;
+    this.styles_.push(style);
+    this.styleIds_[key] = id;
+  }
+
+  return id;
+};
+
+/**
+ * Create the 'x-row' element of a packed row.
+ *
+ * @param {hterm.Scrollback.Chunk} chunk The chunk holding the row.
+ * @param {integer} index The index of the row in the chunk.
+ * @return {HTMLElement} The row, without a rowIndex.
+ */
+hterm.Scrollback.prototype.createRowNode_ = function(chunk, index) {
+  var row = this.document_.createElement('x-row');
+  var text = chunk.getRowText(index);
+  var offset = 0;
+
+  var runEnd = chunk.runEnds[index];
+  for (var i = index ? chunk.runEnds[index - 1] : 0; i < runEnd; i++) {
+    var style = this.styles_[chunk.runs[i * 2]];
+    var nodeText = text.substr(offset, chunk.runs[i * 2 + 1]);
+    offset += nodeText.length;
+
+    if (!style) {
+      row.appendChild(this.document_.createTextNode(nodeText));
+      continue;
+    }
+
+    if (style.styleId) {
+      var span = hterm.TextAttributes.createStyledSpan(this.document_,
+                                                       style.styleId);
+    } else {
+      var span = this.document_.createElement('span');
+      if (style.cssText)
+        span.style.cssText = style.cssText;
+      if (style.className)
+        span.className = style.className;
+      hterm.TextAttributes.setSpanFlags(span, style.flags);
+    }
+    span.textContent = nodeText;
+    row.appendChild(span);
+  }
+
+  if (!row.firstChild)
+    row.appendChild(this.document_.createTextNode(''));
+
+  if (chunk.overflow[index])
+    row.setAttribute('line-overflow', true);
+
+  return row;
+};
+
+/**
+ * A chunk of packed rows.
+ */
+hterm.Scrollback.Chunk = function() {
+  this.rowCount = 0;
+
+  // The text of the rows: one string per row while the chunk is open, and
+  // all of it in textParts[0] once it is sealed.
+  this.textParts = [];
+  this.sealed = false;
+
+  // Per row offsets of the end of its text and of its runs, and whether it
+  // overflows into the next row.
+  this.textEnds = new Uint32Array(hterm.Scrollback.CHUNK_ROWS);
+  this.runEnds = new Uint32Array(hterm.Scrollback.CHUNK_ROWS);
+  this.overflow = new Uint8Array(hterm.Scrollback.CHUNK_ROWS);
+
+  // (style id, text length) pairs.  Grown as needed while the chunk is open,
+  // and trimmed to size when it is sealed.
+  this.runs = new Uint32Array(hterm.Scrollback.CHUNK_ROWS * 2);
+  this.runCount = 0;
+
+  // Trigram filter of the text, built when the chunk is sealed.
+  this.index = null;
+
+  this.byteCount = hterm.Scrollback.CHUNK_OVERHEAD + this.runs.byteLength;
+};
+
+/**
+ * Add a run to the row being packed.
+ *
+ * @param {integer} styleId The style of the run.
+ * @param {integer} length The length of its text.
+ */
+hterm.Scrollback.Chunk.prototype.pushRun = function(styleId, length) {
+  if (this.runCount * 2 == this.runs.length) {
+    var runs = new Uint32Array(
+        Math.max(this.runs.length * 2, hterm.Scrollback.CHUNK_ROWS * 2));
+    runs.set(this.runs);
+    this.byteCount += runs.byteLength - this.runs.byteLength;
+    this.runs = runs;
+  }
+
+  this.runs[this.runCount * 2] = styleId;
+  this.runs[this.runCount * 2 + 1] = length;
+  this.runCount++;
+};
+
+/**
+ * Finish packing a row, after its runs have been pushed.
+ *
+ * @param {string} text The text of the row.
+ * @param {boolean} overflow Whether the row overflows into the next one.
+ */
+hterm.Scrollback.Chunk.prototype.pushRow = function(text, overflow) {
+  var index = this.rowCount++;
+  this.textParts.push(text);
+  this.textEnds[index] = (index ? this.textEnds[index - 1] : 0) + text.length;
+  this.runEnds[index] = this.runCount;
+  this.overflow[index] = overflow ? 1 : 0;
+  this.byteCount += text.length * 2;
+};
+
+/**
+ * Remove the last row.  The chunk must be open.
+ */
+hterm.Scrollback.Chunk.prototype.popRow = function() {
+  var index = --this.rowCount;
+  this.byteCount -= this.textParts.pop().length * 2;
+  this.runCount = index ? this.runEnds[index - 1] : 0;
+};
+
+/**
+ * Return the text of a row.
+ *
+ * @param {integer} index The index of the row in the chunk.
+ * @return {string}
+ */
+hterm.Scrollback.Chunk.prototype.getRowText = function(index) {
+  if (!this.sealed)
+    return this.textParts[index];
+
+  var start = index ? this.textEnds[index - 1] : 0;
+  return this.textParts[0].substring(start, this.textEnds[index]);
+};
+
+/**
+ * Tell whether the text of the chunk may contain the trigrams of a string.
+ *
+ * @param {Array.<integer>} hashes The trigram hashes of the string.
+ * @return {boolean} True if so, or if the chunk has no filter yet.
+ */
+hterm.Scrollback.Chunk.prototype.mayContain = function(hashes) {
+  if (!this.index)
+    return true;
+
+  for (var i = 0; i < hashes.length; i++) {
+    if (!(this.index[hashes[i] >>> 5] & (1 << (hashes[i] & 31))))
+      return false;
+  }
+
+  return true;
+};
+
+/**
+ * Build the trigram filter of the chunk.
+ *
+ * Rows that overflow are joined to the next one, so that the filter also
+ * covers text wrapping between them.
+ */
+hterm.Scrollback.Chunk.prototype.buildIndex_ = function() {
+  var lines = new Array(this.rowCount);
+  for (var i = 0; i < this.rowCount; i++) {
+    lines[i] = this.getRowText(i) + (this.overflow[i] ? '' : '\n');
+  }
+
+  var hashes = hterm.Scrollback.getTrigramHashes(lines.join(''));
+  this.index = new Uint32Array(hterm.Scrollback.INDEX_BITS / 32);
+  for (var i = 0; i < hashes.length; i++) {
+    this.index[hashes[i] >>> 5] |= 1 << (hashes[i] & 31);
+  }
+};
+
+/**
+ * Pack the rows of a full chunk into a single string, trim its runs and
+ * build its trigram filter.
+ */
+hterm.Scrollback.Chunk.prototype.seal = function() {
+  if (this.sealed)
+    return;
+
+  this.textParts = [this.textParts.join('')];
+  this.sealed = true;
+
+  var runs = this.runs.subarray(0, this.runCount * 2);
+  this.byteCount -= this.runs.byteLength - runs.byteLength;
+  this.runs = new Uint32Array(runs);
+
+  this.buildIndex_();
+  this.byteCount += this.index.byteLength;
+};
+
+/**
+ * Go back to one string per row, so that rows can be removed.
+ */
+hterm.Scrollback.Chunk.prototype.unseal = function() {
+  if (!this.sealed)
+    return;
+
+  var textParts = new Array(this.rowCount);
+  for (var i = 0; i < this.rowCount; i++) {
+    textParts[i] = this.getRowText(i);
+  }
+  this.textParts = textParts;
+  this.sealed = false;
+
+  this.byteCount -= this.index.byteLength;
+  this.index = null;
+};
@@ -0,0 +1,194 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+'use strict';
+
+/**
+ * @fileoverview Unit tests for the hterm.Scrollback class.
+ */
+hterm.Scrollback.Tests = new lib.TestManager.Suite('hterm.Scrollback.Tests');
+
+/**
+ * Create a new hterm.Scrollback object for testing.
+ *
+ * Called before each test case in this suite.
+ */
+hterm.Scrollback.Tests.prototype.preamble = function(result, cx) {
+  this.document = cx.window.document;
+  this.scrollback = new hterm.Scrollback(this.document);
+
+  /**
+   * Create an 'x-row' element holding the given text, with every other
+   * character in a bold span.
+   */
+  this.createRow = function(text, opt_overflow) {
+    var row = this.document.createElement('x-row');
+    var attrs = new hterm.TextAttributes(this.document);
+    for (var i = 0; i < text.length; i++) {
+      attrs.bold = !!(i % 2);
+      row.appendChild(attrs.createContainer(text.substr(i, 1)));
+    }
+    if (opt_overflow)
+      row.setAttribute('line-overflow', true);
+    return row;
+  };
+};
+
+/**
+ * Test that rows come back with the same text, spans and attributes.
+ */
+hterm.Scrollback.Tests.addTest('round-trip', function(result, cx) {
+    var attrs = new hterm.TextAttributes(this.document);
+    var row = this.document.createElement('x-row');
+    row.appendChild(attrs.createContainer('plain '));
+    attrs.foreground = 'rgb(255, 0, 0)';
+    attrs.underline = true;
+    row.appendChild(attrs.createContainer('red'));
+    attrs.reset();
+    attrs.wcNode = true;
+    attrs.blink = true;
+    row.appendChild(attrs.createContainer('\u4e2d'));
+    row.setAttribute('line-overflow', true);
+
+    var html = row.innerHTML;
+    this.scrollback.appendRows([row, this.document.createElement('x-row')]);
+    result.assertEQ(this.scrollback.length, 2);
+
+    var node = this.scrollback.getRowNode(0);
+    result.assertEQ(node.nodeName, 'X-ROW');
+    result.assertEQ(node.rowIndex, 0);
+    result.assertEQ(node.innerHTML, html);
+    result.assert(!!node.getAttribute('line-overflow'));
+    result.assert(node.childNodes[1].underline);
+    result.assert(node.childNodes[2].wcNode);
+    result.assert(node.childNodes[2].blinkNode);
+    result.assert(!node.childNodes[2].underline);
+
+    result.assertEQ(this.scrollback.getRowText(0), 'plain red\u4e2d');
+    result.assert(this.scrollback.isRowOverflow(0));
+
+    // Empty rows keep an empty text node, like new terminal rows.
+    node = this.scrollback.getRowNode(1);
+    result.assertEQ(node.childNodes.length, 1);
+    result.assertEQ(node.textContent, '');
+    result.assert(!this.scrollback.isRowOverflow(1));
+
+    result.pass();
+  });
+
+/**
+ * Test adding and removing rows across chunks.
+ */
+hterm.Scrollback.Tests.addTest('append-pop', function(result, cx) {
+    var count = hterm.Scrollback.CHUNK_ROWS * 2 + 10;
+    var rows = [];
+    for (var i = 0; i < count; i++) {
+      rows.push(this.createRow('row ' + i, i % 3 == 0));
+    }
+
+    result.assertEQ(this.scrollback.appendRows(rows), 0);
+    result.assertEQ(this.scrollback.length, count);
+
+    for (var i = 0; i < count; i++) {
+      result.assertEQ(this.scrollback.getRowText(i), 'row ' + i);
+      result.assertEQ(this.scrollback.isRowOverflow(i), i % 3 == 0);
+    }
+    result.assertEQ(this.scrollback.getRowNode(300).innerHTML,
+                    rows[300].innerHTML);
+
+    // Pop back into a sealed chunk, then refill it.
+    var popped = this.scrollback.popRows(20);
+    result.assertEQ(popped.length, 20);
+    result.assertEQ(this.scrollback.length, count - 20);
+    for (var i = 0; i < popped.length; i++) {
+      result.assertEQ(popped[i].rowIndex, count - 20 + i);
+      result.assertEQ(popped[i].innerHTML, rows[count - 20 + i].innerHTML);
+    }
+
+    this.scrollback.appendRows(popped);
+    result.assertEQ(this.scrollback.length, count);
+    for (var i = 0; i < count; i++) {
+      result.assertEQ(this.scrollback.getRowText(i), 'row ' + i);
+    }
+
+    // Popping more than there is returns everything.
+    result.assertEQ(this.scrollback.popRows(count + 1).length, count);
+    result.assertEQ(this.scrollback.length, 0);
+    result.assertEQ(this.scrollback.byteCount, 0);
+
+    result.pass();
+  });
+
+/**
+ * Test that the oldest chunks are dropped past the row and byte limits.
+ */
+hterm.Scrollback.Tests.addTest('limits', function(result, cx) {
+    var chunkRows = hterm.Scrollback.CHUNK_ROWS;
+    var self = this;
+    function append(count) {
+      var rows = [];
+      for (var i = 0; i < count; i++) {
+        rows.push(self.createRow('line ' + i));
+      }
+      return self.scrollback.appendRows(rows);
+    }
+
+    this.scrollback.setLimits(chunkRows * 2, 0);
+    result.assertEQ(append(chunkRows * 2), 0);
+    result.assertEQ(this.scrollback.length, chunkRows * 2);
+
+    // One row past the limit drops the oldest chunk.
+    result.assertEQ(append(1), chunkRows);
+    result.assertEQ(this.scrollback.length, chunkRows + 1);
+    result.assertEQ(this.scrollback.getRowText(0), 'line ' + chunkRows);
+    result.assertEQ(this.scrollback.getRowText(chunkRows), 'line 0');
+
+    // The open chunk is kept whatever the limit.
+    this.scrollback.setLimits(0, 1);
+    result.assertEQ(append(1), chunkRows);
+    result.assertEQ(this.scrollback.length, 2);
+    var byteCount = this.scrollback.byteCount;
+    result.assert(byteCount > 0);
+
+    this.scrollback.setLimits(0, 0);
+    result.assertEQ(append(chunkRows * 4), 0);
+    result.assert(this.scrollback.byteCount > byteCount);
+
+    this.scrollback.clear();
+    result.assertEQ(this.scrollback.length, 0);
+    result.assertEQ(this.scrollback.byteCount, 0);
+
+    result.pass();
+  });
+
+/**
+ * Test that the trigram filter of sealed chunks rules out missing text, and
+ * covers text wrapping between rows.
+ */
+hterm.Scrollback.Tests.addTest('chunk-filter', function(result, cx) {
+    var chunkRows = hterm.Scrollback.CHUNK_ROWS;
+    var rows = [];
+    for (var i = 0; i < chunkRows + 1; i++) {
+      rows.push(this.createRow('row ' + i, i == 10));
+    }
+    rows[11] = this.createRow('Wrapped');
+    this.scrollback.appendRows(rows);
+
+    var hashes = hterm.Scrollback.getTrigramHashes;
+    result.assert(this.scrollback.chunkMayContain(0, hashes('row 12')));
+    result.assert(this.scrollback.chunkMayContain(0, hashes('ROW 1')));
+    result.assert(this.scrollback.chunkMayContain(0, hashes('row 10wrap')));
+    result.assert(!this.scrollback.chunkMayContain(0, hashes('needle')));
+
+    // The open chunk has no filter.
+    result.assert(this.scrollback.chunkMayContain(chunkRows, hashes('needle')));
+
+    // Nor has a chunk reopened to pop rows.
+    var byteCount = this.scrollback.byteCount;
+    this.scrollback.appendRows(this.scrollback.popRows(2).slice(0, 1));
+    result.assert(this.scrollback.chunkMayContain(0, hashes('needle')));
+    result.assert(this.scrollback.byteCount < byteCount);
+
+    result.pass();
+  });
@@ -629,6 +629,28 @@ hterm.ScrollPort.prototype.scheduleInvalidate = function() {
     }, 0);
 };
 
+/**
+ * Run a scheduled invalidate or redraw right away.
+ *
+ * The terminal calls this at the end of an animation frame in which it
+ * changed rows, so that they are drawn before the frame is painted rather
+ * than in a later task.
+ */
+hterm.ScrollPort.prototype.flushRedraw = function() {
+  if (this.timeouts_.redraw) {
+    clearTimeout(this.timeouts_.redraw);
+    delete this.timeouts_.redraw;
+  }
+
+  if (this.timeouts_.invalidate) {
+    clearTimeout(this.timeouts_.invalidate);
+    delete this.timeouts_.invalidate;
+    this.invalidate();
+  } else {
+    this.redraw_();
+  }
+};
+
 /**
  * Set the font size of the ScrollPort.
  */
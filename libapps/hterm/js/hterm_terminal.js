@@ -61,7 +61,7 @@ hterm.Terminal = function(opt_profileId) {
   this.document_ = window.document;
 
   // The rows that have scrolled off screen and are no longer addressable.
-  this.scrollbackRows_ = [];
+  this.scrollbackRows_ = new hterm.Scrollback(this.document_);
 
   // Saved tab stops.
   this.tabStops_ = [];
@@ -122,6 +122,46 @@ hterm.Terminal = function(opt_profileId) {
   // Timeouts we might need to clear.
   this.timeouts_ = {};
 
+  // With batch rendering, output is queued along with its size before
+  // decoding, and handled by renderFrame_() in the next animation frame,
+  // within the frame budget in milliseconds.  Entries are decoded strings,
+  // or batches from the scanner worker.  The first entry may be partly
+  // interpreted.
+  this.batchRendering_ = false;
+  this.frameBudget_ = 10;
+  this.pendingOutput_ = [];
+  this.pendingOutputSizes_ = [];
+  this.pendingOutputOffset_ = 0;
+  this.frameRequest_ = null;
+  this.lastFrameTime_ = null;
+
+  // Sizes of the entries interpretPendingSlice_() has finished, not yet
+  // reported to onOutputRendered().
+  this.pendingOutputDone_ = 0;
+
+  // With worker parsing, output is decoded and cut into operations by an
+  // hterm.VT.Scanner in a Web Worker.  The worker is kept until the output
+  // sent to it has come back, so that output stays in order.
+  this.workerParsing_ = false;
+  this.scanWorker_ = null;
+  this.scanWorkerBacklog_ = 0;
+  this.utf16Decoder_ = null;
+
+  // True while renderFrame_() interprets output, when scrolling, redrawing
+  // and cursor updates wait for the end of the frame.
+  this.inFrame_ = false;
+  this.frameScrollDown_ = false;
+
+  /**
+   * Public, read-only counts of the animation frames that handled output,
+   * of those that used their whole budget, of the frames estimated to have
+   * been dropped while output was pending, and of the characters handled.
+   * Also the number of output entries waiting for a frame, the most there
+   * have been, and the number of output chunks being scanned by the worker.
+   */
+  this.renderStats = {frames: 0, busyFrames: 0, droppedFrames: 0, chars: 0,
+                      queueDepth: 0, maxQueueDepth: 0, workerBacklog: 0};
+
   // The VT escape sequence interpreter.
   this.vt = new hterm.VT(this);
 
@@ -512,6 +552,26 @@ hterm.Terminal.prototype.setProfile = function(profileId, opt_callback) {
       terminal.scrollOnOutput_ = v;
     },
 
+    'batch-rendering': function(v) {
+      terminal.setBatchRendering(v);
+    },
+
+    'render-frame-budget': function(v) {
+      terminal.frameBudget_ = v;
+    },
+
+    'worker-parsing': function(v) {
+      terminal.setWorkerParsing(v);
+    },
+
+    'scrollback-byte-limit': function(v) {
+      terminal.syncScrollbackLimits();
+    },
+
+    'scrollback-limit': function(v) {
+      terminal.syncScrollbackLimits();
+    },
+
     'scrollbar-visible': function(v) {
       terminal.setScrollbarVisible(v);
     },
@@ -818,6 +878,17 @@ hterm.Terminal.prototype.syncMousePasteButton = function() {
   }
 };
 
+/**
+ * Set the size limits of the scrollback from the scrollback-limit and
+ * scrollback-byte-limit prefs.
+ *
+ * The limits apply from the next row scrolled into the scrollback.
+ */
+hterm.Terminal.prototype.syncScrollbackLimits = function() {
+  this.scrollbackRows_.setLimits(this.prefs_.get('scrollback-limit'),
+                                 this.prefs_.get('scrollback-byte-limit'));
+};
+
 /**
  * Enable or disable bold based on the enable-bold pref, autodetecting if
  * necessary.
@@ -1078,7 +1149,7 @@ hterm.Terminal.prototype.realizeHeight_ = function(rowCount) {
     }
 
     var ary = this.screen_.shiftRows(deltaRows);
-    this.scrollbackRows_.push.apply(this.scrollbackRows_, ary);
+    this.appendScrollbackRows_(ary);
 
     // We just removed rows from the top of the screen, we need to update
     // the cursor to match.
@@ -1088,8 +1159,7 @@ hterm.Terminal.prototype.realizeHeight_ = function(rowCount) {
 
     if (deltaRows <= this.scrollbackRows_.length) {
       var scrollbackCount = Math.min(deltaRows, this.scrollbackRows_.length);
-      var rows = this.scrollbackRows_.splice(
-          this.scrollbackRows_.length - scrollbackCount, scrollbackCount);
+      var rows = this.scrollbackRows_.popRows(scrollbackCount);
       this.screen_.unshiftRows(rows);
       deltaRows -= scrollbackCount;
       cursor.row += scrollbackCount;
@@ -1155,7 +1225,7 @@ hterm.Terminal.prototype.scrollLineDown = function() {
  * Clear primary screen, secondary screen, and the scrollback buffer.
  */
 hterm.Terminal.prototype.wipeContents = function() {
-  this.scrollbackRows_.length = 0;
+  this.scrollbackRows_.clear();
   this.scrollPort_.resetCache();
 
   [this.primaryScreen_, this.alternateScreen_].forEach(function(screen) {
@@ -1328,8 +1398,323 @@ hterm.Terminal.prototype.setDefaultTabStops = function(opt_start) {
  * @param {string} str Sequence of characters to interpret or pass through.
  */
 hterm.Terminal.prototype.interpret = function(str) {
-  this.vt.interpret(str);
+  if (this.scanWorker_) {
+    this.postToScanWorker_(str, str.length);
+    return;
+  }
+
+  this.interpretDecoded_(this.vt.decode(str), str.length);
+};
+
+/**
+ * Interpret a sequence of bytes.
+ *
+ * Incomplete escape and UTF-8 sequences are buffered until the next call.
+ *
+ * @param {Uint8Array} bytes The bytes to interpret.
+ */
+hterm.Terminal.prototype.interpretBytes = function(bytes) {
+  if (this.scanWorker_) {
+    // Transfer a copy, the caller may still use the bytes.
+    this.postToScanWorker_(bytes.slice().buffer, bytes.length);
+    return;
+  }
+
+  this.interpretDecoded_(this.vt.decodeBytes(bytes), bytes.length);
+};
+
+/**
+ * Interpret decoded output, or queue it for the next animation frame with
+ * batch rendering.
+ *
+ * @param {string} str The UTF-16 string to interpret.
+ * @param {integer} size The length of the output before decoding, reported
+ *     to onOutputRendered().
+ */
+hterm.Terminal.prototype.interpretDecoded_ = function(str, size) {
+  if (this.batchRendering_) {
+    this.queueOutput_(str, size);
+    return;
+  }
+
+  this.vt.interpretDecoded(str);
+  this.scheduleSyncCursorPosition_();
+  this.onOutputRendered(size);
+};
+
+/**
+ * Queue output for the next animation frame.
+ *
+ * @param {string|Object} entry A decoded string, or a batch from the
+ *     scanner worker.
+ * @param {integer} size The length of the output before decoding.
+ */
+hterm.Terminal.prototype.queueOutput_ = function(entry, size) {
+  this.pendingOutput_.push(entry);
+  this.pendingOutputSizes_.push(size);
+
+  var stats = this.renderStats;
+  stats.queueDepth = this.pendingOutput_.length;
+  stats.maxQueueDepth = Math.max(stats.maxQueueDepth, stats.queueDepth);
+
+  this.scheduleFrame_();
+};
+
+/**
+ * Interpret up to OUTPUT_SLICE characters of the first queued entry.
+ *
+ * The size of the entry is added to pendingOutputDone_ once it is finished.
+ *
+ * @return {integer} The number of characters interpreted.
+ */
+hterm.Terminal.prototype.interpretPendingSlice_ = function() {
+  var entry = this.pendingOutput_[0];
+  var count;
+  var done;
+
+  if (typeof entry == 'string') {
+    var offset = this.pendingOutputOffset_;
+    var end = Math.min(offset + hterm.Terminal.OUTPUT_SLICE, entry.length);
+    this.vt.interpretDecoded(offset || end < entry.length ?
+                             entry.substring(offset, end) : entry);
+    count = end - offset;
+    done = end == entry.length;
+    this.pendingOutputOffset_ = done ? 0 : end;
+  } else {
+    count = this.applyScanBatch_(entry, hterm.Terminal.OUTPUT_SLICE);
+    done = entry.opIndex == entry.ops.length;
+  }
+
+  if (done) {
+    this.pendingOutput_.shift();
+    this.pendingOutputDone_ += this.pendingOutputSizes_.shift();
+    this.renderStats.queueDepth = this.pendingOutput_.length;
+  }
+
+  return count;
+};
+
+/**
+ * Turn parsing output in a Web Worker on or off.
+ *
+ * Does nothing where workers or TextDecoder are not available.
+ *
+ * @param {boolean} state True to decode and scan output in a worker.
+ */
+hterm.Terminal.prototype.setWorkerParsing = function(state) {
+  this.workerParsing_ = !!state && !!(window.Worker && window.TextDecoder);
+  if (!this.workerParsing_) {
+    if (this.scanWorker_ && !this.scanWorkerBacklog_) {
+      this.scanWorker_.terminate();
+      this.scanWorker_ = null;
+    }
+    return;
+  }
+
+  if (!this.scanWorker_) {
+    this.scanWorker_ = hterm.VT.Scanner.createWorker();
+    this.scanWorker_.onmessage = this.onScanBatch_.bind(this);
+    this.utf16Decoder_ = new TextDecoder('utf-16le');
+  }
+};
+
+/**
+ * Send output to the scanner worker.
+ *
+ * @param {ArrayBuffer|string} input The bytes, transferred, or a string with
+ *     one byte per character.
+ * @param {integer} size The length of the output.
+ */
+hterm.Terminal.prototype.postToScanWorker_ = function(input, size) {
+  var message = {input: input, encoding: this.vt.characterEncoding,
+                 size: size};
+  this.scanWorker_.postMessage(
+      message, typeof input == 'string' ? [] : [input]);
+  this.renderStats.workerBacklog = ++this.scanWorkerBacklog_;
+};
+
+/**
+ * Handle a batch of operations from the scanner worker.
+ *
+ * @param {MessageEvent} e The message, holding the batch.
+ */
+hterm.Terminal.prototype.onScanBatch_ = function(e) {
+  this.renderStats.workerBacklog = --this.scanWorkerBacklog_;
+
+  var batch = {
+    ops: new Uint32Array(e.data.ops),
+    text: this.utf16Decoder_.decode(new Uint16Array(e.data.text)),
+    opIndex: 0,
+    offset: 0
+  };
+
+  if (this.batchRendering_) {
+    this.queueOutput_(batch, e.data.size);
+  } else {
+    this.applyScanBatch_(batch, Infinity);
+    this.scheduleSyncCursorPosition_();
+    this.onOutputRendered(e.data.size);
+  }
+
+  // Worker parsing was turned off while output was in the worker.
+  if (!this.workerParsing_ && !this.scanWorkerBacklog_)
+    this.setWorkerParsing(false);
+};
+
+/**
+ * Apply the operations of a scanner batch, from where the last call left.
+ *
+ * @param {Object} batch The batch.
+ * @param {number} limit Stop once this many characters have been handled.
+ * @return {integer} The number of characters handled.
+ */
+hterm.Terminal.prototype.applyScanBatch_ = function(batch, limit) {
+  var count = 0;
+
+  while (batch.opIndex < batch.ops.length && count < limit) {
+    var op = batch.ops[batch.opIndex++];
+    var length = op >>> 1;
+    var str = batch.text.substr(batch.offset, length);
+    batch.offset += length;
+    count += length;
+
+    if (op & 1) {
+      this.vt.interpretDecoded(str);
+    } else {
+      this.vt.interpretText(str);
+    }
+  }
+
+  return count;
+};
+
+/**
+ * Called when output passed to interpret() or interpretBytes() has been
+ * handled.
+ *
+ * With batch rendering, output is handled in a later animation frame.
+ * Clients may override this to pace the output they send, for example by
+ * acknowledging it to the host.
+ *
+ * @param {integer} count The number of characters or bytes handled.
+ */
+hterm.Terminal.prototype.onOutputRendered = function(count) {};
+
+/**
+ * Turn batch rendering on or off.
+ *
+ * Output queued when it is turned off is interpreted right away.
+ *
+ * @param {boolean} state True to interpret and draw output once per animation
+ *     frame.
+ */
+hterm.Terminal.prototype.setBatchRendering = function(state) {
+  this.batchRendering_ = !!state;
+  if (this.batchRendering_ || !this.pendingOutput_.length)
+    return;
+
+  // A requested frame will find nothing left to do.
+  while (this.pendingOutput_.length) {
+    this.interpretPendingSlice_();
+  }
+
+  var size = this.pendingOutputDone_;
+  this.pendingOutputDone_ = 0;
   this.scheduleSyncCursorPosition_();
+  this.onOutputRendered(size);
+};
+
+/**
+ * Maximum number of characters interpreted at once by renderFrame_(), so
+ * that it can check its budget.
+ */
+hterm.Terminal.OUTPUT_SLICE = 4096;
+
+/**
+ * Expected time between animation frames in milliseconds, used to estimate
+ * dropped frames.
+ */
+hterm.Terminal.FRAME_INTERVAL = 1000 / 60;
+
+/**
+ * Request an animation frame to handle queued output.
+ *
+ * Hidden documents get no animation frames, so a timeout is used instead.
+ */
+hterm.Terminal.prototype.scheduleFrame_ = function() {
+  if (this.frameRequest_ != null)
+    return;
+
+  if (this.document_.hidden) {
+    this.frameRequest_ = setTimeout(this.renderFrame_.bind(this), 0);
+  } else {
+    this.frameRequest_ = requestAnimationFrame(this.renderFrame_.bind(this));
+  }
+};
+
+/**
+ * Interpret queued output and bring the DOM up to date, once per animation
+ * frame.
+ *
+ * Output is interpreted until the frame budget is spent, and the rest waits
+ * for the next frame.  Rows only scrolled through within a frame are never
+ * drawn, and the scroll port is redrawn and the cursor moved once at the end.
+ *
+ * @param {number} opt_timestamp The time of the frame, if called for an
+ *     animation frame.
+ */
+hterm.Terminal.prototype.renderFrame_ = function(opt_timestamp) {
+  this.frameRequest_ = null;
+  if (!this.pendingOutput_.length)
+    return;
+
+  // Nothing is painted while hidden, so don't hold output back.
+  var budget = this.document_.hidden ? Infinity : this.frameBudget_;
+  var start = performance.now();
+  var chars = 0;
+
+  this.inFrame_ = true;
+  try {
+    while (this.pendingOutput_.length) {
+      chars += this.interpretPendingSlice_();
+
+      if (performance.now() - start >= budget)
+        break;
+    }
+  } finally {
+    this.inFrame_ = false;
+  }
+
+  var size = this.pendingOutputDone_;
+  this.pendingOutputDone_ = 0;
+
+  if (this.frameScrollDown_) {
+    this.frameScrollDown_ = false;
+    this.scrollPort_.scrollRowToBottom(this.getRowCount());
+  }
+  this.scrollPort_.flushRedraw();
+  this.syncCursorPosition_();
+
+  var stats = this.renderStats;
+  stats.frames++;
+  stats.chars += chars;
+  if (this.pendingOutput_.length) {
+    stats.busyFrames++;
+    this.scheduleFrame_();
+  }
+
+  // Frames missed since the previous one, if output was waiting for them.
+  if (opt_timestamp && this.lastFrameTime_ != null) {
+    var missed = Math.round((opt_timestamp - this.lastFrameTime_) /
+                            hterm.Terminal.FRAME_INTERVAL) - 1;
+    if (missed > 0)
+      stats.droppedFrames += missed;
+  }
+  this.lastFrameTime_ = this.pendingOutput_.length && opt_timestamp ?
+      opt_timestamp : null;
+
+  if (size)
+    this.onOutputRendered(size);
 };
 
 /**
@@ -1358,6 +1743,7 @@ hterm.Terminal.prototype.decorate = function(div) {
       this.prefs_.get('scroll-wheel-move-multiplier'));
 
   this.document_ = this.scrollPort_.getDocument();
+  this.scrollbackRows_.setDocument(this.document_);
 
   this.document_.body.oncontextmenu = function() { return false; };
 
@@ -1487,8 +1873,8 @@ hterm.Terminal.prototype.focus = function() {
  * This is a method from the RowProvider interface.  The ScrollPort uses
  * it to fetch rows on demand as they are scrolled into view.
  *
- * TODO(rginda): Consider saving scrollback rows as (HTML source, text content)
- * pairs to conserve memory.
+ * Scrollback rows are packed, so a new node is returned for them on each
+ * call.
  *
  * @param {integer} index The zero-based row index, measured relative to the
  *     start of the scrollback buffer.  On-screen rows will always have the
@@ -1497,7 +1883,7 @@ hterm.Terminal.prototype.focus = function() {
  */
 hterm.Terminal.prototype.getRowNode = function(index) {
   if (index < this.scrollbackRows_.length)
-    return this.scrollbackRows_[index];
+    return this.scrollbackRows_.getRowNode(index);
 
   var screenIndex = index - this.scrollbackRows_.length;
   return this.screen_.rowsArray[screenIndex];
@@ -1521,9 +1907,16 @@ hterm.Terminal.prototype.getRowNode = function(index) {
 hterm.Terminal.prototype.getRowsText = function(start, end) {
   var ary = [];
   for (var i = start; i < end; i++) {
-    var node = this.getRowNode(i);
-    ary.push(node.textContent);
-    if (i < end - 1 && !node.getAttribute('line-overflow'))
+    var overflow;
+    if (i < this.scrollbackRows_.length) {
+      ary.push(this.scrollbackRows_.getRowText(i));
+      overflow = this.scrollbackRows_.isRowOverflow(i);
+    } else {
+      var node = this.getRowNode(i);
+      ary.push(node.textContent);
+      overflow = node.getAttribute('line-overflow');
+    }
+    if (i < end - 1 && !overflow)
       ary.push('\n');
   }
 
@@ -1543,10 +1936,25 @@ hterm.Terminal.prototype.getRowsText = function(start, end) {
  * @return {string} A string containing the text value of the selected row.
  */
 hterm.Terminal.prototype.getRowText = function(index) {
+  if (index < this.scrollbackRows_.length)
+    return this.scrollbackRows_.getRowText(index);
+
   var node = this.getRowNode(index);
   return node.textContent;
 };
 
+/**
+ * Start searching for a string in the scrollback and on the screen.
+ *
+ * @param {string} query The string to look for.
+ * @param {boolean} opt_caseSensitive Whether the case of letters must match.
+ * @return {hterm.Terminal.Search} The search, running in timeouts.  Override
+ *     its onMatch() and onDone() methods to get the results.
+ */
+hterm.Terminal.prototype.find = function(query, opt_caseSensitive) {
+  return new hterm.Terminal.Search(this, query, opt_caseSensitive);
+};
+
 /**
  * Return the total number of rows in the addressable screen and in the
  * scrollback buffer of this terminal.
@@ -1590,7 +1998,7 @@ hterm.Terminal.prototype.appendRows_ = function(count) {
   var extraRows = this.screen_.rowsArray.length - this.screenSize.height;
   if (extraRows > 0) {
     var ary = this.screen_.shiftRows(extraRows);
-    Array.prototype.push.apply(this.scrollbackRows_, ary);
+    this.appendScrollbackRows_(ary);
     if (this.scrollPort_.isScrolledEnd)
       this.scheduleScrollDown_();
   }
@@ -1601,6 +2009,36 @@ hterm.Terminal.prototype.appendRows_ = function(count) {
   this.setAbsoluteCursorPosition(cursorRow, 0);
 };
 
+/**
+ * Move rows that scrolled off the top of the screen into the scrollback.
+ *
+ * When the scrollback drops its oldest rows to stay within its limits, every
+ * remaining row moves up by that many rows, so the screen rows are renumbered
+ * and a user scrolled back keeps looking at the same text.
+ *
+ * @param {Array.<HTMLElement>} rows The rows removed from the screen.
+ */
+hterm.Terminal.prototype.appendScrollbackRows_ = function(rows) {
+  var scrollbackLength = this.scrollbackRows_.length;
+  var evicted = this.scrollbackRows_.appendRows(rows);
+  if (!evicted)
+    return;
+
+  // The selection can't follow rows that are only drawn from the scrollback.
+  var selection = this.scrollPort_.selection;
+  if (selection.startRow && selection.startRow.rowIndex < scrollbackLength)
+    this.document_.getSelection().removeAllRanges();
+
+  this.renumberRows_(0, this.screen_.rowsArray.length);
+  this.scrollPort_.resetCache();
+  this.scrollPort_.scheduleInvalidate();
+
+  if (!this.scrollPort_.isScrolledEnd) {
+    this.scrollPort_.scrollRowToTop(
+        Math.max(this.scrollPort_.getTopRowIndex() - evicted, 0));
+  }
+};
+
 /**
  * Relocate rows from one part of the addressable screen to another.
  *
@@ -1653,6 +2091,12 @@ hterm.Terminal.prototype.renumberRows_ = function(start, end, opt_screen) {
   }
 };
 
+/**
+ * Matches the characters that are not printable ASCII, for which print() has
+ * to look up the column width.
+ */
+hterm.Terminal.notNarrowPattern_ = /[^\x20-\x7e]/;
+
 /**
  * Print a string to the terminal.
  *
@@ -1668,7 +2112,10 @@ hterm.Terminal.prototype.renumberRows_ = function(start, end, opt_screen) {
 hterm.Terminal.prototype.print = function(str) {
   var startOffset = 0;
 
-  var strWidth = lib.wc.strWidth(str);
+  // Printable ASCII takes one column per character and never needs a wide
+  // character node, so it skips the width lookups.
+  var isNarrow = !hterm.Terminal.notNarrowPattern_.test(str);
+  var strWidth = isNarrow ? str.length : lib.wc.strWidth(str);
 
   while (startOffset < strWidth) {
     if (this.options_.wraparound && this.screen_.cursorPosition.overflow) {
@@ -1685,6 +2132,25 @@ hterm.Terminal.prototype.print = function(str) {
       count = this.screenSize.width - this.screen_.cursorPosition.column;
     }
 
+    if (isNarrow) {
+      if (didOverflow && !this.options_.wraparound) {
+        substr = str.substr(startOffset, count - 1) + str.substr(strWidth - 1);
+        count = strWidth;
+      } else {
+        substr = str.substr(startOffset, count);
+      }
+
+      if (this.options_.insertMode) {
+        this.screen_.insertString(substr, substr.length);
+      } else {
+        this.screen_.overwriteString(substr, substr.length);
+      }
+
+      this.screen_.maybeClipCurrentRow();
+      startOffset += count;
+      continue;
+    }
+
     if (didOverflow && !this.options_.wraparound) {
       // If the string overflowed the line but wraparound is off, then the
       // last printed character should be the last of the string.
@@ -1715,8 +2181,13 @@ hterm.Terminal.prototype.print = function(str) {
 
   this.scheduleSyncCursorPosition_();
 
-  if (this.scrollOnOutput_)
-    this.scrollPort_.scrollRowToBottom(this.getRowCount());
+  if (this.scrollOnOutput_) {
+    if (this.inFrame_) {
+      this.frameScrollDown_ = true;
+    } else {
+      this.scrollPort_.scrollRowToBottom(this.getRowCount());
+    }
+  }
 };
 
 /**
@@ -2246,7 +2717,8 @@ hterm.Terminal.prototype.getCursorRow = function() {
  * Multiple calls will be coalesced into a single redraw.
  */
 hterm.Terminal.prototype.scheduleRedraw_ = function() {
-  if (this.timeouts_.redraw)
+  // The frame being rendered redraws when it ends.
+  if (this.timeouts_.redraw || this.inFrame_)
     return;
 
   var self = this;
@@ -2266,6 +2738,11 @@ hterm.Terminal.prototype.scheduleRedraw_ = function() {
  * do with the VT scroll commands.
  */
 hterm.Terminal.prototype.scheduleScrollDown_ = function() {
+  if (this.inFrame_) {
+    this.frameScrollDown_ = true;
+    return;
+  }
+
   if (this.timeouts_.scrollDown)
     return;
 
@@ -2681,7 +3158,7 @@ hterm.Terminal.prototype.restyleCursor_ = function() {
  * Multiple calls will be coalesced into a single sync.
  */
 hterm.Terminal.prototype.scheduleSyncCursorPosition_ = function() {
-  if (this.timeouts_.syncCursor)
+  if (this.timeouts_.syncCursor || this.inFrame_)
     return;
 
   var self = this;
@@ -2942,6 +3419,8 @@ hterm.Terminal.prototype.onVTKeystroke = function(string) {
   if (this.scrollOnKeystroke_)
     this.scrollPort_.scrollRowToBottom(this.getRowCount());
 
+  this.io.keystrokeTime = this.keyboard.keyEventTime;
+  this.keyboard.keyEventTime = null;
   this.io.onVTKeystroke(this.keyboard.encode(string));
 };
 
@@ -32,6 +32,13 @@ hterm.Terminal.IO = function(terminal) {
 
   // The IO object to restore on IO.pop().
   this.previousIO_ = null;
+
+  /**
+   * Time stamp of the key event behind the current onVTKeystroke() call, on
+   * the performance.now() clock, or null if it did not come from a key
+   * event.  Commands may use it to measure input latency.
+   */
+  this.keystrokeTime = null;
 };
 
 /**
@@ -152,15 +159,25 @@ hterm.Terminal.IO.prototype.onTerminalResize = function(width, height) {
 };
 
 /**
- * Write a UTF-8 encoded byte string to the terminal.
+ * Write UTF-8 encoded output to the terminal.
  *
- * @param {string} string The UTF-8 encoded string to print.
+ * Bytes are decoded without going through a byte string, and UTF-8
+ * sequences may be split between calls.
+ *
+ * @param {string|Uint8Array|ArrayBuffer} string The UTF-8 encoded string or
+ *     bytes to print.
  */
 hterm.Terminal.IO.prototype.writeUTF8 = function(string) {
   if (this.terminal_.io != this)
     throw 'Attempt to print from inactive IO object.';
 
-  this.terminal_.interpret(string);
+  if (typeof string == 'string') {
+    this.terminal_.interpret(string);
+  } else if (string instanceof ArrayBuffer) {
+    this.terminal_.interpretBytes(new Uint8Array(string));
+  } else {
+    this.terminal_.interpretBytes(string);
+  }
 };
 
 /**
@@ -0,0 +1,189 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+'use strict';
+
+lib.rtdep('lib.wc', 'hterm.Scrollback');
+
+/**
+ * A search for a string in the rows of a terminal, scrollback included.
+ *
+ * The search runs in slices of a few milliseconds in timeouts, so it does
+ * not hold up the page however large the scrollback is.  Scrollback text is
+ * read from the packed rows, and the chunks whose trigram filter rules out
+ * the string are skipped, so no DOM is created for them.  Lines wrapped over
+ * several rows are searched as a whole.
+ *
+ * Rows dropped from the scrollback while the search runs are not searched,
+ * and rows added after the search has gone past the end of the terminal are
+ * not either.
+ *
+ * Create searches with hterm.Terminal.prototype.find(), and override the
+ * onMatch() and onDone() methods to get the results.
+ *
+ * @param {hterm.Terminal} terminal The terminal to search.
+ * @param {string} query The string to look for.
+ * @param {boolean} opt_caseSensitive Whether the case of letters must match.
+ */
+hterm.Terminal.Search = function(terminal, query, opt_caseSensitive) {
+  this.terminal_ = terminal;
+  this.caseSensitive_ = !!opt_caseSensitive;
+  this.query_ = this.caseSensitive_ ? query : query.toLowerCase();
+  this.hashes_ = hterm.Scrollback.getTrigramHashes(query);
+
+  // The next row to search, numbered from the first row the scrollback ever
+  // had so that it stays valid as rows are dropped.
+  this.nextRow_ = terminal.scrollbackRows_.droppedCount;
+
+  this.timeout_ = setTimeout(this.run_.bind(this), 0);
+};
+
+/**
+ * Time to spend searching in one timeout, in milliseconds.
+ */
+hterm.Terminal.Search.SLICE_TIME = 8;
+
+/**
+ * Called for each match, in row order.
+ *
+ * Rows are numbered as in hterm.Terminal.prototype.getRowText() at the time
+ * of the call, and columns are in terminal cells.  The end is exclusive, and
+ * is on a later row when the match wraps.
+ *
+ * @param {integer} row The row of the start of the match.
+ * @param {integer} column The column of the start of the match.
+ * @param {integer} endRow The row of the end of the match.
+ * @param {integer} endColumn The column of the end of the match.
+ */
+hterm.Terminal.Search.prototype.onMatch = function(
+    row, column, endRow, endColumn) {};
+
+/**
+ * Called once the whole terminal has been searched.
+ */
+hterm.Terminal.Search.prototype.onDone = function() {};
+
+/**
+ * Stop the search.  Neither onMatch() nor onDone() are called afterwards.
+ */
+hterm.Terminal.Search.prototype.cancel = function() {
+  clearTimeout(this.timeout_);
+  this.timeout_ = null;
+};
+
+/**
+ * Search for a slice of time, and schedule the next slice.
+ */
+hterm.Terminal.Search.prototype.run_ = function() {
+  this.timeout_ = null;
+
+  var scrollback = this.terminal_.scrollbackRows_;
+  var chunkRows = hterm.Scrollback.CHUNK_ROWS;
+  var start = performance.now();
+
+  while (performance.now() - start < hterm.Terminal.Search.SLICE_TIME) {
+    // Rows dropped since the last slice are skipped.
+    var index = Math.max(this.nextRow_ - scrollback.droppedCount, 0);
+    var rowCount = this.terminal_.getRowCount();
+
+    if (index >= rowCount || !this.query_) {
+      this.onDone();
+      return;
+    }
+
+    if (index >= scrollback.length) {
+      // The screen, a page of rows at most.
+      while (index < rowCount) {
+        index = this.searchLine_(index);
+      }
+    } else {
+      var chunkEnd = Math.min((Math.floor(index / chunkRows) + 1) * chunkRows,
+                              scrollback.length);
+
+      if (scrollback.chunkMayContain(index, this.hashes_)) {
+        while (index < chunkEnd) {
+          index = this.searchLine_(index);
+        }
+      } else {
+        // Only the line wrapping out of the chunk, if any, may match.
+        var lineStart = chunkEnd;
+        while (lineStart > index &&
+               this.isRowOverflow_(lineStart - 1)) {
+          lineStart--;
+        }
+        index = lineStart < chunkEnd ? this.searchLine_(lineStart) : chunkEnd;
+      }
+    }
+
+    this.nextRow_ = index + scrollback.droppedCount;
+  }
+
+  this.timeout_ = setTimeout(this.run_.bind(this), 0);
+};
+
+/**
+ * Tell whether a row continues on the next one.
+ *
+ * @param {integer} index The index of the row.
+ * @return {boolean}
+ */
+hterm.Terminal.Search.prototype.isRowOverflow_ = function(index) {
+  var scrollback = this.terminal_.scrollbackRows_;
+  if (index < scrollback.length)
+    return scrollback.isRowOverflow(index);
+
+  return !!this.terminal_.getRowNode(index).getAttribute('line-overflow');
+};
+
+/**
+ * Search the line starting on a row, and report its matches.
+ *
+ * @param {integer} index The index of the first row of the line.
+ * @return {integer} The index of the row after the line.
+ */
+hterm.Terminal.Search.prototype.searchLine_ = function(index) {
+  var rowCount = this.terminal_.getRowCount();
+  var rows = [];
+  var end = index;
+  do {
+    var rowText = this.terminal_.getRowText(end);
+    rows.push(this.caseSensitive_ ? rowText : rowText.toLowerCase());
+  } while (this.isRowOverflow_(end++) && end < rowCount);
+
+  var text = rows.join('');
+
+  var offset = text.indexOf(this.query_);
+  while (offset != -1) {
+    var matchEnd = offset + this.query_.length;
+    var start = this.locate_(rows, offset, false);
+    var stop = this.locate_(rows, matchEnd, true);
+    this.onMatch(index + start.row, start.column,
+                 index + stop.row, stop.column);
+    offset = text.indexOf(this.query_, matchEnd);
+  }
+
+  return end;
+};
+
+/**
+ * Turn an offset in the text of a line into a row and a column in cells.
+ *
+ * @param {Array.<string>} rows The text of the rows of the line.
+ * @param {integer} offset The offset in the text of the line.
+ * @param {boolean} isEnd Whether the offset is the exclusive end of a
+ *     match, which is kept at the end of a row rather than at the start of
+ *     the next one.
+ * @return {Object} The row, relative to the first row of the line, and the
+ *     column.
+ */
+hterm.Terminal.Search.prototype.locate_ = function(rows, offset, isEnd) {
+  var row = 0;
+  while (row < rows.length - 1 &&
+         (isEnd ? offset > rows[row].length : offset >= rows[row].length)) {
+    offset -= rows[row].length;
+    row++;
+  }
+
+  return {row: row, column: lib.wc.strWidth(rows[row].substr(0, offset))};
+};
@@ -218,3 +218,160 @@ hterm.Terminal.Tests.addTest('desktop-notification-bell-test',
 
     result.pass();
   });
+
+/**
+ * Test that output is held until the next animation frame with batch
+ * rendering, and spread over several frames past the frame budget.
+ */
+/**
+ * Test searching the scrollback and the screen, including lines that wrap.
+ */
+hterm.Terminal.Tests.addTest('find', function(result, cx) {
+    var terminal = this.terminal;
+    var lines = [];
+    for (var i = 0; i < 1000; i++) {
+      lines.push('line ' + i);
+    }
+    lines[300] = 'a Needle in row 300';
+    lines[900] = lib.f.getWhitespace(78) + 'needle';
+    lines[999] = 'needle on the screen';
+    terminal.interpret(lines.join('\r\n'));
+
+    var matches = [];
+    var search = terminal.find('needle');
+    search.onMatch = function(row, column, endRow, endColumn) {
+      matches.push([row, column, endRow, endColumn]);
+    };
+    search.onDone = function() {
+      result.assertEQ(JSON.stringify(matches),
+                      JSON.stringify([[300, 2, 300, 8],
+                                      [900, 78, 901, 4],
+                                      [1000, 0, 1000, 6]]));
+      result.assertEQ(terminal.getRowText(300).substr(2, 6), 'Needle');
+      result.assertEQ(terminal.getRowText(1000), 'needle on the screen');
+
+      matches = [];
+      search = terminal.find('Needle', true);
+      search.onMatch = function(row, column, endRow, endColumn) {
+        matches.push([row, column]);
+      };
+      search.onDone = function() {
+        result.assertEQ(JSON.stringify(matches), JSON.stringify([[300, 2]]));
+        result.pass();
+      };
+    };
+
+    result.requestTime(1000);
+  });
+
+/**
+ * Test that UTF-8 sequences split between byte chunks are decoded.
+ */
+hterm.Terminal.Tests.addTest('interpret-bytes', function(result, cx) {
+    var terminal = this.terminal;
+    var rendered = 0;
+    terminal.onOutputRendered = function(count) { rendered += count; };
+
+    // U+4E2D is E4 B8 AD and U+00E9 is C3 A9 in UTF-8.
+    terminal.interpretBytes(new Uint8Array([0x61, 0xe4]));
+    terminal.interpretBytes(new Uint8Array([0xb8]));
+    terminal.io.writeUTF8(new Uint8Array([0xad, 0x62, 0xc3]).buffer);
+    terminal.io.writeUTF8(new Uint8Array([0xa9]));
+
+    result.assertEQ(terminal.getRowText(0), 'a\u4e2db\u00e9');
+    result.assertEQ(rendered, 7);
+
+    result.pass();
+  });
+
+hterm.Terminal.Tests.addTest('batch-rendering', function(result, cx) {
+    var terminal = this.terminal;
+    var rendered = [];
+    terminal.onOutputRendered = function(count) {
+      rendered.push(count);
+      if (rendered.length == 1)
+        firstFrame();
+      else if (rendered.length == 2)
+        secondOutput();
+    };
+
+    // With no budget, a slice is interpreted per frame.  Pref changes are
+    // seen in a timeout.
+    terminal.prefs_.set('batch-rendering', true);
+    terminal.prefs_.set('render-frame-budget', 0);
+    setTimeout(function() {
+      terminal.interpret('hello world');
+      result.assertEQ(terminal.getRowText(0), '');
+      result.assertEQ(rendered.length, 0);
+    }, 0);
+
+    var slice = hterm.Terminal.OUTPUT_SLICE;
+
+    function firstFrame() {
+      result.assertEQ(terminal.getRowText(0), 'hello world');
+      result.assertEQ(rendered[0], 11);
+      result.assertEQ(terminal.renderStats.frames, 1);
+      result.assertEQ(terminal.renderStats.busyFrames, 0);
+
+      terminal.interpret('\r\n' + lib.f.getWhitespace(slice * 3));
+      terminal.interpretBytes(new Uint8Array([13, 10, 100, 111, 110, 101]));
+      result.assertEQ(terminal.renderStats.queueDepth, 2);
+      result.assertEQ(terminal.renderStats.maxQueueDepth, 2);
+    }
+
+    // Output is reported once all of it has been interpreted.
+    function secondOutput() {
+      result.assertEQ(rendered[1], slice * 3 + 2);
+      result.assertEQ(terminal.renderStats.busyFrames, 4);
+      result.assertEQ(terminal.renderStats.queueDepth, 1);
+
+      // Turning batch rendering off interprets what is left.
+      terminal.setBatchRendering(false);
+      terminal.prefs_.set('batch-rendering', false);
+      terminal.prefs_.set('render-frame-budget', 10);
+      result.assertEQ(rendered[2], 6);
+      result.assertEQ(terminal.getRowText(terminal.getRowCount() - 1),
+                      'done');
+      result.pass();
+    }
+
+    result.requestTime(1000);
+  });
+
+/**
+ * Test that output scanned in a worker is interpreted in order, with split
+ * sequences and characters.
+ */
+hterm.Terminal.Tests.addTest('worker-parsing', function(result, cx) {
+    var terminal = this.terminal;
+    var rendered = 0;
+    terminal.onOutputRendered = function(count) {
+      rendered += count;
+      if (rendered == 18)
+        check();
+    };
+
+    terminal.setWorkerParsing(true);
+    terminal.interpret('a\x1b[3');
+    terminal.interpretBytes(new Uint8Array([0x31, 0x6d, 0xe4, 0xb8]));
+    terminal.interpret('\xad\x1b[m\r\nnext');
+    result.assertEQ(terminal.getRowText(0), '');
+    result.assertEQ(terminal.renderStats.workerBacklog, 3);
+
+    function check() {
+      result.assertEQ(terminal.getRowText(0), 'a\u4e2d');
+      result.assertEQ(terminal.getRowText(1), 'next');
+      var node = terminal.getRowNode(0).childNodes[1];
+      result.assertEQ(node.textContent, '\u4e2d');
+      result.assert(!!node.style.color);
+      result.assertEQ(terminal.renderStats.workerBacklog, 0);
+
+      terminal.setWorkerParsing(false);
+      result.assertEQ(terminal.scanWorker_, null);
+      terminal.interpret('!');
+      result.assertEQ(terminal.getRowText(1), 'next!');
+      result.pass();
+    }
+
+    result.requestTime(1000);
+  });
@@ -84,6 +84,35 @@ hterm.TextAttributes.prototype.SRC_DEFAULT = 'default';
  */
 hterm.TextAttributes.prototype.SRC_RGB = 'rgb';
 
+/**
+ * The most distinct span styles to intern.
+ *
+ * Past this, new styles (typically from true color output) are applied to
+ * spans one property at a time, and compared the same way.
+ */
+hterm.TextAttributes.MAX_STYLES = 4096;
+
+/**
+ * The interned span styles, indexed by style id.  Id 0 is unused, so that
+ * spans can be tested for a style id with a plain truth test.
+ *
+ * Each entry holds a template span for the style, in the document it was
+ * last used in, and the flags to set as expando properties on its spans.
+ */
+hterm.TextAttributes.styles_ = [null];
+
+/**
+ * Map from style key to style id.
+ */
+hterm.TextAttributes.styleIds_ = {};
+
+/**
+ * Names of the expando properties set on spans, in the order of the bits of
+ * the style flags.
+ */
+hterm.TextAttributes.spanFlags = ['faint', 'blinkNode', 'underline',
+                                  'strikethrough', 'wcNode', 'tileNode'];
+
 /**
  * The document object which should own the DOM nodes created by this instance.
  *
@@ -178,6 +207,24 @@ hterm.TextAttributes.prototype.createContainer = function(opt_textContent) {
   if (this.isDefault())
     return this.document_.createTextNode(opt_textContent);
 
+  var styleId = this.getStyleId();
+  var span = styleId ?
+      hterm.TextAttributes.createStyledSpan(this.document_, styleId) :
+      this.createSpan_();
+
+  if (opt_textContent)
+    span.textContent = opt_textContent;
+
+  return span;
+};
+
+/**
+ * Create a span styled to match the current set of attributes, one property
+ * at a time.
+ *
+ * @return {HTMLSpanElement} The new span, without a style id.
+ */
+hterm.TextAttributes.prototype.createSpan_ = function() {
   var span = this.document_.createElement('span');
   var style = span.style;
   var classes = [];
@@ -226,15 +273,57 @@ hterm.TextAttributes.prototype.createContainer = function(opt_textContent) {
     span.tileNode = true;
   }
 
-  if (opt_textContent)
-    span.textContent = opt_textContent;
-
   if (classes.length)
     span.className = classes.join(' ');
 
   return span;
 };
 
+/**
+ * Return the key of the current set of attributes in the style table.
+ *
+ * @return {string}
+ */
+hterm.TextAttributes.prototype.getStyleKey_ = function() {
+  var bold = this.enableBold && this.bold;
+  return this.foreground + ';' + this.background + ';' + this.tileData +
+      ';' + (bold ? 1 : 0) + (this.italic ? 1 : 0) + (this.faint ? 1 : 0) +
+      (this.blink ? 1 : 0) + (this.underline ? 1 : 0) +
+      (this.strikethrough ? 1 : 0) + (this.wcNode ? 1 : 0);
+};
+
+/**
+ * Return the interned style id of the span for the current set of
+ * attributes, interning it if it is new.
+ *
+ * Spans with the same style id look the same, so text can move between them.
+ *
+ * @return {integer} The style id, or 0 if there are already too many styles
+ *     to intern a new one.
+ */
+hterm.TextAttributes.prototype.getStyleId = function() {
+  var key = this.getStyleKey_();
+  var styleId = hterm.TextAttributes.styleIds_[key];
+  if (styleId !== undefined)
+    return styleId;
+
+  var styles = hterm.TextAttributes.styles_;
+  if (styles.length > hterm.TextAttributes.MAX_STYLES)
+    return 0;
+
+  var span = this.createSpan_();
+  var flags = 0;
+  for (var i = 0; i < hterm.TextAttributes.spanFlags.length; i++) {
+    if (span[hterm.TextAttributes.spanFlags[i]])
+      flags |= 1 << i;
+  }
+
+  styleId = styles.length;
+  styles.push({template: span, flags: flags});
+  hterm.TextAttributes.styleIds_[key] = styleId;
+  return styleId;
+};
+
 /**
  * Tests if the provided object (string, span or text node) has the same
  * style as this TextAttributes instance.
@@ -252,16 +341,22 @@ hterm.TextAttributes.prototype.matchesContainer = function(obj) {
   if (typeof obj == 'string' || obj.nodeType == 3)
     return this.isDefault();
 
-  var style = obj.style;
-
   // We don't want to put multiple characters in a wcNode or a tile.
   // See the comments in createContainer.
-  return (!(this.wcNode || obj.wcNode) &&
-          !(this.tileData != null || obj.tileNode) &&
-          this.foreground == style.color &&
+  if (this.wcNode || obj.wcNode || this.tileData != null || obj.tileNode)
+    return false;
+
+  // Look the style up without interning it: a style that isn't in the table
+  // yet can't be the style of an existing span.
+  if (obj.styleId)
+    return obj.styleId == hterm.TextAttributes.styleIds_[this.getStyleKey_()];
+
+  var style = obj.style;
+
+  return (this.foreground == style.color &&
           this.background == style.backgroundColor &&
           (this.enableBold && this.bold) == !!style.fontWeight &&
-          this.blink == obj.blinkNode &&
+          this.blink == !!obj.blinkNode &&
           this.italic == !!style.fontStyle &&
           !!this.underline == !!obj.underline &&
           !!this.strikethrough == !!obj.strikethrough);
@@ -339,6 +434,59 @@ hterm.TextAttributes.prototype.syncColors = function() {
   }
 };
 
+/**
+ * Static method to create a span with an interned style.
+ *
+ * @param {HTMLDocument} document The document to create the span in.
+ * @param {integer} styleId The style id, from getStyleId().
+ * @return {HTMLSpanElement} The new span, with its styleId set.
+ */
+hterm.TextAttributes.createStyledSpan = function(document, styleId) {
+  var style = hterm.TextAttributes.styles_[styleId];
+  if (style.template.ownerDocument != document)
+    style.template = document.importNode(style.template, false);
+
+  var span = style.template.cloneNode(false);
+  span.styleId = styleId;
+  hterm.TextAttributes.setSpanFlags(span, style.flags);
+  return span;
+};
+
+/**
+ * Static method to copy a span, with its expando properties.
+ *
+ * @param {HTMLNode} node The span or text node to copy, without its content.
+ * @return {HTMLNode} The copy.
+ */
+hterm.TextAttributes.cloneContainer = function(node) {
+  var rv = node.cloneNode(false);
+  if (node.nodeType == 3)
+    return rv;
+
+  rv.styleId = node.styleId;
+  var flags = hterm.TextAttributes.spanFlags;
+  for (var i = 0; i < flags.length; i++) {
+    if (node[flags[i]])
+      rv[flags[i]] = true;
+  }
+
+  return rv;
+};
+
+/**
+ * Static method to set the expando properties of a span.
+ *
+ * @param {HTMLSpanElement} span The span.
+ * @param {integer} flags The properties to set, as bits in the order of
+ *     hterm.TextAttributes.spanFlags.
+ */
+hterm.TextAttributes.setSpanFlags = function(span, flags) {
+  for (var i = 0; flags; i++, flags >>= 1) {
+    if (flags & 1)
+      span[hterm.TextAttributes.spanFlags[i]] = true;
+  }
+};
+
 /**
  * Static method used to test if the provided objects (strings, spans or
  * text nodes) have the same style.
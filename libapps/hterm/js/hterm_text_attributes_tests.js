@@ -56,3 +56,40 @@ hterm.TextAttributes.Tests.addTest('splitWidecharString', function(result, cx) {
 
     result.pass();
 });
+
+hterm.TextAttributes.Tests.addTest('style-ids', function(result, cx) {
+    var document = cx.window.document;
+    var attrs = new hterm.TextAttributes(document);
+    var other = new hterm.TextAttributes(document);
+
+    attrs.foreground = other.foreground = 'rgb(1, 2, 3)';
+    attrs.underline = other.underline = true;
+    var span = attrs.createContainer('a');
+    result.assert(span.styleId > 0, 'The style should be interned');
+    result.assertEQ(other.getStyleId(), span.styleId,
+                    'Equal attributes should share a style id');
+    result.assertEQ(span.style.color, 'rgb(1, 2, 3)');
+    result.assert(span.underline, 'The span should have its flags');
+    result.assert(other.matchesContainer(span));
+
+    other.underline = false;
+    result.assert(other.getStyleId() != span.styleId,
+                  'Different attributes should have different style ids');
+    result.assert(!other.matchesContainer(span));
+
+    var copy = hterm.TextAttributes.cloneContainer(span);
+    result.assertEQ(copy.styleId, span.styleId);
+    result.assert(copy.underline, 'The copy should have the span flags');
+
+    // Past the limit, new styles are not interned but still match.
+    var maxStyles = hterm.TextAttributes.MAX_STYLES;
+    hterm.TextAttributes.MAX_STYLES = 0;
+    attrs.foreground = 'rgb(4, 5, 6)';
+    span = attrs.createContainer('b');
+    hterm.TextAttributes.MAX_STYLES = maxStyles;
+    result.assert(!span.styleId, 'The style should not be interned');
+    result.assertEQ(span.style.color, 'rgb(4, 5, 6)');
+    result.assert(attrs.matchesContainer(span));
+
+    result.pass();
+});
@@ -57,9 +57,18 @@ hterm.VT = function(terminal) {
       }).join('');
   this.cc1Pattern_ = new RegExp('[' + cc1 + ']');
 
+  // The same, used by parseUnknown_ to scan from the parse position without
+  // copying the rest of the buffer.
+  this.cc1ScanPattern_ = new RegExp('[' + cc1 + ']', 'g');
+
   // Decoder to maintain UTF-8 decode state.
   this.utf8Decoder_ = new lib.UTF8Decoder();
 
+  // Decoder to maintain UTF-8 decode state of byte input, where supported.
+  // It keeps byte order marks, like lib.UTF8Decoder.
+  this.textDecoder_ = window.TextDecoder ?
+      new TextDecoder('utf-8', {ignoreBOM: true}) : null;
+
   /**
    * Whether to accept the 8-bit control characters.
    *
@@ -443,7 +452,17 @@ hterm.VT.prototype.onTerminalMouse_ = function(e) {
  * The buffer will be decoded according to the 'receive-encoding' preference.
  */
 hterm.VT.prototype.interpret = function(buf) {
-  this.parseState_.resetBuf(this.decode(buf));
+  this.interpretDecoded(this.decode(buf));
+};
+
+/**
+ * Interpret a string that has already been decoded with decode() or
+ * decodeBytes().
+ *
+ * @param {string} str The UTF-16 string to interpret.
+ */
+hterm.VT.prototype.interpretDecoded = function(str) {
+  this.parseState_.resetBuf(str);
 
   while (!this.parseState_.isComplete()) {
     var func = this.parseState_.func;
@@ -459,6 +478,22 @@ hterm.VT.prototype.interpret = function(buf) {
   }
 };
 
+/**
+ * Interpret decoded text that holds no control characters, such as a print
+ * run from hterm.VT.Scanner.
+ *
+ * The text is printed directly, unless it belongs to a sequence in progress.
+ *
+ * @param {string} str The text to interpret.
+ */
+hterm.VT.prototype.interpretText = function(str) {
+  if (this.parseState_.func == this.parseState_.defaultFunction) {
+    this.print_(str);
+  } else {
+    this.interpretDecoded(str);
+  }
+};
+
 /**
  * Decode a string according to the 'receive-encoding' preference.
  */
@@ -469,6 +504,29 @@ hterm.VT.prototype.decode = function(str) {
   return str;
 };
 
+/**
+ * Decode bytes according to the 'receive-encoding' preference.
+ *
+ * UTF-8 sequences split between two calls are decoded by the second one.
+ *
+ * @param {Uint8Array} bytes The bytes to decode.
+ * @return {string} The decoded UTF-16 string.
+ */
+hterm.VT.prototype.decodeBytes = function(bytes) {
+  if (this.characterEncoding == 'utf-8' && this.textDecoder_)
+    return this.textDecoder_.decode(bytes, {stream: true});
+
+  // Without a TextDecoder, or with raw encoding, each byte is a character.
+  var chunkSize = 8192;
+  var ary = [];
+  for (var i = 0; i < bytes.length; i += chunkSize) {
+    ary.push(String.fromCharCode.apply(
+        null, bytes.subarray(i, i + chunkSize)));
+  }
+
+  return this.decode(ary.join(''));
+};
+
 /**
  * Encode a UTF-16 string as UTF-8.
  *
@@ -493,36 +551,42 @@ hterm.VT.prototype.decodeUTF8 = function(str) {
  * printed to the terminal, then the control character will be dispatched.
  */
 hterm.VT.prototype.parseUnknown_ = function(parseState) {
-  var self = this;
-
-  function print(str) {
-    if (!self.codingSystemUtf8 && self[self.GL].GL)
-      str = self[self.GL].GL(str);
-
-    self.terminal.print(str);
-  };
-
   // Search for the next contiguous block of plain text.
-  var buf = parseState.peekRemainingBuf();
-  var nextControl = buf.search(this.cc1Pattern_);
+  var buf = parseState.buf;
+  var pos = parseState.pos;
+  this.cc1ScanPattern_.lastIndex = pos;
+  var match = this.cc1ScanPattern_.exec(buf);
+  var nextControl = match ? match.index : buf.length;
 
-  if (nextControl == 0) {
+  if (nextControl == pos) {
     // We've stumbled right into a control character.
-    this.dispatch('CC1', buf.substr(0, 1), parseState);
+    this.dispatch('CC1', buf.charAt(pos), parseState);
     parseState.advance(1);
     return;
   }
 
-  if (nextControl == -1) {
+  if (!match) {
     // There are no control characters in this string.
-    print(buf);
+    this.print_(pos ? buf.substr(pos) : buf);
     parseState.reset();
     return;
   }
 
-  print(buf.substr(0, nextControl));
-  this.dispatch('CC1', buf.substr(nextControl, 1), parseState);
-  parseState.advance(nextControl + 1);
+  this.print_(buf.substring(pos, nextControl));
+  this.dispatch('CC1', buf.charAt(nextControl), parseState);
+  parseState.advance(nextControl - pos + 1);
+};
+
+/**
+ * Print plain text through the character map in GL.
+ *
+ * @param {string} str The text, without control characters.
+ */
+hterm.VT.prototype.print_ = function(str) {
+  if (!this.codingSystemUtf8 && this[this.GL].GL)
+    str = this[this.GL].GL(str);
+
+  this.terminal.print(str);
 };
 
 /**
@@ -0,0 +1,252 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+'use strict';
+
+/**
+ * @fileoverview Splitting of terminal output into print runs and control
+ * sequences, away from the page.
+ *
+ * An hterm.VT.Scanner decodes output and cuts it into operations: runs of
+ * text without control characters, and runs of control characters and
+ * escape sequences.  A batch of operations is two ArrayBuffers, so that it
+ * can be transferred from a Web Worker without copying:
+ *
+ *   - text: the decoded output as UTF-16 code units.
+ *   - ops: one 32-bit word per operation, the length of its text shifted
+ *     left by one, with the low bit set for control sequences.
+ *
+ * The page applies print runs with hterm.VT.prototype.interpretText() and
+ * control sequences with hterm.VT.prototype.interpretDecoded().  The meaning
+ * of control sequences depends on terminal state the worker does not have,
+ * so they are still parsed by hterm.VT, but the page no longer decodes the
+ * output or scans text for control characters.
+ *
+ * The scanner tracks escape sequences only to keep them in one operation.
+ * It treats every C0 and C1 control character as a control sequence, so a
+ * print run never holds text that hterm.VT would not print.  If it gets a
+ * sequence wrong, text is merely sent through the full parser.
+ */
+
+/**
+ * Create a scanner.
+ */
+hterm.VT.Scanner = function() {
+  this.state_ = hterm.VT.Scanner.GROUND;
+
+  // The streaming UTF-8 decoder, and the encoding it was created for.
+  this.decoder_ = null;
+  this.encoding_ = null;
+};
+
+/**
+ * Scanner states: plain text, after ESC, in a CSI sequence, in a string
+ * sequence such as OSC, and after ESC in a string sequence.
+ */
+hterm.VT.Scanner.GROUND = 0;
+hterm.VT.Scanner.ESC = 1;
+hterm.VT.Scanner.CSI = 2;
+hterm.VT.Scanner.STRING = 3;
+hterm.VT.Scanner.STRING_ESC = 4;
+
+/**
+ * Longest operation, in UTF-16 code units, so that the page can check its
+ * frame budget between operations.
+ */
+hterm.VT.Scanner.MAX_RUN = 4096;
+
+/**
+ * Decode output and cut it into operations.
+ *
+ * Sequences and UTF-8 characters split between calls are handled.
+ *
+ * @param {ArrayBuffer|string} input Output bytes, or a string with one byte
+ *     per character.
+ * @param {string} encoding The 'receive-encoding' preference, 'utf-8' or
+ *     'raw'.
+ * @return {Object} The batch, with ops and text ArrayBuffers.
+ */
+hterm.VT.Scanner.prototype.scan = function(input, encoding) {
+  var str = this.decode_(input, encoding);
+  var text = new Uint16Array(str.length);
+  var ops = [];
+  var run = 0;
+  var runControl = false;
+
+  for (var i = 0; i < str.length; i++) {
+    var c = str.charCodeAt(i);
+    text[i] = c;
+
+    var isControl = this.state_ != hterm.VT.Scanner.GROUND ||
+        c < 0x20 || (c >= 0x7f && c <= 0x9f);
+    if (isControl)
+      this.advance_(c);
+
+    if (run && (isControl != runControl || run == hterm.VT.Scanner.MAX_RUN)) {
+      ops.push(run * 2 + (runControl ? 1 : 0));
+      run = 0;
+    }
+    runControl = isControl;
+    run++;
+  }
+
+  if (run)
+    ops.push(run * 2 + (runControl ? 1 : 0));
+
+  return {ops: new Uint32Array(ops).buffer, text: text.buffer};
+};
+
+/**
+ * Decode output according to the encoding.
+ *
+ * @param {ArrayBuffer|string} input Output bytes, or a string with one byte
+ *     per character.
+ * @param {string} encoding 'utf-8' or 'raw'.
+ * @return {string}
+ */
+hterm.VT.Scanner.prototype.decode_ = function(input, encoding) {
+  if (encoding != 'utf-8')
+    return typeof input == 'string' ? input : this.toByteString_(input);
+
+  if (!this.decoder_ || this.encoding_ != encoding) {
+    this.decoder_ = new TextDecoder('utf-8', {ignoreBOM: true});
+    this.encoding_ = encoding;
+  }
+
+  var bytes;
+  if (typeof input == 'string') {
+    bytes = new Uint8Array(input.length);
+    for (var i = 0; i < input.length; i++) {
+      bytes[i] = input.charCodeAt(i);
+    }
+  } else {
+    bytes = new Uint8Array(input);
+  }
+
+  return this.decoder_.decode(bytes, {stream: true});
+};
+
+/**
+ * Turn bytes into a string with one character per byte.
+ *
+ * @param {ArrayBuffer} input The bytes.
+ * @return {string}
+ */
+hterm.VT.Scanner.prototype.toByteString_ = function(input) {
+  var bytes = new Uint8Array(input);
+  var ary = [];
+  for (var i = 0; i < bytes.length; i += 8192) {
+    ary.push(String.fromCharCode.apply(null, bytes.subarray(i, i + 8192)));
+  }
+  return ary.join('');
+};
+
+/**
+ * Follow a character of a control sequence.
+ *
+ * @param {integer} c The character code.
+ */
+hterm.VT.Scanner.prototype.advance_ = function(c) {
+  var Scanner = hterm.VT.Scanner;
+
+  switch (this.state_) {
+    case Scanner.GROUND:
+      if (c == 0x1b) {
+        this.state_ = Scanner.ESC;
+      } else if (c == 0x9b) {
+        this.state_ = Scanner.CSI;
+      } else if (c == 0x90 || c == 0x98 || c == 0x9d || c == 0x9e ||
+                 c == 0x9f) {
+        // DCS, SOS, OSC, PM and APC.
+        this.state_ = Scanner.STRING;
+      }
+      break;
+
+    case Scanner.ESC:
+      if (c == 0x5b) {
+        // '['
+        this.state_ = Scanner.CSI;
+      } else if (c == 0x5d || c == 0x50 || c == 0x5f || c == 0x5e ||
+                 c == 0x58) {
+        // ']', 'P', '_', '^' and 'X'.
+        this.state_ = Scanner.STRING;
+      } else if (c != 0x1b && (c < 0x20 || c > 0x2f)) {
+        // Anything but an intermediate character ends the sequence.
+        this.state_ = Scanner.GROUND;
+      }
+      break;
+
+    case Scanner.CSI:
+      if (c == 0x1b) {
+        this.state_ = Scanner.ESC;
+      } else if (c >= 0x40 && c <= 0x7e) {
+        this.state_ = Scanner.GROUND;
+      }
+      break;
+
+    case Scanner.STRING:
+      if (c == 0x07 || c == 0x9c) {
+        this.state_ = Scanner.GROUND;
+      } else if (c == 0x1b) {
+        this.state_ = Scanner.STRING_ESC;
+      }
+      break;
+
+    case Scanner.STRING_ESC:
+      this.state_ = c == 0x5c ? Scanner.GROUND : Scanner.STRING;
+      break;
+  }
+};
+
+/**
+ * The code run in the worker: scan each message and send the batch back,
+ * along with the size of the input.
+ */
+hterm.VT.Scanner.workerMain_ = function() {
+  var scanner = new hterm.VT.Scanner();
+
+  self.onmessage = function(e) {
+    var batch = scanner.scan(e.data.input, e.data.encoding);
+    batch.size = e.data.size;
+    self.postMessage(batch, [batch.ops, batch.text]);
+  };
+};
+
+/**
+ * Start a Web Worker running a scanner.
+ *
+ * The worker is built from the source of this class, so that it needs no
+ * script file of its own.  Post it {input, encoding, size} messages, with
+ * input an ArrayBuffer (transferred) or a string with one byte per
+ * character, and it replies with {ops, text, size} batches in the same
+ * order.
+ *
+ * @return {Worker}
+ */
+hterm.VT.Scanner.createWorker = function() {
+  var Scanner = hterm.VT.Scanner;
+  var source = ['\'use strict\';',
+                'var hterm = {VT: {}};',
+                'hterm.VT.Scanner = ' + Scanner + ';'];
+
+  for (var key in Scanner) {
+    var value = Scanner[key];
+    source.push('hterm.VT.Scanner.' + key + ' = ' +
+                (typeof value == 'function' ? value : JSON.stringify(value)) +
+                ';');
+  }
+
+  for (var key in Scanner.prototype) {
+    source.push('hterm.VT.Scanner.prototype.' + key + ' = ' +
+                Scanner.prototype[key] + ';');
+  }
+
+  source.push('hterm.VT.Scanner.workerMain_();');
+
+  var url = URL.createObjectURL(
+      new Blob([source.join('\n')], {type: 'text/javascript'}));
+  var worker = new Worker(url);
+  URL.revokeObjectURL(url);
+  return worker;
+};
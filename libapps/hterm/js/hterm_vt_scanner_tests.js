@@ -0,0 +1,91 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+'use strict';
+
+lib.rtdep('lib.f');
+
+/**
+ * @fileoverview Unit tests for hterm.VT.Scanner.
+ */
+hterm.VT.Scanner.Tests = new lib.TestManager.Suite('hterm.VT.Scanner.Tests');
+
+/**
+ * Create a scanner, and a helper turning its batches into readable arrays.
+ *
+ * Called before each test case in this suite.
+ */
+hterm.VT.Scanner.Tests.prototype.preamble = function(result, cx) {
+  var scanner = this.scanner = new hterm.VT.Scanner();
+
+  /**
+   * Scan some input, and return the operations as an array of strings, with
+   * control sequences in brackets.
+   */
+  this.scan = function(input, opt_encoding) {
+    var batch = scanner.scan(input, opt_encoding || 'utf-8');
+    var ops = new Uint32Array(batch.ops);
+    var text = new Uint16Array(batch.text);
+    var rv = [];
+    var offset = 0;
+    for (var i = 0; i < ops.length; i++) {
+      var length = ops[i] >>> 1;
+      var str = String.fromCharCode.apply(
+          null, text.subarray(offset, offset + length));
+      rv.push(ops[i] & 1 ? '[' + str + ']' : str);
+      offset += length;
+    }
+    result.assertEQ(offset, text.length);
+    return rv;
+  };
+};
+
+/**
+ * Test that text and control sequences land in separate operations.
+ */
+hterm.VT.Scanner.Tests.addTest('split', function(result, cx) {
+    result.assertEQ(this.scan('hello'), ['hello']);
+    result.assertEQ(this.scan('a\r\nb'), ['a', '[\r\n]', 'b']);
+    result.assertEQ(this.scan('\x1b[1;31mred\x1b[m.'),
+                    ['[\x1b[1;31m]', 'red', '[\x1b[m]', '.']);
+    result.assertEQ(this.scan('\x1b]0;title\x07x\x1b]2;t\x1b\\y'),
+                    ['[\x1b]0;title\x07]', 'x', '[\x1b]2;t\x1b\\]', 'y']);
+    result.assertEQ(this.scan('\x1b(0q\x1b(B'), ['[\x1b(0]', 'q', '[\x1b(B]']);
+    result.assertEQ(this.scan(''), []);
+
+    result.pass();
+  });
+
+/**
+ * Test that sequences and characters split between calls are kept whole.
+ */
+hterm.VT.Scanner.Tests.addTest('split-between-calls', function(result, cx) {
+    result.assertEQ(this.scan('a\x1b[3'), ['a', '[\x1b[3]']);
+    result.assertEQ(this.scan('1mb\x1b]0;ti'), ['[1m]', 'b', '[\x1b]0;ti]']);
+    result.assertEQ(this.scan('tle\x07c'), ['[tle\x07]', 'c']);
+
+    // U+4E2D is E4 B8 AD in UTF-8, as bytes or as a byte string.
+    result.assertEQ(this.scan(new Uint8Array([0x64, 0xe4, 0xb8]).buffer),
+                    ['d']);
+    result.assertEQ(this.scan('\xad!'), ['\u4e2d!']);
+
+    result.pass();
+  });
+
+/**
+ * Test the raw encoding, and that runs are cut at MAX_RUN.
+ */
+hterm.VT.Scanner.Tests.addTest('raw-and-max-run', function(result, cx) {
+    result.assertEQ(this.scan('\xe9\x9b', 'raw'), ['\xe9', '[\x9b]']);
+    result.assertEQ(this.scan(new Uint8Array([0x41, 0x0a]).buffer, 'raw'),
+                    ['[A\n]']);
+
+    var maxRun = hterm.VT.Scanner.MAX_RUN;
+    var ops = this.scan(lib.f.getWhitespace(maxRun * 2 + 1));
+    result.assertEQ(ops.length, 3);
+    result.assertEQ(ops[0].length, maxRun);
+    result.assertEQ(ops[2].length, 1);
+
+    result.pass();
+  });
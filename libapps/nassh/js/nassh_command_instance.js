@@ -75,8 +75,42 @@ nassh.CommandInstance = function(argv) {
 
   // Buffer for data coming from the terminal.
   this.inputBuffer_ = new nassh.InputBuffer();
+
+  /**
+   * Public, read-only statistics of the time from key events to their input
+   * being posted to the plugin, in milliseconds.
+   */
+  this.inputLatency = {count: 0, total: 0, max: 0};
+
+  /**
+   * Public, read-only statistics of how the plugin closed its streams, as
+   * sent with the exit message, or null until the plugin exits.
+   */
+  this.teardownStats = null;
+
+  /**
+   * Public, read-only results of the last benchmarkCiphers() run, or null.
+   */
+  this.cipherBenchmark = null;
 };
 
+/**
+ * Type of the binary message carrying the data of a read to the plugin.
+ *
+ * The type byte is followed by the fd as a 32-bit little endian integer,
+ * then by the data.  This must match the plugin.
+ */
+nassh.CommandInstance.BINARY_ON_READ = 1;
+
+/**
+ * Type of the binary message carrying an ssh-agent message from the plugin.
+ *
+ * The type byte is followed by the fd as a 32-bit little endian integer,
+ * then by one whole agent message, length included.  This must match the
+ * plugin.
+ */
+nassh.CommandInstance.BINARY_AGENT_MESSAGE = 2;
+
 /**
  * The name of this command used in messages to the user.
  *
@@ -854,6 +888,19 @@ nassh.CommandInstance.prototype.createTtyStream = function(
   return stream;
 };
 
+/**
+ * Measure the AES-CTR throughput of the plugin with and without worker
+ * threads.
+ *
+ * The results are logged and stored in cipherBenchmark.  This is meant to be
+ * run by hand from the JavaScript console.
+ *
+ * @param {integer} opt_megabytes How much data to encrypt, 256MB by default.
+ */
+nassh.CommandInstance.prototype.benchmarkCiphers = function(opt_megabytes) {
+  this.sendToPlugin_('benchmarkCiphers', [opt_megabytes || 256]);
+};
+
 /**
  * Send a message to the nassh plugin.
  *
@@ -866,6 +913,32 @@ nassh.CommandInstance.prototype.sendToPlugin_ = function(name, args) {
   this.plugin_.postMessage(str);
 };
 
+/**
+ * Send the data of a read to the plugin in a binary message, without the
+ * base64 and JSON encoding of sendToPlugin_().
+ *
+ * @param {integer} fd The file descriptor the data was read from.
+ * @param {string} data The data, one byte per character.
+ */
+nassh.CommandInstance.prototype.sendReadToPlugin_ = function(fd, data) {
+  var message = new Uint8Array(5 + data.length);
+  message[0] = nassh.CommandInstance.BINARY_ON_READ;
+  new DataView(message.buffer).setInt32(1, fd, true);
+  for (var i = 0; i < data.length; i++) {
+    message[5 + i] = data.charCodeAt(i);
+  }
+
+  this.plugin_.postMessage(message.buffer);
+
+  if (this.io.keystrokeTime != null) {
+    var latency = performance.now() - this.io.keystrokeTime;
+    this.io.keystrokeTime = null;
+    this.inputLatency.count++;
+    this.inputLatency.total += latency;
+    this.inputLatency.max = Math.max(this.inputLatency.max, latency);
+  }
+};
+
 /**
  * Send a string to the remote host.
  *
@@ -963,11 +1036,39 @@ nassh.CommandInstance.prototype.onBeforeUnload_ = function(e) {
  * plugin message into something dispatchMessage_ can digest.
  */
 nassh.CommandInstance.prototype.onPluginMessage_ = function(e) {
+  if (e.data instanceof ArrayBuffer) {
+    this.onPluginBinaryMessage_(e.data);
+    return;
+  }
+
   var msg = JSON.parse(e.data);
   msg.argv = msg.arguments;
   this.dispatchMessage_('plugin', this.onPlugin_, msg);
 };
 
+/**
+ * Called when the plugin sends us a binary message.
+ *
+ * @param {ArrayBuffer} buffer The message, starting with its type byte.
+ */
+nassh.CommandInstance.prototype.onPluginBinaryMessage_ = function(buffer) {
+  var message = new Uint8Array(buffer);
+  if (message.length < 5 ||
+      message[0] != nassh.CommandInstance.BINARY_AGENT_MESSAGE) {
+    console.warn('Unknown binary message from plugin');
+    return;
+  }
+
+  var fd = new DataView(buffer).getInt32(1, true);
+  var stream = this.streams_.getStreamByFd(fd);
+  if (!(stream instanceof nassh.Stream.SSHAgentRelay)) {
+    console.warn('Agent message for unknown fd: ' + fd);
+    return;
+  }
+
+  stream.writeMessage(message.subarray(5));
+};
+
 /**
  * Connect dialog message handlers.
  */
@@ -1011,12 +1112,31 @@ nassh.CommandInstance.prototype.onPlugin_.printLog = function(str) {
 /**
  * Plugin has exited.
  */
-nassh.CommandInstance.prototype.onPlugin_.exit = function(code) {
+nassh.CommandInstance.prototype.onPlugin_.exit = function(code, teardown) {
   console.log('plugin exit: ' + code);
+  if (teardown) {
+    this.teardownStats = teardown;
+    console.log('plugin closed ' + teardown.count + ' streams in ' +
+                teardown.batches + ' batches (' + teardown.lingered +
+                ' lingered, ' + teardown.dropped + ' dropped), exit waited ' +
+                teardown.exitMs + 'ms');
+  }
   this.sendToPlugin_('onExitAcknowledge', []);
   this.exit(code);
 };
 
+/**
+ * Plugin has finished a benchmarkCiphers() run.
+ */
+nassh.CommandInstance.prototype.onPlugin_.benchmarkResult = function(
+    megabytes, results) {
+  this.cipherBenchmark = {megabytes: megabytes, results: results};
+  for (var i = 0; i < results.length; i++) {
+    console.log('cipher benchmark: ' + results[i].threads + ' threads, ' +
+                results[i].mbps.toFixed(1) + 'MB/s');
+  }
+};
+
 /**
  * Plugin wants to open a file.
  *
@@ -1056,27 +1176,16 @@ nassh.CommandInstance.prototype.onPlugin_.openFile = function(fd, path, mode) {
 };
 
 nassh.CommandInstance.prototype.onPlugin_.openSocket = function(fd, host, port) {
-  var stream = null;
-
-  if (port == 0 && host == this.authAgentAppID_) {
-    // Request for auth-agent connection.
-    stream = this.streams_.openStream(nassh.Stream.SSHAgentRelay, fd,
-      {authAgentAppID: this.authAgentAppID_}, (success) => {
-        this.sendToPlugin_('onOpenSocket', [fd, success, false]);
-      });
-  } else {
-    // Regular relay connection request.
-    if (!this.relay_) {
-      this.sendToPlugin_('onOpenSocket', [fd, false, false]);
-      return;
-    }
-
-    stream = this.relay_.openSocket(fd, host, port, this.streams_,
-      (success) => {
-        this.sendToPlugin_('onOpenSocket', [fd, success, false]);
-      });
+  if (!this.relay_) {
+    this.sendToPlugin_('onOpenSocket', [fd, false, false]);
+    return;
   }
 
+  var stream = this.relay_.openSocket(fd, host, port, this.streams_,
+    (success) => {
+      this.sendToPlugin_('onOpenSocket', [fd, success, false]);
+    });
+
   stream.onDataAvailable = (data) => {
     this.sendToPlugin_('onRead', [fd, data]);
   };
@@ -1086,6 +1195,36 @@ nassh.CommandInstance.prototype.onPlugin_.openSocket = function(fd, host, port)
   };
 };
 
+/**
+ * Plugin wants to connect to the ssh-agent of another app.
+ *
+ * Agent messages travel in binary plugin messages, see BINARY_AGENT_MESSAGE,
+ * and replies go back as binary reads.
+ */
+nassh.CommandInstance.prototype.onPlugin_.openAgent = function(fd, appID) {
+  if (appID != this.authAgentAppID_) {
+    this.sendToPlugin_('onOpenSocket', [fd, false, false]);
+    return;
+  }
+
+  var stream = this.streams_.openStream(nassh.Stream.SSHAgentRelay, fd,
+    {authAgentAppID: appID}, (success) => {
+      this.sendToPlugin_('onOpenSocket', [fd, success, false]);
+    });
+
+  stream.onMessage = (reply) => {
+    var message = new Uint8Array(5 + reply.length);
+    message[0] = nassh.CommandInstance.BINARY_ON_READ;
+    new DataView(message.buffer).setInt32(1, fd, true);
+    message.set(reply, 5);
+    this.plugin_.postMessage(message.buffer);
+  };
+
+  stream.onClose = (reason) => {
+    this.sendToPlugin_('onClose', [fd, reason]);
+  };
+};
+
 /**
  * Plugin wants to write some data to a file descriptor.
  *
@@ -1167,6 +1306,12 @@ nassh.CommandInstance.prototype.onPlugin_.read = function(fd, size) {
     return;
   }
 
+  if (stream instanceof nassh.Stream.Tty) {
+    // Terminal input, typically a keystroke, goes straight to the plugin.
+    stream.asyncReadString(size, (data) => this.sendReadToPlugin_(fd, data));
+    return;
+  }
+
   stream.asyncRead(size, (b64bytes) => {
     this.sendToPlugin_('onRead', [fd, b64bytes]);
   });
@@ -7,13 +7,22 @@
 /**
  * Relay ssh-agent messages to another app.
  *
+ * The plugin hands us whole agent messages (a 32-bit big endian length and a
+ * body) as Uint8Arrays, and we hand replies back the same way through
+ * onMessage.  Requests are passed on as they arrive, without waiting for the
+ * reply to the previous one; the agent answers them in order.
  */
 nassh.Stream.SSHAgentRelay = function(fd) {
   nassh.Stream.apply(this, [fd]);
 
   this.authAgentAppID_ = null;
   this.port_ = null;
-  this.writeBuffer_ = [];
+
+  /**
+   * Called with each reply from the agent, as a Uint8Array holding the whole
+   * message.
+   */
+  this.onMessage = null;
 };
 
 /**
@@ -30,21 +39,12 @@ nassh.Stream.SSHAgentRelay.prototype.asyncOpen_ = function(args, onComplete) {
   this.port_ = chrome.runtime.connect(this.authAgentAppID_);
 
   var normalOnMessage = (msg) => {
-    if (msg.data) {
-      // Prepare header.
-      var size = msg.data.length;
-      var hdr = [(size >>> 24) & 255,
-                 (size >>> 16) & 255,
-                 (size >>> 8) & 255,
-                 (size >>> 0) & 255];
-      // Append body.
-      var bData = hdr.concat(msg.data);
-
-      // Report to client.
-      this.onDataAvailable(this.binaryToAscii(bData));
-
-      // Re-examine write buffer; there might be more data in it.
-      setTimeout(this.trySendPacket_.bind(this), 0);
+    if (msg.data && this.onMessage) {
+      // Put the header back in front of the body.
+      var message = new Uint8Array(4 + msg.data.length);
+      new DataView(message.buffer).setUint32(0, msg.data.length);
+      message.set(msg.data, 4);
+      this.onMessage(message);
     }
   };
 
@@ -82,72 +82,34 @@ nassh.Stream.SSHAgentRelay.prototype.close = function(reason) {
 };
 
 /**
- * Convert binary byte array into base64 ascii.
- */
-nassh.Stream.SSHAgentRelay.prototype.binaryToAscii = function(b) {
-  function x(y) { return String.fromCharCode(y); }
-
-  return btoa(Array.prototype.map.call(b, x).join(''));
-};
-
-/**
- * Convert ascii base64 into binary byte array.
- */
-nassh.Stream.SSHAgentRelay.prototype.asciiToBinary = function(a) {
-  function x(y) { return y.charCodeAt(0); }
-
-  return Array.prototype.map.call(atob(a), x);
-};
-
-/**
- * Check whether there is enough data in the write buffer to constitute a packet.
- * If so, send packet and handle reply.
+ * Send one whole agent message to the agent.
+ *
+ * @param {Uint8Array} message The message, starting with its length.
  */
-nassh.Stream.SSHAgentRelay.prototype.trySendPacket_ = function() {
-  // Message header, 4 bytes of length.
-  if (this.writeBuffer_.length < 4) return;
-
-  var size = ((this.writeBuffer_[0] & 255) << 24) +
-             ((this.writeBuffer_[1] & 255) << 16) +
-             ((this.writeBuffer_[2] & 255) << 8) +
-             ((this.writeBuffer_[3] & 255) << 0);
-
-  // Message body.
-  if (this.writeBuffer_.length < 4 + size) return;
-
-  this.writeBuffer_.splice(0, 4);  // Consume header.
-  var reqData = this.writeBuffer_.splice(0, size);  // Consume body.
+nassh.Stream.SSHAgentRelay.prototype.writeMessage = function(message) {
+  var size = message.length < 4 ? -1 :
+      new DataView(message.buffer, message.byteOffset).getUint32(0);
+  if (size != message.length - 4) {
+    console.warn('Dropping malformed agent message of ' + message.length +
+                 ' bytes');
+    this.close();
+    return;
+  }
 
   try {
     this.port_.postMessage({
         'type': 'auth-agent@openssh.com',
-        'data': reqData
+        'data': Array.from(message.subarray(4))
     });
   } catch (e) {
     this.close();
   }
 };
 
-/**
- * Append data to write buffer.
- */
-nassh.Stream.SSHAgentRelay.prototype.asyncWrite = function(data, onSuccess) {
-  if (!data.length)
-    return;
-
-  var bData = this.asciiToBinary(data);
-  this.writeBuffer_ = this.writeBuffer_.concat(bData);
-
-  setTimeout(this.trySendPacket_.bind(this), 0);
-
-  // Note: report binary length written.
-  onSuccess(bData.length);
-};
-
 /**
  * The asyncRead method is a no-op for this class.
  *
- * Instead we push data to the client using the onDataAvailable event.
+ * Instead we push replies to the client using the onMessage event.
  */
 nassh.Stream.SSHAgentRelay.prototype.asyncRead = function(size, onRead) {
   setTimeout(function() { onRead('') }, 0);
@@ -120,6 +120,20 @@ nassh.Stream.Tty.prototype.asyncOpen_ = function(info, onOpen) {
 };
 
 nassh.Stream.Tty.prototype.asyncRead = function(size, onRead) {
+  this.asyncReadString(size, (data) => {
+    var b64bytes = btoa(data);
+    setTimeout(function() { onRead(b64bytes); }, 0);
+  });
+};
+
+/**
+ * Read from the input buffer, calling back with the data as a string of
+ * bytes.
+ *
+ * Unlike asyncRead(), the callback is called as soon as data is available,
+ * which may be before this returns, so that keystrokes are not held up.
+ */
+nassh.Stream.Tty.prototype.asyncReadString = function(size, onRead) {
   if (!this.open)
     throw nassh.Stream.ERR_STREAM_CLOSED;
 
@@ -131,8 +145,7 @@ nassh.Stream.Tty.prototype.asyncRead = function(size, onRead) {
       return false;
     }
 
-    var b64bytes = btoa(data);
-    setTimeout(function() { onRead(b64bytes); }, 0);
+    onRead(data);
     return true;
   });
 };
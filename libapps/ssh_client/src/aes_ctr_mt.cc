@@ -0,0 +1,427 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "aes_ctr_mt.h"
+
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <openssl/aes.h>
+#include <openssl/engine.h>
+#include <openssl/evp.h>
+
+namespace {
+const int kMaxThreads = 2;
+const size_t kPacketSize = 32 * 1024;
+
+// The keystream is computed in kNumQueues queues of kQueueBlocks blocks each,
+// which the OpenSSH thread uses up in turn.
+const int kNumQueues = 8;
+const size_t kQueueBlocks = 2048;
+const size_t kQueueSize = kQueueBlocks * AES_BLOCK_SIZE;
+
+const int64_t kMicrosecondsPerSecond = 1000 * 1000;
+
+int64_t NowMicroseconds() {
+  timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * kMicrosecondsPerSecond + tv.tv_usec;
+}
+
+// Add |n| to the big endian 128-bit |counter|.
+void AddCounter(uint8_t* counter, uint64_t n) {
+  for (int i = AES_BLOCK_SIZE - 1; i >= 0 && n; --i) {
+    n += counter[i];
+    counter[i] = n & 0xff;
+    n >>= 8;
+  }
+}
+
+// The keystream of one AES-CTR cipher context.
+//
+// Each queue holds the keystream for its own range of counters.  The workers
+// fill empty queues, nearest first, and mark them ready; the OpenSSH thread
+// XORs the current queue into the data and, once it's used up, moves the
+// queue kNumQueues ranges ahead and marks it empty again.  When the current
+// queue isn't ready and nobody is filling it, the OpenSSH thread fills it
+// itself, which is all that happens without workers.
+//
+// A new key or IV bumps the generation, so keystream that was being computed
+// for the old one is thrown away when it's done.
+class KeystreamPipeline {
+ public:
+  explicit KeystreamPipeline(int threads);
+  ~KeystreamPipeline();
+
+  void SetKey(const uint8_t* key, int bits);
+  void SetCounter(const uint8_t* iv);
+
+  void Crypt(uint8_t* out, const uint8_t* in, size_t size);
+
+ private:
+  enum QueueState {
+    kEmpty,
+    kFilling,
+    kReady
+  };
+
+  struct Queue {
+    QueueState state;
+    uint8_t counter[AES_BLOCK_SIZE];
+    uint8_t keystream[kQueueSize];
+  };
+
+  // What's needed to fill a queue without holding the mutex.
+  struct Job {
+    Queue* queue;
+    uint32_t generation;
+    uint8_t counter[AES_BLOCK_SIZE];
+    AES_KEY key;
+  };
+
+  static void* WorkerThread(void* arg);
+  void WorkerLoop();
+
+  void Restart();
+  Queue* NextEmpty();
+  void Claim(Queue* queue, Job* job);
+  void Fill(Job* job);
+  void WaitReady(Queue* queue);
+  void Release(Queue* queue);
+
+  int num_threads_;
+  std::vector<pthread_t> threads_;
+
+  Mutex mutex_;
+  Cond cond_;
+  bool quit_;
+  bool have_key_;
+  bool have_counter_;
+  uint32_t generation_;
+  AES_KEY key_;
+  uint8_t counter_[AES_BLOCK_SIZE];
+  Queue queues_[kNumQueues];
+  int current_;
+
+  // Only used by the OpenSSH thread.
+  bool ready_;
+  size_t offset_;
+
+  DISALLOW_COPY_AND_ASSIGN(KeystreamPipeline);
+};
+
+KeystreamPipeline::KeystreamPipeline(int threads)
+    : num_threads_(threads),
+      quit_(false),
+      have_key_(false),
+      have_counter_(false),
+      generation_(0),
+      current_(0),
+      ready_(false),
+      offset_(0) {
+  memset(&key_, 0, sizeof(key_));
+  memset(counter_, 0, sizeof(counter_));
+  for (int i = 0; i < kNumQueues; i++)
+    queues_[i].state = kEmpty;
+}
+
+KeystreamPipeline::~KeystreamPipeline() {
+  {
+    Mutex::Lock lock(mutex_);
+    quit_ = true;
+    cond_.broadcast();
+  }
+  for (size_t i = 0; i < threads_.size(); i++)
+    pthread_join(threads_[i], NULL);
+  memset(&key_, 0, sizeof(key_));
+  memset(queues_, 0, sizeof(queues_));
+}
+
+void KeystreamPipeline::SetKey(const uint8_t* key, int bits) {
+  Mutex::Lock lock(mutex_);
+  AES_set_encrypt_key(key, bits, &key_);
+  have_key_ = true;
+  Restart();
+}
+
+void KeystreamPipeline::SetCounter(const uint8_t* iv) {
+  Mutex::Lock lock(mutex_);
+  memcpy(counter_, iv, AES_BLOCK_SIZE);
+  have_counter_ = true;
+  Restart();
+}
+
+void KeystreamPipeline::Crypt(uint8_t* out, const uint8_t* in, size_t size) {
+  while (size) {
+    Queue* queue = &queues_[current_];
+    if (!ready_) {
+      WaitReady(queue);
+      ready_ = true;
+    }
+
+    size_t n = std::min(size, kQueueSize - offset_);
+    const uint8_t* keystream = queue->keystream + offset_;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t)) {
+      uint64_t a, b;
+      memcpy(&a, in + i, sizeof(a));
+      memcpy(&b, keystream + i, sizeof(b));
+      a ^= b;
+      memcpy(out + i, &a, sizeof(a));
+    }
+    for (; i < n; i++)
+      out[i] = in[i] ^ keystream[i];
+
+    in += n;
+    out += n;
+    size -= n;
+    offset_ += n;
+    if (offset_ == kQueueSize)
+      Release(queue);
+  }
+}
+
+void* KeystreamPipeline::WorkerThread(void* arg) {
+  static_cast<KeystreamPipeline*>(arg)->WorkerLoop();
+  return NULL;
+}
+
+void KeystreamPipeline::WorkerLoop() {
+  for (;;) {
+    Job job;
+    {
+      Mutex::Lock lock(mutex_);
+      Queue* queue = NULL;
+      while (!quit_ && !(queue = NextEmpty()))
+        cond_.wait(mutex_);
+      if (quit_)
+        break;
+      Claim(queue, &job);
+    }
+    Fill(&job);
+  }
+}
+
+// Called with the mutex held whenever the key or counter changes.
+void KeystreamPipeline::Restart() {
+  if (!have_key_ || !have_counter_)
+    return;
+
+  generation_++;
+  uint8_t counter[AES_BLOCK_SIZE];
+  memcpy(counter, counter_, sizeof(counter));
+  for (int i = 0; i < kNumQueues; i++) {
+    memcpy(queues_[i].counter, counter, sizeof(counter));
+    AddCounter(counter, kQueueBlocks);
+    // A queue that's being filled goes back to empty when its worker is done
+    // with it; it must not be handed to another one before that.
+    if (queues_[i].state != kFilling)
+      queues_[i].state = kEmpty;
+  }
+  current_ = 0;
+  ready_ = false;
+  offset_ = 0;
+
+  while ((int)threads_.size() < num_threads_) {
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, &WorkerThread, this)) {
+      LOG("KeystreamPipeline: can't create worker thread\n");
+      num_threads_ = threads_.size();
+      break;
+    }
+    threads_.push_back(thread);
+  }
+  cond_.broadcast();
+}
+
+// Called with the mutex held.
+KeystreamPipeline::Queue* KeystreamPipeline::NextEmpty() {
+  if (!have_key_ || !have_counter_)
+    return NULL;
+  for (int i = 0; i < kNumQueues; i++) {
+    Queue* queue = &queues_[(current_ + i) % kNumQueues];
+    if (queue->state == kEmpty)
+      return queue;
+  }
+  return NULL;
+}
+
+// Called with the mutex held.
+void KeystreamPipeline::Claim(Queue* queue, Job* job) {
+  assert(queue->state == kEmpty);
+  queue->state = kFilling;
+  job->queue = queue;
+  job->generation = generation_;
+  memcpy(job->counter, queue->counter, sizeof(job->counter));
+  job->key = key_;
+}
+
+void KeystreamPipeline::Fill(Job* job) {
+  uint8_t* keystream = job->queue->keystream;
+  for (size_t i = 0; i < kQueueBlocks; i++) {
+    AES_encrypt(job->counter, keystream, &job->key);
+    AddCounter(job->counter, 1);
+    keystream += AES_BLOCK_SIZE;
+  }
+  memset(&job->key, 0, sizeof(job->key));
+
+  Mutex::Lock lock(mutex_);
+  job->queue->state = job->generation == generation_ ? kReady : kEmpty;
+  cond_.broadcast();
+}
+
+void KeystreamPipeline::WaitReady(Queue* queue) {
+  for (;;) {
+    Job job;
+    {
+      Mutex::Lock lock(mutex_);
+      assert(have_key_ && have_counter_);
+      while (queue->state == kFilling)
+        cond_.wait(mutex_);
+      if (queue->state == kReady)
+        return;
+      Claim(queue, &job);
+    }
+    Fill(&job);
+  }
+}
+
+void KeystreamPipeline::Release(Queue* queue) {
+  Mutex::Lock lock(mutex_);
+  AddCounter(queue->counter, kNumQueues * kQueueBlocks);
+  queue->state = kEmpty;
+  current_ = (current_ + 1) % kNumQueues;
+  ready_ = false;
+  offset_ = 0;
+  cond_.broadcast();
+}
+
+#ifndef OPENSSL_NO_ENGINE
+int g_threads = 0;
+
+const int kCipherNids[] = {
+  NID_aes_128_ctr,
+  NID_aes_192_ctr,
+  NID_aes_256_ctr,
+};
+const int kNumCiphers = sizeof(kCipherNids) / sizeof(kCipherNids[0]);
+EVP_CIPHER g_ciphers[kNumCiphers];
+
+KeystreamPipeline* GetPipeline(EVP_CIPHER_CTX* ctx) {
+  return static_cast<KeystreamPipeline*>(EVP_CIPHER_CTX_get_app_data(ctx));
+}
+
+// OpenSSH sets the key and the IV in separate calls.
+int CipherInit(EVP_CIPHER_CTX* ctx, const unsigned char* key,
+               const unsigned char* iv, int enc) {
+  KeystreamPipeline* pipeline = GetPipeline(ctx);
+  if (!pipeline) {
+    pipeline = new KeystreamPipeline(g_threads);
+    EVP_CIPHER_CTX_set_app_data(ctx, pipeline);
+  }
+  if (key)
+    pipeline->SetKey(key, EVP_CIPHER_CTX_key_length(ctx) * 8);
+  if (iv)
+    pipeline->SetCounter(iv);
+  return 1;
+}
+
+int CipherDo(EVP_CIPHER_CTX* ctx, unsigned char* out, const unsigned char* in,
+             size_t size) {
+  KeystreamPipeline* pipeline = GetPipeline(ctx);
+  if (!pipeline)
+    return 0;
+  pipeline->Crypt(out, in, size);
+  return 1;
+}
+
+int CipherCleanup(EVP_CIPHER_CTX* ctx) {
+  delete GetPipeline(ctx);
+  EVP_CIPHER_CTX_set_app_data(ctx, NULL);
+  return 1;
+}
+
+int EngineCiphers(ENGINE* e, const EVP_CIPHER** cipher, const int** nids,
+                  int nid) {
+  if (!cipher) {
+    *nids = kCipherNids;
+    return kNumCiphers;
+  }
+  for (int i = 0; i < kNumCiphers; i++) {
+    if (kCipherNids[i] == nid) {
+      *cipher = &g_ciphers[i];
+      return 1;
+    }
+  }
+  *cipher = NULL;
+  return 0;
+}
+#endif
+}
+
+int AesCtrMt::DefaultThreads() {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  if (cores <= 1)
+    return 0;
+  return std::min(cores - 1, (long)kMaxThreads);
+}
+
+bool AesCtrMt::Register(int threads) {
+#ifdef OPENSSL_NO_ENGINE
+  return false;
+#else
+  if (threads <= 0)
+    return false;
+
+  g_threads = threads;
+  for (int i = 0; i < kNumCiphers; i++) {
+    EVP_CIPHER* cipher = &g_ciphers[i];
+    memset(cipher, 0, sizeof(*cipher));
+    cipher->nid = kCipherNids[i];
+    cipher->block_size = AES_BLOCK_SIZE;
+    cipher->iv_len = AES_BLOCK_SIZE;
+    cipher->key_len = 16 + 8 * i;
+    cipher->init = CipherInit;
+    cipher->do_cipher = CipherDo;
+    cipher->cleanup = CipherCleanup;
+    cipher->flags = EVP_CIPH_CTR_MODE | EVP_CIPH_ALWAYS_CALL_INIT |
+        EVP_CIPH_CUSTOM_IV;
+  }
+
+  ENGINE* e = ENGINE_new();
+  if (!e)
+    return false;
+  bool ok = ENGINE_set_id(e, "aes-ctr-mt") &&
+      ENGINE_set_name(e, "Threaded AES-CTR") &&
+      ENGINE_set_ciphers(e, EngineCiphers) &&
+      ENGINE_set_default_ciphers(e);
+  ENGINE_free(e);
+  if (!ok)
+    LOG("AesCtrMt: can't register engine\n");
+  return ok;
+#endif
+}
+
+double AesCtrMt::Benchmark(int threads, size_t size) {
+  uint8_t key[32];
+  uint8_t iv[AES_BLOCK_SIZE];
+  memset(key, 0x5a, sizeof(key));
+  memset(iv, 0, sizeof(iv));
+  std::vector<uint8_t> packet(kPacketSize);
+
+  int64_t start = NowMicroseconds();
+  {
+    KeystreamPipeline pipeline(threads);
+    pipeline.SetKey(key, sizeof(key) * 8);
+    pipeline.SetCounter(iv);
+    for (size_t done = 0; done < size; done += kPacketSize)
+      pipeline.Crypt(&packet[0], &packet[0], kPacketSize);
+  }
+  int64_t elapsed = std::max(NowMicroseconds() - start, (int64_t)1);
+  return (double)size / elapsed;
+}
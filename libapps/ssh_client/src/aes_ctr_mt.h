@@ -0,0 +1,39 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef AES_CTR_MT_H
+#define AES_CTR_MT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pthread_helpers.h"
+
+// AES-CTR with the keystream computed ahead of time on worker threads, like
+// the cipher-ctr-mt.c of HPN-SSH.  In counter mode the keystream doesn't
+// depend on the data, so while the OpenSSH thread XORs one queue of keystream
+// into packets, the workers fill the next ones.
+//
+// It's installed as an OpenSSL engine, the default for the aes128-ctr,
+// aes192-ctr and aes256-ctr ciphers, so OpenSSH picks it up through EVP
+// without changes of its own.
+class AesCtrMt {
+ public:
+  // The number of worker threads per cipher worth using here: none on a
+  // single core, since the OpenSSH thread would compete with them.
+  static int DefaultThreads();
+
+  // Make OpenSSL use the threaded AES-CTR, with |threads| workers for each
+  // direction of each connection.  Return false if it isn't available.
+  static bool Register(int threads);
+
+  // Encrypt |size| bytes in packet sized calls with |threads| workers, or on
+  // the calling thread alone for 0, and return the throughput in MB/s.
+  static double Benchmark(int threads, size_t size);
+
+ private:
+  DISALLOW_IMPLICIT_CONSTRUCTORS(AesCtrMt);
+};
+
+#endif  // AES_CTR_MT_H
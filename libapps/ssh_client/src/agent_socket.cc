@@ -0,0 +1,227 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "agent_socket.h"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <string.h>
+
+#include "ppapi/cpp/module.h"
+
+#include "file_system.h"
+#include "proxy_stream.h"
+
+namespace {
+
+// Return the body size in the header at the start of |message|.
+size_t BodySize(const std::vector<char>& message) {
+  const unsigned char* p = reinterpret_cast<const unsigned char*>(&message[0]);
+  return (size_t(p[0]) << 24) | (size_t(p[1]) << 16) |
+         (size_t(p[2]) << 8) | size_t(p[3]);
+}
+
+}  // namespace
+
+AgentSocket::AgentSocket(int fd, int oflag, OutputInterface* out)
+  : ref_(1), fd_(fd), oflag_(oflag), out_(out), factory_(this),
+    is_open_(false), send_task_sent_(false), closing_(false),
+    lingering_(false) {
+}
+
+AgentSocket::~AgentSocket() {
+  assert(!ref_);
+}
+
+bool AgentSocket::connect(const char* app_id) {
+  pp::Module::Get()->core()->CallOnMainThread(0,
+      factory_.NewCallback(&AgentSocket::Connect, app_id));
+  FileSystem* sys = FileSystem::GetFileSystem();
+  while (!is_open())
+    sys->cond().wait(sys->mutex());
+
+  return fd_ != -1;
+}
+
+void AgentSocket::OnOpen(bool success, bool is_atty) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  is_open_ = true;
+  if (!success)
+    fd_ = -1;
+  sys->cond().broadcast();
+}
+
+void AgentSocket::OnRead(const char* buf, size_t size) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  in_buf_.insert(in_buf_.end(), buf, buf + size);
+  sys->cond().broadcast();
+}
+
+void AgentSocket::OnWriteAcknowledge(uint64_t count) {
+  // Messages are posted whole, there is no write window to track.
+}
+
+void AgentSocket::OnClose() {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  is_open_ = false;
+  sys->cond().broadcast();
+  if (closing_)
+    Teardown();
+}
+
+void AgentSocket::OnReadReady(bool is_read_ready) {
+}
+
+void AgentSocket::addref() {
+  ++ref_;
+}
+
+void AgentSocket::release() {
+  if (!--ref_)
+    delete this;
+}
+
+FileStream* AgentSocket::dup(int fd) {
+  return new ProxyStream(fd, oflag_, this);
+}
+
+void AgentSocket::close() {
+  if (is_open() && !closing_) {
+    closing_ = true;
+    FileSystem::GetFileSystem()->DeferClose(fd_, this, false);
+  }
+}
+
+int AgentSocket::read(char* buf, size_t count, size_t* nread) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  if (is_block()) {
+    while (is_open() && in_buf_.empty())
+      sys->cond().wait(sys->mutex());
+  }
+
+  *nread = std::min(count, in_buf_.size());
+  std::copy(in_buf_.begin(), in_buf_.begin() + *nread, buf);
+  in_buf_.erase(in_buf_.begin(), in_buf_.begin() + *nread);
+
+  if (*nread == 0 && !is_block() && is_open()) {
+    *nread = -1;
+    return EAGAIN;
+  }
+
+  return 0;
+}
+
+int AgentSocket::write(const char* buf, size_t count, size_t* nwrote) {
+  if (!is_open())
+    return EIO;
+
+  size_t pos = 0;
+  while (pos < count) {
+    size_t wanted = kHeaderSize;
+    if (partial_.size() >= kHeaderSize)
+      wanted += BodySize(partial_);
+    size_t n = std::min(wanted - partial_.size(), count - pos);
+    partial_.insert(partial_.end(), buf + pos, buf + pos + n);
+    pos += n;
+
+    if (partial_.size() < kHeaderSize)
+      break;
+    size_t size = BodySize(partial_);
+    if (size > kMaxMessageSize) {
+      LOG("AgentSocket::write: %d: message of %d bytes is too long\n",
+          fd_, size);
+      partial_.clear();
+      return EIO;
+    }
+    if (partial_.size() == kHeaderSize + size) {
+      out_queue_.push_back(std::vector<char>());
+      out_queue_.back().swap(partial_);
+    } else if (partial_.size() == kHeaderSize) {
+      partial_.reserve(kHeaderSize + size);
+    }
+  }
+
+  if (!out_queue_.empty() && !send_task_sent_) {
+    pp::Module::Get()->core()->CallOnMainThread(0,
+        factory_.NewCallback(&AgentSocket::Send));
+    send_task_sent_ = true;
+  }
+
+  *nwrote = count;
+  return 0;
+}
+
+int AgentSocket::fstat(nacl_abi_stat* out) {
+  memset(out, 0, sizeof(nacl_abi_stat));
+  out->nacl_abi_st_ino = fd_;
+  out->nacl_abi_st_dev = fd_;
+  return 0;
+}
+
+int AgentSocket::fcntl(int cmd, va_list ap) {
+  if (cmd == F_GETFL) {
+    return oflag_;
+  } else if (cmd == F_SETFL) {
+    oflag_ = va_arg(ap, long);
+    return 0;
+  } else {
+    return -1;
+  }
+}
+
+bool AgentSocket::is_read_ready() {
+  // A closed socket is readable so that select() reports the end of file.
+  return !in_buf_.empty() || !is_open();
+}
+
+bool AgentSocket::is_write_ready() {
+  return true;
+}
+
+void AgentSocket::Connect(int32_t result, const char* app_id) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  out_->OpenAgent(fd_, app_id, this);
+}
+
+void AgentSocket::Send(int32_t result) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  send_task_sent_ = false;
+  while (!out_queue_.empty()) {
+    const std::vector<char>& message = out_queue_.front();
+    if (!out_->WriteAgentMessage(fd_, &message[0], message.size()))
+      assert(0);
+    out_queue_.pop_front();
+  }
+  sys->cond().broadcast();
+
+  if (lingering_) {
+    lingering_ = false;
+    out_->Close(fd_);
+  }
+}
+
+void AgentSocket::FinishClose() {
+  if (!is_open_) {
+    // JS closed it first.
+    Teardown();
+  } else if (send_task_sent_) {
+    // Send() posts the last requests, then asks JS to close.
+    lingering_ = true;
+  } else {
+    out_->Close(fd_);
+  }
+}
+
+void AgentSocket::Teardown() {
+  // This may drop the last reference, so it must come last.
+  closing_ = false;
+  lingering_ = false;
+  FileSystem::GetFileSystem()->CloseDone(this, false);
+}
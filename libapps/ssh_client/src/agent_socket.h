@@ -0,0 +1,83 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef AGENT_SOCKET_H
+#define AGENT_SOCKET_H
+
+#include <deque>
+#include <vector>
+
+#include "ppapi/cpp/completion_callback.h"
+
+#include "file_system.h"
+#include "pthread_helpers.h"
+
+// A connection to the ssh-agent of another app.  Unlike JsSocket, the data
+// is not treated as a byte stream: writes are cut into agent messages (a
+// 32-bit big endian length and a body), and each whole message is posted to
+// JS in one binary message, without base64 or JSON.  Requests are posted as
+// soon as they're complete, so several may be in flight at once; the agent
+// answers them in order.  Replies come back as binary onRead messages.
+class AgentSocket : public FileStream,
+                    public InputInterface {
+ public:
+  AgentSocket(int fd, int oflag, OutputInterface* out);
+  virtual ~AgentSocket();
+
+  bool connect(const char* app_id);
+
+  bool is_block() { return !(oflag_ & O_NONBLOCK); }
+  bool is_open() { return is_open_; }
+
+  // Implements InputInterface.
+  virtual void OnOpen(bool success, bool is_atty);
+  virtual void OnRead(const char* buf, size_t size);
+  virtual void OnWriteAcknowledge(uint64_t count);
+  virtual void OnClose();
+  virtual void OnReadReady(bool is_read_ready);
+
+  virtual void addref();
+  virtual void release();
+  virtual FileStream* dup(int fd);
+
+  virtual void close();
+  virtual int read(char* buf, size_t count, size_t* nread);
+  virtual int write(const char* buf, size_t count, size_t* nwrote);
+  virtual int fstat(nacl_abi_stat* out);
+  virtual int fcntl(int cmd,  va_list ap);
+
+  virtual bool is_read_ready();
+  virtual bool is_write_ready();
+
+  virtual void FinishClose();
+
+  // The largest message OpenSSH sends or accepts (AGENT_MAX_LEN in authfd.c).
+  static const size_t kMaxMessageSize = 256 * 1024;
+
+ private:
+  static const size_t kHeaderSize = 4;
+
+  void Connect(int32_t result, const char* app_id);
+  void Send(int32_t result);
+  void Teardown();
+
+  int ref_;
+  int fd_;
+  int oflag_;
+  OutputInterface* out_;
+  pp::CompletionCallbackFactory<AgentSocket> factory_;
+  bool is_open_;
+  // The start of a message, until all of it has been written.
+  std::vector<char> partial_;
+  // Whole messages waiting for the main thread to post them.
+  std::deque<std::vector<char> > out_queue_;
+  bool send_task_sent_;
+  bool closing_;
+  bool lingering_;
+  std::deque<char> in_buf_;
+
+  DISALLOW_COPY_AND_ASSIGN(AgentSocket);
+};
+
+#endif  // AGENT_SOCKET_H
@@ -24,7 +24,7 @@ void DevNullHandler::release() {
 }
 
 FileStream* DevNullHandler::open(int fd, const char* pathname, int oflag,
-                                 int* err) {
+                                 mode_t cmode, int* err) {
   return new DevNull(fd, oflag);
 }
 
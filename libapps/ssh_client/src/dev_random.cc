@@ -28,7 +28,7 @@ void DevRandomHandler::release() {
 }
 
 FileStream* DevRandomHandler::open(int fd, const char* pathname, int oflag,
-                                   int* err) {
+                                   mode_t cmode, int* err) {
   return new DevRandom(fd, oflag, get_random_bytes_);
 }
 
@@ -9,8 +9,10 @@
 #include <fcntl.h>
 #include <sys/dir.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <sys/types.h>
 #include <stdarg.h>
+#include <stdint.h>
 #include <string.h>
 #include <termios.h>
 #include <unistd.h>
@@ -60,6 +62,12 @@ class FileStream {
     errno = EINVAL;
     return -1;
   }
+  virtual int getsockopt(int level, int optname, void* optval,
+                         socklen_t* optlen) {
+    // Every option we don't emulate reads as zero.
+    memset(optval, 0, *optlen);
+    return 0;
+  }
 
   virtual bool is_read_ready() {
     return true;
@@ -70,6 +78,12 @@ class FileStream {
   virtual bool is_exception() {
     return false;
   }
+
+  // Called on the main thread, with the file system mutex held, for a stream
+  // whose close() handed it to FileSystem::DeferClose().  Release its Pepper
+  // resources once its pending output is sent, then call
+  // FileSystem::CloseDone().
+  virtual void FinishClose() {}
 };
 
 class PathHandler {
@@ -79,9 +93,19 @@ class PathHandler {
   virtual void addref() = 0;
   virtual void release() = 0;
 
+  // |cmode| is the mode of a file created with O_CREAT.
   virtual FileStream* open(int fd, const char* pathname, int oflag,
-                           int* err) = 0;
+                           mode_t cmode, int* err) = 0;
   virtual int stat(const char* pathname, nacl_abi_stat* out) = 0;
+  virtual int mkdir(const char* pathname, mode_t mode) {
+    return EACCES;
+  }
+  virtual int unlink(const char* pathname) {
+    return EACCES;
+  }
+  virtual int rmdir(const char* pathname) {
+    return EACCES;
+  }
 };
 
 class InputInterface {
@@ -95,6 +119,20 @@ class InputInterface {
   virtual void OnReadReady(bool is_read_ready) = 0;
 };
 
+// Timing of the closes of a session.  Times are in microseconds.
+struct CloseStats {
+  // Closes finished, and the main thread tasks that started them.
+  uint32_t count;
+  uint32_t batches;
+  // Closes that waited for pending output, and those that gave up on it.
+  uint32_t lingered;
+  uint32_t dropped;
+  int64_t total_us;
+  int64_t max_us;
+  // How long exit() waited for the last closes to finish.
+  int64_t exit_us;
+};
+
 class OutputInterface {
  public:
   virtual ~OutputInterface() {}
@@ -103,11 +141,14 @@ class OutputInterface {
                         InputInterface* stream) = 0;
   virtual bool OpenSocket(int fd, const char* host, uint16_t port,
                           InputInterface* stream) = 0;
+  virtual bool OpenAgent(int fd, const char* app_id,
+                         InputInterface* stream) = 0;
   virtual bool Write(int fd, const char* data, size_t size) = 0;
+  virtual bool WriteAgentMessage(int fd, const char* data, size_t size) = 0;
   virtual bool Read(int fd, size_t size) = 0;
   virtual bool Close(int fd) = 0;
   virtual size_t GetWriteWindow() = 0;
-  virtual void SendExitCode(int error) = 0;
+  virtual void SendExitCode(int error, const CloseStats& stats) = 0;
 };
 
 #endif  // FILE_INTERFACES_H
@@ -5,6 +5,7 @@
 #include "file_system.h"
 
 #include <arpa/inet.h>
+#include <errno.h>
 #include <netdb.h>
 #include <netinet/in.h>
 #include <signal.h>
@@ -14,14 +15,17 @@
 
 #include "irt.h"
 #include "ppapi/cpp/file_ref.h"
+#include "ppapi/cpp/module.h"
 #include "ppapi/cpp/private/net_address_private.h"
 
+#include "agent_socket.h"
 #include "dev_null.h"
 #include "dev_random.h"
 #include "js_file.h"
 #include "pepper_file.h"
 #include "tcp_server_socket.h"
 #include "tcp_socket.h"
+#include "tmp_fs.h"
 #include "udp_socket.h"
 
 extern "C" void DoWrapSysCalls();
@@ -32,8 +36,15 @@ const int64_t kNanosecondsPerMicrosecond = 1000;
 
 // Magic value; keep in sync with //ssh_client/openssh/authfd.c
 const uint32_t kSshAgentFakeIP = 0x7F010203;
+
+int64_t NowMicroseconds() {
+  timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * kMicrosecondsPerSecond + tv.tv_usec;
+}
 }
 
+const size_t FileSystem::kTmpFsMaxBytes;
 FileStream* const FileSystem::kBadFileStream = (FileStream*)-1;
 FileSystem* FileSystem::file_system_ = NULL;
 
@@ -44,6 +55,11 @@ FileSystem::FileSystem(pp::Instance* instance, OutputInterface* out)
       ppfs_path_handler_(NULL),
       fs_initialized_(false),
       factory_(this),
+      exit_code_acked_(false),
+      close_task_sent_(false),
+      finishing_closes_(false),
+      file_closes_(0),
+      close_stats_(),
       host_resolver_(NULL),
       first_unused_addr_(kFirstAddr),
       use_js_socket_(false),
@@ -90,6 +106,15 @@ FileSystem::FileSystem(pp::Instance* instance, OutputInterface* out)
     abort();
   }
 
+  // Scratch files, sockets and the like never need to reach the HTML5 file
+  // system, where every access is a round trip to the main thread.
+  TmpFsHandler* tmpfs = new TmpFsHandler(kTmpFsMaxBytes);
+  tmpfs->mkdir("/tmp", 01777);
+  tmpfs->mkdir("/run", 0755);
+  tmpfs->addref();
+  AddPathHandler("/tmp", tmpfs);
+  AddPathHandler("/run", tmpfs);
+
   // Add localhost 127.0.0.1
   AddHostAddress("localhost", 0x7F000001);
 
@@ -97,8 +122,6 @@ FileSystem::FileSystem(pp::Instance* instance, OutputInterface* out)
 }
 
 FileSystem::~FileSystem() {
-  for (PathHandlerMap::iterator it = paths_.begin(); it != paths_.end(); ++it)
-    it->second->release();
   for (FileStreamMap::iterator it = streams_.begin(); it != streams_.end();
        ++it) {
     it->second->release();
@@ -141,8 +164,11 @@ void FileSystem::WaitForStdFiles() {
 }
 
 void FileSystem::AddPathHandler(const std::string& path, PathHandler* handler) {
-  assert(paths_.find(path) == paths_.end());
-  paths_[path] = handler;
+  paths_.Mount(path, handler);
+}
+
+PathHandler* FileSystem::FindPathHandler(const char* pathname) {
+  return paths_.Find(pathname);
 }
 
 void FileSystem::AddFileStream(int fd, FileStream* stream) {
@@ -157,7 +183,7 @@ void FileSystem::RemoveFileStream(int fd) {
 
 int FileSystem::GetFirstUnusedDescriptor() {
   int fd = kFileIDOffset;
-  while (IsKnowDescriptor(fd))
+  while (IsKnowDescriptor(fd) || IsClosingDescriptor(fd))
     fd++;
   return fd;
 }
@@ -166,6 +192,15 @@ bool FileSystem::IsKnowDescriptor(int fd) {
   return streams_.find(fd) != streams_.end();
 }
 
+bool FileSystem::IsClosingDescriptor(int fd) {
+  for (PendingCloseMap::iterator it = pending_closes_.begin();
+       it != pending_closes_.end(); ++it) {
+    if (it->second.fd == fd)
+      return true;
+  }
+  return false;
+}
+
 FileStream* FileSystem::GetStream(int fd) {
   FileStreamMap::iterator it = streams_.find(fd);
   return it != streams_.end() ? it->second : (FileStream*)NULL;
@@ -174,12 +209,9 @@ FileStream* FileSystem::GetStream(int fd) {
 int FileSystem::open(const char* pathname, int oflag, mode_t cmode,
                      int* newfd) {
   Mutex::Lock lock(mutex_);
-  PathHandlerMap::iterator it = paths_.find(pathname);
-  PathHandler* handler = NULL;
-  if (it != paths_.end()) {
-    handler = it->second;
-  } else {
-    while (!fs_initialized_)
+  PathHandler* handler = FindPathHandler(pathname);
+  if (!handler) {
+    while (!fs_initialized_ || file_closes_)
       cond_.wait(mutex_);
     handler = ppfs_path_handler_;
   }
@@ -190,7 +222,7 @@ int FileSystem::open(const char* pathname, int oflag, mode_t cmode,
   int fd = GetFirstUnusedDescriptor();
   // mark descriptor as used
   AddFileStream(fd, NULL);
-  FileStream* stream = handler->open(fd, pathname, oflag, &err);
+  FileStream* stream = handler->open(fd, pathname, oflag, cmode, &err);
   if (!stream) {
     RemoveFileStream(fd);
     return err;
@@ -212,6 +244,7 @@ int FileSystem::close(int fd) {
     stream->release();
   }
   RemoveFileStream(fd);
+  socket_flags_.erase(fd);
   return 0;
 }
 
@@ -297,8 +330,9 @@ int FileSystem::fstat(int fd, nacl_abi_stat* out) {
 
 int FileSystem::stat(const char* pathname, nacl_abi_stat* out) {
   Mutex::Lock lock(mutex_);
-  PathHandlerMap::iterator it = paths_.find(pathname);
-  PathHandler* handler = (it != paths_.end()) ? it->second : ppfs_path_handler_;
+  PathHandler* handler = FindPathHandler(pathname);
+  if (!handler)
+    handler = ppfs_path_handler_;
   if (!handler)
     return ENOENT;
 
@@ -354,7 +388,12 @@ int FileSystem::fcntl(int fd, int cmd, va_list ap) {
   if (stream && stream != kBadFileStream) {
     return stream->fcntl(cmd, ap);
   } else if (IsKnowDescriptor(fd)) {
-    // Socket with reserved FD but not allocated yet, for now just ignore.
+    // Socket with reserved FD but not allocated yet.  Keep the flags for
+    // connect(), which needs O_NONBLOCK.
+    if (cmd == F_GETFL)
+      return socket_flags_[fd];
+    if (cmd == F_SETFL)
+      socket_flags_[fd] = va_arg(ap, long);
     return 0;
   } else {
     errno = EBADF;
@@ -540,16 +579,15 @@ int FileSystem::getaddrinfo(const char* hostname, const char* servname,
   params.servname = servname;
   params.hints = hints;
   params.res = res;
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0, factory_.NewCallback(
-      &FileSystem::Resolve, &params, &result));
-  while (result == PP_OK_COMPLETIONPENDING)
-    cond_.wait(mutex_);
+  PepperOperation* op = new PepperOperation();
+  int32_t result = op->Run(
+      factory_.NewCallback(&FileSystem::Resolve, &params, op));
+  op->release();
   return result == PP_OK ? 0 : EAI_FAIL;
 }
 
 void FileSystem::Resolve(int32_t result, GetAddrInfoParams* params,
-                         int32_t* pres) {
+                         PepperOperation* op) {
   Mutex::Lock lock(mutex_);
   const char* hostname = params->hostname;
   const char* servname = params->servname;
@@ -559,8 +597,7 @@ void FileSystem::Resolve(int32_t result, GetAddrInfoParams* params,
   if (hints && hints->ai_family != AF_UNSPEC &&
       hints->ai_family != AF_INET &&
       hints->ai_family != AF_INET6) {
-    *pres = PP_ERROR_FAILED;
-    cond_.broadcast();
+    op->Complete(PP_ERROR_FAILED);
     return;
   }
 
@@ -588,22 +625,19 @@ void FileSystem::Resolve(int32_t result, GetAddrInfoParams* params,
       if (!pp::NetAddressPrivate::CreateFromIPv6Address(
               in.s6_addr, 0, port, &addr)) {
         LOG("NetAddressPrivate::CreateFromIPv6Address failed!\n");
-        *pres = PP_ERROR_FAILED;
-        cond_.broadcast();
+        op->Complete(PP_ERROR_FAILED);
         return;
       }
     } else {
       if (!pp::NetAddressPrivate::CreateFromIPv4Address(
               in.s6_addr, port, &addr)) {
         LOG("NetAddressPrivate::CreateFromIPv4Address failed!\n");
-        *pres = PP_ERROR_FAILED;
-        cond_.broadcast();
+        op->Complete(PP_ERROR_FAILED);
         return;
       }
     }
     *res = CreateAddrInfo(addr, hints, "");
-    *pres = PP_OK;
-    cond_.broadcast();
+    op->Complete(PP_OK);
     return;
   }
 
@@ -612,13 +646,11 @@ void FileSystem::Resolve(int32_t result, GetAddrInfoParams* params,
     PP_NetAddress_Private addr = {};
     if (!pp::NetAddressPrivate::GetAnyAddress(is_ipv6, &addr)) {
       LOG("NetAddressPrivate::GetAnyAddress failed!\n");
-      *pres = PP_ERROR_FAILED;
-      cond_.broadcast();
+      op->Complete(PP_ERROR_FAILED);
       return;
     }
     *res = CreateAddrInfo(addr, hints, "");
-    *pres = PP_OK;
-    cond_.broadcast();
+    op->Complete(PP_OK);
     return;
   }
 
@@ -631,8 +663,7 @@ void FileSystem::Resolve(int32_t result, GetAddrInfoParams* params,
       if (!pp::NetAddressPrivate::CreateFromIPv6Address(
               localhost_ip, 0, port, &localhost)) {
         LOG("NetAddressPrivate::CreateFromIPv6Address failed!\n");
-        *pres = PP_ERROR_FAILED;
-        cond_.broadcast();
+        op->Complete(PP_ERROR_FAILED);
         return;
       }
     } else {
@@ -640,20 +671,17 @@ void FileSystem::Resolve(int32_t result, GetAddrInfoParams* params,
       if (!pp::NetAddressPrivate::CreateFromIPv4Address(
               localhost_ip, port, &localhost)) {
         LOG("NetAddressPrivate::CreateFromIPv4Address failed!\n");
-        *pres = PP_ERROR_FAILED;
-        cond_.broadcast();
+        op->Complete(PP_ERROR_FAILED);
         return;
       }
     }
     *res = CreateAddrInfo(localhost, hints, "");
-    *pres = PP_OK;
-    cond_.broadcast();
+    op->Complete(PP_OK);
     return;
   }
 
   if (hints && hints->ai_flags & AI_NUMERICHOST) {
-    *pres = PP_ERROR_FAILED;
-    cond_.broadcast();
+    op->Complete(PP_ERROR_FAILED);
     return;
   }
 
@@ -673,23 +701,22 @@ void FileSystem::Resolve(int32_t result, GetAddrInfoParams* params,
 
     assert(host_resolver_ == NULL);
     host_resolver_ = new pp::HostResolverPrivate(instance_);
-    *pres = host_resolver_->Resolve(hostname, port, hint,
-        factory_.NewCallback(&FileSystem::OnResolve, params, pres));
-    if (*pres != PP_OK_COMPLETIONPENDING) {
+    result = host_resolver_->Resolve(hostname, port, hint,
+        factory_.NewCallback(&FileSystem::OnResolve, params, op));
+    if (result != PP_OK_COMPLETIONPENDING) {
       delete host_resolver_;
       host_resolver_ = NULL;
-      cond_.broadcast();
+      op->Complete(result);
     }
   } else {
     *res = GetFakeAddress(hostname, port, hints);
-    *pres = PP_OK;
-    cond_.broadcast();
+    op->Complete(PP_OK);
     return;
   }
 }
 
 void FileSystem::OnResolve(int32_t result, GetAddrInfoParams* params,
-                           int32_t* pres) {
+                           PepperOperation* op) {
   Mutex::Lock lock(mutex_);
   assert(host_resolver_);
   const addrinfo* hints = params->hints;
@@ -712,8 +739,7 @@ void FileSystem::OnResolve(int32_t result, GetAddrInfoParams* params,
   }
   delete host_resolver_;
   host_resolver_ = NULL;
-  *pres = result;
-  cond_.broadcast();
+  op->Complete(result);
 }
 
 void FileSystem::freeaddrinfo(addrinfo* ai) {
@@ -809,9 +835,17 @@ int FileSystem::connect(int fd, const sockaddr* serv_addr, socklen_t addrlen) {
   std::string hostname;
 
   if (IsAgentConnect(serv_addr, addrlen, &hostname, &port)) {
-    // If the request is for the auth agent,
-    // make sure to punt request to JS proxy.
-    use_js_socket_ = true;
+    // The auth agent gets its own channel to JS, which passes whole agent
+    // messages instead of base64 encoded stream data.
+    LOG("FileSystem::connect: agent [%s]\n", hostname.c_str());
+    AgentSocket* socket = new AgentSocket(fd, O_RDWR, output_);
+    if (!socket->connect(hostname.c_str())) {
+      errno = ECONNREFUSED;
+      socket->release();
+      return -1;
+    }
+    AddFileStream(fd, socket);
+    return 0;
   } else if (!GetHostPort(serv_addr, addrlen, &hostname, &port)) {
     errno = EAFNOSUPPORT;
     return -1;
@@ -820,7 +854,7 @@ int FileSystem::connect(int fd, const sockaddr* serv_addr, socklen_t addrlen) {
 
   FileStream* stream = NULL;
   if (use_js_socket_) {
-    // Only first socket and auth sockets need JS proxy.
+    // Only the first socket needs JS proxy.
     // Clear flag so other sockets will use Pepper by default.
     use_js_socket_ = false;
     JsSocket* socket = new JsSocket(fd, O_RDWR, output_);
@@ -831,9 +865,17 @@ int FileSystem::connect(int fd, const sockaddr* serv_addr, socklen_t addrlen) {
     }
     stream = socket;
   } else {
-    TCPSocket* socket = new TCPSocket(fd, O_RDWR);
-    if (!socket->connect(hostname.c_str(), port)) {
-      errno = ECONNREFUSED;
+    int oflag = O_RDWR | (socket_flags_[fd] & O_NONBLOCK);
+    socket_flags_.erase(fd);
+    TCPSocket* socket = new TCPSocket(fd, oflag);
+    int error = socket->connect(hostname, port);
+    if (error == EINPROGRESS) {
+      // Nonblocking connect, select() reports when it's done.
+      AddFileStream(fd, socket);
+      errno = EINPROGRESS;
+      return -1;
+    } else if (error) {
+      errno = error;
       socket->release();
       return -1;
     }
@@ -945,6 +987,21 @@ int FileSystem::getsockname(int sockfd, sockaddr* name, socklen_t* namelen) {
   }
 }
 
+int FileSystem::getsockopt(int socket, int level, int optname, void* optval,
+                           socklen_t* optlen) {
+  Mutex::Lock lock(mutex_);
+  FileStream* stream = GetStream(socket);
+  if (stream && stream != kBadFileStream) {
+    return stream->getsockopt(level, optname, optval, optlen);
+  } else if (IsKnowDescriptor(socket)) {
+    memset(optval, 0, *optlen);
+    return 0;
+  } else {
+    errno = EBADF;
+    return -1;
+  }
+}
+
 ssize_t FileSystem::sendto(int sockfd, const char* buf, size_t len, int flags,
                            const sockaddr* dest_addr, socklen_t addrlen) {
   Mutex::Lock lock(mutex_);
@@ -975,6 +1032,16 @@ ssize_t FileSystem::recvfrom(int sockfd, char* buffer, size_t len, int flags,
 
 int FileSystem::mkdir(const char* pathname, mode_t mode) {
   Mutex::Lock lock(mutex_);
+  PathHandler* handler = FindPathHandler(pathname);
+  if (handler) {
+    int err = handler->mkdir(pathname, mode);
+    if (err) {
+      errno = err;
+      return -1;
+    }
+    return 0;
+  }
+
   while (!fs_initialized_)
     cond_.wait(mutex_);
 
@@ -983,15 +1050,47 @@ int FileSystem::mkdir(const char* pathname, mode_t mode) {
     return -1;
   }
 
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&FileSystem::MakeDirectory,
-                                   pathname, &result));
-  while (result == PP_OK_COMPLETIONPENDING)
-    cond_.wait(mutex_);
+  PepperOperation* op = new PepperOperation();
+  int32_t result = op->Run(
+      factory_.NewCallback(&FileSystem::MakeDirectory, pathname, op));
+  op->release();
   return (result == PP_OK) ? 0 : -1;
 }
 
+int FileSystem::unlink(const char* pathname) {
+  Mutex::Lock lock(mutex_);
+  PathHandler* handler = FindPathHandler(pathname);
+  if (!handler) {
+    // Files of the HTML5 file system are never removed.
+    errno = EACCES;
+    return -1;
+  }
+
+  int err = handler->unlink(pathname);
+  if (err) {
+    errno = err;
+    return -1;
+  }
+  return 0;
+}
+
+int FileSystem::rmdir(const char* pathname) {
+  Mutex::Lock lock(mutex_);
+  PathHandler* handler = FindPathHandler(pathname);
+  if (!handler) {
+    // Directories of the HTML5 file system are never removed.
+    errno = EACCES;
+    return -1;
+  }
+
+  int err = handler->rmdir(pathname);
+  if (err) {
+    errno = err;
+    return -1;
+  }
+  return 0;
+}
+
 int FileSystem::sigaction(int signum,
                           const struct sigaction* act,
                           struct sigaction* oldact) {
@@ -1008,36 +1107,122 @@ int FileSystem::sigaction(int signum,
 
 void FileSystem::exit(int status) {
   Mutex::Lock lock(mutex_);
-  output_->SendExitCode(status);
+  output_->SendExitCode(status, CloseAllStreams());
   // Wait for the page to ACK it, so we can abort.
   while (!exit_code_acked_)
     cond_.wait(mutex_);
 }
 
+CloseStats FileSystem::CloseAllStreams() {
+  Mutex::Lock lock(mutex_);
+
+  // Close whatever OpenSSH left open in one batch, and give pending output a
+  // little time to be sent before the page tears us down.
+  int64_t start_us = NowMicroseconds();
+  FileStreamMap::iterator it = streams_.begin();
+  while (it != streams_.end()) {
+    FileStream* stream = it->second;
+    if (it->first > 2 && stream && stream != kBadFileStream) {
+      stream->close();
+      stream->release();
+      streams_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+
+  int64_t deadline_us = start_us + kExitLingerUs;
+  timespec ts_abs;
+  ts_abs.tv_sec = deadline_us / kMicrosecondsPerSecond;
+  ts_abs.tv_nsec = (deadline_us - ts_abs.tv_sec * kMicrosecondsPerSecond) *
+      kNanosecondsPerMicrosecond;
+  while (!pending_closes_.empty()) {
+    if (cond_.timedwait(mutex_, &ts_abs)) {
+      LOG("FileSystem::CloseAllStreams: %d closes still pending\n",
+          pending_closes_.size());
+      break;
+    }
+  }
+  close_stats_.exit_us = NowMicroseconds() - start_us;
+  return close_stats_;
+}
+
 void FileSystem::ExitCodeAcked() {
   Mutex::Lock lock(mutex_);
   exit_code_acked_ = true;
 }
 
+void FileSystem::DeferClose(int fd, FileStream* stream, bool is_file) {
+  Mutex::Lock lock(mutex_);
+  assert(pending_closes_.find(stream) == pending_closes_.end());
+  stream->addref();
+  PendingClose& pending = pending_closes_[stream];
+  pending.fd = fd;
+  pending.is_file = is_file;
+  pending.start_us = NowMicroseconds();
+  if (is_file)
+    ++file_closes_;
+
+  close_queue_.push_back(stream);
+  if (!close_task_sent_) {
+    close_task_sent_ = true;
+    pp::Module::Get()->core()->CallOnMainThread(0,
+        factory_.NewCallback(&FileSystem::FinishCloses));
+  }
+}
+
+void FileSystem::FinishCloses(int32_t result) {
+  Mutex::Lock lock(mutex_);
+  close_task_sent_ = false;
+  std::vector<FileStream*> queue;
+  queue.swap(close_queue_);
+  close_stats_.batches++;
+
+  finishing_closes_ = true;
+  for (size_t i = 0; i < queue.size(); ++i)
+    queue[i]->FinishClose();
+  finishing_closes_ = false;
+}
+
+void FileSystem::CloseDone(FileStream* stream, bool dropped) {
+  Mutex::Lock lock(mutex_);
+  PendingCloseMap::iterator it = pending_closes_.find(stream);
+  assert(it != pending_closes_.end());
+  int64_t elapsed_us = NowMicroseconds() - it->second.start_us;
+  if (it->second.is_file)
+    --file_closes_;
+  pending_closes_.erase(it);
+
+  close_stats_.count++;
+  if (!finishing_closes_)
+    close_stats_.lingered++;
+  if (dropped)
+    close_stats_.dropped++;
+  close_stats_.total_us += elapsed_us;
+  if (elapsed_us > close_stats_.max_us)
+    close_stats_.max_us = elapsed_us;
+
+  cond_.broadcast();
+  stream->release();
+}
+
 void FileSystem::MakeDirectory(int32_t result, const char* pathname,
-                               int32_t* pres) {
+                               PepperOperation* op) {
   Mutex::Lock lock(mutex_);
   pp::FileRef* file_ref = new pp::FileRef(*ppfs_, pathname);
   result = file_ref->MakeDirectory(PP_MAKEDIRECTORYFLAG_WITH_ANCESTORS,
-      factory_.NewCallback(&FileSystem::OnMakeDirectory, file_ref, pres));
+      factory_.NewCallback(&FileSystem::OnMakeDirectory, file_ref, op));
   if (result != PP_OK_COMPLETIONPENDING) {
     delete file_ref;
-    *pres = result;
-    cond_.broadcast();
+    op->Complete(result);
   }
 }
 
 void FileSystem::OnMakeDirectory(int32_t result, pp::FileRef* file_ref,
-                                 int32_t* pres) {
+                                 PepperOperation* op) {
   Mutex::Lock lock(mutex_);
   delete file_ref;
-  *pres = result;
-  cond_.broadcast();
+  op->Complete(result);
 }
 
 void FileSystem::SetTerminalSize(unsigned short col, unsigned short row) {
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "ppapi/cpp/file_ref.h"
 #include "ppapi/cpp/file_system.h"
@@ -25,6 +26,8 @@
 #include "ppapi/utility/completion_callback_factory.h"
 
 #include "file_interfaces.h"
+#include "mount_table.h"
+#include "pepper_operation.h"
 #include "pthread_helpers.h"
 
 class FileSystem {
@@ -92,26 +95,55 @@ class FileSystem {
   int listen(int sockfd, int backlog);
   int accept(int sockfd, sockaddr* addr, socklen_t* addrlen);
   int getsockname(int s, sockaddr* name, socklen_t* namelen);
+  int getsockopt(int socket, int level, int optname, void* optval,
+                 socklen_t* optlen);
   ssize_t sendto(int sockfd, const char* buf, size_t len, int flags,
                  const sockaddr* dest_addr, socklen_t addrlen);
   ssize_t recvfrom(int socket, char* buffer, size_t len, int flags,
                    sockaddr* addr, socklen_t* addrlen);
 
   int mkdir(const char* pathname, mode_t mode);
+  int unlink(const char* pathname);
+  int rmdir(const char* pathname);
 
   int sigaction(int signum,
                 const struct sigaction* act,
                 struct sigaction* oldact);
   void exit(int status);
 
+  // Close the streams OpenSSH left open and wait a little for their pending
+  // output, as when the session ends.  Returns the close statistics of the
+  // session.
+  CloseStats CloseAllStreams();
+
   void ExitCodeAcked();
 
+  // Finish closing |stream| in the background: its close() returns at once,
+  // and a main thread task calls FinishClose() on all the streams queued
+  // since the last one.  The descriptor stays reserved until then.  A file
+  // that is still being written holds back the opening of other files, so
+  // that they never miss its last writes.
+  void DeferClose(int fd, FileStream* stream, bool is_file);
+  // Called by FinishClose(), possibly later, once the stream's resources are
+  // released.  |dropped| is set if pending output was given up on.
+  void CloseDone(FileStream* stream, bool dropped);
+
+  // How long a closed stream may wait for its pending output to be sent.
+  static const int32_t kCloseLingerMs = 5000;
+
  private:
   typedef std::map<int, FileStream*> FileStreamMap;
-  typedef std::map<std::string, PathHandler*> PathHandlerMap;
   typedef std::map<std::string, unsigned long> HostMap;
   typedef std::map<unsigned long, std::string> AddressMap;
   typedef std::map<int, int> SocketTypesMap;
+  typedef std::map<int, int> SocketFlagsMap;
+
+  struct PendingClose {
+    int fd;
+    bool is_file;
+    int64_t start_us;
+  };
+  typedef std::map<FileStream*, PendingClose> PendingCloseMap;
 
   struct GetAddrInfoParams {
     const char* hostname;
@@ -121,6 +153,9 @@ class FileSystem {
   };
 
   void AddPathHandler(const std::string& path, PathHandler* handler);
+  // Return the handler mounted over |pathname|, or NULL if the path belongs
+  // to the HTML5 file system.
+  PathHandler* FindPathHandler(const char* pathname);
   void AddFileStream(int fd, FileStream* stream);
   void RemoveFileStream(int fd);
 
@@ -137,13 +172,20 @@ class FileSystem {
                    std::string* hostname, uint16_t* port);
   bool IsAgentConnect(const sockaddr* serv_addr, socklen_t addrlen,
                       std::string* hostname, uint16_t* port);
-  void Resolve(int32_t result, GetAddrInfoParams* params, int32_t* pres);
-  void OnResolve(int32_t result, GetAddrInfoParams* params, int32_t* pres);
+  void Resolve(int32_t result, GetAddrInfoParams* params,
+               PepperOperation* op);
+  void OnResolve(int32_t result, GetAddrInfoParams* params,
+                 PepperOperation* op);
 
   void OnOpen(int32_t result, pp::FileSystem* fs);
 
-  void MakeDirectory(int32_t result, const char* pathname, int32_t* pres);
-  void OnMakeDirectory(int32_t result, pp::FileRef* file_ref, int32_t* pres);
+  void FinishCloses(int32_t result);
+  bool IsClosingDescriptor(int fd);
+
+  void MakeDirectory(int32_t result, const char* pathname,
+                     PepperOperation* op);
+  void OnMakeDirectory(int32_t result, pp::FileRef* file_ref,
+                       PepperOperation* op);
 
   int GetFirstUnusedDescriptor();
   int IsReady(int nfds, fd_set* fds, bool (FileStream::*is_ready)(),
@@ -151,6 +193,9 @@ class FileSystem {
   bool IsInterrupted();
 
   static const int kFileIDOffset = 100;
+  // How long exit() waits for closes to finish.
+  static const int64_t kExitLingerUs = 2 * 1000 * 1000;
+  static const size_t kTmpFsMaxBytes = 64 * 1024 * 1024;
   static const unsigned long kFirstAddr = 0x00000000;
 
   static FileSystem* file_system_;
@@ -160,7 +205,7 @@ class FileSystem {
   Cond cond_;
   Mutex mutex_;
 
-  PathHandlerMap paths_;
+  MountTable paths_;
   FileStreamMap streams_;
   pp::FileSystem* ppfs_;
   PathHandler* ppfs_path_handler_;
@@ -168,6 +213,15 @@ class FileSystem {
   pp::CompletionCallbackFactory<FileSystem> factory_;
   bool exit_code_acked_;
 
+  // Streams closed but not yet finished, and those waiting for the next
+  // FinishCloses() task.
+  PendingCloseMap pending_closes_;
+  std::vector<FileStream*> close_queue_;
+  bool close_task_sent_;
+  bool finishing_closes_;
+  int file_closes_;
+  CloseStats close_stats_;
+
   pp::HostResolverPrivate* host_resolver_;
 
   HostMap hosts_;
@@ -183,6 +237,8 @@ class FileSystem {
   // TODO(dpolukhin): remove this map and put all socket related info into
   // FileStream with type socket.
   SocketTypesMap socket_types_;
+  // File status flags set on sockets that aren't connected yet.
+  SocketFlagsMap socket_flags_;
 
   DISALLOW_COPY_AND_ASSIGN(FileSystem);
 };
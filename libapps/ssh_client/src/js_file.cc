@@ -38,7 +38,7 @@ void JsFileHandler::Open(int32_t result, JsFile* stream, const char* pathname) {
 }
 
 FileStream* JsFileHandler::open(int fd, const char* pathname, int oflag,
-                                int* err) {
+                                mode_t cmode, int* err) {
   JsFile* stream = new JsFile(fd, (oflag & ~O_NONBLOCK), out_);
   pp::Module::Get()->core()->CallOnMainThread(0,
       factory_.NewCallback(&JsFileHandler::Open, stream, pathname));
@@ -67,7 +67,8 @@ JsFile::JsFile(int fd, int oflag, OutputInterface* out)
     factory_(this), out_task_sent_(false), is_open_(false),
     is_atty_(false), is_read_ready_(false),
     write_sent_(0), write_acknowledged_(0),
-    on_read_call_count_(0) {
+    on_read_call_count_(0), closing_(false), lingering_(false),
+    close_dropped_(false) {
 }
 
 JsFile::~JsFile() {
@@ -138,6 +139,8 @@ void JsFile::OnClose() {
   Mutex::Lock lock(sys->mutex());
   is_open_ = false;
   sys->cond().broadcast();
+  if (closing_)
+    Teardown();
 }
 
 void JsFile::OnReadReady(bool is_read_ready) {
@@ -161,18 +164,10 @@ FileStream* JsFile::dup(int fd) {
 }
 
 void JsFile::close() {
-  if (is_open()) {
+  if (is_open() && !closing_) {
     assert(fd_ >= 3);
-    pp::Module::Get()->core()->CallOnMainThread(0,
-        factory_.NewCallback(&JsFile::Close));
-
-    FileSystem* sys = FileSystem::GetFileSystem();
-    while (out_task_sent_)
-      sys->cond().wait(sys->mutex());
-    while (is_open_)
-      sys->cond().wait(sys->mutex());
-
-    fd_ = -1;
+    closing_ = true;
+    FileSystem::GetFileSystem()->DeferClose(fd_, this, false);
   }
 }
 
@@ -373,6 +368,7 @@ void JsFile::Write(int32_t result) {
   if (count == 0) {
     LOG("JsFile::Write: %d is not ready for write, cached %d\n",
         fd_, out_buf_.size());
+    CheckLinger();
     return;
   }
 
@@ -389,10 +385,48 @@ void JsFile::Write(int32_t result) {
     assert(0);
     PostWriteTask(true);
   }
+  CheckLinger();
+}
+
+void JsFile::FinishClose() {
+  if (!is_open_) {
+    // JS closed it first.
+    Teardown();
+  } else if (out_task_sent_ || !out_buf_.empty()) {
+    // Linger until what was written before close() is sent.  The close
+    // finishes when JS acknowledges it, in OnClose().
+    lingering_ = true;
+    pp::Module::Get()->core()->CallOnMainThread(FileSystem::kCloseLingerMs,
+        factory_.NewCallback(&JsFile::OnLingerTimeout));
+  } else {
+    out_->Close(fd_);
+  }
+}
+
+void JsFile::CheckLinger() {
+  if (lingering_ && !out_task_sent_ && out_buf_.empty()) {
+    lingering_ = false;
+    out_->Close(fd_);
+  }
+}
+
+void JsFile::OnLingerTimeout(int32_t result) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  if (lingering_) {
+    LOG("JsFile::OnLingerTimeout: %d dropping %d bytes\n",
+        fd_, out_buf_.size());
+    lingering_ = false;
+    close_dropped_ = true;
+    out_->Close(fd_);
+  }
 }
 
-void JsFile::Close(int32_t result) {
-  out_->Close(fd_);
+void JsFile::Teardown() {
+  // This may drop the last reference, so it must come last.
+  closing_ = false;
+  lingering_ = false;
+  FileSystem::GetFileSystem()->CloseDone(this, close_dropped_);
 }
 
 //------------------------------------------------------------------------------
@@ -49,12 +49,17 @@ class JsFile : public FileStream,
   virtual bool is_read_ready();
   virtual bool is_write_ready();
 
+  virtual void FinishClose();
+
  protected:
   void PostWriteTask(bool always_post);
+  // Ask JS to close the stream once a close no longer waits for output.
+  void CheckLinger();
+  void OnLingerTimeout(int32_t result);
+  void Teardown();
 
   void Read(int32_t result, size_t size);
   void Write(int32_t result);
-  void Close(int32_t result);
 
   int ref_;
   int fd_;
@@ -70,6 +75,9 @@ class JsFile : public FileStream,
   uint64_t write_sent_;
   uint64_t write_acknowledged_;
   uint64_t on_read_call_count_;
+  bool closing_;
+  bool lingering_;
+  bool close_dropped_;
   static termios tio_;
 
  private:
@@ -86,7 +94,8 @@ class JsFileHandler : public PathHandler {
 
   void Open(int32_t result, JsFile* stream, const char* pathname);
 
-  virtual FileStream* open(int fd, const char* pathname, int oflag, int* err);
+  virtual FileStream* open(int fd, const char* pathname, int oflag,
+                           mode_t cmode, int* err);
   virtual int stat(const char* pathname, nacl_abi_stat* out);
 
  private:
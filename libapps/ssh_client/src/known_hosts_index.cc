@@ -0,0 +1,484 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "known_hosts_index.h"
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <map>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+namespace {
+
+// Read up to |count| bytes at |offset|, returning the number read or -1.
+ssize_t ReadAt(int fd, uint32_t offset, char* buf, size_t count) {
+  if (lseek(fd, offset, SEEK_SET) < 0)
+    return -1;
+
+  size_t done = 0;
+  while (done < count) {
+    ssize_t n = read(fd, buf + done, count - done);
+    if (n < 0)
+      return -1;
+    if (!n)
+      break;
+    done += n;
+  }
+  return done;
+}
+
+bool WriteAll(int fd, const void* buf, size_t count) {
+  const char* p = static_cast<const char*>(buf);
+  while (count) {
+    ssize_t n = write(fd, p, count);
+    if (n <= 0)
+      return false;
+    p += n;
+    count -= n;
+  }
+  return true;
+}
+
+// Decode base64 holding exactly |size| bytes.
+bool DecodeBase64(const std::string& in, uint8_t* out, size_t size) {
+  // EVP_DecodeBlock() counts the padding in its result.
+  std::vector<unsigned char> buf(in.size() / 4 * 3 + 3);
+  int n = EVP_DecodeBlock(&buf[0],
+                          reinterpret_cast<const unsigned char*>(in.data()),
+                          in.size());
+  size_t padding = std::count(in.begin(), in.end(), '=');
+  if (n < 0 || (size_t)n - padding != size)
+    return false;
+  memcpy(out, &buf[0], size);
+  return true;
+}
+
+// The indexes of known_hosts files, and the line numbers of views, kept for
+// the life of the session.  Only used from the OpenSSH thread.
+std::map<std::string, KnownHostsIndex*> g_indexes;
+std::map<std::string, std::vector<unsigned long> > g_views;
+int g_view_count = 0;
+
+}  // namespace
+
+const char KnownHostsIndex::kMagic[4] = {'K', 'H', 'I', 'X'};
+const uint32_t KnownHostsIndex::kVersion;
+const uint32_t KnownHostsIndex::kWildcardKey;
+const size_t KnownHostsIndex::kReadSize;
+
+KnownHostsIndex::KnownHostsIndex(const std::string& path)
+    : path_(path), index_path_(path + ".idx"), loaded_(false) {
+  memset(&header_, 0, sizeof(header_));
+}
+
+KnownHostsIndex::~KnownHostsIndex() {
+}
+
+bool KnownHostsIndex::Update() {
+  int fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) || st.st_size > UINT32_MAX) {
+    close(fd);
+    return false;
+  }
+  uint32_t size = st.st_size;
+  int64_t mtime = st.st_mtime;
+
+  if (!loaded_)
+    loaded_ = Load();
+
+  bool ok = true;
+  if (loaded_ && size == header_.file_size && mtime == header_.file_mtime) {
+    // Up to date.
+  } else {
+    // Lines were only appended if known_hosts grew and still starts with the
+    // bytes that were indexed.  An edit that keeps the size rewrote earlier
+    // lines.
+    uint32_t prefix_hash;
+    bool appended = loaded_ && size > header_.file_size &&
+        PrefixHash(fd, header_.file_size, &prefix_hash) &&
+        prefix_hash == header_.prefix_hash;
+    if (!appended) {
+      memset(&header_, 0, sizeof(header_));
+      entries_.clear();
+      hashed_.clear();
+    }
+    ok = IndexFrom(fd, size, mtime);
+    if (ok) {
+      loaded_ = true;
+      Save();
+    }
+  }
+
+  close(fd);
+  return ok;
+}
+
+void KnownHostsIndex::Lookup(const std::string& host,
+                             std::vector<Line>* lines) const {
+  lines->clear();
+  if (buckets_.empty())
+    return;
+
+  std::string name(host);
+  std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+  uint32_t keys[] = {HashKey(name.data(), name.size()), kWildcardKey};
+
+  for (size_t k = 0; k < sizeof(keys) / sizeof(keys[0]); ++k) {
+    uint32_t i = buckets_[keys[k] % buckets_.size()];
+    while (i && i <= entries_.size()) {
+      const Entry& entry = entries_[i - 1];
+      if (entry.key == keys[k])
+        lines->push_back(entry.line);
+      i = entry.next;
+    }
+  }
+
+  // OpenSSH hashes the name as given.
+  for (size_t i = 0; i < hashed_.size(); ++i) {
+    if (IsHashedMatch(hashed_[i], host))
+      lines->push_back(hashed_[i].line);
+  }
+
+  std::sort(lines->begin(), lines->end());
+  size_t count = 0;
+  for (size_t i = 0; i < lines->size(); ++i) {
+    if (!count || (*lines)[i].offset != (*lines)[count - 1].offset)
+      (*lines)[count++] = (*lines)[i];
+  }
+  lines->resize(count);
+}
+
+bool KnownHostsIndex::ReadLine(int fd, const Line& line, std::string* text) {
+  text->clear();
+  char buf[1024];
+  uint32_t offset = line.offset;
+  for (;;) {
+    ssize_t n = ReadAt(fd, offset, buf, sizeof(buf));
+    if (n < 0)
+      return false;
+    const char* end = static_cast<const char*>(memchr(buf, '\n', n));
+    text->append(buf, end ? end - buf : n);
+    if (end || (size_t)n < sizeof(buf))
+      return true;
+    offset += n;
+  }
+}
+
+bool KnownHostsIndex::Load() {
+  int fd = open(index_path_.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  bool ok = false;
+  struct stat st;
+  Header header;
+  if (!fstat(fd, &st) &&
+      ReadAt(fd, 0, reinterpret_cast<char*>(&header), sizeof(header)) ==
+          sizeof(header) &&
+      !memcmp(header.magic, kMagic, sizeof(kMagic)) &&
+      header.version == kVersion &&
+      header.bucket_count ==
+          std::max<uint32_t>(header.entry_count, 1) * 2 &&
+      (uint64_t)st.st_size ==
+          sizeof(header) + header.bucket_count * sizeof(uint32_t) +
+          (uint64_t)header.entry_count * sizeof(Entry) +
+          (uint64_t)header.hashed_count * sizeof(HashedEntry)) {
+    std::vector<uint32_t> buckets(header.bucket_count);
+    std::vector<Entry> entries(header.entry_count);
+    std::vector<HashedEntry> hashed(header.hashed_count);
+    size_t sizes[] = {buckets.size() * sizeof(uint32_t),
+                      entries.size() * sizeof(Entry),
+                      hashed.size() * sizeof(HashedEntry)};
+    char* data[] = {reinterpret_cast<char*>(buckets.data()),
+                    reinterpret_cast<char*>(entries.data()),
+                    reinterpret_cast<char*>(hashed.data())};
+
+    ok = true;
+    uint32_t offset = sizeof(header);
+    for (size_t i = 0; ok && i < 3; ++i) {
+      ok = ReadAt(fd, offset, data[i], sizes[i]) == (ssize_t)sizes[i];
+      offset += sizes[i];
+    }
+
+    if (ok) {
+      header_ = header;
+      buckets_.swap(buckets);
+      entries_.swap(entries);
+      hashed_.swap(hashed);
+    }
+  }
+
+  close(fd);
+  return ok;
+}
+
+void KnownHostsIndex::Save() {
+  int fd = open(index_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd < 0)
+    return;
+
+  // A partly written index fails to load, and is rebuilt.
+  if (WriteAll(fd, &header_, sizeof(header_)) &&
+      WriteAll(fd, buckets_.data(), buckets_.size() * sizeof(uint32_t)) &&
+      WriteAll(fd, entries_.data(), entries_.size() * sizeof(Entry))) {
+    WriteAll(fd, hashed_.data(), hashed_.size() * sizeof(HashedEntry));
+  }
+  close(fd);
+}
+
+bool KnownHostsIndex::PrefixHash(int fd, uint32_t end, uint32_t* hash) {
+  // FNV-1a, like HashKey(), over the file in chunks.
+  std::vector<char> buf(kReadSize);
+  uint32_t h = 2166136261u;
+  for (uint32_t offset = 0; offset < end; ) {
+    size_t count = std::min<size_t>(end - offset, buf.size());
+    if (ReadAt(fd, offset, &buf[0], count) != (ssize_t)count)
+      return false;
+    for (size_t i = 0; i < count; ++i) {
+      h ^= (uint8_t)buf[i];
+      h *= 16777619u;
+    }
+    offset += count;
+  }
+  *hash = h;
+  return true;
+}
+
+bool KnownHostsIndex::IndexFrom(int fd, uint32_t size, int64_t mtime) {
+  // The last line was indexed without its newline, and is indexed again.
+  uint32_t start = header_.indexed_end;
+  size_t i = 0;
+  for (size_t j = 0; j < entries_.size(); ++j) {
+    if (entries_[j].line.offset < start)
+      entries_[i++] = entries_[j];
+  }
+  entries_.resize(i);
+  i = 0;
+  for (size_t j = 0; j < hashed_.size(); ++j) {
+    if (hashed_[j].line.offset < start)
+      hashed_[i++] = hashed_[j];
+  }
+  hashed_.resize(i);
+
+  std::vector<char> buf(kReadSize);
+  std::string pending;
+  uint32_t offset = start;
+  Line line;
+  line.offset = start;
+  line.number = header_.line_count;
+
+  for (;;) {
+    ssize_t n = ReadAt(fd, offset, &buf[0], buf.size());
+    if (n < 0)
+      return false;
+    if (!n)
+      break;
+    offset += n;
+
+    const char* p = &buf[0];
+    const char* end = p + n;
+    while (const char* nl = static_cast<const char*>(memchr(p, '\n', end - p))) {
+      pending.append(p, nl - p);
+      ++line.number;
+      IndexLine(pending.data(), pending.size(), line);
+      line.offset += pending.size() + 1;
+      pending.clear();
+      p = nl + 1;
+    }
+    pending.append(p, end - p);
+  }
+
+  header_.indexed_end = line.offset;
+  header_.line_count = line.number;
+  if (!pending.empty()) {
+    // OpenSSH reads a last line without a newline too.
+    ++line.number;
+    IndexLine(pending.data(), pending.size(), line);
+  }
+
+  memcpy(header_.magic, kMagic, sizeof(kMagic));
+  header_.version = kVersion;
+  header_.file_size = offset;
+  header_.file_mtime = mtime;
+  if (!PrefixHash(fd, offset, &header_.prefix_hash))
+    return false;
+
+  BuildBuckets();
+  return true;
+}
+
+void KnownHostsIndex::IndexLine(const char* text, size_t size,
+                                const Line& line) {
+  const char* p = text;
+  const char* end = text + size;
+  while (p < end && isspace(*p))
+    ++p;
+  if (p == end || *p == '#')
+    return;
+
+  // Skip markers such as @cert-authority and @revoked.
+  if (*p == '@') {
+    while (p < end && !isspace(*p))
+      ++p;
+    while (p < end && isspace(*p))
+      ++p;
+  }
+
+  const char* hosts_end = p;
+  while (hosts_end < end && !isspace(*hosts_end))
+    ++hosts_end;
+
+  bool wildcard = false;
+  while (p < hosts_end) {
+    const char* comma = std::find(p, hosts_end, ',');
+    std::string pattern(p, comma);
+    p = comma + (comma < hosts_end);
+
+    if (pattern.empty() || pattern[0] == '!') {
+      // Negations never make a line match.
+      continue;
+    }
+
+    if (!pattern.compare(0, 3, "|1|")) {
+      HashedEntry hashed;
+      size_t bar = pattern.find('|', 3);
+      if (bar != std::string::npos &&
+          DecodeBase64(pattern.substr(3, bar - 3), hashed.salt,
+                       sizeof(hashed.salt)) &&
+          DecodeBase64(pattern.substr(bar + 1), hashed.hash,
+                       sizeof(hashed.hash))) {
+        hashed.line = line;
+        hashed_.push_back(hashed);
+      } else {
+        wildcard = true;
+      }
+    } else if (pattern.find_first_of("*?") != std::string::npos) {
+      wildcard = true;
+    } else {
+      std::transform(pattern.begin(), pattern.end(), pattern.begin(),
+                     ::tolower);
+      Entry entry;
+      entry.key = HashKey(pattern.data(), pattern.size());
+      entry.line = line;
+      entries_.push_back(entry);
+    }
+  }
+
+  if (wildcard) {
+    Entry entry;
+    entry.key = kWildcardKey;
+    entry.line = line;
+    entries_.push_back(entry);
+  }
+}
+
+void KnownHostsIndex::BuildBuckets() {
+  buckets_.assign(std::max<size_t>(entries_.size(), 1) * 2, 0);
+  // Chain in reverse, so that each bucket lists its entries in order.
+  for (size_t i = entries_.size(); i--; ) {
+    uint32_t& bucket = buckets_[entries_[i].key % buckets_.size()];
+    entries_[i].next = bucket;
+    bucket = i + 1;
+  }
+
+  header_.bucket_count = buckets_.size();
+  header_.entry_count = entries_.size();
+  header_.hashed_count = hashed_.size();
+}
+
+uint32_t KnownHostsIndex::HashKey(const char* key, size_t size) {
+  // FNV-1a, kept clear of the wildcard key.
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= (uint8_t)key[i];
+    hash *= 16777619u;
+  }
+  return hash == kWildcardKey ? 1 : hash;
+}
+
+bool KnownHostsIndex::IsHashedMatch(const HashedEntry& entry,
+                                    const std::string& host) {
+  uint8_t hash[EVP_MAX_MD_SIZE];
+  unsigned int size = 0;
+  HMAC(EVP_sha1(), entry.salt, sizeof(entry.salt),
+       reinterpret_cast<const unsigned char*>(host.data()), host.size(),
+       hash, &size);
+  return size == sizeof(entry.hash) && !memcmp(hash, entry.hash, size);
+}
+
+//------------------------------------------------------------------------------
+
+extern "C" {
+
+char* nacl_known_hosts_view(const char* path, const char* host) {
+  KnownHostsIndex*& index = g_indexes[path];
+  if (!index)
+    index = new KnownHostsIndex(path);
+  if (!index->Update())
+    return NULL;
+
+  std::vector<KnownHostsIndex::Line> lines;
+  index->Lookup(host, &lines);
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    return NULL;
+
+  char view[64];
+  snprintf(view, sizeof(view), "/tmp/known_hosts.view.%d", ++g_view_count);
+  int view_fd = open(view, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (view_fd < 0) {
+    close(fd);
+    return NULL;
+  }
+
+  std::vector<unsigned long>& numbers = g_views[view];
+  numbers.clear();
+  bool ok = true;
+  std::string text;
+  for (size_t i = 0; ok && i < lines.size(); ++i) {
+    ok = KnownHostsIndex::ReadLine(fd, lines[i], &text);
+    text += '\n';
+    ok = ok && WriteAll(view_fd, text.data(), text.size());
+    numbers.push_back(lines[i].number);
+  }
+  close(view_fd);
+  close(fd);
+
+  if (!ok) {
+    unlink(view);
+    g_views.erase(view);
+    return NULL;
+  }
+  return strdup(view);
+}
+
+unsigned long nacl_known_hosts_view_line(const char* view, unsigned long line) {
+  std::map<std::string, std::vector<unsigned long> >::iterator it =
+      g_views.find(view);
+  if (it == g_views.end() || !line || line > it->second.size())
+    return line;
+  return it->second[line - 1];
+}
+
+void nacl_known_hosts_view_done(char* view) {
+  unlink(view);
+  g_views.erase(view);
+  free(view);
+}
+
+}  // extern "C"
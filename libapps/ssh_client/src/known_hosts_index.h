@@ -0,0 +1,132 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef KNOWN_HOSTS_INDEX_H
+#define KNOWN_HOSTS_INDEX_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "pthread_helpers.h"
+
+// An index of a known_hosts file, kept in a file next to it, so that host key
+// lookups need not read and parse the whole file on every connection.
+//
+// Literal host names map to the lines naming them through a hash table, and
+// lines with wildcard patterns are always candidates.  Hashed host names can
+// only be checked by computing an HMAC with the salt of each line; the index
+// keeps the salts and hashes so that this needs no reading of known_hosts.
+// Candidates may be false positives, OpenSSH matches them again; they are
+// never false negatives.
+//
+// The index is used as is while known_hosts has the size and modification time
+// it had.  When known_hosts grew and still starts with the bytes that were
+// indexed, as when OpenSSH appends a new host key, only the new lines are
+// indexed; any other change rebuilds the index.
+class KnownHostsIndex {
+ public:
+  // A candidate line: its byte offset and its line number, from 1.
+  struct Line {
+    uint32_t offset;
+    uint32_t number;
+
+    bool operator<(const Line& other) const { return offset < other.offset; }
+  };
+
+  explicit KnownHostsIndex(const std::string& path);
+  ~KnownHostsIndex();
+
+  // Bring the index up to date with known_hosts, reading the saved index if
+  // needed.  Returns false if known_hosts can't be read.
+  bool Update();
+
+  // Fill |lines| with the lines that may match |host|, in file order.
+  void Lookup(const std::string& host, std::vector<Line>* lines) const;
+
+  // Read the text of |line| from |fd|, an open known_hosts, without its
+  // newline.
+  static bool ReadLine(int fd, const Line& line, std::string* text);
+
+ private:
+  struct Header {
+    // Laid out so that 32 and 64 bit builds agree.
+    char magic[4];
+    uint32_t version;
+    int64_t file_mtime;
+    // The size of known_hosts when it was indexed, and the end of its last
+    // complete line, where indexing resumes when lines are appended.
+    uint32_t file_size;
+    uint32_t indexed_end;
+    uint32_t line_count;
+    // Hash of the first file_size bytes.
+    uint32_t prefix_hash;
+    uint32_t bucket_count;
+    uint32_t entry_count;
+    uint32_t hashed_count;
+    uint32_t unused;
+  };
+
+  struct Entry {
+    uint32_t key;
+    // Index of the next entry with the same bucket, plus one.
+    uint32_t next;
+    Line line;
+  };
+
+  struct HashedEntry {
+    Line line;
+    uint8_t salt[20];
+    uint8_t hash[20];
+  };
+
+  bool Load();
+  void Save();
+  // Hash the first |end| bytes of known_hosts, or return false if they can't
+  // be read.
+  static bool PrefixHash(int fd, uint32_t end, uint32_t* hash);
+  // Index the lines of known_hosts from indexed_end on, dropping the entries
+  // of a last line that had no newline.
+  bool IndexFrom(int fd, uint32_t size, int64_t mtime);
+  void IndexLine(const char* text, size_t size, const Line& line);
+  void BuildBuckets();
+
+  static uint32_t HashKey(const char* key, size_t size);
+  static bool IsHashedMatch(const HashedEntry& entry, const std::string& host);
+
+  static const char kMagic[4];
+  static const uint32_t kVersion = 2;
+  // Key of the lines with wildcard patterns.
+  static const uint32_t kWildcardKey = 0;
+  static const size_t kReadSize = 64 * 1024;
+
+  std::string path_;
+  std::string index_path_;
+  bool loaded_;
+  Header header_;
+  std::vector<uint32_t> buckets_;
+  std::vector<Entry> entries_;
+  std::vector<HashedEntry> hashed_;
+
+  DISALLOW_COPY_AND_ASSIGN(KnownHostsIndex);
+};
+
+// Entry points for the OpenSSH host file code.
+extern "C" {
+
+// Write the lines of the known_hosts file at |path| that may match |host| to
+// a file in /tmp, and return its path, to be given back to
+// nacl_known_hosts_view_done().  Returns NULL if there's no index to use.
+char* nacl_known_hosts_view(const char* path, const char* host);
+
+// Return the line number in known_hosts of line |line| of a view.
+unsigned long nacl_known_hosts_view_line(const char* view, unsigned long line);
+
+// Remove a view.
+void nacl_known_hosts_view_done(char* view);
+
+}  // extern "C"
+
+#endif  // KNOWN_HOSTS_INDEX_H
@@ -0,0 +1,102 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "mount_table.h"
+
+#include <assert.h>
+
+MountTable::MountTable() {
+}
+
+MountTable::~MountTable() {
+  if (root_.handler)
+    root_.handler->release();
+  for (std::map<std::string, Node*>::iterator it = root_.children.begin();
+       it != root_.children.end(); ++it) {
+    DeleteNode(it->second);
+  }
+}
+
+void MountTable::DeleteNode(Node* node) {
+  if (node->handler)
+    node->handler->release();
+  for (std::map<std::string, Node*>::iterator it = node->children.begin();
+       it != node->children.end(); ++it) {
+    DeleteNode(it->second);
+  }
+  delete node;
+}
+
+void MountTable::Mount(const std::string& path, PathHandler* handler) {
+  std::vector<std::string> components;
+  bool absolute = SplitPath(path.c_str(), &components);
+  assert(absolute);
+
+  Node* node = &root_;
+  for (size_t i = 0; i < components.size(); ++i) {
+    Node*& child = node->children[components[i]];
+    if (!child)
+      child = new Node();
+    node = child;
+  }
+
+  assert(!node->handler);
+  node->handler = handler;
+}
+
+PathHandler* MountTable::Find(const char* pathname) const {
+  std::vector<std::string> components;
+  if (!SplitPath(pathname, &components))
+    return NULL;
+
+  const Node* node = &root_;
+  PathHandler* handler = root_.handler;
+  for (size_t i = 0; i < components.size(); ++i) {
+    std::map<std::string, Node*>::const_iterator it =
+        node->children.find(components[i]);
+    if (it == node->children.end())
+      break;
+    node = it->second;
+    if (node->handler)
+      handler = node->handler;
+  }
+  return handler;
+}
+
+bool MountTable::SplitPath(const char* pathname,
+                           std::vector<std::string>* components) {
+  components->clear();
+  if (!pathname || pathname[0] != '/')
+    return false;
+
+  const char* p = pathname;
+  while (*p) {
+    while (*p == '/')
+      ++p;
+    const char* end = p;
+    while (*end && *end != '/')
+      ++end;
+
+    std::string component(p, end - p);
+    if (component == "..") {
+      if (!components->empty())
+        components->pop_back();
+    } else if (!component.empty() && component != ".") {
+      components->push_back(component);
+    }
+    p = end;
+  }
+  return true;
+}
+
+std::string MountTable::NormalizePath(const char* pathname) {
+  std::vector<std::string> components;
+  if (!SplitPath(pathname, &components))
+    return std::string();
+
+  std::string path;
+  for (size_t i = 0; i < components.size(); ++i)
+    path += "/" + components[i];
+  return path.empty() ? "/" : path;
+}
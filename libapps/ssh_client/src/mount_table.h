@@ -0,0 +1,55 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef MOUNT_TABLE_H
+#define MOUNT_TABLE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "file_interfaces.h"
+#include "pthread_helpers.h"
+
+// Maps paths to the PathHandler mounted at their longest matching prefix.
+// Mount points are kept in a trie over path components, so a lookup costs
+// one map search per component of the path, whatever the number of mounts.
+class MountTable {
+ public:
+  MountTable();
+  ~MountTable();
+
+  // Mount |handler| at |path|, taking over the caller's reference.  A mount
+  // point covers the path itself and everything below it.
+  void Mount(const std::string& path, PathHandler* handler);
+
+  // Return the handler of the deepest mount point covering |pathname|, or
+  // NULL if there is none.  Relative paths are never covered.
+  PathHandler* Find(const char* pathname) const;
+
+  // Split an absolute path into its components, resolving "." and "..".
+  // Return false for relative paths.
+  static bool SplitPath(const char* pathname,
+                        std::vector<std::string>* components);
+
+  // Return the canonical form of an absolute path, or an empty string for
+  // relative paths.
+  static std::string NormalizePath(const char* pathname);
+
+ private:
+  struct Node {
+    Node() : handler(NULL) {}
+
+    PathHandler* handler;
+    std::map<std::string, Node*> children;
+  };
+
+  static void DeleteNode(Node* node);
+
+  Node root_;
+
+  DISALLOW_COPY_AND_ASSIGN(MountTable);
+};
+
+#endif  // MOUNT_TABLE_H
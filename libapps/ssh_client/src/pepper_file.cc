@@ -34,7 +34,7 @@ void PepperFileHandler::release() {
 }
 
 FileStream* PepperFileHandler::open(int fd, const char* pathname, int oflag,
-                                    int* err) {
+                                    mode_t cmode, int* err) {
   PepperFile* file = new PepperFile(fd, oflag, file_system_);
   int32_t ret = file->open(pathname);
   if (ret == 0) {
@@ -55,7 +55,8 @@ int PepperFileHandler::stat(const char* pathname, nacl_abi_stat* out) {
 
 PepperFile::PepperFile(int fd, int oflag, pp::FileSystem* file_system)
   : ref_(1), fd_(fd), oflag_(oflag), factory_(this), file_system_(file_system),
-    file_io_(NULL), offset_(0), file_info_(), write_sent_(false) {
+    file_io_(NULL), offset_(0), file_info_(), write_sent_(false),
+    closing_(false), lingering_(false) {
 }
 
 PepperFile::~PepperFile() {
@@ -77,35 +78,29 @@ FileStream* PepperFile::dup(int fd) {
 }
 
 int32_t PepperFile::open(const char* pathname) {
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&PepperFile::Open, pathname, &result));
-  FileSystem* sys = FileSystem::GetFileSystem();
-  while (result == PP_OK_COMPLETIONPENDING)
-    sys->cond().wait(sys->mutex());
+  PepperOperation* op = new PepperOperation();
+  int32_t result = op->Run(
+      factory_.NewCallback(&PepperFile::Open, pathname, op));
+  op->release();
   return result;
 }
 
 void PepperFile::close() {
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&PepperFile::Close, &result));
-  FileSystem* sys = FileSystem::GetFileSystem();
-  while (result == PP_OK_COMPLETIONPENDING)
-    sys->cond().wait(sys->mutex());
+  if (file_io_ && !closing_) {
+    closing_ = true;
+    FileSystem::GetFileSystem()->DeferClose(fd_, this, true);
+  }
 }
 
 int PepperFile::read(char* buf, size_t count, size_t* nread) {
   if (!is_open())
     return EIO;
 
-  FileSystem* sys = FileSystem::GetFileSystem();
   if (is_block() && in_buf_.empty()) {
-    int32_t result = PP_OK_COMPLETIONPENDING;
-    pp::Module::Get()->core()->CallOnMainThread(0,
-        factory_.NewCallback(&PepperFile::Read, count, &result));
-    while (result == PP_OK_COMPLETIONPENDING)
-      sys->cond().wait(sys->mutex());
+    PepperOperation* op = new PepperOperation();
+    int32_t result = op->Run(
+        factory_.NewCallback(&PepperFile::Read, count, op));
+    op->release();
     if (result < 0) {
       *nread = -1;
       return EIO;
@@ -131,12 +126,9 @@ int PepperFile::write(const char* buf, size_t count, size_t* nwrote) {
 
   out_buf_.insert(out_buf_.end(), buf, buf + count);
   if (is_block()) {
-    int32_t result = PP_OK_COMPLETIONPENDING;
-    pp::Module::Get()->core()->CallOnMainThread(0,
-        factory_.NewCallback(&PepperFile::Write, &result));
-    FileSystem* sys = FileSystem::GetFileSystem();
-    while (result == PP_OK_COMPLETIONPENDING)
-      sys->cond().wait(sys->mutex());
+    PepperOperation* op = new PepperOperation();
+    int32_t result = op->Run(factory_.NewCallback(&PepperFile::Write, op));
+    op->release();
     if ((size_t)result != count) {
       *nwrote = -1;
       return EIO;
@@ -148,7 +140,8 @@ int PepperFile::write(const char* buf, size_t count, size_t* nwrote) {
     if (!write_sent_) {
       write_sent_ = true;
       pp::Module::Get()->core()->CallOnMainThread(0,
-        factory_.NewCallback(&PepperFile::Write, (int32_t*)NULL));
+        factory_.NewCallback(&PepperFile::Write,
+                             static_cast<PepperOperation*>(NULL)));
     }
     *nwrote = count;
     return 0;
@@ -186,6 +179,9 @@ int PepperFile::seek(nacl_abi_off_t offset, int whence,
 int PepperFile::fstat(nacl_abi_stat* out) {
   memset(out, 0, sizeof(nacl_abi_stat));
   out->nacl_abi_st_size = file_info_.size;
+  out->nacl_abi_st_atime = file_info_.last_access_time;
+  out->nacl_abi_st_mtime = file_info_.last_modified_time;
+  out->nacl_abi_st_ctime = file_info_.creation_time;
   return 0;
 }
 
@@ -196,8 +192,8 @@ int PepperFile::fcntl(int cmd, va_list ap) {
     int oflag = va_arg(ap, long);
     if (is_block() && (oflag & O_NONBLOCK)) {
       pp::Module::Get()->core()->CallOnMainThread(0,
-          factory_.NewCallback(&PepperFile::Read,
-                                       kBufSize, (int32_t*)NULL));
+          factory_.NewCallback(&PepperFile::Read, kBufSize,
+                               static_cast<PepperOperation*>(NULL)));
     }
     oflag_ = oflag;
     return 0;
@@ -218,7 +214,8 @@ bool PepperFile::is_exception() {
   return !is_open();
 }
 
-void PepperFile::Open(int32_t result, const char* pathname, int32_t* pres) {
+void PepperFile::Open(int32_t result, const char* pathname,
+                      PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   pp::FileRef file_ref(*file_system_, pathname);
@@ -234,28 +231,27 @@ void PepperFile::Open(int32_t result, const char* pathname, int32_t* pres) {
     open_flags |= PP_FILEOPENFLAG_CREATE;
   if (oflag_ & O_TRUNC)
     open_flags |= PP_FILEOPENFLAG_TRUNCATE;
-  *pres = file_io_->Open(file_ref, open_flags,
-      factory_.NewCallback(&PepperFile::OnOpen, pres));
-  if (*pres != PP_OK_COMPLETIONPENDING)
-    sys->cond().broadcast();
+  result = file_io_->Open(file_ref, open_flags,
+      factory_.NewCallback(&PepperFile::OnOpen, op));
+  if (result != PP_OK_COMPLETIONPENDING)
+    op->Complete(result);
 }
 
-void PepperFile::OnOpen(int32_t result, int32_t* pres) {
+void PepperFile::OnOpen(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   if (result == PP_OK) {
     result = file_io_->Query(&file_info_,
-        factory_.NewCallback(&PepperFile::OnQuery, pres));
+        factory_.NewCallback(&PepperFile::OnQuery, op));
     if (result == PP_OK_COMPLETIONPENDING)
       return;
   }
   delete file_io_;
   file_io_ = NULL;
-  *pres = result;
-  sys->cond().broadcast();
+  op->Complete(result);
 }
 
-void PepperFile::OnQuery(int32_t result, int32_t* pres) {
+void PepperFile::OnQuery(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   if (result == PP_OK) {
@@ -269,43 +265,42 @@ void PepperFile::OnQuery(int32_t result, int32_t* pres) {
     delete file_io_;
     file_io_ = NULL;
   }
-  *pres = result;
-  sys->cond().broadcast();
+  op->Complete(result);
 }
 
-void PepperFile::Read(int32_t result, size_t count, int32_t* pres) {
+void PepperFile::Read(int32_t result, size_t count, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   assert(file_io_);
   read_buf_.resize(count);
   result = file_io_->Read(offset_, &read_buf_[0], read_buf_.size(),
-      factory_.NewCallback(&PepperFile::OnRead, pres));
+      factory_.NewCallback(&PepperFile::OnRead, op));
   if (result != PP_OK_COMPLETIONPENDING) {
     delete file_io_;
     file_io_ = NULL;
-    if (pres)
-      *pres = result;
+    if (op)
+      op->Complete(result);
     sys->cond().broadcast();
   }
 }
 
-void PepperFile::OnRead(int32_t result, int32_t* pres) {
+void PepperFile::OnRead(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   if (result >= 0) {
     in_buf_.insert(in_buf_.end(), &read_buf_[0], &read_buf_[0] + result);
-    if (result && !is_block() && in_buf_.size() < kBufSize)
+    if (result && !is_block() && !closing_ && in_buf_.size() < kBufSize)
       Read(PP_OK, kBufSize, NULL);
   } else {
     delete file_io_;
     file_io_ = NULL;
   }
-  if (pres)
-    *pres = result;
+  if (op)
+    op->Complete(result);
   sys->cond().broadcast();
 }
 
-void PepperFile::Write(int32_t result, int32_t* pres) {
+void PepperFile::Write(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   assert(file_io_);
@@ -313,13 +308,13 @@ void PepperFile::Write(int32_t result, int32_t* pres) {
     if (write_buf_.size()) {
       // Previous write operation is in progress.
       pp::Module::Get()->core()->CallOnMainThread(1,
-          factory_.NewCallback(&PepperFile::Write, &result));
+          factory_.NewCallback(&PepperFile::Write, op));
       return;
     }
     assert(out_buf_.size());
     write_buf_.swap(out_buf_);
     result = file_io_->Write(offset_, &write_buf_[0], write_buf_.size(),
-        factory_.NewCallback(&PepperFile::OnWrite, pres));
+        factory_.NewCallback(&PepperFile::OnWrite, op));
     write_sent_ = false;
   } else {
     result = PP_ERROR_FAILED;
@@ -327,13 +322,14 @@ void PepperFile::Write(int32_t result, int32_t* pres) {
   if (result != PP_OK_COMPLETIONPENDING) {
     delete file_io_;
     file_io_ = NULL;
-    if (pres)
-      *pres = result;
+    if (op)
+      op->Complete(result);
     sys->cond().broadcast();
+    PostLingerCheck();
   }
 }
 
-void PepperFile::OnWrite(int32_t result, int32_t* pres) {
+void PepperFile::OnWrite(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   if ((size_t)result != write_buf_.size()) {
@@ -342,18 +338,53 @@ void PepperFile::OnWrite(int32_t result, int32_t* pres) {
   } else {
     offset_ += result;
   }
-  if (pres)
-    *pres = result;
+  if (op)
+    op->Complete(result);
   write_buf_.clear();
   sys->cond().broadcast();
+  PostLingerCheck();
+}
+
+void PepperFile::FinishClose() {
+  if (is_open() && (write_sent_ || !write_buf_.empty())) {
+    // Let the writes made before close() land before releasing the file.
+    lingering_ = true;
+    pp::Module::Get()->core()->CallOnMainThread(FileSystem::kCloseLingerMs,
+        factory_.NewCallback(&PepperFile::OnLingerTimeout));
+  } else {
+    Teardown(false);
+  }
 }
 
-void PepperFile::Close(int32_t result, int32_t* pres) {
+void PepperFile::PostLingerCheck() {
+  if (lingering_) {
+    pp::Module::Get()->core()->CallOnMainThread(0,
+        factory_.NewCallback(&PepperFile::CheckLinger));
+  }
+}
+
+void PepperFile::CheckLinger(int32_t result) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  if (lingering_ && (!is_open() || (!write_sent_ && write_buf_.empty())))
+    Teardown(false);
+}
+
+void PepperFile::OnLingerTimeout(int32_t result) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
+  if (lingering_) {
+    LOG("PepperFile::OnLingerTimeout: %d dropping %d bytes\n",
+        fd_, out_buf_.size() + write_buf_.size());
+    Teardown(true);
+  }
+}
+
+void PepperFile::Teardown(bool dropped) {
+  // This may drop the last reference, so it must come last.
+  closing_ = false;
+  lingering_ = false;
   delete file_io_;
   file_io_ = NULL;
-  if (pres)
-    *pres = PP_OK;
-  sys->cond().broadcast();
+  FileSystem::GetFileSystem()->CloseDone(this, dropped);
 }
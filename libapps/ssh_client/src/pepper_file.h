@@ -13,6 +13,7 @@
 #include "ppapi/cpp/file_system.h"
 
 #include "file_interfaces.h"
+#include "pepper_operation.h"
 #include "pthread_helpers.h"
 
 class PepperFileHandler : public PathHandler {
@@ -23,7 +24,8 @@ class PepperFileHandler : public PathHandler {
   virtual void addref();
   virtual void release();
 
-  virtual FileStream* open(int fd, const char* pathname, int oflag, int* err);
+  virtual FileStream* open(int fd, const char* pathname, int oflag,
+                           mode_t cmode, int* err);
   virtual int stat(const char* pathname, nacl_abi_stat* out);
 
  private:
@@ -60,18 +62,24 @@ class PepperFile : public FileStream {
   virtual bool is_write_ready();
   virtual bool is_exception();
 
+  virtual void FinishClose();
+
  private:
-  void Open(int32_t result, const char* pathname, int32_t* pres);
-  void OnOpen(int32_t result, int32_t* pres);
-  void OnQuery(int32_t result, int32_t* pres);
+  void Open(int32_t result, const char* pathname, PepperOperation* op);
+  void OnOpen(int32_t result, PepperOperation* op);
+  void OnQuery(int32_t result, PepperOperation* op);
 
-  void Read(int32_t result, size_t count, int32_t* pres);
-  void OnRead(int32_t result, int32_t* pres);
+  void Read(int32_t result, size_t count, PepperOperation* op);
+  void OnRead(int32_t result, PepperOperation* op);
 
-  void Write(int32_t result, int32_t* pres);
-  void OnWrite(int32_t result, int32_t* pres);
+  void Write(int32_t result, PepperOperation* op);
+  void OnWrite(int32_t result, PepperOperation* op);
 
-  void Close(int32_t result, int32_t* pres);
+  // Release the file once a close no longer waits for pending writes.
+  void PostLingerCheck();
+  void CheckLinger(int32_t result);
+  void OnLingerTimeout(int32_t result);
+  void Teardown(bool dropped);
 
   static const size_t kBufSize = 64 * 1024;
 
@@ -88,6 +96,8 @@ class PepperFile : public FileStream {
   std::vector<char> read_buf_;
   std::vector<char> write_buf_;
   bool write_sent_;
+  bool closing_;
+  bool lingering_;
 
   DISALLOW_COPY_AND_ASSIGN(PepperFile);
 };
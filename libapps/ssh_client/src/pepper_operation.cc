@@ -0,0 +1,64 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "pepper_operation.h"
+
+#include "ppapi/cpp/module.h"
+
+#include "file_system.h"
+
+PepperOperation::PepperOperation()
+  : ref_(1), result_(PP_OK_COMPLETIONPENDING), running_(false),
+    cancelled_(false) {
+}
+
+PepperOperation::~PepperOperation() {
+  assert(!ref_);
+  assert(!running_);
+}
+
+void PepperOperation::addref() {
+  ++ref_;
+}
+
+void PepperOperation::release() {
+  if (!--ref_)
+    delete this;
+}
+
+void PepperOperation::Start(const pp::CompletionCallback& callback) {
+  assert(!running_ && !is_done());
+  running_ = true;
+  addref();
+  pp::Module::Get()->core()->CallOnMainThread(0, callback);
+}
+
+int32_t PepperOperation::Wait() {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  while (!is_done())
+    sys->cond().wait(sys->mutex());
+  return result_;
+}
+
+int32_t PepperOperation::Run(const pp::CompletionCallback& callback) {
+  Start(callback);
+  return Wait();
+}
+
+void PepperOperation::Cancel() {
+  cancelled_ = true;
+  if (!is_done()) {
+    result_ = PP_ERROR_ABORTED;
+    FileSystem::GetFileSystem()->cond().broadcast();
+  }
+}
+
+void PepperOperation::Complete(int32_t result) {
+  assert(running_ && result != PP_OK_COMPLETIONPENDING);
+  running_ = false;
+  if (!cancelled_)
+    result_ = result;
+  FileSystem::GetFileSystem()->cond().broadcast();
+  release();
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef PEPPER_OPERATION_H
+#define PEPPER_OPERATION_H
+
+#include "ppapi/c/pp_errors.h"
+#include "ppapi/cpp/completion_callback.h"
+
+#include "pthread_helpers.h"
+
+// One request to the Pepper main thread, and its result.
+//
+// The OpenSSH thread posts the task that starts the request with Start(),
+// passing the operation along to it, and the main thread side reports the
+// result with Complete().  A blocking syscall calls Wait() right away; a
+// nonblocking one keeps the operation and checks is_done() later, so one
+// thread can have any number of requests in flight and wait for them in
+// select().  Giving up with Cancel() doesn't wait for the main thread: the
+// task sees is_cancelled() and undoes what it did instead.
+//
+// Every method must be called with the file system mutex held.  Start() takes
+// a reference for the main thread side, which Complete() drops, so the task
+// must call Complete() exactly once, whether it succeeded, failed or was
+// cancelled.
+class PepperOperation {
+ public:
+  PepperOperation();
+
+  void addref();
+  void release();
+
+  // Post |callback| to the main thread.
+  void Start(const pp::CompletionCallback& callback);
+  // Wait until the operation completes or is cancelled, and return its result.
+  int32_t Wait();
+  // Start(|callback|) and Wait() for it.
+  int32_t Run(const pp::CompletionCallback& callback);
+  // Stop waiting: the result becomes PP_ERROR_ABORTED unless it's known.
+  void Cancel();
+
+  // Called by the main thread side when the request is done.
+  void Complete(int32_t result);
+
+  bool is_done() { return result_ != PP_OK_COMPLETIONPENDING; }
+  bool is_running() { return running_; }
+  bool is_cancelled() { return cancelled_; }
+  int32_t result() { return result_; }
+
+ private:
+  ~PepperOperation();
+
+  int ref_;
+  int32_t result_;
+  bool running_;
+  bool cancelled_;
+
+  DISALLOW_COPY_AND_ASSIGN(PepperOperation);
+};
+
+#endif  // PEPPER_OPERATION_H
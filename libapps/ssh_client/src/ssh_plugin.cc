@@ -8,11 +8,15 @@
 #include <string.h>
 #include <resolv.h>
 
+#include <algorithm>
+
 #include "ppapi/cpp/module.h"
+#include "ppapi/cpp/var_array_buffer.h"
 
 #include "json/reader.h"
 #include "json/writer.h"
 
+#include "aes_ctr_mt.h"
 #include "file_system.h"
 
 const char kMessageNameAttr[] = "name";
@@ -28,6 +32,17 @@ const char kOnCloseMethodId[] = "onClose";
 const char kOnReadReadyMethodId[] = "onReadReady";
 const char kOnResizeMethodId[] = "onResize";
 const char kOnExitAcknowledgeMethodId[] = "onExitAcknowledge";
+const char kBenchmarkCiphersMethodId[] = "benchmarkCiphers";
+
+// Binary messages start with one of these type bytes.
+// kBinaryOnRead is followed by the fd as a 32-bit little endian integer, then
+// by the data. It carries terminal input and ssh-agent replies without base64
+// and JSON.
+// kBinaryAgentMessage goes the other way, to JS: the fd, then one whole
+// ssh-agent message for the auth agent app.
+const uint8_t kBinaryOnRead = 1;
+const uint8_t kBinaryAgentMessage = 2;
+const size_t kBinaryOnReadHeaderSize = 5;
 
 // Known startSession attributes.
 const char kUsernameAttr[] = "username";
@@ -41,17 +56,21 @@ const char kArgumentsAttr[] = "arguments";
 const char kWriteWindowAttr[] = "writeWindow";
 const char kAuthAgentAppID[] = "authAgentAppID";
 const char kSubsystemAttr[] = "subsystem";
+const char kCipherThreadsAttr[] = "cipherThreads";
 
 // These are JavaScript method names as C++ code sees them.
 const char kPrintLogMethodId[] = "printLog";
 const char kExitMethodId[] = "exit";
 const char kOpenFileMethodId[] = "openFile";
 const char kOpenSocketMethodId[] = "openSocket";
+const char kOpenAgentMethodId[] = "openAgent";
 const char kWriteMethodId[] = "write";
 const char kReadMethodId[] = "read";
 const char kCloseMethodId[] = "close";
+const char kBenchmarkResultMethodId[] = "benchmarkResult";
 
 const size_t kDefaultWriteWindow = 64 * 1024;
+const int kMaxBenchmarkMegabytes = 1024;
 
 extern "C" int ssh_main(int ac, const char** av, const char *subsystem);
 
@@ -63,6 +82,8 @@ SshPluginInstance::SshPluginInstance(PP_Instance instance)
     : pp::Instance(instance),
       core_(pp::Module::Get()->core()),
       openssh_thread_(NULL),
+      benchmark_megabytes_(0),
+      benchmark_running_(false),
       factory_(this),
       file_system_(this, this) {
   instance_ = this;
@@ -82,6 +103,29 @@ void SshPluginInstance::HandleMessage(const pp::Var& message_data) {
       if (!function.empty() && args.isArray())
         Invoke(function, args);
     }
+  } else if (message_data.is_array_buffer()) {
+    pp::VarArrayBuffer buffer(message_data);
+    const uint8_t* data = static_cast<const uint8_t*>(buffer.Map());
+    HandleBinaryMessage(data, buffer.ByteLength());
+    buffer.Unmap();
+  }
+}
+
+void SshPluginInstance::HandleBinaryMessage(const uint8_t* data,
+                                            size_t size) {
+  if (size >= kBinaryOnReadHeaderSize && data[0] == kBinaryOnRead) {
+    int32_t fd;
+    memcpy(&fd, data + 1, sizeof(fd));
+    InputStreams::iterator it = streams_.find(fd);
+    if (it != streams_.end()) {
+      it->second->OnRead(reinterpret_cast<const char*>(data) +
+                             kBinaryOnReadHeaderSize,
+                         size - kBinaryOnReadHeaderSize);
+    } else {
+      PrintLogImpl(0, "onRead: for unknown file descriptor\n");
+    }
+  } else {
+    PrintLogImpl(0, "HandleMessage: invalid binary message\n");
   }
 }
 
@@ -104,6 +148,8 @@ void SshPluginInstance::Invoke(const std::string& function,
     OnResize(args);
   } else if (function == kOnExitAcknowledgeMethodId) {
     OnExitAcknowledge(args);
+  } else if (function == kBenchmarkCiphersMethodId) {
+    BenchmarkCiphers(args);
   }
 }
 
@@ -128,15 +174,27 @@ void SshPluginInstance::PrintLog(const std::string& msg) {
       &SshPluginInstance::PrintLogImpl, msg));
 }
 
-void SshPluginInstance::SendExitCodeImpl(int32_t result, int error) {
+void SshPluginInstance::SendExitCodeImpl(int32_t result, int error,
+                                         CloseStats stats) {
+  // JSON has no 64-bit integers, so the times go out as milliseconds.
+  Json::Value teardown(Json::objectValue);
+  teardown["count"] = stats.count;
+  teardown["batches"] = stats.batches;
+  teardown["lingered"] = stats.lingered;
+  teardown["dropped"] = stats.dropped;
+  teardown["totalMs"] = stats.total_us / 1000.0;
+  teardown["maxMs"] = stats.max_us / 1000.0;
+  teardown["exitMs"] = stats.exit_us / 1000.0;
+
   Json::Value call_args(Json::arrayValue);
   call_args.append(error);
+  call_args.append(teardown);
   InvokeJS(kExitMethodId, call_args);
 }
 
-void SshPluginInstance::SendExitCode(int error) {
+void SshPluginInstance::SendExitCode(int error, const CloseStats& stats) {
   core_->CallOnMainThread(0, factory_.NewCallback(
-      &SshPluginInstance::SendExitCodeImpl, error));
+      &SshPluginInstance::SendExitCodeImpl, error, stats));
   openssh_thread_ = NULL;
 }
 
@@ -166,6 +224,17 @@ bool SshPluginInstance::OpenSocket(int fd, const char* host, uint16_t port,
   return true;
 }
 
+bool SshPluginInstance::OpenAgent(int fd, const char* app_id,
+                                  InputInterface* stream) {
+  Json::Value call_args(Json::arrayValue);
+  call_args.append(fd);
+  call_args.append(std::string(app_id));
+  InvokeJS(kOpenAgentMethodId, call_args);
+  assert(streams_.find(fd) == streams_.end());
+  streams_[fd] = stream;
+  return true;
+}
+
 bool SshPluginInstance::Write(int fd, const char* data, size_t size) {
   const size_t kMaxWriteSize = 24*1024;
   std::vector<char> buf(kMaxWriteSize * 4 / 3 + 4);
@@ -188,6 +257,19 @@ bool SshPluginInstance::Write(int fd, const char* data, size_t size) {
   return true;
 }
 
+bool SshPluginInstance::WriteAgentMessage(int fd, const char* data,
+                                          size_t size) {
+  pp::VarArrayBuffer buffer(kBinaryOnReadHeaderSize + size);
+  uint8_t* message = static_cast<uint8_t*>(buffer.Map());
+  int32_t fd32 = fd;
+  message[0] = kBinaryAgentMessage;
+  memcpy(message + 1, &fd32, sizeof(fd32));
+  memcpy(message + kBinaryOnReadHeaderSize, data, size);
+  buffer.Unmap();
+  PostMessage(buffer);
+  return true;
+}
+
 bool SshPluginInstance::Read(int fd, size_t size) {
   Json::Value call_args(Json::arrayValue);
   call_args.append(fd);
@@ -259,7 +341,10 @@ void SshPluginInstance::SessionThreadImpl() {
   for (size_t i = 0; i < argv.size(); i++)
     LOG("  argv[%d] = %s\n", i, argv[i]);
 
-  SendExitCode(ssh_main(argv.size(), &argv[0], csubsystem));
+  // A normal logout returns rather than calling exit(), and leaves the
+  // connection socket to be closed in the background.
+  int status = ssh_main(argv.size(), &argv[0], csubsystem);
+  SendExitCode(status, file_system_.CloseAllStreams());
 }
 
 void* SshPluginInstance::SessionThread(void* arg) {
@@ -297,15 +382,83 @@ void SshPluginInstance::StartSession(const Json::Value& args) {
         session_args_[kAuthAgentAppID].isString()) {
       setenv("SSH_AUTH_SOCK", session_args_[kAuthAgentAppID].asCString(), 1);
     }
+    // OpenSSL picks its cipher implementations when OpenSSH sets up each
+    // cipher context, so this has to happen before the session starts.
+    int cipher_threads = AesCtrMt::DefaultThreads();
+    if (session_args_.isMember(kCipherThreadsAttr) &&
+        session_args_[kCipherThreadsAttr].isNumeric()) {
+      cipher_threads = session_args_[kCipherThreadsAttr].asInt();
+    }
+    if (cipher_threads > 0 && !AesCtrMt::Register(cipher_threads))
+      PrintLogImpl(0, "startSession: threaded AES-CTR not available\n");
     if (pthread_create(&openssh_thread_, NULL,
                        &SshPluginInstance::SessionThread, this)) {
-      SendExitCodeImpl(0, -1);
+      SendExitCodeImpl(0, -1, CloseStats());
     }
   } else {
     PrintLogImpl(0, "startSession: invalid arguments\n");
   }
 }
 
+void SshPluginInstance::BenchmarkThreadImpl() {
+  size_t size = benchmark_megabytes_ * 1024 * 1024;
+  int threads[] = { 0, std::max(AesCtrMt::DefaultThreads(), 1) };
+
+  Json::Value results(Json::arrayValue);
+  for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+    double mbps = AesCtrMt::Benchmark(threads[i], size);
+    char buf[128];
+    snprintf(buf, sizeof(buf), "aes256-ctr, %d worker threads: %.1f MB/s\n",
+             threads[i], mbps);
+    PrintLog(buf);
+
+    Json::Value result(Json::objectValue);
+    result["threads"] = threads[i];
+    result["mbps"] = mbps;
+    results.append(result);
+  }
+  core_->CallOnMainThread(0, factory_.NewCallback(
+      &SshPluginInstance::SendBenchmarkResultImpl, results));
+}
+
+void* SshPluginInstance::BenchmarkThread(void* arg) {
+  SshPluginInstance* instance = static_cast<SshPluginInstance*>(arg);
+  instance->BenchmarkThreadImpl();
+  return NULL;
+}
+
+void SshPluginInstance::SendBenchmarkResultImpl(int32_t result,
+                                                Json::Value results) {
+  benchmark_running_ = false;
+  Json::Value call_args(Json::arrayValue);
+  call_args.append(benchmark_megabytes_);
+  call_args.append(results);
+  InvokeJS(kBenchmarkResultMethodId, call_args);
+}
+
+void SshPluginInstance::BenchmarkCiphers(const Json::Value& args) {
+  if (args.size() == 1 && args[(size_t)0].isNumeric() &&
+      args[(size_t)0].asInt() > 0 &&
+      args[(size_t)0].asInt() <= kMaxBenchmarkMegabytes) {
+    if (benchmark_running_) {
+      PrintLogImpl(0, "benchmarkCiphers: already running\n");
+      return;
+    }
+    benchmark_megabytes_ = args[(size_t)0].asInt();
+    benchmark_running_ = true;
+    pthread_t thread;
+    if (pthread_create(&thread, NULL,
+                       &SshPluginInstance::BenchmarkThread, this)) {
+      benchmark_running_ = false;
+      PrintLogImpl(0, "benchmarkCiphers: can't create thread\n");
+      return;
+    }
+    pthread_detach(thread);
+  } else {
+    PrintLogImpl(0, "benchmarkCiphers: invalid arguments\n");
+  }
+}
+
 void SshPluginInstance::OnOpen(const Json::Value& args) {
   const Json::Value& fd = args[(size_t)0];
   const Json::Value& success = args[(size_t)1];
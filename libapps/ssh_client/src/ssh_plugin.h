@@ -34,15 +34,19 @@ class SshPluginInstance : public pp::Instance,
                         InputInterface* stream);
   virtual bool OpenSocket(int fd, const char* host, uint16_t port,
                           InputInterface* stream);
+  virtual bool OpenAgent(int fd, const char* app_id, InputInterface* stream);
   virtual bool Write(int fd, const char* data, size_t size);
+  virtual bool WriteAgentMessage(int fd, const char* data, size_t size);
   virtual bool Read(int fd, size_t size);
   virtual bool Close(int fd);
   virtual size_t GetWriteWindow();
-  virtual void SendExitCode(int error);
+  virtual void SendExitCode(int error, const CloseStats& stats);
 
  private:
   typedef std::map<int, InputInterface*> InputStreams;
 
+  void HandleBinaryMessage(const uint8_t* data, size_t size);
+
   void StartSession(const Json::Value& args);
   void OnOpen(const Json::Value& args);
   void OnRead(const Json::Value& args);
@@ -51,23 +55,30 @@ class SshPluginInstance : public pp::Instance,
   void OnReadReady(const Json::Value& args);
   void OnResize(const Json::Value& args);
   void OnExitAcknowledge(const Json::Value& args);
+  void BenchmarkCiphers(const Json::Value& args);
 
   void SessionThreadImpl();
   static void* SessionThread(void* arg);
 
+  void BenchmarkThreadImpl();
+  static void* BenchmarkThread(void* arg);
+  void SendBenchmarkResultImpl(int32_t result, Json::Value results);
+
   void Invoke(const std::string& function, const Json::Value& args);
   void InvokeJS(const std::string& function, const Json::Value& args);
 
   void PrintLog(const std::string& msg);
   void PrintLogImpl(int32_t result, const std::string& msg);
 
-  void SendExitCodeImpl(int32_t result, int error);
+  void SendExitCodeImpl(int32_t result, int error, CloseStats stats);
 
   static SshPluginInstance* instance_;
 
   pp::Core* core_;
   pthread_t openssh_thread_;
   Json::Value session_args_;
+  int benchmark_megabytes_;
+  bool benchmark_running_;
   pp::CompletionCallbackFactory<SshPluginInstance> factory_;
   InputStreams streams_;
   FileSystem file_system_;
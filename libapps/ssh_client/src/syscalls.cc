@@ -441,8 +441,8 @@ int setsockopt(int socket, int level, int option_name,
 int getsockopt(int socket, int level, int option_name,
                void* option_value, socklen_t* option_len) {
   LOG("getsockopt: %d %d %d\n", socket, level, option_name);
-  memset(option_value, 0, *option_len);
-  return 0;
+  return FileSystem::GetFileSystem()->getsockopt(
+      socket, level, option_name, option_value, option_len);
 }
 
 int shutdown(int s, int how) {
@@ -466,6 +466,16 @@ int mkdir(const char* pathname, mode_t mode) {
   return FileSystem::GetFileSystem()->mkdir(pathname, mode);
 }
 
+int unlink(const char* pathname) {
+  LOG("unlink: %s\n", pathname);
+  return FileSystem::GetFileSystem()->unlink(pathname);
+}
+
+int rmdir(const char* pathname) {
+  LOG("rmdir: %s\n", pathname);
+  return FileSystem::GetFileSystem()->rmdir(pathname);
+}
+
 int sched_setscheduler(pid_t pid, int policy,
                        const struct sched_param* param) {
   LOG("sched_setscheduler: %d %d\n", pid, policy);
@@ -16,7 +16,7 @@
 TCPServerSocket::TCPServerSocket(int fd, int oflag,
                                  const sockaddr* saddr, socklen_t addrlen)
   : ref_(1), fd_(fd), oflag_(oflag), factory_(this), socket_(NULL),
-    sin6_(), resource_(0) {
+    sin6_(), resource_(0), closing_(false) {
   assert(sizeof(sin6_) >= addrlen);
   memcpy(&sin6_, saddr, std::min(sizeof(sin6_), addrlen));
 }
@@ -48,13 +48,9 @@ int TCPServerSocket::write(const char* buf, size_t count, size_t* nwrote) {
 }
 
 void TCPServerSocket::close() {
-  if (socket_) {
-    int32_t result = PP_OK_COMPLETIONPENDING;
-    pp::Module::Get()->core()->CallOnMainThread(0,
-        factory_.NewCallback(&TCPServerSocket::Close, &result));
-    FileSystem* sys = FileSystem::GetFileSystem();
-    while (result == PP_OK_COMPLETIONPENDING)
-      sys->cond().wait(sys->mutex());
+  if (socket_ && !closing_) {
+    closing_ = true;
+    FileSystem::GetFileSystem()->DeferClose(fd_, this, false);
   }
 }
 
@@ -82,12 +78,10 @@ bool TCPServerSocket::is_exception() {
 }
 
 bool TCPServerSocket::listen(int backlog) {
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&TCPServerSocket::Listen, backlog, &result));
-  FileSystem* sys = FileSystem::GetFileSystem();
-  while (result == PP_OK_COMPLETIONPENDING)
-    sys->cond().wait(sys->mutex());
+  PepperOperation* op = new PepperOperation();
+  int32_t result = op->Run(
+      factory_.NewCallback(&TCPServerSocket::Listen, backlog, op));
+  op->release();
   return result == PP_OK;
 }
 
@@ -99,12 +93,13 @@ PP_Resource TCPServerSocket::accept() {
   resource_ = 0;
   pp::Module::Get()->core()->CallOnMainThread(0,
       factory_.NewCallback(&TCPServerSocket::Accept,
-                           static_cast<int32_t*>(NULL)));
+                           static_cast<PepperOperation*>(NULL)));
 
   return ret;
 }
 
-void TCPServerSocket::Listen(int32_t result, int backlog, int32_t* pres) {
+void TCPServerSocket::Listen(int32_t result, int backlog,
+                             PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   assert(!socket_);
@@ -115,17 +110,17 @@ void TCPServerSocket::Listen(int32_t result, int backlog, int32_t* pres) {
                                    sizeof(sin6_), &addr)) {
     LOG("TCPServerSocket::Listen: %s\n",
         pp::NetAddressPrivate::Describe(addr, true).c_str());
-    *pres = socket_->Listen(&addr, backlog,
-        factory_.NewCallback(&TCPServerSocket::Accept, pres));
+    result = socket_->Listen(&addr, backlog,
+        factory_.NewCallback(&TCPServerSocket::Accept, op));
   } else {
-    *pres = PP_ERROR_FAILED;
+    result = PP_ERROR_FAILED;
   }
 
-  if (*pres != PP_OK_COMPLETIONPENDING)
-    sys->cond().broadcast();
+  if (result != PP_OK_COMPLETIONPENDING)
+    op->Complete(result);
 }
 
-void TCPServerSocket::Accept(int32_t result, int32_t* pres) {
+void TCPServerSocket::Accept(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   assert(socket_);
@@ -135,8 +130,8 @@ void TCPServerSocket::Accept(int32_t result, int32_t* pres) {
     if (result == PP_OK_COMPLETIONPENDING)
       result = PP_OK;
   }
-  if (pres)
-    *pres = result;
+  if (op)
+    op->Complete(result);
   sys->cond().broadcast();
 }
 
@@ -147,11 +142,9 @@ void TCPServerSocket::OnAccept(int32_t result) {
   sys->cond().broadcast();
 }
 
-void TCPServerSocket::Close(int32_t result, int32_t* pres) {
-  FileSystem* sys = FileSystem::GetFileSystem();
-  Mutex::Lock lock(sys->mutex());
+void TCPServerSocket::FinishClose() {
+  closing_ = false;
   delete socket_;
   socket_ = NULL;
-  *pres = PP_OK;
-  sys->cond().broadcast();
+  FileSystem::GetFileSystem()->CloseDone(this, false);
 }
@@ -12,6 +12,7 @@
 #include "ppapi/cpp/private/tcp_server_socket_private.h"
 
 #include "file_system.h"
+#include "pepper_operation.h"
 #include "pthread_helpers.h"
 
 class TCPServerSocket : public FileStream {
@@ -37,14 +38,15 @@ class TCPServerSocket : public FileStream {
   virtual bool is_write_ready();
   virtual bool is_exception();
 
+  virtual void FinishClose();
+
   bool listen(int backlog);
   PP_Resource accept();
 
  private:
-  void Listen(int32_t result, int backlog, int32_t* pres);
-  void Accept(int32_t result, int32_t* pres);
+  void Listen(int32_t result, int backlog, PepperOperation* op);
+  void Accept(int32_t result, PepperOperation* op);
   void OnAccept(int32_t result);
-  void Close(int32_t result, int32_t* pres);
 
   int ref_;
   int fd_;
@@ -53,6 +55,7 @@ class TCPServerSocket : public FileStream {
   pp::TCPServerSocketPrivate* socket_;
   sockaddr_in6 sin6_;
   PP_Resource resource_;
+  bool closing_;
 
   DISALLOW_COPY_AND_ASSIGN(TCPServerSocket);
 };
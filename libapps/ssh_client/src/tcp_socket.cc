@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <assert.h>
 #include <string.h>
+#include <sys/socket.h>
 
 #include "ppapi/c/pp_errors.h"
 #include "ppapi/cpp/module.h"
@@ -15,12 +16,15 @@
 
 TCPSocket::TCPSocket(int fd, int oflag)
   : ref_(1), fd_(fd), oflag_(oflag), factory_(this), socket_(NULL),
-    read_buf_(kBufSize), read_sent_(false), write_sent_(false) {
+    connect_op_(NULL), read_buf_(kBufSize), read_sent_(false),
+    write_sent_(false), closing_(false), lingering_(false) {
 }
 
 TCPSocket::~TCPSocket() {
   assert(!socket_);
   assert(!ref_);
+  if (connect_op_)
+    connect_op_->release();
 }
 
 void TCPSocket::addref() {
@@ -36,38 +40,55 @@ FileStream* TCPSocket::dup(int fd) {
   return NULL;
 }
 
-bool TCPSocket::connect(const char* host, uint16_t port) {
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&TCPSocket::Connect, host, port, &result));
-  FileSystem* sys = FileSystem::GetFileSystem();
-  while (result == PP_OK_COMPLETIONPENDING)
-    sys->cond().wait(sys->mutex());
-  return result == PP_OK;
+int TCPSocket::connect(const std::string& host, uint16_t port) {
+  assert(!connect_op_);
+  connect_op_ = new PepperOperation();
+  connect_op_->Start(
+      factory_.NewCallback(&TCPSocket::Connect, host, port, connect_op_));
+  if (!is_block())
+    return EINPROGRESS;
+  return FinishConnect();
+}
+
+int TCPSocket::FinishConnect() {
+  if (!connect_op_)
+    return 0;
+
+  int32_t result = connect_op_->Wait();
+  connect_op_->release();
+  connect_op_ = NULL;
+  if (result == PP_OK)
+    return 0;
+  return result == PP_ERROR_TIMEDOUT ? ETIMEDOUT : ECONNREFUSED;
 }
 
 bool TCPSocket::accept(PP_Resource resource) {
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&TCPSocket::Accept, resource, &result));
-  FileSystem* sys = FileSystem::GetFileSystem();
-  while (result == PP_OK_COMPLETIONPENDING)
-    sys->cond().wait(sys->mutex());
+  PepperOperation* op = new PepperOperation();
+  int32_t result = op->Run(
+      factory_.NewCallback(&TCPSocket::Accept, resource, op));
+  op->release();
   return result == PP_OK;
 }
 
 void TCPSocket::close() {
-  if (socket_) {
-    int32_t result = PP_OK_COMPLETIONPENDING;
-    pp::Module::Get()->core()->CallOnMainThread(0,
-        factory_.NewCallback(&TCPSocket::Close, &result));
-    FileSystem* sys = FileSystem::GetFileSystem();
-    while (result == PP_OK_COMPLETIONPENDING)
-      sys->cond().wait(sys->mutex());
+  bool connecting = connect_op_ && connect_op_->is_running();
+  if ((socket_ || connecting) && !closing_) {
+    closing_ = true;
+    if (connect_op_)
+      connect_op_->Cancel();
+    FileSystem::GetFileSystem()->DeferClose(fd_, this, false);
   }
 }
 
 int TCPSocket::read(char* buf, size_t count, size_t* nread) {
+  if (is_connecting()) {
+    if (!is_block()) {
+      *nread = -1;
+      return EAGAIN;
+    }
+    connect_op_->Wait();
+  }
+
   if (is_block()) {
     FileSystem* sys = FileSystem::GetFileSystem();
     while (in_buf_.empty() && is_open())
@@ -95,16 +116,23 @@ int TCPSocket::read(char* buf, size_t count, size_t* nread) {
 }
 
 int TCPSocket::write(const char* buf, size_t count, size_t* nwrote) {
+  if (is_connecting()) {
+    if (!is_block()) {
+      *nwrote = -1;
+      return EAGAIN;
+    }
+    connect_op_->Wait();
+  }
+
   if (!is_open())
     return EIO;
 
   out_buf_.insert(out_buf_.end(), buf, buf + count);
   if (is_block()) {
-    int32_t result = PP_OK_COMPLETIONPENDING;
-    PostWriteTask(&result, true);
-    FileSystem* sys = FileSystem::GetFileSystem();
-    while (result == PP_OK_COMPLETIONPENDING)
-      sys->cond().wait(sys->mutex());
+    PepperOperation* op = new PepperOperation();
+    PostWriteTask(op, true);
+    int32_t result = op->Wait();
+    op->release();
     if ((size_t)result != count) {
       *nwrote = -1;
       return EIO;
@@ -130,20 +158,33 @@ int TCPSocket::fcntl(int cmd, va_list ap) {
   }
 }
 
+int TCPSocket::getsockopt(int level, int optname, void* optval,
+                          socklen_t* optlen) {
+  if (level == SOL_SOCKET && optname == SO_ERROR &&
+      *optlen >= sizeof(int)) {
+    // Like Linux, the error of a connect in progress is 0 until it's done.
+    int error = is_connecting() ? 0 : FinishConnect();
+    memcpy(optval, &error, sizeof(error));
+    *optlen = sizeof(error);
+    return 0;
+  }
+  return FileStream::getsockopt(level, optname, optval, optlen);
+}
+
 bool TCPSocket::is_read_ready() {
-  return !is_open() || !in_buf_.empty();
+  return !is_connecting() && (!is_open() || !in_buf_.empty());
 }
 
 bool TCPSocket::is_write_ready() {
-  return !is_open() || out_buf_.size() < kBufSize;
+  return !is_connecting() && (!is_open() || out_buf_.size() < kBufSize);
 }
 
 bool TCPSocket::is_exception() {
-  return !is_open();
+  return !is_connecting() && !is_open();
 }
 
 void TCPSocket::PostReadTask() {
-  if (is_open() && !read_sent_ && in_buf_.size() < kBufSize / 2) {
+  if (is_open() && !closing_ && !read_sent_ && in_buf_.size() < kBufSize / 2) {
     read_sent_ = true;
     if (!pp::Module::Get()->core()->IsMainThread()) {
       pp::Module::Get()->core()->CallOnMainThread(
@@ -155,42 +196,55 @@ void TCPSocket::PostReadTask() {
   }
 }
 
-void TCPSocket::PostWriteTask(int32_t* pres, bool always_post) {
+void TCPSocket::PostWriteTask(PepperOperation* op, bool always_post) {
   if (is_open() && !write_sent_ && !out_buf_.empty()) {
     write_sent_ = true;
-    if (always_post || !pp::Module::Get()->core()->IsMainThread()) {
+    if (op) {
+      op->Start(factory_.NewCallback(&TCPSocket::Write, op));
+    } else if (always_post || !pp::Module::Get()->core()->IsMainThread()) {
       pp::Module::Get()->core()->CallOnMainThread(0,
-          factory_.NewCallback(&TCPSocket::Write, pres));
+          factory_.NewCallback(&TCPSocket::Write, op));
     } else {
       // If on main Pepper thread and delay is not required call it directly.
-      Write(PP_OK, pres);
+      Write(PP_OK, op);
     }
   }
 }
 
-void TCPSocket::Connect(int32_t result, const char* host, uint16_t port,
-                        int32_t* pres) {
+void TCPSocket::Connect(int32_t result, const std::string& host,
+                        uint16_t port, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
+  if (op->is_cancelled()) {
+    op->Complete(PP_ERROR_ABORTED);
+    return;
+  }
+
   assert(!socket_);
   socket_ = new pp::TCPSocketPrivate(sys->instance());
-  *pres = socket_->Connect(host, port,
-      factory_.NewCallback(&TCPSocket::OnConnect, pres));
-  if (*pres != PP_OK_COMPLETIONPENDING)
-    sys->cond().broadcast();
+  result = socket_->Connect(host.c_str(), port,
+      factory_.NewCallback(&TCPSocket::OnConnect, op));
+  if (result != PP_OK_COMPLETIONPENDING) {
+    delete socket_;
+    socket_ = NULL;
+    op->Complete(result);
+  }
 }
 
-void TCPSocket::OnConnect(int32_t result, int32_t* pres) {
+void TCPSocket::OnConnect(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
-  if (result == PP_OK) {
+  if (result == PP_OK && !op->is_cancelled()) {
     PostReadTask();
   } else {
     delete socket_;
     socket_ = NULL;
   }
-  *pres = result;
-  sys->cond().broadcast();
+  op->Complete(result);
+
+  // FinishClose() left the rest of the close to us.
+  if (lingering_)
+    Teardown(false);
 }
 
 void TCPSocket::Read(int32_t result) {
@@ -210,6 +264,7 @@ void TCPSocket::Read(int32_t result) {
     socket_ = NULL;
     read_sent_ = false;
     sys->cond().broadcast();
+    PostLingerCheck();
   }
 }
 
@@ -232,15 +287,16 @@ void TCPSocket::OnRead(int32_t result) {
     socket_ = NULL;
   }
   sys->cond().broadcast();
+  PostLingerCheck();
 }
 
-void TCPSocket::Write(int32_t result, int32_t* pres) {
+void TCPSocket::Write(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
 
   if (!is_open()) {
-    if (pres)
-      *pres = PP_ERROR_FAILED;
+    if (op)
+      op->Complete(PP_ERROR_FAILED);
     write_sent_ = false;
     sys->cond().broadcast();
     return;
@@ -248,32 +304,34 @@ void TCPSocket::Write(int32_t result, int32_t* pres) {
 
   if (write_buf_.size()) {
     // Previous write operation is in progress.
-    PostWriteTask(pres, true);
+    pp::Module::Get()->core()->CallOnMainThread(0,
+        factory_.NewCallback(&TCPSocket::Write, op));
     return;
   }
   assert(out_buf_.size());
   write_buf_.swap(out_buf_);
   result = socket_->Write(&write_buf_[0], write_buf_.size(),
-      factory_.NewCallback(&TCPSocket::OnWrite, pres));
+      factory_.NewCallback(&TCPSocket::OnWrite, op));
   if (result != PP_OK_COMPLETIONPENDING) {
     LOG("TCPSocket::Write: failed %d %d %d\n", fd_, result, write_buf_.size());
     delete socket_;
     socket_ = NULL;
-    if (pres)
-      *pres = result;
+    if (op)
+      op->Complete(result);
     write_sent_ = false;
     sys->cond().broadcast();
+    PostLingerCheck();
   }
 }
 
-void TCPSocket::OnWrite(int32_t result, int32_t* pres) {
+void TCPSocket::OnWrite(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
 
   write_sent_ = false;
   if (!is_open()) {
-    if (pres)
-      *pres = PP_ERROR_FAILED;
+    if (op)
+      op->Complete(PP_ERROR_FAILED);
     sys->cond().broadcast();
     return;
   }
@@ -287,8 +345,8 @@ void TCPSocket::OnWrite(int32_t result, int32_t* pres) {
     // Partial write. Insert remaining bytes at the beginning of out_buf_.
     out_buf_.insert(out_buf_.begin(), &write_buf_[result], &*write_buf_.end());
   }
-  if (pres)
-    *pres = result;
+  if (op)
+    op->Complete(result);
   write_buf_.clear();
   sys->cond().broadcast();
 
@@ -298,25 +356,71 @@ void TCPSocket::OnWrite(int32_t result, int32_t* pres) {
     // we always wait write operation completion.
     PostWriteTask(NULL, false);
   }
+  PostLingerCheck();
+}
+
+void TCPSocket::FinishClose() {
+  if (connect_op_ && connect_op_->is_running()) {
+    // Abort the connect.  Pepper still calls OnConnect(), which finishes the
+    // close.
+    lingering_ = true;
+    delete socket_;
+    socket_ = NULL;
+  } else if (is_open() &&
+             (write_sent_ || !write_buf_.empty() || !out_buf_.empty())) {
+    // Linger, like SO_LINGER, until what was written before close() is sent.
+    lingering_ = true;
+    PostWriteTask(NULL, true);
+    pp::Module::Get()->core()->CallOnMainThread(FileSystem::kCloseLingerMs,
+        factory_.NewCallback(&TCPSocket::OnLingerTimeout));
+  } else {
+    Teardown(false);
+  }
 }
 
-void TCPSocket::Close(int32_t result, int32_t* pres) {
+void TCPSocket::PostLingerCheck() {
+  if (lingering_) {
+    pp::Module::Get()->core()->CallOnMainThread(0,
+        factory_.NewCallback(&TCPSocket::CheckLinger));
+  }
+}
+
+void TCPSocket::CheckLinger(int32_t result) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
+  if (!lingering_)
+    return;
+  if (is_open() && !out_buf_.empty())
+    PostWriteTask(NULL, true);
+  if (!is_open() || (!write_sent_ && write_buf_.empty()))
+    Teardown(false);
+}
+
+void TCPSocket::OnLingerTimeout(int32_t result) {
+  FileSystem* sys = FileSystem::GetFileSystem();
+  Mutex::Lock lock(sys->mutex());
+  if (lingering_) {
+    LOG("TCPSocket::OnLingerTimeout: %d dropping %d bytes\n",
+        fd_, out_buf_.size() + write_buf_.size());
+    Teardown(true);
+  }
+}
+
+void TCPSocket::Teardown(bool dropped) {
+  // This may drop the last reference, so it must come last.
+  closing_ = false;
+  lingering_ = false;
   delete socket_;
   socket_ = NULL;
-  if (pres)
-    *pres = PP_OK;
-  sys->cond().broadcast();
+  FileSystem::GetFileSystem()->CloseDone(this, dropped);
 }
 
-bool TCPSocket::Accept(int32_t result, PP_Resource resource, int32_t* pres) {
+void TCPSocket::Accept(int32_t result, PP_Resource resource,
+                       PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   assert(!socket_);
   socket_ = new pp::TCPSocketPrivate(pp::PassRef(), resource);
   PostReadTask();
-  *pres = PP_OK;
-  sys->cond().broadcast();
-  return true;
+  op->Complete(PP_OK);
 }
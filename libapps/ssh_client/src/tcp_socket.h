@@ -5,12 +5,14 @@
 #ifndef SOCKET_H
 #define SOCKET_H
 
+#include <string>
 #include <vector>
 
 #include "ppapi/cpp/completion_callback.h"
 #include "ppapi/cpp/private/tcp_socket_private.h"
 
 #include "file_system.h"
+#include "pepper_operation.h"
 #include "pthread_helpers.h"
 
 class TCPSocket : public FileStream {
@@ -23,7 +25,9 @@ class TCPSocket : public FileStream {
   bool is_block() { return !(oflag_ & O_NONBLOCK); }
   bool is_open() { return socket_ != NULL; }
 
-  bool connect(const char* host, uint16_t port);
+  // Returns 0 or an errno.  A nonblocking socket returns EINPROGRESS and
+  // becomes writable once connected; getsockopt(SO_ERROR) gives the result.
+  int connect(const std::string& host, uint16_t port);
   bool accept(PP_Resource resource);
 
   virtual void addref();
@@ -35,27 +39,39 @@ class TCPSocket : public FileStream {
   virtual int write(const char* buf, size_t count, size_t* nwrote);
 
   virtual int fcntl(int cmd,  va_list ap);
+  virtual int getsockopt(int level, int optname, void* optval,
+                         socklen_t* optlen);
 
   virtual bool is_read_ready();
   virtual bool is_write_ready();
   virtual bool is_exception();
 
+  virtual void FinishClose();
+
  private:
+  bool is_connecting() { return connect_op_ && !connect_op_->is_done(); }
+  int FinishConnect();
+
   void PostReadTask();
-  void PostWriteTask(int32_t* pres, bool always_post);
+  void PostWriteTask(PepperOperation* op, bool always_post);
 
-  void Connect(int32_t result, const char* host, uint16_t port, int32_t* pres);
-  void OnConnect(int32_t result, int32_t* pres);
+  void Connect(int32_t result, const std::string& host, uint16_t port,
+               PepperOperation* op);
+  void OnConnect(int32_t result, PepperOperation* op);
 
   void Read(int32_t result);
   void OnRead(int32_t result);
 
-  void Write(int32_t result, int32_t* pres);
-  void OnWrite(int32_t result, int32_t* pres);
+  void Write(int32_t result, PepperOperation* op);
+  void OnWrite(int32_t result, PepperOperation* op);
 
-  void Close(int32_t result, int32_t* pres);
+  // Release the socket once a close no longer waits for pending output.
+  void PostLingerCheck();
+  void CheckLinger(int32_t result);
+  void OnLingerTimeout(int32_t result);
+  void Teardown(bool dropped);
 
-  bool Accept(int32_t result, PP_Resource resource, int32_t* pres);
+  void Accept(int32_t result, PP_Resource resource, PepperOperation* op);
 
   static const size_t kBufSize = 64 * 1024;
 
@@ -64,12 +80,15 @@ class TCPSocket : public FileStream {
   int oflag_;
   pp::CompletionCallbackFactory<TCPSocket> factory_;
   pp::TCPSocketPrivate* socket_;
+  PepperOperation* connect_op_;
   std::vector<char> in_buf_;
   std::vector<char> out_buf_;
   std::vector<char> read_buf_;
   std::vector<char> write_buf_;
   bool read_sent_;
   bool write_sent_;
+  bool closing_;
+  bool lingering_;
 
   DISALLOW_COPY_AND_ASSIGN(TCPSocket);
 };
@@ -0,0 +1,491 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "tmp_fs.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include <algorithm>
+
+#include "mount_table.h"
+
+const size_t TmpFsNode::kPageSize;
+
+TmpFsNode::TmpFsNode(TmpFsHandler* handler, nacl_abi_ino_t ino, bool is_dir,
+                     mode_t mode)
+    : ref_(1), handler_(handler), ino_(ino), is_dir_(is_dir), mode_(mode),
+      size_(0), mtime_(time(NULL)), allocated_pages_(0) {
+}
+
+TmpFsNode::~TmpFsNode() {
+  assert(!ref_);
+  for (size_t i = 0; i < pages_.size(); ++i)
+    delete[] pages_[i];
+  handler_->FreePages(allocated_pages_);
+}
+
+void TmpFsNode::addref() {
+  ++ref_;
+}
+
+void TmpFsNode::release() {
+  if (!--ref_)
+    delete this;
+}
+
+void TmpFsNode::stat(nacl_abi_stat* out) const {
+  memset(out, 0, sizeof(nacl_abi_stat));
+  out->nacl_abi_st_ino = ino_;
+  out->nacl_abi_st_mode = (is_dir_ ? S_IFDIR : S_IFREG) | (mode_ & 07777);
+  out->nacl_abi_st_nlink = 1;
+  out->nacl_abi_st_size = size_;
+  out->nacl_abi_st_blksize = kPageSize;
+  out->nacl_abi_st_blocks = allocated_pages_ * (kPageSize / 512);
+  out->nacl_abi_st_atime = mtime_;
+  out->nacl_abi_st_mtime = mtime_;
+  out->nacl_abi_st_ctime = mtime_;
+}
+
+size_t TmpFsNode::Read(nacl_abi_off_t offset, char* buf, size_t count) const {
+  if (offset >= size_)
+    return 0;
+  if (count > (size_t)(size_ - offset))
+    count = size_ - offset;
+
+  size_t done = 0;
+  while (done < count) {
+    size_t page = (offset + done) / kPageSize;
+    size_t start = (offset + done) % kPageSize;
+    size_t n = std::min(kPageSize - start, count - done);
+    if (page < pages_.size() && pages_[page])
+      memcpy(buf + done, pages_[page] + start, n);
+    else
+      memset(buf + done, 0, n);
+    done += n;
+  }
+  return count;
+}
+
+size_t TmpFsNode::PagesNeeded(nacl_abi_off_t offset, size_t count) const {
+  if (!count)
+    return 0;
+
+  size_t needed = 0;
+  size_t last = (offset + count - 1) / kPageSize;
+  for (size_t page = offset / kPageSize; page <= last; ++page) {
+    if (page >= pages_.size() || !pages_[page])
+      ++needed;
+  }
+  return needed;
+}
+
+size_t TmpFsNode::Write(nacl_abi_off_t offset, const char* buf,
+                        size_t count) {
+  size_t allocated = 0;
+  size_t done = 0;
+  while (done < count) {
+    size_t page = (offset + done) / kPageSize;
+    size_t start = (offset + done) % kPageSize;
+    size_t n = std::min(kPageSize - start, count - done);
+    if (page >= pages_.size())
+      pages_.resize(page + 1, NULL);
+    if (!pages_[page]) {
+      pages_[page] = new char[kPageSize];
+      memset(pages_[page], 0, kPageSize);
+      ++allocated;
+    }
+    memcpy(pages_[page] + start, buf + done, n);
+    done += n;
+  }
+
+  allocated_pages_ += allocated;
+  if (offset + (nacl_abi_off_t)count > size_)
+    size_ = offset + count;
+  mtime_ = time(NULL);
+  return allocated;
+}
+
+size_t TmpFsNode::Truncate(nacl_abi_off_t size) {
+  size_t freed = 0;
+  size_t keep = (size + kPageSize - 1) / kPageSize;
+  for (size_t page = keep; page < pages_.size(); ++page) {
+    if (pages_[page]) {
+      delete[] pages_[page];
+      ++freed;
+    }
+  }
+  if (keep < pages_.size())
+    pages_.resize(keep);
+  allocated_pages_ -= freed;
+
+  // Bytes past the new end in the last page must read as zeros if the file
+  // grows again.
+  if (size < size_ && size % kPageSize && keep <= pages_.size() &&
+      pages_[keep - 1]) {
+    size_t start = size % kPageSize;
+    memset(pages_[keep - 1] + start, 0, kPageSize - start);
+  }
+
+  size_ = size;
+  mtime_ = time(NULL);
+  return freed;
+}
+
+//------------------------------------------------------------------------------
+
+TmpFsHandler::TmpFsHandler(size_t max_bytes)
+    : ref_(1), max_pages_(max_bytes / TmpFsNode::kPageSize), used_pages_(0),
+      next_ino_(1) {
+}
+
+TmpFsHandler::~TmpFsHandler() {
+  assert(!ref_);
+  for (NodeMap::iterator it = nodes_.begin(); it != nodes_.end(); ++it)
+    it->second->release();
+}
+
+void TmpFsHandler::addref() {
+  ++ref_;
+}
+
+void TmpFsHandler::release() {
+  if (!--ref_)
+    delete this;
+}
+
+bool TmpFsHandler::ReservePages(size_t count) {
+  if (used_pages_ + count > max_pages_)
+    return false;
+  used_pages_ += count;
+  return true;
+}
+
+void TmpFsHandler::FreePages(size_t count) {
+  assert(used_pages_ >= count);
+  used_pages_ -= count;
+}
+
+TmpFsNode* TmpFsHandler::Lookup(const std::string& path) {
+  NodeMap::iterator it = nodes_.find(path);
+  return it != nodes_.end() ? it->second : NULL;
+}
+
+bool TmpFsHandler::IsMountPoint(const std::string& path) {
+  return path.rfind('/') == 0 && path.size() > 1;
+}
+
+int TmpFsHandler::CheckParent(const std::string& path) {
+  if (path.empty())
+    return ENOENT;
+
+  // Mount points have no parent in this file system.
+  if (IsMountPoint(path))
+    return 0;
+
+  TmpFsNode* parent = Lookup(path.substr(0, path.rfind('/')));
+  if (!parent)
+    return ENOENT;
+  if (!parent->is_dir())
+    return ENOTDIR;
+  return 0;
+}
+
+void TmpFsHandler::ListDirectory(const std::string& path,
+                                 std::vector<std::string>* names) {
+  names->clear();
+  names->push_back(".");
+  names->push_back("..");
+
+  // Paths below a directory sort right after it, all starting with its path
+  // and a slash.
+  std::string prefix = path + "/";
+  for (NodeMap::iterator it = nodes_.lower_bound(prefix);
+       it != nodes_.end() && !it->first.compare(0, prefix.size(), prefix);
+       ++it) {
+    std::string name = it->first.substr(prefix.size());
+    if (name.find('/') == std::string::npos)
+      names->push_back(name);
+  }
+}
+
+FileStream* TmpFsHandler::open(int fd, const char* pathname, int oflag,
+                               mode_t cmode, int* err) {
+  std::string path = MountTable::NormalizePath(pathname);
+  TmpFsNode* node = Lookup(path);
+
+  if (node && (oflag & O_CREAT) && (oflag & O_EXCL)) {
+    *err = EEXIST;
+    return NULL;
+  }
+
+  if (!node) {
+    if (!(oflag & O_CREAT)) {
+      *err = ENOENT;
+      return NULL;
+    }
+    *err = CheckParent(path);
+    if (*err)
+      return NULL;
+    node = new TmpFsNode(this, next_ino_++, false, cmode);
+    nodes_[path] = node;
+  }
+
+  if (node->is_dir()) {
+    if ((oflag & O_ACCMODE) != O_RDONLY) {
+      *err = EISDIR;
+      return NULL;
+    }
+    std::vector<std::string> names;
+    ListDirectory(path, &names);
+    return new TmpDir(fd, node, names);
+  }
+
+  if ((oflag & O_TRUNC) && (oflag & O_ACCMODE) != O_RDONLY)
+    FreePages(node->Truncate(0));
+
+  return new TmpFile(fd, oflag, this, node);
+}
+
+int TmpFsHandler::stat(const char* pathname, nacl_abi_stat* out) {
+  TmpFsNode* node = Lookup(MountTable::NormalizePath(pathname));
+  if (!node)
+    return ENOENT;
+
+  node->stat(out);
+  return 0;
+}
+
+int TmpFsHandler::mkdir(const char* pathname, mode_t mode) {
+  std::string path = MountTable::NormalizePath(pathname);
+  if (Lookup(path))
+    return EEXIST;
+
+  int err = CheckParent(path);
+  if (err)
+    return err;
+
+  nodes_[path] = new TmpFsNode(this, next_ino_++, true, mode);
+  return 0;
+}
+
+int TmpFsHandler::unlink(const char* pathname) {
+  std::string path = MountTable::NormalizePath(pathname);
+  NodeMap::iterator it = nodes_.find(path);
+  if (it == nodes_.end())
+    return ENOENT;
+
+  if (it->second->is_dir())
+    return EISDIR;
+
+  Remove(it);
+  return 0;
+}
+
+int TmpFsHandler::rmdir(const char* pathname) {
+  std::string path = MountTable::NormalizePath(pathname);
+  NodeMap::iterator it = nodes_.find(path);
+  if (it == nodes_.end())
+    return ENOENT;
+  if (!it->second->is_dir())
+    return ENOTDIR;
+  if (IsMountPoint(path))
+    return EBUSY;
+
+  std::vector<std::string> names;
+  ListDirectory(path, &names);
+  // Only "." and "..".
+  if (names.size() > 2)
+    return ENOTEMPTY;
+
+  Remove(it);
+  return 0;
+}
+
+void TmpFsHandler::Remove(NodeMap::iterator it) {
+  // Streams still open on the node keep it, and its pages, until they are
+  // closed.
+  TmpFsNode* node = it->second;
+  nodes_.erase(it);
+  node->release();
+}
+
+//------------------------------------------------------------------------------
+
+TmpFile::TmpFile(int fd, int oflag, TmpFsHandler* handler, TmpFsNode* node)
+  : ref_(1), fd_(fd), oflag_(oflag), handler_(handler), node_(node),
+    offset_(0) {
+  handler_->addref();
+  node_->addref();
+}
+
+TmpFile::~TmpFile() {
+  assert(!ref_);
+  node_->release();
+  handler_->release();
+}
+
+void TmpFile::addref() {
+  ++ref_;
+}
+
+void TmpFile::release() {
+  if (!--ref_)
+    delete this;
+}
+
+FileStream* TmpFile::dup(int fd) {
+  TmpFile* file = new TmpFile(fd, oflag_, handler_, node_);
+  file->offset_ = offset_;
+  return file;
+}
+
+void TmpFile::close() {
+  fd_ = 0;
+}
+
+int TmpFile::read(char* buf, size_t count, size_t* nread) {
+  if ((oflag_ & O_ACCMODE) == O_WRONLY)
+    return EBADF;
+
+  *nread = node_->Read(offset_, buf, count);
+  offset_ += *nread;
+  return 0;
+}
+
+int TmpFile::write(const char* buf, size_t count, size_t* nwrote) {
+  if ((oflag_ & O_ACCMODE) == O_RDONLY)
+    return EBADF;
+
+  if (oflag_ & O_APPEND)
+    offset_ = node_->size();
+
+  size_t pages = node_->PagesNeeded(offset_, count);
+  if (!handler_->ReservePages(pages))
+    return ENOSPC;
+
+  size_t allocated = node_->Write(offset_, buf, count);
+  assert(allocated == pages);
+  offset_ += count;
+  *nwrote = count;
+  return 0;
+}
+
+int TmpFile::seek(nacl_abi_off_t offset, int whence,
+                  nacl_abi_off_t* new_offset) {
+  nacl_abi_off_t base;
+  switch (whence) {
+    case SEEK_SET:
+      base = 0;
+      break;
+    case SEEK_CUR:
+      base = offset_;
+      break;
+    case SEEK_END:
+      base = node_->size();
+      break;
+    default:
+      return EINVAL;
+  }
+
+  if (base + offset < 0)
+    return EINVAL;
+
+  offset_ = base + offset;
+  if (new_offset)
+    *new_offset = offset_;
+  return 0;
+}
+
+int TmpFile::fstat(nacl_abi_stat* out) {
+  node_->stat(out);
+  return 0;
+}
+
+int TmpFile::fcntl(int cmd, va_list ap) {
+  if (cmd == F_GETFL) {
+    return oflag_;
+  } else if (cmd == F_SETFL) {
+    oflag_ = va_arg(ap, long);
+    return 0;
+  } else {
+    return -1;
+  }
+}
+
+//------------------------------------------------------------------------------
+
+TmpDir::TmpDir(int fd, TmpFsNode* node, const std::vector<std::string>& names)
+  : ref_(1), fd_(fd), node_(node), names_(names), next_(0) {
+  node_->addref();
+}
+
+TmpDir::~TmpDir() {
+  assert(!ref_);
+  node_->release();
+}
+
+void TmpDir::addref() {
+  ++ref_;
+}
+
+void TmpDir::release() {
+  if (!--ref_)
+    delete this;
+}
+
+FileStream* TmpDir::dup(int fd) {
+  TmpDir* dir = new TmpDir(fd, node_, names_);
+  dir->next_ = next_;
+  return dir;
+}
+
+void TmpDir::close() {
+  fd_ = 0;
+}
+
+int TmpDir::read(char* buf, size_t count, size_t* nread) {
+  return EISDIR;
+}
+
+int TmpDir::write(const char* buf, size_t count, size_t* nwrote) {
+  return EBADF;
+}
+
+int TmpDir::fstat(nacl_abi_stat* out) {
+  node_->stat(out);
+  return 0;
+}
+
+int TmpDir::getdents(dirent* buf, size_t count, size_t* nread) {
+  // The IRT hands us a buffer in the NaCl ABI layout.
+  char* out = reinterpret_cast<char*>(buf);
+  size_t used = 0;
+
+  while (next_ < names_.size()) {
+    const std::string& name = names_[next_];
+    size_t reclen = offsetof(nacl_abi_dirent, nacl_abi_d_name) +
+        name.size() + 1;
+    reclen = (reclen + 7) & ~7;
+    if (used + reclen > count)
+      break;
+
+    nacl_abi_dirent* ent = reinterpret_cast<nacl_abi_dirent*>(out + used);
+    ent->nacl_abi_d_ino = next_ + 1;
+    ent->nacl_abi_d_off = next_ + 1;
+    ent->nacl_abi_d_reclen = reclen;
+    memcpy(ent->nacl_abi_d_name, name.c_str(), name.size() + 1);
+    used += reclen;
+    ++next_;
+  }
+
+  if (!used && next_ < names_.size())
+    return EINVAL;
+
+  *nread = used;
+  return 0;
+}
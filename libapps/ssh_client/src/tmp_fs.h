@@ -0,0 +1,168 @@
+// Copyright (c) 2012 The Chromium OS Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TMP_FS_H
+#define TMP_FS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "file_interfaces.h"
+#include "pthread_helpers.h"
+
+class TmpFsHandler;
+
+// A file or directory of a TmpFsHandler.  Nodes are reference counted so
+// that unlinked files stay readable through the streams still open on them.
+// Their pages count against the size limit of the handler until they are
+// deleted.
+class TmpFsNode {
+ public:
+  TmpFsNode(TmpFsHandler* handler, nacl_abi_ino_t ino, bool is_dir,
+            mode_t mode);
+  ~TmpFsNode();
+
+  void addref();
+  void release();
+
+  bool is_dir() const { return is_dir_; }
+  nacl_abi_off_t size() const { return size_; }
+
+  void stat(nacl_abi_stat* out) const;
+
+  // Copy up to |count| bytes at |offset| out of the file.  Holes read as
+  // zeros.
+  size_t Read(nacl_abi_off_t offset, char* buf, size_t count) const;
+
+  // Copy |count| bytes in at |offset|, allocating pages as needed.  Returns
+  // the number of pages allocated.
+  size_t Write(nacl_abi_off_t offset, const char* buf, size_t count);
+
+  // Return the number of pages a write of |count| bytes at |offset| would
+  // allocate.
+  size_t PagesNeeded(nacl_abi_off_t offset, size_t count) const;
+
+  // Shrink or extend the file.  Returns the number of pages freed.
+  size_t Truncate(nacl_abi_off_t size);
+
+  static const size_t kPageSize = 4096;
+
+ private:
+  int ref_;
+  TmpFsHandler* handler_;
+  nacl_abi_ino_t ino_;
+  bool is_dir_;
+  mode_t mode_;
+  nacl_abi_off_t size_;
+  time_t mtime_;
+  // Pages of the file, NULL for holes.
+  std::vector<char*> pages_;
+  size_t allocated_pages_;
+
+  DISALLOW_COPY_AND_ASSIGN(TmpFsNode);
+};
+
+// A file system held in memory, for paths like /tmp that need not outlive
+// the session.  One handler may be mounted at several places; its files are
+// keyed by their full normalized path, and share one size limit.
+class TmpFsHandler : public PathHandler {
+ public:
+  explicit TmpFsHandler(size_t max_bytes);
+  virtual ~TmpFsHandler();
+
+  virtual void addref();
+  virtual void release();
+
+  virtual FileStream* open(int fd, const char* pathname, int oflag,
+                           mode_t cmode, int* err);
+  virtual int stat(const char* pathname, nacl_abi_stat* out);
+  virtual int mkdir(const char* pathname, mode_t mode);
+  virtual int unlink(const char* pathname);
+  virtual int rmdir(const char* pathname);
+
+  // Reserve pages for a write, or return false if the size limit is hit.
+  bool ReservePages(size_t count);
+  void FreePages(size_t count);
+
+ private:
+  typedef std::map<std::string, TmpFsNode*> NodeMap;
+
+  TmpFsNode* Lookup(const std::string& path);
+  // Whether |path| is where the handler is mounted, which has no parent here
+  // and can't be removed.
+  static bool IsMountPoint(const std::string& path);
+  // Return 0 if a node may be created at |path|, or an errno.
+  int CheckParent(const std::string& path);
+  // Fill |names| with the entries of the directory at |path|.
+  void ListDirectory(const std::string& path, std::vector<std::string>* names);
+  // Drop the node at |it| from the file system.
+  void Remove(NodeMap::iterator it);
+
+  int ref_;
+  size_t max_pages_;
+  size_t used_pages_;
+  nacl_abi_ino_t next_ino_;
+  NodeMap nodes_;
+
+  DISALLOW_COPY_AND_ASSIGN(TmpFsHandler);
+};
+
+class TmpFile : public FileStream {
+ public:
+  TmpFile(int fd, int oflag, TmpFsHandler* handler, TmpFsNode* node);
+  virtual ~TmpFile();
+
+  virtual void addref();
+  virtual void release();
+  virtual FileStream* dup(int fd);
+
+  virtual void close();
+  virtual int read(char* buf, size_t count, size_t* nread);
+  virtual int write(const char* buf, size_t count, size_t* nwrote);
+  virtual int seek(nacl_abi_off_t offset, int whence,
+                   nacl_abi_off_t* new_offset);
+  virtual int fstat(nacl_abi_stat* out);
+
+  virtual int fcntl(int cmd,  va_list ap);
+
+ private:
+  int ref_;
+  int fd_;
+  int oflag_;
+  TmpFsHandler* handler_;
+  TmpFsNode* node_;
+  nacl_abi_off_t offset_;
+
+  DISALLOW_COPY_AND_ASSIGN(TmpFile);
+};
+
+// A directory opened for getdents(); the entries are listed when it is
+// opened.
+class TmpDir : public FileStream {
+ public:
+  TmpDir(int fd, TmpFsNode* node, const std::vector<std::string>& names);
+  virtual ~TmpDir();
+
+  virtual void addref();
+  virtual void release();
+  virtual FileStream* dup(int fd);
+
+  virtual void close();
+  virtual int read(char* buf, size_t count, size_t* nread);
+  virtual int write(const char* buf, size_t count, size_t* nwrote);
+  virtual int fstat(nacl_abi_stat* out);
+  virtual int getdents(dirent* buf, size_t count, size_t* nread);
+
+ private:
+  int ref_;
+  int fd_;
+  TmpFsNode* node_;
+  std::vector<std::string> names_;
+  size_t next_;
+
+  DISALLOW_COPY_AND_ASSIGN(TmpDir);
+};
+
+#endif  // TMP_FS_H
@@ -16,7 +16,8 @@
 
 UDPSocket::UDPSocket(int fd, int oflag)
   : ref_(1), fd_(fd), oflag_(oflag), factory_(this), socket_(NULL),
-    read_buf_(kBufSize), read_sent_(false), write_sent_(false) {
+    read_buf_(kBufSize), read_sent_(false), write_sent_(false),
+    closing_(false) {
 }
 
 UDPSocket::~UDPSocket() {
@@ -38,23 +39,18 @@ FileStream* UDPSocket::dup(int fd) {
 }
 
 bool UDPSocket::bind(const sockaddr* saddr, socklen_t addrlen) {
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&UDPSocket::Bind, saddr, addrlen, &result));
-  FileSystem* sys = FileSystem::GetFileSystem();
-  while (result == PP_OK_COMPLETIONPENDING)
-    sys->cond().wait(sys->mutex());
+  PepperOperation* op = new PepperOperation();
+  int32_t result = op->Run(
+      factory_.NewCallback(&UDPSocket::Bind, saddr, addrlen, op));
+  op->release();
   return result == PP_OK;
 }
 
 int UDPSocket::getsockname(sockaddr* name, socklen_t* namelen) {
-  int32_t result = PP_OK_COMPLETIONPENDING;
-  pp::Module::Get()->core()->CallOnMainThread(0,
-      factory_.NewCallback(&UDPSocket::GetBoundAddress,
-                           name, namelen, &result));
-  FileSystem* sys = FileSystem::GetFileSystem();
-  while (result == PP_OK_COMPLETIONPENDING)
-    sys->cond().wait(sys->mutex());
+  PepperOperation* op = new PepperOperation();
+  int32_t result = op->Run(
+      factory_.NewCallback(&UDPSocket::GetBoundAddress, name, namelen, op));
+  op->release();
   return result == PP_OK ? 0 : -1;
 }
 
@@ -112,13 +108,9 @@ ssize_t UDPSocket::recvfrom(char* buffer, size_t len, int flags,
 }
 
 void UDPSocket::close() {
-  if (socket_) {
-    int32_t result = PP_OK_COMPLETIONPENDING;
-    pp::Module::Get()->core()->CallOnMainThread(0,
-        factory_.NewCallback(&UDPSocket::Close, &result));
-    FileSystem* sys = FileSystem::GetFileSystem();
-    while (result == PP_OK_COMPLETIONPENDING)
-      sys->cond().wait(sys->mutex());
+  if (socket_ && !closing_) {
+    closing_ = true;
+    FileSystem::GetFileSystem()->DeferClose(fd_, this, false);
   }
 }
 
@@ -155,16 +147,15 @@ bool UDPSocket::is_exception() {
   return !is_open();
 }
 
-void UDPSocket::Close(int32_t result, int32_t* pres) {
-  FileSystem* sys = FileSystem::GetFileSystem();
+void UDPSocket::FinishClose() {
+  closing_ = false;
   delete socket_;
   socket_ = NULL;
-  *pres = PP_OK;
-  sys->cond().broadcast();
+  FileSystem::GetFileSystem()->CloseDone(this, false);
 }
 
 void UDPSocket::Bind(int32_t result, const sockaddr* saddr, socklen_t addrlen,
-                     int32_t* pres) {
+                     PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   assert(!socket_);
@@ -174,17 +165,17 @@ void UDPSocket::Bind(int32_t result, const sockaddr* saddr, socklen_t addrlen,
   if (FileSystem::CreateNetAddress(saddr, addrlen, &addr)) {
     LOG("UDPSocket::Bind: %d %s\n",
         fd_, pp::NetAddressPrivate::Describe(addr, true).c_str());
-    *pres = socket_->Bind(&addr,
-        factory_.NewCallback(&UDPSocket::OnBind, pres));
+    result = socket_->Bind(&addr,
+        factory_.NewCallback(&UDPSocket::OnBind, op));
   } else {
-    *pres = PP_ERROR_FAILED;
+    result = PP_ERROR_FAILED;
   }
 
-  if (*pres != PP_OK_COMPLETIONPENDING)
-    sys->cond().broadcast();
+  if (result != PP_OK_COMPLETIONPENDING)
+    op->Complete(result);
 }
 
-void UDPSocket::OnBind(int32_t result, int32_t* pres) {
+void UDPSocket::OnBind(int32_t result, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   if (result == PP_OK) {
@@ -194,12 +185,11 @@ void UDPSocket::OnBind(int32_t result, int32_t* pres) {
     delete socket_;
     socket_ = NULL;
   }
-  *pres = result;
-  sys->cond().broadcast();
+  op->Complete(result);
 }
 
 void UDPSocket::GetBoundAddress(int32_t result, sockaddr* name,
-                                socklen_t* namelen, int32_t* pres) {
+                                socklen_t* namelen, PepperOperation* op) {
   FileSystem* sys = FileSystem::GetFileSystem();
   Mutex::Lock lock(sys->mutex());
   PP_NetAddress_Private addr = {};
@@ -207,14 +197,13 @@ void UDPSocket::GetBoundAddress(int32_t result, sockaddr* name,
     LOG("UDPSocket::GetBoundAddress: %d %s\n",
         fd_, pp::NetAddressPrivate::Describe(addr, true).c_str());
     if (FileSystem::CreateSocketAddress(addr, name, namelen)) {
-      *pres = PP_OK;
+      op->Complete(PP_OK);
     } else {
-      *pres = PP_ERROR_FAILED;
+      op->Complete(PP_ERROR_FAILED);
     }
   } else {
-    *pres = PP_ERROR_FAILED;
+    op->Complete(PP_ERROR_FAILED);
   }
-  sys->cond().broadcast();
 }
 
 void UDPSocket::Read(int32_t result) {
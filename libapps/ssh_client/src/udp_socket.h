@@ -16,6 +16,7 @@
 #include "ppapi/cpp/private/udp_socket_private.h"
 
 #include "file_system.h"
+#include "pepper_operation.h"
 #include "pthread_helpers.h"
 
 class UDPSocket : public FileStream {
@@ -49,17 +50,17 @@ class UDPSocket : public FileStream {
   virtual bool is_write_ready();
   virtual bool is_exception();
 
+  virtual void FinishClose();
+
  private:
   typedef std::deque<std::pair<sockaddr_in6, std::vector<char> > > MessageQueue;
 
-  void Close(int32_t result, int32_t* pres);
-
   void Bind(int32_t result, const sockaddr* saddr, socklen_t addrlen,
-            int32_t* pres);
-  void OnBind(int32_t result, int32_t* pres);
+            PepperOperation* op);
+  void OnBind(int32_t result, PepperOperation* op);
 
   void GetBoundAddress(int32_t result, sockaddr* name, socklen_t* namelen,
-                       int32_t* pres);
+                       PepperOperation* op);
 
   void Read(int32_t result);
   void OnRead(int32_t result);
@@ -88,6 +89,7 @@ class UDPSocket : public FileStream {
   PP_NetAddress_Private write_addr_;
   bool read_sent_;
   bool write_sent_;
+  bool closing_;
 
   DISALLOW_COPY_AND_ASSIGN(UDPSocket);
 };
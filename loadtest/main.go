@@ -0,0 +1,390 @@
+// Command loadtest measures how many clients a gotty server can handle and
+// where it saturates. It runs the server in process with a synthetic
+// command, which is this program in generator mode, and drives simulated
+// clients speaking the gotty protocol over loopback.
+//
+//	go build ./loadtest && ./loadtest -clients 200 -mode stream -duration 30s
+package main
+
+import (
+	"bytes"
+	"encoding/base64"
+	"encoding/json"
+	"flag"
+	"fmt"
+	"io"
+	"io/ioutil"
+	"log"
+	"net"
+	"net/http"
+	"os"
+	"path/filepath"
+	"runtime"
+	"sort"
+	"strconv"
+	"sync"
+	"time"
+
+	"github.com/gorilla/websocket"
+	"github.com/q1051278389/gotty/app"
+)
+
+var (
+	generate = flag.String("generate", "", "Run as the synthetic command in the given mode (used internally)")
+
+	mode     = flag.String("mode", "stream", "Workload: stream (steady output), bursty (bursts of output) or echo (interactive typing)")
+	clients  = flag.Int("clients", 10, "Number of simulated clients")
+	duration = flag.Duration("duration", 10*time.Second, "How long to run the workload")
+	rampUp   = flag.Duration("ramp-up", time.Second, "Time to spread client connections over")
+	rate     = flag.Int("rate", 0, "Bytes per second written by each stream command, 0 for as fast as possible")
+	burst    = flag.Int("burst", 256*1024, "Bytes written by each bursty command per burst")
+	interval = flag.Duration("interval", time.Second, "Time between bursts, or between keystrokes in echo mode")
+	binary   = flag.Bool("binary", true, "Receive output in binary frames instead of base64 text")
+	ack      = flag.Bool("ack", true, "Acknowledge output, enabling flow control")
+	port     = flag.String("port", "18080", "Port for the server to listen on")
+	verbose  = flag.Bool("verbose", false, "Show the server log")
+
+	flushDelay = flag.Int("flush-delay", app.DefaultOptions.FlushDelay, "Server flush delay in milliseconds")
+	flowWindow = flag.Int("flow-window", app.DefaultOptions.FlowWindow, "Server flow control window in bytes")
+	poolSize   = flag.Int("pool-size", app.DefaultOptions.PoolSize, "Number of processes the server starts ahead of time")
+)
+
+// line is the output unit of the generators, close to a line of a log.
+var line = []byte("2016/01/01 00:00:00 [info] request completed in 0.0123s: GET /api/v1/items?page=42 200 OK\r\n")
+
+func main() {
+	flag.Parse()
+
+	if *generate != "" {
+		runGenerator(*generate)
+		return
+	}
+
+	if !*verbose {
+		log.SetOutput(ioutil.Discard)
+	}
+	if err := runLoad(); err != nil {
+		fmt.Fprintln(os.Stderr, "Error:", err)
+		os.Exit(1)
+	}
+}
+
+func runGenerator(mode string) {
+	switch mode {
+	case "stream":
+		var throttle <-chan time.Time
+		perTick := 0
+		if *rate > 0 {
+			// Write in 10ms slices of the rate
+			throttle = time.Tick(10 * time.Millisecond)
+			perTick = *rate / 100
+		}
+		chunk := bytes.Repeat(line, 64)
+		for {
+			if throttle == nil {
+				if _, err := os.Stdout.Write(chunk); err != nil {
+					return
+				}
+				continue
+			}
+			<-throttle
+			for written := 0; written < perTick; written += len(line) {
+				if _, err := os.Stdout.Write(line); err != nil {
+					return
+				}
+			}
+		}
+
+	case "bursty":
+		chunk := bytes.Repeat(line, *burst/len(line)+1)[:*burst]
+		for {
+			if _, err := os.Stdout.Write(chunk); err != nil {
+				return
+			}
+			time.Sleep(*interval)
+		}
+
+	case "echo":
+		io.Copy(os.Stdout, os.Stdin)
+
+	default:
+		fmt.Fprintln(os.Stderr, "Unknown generator mode:", mode)
+		os.Exit(1)
+	}
+}
+
+// clientStats are the measurements of one simulated client.
+type clientStats struct {
+	connected   bool
+	firstOutput time.Duration
+	bytes       int64
+	frames      int64
+	latencies   []time.Duration
+}
+
+func runLoad() error {
+	if *mode != "stream" && *mode != "bursty" && *mode != "echo" {
+		return fmt.Errorf("unknown mode %q", *mode)
+	}
+
+	self, err := filepath.Abs(os.Args[0])
+	if err != nil {
+		return err
+	}
+	command := []string{
+		self, "-generate", *mode,
+		"-rate", strconv.Itoa(*rate),
+		"-burst", strconv.Itoa(*burst),
+		"-interval", interval.String(),
+	}
+
+	options := app.DefaultOptions
+	options.Address = "127.0.0.1"
+	options.Port = *port
+	options.PermitWrite = true
+	options.FlushDelay = *flushDelay
+	options.FlowWindow = *flowWindow
+	options.PoolSize = *poolSize
+	if err := app.CheckConfig(&options); err != nil {
+		return err
+	}
+	server, err := app.New(command, &options)
+	if err != nil {
+		return err
+	}
+
+	serverDone := make(chan error, 1)
+	go func() { serverDone <- server.Run() }()
+	if err := waitForServer(net.JoinHostPort(options.Address, options.Port), serverDone); err != nil {
+		return err
+	}
+
+	runtime.GC()
+	var baseline runtime.MemStats
+	runtime.ReadMemStats(&baseline)
+	baseGoroutines := runtime.NumGoroutine()
+
+	url := "ws://" + net.JoinHostPort(options.Address, options.Port) + "/ws"
+	stop := make(chan bool)
+	stats := make([]*clientStats, *clients)
+	wg := &sync.WaitGroup{}
+	start := time.Now()
+	for i := range stats {
+		stats[i] = &clientStats{}
+		wg.Add(1)
+		go func(s *clientStats) {
+			defer wg.Done()
+			runClient(url, s, stop)
+		}(stats[i])
+		if *clients > 1 {
+			time.Sleep(*rampUp / time.Duration(*clients))
+		}
+	}
+
+	// Sample in the middle of the steady state
+	time.Sleep(*duration / 2)
+	runtime.GC()
+	var loaded runtime.MemStats
+	runtime.ReadMemStats(&loaded)
+	goroutines := runtime.NumGoroutine()
+
+	time.Sleep(*duration / 2)
+	close(stop)
+	wg.Wait()
+	elapsed := time.Since(start)
+
+	server.Exit()
+	select {
+	case <-serverDone:
+	case <-time.After(10 * time.Second):
+		fmt.Fprintln(os.Stderr, "Server did not exit in time")
+	}
+
+	report(stats, elapsed, goroutines-baseGoroutines, int64(loaded.HeapInuse)-int64(baseline.HeapInuse))
+	return nil
+}
+
+func waitForServer(address string, serverDone chan error) error {
+	for i := 0; i < 100; i++ {
+		select {
+		case err := <-serverDone:
+			return err
+		default:
+		}
+		if conn, err := net.Dial("tcp", address); err == nil {
+			conn.Close()
+			return nil
+		}
+		time.Sleep(50 * time.Millisecond)
+	}
+	return fmt.Errorf("server is not listening on %s", address)
+}
+
+// runClient connects to the server and reads output until stopped, typing
+// into the terminal in echo mode.
+func runClient(url string, s *clientStats, stop chan bool) {
+	header := http.Header{}
+	header.Set("Sec-WebSocket-Protocol", "gotty")
+	started := time.Now()
+	conn, _, err := websocket.DefaultDialer.Dial(url, header)
+	if err != nil {
+		return
+	}
+	defer conn.Close()
+
+	writeMutex := &sync.Mutex{}
+	write := func(data []byte) error {
+		writeMutex.Lock()
+		defer writeMutex.Unlock()
+		return conn.WriteMessage(websocket.TextMessage, data)
+	}
+
+	init, _ := json.Marshal(app.InitMessage{Binary: *binary, FlowControl: *ack})
+	if err := write(init); err != nil {
+		return
+	}
+	s.connected = true
+
+	// The keystroke waiting for its echo, guarded by echoMutex
+	echoMutex := &sync.Mutex{}
+	var expected []byte
+	var sent time.Time
+	var recent []byte
+	echoed := make(chan bool, 1)
+
+	done := make(chan bool)
+	go func() {
+		defer close(done)
+		for {
+			messageType, data, err := conn.ReadMessage()
+			if err != nil || len(data) == 0 {
+				return
+			}
+			if data[0] != '0' {
+				continue
+			}
+
+			output := data[1:]
+			if messageType == websocket.TextMessage {
+				if output, err = base64.StdEncoding.DecodeString(string(output)); err != nil {
+					return
+				}
+			}
+			if s.frames == 0 {
+				s.firstOutput = time.Since(started)
+			}
+			s.frames++
+			s.bytes += int64(len(output))
+
+			if *ack {
+				if err := write([]byte("3" + strconv.FormatInt(s.bytes, 10))); err != nil {
+					return
+				}
+			}
+
+			echoMutex.Lock()
+			if expected != nil {
+				recent = append(recent, output...)
+				if bytes.Contains(recent, expected) {
+					s.latencies = append(s.latencies, time.Since(sent))
+					expected, recent = nil, recent[:0]
+					echoed <- true
+				} else if len(recent) > 4096 {
+					recent = append(recent[:0], recent[len(recent)-len(expected):]...)
+				}
+			}
+			echoMutex.Unlock()
+		}
+	}()
+
+	if *mode == "echo" {
+		for keystroke := 0; ; keystroke++ {
+			token := []byte("<" + strconv.Itoa(keystroke) + ">")
+			echoMutex.Lock()
+			expected, sent = token, time.Now()
+			echoMutex.Unlock()
+			if err := write(append(append([]byte{'0'}, token...), '\r')); err != nil {
+				break
+			}
+
+			select {
+			case <-echoed:
+			case <-done:
+				return
+			case <-stop:
+				conn.Close()
+				<-done
+				return
+			}
+			select {
+			case <-time.After(*interval):
+			case <-stop:
+				conn.Close()
+				<-done
+				return
+			}
+		}
+	}
+
+	select {
+	case <-stop:
+		conn.Close()
+	case <-done:
+	}
+	<-done
+}
+
+func report(stats []*clientStats, elapsed time.Duration, goroutines int, heap int64) {
+	connected := 0
+	var totalBytes, totalFrames int64
+	var latencies, firstOutputs []time.Duration
+	for _, s := range stats {
+		if !s.connected {
+			continue
+		}
+		connected++
+		totalBytes += s.bytes
+		totalFrames += s.frames
+		latencies = append(latencies, s.latencies...)
+		if s.frames > 0 {
+			firstOutputs = append(firstOutputs, s.firstOutput)
+		}
+	}
+
+	fmt.Printf("mode %s, %d clients, %s\n", *mode, len(stats), elapsed-elapsed%time.Millisecond)
+	fmt.Printf("connected:      %d (%d failed)\n", connected, len(stats)-connected)
+	fmt.Printf("output:         %.1f MB, %.1f MB/s\n",
+		float64(totalBytes)/1e6, float64(totalBytes)/1e6/elapsed.Seconds())
+	if totalFrames > 0 {
+		fmt.Printf("frames:         %d, %.0f/s, %.1f KB on average\n",
+			totalFrames, float64(totalFrames)/elapsed.Seconds(), float64(totalBytes)/float64(totalFrames)/1e3)
+	}
+	fmt.Printf("first output:   %s\n", percentiles(firstOutputs))
+	if *mode == "echo" {
+		fmt.Printf("echo latency:   %s\n", percentiles(latencies))
+	}
+	if connected > 0 {
+		// Both include the simulated clients, which are in the same process
+		fmt.Printf("per session:    %.1f goroutines, %.1f KB of heap\n",
+			float64(goroutines)/float64(connected), float64(heap)/float64(connected)/1e3)
+	}
+}
+
+func percentiles(durations []time.Duration) string {
+	if len(durations) == 0 {
+		return "no samples"
+	}
+	sort.Sort(byDuration(durations))
+	at := func(p float64) time.Duration {
+		d := durations[int(p*float64(len(durations)-1))]
+		return d - d%time.Microsecond
+	}
+	return fmt.Sprintf("p50 %s, p90 %s, p99 %s, max %s (%d samples)",
+		at(0.5), at(0.9), at(0.99), at(1), len(durations))
+}
+
+type byDuration []time.Duration
+
+func (d byDuration) Len() int           { return len(d) }
+func (d byDuration) Less(i, j int) bool { return d[i] < d[j] }
+func (d byDuration) Swap(i, j int)      { d[i], d[j] = d[j], d[i] }
@@ -33,6 +33,7 @@ func main() {
 		flag{"title-format", "", "Title format of browser window"},
 		flag{"reconnect", "", "Enable reconnection"},
 		flag{"reconnect-time", "", "Time to reconnect"},
+		flag{"reconnect-grace", "", "Seconds to keep the command running for a reconnecting client, 0 to stop it on disconnection"},
 		flag{"timeout", "", "Timeout seconds for waiting a client (0 to disable)"},
 		flag{"max-connection", "", "Maximum connection to gotty, 0(default) means no limit"},
 		flag{"once", "", "Accept only one client and exit on disconnection"},
@@ -40,6 +41,16 @@ func main() {
 		flag{"close-signal", "", "Signal sent to the command process when gotty close it (default: SIGHUP)"},
 		flag{"width", "", "Static width of the screen, 0(default) means dynamically resize"},
 		flag{"height", "", "Static height of the screen, 0(default) means dynamically resize"},
+		flag{"flush-size", "", "Maximum bytes of output coalesced into one websocket frame"},
+		flag{"pool-size", "", "Number of processes started ahead of time for clients without arguments, 0(default) to disable"},
+		flag{"broadcast", "", "Run one command shared by all clients, only the first client can write"},
+		flag{"flush-delay", "", "Milliseconds to wait for more output before sending a frame, 0 to send immediately"},
+		flag{"flow-window", "", "Maximum bytes of output sent to a client but not yet displayed, 0 to disable"},
+		flag{"write-timeout", "", "Seconds to wait for a write to a client before disconnecting it, 0 to disable"},
+		flag{"metrics", "", "Expose metrics in the Prometheus text format at /metrics"},
+		flag{"compression-level", "", "Compression level of websocket messages (1-9), 0 to disable compression"},
+		flag{"compression-threshold", "", "Minimum bytes of a websocket message to compress it"},
+		flag{"compression-context-takeover", "", "Keep the compression state between messages, compressing better with more memory per client"},
 	}
 
 	mappingHint := map[string]string{
@@ -50,6 +61,7 @@ func main() {
 		"tls-ca-crt": "TLSCACrtFile",
 		"random-url": "EnableRandomUrl",
 		"reconnect":  "EnableReconnect",
+		"metrics":    "EnableMetrics",
 	}
 
 	cliFlags, err := generateFlags(flags, mappingHint)
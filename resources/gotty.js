@@ -5,23 +5,59 @@
     var protocols = ["gotty"];
     var autoReconnect = -1;
 
-    var openWs = function() {
-        var ws = new WebSocket(url, protocols);
+    var ws;
+    var term;
+
+    // Session to resume and the number of output bytes received from it
+    var session = null;
+    var offset = 0;
+
+    // Output bytes displayed on this connection, acknowledged to the server
+    // when it enables flow control
+    var flowControl = false;
+    var consumed = 0;
+    var ackTimer = null;
 
-        var term;
+    // Time the last ping was sent and the round trip time of the previous
+    // one in milliseconds, reported to the server with the next ping
+    var pingSent = null;
+    var pingRTT = "";
+
+    var openWs = function() {
+        ws = new WebSocket(url, protocols);
+        ws.binaryType = "arraybuffer";
 
         var pingTimer;
 
         ws.onopen = function(event) {
-            ws.send(JSON.stringify({ Arguments: args, AuthToken: gotty_auth_token,}));
+            flowControl = false;
+            consumed = 0;
+            clearTimeout(ackTimer);
+            ackTimer = null;
+            pingSent = null;
+            pingRTT = "";
+            ws.send(JSON.stringify({ Arguments: args, AuthToken: gotty_auth_token, Binary: true, SessionID: session, Offset: offset, FlowControl: true,}));
             pingTimer = setInterval(sendPing, 30 * 1000, ws);
 
+            if (term) {
+                term.io.showOverlay("Reconnected");
+                term.installKeyboard();
+                term.io.onTerminalResize(term.screenSize.width, term.screenSize.height);
+                return;
+            }
+
             hterm.defaultStorage = new lib.Storage.Local();
             hterm.defaultStorage.clear();
 
             term = new hterm.Terminal();
 
             term.getPrefs().set("send-encoding", "raw");
+            term.getPrefs().set("batch-rendering", true);
+            term.getPrefs().set("worker-parsing", true);
+
+            // Output is drawn once per animation frame, and only drawn
+            // output is acknowledged
+            term.onOutputRendered = acknowledge;
 
             term.onTerminalReady = function() {
                 var io = term.io.push();
@@ -50,13 +86,27 @@
         };
 
         ws.onmessage = function(event) {
+            if (event.data instanceof ArrayBuffer) {
+                // Binary frames carry raw output after the opcode, decoded
+                // by hterm without a byte string in between
+                var output = new Uint8Array(event.data, 1);
+                offset += output.length;
+                term.io.writeUTF8(output);
+                return;
+            }
+
             data = event.data.slice(1);
             switch(event.data[0]) {
             case '0':
-                term.io.writeUTF8(window.atob(data));
+                var output = window.atob(data);
+                offset += output.length;
+                term.io.writeUTF8(output);
                 break;
             case '1':
-                // pong
+                if (pingSent != null) {
+                    pingRTT = String(Date.now() - pingSent);
+                    pingSent = null;
+                }
                 break;
             case '2':
                 term.setWindowTitle(data);
@@ -72,6 +122,19 @@
                 autoReconnect = JSON.parse(data);
                 console.log("Enabling reconnect: " + autoReconnect + " seconds")
                 break;
+            case '5':
+                var info = JSON.parse(data);
+                if (session != null && info.ID != session) {
+                    // The previous session is gone, start over
+                    term.reset();
+                }
+                session = info.ID;
+                offset = info.Offset;
+                break;
+            case '6':
+                flowControl = true;
+                console.log("Enabling flow control: " + JSON.parse(data) + " bytes")
+                break;
             }
         };
 
@@ -89,7 +152,23 @@
 
 
     var sendPing = function(ws) {
-        ws.send("1");
+        ws.send("1" + pingRTT);
+        pingSent = Date.now();
+    }
+
+    // Acknowledges displayed output once the current burst of messages has
+    // been handled
+    var acknowledge = function(size) {
+        consumed += size;
+        if (!flowControl || ackTimer != null) {
+            return;
+        }
+        ackTimer = setTimeout(function() {
+            ackTimer = null;
+            if (ws.readyState == WebSocket.OPEN) {
+                ws.send("3" + consumed);
+            }
+        }, 0);
     }
 
     openWs();